@@ -0,0 +1,284 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+/*
+ * Measures the primitives of `AstContext`: the construction of deep and wide DAGs, the
+ * garbage collection, the traversals, the representations and the evaluation.
+ *
+ * Besides the time, each benchmark reports the nodes allocated by iteration, the bytes
+ * reserved by the node pool and the peak memory of the process. The peak memory never
+ * decreases, it is the one of the process once the benchmark is done.
+ *
+ * The benchmarks which allocate nodes on each iteration collect them every
+ * `garbageInterval` iterations, outside of the timing.
+ */
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <triton/api.hpp>
+#include <triton/ast.hpp>
+#include <triton/astContext.hpp>
+
+#include "benchmark.hpp"
+
+
+
+namespace triton {
+  namespace benchmarks {
+
+    /* The number of iterations between two collections of the dead nodes */
+    static const triton::usize garbageInterval = 16;
+
+
+    /* A context with two 64-bit variables */
+    class Context {
+      public:
+        triton::API api;
+        triton::ast::SharedAstContext ast;
+        triton::engines::symbolic::SharedSymbolicVariable x;
+        triton::engines::symbolic::SharedSymbolicVariable y;
+        triton::ast::SharedAbstractNode xNode;
+        triton::ast::SharedAbstractNode yNode;
+
+        Context(bool hashConsing=false) {
+          this->api.setArchitecture(triton::arch::ARCH_X86_64);
+          this->api.setMode(triton::modes::AST_HASH_CONSING, hashConsing);
+          this->ast = this->api.getAstContext();
+          this->x   = this->api.newSymbolicVariable(64, "x");
+          this->y   = this->api.newSymbolicVariable(64, "y");
+
+          /* The values of the variables are bound to their nodes */
+          this->xNode = this->ast->variable(this->x);
+          this->yNode = this->ast->variable(this->y);
+          this->ast->updateVariable(this->x->getId(), 0x1122334455667788);
+          this->ast->updateVariable(this->y->getId(), 0x0123456789abcdef);
+        }
+    };
+
+
+    /* Builds a chain of `depth` operations over x and y */
+    static triton::ast::SharedAbstractNode buildDeep(Context& ctx, triton::usize depth) {
+      const auto& x = ctx.xNode;
+      const auto& y = ctx.yNode;
+      auto node     = x;
+
+      for (triton::usize index = 0; index < depth; index++) {
+        switch (index % 4) {
+          case 0:  node = ctx.ast->bvadd(node, y); break;
+          case 1:  node = ctx.ast->bvxor(node, ctx.ast->bv(index, 64)); break;
+          case 2:  node = ctx.ast->bvmul(node, x); break;
+          default: node = ctx.ast->bvsub(node, ctx.ast->bv(index, 64)); break;
+        }
+      }
+
+      return node;
+    }
+
+
+    /* Builds a balanced tree over `width` leaves */
+    static triton::ast::SharedAbstractNode buildWide(Context& ctx, triton::usize width) {
+      const auto& x = ctx.xNode;
+      const auto& y = ctx.yNode;
+      std::vector<triton::ast::SharedAbstractNode> level;
+
+      level.reserve(width);
+      for (triton::usize index = 0; index < width; index++)
+        level.push_back(ctx.ast->bvxor((index & 1) ? x : y, ctx.ast->bv(index, 64)));
+
+      while (level.size() > 1) {
+        std::vector<triton::ast::SharedAbstractNode> next;
+        next.reserve((level.size() + 1) / 2);
+        for (triton::usize index = 0; index + 1 < level.size(); index += 2)
+          next.push_back((next.size() & 1) ? ctx.ast->bvand(level[index], level[index + 1]) : ctx.ast->bvadd(level[index], level[index + 1]));
+        if (level.size() & 1)
+          next.push_back(level.back());
+        level.swap(next);
+      }
+
+      return level.front();
+    }
+
+
+    /* Builds a chain of `depth` symbolic expressions, each one referencing the previous one */
+    static triton::ast::SharedAbstractNode buildReferences(Context& ctx, triton::usize depth) {
+      auto node = ctx.xNode;
+
+      for (triton::usize index = 0; index < depth; index++) {
+        auto expr = ctx.api.newSymbolicExpression(ctx.ast->bvadd(node, ctx.yNode));
+        node = ctx.ast->reference(expr);
+      }
+
+      return node;
+    }
+
+
+    /* Sets the memory counters of a benchmark */
+    static void setCounters(State& state, Context& ctx, triton::usize nodes) {
+      state.counters["nodes/iter"]     = static_cast<double>(getAllocatedNodes(ctx.api) - nodes) / state.getIterations();
+      state.counters["reserved_bytes"] = static_cast<double>(getReservedBytes(ctx.api));
+      state.counters["peak_bytes"]     = static_cast<double>(getPeakMemory());
+    }
+
+
+    /* Collects the dead nodes every `garbageInterval` iterations, outside of the timing */
+    static void collect(State& state, Context& ctx, triton::usize iteration) {
+      if (iteration % garbageInterval == 0) {
+        state.pauseTiming();
+        ctx.ast->garbage();
+        state.resumeTiming();
+      }
+    }
+
+
+    static void buildDeepDag(State& state, triton::usize depth, bool hashConsing) {
+      Context ctx(hashConsing);
+      triton::usize nodes = getAllocatedNodes(ctx.api);
+      triton::usize iteration = 0;
+
+      while (state.keepRunning()) {
+        buildDeep(ctx, depth);
+        collect(state, ctx, ++iteration);
+      }
+
+      setCounters(state, ctx, nodes);
+    }
+
+
+    static void buildWideDag(State& state, triton::usize width, bool hashConsing) {
+      Context ctx(hashConsing);
+      triton::usize nodes = getAllocatedNodes(ctx.api);
+      triton::usize iteration = 0;
+
+      while (state.keepRunning()) {
+        buildWide(ctx, width);
+        collect(state, ctx, ++iteration);
+      }
+
+      setCounters(state, ctx, nodes);
+    }
+
+
+    static void garbageDeepDag(State& state, triton::usize depth) {
+      Context ctx;
+      triton::usize nodes = getAllocatedNodes(ctx.api);
+      triton::usize freed = 0;
+
+      while (state.keepRunning()) {
+        state.pauseTiming();
+        buildDeep(ctx, depth);
+        triton::usize inUse = getBytesInUse(ctx.api);
+        state.resumeTiming();
+
+        ctx.ast->garbage();
+
+        state.pauseTiming();
+        freed += inUse - getBytesInUse(ctx.api);
+        state.resumeTiming();
+      }
+
+      setCounters(state, ctx, nodes);
+      state.counters["freed_bytes/iter"] = static_cast<double>(freed) / state.getIterations();
+    }
+
+
+    static void extractChildren(State& state, triton::usize depth, bool references) {
+      Context ctx;
+      auto root = references ? buildReferences(ctx, depth) : buildDeep(ctx, depth);
+      triton::usize nodes = getAllocatedNodes(ctx.api);
+      triton::usize extracted = 0;
+
+      while (state.keepRunning())
+        extracted = triton::ast::childrenExtraction(root, true, false).size();
+
+      setCounters(state, ctx, nodes);
+      state.counters["children"] = static_cast<double>(extracted);
+    }
+
+
+    static void unrollReferences(State& state, triton::usize depth) {
+      Context ctx;
+      auto root = buildReferences(ctx, depth);
+      triton::usize nodes = getAllocatedNodes(ctx.api);
+      triton::usize iteration = 0;
+
+      while (state.keepRunning()) {
+        triton::ast::unroll(root);
+        collect(state, ctx, ++iteration);
+      }
+
+      setCounters(state, ctx, nodes);
+    }
+
+
+    static void printDeepDag(State& state, triton::usize depth, triton::ast::representations::mode_e mode) {
+      Context ctx;
+      auto root = buildDeep(ctx, depth);
+      triton::usize nodes = getAllocatedNodes(ctx.api);
+      triton::usize length = 0;
+
+      ctx.ast->setRepresentationMode(mode);
+      while (state.keepRunning()) {
+        std::ostringstream stream;
+        stream << root.get();
+        length = static_cast<triton::usize>(stream.tellp());
+      }
+
+      setCounters(state, ctx, nodes);
+      state.counters["chars"] = static_cast<double>(length);
+    }
+
+
+    /* Updates a variable and evaluates the root again, the cone of the variable is evaluated again on update */
+    static void evaluateDag(State& state, triton::usize size, bool wide) {
+      Context ctx;
+      auto root = wide ? buildWide(ctx, size) : buildDeep(ctx, size);
+      triton::usize nodes = getAllocatedNodes(ctx.api);
+      triton::uint64 value = 0;
+      triton::uint512 result = 0;
+
+      while (state.keepRunning()) {
+        ctx.ast->updateVariable(ctx.x->getId(), ++value);
+        result ^= root->evaluate();
+      }
+
+      setCounters(state, ctx, nodes);
+      state.counters["checksum"] = static_cast<double>(static_cast<triton::uint32>(result));
+    }
+
+
+    static triton::usize registerAst(void) {
+      triton::usize count = 0;
+
+      for (triton::usize depth : {100, 1000, 10000}) {
+        count = registerBenchmark("ast/build/deep/" + std::to_string(depth), [depth](State& state) { buildDeepDag(state, depth, false); });
+        count = registerBenchmark("ast/build/deep_hash_consing/" + std::to_string(depth), [depth](State& state) { buildDeepDag(state, depth, true); });
+      }
+
+      for (triton::usize width : {128, 4096}) {
+        count = registerBenchmark("ast/build/wide/" + std::to_string(width), [width](State& state) { buildWideDag(state, width, false); });
+        count = registerBenchmark("ast/build/wide_hash_consing/" + std::to_string(width), [width](State& state) { buildWideDag(state, width, true); });
+      }
+
+      count = registerBenchmark("ast/garbage/deep/1000",                [](State& state) { garbageDeepDag(state, 1000); });
+      count = registerBenchmark("ast/children_extraction/deep/1000",    [](State& state) { extractChildren(state, 1000, false); });
+      count = registerBenchmark("ast/children_extraction/unroll/1000",  [](State& state) { extractChildren(state, 1000, true); });
+      count = registerBenchmark("ast/unroll/1000",                      [](State& state) { unrollReferences(state, 1000); });
+      count = registerBenchmark("ast/representation/smt/1000",          [](State& state) { printDeepDag(state, 1000, triton::ast::representations::SMT_REPRESENTATION); });
+      count = registerBenchmark("ast/representation/python/1000",       [](State& state) { printDeepDag(state, 1000, triton::ast::representations::PYTHON_REPRESENTATION); });
+      count = registerBenchmark("ast/evaluate/deep/1000",               [](State& state) { evaluateDag(state, 1000, false); });
+      count = registerBenchmark("ast/evaluate/wide/4096",               [](State& state) { evaluateDag(state, 4096, true); });
+
+      return count;
+    }
+
+
+    static triton::usize registered = registerAst();
+
+  }; /* benchmarks namespace */
+}; /* triton namespace */
@@ -0,0 +1,287 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <set>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+  #include <sys/resource.h>
+#endif
+
+#include <triton/exceptions.hpp>
+
+#include "benchmark.hpp"
+
+
+
+namespace triton {
+  namespace benchmarks {
+
+    /* A registered benchmark */
+    struct Benchmark {
+      std::string name;
+      std::function<void(State&)> function;
+    };
+
+
+    /* A result of a benchmark */
+    struct Result {
+      std::string name;
+      triton::usize iterations;
+      double nanoseconds;
+      std::map<std::string, double> counters;
+    };
+
+
+    /* The registered benchmarks, in order of registration */
+    static std::vector<Benchmark>& getBenchmarks(void) {
+      static std::vector<Benchmark> benchmarks;
+      return benchmarks;
+    }
+
+
+    State::State(triton::usize iterations) {
+      this->iterations = iterations;
+      this->remaining  = iterations;
+      this->elapsed    = std::chrono::steady_clock::duration::zero();
+      this->paused     = true;
+    }
+
+
+    bool State::keepRunning(void) {
+      if (this->remaining == this->iterations && this->paused)
+        this->resumeTiming();
+
+      if (this->remaining == 0) {
+        this->pauseTiming();
+        return false;
+      }
+
+      this->remaining--;
+      return true;
+    }
+
+
+    void State::pauseTiming(void) {
+      if (!this->paused) {
+        this->elapsed += std::chrono::steady_clock::now() - this->start;
+        this->paused = true;
+      }
+    }
+
+
+    void State::resumeTiming(void) {
+      if (this->paused) {
+        this->start  = std::chrono::steady_clock::now();
+        this->paused = false;
+      }
+    }
+
+
+    triton::usize State::getIterations(void) const {
+      return this->iterations;
+    }
+
+
+    double State::getSeconds(void) const {
+      return std::chrono::duration<double>(this->elapsed).count();
+    }
+
+
+    triton::usize registerBenchmark(const std::string& name, const std::function<void(State&)>& function) {
+      getBenchmarks().push_back({name, function});
+      return getBenchmarks().size();
+    }
+
+
+    triton::usize getAllocatedNodes(triton::API& api) {
+      return api.getAstContext()->getNodeAllocator().getPool()->getAllocations();
+    }
+
+
+    triton::usize getBytesInUse(triton::API& api) {
+      return api.getAstContext()->getNodeAllocator().getPool()->getBytesInUse();
+    }
+
+
+    triton::usize getReservedBytes(triton::API& api) {
+      return api.getAstContext()->getNodeAllocator().getPool()->getBytesReserved();
+    }
+
+
+    triton::usize getPeakMemory(void) {
+      #if defined(__unix__) || defined(__APPLE__)
+        struct rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) != 0)
+          return 0;
+        #if defined(__APPLE__)
+          return static_cast<triton::usize>(usage.ru_maxrss);
+        #else
+          return static_cast<triton::usize>(usage.ru_maxrss) * 1024;
+        #endif
+      #else
+        return 0;
+      #endif
+    }
+
+
+    /* Runs a benchmark with more iterations until a run lasts `minTime` seconds */
+    static Result run(const Benchmark& benchmark, double minTime) {
+      static const triton::usize maxIterations = 1000000000;
+      triton::usize iterations = 1;
+
+      while (true) {
+        State state(iterations);
+        benchmark.function(state);
+
+        double seconds = state.getSeconds();
+        if (seconds >= minTime || iterations >= maxIterations)
+          return {benchmark.name, iterations, seconds * 1e9 / iterations, state.counters};
+
+        /* Aims at the minimum time, by steps of 2 to 10 */
+        double factor = (seconds > 0) ? (minTime * 1.4 / seconds) : 10;
+        factor = std::min(10.0, std::max(2.0, factor));
+        iterations = std::min(maxIterations, static_cast<triton::usize>(iterations * factor));
+      }
+    }
+
+
+    /* Prints JSON strings, the names and counters are plain ASCII */
+    static std::string quote(const std::string& value) {
+      return "\"" + value + "\"";
+    }
+
+
+    static void report(const std::vector<Result>& results, const std::string& format) {
+      char buffer[64];
+
+      if (format == "json") {
+        std::cout << "{\n  \"benchmarks\": [";
+        for (triton::usize index = 0; index < results.size(); index++) {
+          const Result& result = results[index];
+          std::snprintf(buffer, sizeof(buffer), "%.3f", result.nanoseconds);
+          std::cout << (index ? ",\n" : "\n") << "    {\"name\": " << quote(result.name) << ", \"iterations\": " << result.iterations << ", \"ns_per_iteration\": " << buffer << ", \"counters\": {";
+          bool first = true;
+          for (const auto& counter : result.counters) {
+            std::snprintf(buffer, sizeof(buffer), "%.6g", counter.second);
+            std::cout << (first ? "" : ", ") << quote(counter.first) << ": " << buffer;
+            first = false;
+          }
+          std::cout << "}}";
+        }
+        std::cout << "\n  ]\n}" << std::endl;
+        return;
+      }
+
+      /* The counters of all results, one column each */
+      std::set<std::string> names;
+      for (const auto& result : results) {
+        for (const auto& counter : result.counters)
+          names.insert(counter.first);
+      }
+
+      if (format == "csv") {
+        std::cout << "name,iterations,ns_per_iteration";
+        for (const auto& name : names)
+          std::cout << "," << name;
+        std::cout << std::endl;
+
+        for (const auto& result : results) {
+          std::snprintf(buffer, sizeof(buffer), "%.3f", result.nanoseconds);
+          std::cout << result.name << "," << result.iterations << "," << buffer;
+          for (const auto& name : names) {
+            auto it = result.counters.find(name);
+            if (it != result.counters.end())
+              std::snprintf(buffer, sizeof(buffer), "%.6g", it->second);
+            std::cout << "," << (it != result.counters.end() ? buffer : "");
+          }
+          std::cout << std::endl;
+        }
+        return;
+      }
+
+      for (const auto& result : results) {
+        std::snprintf(buffer, sizeof(buffer), "%-56s %14.1f ns %12zu", result.name.c_str(), result.nanoseconds, static_cast<size_t>(result.iterations));
+        std::cout << buffer;
+        for (const auto& counter : result.counters) {
+          std::snprintf(buffer, sizeof(buffer), "  %s=%.4g", counter.first.c_str(), counter.second);
+          std::cout << buffer;
+        }
+        std::cout << std::endl;
+      }
+    }
+
+
+    static void usage(const char* program) {
+      std::cout << "Usage: " << program << " [--filter=<substring>] [--format=console|csv|json] [--min-time=<seconds>] [--list]" << std::endl;
+    }
+
+  }; /* benchmarks namespace */
+}; /* triton namespace */
+
+
+
+int main(int argc, char* argv[]) {
+  using namespace triton::benchmarks;
+
+  std::string filter;
+  std::string format = "console";
+  double minTime     = 0.5;
+  bool list          = false;
+
+  for (int index = 1; index < argc; index++) {
+    std::string arg = argv[index];
+    if (arg.compare(0, 9, "--filter=") == 0)
+      filter = arg.substr(9);
+    else if (arg.compare(0, 9, "--format=") == 0)
+      format = arg.substr(9);
+    else if (arg.compare(0, 11, "--min-time=") == 0)
+      minTime = std::atof(arg.substr(11).c_str());
+    else if (arg == "--list")
+      list = true;
+    else {
+      usage(argv[0]);
+      return (arg == "--help") ? 0 : 1;
+    }
+  }
+
+  if (format != "console" && format != "csv" && format != "json") {
+    usage(argv[0]);
+    return 1;
+  }
+
+  std::vector<Result> results;
+  int status = 0;
+
+  for (const auto& benchmark : getBenchmarks()) {
+    if (benchmark.name.find(filter) == std::string::npos)
+      continue;
+
+    if (list) {
+      std::cout << benchmark.name << std::endl;
+      continue;
+    }
+
+    try {
+      results.push_back(run(benchmark, minTime));
+    }
+    catch (const triton::exceptions::Exception& e) {
+      std::cerr << benchmark.name << ": " << e.what() << std::endl;
+      status = 1;
+    }
+  }
+
+  if (!list)
+    report(results, format);
+
+  return status;
+}
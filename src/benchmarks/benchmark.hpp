@@ -0,0 +1,92 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_BENCHMARK_HPP
+#define TRITON_BENCHMARK_HPP
+
+#include <chrono>
+#include <functional>
+#include <map>
+#include <string>
+
+#include <triton/api.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+  //! The Benchmarks namespace
+  namespace benchmarks {
+
+    /*! \class State
+     *  \brief The state of a run of a benchmark.
+     *
+     * \description
+     * A benchmark loops `while (state.keepRunning())`, the runner grows the number of iterations
+     * until a run lasts the minimum time. Only the time between the first call and the end of the
+     * loop is measured, minus the time spent paused.
+     */
+    class State {
+      private:
+        //! The number of iterations of the run.
+        triton::usize iterations;
+
+        //! The number of iterations left.
+        triton::usize remaining;
+
+        //! The measured time, up to the last pause.
+        std::chrono::steady_clock::duration elapsed;
+
+        //! The start of the current measure.
+        std::chrono::steady_clock::time_point start;
+
+        //! True while the timing is paused.
+        bool paused;
+
+      public:
+        //! The counters reported with the benchmark, by name, set once the loop is done.
+        std::map<std::string, double> counters;
+
+        //! Constructor.
+        State(triton::usize iterations);
+
+        //! Returns true while iterations are left. The timing starts on the first call and stops on the last one.
+        bool keepRunning(void);
+
+        //! Stops the timing, e.g. during a setup in the loop.
+        void pauseTiming(void);
+
+        //! Restarts the timing.
+        void resumeTiming(void);
+
+        //! Returns the number of iterations of the run.
+        triton::usize getIterations(void) const;
+
+        //! Returns the measured time in seconds.
+        double getSeconds(void) const;
+    };
+
+    //! Registers a benchmark under `name`. Returns the number of benchmarks registered.
+    triton::usize registerBenchmark(const std::string& name, const std::function<void(State&)>& function);
+
+    //! Returns the number of AST nodes allocated by the AST context of `api` so far.
+    triton::usize getAllocatedNodes(triton::API& api);
+
+    //! Returns the number of bytes used by the live nodes of the AST context of `api`.
+    triton::usize getBytesInUse(triton::API& api);
+
+    //! Returns the number of bytes reserved by the AST context of `api`.
+    triton::usize getReservedBytes(triton::API& api);
+
+    //! Returns the peak resident memory of the process in bytes, 0 if unknown.
+    triton::usize getPeakMemory(void);
+
+  }; /* benchmarks namespace */
+}; /* triton namespace */
+
+#endif /* TRITON_BENCHMARK_HPP */
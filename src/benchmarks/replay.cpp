@@ -0,0 +1,449 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+/*
+ * Replays a corpus of queries through the solvers, under several configurations of the
+ * solver engine, and reports the time of each query.
+ *
+ * A query is a file, either in SMT-LIB2 (see `Smt2ToTriton`, e.g. the ones dumped by
+ * `SolverStatistics::setSlowQueryDump()`) or in the binary format of `AstSerializer`.
+ * Its assertions, or the roots of its DAG, are the conjuncts of the query. The last
+ * conjunct is the one solved, the others are the path constraints it is solved with.
+ *
+ * The configurations are:
+ *
+ *   plain          the conjunction of the query is sent to the solver.
+ *   cache          the solver cache is enabled (see `SolverCache`).
+ *   slicing        the path constraints are pushed and only the ones relevant to the
+ *                  last conjunct are sent (see `API::getRelevantPathPredicate()`).
+ *   preprocessing  the queries are preprocessed (see `SolverPreprocessor`).
+ *   all            all of the above.
+ *
+ * Each solver and configuration replays the corpus in a new context, `--repeat` times
+ * so that the cache is hit from the second pass on.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+  #include <dirent.h>
+  #include <sys/stat.h>
+#endif
+
+#include <triton/api.hpp>
+#include <triton/astSerializer.hpp>
+#include <triton/config.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/smt2ToTriton.hpp>
+
+
+
+namespace triton {
+  namespace benchmarks {
+
+    /* The configurations of the solver engine */
+    enum configuration_e {
+      CONFIG_CACHE         = (1 << 0),
+      CONFIG_SLICING       = (1 << 1),
+      CONFIG_PREPROCESSING = (1 << 2),
+    };
+
+
+    /* A query of the corpus, loaded in a context */
+    struct Query {
+      //! The file of the query.
+      std::string path;
+
+      //! The conjuncts of the query, the last one is solved.
+      std::vector<triton::ast::SharedAbstractNode> conjuncts;
+
+      //! The variable nodes of the query, kept alive for the lifetime of the query.
+      std::vector<triton::ast::SharedAbstractNode> variables;
+    };
+
+
+    /* A replayed query */
+    struct Row {
+      std::string path;
+      std::string solver;
+      std::string configuration;
+      triton::usize pass;
+      triton::engines::solver::status_e status;
+      double milliseconds;
+      triton::uint32 solvingTime;
+      triton::usize nodes;
+      bool cached;
+    };
+
+
+    /* The options of the replay */
+    struct Options {
+      std::vector<std::string> solvers;
+      std::vector<std::string> configurations;
+      std::vector<std::string> external;
+      std::string format = "console";
+      triton::uint32 timeout = 10000;
+      triton::usize repeat = 1;
+      triton::usize cacheCapacity = 65536;
+    };
+
+
+    static const triton::usize serializedMagicSize = 7;
+
+
+    static std::vector<std::string> split(const std::string& value, char separator) {
+      std::vector<std::string> items;
+      std::istringstream stream(value);
+      std::string item;
+
+      while (std::getline(stream, item, separator)) {
+        if (!item.empty())
+          items.push_back(item);
+      }
+
+      return items;
+    }
+
+
+    static std::string getStatusName(triton::engines::solver::status_e status) {
+      switch (status) {
+        case triton::engines::solver::SAT:      return "sat";
+        case triton::engines::solver::UNSAT:    return "unsat";
+        case triton::engines::solver::TIMEOUT:  return "timeout";
+        case triton::engines::solver::OUTOFMEM: return "outofmem";
+        default:                                return "unknown";
+      }
+    }
+
+
+    /* Returns the solvers available in this build, `external` only if a command is given */
+    static std::vector<std::pair<std::string, triton::engines::solver::solver_e>> getSolvers(const Options& options) {
+      std::vector<std::pair<std::string, triton::engines::solver::solver_e>> solvers;
+
+      #ifdef TRITON_Z3_INTERFACE
+        solvers.push_back({"z3", triton::engines::solver::SOLVER_Z3});
+      #endif
+      #ifdef TRITON_BITWUZLA_INTERFACE
+        solvers.push_back({"bitwuzla", triton::engines::solver::SOLVER_BITWUZLA});
+      #endif
+      #if defined(TRITON_Z3_INTERFACE) || defined(TRITON_BITWUZLA_INTERFACE)
+        solvers.push_back({"portfolio", triton::engines::solver::SOLVER_PORTFOLIO});
+      #endif
+      solvers.push_back({"local_search", triton::engines::solver::SOLVER_LOCAL_SEARCH});
+      if (!options.external.empty())
+        solvers.push_back({"external", triton::engines::solver::SOLVER_EXTERNAL});
+
+      return solvers;
+    }
+
+
+    static triton::usize getConfiguration(const std::string& name) {
+      if (name == "plain")         return 0;
+      if (name == "cache")         return CONFIG_CACHE;
+      if (name == "slicing")       return CONFIG_SLICING;
+      if (name == "preprocessing") return CONFIG_PREPROCESSING;
+      if (name == "all")           return CONFIG_CACHE | CONFIG_SLICING | CONFIG_PREPROCESSING;
+      throw triton::exceptions::Exception("Unknown configuration: " + name);
+    }
+
+
+    /* Returns the files of the corpus, the directories are listed in order */
+    static std::vector<std::string> getFiles(const std::vector<std::string>& paths) {
+      std::vector<std::string> files;
+
+      for (const auto& path : paths) {
+        #if defined(__unix__) || defined(__APPLE__)
+          struct stat info;
+          if (stat(path.c_str(), &info) == 0 && S_ISDIR(info.st_mode)) {
+            std::vector<std::string> entries;
+            if (DIR* dir = opendir(path.c_str())) {
+              while (struct dirent* entry = readdir(dir)) {
+                std::string file = path + "/" + entry->d_name;
+                if (entry->d_name[0] != '.' && stat(file.c_str(), &info) == 0 && S_ISREG(info.st_mode))
+                  entries.push_back(file);
+              }
+              closedir(dir);
+            }
+            std::sort(entries.begin(), entries.end());
+            files.insert(files.end(), entries.begin(), entries.end());
+            continue;
+          }
+        #endif
+        files.push_back(path);
+      }
+
+      return files;
+    }
+
+
+    /* Splits the top-level conjunctions of `node` */
+    static void flatten(const triton::ast::SharedAbstractNode& node, std::vector<triton::ast::SharedAbstractNode>& conjuncts) {
+      if (node->getType() == triton::ast::LAND_NODE) {
+        for (const auto& child : node->getChildren())
+          flatten(child, conjuncts);
+        return;
+      }
+      conjuncts.push_back(node);
+    }
+
+
+    static std::vector<triton::ast::SharedAbstractNode> loadSerialized(triton::API& api, const std::string& path, Query& query) {
+      std::ifstream stream(path, std::ios::binary);
+      triton::ast::AstSerializer serializer(api.getAstContext());
+
+      auto roots = serializer.deserialize(stream);
+      for (const auto& var : serializer.getVariables())
+        query.variables.push_back(api.getAstContext()->variable(var));
+
+      return roots;
+    }
+
+
+    /* Parses a SMT-LIB2 file. Its constants are renamed as new symbolic variables of the context. */
+    static std::vector<triton::ast::SharedAbstractNode> loadSmt2(triton::API& api, const std::string& path, Query& query) {
+      std::ifstream stream(path);
+
+      triton::ast::Smt2ToTriton parser(api.getAstContext(), [&](const std::string& name, triton::uint32 size) {
+        auto var = api.newSymbolicVariable(size, name);
+        query.variables.push_back(api.getAstContext()->variable(var));
+        return var;
+      });
+
+      try {
+        return parser.parse(stream);
+      }
+      catch (const triton::exceptions::Exception& e) {
+        throw triton::exceptions::Exception(path + ": " + e.what());
+      }
+    }
+
+
+    static Query load(triton::API& api, const std::string& path) {
+      std::vector<triton::ast::SharedAbstractNode> roots;
+      char header[serializedMagicSize] = {0};
+      Query query;
+
+      std::ifstream stream(path, std::ios::binary);
+      if (!stream)
+        throw triton::exceptions::Exception("Cannot open " + path);
+      stream.read(header, sizeof(header));
+      stream.close();
+
+      query.path = path;
+      if (std::memcmp(header, "TRTNDAG", serializedMagicSize) == 0)
+        roots = loadSerialized(api, path, query);
+      else
+        roots = loadSmt2(api, path, query);
+
+      for (const auto& root : roots)
+        flatten(root, query.conjuncts);
+
+      if (query.conjuncts.empty())
+        throw triton::exceptions::Exception(path + ": The query is empty.");
+
+      return query;
+    }
+
+
+    /* Replays the corpus through a solver, under a configuration */
+    static void replay(const std::vector<std::string>& files, const std::pair<std::string, triton::engines::solver::solver_e>& solver, const std::string& configuration, const Options& options, std::vector<Row>& rows) {
+      triton::usize flags = getConfiguration(configuration);
+      std::vector<Query> queries;
+      std::vector<triton::usize> sizes;
+      triton::API api;
+
+      api.setArchitecture(triton::arch::ARCH_X86_64);
+      api.setSolver(solver.second);
+      if (solver.second == triton::engines::solver::SOLVER_EXTERNAL)
+        api.getSolverExternal()->setCommand(options.external);
+      api.setSolverTimeout(options.timeout);
+      api.getSolverCache()->setCapacity((flags & CONFIG_CACHE) ? options.cacheCapacity : 0);
+      api.getSolverPreprocessor()->setEnabled((flags & CONFIG_PREPROCESSING) != 0);
+
+      for (const auto& file : files) {
+        queries.push_back(load(api, file));
+        sizes.push_back(triton::ast::childrenExtraction(api.getAstContext()->land(queries.back().conjuncts), true, false).size());
+      }
+
+      for (triton::usize pass = 0; pass < options.repeat; pass++) {
+        for (triton::usize index = 0; index < queries.size(); index++) {
+          const Query& query = queries[index];
+          const auto& last = query.conjuncts.back();
+          triton::engines::solver::status_e status = triton::engines::solver::UNKNOWN;
+          triton::uint32 solvingTime = 0;
+
+          /* The path constraints are pushed outside of the timing, the slicing itself is timed */
+          if (flags & CONFIG_SLICING) {
+            api.clearPathConstraints();
+            for (triton::usize conjunct = 0; conjunct + 1 < query.conjuncts.size(); conjunct++)
+              api.pushPathConstraint(query.conjuncts[conjunct]);
+          }
+
+          triton::usize hits = api.getSolverCache()->getHits();
+          auto start = std::chrono::steady_clock::now();
+
+          triton::ast::SharedAbstractNode node;
+          if (flags & CONFIG_SLICING)
+            node = api.getAstContext()->land(api.getRelevantPathPredicate(last), last);
+          else
+            node = (query.conjuncts.size() == 1) ? last : api.getAstContext()->land(query.conjuncts);
+          api.getModel(node, &status, 0, &solvingTime);
+
+          auto elapsed = std::chrono::steady_clock::now() - start;
+          rows.push_back({
+            query.path, solver.first, configuration, pass, status,
+            std::chrono::duration<double, std::milli>(elapsed).count(), solvingTime, sizes[index],
+            api.getSolverCache()->getHits() != hits
+          });
+        }
+      }
+    }
+
+
+    static std::string quote(const std::string& value) {
+      std::string quoted = "\"";
+
+      for (char c : value) {
+        if (c == '"' || c == '\\')
+          quoted += '\\';
+        quoted += c;
+      }
+
+      return quoted + "\"";
+    }
+
+
+    static void report(const std::vector<Row>& rows, const std::string& format) {
+      char buffer[256];
+
+      if (format == "json") {
+        std::cout << "{\n  \"queries\": [";
+        for (triton::usize index = 0; index < rows.size(); index++) {
+          const Row& row = rows[index];
+          std::snprintf(buffer, sizeof(buffer), "%.3f", row.milliseconds);
+          std::cout << (index ? ",\n" : "\n") << "    {\"file\": " << quote(row.path) << ", \"solver\": " << quote(row.solver) << ", \"configuration\": " << quote(row.configuration)
+                    << ", \"pass\": " << row.pass << ", \"status\": " << quote(getStatusName(row.status)) << ", \"ms\": " << buffer << ", \"solver_ms\": " << row.solvingTime
+                    << ", \"nodes\": " << row.nodes << ", \"cached\": " << (row.cached ? "true" : "false") << "}";
+        }
+        std::cout << "\n  ]\n}" << std::endl;
+        return;
+      }
+
+      if (format == "csv") {
+        std::cout << "file,solver,configuration,pass,status,ms,solver_ms,nodes,cached" << std::endl;
+        for (const auto& row : rows) {
+          std::snprintf(buffer, sizeof(buffer), "%.3f", row.milliseconds);
+          std::cout << row.path << "," << row.solver << "," << row.configuration << "," << row.pass << "," << getStatusName(row.status) << "," << buffer << ","
+                    << row.solvingTime << "," << row.nodes << "," << (row.cached ? 1 : 0) << std::endl;
+        }
+        return;
+      }
+
+      /* The console prints the total of each solver and configuration */
+      for (triton::usize index = 0; index < rows.size();) {
+        triton::usize sat = 0, unsat = 0, other = 0, cached = 0;
+        double milliseconds = 0;
+        triton::usize end = index;
+
+        while (end < rows.size() && rows[end].solver == rows[index].solver && rows[end].configuration == rows[index].configuration) {
+          milliseconds += rows[end].milliseconds;
+          sat    += (rows[end].status == triton::engines::solver::SAT);
+          unsat  += (rows[end].status == triton::engines::solver::UNSAT);
+          other  += (rows[end].status != triton::engines::solver::SAT && rows[end].status != triton::engines::solver::UNSAT);
+          cached += rows[end].cached;
+          end++;
+        }
+
+        std::snprintf(buffer, sizeof(buffer), "%-16s %-16s %8zu queries %12.3f ms  sat=%zu unsat=%zu other=%zu cached=%zu",
+                      rows[index].solver.c_str(), rows[index].configuration.c_str(), static_cast<size_t>(end - index), milliseconds,
+                      static_cast<size_t>(sat), static_cast<size_t>(unsat), static_cast<size_t>(other), static_cast<size_t>(cached));
+        std::cout << buffer << std::endl;
+        index = end;
+      }
+    }
+
+
+    static void usage(const char* program) {
+      std::cout << "Usage: " << program << " [--solvers=<name,...>] [--configurations=plain,cache,slicing,preprocessing,all] [--format=console|csv|json]" << std::endl
+                << "       [--timeout=<ms>] [--repeat=<passes>] [--cache-capacity=<entries>] [--external=<command>] <file or directory>..." << std::endl;
+    }
+
+  }; /* benchmarks namespace */
+}; /* triton namespace */
+
+
+
+int main(int argc, char* argv[]) {
+  using namespace triton::benchmarks;
+
+  std::vector<std::string> paths;
+  Options options;
+
+  for (int index = 1; index < argc; index++) {
+    std::string arg = argv[index];
+    if (arg.compare(0, 10, "--solvers=") == 0)
+      options.solvers = split(arg.substr(10), ',');
+    else if (arg.compare(0, 17, "--configurations=") == 0)
+      options.configurations = split(arg.substr(17), ',');
+    else if (arg.compare(0, 9, "--format=") == 0)
+      options.format = arg.substr(9);
+    else if (arg.compare(0, 10, "--timeout=") == 0)
+      options.timeout = static_cast<triton::uint32>(std::strtoul(arg.substr(10).c_str(), nullptr, 10));
+    else if (arg.compare(0, 9, "--repeat=") == 0)
+      options.repeat = std::max<triton::usize>(1, std::strtoul(arg.substr(9).c_str(), nullptr, 10));
+    else if (arg.compare(0, 17, "--cache-capacity=") == 0)
+      options.cacheCapacity = std::strtoul(arg.substr(17).c_str(), nullptr, 10);
+    else if (arg.compare(0, 11, "--external=") == 0)
+      options.external = split(arg.substr(11), ' ');
+    else if (arg.compare(0, 2, "--") != 0)
+      paths.push_back(arg);
+    else {
+      usage(argv[0]);
+      return (arg == "--help") ? 0 : 1;
+    }
+  }
+
+  if (paths.empty() || (options.format != "console" && options.format != "csv" && options.format != "json")) {
+    usage(argv[0]);
+    return 1;
+  }
+
+  if (options.configurations.empty())
+    options.configurations = {"plain", "cache", "slicing", "preprocessing", "all"};
+
+  std::vector<std::string> files = getFiles(paths);
+  std::vector<Row> rows;
+  int status = 0;
+
+  for (const auto& solver : getSolvers(options)) {
+    if (!options.solvers.empty() && std::find(options.solvers.begin(), options.solvers.end(), solver.first) == options.solvers.end())
+      continue;
+
+    for (const auto& configuration : options.configurations) {
+      try {
+        replay(files, solver, configuration, options, rows);
+      }
+      catch (const triton::exceptions::Exception& e) {
+        std::cerr << solver.first << "/" << configuration << ": " << e.what() << std::endl;
+        status = 1;
+      }
+    }
+  }
+
+  report(rows, options.format);
+
+  return status;
+}
@@ -0,0 +1,224 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+/*
+ * Measures the throughput of `processing()` by family of instructions, under several
+ * combinations of modes, and the AST nodes each instruction allocates.
+ *
+ * A run processes the instructions of a family in a loop. The inputs of the family are
+ * symbolized and tainted, and the state is concretized again every `resetInterval`
+ * rounds, outside of the timing and of the nodes counted, so that the ASTs do not grow
+ * with the iterations.
+ */
+
+#include <string>
+#include <vector>
+
+#include <triton/api.hpp>
+
+#include "benchmark.hpp"
+
+
+
+namespace triton {
+  namespace benchmarks {
+
+    /* A family of instructions */
+    struct Family {
+      //! The name of the family.
+      const char* name;
+
+      //! The architecture.
+      triton::arch::architecture_e arch;
+
+      //! True if the instructions are Thumb ones.
+      bool thumb;
+
+      //! The instructions, processed in order.
+      std::vector<std::string> code;
+
+      //! The registers symbolized and tainted.
+      std::vector<std::string> inputs;
+
+      //! The concrete registers, by name.
+      std::vector<std::pair<std::string, triton::uint64>> registers;
+    };
+
+
+    /* A combination of modes */
+    struct Configuration {
+      //! The name of the configuration.
+      const char* name;
+
+      //! Sets the modes of a context.
+      void (*setup)(triton::API& api);
+    };
+
+
+    /* The number of rounds between two concretizations of the state */
+    static const triton::usize resetInterval = 256;
+
+
+    static const std::vector<Family> families = {
+      {"x86_64/alu", triton::arch::ARCH_X86_64, false, {
+        std::string("\x48\x01\xd8", 3),                 /* add rax, rbx                 */
+        std::string("\x48\x29\xd1", 3),                 /* sub rcx, rdx                 */
+        std::string("\x48\x0f\xaf\xc3", 4),             /* imul rax, rbx                */
+        std::string("\x25\x34\x12\x00\x00", 5),         /* and eax, 0x1234              */
+        std::string("\x48\xc1\xe2\x03", 4),             /* shl rdx, 3                   */
+        std::string("\x48\x8d\x74\xc3\x0a", 5),         /* lea rsi, [rbx+rax*8+0xa]     */
+        std::string("\x48\x8b\x44\x24\x08", 5),         /* mov rax, [rsp+8]             */
+        std::string("\x48\x89\x4c\x24\x10", 5),         /* mov [rsp+0x10], rcx          */
+      }, {"rbx", "rdx"}, {{"rsp", 0x7fff0000}}},
+
+      {"x86_64/flags", triton::arch::ARCH_X86_64, false, {
+        std::string("\x48\x39\xd8", 3),                 /* cmp rax, rbx                 */
+        std::string("\x85\xc9", 2),                     /* test ecx, ecx                */
+        std::string("\x48\x11\xd0", 3),                 /* adc rax, rdx                 */
+        std::string("\x0f\x94\xc0", 3),                 /* sete al                      */
+        std::string("\x48\x0f\x42\xca", 4),             /* cmovb rcx, rdx               */
+        std::string("\x9c", 1),                         /* pushfq                       */
+        std::string("\x9d", 1),                         /* popfq                        */
+        std::string("\x75\x00", 2),                     /* jne +0                       */
+      }, {"rbx", "rdx"}, {{"rsp", 0x7fff0000}}},
+
+      {"x86_64/simd", triton::arch::ARCH_X86_64, false, {
+        std::string("\x66\x0f\xfe\xc1", 4),             /* paddd xmm0, xmm1             */
+        std::string("\x66\x0f\xef\xd3", 4),             /* pxor xmm2, xmm3              */
+        std::string("\x66\x0f\x70\xc1\x1b", 5),         /* pshufd xmm0, xmm1, 0x1b      */
+        std::string("\x66\x0f\x74\xc1", 4),             /* pcmpeqb xmm0, xmm1           */
+        std::string("\x66\x0f\xd7\xd1", 4),             /* pmovmskb edx, xmm1           */
+        std::string("\xf3\x0f\x6f\x06", 4),             /* movdqu xmm0, [rsi]           */
+        std::string("\xc5\xf5\xfe\xc2", 4),             /* vpaddd ymm0, ymm1, ymm2      */
+        std::string("\xc5\xf5\xef\xc2", 4),             /* vpxor ymm0, ymm1, ymm2       */
+      }, {"xmm1", "ymm2"}, {{"rsi", 0x10000}}},
+
+      {"x86_64/string", triton::arch::ARCH_X86_64, false, {
+        std::string("\xf3\xa4", 2),                     /* rep movsb                    */
+        std::string("\xf3\xaa", 2),                     /* rep stosb                    */
+        std::string("\x48\xa5", 2),                     /* movsq                        */
+        std::string("\xa6", 1),                         /* cmpsb                        */
+        std::string("\xac", 1),                         /* lodsb                        */
+        std::string("\xae", 1),                         /* scasb                        */
+      }, {"al"}, {{"rcx", 0x10000000}, {"rsi", 0x10000}, {"rdi", 0x20000}}},
+
+      {"aarch64", triton::arch::ARCH_AARCH64, false, {
+        std::string("\x20\x00\x02\x8b", 4),             /* add x0, x1, x2               */
+        std::string("\x83\x04\x00\xf1", 4),             /* subs x3, x4, #1              */
+        std::string("\xe5\x07\x40\xf9", 4),             /* ldr x5, [sp, #8]             */
+        std::string("\xe6\x0b\x00\xf9", 4),             /* str x6, [sp, #16]            */
+        std::string("\x07\x01\x09\x8a", 4),             /* and x7, x8, x9               */
+        std::string("\x20\xf0\x7d\xd3", 4),             /* lsl x0, x1, #3               */
+        std::string("\x20\x00\x82\x9a", 4),             /* csel x0, x1, x2, eq          */
+        std::string("\x20\x7c\x02\x9b", 4),             /* mul x0, x1, x2               */
+        std::string("\x1f\x00\x01\xeb", 4),             /* cmp x0, x1                   */
+        std::string("\x41\x00\x00\x54", 4),             /* b.ne #8                      */
+      }, {"x1", "x4"}, {{"sp", 0x7fff0000}}},
+
+      {"arm32", triton::arch::ARCH_ARM32, false, {
+        std::string("\x02\x00\x81\xe0", 4),             /* add r0, r1, r2               */
+        std::string("\x01\x30\x54\xe2", 4),             /* subs r3, r4, #1              */
+        std::string("\x08\x50\x9d\xe5", 4),             /* ldr r5, [sp, #8]             */
+        std::string("\x10\x60\x8d\xe5", 4),             /* str r6, [sp, #16]            */
+        std::string("\x09\x70\x08\xe0", 4),             /* and r7, r8, r9               */
+        std::string("\x81\x01\xa0\xe1", 4),             /* lsl r0, r1, #3               */
+        std::string("\x01\x00\x50\xe1", 4),             /* cmp r0, r1                   */
+        std::string("\x01\x00\xa0\x01", 4),             /* moveq r0, r1                 */
+      }, {"r1", "r4"}, {{"sp", 0x7fff0000}}},
+
+      {"thumb", triton::arch::ARCH_ARM32, true, {
+        std::string("\x88\x18", 2),                     /* adds r0, r1, r2              */
+        std::string("\x01\x3b", 2),                     /* subs r3, #1                  */
+        std::string("\x02\x9d", 2),                     /* ldr r5, [sp, #8]             */
+        std::string("\x04\x96", 2),                     /* str r6, [sp, #16]            */
+        std::string("\x08\x40", 2),                     /* ands r0, r1                  */
+        std::string("\xc8\x00", 2),                     /* lsls r0, r1, #3              */
+        std::string("\x88\x42", 2),                     /* cmp r0, r1                   */
+        std::string("\x01\xeb\x02\x00", 4),             /* add.w r0, r1, r2             */
+      }, {"r1", "r3"}, {{"sp", 0x7fff0000}}},
+    };
+
+
+    static const std::vector<Configuration> configurations = {
+      {"plain",              [](triton::API&) {}},
+      {"only_on_symbolized", [](triton::API& api) { api.setMode(triton::modes::ONLY_ON_SYMBOLIZED, true); }},
+      {"aligned_memory",     [](triton::API& api) { api.setMode(triton::modes::ALIGNED_MEMORY, true); }},
+      {"taint_only",         [](triton::API& api) { api.enableSymbolicEngine(false); }},
+    };
+
+
+    /* Sets the concrete registers and the inputs of a family */
+    static void initialize(triton::API& api, const Family& family) {
+      for (const auto& reg : family.registers)
+        api.setConcreteRegisterValue(api.getRegister(reg.first), reg.second);
+
+      for (const auto& name : family.inputs) {
+        const triton::arch::Register& reg = api.getRegister(name);
+        if (api.isSymbolicEngineEnabled())
+          api.symbolizeRegister(reg, name);
+        api.taintRegister(reg);
+      }
+    }
+
+
+    static void processFamily(State& state, const Family& family, const Configuration& configuration) {
+      triton::API api;
+
+      api.setArchitecture(family.arch);
+      if (family.thumb)
+        api.setThumb(true);
+      configuration.setup(api);
+      initialize(api, family);
+
+      triton::usize nodes  = getAllocatedNodes(api);
+      triton::usize rounds = 0;
+
+      while (state.keepRunning()) {
+        triton::uint64 addr = 0x400000;
+        for (const auto& code : family.code) {
+          triton::arch::Instruction inst(addr, reinterpret_cast<const triton::uint8*>(code.data()), static_cast<triton::uint32>(code.size()));
+          api.processing(inst);
+          addr += code.size();
+        }
+
+        /* The ASTs are not kept growing from one round to the next ones */
+        if (++rounds % resetInterval == 0) {
+          state.pauseTiming();
+          triton::usize before = getAllocatedNodes(api);
+          api.concretizeAllRegister();
+          api.concretizeAllMemory();
+          initialize(api, family);
+          nodes += getAllocatedNodes(api) - before;
+          state.resumeTiming();
+        }
+      }
+
+      double instructions = static_cast<double>(state.getIterations() * family.code.size());
+      state.counters["inst/s"]     = (state.getSeconds() > 0) ? instructions / state.getSeconds() : 0;
+      state.counters["nodes/inst"] = (getAllocatedNodes(api) - nodes) / instructions;
+    }
+
+
+    static triton::usize registerSemantics(void) {
+      triton::usize count = 0;
+
+      for (const auto& family : families) {
+        for (const auto& configuration : configurations) {
+          count = registerBenchmark(std::string("semantics/") + family.name + "/" + configuration.name, [&family, &configuration](State& state) {
+            processFamily(state, family, configuration);
+          });
+        }
+      }
+
+      return count;
+    }
+
+
+    static triton::usize registered = registerSemantics();
+
+  }; /* benchmarks namespace */
+}; /* triton namespace */
@@ -1,20 +1,34 @@
 /* Used to test the C++ API */
 
+#include <atomic>
 #include <iostream>
 #include <sstream>
 #include <list>
+#include <memory>
+#include <thread>
+#include <vector>
 
 #include <triton/aarch64Cpu.hpp>
 #include <triton/aarch64Specifications.hpp>
 #include <triton/api.hpp>
+#include <triton/astEvaluator.hpp>
+#include <triton/astRewriter.hpp>
+#include <triton/astSerializer.hpp>
 #include <triton/bitsVector.hpp>
 #include <triton/config.hpp>
 #include <triton/exceptions.hpp>
+#include <triton/executor.hpp>
 #include <triton/immediate.hpp>
 #include <triton/instruction.hpp>
 #include <triton/memoryAccess.hpp>
+#include <triton/memoryPlacement.hpp>
 #include <triton/operandWrapper.hpp>
 #include <triton/register.hpp>
+#include <triton/smt2ToTriton.hpp>
+#include <triton/solverServer.hpp>
+#include <triton/stateObserver.hpp>
+#include <triton/traceSegment.hpp>
+#include <triton/tritonC.h>
 #include <triton/x8664Cpu.hpp>
 #include <triton/x86Cpu.hpp>
 #include <triton/x86Specifications.hpp>
@@ -628,6 +642,978 @@ int test_10(void) {
 #endif
 
 
+int test_11(void) {
+  triton::API ctx(triton::arch::ARCH_X86_64);
+  auto actx = ctx.getAstContext();
+  auto varx = ctx.newSymbolicVariable(8, "x");
+  auto vary = ctx.newSymbolicVariable(32, "y");
+  auto x    = actx->variable(varx);
+  auto y    = actx->variable(vary);
+
+  std::list<triton::ast::SharedAbstractNode> nodes = {
+    actx->bvadd(actx->zx(24, x), y),
+    actx->bvmul(actx->sx(24, x), actx->bvnot(y)),
+    actx->bvsdiv(y, actx->sx(24, x)),
+    actx->bvsmod(actx->sx(120, y), actx->zx(120, actx->bvrol(y, 3))),
+    actx->concat(actx->extract(7, 0, y), x),
+    actx->ite(actx->bvslt(x, actx->bv(5, 8)), actx->bvlshr(y, actx->zx(24, x)), actx->bvashr(y, actx->bv(3, 32))),
+    actx->bswap(actx->zx(96, y)),
+    actx->bvshl(actx->zx(32, y), actx->bv(0x100000000, 64)),
+    actx->bvashr(actx->sx(32, y), actx->bv(0x100000001, 64)),
+    actx->bvlshr(actx->zx(96, y), actx->bv((triton::uint512(1) << 64) + 1, 128)),
+    actx->bvashr(actx->sx(96, y), actx->bv(triton::uint512(1) << 32, 128)),
+    actx->lor(std::vector<triton::ast::SharedAbstractNode>{actx->equal(x, actx->bv(1, 8)), actx->bvugt(y, actx->bv(100, 32))}),
+  };
+
+  const triton::uint64 samples[][2] = {{0, 0}, {1, 2}, {0x80, 0x80000000}, {0xff, 0xffffffff}, {0x7f, 0x1234}};
+
+  for (const auto& node : nodes) {
+    triton::ast::AstEvaluator evaluator(node);
+    std::vector<std::vector<triton::uint512>> inputs;
+    std::vector<triton::uint512> expected;
+    for (const auto& sample : samples) {
+      std::vector<triton::uint512> values;
+      for (const auto& var : evaluator.getVariables())
+        values.push_back(var->getId() == varx->getId() ? sample[0] : sample[1]);
+
+      ctx.setConcreteVariableValue(varx, sample[0]);
+      ctx.setConcreteVariableValue(vary, sample[1]);
+      if (evaluator.evaluate(values) != node->evaluate()) {
+        std::cerr << "test_11: KO (" << node.get() << ")" << std::endl;
+        return 1;
+      }
+
+      inputs.push_back(values);
+      expected.push_back(node->evaluate());
+    }
+
+    if (evaluator.evaluateBatch(inputs) != expected) {
+      std::cerr << "test_11: KO (batch " << node.get() << ")" << std::endl;
+      return 1;
+    }
+  }
+
+  std::cout << "test_11: OK" << std::endl;
+  return 0;
+}
+
+
+int test_12(void) {
+  triton::API ctx(triton::arch::ARCH_X86_64);
+  auto actx = ctx.getAstContext();
+  auto varx = ctx.newSymbolicVariable(8, "x");
+  auto vary = ctx.newSymbolicVariable(8, "y");
+  auto x    = actx->variable(varx);
+  auto y    = actx->variable(vary);
+
+  /* (x ^ y) + 2 * (x & y) == x + y */
+  auto mba = actx->bvadd(actx->bvxor(x, y), actx->bvmul(actx->bv(2, 8), actx->bvand(x, y)));
+
+  triton::ast::AstRewriter rewriter(actx);
+  auto node = rewriter.simplify(mba);
+  if (node->getType() != triton::ast::BVADD_NODE) {
+    std::cerr << "test_12: KO (" << node << ")" << std::endl;
+    return 1;
+  }
+
+  for (triton::uint32 value = 0; value < 0x10000; value += 0x101) {
+    ctx.setConcreteVariableValue(varx, value & 0xff);
+    ctx.setConcreteVariableValue(vary, value >> 8);
+    if (node->evaluate() != mba->evaluate()) {
+      std::cerr << "test_12: KO (evaluation)" << std::endl;
+      return 1;
+    }
+  }
+
+  std::cout << "test_12: OK" << std::endl;
+  return 0;
+}
+
+
+int test_13(void) {
+  triton::API ctx(triton::arch::ARCH_X86_64);
+  ctx.setMode(triton::modes::AST_ABSTRACT_DOMAIN, true);
+
+  auto actx = ctx.getAstContext();
+  auto varx = ctx.newSymbolicVariable(8, "x");
+  auto x    = actx->zx(8, actx->variable(varx));
+
+  /* (x & 0xf0) | 1 has its low nibble known and is in [1, 0xf1] */
+  auto node   = actx->bvor(actx->bvand(x, actx->bv(0xf0, 16)), actx->bv(1, 16));
+  auto domain = node->getDomain();
+  if (domain.getKnownZeros() != 0xff0e || domain.getKnownOnes() != 1 || domain.getLower() != 1 || domain.getUpper() != 0xf1) {
+    std::cerr << "test_13: KO (" << node << ")" << std::endl;
+    return 1;
+  }
+
+  /* zx(8, x) < 0x1000 always holds */
+  auto cond = actx->bvult(x, actx->bv(0x1000, 16));
+  if (!cond->getDomain().isConstant() || cond->getDomain().getLower() != 1) {
+    std::cerr << "test_13: KO (" << cond << ")" << std::endl;
+    return 1;
+  }
+
+  /* Constraints which always hold are not recorded */
+  ctx.pushPathConstraint(cond);
+  if (ctx.getPathConstraints().size() != 0) {
+    std::cerr << "test_13: KO (path constraint)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_13: OK" << std::endl;
+  return 0;
+}
+
+
+int test_14(void) {
+  triton::API ctx(triton::arch::ARCH_X86_64);
+  auto actx = ctx.getAstContext();
+  auto varx = ctx.newSymbolicVariable(32, "x");
+  auto x    = actx->variable(varx);
+
+  ctx.setConcreteVariableValue(varx, 0x1234);
+
+  /* A shared sub-tree behind a reference */
+  auto expr = ctx.newSymbolicExpression(actx->bvmul(x, actx->bv(3, 32)), "shared");
+  auto ref  = actx->reference(expr);
+  auto node = actx->equal(actx->bvadd(ref, ref), actx->concat(actx->extract(15, 0, ref), actx->bvrol(x, 5)));
+
+  std::stringstream stream;
+  triton::ast::AstSerializer(actx).serialize(stream, {node});
+
+  /* Loads it into another context */
+  triton::API ctx2(triton::arch::ARCH_X86_64);
+  triton::ast::AstSerializer serializer(ctx2.getAstContext());
+  auto roots = serializer.deserialize(stream);
+
+  std::ostringstream s1, s2;
+  s1 << node;
+  s2 << roots[0];
+  if (roots.size() != 1 || s1.str() != s2.str() || roots[0]->evaluate() != node->evaluate() || roots[0]->getHash() != node->getHash()) {
+    std::cerr << "test_14: KO (" << roots[0] << ")" << std::endl;
+    return 1;
+  }
+
+  if (serializer.getVariables().size() != 1 || serializer.getVariables()[0]->getAlias() != "x" || serializer.getExpressions().size() != 1) {
+    std::cerr << "test_14: KO (symbolic state)" << std::endl;
+    return 1;
+  }
+
+  /* A rotation amount taken from a node which does not fit on 32 bits */
+  auto low  = actx->extract(23, 0, x);
+  auto rot  = actx->bvrol(low, actx->bv((triton::uint512(1) << 64) + 5, 128));
+  auto ror  = actx->bvror(low, actx->bv((triton::uint512(1) << 64) + 5, 128));
+
+  std::stringstream stream2;
+  triton::ast::AstSerializer(actx).serialize(stream2, {rot, ror});
+  roots = triton::ast::AstSerializer(ctx2.getAstContext()).deserialize(stream2);
+
+  if (roots.size() != 2 || !roots[0]->equalTo(rot) || !roots[1]->equalTo(ror) || rot->evaluate() != actx->bvrol(low, 21)->evaluate() || ror->evaluate() != actx->bvror(low, 21)->evaluate()) {
+    std::cerr << "test_14: KO (wide rotation)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_14: OK" << std::endl;
+  return 0;
+}
+
+
+int test_15(void) {
+  triton::API ctx(triton::arch::ARCH_X86_64);
+  auto actx = ctx.getAstContext();
+  auto x    = actx->variable(ctx.newSymbolicVariable(8, "x"));
+
+  /* The tree doubles at each step, the DAG does not */
+  auto node = x;
+  for (triton::uint32 i = 0; i < 64; i++) {
+    node = actx->bvadd(node, actx->bvxor(node, x));
+  }
+
+  std::ostringstream stream;
+  actx->printShared(stream, node.get());
+  if (stream.str().size() > 8192 || stream.str().find("(let ((node!0 (bvadd x (bvxor x x)))) (let ((node!1 (bvadd node!0 (bvxor node!0 x)))) ") != 0) {
+    std::cerr << "test_15: KO (" << stream.str().substr(0, 128) << ")" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_15: OK" << std::endl;
+  return 0;
+}
+
+
+int test_16(void) {
+  triton::API ctx(triton::arch::ARCH_X86_64);
+  auto actx = ctx.getAstContext();
+  auto var  = ctx.newSymbolicVariable(8, "x");
+  auto x    = actx->variable(var);
+
+  ctx.setConcreteVariableValue(var, 3);
+
+  auto node = x;
+  for (triton::uint32 i = 0; i < 32; i++) {
+    node = actx->bvadd(node, actx->bvmul(x, actx->bv(i, 8)));
+  }
+  node->freeze();
+
+  /* Workers build on the frozen DAG in their own contexts */
+  bool valid[2] = {false, false};
+  std::vector<std::thread> workers;
+  for (triton::uint32 i = 0; i < 2; i++) {
+    workers.emplace_back([&node, &valid, i]() {
+      auto wctx = std::make_shared<triton::ast::AstContext>(std::make_shared<triton::modes::Modes>());
+      auto e = wctx->bvadd(node, wctx->bv(i, 8));
+      std::ostringstream stream;
+      stream << e;
+      valid[i] = (e->evaluate() == ((node->evaluate() + i) & 0xff)) && stream.str().find("(bvadd (bvadd x") == 0;
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+
+  if (!valid[0] || !valid[1]) {
+    std::cerr << "test_16: KO (workers)" << std::endl;
+    return 1;
+  }
+
+  /* The frozen DAG keeps its value, new nodes follow the variable */
+  triton::uint512 value = node->evaluate();
+  ctx.setConcreteVariableValue(var, 4);
+  if (node->evaluate() != value || actx->variable(var)->evaluate() != 4 || !node->isFrozen()) {
+    std::cerr << "test_16: KO (frozen value)" << std::endl;
+    return 1;
+  }
+
+  try {
+    node->setChild(0, x);
+    std::cerr << "test_16: KO (frozen node modified)" << std::endl;
+    return 1;
+  }
+  catch (const triton::exceptions::Ast&) {
+  }
+
+  std::cout << "test_16: OK" << std::endl;
+  return 0;
+}
+
+
+int test_17(void) {
+  triton::API ctx(triton::arch::ARCH_X86_64);
+
+  ctx.setConcreteMemoryAreaValue(0x1000, {0x11, 0x22, 0x33, 0x44});
+  ctx.setConcreteRegisterValue(ctx.registers.x86_rbx, 0x1000);
+  ctx.symbolizeRegister(ctx.registers.x86_rbx);
+  ctx.taintRegister(ctx.registers.x86_rbx);
+
+  /* The fork starts in the state of its parent */
+  std::unique_ptr<triton::API> child(ctx.fork());
+  if (child->getConcreteMemoryValue(0x1002) != 0x33 ||
+      child->getConcreteRegisterValue(child->registers.x86_rbx) != 0x1000 ||
+      !child->isRegisterSymbolized(child->registers.x86_rbx) ||
+      !child->isRegisterTainted(child->registers.x86_rbx)) {
+    std::cerr << "test_17: KO (forked state)" << std::endl;
+    return 1;
+  }
+
+  /* Both contexts then diverge */
+  triton::arch::Instruction inst((const unsigned char*)"\x48\x89\xd8", 3); // mov rax, rbx
+  child->processing(inst);
+  child->setConcreteMemoryValue(0x1002, 0x99);
+  child->taintMemory(0x2000);
+  child->concretizeRegister(child->registers.x86_rbx);
+
+  if (ctx.getConcreteMemoryValue(0x1002) != 0x33 ||
+      ctx.getConcreteRegisterValue(ctx.registers.x86_rax) != 0 ||
+      !ctx.isRegisterSymbolized(ctx.registers.x86_rbx) ||
+      ctx.isRegisterTainted(ctx.registers.x86_rax) ||
+      ctx.isMemoryTainted(0x2000)) {
+    std::cerr << "test_17: KO (parent modified)" << std::endl;
+    return 1;
+  }
+
+  if (child->getConcreteMemoryValue(0x1002) != 0x99 ||
+      child->getConcreteRegisterValue(child->registers.x86_rax) != 0x1000 ||
+      !child->isRegisterTainted(child->registers.x86_rax) ||
+      child->isRegisterSymbolized(child->registers.x86_rbx) ||
+      !child->isMemoryTainted(0x2000)) {
+    std::cerr << "test_17: KO (child state)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_17: OK" << std::endl;
+  return 0;
+}
+
+
+int test_18(void) {
+  triton::API ctx(triton::arch::ARCH_X86_64);
+  auto actx = ctx.getAstContext();
+  auto x    = actx->variable(ctx.newSymbolicVariable(64, "x"));
+
+  /* Each expression reads the previous one twice */
+  auto expr = ctx.newSymbolicExpression(x);
+  for (triton::uint32 i = 0; i < 64; i++) {
+    expr = ctx.newSymbolicExpression(actx->bvadd(actx->reference(expr), actx->bvnot(actx->reference(expr))));
+  }
+
+  /* Both references to an expression are unrolled to the same copy */
+  auto node = triton::ast::unroll(actx->reference(expr));
+  if (node->getChildren()[0] != node->getChildren()[1]->getChildren()[0]) {
+    std::cerr << "test_18: KO (shared references)" << std::endl;
+    return 1;
+  }
+
+  if (triton::ast::childrenExtraction(node, false, true).size() != 64 * 2 + 1 || node->evaluate() != expr->getAst()->evaluate()) {
+    std::cerr << "test_18: KO (unrolled size)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_18: OK" << std::endl;
+  return 0;
+}
+
+
+int test_19(void) {
+  triton::API ctx(triton::arch::ARCH_X86_64);
+  std::vector<triton::uint8> buffer(0x3000);
+
+  for (triton::usize index = 0; index < buffer.size(); index++)
+    buffer[index] = static_cast<triton::uint8>(index * 7);
+
+  /* The two pages fully covered are mapped to the buffer */
+  ctx.mapConcreteMemoryArea(0x10800, buffer.data(), buffer.size());
+  triton::usize chunks = 0;
+  ctx.getConcreteMemory().forEachChunk(0x10800, buffer.size(), [&](triton::uint64 addr, const triton::uint8* data, triton::usize length) {
+    if (addr == 0x11000 && data == buffer.data() + 0x800)
+      chunks++;
+  });
+  if (chunks != 1 || ctx.getConcreteMemoryAreaValue(0x10800, buffer.size()) != buffer) {
+    std::cerr << "test_19: KO (mapped area)" << std::endl;
+    return 1;
+  }
+
+  /* A write copies the page, the buffer is left untouched */
+  ctx.setConcreteMemoryValue(0x11000, 0xff);
+  triton::uint8 area[4];
+  ctx.getConcreteMemoryAreaValue(0x10fff, area, 4);
+  if (buffer[0x800] != 0 || area[0] != buffer[0x7ff] || area[1] != 0xff || area[2] != buffer[0x801]) {
+    std::cerr << "test_19: KO (copy on write)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_19: OK" << std::endl;
+  return 0;
+}
+
+
+int test_20(void) {
+  triton::API ctx(triton::arch::ARCH_X86_64);
+
+  /* The second decoding at the same address comes from the cache */
+  triton::arch::Instruction first(0x1000, (const unsigned char*)"\x48\x8d\x05\x10\x00\x00\x00\x90", 8); // lea rax, [rip + 0x10]
+  triton::arch::Instruction second(0x1000, (const unsigned char*)"\x48\x8d\x05\x10\x00\x00\x00\xcc", 8);
+  ctx.disassembly(first);
+  ctx.disassembly(second);
+  if (second.getDisassembly() != first.getDisassembly() || second.getSize() != 7 || second.operands.size() != 2 ||
+      second.operands[1].getConstMemory().getPcRelative() != 0x1007) {
+    std::cerr << "test_20: KO (cached decoding)" << std::endl;
+    return 1;
+  }
+
+  /* Modified code is decoded again */
+  triton::arch::Instruction third(0x1000, (const unsigned char*)"\x48\x89\xd8", 3); // mov rax, rbx
+  ctx.disassembly(third);
+  if (third.getType() != triton::arch::x86::ID_INS_MOV || third.getDisassembly() != "mov rax, rbx") {
+    std::cerr << "test_20: KO (modified code)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_20: OK" << std::endl;
+  return 0;
+}
+
+
+int test_21(void) {
+  triton::API ctx(triton::arch::ARCH_X86_64);
+  std::vector<std::thread> threads;
+  std::vector<int> errors(4, 0);
+
+  /* Each thread decodes with its own Capstone handle and buffer */
+  for (triton::uint32 t = 0; t < errors.size(); t++) {
+    threads.push_back(std::thread([&ctx, &errors, t]() {
+      for (triton::uint64 i = 0; i < 1000; i++) {
+        triton::arch::Instruction inst(0x1000 * (t + 1) + i * 3, (const unsigned char*)"\x48\x89\xd8", 3); // mov rax, rbx
+        ctx.disassembly(inst);
+        if (inst.getType() != triton::arch::x86::ID_INS_MOV || inst.getDisassembly() != "mov rax, rbx" || inst.operands.size() != 2)
+          errors[t]++;
+      }
+    }));
+  }
+
+  for (auto& thread : threads)
+    thread.join();
+
+  for (auto error : errors) {
+    if (error) {
+      std::cerr << "test_21: KO (parallel disassembly)" << std::endl;
+      return 1;
+    }
+  }
+
+  /* A copy of the CPU decodes with the same handles */
+  triton::arch::x86::x8664Cpu cpu;
+  triton::arch::x86::x8664Cpu copy(cpu);
+  triton::arch::Instruction inst(0x1000, (const unsigned char*)"\x90", 1);
+  copy.disassembly(inst);
+  if (inst.getType() != triton::arch::x86::ID_INS_NOP) {
+    std::cerr << "test_21: KO (copied cpu)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_21: OK" << std::endl;
+  return 0;
+}
+
+
+int test_22(void) {
+  triton::API ctx1(triton::arch::ARCH_X86_64);
+  triton::API ctx2(triton::arch::ARCH_X86_64);
+  triton::API ctx3(triton::arch::ARCH_X86);
+
+  /* The contexts of an architecture share its registers */
+  if (&ctx1.getAllRegisters() != &ctx2.getAllRegisters() || &ctx1.getRegister(triton::arch::ID_REG_X86_RAX) != &ctx2.getRegister(triton::arch::ID_REG_X86_RAX)) {
+    std::cerr << "test_22: KO (shared registers)" << std::endl;
+    return 1;
+  }
+
+  if (&ctx1.getAllRegisters() == &ctx3.getAllRegisters() || ctx3.isRegisterValid(triton::arch::ID_REG_X86_R8) ||
+      ctx1.getRegister("rax").getId() != triton::arch::ID_REG_X86_RAX || ctx3.getParentRegister(triton::arch::ID_REG_X86_AX).getId() != triton::arch::ID_REG_X86_EAX) {
+    std::cerr << "test_22: KO (registers of x86)" << std::endl;
+    return 1;
+  }
+
+  try {
+    ctx3.getRegister(triton::arch::ID_REG_X86_R8);
+    std::cerr << "test_22: KO (register of x86-64)" << std::endl;
+    return 1;
+  }
+  catch (const triton::exceptions::Cpu&) {
+  }
+
+  std::cout << "test_22: OK" << std::endl;
+  return 0;
+}
+
+
+int test_23(void) {
+  triton::API ctx(triton::arch::ARCH_X86_64);
+  triton::arch::Instruction inst;
+
+  ctx.setConcreteRegisterValue(ctx.registers.x86_rbx, 0x10);
+  ctx.setConcreteRegisterValue(ctx.registers.x86_rsp, 0x7fff0000);
+
+  /* One instruction reused across processings */
+  inst.setOpcode((const unsigned char*)"\x48\x89\x5c\x24\x08", 5); // mov [rsp + 8], rbx
+  ctx.processing(inst);
+  if (inst.getStoreAccess().size() != 1 || inst.getReadRegisters().size() != 2 || inst.getWrittenRegisters().size() != 1) {
+    std::cerr << "test_23: KO (first processing)" << std::endl;
+    return 1;
+  }
+
+  inst.clear();
+  inst.setOpcode((const unsigned char*)"\x48\x01\xd8", 3); // add rax, rbx
+  ctx.processing(inst);
+  if (!inst.getStoreAccess().empty() || !inst.getLoadAccess().empty() || inst.getReadRegisters().size() != 2 ||
+      inst.getUndefinedRegisters().size() != 0 || ctx.getConcreteRegisterValue(ctx.registers.x86_rax) != 0x10) {
+    std::cerr << "test_23: KO (reused instruction)" << std::endl;
+    return 1;
+  }
+
+  /* The sets are ordered and without duplicates */
+  inst.setReadRegister(ctx.registers.x86_rbx, nullptr);
+  inst.setReadRegister(ctx.registers.x86_rbx, nullptr);
+  auto it = inst.getReadRegisters().cbegin();
+  for (auto next = std::next(it); next != inst.getReadRegisters().cend(); it++, next++) {
+    if (!(*it < *next)) {
+      std::cerr << "test_23: KO (order)" << std::endl;
+      return 1;
+    }
+  }
+
+  std::cout << "test_23: OK" << std::endl;
+  return 0;
+}
+
+
+int test_24(void) {
+  triton::API ctx(triton::arch::ARCH_ARM32);
+  ctx.setThumb(true);
+
+  /* The conditions of an IT block are restored from the cache */
+  const char* code[] = {
+    "\x0c\xbf", // ite eq
+    "\x01\x20", // moveq r0, #1
+    "\x02\x20", // movne r0, #2
+    "\x03\x20", // movs r0, #3
+  };
+  triton::arch::arm::condition_e conditions[] = {
+    triton::arch::arm::ID_CONDITION_EQ,
+    triton::arch::arm::ID_CONDITION_EQ,
+    triton::arch::arm::ID_CONDITION_NE,
+    triton::arch::arm::ID_CONDITION_AL,
+  };
+
+  for (triton::uint32 pass = 0; pass < 2; pass++) {
+    for (triton::uint32 i = 0; i < 4; i++) {
+      triton::arch::Instruction inst(0x1000 + i * 2, (const unsigned char*)code[i], 2);
+      ctx.disassembly(inst);
+      if (inst.getCodeCondition() != conditions[i] || !inst.isThumb()) {
+        std::cerr << "test_24: KO (IT block, pass " << pass << ")" << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  /* The same bytes outside of the IT block are decoded again */
+  triton::arch::Instruction inst(0x1002, (const unsigned char*)code[1], 2);
+  ctx.disassembly(inst);
+  if (inst.getCodeCondition() != triton::arch::arm::ID_CONDITION_AL) {
+    std::cerr << "test_24: KO (outside of the IT block)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_24: OK" << std::endl;
+  return 0;
+}
+
+
+static void test_25_count(void* data, triton::API& api, const triton::arch::Register& reg) {
+  (*static_cast<triton::uint32*>(data))++;
+}
+
+
+int test_25(void) {
+  triton::API ctx(triton::arch::ARCH_X86_64);
+  triton::uint32 reads = 0;
+
+  /* A plain function with a user pointer */
+  auto cb = triton::callbacks::getConcreteRegisterValueCallback(test_25_count, &reads);
+  ctx.addCallback(triton::callbacks::GET_CONCRETE_REGISTER_VALUE, cb);
+  ctx.getConcreteRegisterValue(ctx.registers.x86_rax);
+  ctx.getConcreteRegisterValue(ctx.registers.x86_rbx);
+  if (reads != 2) {
+    std::cerr << "test_25: KO (plain function)" << std::endl;
+    return 1;
+  }
+
+  /* It is removed with the same function and user pointer */
+  ctx.removeCallback(triton::callbacks::GET_CONCRETE_REGISTER_VALUE, triton::callbacks::getConcreteRegisterValueCallback(test_25_count, &reads));
+  ctx.getConcreteRegisterValue(ctx.registers.x86_rax);
+  if (reads != 2) {
+    std::cerr << "test_25: KO (removal)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_25: OK" << std::endl;
+  return 0;
+}
+
+
+#if defined(TRITON_Z3_INTERFACE) || defined(TRITON_BITWUZLA_INTERFACE)
+/* The queries of two tracers are solved by a solver server, the identical ones once */
+int test_26(void) {
+  triton::engines::solver::SolverServer server(triton::API().getSolver());
+  triton::uint16 port = server.start("127.0.0.1:0");
+
+  for (int tracer = 0; tracer < 2; tracer++) {
+    triton::API ctx(triton::arch::ARCH_X86_64);
+    triton::engines::solver::status_e status;
+    auto actx = ctx.getAstContext();
+    auto varx = ctx.newSymbolicVariable(32, "x");
+
+    ctx.setSolver(triton::engines::solver::SOLVER_REMOTE);
+    ctx.getSolverRemote()->setEndpoints({"127.0.0.1:" + std::to_string(port)});
+
+    auto node = actx->equal(actx->bvadd(actx->variable(varx), actx->bv(1, 32)), actx->bv(0x1234, 32));
+    auto model = ctx.getModel(node, &status);
+    if (status != triton::engines::solver::SAT || model[varx->getId()].getValue() != 0x1233) {
+      std::cerr << "test_26: KO (model of tracer " << tracer << ")" << std::endl;
+      return 1;
+    }
+
+    if (ctx.isSat(actx->land(node, actx->equal(actx->variable(varx), actx->bv(0, 32)))) != false) {
+      std::cerr << "test_26: KO (unsat query of tracer " << tracer << ")" << std::endl;
+      return 1;
+    }
+  }
+
+  if (server.getQueries() != 4 || server.getHits() != 2) {
+    std::cerr << "test_26: KO (" << server.getHits() << " hits out of " << server.getQueries() << " queries)" << std::endl;
+    return 1;
+  }
+
+  /* A server which is down gives UNKNOWN */
+  server.stop();
+  triton::API ctx(triton::arch::ARCH_X86_64);
+  triton::engines::solver::status_e status;
+  ctx.setSolver(triton::engines::solver::SOLVER_REMOTE);
+  ctx.getSolverRemote()->setEndpoints({"127.0.0.1:" + std::to_string(port)});
+  ctx.isSat(ctx.getAstContext()->equal(ctx.getAstContext()->variable(ctx.newSymbolicVariable(8)), ctx.getAstContext()->bv(1, 8)), &status);
+  if (status != triton::engines::solver::UNKNOWN) {
+    std::cerr << "test_26: KO (server down)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_26: OK" << std::endl;
+  return 0;
+}
+#endif
+
+
+#ifdef TRITON_Z3_INTERFACE
+int test_27(void) {
+  triton::API ctx(triton::arch::ARCH_X86_64);
+  triton::engines::solver::status_e status;
+  auto actx = ctx.getAstContext();
+  auto& executor = triton::utils::Executor::getDefault();
+  triton::usize threads = executor.getThreads();
+  std::vector<triton::engines::symbolic::SharedSymbolicVariable> vars;
+  std::vector<triton::ast::SharedAbstractNode> branches;
+
+  /* Four independent chains, large enough to be converted in parallel */
+  for (triton::uint32 index = 0; index < 4; index++) {
+    vars.push_back(ctx.newSymbolicVariable(32));
+    auto chain = actx->variable(vars.back());
+    for (triton::uint32 step = 0; step < 10000; step++)
+      chain = actx->bvadd(chain, actx->bv(index + 1, 32));
+    branches.push_back(actx->equal(chain, actx->bv(0x10000000 * (index + 1), 32)));
+  }
+
+  executor.setThreads(4);
+  ctx.setSolver(triton::engines::solver::SOLVER_Z3);
+  auto model = ctx.getModel(actx->land(branches), &status);
+  executor.setThreads(threads);
+
+  if (status != triton::engines::solver::SAT) {
+    std::cerr << "test_27: KO (status " << status << ")" << std::endl;
+    return 1;
+  }
+
+  for (triton::uint32 index = 0; index < 4; index++) {
+    triton::uint32 expected = 0x10000000 * (index + 1) - 10000 * (index + 1);
+    if (model[vars[index]->getId()].getValue() != expected) {
+      std::cerr << "test_27: KO (model of variable " << index << ")" << std::endl;
+      return 1;
+    }
+  }
+
+  std::cout << "test_27: OK" << std::endl;
+  return 0;
+}
+#endif
+
+
+int test_28(void) {
+  triton_context_t* ctx = triton_create(TRITON_ARCH_X86_64);
+  const uint8_t code[] = {0x48, 0x3d, 0x34, 0x12, 0x00, 0x00, 0x74, 0x00}; /* cmp rax, 0x1234; jz +0 */
+  const triton_instruction_t insns[] = {{0x1000, code, 6}, {0x1006, code + 6, 2}};
+  triton_instruction_result_t results[2];
+  uint8_t memory[4] = {0};
+  uint64_t values[2] = {0};
+  uint32_t regs[2] = {0};
+  uint64_t var = 0;
+
+  const uint8_t bytes[4] = {1, 2, 3, 4};
+  if (triton_set_memory(ctx, 0x2000, bytes, 4) != TRITON_OK || triton_get_memory(ctx, 0x2000, memory, 4) != TRITON_OK || memory[3] != 4) {
+    std::cerr << "test_28: KO (memory)" << std::endl;
+    return 1;
+  }
+
+  if (triton_get_register_id(ctx, "rax", &regs[0]) != TRITON_OK || triton_get_register_id(ctx, "rbx", &regs[1]) != TRITON_OK) {
+    std::cerr << "test_28: KO (register id)" << std::endl;
+    return 1;
+  }
+
+  if (triton_get_register_id(ctx, "foo", &regs[1]) != TRITON_ERROR || std::string(triton_last_error(ctx)).empty()) {
+    std::cerr << "test_28: KO (error)" << std::endl;
+    return 1;
+  }
+
+  const uint64_t init[2] = {0x10, 0x20};
+  if (triton_set_registers(ctx, regs, init, 2) != TRITON_OK || triton_get_registers(ctx, regs, values, 2) != TRITON_OK || values[1] != 0x20) {
+    std::cerr << "test_28: KO (registers)" << std::endl;
+    return 1;
+  }
+
+  if (triton_symbolize_registers(ctx, regs, 1, &var) != TRITON_OK) {
+    std::cerr << "test_28: KO (symbolize)" << std::endl;
+    return 1;
+  }
+
+  if (triton_process(ctx, insns, 2, results) != 2 || results[0].next != 0x1006 || !results[1].branch || results[1].taken || results[1].next != 0x1008) {
+    std::cerr << "test_28: KO (process)" << std::endl;
+    return 1;
+  }
+
+  if (triton_get_path_constraints_size(ctx) != 1) {
+    std::cerr << "test_28: KO (path constraints)" << std::endl;
+    return 1;
+  }
+
+  #ifdef TRITON_Z3_INTERFACE
+  triton_query_t query = {TRITON_QUERY_FLIP, 0, 0, 0};
+  triton_answer_t answer;
+  triton_model_entry_t model[1];
+
+  if (triton_solve(ctx, &query, 1, &answer, model, 1) != TRITON_OK || answer.status != TRITON_SAT || answer.count != 1) {
+    std::cerr << "test_28: KO (solve)" << std::endl;
+    return 1;
+  }
+
+  if (model[0].variable != var || model[0].value != 0x1234) {
+    std::cerr << "test_28: KO (model)" << std::endl;
+    return 1;
+  }
+  #endif
+
+  triton_destroy(ctx);
+
+  std::cout << "test_28: OK" << std::endl;
+  return 0;
+}
+
+
+static triton::usize test_29_blocks = 0;
+
+static void* test_29_allocate(triton::usize size, void* data) {
+  test_29_blocks++;
+  return ::operator new(size);
+}
+
+static void test_29_release(void* p, triton::usize size, void* data) {
+  test_29_blocks--;
+  ::operator delete(p);
+}
+
+int test_29(void) {
+  triton::utils::MemoryPlacement hooks;
+  hooks.setHooks(test_29_allocate, test_29_release);
+
+  {
+    triton::API ctx(triton::arch::ARCH_X86_64);
+    ctx.setMemoryPlacement(hooks);
+
+    /* The slabs of the AST nodes and of the pages come from the hooks */
+    auto actx = ctx.getAstContext();
+    auto node = actx->bvadd(actx->variable(ctx.newSymbolicVariable(32)), actx->bv(1, 32));
+    ctx.setConcreteMemoryValue(0x1000, 0x41);
+
+    if (test_29_blocks < 2 || ctx.getConcreteMemoryValue(0x1000) != 0x41) {
+      std::cerr << "test_29: KO (hooks)" << std::endl;
+      return 1;
+    }
+
+    /* Forks keep the placement */
+    std::unique_ptr<triton::API> fork(ctx.fork());
+    if (fork->getMemoryPlacement() != hooks) {
+      std::cerr << "test_29: KO (fork)" << std::endl;
+      return 1;
+    }
+  }
+
+  if (test_29_blocks != 0) {
+    std::cerr << "test_29: KO (release)" << std::endl;
+    return 1;
+  }
+
+  /* Huge pages and NUMA nodes are requests, regular pages are used if they cannot be honored */
+  triton::utils::MemoryPlacement huge;
+  huge.setHugePages(triton::utils::HUGE_PAGES_TRANSPARENT);
+  huge.setNumaNode(0);
+
+  triton::API ctx(triton::arch::ARCH_X86_64);
+  ctx.setMemoryPlacement(huge);
+  auto actx = ctx.getAstContext();
+  actx->bvadd(actx->variable(ctx.newSymbolicVariable(32)), actx->bv(1, 32));
+  ctx.setConcreteMemoryValue(0x1000, 0x41);
+
+  if (ctx.getConcreteMemoryValue(0x1000) != 0x41 || ctx.getMemoryUsage().astReservedBytes < triton::utils::MemoryPlacement::hugePageSize) {
+    std::cerr << "test_29: KO (huge pages)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_29: OK" << std::endl;
+  return 0;
+}
+
+
+int test_30(void) {
+  triton::API ctx(triton::arch::ARCH_X86_64);
+  const triton::uint8 code[] = {0x48, 0xff, 0xc0, 0x48, 0xff, 0xc9, 0x75, 0xf8}; /* loop: inc rax; dec rcx; jnz loop */
+  const auto& rax = ctx.getRegister(triton::arch::ID_REG_X86_RAX);
+  const auto& rcx = ctx.getRegister(triton::arch::ID_REG_X86_RCX);
+  const auto& observer = ctx.getStateObserver();
+  std::atomic<bool> done(false);
+  std::atomic<bool> consistent(true);
+  std::atomic<triton::usize> reads(0);
+
+  ctx.setConcreteMemoryAreaValue(0x1000, code, sizeof(code));
+  ctx.setConcreteRegisterValue(rcx, 1000);
+  ctx.getStateObserver().setEnabled(true);
+
+  /* The views are published after each jnz, where rax + rcx is 1000 */
+  std::thread reader([&]() {
+    triton::uint64 epoch = 0;
+    while (!done.load()) {
+      triton::StateObserver::Reader view(observer);
+      if (view.get() == nullptr)
+        continue;
+      if (view->getEpoch() < epoch || view->getConcreteRegisterValue(rax) + view->getConcreteRegisterValue(rcx) != 1000)
+        consistent = false;
+      epoch = view->getEpoch();
+      reads++;
+    }
+  });
+
+  triton::uint64 pc = 0x1000;
+  while (pc != 0x1008) {
+    triton::uint8 opcodes[16];
+    ctx.getConcreteMemoryAreaValue(pc, opcodes, sizeof(opcodes));
+    triton::arch::Instruction inst(pc, opcodes, sizeof(opcodes));
+    ctx.processing(inst);
+    pc = ctx.getConcreteRegisterValue(ctx.getRegister(triton::arch::ID_REG_X86_RIP)).convert_to<triton::uint64>();
+  }
+
+  done = true;
+  reader.join();
+
+  triton::StateObserver::Reader view(observer);
+  if (!consistent || view->getEpoch() != 1000 || view->getConcreteRegisterValue(rax) != 1000 || view->getConcreteMemory().get(0x1006) != 0x75) {
+    std::cerr << "test_30: KO (" << reads << " reads)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_30: OK" << std::endl;
+  return 0;
+}
+
+
+int test_31(void) {
+  triton::API ctx(triton::arch::ARCH_X86_64);
+  triton::API other(triton::arch::ARCH_X86_64);
+  std::vector<triton::uint8> trace = {'T', 'T', 'R', 'C', 0x01};
+
+  /* A compact record without memory access, the registers being (id, value) deltas of 8 bytes */
+  auto record = [&](triton::uint64 addr, const std::vector<triton::uint8>& opcode, const std::vector<std::pair<triton::arch::register_e, triton::uint64>>& regs) {
+    for (triton::usize i = 0; i < 8; i++)
+      trace.push_back(static_cast<triton::uint8>(addr >> (i * 8)));
+    trace.insert(trace.end(), {0x00, 0x00, 0x00, 0x00});
+    trace.push_back(static_cast<triton::uint8>(opcode.size()));
+    trace.insert(trace.end(), opcode.begin(), opcode.end());
+    trace.push_back(static_cast<triton::uint8>(regs.size()));
+    for (const auto& reg : regs) {
+      trace.push_back(static_cast<triton::uint8>(reg.first));
+      trace.push_back(static_cast<triton::uint8>(reg.first >> 8));
+      trace.push_back(8);
+      for (triton::usize i = 0; i < 8; i++)
+        trace.push_back(static_cast<triton::uint8>(reg.second >> (i * 8)));
+    }
+    trace.insert(trace.end(), {0x00, 0x00});
+  };
+
+  record(0x1000, {0x48, 0xff, 0xc0}, {});                                       /* inc rax */
+  record(0x1003, {0x48, 0x01, 0xc3}, {{triton::arch::ID_REG_X86_RAX, 2}});      /* add rbx, rax */
+  record(0x1006, {0x48, 0x83, 0xfb, 0x05}, {{triton::arch::ID_REG_X86_RBX, 4}}); /* cmp rbx, 5 */
+  record(0x100a, {0x75, 0x02}, {});                                             /* jne */
+
+  ctx.setConcreteRegisterValue(ctx.getRegister(triton::arch::ID_REG_X86_RAX), 1);
+  ctx.setConcreteRegisterValue(ctx.getRegister(triton::arch::ID_REG_X86_RBX), 2);
+  ctx.symbolizeRegister(ctx.getRegister(triton::arch::ID_REG_X86_RAX));
+
+  auto boundaries = ctx.scanTraceBoundaries(trace.data(), trace.size(), triton::arch::TRACE_COMPACT, 2);
+  if (boundaries.size() != 2 || boundaries[0].index != 0 || boundaries[1].index != 2) {
+    std::cerr << "test_31: KO (boundaries)" << std::endl;
+    return 1;
+  }
+
+  /* The second segment is processed by another context, from the concrete state at its boundary */
+  auto first  = ctx.processTraceSegment(trace.data(), trace.size(), triton::arch::TRACE_COMPACT, boundaries[0], 2);
+  auto second = other.processTraceSegment(trace.data(), trace.size(), triton::arch::TRACE_COMPACT, boundaries[1], 2);
+
+  triton::engines::symbolic::SegmentStitcher stitcher(ctx.getAstContext());
+  stitcher.append(first);
+  stitcher.append(second);
+
+  const auto& pcs = stitcher.getPathConstraints();
+  auto rbx = stitcher.getRegisterAst(0, triton::arch::ID_REG_X86_RBX);
+  if (pcs.size() != 1 || !pcs[0].getTakenPredicate()->isSymbolized() || pcs[0].getTakenPredicate()->evaluate() != 1 ||
+      rbx == nullptr || !rbx->isSymbolized() || rbx->evaluate() != 4 || stitcher.getNextIndex() != 4) {
+    std::cerr << "test_31: KO" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_31: OK" << std::endl;
+  return 0;
+}
+
+
+int test_32(void) {
+  triton::API ctx(triton::arch::ARCH_X86_64);
+  auto rax = ctx.newSymbolicVariable(32, "rax");
+  auto rbx = ctx.newSymbolicVariable(8);
+  auto raxNode = ctx.getAstContext()->variable(rax);
+  auto rbxNode = ctx.getAstContext()->variable(rbx);
+  std::vector<triton::ast::SharedAbstractNode> declared;
+
+  /* The constants named after a variable of the context are that variable, the others are new variables */
+  triton::ast::Smt2ToTriton parser(ctx.getAstContext(), [&](const std::string& name, triton::uint32 size) -> triton::engines::symbolic::SharedSymbolicVariable {
+    if (name.compare(0, 7, "SymVar_") == 0)
+      return nullptr;
+    auto var = ctx.newSymbolicVariable(size, name);
+    declared.push_back(ctx.getAstContext()->variable(var));
+    return var;
+  });
+  parser.setVariable("eax", rax);
+
+  ctx.setConcreteVariableValue(rax, 7);
+  ctx.setConcreteVariableValue(rbx, 0x20);
+
+  const auto& assertions = parser.parse(std::string(
+    "(set-logic QF_BV)\n"
+    "(declare-fun eax () (_ BitVec 32))\n"
+    "(declare-fun " + rbx->getName() + " () (_ BitVec 8))\n"
+    "(declare-fun flag () (_ BitVec 1))\n"
+    "; a function with arguments is expanded where applied\n"
+    "(define-fun square ((x (_ BitVec 32))) (_ BitVec 32) (let ((t (bvadd x #x00000003))) (bvmul t t)))\n"
+    "(assert (= (square eax) ((_ zero_extend 24) (bvadd " + rbx->getName() + " (_ bv68 8)))))\n"
+    "(push 1)\n"
+    "(assert (= flag #b1))\n"
+    "(pop 1)\n"
+    "(check-sat)\n"
+  ));
+
+  /* The symbols of a let are shared nodes */
+  auto term = parser.parseTerm("(let ((s (bvadd eax #x00000001))) (bvsub s s))");
+
+  if (assertions.size() != 1 || assertions[0]->evaluate() != 1 || declared.size() != 1 ||
+      term->getChildren()[0] != term->getChildren()[1] || term->evaluate() != 0) {
+    std::cerr << "test_32: KO" << std::endl;
+    return 1;
+  }
+
+  try {
+    parser.parseTerm("(bvadd eax s)");
+    std::cerr << "test_32: KO (let binding not removed)" << std::endl;
+    return 1;
+  }
+  catch (const triton::exceptions::AstLifting&) {
+  }
+
+  std::cout << "test_32: OK" << std::endl;
+  return 0;
+}
+
+
 int main(int ac, const char **av) {
   if (test_1())
     return 1;
@@ -656,6 +1642,76 @@ int main(int ac, const char **av) {
   if (test_9())
     return 1;
 
+  if (test_11())
+    return 1;
+
+  if (test_12())
+    return 1;
+
+  if (test_13())
+    return 1;
+
+  if (test_14())
+    return 1;
+
+  if (test_15())
+    return 1;
+
+  if (test_16())
+    return 1;
+
+  if (test_17())
+    return 1;
+
+  if (test_18())
+    return 1;
+
+  if (test_19())
+    return 1;
+
+  if (test_20())
+    return 1;
+
+  if (test_21())
+    return 1;
+
+  if (test_22())
+    return 1;
+
+  if (test_23())
+    return 1;
+
+  if (test_24())
+    return 1;
+
+  if (test_25())
+    return 1;
+
+  #if defined(TRITON_Z3_INTERFACE) || defined(TRITON_BITWUZLA_INTERFACE)
+  if (test_26())
+    return 1;
+  #endif
+
+  #ifdef TRITON_Z3_INTERFACE
+  if (test_27())
+    return 1;
+  #endif
+
+  if (test_28())
+    return 1;
+
+  if (test_29())
+    return 1;
+
+  if (test_30())
+    return 1;
+
+  if (test_31())
+    return 1;
+
+  if (test_32())
+    return 1;
+
   #ifdef TRITON_LLVM_INTERFACE
   if (test_10())
     return 1;
@@ -0,0 +1,79 @@
+/*
+** Reference solver server of the remote solver (see SOLVER_REMOTE).
+**
+** Serves the queries of the tracers of a cluster, with a cache of the answers shared by
+** all the tracers. Run one server per solver machine and give their endpoints to the
+** tracers, e.g. with `ctx.setSolverRemoteEndpoints(["solver1:7000", "solver2:7000"])`.
+**
+** Usage: solver_server [--workers=<n>] [--cache=<n>] [<host>:]<port>
+*/
+
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include <triton/api.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/solverServer.hpp>
+
+
+
+static volatile std::sig_atomic_t stopping = 0;
+
+static void onSignal(int) {
+  stopping = 1;
+}
+
+
+int main(int ac, const char **av) {
+  triton::usize capacity = 65536;
+  triton::usize workers = 0;
+  std::string endpoint;
+
+  for (int i = 1; i < ac; i++) {
+    if (std::strncmp(av[i], "--workers=", 10) == 0)
+      workers = std::strtoul(av[i] + 10, nullptr, 10);
+    else if (std::strncmp(av[i], "--cache=", 8) == 0)
+      capacity = std::strtoul(av[i] + 8, nullptr, 10);
+    else
+      endpoint = av[i];
+  }
+
+  if (endpoint.empty()) {
+    std::cerr << "Usage: " << av[0] << " [--workers=<n>] [--cache=<n>] [<host>:]<port>" << std::endl;
+    return 1;
+  }
+
+  if (endpoint.find(':') == std::string::npos)
+    endpoint = "0.0.0.0:" + endpoint;
+
+  /* The queries are solved by the default solver of Triton */
+  triton::engines::solver::SolverServer server(triton::API().getSolver());
+  server.setCacheCapacity(capacity);
+  if (workers)
+    server.setWorkers(workers);
+
+  try {
+    triton::uint16 port = server.start(endpoint);
+    std::cout << "Serving on port " << port << " with " << server.getWorkers() << " workers" << std::endl;
+  }
+  catch (const triton::exceptions::Exception& e) {
+    std::cerr << e.what() << std::endl;
+    return 1;
+  }
+
+  std::signal(SIGINT, onSignal);
+  std::signal(SIGTERM, onSignal);
+
+  while (!stopping)
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+  server.stop();
+  std::cout << server.getQueries() << " queries, " << server.getHits() << " answered by the cache" << std::endl;
+
+  return 0;
+}
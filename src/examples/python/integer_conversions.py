@@ -0,0 +1,53 @@
+#!/usr/bin/env python3
+## -*- coding: utf-8 -*-
+##
+## Measures the conversions of the Python integers to the registers of each
+## width and back, as well as the evaluation of nodes of each width.
+##
+## Output (the timings depend on the host):
+##
+##  $ ./integer_conversions.py
+##  rax   ( 64 bits):  set+get 0.35 us, evaluate 0.21 us
+##  xmm0  (128 bits):  set+get 0.41 us, evaluate 0.24 us
+##  ymm0  (256 bits):  set+get 0.45 us, evaluate 0.25 us
+##  zmm0  (512 bits):  set+get 0.52 us, evaluate 0.28 us
+##
+
+from __future__ import print_function
+from triton     import TritonContext, ARCH
+
+import sys
+import time
+
+ROUNDS = 20000
+
+
+def measure(function):
+    start = time.perf_counter()
+    for i in range(ROUNDS):
+        function(i)
+    return (time.perf_counter() - start) * 1e6 / ROUNDS
+
+
+if __name__ == '__main__':
+    ctx = TritonContext(ARCH.X86_64)
+    ast = ctx.getAstContext()
+
+    for reg in [ctx.registers.rax, ctx.registers.xmm0, ctx.registers.ymm0, ctx.registers.zmm0]:
+        bits  = reg.getBitSize()
+        mask  = (1 << bits) - 1
+        value = mask // 3
+
+        # The values are checked on the way, from a small one to the widest ones
+        def setAndGet(i):
+            v = (value >> (i % bits)) ^ i
+            ctx.setConcreteRegisterValue(reg, v)
+            assert ctx.getConcreteRegisterValue(reg) == v
+
+        node = ast.bv(value, bits)
+        def evaluate(i):
+            assert node.evaluate() == value
+
+        print('%-5s (%3d bits):  set+get %.2f us, evaluate %.2f us' % (reg.getName(), bits, measure(setAndGet), measure(evaluate)))
+
+    sys.exit(0)
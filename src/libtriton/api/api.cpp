@@ -6,13 +6,25 @@
 */
 
 #include <triton/api.hpp>
+#include <triton/astRewriter.hpp>
+#include <triton/astSerializer.hpp>
 #include <triton/config.hpp>
+#include <triton/coreUtils.hpp>
 #include <triton/exceptions.hpp>
+#include <triton/mappedFile.hpp>
+#include <triton/traceReader.hpp>
 
+#include <algorithm>
+#include <cstring>
+#include <fstream>
 #include <list>
 #include <map>
 #include <memory>
 #include <new>
+#include <set>
+#include <sstream>
+#include <tuple>
+#include <unordered_map>
 
 
 /*!
@@ -239,7 +251,10 @@ namespace triton {
     callbacks(*this),
     arch(&this->callbacks) {
     this->modes   = std::make_shared<triton::modes::Modes>();
-    this->astCtxt = std::make_shared<triton::ast::AstContext>(this->modes);
+    this->tracer   = std::make_shared<triton::utils::EventTracer>();
+    this->coverage = std::make_shared<triton::arch::Coverage>();
+    this->astCtxt  = std::make_shared<triton::ast::AstContext>(this->modes);
+    this->astCtxt->setTracer(this->tracer);
   }
 
 
@@ -318,6 +333,7 @@ namespace triton {
   void API::setArchitecture(triton::arch::architecture_e arch) {
     /* Setup and init the targeted architecture */
     this->arch.setArchitecture(arch);
+    this->arch.setConcreteMemoryPlacement(this->placement);
 
     /* remove and re-init previous engines (when setArchitecture() has been called twice) */
     this->removeEngines();
@@ -331,6 +347,56 @@ namespace triton {
   }
 
 
+  const triton::arch::SharedDisassemblyCache& API::getDisassemblyCache(void) const {
+    this->checkArchitecture();
+    return this->arch.getDisassemblyCache();
+  }
+
+
+  void API::setDisassemblyCache(const triton::arch::SharedDisassemblyCache& cache) {
+    this->checkArchitecture();
+    this->arch.setDisassemblyCache(cache);
+  }
+
+
+  triton::uint32 API::getThread(void) const {
+    this->checkArchitecture();
+    return this->arch.getThread();
+  }
+
+
+  std::vector<triton::uint32> API::getThreads(void) const {
+    this->checkArchitecture();
+    return this->arch.getThreads();
+  }
+
+
+  void API::setThread(triton::uint32 tid) {
+    this->checkArchitecture();
+
+    /* The deferred symbolic registers are built before the concrete registers are switched */
+    if (this->symbolic)
+      this->symbolic->setThread(tid);
+    if (this->taint)
+      this->taint->setThread(tid);
+    this->arch.setThread(tid);
+  }
+
+
+  void API::removeThread(triton::uint32 tid) {
+    this->checkArchitecture();
+
+    if (tid == this->arch.getThread())
+      throw triton::exceptions::API("API::removeThread(): Cannot remove the current thread.");
+
+    if (this->symbolic)
+      this->symbolic->removeThread(tid);
+    if (this->taint)
+      this->taint->removeThread(tid);
+    this->arch.removeThread(tid);
+  }
+
+
   bool API::isFlag(triton::arch::register_e regId) const {
     return this->arch.isFlag(regId);
   }
@@ -436,8 +502,22 @@ namespace triton {
   }
 
 
+  void API::getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::uint8* area, triton::usize size, bool execCallbacks) const {
+    this->checkArchitecture();
+    this->arch.getConcreteMemoryAreaValue(baseAddr, area, size, execCallbacks);
+  }
+
+
+  const triton::arch::ConcreteMemory& API::getConcreteMemory(void) const {
+    this->checkArchitecture();
+    return this->arch.getConcreteMemory();
+  }
+
+
   triton::uint512 API::getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks) const {
     this->checkArchitecture();
+    if (this->symbolic)
+      this->symbolic->buildLazyRegisters(reg);
     return this->arch.getConcreteRegisterValue(reg, execCallbacks);
   }
 
@@ -471,9 +551,7 @@ namespace triton {
      * In order to synchronize the concrete state with the symbolic
      * one, the symbolic expression is concretized.
      */
-    for (triton::usize index = 0 ; index < values.size() ; index++) {
-      this->concretizeMemory(baseAddr + index);
-    }
+    this->concretizeMemoryArea(baseAddr, values.size());
   }
 
 
@@ -484,14 +562,34 @@ namespace triton {
      * In order to synchronize the concrete state with the symbolic
      * one, the symbolic expression is concretized.
      */
-    for (triton::usize index = 0 ; index < size ; index++) {
-      this->concretizeMemory(baseAddr + index);
-    }
+    this->concretizeMemoryArea(baseAddr, size);
+  }
+
+
+  void API::mapConcreteMemoryArea(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size, const std::shared_ptr<const void>& owner) {
+    this->checkArchitecture();
+    this->arch.mapConcreteMemoryArea(baseAddr, area, size, owner);
+    /*
+     * In order to synchronize the concrete state with the symbolic
+     * one, the symbolic expression is concretized.
+     */
+    this->concretizeMemoryArea(baseAddr, size);
+  }
+
+
+  triton::usize API::mapConcreteMemoryFile(triton::uint64 baseAddr, const std::string& path, triton::uint64 offset, triton::usize size) {
+    this->checkArchitecture();
+    /* The memory keeps the file mapped as long as a page uses it, the contexts mapping it share it */
+    auto file = triton::arch::MappedFile::share(path, offset, size);
+    this->mapConcreteMemoryArea(baseAddr, file->getData(), file->getSize(), file);
+    return file->getSize();
   }
 
 
   void API::setConcreteRegisterValue(const triton::arch::Register& reg, const triton::uint512& value) {
     this->checkArchitecture();
+    if (this->symbolic)
+      this->symbolic->buildLazyRegisters(reg);
     this->arch.setConcreteRegisterValue(reg, value);
     /*
      * In order to synchronize the concrete state with the symbolic
@@ -561,14 +659,42 @@ namespace triton {
     if (this->taint == nullptr)
       throw triton::exceptions::API("API::initEngines(): Not enough memory.");
 
+    /* The forks of the dereferences of symbolic addresses ask the solver for the other addresses */
+    this->symbolic->setSolver(this->solver);
+
+    /* The engines time their phases of the processing */
+    this->symbolic->setStatistics(&this->statistics);
+    this->taint->setStatistics(&this->statistics);
+
+    /* The path manager records the branches of the path constraints */
+    this->symbolic->setCoverage(this->coverage.get());
+
+    /* The registers of the new engines are the ones of the current thread */
+    this->symbolic->setThread(this->arch.getThread());
+    this->taint->setThread(this->arch.getThread());
+
     this->lifting = new(std::nothrow) triton::engines::lifters::LiftingEngine(this->astCtxt, this->symbolic);
     if (this->lifting == nullptr)
       throw triton::exceptions::API("API::initEngines(): Not enough memory.");
 
-    this->irBuilder = new(std::nothrow) triton::arch::IrBuilder(&this->arch, this->modes, this->astCtxt, this->symbolic, this->taint);
+    this->synthesisCache = new(std::nothrow) triton::engines::synthesis::SynthesisCache(this->astCtxt);
+    if (this->synthesisCache == nullptr)
+      throw triton::exceptions::API("API::initEngines(): Not enough memory.");
+
+    this->simplificationCache = new(std::nothrow) triton::ast::SimplificationCache();
+    if (this->simplificationCache == nullptr)
+      throw triton::exceptions::API("API::initEngines(): Not enough memory.");
+
+    this->irBuilder = new(std::nothrow) triton::arch::IrBuilder(&this->arch, this->modes, this->astCtxt, this->symbolic, this->taint, &this->statistics, this->coverage.get());
     if (this->irBuilder == nullptr)
       throw triton::exceptions::API("API::initEngines(): Not enough memory.");
 
+    #ifdef TRITON_UNICORN_INTERFACE
+    this->native = new(std::nothrow) triton::arch::NativeBackend(&this->arch, this->symbolic, this->taint);
+    if (this->native == nullptr)
+      throw triton::exceptions::API("API::initEngines(): Not enough memory.");
+    #endif
+
     /* Setup registers shortcut */
     this->registers.init(this->arch.getArchitecture());
   }
@@ -578,23 +704,35 @@ namespace triton {
     if (this->isArchitectureValid()) {
       delete this->irBuilder;
       delete this->lifting;
+      delete this->native;
+      delete this->simplificationCache;
       delete this->solver;
       delete this->symbolic;
+      delete this->synthesisCache;
       delete this->taint;
 
-      this->astCtxt   = nullptr;
-      this->irBuilder = nullptr;
-      this->lifting   = nullptr;
-      this->solver    = nullptr;
-      this->symbolic  = nullptr;
-      this->taint     = nullptr;
+      this->astCtxt             = nullptr;
+      this->irBuilder           = nullptr;
+      this->lifting             = nullptr;
+      this->native              = nullptr;
+      this->simplificationCache = nullptr;
+      this->solver              = nullptr;
+      this->symbolic            = nullptr;
+      this->synthesisCache      = nullptr;
+      this->taint               = nullptr;
     }
 
     // Clean up the ast context
     this->astCtxt = std::make_shared<triton::ast::AstContext>(this->modes);
+    this->astCtxt->setTracer(this->tracer);
+    this->astCtxt->getNodePool()->setPlacement(this->placement);
 
     // Clean up the registers shortcut
     this->registers.clear();
+    this->observedRegisters.clear();
+
+    // The mark shares the AST context of the removed engines
+    this->mark = nullptr;
   }
 
 
@@ -605,261 +743,1432 @@ namespace triton {
       this->clearArchitecture();
       this->clearCallbacks();
       this->clearModes();
+      this->syscalls = triton::arch::Syscalls();
     }
   }
 
 
-  bool API::processing(triton::arch::Instruction& inst) {
+  API* API::fork(void) const {
     this->checkArchitecture();
-    this->arch.disassembly(inst);
-    return this->irBuilder->buildSemantics(inst);
-  }
-
-
 
-  /* IR builder API ================================================================================= */
+    API* ctx = new(std::nothrow) API();
+    if (ctx == nullptr)
+      throw triton::exceptions::API("API::fork(): Not enough memory.");
+
+    try {
+      /* Both contexts build nodes of the same AST context, trace their events together, share their decoded instructions and their coverage */
+      ctx->modes     = this->modes;
+      ctx->astCtxt   = this->astCtxt;
+      ctx->tracer    = this->tracer;
+      ctx->coverage  = this->coverage;
+      ctx->placement = this->placement;
+      ctx->arch.setArchitecture(this->getArchitecture());
+      ctx->arch.setDisassemblyCache(this->arch.getDisassemblyCache());
+      ctx->initEngines();
+
+      ctx->arch.copyState(this->arch);
+      ctx->symbolic->copyState(*this->symbolic);
+      ctx->taint->copyState(*this->taint);
+      ctx->setSolver(this->getSolver());
+      ctx->syscalls = this->syscalls;
+    }
+    catch (...) {
+      delete ctx;
+      throw;
+    }
 
-  bool API::buildSemantics(triton::arch::Instruction& inst) {
-    this->checkIrBuilder();
-    return this->irBuilder->buildSemantics(inst);
+    return ctx;
   }
 
 
-  triton::ast::SharedAstContext API::getAstContext(void) {
-    return this->astCtxt;
+  void API::setMark(void) {
+    this->checkArchitecture();
+    this->mark.reset(this->fork());
   }
 
 
+  void API::rollbackToMark(void) {
+    this->checkArchitecture();
 
-  /* AST representation API ========================================================================= */
-
-  triton::ast::representations::mode_e API::getAstRepresentationMode(void) const {
-    return this->astCtxt->getRepresentationMode();
-  }
+    if (this->mark == nullptr)
+      throw triton::exceptions::API("API::rollbackToMark(): There is no mark, see setMark().");
 
+    /*
+     * The memories, registers and path constraints are persistent: the pages and entries not written
+     * since the mark are still shared with it, so that replacing the state by the one of the mark only
+     * releases the ones written since.
+     */
+    this->arch.copyState(this->mark->arch);
+    this->symbolic->copyState(*this->mark->symbolic);
+    this->taint->copyState(*this->mark->taint);
+    this->syscalls = this->mark->syscalls;
+  }
+
+
+  void API::removeMark(void) {
+    this->mark = nullptr;
+  }
+
+
+  /*
+   * Layout of a snapshot. All integers are little-endian.
+   *
+   *  header      magic[8], version:u32, architecture:u32, modes:u64, flags:u32, reserved:u32, state size:u64, pages offset:u64
+   *  state       the sections below, one after the other
+   *  pages       the bytes of the pages of the concrete memory, from an offset aligned on the size of a page
+   *
+   * Sections of the state:
+   *
+   *  registers   count:u32, then id:u32, value:u8[64] (the non-zero parent registers)
+   *  memory      count:u64, then address:u64, full:u8, defined:u8[pageSize / 8] (if the page is not full)
+   *  taint       count:u32, then register:u32, labels... and count:u64, then address:u64, labels...
+   *              (labels are count:u32, then label:u32)
+   *  ast         size:u64, then the AST of the expressions and of the path constraints (see AstSerializer)
+   *  variables   count:u64, then id:u64, origin:u64, type:u32, size:u32, alias, comment (strings are size:u32, then bytes)
+   *  origins     count:u64, then id:u64, register:u32, size:u32, address:u64 (the origins of the expressions)
+   *  symbolic    count:u32, then register:u32, expression:u64 and count:u64, then address:u64, expression:u64
+   *  constraints count:u64, then thread:u32, count:u64, comment, branches:u32, then taken:u8, source:u64,
+   *              destination:u64, root:u32, then iterations:u32, then root:u32
+   *
+   * The roots of the AST are the predicates of the path constraints, in order.
+   */
+  static const char snapshotMagic[8] = {'T', 'R', 'T', 'N', 'S', 'N', 'A', 'P'};
+  static const triton::uint32 snapshotVersion = 1;
+  static const triton::usize snapshotHeaderSize = 48;
+
+  /* Header flags */
+  static const triton::uint32 symbolicEnabledFlag = 1;
+  static const triton::uint32 taintEnabledFlag    = 2;
+
+
+  /* Appends a little-endian integer */
+  static void snapshotPut(std::string& out, triton::uint64 value, triton::usize bytes) {
+    for (triton::usize index = 0; index < bytes; index++)
+      out.push_back(static_cast<char>((value >> (index * 8)) & 0xff));
+  }
+
+
+  /* Appends a string */
+  static void snapshotPut(std::string& out, const std::string& value) {
+    snapshotPut(out, value.size(), 4);
+    out.append(value);
+  }
+
+
+  /* Appends taint labels */
+  static void snapshotPut(std::string& out, const triton::engines::taint::TaintLabels& labels) {
+    auto values = labels.getLabels();
+    snapshotPut(out, values.size(), 4);
+    for (triton::uint32 label : values)
+      snapshotPut(out, label, 4);
+  }
+
+
+  /* Reads the fields of a snapshot in place */
+  class SnapshotCursor {
+    private:
+      const triton::uint8* data;
+      triton::usize size;
+      triton::usize offset;
+
+    public:
+      SnapshotCursor(const triton::uint8* data, triton::usize size) : data(data), size(size), offset(0) {}
+
+      const triton::uint8* take(triton::usize bytes) {
+        if (bytes > this->size - this->offset)
+          throw triton::exceptions::API("API::loadSnapshot(): Truncated snapshot.");
+        const triton::uint8* ptr = this->data + this->offset;
+        this->offset += bytes;
+        return ptr;
+      }
+
+      triton::uint64 get(triton::usize bytes) {
+        const triton::uint8* ptr = this->take(bytes);
+        triton::uint64 value = 0;
+        for (triton::usize index = bytes; index > 0; index--)
+          value = (value << 8) | ptr[index - 1];
+        return value;
+      }
+
+      std::string string(void) {
+        triton::usize length = static_cast<triton::usize>(this->get(4));
+        return std::string(reinterpret_cast<const char*>(this->take(length)), length);
+      }
+
+      std::vector<triton::uint32> labels(void) {
+        std::vector<triton::uint32> values(static_cast<triton::usize>(this->get(4)));
+        for (auto& label : values)
+          label = static_cast<triton::uint32>(this->get(4));
+        return values;
+      }
+  };
 
-  void API::setAstRepresentationMode(triton::ast::representations::mode_e mode) {
-    this->astCtxt->setRepresentationMode(mode);
-  }
 
+  void API::saveSnapshot(const std::string& path) const {
+    using Memory = triton::arch::ConcreteMemory;
+
+    this->checkSymbolic();
 
+    const Memory& memory = this->arch.getConcreteMemory();
+    std::string state;
+    std::string value(triton::size::dqqword, '\0');
 
-  /* Callbacks API ================================================================================= */
+    /* Concrete registers */
+    std::vector<std::pair<triton::uint32, triton::uint512>> registers;
+    for (const auto* reg : this->arch.getParentRegisters()) {
+      triton::uint512 v = this->arch.getConcreteRegisterValue(*reg, false);
+      if (v != 0)
+        registers.push_back({reg->getId(), v});
+    }
+    std::sort(registers.begin(), registers.end());
+    snapshotPut(state, registers.size(), 4);
+    for (const auto& reg : registers) {
+      snapshotPut(state, reg.first, 4);
+      triton::utils::fromUintToBuffer(reg.second, reinterpret_cast<triton::uint8*>(&value[0]));
+      state.append(value);
+    }
 
-  template TRITON_EXPORT void API::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&)> cb);
-  template TRITON_EXPORT void API::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::Register&)> cb);
-  template TRITON_EXPORT void API::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&, const triton::uint512& value)> cb);
-  template TRITON_EXPORT void API::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::Register&, const triton::uint512& value)> cb);
-  template TRITON_EXPORT void API::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<triton::ast::SharedAbstractNode(triton::API&, const triton::ast::SharedAbstractNode&)> cb);
+    /* Pages of the concrete memory */
+    std::vector<triton::uint64> pages = memory.getDefinedPages();
+    snapshotPut(state, pages.size(), 8);
+    for (triton::uint64 page : pages) {
+      snapshotPut(state, page, 8);
+      if (memory.isDefined(page, Memory::pageSize)) {
+        snapshotPut(state, 1, 1);
+        continue;
+      }
+      snapshotPut(state, 0, 1);
+      for (triton::uint32 offset = 0; offset < Memory::pageSize; offset += 8) {
+        triton::uint8 bits = 0;
+        for (triton::uint32 bit = 0; bit < 8; bit++)
+          bits |= (memory.isDefined(page + offset + bit) ? 1 : 0) << bit;
+        state.push_back(static_cast<char>(bits));
+      }
+    }
 
-  template TRITON_EXPORT void API::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&)> cb);
-  template TRITON_EXPORT void API::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::Register&)> cb);
-  template TRITON_EXPORT void API::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&, const triton::uint512& value)> cb);
-  template TRITON_EXPORT void API::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::Register&, const triton::uint512& value)> cb);
-  template TRITON_EXPORT void API::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<triton::ast::SharedAbstractNode(triton::API&, const triton::ast::SharedAbstractNode&)> cb);
+    /* Taint */
+    std::vector<const triton::arch::Register*> taintedRegisters;
+    for (const auto* reg : this->taint->getTaintedRegisters())
+      taintedRegisters.push_back(reg);
+    std::sort(taintedRegisters.begin(), taintedRegisters.end(), [](const triton::arch::Register* a, const triton::arch::Register* b) { return a->getId() < b->getId(); });
+    snapshotPut(state, taintedRegisters.size(), 4);
+    for (const auto* reg : taintedRegisters) {
+      snapshotPut(state, reg->getId(), 4);
+      snapshotPut(state, this->taint->getRegisterTaintLabels(*reg));
+    }
 
+    auto taintedMemory = this->taint->getTaintedMemory();
+    std::vector<triton::uint64> taintedAddrs(taintedMemory.begin(), taintedMemory.end());
+    std::sort(taintedAddrs.begin(), taintedAddrs.end());
+    snapshotPut(state, taintedAddrs.size(), 8);
+    for (triton::uint64 addr : taintedAddrs) {
+      snapshotPut(state, addr, 8);
+      snapshotPut(state, this->taint->getMemoryTaintLabels(addr));
+    }
 
-  void API::clearCallbacks(void) {
-    this->callbacks.clearCallbacks();
-  }
+    /* The AST of the expressions and of the path constraints */
+    this->symbolic->buildLazyRegisters();
+
+    std::vector<triton::engines::symbolic::SharedSymbolicExpression> exprs;
+    for (const auto& it : this->symbolic->getSymbolicExpressions())
+      exprs.push_back(it.second);
+    std::sort(exprs.begin(), exprs.end(), [](const triton::engines::symbolic::SharedSymbolicExpression& a, const triton::engines::symbolic::SharedSymbolicExpression& b) { return a->getId() < b->getId(); });
+
+    const auto& constraints = this->symbolic->getPathConstraints();
+    std::vector<triton::ast::SharedAbstractNode> roots;
+    for (const auto& pco : constraints) {
+      for (const auto& branch : pco.getBranchConstraints())
+        roots.push_back(std::get<3>(branch));
+      for (const auto& iteration : pco.getIterations())
+        roots.push_back(iteration);
+    }
 
+    std::ostringstream ast;
+    triton::ast::AstSerializer(this->astCtxt).serialize(ast, roots, exprs);
+    snapshotPut(state, ast.str().size(), 8);
+    state.append(ast.str());
+
+    /* Variables, those which are not in the AST included */
+    std::vector<triton::engines::symbolic::SharedSymbolicVariable> vars;
+    for (const auto& it : this->symbolic->getSymbolicVariables())
+      vars.push_back(it.second);
+    std::sort(vars.begin(), vars.end(), [](const triton::engines::symbolic::SharedSymbolicVariable& a, const triton::engines::symbolic::SharedSymbolicVariable& b) { return a->getId() < b->getId(); });
+    snapshotPut(state, vars.size(), 8);
+    for (const auto& var : vars) {
+      snapshotPut(state, var->getId(), 8);
+      snapshotPut(state, var->getOrigin(), 8);
+      snapshotPut(state, var->getType(), 4);
+      snapshotPut(state, var->getSize(), 4);
+      snapshotPut(state, var->getAlias());
+      snapshotPut(state, var->getComment());
+    }
 
-  triton::ast::SharedAbstractNode API::processCallbacks(triton::callbacks::callback_e kind, triton::ast::SharedAbstractNode node) {
-    if (this->callbacks.isDefined()) {
-      return this->callbacks.processCallbacks(kind, node);
+    /* Origins of the expressions */
+    snapshotPut(state, exprs.size(), 8);
+    for (const auto& expr : exprs) {
+      snapshotPut(state, expr->getId(), 8);
+      snapshotPut(state, expr->getOriginRegister().getId(), 4);
+      snapshotPut(state, expr->getOriginMemory().getSize(), 4);
+      snapshotPut(state, expr->getOriginMemory().getAddress(), 8);
     }
-    return node;
-  }
 
+    /* Symbolic registers and memory */
+    std::map<triton::uint32, triton::usize> symbolicRegisters;
+    for (const auto& it : this->symbolic->getSymbolicRegisters())
+      symbolicRegisters[it.first] = it.second->getId();
+    snapshotPut(state, symbolicRegisters.size(), 4);
+    for (const auto& it : symbolicRegisters) {
+      snapshotPut(state, it.first, 4);
+      snapshotPut(state, it.second, 8);
+    }
 
-  void API::processCallbacks(triton::callbacks::callback_e kind, const triton::arch::MemoryAccess& mem) {
-    if (this->callbacks.isDefined()) {
-      this->callbacks.processCallbacks(kind, mem);
+    std::map<triton::uint64, triton::usize> symbolicMemory;
+    for (const auto& it : this->symbolic->getSymbolicMemory())
+      symbolicMemory[it.first] = it.second->getId();
+    snapshotPut(state, symbolicMemory.size(), 8);
+    for (const auto& it : symbolicMemory) {
+      snapshotPut(state, it.first, 8);
+      snapshotPut(state, it.second, 8);
     }
-  }
 
+    /* Path constraints */
+    triton::uint32 root = 0;
+    snapshotPut(state, constraints.size(), 8);
+    for (const auto& pco : constraints) {
+      snapshotPut(state, pco.getThreadId(), 4);
+      snapshotPut(state, pco.getCount(), 8);
+      snapshotPut(state, pco.getComment());
+      snapshotPut(state, pco.getBranchConstraints().size(), 4);
+      for (const auto& branch : pco.getBranchConstraints()) {
+        snapshotPut(state, std::get<0>(branch), 1);
+        snapshotPut(state, std::get<1>(branch), 8);
+        snapshotPut(state, std::get<2>(branch), 8);
+        snapshotPut(state, root++, 4);
+      }
+      snapshotPut(state, pco.getIterations().size(), 4);
+      for (triton::usize index = 0; index < pco.getIterations().size(); index++)
+        snapshotPut(state, root++, 4);
+    }
 
-  void API::processCallbacks(triton::callbacks::callback_e kind, const triton::arch::Register& reg) {
-    if (this->callbacks.isDefined()) {
-      this->callbacks.processCallbacks(kind, reg);
+    /* Header, the pages follow the state from an offset aligned on the size of a page */
+    triton::uint64 pagesOffset = (snapshotHeaderSize + state.size() + Memory::pageSize - 1) & ~static_cast<triton::uint64>(Memory::pageSize - 1);
+    triton::uint32 flags = (this->symbolic->isEnabled() ? symbolicEnabledFlag : 0) | (this->taint->isEnabled() ? taintEnabledFlag : 0);
+
+    std::string header(snapshotMagic, sizeof(snapshotMagic));
+    snapshotPut(header, snapshotVersion, 4);
+    snapshotPut(header, this->getArchitecture(), 4);
+    snapshotPut(header, this->modes->getEnabledModes(), 8);
+    snapshotPut(header, flags, 4);
+    snapshotPut(header, 0, 4);
+    snapshotPut(header, state.size(), 8);
+    snapshotPut(header, pagesOffset, 8);
+
+    std::ofstream file(path, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file)
+      throw triton::exceptions::API("API::saveSnapshot(): Cannot open the file.");
+
+    file.write(header.data(), header.size());
+    file.write(state.data(), state.size());
+    std::string padding(pagesOffset - snapshotHeaderSize - state.size(), '\0');
+    file.write(padding.data(), padding.size());
+
+    std::string bytes(Memory::pageSize, '\0');
+    for (triton::uint64 page : pages) {
+      memory.read(page, Memory::pageSize, reinterpret_cast<triton::uint8*>(&bytes[0]));
+      file.write(bytes.data(), bytes.size());
     }
+
+    if (!file)
+      throw triton::exceptions::API("API::saveSnapshot(): Cannot write the file.");
   }
 
 
+  void API::loadSnapshot(const std::string& path) {
+    using Memory = triton::arch::ConcreteMemory;
 
-  /* Modes API======================================================================================= */
+    auto file = triton::arch::MappedFile::share(path);
+    const triton::uint8* data = file->getData();
+    SnapshotCursor header(data, file->getSize());
 
-  void API::setMode(triton::modes::mode_e mode, bool flag) {
-    this->modes->setMode(mode, flag);
-  }
+    /* Header */
+    if (file->getSize() < snapshotHeaderSize || std::memcmp(header.take(sizeof(snapshotMagic)), snapshotMagic, sizeof(snapshotMagic)) != 0)
+      throw triton::exceptions::API("API::loadSnapshot(): Not a snapshot.");
 
+    if (header.get(4) != snapshotVersion)
+      throw triton::exceptions::API("API::loadSnapshot(): Unsupported version.");
 
-  bool API::isModeEnabled(triton::modes::mode_e mode) const {
-    return this->modes->isModeEnabled(mode);
-  }
+    auto architecture           = static_cast<triton::arch::architecture_e>(header.get(4));
+    triton::uint64 enabledModes = header.get(8);
+    triton::uint32 flags        = static_cast<triton::uint32>(header.get(4));
+    header.get(4);
+    triton::uint64 stateSize    = header.get(8);
+    triton::uint64 pagesOffset  = header.get(8);
 
+    if (stateSize > file->getSize() - snapshotHeaderSize || pagesOffset < snapshotHeaderSize + stateSize || pagesOffset > file->getSize())
+      throw triton::exceptions::API("API::loadSnapshot(): Truncated snapshot.");
 
-  void API::clearModes(void) {
+    SnapshotCursor cursor(data + snapshotHeaderSize, static_cast<triton::usize>(stateSize));
+
+    /* A fresh state, the modes are set before the AST context builds nodes */
     this->modes->clearModes();
-  }
+    for (triton::uint32 mode = 0; mode < 64; mode++) {
+      if (enabledModes & triton::modes::modeMask(static_cast<triton::modes::mode_e>(mode)))
+        this->modes->setMode(static_cast<triton::modes::mode_e>(mode), true);
+    }
+    this->setArchitecture(architecture);
 
+    /* Concrete registers, set once the symbolic registers are assigned */
+    std::vector<std::pair<triton::uint32, triton::uint512>> concreteRegisters(static_cast<triton::usize>(cursor.get(4)));
+    for (auto& reg : concreteRegisters) {
+      reg.first  = static_cast<triton::uint32>(cursor.get(4));
+      reg.second = triton::utils::fromBufferToUint<triton::uint512>(cursor.take(triton::size::dqqword));
+    }
 
+    /* Pages of the concrete memory, the runs of full pages are backed by the file */
+    triton::uint64 count = cursor.get(8);
+    if (count > (file->getSize() - pagesOffset) / Memory::pageSize)
+      throw triton::exceptions::API("API::loadSnapshot(): Truncated snapshot.");
+
+    triton::uint64 runAddr = 0;
+    triton::uint64 runSize = 0;
+    const triton::uint8* runData = nullptr;
+    for (triton::uint64 index = 0; index < count; index++) {
+      triton::uint64 page = cursor.get(8);
+      bool full = (cursor.get(1) != 0);
+      const triton::uint8* bytes = data + pagesOffset + index * Memory::pageSize;
+
+      if (runSize && (!full || page != runAddr + runSize)) {
+        this->arch.mapConcreteMemoryArea(runAddr, runData, runSize, file);
+        runSize = 0;
+      }
+
+      if (full) {
+        if (runSize == 0) {
+          runAddr = page;
+          runData = bytes;
+        }
+        runSize += Memory::pageSize;
+        continue;
+      }
+
+      const triton::uint8* defined = cursor.take(Memory::pageSize / 8);
+      for (triton::uint32 offset = 0; offset < Memory::pageSize; offset++) {
+        if (defined[offset / 8] & (1 << (offset % 8)))
+          this->arch.setConcreteMemoryValue(page + offset, bytes[offset]);
+      }
+    }
+    if (runSize)
+      this->arch.mapConcreteMemoryArea(runAddr, runData, runSize, file);
+
+    /* Taint */
+    this->taint->enable(true);
+    for (triton::uint64 index = cursor.get(4); index > 0; index--) {
+      const triton::arch::Register& reg = this->getRegister(static_cast<triton::arch::register_e>(cursor.get(4)));
+      this->taint->taintRegister(reg);
+      for (triton::uint32 label : cursor.labels())
+        this->taint->taintRegister(reg, label);
+    }
+    for (triton::uint64 index = cursor.get(8); index > 0; index--) {
+      triton::uint64 addr = cursor.get(8);
+      this->taint->taintMemory(addr);
+      for (triton::uint32 label : cursor.labels())
+        this->taint->taintMemory(addr, label);
+    }
+    this->taint->enable((flags & taintEnabledFlag) != 0);
+
+    /* The AST, read in place */
+    triton::uint64 astSize = cursor.get(8);
+    triton::ast::AstSerializer serializer(this->astCtxt);
+    std::vector<triton::ast::SharedAbstractNode> roots = serializer.deserialize(cursor.take(static_cast<triton::usize>(astSize)), static_cast<triton::usize>(astSize));
+
+    /* Variables, shared with the AST if they are in it */
+    std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicVariable> loaded;
+    for (const auto& var : serializer.getVariables())
+      loaded[var->getId()] = var;
+
+    for (triton::uint64 index = cursor.get(8); index > 0; index--) {
+      auto id     = static_cast<triton::usize>(cursor.get(8));
+      auto origin = cursor.get(8);
+      auto type   = static_cast<triton::engines::symbolic::variable_e>(cursor.get(4));
+      auto size   = static_cast<triton::uint32>(cursor.get(4));
+      auto alias  = cursor.string();
+      auto comment = cursor.string();
+
+      auto it = loaded.find(id);
+      if (it != loaded.end()) {
+        this->symbolic->addSymbolicVariable(it->second);
+        continue;
+      }
+      auto var = std::make_shared<triton::engines::symbolic::SymbolicVariable>(type, origin, id, size, alias);
+      var->setComment(comment);
+      this->symbolic->addSymbolicVariable(var);
+    }
 
-  /* Symbolic engine API ============================================================================ */
+    /* Expressions and their origins */
+    std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicExpression> exprs;
+    for (const auto& expr : serializer.getExpressions())
+      exprs[expr->getId()] = expr;
+
+    auto expressionOf = [&](triton::usize id) -> const triton::engines::symbolic::SharedSymbolicExpression& {
+      auto it = exprs.find(id);
+      if (it == exprs.end())
+        throw triton::exceptions::API("API::loadSnapshot(): Invalid expression.");
+      return it->second;
+    };
+
+    for (triton::uint64 index = cursor.get(8); index > 0; index--) {
+      const auto& expr = expressionOf(static_cast<triton::usize>(cursor.get(8)));
+      auto reg  = static_cast<triton::arch::register_e>(cursor.get(4));
+      auto size = static_cast<triton::uint32>(cursor.get(4));
+      auto addr = cursor.get(8);
+      if (reg != triton::arch::ID_REG_INVALID)
+        expr->setOriginRegister(this->getRegister(reg));
+      if (size)
+        expr->setOriginMemory(triton::arch::MemoryAccess(addr, size));
+      this->symbolic->addSymbolicExpression(expr);
+    }
 
-  triton::engines::symbolic::SymbolicEngine* API::getSymbolicEngine(void) {
-    this->checkSymbolic();
-    return this->symbolic;
-  }
+    /* Symbolic registers and memory */
+    for (triton::uint64 index = cursor.get(4); index > 0; index--) {
+      const triton::arch::Register& reg = this->getRegister(static_cast<triton::arch::register_e>(cursor.get(4)));
+      this->symbolic->assignSymbolicExpressionToRegister(expressionOf(static_cast<triton::usize>(cursor.get(8))), reg);
+    }
+    for (triton::uint64 index = cursor.get(8); index > 0; index--) {
+      triton::uint64 addr = cursor.get(8);
+      this->symbolic->setSymbolicMemory(addr, expressionOf(static_cast<triton::usize>(cursor.get(8))));
+    }
 
+    for (const auto& reg : concreteRegisters)
+      this->arch.setConcreteRegisterValue(this->getRegister(static_cast<triton::arch::register_e>(reg.first)), reg.second);
+
+    /* Path constraints */
+    auto rootOf = [&](triton::uint64 index) -> const triton::ast::SharedAbstractNode& {
+      if (index >= roots.size())
+        throw triton::exceptions::API("API::loadSnapshot(): Invalid path constraint.");
+      return roots[static_cast<triton::usize>(index)];
+    };
+
+    for (triton::uint64 index = cursor.get(8); index > 0; index--) {
+      triton::engines::symbolic::PathConstraint pco;
+      pco.setThreadId(static_cast<triton::uint32>(cursor.get(4)));
+      auto count = static_cast<triton::usize>(cursor.get(8));
+      pco.setComment(cursor.string());
+      for (triton::uint64 branch = cursor.get(4); branch > 0; branch--) {
+        bool taken           = (cursor.get(1) != 0);
+        triton::uint64 src   = cursor.get(8);
+        triton::uint64 dst   = cursor.get(8);
+        pco.addBranchConstraint(taken, src, dst, rootOf(cursor.get(4)));
+      }
+      std::vector<triton::ast::SharedAbstractNode> iterations;
+      for (triton::uint64 iteration = cursor.get(4); iteration > 0; iteration--)
+        iterations.push_back(rootOf(cursor.get(4)));
+      pco.setIterations(iterations);
+      pco.setCount(count);
+      this->symbolic->pushPathConstraint(pco);
+    }
 
-  triton::engines::symbolic::SharedSymbolicVariable API::symbolizeExpression(triton::usize exprId, triton::uint32 symVarSize, const std::string& symVarAlias) {
-    this->checkSymbolic();
-    return this->symbolic->symbolizeExpression(exprId, symVarSize, symVarAlias);
+    this->symbolic->enable((flags & symbolicEnabledFlag) != 0);
   }
 
 
-  triton::engines::symbolic::SharedSymbolicVariable API::symbolizeMemory(const triton::arch::MemoryAccess& mem, const std::string& symVarAlias) {
-    this->checkSymbolic();
-    return this->symbolic->symbolizeMemory(mem, symVarAlias);
+  triton::arch::ProcessingStatistics* API::getStatistics(void) {
+    return &this->statistics;
   }
 
 
-  triton::engines::symbolic::SharedSymbolicVariable API::symbolizeRegister(const triton::arch::Register& reg, const std::string& symVarAlias) {
+  triton::MemoryUsage API::getMemoryUsage(void) const {
     this->checkSymbolic();
-    return this->symbolic->symbolizeRegister(reg, symVarAlias);
-  }
+    this->checkTaint();
+    this->checkSolver();
 
+    triton::MemoryUsage usage;
+    const auto& pool = this->astCtxt->getNodePool();
 
-  triton::ast::SharedAbstractNode API::getOperandAst(const triton::arch::OperandWrapper& op) {
-    this->checkSymbolic();
-    return this->symbolic->getOperandAst(op);
-  }
+    usage.astNodesByKind = this->astCtxt->getLiveNodes();
+    for (const auto& kind : usage.astNodesByKind)
+      usage.astNodes.count += kind.second;
+    usage.astNodes.bytes = pool->getBytesInUse();
+    usage.astReservedBytes = pool->getBytesReserved();
 
+    this->symbolic->getMemoryUsage(usage);
+    this->taint->getMemoryUsage(usage);
 
-  triton::ast::SharedAbstractNode API::getOperandAst(triton::arch::Instruction& inst, const triton::arch::OperandWrapper& op) {
-    this->checkSymbolic();
-    return this->symbolic->getOperandAst(inst, op);
+    const auto& memory = this->arch.getConcreteMemory();
+    usage.concreteMemory.count      = memory.size();
+    usage.concreteMemory.bytes      = memory.getBytes();
+    usage.mappedMemory.count        = memory.getNumberOfMappedPages();
+    usage.mappedMemory.bytes        = usage.mappedMemory.count * triton::arch::ConcreteMemory::pageSize;
+    usage.solverCache.count         = this->solver->getCache()->size();
+    usage.solverCache.bytes         = this->solver->getCache()->getBytes();
+    usage.simplificationCache.count = this->simplificationCache->size();
+    usage.simplificationCache.bytes = this->simplificationCache->getBytes();
+    usage.synthesisCache.count      = this->synthesisCache->size();
+    usage.synthesisCache.bytes      = this->synthesisCache->getBytes();
+
+    return usage;
   }
 
 
-  triton::ast::SharedAbstractNode API::getImmediateAst(const triton::arch::Immediate& imm) {
-    this->checkSymbolic();
-    return this->symbolic->getImmediateAst(imm);
+  triton::utils::EventTracer* API::getTracer(void) {
+    return this->tracer.get();
   }
 
 
-  triton::ast::SharedAbstractNode API::getImmediateAst(triton::arch::Instruction& inst, const triton::arch::Immediate& imm) {
-    this->checkSymbolic();
-    return this->symbolic->getImmediateAst(inst, imm);
+  triton::arch::Coverage* API::getCoverage(void) {
+    return this->coverage.get();
   }
 
 
-  triton::ast::SharedAbstractNode API::getMemoryAst(const triton::arch::MemoryAccess& mem) {
-    this->checkSymbolic();
-    return this->symbolic->getMemoryAst(mem);
+  triton::utils::Executor& API::getExecutor(void) const {
+    return triton::utils::Executor::getDefault();
   }
 
 
-  triton::ast::SharedAbstractNode API::getMemoryAst(triton::arch::Instruction& inst, const triton::arch::MemoryAccess& mem) {
-    this->checkSymbolic();
-    return this->symbolic->getMemoryAst(inst, mem);
+  void API::setMemoryPlacement(const triton::utils::MemoryPlacement& placement) {
+    this->placement = placement;
+    this->astCtxt->getNodePool()->setPlacement(placement);
+    if (this->isArchitectureValid())
+      this->arch.setConcreteMemoryPlacement(placement);
   }
 
 
-  triton::ast::SharedAbstractNode API::getRegisterAst(const triton::arch::Register& reg) {
-    this->checkSymbolic();
-    return this->symbolic->getRegisterAst(reg);
+  const triton::utils::MemoryPlacement& API::getMemoryPlacement(void) const {
+    return this->placement;
   }
 
 
-  triton::ast::SharedAbstractNode API::getRegisterAst(triton::arch::Instruction& inst, const triton::arch::Register& reg) {
-    this->checkSymbolic();
-    return this->symbolic->getRegisterAst(inst, reg);
+  triton::StateObserver& API::getStateObserver(void) {
+    return this->observer;
   }
 
 
-  triton::engines::symbolic::SharedSymbolicExpression API::newSymbolicExpression(const triton::ast::SharedAbstractNode& node, const std::string& comment) {
+  void API::publishState(void) {
+    this->checkArchitecture();
     this->checkSymbolic();
-    return this->symbolic->newSymbolicExpression(node, triton::engines::symbolic::VOLATILE_EXPRESSION, comment);
-  }
 
+    std::unique_ptr<triton::StateView> view(new triton::StateView());
 
-  triton::engines::symbolic::SharedSymbolicVariable API::newSymbolicVariable(triton::uint32 varSize, const std::string& alias) {
-    this->checkSymbolic();
-    return this->symbolic->newSymbolicVariable(triton::engines::symbolic::UNDEFINED_VARIABLE, 0, varSize, alias);
-  }
+    if (this->observedRegisters.empty()) {
+      for (const auto* reg : this->arch.getParentRegisters())
+        this->observedRegisters.push_back(reg);
+    }
 
+    for (const auto* reg : this->observedRegisters)
+      view->registers[reg->getId()] = this->arch.getConcreteRegisterValue(*reg, false);
 
-  void API::removeSymbolicExpression(const triton::engines::symbolic::SharedSymbolicExpression& expr) {
-    this->checkSymbolic();
-    return this->symbolic->removeSymbolicExpression(expr);
+    /* Persistent structures, only their roots are copied */
+    view->memory            = this->arch.getConcreteMemory();
+    view->symbolicRegisters = this->symbolic->getPersistentSymbolicRegisters();
+    view->pathConstraints   = this->symbolic->getPersistentPathConstraints();
+
+    this->observer.publish(view.release());
   }
 
 
-  const triton::engines::symbolic::SharedSymbolicExpression& API::createSymbolicExpression(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, const triton::arch::OperandWrapper& dst, const std::string& comment) {
-    this->checkSymbolic();
-    return this->symbolic->createSymbolicExpression(inst, node, dst, comment);
+  void API::disassemble(triton::arch::Instruction& inst) {
+    triton::arch::PhaseTimer timer(&this->statistics, triton::arch::PHASE_DISASSEMBLY);
+    this->arch.disassembly(inst);
   }
 
 
-  const triton::engines::symbolic::SharedSymbolicExpression& API::createSymbolicMemoryExpression(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, const triton::arch::MemoryAccess& mem, const std::string& comment) {
-    this->checkSymbolic();
-    return this->symbolic->createSymbolicMemoryExpression(inst, node, mem, comment);
+  bool API::processing(triton::arch::Instruction& inst) {
+    this->checkArchitecture();
+    this->disassemble(inst);
+    return this->processDecoded(inst);
   }
 
 
-  const triton::engines::symbolic::SharedSymbolicExpression& API::createSymbolicRegisterExpression(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, const triton::arch::Register& reg, const std::string& comment) {
-    this->checkSymbolic();
-    return this->symbolic->createSymbolicRegisterExpression(inst, node, reg, comment);
+  bool API::processDecoded(triton::arch::Instruction& inst) {
+    bool ret = this->irBuilder->buildSemantics(inst);
+    if (this->observer.isEnabled() && inst.isControlFlow())
+      this->publishState();
+
+    return ret;
   }
 
 
-  const triton::engines::symbolic::SharedSymbolicExpression& API::createSymbolicVolatileExpression(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, const std::string& comment) {
-    this->checkSymbolic();
-    return this->symbolic->createSymbolicVolatileExpression(inst, node, comment);
-  }
+  bool API::processing(std::vector<triton::arch::Instruction>& block) {
+    bool ret = true;
+
+    this->checkArchitecture();
+    triton::utils::TraceScope scope(this->tracer.get(), "processBlock", "processing", block.empty() ? 0 : block.front().getAddress());
+    this->symbolic->beginBlock(block.empty() ? 0 : block.front().getAddress());
+
+    try {
+      for (auto& inst : block) {
+        this->disassemble(inst);
+        ret &= this->irBuilder->buildSemantics(inst);
+      }
+    }
+    catch (...) {
+      this->symbolic->endBlock();
+      throw;
+    }
 
+    this->symbolic->endBlock();
+    if (this->observer.isEnabled())
+      this->publishState();
 
-  void API::assignSymbolicExpressionToMemory(const triton::engines::symbolic::SharedSymbolicExpression& se, const triton::arch::MemoryAccess& mem) {
-    this->checkSymbolic();
-    this->symbolic->assignSymbolicExpressionToMemory(se, mem);
+    return ret;
   }
 
 
-  void API::assignSymbolicExpressionToRegister(const triton::engines::symbolic::SharedSymbolicExpression& se, const triton::arch::Register& reg) {
-    this->checkSymbolic();
-    this->symbolic->assignSymbolicExpressionToRegister(se, reg);
-  }
+  std::vector<triton::arch::Instruction> API::processBlock(triton::uint64 addr, triton::uint64* next) {
+    std::vector<triton::arch::Instruction> block;
+    triton::uint8 opcodes[16];
 
+    this->checkArchitecture();
+    triton::utils::TraceScope scope(this->tracer.get(), "processBlock", "processing", addr);
+    this->symbolic->beginBlock(addr);
 
-  triton::engines::symbolic::SharedSymbolicExpression API::getSymbolicMemory(triton::uint64 addr) const {
-    this->checkSymbolic();
-    return this->symbolic->getSymbolicMemory(addr);
-  }
+    try {
+      while (this->arch.isConcreteMemoryValueDefined(addr)) {
+        this->arch.getConcreteMemoryAreaValue(addr, opcodes, sizeof(opcodes));
+        block.push_back(triton::arch::Instruction(addr, opcodes, sizeof(opcodes)));
 
+        triton::arch::Instruction& inst = block.back();
+        this->disassemble(inst);
 
-  std::unordered_map<triton::arch::register_e, triton::engines::symbolic::SharedSymbolicExpression> API::getSymbolicRegisters(void) const {
-    this->checkSymbolic();
-    return this->symbolic->getSymbolicRegisters();
-  }
+        /* The unsupported instruction is not executed, the block resumes at it */
+        if (this->irBuilder->buildSemantics(inst) == false)
+          break;
 
+        /* The terminator of the block sets the program counter */
+        if (inst.isControlFlow()) {
+          addr = this->arch.getConcreteRegisterValue(this->arch.getProgramCounter()).convert_to<triton::uint64>();
+          break;
+        }
 
-  std::unordered_map<triton::uint64, triton::engines::symbolic::SharedSymbolicExpression> API::getSymbolicMemory(void) const {
-    this->checkSymbolic();
-    return this->symbolic->getSymbolicMemory();
+        addr = inst.getNextAddress();
+      }
+    }
+    catch (...) {
+      this->symbolic->endBlock();
+      throw;
+    }
+
+    this->symbolic->endBlock();
+    if (this->observer.isEnabled())
+      this->publishState();
+
+    if (next)
+      *next = addr;
+
+    return block;
   }
 
 
-  const triton::engines::symbolic::SharedSymbolicExpression& API::getSymbolicRegister(const triton::arch::Register& reg) const {
-    this->checkSymbolic();
-    return this->symbolic->getSymbolicRegister(reg);
+  triton::arch::EmulationResult API::emulate(triton::uint64 start, const triton::arch::EmulationOptions& options) {
+    triton::arch::EmulationResult result;
+    triton::arch::Instruction inst;
+    triton::uint8 opcodes[16];
+    triton::uint64 pc = start;
+
+    this->checkArchitecture();
+    #ifdef TRITON_UNICORN_INTERFACE
+    bool resumed = false;
+    #else
+    if (options.native)
+      throw triton::exceptions::API("API::emulate(): Triton not built with Unicorn.");
+    #endif
+
+    triton::utils::TraceScope scope(this->tracer.get(), "emulate", "processing", start);
+    const triton::arch::Register& pcReg = this->arch.getProgramCounter();
+
+    while (true) {
+      triton::arch::emulation_e reason = triton::arch::EMULATION_ADDRESS;
+      triton::usize executed = 0;
+      bool syscall = false;
+      bool stop = false;
+
+      /* A hook runs out of any block, so that it sees the deferred expressions */
+      auto hook = options.hooks.find(pc);
+      if (hook != options.hooks.end()) {
+        this->arch.setConcreteRegisterValue(pcReg, pc);
+        if (hook->second(*this, pc) == false) {
+          result.reason = triton::arch::EMULATION_HOOK;
+          result.pc     = pc;
+          return result;
+        }
+        /* The hook may move the program counter, the instruction at the new one is not hooked again */
+        pc = this->arch.getConcreteRegisterValue(pcReg).convert_to<triton::uint64>();
+      }
+
+      #ifdef TRITON_UNICORN_INTERFACE
+      /* After a native run, the instruction which stopped it runs in Triton */
+      if (options.native && !resumed && this->native->isConcrete()
+          && (result.instructions == 0 || options.stops.find(pc) == options.stops.end())
+          && (options.maxInstructions == 0 || result.instructions < options.maxInstructions)) {
+        triton::usize limit = options.maxInstructions ? options.maxInstructions - result.instructions : 0;
+        triton::usize count = this->native->run(pc, options, limit);
+        result.instructions += count;
+        result.native       += count;
+        resumed = true;
+        continue;
+      }
+      resumed = false;
+      #endif
+
+      this->symbolic->beginBlock(pc);
+      try {
+        while (true) {
+          /* The start address does not stop the emulation, so that it can be resumed */
+          if ((result.instructions || pc != start) && options.stops.find(pc) != options.stops.end()) {
+            reason = triton::arch::EMULATION_ADDRESS;
+            stop   = true;
+            break;
+          }
+
+          if (options.maxInstructions && result.instructions >= options.maxInstructions) {
+            reason = triton::arch::EMULATION_COUNT;
+            stop   = true;
+            break;
+          }
+
+          /* A hooked instruction starts a new block */
+          if (executed && options.hooks.find(pc) != options.hooks.end())
+            break;
+
+          if (!this->arch.isConcreteMemoryValueDefined(pc)) {
+            reason = triton::arch::EMULATION_UNDEFINED;
+            stop   = true;
+            break;
+          }
+
+          /* The instruction is reused, its containers keep their capacity */
+          this->arch.getConcreteMemoryAreaValue(pc, opcodes, sizeof(opcodes));
+          inst.reset(pc, opcodes, sizeof(opcodes));
+          this->disassemble(inst);
+
+          /* The unsupported instruction is not executed, the emulation resumes at it */
+          if (this->irBuilder->buildSemantics(inst) == false) {
+            reason = triton::arch::EMULATION_UNSUPPORTED;
+            stop   = true;
+            break;
+          }
+          result.instructions++;
+          executed++;
+
+          /* A syscall ends its block, its handler runs out of it */
+          if (options.syscalls && triton::arch::Syscalls::isSyscall(inst, this->getArchitecture())) {
+            pc      = this->arch.getConcreteRegisterValue(pcReg).convert_to<triton::uint64>();
+            syscall = true;
+            break;
+          }
+
+          if (!inst.isControlFlow()) {
+            pc = inst.getNextAddress();
+            continue;
+          }
+
+          /* The terminator of the block sets the program counter */
+          pc = this->arch.getConcreteRegisterValue(pcReg).convert_to<triton::uint64>();
+          if (options.stopOnSymbolicPc && this->isSymbolicEngineEnabled()) {
+            const triton::engines::symbolic::SharedSymbolicExpression& expr = this->symbolic->getSymbolicRegister(pcReg);
+            if (expr != nullptr && expr->getAst()->isSymbolized()) {
+              reason = triton::arch::EMULATION_SYMBOLIC_PC;
+              stop   = true;
+            }
+          }
+          break;
+        }
+      }
+      catch (...) {
+        this->symbolic->endBlock();
+        throw;
+      }
+
+      this->symbolic->endBlock();
+      if (executed)
+        result.blocks++;
+
+      if (syscall) {
+        triton::arch::Syscall call;
+        if (!this->syscalls.execute(*this, call)) {
+          reason = triton::arch::EMULATION_SYSCALL;
+          stop   = true;
+        }
+        else if (call.exit) {
+          reason        = triton::arch::EMULATION_EXIT;
+          result.status = call.ret;
+          stop          = true;
+        }
+      }
+
+      if (stop) {
+        result.reason = reason;
+        result.pc     = pc;
+        return result;
+      }
+    }
   }
 
 
-  triton::uint8 API::getSymbolicMemoryValue(triton::uint64 address) {
-    this->checkSymbolic();
-    return this->symbolic->getSymbolicMemoryValue(address);
+  void API::setSyscallHandler(triton::uint64 number, const triton::arch::SyscallHandler& handler) {
+    this->syscalls.setHandler(number, handler);
+  }
+
+
+  void API::removeSyscallHandler(triton::uint64 number) {
+    this->syscalls.removeHandler(number);
+  }
+
+
+  void API::setSyscallFile(const std::string& path, const std::vector<triton::uint8>& content, bool symbolize) {
+    this->syscalls.setFile(path, content, symbolize);
+  }
+
+
+  const std::vector<triton::uint8>& API::getSyscallFile(const std::string& path) const {
+    return this->syscalls.getFile(path);
+  }
+
+
+  void API::setSyscallLayout(triton::uint64 heap, triton::uint64 mmap) {
+    this->syscalls.setLayout(heap, mmap);
+  }
+
+
+  triton::usize API::processTrace(std::istream& stream, triton::arch::trace_e format, triton::usize decoders) {
+    triton::arch::TraceReader reader(stream, format);
+    return this->processTrace(reader, format, decoders);
+  }
+
+
+  triton::usize API::processTrace(const triton::uint8* data, triton::usize size, triton::arch::trace_e format, triton::usize decoders) {
+    triton::arch::TraceReader reader(data, size, format);
+    return this->processTrace(reader, format, decoders);
+  }
+
+
+  triton::usize API::processTrace(const std::string& path, triton::arch::trace_e format, triton::usize decoders) {
+    triton::arch::MappedFile file(path);
+    triton::arch::TraceReader reader(file.getData(), file.getSize(), format);
+    return this->processTrace(reader, format, decoders);
+  }
+
+
+  triton::usize API::processTrace(triton::arch::TraceReader& reader, triton::arch::trace_e format, triton::usize decoders, triton::engines::symbolic::SegmentSummary* segment) {
+    triton::usize count = 0;
+
+    this->checkArchitecture();
+
+    /* The decoding of Arm32 depends on the previous instructions (Thumb mode, IT blocks), it stays sequential */
+    if (this->getArchitecture() == triton::arch::ARCH_ARM32)
+      decoders = 0;
+
+    /*
+     * The decoders only read the specifications of the CPU and the disassembly cache, which is
+     * locked. An instruction without address would read the program counter, the consumer decodes it.
+     */
+    auto decode = [this](triton::arch::Instruction& inst) {
+      if (!inst.getAddress())
+        return false;
+      this->arch.disassembly(inst);
+      return true;
+    };
+
+    /* Sets a memory area if the emulated one differs */
+    auto sync = [&](triton::uint64 addr, const std::vector<triton::uint8>& bytes) {
+      if (this->arch.getConcreteMemoryAreaValue(addr, bytes.size(), false) != bytes)
+        this->setConcreteMemoryAreaValue(addr, bytes);
+    };
+
+    /*
+     * Records the bytes of memory touched by a segment. The bytes read by a compact record before the
+     * segment touches them are its live-ins, they take their recorded value and are symbolized.
+     */
+    auto touch = [&](triton::uint64 addr, const std::vector<triton::uint8>& bytes, bool read) {
+      for (triton::usize index = 0; index < bytes.size(); index++) {
+        triton::uint64 byte = addr + index;
+        if (!segment->memory.emplace(byte, nullptr).second || !read || segment->index == 0)
+          continue;
+        this->arch.setConcreteMemoryValue(byte, bytes[index]);
+        auto var = this->symbolizeMemory(triton::arch::MemoryAccess(byte, triton::size::byte));
+        segment->liveIns.push_back({var, 0, triton::arch::ID_REG_INVALID, byte, bytes[index]});
+      }
+    };
+
+    triton::arch::TracePipeline pipeline(reader, decode, decoders);
+    return pipeline.run([&](triton::arch::TraceRecord& record, triton::arch::Instruction& inst, bool decoded) {
+      if (segment) {
+        for (const auto& area : record.memory)
+          touch(area.first, area.second, format == triton::arch::TRACE_COMPACT);
+        for (const auto& area : record.writes)
+          touch(area.first, area.second, false);
+      }
+
+      if (format != triton::arch::TRACE_COMPACT) {
+        for (const auto& reg : record.registers)
+          this->setConcreteRegisterValue(this->getRegister(reg.first), reg.second);
+
+        for (const auto& area : record.memory)
+          this->setConcreteMemoryAreaValue(area.first, area.second);
+      }
+      else {
+        /* Switch to the registers of the thread, the first one keeps the current registers */
+        if (record.thread != this->arch.getThread()) {
+          std::vector<triton::uint32> threads = this->arch.getThreads();
+          bool known = std::find(threads.begin(), threads.end(), record.thread) != threads.end();
+
+          this->setThread(record.thread);
+
+          /* A new thread starts from the concrete state, its deltas hold its registers */
+          if (!known && count != 0 && this->symbolic)
+            this->concretizeAllRegister();
+        }
+
+        for (const auto& reg : record.registerIds) {
+          const triton::arch::Register& r = this->getRegister(reg.first);
+          if (this->arch.getConcreteRegisterValue(r, false) != reg.second)
+            this->setConcreteRegisterValue(r, reg.second);
+        }
+
+        for (const auto& area : record.memory)
+          sync(area.first, area.second);
+      }
+
+      if (!decoded)
+        this->disassemble(inst);
+      this->processDecoded(inst);
+      count++;
+
+      for (const auto& area : record.writes)
+        sync(area.first, area.second);
+    });
+  }
+
+
+  /* Returns the concrete registers of every thread of an architecture, the immutable ones skipped */
+  static triton::engines::symbolic::SegmentBoundary captureBoundary(triton::arch::Architecture& arch, triton::usize index) {
+    triton::engines::symbolic::SegmentBoundary boundary;
+
+    boundary.index  = index;
+    boundary.thread = arch.getThread();
+
+    /* Only the concrete registers are switched, the current thread is restored before they are used */
+    for (triton::uint32 tid : arch.getThreads()) {
+      auto& registers = boundary.registers[tid];
+      arch.setThread(tid);
+      for (const auto* reg : arch.getParentRegisters()) {
+        if (reg->isMutable())
+          registers.push_back({reg->getId(), arch.getConcreteRegisterValue(*reg, false)});
+      }
+    }
+    arch.setThread(boundary.thread);
+
+    return boundary;
+  }
+
+
+  triton::engines::symbolic::SegmentBoundary API::captureSegmentBoundary(triton::usize index) {
+    this->checkArchitecture();
+    return captureBoundary(this->arch, index);
+  }
+
+
+  std::vector<triton::engines::symbolic::SegmentBoundary> API::scanTraceBoundaries(const triton::uint8* data, triton::usize size, triton::arch::trace_e format, triton::usize length) {
+    triton::arch::TraceReader reader(data, size, format);
+    return this->scanTraceBoundaries(reader, format, length);
+  }
+
+
+  std::vector<triton::engines::symbolic::SegmentBoundary> API::scanTraceBoundaries(const std::string& path, triton::arch::trace_e format, triton::usize length) {
+    triton::arch::MappedFile file(path);
+    triton::arch::TraceReader reader(file.getData(), file.getSize(), format);
+    return this->scanTraceBoundaries(reader, format, length);
+  }
+
+
+  std::vector<triton::engines::symbolic::SegmentBoundary> API::scanTraceBoundaries(triton::arch::TraceReader& reader, triton::arch::trace_e format, triton::usize length) {
+    std::vector<triton::engines::symbolic::SegmentBoundary> boundaries;
+    triton::arch::Architecture scratch;
+    triton::arch::TraceRecord record;
+    triton::usize index = 0;
+
+    if (length == 0)
+      throw triton::exceptions::API("API::scanTraceBoundaries(): The segments must hold at least one record.");
+
+    /* The registers are applied to a scratch architecture, which handles the sub-registers and the flags */
+    auto initial = this->captureSegmentBoundary(0);
+    scratch.setArchitecture(this->getArchitecture());
+    for (const auto& thread : initial.registers) {
+      scratch.setThread(thread.first);
+      for (const auto& reg : thread.second)
+        scratch.setConcreteRegisterValue(scratch.getRegister(reg.first), reg.second);
+    }
+    scratch.setThread(initial.thread);
+
+    /*
+     * A boundary holds the registers of its record: a segment symbolizes them before the record is applied,
+     * so that a compact record agreeing with them keeps them symbolic, as the processing of the whole trace does.
+     */
+    while (reader.next(record)) {
+      if (format != triton::arch::TRACE_COMPACT) {
+        for (const auto& reg : record.registers)
+          scratch.setConcreteRegisterValue(scratch.getRegister(reg.first), reg.second);
+      }
+      else {
+        /* A new thread starts with a copy of the current registers, its deltas hold its registers */
+        if (record.thread != scratch.getThread())
+          scratch.setThread(record.thread);
+        for (const auto& reg : record.registerIds)
+          scratch.setConcreteRegisterValue(scratch.getRegister(reg.first), reg.second);
+      }
+
+      if (index % length == 0)
+        boundaries.push_back(captureBoundary(scratch, index));
+
+      index++;
+    }
+
+    return boundaries;
+  }
+
+
+  triton::engines::symbolic::SegmentSummary API::processTraceSegment(const triton::uint8* data, triton::usize size, triton::arch::trace_e format, const triton::engines::symbolic::SegmentBoundary& boundary, triton::usize count, triton::usize decoders) {
+    triton::arch::TraceReader reader(data, size, format);
+    return this->processTraceSegment(reader, format, boundary, count, decoders);
+  }
+
+
+  triton::engines::symbolic::SegmentSummary API::processTraceSegment(const std::string& path, triton::arch::trace_e format, const triton::engines::symbolic::SegmentBoundary& boundary, triton::usize count, triton::usize decoders) {
+    triton::arch::MappedFile file(path);
+    triton::arch::TraceReader reader(file.getData(), file.getSize(), format);
+    return this->processTraceSegment(reader, format, boundary, count, decoders);
+  }
+
+
+  triton::engines::symbolic::SegmentSummary API::processTraceSegment(triton::arch::TraceReader& reader, triton::arch::trace_e format, const triton::engines::symbolic::SegmentBoundary& boundary, triton::usize count, triton::usize decoders) {
+    triton::engines::symbolic::SegmentSummary segment;
+
+    this->checkSymbolic();
+
+    if (reader.skip(boundary.index) != boundary.index)
+      throw triton::exceptions::API("API::processTraceSegment(): The trace ends before the segment.");
+    reader.setLimit(count);
+
+    segment.index = boundary.index;
+    segment.count = 0;
+
+    /* The registers at the boundary are the live-ins of the segment, the first one starts from the context */
+    if (boundary.index != 0) {
+      for (const auto& thread : boundary.registers) {
+        this->setThread(thread.first);
+        for (const auto& reg : thread.second) {
+          const triton::arch::Register& r = this->getRegister(reg.first);
+          this->setConcreteRegisterValue(r, reg.second);
+          segment.liveIns.push_back({this->symbolizeRegister(r), thread.first, reg.first, 0, reg.second});
+        }
+      }
+      this->setThread(boundary.thread);
+    }
+
+    triton::usize first = this->getPathConstraints().size();
+    segment.count = this->processTrace(reader, format, decoders, &segment);
+
+    const auto& pcs = this->getPathConstraints();
+    segment.pathConstraints.assign(pcs.begin() + std::min(first, pcs.size()), pcs.end());
+
+    /* The final state: the registers of every thread, and the memory touched or symbolic */
+    triton::uint32 current = this->arch.getThread();
+    for (triton::uint32 tid : this->getThreads()) {
+      this->setThread(tid);
+      for (const auto* reg : this->getParentRegisters()) {
+        const auto& expr = this->getSymbolicRegister(*reg);
+        segment.registers[{tid, reg->getId()}] = expr ? expr->getAst() : nullptr;
+      }
+    }
+    this->setThread(current);
+
+    for (const auto& cell : this->getSymbolicMemory())
+      segment.memory[cell.first] = nullptr;
+
+    for (auto& cell : segment.memory) {
+      auto expr = this->getSymbolicMemory(cell.first);
+      cell.second = expr ? expr->getAst() : nullptr;
+    }
+
+    return segment;
+  }
+
+
+
+  /* IR builder API ================================================================================= */
+
+  bool API::buildSemantics(triton::arch::Instruction& inst) {
+    this->checkIrBuilder();
+    return this->irBuilder->buildSemantics(inst);
+  }
+
+
+  triton::ast::SharedAstContext API::getAstContext(void) {
+    return this->astCtxt;
+  }
+
+
+  void API::setFunctionSummary(triton::uint64 addr, const std::string& symbol) {
+    this->checkIrBuilder();
+    this->irBuilder->getFunctionSummaries().setSummary(addr, symbol);
+  }
+
+
+  void API::removeFunctionSummary(triton::uint64 addr) {
+    this->checkIrBuilder();
+    this->irBuilder->getFunctionSummaries().removeSummary(addr);
+  }
+
+
+  std::map<triton::uint64, std::string> API::getFunctionSummaries(void) {
+    this->checkIrBuilder();
+    return this->irBuilder->getFunctionSummaries().getSummaries();
+  }
+
+
+
+  /* AST representation API ========================================================================= */
+
+  triton::ast::representations::mode_e API::getAstRepresentationMode(void) const {
+    return this->astCtxt->getRepresentationMode();
+  }
+
+
+  void API::setAstRepresentationMode(triton::ast::representations::mode_e mode) {
+    this->astCtxt->setRepresentationMode(mode);
+  }
+
+
+
+  /* Callbacks API ================================================================================= */
+
+  template TRITON_EXPORT void API::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, triton::uint64 baseAddr, triton::usize size)> cb);
+  template TRITON_EXPORT void API::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, triton::uint64 baseAddr, const std::vector<triton::uint8>& values)> cb);
+  template TRITON_EXPORT void API::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&)> cb);
+  template TRITON_EXPORT void API::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::Register&)> cb);
+  template TRITON_EXPORT void API::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&, const triton::uint512& value)> cb);
+  template TRITON_EXPORT void API::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::Register&, const triton::uint512& value)> cb);
+  template TRITON_EXPORT void API::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<triton::ast::SharedAbstractNode(triton::API&, const triton::ast::SharedAbstractNode&)> cb);
+  template TRITON_EXPORT void API::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&)> cb, const triton::callbacks::memoryRanges& ranges);
+  template TRITON_EXPORT void API::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&, const triton::uint512& value)> cb, const triton::callbacks::memoryRanges& ranges);
+
+  template TRITON_EXPORT void API::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, triton::uint64 baseAddr, triton::usize size)> cb);
+  template TRITON_EXPORT void API::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, triton::uint64 baseAddr, const std::vector<triton::uint8>& values)> cb);
+  template TRITON_EXPORT void API::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&)> cb);
+  template TRITON_EXPORT void API::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::Register&)> cb);
+  template TRITON_EXPORT void API::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&, const triton::uint512& value)> cb);
+  template TRITON_EXPORT void API::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::Register&, const triton::uint512& value)> cb);
+  template TRITON_EXPORT void API::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<triton::ast::SharedAbstractNode(triton::API&, const triton::ast::SharedAbstractNode&)> cb);
+
+
+  void API::clearCallbacks(void) {
+    this->callbacks.clearCallbacks();
+  }
+
+
+  triton::ast::SharedAbstractNode API::processCallbacks(triton::callbacks::callback_e kind, triton::ast::SharedAbstractNode node) {
+    if (this->callbacks.isDefined()) {
+      return this->callbacks.processCallbacks(kind, node);
+    }
+    return node;
+  }
+
+
+  void API::processCallbacks(triton::callbacks::callback_e kind, const triton::arch::MemoryAccess& mem) {
+    if (this->callbacks.isDefined()) {
+      this->callbacks.processCallbacks(kind, mem);
+    }
+  }
+
+
+  void API::processCallbacks(triton::callbacks::callback_e kind, const triton::arch::Register& reg) {
+    if (this->callbacks.isDefined()) {
+      this->callbacks.processCallbacks(kind, reg);
+    }
+  }
+
+
+
+  /* Modes API======================================================================================= */
+
+  void API::setMode(triton::modes::mode_e mode, bool flag) {
+    this->modes->setMode(mode, flag);
+  }
+
+
+  bool API::isModeEnabled(triton::modes::mode_e mode) const {
+    return this->modes->isModeEnabled(mode);
+  }
+
+
+  void API::clearModes(void) {
+    this->modes->clearModes();
+  }
+
+
+
+  /* Symbolic engine API ============================================================================ */
+
+  triton::engines::symbolic::SymbolicEngine* API::getSymbolicEngine(void) {
+    this->checkSymbolic();
+    return this->symbolic;
+  }
+
+
+  triton::engines::symbolic::SharedSymbolicVariable API::symbolizeExpression(triton::usize exprId, triton::uint32 symVarSize, const std::string& symVarAlias) {
+    this->checkSymbolic();
+    return this->symbolic->symbolizeExpression(exprId, symVarSize, symVarAlias);
+  }
+
+
+  triton::engines::symbolic::SharedSymbolicVariable API::symbolizeMemory(const triton::arch::MemoryAccess& mem, const std::string& symVarAlias) {
+    this->checkSymbolic();
+    return this->symbolic->symbolizeMemory(mem, symVarAlias);
+  }
+
+
+  std::vector<triton::engines::symbolic::SharedSymbolicVariable> API::symbolizeMemoryArea(triton::uint64 baseAddr, triton::usize size, triton::uint32 granularity, const std::string& aliasPrefix) {
+    this->checkSymbolic();
+    return this->symbolic->symbolizeMemoryArea(baseAddr, size, granularity, aliasPrefix);
+  }
+
+
+  triton::engines::symbolic::SharedSymbolicVariable API::symbolizeRegister(const triton::arch::Register& reg, const std::string& symVarAlias) {
+    this->checkSymbolic();
+    return this->symbolic->symbolizeRegister(reg, symVarAlias);
+  }
+
+
+  triton::ast::SharedAbstractNode API::getOperandAst(const triton::arch::OperandWrapper& op) {
+    this->checkSymbolic();
+    return this->symbolic->getOperandAst(op);
+  }
+
+
+  triton::ast::SharedAbstractNode API::getOperandAst(triton::arch::Instruction& inst, const triton::arch::OperandWrapper& op) {
+    this->checkSymbolic();
+    return this->symbolic->getOperandAst(inst, op);
+  }
+
+
+  triton::ast::SharedAbstractNode API::getImmediateAst(const triton::arch::Immediate& imm) {
+    this->checkSymbolic();
+    return this->symbolic->getImmediateAst(imm);
+  }
+
+
+  triton::ast::SharedAbstractNode API::getImmediateAst(triton::arch::Instruction& inst, const triton::arch::Immediate& imm) {
+    this->checkSymbolic();
+    return this->symbolic->getImmediateAst(inst, imm);
+  }
+
+
+  triton::ast::SharedAbstractNode API::getMemoryAst(const triton::arch::MemoryAccess& mem) {
+    this->checkSymbolic();
+    return this->symbolic->getMemoryAst(mem);
+  }
+
+
+  triton::ast::SharedAbstractNode API::getMemoryAst(triton::arch::Instruction& inst, const triton::arch::MemoryAccess& mem) {
+    this->checkSymbolic();
+    return this->symbolic->getMemoryAst(inst, mem);
+  }
+
+
+  triton::ast::SharedAbstractNode API::getRegisterAst(const triton::arch::Register& reg) {
+    this->checkSymbolic();
+    return this->symbolic->getRegisterAst(reg);
+  }
+
+
+  triton::ast::SharedAbstractNode API::getRegisterAst(triton::arch::Instruction& inst, const triton::arch::Register& reg) {
+    this->checkSymbolic();
+    return this->symbolic->getRegisterAst(inst, reg);
+  }
+
+
+  triton::engines::symbolic::SharedSymbolicExpression API::newSymbolicExpression(const triton::ast::SharedAbstractNode& node, const std::string& comment) {
+    this->checkSymbolic();
+    return this->symbolic->newSymbolicExpression(node, triton::engines::symbolic::VOLATILE_EXPRESSION, comment);
+  }
+
+
+  triton::engines::symbolic::SharedSymbolicVariable API::newSymbolicVariable(triton::uint32 varSize, const std::string& alias) {
+    this->checkSymbolic();
+    return this->symbolic->newSymbolicVariable(triton::engines::symbolic::UNDEFINED_VARIABLE, 0, varSize, alias);
+  }
+
+
+  void API::removeSymbolicExpression(const triton::engines::symbolic::SharedSymbolicExpression& expr) {
+    this->checkSymbolic();
+    return this->symbolic->removeSymbolicExpression(expr);
+  }
+
+
+  const triton::engines::symbolic::SharedSymbolicExpression& API::createSymbolicExpression(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, const triton::arch::OperandWrapper& dst, const std::string& comment) {
+    this->checkSymbolic();
+    return this->symbolic->createSymbolicExpression(inst, node, dst, comment);
+  }
+
+
+  const triton::engines::symbolic::SharedSymbolicExpression& API::createSymbolicMemoryExpression(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, const triton::arch::MemoryAccess& mem, const std::string& comment) {
+    this->checkSymbolic();
+    return this->symbolic->createSymbolicMemoryExpression(inst, node, mem, comment);
+  }
+
+
+  const triton::engines::symbolic::SharedSymbolicExpression& API::createSymbolicRegisterExpression(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, const triton::arch::Register& reg, const std::string& comment) {
+    this->checkSymbolic();
+    return this->symbolic->createSymbolicRegisterExpression(inst, node, reg, comment);
+  }
+
+
+  const triton::engines::symbolic::SharedSymbolicExpression& API::createSymbolicVolatileExpression(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, const std::string& comment) {
+    this->checkSymbolic();
+    return this->symbolic->createSymbolicVolatileExpression(inst, node, comment);
+  }
+
+
+  void API::assignSymbolicExpressionToMemory(const triton::engines::symbolic::SharedSymbolicExpression& se, const triton::arch::MemoryAccess& mem) {
+    this->checkSymbolic();
+    this->symbolic->assignSymbolicExpressionToMemory(se, mem);
+  }
+
+
+  void API::assignSymbolicExpressionToRegister(const triton::engines::symbolic::SharedSymbolicExpression& se, const triton::arch::Register& reg) {
+    this->checkSymbolic();
+    this->symbolic->assignSymbolicExpressionToRegister(se, reg);
+  }
+
+
+  triton::engines::symbolic::SharedSymbolicExpression API::getSymbolicMemory(triton::uint64 addr) const {
+    this->checkSymbolic();
+    return this->symbolic->getSymbolicMemory(addr);
+  }
+
+
+  std::unordered_map<triton::arch::register_e, triton::engines::symbolic::SharedSymbolicExpression> API::getSymbolicRegisters(void) const {
+    this->checkSymbolic();
+    this->symbolic->buildLazyRegisters();
+    return this->symbolic->getSymbolicRegisters();
+  }
+
+
+  std::unordered_map<triton::uint64, triton::engines::symbolic::SharedSymbolicExpression> API::getSymbolicMemory(void) const {
+    this->checkSymbolic();
+    return this->symbolic->getSymbolicMemory();
+  }
+
+
+  const triton::engines::symbolic::SharedSymbolicExpression& API::getSymbolicRegister(const triton::arch::Register& reg) const {
+    this->checkSymbolic();
+    this->symbolic->buildLazyRegisters(reg);
+    return this->symbolic->getSymbolicRegister(reg);
+  }
+
+
+  triton::uint8 API::getSymbolicMemoryValue(triton::uint64 address) {
+    this->checkSymbolic();
+    return this->symbolic->getSymbolicMemoryValue(address);
   }
 
 
@@ -895,6 +2204,72 @@ namespace triton {
   }
 
 
+  void API::clearSimplificationCache(void) {
+    this->checkSymbolic();
+    this->simplificationCache->clear();
+  }
+
+
+  triton::usize API::getSimplificationCacheSize(void) const {
+    this->checkSymbolic();
+    return this->simplificationCache->size();
+  }
+
+
+  void API::setSimplificationCacheCapacity(triton::usize capacity) {
+    this->checkSymbolic();
+    this->simplificationCache->setCapacity(capacity);
+  }
+
+
+  void API::addSimplificationPass(const std::string& name, const triton::engines::symbolic::SimplificationRule& rule, triton::sint32 order) {
+    this->checkSymbolic();
+    this->symbolic->addSimplificationPass(name, rule, order);
+  }
+
+
+  void API::addSimplificationPass(const std::string& name) {
+    this->checkSymbolic();
+    this->symbolic->addSimplificationPass(name);
+  }
+
+
+  void API::removeSimplificationPass(const std::string& name) {
+    this->checkSymbolic();
+    this->symbolic->removeSimplificationPass(name);
+  }
+
+
+  std::vector<std::string> API::getSimplificationPasses(void) const {
+    this->checkSymbolic();
+    return this->symbolic->getSimplificationPasses();
+  }
+
+
+  void API::setSimplificationIterations(triton::uint32 iterations) {
+    this->checkSymbolic();
+    this->symbolic->setSimplificationIterations(iterations);
+  }
+
+
+  const std::map<std::string, triton::engines::symbolic::SimplificationPassStatistics>& API::getSimplificationPassStatistics(void) const {
+    this->checkSymbolic();
+    return this->symbolic->getSimplificationPassStatistics();
+  }
+
+
+  triton::usize API::getSimplificationMemoHits(void) const {
+    this->checkSymbolic();
+    return this->symbolic->getSimplificationMemoHits();
+  }
+
+
+  void API::clearSimplificationMemo(void) {
+    this->checkSymbolic();
+    this->symbolic->clearSimplificationMemo();
+  }
+
+
   triton::engines::symbolic::SharedSymbolicExpression API::getSymbolicExpression(triton::usize symExprId) const {
     this->checkSymbolic();
     return this->symbolic->getSymbolicExpression(symExprId);
@@ -913,6 +2288,12 @@ namespace triton {
   }
 
 
+  void API::applyModel(const std::unordered_map<triton::usize, triton::engines::solver::SolverModel>& model) {
+    this->checkSymbolic();
+    this->symbolic->setConcreteVariableValues(model);
+  }
+
+
   triton::engines::symbolic::SharedSymbolicVariable API::getSymbolicVariable(triton::usize symVarId) const {
     this->checkSymbolic();
     return this->symbolic->getSymbolicVariable(symVarId);
@@ -939,25 +2320,61 @@ namespace triton {
 
   std::vector<triton::engines::symbolic::PathConstraint> API::getPathConstraintsOfThread(triton::uint32 threadId) const {
     this->checkSymbolic();
-    return this->symbolic->getPathConstraintsOfThread(threadId);
+    return this->symbolic->getPathConstraintsOfThread(threadId);
+  }
+
+
+  triton::usize API::getSizeOfPathConstraints(void) const {
+    this->checkSymbolic();
+    return this->symbolic->getSizeOfPathConstraints();
+  }
+
+
+  void API::setPathConstraintsSpilling(const std::string& path, triton::usize resident) {
+    this->checkSymbolic();
+    this->symbolic->setSpilling(path, resident);
+  }
+
+
+  triton::usize API::getNumberOfSpilledPathConstraints(void) const {
+    this->checkSymbolic();
+    return this->symbolic->getNumberOfSpilledPathConstraints();
+  }
+
+
+  triton::ast::SharedAbstractNode API::getPathPredicate(void) {
+    this->checkSymbolic();
+    return this->symbolic->getPathPredicate();
+  }
+
+
+  triton::ast::SharedAbstractNode API::getFlatPathPredicate(void) {
+    this->checkSymbolic();
+    return this->symbolic->getFlatPathPredicate();
+  }
+
+
+  triton::ast::SharedAbstractNode API::getRelevantPathPredicate(const triton::ast::SharedAbstractNode& node) {
+    this->checkSymbolic();
+    return this->symbolic->getRelevantPathPredicate(node);
   }
 
 
-  triton::usize API::getSizeOfPathConstraints(void) const {
+  std::vector<triton::ast::SharedAbstractNode> API::getPredicatesToReachAddress(triton::uint64 addr) {
     this->checkSymbolic();
-    return this->symbolic->getSizeOfPathConstraints();
+    return this->symbolic->getPredicatesToReachAddress(addr);
   }
 
 
-  triton::ast::SharedAbstractNode API::getPathPredicate(void) {
+  triton::ast::SharedAbstractNode API::getPredicateToFlipIteration(triton::usize index, triton::usize iteration) {
     this->checkSymbolic();
-    return this->symbolic->getPathPredicate();
+    return this->symbolic->getPredicateToFlipIteration(index, iteration);
   }
 
 
-  std::vector<triton::ast::SharedAbstractNode> API::getPredicatesToReachAddress(triton::uint64 addr) {
+  void API::setFlippableIterations(triton::usize count) {
     this->checkSymbolic();
-    return this->symbolic->getPredicatesToReachAddress(addr);
+    this->symbolic->setFlippableIterations(count);
   }
 
 
@@ -997,6 +2414,42 @@ namespace triton {
   }
 
 
+  void API::setSymbolicBudget(triton::uint32 maxDepth, triton::usize maxNodes, triton::usize maxExpressions, triton::engines::symbolic::budget_policy_e policy) {
+    this->checkSymbolic();
+    this->symbolic->setBudget(maxDepth, maxNodes, maxExpressions, policy);
+  }
+
+
+  bool API::isSymbolicBudgetExceeded(void) const {
+    this->checkSymbolic();
+    return this->symbolic->isBudgetExceeded();
+  }
+
+
+  void API::setSymbolicDepthLimit(triton::uint32 depth, triton::engines::symbolic::depth_policy_e policy) {
+    this->checkSymbolic();
+    this->symbolic->setDepthLimit(depth, policy);
+  }
+
+
+  triton::uint32 API::getSymbolicDepthLimit(void) const {
+    this->checkSymbolic();
+    return this->symbolic->getDepthLimit();
+  }
+
+
+  triton::engines::symbolic::depth_policy_e API::getSymbolicDepthPolicy(void) const {
+    this->checkSymbolic();
+    return this->symbolic->getDepthPolicy();
+  }
+
+
+  triton::engines::symbolic::ConcretizationPolicy* API::getConcretizationPolicy(void) {
+    this->checkSymbolic();
+    return this->symbolic->getConcretizationPolicy();
+  }
+
+
   bool API::isSymbolicExpressionExists(triton::usize symExprId) const {
     this->checkSymbolic();
     return this->symbolic->isSymbolicExpressionExists(symExprId);
@@ -1017,6 +2470,7 @@ namespace triton {
 
   bool API::isRegisterSymbolized(const triton::arch::Register& reg) const {
     this->checkSymbolic();
+    this->symbolic->buildLazyRegisters(reg);
     return this->symbolic->isRegisterSymbolized(reg);
   }
 
@@ -1045,6 +2499,12 @@ namespace triton {
   }
 
 
+  void API::concretizeMemoryArea(triton::uint64 baseAddr, triton::usize size) {
+    this->checkSymbolic();
+    this->symbolic->concretizeMemoryArea(baseAddr, size);
+  }
+
+
   void API::concretizeRegister(const triton::arch::Register& reg) {
     this->checkSymbolic();
     this->symbolic->concretizeRegister(reg);
@@ -1057,6 +2517,12 @@ namespace triton {
   }
 
 
+  std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicExpression> API::sliceExpressionsMany(const std::vector<triton::engines::symbolic::SharedSymbolicExpression>& exprs) {
+    this->checkSymbolic();
+    return this->symbolic->sliceExpressionsMany(exprs);
+  }
+
+
   std::vector<triton::engines::symbolic::SharedSymbolicExpression> API::getTaintedSymbolicExpressions(void) const {
     this->checkSymbolic();
     return this->symbolic->getTaintedSymbolicExpressions();
@@ -1108,21 +2574,162 @@ namespace triton {
   }
 
 
+  triton::engines::solver::SolverCache* API::getSolverCache(void) {
+    this->checkSolver();
+    return this->solver->getCache();
+  }
+
+
+  triton::engines::solver::ExternalSolver* API::getSolverExternal(void) {
+    this->checkSolver();
+    return this->solver->getExternal();
+  }
+
+
+  triton::engines::solver::RemoteSolver* API::getSolverRemote(void) {
+    this->checkSolver();
+    return this->solver->getRemote();
+  }
+
+
+  triton::engines::solver::SolverBudget* API::getSolverBudget(void) {
+    this->checkSolver();
+    return this->solver->getBudget();
+  }
+
+
+  triton::engines::solver::AnalyticSolver* API::getSolverAnalytic(void) {
+    this->checkSolver();
+    return this->solver->getAnalytic();
+  }
+
+
+  triton::engines::solver::SolverPreprocessor* API::getSolverPreprocessor(void) {
+    this->checkSolver();
+    return this->solver->getPreprocessor();
+  }
+
+
+  triton::engines::solver::SolverProfiles* API::getSolverProfiles(void) {
+    this->checkSolver();
+    return this->solver->getProfiles();
+  }
+
+
+  triton::engines::solver::SolverStatistics* API::getSolverStatistics(void) {
+    this->checkSolver();
+    return this->solver->getStatistics();
+  }
+
+
+  triton::engines::solver::LocalSearchSolver* API::getSolverLocalSearch(void) {
+    this->checkSolver();
+    return this->solver->getLocalSearch();
+  }
+
+
+  #if defined(TRITON_Z3_INTERFACE) || defined(TRITON_BITWUZLA_INTERFACE)
+  triton::engines::solver::PortfolioSolver* API::getSolverPortfolio(void) {
+    this->checkSolver();
+    return this->solver->getPortfolio();
+  }
+  #endif
+
+
+  triton::ast::SharedAbstractNode API::rewriteConstraint(const triton::ast::SharedAbstractNode& node) const {
+    if (node == nullptr || !this->modes->isModeEnabled(triton::modes::AST_EQUALITY_SATURATION))
+      return node;
+    return triton::ast::AstRewriter(this->astCtxt).simplify(node);
+  }
+
+
   std::unordered_map<triton::usize, triton::engines::solver::SolverModel> API::getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
     this->checkSolver();
-    return this->solver->getModel(node, status, timeout, solvingTime);
+    return this->solver->getModel(this->rewriteConstraint(node), status, timeout, solvingTime);
   }
 
 
   std::vector<std::unordered_map<triton::usize, triton::engines::solver::SolverModel>> API::getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
     this->checkSolver();
-    return this->solver->getModels(node, limit, status, timeout, solvingTime);
+    return this->solver->getModels(this->rewriteConstraint(node), limit, status, timeout, solvingTime);
+  }
+
+
+  triton::usize API::enumerateModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, const triton::engines::solver::ModelCallback& callback, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& variables, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+    this->checkSolver();
+    return this->solver->enumerateModels(this->rewriteConstraint(node), limit, callback, variables, status, timeout, solvingTime);
   }
 
 
   bool API::isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
     this->checkSolver();
-    return this->solver->isSat(node, status, timeout, solvingTime);
+
+    /* A constraint decided by its domain does not need the solver */
+    if (node != nullptr && node->isSymbolized() && this->modes->isModeEnabled(triton::modes::AST_ABSTRACT_DOMAIN) && node->getDomain().isConstant()) {
+      bool sat = (node->evaluate() != 0);
+      if (status)
+        *status = sat ? triton::engines::solver::SAT : triton::engines::solver::UNSAT;
+      if (solvingTime)
+        *solvingTime = 0;
+      return sat;
+    }
+
+    return this->solver->isSat(this->rewriteConstraint(node), status, timeout, solvingTime);
+  }
+
+
+  std::vector<triton::ast::SharedAbstractNode> API::getUnsatCore(const std::vector<triton::ast::SharedAbstractNode>& conjuncts, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+    this->checkSolver();
+    return this->solver->getUnsatCore(conjuncts, status, timeout, solvingTime);
+  }
+
+
+  triton::engines::solver::SolverFuture API::getModelAsync(const triton::ast::SharedAbstractNode& node, triton::uint32 timeout) {
+    this->checkSolver();
+    return this->solver->getModelAsync(this->rewriteConstraint(node), timeout);
+  }
+
+
+  triton::engines::solver::SolverFuture API::isSatAsync(const triton::ast::SharedAbstractNode& node, triton::uint32 timeout) {
+    this->checkSolver();
+
+    /* A constraint decided by its domain does not need the solver */
+    if (node != nullptr && node->isSymbolized() && this->modes->isModeEnabled(triton::modes::AST_ABSTRACT_DOMAIN) && node->getDomain().isConstant()) {
+      bool sat = (node->evaluate() != 0);
+      return triton::engines::solver::SolverFuture(sat ? triton::engines::solver::SAT : triton::engines::solver::UNSAT, {});
+    }
+
+    return this->solver->isSatAsync(this->rewriteConstraint(node), timeout);
+  }
+
+
+  std::vector<triton::engines::solver::BranchFlip> API::solveAllBranchFlips(const triton::engines::solver::BranchFlipOptions& options) {
+    this->checkSolver();
+    return this->solver->solveBranchFlips(this->getPathConstraints(), options);
+  }
+
+
+  std::vector<triton::engines::solver::BranchFlip> API::solveBranchFlips(const std::vector<triton::engines::symbolic::PathConstraint>& pathConstraints, const triton::engines::solver::BranchFlipOptions& options) {
+    this->checkSolver();
+    return this->solver->solveBranchFlips(pathConstraints, options);
+  }
+
+
+  bool API::isEquivalent(const triton::ast::SharedAbstractNode& node1, const triton::ast::SharedAbstractNode& node2, const triton::engines::solver::EquivalenceOptions& options) {
+    this->checkSolver();
+    return this->solver->checkEquivalences({{node1, node2}}, options).front().status == triton::engines::solver::UNSAT;
+  }
+
+
+  std::vector<triton::engines::solver::Equivalence> API::checkEquivalences(const std::vector<std::pair<triton::ast::SharedAbstractNode, triton::ast::SharedAbstractNode>>& pairs, const triton::engines::solver::EquivalenceOptions& options) {
+    this->checkSolver();
+    return this->solver->checkEquivalences(pairs, options);
+  }
+
+
+  bool API::isOpaquePredicate(const triton::ast::SharedAbstractNode& node, const triton::engines::solver::EquivalenceOptions& options) {
+    this->checkSolver();
+    return this->solver->checkOpaquePredicate(node, options).status == triton::engines::solver::UNSAT;
   }
 
 
@@ -1146,7 +2753,10 @@ namespace triton {
     this->checkSolver();
     #ifdef TRITON_Z3_INTERFACE
     if (this->getSolver() == triton::engines::solver::SOLVER_Z3) {
-      return reinterpret_cast<const triton::engines::solver::Z3Solver*>(this->getSolverInstance())->simplify(node);
+      const auto* z3 = reinterpret_cast<const triton::engines::solver::Z3Solver*>(this->getSolverInstance());
+      return this->simplificationCache->simplify(triton::ast::SIMPLIFIER_SOLVER, node, [z3](const triton::ast::SharedAbstractNode& n) {
+        return z3->simplify(n);
+      });
     }
     #endif
     throw triton::exceptions::API("API::simplifyAstViaSolver(): Solver instance must be a SOLVER_Z3.");
@@ -1165,6 +2775,48 @@ namespace triton {
   }
 
 
+  triton::usize API::getSolverThreads(void) const {
+    this->checkSolver();
+    return this->solver->getThreads();
+  }
+
+
+  void API::setSolverThreads(triton::usize threads) {
+    this->checkSolver();
+    this->solver->setThreads(threads);
+  }
+
+
+  void API::pushSolverConstraint(const triton::ast::SharedAbstractNode& node) {
+    this->checkSolver();
+    this->solver->pushConstraint(node);
+  }
+
+
+  void API::pushSolverScope(void) {
+    this->checkSolver();
+    this->solver->push();
+  }
+
+
+  void API::popSolverScope(triton::uint32 count) {
+    this->checkSolver();
+    this->solver->pop(count);
+  }
+
+
+  std::unordered_map<triton::usize, triton::engines::solver::SolverModel> API::getModelWithAssumptions(const std::vector<triton::ast::SharedAbstractNode>& assumptions, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) {
+    this->checkSolver();
+    return this->solver->checkWithAssumptions(assumptions, status, timeout, solvingTime);
+  }
+
+
+  void API::resetSolverSession(void) {
+    this->checkSolver();
+    this->solver->resetSession();
+  }
+
+
 
   /* Taint engine API ============================================================================== */
 
@@ -1174,7 +2826,7 @@ namespace triton {
   }
 
 
-  const std::unordered_set<triton::uint64>& API::getTaintedMemory(void) const {
+  std::unordered_set<triton::uint64> API::getTaintedMemory(void) const {
     this->checkTaint();
     return this->taint->getTaintedMemory();
   }
@@ -1198,6 +2850,24 @@ namespace triton {
   }
 
 
+  triton::engines::taint::TaintLabels API::getMemoryTaintLabels(triton::uint64 addr, triton::uint32 size) const {
+    this->checkTaint();
+    return this->taint->getMemoryTaintLabels(addr, size);
+  }
+
+
+  triton::engines::taint::TaintLabels API::getMemoryTaintLabels(const triton::arch::MemoryAccess& mem) const {
+    this->checkTaint();
+    return this->taint->getMemoryTaintLabels(mem);
+  }
+
+
+  triton::engines::taint::TaintLabels API::getRegisterTaintLabels(const triton::arch::Register& reg) const {
+    this->checkTaint();
+    return this->taint->getRegisterTaintLabels(reg);
+  }
+
+
   bool API::isTainted(const triton::arch::OperandWrapper& op) const {
     this->checkTaint();
     return this->taint->isTainted(op);
@@ -1222,6 +2892,18 @@ namespace triton {
   }
 
 
+  triton::uint64 API::getRegisterTaintBits(const triton::arch::Register& reg) const {
+    this->checkTaint();
+    return this->taint->getRegisterTaintBits(reg);
+  }
+
+
+  bool API::setRegisterTaintBits(const triton::arch::Register& reg, triton::uint64 bits) {
+    this->checkTaint();
+    return this->taint->setRegisterTaintBits(reg, bits);
+  }
+
+
   bool API::setTaint(const triton::arch::OperandWrapper& op, bool flag) {
     this->checkTaint();
     return this->taint->setTaint(op, flag);
@@ -1260,6 +2942,24 @@ namespace triton {
   }
 
 
+  bool API::taintMemory(triton::uint64 addr, triton::uint32 label) {
+    this->checkTaint();
+    return this->taint->taintMemory(addr, label);
+  }
+
+
+  bool API::taintMemory(const triton::arch::MemoryAccess& mem, triton::uint32 label) {
+    this->checkTaint();
+    return this->taint->taintMemory(mem, label);
+  }
+
+
+  bool API::taintRegister(const triton::arch::Register& reg, triton::uint32 label) {
+    this->checkTaint();
+    return this->taint->taintRegister(reg, label);
+  }
+
+
   bool API::untaintMemory(triton::uint64 addr) {
     this->checkTaint();
     return this->taint->untaintMemory(addr);
@@ -1365,10 +3065,53 @@ namespace triton {
 
   /* Synthesizer engine API ============================================================================= */
 
-  triton::engines::synthesis::SynthesisResult API::synthesize(const triton::ast::SharedAbstractNode& node, bool constant, bool subexpr, bool opaque) {
+  void API::clearSynthesisCache(void) {
+    this->checkSymbolic();
+    this->synthesisCache->clear();
+  }
+
+
+  triton::usize API::getSynthesisCacheSize(void) const {
+    this->checkSymbolic();
+    return this->synthesisCache->size();
+  }
+
+
+  void API::loadSynthesisCache(std::istream& stream) {
+    this->checkSymbolic();
+    this->synthesisCache->load(stream);
+  }
+
+
+  void API::saveSynthesisCache(std::ostream& stream) const {
+    this->checkSymbolic();
+    this->synthesisCache->save(stream);
+  }
+
+
+  triton::engines::synthesis::SynthesisResult API::synthesize(const triton::ast::SharedAbstractNode& node, bool constant, bool subexpr, bool opaque, bool parallel) {
+    this->checkSymbolic();
+    triton::engines::synthesis::Synthesizer synth(this->symbolic, this->synthesisCache);
+    return synth.synthesize(node, constant, subexpr, opaque, parallel);
+  }
+
+
+
+  /* Exploration engine API ============================================================================= */
+
+  triton::engines::exploration::ExplorationResult API::explore(triton::uint64 entry, const triton::engines::exploration::ExplorationOptions& options) {
     this->checkSymbolic();
-    triton::engines::synthesis::Synthesizer synth(this->symbolic);
-    return synth.synthesize(node, constant, subexpr, opaque);
+    this->checkSolver();
+    triton::engines::exploration::ExplorationEngine engine(this, options);
+    return engine.explore(entry);
+  }
+
+
+  triton::engines::exploration::FuzzerBridgeResult API::syncFuzzer(triton::uint64 entry, const triton::engines::exploration::FuzzerBridgeOptions& options) {
+    this->checkSymbolic();
+    this->checkSolver();
+    triton::engines::exploration::FuzzerBridge bridge(this, options);
+    return bridge.watch(entry);
   }
 
 
@@ -1389,22 +3132,142 @@ namespace triton {
   }
 
 
-  std::ostream& API::liftToPython(std::ostream& stream, const triton::engines::symbolic::SharedSymbolicExpression& expr) {
+  std::ostream& API::liftToLLVM(std::ostream& stream, const std::vector<triton::ast::SharedAbstractNode>& nodes, const char* fname, bool optimize) {
+    this->checkLifting();
+    #ifdef TRITON_LLVM_INTERFACE
+    return this->lifting->liftToLLVM(stream, nodes, fname, optimize);
+    #endif
+    throw triton::exceptions::API("API::liftToLLVM(): Triton not built with LLVM");
+  }
+
+
+  std::unique_ptr<API> API::symbolizeBlock(const std::vector<triton::arch::Instruction>& block, std::vector<std::pair<std::string, triton::ast::SharedAbstractNode>>& outputs) {
+    std::set<triton::arch::register_e> inputs;
+    std::vector<triton::arch::MemoryAccess> loads;
+    std::vector<triton::arch::Instruction> copy;
+
+    /*
+     * The block is executed in scratch contexts which start from the concrete state of this
+     * one. They have their own AST context, so that their variables do not clash with ours.
+     */
+    auto scratch = [&](void) {
+      std::unique_ptr<API> ctx(new API());
+      ctx->modes   = this->modes;
+      ctx->astCtxt = std::make_shared<triton::ast::AstContext>(ctx->modes);
+      ctx->setArchitecture(this->getArchitecture());
+      ctx->setDisassemblyCache(this->getDisassemblyCache());
+      ctx->arch.copyState(this->arch);
+
+      copy.clear();
+      for (const auto& inst : block) {
+        copy.push_back(triton::arch::Instruction(inst.getAddress(), inst.getOpcode(), inst.getSize()));
+        copy.back().setThumb(inst.isThumb());
+      }
+      return ctx;
+    };
+
+    /* A first run finds the registers and the memory read by the block */
+    auto probe = scratch();
+    probe->processing(copy);
+    for (auto& inst : copy) {
+      for (const auto& reg : inst.getReadRegisters())
+        inputs.insert(probe->getParentRegister(reg.first).getId());
+      for (const auto& load : inst.getLoadAccess())
+        loads.push_back(load.first);
+    }
+
+    /* The second run has them symbolized, a memory cell read by several accesses is symbolized by the first one */
+    auto ctx = scratch();
+    for (auto id : inputs)
+      ctx->symbolizeRegister(ctx->getRegister(id), ctx->getRegister(id).getName());
+
+    std::sort(loads.begin(), loads.end(), [](const triton::arch::MemoryAccess& a, const triton::arch::MemoryAccess& b) {
+      return a.getAddress() < b.getAddress();
+    });
+    triton::uint64 end = 0;
+    for (const auto& load : loads) {
+      if (load.getAddress() < end)
+        continue;
+      std::ostringstream name;
+      name << "mem_0x" << std::hex << load.getAddress();
+      ctx->symbolizeMemory(triton::arch::MemoryAccess(load.getAddress(), load.getSize()), name.str());
+      end = load.getAddress() + load.getSize();
+    }
+
+    ctx->processing(copy);
+
+    /* The outputs are the final values of the registers and of the memory written by the block */
+    std::set<triton::arch::register_e> written;
+    std::set<std::pair<triton::uint64, triton::uint32>> stored;
+    for (auto& inst : copy) {
+      for (const auto& reg : inst.getWrittenRegisters())
+        written.insert(ctx->getParentRegister(reg.first).getId());
+      for (const auto& store : inst.getStoreAccess())
+        stored.insert({store.first.getAddress(), store.first.getSize()});
+    }
+
+    for (auto id : written)
+      outputs.push_back({ctx->getRegister(id).getName() + "_out", ctx->getRegisterAst(ctx->getRegister(id))});
+
+    for (const auto& store : stored) {
+      std::ostringstream name;
+      name << "mem_0x" << std::hex << store.first << "_out";
+      outputs.push_back({name.str(), ctx->getMemoryAst(triton::arch::MemoryAccess(store.first, store.second))});
+    }
+
+    return ctx;
+  }
+
+
+  std::ostream& API::liftToLLVM(std::ostream& stream, const std::vector<triton::arch::Instruction>& block, const char* fname, bool optimize) {
+    this->checkLifting();
+    #ifdef TRITON_LLVM_INTERFACE
+    std::vector<std::pair<std::string, triton::ast::SharedAbstractNode>> outputs;
+    auto ctx = this->symbolizeBlock(block, outputs);
+    return this->lifting->liftToLLVM(stream, outputs, fname, optimize);
+    #endif
+    throw triton::exceptions::API("API::liftToLLVM(): Triton not built with LLVM");
+  }
+
+
+  std::ostream& API::liftToC(std::ostream& stream, const triton::ast::SharedAbstractNode& node, const char* fname) {
+    this->checkLifting();
+    return this->lifting->liftToC(stream, node, fname);
+  }
+
+
+  std::ostream& API::liftToC(std::ostream& stream, const triton::engines::symbolic::SharedSymbolicExpression& expr, const char* fname) {
+    this->checkLifting();
+    return this->lifting->liftToC(stream, expr, fname);
+  }
+
+
+  std::ostream& API::liftToC(std::ostream& stream, const std::vector<triton::arch::Instruction>& block, const char* fname) {
+    this->checkLifting();
+    std::vector<std::pair<std::string, triton::ast::SharedAbstractNode>> outputs;
+    auto ctx = this->symbolizeBlock(block, outputs);
+    return this->lifting->liftToC(stream, outputs, fname);
+  }
+
+
+  std::ostream& API::liftToPython(std::ostream& stream, const triton::engines::symbolic::SharedSymbolicExpression& expr, bool shared) {
     this->checkLifting();
-    return this->lifting->liftToPython(stream, expr);
+    return this->lifting->liftToPython(stream, expr, shared);
   }
 
 
-  std::ostream& API::liftToSMT(std::ostream& stream, const triton::engines::symbolic::SharedSymbolicExpression& expr, bool assert_) {
+  std::ostream& API::liftToSMT(std::ostream& stream, const triton::engines::symbolic::SharedSymbolicExpression& expr, bool assert_, bool shared) {
     this->checkLifting();
-    return this->lifting->liftToSMT(stream, expr, assert_);
+    return this->lifting->liftToSMT(stream, expr, assert_, shared);
   }
 
 
   triton::ast::SharedAbstractNode API::simplifyAstViaLLVM(const triton::ast::SharedAbstractNode& node) const {
     this->checkLifting();
     #ifdef TRITON_LLVM_INTERFACE
-    return this->lifting->simplifyAstViaLLVM(node);
+    return this->simplificationCache->simplify(triton::ast::SIMPLIFIER_LLVM, node, [this](const triton::ast::SharedAbstractNode& n) {
+      return this->lifting->simplifyAstViaLLVM(n);
+    });
     #endif
     throw triton::exceptions::API("API::simplifyAstViaLLVM(): Triton not built with LLVM");
   }
@@ -0,0 +1,177 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <triton/exceptions.hpp>
+#include <triton/stateObserver.hpp>
+
+
+
+namespace triton {
+
+  StateView::StateView() {
+    this->epoch = 0;
+  }
+
+
+  triton::uint64 StateView::getEpoch(void) const {
+    return this->epoch;
+  }
+
+
+  triton::uint512 StateView::getConcreteRegisterValue(const triton::arch::Register& reg) const {
+    auto it = this->registers.find(reg.getParent());
+    if (it == this->registers.end())
+      throw triton::exceptions::API("StateView::getConcreteRegisterValue(): Invalid register.");
+    return (it->second >> reg.getLow()) & reg.getMaxValue();
+  }
+
+
+  const triton::arch::ConcreteMemory& StateView::getConcreteMemory(void) const {
+    return this->memory;
+  }
+
+
+  bool StateView::isRegisterSymbolized(const triton::arch::Register& reg) const {
+    const triton::engines::symbolic::SharedSymbolicExpression* expr = this->symbolicRegisters.find(reg.getParent());
+    return expr != nullptr && *expr != nullptr;
+  }
+
+
+  triton::usize StateView::getSymbolicRegisterId(const triton::arch::Register& reg) const {
+    const triton::engines::symbolic::SharedSymbolicExpression* expr = this->symbolicRegisters.find(reg.getParent());
+    if (expr == nullptr || *expr == nullptr)
+      throw triton::exceptions::API("StateView::getSymbolicRegisterId(): The register has no symbolic expression.");
+    return (*expr)->getId();
+  }
+
+
+  triton::usize StateView::getSizeOfPathConstraints(void) const {
+    return this->pathConstraints.size();
+  }
+
+
+  const triton::engines::symbolic::PathConstraint& StateView::getPathConstraint(triton::usize index) const {
+    if (index >= this->pathConstraints.size())
+      throw triton::exceptions::API("StateView::getPathConstraint(): Invalid index.");
+    return this->pathConstraints[index];
+  }
+
+
+  StateObserver::Reader::Reader(const StateObserver& observer) {
+    this->observer = &observer;
+    this->slot     = 0;
+
+    /*
+     * The epoch is pinned before the view is loaded: the views replaced at
+     * a later epoch are not released until the reader unpins it.
+     */
+    triton::uint64 pin = observer.epoch.load() + 1;
+    for (;;) {
+      triton::uint64 expected = 0;
+      if (observer.pins[this->slot].compare_exchange_strong(expected, pin))
+        break;
+      if (++this->slot == maxReaders)
+        throw triton::exceptions::API("StateObserver::Reader::Reader(): Too many readers.");
+    }
+
+    this->view = observer.current.load();
+  }
+
+
+  StateObserver::Reader::~Reader() {
+    this->observer->pins[this->slot].store(0, std::memory_order_release);
+  }
+
+
+  const StateView* StateObserver::Reader::get(void) const {
+    return this->view;
+  }
+
+
+  const StateView* StateObserver::Reader::operator->(void) const {
+    return this->view;
+  }
+
+
+  StateObserver::StateObserver() {
+    this->enabled.store(false, std::memory_order_relaxed);
+    this->current.store(nullptr, std::memory_order_relaxed);
+    this->epoch.store(0, std::memory_order_relaxed);
+
+    for (triton::usize i = 0; i < maxReaders; i++)
+      this->pins[i].store(0, std::memory_order_relaxed);
+  }
+
+
+  StateObserver::~StateObserver() {
+    this->clear();
+  }
+
+
+  void StateObserver::setEnabled(bool flag) {
+    this->enabled.store(flag, std::memory_order_relaxed);
+  }
+
+
+  bool StateObserver::isEnabled(void) const {
+    return this->enabled.load(std::memory_order_relaxed);
+  }
+
+
+  void StateObserver::publish(StateView* view) {
+    view->epoch = this->epoch.load(std::memory_order_relaxed) + 1;
+
+    StateView* old = this->current.exchange(view);
+    triton::uint64 replaced = this->epoch.fetch_add(1) + 1;
+
+    if (old != nullptr)
+      this->retired.push_back(std::make_pair(replaced, old));
+
+    this->reclaim();
+  }
+
+
+  void StateObserver::reclaim(void) {
+    /* A reader pinned at `pin` may hold the views replaced at `pin` or later */
+    triton::uint64 oldest = 0;
+    for (triton::usize i = 0; i < maxReaders; i++) {
+      triton::uint64 pin = this->pins[i].load();
+      if (pin != 0 && (oldest == 0 || pin < oldest))
+        oldest = pin;
+    }
+
+    triton::usize kept = 0;
+    for (const auto& item : this->retired) {
+      if (oldest == 0 || item.first < oldest)
+        delete item.second;
+      else
+        this->retired[kept++] = item;
+    }
+
+    this->retired.resize(kept);
+  }
+
+
+  triton::uint64 StateObserver::getEpoch(void) const {
+    return this->epoch.load();
+  }
+
+
+  triton::usize StateObserver::getRetired(void) const {
+    return this->retired.size();
+  }
+
+
+  void StateObserver::clear(void) {
+    for (const auto& item : this->retired)
+      delete item.second;
+
+    this->retired.clear();
+    delete this->current.exchange(nullptr);
+  }
+
+};
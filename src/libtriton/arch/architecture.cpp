@@ -5,6 +5,7 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <algorithm>
 #include <new>
 
 #include <triton/aarch64Cpu.hpp>
@@ -22,6 +23,7 @@ namespace triton {
     Architecture::Architecture(triton::callbacks::Callbacks* callbacks) {
       this->arch      = triton::arch::ARCH_INVALID;
       this->callbacks = callbacks;
+      this->thread    = 0;
     }
 
 
@@ -44,51 +46,161 @@ namespace triton {
     }
 
 
-    void Architecture::setArchitecture(triton::arch::architecture_e arch) {
-      /* Allocate and init the good arch */
+    triton::arch::CpuInterface* Architecture::newCpu(triton::arch::architecture_e arch, triton::callbacks::Callbacks* callbacks) const {
+      triton::arch::CpuInterface* cpu = nullptr;
+
       switch (arch) {
         case triton::arch::ARCH_X86_64:
-          /* init the new instance */
-          this->cpu.reset(new(std::nothrow) triton::arch::x86::x8664Cpu(this->callbacks));
-          if (this->cpu == nullptr)
-            throw triton::exceptions::Architecture("Architecture::setArchitecture(): Not enough memory.");
+          cpu = new(std::nothrow) triton::arch::x86::x8664Cpu(callbacks);
           break;
 
         case triton::arch::ARCH_X86:
-          /* init the new instance */
-          this->cpu.reset(new(std::nothrow) triton::arch::x86::x86Cpu(this->callbacks));
-          if (this->cpu == nullptr)
-            throw triton::exceptions::Architecture("Architecture::setArchitecture(): Not enough memory.");
+          cpu = new(std::nothrow) triton::arch::x86::x86Cpu(callbacks);
           break;
 
         case triton::arch::ARCH_AARCH64:
-          /* init the new instance */
-          this->cpu.reset(new(std::nothrow) triton::arch::arm::aarch64::AArch64Cpu(this->callbacks));
-          if (this->cpu == nullptr)
-            throw triton::exceptions::Architecture("Architecture::setArchitecture(): Not enough memory.");
+          cpu = new(std::nothrow) triton::arch::arm::aarch64::AArch64Cpu(callbacks);
           break;
 
         case triton::arch::ARCH_ARM32:
-          /* init the new instance */
-          this->cpu.reset(new(std::nothrow) triton::arch::arm::arm32::Arm32Cpu(this->callbacks));
-          if (this->cpu == nullptr)
-            throw triton::exceptions::Architecture("Architecture::setArchitecture(): Not enough memory.");
+          cpu = new(std::nothrow) triton::arch::arm::arm32::Arm32Cpu(callbacks);
           break;
 
         default:
           throw triton::exceptions::Architecture("Architecture::setArchitecture(): Architecture not supported.");
-          break;
       }
 
+      if (cpu == nullptr)
+        throw triton::exceptions::Architecture("Architecture::setArchitecture(): Not enough memory.");
+
+      return cpu;
+    }
+
+
+    void Architecture::setArchitecture(triton::arch::architecture_e arch) {
+      /* Allocate and init the good arch */
+      this->cpu.reset(this->newCpu(arch, this->callbacks));
+
       /* Setup global variables */
-      this->arch = arch;
+      this->arch      = arch;
+      this->decodings = std::make_shared<triton::arch::DisassemblyCache>(arch);
+      this->threads.clear();
+      this->spare.reset();
+      this->thread    = 0;
     }
 
 
     void Architecture::clearArchitecture(void) {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::clearArchitecture(): You must define an architecture.");
+      /* The decoded instructions are kept, a hit needs the same bytes at the same address */
       this->cpu->clear();
+
+      /* The threads are kept, their registers are cleared too */
+      for (auto& it : this->threads) {
+        it.second.cpu->clear();
+        it.second.decoding  = 0;
+        it.second.exclusive = false;
+      }
+    }
+
+
+    void Architecture::copyState(const triton::arch::Architecture& other) {
+      if (!this->cpu || !other.cpu)
+        throw triton::exceptions::Architecture("Architecture::copyState(): You must define an architecture.");
+
+      if (this->arch != other.arch)
+        throw triton::exceptions::Architecture("Architecture::copyState(): The architectures differ.");
+
+      this->cpu->copyState(*other.cpu);
+
+      this->threads.clear();
+      for (const auto& it : other.threads) {
+        ThreadRegisters& registers = this->threads[it.first];
+        registers.cpu.reset(this->newCpu(this->arch, nullptr));
+        registers.cpu->copyRegisters(*it.second.cpu);
+        registers.decoding  = it.second.decoding;
+        registers.exclusive = it.second.exclusive;
+      }
+      this->thread = other.thread;
+    }
+
+
+    triton::uint32 Architecture::getThread(void) const {
+      return this->thread;
+    }
+
+
+    std::vector<triton::uint32> Architecture::getThreads(void) const {
+      std::vector<triton::uint32> ret = {this->thread};
+
+      for (const auto& it : this->threads)
+        ret.push_back(it.first);
+
+      std::sort(ret.begin(), ret.end());
+      return ret;
+    }
+
+
+    void Architecture::setThread(triton::uint32 tid) {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::setThread(): You must define an architecture.");
+
+      if (tid == this->thread)
+        return;
+
+      /* The registers of the current thread are saved into a spare CPU, the CPU of the next thread becomes the spare */
+      if (this->spare == nullptr)
+        this->spare.reset(this->newCpu(this->arch, nullptr));
+
+      ThreadRegisters current;
+      this->spare->copyRegisters(*this->cpu);
+      current.cpu       = std::move(this->spare);
+      current.decoding  = this->cpu->getDecodingState();
+      current.exclusive = this->cpu->isMemoryExclusiveAccess();
+
+      auto next = this->threads.find(tid);
+      if (next != this->threads.end()) {
+        this->cpu->copyRegisters(*next->second.cpu);
+        this->cpu->setDecodingState(next->second.decoding);
+        this->cpu->setMemoryExclusiveAccess(next->second.exclusive);
+        this->spare = std::move(next->second.cpu);
+        this->threads.erase(next);
+      }
+
+      this->threads[this->thread] = std::move(current);
+      this->thread = tid;
+    }
+
+
+    void Architecture::removeThread(triton::uint32 tid) {
+      if (tid == this->thread)
+        throw triton::exceptions::Architecture("Architecture::removeThread(): Cannot remove the current thread.");
+
+      auto it = this->threads.find(tid);
+      if (it == this->threads.end())
+        return;
+
+      this->spare = std::move(it->second.cpu);
+      this->threads.erase(it);
+    }
+
+
+    const triton::arch::SharedDisassemblyCache& Architecture::getDisassemblyCache(void) const {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::getDisassemblyCache(): You must define an architecture.");
+      return this->decodings;
+    }
+
+
+    void Architecture::setDisassemblyCache(const triton::arch::SharedDisassemblyCache& cache) {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::setDisassemblyCache(): You must define an architecture.");
+
+      if (cache == nullptr || cache->getArchitecture() != this->arch)
+        throw triton::exceptions::Architecture("Architecture::setDisassemblyCache(): The cache must be of the same architecture.");
+
+      this->decodings = cache;
     }
 
 
@@ -243,7 +355,21 @@ namespace triton {
     void Architecture::disassembly(triton::arch::Instruction& inst) const {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::disassembly(): You must define an architecture.");
+
+      /* Update instruction address if undefined, as the cpu would do */
+      if (inst.getOpcode() != nullptr && inst.getSize() != 0 && !inst.getAddress())
+        inst.setAddress(this->cpu->getConcreteRegisterValue64(this->cpu->getProgramCounter()));
+
+      /* The same bytes were already decoded at this address in the same state (e.g. Thumb mode, IT block) */
+      triton::uint32 state = this->cpu->getDecodingState();
+      triton::uint32 next  = 0;
+      if (this->decodings->find(inst, state, next)) {
+        this->cpu->setDecodingState(next);
+        return;
+      }
+
       this->cpu->disassembly(inst);
+      this->decodings->insert(inst, state, this->cpu->getDecodingState());
     }
 
 
@@ -305,6 +431,20 @@ namespace triton {
     }
 
 
+    void Architecture::getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::uint8* area, triton::usize size, bool execCallbacks) const {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::getConcreteMemoryAreaValue(): You must define an architecture.");
+      this->cpu->getConcreteMemoryAreaValue(baseAddr, area, size, execCallbacks);
+    }
+
+
+    const triton::arch::ConcreteMemory& Architecture::getConcreteMemory(void) const {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::getConcreteMemory(): You must define an architecture.");
+      return this->cpu->getConcreteMemory();
+    }
+
+
     triton::uint512 Architecture::getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks) const {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::getConcreteRegisterValue(): You must define an architecture.");
@@ -312,6 +452,20 @@ namespace triton {
     }
 
 
+    triton::uint64 Architecture::getConcreteMemoryValue64(const triton::arch::MemoryAccess& mem, bool execCallbacks) const {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::getConcreteMemoryValue64(): You must define an architecture.");
+      return this->cpu->getConcreteMemoryValue64(mem, execCallbacks);
+    }
+
+
+    triton::uint64 Architecture::getConcreteRegisterValue64(const triton::arch::Register& reg, bool execCallbacks) const {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::getConcreteRegisterValue64(): You must define an architecture.");
+      return this->cpu->getConcreteRegisterValue64(reg, execCallbacks);
+    }
+
+
     void Architecture::setConcreteMemoryValue(triton::uint64 addr, triton::uint8 value) {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::setConcreteMemoryValue(): You must define an architecture.");
@@ -340,6 +494,20 @@ namespace triton {
     }
 
 
+    void Architecture::mapConcreteMemoryArea(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size, const std::shared_ptr<const void>& owner) {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::mapConcreteMemoryArea(): You must define an architecture.");
+      this->cpu->mapConcreteMemoryArea(baseAddr, area, size, owner);
+    }
+
+
+    void Architecture::setConcreteMemoryPlacement(const triton::utils::MemoryPlacement& placement) {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::setConcreteMemoryPlacement(): You must define an architecture.");
+      this->cpu->setConcreteMemoryPlacement(placement);
+    }
+
+
     void Architecture::setConcreteRegisterValue(const triton::arch::Register& reg, const triton::uint512& value) {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::setConcreteRegisterValue(): You must define an architecture.");
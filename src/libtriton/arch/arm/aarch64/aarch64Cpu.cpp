@@ -10,6 +10,7 @@
 
 #include <triton/aarch64Cpu.hpp>
 #include <triton/architecture.hpp>
+#include <triton/capstonePool.hpp>
 #include <triton/coreUtils.hpp>
 #include <triton/cpuSize.hpp>
 #include <triton/exceptions.hpp>
@@ -24,7 +25,6 @@ namespace triton {
 
         AArch64Cpu::AArch64Cpu(triton::callbacks::Callbacks* callbacks) : AArch64Specifications(ARCH_AARCH64) {
           this->callbacks = callbacks;
-          this->handle    = 0;
 
           this->clear();
           this->disassInit();
@@ -38,27 +38,25 @@ namespace triton {
 
         AArch64Cpu::~AArch64Cpu() {
           this->memory.clear();
-          if (this->handle) {
-            triton::extlibs::capstone::cs_close(&this->handle);
-          }
         }
 
 
         void AArch64Cpu::disassInit(void) {
-          if (this->handle) {
-            triton::extlibs::capstone::cs_close(&this->handle);
-          }
+          this->disassembler = triton::arch::CapstonePool::get(triton::extlibs::capstone::CS_ARCH_ARM64, triton::extlibs::capstone::CS_MODE_ARM);
+        }
 
-          if (triton::extlibs::capstone::cs_open(triton::extlibs::capstone::CS_ARCH_ARM64, triton::extlibs::capstone::CS_MODE_ARM, &this->handle) != triton::extlibs::capstone::CS_ERR_OK)
-            throw triton::exceptions::Disassembly("AArch64Cpu::disassInit(): Cannot open capstone.");
 
-          triton::extlibs::capstone::cs_option(this->handle, triton::extlibs::capstone::CS_OPT_DETAIL, triton::extlibs::capstone::CS_OPT_ON);
+        void AArch64Cpu::copy(const AArch64Cpu& other) {
+          this->callbacks    = other.callbacks;
+          this->memory       = other.memory;
+          this->disassembler = other.disassembler;
+
+          this->copyRegisters(other);
         }
 
 
-        void AArch64Cpu::copy(const AArch64Cpu& other) {
-          this->callbacks = other.callbacks;
-          this->memory    = other.memory;
+        void AArch64Cpu::copyRegisters(const triton::arch::CpuInterface& cpu) {
+          const AArch64Cpu& other = dynamic_cast<const AArch64Cpu&>(cpu);
 
           std::memcpy(this->x0,   other.x0,   sizeof(this->x0));
           std::memcpy(this->x1,   other.x1,   sizeof(this->x1));
@@ -129,6 +127,13 @@ namespace triton {
         }
 
 
+        void AArch64Cpu::copyState(const triton::arch::CpuInterface& other) {
+          triton::callbacks::Callbacks* callbacks = this->callbacks;
+          this->copy(dynamic_cast<const AArch64Cpu&>(other));
+          this->callbacks = callbacks;
+        }
+
+
         void AArch64Cpu::clear(void) {
           /* Clear memory */
           this->memory.clear();
@@ -284,11 +289,9 @@ namespace triton {
 
 
         const triton::arch::Register& AArch64Cpu::getRegister(triton::arch::register_e id) const {
-          try {
-            return this->id2reg.at(id);
-          } catch (const std::out_of_range&) {
+          if (static_cast<triton::uint32>(id) >= triton::arch::ID_REG_LAST_ITEM || this->regIndex[id] == nullptr)
             throw triton::exceptions::Cpu("AArch64Cpu::getRegister(): Invalid register for this architecture.");
-          }
+          return *this->regIndex[id];
         }
 
 
@@ -324,8 +327,6 @@ namespace triton {
 
 
         void AArch64Cpu::disassembly(triton::arch::Instruction& inst) {
-          triton::extlibs::capstone::cs_insn* insn;
-          triton::usize count = 0;
           triton::uint32 size = 0;
 
           /* Check if the opcode and opcode' size are defined */
@@ -337,23 +338,21 @@ namespace triton {
 
           /* Update instruction address if undefined */
           if (!inst.getAddress()) {
-            inst.setAddress(this->getConcreteRegisterValue(this->getProgramCounter()).convert_to<triton::uint64>());
+            inst.setAddress(this->getConcreteRegisterValue64(this->getProgramCounter()));
           }
 
           /* Let's disass and build our operands */
-          count = triton::extlibs::capstone::cs_disasm(this->handle, inst.getOpcode(), inst.getSize(), inst.getAddress(), 0, &insn);
-          if (count > 0) {
+          triton::arch::CapstonePool::Lease lease(*this->disassembler);
+          const triton::uint8* code = inst.getOpcode();
+          size_t codeSize           = inst.getSize();
+          triton::uint64 codeAddr   = inst.getAddress();
+          triton::extlibs::capstone::cs_insn* insn = lease.insn;
+          if (triton::extlibs::capstone::cs_disasm_iter(lease.handle, &code, &codeSize, &codeAddr, insn)) {
             /* Detail information */
             triton::extlibs::capstone::cs_detail* detail = insn->detail;
 
             /* Init the disassembly */
-            std::stringstream str;
-
-            str << insn[0].mnemonic;
-            if (detail->arm64.op_count)
-              str << " " <<  insn[0].op_str;
-
-            inst.setDisassembly(str.str());
+            inst.setDisassembly(insn[0].mnemonic, detail->arm64.op_count ? insn[0].op_str : "");
 
             /* Refine the size */
             inst.setSize(insn[0].size);
@@ -485,9 +484,6 @@ namespace triton {
                 }
               }
             }
-
-            /* Free capstone stuffs */
-            triton::extlibs::capstone::cs_free(insn, count);
           }
           else
             throw triton::exceptions::Disassembly("AArch64Cpu::disassembly(): Failed to disassemble the given code.");
@@ -495,23 +491,43 @@ namespace triton {
 
 
         triton::uint8 AArch64Cpu::getConcreteMemoryValue(triton::uint64 addr, bool execCallbacks) const {
-          if (execCallbacks && this->callbacks)
+          if (execCallbacks && this->callbacks && this->callbacks->isLoadDefined())
             this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, MemoryAccess(addr, triton::size::byte));
 
-          auto it = this->memory.find(addr);
-          if (it == this->memory.end())
-            return 0x00;
+          return this->memory.get(addr);
+        }
+
 
-          return it->second;
+        triton::uint64 AArch64Cpu::getConcreteMemoryValue64(const triton::arch::MemoryAccess& mem, bool execCallbacks) const {
+          triton::uint64 ret = 0;
+          triton::uint8 bytes[triton::size::qword];
+          triton::uint64 addr = 0;
+          triton::uint32 size = 0;
+
+          if (execCallbacks && this->callbacks && this->callbacks->isLoadDefined())
+            this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, mem);
+
+          addr = mem.getAddress();
+          size = mem.getSize();
+
+          if (size == 0 || size > triton::size::qword)
+            throw triton::exceptions::Cpu("AArch64Cpu::getConcreteMemoryValue64(): Invalid size memory.");
+
+          this->memory.read(addr, size, bytes);
+          for (triton::sint32 i = size-1; i >= 0; i--)
+            ret = ((ret << triton::bitsize::byte) | bytes[i]);
+
+          return ret;
         }
 
 
         triton::uint512 AArch64Cpu::getConcreteMemoryValue(const triton::arch::MemoryAccess& mem, bool execCallbacks) const {
           triton::uint512 ret = 0;
+          triton::uint8 bytes[triton::size::dqqword];
           triton::uint64 addr = 0;
           triton::uint32 size = 0;
 
-          if (execCallbacks && this->callbacks)
+          if (execCallbacks && this->callbacks && this->callbacks->isLoadDefined())
             this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, mem);
 
           addr = mem.getAddress();
@@ -520,27 +536,53 @@ namespace triton {
           if (size == 0 || size > triton::size::dqqword)
             throw triton::exceptions::Cpu("AArch64Cpu::getConcreteMemoryValue(): Invalid size memory.");
 
+          /* The accesses of 64 bits or less do not need the multiprecision arithmetic */
+          if (size <= triton::size::qword)
+            return this->getConcreteMemoryValue64(mem, false);
+
+          this->memory.read(addr, size, bytes);
           for (triton::sint32 i = size-1; i >= 0; i--)
-            ret = ((ret << triton::bitsize::byte) | this->getConcreteMemoryValue(addr+i, false));
+            ret = ((ret << triton::bitsize::byte) | bytes[i]);
 
           return ret;
         }
 
 
         std::vector<triton::uint8> AArch64Cpu::getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks) const {
-          std::vector<triton::uint8> area;
+          std::vector<triton::uint8> area(size);
 
-          for (triton::usize index = 0; index < size; index++)
-            area.push_back(this->getConcreteMemoryValue(baseAddr+index));
+          this->getConcreteMemoryAreaValue(baseAddr, area.data(), size, execCallbacks);
 
           return area;
         }
 
 
-        triton::uint512 AArch64Cpu::getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks) const {
-          triton::uint512 value = 0;
+        void AArch64Cpu::getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::uint8* area, triton::usize size, bool execCallbacks) const {
+          if (execCallbacks && this->callbacks && this->callbacks->isDefined()) {
+            /* The area callbacks are called once, before the area is read */
+            this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_AREA_VALUE, baseAddr, size);
+
+            /* The callbacks are called on each byte, before it is read */
+            if (this->callbacks->isDefined(triton::callbacks::GET_CONCRETE_MEMORY_VALUE)) {
+              for (triton::usize index = 0; index < size; index++)
+                area[index] = this->getConcreteMemoryValue(baseAddr+index);
+              return;
+            }
+          }
 
-          if (execCallbacks && this->callbacks)
+          this->memory.read(baseAddr, size, area);
+        }
+
+
+        const triton::arch::ConcreteMemory& AArch64Cpu::getConcreteMemory(void) const {
+          return this->memory;
+        }
+
+
+        triton::uint64 AArch64Cpu::getConcreteRegisterValue64(const triton::arch::Register& reg, bool execCallbacks) const {
+          triton::uint64 value = 0;
+
+          if (execCallbacks && this->callbacks && this->callbacks->isDefined(triton::callbacks::GET_CONCRETE_REGISTER_VALUE))
             this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_REGISTER_VALUE, reg);
 
           switch (reg.getId()) {
@@ -616,166 +658,185 @@ namespace triton {
             case triton::arch::ID_REG_AARCH64_Z:    return (((*((triton::uint32*)(this->spsr))) >> 30) & 1);
             case triton::arch::ID_REG_AARCH64_C:    return (((*((triton::uint32*)(this->spsr))) >> 29) & 1);
             case triton::arch::ID_REG_AARCH64_V:    return (((*((triton::uint32*)(this->spsr))) >> 28) & 1);
-            case triton::arch::ID_REG_AARCH64_Q0:   value = triton::utils::fromBufferToUint<triton::uint128>(this->q0);  return value;
             case triton::arch::ID_REG_AARCH64_D0:   return (*((triton::uint64*)(this->q0)));
             case triton::arch::ID_REG_AARCH64_S0:   return (*((triton::uint32*)(this->q0)));
             case triton::arch::ID_REG_AARCH64_H0:   return (*((triton::uint16*)(this->q0)));
             case triton::arch::ID_REG_AARCH64_B0:   return (*((triton::uint8*)(this->q0)));
-            case triton::arch::ID_REG_AARCH64_Q1:   value = triton::utils::fromBufferToUint<triton::uint128>(this->q1);  return value;
             case triton::arch::ID_REG_AARCH64_D1:   return (*((triton::uint64*)(this->q1)));
             case triton::arch::ID_REG_AARCH64_S1:   return (*((triton::uint32*)(this->q1)));
             case triton::arch::ID_REG_AARCH64_H1:   return (*((triton::uint16*)(this->q1)));
             case triton::arch::ID_REG_AARCH64_B1:   return (*((triton::uint8*)(this->q1)));
-            case triton::arch::ID_REG_AARCH64_Q2:   value = triton::utils::fromBufferToUint<triton::uint128>(this->q2);  return value;
             case triton::arch::ID_REG_AARCH64_D2:   return (*((triton::uint64*)(this->q2)));
             case triton::arch::ID_REG_AARCH64_S2:   return (*((triton::uint32*)(this->q2)));
             case triton::arch::ID_REG_AARCH64_H2:   return (*((triton::uint16*)(this->q2)));
             case triton::arch::ID_REG_AARCH64_B2:   return (*((triton::uint8*)(this->q2)));
-            case triton::arch::ID_REG_AARCH64_Q3:   value = triton::utils::fromBufferToUint<triton::uint128>(this->q3);  return value;
             case triton::arch::ID_REG_AARCH64_D3:   return (*((triton::uint64*)(this->q3)));
             case triton::arch::ID_REG_AARCH64_S3:   return (*((triton::uint32*)(this->q3)));
             case triton::arch::ID_REG_AARCH64_H3:   return (*((triton::uint16*)(this->q3)));
             case triton::arch::ID_REG_AARCH64_B3:   return (*((triton::uint8*)(this->q3)));
-            case triton::arch::ID_REG_AARCH64_Q4:   value = triton::utils::fromBufferToUint<triton::uint128>(this->q4);  return value;
             case triton::arch::ID_REG_AARCH64_D4:   return (*((triton::uint64*)(this->q4)));
             case triton::arch::ID_REG_AARCH64_S4:   return (*((triton::uint32*)(this->q4)));
             case triton::arch::ID_REG_AARCH64_H4:   return (*((triton::uint16*)(this->q4)));
             case triton::arch::ID_REG_AARCH64_B4:   return (*((triton::uint8*)(this->q4)));
-            case triton::arch::ID_REG_AARCH64_Q5:   value = triton::utils::fromBufferToUint<triton::uint128>(this->q5);  return value;
             case triton::arch::ID_REG_AARCH64_D5:   return (*((triton::uint64*)(this->q5)));
             case triton::arch::ID_REG_AARCH64_S5:   return (*((triton::uint32*)(this->q5)));
             case triton::arch::ID_REG_AARCH64_H5:   return (*((triton::uint16*)(this->q5)));
             case triton::arch::ID_REG_AARCH64_B5:   return (*((triton::uint8*)(this->q5)));
-            case triton::arch::ID_REG_AARCH64_Q6:   value = triton::utils::fromBufferToUint<triton::uint128>(this->q6);  return value;
             case triton::arch::ID_REG_AARCH64_D6:   return (*((triton::uint64*)(this->q6)));
             case triton::arch::ID_REG_AARCH64_S6:   return (*((triton::uint32*)(this->q6)));
             case triton::arch::ID_REG_AARCH64_H6:   return (*((triton::uint16*)(this->q6)));
             case triton::arch::ID_REG_AARCH64_B6:   return (*((triton::uint8*)(this->q6)));
-            case triton::arch::ID_REG_AARCH64_Q7:   value = triton::utils::fromBufferToUint<triton::uint128>(this->q7);  return value;
             case triton::arch::ID_REG_AARCH64_D7:   return (*((triton::uint64*)(this->q7)));
             case triton::arch::ID_REG_AARCH64_S7:   return (*((triton::uint32*)(this->q7)));
             case triton::arch::ID_REG_AARCH64_H7:   return (*((triton::uint16*)(this->q7)));
             case triton::arch::ID_REG_AARCH64_B7:   return (*((triton::uint8*)(this->q7)));
-            case triton::arch::ID_REG_AARCH64_Q8:   value = triton::utils::fromBufferToUint<triton::uint128>(this->q8);  return value;
             case triton::arch::ID_REG_AARCH64_D8:   return (*((triton::uint64*)(this->q8)));
             case triton::arch::ID_REG_AARCH64_S8:   return (*((triton::uint32*)(this->q8)));
             case triton::arch::ID_REG_AARCH64_H8:   return (*((triton::uint16*)(this->q8)));
             case triton::arch::ID_REG_AARCH64_B8:   return (*((triton::uint8*)(this->q8)));
-            case triton::arch::ID_REG_AARCH64_Q9:   value = triton::utils::fromBufferToUint<triton::uint128>(this->q9);  return value;
             case triton::arch::ID_REG_AARCH64_D9:   return (*((triton::uint64*)(this->q9)));
             case triton::arch::ID_REG_AARCH64_S9:   return (*((triton::uint32*)(this->q9)));
             case triton::arch::ID_REG_AARCH64_H9:   return (*((triton::uint16*)(this->q9)));
             case triton::arch::ID_REG_AARCH64_B9:   return (*((triton::uint8*)(this->q9)));
-            case triton::arch::ID_REG_AARCH64_Q10:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q10);  return value;
             case triton::arch::ID_REG_AARCH64_D10:  return (*((triton::uint64*)(this->q10)));
             case triton::arch::ID_REG_AARCH64_S10:  return (*((triton::uint32*)(this->q10)));
             case triton::arch::ID_REG_AARCH64_H10:  return (*((triton::uint16*)(this->q10)));
             case triton::arch::ID_REG_AARCH64_B10:  return (*((triton::uint8*)(this->q10)));
-            case triton::arch::ID_REG_AARCH64_Q11:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q11);  return value;
             case triton::arch::ID_REG_AARCH64_D11:  return (*((triton::uint64*)(this->q11)));
             case triton::arch::ID_REG_AARCH64_S11:  return (*((triton::uint32*)(this->q11)));
             case triton::arch::ID_REG_AARCH64_H11:  return (*((triton::uint16*)(this->q11)));
             case triton::arch::ID_REG_AARCH64_B11:  return (*((triton::uint8*)(this->q11)));
-            case triton::arch::ID_REG_AARCH64_Q12:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q12);  return value;
             case triton::arch::ID_REG_AARCH64_D12:  return (*((triton::uint64*)(this->q12)));
             case triton::arch::ID_REG_AARCH64_S12:  return (*((triton::uint32*)(this->q12)));
             case triton::arch::ID_REG_AARCH64_H12:  return (*((triton::uint16*)(this->q12)));
             case triton::arch::ID_REG_AARCH64_B12:  return (*((triton::uint8*)(this->q12)));
-            case triton::arch::ID_REG_AARCH64_Q13:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q13);  return value;
             case triton::arch::ID_REG_AARCH64_D13:  return (*((triton::uint64*)(this->q13)));
             case triton::arch::ID_REG_AARCH64_S13:  return (*((triton::uint32*)(this->q13)));
             case triton::arch::ID_REG_AARCH64_H13:  return (*((triton::uint16*)(this->q13)));
             case triton::arch::ID_REG_AARCH64_B13:  return (*((triton::uint8*)(this->q13)));
-            case triton::arch::ID_REG_AARCH64_Q14:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q14);  return value;
             case triton::arch::ID_REG_AARCH64_D14:  return (*((triton::uint64*)(this->q14)));
             case triton::arch::ID_REG_AARCH64_S14:  return (*((triton::uint32*)(this->q14)));
             case triton::arch::ID_REG_AARCH64_H14:  return (*((triton::uint16*)(this->q14)));
             case triton::arch::ID_REG_AARCH64_B14:  return (*((triton::uint8*)(this->q14)));
-            case triton::arch::ID_REG_AARCH64_Q15:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q15);  return value;
             case triton::arch::ID_REG_AARCH64_D15:  return (*((triton::uint64*)(this->q15)));
             case triton::arch::ID_REG_AARCH64_S15:  return (*((triton::uint32*)(this->q15)));
             case triton::arch::ID_REG_AARCH64_H15:  return (*((triton::uint16*)(this->q15)));
             case triton::arch::ID_REG_AARCH64_B15:  return (*((triton::uint8*)(this->q15)));
-            case triton::arch::ID_REG_AARCH64_Q16:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q16);  return value;
             case triton::arch::ID_REG_AARCH64_D16:  return (*((triton::uint64*)(this->q16)));
             case triton::arch::ID_REG_AARCH64_S16:  return (*((triton::uint32*)(this->q16)));
             case triton::arch::ID_REG_AARCH64_H16:  return (*((triton::uint16*)(this->q16)));
             case triton::arch::ID_REG_AARCH64_B16:  return (*((triton::uint8*)(this->q16)));
-            case triton::arch::ID_REG_AARCH64_Q17:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q17);  return value;
             case triton::arch::ID_REG_AARCH64_D17:  return (*((triton::uint64*)(this->q17)));
             case triton::arch::ID_REG_AARCH64_S17:  return (*((triton::uint32*)(this->q17)));
             case triton::arch::ID_REG_AARCH64_H17:  return (*((triton::uint16*)(this->q17)));
             case triton::arch::ID_REG_AARCH64_B17:  return (*((triton::uint8*)(this->q17)));
-            case triton::arch::ID_REG_AARCH64_Q18:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q18);  return value;
             case triton::arch::ID_REG_AARCH64_D18:  return (*((triton::uint64*)(this->q18)));
             case triton::arch::ID_REG_AARCH64_S18:  return (*((triton::uint32*)(this->q18)));
             case triton::arch::ID_REG_AARCH64_H18:  return (*((triton::uint16*)(this->q18)));
             case triton::arch::ID_REG_AARCH64_B18:  return (*((triton::uint8*)(this->q18)));
-            case triton::arch::ID_REG_AARCH64_Q19:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q19);  return value;
             case triton::arch::ID_REG_AARCH64_D19:  return (*((triton::uint64*)(this->q19)));
             case triton::arch::ID_REG_AARCH64_S19:  return (*((triton::uint32*)(this->q19)));
             case triton::arch::ID_REG_AARCH64_H19:  return (*((triton::uint16*)(this->q19)));
             case triton::arch::ID_REG_AARCH64_B19:  return (*((triton::uint8*)(this->q19)));
-            case triton::arch::ID_REG_AARCH64_Q20:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q20);  return value;
             case triton::arch::ID_REG_AARCH64_D20:  return (*((triton::uint64*)(this->q20)));
             case triton::arch::ID_REG_AARCH64_S20:  return (*((triton::uint32*)(this->q20)));
             case triton::arch::ID_REG_AARCH64_H20:  return (*((triton::uint16*)(this->q20)));
             case triton::arch::ID_REG_AARCH64_B20:  return (*((triton::uint8*)(this->q20)));
-            case triton::arch::ID_REG_AARCH64_Q21:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q21);  return value;
             case triton::arch::ID_REG_AARCH64_D21:  return (*((triton::uint64*)(this->q21)));
             case triton::arch::ID_REG_AARCH64_S21:  return (*((triton::uint32*)(this->q21)));
             case triton::arch::ID_REG_AARCH64_H21:  return (*((triton::uint16*)(this->q21)));
             case triton::arch::ID_REG_AARCH64_B21:  return (*((triton::uint8*)(this->q21)));
-            case triton::arch::ID_REG_AARCH64_Q22:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q22);  return value;
             case triton::arch::ID_REG_AARCH64_D22:  return (*((triton::uint64*)(this->q22)));
             case triton::arch::ID_REG_AARCH64_S22:  return (*((triton::uint32*)(this->q22)));
             case triton::arch::ID_REG_AARCH64_H22:  return (*((triton::uint16*)(this->q22)));
             case triton::arch::ID_REG_AARCH64_B22:  return (*((triton::uint8*)(this->q22)));
-            case triton::arch::ID_REG_AARCH64_Q23:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q23);  return value;
             case triton::arch::ID_REG_AARCH64_D23:  return (*((triton::uint64*)(this->q23)));
             case triton::arch::ID_REG_AARCH64_S23:  return (*((triton::uint32*)(this->q23)));
             case triton::arch::ID_REG_AARCH64_H23:  return (*((triton::uint16*)(this->q23)));
             case triton::arch::ID_REG_AARCH64_B23:  return (*((triton::uint8*)(this->q23)));
-            case triton::arch::ID_REG_AARCH64_Q24:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q24);  return value;
             case triton::arch::ID_REG_AARCH64_D24:  return (*((triton::uint64*)(this->q24)));
             case triton::arch::ID_REG_AARCH64_S24:  return (*((triton::uint32*)(this->q24)));
             case triton::arch::ID_REG_AARCH64_H24:  return (*((triton::uint16*)(this->q24)));
             case triton::arch::ID_REG_AARCH64_B24:  return (*((triton::uint8*)(this->q24)));
-            case triton::arch::ID_REG_AARCH64_Q25:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q25);  return value;
             case triton::arch::ID_REG_AARCH64_D25:  return (*((triton::uint64*)(this->q25)));
             case triton::arch::ID_REG_AARCH64_S25:  return (*((triton::uint32*)(this->q25)));
             case triton::arch::ID_REG_AARCH64_H25:  return (*((triton::uint16*)(this->q25)));
             case triton::arch::ID_REG_AARCH64_B25:  return (*((triton::uint8*)(this->q25)));
-            case triton::arch::ID_REG_AARCH64_Q26:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q26);  return value;
             case triton::arch::ID_REG_AARCH64_D26:  return (*((triton::uint64*)(this->q26)));
             case triton::arch::ID_REG_AARCH64_S26:  return (*((triton::uint32*)(this->q26)));
             case triton::arch::ID_REG_AARCH64_H26:  return (*((triton::uint16*)(this->q26)));
             case triton::arch::ID_REG_AARCH64_B26:  return (*((triton::uint8*)(this->q26)));
-            case triton::arch::ID_REG_AARCH64_Q27:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q27);  return value;
             case triton::arch::ID_REG_AARCH64_D27:  return (*((triton::uint64*)(this->q27)));
             case triton::arch::ID_REG_AARCH64_S27:  return (*((triton::uint32*)(this->q27)));
             case triton::arch::ID_REG_AARCH64_H27:  return (*((triton::uint16*)(this->q27)));
             case triton::arch::ID_REG_AARCH64_B27:  return (*((triton::uint8*)(this->q27)));
-            case triton::arch::ID_REG_AARCH64_Q28:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q28);  return value;
             case triton::arch::ID_REG_AARCH64_D28:  return (*((triton::uint64*)(this->q28)));
             case triton::arch::ID_REG_AARCH64_S28:  return (*((triton::uint32*)(this->q28)));
             case triton::arch::ID_REG_AARCH64_H28:  return (*((triton::uint16*)(this->q28)));
             case triton::arch::ID_REG_AARCH64_B28:  return (*((triton::uint8*)(this->q28)));
-            case triton::arch::ID_REG_AARCH64_Q29:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q29);  return value;
             case triton::arch::ID_REG_AARCH64_D29:  return (*((triton::uint64*)(this->q29)));
             case triton::arch::ID_REG_AARCH64_S29:  return (*((triton::uint32*)(this->q29)));
             case triton::arch::ID_REG_AARCH64_H29:  return (*((triton::uint16*)(this->q29)));
             case triton::arch::ID_REG_AARCH64_B29:  return (*((triton::uint8*)(this->q29)));
-            case triton::arch::ID_REG_AARCH64_Q30:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q30);  return value;
             case triton::arch::ID_REG_AARCH64_D30:  return (*((triton::uint64*)(this->q30)));
             case triton::arch::ID_REG_AARCH64_S30:  return (*((triton::uint32*)(this->q30)));
             case triton::arch::ID_REG_AARCH64_H30:  return (*((triton::uint16*)(this->q30)));
             case triton::arch::ID_REG_AARCH64_B30:  return (*((triton::uint8*)(this->q30)));
-            case triton::arch::ID_REG_AARCH64_Q31:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q31);  return value;
             case triton::arch::ID_REG_AARCH64_D31:  return (*((triton::uint64*)(this->q31)));
             case triton::arch::ID_REG_AARCH64_S31:  return (*((triton::uint32*)(this->q31)));
             case triton::arch::ID_REG_AARCH64_H31:  return (*((triton::uint16*)(this->q31)));
             case triton::arch::ID_REG_AARCH64_B31:  return (*((triton::uint8*)(this->q31)));
+            default:
+              throw triton::exceptions::Cpu("AArch64Cpu::getConcreteRegisterValue64(): Invalid register.");
+          }
+
+          return value;
+        }
+
+
+        triton::uint512 AArch64Cpu::getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks) const {
+          triton::uint512 value = 0;
+
+          if (execCallbacks && this->callbacks && this->callbacks->isDefined(triton::callbacks::GET_CONCRETE_REGISTER_VALUE))
+            this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_REGISTER_VALUE, reg);
+
+          /* The registers of 64 bits or less do not need the multiprecision arithmetic */
+          if (reg.getBitSize() <= triton::bitsize::qword)
+            return this->getConcreteRegisterValue64(reg, false);
+
+          switch (reg.getId()) {
+            case triton::arch::ID_REG_AARCH64_Q0:   value = triton::utils::fromBufferToUint<triton::uint128>(this->q0);  return value;
+            case triton::arch::ID_REG_AARCH64_Q1:   value = triton::utils::fromBufferToUint<triton::uint128>(this->q1);  return value;
+            case triton::arch::ID_REG_AARCH64_Q2:   value = triton::utils::fromBufferToUint<triton::uint128>(this->q2);  return value;
+            case triton::arch::ID_REG_AARCH64_Q3:   value = triton::utils::fromBufferToUint<triton::uint128>(this->q3);  return value;
+            case triton::arch::ID_REG_AARCH64_Q4:   value = triton::utils::fromBufferToUint<triton::uint128>(this->q4);  return value;
+            case triton::arch::ID_REG_AARCH64_Q5:   value = triton::utils::fromBufferToUint<triton::uint128>(this->q5);  return value;
+            case triton::arch::ID_REG_AARCH64_Q6:   value = triton::utils::fromBufferToUint<triton::uint128>(this->q6);  return value;
+            case triton::arch::ID_REG_AARCH64_Q7:   value = triton::utils::fromBufferToUint<triton::uint128>(this->q7);  return value;
+            case triton::arch::ID_REG_AARCH64_Q8:   value = triton::utils::fromBufferToUint<triton::uint128>(this->q8);  return value;
+            case triton::arch::ID_REG_AARCH64_Q9:   value = triton::utils::fromBufferToUint<triton::uint128>(this->q9);  return value;
+            case triton::arch::ID_REG_AARCH64_Q10:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q10);  return value;
+            case triton::arch::ID_REG_AARCH64_Q11:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q11);  return value;
+            case triton::arch::ID_REG_AARCH64_Q12:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q12);  return value;
+            case triton::arch::ID_REG_AARCH64_Q13:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q13);  return value;
+            case triton::arch::ID_REG_AARCH64_Q14:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q14);  return value;
+            case triton::arch::ID_REG_AARCH64_Q15:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q15);  return value;
+            case triton::arch::ID_REG_AARCH64_Q16:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q16);  return value;
+            case triton::arch::ID_REG_AARCH64_Q17:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q17);  return value;
+            case triton::arch::ID_REG_AARCH64_Q18:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q18);  return value;
+            case triton::arch::ID_REG_AARCH64_Q19:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q19);  return value;
+            case triton::arch::ID_REG_AARCH64_Q20:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q20);  return value;
+            case triton::arch::ID_REG_AARCH64_Q21:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q21);  return value;
+            case triton::arch::ID_REG_AARCH64_Q22:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q22);  return value;
+            case triton::arch::ID_REG_AARCH64_Q23:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q23);  return value;
+            case triton::arch::ID_REG_AARCH64_Q24:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q24);  return value;
+            case triton::arch::ID_REG_AARCH64_Q25:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q25);  return value;
+            case triton::arch::ID_REG_AARCH64_Q26:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q26);  return value;
+            case triton::arch::ID_REG_AARCH64_Q27:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q27);  return value;
+            case triton::arch::ID_REG_AARCH64_Q28:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q28);  return value;
+            case triton::arch::ID_REG_AARCH64_Q29:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q29);  return value;
+            case triton::arch::ID_REG_AARCH64_Q30:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q30);  return value;
+            case triton::arch::ID_REG_AARCH64_Q31:  value = triton::utils::fromBufferToUint<triton::uint128>(this->q31);  return value;
             default:
               throw triton::exceptions::Cpu("AArch64Cpu::getConcreteRegisterValue(): Invalid register.");
           }
@@ -785,9 +846,9 @@ namespace triton {
 
 
         void AArch64Cpu::setConcreteMemoryValue(triton::uint64 addr, triton::uint8 value) {
-          if (this->callbacks)
+          if (this->callbacks && this->callbacks->isDefined(triton::callbacks::SET_CONCRETE_MEMORY_VALUE))
             this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_MEMORY_VALUE, MemoryAccess(addr, triton::size::byte), value);
-          this->memory[addr] = value;
+          this->memory.set(addr, value);
         }
 
 
@@ -795,6 +856,7 @@ namespace triton {
           triton::uint64 addr = mem.getAddress();
           triton::uint32 size = mem.getSize();
           triton::uint512 cv  = value;
+          triton::uint8 bytes[triton::size::dqqword];
 
           if (cv > mem.getMaxValue())
             throw triton::exceptions::Register("AArch64Cpu::setConcreteMemoryValue(): You cannot set this concrete value (too big) to this memory access.");
@@ -802,29 +864,57 @@ namespace triton {
           if (size == 0 || size > triton::size::dqqword)
             throw triton::exceptions::Cpu("AArch64Cpu::setConcreteMemoryValue(): Invalid size memory.");
 
-          if (this->callbacks)
+          if (this->callbacks && this->callbacks->isDefined(triton::callbacks::SET_CONCRETE_MEMORY_VALUE))
             this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_MEMORY_VALUE, mem, value);
 
           for (triton::uint32 i = 0; i < size; i++) {
-            this->memory[addr+i] = (cv & 0xff).convert_to<triton::uint8>();
+            bytes[i] = (cv & 0xff).convert_to<triton::uint8>();
             cv >>= 8;
           }
+          this->memory.write(addr, bytes, size);
         }
 
 
         void AArch64Cpu::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const std::vector<triton::uint8>& values) {
-          this->memory.reserve(values.size() + this->memory.size());
-          for (triton::usize index = 0; index < values.size(); index++) {
-            this->setConcreteMemoryValue(baseAddr+index, values[index]);
-          }
+          this->setConcreteMemoryAreaValue(baseAddr, values.data(), values.size());
         }
 
 
         void AArch64Cpu::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size) {
-          this->memory.reserve(size + this->memory.size());
-          for (triton::usize index = 0; index < size; index++) {
-            this->setConcreteMemoryValue(baseAddr+index, area[index]);
+          if (this->callbacks && this->callbacks->isDefined()) {
+            /* The area callbacks are called once, before the area is written */
+            this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_MEMORY_AREA_VALUE, baseAddr, area, size);
+
+            /* The callbacks are called on each byte, before it is written */
+            if (this->callbacks->isDefined(triton::callbacks::SET_CONCRETE_MEMORY_VALUE)) {
+              for (triton::usize index = 0; index < size; index++)
+                this->setConcreteMemoryValue(baseAddr+index, area[index]);
+              return;
+            }
           }
+
+          this->memory.write(baseAddr, area, size);
+        }
+
+
+        void AArch64Cpu::mapConcreteMemoryArea(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size, const std::shared_ptr<const void>& owner) {
+          if (this->callbacks && this->callbacks->isDefined()) {
+            /* The callbacks are called on each byte, the area is copied */
+            if (this->callbacks->isDefined(triton::callbacks::SET_CONCRETE_MEMORY_VALUE)) {
+              this->setConcreteMemoryAreaValue(baseAddr, area, size);
+              return;
+            }
+
+            /* The area callbacks are called once, before the area is mapped */
+            this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_MEMORY_AREA_VALUE, baseAddr, area, size);
+          }
+
+          this->memory.map(baseAddr, area, size, owner);
+        }
+
+
+        void AArch64Cpu::setConcreteMemoryPlacement(const triton::utils::MemoryPlacement& placement) {
+          this->memory.setPlacement(placement);
         }
 
 
@@ -832,7 +922,7 @@ namespace triton {
           if (value > reg.getMaxValue())
             throw triton::exceptions::Register("AArch64Cpu::setConcreteRegisterValue(): You cannot set this concrete value (too big) to this register.");
 
-          if (this->callbacks)
+          if (this->callbacks && this->callbacks->isDefined(triton::callbacks::SET_CONCRETE_REGISTER_VALUE))
             this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_REGISTER_VALUE, reg, value);
 
           switch (reg.getId()) {
@@ -1108,6 +1198,17 @@ namespace triton {
         }
 
 
+        triton::uint32 AArch64Cpu::getDecodingState(void) const {
+          /* The decoding does not depend on the state in aarch64 */
+          return 0;
+        }
+
+
+        void AArch64Cpu::setDecodingState(triton::uint32 state) {
+          /* The decoding does not depend on the state in aarch64 */
+        }
+
+
         bool AArch64Cpu::isMemoryExclusiveAccess(void) const {
           /* There is no exclusive memory access support in aarch64 */
           return false;
@@ -1125,11 +1226,7 @@ namespace triton {
 
 
         bool AArch64Cpu::isConcreteMemoryValueDefined(triton::uint64 baseAddr, triton::usize size) const {
-          for (triton::usize index = 0; index < size; index++) {
-            if (this->memory.find(baseAddr + index) == this->memory.end())
-              return false;
-          }
-          return true;
+          return this->memory.isDefined(baseAddr, size);
         }
 
 
@@ -1139,11 +1236,7 @@ namespace triton {
 
 
         void AArch64Cpu::clearConcreteMemoryValue(triton::uint64 baseAddr, triton::usize size) {
-          for (triton::usize index = 0; index < size; index++) {
-            if (this->memory.find(baseAddr + index) != this->memory.end()) {
-              this->memory.erase(baseAddr + index);
-            }
-          }
+          this->memory.erase(baseAddr, size);
         }
 
       }; /* aarch64 namespace */
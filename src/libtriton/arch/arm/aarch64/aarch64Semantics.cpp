@@ -322,7 +322,14 @@ namespace triton {
 
         triton::ast::SharedAbstractNode AArch64Semantics::getCodeConditionAst(triton::arch::Instruction& inst,
                                                                               triton::ast::SharedAbstractNode& thenNode,
-                                                                              triton::ast::SharedAbstractNode& elseNode) {
+                                                                              triton::ast::SharedAbstractNode& elseNode,
+                                                                              bool fold) {
+
+          auto ite = [this, fold](const triton::ast::SharedAbstractNode& cond,
+                                  const triton::ast::SharedAbstractNode& thenExpr,
+                                  const triton::ast::SharedAbstractNode& elseExpr) {
+            return fold ? this->astCtxt->iteFold(cond, thenExpr, elseExpr) : this->astCtxt->ite(cond, thenExpr, elseExpr);
+          };
 
           switch (inst.getCodeCondition()) {
             // Always. Any flags. This suffix is normally omitted.
@@ -333,7 +340,7 @@ namespace triton {
             // Equal. Z set.
             case triton::arch::arm::ID_CONDITION_EQ: {
               auto z = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_Z)));
-              auto node = this->astCtxt->ite(
+              auto node = ite(
                           this->astCtxt->equal(z, this->astCtxt->bvtrue()),
                           thenNode,
                           elseNode);
@@ -344,7 +351,7 @@ namespace triton {
             case triton::arch::arm::ID_CONDITION_GE: {
               auto n = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_N)));
               auto v = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_V)));
-              auto node = this->astCtxt->ite(
+              auto node = ite(
                           this->astCtxt->equal(n, v),
                           thenNode,
                           elseNode);
@@ -356,7 +363,7 @@ namespace triton {
               auto z = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_Z)));
               auto n = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_N)));
               auto v = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_V)));
-              auto node = this->astCtxt->ite(
+              auto node = ite(
                           this->astCtxt->land(
                             this->astCtxt->equal(z, this->astCtxt->bvfalse()),
                             this->astCtxt->equal(n, v)
@@ -370,7 +377,7 @@ namespace triton {
             case triton::arch::arm::ID_CONDITION_HI: {
               auto c = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_C)));
               auto z = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_Z)));
-              auto node = this->astCtxt->ite(
+              auto node = ite(
                           this->astCtxt->land(
                             this->astCtxt->equal(c, this->astCtxt->bvtrue()),
                             this->astCtxt->equal(z, this->astCtxt->bvfalse())
@@ -383,7 +390,7 @@ namespace triton {
             // Higher or same (unsigned >=). C set.
             case triton::arch::arm::ID_CONDITION_HS: {
               auto c = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_C)));
-              auto node = this->astCtxt->ite(
+              auto node = ite(
                           this->astCtxt->equal(c, this->astCtxt->bvtrue()),
                           thenNode,
                           elseNode);
@@ -395,7 +402,7 @@ namespace triton {
               auto z = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_Z)));
               auto n = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_N)));
               auto v = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_V)));
-              auto node = this->astCtxt->ite(
+              auto node = ite(
                           this->astCtxt->lor(
                             this->astCtxt->equal(z, this->astCtxt->bvtrue()),
                             this->astCtxt->lnot(this->astCtxt->equal(n, v))
@@ -408,7 +415,7 @@ namespace triton {
             // Lower (unsigned <). C clear.
             case triton::arch::arm::ID_CONDITION_LO: {
               auto c = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_C)));
-              auto node = this->astCtxt->ite(
+              auto node = ite(
                           this->astCtxt->equal(c, this->astCtxt->bvfalse()),
                           thenNode,
                           elseNode);
@@ -419,7 +426,7 @@ namespace triton {
             case triton::arch::arm::ID_CONDITION_LS: {
               auto c = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_C)));
               auto z = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_Z)));
-              auto node = this->astCtxt->ite(
+              auto node = ite(
                           this->astCtxt->lor(
                             this->astCtxt->equal(c, this->astCtxt->bvfalse()),
                             this->astCtxt->equal(z, this->astCtxt->bvtrue())
@@ -433,7 +440,7 @@ namespace triton {
             case triton::arch::arm::ID_CONDITION_LT: {
               auto n = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_N)));
               auto v = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_V)));
-              auto node = this->astCtxt->ite(
+              auto node = ite(
                           this->astCtxt->lnot(this->astCtxt->equal(n, v)),
                           thenNode,
                           elseNode);
@@ -443,7 +450,7 @@ namespace triton {
             // Negative. N set.
             case triton::arch::arm::ID_CONDITION_MI: {
               auto n = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_N)));
-              auto node = this->astCtxt->ite(
+              auto node = ite(
                           this->astCtxt->equal(n, this->astCtxt->bvtrue()),
                           thenNode,
                           elseNode);
@@ -453,7 +460,7 @@ namespace triton {
             // Not equal. Z clear.
             case triton::arch::arm::ID_CONDITION_NE: {
               auto z = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_Z)));
-              auto node = this->astCtxt->ite(
+              auto node = ite(
                           this->astCtxt->equal(z, this->astCtxt->bvfalse()),
                           thenNode,
                           elseNode);
@@ -463,7 +470,7 @@ namespace triton {
             // Positive or zero. N clear.
             case triton::arch::arm::ID_CONDITION_PL: {
               auto n = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_N)));
-              auto node = this->astCtxt->ite(
+              auto node = ite(
                           this->astCtxt->equal(n, this->astCtxt->bvfalse()),
                           thenNode,
                           elseNode);
@@ -473,7 +480,7 @@ namespace triton {
             // No overflow. V clear.
             case triton::arch::arm::ID_CONDITION_VC: {
               auto v = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_V)));
-              auto node = this->astCtxt->ite(
+              auto node = ite(
                           this->astCtxt->equal(v, this->astCtxt->bvfalse()),
                           thenNode,
                           elseNode);
@@ -483,7 +490,7 @@ namespace triton {
             // Overflow. V set.
             case triton::arch::arm::ID_CONDITION_VS: {
               auto v = this->symbolicEngine->getOperandAst(inst, triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_AARCH64_V)));
-              auto node = this->astCtxt->ite(
+              auto node = ite(
                           this->astCtxt->equal(v, this->astCtxt->bvtrue()),
                           thenNode,
                           elseNode);
@@ -1075,8 +1082,8 @@ namespace triton {
           auto op1 = this->symbolicEngine->getOperandAst(inst, src);
           auto op2 = this->astCtxt->bv(inst.getNextAddress(), dst.getBitSize());
 
-          /* Create the semantics */
-          auto node = this->getCodeConditionAst(inst, op1, op2);
+          /* Create the semantics, an ite so that both targets are in the path constraint */
+          auto node = this->getCodeConditionAst(inst, op1, op2, false);
 
           /* Create symbolic expression */
           auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "B operation - Program Counter");
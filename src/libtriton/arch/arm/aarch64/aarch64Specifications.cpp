@@ -18,10 +18,24 @@ namespace triton {
     namespace arm {
       namespace aarch64 {
 
-        AArch64Specifications::AArch64Specifications(triton::arch::architecture_e arch) {
+        AArch64Specifications::AArch64Specifications(triton::arch::architecture_e arch)
+          : id2reg(getRegisterTable(arch).id2reg),
+            name2id(getRegisterTable(arch).name2id),
+            regIndex(getRegisterTable(arch).regIndex) {
+        }
+
+
+        const AArch64Specifications::RegisterTable& AArch64Specifications::getRegisterTable(triton::arch::architecture_e arch) {
           if (arch != triton::arch::ARCH_AARCH64)
               throw triton::exceptions::Architecture("AArch64Specifications::AArch64Specifications(): Invalid architecture.");
 
+          /* The table is immutable, the contexts of this architecture share it */
+          static const RegisterTable aarch64(arch);
+          return aarch64;
+        }
+
+
+        AArch64Specifications::RegisterTable::RegisterTable(triton::arch::architecture_e arch) {
             // Fill id2reg and name2id with those available in AArch64 from spec
             #define REG_SPEC(UPPER_NAME, LOWER_NAME, AARCH64_UPPER, AARCH64_LOWER, AARCH64_PARENT, MUTABLE) \
               id2reg.emplace(ID_REG_AARCH64_##UPPER_NAME,                                                   \
@@ -36,6 +50,11 @@ namespace triton {
             // Handle register not available in capstone as normal registers
             #define REG_SPEC_NO_CAPSTONE REG_SPEC
             #include "triton/aarch64.spec"
+
+          /* Index the registers by id, a lookup is done for each register access */
+          this->regIndex.fill(nullptr);
+          for (const auto& kv : this->id2reg)
+            this->regIndex[kv.first] = &kv.second;
         }
 
 
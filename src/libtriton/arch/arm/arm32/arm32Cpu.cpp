@@ -10,6 +10,7 @@
 
 #include <triton/architecture.hpp>
 #include <triton/arm32Cpu.hpp>
+#include <triton/capstonePool.hpp>
 #include <triton/coreUtils.hpp>
 #include <triton/cpuSize.hpp>
 #include <triton/exceptions.hpp>
@@ -25,8 +26,6 @@ namespace triton {
 
         Arm32Cpu::Arm32Cpu(triton::callbacks::Callbacks* callbacks) : Arm32Specifications(ARCH_ARM32) {
           this->callbacks       = callbacks;
-          this->handleArm       = 0;
-          this->handleThumb     = 0;
           this->thumb           = false;
           this->itInstrsCount   = 0;
           this->itInstrIndex    = 0;
@@ -46,44 +45,30 @@ namespace triton {
 
         Arm32Cpu::~Arm32Cpu() {
           this->memory.clear();
-
-          if (this->handleArm) {
-            triton::extlibs::capstone::cs_close(&this->handleArm);
-          }
-
-          if (this->handleThumb) {
-            triton::extlibs::capstone::cs_close(&this->handleThumb);
-          }
         }
 
 
         void Arm32Cpu::disassInit(void) {
           /* Open capstone in ARM mode. */
-          if (this->handleArm) {
-            triton::extlibs::capstone::cs_close(&this->handleArm);
-          }
+          this->disassemblerArm = triton::arch::CapstonePool::get(triton::extlibs::capstone::CS_ARCH_ARM, triton::extlibs::capstone::CS_MODE_ARM);
 
           /* Open capstone in Thumb mode. */
-          if (this->handleThumb) {
-            triton::extlibs::capstone::cs_close(&this->handleThumb);
-          }
+          this->disassemblerThumb = triton::arch::CapstonePool::get(triton::extlibs::capstone::CS_ARCH_ARM, triton::extlibs::capstone::CS_MODE_THUMB);
+        }
 
-          if (triton::extlibs::capstone::cs_open(triton::extlibs::capstone::CS_ARCH_ARM, triton::extlibs::capstone::CS_MODE_ARM, &this->handleArm) != triton::extlibs::capstone::CS_ERR_OK) {
-            throw triton::exceptions::Disassembly("Arm32Cpu::disassInit(): Cannot open capstone in ARM mode.");
-          }
 
-          if (triton::extlibs::capstone::cs_open(triton::extlibs::capstone::CS_ARCH_ARM, triton::extlibs::capstone::CS_MODE_THUMB, &this->handleThumb) != triton::extlibs::capstone::CS_ERR_OK) {
-            throw triton::exceptions::Disassembly("Arm32Cpu::disassInit(): Cannot open capstone in Thumb mode.");
-          }
+        void Arm32Cpu::copy(const Arm32Cpu& other) {
+          this->callbacks         = other.callbacks;
+          this->memory            = other.memory;
+          this->disassemblerArm   = other.disassemblerArm;
+          this->disassemblerThumb = other.disassemblerThumb;
 
-          triton::extlibs::capstone::cs_option(this->handleThumb, triton::extlibs::capstone::CS_OPT_DETAIL, triton::extlibs::capstone::CS_OPT_ON);
-          triton::extlibs::capstone::cs_option(this->handleArm,   triton::extlibs::capstone::CS_OPT_DETAIL, triton::extlibs::capstone::CS_OPT_ON);
+          this->copyRegisters(other);
         }
 
 
-        void Arm32Cpu::copy(const Arm32Cpu& other) {
-          this->callbacks = other.callbacks;
-          this->memory    = other.memory;
+        void Arm32Cpu::copyRegisters(const triton::arch::CpuInterface& cpu) {
+          const Arm32Cpu& other = dynamic_cast<const Arm32Cpu&>(cpu);
 
           std::memcpy(this->r0,   other.r0,   sizeof(this->r0));
           std::memcpy(this->r1,   other.r1,   sizeof(this->r1));
@@ -105,6 +90,16 @@ namespace triton {
         }
 
 
+        void Arm32Cpu::copyState(const triton::arch::CpuInterface& other) {
+          triton::callbacks::Callbacks* callbacks = this->callbacks;
+          const Arm32Cpu& cpu = dynamic_cast<const Arm32Cpu&>(other);
+          this->copy(cpu);
+          this->callbacks       = callbacks;
+          this->thumb           = cpu.thumb;
+          this->exclusiveMemAcc = cpu.exclusiveMemAcc;
+        }
+
+
         void Arm32Cpu::clear(void) {
           /* Clear memory */
           this->memory.clear();
@@ -202,11 +197,9 @@ namespace triton {
 
 
         const triton::arch::Register& Arm32Cpu::getRegister(triton::arch::register_e id) const {
-          try {
-            return this->id2reg.at(id);
-          } catch (const std::out_of_range&) {
+          if (static_cast<triton::uint32>(id) >= triton::arch::ID_REG_LAST_ITEM || this->regIndex[id] == nullptr)
             throw triton::exceptions::Cpu("Arm32Cpu::getRegister(): Invalid register for this architecture.");
-          }
+          return *this->regIndex[id];
         }
 
 
@@ -242,28 +235,26 @@ namespace triton {
 
 
         void Arm32Cpu::disassembly(triton::arch::Instruction& inst) {
-          triton::extlibs::capstone::csh      handle;
-          triton::extlibs::capstone::cs_insn* insn;
-          triton::usize                       count = 0;
-
           /* Check if the opcode and opcode' size are defined */
           if (inst.getOpcode() == nullptr || inst.getSize() == 0)
             throw triton::exceptions::Disassembly("Arm32Cpu::disassembly(): Opcode and opcodeSize must be definied.");
 
-          /* Select capstone handler (based on execution mode) */
-          handle = (this->thumb ? this->handleThumb : this->handleArm);
-
           /* Clear instructicon's operands if alredy defined */
           inst.operands.clear();
 
           /* Update instruction address if undefined */
           if (!inst.getAddress()) {
-            inst.setAddress(this->getConcreteRegisterValue(this->getProgramCounter()).convert_to<triton::uint64>());
+            inst.setAddress(this->getConcreteRegisterValue64(this->getProgramCounter()));
           }
 
           /* Let's disass and build our operands */
-          count = triton::extlibs::capstone::cs_disasm(handle, inst.getOpcode(), inst.getSize(), inst.getAddress(), 0, &insn);
-          if (count > 0) {
+          /* Select capstone handler (based on execution mode) */
+          triton::arch::CapstonePool::Lease lease(*(this->thumb ? this->disassemblerThumb : this->disassemblerArm));
+          const triton::uint8* code = inst.getOpcode();
+          size_t codeSize           = inst.getSize();
+          triton::uint64 codeAddr   = inst.getAddress();
+          triton::extlibs::capstone::cs_insn* insn = lease.insn;
+          if (triton::extlibs::capstone::cs_disasm_iter(lease.handle, &code, &codeSize, &codeAddr, insn)) {
             triton::extlibs::capstone::cs_detail* detail = insn->detail;
             for (triton::uint32 j = 0; j < 1; j++) {
               /* Refine the opcode */
@@ -288,16 +279,7 @@ namespace triton {
               inst.setThumb(thumb);
 
               /* Init the disassembly */
-              std::stringstream str;
-
-              /* Add mnemonic */
-              str << insn[j].mnemonic;
-
-              /* Add operands */
-              if (inst.getType() == ID_INS_IT || detail->arm.op_count)
-                str << " " <<  insn[j].op_str;
-
-              inst.setDisassembly(str.str());
+              inst.setDisassembly(insn[j].mnemonic, (inst.getType() == ID_INS_IT || detail->arm.op_count) ? insn[j].op_str : "");
 
               /* Process IT instruction */
               if (inst.getType() == ID_INS_IT) {
@@ -495,9 +477,6 @@ namespace triton {
 
             /* Post process instruction */
             this->postDisassembly(inst);
-
-            /* Free capstone stuffs */
-            triton::extlibs::capstone::cs_free(insn, count);
           }
           else
             throw triton::exceptions::Disassembly("Arm32Cpu::disassembly(): Failed to disassemble the given code.");
@@ -570,23 +549,43 @@ namespace triton {
 
 
         triton::uint8 Arm32Cpu::getConcreteMemoryValue(triton::uint64 addr, bool execCallbacks) const {
-          if (execCallbacks && this->callbacks)
+          if (execCallbacks && this->callbacks && this->callbacks->isLoadDefined())
             this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, MemoryAccess(addr, triton::size::byte));
 
-          auto it = this->memory.find(addr);
-          if (it == this->memory.end())
-            return 0x00;
+          return this->memory.get(addr);
+        }
 
-          return it->second;
+
+        triton::uint64 Arm32Cpu::getConcreteMemoryValue64(const triton::arch::MemoryAccess& mem, bool execCallbacks) const {
+          triton::uint64 ret = 0;
+          triton::uint8 bytes[triton::size::qword];
+          triton::uint64 addr = 0;
+          triton::uint32 size = 0;
+
+          if (execCallbacks && this->callbacks && this->callbacks->isLoadDefined())
+            this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, mem);
+
+          addr = mem.getAddress();
+          size = mem.getSize();
+
+          if (size == 0 || size > triton::size::qword)
+            throw triton::exceptions::Cpu("Arm32Cpu::getConcreteMemoryValue64(): Invalid size memory.");
+
+          this->memory.read(addr, size, bytes);
+          for (triton::sint32 i = size-1; i >= 0; i--)
+            ret = ((ret << triton::bitsize::byte) | bytes[i]);
+
+          return ret;
         }
 
 
         triton::uint512 Arm32Cpu::getConcreteMemoryValue(const triton::arch::MemoryAccess& mem, bool execCallbacks) const {
           triton::uint512 ret = 0;
+          triton::uint8 bytes[triton::size::dqqword];
           triton::uint64 addr = 0;
           triton::uint32 size = 0;
 
-          if (execCallbacks && this->callbacks)
+          if (execCallbacks && this->callbacks && this->callbacks->isLoadDefined())
             this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, mem);
 
           addr = mem.getAddress();
@@ -595,27 +594,53 @@ namespace triton {
           if (size == 0 || size > triton::size::dqqword)
             throw triton::exceptions::Cpu("Arm32Cpu::getConcreteMemoryValue(): Invalid size memory.");
 
+          /* The accesses of 64 bits or less do not need the multiprecision arithmetic */
+          if (size <= triton::size::qword)
+            return this->getConcreteMemoryValue64(mem, false);
+
+          this->memory.read(addr, size, bytes);
           for (triton::sint32 i = size-1; i >= 0; i--)
-            ret = ((ret << triton::bitsize::byte) | this->getConcreteMemoryValue(addr+i, false));
+            ret = ((ret << triton::bitsize::byte) | bytes[i]);
 
           return ret;
         }
 
 
         std::vector<triton::uint8> Arm32Cpu::getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks) const {
-          std::vector<triton::uint8> area;
+          std::vector<triton::uint8> area(size);
 
-          for (triton::usize index = 0; index < size; index++)
-            area.push_back(this->getConcreteMemoryValue(baseAddr+index));
+          this->getConcreteMemoryAreaValue(baseAddr, area.data(), size, execCallbacks);
 
           return area;
         }
 
 
-        triton::uint512 Arm32Cpu::getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks) const {
-          triton::uint512 value = 0;
+        void Arm32Cpu::getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::uint8* area, triton::usize size, bool execCallbacks) const {
+          if (execCallbacks && this->callbacks && this->callbacks->isDefined()) {
+            /* The area callbacks are called once, before the area is read */
+            this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_AREA_VALUE, baseAddr, size);
 
-          if (execCallbacks && this->callbacks)
+            /* The callbacks are called on each byte, before it is read */
+            if (this->callbacks->isDefined(triton::callbacks::GET_CONCRETE_MEMORY_VALUE)) {
+              for (triton::usize index = 0; index < size; index++)
+                area[index] = this->getConcreteMemoryValue(baseAddr+index);
+              return;
+            }
+          }
+
+          this->memory.read(baseAddr, size, area);
+        }
+
+
+        const triton::arch::ConcreteMemory& Arm32Cpu::getConcreteMemory(void) const {
+          return this->memory;
+        }
+
+
+        triton::uint64 Arm32Cpu::getConcreteRegisterValue64(const triton::arch::Register& reg, bool execCallbacks) const {
+          triton::uint64 value = 0;
+
+          if (execCallbacks && this->callbacks && this->callbacks->isDefined(triton::callbacks::GET_CONCRETE_REGISTER_VALUE))
             this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_REGISTER_VALUE, reg);
 
           switch (reg.getId()) {
@@ -641,17 +666,23 @@ namespace triton {
             case triton::arch::ID_REG_ARM32_C:    return (((*((triton::uint32*)(this->apsr))) >> 29) & 1);
             case triton::arch::ID_REG_ARM32_V:    return (((*((triton::uint32*)(this->apsr))) >> 28) & 1);
             default:
-              throw triton::exceptions::Cpu("Arm32Cpu::getConcreteRegisterValue(): Invalid register.");
+              throw triton::exceptions::Cpu("Arm32Cpu::getConcreteRegisterValue64(): Invalid register.");
           }
 
           return value;
         }
 
 
+        triton::uint512 Arm32Cpu::getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks) const {
+          /* All the registers hold 32 bits or less */
+          return this->getConcreteRegisterValue64(reg, execCallbacks);
+        }
+
+
         void Arm32Cpu::setConcreteMemoryValue(triton::uint64 addr, triton::uint8 value) {
-          if (this->callbacks)
+          if (this->callbacks && this->callbacks->isDefined(triton::callbacks::SET_CONCRETE_MEMORY_VALUE))
             this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_MEMORY_VALUE, MemoryAccess(addr, triton::size::byte), value);
-          this->memory[addr] = value;
+          this->memory.set(addr, value);
         }
 
 
@@ -659,6 +690,7 @@ namespace triton {
           triton::uint64 addr = mem.getAddress();
           triton::uint32 size = mem.getSize();
           triton::uint512 cv  = value;
+          triton::uint8 bytes[triton::size::dqqword];
 
           if (cv > mem.getMaxValue())
             throw triton::exceptions::Register("Arm32Cpu::setConcreteMemoryValue(): You cannot set this concrete value (too big) to this memory access.");
@@ -666,29 +698,57 @@ namespace triton {
           if (size == 0 || size > triton::size::dqqword)
             throw triton::exceptions::Cpu("Arm32Cpu::setConcreteMemoryValue(): Invalid size memory.");
 
-          if (this->callbacks)
+          if (this->callbacks && this->callbacks->isDefined(triton::callbacks::SET_CONCRETE_MEMORY_VALUE))
             this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_MEMORY_VALUE, mem, value);
 
           for (triton::uint32 i = 0; i < size; i++) {
-            this->memory[addr+i] = (cv & 0xff).convert_to<triton::uint8>();
+            bytes[i] = (cv & 0xff).convert_to<triton::uint8>();
             cv >>= 8;
           }
+          this->memory.write(addr, bytes, size);
         }
 
 
         void Arm32Cpu::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const std::vector<triton::uint8>& values) {
-          this->memory.reserve(values.size() + this->memory.size());
-          for (triton::usize index = 0; index < values.size(); index++) {
-            this->setConcreteMemoryValue(baseAddr+index, values[index]);
-          }
+          this->setConcreteMemoryAreaValue(baseAddr, values.data(), values.size());
         }
 
 
         void Arm32Cpu::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size) {
-          this->memory.reserve(size + this->memory.size());
-          for (triton::usize index = 0; index < size; index++) {
-            this->setConcreteMemoryValue(baseAddr+index, area[index]);
+          if (this->callbacks && this->callbacks->isDefined()) {
+            /* The area callbacks are called once, before the area is written */
+            this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_MEMORY_AREA_VALUE, baseAddr, area, size);
+
+            /* The callbacks are called on each byte, before it is written */
+            if (this->callbacks->isDefined(triton::callbacks::SET_CONCRETE_MEMORY_VALUE)) {
+              for (triton::usize index = 0; index < size; index++)
+                this->setConcreteMemoryValue(baseAddr+index, area[index]);
+              return;
+            }
           }
+
+          this->memory.write(baseAddr, area, size);
+        }
+
+
+        void Arm32Cpu::mapConcreteMemoryArea(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size, const std::shared_ptr<const void>& owner) {
+          if (this->callbacks && this->callbacks->isDefined()) {
+            /* The callbacks are called on each byte, the area is copied */
+            if (this->callbacks->isDefined(triton::callbacks::SET_CONCRETE_MEMORY_VALUE)) {
+              this->setConcreteMemoryAreaValue(baseAddr, area, size);
+              return;
+            }
+
+            /* The area callbacks are called once, before the area is mapped */
+            this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_MEMORY_AREA_VALUE, baseAddr, area, size);
+          }
+
+          this->memory.map(baseAddr, area, size, owner);
+        }
+
+
+        void Arm32Cpu::setConcreteMemoryPlacement(const triton::utils::MemoryPlacement& placement) {
+          this->memory.setPlacement(placement);
         }
 
 
@@ -696,7 +756,7 @@ namespace triton {
           if (value > reg.getMaxValue())
             throw triton::exceptions::Register("Arm32Cpu::setConcreteRegisterValue(): You cannot set this concrete value (too big) to this register.");
 
-          if (this->callbacks)
+          if (this->callbacks && this->callbacks->isDefined(triton::callbacks::SET_CONCRETE_REGISTER_VALUE))
             this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_REGISTER_VALUE, reg, value);
 
           switch (reg.getId()) {
@@ -767,6 +827,38 @@ namespace triton {
         }
 
 
+        triton::uint32 Arm32Cpu::getDecodingState(void) const {
+          /* Bit 0: Thumb mode */
+          triton::uint32 state = this->thumb ? 1 : 0;
+
+          /* Outside of an IT block, the decoding only depends on the mode */
+          if (this->itInstrsCount == 0)
+            return state;
+
+          /* Bits 1-3: remaining instructions, bits 4-6: index, bits 8-15: condition, bits 16-19: 't' slots */
+          state |= (this->itInstrsCount << 1) | (this->itInstrIndex << 4) | (static_cast<triton::uint32>(this->itCC) << 8);
+          for (triton::uint32 i = 0; i < this->itInstrIndex + this->itInstrsCount; i++) {
+            if (this->itStateArray[i] == 't')
+              state |= (1 << (16 + i));
+          }
+
+          return state;
+        }
+
+
+        void Arm32Cpu::setDecodingState(triton::uint32 state) {
+          this->thumb         = (state & 1);
+          this->itInstrsCount = (state >> 1) & 7;
+          this->itInstrIndex  = (state >> 4) & 7;
+          this->itCC          = static_cast<triton::arch::arm::condition_e>((state >> 8) & 0xff);
+          this->itCCInv       = this->invertCodeCondition(this->itCC);
+
+          std::memset(this->itStateArray, 0, sizeof(this->itStateArray));
+          for (triton::uint32 i = 0; i < this->itInstrIndex + this->itInstrsCount && i < 4; i++)
+            this->itStateArray[i] = ((state >> (16 + i)) & 1) ? 't' : 'e';
+        }
+
+
         bool Arm32Cpu::isMemoryExclusiveAccess(void) const {
           return this->exclusiveMemAcc;
         }
@@ -783,11 +875,7 @@ namespace triton {
 
 
         bool Arm32Cpu::isConcreteMemoryValueDefined(triton::uint64 baseAddr, triton::usize size) const {
-          for (triton::usize index = 0; index < size; index++) {
-            if (this->memory.find(baseAddr + index) == this->memory.end())
-              return false;
-          }
-          return true;
+          return this->memory.isDefined(baseAddr, size);
         }
 
 
@@ -797,11 +885,7 @@ namespace triton {
 
 
         void Arm32Cpu::clearConcreteMemoryValue(triton::uint64 baseAddr, triton::usize size) {
-          for (triton::usize index = 0; index < size; index++) {
-            if (this->memory.find(baseAddr + index) != this->memory.end()) {
-              this->memory.erase(baseAddr + index);
-            }
-          }
+          this->memory.erase(baseAddr, size);
         }
 
 
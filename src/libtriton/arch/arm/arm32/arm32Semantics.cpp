@@ -228,7 +228,29 @@ namespace triton {
             thenNode = this->clearISSB(opNode);
           }
 
-          return this->astCtxt->ite(condNode, thenNode, elseNode);
+          return this->astCtxt->iteFold(condNode, thenNode, elseNode);
+        }
+
+
+        inline std::vector<triton::ast::SharedAbstractNode> Arm32Semantics::buildConditionalStores(triton::arch::Instruction& inst,
+                                                                                                  const triton::ast::SharedAbstractNode& cond,
+                                                                                                  const std::vector<triton::ast::SharedAbstractNode>& ops,
+                                                                                                  triton::uint64 addr,
+                                                                                                  triton::uint32 size) {
+          /* The previous content is only read if the store may not happen */
+          if (!cond->isSymbolized() && cond->evaluate()) {
+            return ops;
+          }
+
+          auto olds = this->symbolicEngine->getMemoryAsts(inst, addr, size, ops.size());
+          std::vector<triton::ast::SharedAbstractNode> nodes;
+          nodes.reserve(ops.size());
+
+          for (triton::usize i = 0; i < ops.size(); i++) {
+            nodes.push_back(this->astCtxt->iteFold(cond, ops[i], olds[i]));
+          }
+
+          return nodes;
         }
 
 
@@ -350,7 +372,7 @@ namespace triton {
           auto op2 = this->astCtxt->bv(delta, dst.getBitSize());
 
           /* Create the semantics */
-          auto node = this->astCtxt->ite(
+          auto node = this->astCtxt->iteFold(
                         cond,
                         this->astCtxt->bvadd(op1, op2),
                         op1
@@ -375,7 +397,7 @@ namespace triton {
           auto op2 = this->astCtxt->bv(delta, dst.getBitSize());
 
           /* Create the semantics */
-          auto node = this->astCtxt->ite(
+          auto node = this->astCtxt->iteFold(
                         cond,
                         this->astCtxt->bvsub(op1, op2),
                         op1
@@ -688,7 +710,7 @@ namespace triton {
            */
           auto node1 = this->astCtxt->extract(high, high, this->astCtxt->reference(parent));
           auto node2 = this->symbolicEngine->getOperandAst(nf);
-          auto node3 = this->astCtxt->ite(cond, node1, node2);
+          auto node3 = this->astCtxt->iteFold(cond, node1, node2);
 
           /* Create the symbolic expression */
           auto expr = this->symbolicEngine->createSymbolicExpression(inst, node3, nf, "Negative flag");
@@ -721,7 +743,7 @@ namespace triton {
                          this->astCtxt->bv(0, 1)
                        );
           auto node2 = this->symbolicEngine->getOperandAst(zf);
-          auto node3 = this->astCtxt->ite(cond, node1, node2);
+          auto node3 = this->astCtxt->iteFold(cond, node1, node2);
 
           /* Create the symbolic expression */
           auto expr = this->symbolicEngine->createSymbolicExpression(inst, node3, zf, "Zero flag");
@@ -759,7 +781,7 @@ namespace triton {
                          )
                        );
           auto node2 = this->symbolicEngine->getOperandAst(cf);
-          auto node3 = this->astCtxt->ite(cond, node1, node2);
+          auto node3 = this->astCtxt->iteFold(cond, node1, node2);
 
           /* Create the symbolic expression */
           auto expr = this->symbolicEngine->createSymbolicExpression(inst, node3, cf, "Carry flag");
@@ -798,7 +820,7 @@ namespace triton {
                          this->astCtxt->bvtrue()
                        );
           auto node2 = this->symbolicEngine->getOperandAst(cf);
-          auto node3 = this->astCtxt->ite(cond, node1, node2);
+          auto node3 = this->astCtxt->iteFold(cond, node1, node2);
 
           /* Create the symbolic expression */
           auto expr = this->symbolicEngine->createSymbolicExpression(inst, node3, cf, "Carry flag");
@@ -824,7 +846,7 @@ namespace triton {
            */
           auto node1 = this->astCtxt->extract(high, high, this->astCtxt->reference(parent2));
           auto node2 = this->symbolicEngine->getOperandAst(nf);
-          auto node3 = this->astCtxt->ite(cond, node1, node2);
+          auto node3 = this->astCtxt->iteFold(cond, node1, node2);
 
           /* Create the symbolic expression */
           auto expr = this->symbolicEngine->createSymbolicExpression(inst, node3, nf, "Negative flag");
@@ -865,7 +887,7 @@ namespace triton {
                          this->astCtxt->bv(0, 1)
                        );
           auto node2 = this->symbolicEngine->getOperandAst(zf);
-          auto node3 = this->astCtxt->ite(cond, node1, node2);
+          auto node3 = this->astCtxt->iteFold(cond, node1, node2);
 
           /* Create the symbolic expression */
           auto expr = this->symbolicEngine->createSymbolicExpression(inst, node3, zf, "Zero flag");
@@ -898,7 +920,7 @@ namespace triton {
                          )
                        );
           auto node2 = this->symbolicEngine->getOperandAst(vf);
-          auto node3 = this->astCtxt->ite(cond, node1, node2);
+          auto node3 = this->astCtxt->iteFold(cond, node1, node2);
 
           /* Create the symbolic expression */
           auto expr = this->symbolicEngine->createSymbolicExpression(inst, node3, vf, "Overflow flag");
@@ -931,7 +953,7 @@ namespace triton {
                          )
                        );
           auto node2 = this->symbolicEngine->getOperandAst(vf);
-          auto node3 = this->astCtxt->ite(cond, node1, node2);
+          auto node3 = this->astCtxt->iteFold(cond, node1, node2);
 
           /* Create the symbolic expression */
           auto expr = this->symbolicEngine->createSymbolicExpression(inst, node3, vf, "Overflow flag");
@@ -1806,15 +1828,16 @@ namespace triton {
 
           bool updateControlFlow = true;
 
+          /* The registers are loaded from one range */
+          auto address = baseNode->evaluate().convert_to<triton::uint64>();
+          auto loads   = this->symbolicEngine->getMemoryAsts(inst, address, size, inst.operands.size() - 1);
+
           for (unsigned int i = 1; i < inst.operands.size(); i++) {
             auto& dst = inst.operands[i];
-
-            /* Compute memory address */
-            auto addr = baseNode->evaluate().convert_to<triton::uint64>() + size * (i-1);
-            auto src  = triton::arch::OperandWrapper(triton::arch::MemoryAccess(addr, size));
+            auto  src = triton::arch::OperandWrapper(triton::arch::MemoryAccess(address + size * (i-1), size));
 
             /* Create symbolic operands */
-            auto op2 = this->getArm32SourceOperandAst(inst, src);
+            auto op2 = loads[i-1];
             auto op3 = this->getArm32SourceOperandAst(inst, dst);
 
             /* Create the semantics */
@@ -1828,7 +1851,7 @@ namespace triton {
               node1 = this->clearISSB(op2);
             }
 
-            auto node2 = this->astCtxt->ite(cond, node1, op3);
+            auto node2 = this->astCtxt->iteFold(cond, node1, op3);
 
             /* Create symbolic expression */
             auto expr1 = this->symbolicEngine->createSymbolicExpression(inst, node2, dst, "LDM operation - LOAD access");
@@ -1849,7 +1872,7 @@ namespace triton {
 
           if (inst.isWriteBack() == true) {
             /* Create the semantics of the base register */
-            auto node1 = this->astCtxt->ite(
+            auto node1 = this->astCtxt->iteFold(
                            cond,
                            this->astCtxt->bvadd(
                              baseNode,
@@ -1917,7 +1940,7 @@ namespace triton {
                 thenNode = this->astCtxt->bvsub(baseNode, this->astCtxt->sx(base.getBitSize() - imm.getBitSize(), immNode));
               }
 
-              auto node2 = this->astCtxt->ite(cond, thenNode, baseNode);
+              auto node2 = this->astCtxt->iteFold(cond, thenNode, baseNode);
 
               /* Create symbolic expression */
               auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, node2, base, "LDR operation - Post-indexed base register computation");
@@ -1939,7 +1962,7 @@ namespace triton {
                 thenNode = this->astCtxt->bvsub(baseNode, regNode);
               }
 
-              auto node2 = this->astCtxt->ite(cond, thenNode, baseNode);
+              auto node2 = this->astCtxt->iteFold(cond, thenNode, baseNode);
 
               /* Create symbolic expression */
               auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, node2, base, "LDR operation - Post-indexed base register computation");
@@ -1958,7 +1981,7 @@ namespace triton {
             auto baseNode = this->symbolicEngine->getOperandAst(inst, base);
 
             /* Create the semantics of the base register */
-            auto node3 = this->astCtxt->ite(cond, src.getMemory().getLeaAst(), baseNode);
+            auto node3 = this->astCtxt->iteFold(cond, src.getMemory().getLeaAst(), baseNode);
 
             /* Create symbolic expression */
             auto expr3 = this->symbolicEngine->createSymbolicExpression(inst, node3, base, "LDR operation - Pre-indexed base register computation");
@@ -2024,7 +2047,7 @@ namespace triton {
                 thenNode = this->astCtxt->bvsub(baseNode, this->astCtxt->sx(base.getBitSize() - imm.getBitSize(), immNode));
               }
 
-              auto node2 = this->astCtxt->ite(cond, thenNode, baseNode);
+              auto node2 = this->astCtxt->iteFold(cond, thenNode, baseNode);
 
               /* Create symbolic expression */
               auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, node2, base, "LDRB operation - Post-indexed base register computation");
@@ -2046,7 +2069,7 @@ namespace triton {
                 thenNode = this->astCtxt->bvsub(baseNode, regNode);
               }
 
-              auto node2 = this->astCtxt->ite(cond, thenNode, baseNode);
+              auto node2 = this->astCtxt->iteFold(cond, thenNode, baseNode);
 
               /* Create symbolic expression */
               auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, node2, base, "LDRB operation - Post-indexed base register computation");
@@ -2065,7 +2088,7 @@ namespace triton {
             auto baseNode = this->symbolicEngine->getOperandAst(inst, base);
 
             /* Create the semantics of the base register */
-            auto node3 = this->astCtxt->ite(cond, src.getMemory().getLeaAst(), baseNode);
+            auto node3 = this->astCtxt->iteFold(cond, src.getMemory().getLeaAst(), baseNode);
 
             /* Create symbolic expression */
             auto expr3 = this->symbolicEngine->createSymbolicExpression(inst, node3, base, "LDRB operation - Pre-indexed base register computation");
@@ -2131,7 +2154,7 @@ namespace triton {
                 thenNode = this->astCtxt->bvsub(baseNode, this->astCtxt->sx(base.getBitSize() - imm.getBitSize(), immNode));
               }
 
-              auto node2 = this->astCtxt->ite(cond, thenNode, baseNode);
+              auto node2 = this->astCtxt->iteFold(cond, thenNode, baseNode);
 
               /* Create symbolic expression */
               auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, node2, base, "LDRH operation - Post-indexed base register computation");
@@ -2153,7 +2176,7 @@ namespace triton {
                 thenNode = this->astCtxt->bvsub(baseNode, regNode);
               }
 
-              auto node2 = this->astCtxt->ite(cond, thenNode, baseNode);
+              auto node2 = this->astCtxt->iteFold(cond, thenNode, baseNode);
 
               /* Create symbolic expression */
               auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, node2, base, "LDRH operation - Post-indexed base register computation");
@@ -2172,7 +2195,7 @@ namespace triton {
             auto baseNode = this->symbolicEngine->getOperandAst(inst, base);
 
             /* Create the semantics of the base register */
-            auto node3 = this->astCtxt->ite(cond, src.getMemory().getLeaAst(), baseNode);
+            auto node3 = this->astCtxt->iteFold(cond, src.getMemory().getLeaAst(), baseNode);
 
             /* Create symbolic expression */
             auto expr3 = this->symbolicEngine->createSymbolicExpression(inst, node3, base, "LDRH operation - Pre-indexed base register computation");
@@ -2238,7 +2261,7 @@ namespace triton {
                 thenNode = this->astCtxt->bvsub(baseNode, this->astCtxt->sx(base.getBitSize() - imm.getBitSize(), immNode));
               }
 
-              auto node2 = this->astCtxt->ite(cond, thenNode, baseNode);
+              auto node2 = this->astCtxt->iteFold(cond, thenNode, baseNode);
 
               /* Create symbolic expression */
               auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, node2, base, "LDRSB operation - Post-indexed base register computation");
@@ -2260,7 +2283,7 @@ namespace triton {
                 thenNode = this->astCtxt->bvsub(baseNode, regNode);
               }
 
-              auto node2 = this->astCtxt->ite(cond, thenNode, baseNode);
+              auto node2 = this->astCtxt->iteFold(cond, thenNode, baseNode);
 
               /* Create symbolic expression */
               auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, node2, base, "LDRSB operation - Post-indexed base register computation");
@@ -2279,7 +2302,7 @@ namespace triton {
             auto baseNode = this->symbolicEngine->getOperandAst(inst, base);
 
             /* Create the semantics of the base register */
-            auto node3 = this->astCtxt->ite(cond, src.getMemory().getLeaAst(), baseNode);
+            auto node3 = this->astCtxt->iteFold(cond, src.getMemory().getLeaAst(), baseNode);
 
             /* Create symbolic expression */
             auto expr3 = this->symbolicEngine->createSymbolicExpression(inst, node3, base, "LDRB operation - Pre-indexed base register computation");
@@ -2322,8 +2345,8 @@ namespace triton {
 
           /* Create the semantics */
           auto cond  = this->getCodeConditionAst(inst);
-          auto node1 = this->astCtxt->ite(cond, op1, op2);
-          auto node2 = this->astCtxt->ite(cond, op3, op4);
+          auto node1 = this->astCtxt->iteFold(cond, op1, op2);
+          auto node2 = this->astCtxt->iteFold(cond, op3, op4);
 
           /* Create symbolic expression */
           auto expr1 = this->symbolicEngine->createSymbolicExpression(inst, node1, dst1, "LDRD operation - LOAD access");
@@ -2347,13 +2370,13 @@ namespace triton {
             triton::ast::SharedAbstractNode node2;
 
             if(imm.isSubtracted()) {
-              node2 = this->astCtxt->ite(
+              node2 = this->astCtxt->iteFold(
                             cond,
                             this->astCtxt->bvsub(baseNode, this->astCtxt->sx(base.getBitSize() - imm.getBitSize(), immNode)),
                             baseNode
                           );
             } else {
-              node2 = this->astCtxt->ite(
+              node2 = this->astCtxt->iteFold(
                             cond,
                             this->astCtxt->bvadd(baseNode, this->astCtxt->sx(base.getBitSize() - imm.getBitSize(), immNode)),
                             baseNode
@@ -2376,7 +2399,7 @@ namespace triton {
             auto baseNode = this->symbolicEngine->getOperandAst(inst, base);
 
             /* Create the semantics of the base register */
-            auto node3 = this->astCtxt->ite(cond, inst.operands[2].getMemory().getLeaAst(), baseNode);
+            auto node3 = this->astCtxt->iteFold(cond, inst.operands[2].getMemory().getLeaAst(), baseNode);
 
             /* Create symbolic expression */
             auto expr3 = this->symbolicEngine->createSymbolicExpression(inst, node3, base, "LDRD operation - Pre-indexed base register computation");
@@ -2482,7 +2505,7 @@ namespace triton {
                 thenNode = this->astCtxt->bvsub(baseNode, this->astCtxt->sx(base.getBitSize() - imm.getBitSize(), immNode));
               }
 
-              auto node2 = this->astCtxt->ite(cond, thenNode, baseNode);
+              auto node2 = this->astCtxt->iteFold(cond, thenNode, baseNode);
 
               /* Create symbolic expression */
               auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, node2, base, "LDRSH operation - Post-indexed base register computation");
@@ -2504,7 +2527,7 @@ namespace triton {
                 thenNode = this->astCtxt->bvsub(baseNode, regNode);
               }
 
-              auto node2 = this->astCtxt->ite(cond, thenNode, baseNode);
+              auto node2 = this->astCtxt->iteFold(cond, thenNode, baseNode);
 
               /* Create symbolic expression */
               auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, node2, base, "LDRSH operation - Post-indexed base register computation");
@@ -2523,7 +2546,7 @@ namespace triton {
             auto baseNode = this->symbolicEngine->getOperandAst(inst, base);
 
             /* Create the semantics of the base register */
-            auto node3 = this->astCtxt->ite(cond, src.getMemory().getLeaAst(), baseNode);
+            auto node3 = this->astCtxt->iteFold(cond, src.getMemory().getLeaAst(), baseNode);
 
             /* Create symbolic expression */
             auto expr3 = this->symbolicEngine->createSymbolicExpression(inst, node3, base, "LDRB operation - Pre-indexed base register computation");
@@ -3064,15 +3087,17 @@ namespace triton {
 
           bool updateControlFlow = true;
 
+          /* The registers are popped from one range */
+          auto stackValue = this->architecture->getConcreteRegisterValue64(stack);
+          auto loads      = this->symbolicEngine->getMemoryAsts(inst, stackValue, size, inst.operands.size());
+
           for (uint8_t i = 0; i < inst.operands.size(); i++) {
-            auto& dst        = inst.operands[i];
-            auto  stack      = this->architecture->getStackPointer();
-            auto  stackValue = this->architecture->getConcreteRegisterValue(stack).convert_to<triton::uint64>();
-            auto  src        = triton::arch::OperandWrapper(triton::arch::MemoryAccess(stackValue, size));
+            auto& dst = inst.operands[i];
+            auto  src = triton::arch::OperandWrapper(triton::arch::MemoryAccess(stackValue + size * i, size));
 
             /* Create symbolic operands */
             auto op1 = this->getArm32SourceOperandAst(inst, dst);
-            auto op2 = this->getArm32SourceOperandAst(inst, src);
+            auto op2 = loads[i];
 
             /* Create the semantics */
             auto node1 = op2;
@@ -3085,7 +3110,7 @@ namespace triton {
               node1 = this->clearISSB(op2);
             }
 
-            auto node2 = this->astCtxt->ite(cond, node1, op1);
+            auto node2 = this->astCtxt->iteFold(cond, node1, op1);
 
             /* Create symbolic expression */
             auto expr = this->symbolicEngine->createSymbolicExpression(inst, node2, dst, "POP operation - Pop register");
@@ -3093,9 +3118,6 @@ namespace triton {
             /* Spread taint */
             this->spreadTaint(inst, cond, expr, dst, this->taintEngine->isTainted(src));
 
-            /* Align stack */
-            alignAddStack_s(inst, cond, size);
-
             /* If PC was modified, do not update the control flow at the end of
              * the function.
              */
@@ -3107,6 +3129,9 @@ namespace triton {
             }
           }
 
+          /* Align stack */
+          alignAddStack_s(inst, cond, size * inst.operands.size());
+
           /* Update the symbolic control flow */
           if (updateControlFlow) {
             this->controlFlow_s(inst);
@@ -3122,24 +3147,24 @@ namespace triton {
           /* Create the semantics */
           auto cond = this->getCodeConditionAst(inst);
 
+          /* Create symbolic operands */
+          std::vector<triton::ast::SharedAbstractNode> ops;
           for (triton::uint32 i = 0; i <= nuop; i++) {
-            auto& src = inst.operands[nuop - i];
-
-            /* Create symbolic operands */
-            auto op = this->getArm32SourceOperandAst(inst, src);
+            ops.push_back(this->getArm32SourceOperandAst(inst, inst.operands[i]));
+          }
 
-            /* Create the semantics - side effect */
-            auto stackValue = alignSubStack_s(inst, cond, size);
-            auto dst        = triton::arch::OperandWrapper(triton::arch::MemoryAccess(stackValue, size));
+          /* Create the semantics - side effect */
+          auto stackValue = alignSubStack_s(inst, cond, size * (nuop + 1));
 
-            /* Create the semantics */
-            auto node = this->astCtxt->ite(cond, op, this->astCtxt->bv(stackValue, op->getBitvectorSize()));
+          /* The registers are pushed as one range, the lowest one at the lowest address */
+          auto nodes = this->buildConditionalStores(inst, cond, ops, stackValue, size);
+          auto exprs = this->symbolicEngine->createSymbolicMemoryExpressions(inst, nodes, stackValue, "PUSH operation - Push register");
 
-            /* Create symbolic expression */
-            auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PUSH operation - Push register");
+          for (triton::uint32 i = 0; i <= nuop; i++) {
+            auto dst = triton::arch::OperandWrapper(triton::arch::MemoryAccess(stackValue + size * i, size));
 
             /* Spread taint */
-            this->spreadTaint(inst, cond, expr, dst, this->taintEngine->isTainted(src));
+            this->spreadTaint(inst, cond, exprs[i], dst, this->taintEngine->isTainted(inst.operands[i]));
           }
 
           /* Update the symbolic control flow */
@@ -3841,8 +3866,8 @@ namespace triton {
                        );
           auto lower = this->astCtxt->extract(triton::bitsize::dword-1, 0, mul);
           auto upper = this->astCtxt->extract(triton::bitsize::qword-1, triton::bitsize::dword, mul);
-          auto node1 = this->astCtxt->ite(cond, lower, this->symbolicEngine->getOperandAst(inst, dst1));
-          auto node2 = this->astCtxt->ite(cond, upper, this->symbolicEngine->getOperandAst(inst, dst2));
+          auto node1 = this->astCtxt->iteFold(cond, lower, this->symbolicEngine->getOperandAst(inst, dst1));
+          auto node2 = this->astCtxt->iteFold(cond, upper, this->symbolicEngine->getOperandAst(inst, dst2));
 
           /* Create symbolic expression */
           auto expr1 = this->symbolicEngine->createSymbolicExpression(inst, node1, dst1, "SMULL(S) operation - Lower 32 bits of the result.");
@@ -3888,30 +3913,28 @@ namespace triton {
           /* Create the semantics */
           auto cond = this->getCodeConditionAst(inst);
 
+          /* Create symbolic operands */
+          std::vector<triton::ast::SharedAbstractNode> ops;
           for (unsigned int i = 1; i < inst.operands.size(); i++) {
-            auto& src = inst.operands[i];
-
-            /* Compute memory address */
-            auto addr = baseNode->evaluate().convert_to<triton::uint64>() + size * (i-1);
-            auto dst  = triton::arch::OperandWrapper(triton::arch::MemoryAccess(addr, size));
-
-            /* Create symbolic operands */
-            auto op2 = this->symbolicEngine->getOperandAst(inst, src);
-            auto op3 = this->symbolicEngine->getOperandAst(inst, dst);
+            ops.push_back(this->symbolicEngine->getOperandAst(inst, inst.operands[i]));
+          }
 
-            /* Create the semantics */
-            auto node = this->astCtxt->ite(cond, op2, op3);
+          /* The registers are stored as one range */
+          auto address = baseNode->evaluate().convert_to<triton::uint64>();
+          auto nodes   = this->buildConditionalStores(inst, cond, ops, address, size);
+          auto exprs   = this->symbolicEngine->createSymbolicMemoryExpressions(inst, nodes, address, "STM operation - STORE access");
 
-            /* Create symbolic expression */
-            auto expr1 = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "STM operation - STORE access");
+          for (unsigned int i = 1; i < inst.operands.size(); i++) {
+            auto& src = inst.operands[i];
+            auto  dst = triton::arch::OperandWrapper(triton::arch::MemoryAccess(address + size * (i-1), size));
 
             /* Spread taint */
-            this->spreadTaint(inst, cond, expr1, dst, this->taintEngine->isTainted(base) | this->taintEngine->isTainted(src));
+            this->spreadTaint(inst, cond, exprs[i-1], dst, this->taintEngine->isTainted(base) | this->taintEngine->isTainted(src));
           }
 
           if (inst.isWriteBack() == true) {
             /* Create the semantics of the base register */
-            auto node = this->astCtxt->ite(
+            auto node = this->astCtxt->iteFold(
                           cond,
                           this->astCtxt->bvadd(
                             baseNode,
@@ -3947,30 +3970,28 @@ namespace triton {
           /* Create the semantics */
           auto cond = this->getCodeConditionAst(inst);
 
+          /* Create symbolic operands */
+          std::vector<triton::ast::SharedAbstractNode> ops;
           for (unsigned int i = 1; i < inst.operands.size(); i++) {
-            auto& src = inst.operands[i];
-
-            /* Compute memory address */
-            auto addr = baseNode->evaluate().convert_to<triton::uint64>() + size * i;
-            auto dst  = triton::arch::OperandWrapper(triton::arch::MemoryAccess(addr, size));
-
-            /* Create symbolic operands */
-            auto op2 = this->symbolicEngine->getOperandAst(inst, src);
-            auto op3 = this->symbolicEngine->getOperandAst(inst, dst);
+            ops.push_back(this->symbolicEngine->getOperandAst(inst, inst.operands[i]));
+          }
 
-            /* Create the semantics */
-            auto node = this->astCtxt->ite(cond, op2, op3);
+          /* The registers are stored as one range */
+          auto address = baseNode->evaluate().convert_to<triton::uint64>() + size;
+          auto nodes   = this->buildConditionalStores(inst, cond, ops, address, size);
+          auto exprs   = this->symbolicEngine->createSymbolicMemoryExpressions(inst, nodes, address, "STMIB operation - STORE access");
 
-            /* Create symbolic expression */
-            auto expr1 = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "STMIB operation - STORE access");
+          for (unsigned int i = 1; i < inst.operands.size(); i++) {
+            auto& src = inst.operands[i];
+            auto  dst = triton::arch::OperandWrapper(triton::arch::MemoryAccess(address + size * (i-1), size));
 
             /* Spread taint */
-            this->spreadTaint(inst, cond, expr1, dst, this->taintEngine->isTainted(base) | this->taintEngine->isTainted(src));
+            this->spreadTaint(inst, cond, exprs[i-1], dst, this->taintEngine->isTainted(base) | this->taintEngine->isTainted(src));
           }
 
           if (inst.isWriteBack() == true) {
             /* Create the semantics of the base register */
-            auto node1 = this->astCtxt->ite(
+            auto node1 = this->astCtxt->iteFold(
                            cond,
                            this->astCtxt->bvadd(
                              baseNode,
@@ -4032,7 +4053,7 @@ namespace triton {
               thenNode = this->astCtxt->bvsub(baseNode, this->astCtxt->sx(base.getBitSize() - imm.getBitSize(), immNode));
             }
 
-            auto node2 = this->astCtxt->ite(cond, thenNode, baseNode);
+            auto node2 = this->astCtxt->iteFold(cond, thenNode, baseNode);
 
             /* Create symbolic expression */
             auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, node2, base, "STR operation - Base register computation");
@@ -4050,7 +4071,7 @@ namespace triton {
             auto baseNode = this->symbolicEngine->getOperandAst(inst, base);
 
             /* Create the semantics of the base register */
-            auto node3 = this->astCtxt->ite(cond, dst.getMemory().getLeaAst(), baseNode);
+            auto node3 = this->astCtxt->iteFold(cond, dst.getMemory().getLeaAst(), baseNode);
 
             /* Create symbolic expression */
             auto expr3 = this->symbolicEngine->createSymbolicExpression(inst, node3, base, "STR operation - Base register computation");
@@ -4109,7 +4130,7 @@ namespace triton {
               thenNode = this->astCtxt->bvsub(baseNode, this->astCtxt->sx(base.getBitSize() - imm.getBitSize(), immNode));
             }
 
-            auto node2 = this->astCtxt->ite(cond, thenNode, baseNode);
+            auto node2 = this->astCtxt->iteFold(cond, thenNode, baseNode);
 
             /* Create symbolic expression */
             auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, node2, base, "STRB operation - Base register computation");
@@ -4127,7 +4148,7 @@ namespace triton {
             auto baseNode = this->symbolicEngine->getOperandAst(inst, base);
 
             /* Create the semantics of the base register */
-            auto node3 = this->astCtxt->ite(cond, dst.getMemory().getLeaAst(), baseNode);
+            auto node3 = this->astCtxt->iteFold(cond, dst.getMemory().getLeaAst(), baseNode);
 
             /* Create symbolic expression */
             auto expr3 = this->symbolicEngine->createSymbolicExpression(inst, node3, base, "STRB operation - Base register computation");
@@ -4165,7 +4186,7 @@ namespace triton {
             auto op3 = this->symbolicEngine->getOperandAst(inst, dst);
 
             /* Create the semantics */
-            auto node = this->astCtxt->ite(cond, op2, op3);
+            auto node = this->astCtxt->iteFold(cond, op2, op3);
 
             /* Create symbolic expression */
             auto expr1 = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "STRD operation - STORE access");
@@ -4195,7 +4216,7 @@ namespace triton {
                 thenNode = this->astCtxt->bvsub(baseNode, this->astCtxt->sx(base.getBitSize() - imm.getBitSize(), immNode));
               }
 
-              auto node2 = this->astCtxt->ite(cond, thenNode, baseNode);
+              auto node2 = this->astCtxt->iteFold(cond, thenNode, baseNode);
 
               /* Create symbolic expression */
               auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, node2, base, "STRD operation - Base register computation");
@@ -4217,7 +4238,7 @@ namespace triton {
                 thenNode = this->astCtxt->bvsub(baseNode, regNode);
               }
 
-              auto node2 = this->astCtxt->ite(cond, thenNode, baseNode);
+              auto node2 = this->astCtxt->iteFold(cond, thenNode, baseNode);
 
               /* Create symbolic expression */
               auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, node2, base, "STRD operation - Base register computation");
@@ -4236,7 +4257,7 @@ namespace triton {
             auto baseNode = this->symbolicEngine->getOperandAst(inst, base);
 
             /* Create the semantics of the base register */
-            auto node3 = this->astCtxt->ite(cond, inst.operands[2].getMemory().getLeaAst(), baseNode);
+            auto node3 = this->astCtxt->iteFold(cond, inst.operands[2].getMemory().getLeaAst(), baseNode);
 
             /* Create symbolic expression */
             auto expr3 = this->symbolicEngine->createSymbolicExpression(inst, node3, base, "STRD operation - Base register computation");
@@ -4275,10 +4296,10 @@ namespace triton {
 
           /* Create the semantics */
           auto cond  = this->getCodeConditionAst(inst);
-          auto node1 = this->astCtxt->ite(cond, status, this->symbolicEngine->getOperandAst(inst, dst1));
+          auto node1 = this->astCtxt->iteFold(cond, status, this->symbolicEngine->getOperandAst(inst, dst1));
           auto node2 = this->architecture->isMemoryExclusiveAccess() == true ?
-                          this->astCtxt->ite(cond, op1, op2) :
-                          this->astCtxt->ite(cond, op2, op2);
+                          this->astCtxt->iteFold(cond, op1, op2) :
+                          this->astCtxt->iteFold(cond, op2, op2);
 
           /* Create symbolic expression */
           auto expr1 = this->symbolicEngine->createSymbolicExpression(inst, node1, dst1, "STREX operation - STATUS update");
@@ -4341,7 +4362,7 @@ namespace triton {
                 thenNode = this->astCtxt->bvsub(baseNode, this->astCtxt->sx(base.getBitSize() - imm.getBitSize(), immNode));
               }
 
-              auto node2 = this->astCtxt->ite(cond, thenNode, baseNode);
+              auto node2 = this->astCtxt->iteFold(cond, thenNode, baseNode);
 
               /* Create symbolic expression */
               auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, node2, base, "STRH operation - Base register computation");
@@ -4363,7 +4384,7 @@ namespace triton {
                 thenNode = this->astCtxt->bvsub(baseNode, regNode);
               }
 
-              auto node2 = this->astCtxt->ite(cond, thenNode, baseNode);
+              auto node2 = this->astCtxt->iteFold(cond, thenNode, baseNode);
 
               /* Create symbolic expression */
               auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, node2, base, "STRH operation - Base register computation");
@@ -4382,7 +4403,7 @@ namespace triton {
             auto baseNode = this->symbolicEngine->getOperandAst(inst, base);
 
             /* Create the semantics of the base register */
-            auto node3 = this->astCtxt->ite(cond, dst.getMemory().getLeaAst(), baseNode);
+            auto node3 = this->astCtxt->iteFold(cond, dst.getMemory().getLeaAst(), baseNode);
 
             /* Create symbolic expression */
             auto expr3 = this->symbolicEngine->createSymbolicExpression(inst, node3, base, "STRH operation - Base register computation");
@@ -4673,8 +4694,8 @@ namespace triton {
                        );
           auto lower = this->astCtxt->extract(triton::bitsize::dword-1, 0, mul);
           auto upper = this->astCtxt->extract(triton::bitsize::qword-1, triton::bitsize::dword, mul);
-          auto node1 = this->astCtxt->ite(cond, lower, this->symbolicEngine->getOperandAst(inst, dst1));
-          auto node2 = this->astCtxt->ite(cond, upper, this->symbolicEngine->getOperandAst(inst, dst2));
+          auto node1 = this->astCtxt->iteFold(cond, lower, this->symbolicEngine->getOperandAst(inst, dst1));
+          auto node2 = this->astCtxt->iteFold(cond, upper, this->symbolicEngine->getOperandAst(inst, dst2));
 
           /* Create symbolic expression */
           auto expr1 = this->symbolicEngine->createSymbolicExpression(inst, node1, dst1, "UMULL(S) operation - Lower 32 bits of the result.");
@@ -4840,7 +4861,7 @@ namespace triton {
           /* Create the semantics */
           auto node1 = this->getShiftCAst(node, shiftType, shiftAmount);
           auto node2 = this->symbolicEngine->getOperandAst(cf);
-          auto node3 = this->astCtxt->ite(cond, node1, node2);
+          auto node3 = this->astCtxt->iteFold(cond, node1, node2);
 
           /* Create symbolic expression */
           auto expr = this->symbolicEngine->createSymbolicExpression(inst, node3, cf, "Carry flag");
@@ -4927,7 +4948,7 @@ namespace triton {
           /* Create the semantics */
           auto node1 = this->getShiftCAst(op1, shiftType, shiftAmount);
           auto node2 = this->symbolicEngine->getOperandAst(cf);
-          auto node3 = this->astCtxt->ite(cond, node1, node2);
+          auto node3 = this->astCtxt->iteFold(cond, node1, node2);
 
           /* Create symbolic expression */
           auto expr = this->symbolicEngine->createSymbolicExpression(inst, node3, cf, "Carry flag");
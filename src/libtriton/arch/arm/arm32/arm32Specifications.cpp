@@ -18,10 +18,24 @@ namespace triton {
     namespace arm {
       namespace arm32 {
 
-        Arm32Specifications::Arm32Specifications(triton::arch::architecture_e arch) {
+        Arm32Specifications::Arm32Specifications(triton::arch::architecture_e arch)
+          : id2reg(getRegisterTable(arch).id2reg),
+            name2id(getRegisterTable(arch).name2id),
+            regIndex(getRegisterTable(arch).regIndex) {
+        }
+
+
+        const Arm32Specifications::RegisterTable& Arm32Specifications::getRegisterTable(triton::arch::architecture_e arch) {
           if (arch != triton::arch::ARCH_ARM32)
               throw triton::exceptions::Architecture("ARM32Specifications::ARM32Specifications(): Invalid architecture.");
 
+          /* The table is immutable, the contexts of this architecture share it */
+          static const RegisterTable arm32(arch);
+          return arm32;
+        }
+
+
+        Arm32Specifications::RegisterTable::RegisterTable(triton::arch::architecture_e arch) {
             // Fill id2reg and name2id with those available in Arm32 from spec
             #define REG_SPEC(UPPER_NAME, LOWER_NAME, ARM32_UPPER, ARM32_LOWER, ARM32_PARENT, MUTABLE) \
               id2reg.emplace(ID_REG_ARM32_##UPPER_NAME,                                               \
@@ -36,6 +50,11 @@ namespace triton {
             // Handle register not available in capstone as normal registers
             #define REG_SPEC_NO_CAPSTONE REG_SPEC
             #include "triton/arm32.spec"
+
+          /* Index the registers by id, a lookup is done for each register access */
+          this->regIndex.fill(nullptr);
+          for (const auto& kv : this->id2reg)
+            this->regIndex[kv.first] = &kv.second;
         }
 
 
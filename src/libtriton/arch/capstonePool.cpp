@@ -0,0 +1,100 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <map>
+#include <tuple>
+
+#include <triton/capstonePool.hpp>
+#include <triton/exceptions.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+
+    CapstonePool::CapstonePool(triton::extlibs::capstone::cs_arch arch, triton::extlibs::capstone::cs_mode mode, triton::usize syntax) {
+      this->arch   = arch;
+      this->mode   = mode;
+      this->syntax = syntax;
+      this->idle.push_back(this->open());
+    }
+
+
+    CapstonePool::~CapstonePool() {
+      for (auto& entry : this->idle) {
+        triton::extlibs::capstone::cs_free(entry.second, 1);
+        triton::extlibs::capstone::cs_close(&entry.first);
+      }
+    }
+
+
+    std::shared_ptr<CapstonePool> CapstonePool::get(triton::extlibs::capstone::cs_arch arch, triton::extlibs::capstone::cs_mode mode, triton::usize syntax) {
+      using Key = std::tuple<triton::extlibs::capstone::cs_arch, triton::extlibs::capstone::cs_mode, triton::usize>;
+
+      /* The handles only depend on their configuration, the contexts of a process share them */
+      static std::mutex lock;
+      static std::map<Key, std::weak_ptr<CapstonePool>> pools;
+
+      std::lock_guard<std::mutex> guard(lock);
+      std::weak_ptr<CapstonePool>& entry = pools[Key(arch, mode, syntax)];
+
+      std::shared_ptr<CapstonePool> pool = entry.lock();
+      if (pool == nullptr) {
+        pool  = std::make_shared<CapstonePool>(arch, mode, syntax);
+        entry = pool;
+      }
+
+      return pool;
+    }
+
+
+    std::pair<triton::extlibs::capstone::csh, triton::extlibs::capstone::cs_insn*> CapstonePool::open(void) const {
+      triton::extlibs::capstone::csh handle = 0;
+
+      if (triton::extlibs::capstone::cs_open(this->arch, this->mode, &handle) != triton::extlibs::capstone::CS_ERR_OK)
+        throw triton::exceptions::Disassembly("CapstonePool::open(): Cannot open capstone.");
+
+      triton::extlibs::capstone::cs_option(handle, triton::extlibs::capstone::CS_OPT_DETAIL, triton::extlibs::capstone::CS_OPT_ON);
+      if (this->syntax)
+        triton::extlibs::capstone::cs_option(handle, triton::extlibs::capstone::CS_OPT_SYNTAX, this->syntax);
+
+      /* The buffer, with its details, is reused by every decoding of the handle */
+      triton::extlibs::capstone::cs_insn* insn = triton::extlibs::capstone::cs_malloc(handle);
+      if (insn == nullptr) {
+        triton::extlibs::capstone::cs_close(&handle);
+        throw triton::exceptions::Disassembly("CapstonePool::open(): Not enough memory.");
+      }
+
+      return std::make_pair(handle, insn);
+    }
+
+
+    CapstonePool::Lease::Lease(CapstonePool& pool) : pool(pool) {
+      {
+        std::lock_guard<std::mutex> guard(pool.lock);
+        if (!pool.idle.empty()) {
+          this->handle = pool.idle.back().first;
+          this->insn   = pool.idle.back().second;
+          pool.idle.pop_back();
+          return;
+        }
+      }
+
+      /* All handles are leased, another thread is decoding */
+      auto entry   = pool.open();
+      this->handle = entry.first;
+      this->insn   = entry.second;
+    }
+
+
+    CapstonePool::Lease::~Lease() {
+      std::lock_guard<std::mutex> guard(this->pool.lock);
+      this->pool.idle.push_back(std::make_pair(this->handle, this->insn));
+    }
+
+  }; /* arch namespace */
+}; /* triton namespace */
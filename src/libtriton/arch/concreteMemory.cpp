@@ -0,0 +1,415 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+#include <triton/concreteMemory.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+
+    ConcreteMemory::ConcreteMemory() {
+      this->count = 0;
+    }
+
+
+    ConcreteMemory::ConcreteMemory(const ConcreteMemory& other) {
+      *this = other;
+    }
+
+
+    ConcreteMemory& ConcreteMemory::operator=(const ConcreteMemory& other) {
+      this->pages   = other.pages;
+      this->regions = other.regions;
+      this->count   = other.count;
+      this->setPlacement(other.getPlacement());
+      return *this;
+    }
+
+
+    void ConcreteMemory::setPlacement(const triton::utils::MemoryPlacement& placement) {
+      /* The pages already allocated keep their slabs alive */
+      if (placement.isDefault()) {
+        this->pool = nullptr;
+      }
+      else {
+        this->pool = std::make_shared<triton::ast::NodePool>();
+        this->pool->setPlacement(placement);
+      }
+    }
+
+
+    triton::utils::MemoryPlacement ConcreteMemory::getPlacement(void) const {
+      if (this->pool == nullptr)
+        return triton::utils::MemoryPlacement();
+      return this->pool->getPlacement();
+    }
+
+
+    std::shared_ptr<ConcreteMemory::Page> ConcreteMemory::newPage(const Page* other) const {
+      if (this->pool == nullptr)
+        return (other != nullptr) ? std::make_shared<Page>(*other) : std::make_shared<Page>();
+
+      triton::ast::NodeAllocator<Page> allocator(this->pool);
+      return (other != nullptr) ? std::allocate_shared<Page>(allocator, *other) : std::allocate_shared<Page>(allocator);
+    }
+
+
+    ConcreteMemory::Page& ConcreteMemory::detach(triton::uint64 number) {
+      std::shared_ptr<Page>& page = this->pages.modify(number);
+
+      if (page == nullptr) {
+        const triton::uint8* data = this->backing(number);
+        page = this->newPage(nullptr);
+        /* A page backed by a region starts as a copy of it */
+        if (data != nullptr) {
+          std::memcpy(page->bytes, data, pageSize);
+          page->defined.set();
+        }
+        else {
+          std::fill(page->bytes, page->bytes + pageSize, 0);
+        }
+      }
+      /* Copy on write */
+      else if (page.use_count() > 1) {
+        page = this->newPage(page.get());
+      }
+
+      return *page;
+    }
+
+
+    const triton::uint8* ConcreteMemory::backing(triton::uint64 number) const {
+      auto it = this->regions.upper_bound(number);
+      if (it == this->regions.begin())
+        return nullptr;
+
+      --it;
+      if (number - it->first >= it->second.length)
+        return nullptr;
+
+      return it->second.data + (number - it->first) * pageSize;
+    }
+
+
+    void ConcreteMemory::release(triton::uint64 number) {
+      const std::shared_ptr<Page>* page = this->pages.find(number);
+
+      if (page != nullptr && (*page)->defined.none()) {
+        /* The region must not show through once the page is released */
+        this->unback(number, number + 1);
+        this->pages.erase(number);
+      }
+    }
+
+
+    void ConcreteMemory::unback(triton::uint64 first, triton::uint64 last) {
+      auto it = this->regions.upper_bound(first);
+
+      if (it != this->regions.begin() && std::prev(it)->first + std::prev(it)->second.length > first)
+        --it;
+
+      while (it != this->regions.end() && it->first < last) {
+        triton::uint64 start = it->first;
+        Region region        = it->second;
+        triton::uint64 end   = start + region.length;
+        triton::uint64 lo    = std::max(start, first);
+        triton::uint64 hi    = std::min(end, last);
+
+        /* The pages of the region which are not hidden by a page were defined */
+        this->count -= (hi - lo - this->getPages(lo, hi).size()) * pageSize;
+
+        it = this->regions.erase(it);
+        if (start < lo)
+          this->regions[start] = Region{region.data, lo - start, region.owner};
+        if (hi < end)
+          this->regions[hi] = Region{region.data + (hi - start) * pageSize, end - hi, region.owner};
+      }
+    }
+
+
+    std::vector<triton::uint64> ConcreteMemory::getPages(triton::uint64 first, triton::uint64 last) const {
+      std::vector<triton::uint64> numbers;
+
+      /* Whichever is the smallest, the pages or the range, is walked */
+      if (this->pages.size() < last - first) {
+        this->pages.forEach([&](triton::uint64 number, const std::shared_ptr<Page>&) {
+          if (number >= first && number < last)
+            numbers.push_back(number);
+        });
+      }
+      else {
+        for (triton::uint64 number = first; number < last; number++) {
+          if (this->pages.contains(number))
+            numbers.push_back(number);
+        }
+      }
+
+      return numbers;
+    }
+
+
+    bool ConcreteMemory::isUsed(const Page& page, triton::uint32 offset, triton::usize length) {
+      for (triton::usize index = 0; index < length; index++) {
+        if (page.defined[offset + index])
+          return true;
+      }
+      return false;
+    }
+
+
+    bool ConcreteMemory::isDefined(triton::uint64 addr) const {
+      const std::shared_ptr<Page>* page = this->pages.find(addr >> pageBits);
+      if (page == nullptr)
+        return this->backing(addr >> pageBits) != nullptr;
+      return (*page)->defined[addr & (pageSize - 1)];
+    }
+
+
+    triton::uint8 ConcreteMemory::get(triton::uint64 addr) const {
+      const std::shared_ptr<Page>* page = this->pages.find(addr >> pageBits);
+      if (page == nullptr) {
+        const triton::uint8* data = this->backing(addr >> pageBits);
+        return (data != nullptr) ? data[addr & (pageSize - 1)] : 0x00;
+      }
+
+      /* Undefined bytes of a page are kept at zero */
+      return (*page)->bytes[addr & (pageSize - 1)];
+    }
+
+
+    void ConcreteMemory::set(triton::uint64 addr, triton::uint8 value) {
+      triton::uint32 offset = addr & (pageSize - 1);
+      Page& page = this->detach(addr >> pageBits);
+
+      if (!page.defined[offset]) {
+        page.defined[offset] = true;
+        this->count++;
+      }
+      page.bytes[offset] = value;
+    }
+
+
+    void ConcreteMemory::erase(triton::uint64 addr) {
+      triton::uint32 offset = addr & (pageSize - 1);
+
+      if (!this->isDefined(addr))
+        return;
+
+      Page& page = this->detach(addr >> pageBits);
+      page.defined[offset] = false;
+      page.bytes[offset] = 0;
+      this->count--;
+
+      this->release(addr >> pageBits);
+    }
+
+
+    bool ConcreteMemory::isDefined(triton::uint64 addr, triton::usize size) const {
+      while (size) {
+        triton::uint32 offset = addr & (pageSize - 1);
+        triton::usize  length = std::min<triton::usize>(size, pageSize - offset);
+
+        const std::shared_ptr<Page>* page = this->pages.find(addr >> pageBits);
+        if (page == nullptr) {
+          if (this->backing(addr >> pageBits) == nullptr)
+            return false;
+        }
+        else if (length == pageSize) {
+          if (!(*page)->defined.all())
+            return false;
+        }
+        else {
+          for (triton::usize index = 0; index < length; index++) {
+            if (!(*page)->defined[offset + index])
+              return false;
+          }
+        }
+
+        addr += length;
+        size -= length;
+      }
+      return true;
+    }
+
+
+    bool ConcreteMemory::isPageDefined(triton::uint64 addr) const {
+      const std::shared_ptr<Page>* page = this->pages.find(addr >> pageBits);
+      if (page == nullptr)
+        return this->backing(addr >> pageBits) != nullptr;
+      return (*page)->defined.any();
+    }
+
+
+    void ConcreteMemory::read(triton::uint64 addr, triton::usize size, triton::uint8* out) const {
+      this->forEachChunk(addr, size, [&out](triton::uint64, const triton::uint8* data, triton::usize length) {
+        /* Undefined bytes of a page are kept at zero */
+        if (data == nullptr)
+          std::memset(out, 0, length);
+        else
+          std::memcpy(out, data, length);
+        out += length;
+      });
+    }
+
+
+    void ConcreteMemory::write(triton::uint64 addr, const triton::uint8* values, triton::usize size) {
+      while (size) {
+        triton::uint32 offset = addr & (pageSize - 1);
+        triton::usize  length = std::min<triton::usize>(size, pageSize - offset);
+        Page& page            = this->detach(addr >> pageBits);
+
+        std::memcpy(page.bytes + offset, values, length);
+
+        if (length == pageSize) {
+          this->count += pageSize - page.defined.count();
+          page.defined.set();
+        }
+        else {
+          for (triton::usize index = 0; index < length; index++) {
+            if (!page.defined[offset + index]) {
+              page.defined[offset + index] = true;
+              this->count++;
+            }
+          }
+        }
+
+        addr   += length;
+        size   -= length;
+        values += length;
+      }
+    }
+
+
+    void ConcreteMemory::erase(triton::uint64 addr, triton::usize size) {
+      while (size) {
+        triton::uint32 offset = addr & (pageSize - 1);
+        triton::usize  length = std::min<triton::usize>(size, pageSize - offset);
+        triton::uint64 number = addr >> pageBits;
+
+        const std::shared_ptr<Page>* found = this->pages.find(number);
+        if (length == pageSize) {
+          this->unback(number, number + 1);
+          if (found != nullptr) {
+            this->count -= (*found)->defined.count();
+            this->pages.erase(number);
+          }
+        }
+        else if (found != nullptr ? isUsed(**found, offset, length) : this->backing(number) != nullptr) {
+          Page& page = this->detach(number);
+
+          for (triton::usize index = 0; index < length; index++) {
+            if (page.defined[offset + index]) {
+              page.defined[offset + index] = false;
+              this->count--;
+            }
+          }
+          std::memset(page.bytes + offset, 0, length);
+
+          this->release(number);
+        }
+
+        addr += length;
+        size -= length;
+      }
+    }
+
+
+    void ConcreteMemory::map(triton::uint64 addr, const triton::uint8* area, triton::usize size, const std::shared_ptr<const void>& owner) {
+      /* The head of the area, up to the next page */
+      triton::uint32 offset = addr & (pageSize - 1);
+      if (offset && size) {
+        triton::usize length = std::min<triton::usize>(size, pageSize - offset);
+        this->write(addr, area, length);
+        addr += length;
+        size -= length;
+        area += length;
+      }
+
+      /* The pages fully covered replace what they cover, up to the end of the address space */
+      while (size >= pageSize) {
+        triton::uint64 first  = addr >> pageBits;
+        triton::uint64 number = std::min<triton::uint64>(size / pageSize, (~static_cast<triton::uint64>(0) >> pageBits) - first + 1);
+        triton::uint64 last   = first + number;
+
+        this->unback(first, last);
+        for (triton::uint64 page : this->getPages(first, last)) {
+          this->count -= (*this->pages.find(page))->defined.count();
+          this->pages.erase(page);
+        }
+
+        this->regions[first] = Region{area, number, owner};
+        this->count += number * pageSize;
+
+        addr += number * pageSize;
+        size -= number * pageSize;
+        area += number * pageSize;
+      }
+
+      /* The tail of the area */
+      this->write(addr, area, size);
+    }
+
+
+    void ConcreteMemory::clear(void) {
+      this->pages.clear();
+      this->regions.clear();
+      this->count = 0;
+    }
+
+
+    triton::usize ConcreteMemory::size(void) const {
+      return this->count;
+    }
+
+
+    triton::usize ConcreteMemory::getNumberOfPages(void) const {
+      return this->pages.size();
+    }
+
+
+    triton::usize ConcreteMemory::getBytes(void) const {
+      return this->pages.size() * sizeof(Page);
+    }
+
+
+    triton::usize ConcreteMemory::getNumberOfMappedPages(void) const {
+      triton::usize number = 0;
+
+      for (const auto& region : this->regions)
+        number += region.second.length - this->getPages(region.first, region.first + region.second.length).size();
+
+      return number;
+    }
+
+
+    std::vector<triton::uint64> ConcreteMemory::getDefinedPages(void) const {
+      std::vector<triton::uint64> addrs;
+
+      this->pages.forEach([&](triton::uint64 number, const std::shared_ptr<Page>& page) {
+        if (page->defined.any())
+          addrs.push_back(number << pageBits);
+      });
+
+      /* The pages of the regions which are not hidden by a page */
+      for (const auto& region : this->regions) {
+        for (triton::uint64 number = region.first; number - region.first < region.second.length; number++) {
+          if (!this->pages.contains(number))
+            addrs.push_back(number << pageBits);
+        }
+      }
+
+      std::sort(addrs.begin(), addrs.end());
+      return addrs;
+    }
+
+  }; /* arch namespace */
+}; /* triton namespace */
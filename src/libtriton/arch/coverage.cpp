@@ -0,0 +1,186 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <triton/coverage.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+
+    triton::usize Coverage::EdgeHash::operator()(const std::pair<triton::uint64, triton::uint64>& edge) const {
+      return static_cast<triton::usize>((edge.first * 0x9e3779b97f4a7c15ULL) ^ (edge.second * 0xc2b2ae3d27d4eb4fULL));
+    }
+
+
+    Coverage::Coverage() {
+      this->enabled = false;
+      this->bitmap.resize(COVERAGE_BITMAP_SIZE, 0);
+    }
+
+
+    void Coverage::setEnabled(bool flag) {
+      this->enabled = flag;
+    }
+
+
+    triton::usize Coverage::getEdgeIndex(triton::uint64 src, triton::uint64 dst) {
+      /* The hits by hash of the edge, as AFL does */
+      triton::uint64 hash = (src * 0x9e3779b97f4a7c15ULL) ^ (dst * 0xc2b2ae3d27d4eb4fULL);
+      return static_cast<triton::usize>((hash >> 32) % COVERAGE_BITMAP_SIZE);
+    }
+
+
+    void Coverage::cover(Branch& branch) {
+      if (branch.index == static_cast<triton::usize>(-1))
+        return;
+
+      /* The last uncovered branch takes its place */
+      const auto& last = this->uncovered.back();
+      this->branches[last].index = branch.index;
+      this->uncovered[branch.index] = last;
+      this->uncovered.pop_back();
+      branch.index = static_cast<triton::usize>(-1);
+    }
+
+
+    void Coverage::recordInstruction(triton::uint64 address, bool controlFlow, triton::uint64 next) {
+      std::lock_guard<std::mutex> guard(this->lock);
+
+      this->addresses.insert(address);
+      if (!controlFlow)
+        return;
+
+      auto edge = std::make_pair(address, next);
+      this->edges[edge]++;
+
+      triton::uint8& hits = this->bitmap[Coverage::getEdgeIndex(address, next)];
+      if (hits < 0xff)
+        hits++;
+
+      auto it = this->branches.find(edge);
+      if (it != this->branches.end())
+        this->cover(it->second);
+    }
+
+
+    void Coverage::recordBranch(bool taken, triton::uint64 src, triton::uint64 dst) {
+      std::lock_guard<std::mutex> guard(this->lock);
+      auto edge = std::make_pair(src, dst);
+      auto it = this->branches.find(edge);
+
+      if (it == this->branches.end()) {
+        Branch branch;
+        branch.index = static_cast<triton::usize>(-1);
+
+        /* A branch first seen not taken may have been taken by an edge before */
+        if (!taken && this->edges.find(edge) == this->edges.end()) {
+          branch.index = this->uncovered.size();
+          this->uncovered.push_back(edge);
+        }
+
+        it = this->branches.emplace(edge, branch).first;
+      }
+
+      if (taken) {
+        it->second.coverage.taken++;
+        this->cover(it->second);
+      }
+      else {
+        it->second.coverage.notTaken++;
+      }
+    }
+
+
+    bool Coverage::isExecuted(triton::uint64 address) const {
+      std::lock_guard<std::mutex> guard(this->lock);
+      return this->addresses.find(address) != this->addresses.end();
+    }
+
+
+    bool Coverage::isCovered(triton::uint64 src, triton::uint64 dst) const {
+      std::lock_guard<std::mutex> guard(this->lock);
+      auto edge = std::make_pair(src, dst);
+
+      if (this->edges.find(edge) != this->edges.end())
+        return true;
+
+      auto it = this->branches.find(edge);
+      return it != this->branches.end() && it->second.coverage.taken != 0;
+    }
+
+
+    BranchCoverage Coverage::getBranch(triton::uint64 src, triton::uint64 dst) const {
+      std::lock_guard<std::mutex> guard(this->lock);
+      auto it = this->branches.find(std::make_pair(src, dst));
+      return (it == this->branches.end()) ? BranchCoverage() : it->second.coverage;
+    }
+
+
+    std::set<triton::uint64> Coverage::getAddresses(void) const {
+      std::lock_guard<std::mutex> guard(this->lock);
+      return std::set<triton::uint64>(this->addresses.begin(), this->addresses.end());
+    }
+
+
+    std::map<std::pair<triton::uint64, triton::uint64>, triton::usize> Coverage::getEdges(void) const {
+      std::lock_guard<std::mutex> guard(this->lock);
+      return std::map<std::pair<triton::uint64, triton::uint64>, triton::usize>(this->edges.begin(), this->edges.end());
+    }
+
+
+    std::vector<triton::uint8> Coverage::getBitmap(void) const {
+      std::lock_guard<std::mutex> guard(this->lock);
+      return this->bitmap;
+    }
+
+
+    std::map<std::pair<triton::uint64, triton::uint64>, BranchCoverage> Coverage::getBranches(void) const {
+      std::lock_guard<std::mutex> guard(this->lock);
+      std::map<std::pair<triton::uint64, triton::uint64>, BranchCoverage> ret;
+
+      for (const auto& item : this->branches)
+        ret[item.first] = item.second.coverage;
+
+      return ret;
+    }
+
+
+    std::vector<std::pair<triton::uint64, triton::uint64>> Coverage::getUncoveredBranches(void) const {
+      std::lock_guard<std::mutex> guard(this->lock);
+      return this->uncovered;
+    }
+
+
+    triton::usize Coverage::getNumberOfUncoveredBranches(void) const {
+      std::lock_guard<std::mutex> guard(this->lock);
+      return this->uncovered.size();
+    }
+
+
+    bool Coverage::getNextUncoveredBranch(std::pair<triton::uint64, triton::uint64>& branch) const {
+      std::lock_guard<std::mutex> guard(this->lock);
+
+      if (this->uncovered.empty())
+        return false;
+
+      branch = this->uncovered.back();
+      return true;
+    }
+
+
+    void Coverage::clear(void) {
+      std::lock_guard<std::mutex> guard(this->lock);
+      this->addresses.clear();
+      this->edges.clear();
+      this->branches.clear();
+      this->uncovered.clear();
+      this->bitmap.assign(COVERAGE_BITMAP_SIZE, 0);
+    }
+
+  }; /* arch namespace */
+}; /* triton namespace */
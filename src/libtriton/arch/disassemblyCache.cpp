@@ -0,0 +1,97 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <cstring>
+
+#include <triton/disassemblyCache.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+
+    DisassemblyCache::DisassemblyCache(triton::arch::architecture_e arch) {
+      this->arch = arch;
+    }
+
+
+    triton::arch::architecture_e DisassemblyCache::getArchitecture(void) const {
+      return this->arch;
+    }
+
+
+    bool DisassemblyCache::find(triton::arch::Instruction& inst, triton::uint32 state, triton::uint32& next) const {
+      std::lock_guard<std::mutex> guard(this->lock);
+      auto it = this->entries.find(Key(inst.getAddress(), state));
+      if (it == this->entries.end())
+        return false;
+
+      const Entry& entry = it->second;
+
+      /* The code must not have changed since it was decoded */
+      if (inst.getSize() < entry.size || std::memcmp(inst.getOpcode(), entry.bytes, entry.size) != 0)
+        return false;
+
+      inst.setOpcode(entry.bytes, entry.size);
+      inst.setDisassembly(entry.mnemonic.c_str(), entry.operandsText.c_str());
+      inst.setType(entry.type);
+      inst.setPrefix(entry.prefix);
+      inst.setCodeCondition(entry.codeCondition);
+      inst.setSemanticsHandler(entry.handler);
+      inst.setBranch(entry.branch);
+      inst.setControlFlow(entry.controlFlow);
+      inst.setWriteBack(entry.writeBack);
+      inst.setUpdateFlag(entry.updateFlag);
+      inst.setThumb(entry.thumb);
+      inst.operands = entry.operands;
+      next = entry.next;
+
+      return true;
+    }
+
+
+    void DisassemblyCache::insert(const triton::arch::Instruction& inst, triton::uint32 state, triton::uint32 next) {
+      if (inst.getSize() > sizeof(Entry::bytes))
+        return;
+
+      std::lock_guard<std::mutex> guard(this->lock);
+      if (this->entries.size() >= capacity)
+        this->entries.clear();
+
+      Entry& entry = this->entries[Key(inst.getAddress(), state)];
+
+      std::memcpy(entry.bytes, inst.getOpcode(), inst.getSize());
+      entry.size          = inst.getSize();
+      entry.mnemonic      = inst.getMnemonic();
+      entry.operandsText  = inst.getOperandsText();
+      entry.operands      = inst.operands;
+      entry.type          = inst.getType();
+      entry.prefix        = inst.getPrefix();
+      entry.codeCondition = inst.getCodeCondition();
+      entry.handler       = inst.getSemanticsHandler();
+      entry.branch        = inst.isBranch();
+      entry.controlFlow   = inst.isControlFlow();
+      entry.writeBack     = inst.isWriteBack();
+      entry.updateFlag    = inst.isUpdateFlag();
+      entry.thumb         = inst.isThumb();
+      entry.next          = next;
+    }
+
+
+    void DisassemblyCache::clear(void) {
+      std::lock_guard<std::mutex> guard(this->lock);
+      this->entries.clear();
+    }
+
+
+    triton::usize DisassemblyCache::size(void) const {
+      std::lock_guard<std::mutex> guard(this->lock);
+      return this->entries.size();
+    }
+
+  }; /* arch namespace */
+}; /* triton namespace */
@@ -0,0 +1,450 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+
+#include <triton/cpuSize.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/functionSummaries.hpp>
+#include <triton/memoryAccess.hpp>
+#include <triton/register.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+
+    FunctionSummaries::FunctionSummaries(triton::arch::Architecture* architecture,
+                                         triton::engines::symbolic::SymbolicEngine* symbolicEngine,
+                                         triton::engines::taint::TaintEngine* taintEngine,
+                                         const triton::ast::SharedAstContext& astCtxt)
+      : astCtxt(astCtxt) {
+
+      if (architecture == nullptr)
+        throw triton::exceptions::FunctionSummaries("FunctionSummaries::FunctionSummaries(): The architecture API must be defined.");
+
+      if (symbolicEngine == nullptr)
+        throw triton::exceptions::FunctionSummaries("FunctionSummaries::FunctionSummaries(): The symbolic engine API must be defined.");
+
+      if (taintEngine == nullptr)
+        throw triton::exceptions::FunctionSummaries("FunctionSummaries::FunctionSummaries(): The taint engine API must be defined.");
+
+      this->architecture   = architecture;
+      this->symbolicEngine = symbolicEngine;
+      this->taintEngine    = taintEngine;
+    }
+
+
+    const std::map<std::string, FunctionSummaries::model_e>& FunctionSummaries::getModels(void) {
+      static const std::map<std::string, model_e> models = {
+        {"memcpy",  MODEL_MEMCPY},
+        {"memmove", MODEL_MEMMOVE},
+        {"memset",  MODEL_MEMSET},
+        {"strcmp",  MODEL_STRCMP},
+        {"strlen",  MODEL_STRLEN},
+        {"strncpy", MODEL_STRNCPY},
+      };
+      return models;
+    }
+
+
+    void FunctionSummaries::setSummary(triton::uint64 addr, const std::string& symbol) {
+      const auto& models = getModels();
+      auto it = models.find(symbol);
+
+      if (it == models.end())
+        throw triton::exceptions::FunctionSummaries("FunctionSummaries::setSummary(): No model for this symbol.");
+
+      this->summaries[addr] = it->second;
+    }
+
+
+    void FunctionSummaries::removeSummary(triton::uint64 addr) {
+      this->summaries.erase(addr);
+    }
+
+
+    bool FunctionSummaries::isSummarized(triton::uint64 addr) const {
+      return (this->summaries.find(addr) != this->summaries.end());
+    }
+
+
+    std::map<triton::uint64, std::string> FunctionSummaries::getSummaries(void) const {
+      std::map<triton::uint64, std::string> ret;
+
+      for (const auto& summary : this->summaries) {
+        for (const auto& model : getModels()) {
+          if (model.second == summary.second)
+            ret[summary.first] = model.first;
+        }
+      }
+
+      return ret;
+    }
+
+
+    triton::arch::OperandWrapper FunctionSummaries::getArgument(triton::uint32 index) const {
+      static const triton::arch::register_e x8664[] = {triton::arch::ID_REG_X86_RDI, triton::arch::ID_REG_X86_RSI, triton::arch::ID_REG_X86_RDX};
+      static const triton::arch::register_e aarch64[] = {triton::arch::ID_REG_AARCH64_X0, triton::arch::ID_REG_AARCH64_X1, triton::arch::ID_REG_AARCH64_X2};
+      static const triton::arch::register_e arm32[] = {triton::arch::ID_REG_ARM32_R0, triton::arch::ID_REG_ARM32_R1, triton::arch::ID_REG_ARM32_R2};
+
+      switch (this->architecture->getArchitecture()) {
+        case triton::arch::ARCH_X86_64:
+          return triton::arch::OperandWrapper(this->architecture->getRegister(x8664[index]));
+
+        /* The arguments are pushed on the stack, above the return address */
+        case triton::arch::ARCH_X86: {
+          triton::uint64 sp = this->architecture->getConcreteRegisterValue(this->architecture->getStackPointer()).convert_to<triton::uint64>();
+          return triton::arch::OperandWrapper(triton::arch::MemoryAccess(sp + (index + 1) * triton::size::dword, triton::size::dword));
+        }
+
+        case triton::arch::ARCH_AARCH64:
+          return triton::arch::OperandWrapper(this->architecture->getRegister(aarch64[index]));
+
+        case triton::arch::ARCH_ARM32:
+          return triton::arch::OperandWrapper(this->architecture->getRegister(arm32[index]));
+
+        default:
+          throw triton::exceptions::FunctionSummaries("FunctionSummaries::getArgument(): Architecture not supported.");
+      }
+    }
+
+
+    triton::ast::SharedAbstractNode FunctionSummaries::getArgumentAst(triton::arch::Instruction& inst, triton::uint32 index) {
+      return this->symbolicEngine->getOperandAst(inst, this->getArgument(index));
+    }
+
+
+    triton::uint64 FunctionSummaries::concretize(const triton::ast::SharedAbstractNode& node) {
+      triton::uint64 value = node->evaluate().convert_to<triton::uint64>();
+
+      /* The model only handles this value */
+      if (node->isSymbolized())
+        this->symbolicEngine->pushPathConstraint(this->astCtxt->equal(node, this->astCtxt->bv(value, node->getBitvectorSize())));
+
+      return value;
+    }
+
+
+    triton::ast::SharedAbstractNode FunctionSummaries::getByteAst(triton::uint64 addr, bool& tainted) const {
+      tainted |= this->taintEngine->isMemoryTainted(addr);
+      return this->symbolicEngine->getMemoryAst(triton::arch::MemoryAccess(addr, triton::size::byte));
+    }
+
+
+    void FunctionSummaries::addConstraint(std::vector<triton::ast::SharedAbstractNode>& constraints, const triton::ast::SharedAbstractNode& constraint) const {
+      if (constraint->isSymbolized())
+        constraints.push_back(constraint);
+    }
+
+
+    void FunctionSummaries::pushConstraints(const std::vector<triton::ast::SharedAbstractNode>& constraints) {
+      if (constraints.empty())
+        return;
+
+      if (constraints.size() == 1)
+        this->symbolicEngine->pushPathConstraint(constraints.front());
+      else
+        this->symbolicEngine->pushPathConstraint(this->astCtxt->land(constraints));
+    }
+
+
+    void FunctionSummaries::moveMemory(triton::uint64 dst, triton::uint64 src, triton::usize size) {
+      std::vector<triton::uint8> area(std::min<triton::usize>(size, triton::engines::symbolic::SymbolicMemory::pageSize));
+      bool backward = (dst > src);
+
+      /* The concrete values are moved by chunks, each one is read before being written (see SymbolicMemory::copy) */
+      for (triton::usize done = 0; done < size;) {
+        triton::usize length = std::min<triton::usize>(size - done, area.size());
+        triton::usize offset = backward ? (size - done - length) : done;
+
+        this->architecture->getConcreteMemoryAreaValue(src + offset, area.data(), length);
+        this->architecture->setConcreteMemoryAreaValue(dst + offset, area.data(), length);
+        done += length;
+      }
+
+      /* The expressions of the memory cells are shared with the destination */
+      this->symbolicEngine->copySymbolicMemory(dst, src, size);
+
+      /* Spread taint */
+      if (this->taintEngine->isEnabled()) {
+        for (triton::usize index = 0; index < size; index++) {
+          triton::usize offset = backward ? (size - index - 1) : index;
+          this->taintEngine->taintAssignment(triton::arch::MemoryAccess(dst + offset, triton::size::byte), triton::arch::MemoryAccess(src + offset, triton::size::byte));
+        }
+      }
+    }
+
+
+    void FunctionSummaries::fillMemory(triton::uint64 dst, triton::uint8 value, triton::usize size) {
+      std::vector<triton::uint8> area(std::min<triton::usize>(size, triton::engines::symbolic::SymbolicMemory::pageSize), value);
+
+      for (triton::usize done = 0; done < size;) {
+        triton::usize length = std::min<triton::usize>(size - done, area.size());
+        this->architecture->setConcreteMemoryAreaValue(dst + done, area.data(), length);
+        done += length;
+      }
+
+      this->symbolicEngine->concretizeMemoryArea(dst, size);
+    }
+
+
+    void FunctionSummaries::setReturnValue(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, bool tainted) {
+      triton::arch::register_e id = triton::arch::ID_REG_INVALID;
+
+      switch (this->architecture->getArchitecture()) {
+        case triton::arch::ARCH_X86_64:  id = triton::arch::ID_REG_X86_RAX;     break;
+        case triton::arch::ARCH_X86:     id = triton::arch::ID_REG_X86_EAX;     break;
+        case triton::arch::ARCH_AARCH64: id = triton::arch::ID_REG_AARCH64_X0;  break;
+        case triton::arch::ARCH_ARM32:   id = triton::arch::ID_REG_ARM32_R0;    break;
+        default:
+          throw triton::exceptions::FunctionSummaries("FunctionSummaries::setReturnValue(): Architecture not supported.");
+      }
+
+      const triton::arch::Register& reg = this->architecture->getRegister(id);
+      triton::ast::SharedAbstractNode value = node;
+
+      if (value->getBitvectorSize() < reg.getBitSize())
+        value = this->astCtxt->zx(reg.getBitSize() - value->getBitvectorSize(), value);
+
+      auto expr = this->symbolicEngine->createSymbolicExpression(inst, value, triton::arch::OperandWrapper(reg), "Return value");
+      expr->isTainted = this->taintEngine->setTaintRegister(reg, tainted);
+    }
+
+
+    void FunctionSummaries::returnToCaller(triton::arch::Instruction& inst) {
+      auto pc = triton::arch::OperandWrapper(this->architecture->getProgramCounter());
+
+      switch (this->architecture->getArchitecture()) {
+        /* The return address is popped */
+        case triton::arch::ARCH_X86:
+        case triton::arch::ARCH_X86_64: {
+          auto sp   = triton::arch::OperandWrapper(this->architecture->getStackPointer());
+          auto size = this->architecture->gprSize();
+          auto top  = this->architecture->getConcreteRegisterValue(sp.getConstRegister()).convert_to<triton::uint64>();
+          auto ret  = triton::arch::OperandWrapper(triton::arch::MemoryAccess(top, size));
+
+          auto op1 = this->symbolicEngine->getOperandAst(inst, ret);
+          auto op2 = this->symbolicEngine->getOperandAst(inst, sp);
+
+          auto node = this->astCtxt->bvadd(op2, this->astCtxt->bv(size, sp.getBitSize()));
+
+          auto expr1 = this->symbolicEngine->createSymbolicExpression(inst, op1, pc, "Program Counter");
+          auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, node, sp, "Stack alignment");
+
+          expr1->isTainted = this->taintEngine->taintAssignment(pc, ret);
+          expr2->isTainted = this->taintEngine->taintUnion(sp, sp);
+          break;
+        }
+
+        /* The return address is in the link register */
+        case triton::arch::ARCH_AARCH64: {
+          auto lr   = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::ID_REG_AARCH64_X30));
+          auto op1  = this->symbolicEngine->getOperandAst(inst, lr);
+          auto expr = this->symbolicEngine->createSymbolicExpression(inst, op1, pc, "Program Counter");
+          expr->isTainted = this->taintEngine->taintAssignment(pc, lr);
+          break;
+        }
+
+        /* The lowest bit of the link register selects the Thumb mode */
+        case triton::arch::ARCH_ARM32: {
+          auto lr   = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::ID_REG_ARM32_R14));
+          auto op1  = this->symbolicEngine->getOperandAst(inst, lr);
+          auto node = this->astCtxt->bvand(op1, this->astCtxt->bv(0xfffffffe, lr.getBitSize()));
+          auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, pc, "Program Counter");
+          expr->isTainted = this->taintEngine->taintAssignment(pc, lr);
+          this->architecture->setThumb((op1->evaluate() & 1) != 0);
+          break;
+        }
+
+        default:
+          throw triton::exceptions::FunctionSummaries("FunctionSummaries::returnToCaller(): Architecture not supported.");
+      }
+
+      inst.setControlFlow(true);
+    }
+
+
+    void FunctionSummaries::memcpyModel(triton::arch::Instruction& inst) {
+      auto op1 = this->getArgumentAst(inst, 0);
+      auto op2 = this->getArgumentAst(inst, 1);
+      auto op3 = this->getArgumentAst(inst, 2);
+
+      triton::uint64 dst  = this->concretize(op1);
+      triton::uint64 src  = this->concretize(op2);
+      triton::uint64 size = this->concretize(op3);
+
+      /* memmove semantics, which also holds for memcpy */
+      this->moveMemory(dst, src, size);
+
+      this->setReturnValue(inst, op1, this->taintEngine->isTainted(this->getArgument(0)));
+    }
+
+
+    void FunctionSummaries::memsetModel(triton::arch::Instruction& inst) {
+      auto op1 = this->getArgumentAst(inst, 0);
+      auto op2 = this->getArgumentAst(inst, 1);
+      auto op3 = this->getArgumentAst(inst, 2);
+
+      triton::uint64 dst  = this->concretize(op1);
+      triton::uint64 size = this->concretize(op3);
+      auto           byte = this->astCtxt->extract(triton::bitsize::byte - 1, 0, op2);
+
+      if (size && byte->isSymbolized()) {
+        /* The first byte is stored, the next ones are replicated by doubling the filled part of the area */
+        this->symbolicEngine->createSymbolicExpression(inst, byte, triton::arch::OperandWrapper(triton::arch::MemoryAccess(dst, triton::size::byte)), "memset");
+        for (triton::uint64 filled = 1; filled < size;) {
+          triton::uint64 length = std::min(filled, size - filled);
+          this->moveMemory(dst + filled, dst, length);
+          filled += length;
+        }
+      }
+      else {
+        this->fillMemory(dst, byte->evaluate().convert_to<triton::uint8>(), size);
+      }
+
+      /* Spread taint */
+      if (this->taintEngine->isEnabled()) {
+        auto c = this->getArgument(1);
+        for (triton::uint64 index = 0; index < size; index++)
+          this->taintEngine->taintAssignment(triton::arch::OperandWrapper(triton::arch::MemoryAccess(dst + index, triton::size::byte)), c);
+      }
+
+      this->setReturnValue(inst, op1, this->taintEngine->isTainted(this->getArgument(0)));
+    }
+
+
+    void FunctionSummaries::strcmpModel(triton::arch::Instruction& inst) {
+      std::vector<triton::ast::SharedAbstractNode> constraints;
+      triton::ast::SharedAbstractNode result = nullptr;
+      bool tainted = false;
+
+      triton::uint64 s1 = this->concretize(this->getArgumentAst(inst, 0));
+      triton::uint64 s2 = this->concretize(this->getArgumentAst(inst, 1));
+
+      for (triton::uint64 index = 0; result == nullptr; index++) {
+        auto op1  = this->getByteAst(s1 + index, tainted);
+        auto op2  = this->getByteAst(s2 + index, tainted);
+        auto zero = this->astCtxt->bv(0, triton::bitsize::byte);
+
+        triton::uint512 value1 = op1->evaluate();
+        triton::uint512 value2 = op2->evaluate();
+
+        /* The first different bytes give the result */
+        if (value1 != value2) {
+          this->addConstraint(constraints, this->astCtxt->distinct(op1, op2));
+          result = this->astCtxt->bvsub(
+                     this->astCtxt->zx(triton::bitsize::dword - triton::bitsize::byte, op1),
+                     this->astCtxt->zx(triton::bitsize::dword - triton::bitsize::byte, op2)
+                   );
+        }
+
+        /* Both strings end */
+        else if (value1 == 0) {
+          this->addConstraint(constraints, this->astCtxt->equal(op1, zero));
+          this->addConstraint(constraints, this->astCtxt->equal(op2, zero));
+          result = this->astCtxt->bv(0, triton::bitsize::dword);
+        }
+
+        else {
+          this->addConstraint(constraints, this->astCtxt->equal(op1, op2));
+          this->addConstraint(constraints, this->astCtxt->distinct(op1, zero));
+        }
+      }
+
+      this->pushConstraints(constraints);
+      this->setReturnValue(inst, result, tainted);
+    }
+
+
+    void FunctionSummaries::strlenModel(triton::arch::Instruction& inst) {
+      std::vector<triton::ast::SharedAbstractNode> constraints;
+      triton::uint64 length = 0;
+      bool tainted = false;
+
+      triton::uint64 s = this->concretize(this->getArgumentAst(inst, 0));
+
+      while (true) {
+        auto op   = this->getByteAst(s + length, tainted);
+        auto zero = this->astCtxt->bv(0, triton::bitsize::byte);
+
+        if (op->evaluate().is_zero()) {
+          this->addConstraint(constraints, this->astCtxt->equal(op, zero));
+          break;
+        }
+
+        this->addConstraint(constraints, this->astCtxt->distinct(op, zero));
+        length++;
+      }
+
+      this->pushConstraints(constraints);
+      this->setReturnValue(inst, this->astCtxt->bv(length, this->architecture->gprBitSize()), tainted);
+    }
+
+
+    void FunctionSummaries::strncpyModel(triton::arch::Instruction& inst) {
+      std::vector<triton::ast::SharedAbstractNode> constraints;
+      triton::uint64 length = 0;
+      bool tainted = false;
+
+      auto op1 = this->getArgumentAst(inst, 0);
+      auto op2 = this->getArgumentAst(inst, 1);
+      auto op3 = this->getArgumentAst(inst, 2);
+
+      triton::uint64 dst  = this->concretize(op1);
+      triton::uint64 src  = this->concretize(op2);
+      triton::uint64 size = this->concretize(op3);
+
+      /* The length of the source, bounded by the size */
+      while (length < size) {
+        auto op   = this->getByteAst(src + length, tainted);
+        auto zero = this->astCtxt->bv(0, triton::bitsize::byte);
+
+        if (op->evaluate().is_zero()) {
+          this->addConstraint(constraints, this->astCtxt->equal(op, zero));
+          break;
+        }
+
+        this->addConstraint(constraints, this->astCtxt->distinct(op, zero));
+        length++;
+      }
+
+      /* The string is copied, and the rest of the destination is padded with zeros */
+      this->moveMemory(dst, src, length);
+      this->fillMemory(dst + length, 0, size - length);
+
+      if (this->taintEngine->isEnabled()) {
+        for (triton::uint64 index = length; index < size; index++)
+          this->taintEngine->setTaintMemory(triton::arch::MemoryAccess(dst + index, triton::size::byte), false);
+      }
+
+      this->pushConstraints(constraints);
+      this->setReturnValue(inst, op1, this->taintEngine->isTainted(this->getArgument(0)));
+    }
+
+
+    bool FunctionSummaries::execute(triton::arch::Instruction& inst) {
+      auto it = this->summaries.find(inst.getAddress());
+
+      if (it == this->summaries.end())
+        return false;
+
+      switch (it->second) {
+        case MODEL_MEMCPY:
+        case MODEL_MEMMOVE: this->memcpyModel(inst);  break;
+        case MODEL_MEMSET:  this->memsetModel(inst);  break;
+        case MODEL_STRCMP:  this->strcmpModel(inst);  break;
+        case MODEL_STRLEN:  this->strlenModel(inst);  break;
+        case MODEL_STRNCPY: this->strncpyModel(inst); break;
+      }
+
+      this->returnToCaller(inst);
+      return true;
+    }
+
+  }; /* arch namespace */
+}; /* triton namespace */
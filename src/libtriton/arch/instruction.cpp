@@ -22,6 +22,7 @@ namespace triton {
       this->codeCondition   = triton::arch::arm::ID_CONDITION_INVALID;
       this->conditionTaken  = 0;
       this->controlFlow     = false;
+      this->handler         = 0;
       this->prefix          = triton::arch::x86::ID_PREFIX_INVALID;
       this->size            = 0;
       this->tainted         = false;
@@ -73,6 +74,7 @@ namespace triton {
       this->codeCondition       = other.codeCondition;
       this->conditionTaken      = other.conditionTaken;
       this->controlFlow         = other.controlFlow;
+      this->handler             = other.handler;
       this->loadAccess          = other.loadAccess;
       this->operands            = other.operands;
       this->prefix              = other.prefix;
@@ -91,8 +93,8 @@ namespace triton {
 
       std::memcpy(this->opcode, other.opcode, sizeof(this->opcode));
 
-      this->disassembly.clear();
-      this->disassembly.str(other.disassembly.str());
+      this->mnemonic            = other.mnemonic;
+      this->operandsText        = other.operandsText;
     }
 
 
@@ -122,7 +124,25 @@ namespace triton {
 
 
     std::string Instruction::getDisassembly(void) const {
-      return this->disassembly.str();
+      if (this->operandsText.empty())
+        return this->mnemonic;
+
+      std::string str;
+      str.reserve(this->mnemonic.size() + 1 + this->operandsText.size());
+      str.append(this->mnemonic);
+      str.push_back(' ');
+      str.append(this->operandsText);
+      return str;
+    }
+
+
+    const std::string& Instruction::getMnemonic(void) const {
+      return this->mnemonic;
+    }
+
+
+    const std::string& Instruction::getOperandsText(void) const {
+      return this->operandsText;
     }
 
 
@@ -159,32 +179,37 @@ namespace triton {
     }
 
 
-    std::set<std::pair<triton::arch::MemoryAccess, triton::ast::SharedAbstractNode>>& Instruction::getLoadAccess(void) {
+    triton::uint32 Instruction::getSemanticsHandler(void) const {
+      return this->handler;
+    }
+
+
+    triton::utils::FlatSet<std::pair<triton::arch::MemoryAccess, triton::ast::SharedAbstractNode>>& Instruction::getLoadAccess(void) {
       return this->loadAccess;
     }
 
 
-    std::set<std::pair<triton::arch::MemoryAccess, triton::ast::SharedAbstractNode>>& Instruction::getStoreAccess(void) {
+    triton::utils::FlatSet<std::pair<triton::arch::MemoryAccess, triton::ast::SharedAbstractNode>>& Instruction::getStoreAccess(void) {
       return this->storeAccess;
     }
 
 
-    std::set<std::pair<triton::arch::Register, triton::ast::SharedAbstractNode>>& Instruction::getReadRegisters(void) {
+    triton::utils::FlatSet<std::pair<triton::arch::Register, triton::ast::SharedAbstractNode>>& Instruction::getReadRegisters(void) {
       return this->readRegisters;
     }
 
 
-    std::set<std::pair<triton::arch::Register, triton::ast::SharedAbstractNode>>& Instruction::getWrittenRegisters(void) {
+    triton::utils::FlatSet<std::pair<triton::arch::Register, triton::ast::SharedAbstractNode>>& Instruction::getWrittenRegisters(void) {
       return this->writtenRegisters;
     }
 
 
-    std::set<std::pair<triton::arch::Immediate, triton::ast::SharedAbstractNode>>& Instruction::getReadImmediates(void) {
+    triton::utils::FlatSet<std::pair<triton::arch::Immediate, triton::ast::SharedAbstractNode>>& Instruction::getReadImmediates(void) {
       return this->readImmediates;
     }
 
 
-    std::set<triton::arch::Register>& Instruction::getUndefinedRegisters(void) {
+    triton::utils::FlatSet<triton::arch::Register>& Instruction::getUndefinedRegisters(void) {
       return this->undefinedRegisters;
     }
 
@@ -314,14 +339,25 @@ namespace triton {
     }
 
 
+    void Instruction::setSemanticsHandler(triton::uint32 handler) {
+      this->handler = handler;
+    }
+
+
     void Instruction::setThumb(bool state) {
       this->thumb = state;
     }
 
 
     void Instruction::setDisassembly(const std::string& str) {
-      this->disassembly.clear();
-      this->disassembly.str(str);
+      this->mnemonic = str;
+      this->operandsText.clear();
+    }
+
+
+    void Instruction::setDisassembly(const char* mnemonic, const char* operands) {
+      this->mnemonic.assign(mnemonic);
+      this->operandsText.assign(operands);
     }
 
 
@@ -506,29 +542,38 @@ namespace triton {
       this->codeCondition   = triton::arch::arm::ID_CONDITION_INVALID;
       this->conditionTaken  = 0;
       this->controlFlow     = false;
+      this->handler         = 0;
       this->prefix          = triton::arch::x86::ID_PREFIX_INVALID;
       this->size            = 0;
       this->tainted         = false;
+      this->thumb           = false;
       this->tid             = 0;
       this->type            = 0;
       this->updateFlag      = false;
       this->writeBack       = false;
 
-      /* Clear the stringstream (See #975) */
-      std::stringstream().swap(this->disassembly);
-
       this->loadAccess.clear();
+      this->mnemonic.clear();
       this->operands.clear();
+      this->operandsText.clear();
       this->readImmediates.clear();
       this->readRegisters.clear();
       this->storeAccess.clear();
       this->symbolicExpressions.clear();
+      this->undefinedRegisters.clear();
       this->writtenRegisters.clear();
 
       std::memset(this->opcode, 0x00, sizeof(this->opcode));
     }
 
 
+    void Instruction::reset(triton::uint64 addr, const triton::uint8* opcode, triton::uint32 opSize) {
+      this->clear();
+      this->setOpcode(opcode, opSize);
+      this->setAddress(addr);
+    }
+
+
     std::ostream& operator<<(std::ostream& stream, const Instruction& inst) {
       stream << "0x" << std::hex << inst.getAddress() << ": " << inst.getDisassembly() << std::dec;
       return stream;
@@ -16,6 +16,7 @@
 #include <triton/operandWrapper.hpp>
 #include <triton/register.hpp>
 #include <triton/x86Semantics.hpp>
+#include <triton/x86Specifications.hpp>
 
 
 
@@ -26,7 +27,9 @@ namespace triton {
                          const triton::modes::SharedModes& modes,
                          const triton::ast::SharedAstContext& astCtxt,
                          triton::engines::symbolic::SymbolicEngine* symbolicEngine,
-                         triton::engines::taint::TaintEngine* taintEngine)
+                         triton::engines::taint::TaintEngine* taintEngine,
+                         triton::arch::ProcessingStatistics* statistics,
+                         triton::arch::Coverage* coverage)
       : modes(modes), astCtxt(astCtxt) {
 
       if (architecture == nullptr)
@@ -38,15 +41,25 @@ namespace triton {
       if (taintEngine == nullptr)
         throw triton::exceptions::IrBuilder("IrBuilder::IrBuilder(): The taint engines API must be defined.");
 
+      if (statistics == nullptr)
+        throw triton::exceptions::IrBuilder("IrBuilder::IrBuilder(): The statistics must be defined.");
+
+      if (coverage == nullptr)
+        throw triton::exceptions::IrBuilder("IrBuilder::IrBuilder(): The coverage must be defined.");
+
       this->architecture              = architecture;
       this->backupSymbolicEngine      = new(std::nothrow) triton::engines::symbolic::SymbolicEngine(architecture, modes, astCtxt, nullptr);
+      this->coverage                  = coverage;
+      this->statistics                = statistics;
       this->symbolicEngine            = symbolicEngine;
       this->taintEngine               = taintEngine;
       this->aarch64Isa                = new(std::nothrow) triton::arch::arm::aarch64::AArch64Semantics(architecture, symbolicEngine, taintEngine, astCtxt);
       this->arm32Isa                  = new(std::nothrow) triton::arch::arm::arm32::Arm32Semantics(architecture, symbolicEngine, taintEngine, astCtxt);
       this->x86Isa                    = new(std::nothrow) triton::arch::x86::x86Semantics(architecture, symbolicEngine, taintEngine, modes, astCtxt);
+      this->x86TaintSummaries         = new(std::nothrow) triton::arch::x86::x86TaintSummaries(architecture, taintEngine);
+      this->functionSummaries         = new(std::nothrow) triton::arch::FunctionSummaries(architecture, symbolicEngine, taintEngine, astCtxt);
 
-      if (this->x86Isa == nullptr || this->aarch64Isa == nullptr || this->backupSymbolicEngine == nullptr)
+      if (this->x86Isa == nullptr || this->aarch64Isa == nullptr || this->backupSymbolicEngine == nullptr || this->x86TaintSummaries == nullptr || this->functionSummaries == nullptr)
         throw triton::exceptions::IrBuilder("IrBuilder::IrBuilder(): Not enough memory.");
     }
 
@@ -56,48 +69,254 @@ namespace triton {
       delete this->aarch64Isa;
       delete this->arm32Isa;
       delete this->x86Isa;
+      delete this->x86TaintSummaries;
+      delete this->functionSummaries;
+    }
+
+
+    triton::arch::FunctionSummaries& IrBuilder::getFunctionSummaries(void) {
+      return *this->functionSummaries;
     }
 
 
     bool IrBuilder::buildSemantics(triton::arch::Instruction& inst) {
+      triton::utils::TraceScope scope(this->astCtxt->getTracer().get(), "buildSemantics", "processing", inst.getAddress());
       triton::arch::architecture_e arch = this->architecture->getArchitecture();
+      bool recorded = this->statistics->isEnabled();
+      triton::usize nodes = recorded ? this->astCtxt->getNodeAllocator().getPool()->getAllocations() : 0;
       bool ret = false;
 
       if (arch == triton::arch::ARCH_INVALID)
         throw triton::exceptions::IrBuilder("IrBuilder::buildSemantics(): You must define an architecture.");
 
-      /* Initialize the target address of memory operands */
-      for (auto& operand : inst.operands) {
-        if (operand.getType() == triton::arch::OP_MEM) {
-          this->symbolicEngine->initLeaAst(operand.getMemory());
+      /* The interest of the operands decides the path of the semantics once */
+      triton::arch::semantics_path_e path = this->getSemanticsPath(inst);
+
+      /* The instructions with a taint summary only spread the taint, the others are built */
+      if (path == triton::arch::SEMANTICS_TAINT) {
+        triton::arch::PhaseTimer timer(this->statistics, triton::arch::PHASE_TAINT);
+        if (this->x86TaintSummaries->spread(inst)) {
+          if (recorded)
+            this->statistics->recordInstruction(inst.getType(), inst.getAddress(), inst.isControlFlow(), 0, 0);
+          if (this->coverage->isEnabled())
+            this->recordCoverage(inst);
+          return true;
         }
+        path = triton::arch::SEMANTICS_FULL;
       }
 
       /* Pre IR processing */
-      this->preIrInit(inst);
+      {
+        triton::arch::PhaseTimer timer(this->statistics, triton::arch::PHASE_PRE_IR_INIT);
+
+        /* Initialize the target address of memory operands */
+        for (auto& operand : inst.operands) {
+          if (operand.getType() == triton::arch::OP_MEM) {
+            this->symbolicEngine->initLeaAst(operand.getMemory());
+          }
+        }
+
+        this->preIrInit(inst);
+      }
+
+      /* Processing. A function with a summary executes its model instead of its instructions. */
+      {
+        triton::arch::PhaseTimer timer(this->statistics, triton::arch::PHASE_SEMANTICS);
+
+        if (this->functionSummaries->isSummarized(inst.getAddress())) {
+          ret = this->functionSummaries->execute(inst);
+        }
+        else if (path == triton::arch::SEMANTICS_CONCRETE) {
+          this->symbolicEngine->setConcreteSemantics(true);
+          try {
+            ret = this->getSemantics(arch)->buildSemantics(inst);
+          }
+          catch (...) {
+            this->symbolicEngine->setConcreteSemantics(false);
+            throw;
+          }
+          this->symbolicEngine->setConcreteSemantics(false);
+        }
+        else if ((arch == triton::arch::ARCH_X86 || arch == triton::arch::ARCH_X86_64) && this->isSemanticsCacheable(inst)) {
+          ret = this->buildCachedSemantics(inst);
+        }
+        else {
+          ret = this->getSemantics(arch)->buildSemantics(inst);
+        }
+      }
+
+      /* Post IR processing */
+      {
+        triton::arch::PhaseTimer timer(this->statistics, triton::arch::PHASE_POST_IR_INIT);
+        this->postIrInit(inst);
+      }
+
+      if (recorded)
+        this->statistics->recordInstruction(inst.getType(), inst.getAddress(), inst.isControlFlow(), this->astCtxt->getNodeAllocator().getPool()->getAllocations() - nodes, inst.symbolicExpressions.size());
+
+      if (ret && this->coverage->isEnabled())
+        this->recordCoverage(inst);
+
+      return ret;
+    }
+
+
+    void IrBuilder::recordCoverage(const triton::arch::Instruction& inst) {
+      triton::uint64 next = 0;
 
-      /* Processing */
+      /* The destination of the edge is the program counter left by the semantics */
+      if (inst.isControlFlow())
+        next = this->architecture->getConcreteRegisterValue(this->architecture->getProgramCounter()).convert_to<triton::uint64>();
+
+      this->coverage->recordInstruction(inst.getAddress(), inst.isControlFlow(), next);
+    }
+
+
+    triton::arch::SemanticsInterface* IrBuilder::getSemantics(triton::arch::architecture_e arch) const {
       switch (arch) {
         case triton::arch::ARCH_AARCH64:
-          ret = this->aarch64Isa->buildSemantics(inst);
-          break;
+          return this->aarch64Isa;
 
         case triton::arch::ARCH_ARM32:
-          ret = this->arm32Isa->buildSemantics(inst);
-          break;
+          return this->arm32Isa;
 
         case triton::arch::ARCH_X86:
         case triton::arch::ARCH_X86_64:
-          ret = this->x86Isa->buildSemantics(inst);
-          break;
+          return this->x86Isa;
 
         default:
           throw triton::exceptions::IrBuilder("IrBuilder::buildSemantics(): Architecture not supported.");
-          break;
       }
+    }
 
-      /* Post IR processing */
-      this->postIrInit(inst);
+
+    triton::arch::semantics_path_e IrBuilder::getSemanticsPath(const triton::arch::Instruction& inst) const {
+      triton::arch::architecture_e arch = this->architecture->getArchitecture();
+      bool symbolic = this->symbolicEngine->isEnabled();
+
+      /* A function with a summary executes its model */
+      if (this->functionSummaries->isSummarized(inst.getAddress()))
+        return triton::arch::SEMANTICS_FULL;
+
+      /* If only the taint engine is enabled and the mode is enabled, the instructions with a taint summary only spread the taint */
+      if (!symbolic && this->taintEngine->isEnabled() &&
+          (arch == triton::arch::ARCH_X86 || arch == triton::arch::ARCH_X86_64) &&
+          this->modes->isModeEnabled(triton::modes::TAINT_SUMMARIES))
+        return triton::arch::SEMANTICS_TAINT;
+
+      /*
+       * With ONLY_ON_TAINTED and nothing tainted, the instruction cannot be tainted
+       * whatever it reads, implicitly or not, and all its expressions would be removed
+       * once it is built. They are built concrete instead.
+       */
+      if (symbolic && this->modes->isModeEnabled(triton::modes::ONLY_ON_TAINTED) &&
+          (!this->taintEngine->isEnabled() || this->taintEngine->isEmpty()))
+        return triton::arch::SEMANTICS_CONCRETE;
+
+      return triton::arch::SEMANTICS_FULL;
+    }
+
+
+    bool IrBuilder::isSemanticsCacheable(const triton::arch::Instruction& inst) const {
+      if (!this->modes->isModeEnabled(triton::modes::SEMANTICS_CACHE))
+        return false;
+
+      /* The semantics spread the taint, and the taint engine only returns the taint of the destination once disabled */
+      if (!this->symbolicEngine->isEnabled() || this->taintEngine->isEnabled() || !this->taintEngine->isEmpty())
+        return false;
+
+      /* These modes make the factories of the AST context depend on the values of the nodes */
+      if (this->modes->isAnyModeEnabled(triton::modes::modeMask(triton::modes::AST_ABSTRACT_DOMAIN) |
+                                        triton::modes::modeMask(triton::modes::AST_HASH_CONSING) |
+                                        triton::modes::modeMask(triton::modes::AST_OPTIMIZATIONS) |
+                                        triton::modes::modeMask(triton::modes::CONCRETIZE_UNDEFINED_REGISTERS) |
+                                        triton::modes::modeMask(triton::modes::CONSTANT_FOLDING) |
+                                        triton::modes::modeMask(triton::modes::SYMBOLIZE_INDEX_ROTATION)))
+        return false;
+
+      /* The deferred flags are not reported to the cache */
+      if (this->modes->isAnyModeEnabled(triton::modes::modeMask(triton::modes::DEAD_FLAGS_ELIMINATION) | triton::modes::modeMask(triton::modes::LAZY_FLAGS)))
+        return false;
+
+      /* The repeated instructions depend on the counter */
+      if (inst.getPrefix() != triton::arch::x86::ID_PREFIX_INVALID && inst.getPrefix() != triton::arch::x86::ID_PREFIX_LOCK)
+        return false;
+
+      /* The semantics which never read the concrete state */
+      switch (inst.getType()) {
+        case triton::arch::x86::ID_INS_ADC:
+        case triton::arch::x86::ID_INS_ADD:
+        case triton::arch::x86::ID_INS_AND:
+        case triton::arch::x86::ID_INS_ANDN:
+        case triton::arch::x86::ID_INS_BT:
+        case triton::arch::x86::ID_INS_BTC:
+        case triton::arch::x86::ID_INS_BTR:
+        case triton::arch::x86::ID_INS_BTS:
+        case triton::arch::x86::ID_INS_CDQ:
+        case triton::arch::x86::ID_INS_CDQE:
+        case triton::arch::x86::ID_INS_CMP:
+        case triton::arch::x86::ID_INS_CQO:
+        case triton::arch::x86::ID_INS_CWD:
+        case triton::arch::x86::ID_INS_CWDE:
+        case triton::arch::x86::ID_INS_DEC:
+        case triton::arch::x86::ID_INS_IMUL:
+        case triton::arch::x86::ID_INS_INC:
+        case triton::arch::x86::ID_INS_LEA:
+        case triton::arch::x86::ID_INS_MOV:
+        case triton::arch::x86::ID_INS_MOVAPS:
+        case triton::arch::x86::ID_INS_MOVD:
+        case triton::arch::x86::ID_INS_MOVDQA:
+        case triton::arch::x86::ID_INS_MOVDQU:
+        case triton::arch::x86::ID_INS_MOVSX:
+        case triton::arch::x86::ID_INS_MOVSXD:
+        case triton::arch::x86::ID_INS_MOVUPS:
+        case triton::arch::x86::ID_INS_MOVZX:
+        case triton::arch::x86::ID_INS_MUL:
+        case triton::arch::x86::ID_INS_NEG:
+        case triton::arch::x86::ID_INS_NOP:
+        case triton::arch::x86::ID_INS_NOT:
+        case triton::arch::x86::ID_INS_OR:
+        case triton::arch::x86::ID_INS_PAND:
+        case triton::arch::x86::ID_INS_POPCNT:
+        case triton::arch::x86::ID_INS_POR:
+        case triton::arch::x86::ID_INS_PXOR:
+        case triton::arch::x86::ID_INS_SBB:
+        case triton::arch::x86::ID_INS_SUB:
+        case triton::arch::x86::ID_INS_TEST:
+        case triton::arch::x86::ID_INS_XADD:
+        case triton::arch::x86::ID_INS_XCHG:
+        case triton::arch::x86::ID_INS_XOR:
+          return true;
+        default:
+          return false;
+      }
+    }
+
+
+    bool IrBuilder::buildCachedSemantics(triton::arch::Instruction& inst) {
+      triton::arch::architecture_e arch = this->architecture->getArchitecture();
+      bool ret = false;
+
+      if (this->semanticsCache.replay(inst, arch, this->symbolicEngine, this->astCtxt))
+        return true;
+
+      this->semanticsCache.record(inst, arch);
+      this->symbolicEngine->setSemanticsRecorder(&this->semanticsCache);
+
+      try {
+        ret = this->x86Isa->buildSemantics(inst);
+      }
+      catch (...) {
+        this->symbolicEngine->setSemanticsRecorder(nullptr);
+        this->semanticsCache.abort();
+        throw;
+      }
+
+      this->symbolicEngine->setSemanticsRecorder(nullptr);
+      if (ret)
+        this->semanticsCache.commit(inst);
+      else
+        this->semanticsCache.abort();
 
       return ret;
     }
@@ -116,7 +335,7 @@ namespace triton {
 
       /* Update instruction address if undefined */
       if (!inst.getAddress()) {
-        inst.setAddress(this->architecture->getConcreteRegisterValue(this->architecture->getProgramCounter()).convert_to<triton::uint64>());
+        inst.setAddress(this->architecture->getConcreteRegisterValue64(this->architecture->getProgramCounter()));
       }
 
       /* Backup the symbolic engine in the case where only the taint is available. */
@@ -135,8 +354,10 @@ namespace triton {
       auto& storeAccess       = inst.getStoreAccess();
       auto& writtenRegisters  = inst.getWrittenRegisters();
 
-      /* Set the taint */
+      /* Set the taint, and index the tainted expressions now that the semantics have spread it */
       inst.setTaint();
+      if (this->symbolicEngine->isEnabled())
+        this->symbolicEngine->indexTaintedExpressions(inst.symbolicExpressions);
 
       // ----------------------------------------------------------------------
 
@@ -230,7 +451,18 @@ namespace triton {
         this->removeSymbolicExpressions(inst);
       }
 
-      this->astCtxt->garbage();
+      // ----------------------------------------------------------------------
+
+      /*
+       * If the symbolic engine is defined to prune dead definitions, the
+       * definitions overwritten by this instruction without being read
+       * release their AST.
+       */
+      if (this->symbolicEngine->isEnabled() && this->modes->isModeEnabled(triton::modes::PRUNE_DEAD_EXPRESSIONS)) {
+        this->pruneDeadDefinitions(inst);
+      }
+
+      this->astCtxt->garbageIfNeeded();
     }
 
 
@@ -242,6 +474,36 @@ namespace triton {
     }
 
 
+    void IrBuilder::pruneDeadDefinitions(const triton::arch::Instruction& inst) {
+      for (const auto& se : inst.symbolicExpressions) {
+        if (se->getType() != triton::engines::symbolic::REGISTER_EXPRESSION)
+          continue;
+
+        triton::arch::register_e id = se->getOriginRegister().getParent();
+        auto& definition = this->definitions[id];
+        auto previous = definition.lock();
+        definition = se;
+
+        if (previous == nullptr || previous == se)
+          continue;
+
+        /* A definition which is still assigned to its register is alive */
+        if (this->symbolicEngine->getSymbolicRegister(this->architecture->getRegister(id)) == previous)
+          continue;
+
+        /*
+         * Reading a definition creates a reference to it, which is a parent of
+         * its AST. Variables are kept so that they stay registered.
+         */
+        const triton::ast::SharedAbstractNode& node = previous->getAst();
+        if (node->isFrozen() || node->getType() == triton::ast::VARIABLE_NODE || !node->getParents().empty())
+          continue;
+
+        previous->setAst(this->astCtxt->bv(node->evaluate(), node->getBitvectorSize()));
+      }
+    }
+
+
     template <typename T>
     void IrBuilder::collectNodes(T& items) const {
       items.clear();
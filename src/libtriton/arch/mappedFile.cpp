@@ -0,0 +1,165 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <map>
+#include <mutex>
+#include <tuple>
+
+#include <triton/exceptions.hpp>
+#include <triton/mappedFile.hpp>
+
+#if defined(_WIN32)
+  #include <windows.h>
+#else
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+
+
+namespace triton {
+  namespace arch {
+
+    /* The mappings shared by the contexts of the process, by path, offset and size */
+    static std::mutex sharedLock;
+    static std::map<std::tuple<std::string, triton::uint64, triton::usize>, std::weak_ptr<const MappedFile>> sharedFiles;
+
+
+    MappedFile::MappedFile(const std::string& path, triton::uint64 offset, triton::usize size) {
+      triton::uint64 fileSize = 0;
+      triton::uint64 aligned  = 0;
+
+      this->base   = nullptr;
+      this->length = 0;
+      this->data   = nullptr;
+      this->size   = 0;
+
+      #if defined(_WIN32)
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+          throw triton::exceptions::Architecture("MappedFile::MappedFile(): Cannot open the file.");
+
+        LARGE_INTEGER info;
+        if (!GetFileSizeEx(file, &info)) {
+          CloseHandle(file);
+          throw triton::exceptions::Architecture("MappedFile::MappedFile(): Cannot get the size of the file.");
+        }
+        fileSize = static_cast<triton::uint64>(info.QuadPart);
+
+        SYSTEM_INFO system;
+        GetSystemInfo(&system);
+        aligned = offset - (offset % system.dwAllocationGranularity);
+      #else
+        int file = open(path.c_str(), O_RDONLY);
+        if (file < 0)
+          throw triton::exceptions::Architecture("MappedFile::MappedFile(): Cannot open the file.");
+
+        struct stat info;
+        if (fstat(file, &info) != 0) {
+          close(file);
+          throw triton::exceptions::Architecture("MappedFile::MappedFile(): Cannot get the size of the file.");
+        }
+        fileSize = static_cast<triton::uint64>(info.st_size);
+        aligned  = offset - (offset % static_cast<triton::uint64>(sysconf(_SC_PAGESIZE)));
+      #endif
+
+      if (offset > fileSize || (size != 0 && size > fileSize - offset)) {
+        #if defined(_WIN32)
+          CloseHandle(file);
+        #else
+          close(file);
+        #endif
+        throw triton::exceptions::Architecture("MappedFile::MappedFile(): The area is out of the file.");
+      }
+
+      this->size   = size ? size : static_cast<triton::usize>(fileSize - offset);
+      this->length = static_cast<triton::usize>(offset - aligned) + this->size;
+
+      /* An empty area is not mapped */
+      if (this->size == 0) {
+        #if defined(_WIN32)
+          CloseHandle(file);
+        #else
+          close(file);
+        #endif
+        return;
+      }
+
+      #if defined(_WIN32)
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping != nullptr)
+          this->base = MapViewOfFile(mapping, FILE_MAP_READ, static_cast<DWORD>(aligned >> 32), static_cast<DWORD>(aligned), this->length);
+        /* The view keeps the file mapped */
+        if (mapping != nullptr)
+          CloseHandle(mapping);
+        CloseHandle(file);
+      #else
+        this->base = mmap(nullptr, this->length, PROT_READ, MAP_PRIVATE, file, static_cast<off_t>(aligned));
+        if (this->base == MAP_FAILED)
+          this->base = nullptr;
+        /* The mapping keeps the file open */
+        close(file);
+      #endif
+
+      if (this->base == nullptr)
+        throw triton::exceptions::Architecture("MappedFile::MappedFile(): Cannot map the file.");
+
+      this->data = reinterpret_cast<const triton::uint8*>(this->base) + (offset - aligned);
+    }
+
+
+    MappedFile::~MappedFile() {
+      if (this->base == nullptr)
+        return;
+
+      #if defined(_WIN32)
+        UnmapViewOfFile(this->base);
+      #else
+        munmap(this->base, this->length);
+      #endif
+    }
+
+
+    const triton::uint8* MappedFile::getData(void) const {
+      return this->data;
+    }
+
+
+    triton::usize MappedFile::getSize(void) const {
+      return this->size;
+    }
+
+
+    std::shared_ptr<const MappedFile> MappedFile::share(const std::string& path, triton::uint64 offset, triton::usize size) {
+      std::lock_guard<std::mutex> guard(sharedLock);
+      auto key = std::make_tuple(path, offset, size);
+
+      auto it = sharedFiles.find(key);
+      if (it != sharedFiles.end()) {
+        std::shared_ptr<const MappedFile> file = it->second.lock();
+        if (file != nullptr)
+          return file;
+      }
+
+      /* The mappings released are dropped as others are added */
+      for (auto entry = sharedFiles.begin(); entry != sharedFiles.end();) {
+        if (entry->second.expired())
+          entry = sharedFiles.erase(entry);
+        else
+          ++entry;
+      }
+
+      auto file = std::make_shared<const MappedFile>(path, offset, size);
+      sharedFiles[key] = file;
+
+      return file;
+    }
+
+  }; /* arch namespace */
+}; /* triton namespace */
@@ -5,6 +5,8 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <utility>
+
 #include <triton/cpuSize.hpp>
 #include <triton/exceptions.hpp>
 #include <triton/memoryAccess.hpp>
@@ -48,6 +50,19 @@ namespace triton {
     }
 
 
+    MemoryAccess::MemoryAccess(MemoryAccess&& other) noexcept
+      : BitsVector(other),
+        address(other.address),
+        pcRelative(other.pcRelative),
+        segmentReg(other.segmentReg),
+        baseReg(other.baseReg),
+        indexReg(other.indexReg),
+        displacement(other.displacement),
+        scale(other.scale),
+        leaAst(std::move(other.leaAst)) {
+    }
+
+
     triton::uint64 MemoryAccess::getAddress(void) const {
       return this->address;
     }
@@ -182,6 +197,20 @@ namespace triton {
     }
 
 
+    MemoryAccess& MemoryAccess::operator=(MemoryAccess&& other) noexcept {
+      BitsVector::operator=(other);
+      this->address      = other.address;
+      this->baseReg      = other.baseReg;
+      this->displacement = other.displacement;
+      this->indexReg     = other.indexReg;
+      this->leaAst       = std::move(other.leaAst);
+      this->pcRelative   = other.pcRelative;
+      this->scale        = other.scale;
+      this->segmentReg   = other.segmentReg;
+      return *this;
+    }
+
+
     void MemoryAccess::copy(const MemoryAccess& other) {
       this->address      = other.address;
       this->baseReg      = other.baseReg;
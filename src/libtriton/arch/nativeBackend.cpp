@@ -0,0 +1,371 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include <unicorn/unicorn.h>
+
+#include <triton/exceptions.hpp>
+#include <triton/nativeBackend.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+
+    /* The size of a page of Unicorn */
+    static const triton::uint64 NATIVE_PAGE_BITS = 12;
+    static const triton::uint64 NATIVE_PAGE_SIZE = static_cast<triton::uint64>(1) << NATIVE_PAGE_BITS;
+
+
+    //! A register copied between Triton and Unicorn.
+    struct NativeRegister {
+      //! The register of Triton.
+      triton::arch::register_e reg;
+
+      //! The register of Unicorn.
+      int uc;
+    };
+
+
+    //! Returns the registers of `arch` copied between Triton and Unicorn. The flags of AArch64 are copied apart.
+    static const std::vector<NativeRegister>& getNativeRegisters(triton::arch::architecture_e arch) {
+      static std::vector<NativeRegister> x8664;
+      static std::vector<NativeRegister> aarch64;
+
+      if (x8664.empty()) {
+        x8664 = {
+          {triton::arch::ID_REG_X86_RAX, UC_X86_REG_RAX}, {triton::arch::ID_REG_X86_RBX, UC_X86_REG_RBX},
+          {triton::arch::ID_REG_X86_RCX, UC_X86_REG_RCX}, {triton::arch::ID_REG_X86_RDX, UC_X86_REG_RDX},
+          {triton::arch::ID_REG_X86_RDI, UC_X86_REG_RDI}, {triton::arch::ID_REG_X86_RSI, UC_X86_REG_RSI},
+          {triton::arch::ID_REG_X86_RBP, UC_X86_REG_RBP}, {triton::arch::ID_REG_X86_RSP, UC_X86_REG_RSP},
+          {triton::arch::ID_REG_X86_R8,  UC_X86_REG_R8},  {triton::arch::ID_REG_X86_R9,  UC_X86_REG_R9},
+          {triton::arch::ID_REG_X86_R10, UC_X86_REG_R10}, {triton::arch::ID_REG_X86_R11, UC_X86_REG_R11},
+          {triton::arch::ID_REG_X86_R12, UC_X86_REG_R12}, {triton::arch::ID_REG_X86_R13, UC_X86_REG_R13},
+          {triton::arch::ID_REG_X86_R14, UC_X86_REG_R14}, {triton::arch::ID_REG_X86_R15, UC_X86_REG_R15},
+          {triton::arch::ID_REG_X86_RIP, UC_X86_REG_RIP}, {triton::arch::ID_REG_X86_EFLAGS, UC_X86_REG_EFLAGS},
+          {triton::arch::ID_REG_X86_FS,  UC_X86_REG_FS_BASE}, {triton::arch::ID_REG_X86_GS, UC_X86_REG_GS_BASE},
+          {triton::arch::ID_REG_X86_MXCSR, UC_X86_REG_MXCSR},
+        };
+        for (triton::uint32 index = 0; index < 16; index++)
+          x8664.push_back({static_cast<triton::arch::register_e>(triton::arch::ID_REG_X86_YMM0 + index), UC_X86_REG_YMM0 + static_cast<int>(index)});
+
+        for (triton::uint32 index = 0; index < 29; index++)
+          aarch64.push_back({static_cast<triton::arch::register_e>(triton::arch::ID_REG_AARCH64_X0 + index), UC_ARM64_REG_X0 + static_cast<int>(index)});
+        aarch64.push_back({triton::arch::ID_REG_AARCH64_X29, UC_ARM64_REG_X29});
+        aarch64.push_back({triton::arch::ID_REG_AARCH64_X30, UC_ARM64_REG_X30});
+        aarch64.push_back({triton::arch::ID_REG_AARCH64_SP,  UC_ARM64_REG_SP});
+        aarch64.push_back({triton::arch::ID_REG_AARCH64_PC,  UC_ARM64_REG_PC});
+        for (triton::uint32 index = 0; index < 32; index++)
+          aarch64.push_back({static_cast<triton::arch::register_e>(triton::arch::ID_REG_AARCH64_Q0 + index), UC_ARM64_REG_Q0 + static_cast<int>(index)});
+      }
+
+      return (arch == triton::arch::ARCH_X86_64) ? x8664 : aarch64;
+    }
+
+
+    NativeBackend::NativeBackend(triton::arch::Architecture* architecture,
+                                 triton::engines::symbolic::SymbolicEngine* symbolicEngine,
+                                 triton::engines::taint::TaintEngine* taintEngine) {
+
+      if (architecture == nullptr)
+        throw triton::exceptions::NativeBackend("NativeBackend::NativeBackend(): The architecture API must be defined.");
+
+      if (symbolicEngine == nullptr)
+        throw triton::exceptions::NativeBackend("NativeBackend::NativeBackend(): The symbolic engine API must be defined.");
+
+      if (taintEngine == nullptr)
+        throw triton::exceptions::NativeBackend("NativeBackend::NativeBackend(): The taint engine API must be defined.");
+
+      this->architecture   = architecture;
+      this->symbolicEngine = symbolicEngine;
+      this->taintEngine    = taintEngine;
+      this->engine         = nullptr;
+      this->engineArch     = triton::arch::ARCH_INVALID;
+      this->options        = nullptr;
+      this->first          = 0;
+      this->last           = 0;
+      this->count          = 0;
+      this->interrupted    = false;
+    }
+
+
+    NativeBackend::~NativeBackend() {
+      this->close();
+    }
+
+
+    void NativeBackend::open(void) {
+      triton::arch::architecture_e arch = this->architecture->getArchitecture();
+      uc_hook hook;
+      uc_err err = UC_ERR_OK;
+
+      if (this->engine != nullptr && this->engineArch == arch)
+        return;
+
+      this->close();
+
+      switch (arch) {
+        case triton::arch::ARCH_X86_64:  err = uc_open(UC_ARCH_X86, UC_MODE_64, &this->engine);    break;
+        case triton::arch::ARCH_AARCH64: err = uc_open(UC_ARCH_ARM64, UC_MODE_ARM, &this->engine); break;
+        default:
+          throw triton::exceptions::NativeBackend("NativeBackend::open(): Architecture not supported.");
+      }
+
+      if (err != UC_ERR_OK) {
+        this->engine = nullptr;
+        throw triton::exceptions::NativeBackend(std::string("NativeBackend::open(): ") + uc_strerror(err));
+      }
+
+      this->engineArch = arch;
+
+      /* The hooks are installed once, the state of the run is in the members */
+      uc_hook_add(this->engine, &hook, UC_HOOK_CODE, reinterpret_cast<void*>(&NativeBackend::onCode), this, 1, 0);
+      uc_hook_add(this->engine, &hook, UC_HOOK_MEM_UNMAPPED, reinterpret_cast<void*>(&NativeBackend::onUnmapped), this, 1, 0);
+      uc_hook_add(this->engine, &hook, UC_HOOK_MEM_WRITE_PROT, reinterpret_cast<void*>(&NativeBackend::onWrite), this, 1, 0);
+      uc_hook_add(this->engine, &hook, UC_HOOK_INTR, reinterpret_cast<void*>(&NativeBackend::onInterrupt), this, 1, 0);
+      if (arch == triton::arch::ARCH_X86_64)
+        uc_hook_add(this->engine, &hook, UC_HOOK_INSN, reinterpret_cast<void*>(&NativeBackend::onSyscall), this, 1, 0, UC_X86_INS_SYSCALL);
+    }
+
+
+    void NativeBackend::close(void) {
+      if (this->engine != nullptr)
+        uc_close(this->engine);
+
+      this->engine     = nullptr;
+      this->engineArch = triton::arch::ARCH_INVALID;
+      this->mapped.clear();
+      this->dirty.clear();
+    }
+
+
+    bool NativeBackend::isConcrete(void) const {
+      triton::arch::architecture_e arch = this->architecture->getArchitecture();
+
+      if (arch != triton::arch::ARCH_X86_64 && arch != triton::arch::ARCH_AARCH64)
+        return false;
+
+      /* Any register, the ones not copied to Unicorn included */
+      for (const triton::arch::Register* reg : this->architecture->getParentRegisters()) {
+        if (this->taintEngine->isRegisterTainted(*reg))
+          return false;
+        if (this->symbolicEngine->isEnabled() && this->symbolicEngine->isRegisterSymbolized(*reg))
+          return false;
+      }
+
+      return true;
+    }
+
+
+    void NativeBackend::loadRegisters(void) {
+      triton::uint8 buffer[triton::size::qqword];
+
+      for (const auto& native : getNativeRegisters(this->engineArch)) {
+        const triton::arch::Register& reg = this->architecture->getRegister(native.reg);
+        triton::uint512 value = this->architecture->getConcreteRegisterValue(reg, false);
+
+        for (triton::uint32 index = 0; index < reg.getSize(); index++)
+          buffer[index] = static_cast<triton::uint8>((value >> (index * 8)) & 0xff);
+
+        uc_reg_write(this->engine, native.uc, buffer);
+      }
+
+      if (this->engineArch == triton::arch::ARCH_AARCH64) {
+        triton::uint64 nzcv = 0;
+        nzcv |= static_cast<triton::uint64>(!this->architecture->getConcreteRegisterValue(this->architecture->getRegister(triton::arch::ID_REG_AARCH64_N), false).is_zero()) << 31;
+        nzcv |= static_cast<triton::uint64>(!this->architecture->getConcreteRegisterValue(this->architecture->getRegister(triton::arch::ID_REG_AARCH64_Z), false).is_zero()) << 30;
+        nzcv |= static_cast<triton::uint64>(!this->architecture->getConcreteRegisterValue(this->architecture->getRegister(triton::arch::ID_REG_AARCH64_C), false).is_zero()) << 29;
+        nzcv |= static_cast<triton::uint64>(!this->architecture->getConcreteRegisterValue(this->architecture->getRegister(triton::arch::ID_REG_AARCH64_V), false).is_zero()) << 28;
+        uc_reg_write(this->engine, UC_ARM64_REG_NZCV, &nzcv);
+      }
+    }
+
+
+    void NativeBackend::storeRegisters(void) {
+      triton::uint8 buffer[triton::size::qqword];
+
+      for (const auto& native : getNativeRegisters(this->engineArch)) {
+        const triton::arch::Register& reg = this->architecture->getRegister(native.reg);
+        triton::uint512 value = 0;
+
+        std::memset(buffer, 0, sizeof(buffer));
+        uc_reg_read(this->engine, native.uc, buffer);
+
+        for (triton::uint32 index = reg.getSize(); index > 0; index--)
+          value = (value << 8) | buffer[index - 1];
+
+        this->architecture->setConcreteRegisterValue(reg, value);
+      }
+
+      if (this->engineArch == triton::arch::ARCH_AARCH64) {
+        triton::uint64 nzcv = 0;
+        uc_reg_read(this->engine, UC_ARM64_REG_NZCV, &nzcv);
+        this->architecture->setConcreteRegisterValue(this->architecture->getRegister(triton::arch::ID_REG_AARCH64_N), (nzcv >> 31) & 1);
+        this->architecture->setConcreteRegisterValue(this->architecture->getRegister(triton::arch::ID_REG_AARCH64_Z), (nzcv >> 30) & 1);
+        this->architecture->setConcreteRegisterValue(this->architecture->getRegister(triton::arch::ID_REG_AARCH64_C), (nzcv >> 29) & 1);
+        this->architecture->setConcreteRegisterValue(this->architecture->getRegister(triton::arch::ID_REG_AARCH64_V), (nzcv >> 28) & 1);
+      }
+
+      /* No register was symbolized, their expressions only hold their old values */
+      this->symbolicEngine->concretizeAllRegister();
+    }
+
+
+    void NativeBackend::storeMemory(void) {
+      std::vector<triton::uint8> page(NATIVE_PAGE_SIZE);
+
+      for (triton::uint64 number : this->dirty) {
+        triton::uint64 addr = number << NATIVE_PAGE_BITS;
+        uc_mem_read(this->engine, addr, page.data(), page.size());
+        this->architecture->setConcreteMemoryAreaValue(addr, page.data(), page.size());
+        this->symbolicEngine->concretizeMemoryArea(addr, page.size());
+      }
+
+      for (triton::uint64 number : this->mapped)
+        uc_mem_unmap(this->engine, number << NATIVE_PAGE_BITS, NATIVE_PAGE_SIZE);
+
+      this->mapped.clear();
+      this->dirty.clear();
+    }
+
+
+    bool NativeBackend::mapPage(triton::uint64 number) {
+      triton::uint64 addr = number << NATIVE_PAGE_BITS;
+      std::vector<triton::uint8> page(NATIVE_PAGE_SIZE);
+
+      /* The symbolized and tainted bytes are only read by Triton */
+      if (this->symbolicEngine->isMemorySymbolized(addr, NATIVE_PAGE_SIZE) || this->taintEngine->isMemoryTainted(addr, NATIVE_PAGE_SIZE))
+        return false;
+
+      this->architecture->getConcreteMemoryAreaValue(addr, page.data(), page.size(), false);
+
+      /* Read only, so that the first write marks the page dirty */
+      if (uc_mem_map(this->engine, addr, NATIVE_PAGE_SIZE, UC_PROT_READ | UC_PROT_EXEC) != UC_ERR_OK)
+        return false;
+
+      uc_mem_write(this->engine, addr, page.data(), page.size());
+      this->mapped.insert(number);
+
+      return true;
+    }
+
+
+    void NativeBackend::onCode(struct uc_struct* uc, triton::uint64 addr, triton::uint32 size, void* user) {
+      NativeBackend* self = static_cast<NativeBackend*>(user);
+
+      /* The stops and the hooks are left to Triton */
+      if (self->count && (self->options->stops.count(addr) || self->options->hooks.count(addr))) {
+        uc_emu_stop(uc);
+        return;
+      }
+
+      self->last = addr;
+      self->count++;
+    }
+
+
+    bool NativeBackend::onUnmapped(struct uc_struct* uc, int type, triton::uint64 addr, int size, triton::sint64 value, void* user) {
+      NativeBackend* self = static_cast<NativeBackend*>(user);
+
+      try {
+        /* Undefined code is reported by Triton */
+        if (type == UC_MEM_FETCH_UNMAPPED && !self->architecture->isConcreteMemoryValueDefined(addr))
+          return false;
+
+        triton::uint64 firstPage = addr >> NATIVE_PAGE_BITS;
+        triton::uint64 lastPage  = (addr + (size ? size - 1 : 0)) >> NATIVE_PAGE_BITS;
+
+        for (triton::uint64 number = firstPage; number <= lastPage; number++) {
+          if (self->mapped.count(number) == 0 && !self->mapPage(number))
+            return false;
+        }
+      }
+      catch (...) {
+        self->error = std::current_exception();
+        return false;
+      }
+
+      /* The access is retried */
+      return true;
+    }
+
+
+    bool NativeBackend::onWrite(struct uc_struct* uc, int type, triton::uint64 addr, int size, triton::sint64 value, void* user) {
+      NativeBackend* self = static_cast<NativeBackend*>(user);
+
+      triton::uint64 firstPage = addr >> NATIVE_PAGE_BITS;
+      triton::uint64 lastPage  = (addr + (size ? size - 1 : 0)) >> NATIVE_PAGE_BITS;
+
+      for (triton::uint64 number = firstPage; number <= lastPage; number++) {
+        if (self->mapped.count(number) == 0)
+          return false;
+        uc_mem_protect(uc, number << NATIVE_PAGE_BITS, NATIVE_PAGE_SIZE, UC_PROT_ALL);
+        self->dirty.insert(number);
+      }
+
+      return true;
+    }
+
+
+    void NativeBackend::onSyscall(struct uc_struct* uc, void* user) {
+      NativeBackend* self = static_cast<NativeBackend*>(user);
+      self->interrupted = true;
+      uc_emu_stop(uc);
+    }
+
+
+    void NativeBackend::onInterrupt(struct uc_struct* uc, triton::uint32 intno, void* user) {
+      NativeBackend* self = static_cast<NativeBackend*>(user);
+      self->interrupted = true;
+      uc_emu_stop(uc);
+    }
+
+
+    triton::usize NativeBackend::run(triton::uint64& pc, const triton::arch::EmulationOptions& options, triton::usize limit) {
+      uc_err err = UC_ERR_OK;
+
+      this->open();
+
+      this->options     = &options;
+      this->first       = pc;
+      this->last        = pc;
+      this->count       = 0;
+      this->interrupted = false;
+      this->error       = nullptr;
+
+      this->loadRegisters();
+      err = uc_emu_start(this->engine, pc, std::numeric_limits<triton::uint64>::max(), 0, limit);
+
+      /*
+       * The instruction which stopped the run on an error, a syscall or an interrupt is
+       * started again by Triton, which gives it its semantics.
+       */
+      if (err != UC_ERR_OK || this->interrupted) {
+        triton::uint64 current = 0;
+        uc_reg_read(this->engine, (this->engineArch == triton::arch::ARCH_X86_64) ? static_cast<int>(UC_X86_REG_RIP) : static_cast<int>(UC_ARM64_REG_PC), &current);
+        if (this->count && (this->interrupted || current == this->last)) {
+          this->count--;
+          uc_reg_write(this->engine, (this->engineArch == triton::arch::ARCH_X86_64) ? static_cast<int>(UC_X86_REG_RIP) : static_cast<int>(UC_ARM64_REG_PC), &this->last);
+        }
+      }
+
+      this->storeRegisters();
+      this->storeMemory();
+      this->options = nullptr;
+
+      if (this->error)
+        std::rethrow_exception(this->error);
+
+      pc = this->architecture->getConcreteRegisterValue(this->architecture->getProgramCounter(), false).convert_to<triton::uint64>();
+      return this->count;
+    }
+
+  }; /* arch namespace */
+}; /* triton namespace */
@@ -5,6 +5,8 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <utility>
+
 #include <triton/exceptions.hpp>
 #include <triton/operandWrapper.hpp>
 
@@ -13,20 +15,26 @@
 namespace triton {
   namespace arch {
 
-    OperandWrapper::OperandWrapper(const triton::arch::Immediate& imm) {
-      this->imm  = imm;
+    OperandWrapper::OperandWrapper(const triton::arch::Immediate& imm)
+      : imm(imm) {
       this->type = triton::arch::OP_IMM;
     }
 
 
-    OperandWrapper::OperandWrapper(const triton::arch::MemoryAccess& mem) {
-      this->mem  = mem;
+    OperandWrapper::OperandWrapper(const triton::arch::MemoryAccess& mem)
+      : mem(mem) {
+      this->type = triton::arch::OP_MEM;
+    }
+
+
+    OperandWrapper::OperandWrapper(triton::arch::MemoryAccess&& mem) noexcept
+      : mem(std::move(mem)) {
       this->type = triton::arch::OP_MEM;
     }
 
 
-    OperandWrapper::OperandWrapper(const triton::arch::Register& reg) {
-      this->reg  = reg;
+    OperandWrapper::OperandWrapper(const triton::arch::Register& reg)
+      : reg(reg) {
       this->type = triton::arch::OP_REG;
     }
 
@@ -39,6 +47,14 @@ namespace triton {
     }
 
 
+    OperandWrapper::OperandWrapper(OperandWrapper&& other) noexcept
+      : imm(other.imm),
+        mem(std::move(other.mem)),
+        reg(other.reg) {
+      this->type = other.type;
+    }
+
+
     triton::arch::operand_e OperandWrapper::getType(void) const {
       return this->type;
     }
@@ -146,6 +162,15 @@ namespace triton {
     }
 
 
+    OperandWrapper& OperandWrapper::operator=(OperandWrapper&& other) noexcept {
+      this->imm  = other.imm;
+      this->mem  = std::move(other.mem);
+      this->reg  = other.reg;
+      this->type = other.type;
+      return *this;
+    }
+
+
     bool OperandWrapper::operator==(const OperandWrapper& other) const {
       if (this->type != other.type)
         return false;
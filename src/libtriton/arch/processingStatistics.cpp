@@ -0,0 +1,158 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+
+#include <triton/exceptions.hpp>
+#include <triton/processingStatistics.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+
+    ProcessingStatistics::ProcessingStatistics() {
+      this->enabled = false;
+      for (triton::usize index = 0; index < PHASE_LAST; index++)
+        this->depths[index] = 0;
+      this->clear();
+    }
+
+
+    void ProcessingStatistics::setEnabled(bool flag) {
+      this->enabled = flag;
+    }
+
+
+    void ProcessingStatistics::recordInstruction(triton::uint32 type, triton::uint64 address, bool controlFlow, triton::usize nodes, triton::usize expressions) {
+      OpcodeStatistics& opcode = this->opcodes[type];
+      OpcodeStatistics& instruction = this->addresses[address];
+
+      opcode.instructions++;
+      opcode.nodes       += nodes;
+      opcode.expressions += expressions;
+
+      instruction.instructions++;
+      instruction.nodes       += nodes;
+      instruction.expressions += expressions;
+
+      if (this->leader) {
+        this->block = address;
+        this->blocks[address].executions++;
+      }
+
+      BlockStatistics& block = this->blocks[this->block];
+      block.instructions++;
+      block.nodes += nodes;
+      this->leader = controlFlow;
+
+      this->instructions++;
+      this->nodes       += nodes;
+      this->expressions += expressions;
+    }
+
+
+    const PhaseStatistics& ProcessingStatistics::getPhase(triton::arch::phase_e phase) const {
+      if (phase >= PHASE_LAST)
+        throw triton::exceptions::Architecture("ProcessingStatistics::getPhase(): Invalid phase.");
+      return this->phases[phase];
+    }
+
+
+    const char* ProcessingStatistics::getPhaseName(triton::arch::phase_e phase) {
+      switch (phase) {
+        case PHASE_DISASSEMBLY:     return "disassembly";
+        case PHASE_PRE_IR_INIT:     return "preIrInit";
+        case PHASE_SEMANTICS:       return "semantics";
+        case PHASE_POST_IR_INIT:    return "postIrInit";
+        case PHASE_TAINT:           return "taint";
+        case PHASE_PATH_CONSTRAINT: return "pathConstraint";
+        case PHASE_CALLBACKS:       return "callbacks";
+        default:
+          throw triton::exceptions::Architecture("ProcessingStatistics::getPhaseName(): Invalid phase.");
+      }
+    }
+
+
+    triton::usize ProcessingStatistics::getInstructions(void) const {
+      return this->instructions;
+    }
+
+
+    triton::usize ProcessingStatistics::getNodes(void) const {
+      return this->nodes;
+    }
+
+
+    triton::usize ProcessingStatistics::getExpressions(void) const {
+      return this->expressions;
+    }
+
+
+    const std::unordered_map<triton::uint32, OpcodeStatistics>& ProcessingStatistics::getOpcodes(void) const {
+      return this->opcodes;
+    }
+
+
+    const std::unordered_map<triton::uint64, OpcodeStatistics>& ProcessingStatistics::getAddresses(void) const {
+      return this->addresses;
+    }
+
+
+    const std::unordered_map<triton::uint64, BlockStatistics>& ProcessingStatistics::getBlocks(void) const {
+      return this->blocks;
+    }
+
+
+    /* Returns the `n` greatest entries of `table` according to `greater`, ties broken by key */
+    template <typename K, typename V, typename F>
+    static std::vector<std::pair<K, V>> getTop(const std::unordered_map<K, V>& table, triton::usize n, F greater) {
+      std::vector<std::pair<K, V>> entries(table.begin(), table.end());
+      auto compare = [&](const std::pair<K, V>& a, const std::pair<K, V>& b) {
+        if (greater(a.second, b.second)) return true;
+        if (greater(b.second, a.second)) return false;
+        return a.first < b.first;
+      };
+
+      n = std::min(n, static_cast<triton::usize>(entries.size()));
+      std::partial_sort(entries.begin(), entries.begin() + n, entries.end(), compare);
+      entries.resize(n);
+      return entries;
+    }
+
+
+    std::vector<std::pair<triton::uint32, OpcodeStatistics>> ProcessingStatistics::getTopOpcodes(triton::usize n) const {
+      return getTop(this->opcodes, n, [](const OpcodeStatistics& a, const OpcodeStatistics& b) { return a.nodes > b.nodes; });
+    }
+
+
+    std::vector<std::pair<triton::uint64, OpcodeStatistics>> ProcessingStatistics::getTopAddresses(triton::usize n) const {
+      return getTop(this->addresses, n, [](const OpcodeStatistics& a, const OpcodeStatistics& b) { return a.instructions > b.instructions; });
+    }
+
+
+    std::vector<std::pair<triton::uint64, BlockStatistics>> ProcessingStatistics::getTopBlocks(triton::usize n) const {
+      return getTop(this->blocks, n, [](const BlockStatistics& a, const BlockStatistics& b) { return a.executions > b.executions; });
+    }
+
+
+    void ProcessingStatistics::clear(void) {
+      for (triton::usize index = 0; index < PHASE_LAST; index++)
+        this->phases[index] = PhaseStatistics();
+
+      this->instructions = 0;
+      this->nodes        = 0;
+      this->expressions  = 0;
+      this->block        = 0;
+      this->leader       = true;
+      this->opcodes.clear();
+      this->addresses.clear();
+      this->blocks.clear();
+    }
+
+  }; /* arch namespace */
+}; /* triton namespace */
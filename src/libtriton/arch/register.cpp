@@ -18,7 +18,7 @@ namespace triton {
     }
 
 
-    Register::Register(triton::arch::register_e regId, std::string name, triton::arch::register_e parent, triton::uint32 high, triton::uint32 low, bool vmutable)
+    Register::Register(triton::arch::register_e regId, const char* name, triton::arch::register_e parent, triton::uint32 high, triton::uint32 low, bool vmutable)
       : BitsVector(high, low),
         name(name),
         id(regId),
@@ -35,19 +35,7 @@ namespace triton {
     }
 
 
-    Register::Register(const Register& other)
-      : BitsVector(other),
-        ArmOperandProperties(other) {
-      this->copy(other);
-    }
-
-
-    void Register::copy(const Register& other) {
-      this->id       = other.id;
-      this->name     = other.name;
-      this->parent   = other.parent;
-      this->vmutable = other.vmutable;
-    }
+    Register::Register(const Register& other) = default;
 
 
     triton::arch::register_e Register::getId(void) const {
@@ -104,12 +92,7 @@ namespace triton {
     }
 
 
-    Register& Register::operator=(const Register& other) {
-      ArmOperandProperties::operator=(other);
-      BitsVector::operator=(other);
-      this->copy(other);
-      return *this;
-    }
+    Register& Register::operator=(const Register& other) = default;
 
 
     std::ostream& operator<<(std::ostream& stream, const Register& reg) {
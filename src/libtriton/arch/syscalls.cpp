@@ -0,0 +1,397 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+
+#include <triton/aarch64Specifications.hpp>
+#include <triton/api.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/syscalls.hpp>
+#include <triton/x86Specifications.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+
+    /* The errors and the flags of Linux, the same on x86-64 and AArch64 */
+    static const triton::uint64 LINUX_ENOENT    = 2;
+    static const triton::uint64 LINUX_EBADF     = 9;
+    static const triton::uint64 LINUX_EINVAL    = 22;
+    static const triton::uint64 LINUX_O_CREAT   = 0x40;
+    static const triton::uint64 LINUX_O_TRUNC   = 0x200;
+    static const triton::uint64 LINUX_O_APPEND  = 0x400;
+    static const triton::uint64 LINUX_MAP_FIXED = 0x10;
+    static const triton::uint64 LINUX_MAP_ANON  = 0x20;
+    static const triton::uint64 LINUX_PAGE_SIZE = 0x1000;
+
+
+    //! Returns the negative errno `err`.
+    static triton::uint64 error(triton::uint64 err) {
+      return static_cast<triton::uint64>(0) - err;
+    }
+
+
+    Syscalls::Syscalls() {
+      this->files["/dev/stdin"]  = File{{}, false};
+      this->files["/dev/stdout"] = File{{}, false};
+      this->files["/dev/stderr"] = File{{}, false};
+
+      this->descriptors[0] = Descriptor{"/dev/stdin",  0, false};
+      this->descriptors[1] = Descriptor{"/dev/stdout", 0, true};
+      this->descriptors[2] = Descriptor{"/dev/stderr", 0, true};
+
+      this->setLayout(0x10000000, 0x7f0000000000);
+    }
+
+
+    const std::map<triton::uint64, Syscalls::syscall_e>& Syscalls::getBuiltins(triton::arch::architecture_e arch) {
+      static const std::map<triton::uint64, syscall_e> x8664 = {
+        {0,   SYSCALL_READ},
+        {1,   SYSCALL_WRITE},
+        {2,   SYSCALL_OPEN},
+        {3,   SYSCALL_CLOSE},
+        {5,   SYSCALL_FSTAT},
+        {9,   SYSCALL_MMAP},
+        {12,  SYSCALL_BRK},
+        {60,  SYSCALL_EXIT},
+        {231, SYSCALL_EXIT},
+        {257, SYSCALL_OPENAT},
+      };
+
+      static const std::map<triton::uint64, syscall_e> aarch64 = {
+        {56,  SYSCALL_OPENAT},
+        {57,  SYSCALL_CLOSE},
+        {63,  SYSCALL_READ},
+        {64,  SYSCALL_WRITE},
+        {80,  SYSCALL_FSTAT},
+        {93,  SYSCALL_EXIT},
+        {94,  SYSCALL_EXIT},
+        {214, SYSCALL_BRK},
+        {222, SYSCALL_MMAP},
+      };
+
+      switch (arch) {
+        case triton::arch::ARCH_X86_64:  return x8664;
+        case triton::arch::ARCH_AARCH64: return aarch64;
+        default:
+          throw triton::exceptions::Syscalls("Syscalls::getBuiltins(): Architecture not supported.");
+      }
+    }
+
+
+    bool Syscalls::isSyscall(const triton::arch::Instruction& inst, triton::arch::architecture_e arch) {
+      switch (arch) {
+        case triton::arch::ARCH_X86_64:  return (inst.getType() == triton::arch::x86::ID_INS_SYSCALL);
+        case triton::arch::ARCH_AARCH64: return (inst.getType() == triton::arch::arm::aarch64::ID_INS_SVC);
+        default:
+          return false;
+      }
+    }
+
+
+    void Syscalls::setHandler(triton::uint64 number, const triton::arch::SyscallHandler& handler) {
+      if (!handler)
+        throw triton::exceptions::Syscalls("Syscalls::setHandler(): The handler must be defined.");
+
+      this->handlers[number] = handler;
+    }
+
+
+    void Syscalls::removeHandler(triton::uint64 number) {
+      this->handlers.erase(number);
+    }
+
+
+    void Syscalls::setFile(const std::string& path, const std::vector<triton::uint8>& content, bool symbolize) {
+      this->files[path] = File{content, symbolize};
+
+      /* The opened descriptors read the new content from the start */
+      for (auto& it : this->descriptors) {
+        if (it.second.path == path)
+          it.second.offset = 0;
+      }
+    }
+
+
+    const std::vector<triton::uint8>& Syscalls::getFile(const std::string& path) const {
+      auto it = this->files.find(path);
+
+      if (it == this->files.end())
+        throw triton::exceptions::Syscalls("Syscalls::getFile(): No such file.");
+
+      return it->second.content;
+    }
+
+
+    void Syscalls::setLayout(triton::uint64 heap, triton::uint64 mmap) {
+      if ((heap | mmap) & (LINUX_PAGE_SIZE - 1))
+        throw triton::exceptions::Syscalls("Syscalls::setLayout(): The addresses must be aligned on a page.");
+
+      this->heap         = heap;
+      this->programBreak = heap;
+      this->nextMapping  = mmap;
+    }
+
+
+    Syscalls::Descriptor* Syscalls::getDescriptor(triton::uint64 fd) {
+      auto it = this->descriptors.find(fd);
+
+      if (it == this->descriptors.end())
+        return nullptr;
+
+      return &it->second;
+    }
+
+
+    std::string Syscalls::getString(triton::API& api, triton::uint64 addr) const {
+      std::string ret;
+
+      /* Bounded by PATH_MAX */
+      while (ret.size() < 4096) {
+        triton::uint8 c = api.getConcreteMemoryValue(addr + ret.size());
+        if (c == 0)
+          break;
+        ret.push_back(static_cast<char>(c));
+      }
+
+      return ret;
+    }
+
+
+    void Syscalls::load(triton::API& api, triton::uint64 addr, const triton::uint8* content, triton::usize size, bool symbolize) const {
+      if (size == 0)
+        return;
+
+      api.setConcreteMemoryAreaValue(addr, content, size);
+
+      /* The bytes are symbolized at once, instead of one callback per byte */
+      if (symbolize && api.isSymbolicEngineEnabled())
+        api.symbolizeMemoryArea(addr, size);
+      else
+        api.concretizeMemoryArea(addr, size);
+    }
+
+
+    triton::uint64 Syscalls::brkSyscall(triton::API&, triton::arch::Syscall& call) {
+      /* An address below the heap queries the program break */
+      if (call.args[0] >= this->heap)
+        this->programBreak = call.args[0];
+
+      return this->programBreak;
+    }
+
+
+    triton::uint64 Syscalls::closeSyscall(triton::API&, triton::arch::Syscall& call) {
+      if (this->descriptors.erase(call.args[0]) == 0)
+        return error(LINUX_EBADF);
+
+      return 0;
+    }
+
+
+    triton::uint64 Syscalls::fstatSyscall(triton::API& api, triton::arch::Syscall& call) {
+      Descriptor* desc = this->getDescriptor(call.args[0]);
+
+      if (desc == nullptr)
+        return error(LINUX_EBADF);
+
+      /* The devices are character devices, the other files are regular ones */
+      bool device = (desc->path.compare(0, 5, "/dev/") == 0);
+      triton::uint64 mode = device ? 0020620 : 0100644;
+      triton::uint64 size = this->files[desc->path].content.size();
+
+      /* The offsets of st_mode, st_size and st_blksize in the struct stat of the architecture */
+      triton::usize length = 0, modeOffset = 0, blksizeOffset = 0, blksizeSize = 0;
+      switch (api.getArchitecture()) {
+        case triton::arch::ARCH_X86_64:  length = 144; modeOffset = 24; blksizeOffset = 56; blksizeSize = 8; break;
+        case triton::arch::ARCH_AARCH64: length = 128; modeOffset = 16; blksizeOffset = 56; blksizeSize = 4; break;
+        default:
+          throw triton::exceptions::Syscalls("Syscalls::fstatSyscall(): Architecture not supported.");
+      }
+
+      std::vector<triton::uint8> buf(length, 0);
+      auto put = [&buf](triton::usize offset, triton::uint64 value, triton::usize bytes) {
+        for (triton::usize index = 0; index < bytes; index++)
+          buf[offset + index] = static_cast<triton::uint8>(value >> (index * 8));
+      };
+
+      put(modeOffset, mode, 4);
+      put(48, size, 8);
+      put(blksizeOffset, LINUX_PAGE_SIZE, blksizeSize);
+
+      this->load(api, call.args[1], buf.data(), buf.size(), false);
+      return 0;
+    }
+
+
+    triton::uint64 Syscalls::mmapSyscall(triton::API& api, triton::arch::Syscall& call) {
+      triton::uint64 length = call.args[1];
+      triton::uint64 flags  = call.args[3];
+      triton::uint64 size   = (length + LINUX_PAGE_SIZE - 1) & ~(LINUX_PAGE_SIZE - 1);
+      const File* file      = nullptr;
+      triton::uint64 base   = 0;
+
+      if (length == 0 || size < length)
+        return error(LINUX_EINVAL);
+
+      if ((flags & LINUX_MAP_ANON) == 0) {
+        Descriptor* desc = this->getDescriptor(call.args[4]);
+        if (desc == nullptr)
+          return error(LINUX_EBADF);
+        file = &this->files[desc->path];
+      }
+
+      /* A fixed mapping replaces the memory, the other ones are taken from memory never mapped, which is zero */
+      if (flags & LINUX_MAP_FIXED) {
+        if (call.args[0] & (LINUX_PAGE_SIZE - 1))
+          return error(LINUX_EINVAL);
+        base = call.args[0];
+        std::vector<triton::uint8> zeros(size, 0);
+        this->load(api, base, zeros.data(), zeros.size(), false);
+      }
+      else {
+        base = this->nextMapping;
+        this->nextMapping += size;
+      }
+
+      if (file != nullptr && call.args[5] < file->content.size()) {
+        triton::usize count = std::min<triton::uint64>(length, file->content.size() - call.args[5]);
+        this->load(api, base, file->content.data() + call.args[5], count, file->symbolize);
+      }
+
+      return base;
+    }
+
+
+    triton::uint64 Syscalls::openSyscall(triton::API& api, triton::arch::Syscall& call, triton::uint32 path) {
+      std::string name = this->getString(api, call.args[path]);
+      triton::uint64 flags = call.args[path + 1];
+      triton::uint64 fd = 0;
+
+      auto it = this->files.find(name);
+      if (it == this->files.end()) {
+        if ((flags & LINUX_O_CREAT) == 0)
+          return error(LINUX_ENOENT);
+        it = this->files.emplace(name, File{{}, false}).first;
+      }
+
+      if (flags & LINUX_O_TRUNC)
+        it->second.content.clear();
+
+      /* The lowest descriptor not opened */
+      while (this->descriptors.find(fd) != this->descriptors.end())
+        fd++;
+
+      this->descriptors[fd] = Descriptor{name, 0, (flags & LINUX_O_APPEND) != 0};
+      return fd;
+    }
+
+
+    triton::uint64 Syscalls::readSyscall(triton::API& api, triton::arch::Syscall& call) {
+      Descriptor* desc = this->getDescriptor(call.args[0]);
+
+      if (desc == nullptr)
+        return error(LINUX_EBADF);
+
+      const File& file = this->files[desc->path];
+      if (desc->offset >= file.content.size())
+        return 0;
+
+      triton::usize count = std::min<triton::uint64>(call.args[2], file.content.size() - desc->offset);
+      this->load(api, call.args[1], file.content.data() + desc->offset, count, file.symbolize);
+      desc->offset += count;
+
+      return count;
+    }
+
+
+    triton::uint64 Syscalls::writeSyscall(triton::API& api, triton::arch::Syscall& call) {
+      Descriptor* desc = this->getDescriptor(call.args[0]);
+
+      if (desc == nullptr)
+        return error(LINUX_EBADF);
+
+      File& file = this->files[desc->path];
+      std::vector<triton::uint8> data = api.getConcreteMemoryAreaValue(call.args[1], call.args[2]);
+
+      if (desc->append)
+        desc->offset = file.content.size();
+
+      if (file.content.size() < desc->offset + data.size())
+        file.content.resize(desc->offset + data.size());
+
+      std::copy(data.begin(), data.end(), file.content.begin() + desc->offset);
+      desc->offset += data.size();
+
+      return data.size();
+    }
+
+
+    bool Syscalls::execute(triton::API& api, triton::arch::Syscall& call) {
+      static const triton::arch::register_e x8664[] = {
+        triton::arch::ID_REG_X86_RDI, triton::arch::ID_REG_X86_RSI, triton::arch::ID_REG_X86_RDX,
+        triton::arch::ID_REG_X86_R10, triton::arch::ID_REG_X86_R8,  triton::arch::ID_REG_X86_R9
+      };
+      static const triton::arch::register_e aarch64[] = {
+        triton::arch::ID_REG_AARCH64_X0, triton::arch::ID_REG_AARCH64_X1, triton::arch::ID_REG_AARCH64_X2,
+        triton::arch::ID_REG_AARCH64_X3, triton::arch::ID_REG_AARCH64_X4, triton::arch::ID_REG_AARCH64_X5
+      };
+
+      const triton::arch::register_e* args = nullptr;
+      triton::arch::register_e number = triton::arch::ID_REG_INVALID;
+      triton::arch::register_e ret = triton::arch::ID_REG_INVALID;
+
+      switch (api.getArchitecture()) {
+        case triton::arch::ARCH_X86_64:  args = x8664;   number = triton::arch::ID_REG_X86_RAX;    ret = triton::arch::ID_REG_X86_RAX;   break;
+        case triton::arch::ARCH_AARCH64: args = aarch64; number = triton::arch::ID_REG_AARCH64_X8; ret = triton::arch::ID_REG_AARCH64_X0; break;
+        default:
+          throw triton::exceptions::Syscalls("Syscalls::execute(): Architecture not supported.");
+      }
+
+      call = Syscall();
+      call.number = api.getConcreteRegisterValue(api.getRegister(number)).convert_to<triton::uint64>();
+      for (triton::usize index = 0; index < call.args.size(); index++)
+        call.args[index] = api.getConcreteRegisterValue(api.getRegister(args[index])).convert_to<triton::uint64>();
+
+      /* The handlers of the user come first */
+      auto handler = this->handlers.find(call.number);
+      if (handler != this->handlers.end()) {
+        handler->second(api, call);
+      }
+      else {
+        const auto& builtins = getBuiltins(api.getArchitecture());
+        auto builtin = builtins.find(call.number);
+
+        if (builtin == builtins.end())
+          return false;
+
+        switch (builtin->second) {
+          case SYSCALL_BRK:    call.ret = this->brkSyscall(api, call);      break;
+          case SYSCALL_CLOSE:  call.ret = this->closeSyscall(api, call);    break;
+          case SYSCALL_EXIT:   call.ret = call.args[0]; call.exit = true;   break;
+          case SYSCALL_FSTAT:  call.ret = this->fstatSyscall(api, call);    break;
+          case SYSCALL_MMAP:   call.ret = this->mmapSyscall(api, call);     break;
+          case SYSCALL_OPEN:   call.ret = this->openSyscall(api, call, 0);  break;
+          case SYSCALL_OPENAT: call.ret = this->openSyscall(api, call, 1);  break;
+          case SYSCALL_READ:   call.ret = this->readSyscall(api, call);     break;
+          case SYSCALL_WRITE:  call.ret = this->writeSyscall(api, call);    break;
+        }
+      }
+
+      /* The return value is concrete */
+      if (!call.exit) {
+        const triton::arch::Register& reg = api.getRegister(ret);
+        api.setConcreteRegisterValue(reg, call.ret);
+        api.concretizeRegister(reg);
+      }
+
+      return true;
+    }
+
+  }; /* arch namespace */
+}; /* triton namespace */
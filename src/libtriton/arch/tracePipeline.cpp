@@ -0,0 +1,163 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <limits>
+#include <thread>
+#include <vector>
+
+#include <triton/exceptions.hpp>
+#include <triton/tracePipeline.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+
+    TracePipeline::TracePipeline(triton::arch::TraceReader& reader, const Decoder& decoder, triton::usize decoders)
+      : reader(reader), decoder(decoder) {
+      this->decoders = decoders;
+      this->total    = std::numeric_limits<triton::uint64>::max();
+      this->stopped  = false;
+
+      if (decoders) {
+        this->slots.reset(new(std::nothrow) Slot[capacity]);
+        if (this->slots == nullptr)
+          throw triton::exceptions::Architecture("TracePipeline::TracePipeline(): Not enough memory.");
+
+        for (triton::usize i = 0; i < capacity; i++) {
+          this->slots[i].decoded     = false;
+          this->slots[i].readSeq     = 0;
+          this->slots[i].decodedSeq  = 0;
+          this->slots[i].consumedSeq = 0;
+        }
+      }
+    }
+
+
+    bool TracePipeline::wait(const std::atomic<triton::uint64>& value, triton::uint64 seq) const {
+      while (value.load(std::memory_order_acquire) != seq + 1) {
+        if (this->stopped.load(std::memory_order_relaxed))
+          return false;
+        /* The trace ended, the value may have been published meanwhile */
+        if (this->total.load(std::memory_order_acquire) <= seq)
+          return value.load(std::memory_order_acquire) == seq + 1;
+        std::this_thread::yield();
+      }
+      return true;
+    }
+
+
+    void TracePipeline::readStage(void) {
+      triton::uint64 seq = 0;
+
+      try {
+        for (;; seq++) {
+          Slot& slot = this->slots[seq % capacity];
+
+          /* The slot is free once its previous record is consumed */
+          if (seq >= capacity && !this->wait(slot.consumedSeq, seq - capacity))
+            return;
+
+          if (!this->reader.next(slot.record))
+            break;
+
+          slot.inst.reset(slot.record.address, slot.record.opcode.data(), static_cast<triton::uint32>(slot.record.opcode.size()));
+          slot.inst.setThreadId(slot.record.thread);
+          slot.decoded = false;
+          slot.error   = nullptr;
+          slot.readSeq.store(seq + 1, std::memory_order_release);
+        }
+      }
+      catch (...) {
+        this->readError = std::current_exception();
+      }
+
+      this->total.store(seq, std::memory_order_release);
+    }
+
+
+    void TracePipeline::decodeStage(triton::usize first) {
+      for (triton::uint64 seq = first;; seq += this->decoders) {
+        Slot& slot = this->slots[seq % capacity];
+
+        if (!this->wait(slot.readSeq, seq))
+          return;
+
+        try {
+          slot.decoded = this->decoder(slot.inst);
+        }
+        catch (...) {
+          slot.error = std::current_exception();
+        }
+
+        slot.decodedSeq.store(seq + 1, std::memory_order_release);
+      }
+    }
+
+
+    triton::usize TracePipeline::runSequential(const Consumer& consumer) {
+      triton::arch::TraceRecord record;
+      triton::arch::Instruction inst;
+      triton::usize count = 0;
+
+      while (this->reader.next(record)) {
+        inst.reset(record.address, record.opcode.data(), static_cast<triton::uint32>(record.opcode.size()));
+        inst.setThreadId(record.thread);
+        consumer(record, inst, false);
+        count++;
+      }
+
+      return count;
+    }
+
+
+    triton::usize TracePipeline::run(const Consumer& consumer) {
+      std::vector<std::thread> threads;
+      triton::uint64 seq = 0;
+
+      if (this->decoders == 0)
+        return this->runSequential(consumer);
+
+      auto stop = [&]() {
+        this->stopped.store(true);
+        for (auto& thread : threads)
+          thread.join();
+      };
+
+      try {
+        threads.emplace_back(&TracePipeline::readStage, this);
+        for (triton::usize k = 0; k < this->decoders; k++)
+          threads.emplace_back(&TracePipeline::decodeStage, this, k);
+
+        for (;; seq++) {
+          Slot& slot = this->slots[seq % capacity];
+
+          if (!this->wait(slot.decodedSeq, seq))
+            break;
+
+          if (slot.error)
+            std::rethrow_exception(slot.error);
+
+          consumer(slot.record, slot.inst, slot.decoded);
+          slot.consumedSeq.store(seq + 1, std::memory_order_release);
+        }
+      }
+      catch (...) {
+        stop();
+        throw;
+      }
+
+      stop();
+
+      if (this->readError)
+        std::rethrow_exception(this->readError);
+
+      return seq;
+    }
+
+  };
+};
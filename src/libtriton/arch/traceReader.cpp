@@ -0,0 +1,369 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <cctype>
+#include <cstring>
+#include <limits>
+#include <sstream>
+
+#include <triton/exceptions.hpp>
+#include <triton/traceReader.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+
+    /* Returns the value of an hexadecimal digit, or -1 */
+    static int hexDigit(char c) {
+      if (c >= '0' && c <= '9') return c - '0';
+      if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+      if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+      return -1;
+    }
+
+
+    /* Throws an error of the trace at a position */
+    [[noreturn]] static void invalid(const char* what, triton::usize position) {
+      throw triton::exceptions::Architecture(std::string("TraceReader::next(): ") + what + " (position " + std::to_string(position) + ").");
+    }
+
+
+    /* Parses an hexadecimal integer, with or without the 0x prefix */
+    static triton::uint512 parseInteger(const std::string& str, triton::usize position) {
+      triton::uint512 value = 0;
+      triton::usize index = 0;
+
+      if (str.size() > 2 && str[0] == '0' && (str[1] == 'x' || str[1] == 'X'))
+        index = 2;
+
+      if (index == str.size() || str.size() - index > 128)
+        invalid("Invalid integer", position);
+
+      for (; index < str.size(); index++) {
+        int digit = hexDigit(str[index]);
+        if (digit < 0)
+          invalid("Invalid integer", position);
+        value = (value << 4) | digit;
+      }
+
+      return value;
+    }
+
+
+    /* Parses hexadecimal bytes */
+    static std::vector<triton::uint8> parseBytes(const std::string& str, triton::usize position) {
+      std::vector<triton::uint8> bytes;
+
+      if (str.empty() || str.size() % 2)
+        invalid("Invalid bytes", position);
+
+      bytes.reserve(str.size() / 2);
+      for (triton::usize index = 0; index < str.size(); index += 2) {
+        int high = hexDigit(str[index]);
+        int low  = hexDigit(str[index + 1]);
+        if (high < 0 || low < 0)
+          invalid("Invalid bytes", position);
+        bytes.push_back(static_cast<triton::uint8>((high << 4) | low));
+      }
+
+      return bytes;
+    }
+
+
+    /* Reads a little-endian integer, returns false at the end of the stream */
+    static bool get(std::istream& stream, triton::usize bytes, triton::uint64& value) {
+      value = 0;
+      for (triton::usize index = 0; index < bytes; index++) {
+        int c = stream.get();
+        if (c == std::char_traits<char>::eof())
+          return false;
+        value |= static_cast<triton::uint64>(c & 0xff) << (index * 8);
+      }
+      return true;
+    }
+
+
+    /* Reads a little-endian integer */
+    static triton::uint64 load(const triton::uint8* bytes, triton::usize size) {
+      triton::uint64 value = 0;
+      for (triton::usize index = 0; index < size; index++)
+        value |= static_cast<triton::uint64>(bytes[index]) << (index * 8);
+      return value;
+    }
+
+
+    /* A read-only stream over the memory of a trace */
+    class TraceStreamBuf : public std::streambuf {
+      public:
+        TraceStreamBuf(const triton::uint8* data, triton::usize size) {
+          char* begin = const_cast<char*>(reinterpret_cast<const char*>(data));
+          this->setg(begin, begin, begin + size);
+        }
+    };
+
+
+    TraceReader::TraceReader(std::istream& stream, triton::arch::trace_e format)
+      : stream(&stream), data(nullptr), size(0), offset(0), format(format), position(0), remaining(std::numeric_limits<triton::usize>::max()) {
+      if (format != triton::arch::TRACE_BINARY && format != triton::arch::TRACE_COMPACT && format != triton::arch::TRACE_TEXT)
+        throw triton::exceptions::Architecture("TraceReader::TraceReader(): Invalid format of trace.");
+
+      if (format == triton::arch::TRACE_COMPACT)
+        this->readHeader();
+    }
+
+
+    TraceReader::TraceReader(const triton::uint8* data, triton::usize size, triton::arch::trace_e format)
+      : stream(nullptr), data(data), size(size), offset(0), format(format), position(0), remaining(std::numeric_limits<triton::usize>::max()) {
+      if (format != triton::arch::TRACE_BINARY && format != triton::arch::TRACE_COMPACT && format != triton::arch::TRACE_TEXT)
+        throw triton::exceptions::Architecture("TraceReader::TraceReader(): Invalid format of trace.");
+
+      if (data == nullptr && size != 0)
+        throw triton::exceptions::Architecture("TraceReader::TraceReader(): Invalid trace.");
+
+      /* The compact records are read in place, the other formats through a stream */
+      if (format == triton::arch::TRACE_COMPACT) {
+        this->readHeader();
+      }
+      else {
+        this->buffer.reset(new TraceStreamBuf(data, size));
+        this->owned.reset(new std::istream(this->buffer.get()));
+        this->stream = this->owned.get();
+      }
+    }
+
+
+    const triton::uint8* TraceReader::take(triton::usize bytes) {
+      if (this->stream == nullptr) {
+        if (bytes > this->size - this->offset)
+          return nullptr;
+        const triton::uint8* ptr = this->data + this->offset;
+        this->offset += bytes;
+        return ptr;
+      }
+
+      this->scratch.resize(bytes);
+      if (bytes && !this->stream->read(reinterpret_cast<char*>(this->scratch.data()), bytes))
+        return nullptr;
+
+      return this->scratch.data();
+    }
+
+
+    void TraceReader::readHeader(void) {
+      const triton::uint8* header = this->take(5);
+
+      if (header == nullptr || std::memcmp(header, "TTRC", 4) != 0)
+        throw triton::exceptions::Architecture("TraceReader::TraceReader(): Invalid header of compact trace.");
+
+      if (header[4] != 1)
+        throw triton::exceptions::Architecture("TraceReader::TraceReader(): Unsupported version of compact trace.");
+    }
+
+
+    bool TraceReader::next(TraceRecord& record) {
+      record.opcode.clear();
+      record.thread = 0;
+      record.registers.clear();
+      record.registerIds.clear();
+      record.memory.clear();
+      record.writes.clear();
+
+      if (this->remaining == 0)
+        return false;
+
+      bool found = false;
+      if (this->format == triton::arch::TRACE_BINARY)
+        found = this->nextBinary(record);
+      else if (this->format == triton::arch::TRACE_COMPACT)
+        found = this->nextCompact(record);
+      else
+        found = this->nextText(record);
+
+      if (found)
+        this->remaining--;
+
+      return found;
+    }
+
+
+    triton::usize TraceReader::skip(triton::usize count) {
+      TraceRecord record;
+      triton::usize skipped = 0;
+
+      while (skipped < count && this->next(record))
+        skipped++;
+
+      return skipped;
+    }
+
+
+    void TraceReader::setLimit(triton::usize count) {
+      this->remaining = count;
+    }
+
+
+    bool TraceReader::nextBinary(TraceRecord& record) {
+      triton::uint64 value = 0;
+
+      /* The trace may only end between two records */
+      if (this->stream->peek() == std::char_traits<char>::eof())
+        return false;
+
+      this->position++;
+
+      auto read = [&](triton::usize bytes) {
+        if (!get(*this->stream, bytes, value))
+          invalid("Truncated trace", this->position);
+        return value;
+      };
+
+      auto readBytes = [&](triton::usize size, std::vector<triton::uint8>& bytes) {
+        bytes.resize(size);
+        if (size && !this->stream->read(reinterpret_cast<char*>(bytes.data()), size))
+          invalid("Truncated trace", this->position);
+      };
+
+      record.address = read(8);
+      readBytes(static_cast<triton::usize>(read(1)), record.opcode);
+
+      triton::usize registers = static_cast<triton::usize>(read(1));
+      for (triton::usize index = 0; index < registers; index++) {
+        std::vector<triton::uint8> name;
+        std::vector<triton::uint8> bytes;
+        triton::uint512 reg = 0;
+
+        readBytes(static_cast<triton::usize>(read(1)), name);
+        readBytes(static_cast<triton::usize>(read(1)), bytes);
+        if (bytes.size() > 64)
+          invalid("Invalid size of register value", this->position);
+
+        for (auto it = bytes.rbegin(); it != bytes.rend(); it++)
+          reg = (reg << 8) | *it;
+
+        record.registers.push_back({std::string(name.begin(), name.end()), reg});
+      }
+
+      triton::usize areas = static_cast<triton::usize>(read(1));
+      for (triton::usize index = 0; index < areas; index++) {
+        std::vector<triton::uint8> bytes;
+        triton::uint64 addr = read(8);
+        readBytes(static_cast<triton::usize>(read(2)), bytes);
+        record.memory.push_back({addr, std::move(bytes)});
+      }
+
+      return true;
+    }
+
+
+    bool TraceReader::nextCompact(TraceRecord& record) {
+      /* The trace may only end between two records */
+      if (this->stream == nullptr ? this->offset == this->size : this->stream->peek() == std::char_traits<char>::eof())
+        return false;
+
+      this->position++;
+
+      auto read = [&](triton::usize bytes) {
+        const triton::uint8* ptr = this->take(bytes);
+        if (ptr == nullptr)
+          invalid("Truncated trace", this->position);
+        return ptr;
+      };
+
+      auto readAreas = [&](std::vector<std::pair<triton::uint64, std::vector<triton::uint8>>>& areas) {
+        triton::usize count = read(1)[0];
+        areas.reserve(count);
+        for (triton::usize index = 0; index < count; index++) {
+          triton::uint64 addr = load(read(8), 8);
+          triton::usize size  = read(1)[0];
+          const triton::uint8* bytes = read(size);
+          areas.push_back({addr, std::vector<triton::uint8>(bytes, bytes + size)});
+        }
+      };
+
+      record.address = load(read(8), 8);
+      record.thread  = static_cast<triton::uint32>(load(read(4), 4));
+
+      triton::usize size = read(1)[0];
+      const triton::uint8* opcode = read(size);
+      record.opcode.assign(opcode, opcode + size);
+
+      triton::usize registers = read(1)[0];
+      record.registerIds.reserve(registers);
+      for (triton::usize index = 0; index < registers; index++) {
+        triton::uint64 id = load(read(2), 2);
+        triton::usize bytes = read(1)[0];
+        triton::uint512 reg = 0;
+
+        if (id == triton::arch::ID_REG_INVALID || id >= triton::arch::ID_REG_LAST_ITEM)
+          invalid("Invalid register", this->position);
+
+        if (bytes > 64)
+          invalid("Invalid size of register value", this->position);
+
+        const triton::uint8* value = read(bytes);
+        for (triton::usize byte = bytes; byte > 0; byte--)
+          reg = (reg << 8) | value[byte - 1];
+
+        record.registerIds.push_back({static_cast<triton::arch::register_e>(id), reg});
+      }
+
+      readAreas(record.memory);
+      readAreas(record.writes);
+
+      return true;
+    }
+
+
+    bool TraceReader::nextText(TraceRecord& record) {
+      std::string line;
+
+      while (std::getline(*this->stream, line)) {
+        std::istringstream fields(line);
+        std::string field;
+
+        this->position++;
+
+        /* Empty lines and comments are ignored */
+        if (!(fields >> field) || field[0] == '#')
+          continue;
+
+        record.address = static_cast<triton::uint64>(parseInteger(field, this->position));
+
+        if (!(fields >> field))
+          invalid("Missing opcode", this->position);
+        record.opcode = parseBytes(field, this->position);
+
+        while (fields >> field) {
+          auto equal = field.find('=');
+          if (equal == std::string::npos || equal == 0)
+            invalid("Invalid assignment", this->position);
+
+          std::string left  = field.substr(0, equal);
+          std::string right = field.substr(equal + 1);
+
+          if (left.front() == '[') {
+            if (left.size() < 3 || left.back() != ']')
+              invalid("Invalid memory assignment", this->position);
+            triton::uint64 addr = static_cast<triton::uint64>(parseInteger(left.substr(1, left.size() - 2), this->position));
+            record.memory.push_back({addr, parseBytes(right, this->position)});
+          }
+          else {
+            for (auto& c : left)
+              c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+            record.registers.push_back({left, parseInteger(right, this->position)});
+          }
+        }
+
+        return true;
+      }
+
+      return false;
+    }
+
+  }; /* arch namespace */
+}; /* triton namespace */
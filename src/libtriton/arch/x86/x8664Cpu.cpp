@@ -9,6 +9,7 @@
 #include <cstring>
 
 #include <triton/architecture.hpp>
+#include <triton/capstonePool.hpp>
 #include <triton/coreUtils.hpp>
 #include <triton/cpuSize.hpp>
 #include <triton/exceptions.hpp>
@@ -23,7 +24,6 @@ namespace triton {
 
       x8664Cpu::x8664Cpu(triton::callbacks::Callbacks* callbacks) : x86Specifications(ARCH_X86_64) {
         this->callbacks = callbacks;
-        this->handle    = 0;
 
         this->clear();
         this->disassInit();
@@ -37,28 +37,25 @@ namespace triton {
 
       x8664Cpu::~x8664Cpu() {
         this->memory.clear();
-        if (this->handle) {
-          triton::extlibs::capstone::cs_close(&this->handle);
-        }
       }
 
 
       void x8664Cpu::disassInit(void) {
-        if (this->handle) {
-          triton::extlibs::capstone::cs_close(&this->handle);
-        }
+        this->disassembler = triton::arch::CapstonePool::get(triton::extlibs::capstone::CS_ARCH_X86, triton::extlibs::capstone::CS_MODE_64, triton::extlibs::capstone::CS_OPT_SYNTAX_INTEL);
+      }
+
 
-        if (triton::extlibs::capstone::cs_open(triton::extlibs::capstone::CS_ARCH_X86, triton::extlibs::capstone::CS_MODE_64, &this->handle) != triton::extlibs::capstone::CS_ERR_OK)
-          throw triton::exceptions::Disassembly("x8664Cpu::disassInit(): Cannot open capstone.");
+      void x8664Cpu::copy(const x8664Cpu& other) {
+        this->callbacks    = other.callbacks;
+        this->memory       = other.memory;
+        this->disassembler = other.disassembler;
 
-        triton::extlibs::capstone::cs_option(this->handle, triton::extlibs::capstone::CS_OPT_DETAIL, triton::extlibs::capstone::CS_OPT_ON);
-        triton::extlibs::capstone::cs_option(this->handle, triton::extlibs::capstone::CS_OPT_SYNTAX, triton::extlibs::capstone::CS_OPT_SYNTAX_INTEL);
+        this->copyRegisters(other);
       }
 
 
-      void x8664Cpu::copy(const x8664Cpu& other) {
-        this->callbacks = other.callbacks;
-        this->memory    = other.memory;
+      void x8664Cpu::copyRegisters(const triton::arch::CpuInterface& cpu) {
+        const x8664Cpu& other = dynamic_cast<const x8664Cpu&>(cpu);
 
         std::memcpy(this->rax,        other.rax,        sizeof(this->rax));
         std::memcpy(this->rbx,        other.rbx,        sizeof(this->rbx));
@@ -160,6 +157,13 @@ namespace triton {
       }
 
 
+      void x8664Cpu::copyState(const triton::arch::CpuInterface& other) {
+        triton::callbacks::Callbacks* callbacks = this->callbacks;
+        this->copy(dynamic_cast<const x8664Cpu&>(other));
+        this->callbacks = callbacks;
+      }
+
+
       void x8664Cpu::clear(void) {
         /* Clear memory */
         this->memory.clear();
@@ -442,11 +446,9 @@ namespace triton {
 
 
       const triton::arch::Register& x8664Cpu::getRegister(triton::arch::register_e id) const {
-        try {
-          return this->id2reg.at(id);
-        } catch (const std::out_of_range&) {
+        if (static_cast<triton::uint32>(id) >= triton::arch::ID_REG_LAST_ITEM || this->regIndex[id] == nullptr)
           throw triton::exceptions::Cpu("x8664Cpu::getRegister(): Invalid register for this architecture.");
-        }
+        return *this->regIndex[id];
       }
 
 
@@ -482,8 +484,6 @@ namespace triton {
 
 
       void x8664Cpu::disassembly(triton::arch::Instruction& inst) {
-        triton::extlibs::capstone::cs_insn* insn;
-        triton::usize count = 0;
 
         /* Check if the opcode and opcode' size are defined */
         if (inst.getOpcode() == nullptr || inst.getSize() == 0)
@@ -494,23 +494,21 @@ namespace triton {
 
         /* Update instruction address if undefined */
         if (!inst.getAddress()) {
-          inst.setAddress(this->getConcreteRegisterValue(this->getProgramCounter()).convert_to<triton::uint64>());
+          inst.setAddress(this->getConcreteRegisterValue64(this->getProgramCounter()));
         }
 
         /* Let's disass and build our operands */
-        count = triton::extlibs::capstone::cs_disasm(this->handle, inst.getOpcode(), inst.getSize(), inst.getAddress(), 0, &insn);
-        if (count > 0) {
+        triton::arch::CapstonePool::Lease lease(*this->disassembler);
+        const triton::uint8* code = inst.getOpcode();
+        size_t codeSize           = inst.getSize();
+        triton::uint64 codeAddr   = inst.getAddress();
+        triton::extlibs::capstone::cs_insn* insn = lease.insn;
+        if (triton::extlibs::capstone::cs_disasm_iter(lease.handle, &code, &codeSize, &codeAddr, insn)) {
           /* Detail information */
           triton::extlibs::capstone::cs_detail* detail = insn->detail;
 
           /* Init the disassembly */
-          std::stringstream str;
-
-          str << insn[0].mnemonic;
-          if (detail->x86.op_count)
-            str << " " <<  insn[0].op_str;
-
-          inst.setDisassembly(str.str());
+          inst.setDisassembly(insn[0].mnemonic, detail->x86.op_count ? insn[0].op_str : "");
 
           /* Refine the size */
           inst.setSize(insn[0].size);
@@ -585,8 +583,8 @@ namespace triton {
             }
           }
 
-          /* Free capstone stuffs */
-          triton::extlibs::capstone::cs_free(insn, count);
+          /* Set the specialized semantics handler */
+          inst.setSemanticsHandler(this->selectSemanticsHandler(inst));
         }
         else
           throw triton::exceptions::Disassembly("x8664Cpu::disassembly(): Failed to disassemble the given code.");
@@ -594,24 +592,43 @@ namespace triton {
 
 
       triton::uint8 x8664Cpu::getConcreteMemoryValue(triton::uint64 addr, bool execCallbacks) const {
-        if (execCallbacks && this->callbacks)
+        if (execCallbacks && this->callbacks && this->callbacks->isLoadDefined())
           this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, MemoryAccess(addr, triton::size::byte));
 
-        auto it = this->memory.find(addr);
-        if (it == this->memory.end()) {
-          return 0x00;
-        }
+        return this->memory.get(addr);
+      }
+
+
+      triton::uint64 x8664Cpu::getConcreteMemoryValue64(const triton::arch::MemoryAccess& mem, bool execCallbacks) const {
+        triton::uint64 ret = 0;
+        triton::uint8 bytes[triton::size::qword];
+        triton::uint64 addr = 0;
+        triton::uint32 size = 0;
+
+        if (execCallbacks && this->callbacks && this->callbacks->isLoadDefined())
+          this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, mem);
+
+        addr = mem.getAddress();
+        size = mem.getSize();
+
+        if (size == 0 || size > triton::size::qword)
+          throw triton::exceptions::Cpu("x8664Cpu::getConcreteMemoryValue64(): Invalid size memory.");
+
+        this->memory.read(addr, size, bytes);
+        for (triton::sint32 i = size-1; i >= 0; i--)
+          ret = ((ret << triton::bitsize::byte) | bytes[i]);
 
-        return it->second;
+        return ret;
       }
 
 
       triton::uint512 x8664Cpu::getConcreteMemoryValue(const triton::arch::MemoryAccess& mem, bool execCallbacks) const {
         triton::uint512 ret = 0;
+        triton::uint8 bytes[triton::size::dqqword];
         triton::uint64 addr = 0;
         triton::uint32 size = 0;
 
-        if (execCallbacks && this->callbacks)
+        if (execCallbacks && this->callbacks && this->callbacks->isLoadDefined())
           this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, mem);
 
         addr = mem.getAddress();
@@ -620,31 +637,56 @@ namespace triton {
         if (size == 0 || size > triton::size::dqqword)
           throw triton::exceptions::Cpu("x8664Cpu::getConcreteMemoryValue(): Invalid size memory.");
 
+        /* The accesses of 64 bits or less do not need the multiprecision arithmetic */
+        if (size <= triton::size::qword)
+          return this->getConcreteMemoryValue64(mem, false);
+
+        this->memory.read(addr, size, bytes);
         for (triton::sint32 i = size-1; i >= 0; i--)
-          ret = ((ret << triton::bitsize::byte) | this->getConcreteMemoryValue(addr+i, false));
+          ret = ((ret << triton::bitsize::byte) | bytes[i]);
 
         return ret;
       }
 
 
       std::vector<triton::uint8> x8664Cpu::getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks) const {
-        std::vector<triton::uint8> area;
+        std::vector<triton::uint8> area(size);
 
-        for (triton::usize index = 0; index < size; index++)
-          area.push_back(this->getConcreteMemoryValue(baseAddr+index));
+        this->getConcreteMemoryAreaValue(baseAddr, area.data(), size, execCallbacks);
 
         return area;
       }
 
 
-      triton::uint512 x8664Cpu::getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks) const {
-        triton::uint512 value = 0;
+      void x8664Cpu::getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::uint8* area, triton::usize size, bool execCallbacks) const {
+        if (execCallbacks && this->callbacks && this->callbacks->isDefined()) {
+          /* The area callbacks are called once, before the area is read */
+          this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_AREA_VALUE, baseAddr, size);
 
-        if (execCallbacks && this->callbacks)
+          /* The callbacks are called on each byte, before it is read */
+          if (this->callbacks->isDefined(triton::callbacks::GET_CONCRETE_MEMORY_VALUE)) {
+            for (triton::usize index = 0; index < size; index++)
+              area[index] = this->getConcreteMemoryValue(baseAddr+index);
+            return;
+          }
+        }
+
+        this->memory.read(baseAddr, size, area);
+      }
+
+
+      const triton::arch::ConcreteMemory& x8664Cpu::getConcreteMemory(void) const {
+        return this->memory;
+      }
+
+
+      triton::uint64 x8664Cpu::getConcreteRegisterValue64(const triton::arch::Register& reg, bool execCallbacks) const {
+        triton::uint64 value = 0;
+
+        if (execCallbacks && this->callbacks && this->callbacks->isDefined(triton::callbacks::GET_CONCRETE_REGISTER_VALUE))
           this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_REGISTER_VALUE, reg);
 
         switch (reg.getId()) {
-
           case triton::arch::ID_REG_X86_RAX: { triton::uint64 val = 0; std::memcpy(&val, (triton::uint64*)this->rax,  triton::size::qword); return val; }
           case triton::arch::ID_REG_X86_EAX: { triton::uint32 val = 0; std::memcpy(&val, (triton::uint32*)this->rax,  triton::size::dword); return val; }
           case triton::arch::ID_REG_X86_AX:  { triton::uint16 val = 0; std::memcpy(&val, (triton::uint16*)this->rax,  triton::size::word);  return val; }
@@ -731,82 +773,6 @@ namespace triton {
           case triton::arch::ID_REG_X86_MM6: { triton::uint64 val = 0; std::memcpy(&val, (triton::uint64*)this->st6, triton::size::qword); return val; }
           case triton::arch::ID_REG_X86_MM7: { triton::uint64 val = 0; std::memcpy(&val, (triton::uint64*)this->st7, triton::size::qword); return val; }
 
-          case triton::arch::ID_REG_X86_ST0: { return triton::utils::fromBufferToUint<triton::uint80>(this->st0); }
-          case triton::arch::ID_REG_X86_ST1: { return triton::utils::fromBufferToUint<triton::uint80>(this->st1); }
-          case triton::arch::ID_REG_X86_ST2: { return triton::utils::fromBufferToUint<triton::uint80>(this->st2); }
-          case triton::arch::ID_REG_X86_ST3: { return triton::utils::fromBufferToUint<triton::uint80>(this->st3); }
-          case triton::arch::ID_REG_X86_ST4: { return triton::utils::fromBufferToUint<triton::uint80>(this->st4); }
-          case triton::arch::ID_REG_X86_ST5: { return triton::utils::fromBufferToUint<triton::uint80>(this->st5); }
-          case triton::arch::ID_REG_X86_ST6: { return triton::utils::fromBufferToUint<triton::uint80>(this->st6); }
-          case triton::arch::ID_REG_X86_ST7: { return triton::utils::fromBufferToUint<triton::uint80>(this->st7); }
-
-          case triton::arch::ID_REG_X86_XMM0:  { return triton::utils::fromBufferToUint<triton::uint128>(this->zmm0);  }
-          case triton::arch::ID_REG_X86_XMM1:  { return triton::utils::fromBufferToUint<triton::uint128>(this->zmm1);  }
-          case triton::arch::ID_REG_X86_XMM2:  { return triton::utils::fromBufferToUint<triton::uint128>(this->zmm2);  }
-          case triton::arch::ID_REG_X86_XMM3:  { return triton::utils::fromBufferToUint<triton::uint128>(this->zmm3);  }
-          case triton::arch::ID_REG_X86_XMM4:  { return triton::utils::fromBufferToUint<triton::uint128>(this->zmm4);  }
-          case triton::arch::ID_REG_X86_XMM5:  { return triton::utils::fromBufferToUint<triton::uint128>(this->zmm5);  }
-          case triton::arch::ID_REG_X86_XMM6:  { return triton::utils::fromBufferToUint<triton::uint128>(this->zmm6);  }
-          case triton::arch::ID_REG_X86_XMM7:  { return triton::utils::fromBufferToUint<triton::uint128>(this->zmm7);  }
-          case triton::arch::ID_REG_X86_XMM8:  { return triton::utils::fromBufferToUint<triton::uint128>(this->zmm8);  }
-          case triton::arch::ID_REG_X86_XMM9:  { return triton::utils::fromBufferToUint<triton::uint128>(this->zmm9);  }
-          case triton::arch::ID_REG_X86_XMM10: { return triton::utils::fromBufferToUint<triton::uint128>(this->zmm10); }
-          case triton::arch::ID_REG_X86_XMM11: { return triton::utils::fromBufferToUint<triton::uint128>(this->zmm11); }
-          case triton::arch::ID_REG_X86_XMM12: { return triton::utils::fromBufferToUint<triton::uint128>(this->zmm12); }
-          case triton::arch::ID_REG_X86_XMM13: { return triton::utils::fromBufferToUint<triton::uint128>(this->zmm13); }
-          case triton::arch::ID_REG_X86_XMM14: { return triton::utils::fromBufferToUint<triton::uint128>(this->zmm14); }
-          case triton::arch::ID_REG_X86_XMM15: { return triton::utils::fromBufferToUint<triton::uint128>(this->zmm15); }
-
-          case triton::arch::ID_REG_X86_YMM0:  { return triton::utils::fromBufferToUint<triton::uint256>(this->zmm0);  }
-          case triton::arch::ID_REG_X86_YMM1:  { return triton::utils::fromBufferToUint<triton::uint256>(this->zmm1);  }
-          case triton::arch::ID_REG_X86_YMM2:  { return triton::utils::fromBufferToUint<triton::uint256>(this->zmm2);  }
-          case triton::arch::ID_REG_X86_YMM3:  { return triton::utils::fromBufferToUint<triton::uint256>(this->zmm3);  }
-          case triton::arch::ID_REG_X86_YMM4:  { return triton::utils::fromBufferToUint<triton::uint256>(this->zmm4);  }
-          case triton::arch::ID_REG_X86_YMM5:  { return triton::utils::fromBufferToUint<triton::uint256>(this->zmm5);  }
-          case triton::arch::ID_REG_X86_YMM6:  { return triton::utils::fromBufferToUint<triton::uint256>(this->zmm6);  }
-          case triton::arch::ID_REG_X86_YMM7:  { return triton::utils::fromBufferToUint<triton::uint256>(this->zmm7);  }
-          case triton::arch::ID_REG_X86_YMM8:  { return triton::utils::fromBufferToUint<triton::uint256>(this->zmm8);  }
-          case triton::arch::ID_REG_X86_YMM9:  { return triton::utils::fromBufferToUint<triton::uint256>(this->zmm9);  }
-          case triton::arch::ID_REG_X86_YMM10: { return triton::utils::fromBufferToUint<triton::uint256>(this->zmm10); }
-          case triton::arch::ID_REG_X86_YMM11: { return triton::utils::fromBufferToUint<triton::uint256>(this->zmm11); }
-          case triton::arch::ID_REG_X86_YMM12: { return triton::utils::fromBufferToUint<triton::uint256>(this->zmm12); }
-          case triton::arch::ID_REG_X86_YMM13: { return triton::utils::fromBufferToUint<triton::uint256>(this->zmm13); }
-          case triton::arch::ID_REG_X86_YMM14: { return triton::utils::fromBufferToUint<triton::uint256>(this->zmm14); }
-          case triton::arch::ID_REG_X86_YMM15: { return triton::utils::fromBufferToUint<triton::uint256>(this->zmm15); }
-
-          case triton::arch::ID_REG_X86_ZMM0:  { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm0);  }
-          case triton::arch::ID_REG_X86_ZMM1:  { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm1);  }
-          case triton::arch::ID_REG_X86_ZMM2:  { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm2);  }
-          case triton::arch::ID_REG_X86_ZMM3:  { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm3);  }
-          case triton::arch::ID_REG_X86_ZMM4:  { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm4);  }
-          case triton::arch::ID_REG_X86_ZMM5:  { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm5);  }
-          case triton::arch::ID_REG_X86_ZMM6:  { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm6);  }
-          case triton::arch::ID_REG_X86_ZMM7:  { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm7);  }
-          case triton::arch::ID_REG_X86_ZMM8:  { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm8);  }
-          case triton::arch::ID_REG_X86_ZMM9:  { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm9);  }
-          case triton::arch::ID_REG_X86_ZMM10: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm10); }
-          case triton::arch::ID_REG_X86_ZMM11: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm11); }
-          case triton::arch::ID_REG_X86_ZMM12: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm12); }
-          case triton::arch::ID_REG_X86_ZMM13: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm13); }
-          case triton::arch::ID_REG_X86_ZMM14: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm14); }
-          case triton::arch::ID_REG_X86_ZMM15: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm15); }
-          case triton::arch::ID_REG_X86_ZMM16: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm16); }
-          case triton::arch::ID_REG_X86_ZMM17: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm17); }
-          case triton::arch::ID_REG_X86_ZMM18: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm18); }
-          case triton::arch::ID_REG_X86_ZMM19: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm19); }
-          case triton::arch::ID_REG_X86_ZMM20: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm20); }
-          case triton::arch::ID_REG_X86_ZMM21: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm21); }
-          case triton::arch::ID_REG_X86_ZMM22: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm22); }
-          case triton::arch::ID_REG_X86_ZMM23: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm23); }
-          case triton::arch::ID_REG_X86_ZMM24: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm24); }
-          case triton::arch::ID_REG_X86_ZMM25: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm25); }
-          case triton::arch::ID_REG_X86_ZMM26: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm26); }
-          case triton::arch::ID_REG_X86_ZMM27: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm27); }
-          case triton::arch::ID_REG_X86_ZMM28: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm28); }
-          case triton::arch::ID_REG_X86_ZMM29: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm29); }
-          case triton::arch::ID_REG_X86_ZMM30: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm30); }
-          case triton::arch::ID_REG_X86_ZMM31: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm31); }
-
           case triton::arch::ID_REG_X86_MXCSR:      { triton::uint32 val = 0; std::memcpy(&val, (triton::uint32*)this->mxcsr,      sizeof(triton::uint32)); return val; }
           case triton::arch::ID_REG_X86_MXCSR_MASK: { triton::uint32 val = 0; std::memcpy(&val, (triton::uint32*)this->mxcsr_mask, sizeof(triton::uint32)); return val; }
 
@@ -918,7 +884,97 @@ namespace triton {
           case triton::arch::ID_REG_X86_EFER_FFXSR: { triton::uint64 flag = 0; std::memcpy(&flag, (triton::uint64*)this->efer, sizeof(triton::uint64)); return ((flag >> 14) & 1); }
           case triton::arch::ID_REG_X86_EFER_TCE:   { triton::uint64 flag = 0; std::memcpy(&flag, (triton::uint64*)this->efer, sizeof(triton::uint64)); return ((flag >> 15) & 1); }
           case triton::arch::ID_REG_X86_EFER:       { triton::uint64 val = 0;  std::memcpy(&val,  (triton::uint64*)this->efer, sizeof(triton::uint64)); return val; }
+          default:
+            throw triton::exceptions::Cpu("x8664Cpu::getConcreteRegisterValue64(): Invalid register.");
+        }
 
+        return value;
+      }
+
+
+      triton::uint512 x8664Cpu::getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks) const {
+        triton::uint512 value = 0;
+
+        if (execCallbacks && this->callbacks && this->callbacks->isDefined(triton::callbacks::GET_CONCRETE_REGISTER_VALUE))
+          this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_REGISTER_VALUE, reg);
+
+        /* The registers of 64 bits or less do not need the multiprecision arithmetic */
+        if (reg.getBitSize() <= triton::bitsize::qword)
+          return this->getConcreteRegisterValue64(reg, false);
+
+        switch (reg.getId()) {
+          case triton::arch::ID_REG_X86_ST0: { return triton::utils::fromBufferToUint<triton::uint80>(this->st0); }
+          case triton::arch::ID_REG_X86_ST1: { return triton::utils::fromBufferToUint<triton::uint80>(this->st1); }
+          case triton::arch::ID_REG_X86_ST2: { return triton::utils::fromBufferToUint<triton::uint80>(this->st2); }
+          case triton::arch::ID_REG_X86_ST3: { return triton::utils::fromBufferToUint<triton::uint80>(this->st3); }
+          case triton::arch::ID_REG_X86_ST4: { return triton::utils::fromBufferToUint<triton::uint80>(this->st4); }
+          case triton::arch::ID_REG_X86_ST5: { return triton::utils::fromBufferToUint<triton::uint80>(this->st5); }
+          case triton::arch::ID_REG_X86_ST6: { return triton::utils::fromBufferToUint<triton::uint80>(this->st6); }
+          case triton::arch::ID_REG_X86_ST7: { return triton::utils::fromBufferToUint<triton::uint80>(this->st7); }
+          case triton::arch::ID_REG_X86_XMM0:  { return triton::utils::fromBufferToUint<triton::uint128>(this->zmm0);  }
+          case triton::arch::ID_REG_X86_XMM1:  { return triton::utils::fromBufferToUint<triton::uint128>(this->zmm1);  }
+          case triton::arch::ID_REG_X86_XMM2:  { return triton::utils::fromBufferToUint<triton::uint128>(this->zmm2);  }
+          case triton::arch::ID_REG_X86_XMM3:  { return triton::utils::fromBufferToUint<triton::uint128>(this->zmm3);  }
+          case triton::arch::ID_REG_X86_XMM4:  { return triton::utils::fromBufferToUint<triton::uint128>(this->zmm4);  }
+          case triton::arch::ID_REG_X86_XMM5:  { return triton::utils::fromBufferToUint<triton::uint128>(this->zmm5);  }
+          case triton::arch::ID_REG_X86_XMM6:  { return triton::utils::fromBufferToUint<triton::uint128>(this->zmm6);  }
+          case triton::arch::ID_REG_X86_XMM7:  { return triton::utils::fromBufferToUint<triton::uint128>(this->zmm7);  }
+          case triton::arch::ID_REG_X86_XMM8:  { return triton::utils::fromBufferToUint<triton::uint128>(this->zmm8);  }
+          case triton::arch::ID_REG_X86_XMM9:  { return triton::utils::fromBufferToUint<triton::uint128>(this->zmm9);  }
+          case triton::arch::ID_REG_X86_XMM10: { return triton::utils::fromBufferToUint<triton::uint128>(this->zmm10); }
+          case triton::arch::ID_REG_X86_XMM11: { return triton::utils::fromBufferToUint<triton::uint128>(this->zmm11); }
+          case triton::arch::ID_REG_X86_XMM12: { return triton::utils::fromBufferToUint<triton::uint128>(this->zmm12); }
+          case triton::arch::ID_REG_X86_XMM13: { return triton::utils::fromBufferToUint<triton::uint128>(this->zmm13); }
+          case triton::arch::ID_REG_X86_XMM14: { return triton::utils::fromBufferToUint<triton::uint128>(this->zmm14); }
+          case triton::arch::ID_REG_X86_XMM15: { return triton::utils::fromBufferToUint<triton::uint128>(this->zmm15); }
+          case triton::arch::ID_REG_X86_YMM0:  { return triton::utils::fromBufferToUint<triton::uint256>(this->zmm0);  }
+          case triton::arch::ID_REG_X86_YMM1:  { return triton::utils::fromBufferToUint<triton::uint256>(this->zmm1);  }
+          case triton::arch::ID_REG_X86_YMM2:  { return triton::utils::fromBufferToUint<triton::uint256>(this->zmm2);  }
+          case triton::arch::ID_REG_X86_YMM3:  { return triton::utils::fromBufferToUint<triton::uint256>(this->zmm3);  }
+          case triton::arch::ID_REG_X86_YMM4:  { return triton::utils::fromBufferToUint<triton::uint256>(this->zmm4);  }
+          case triton::arch::ID_REG_X86_YMM5:  { return triton::utils::fromBufferToUint<triton::uint256>(this->zmm5);  }
+          case triton::arch::ID_REG_X86_YMM6:  { return triton::utils::fromBufferToUint<triton::uint256>(this->zmm6);  }
+          case triton::arch::ID_REG_X86_YMM7:  { return triton::utils::fromBufferToUint<triton::uint256>(this->zmm7);  }
+          case triton::arch::ID_REG_X86_YMM8:  { return triton::utils::fromBufferToUint<triton::uint256>(this->zmm8);  }
+          case triton::arch::ID_REG_X86_YMM9:  { return triton::utils::fromBufferToUint<triton::uint256>(this->zmm9);  }
+          case triton::arch::ID_REG_X86_YMM10: { return triton::utils::fromBufferToUint<triton::uint256>(this->zmm10); }
+          case triton::arch::ID_REG_X86_YMM11: { return triton::utils::fromBufferToUint<triton::uint256>(this->zmm11); }
+          case triton::arch::ID_REG_X86_YMM12: { return triton::utils::fromBufferToUint<triton::uint256>(this->zmm12); }
+          case triton::arch::ID_REG_X86_YMM13: { return triton::utils::fromBufferToUint<triton::uint256>(this->zmm13); }
+          case triton::arch::ID_REG_X86_YMM14: { return triton::utils::fromBufferToUint<triton::uint256>(this->zmm14); }
+          case triton::arch::ID_REG_X86_YMM15: { return triton::utils::fromBufferToUint<triton::uint256>(this->zmm15); }
+          case triton::arch::ID_REG_X86_ZMM0:  { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm0);  }
+          case triton::arch::ID_REG_X86_ZMM1:  { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm1);  }
+          case triton::arch::ID_REG_X86_ZMM2:  { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm2);  }
+          case triton::arch::ID_REG_X86_ZMM3:  { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm3);  }
+          case triton::arch::ID_REG_X86_ZMM4:  { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm4);  }
+          case triton::arch::ID_REG_X86_ZMM5:  { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm5);  }
+          case triton::arch::ID_REG_X86_ZMM6:  { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm6);  }
+          case triton::arch::ID_REG_X86_ZMM7:  { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm7);  }
+          case triton::arch::ID_REG_X86_ZMM8:  { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm8);  }
+          case triton::arch::ID_REG_X86_ZMM9:  { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm9);  }
+          case triton::arch::ID_REG_X86_ZMM10: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm10); }
+          case triton::arch::ID_REG_X86_ZMM11: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm11); }
+          case triton::arch::ID_REG_X86_ZMM12: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm12); }
+          case triton::arch::ID_REG_X86_ZMM13: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm13); }
+          case triton::arch::ID_REG_X86_ZMM14: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm14); }
+          case triton::arch::ID_REG_X86_ZMM15: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm15); }
+          case triton::arch::ID_REG_X86_ZMM16: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm16); }
+          case triton::arch::ID_REG_X86_ZMM17: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm17); }
+          case triton::arch::ID_REG_X86_ZMM18: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm18); }
+          case triton::arch::ID_REG_X86_ZMM19: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm19); }
+          case triton::arch::ID_REG_X86_ZMM20: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm20); }
+          case triton::arch::ID_REG_X86_ZMM21: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm21); }
+          case triton::arch::ID_REG_X86_ZMM22: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm22); }
+          case triton::arch::ID_REG_X86_ZMM23: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm23); }
+          case triton::arch::ID_REG_X86_ZMM24: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm24); }
+          case triton::arch::ID_REG_X86_ZMM25: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm25); }
+          case triton::arch::ID_REG_X86_ZMM26: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm26); }
+          case triton::arch::ID_REG_X86_ZMM27: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm27); }
+          case triton::arch::ID_REG_X86_ZMM28: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm28); }
+          case triton::arch::ID_REG_X86_ZMM29: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm29); }
+          case triton::arch::ID_REG_X86_ZMM30: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm30); }
+          case triton::arch::ID_REG_X86_ZMM31: { return triton::utils::fromBufferToUint<triton::uint512>(this->zmm31); }
           default:
             throw triton::exceptions::Cpu("x8664Cpu::getConcreteRegisterValue(): Invalid register.");
         }
@@ -928,9 +984,9 @@ namespace triton {
 
 
       void x8664Cpu::setConcreteMemoryValue(triton::uint64 addr, triton::uint8 value) {
-        if (this->callbacks)
+        if (this->callbacks && this->callbacks->isDefined(triton::callbacks::SET_CONCRETE_MEMORY_VALUE))
           this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_MEMORY_VALUE, MemoryAccess(addr, triton::size::byte), value);
-        this->memory[addr] = value;
+        this->memory.set(addr, value);
       }
 
 
@@ -938,6 +994,7 @@ namespace triton {
         triton::uint64 addr = mem.getAddress();
         triton::uint32 size = mem.getSize();
         triton::uint512 cv  = value;
+        triton::uint8 bytes[triton::size::dqqword];
 
         if (cv > mem.getMaxValue())
           throw triton::exceptions::Register("x8664Cpu::setConcreteMemoryValue(): You cannot set this concrete value (too big) to this memory access.");
@@ -945,31 +1002,57 @@ namespace triton {
         if (size == 0 || size > triton::size::dqqword)
           throw triton::exceptions::Cpu("x8664Cpu::setConcreteMemoryValue(): Invalid size memory.");
 
-        if (this->callbacks)
+        if (this->callbacks && this->callbacks->isDefined(triton::callbacks::SET_CONCRETE_MEMORY_VALUE))
           this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_MEMORY_VALUE, mem, value);
 
         for (triton::uint32 i = 0; i < size; i++) {
-          this->memory[addr+i] = (cv & 0xff).convert_to<triton::uint8>();
+          bytes[i] = (cv & 0xff).convert_to<triton::uint8>();
           cv >>= 8;
         }
+        this->memory.write(addr, bytes, size);
       }
 
 
       void x8664Cpu::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const std::vector<triton::uint8>& values) {
-        // Pre-reserving the memory. We modified the original robin_map to not force rehash on reserve.
-        this->memory.reserve(values.size() + this->memory.size());
-        for (triton::usize index = 0; index < values.size(); index++) {
-          this->setConcreteMemoryValue(baseAddr+index, values[index]);
-        }
+        this->setConcreteMemoryAreaValue(baseAddr, values.data(), values.size());
       }
 
 
       void x8664Cpu::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size) {
-        // Pre-reserving the memory. We modified the original robin_map to not force rehash on every reserve if not needed.
-        this->memory.reserve(size + this->memory.size());
-        for (triton::usize index = 0; index < size; index++) {
-          this->setConcreteMemoryValue(baseAddr+index, area[index]);
+        if (this->callbacks && this->callbacks->isDefined()) {
+          /* The area callbacks are called once, before the area is written */
+          this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_MEMORY_AREA_VALUE, baseAddr, area, size);
+
+          /* The callbacks are called on each byte, before it is written */
+          if (this->callbacks->isDefined(triton::callbacks::SET_CONCRETE_MEMORY_VALUE)) {
+            for (triton::usize index = 0; index < size; index++)
+              this->setConcreteMemoryValue(baseAddr+index, area[index]);
+            return;
+          }
+        }
+
+        this->memory.write(baseAddr, area, size);
+      }
+
+
+      void x8664Cpu::mapConcreteMemoryArea(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size, const std::shared_ptr<const void>& owner) {
+        if (this->callbacks && this->callbacks->isDefined()) {
+          /* The callbacks are called on each byte, the area is copied */
+          if (this->callbacks->isDefined(triton::callbacks::SET_CONCRETE_MEMORY_VALUE)) {
+            this->setConcreteMemoryAreaValue(baseAddr, area, size);
+            return;
+          }
+
+          /* The area callbacks are called once, before the area is mapped */
+          this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_MEMORY_AREA_VALUE, baseAddr, area, size);
         }
+
+        this->memory.map(baseAddr, area, size, owner);
+      }
+
+
+      void x8664Cpu::setConcreteMemoryPlacement(const triton::utils::MemoryPlacement& placement) {
+        this->memory.setPlacement(placement);
       }
 
 
@@ -977,7 +1060,7 @@ namespace triton {
         if (value > reg.getMaxValue())
           throw triton::exceptions::Register("x8664Cpu::setConcreteRegisterValue(): You cannot set this concrete value (too big) to this register.");
 
-        if (this->callbacks)
+        if (this->callbacks && this->callbacks->isDefined(triton::callbacks::SET_CONCRETE_REGISTER_VALUE))
           this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_REGISTER_VALUE, reg, value);
 
         switch (reg.getId()) {
@@ -1766,6 +1849,17 @@ namespace triton {
       }
 
 
+      triton::uint32 x8664Cpu::getDecodingState(void) const {
+        /* The decoding does not depend on the state in x86_64 */
+        return 0;
+      }
+
+
+      void x8664Cpu::setDecodingState(triton::uint32 state) {
+        /* The decoding does not depend on the state in x86_64 */
+      }
+
+
       bool x8664Cpu::isMemoryExclusiveAccess(void) const {
         /* There is no exclusive memory access support in x86_64 */
         return false;
@@ -1783,12 +1877,7 @@ namespace triton {
 
 
       bool x8664Cpu::isConcreteMemoryValueDefined(triton::uint64 baseAddr, triton::usize size) const {
-        for (triton::usize index = 0; index < size; index++) {
-          if (this->memory.find(baseAddr + index) == this->memory.end()) {
-            return false;
-          }
-        }
-        return true;
+        return this->memory.isDefined(baseAddr, size);
       }
 
 
@@ -1798,11 +1887,7 @@ namespace triton {
 
 
       void x8664Cpu::clearConcreteMemoryValue(triton::uint64 baseAddr, triton::usize size) {
-        for (triton::usize index = 0; index < size; index++) {
-          if (this->memory.find(baseAddr + index) != this->memory.end()) {
-            this->memory.erase(baseAddr + index);
-          }
-        }
+        this->memory.erase(baseAddr, size);
       }
 
     }; /* x86 namespace */
@@ -5,6 +5,9 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <algorithm>
+#include <vector>
+
 #include <triton/cpuSize.hpp>
 #include <triton/exceptions.hpp>
 #include <triton/x86Semantics.hpp>
@@ -435,6 +438,13 @@ namespace triton {
 
 
       bool x86Semantics::buildSemantics(triton::arch::Instruction& inst) {
+        /* The specialized handler selected at the disassembly level, if any */
+        triton::uint32 handler = inst.getSemanticsHandler();
+        if (handler != ID_HANDLER_INVALID && handler < ID_HANDLER_LAST_ITEM) {
+          (this->*x86Semantics::handlers[handler])(inst);
+          return true;
+        }
+
         switch (inst.getType()) {
           case ID_INS_AAA:            this->aaa_s(inst);          break;
           case ID_INS_AAD:            this->aad_s(inst);          break;
@@ -818,6 +828,335 @@ namespace triton {
       }
 
 
+      namespace {
+        /* The accesses to an operand of a known kind, without dispatching on its type */
+        template <triton::arch::operand_e K> struct FastOperand;
+
+        template <> struct FastOperand<triton::arch::OP_IMM> {
+          static const triton::arch::Immediate& get(const triton::arch::OperandWrapper& op) {
+            return op.getConstImmediate();
+          }
+
+          static triton::ast::SharedAbstractNode read(triton::engines::symbolic::SymbolicEngine* engine, triton::arch::Instruction& inst, const triton::arch::OperandWrapper& op) {
+            return engine->getImmediateAst(inst, op.getConstImmediate());
+          }
+
+          static bool isTainted(const triton::engines::taint::TaintEngine*, const triton::arch::OperandWrapper&) {
+            return triton::engines::taint::UNTAINTED;
+          }
+        };
+
+        template <> struct FastOperand<triton::arch::OP_MEM> {
+          static const triton::arch::MemoryAccess& get(const triton::arch::OperandWrapper& op) {
+            return op.getConstMemory();
+          }
+
+          static triton::ast::SharedAbstractNode read(triton::engines::symbolic::SymbolicEngine* engine, triton::arch::Instruction& inst, const triton::arch::OperandWrapper& op) {
+            return engine->getMemoryAst(inst, op.getConstMemory());
+          }
+
+          static const triton::engines::symbolic::SharedSymbolicExpression& write(triton::engines::symbolic::SymbolicEngine* engine, triton::arch::Instruction& inst,
+                                                                                 const triton::ast::SharedAbstractNode& node, const triton::arch::OperandWrapper& op, const std::string& comment) {
+            return engine->createSymbolicMemoryExpression(inst, node, op.getConstMemory(), comment);
+          }
+
+          static bool isTainted(const triton::engines::taint::TaintEngine* engine, const triton::arch::OperandWrapper& op) {
+            return engine->isMemoryTainted(op.getConstMemory());
+          }
+        };
+
+        template <> struct FastOperand<triton::arch::OP_REG> {
+          static const triton::arch::Register& get(const triton::arch::OperandWrapper& op) {
+            return op.getConstRegister();
+          }
+
+          static triton::ast::SharedAbstractNode read(triton::engines::symbolic::SymbolicEngine* engine, triton::arch::Instruction& inst, const triton::arch::OperandWrapper& op) {
+            return engine->getRegisterAst(inst, op.getConstRegister());
+          }
+
+          static const triton::engines::symbolic::SharedSymbolicExpression& write(triton::engines::symbolic::SymbolicEngine* engine, triton::arch::Instruction& inst,
+                                                                                 const triton::ast::SharedAbstractNode& node, const triton::arch::OperandWrapper& op, const std::string& comment) {
+            return engine->createSymbolicRegisterExpression(inst, node, op.getConstRegister(), comment);
+          }
+
+          static bool isTainted(const triton::engines::taint::TaintEngine* engine, const triton::arch::OperandWrapper& op) {
+            return engine->isRegisterTainted(op.getConstRegister());
+          }
+        };
+      };
+
+
+      template <triton::arch::operand_e D, triton::arch::operand_e S>
+      void x86Semantics::addFast_s(triton::arch::Instruction& inst) {
+        auto& dst = inst.operands[0];
+        auto& src = inst.operands[1];
+
+        /* Create symbolic operands */
+        auto op1 = FastOperand<D>::read(this->symbolicEngine, inst, dst);
+        auto op2 = FastOperand<S>::read(this->symbolicEngine, inst, src);
+
+        /* Create the semantics */
+        auto node = this->astCtxt->bvadd(op1, op2);
+
+        /* Create symbolic expression */
+        auto expr = FastOperand<D>::write(this->symbolicEngine, inst, node, dst, "ADD operation");
+
+        /* Spread taint */
+        expr->isTainted = this->taintEngine->taintUnion(FastOperand<D>::get(dst), FastOperand<S>::get(src));
+
+        /* Update symbolic flags */
+        this->af_s(inst, expr, dst, op1, op2);
+        this->cfAdd_s(inst, expr, dst, op1, op2);
+        this->ofAdd_s(inst, expr, dst, op1, op2);
+        this->pf_s(inst, expr, dst);
+        this->sf_s(inst, expr, dst);
+        this->zf_s(inst, expr, dst);
+
+        /* Update the symbolic control flow */
+        this->controlFlow_s(inst);
+      }
+
+
+      template <triton::arch::operand_e D, triton::arch::operand_e S>
+      void x86Semantics::cmpFast_s(triton::arch::Instruction& inst) {
+        auto& dst = inst.operands[0];
+        auto& src = inst.operands[1];
+
+        /* Create symbolic operands */
+        auto op1 = FastOperand<D>::read(this->symbolicEngine, inst, dst);
+        auto op2 = this->astCtxt->sx(dst.getBitSize() - src.getBitSize(), FastOperand<S>::read(this->symbolicEngine, inst, src));
+
+        /* Create the semantics */
+        auto node = this->astCtxt->bvsub(op1, op2);
+
+        /* Create symbolic expression */
+        auto expr = this->symbolicEngine->createSymbolicVolatileExpression(inst, node, "CMP operation");
+
+        /* Spread taint */
+        expr->isTainted = FastOperand<D>::isTainted(this->taintEngine, dst) | FastOperand<S>::isTainted(this->taintEngine, src);
+
+        /* Update symbolic flags */
+        this->af_s(inst, expr, dst, op1, op2, true);
+        this->cfSub_s(inst, expr, dst, op1, op2, true);
+        this->ofSub_s(inst, expr, dst, op1, op2, true);
+        this->pf_s(inst, expr, dst, true);
+        this->sf_s(inst, expr, dst, true);
+        this->zf_s(inst, expr, dst, true);
+
+        /* Update the symbolic control flow */
+        this->controlFlow_s(inst);
+      }
+
+
+      template <triton::arch::register_e flag, bool value>
+      void x86Semantics::jccFast_s(triton::arch::Instruction& inst) {
+        const auto& pc  = this->architecture->getProgramCounter();
+        const auto& reg = this->architecture->getRegister(flag);
+        auto  srcImm1   = triton::arch::Immediate(inst.getNextAddress(), pc.getSize());
+        auto& srcImm2   = inst.operands[0];
+
+        /* Create symbolic operands */
+        auto op1 = this->symbolicEngine->getRegisterAst(inst, reg);
+        auto op2 = this->symbolicEngine->getImmediateAst(inst, srcImm1);
+        auto op3 = this->symbolicEngine->getImmediateAst(inst, srcImm2.getConstImmediate());
+
+        /* Create the semantics */
+        auto node = this->astCtxt->ite(this->astCtxt->equal(op1, value ? this->astCtxt->bvtrue() : this->astCtxt->bvfalse()), op3, op2);
+
+        /* Create symbolic expression */
+        auto expr = this->symbolicEngine->createSymbolicRegisterExpression(inst, node, pc, "Program Counter");
+
+        /* Set condition flag */
+        if (op1->evaluate().is_zero() != value)
+          inst.setConditionTaken(true);
+
+        /* Spread taint */
+        expr->isTainted = this->taintEngine->taintAssignment(pc, reg);
+
+        /* Create the path constraint */
+        this->symbolicEngine->pushPathConstraint(inst, expr);
+      }
+
+
+      template <triton::arch::operand_e D, triton::arch::operand_e S>
+      void x86Semantics::movFast_s(triton::arch::Instruction& inst) {
+        auto& dst = inst.operands[0];
+        auto& src = inst.operands[1];
+
+        /* Create the semantics */
+        auto node = FastOperand<S>::read(this->symbolicEngine, inst, src);
+
+        /* Create symbolic expression */
+        auto expr = FastOperand<D>::write(this->symbolicEngine, inst, node, dst, "MOV operation");
+
+        /* Spread taint */
+        expr->isTainted = this->taintEngine->taintAssignment(FastOperand<D>::get(dst), FastOperand<S>::get(src));
+
+        /* Update the symbolic control flow */
+        this->controlFlow_s(inst);
+      }
+
+
+      void x86Semantics::popRegFast_s(triton::arch::Instruction& inst) {
+        const auto& stack      = this->architecture->getStackPointer();
+        auto        stackValue = this->architecture->getConcreteRegisterValue64(stack);
+        const auto& dst        = inst.operands[0].getConstRegister();
+        auto        src        = triton::arch::MemoryAccess(stackValue, dst.getSize());
+
+        /* Create symbolic operands */
+        auto op1 = this->symbolicEngine->getMemoryAst(inst, src);
+
+        /* Create symbolic expression */
+        auto expr = this->symbolicEngine->createSymbolicRegisterExpression(inst, op1, dst, "POP operation");
+
+        /* Spread taint */
+        expr->isTainted = this->taintEngine->taintAssignment(dst, src);
+
+        /* Create the semantics - side effect (SP is not incremented if it is the destination) */
+        if (this->architecture->getParentRegister(dst) != stack)
+          alignAddStack_s(inst, src.getSize());
+
+        /* Update the symbolic control flow */
+        this->controlFlow_s(inst);
+      }
+
+
+      template <triton::arch::operand_e S>
+      void x86Semantics::pushFast_s(triton::arch::Instruction& inst) {
+        auto& src           = inst.operands[0];
+        const auto& stack   = this->architecture->getStackPointer();
+        triton::uint32 size = stack.getSize();
+
+        /* If it's an immediate source, the memory access is always based on the arch size */
+        if (S != triton::arch::OP_IMM)
+          size = src.getSize();
+
+        /* Create symbolic operands */
+        auto op1 = FastOperand<S>::read(this->symbolicEngine, inst, src);
+
+        /* Create the semantics - side effect */
+        auto stackValue = alignSubStack_s(inst, size);
+        auto dst        = triton::arch::MemoryAccess(stackValue, size);
+
+        /* Create the semantics */
+        auto node = this->astCtxt->zx(dst.getBitSize() - src.getBitSize(), op1);
+
+        /* Create symbolic expression */
+        auto expr = this->symbolicEngine->createSymbolicMemoryExpression(inst, node, dst, "PUSH operation");
+
+        /* Spread taint */
+        expr->isTainted = this->taintEngine->taintAssignment(dst, FastOperand<S>::get(src));
+
+        /* Update the symbolic control flow */
+        this->controlFlow_s(inst);
+      }
+
+
+      template <triton::arch::operand_e D, triton::arch::operand_e S>
+      void x86Semantics::subFast_s(triton::arch::Instruction& inst) {
+        auto& dst = inst.operands[0];
+        auto& src = inst.operands[1];
+
+        /* Create symbolic operands */
+        auto op1 = FastOperand<D>::read(this->symbolicEngine, inst, dst);
+        auto op2 = FastOperand<S>::read(this->symbolicEngine, inst, src);
+
+        /* Create the semantics */
+        auto node = this->astCtxt->bvsub(op1, op2);
+
+        /* Create symbolic expression */
+        auto expr = FastOperand<D>::write(this->symbolicEngine, inst, node, dst, "SUB operation");
+
+        /* Spread taint */
+        expr->isTainted = this->taintEngine->taintUnion(FastOperand<D>::get(dst), FastOperand<S>::get(src));
+
+        /* Update symbolic flags */
+        this->af_s(inst, expr, dst, op1, op2);
+        this->cfSub_s(inst, expr, dst, op1, op2);
+        this->ofSub_s(inst, expr, dst, op1, op2);
+        this->pf_s(inst, expr, dst);
+        this->sf_s(inst, expr, dst);
+        this->zf_s(inst, expr, dst);
+
+        /* Update the symbolic control flow */
+        this->controlFlow_s(inst);
+      }
+
+
+      template <triton::arch::operand_e D, triton::arch::operand_e S>
+      void x86Semantics::testFast_s(triton::arch::Instruction& inst) {
+        auto& src1 = inst.operands[0];
+        auto& src2 = inst.operands[1];
+
+        /* Create symbolic operands */
+        auto op1 = FastOperand<D>::read(this->symbolicEngine, inst, src1);
+        auto op2 = FastOperand<S>::read(this->symbolicEngine, inst, src2);
+
+        /* Create the semantics */
+        auto node = this->astCtxt->bvand(op1, op2);
+
+        /* Create symbolic expression */
+        auto expr = this->symbolicEngine->createSymbolicVolatileExpression(inst, node, "TEST operation");
+
+        /* Spread taint */
+        expr->isTainted = FastOperand<D>::isTainted(this->taintEngine, src1) | FastOperand<S>::isTainted(this->taintEngine, src2);
+
+        /* Update symbolic flags */
+        this->undefined_s(inst, this->architecture->getRegister(ID_REG_X86_AF));
+        this->clearFlag_s(inst, this->architecture->getRegister(ID_REG_X86_CF), "Clears carry flag");
+        this->clearFlag_s(inst, this->architecture->getRegister(ID_REG_X86_OF), "Clears overflow flag");
+        this->pf_s(inst, expr, src1, true);
+        this->sf_s(inst, expr, src1, true);
+        this->zf_s(inst, expr, src1, true);
+
+        /* Update the symbolic control flow */
+        this->controlFlow_s(inst);
+      }
+
+
+      const x86Semantics::handler_t x86Semantics::handlers[ID_HANDLER_LAST_ITEM] = {
+        nullptr,                                                                  /* ID_HANDLER_INVALID */
+        &x86Semantics::addFast_s<triton::arch::OP_MEM, triton::arch::OP_IMM>,     /* ID_HANDLER_ADD_MEM_IMM */
+        &x86Semantics::addFast_s<triton::arch::OP_MEM, triton::arch::OP_REG>,     /* ID_HANDLER_ADD_MEM_REG */
+        &x86Semantics::addFast_s<triton::arch::OP_REG, triton::arch::OP_IMM>,     /* ID_HANDLER_ADD_REG_IMM */
+        &x86Semantics::addFast_s<triton::arch::OP_REG, triton::arch::OP_MEM>,     /* ID_HANDLER_ADD_REG_MEM */
+        &x86Semantics::addFast_s<triton::arch::OP_REG, triton::arch::OP_REG>,     /* ID_HANDLER_ADD_REG_REG */
+        &x86Semantics::cmpFast_s<triton::arch::OP_MEM, triton::arch::OP_IMM>,     /* ID_HANDLER_CMP_MEM_IMM */
+        &x86Semantics::cmpFast_s<triton::arch::OP_MEM, triton::arch::OP_REG>,     /* ID_HANDLER_CMP_MEM_REG */
+        &x86Semantics::cmpFast_s<triton::arch::OP_REG, triton::arch::OP_IMM>,     /* ID_HANDLER_CMP_REG_IMM */
+        &x86Semantics::cmpFast_s<triton::arch::OP_REG, triton::arch::OP_MEM>,     /* ID_HANDLER_CMP_REG_MEM */
+        &x86Semantics::cmpFast_s<triton::arch::OP_REG, triton::arch::OP_REG>,     /* ID_HANDLER_CMP_REG_REG */
+        &x86Semantics::jccFast_s<triton::arch::ID_REG_X86_CF, false>,             /* ID_HANDLER_JAE */
+        &x86Semantics::jccFast_s<triton::arch::ID_REG_X86_CF, true>,              /* ID_HANDLER_JB */
+        &x86Semantics::jccFast_s<triton::arch::ID_REG_X86_ZF, true>,              /* ID_HANDLER_JE */
+        &x86Semantics::jccFast_s<triton::arch::ID_REG_X86_ZF, false>,             /* ID_HANDLER_JNE */
+        &x86Semantics::jccFast_s<triton::arch::ID_REG_X86_OF, false>,             /* ID_HANDLER_JNO */
+        &x86Semantics::jccFast_s<triton::arch::ID_REG_X86_PF, false>,             /* ID_HANDLER_JNP */
+        &x86Semantics::jccFast_s<triton::arch::ID_REG_X86_SF, false>,             /* ID_HANDLER_JNS */
+        &x86Semantics::jccFast_s<triton::arch::ID_REG_X86_OF, true>,              /* ID_HANDLER_JO */
+        &x86Semantics::jccFast_s<triton::arch::ID_REG_X86_PF, true>,              /* ID_HANDLER_JP */
+        &x86Semantics::jccFast_s<triton::arch::ID_REG_X86_SF, true>,              /* ID_HANDLER_JS */
+        &x86Semantics::lea_s,                                                     /* ID_HANDLER_LEA_REG_MEM */
+        &x86Semantics::movFast_s<triton::arch::OP_MEM, triton::arch::OP_IMM>,     /* ID_HANDLER_MOV_MEM_IMM */
+        &x86Semantics::movFast_s<triton::arch::OP_MEM, triton::arch::OP_REG>,     /* ID_HANDLER_MOV_MEM_REG */
+        &x86Semantics::movFast_s<triton::arch::OP_REG, triton::arch::OP_IMM>,     /* ID_HANDLER_MOV_REG_IMM */
+        &x86Semantics::movFast_s<triton::arch::OP_REG, triton::arch::OP_MEM>,     /* ID_HANDLER_MOV_REG_MEM */
+        &x86Semantics::movFast_s<triton::arch::OP_REG, triton::arch::OP_REG>,     /* ID_HANDLER_MOV_REG_REG */
+        &x86Semantics::popRegFast_s,                                              /* ID_HANDLER_POP_REG */
+        &x86Semantics::pushFast_s<triton::arch::OP_IMM>,                          /* ID_HANDLER_PUSH_IMM */
+        &x86Semantics::pushFast_s<triton::arch::OP_REG>,                          /* ID_HANDLER_PUSH_REG */
+        &x86Semantics::subFast_s<triton::arch::OP_MEM, triton::arch::OP_IMM>,     /* ID_HANDLER_SUB_MEM_IMM */
+        &x86Semantics::subFast_s<triton::arch::OP_MEM, triton::arch::OP_REG>,     /* ID_HANDLER_SUB_MEM_REG */
+        &x86Semantics::subFast_s<triton::arch::OP_REG, triton::arch::OP_IMM>,     /* ID_HANDLER_SUB_REG_IMM */
+        &x86Semantics::subFast_s<triton::arch::OP_REG, triton::arch::OP_MEM>,     /* ID_HANDLER_SUB_REG_MEM */
+        &x86Semantics::subFast_s<triton::arch::OP_REG, triton::arch::OP_REG>,     /* ID_HANDLER_SUB_REG_REG */
+        &x86Semantics::testFast_s<triton::arch::OP_MEM, triton::arch::OP_IMM>,    /* ID_HANDLER_TEST_MEM_IMM */
+        &x86Semantics::testFast_s<triton::arch::OP_MEM, triton::arch::OP_REG>,    /* ID_HANDLER_TEST_MEM_REG */
+        &x86Semantics::testFast_s<triton::arch::OP_REG, triton::arch::OP_IMM>,    /* ID_HANDLER_TEST_REG_IMM */
+        &x86Semantics::testFast_s<triton::arch::OP_REG, triton::arch::OP_REG>,    /* ID_HANDLER_TEST_REG_REG */
+      };
+
+
       triton::uint64 x86Semantics::alignAddStack_s(triton::arch::Instruction& inst, triton::uint32 delta) {
         auto dst = triton::arch::OperandWrapper(this->architecture->getStackPointer());
 
@@ -894,6 +1233,33 @@ namespace triton {
       }
 
 
+      void x86Semantics::flag_s(triton::arch::Instruction& inst,
+                                const triton::engines::symbolic::SharedSymbolicExpression& parent,
+                                const triton::arch::Register& flag,
+                                const std::function<triton::ast::SharedAbstractNode(void)>& node,
+                                const std::string& comment) {
+
+        /* Spread the taint from the parent to the child */
+        bool tainted = this->taintEngine->setTaintRegister(flag, parent->isTainted);
+
+        /*
+         * Defer the expression until the flag is read. Without the symbolic engine, or
+         * only on tainted instructions, the expressions of the instruction are removed
+         * after its semantics and the flag must be built now.
+         */
+        if (this->modes->isModeEnabled(triton::modes::LAZY_FLAGS) &&
+            this->symbolicEngine->isEnabled() &&
+            !this->modes->isModeEnabled(triton::modes::ONLY_ON_TAINTED)) {
+          this->symbolicEngine->deferSymbolicRegisterExpression(inst, flag, node, comment, tainted);
+          return;
+        }
+
+        /* Create the symbolic expression */
+        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node(), flag, comment);
+        expr->isTainted = tainted;
+      }
+
+
       void x86Semantics::controlFlow_s(triton::arch::Instruction& inst) {
         auto pc      = triton::arch::OperandWrapper(this->architecture->getProgramCounter());
         auto counter = triton::arch::OperandWrapper(this->architecture->getParentRegister(ID_REG_X86_CX));
@@ -1008,6 +1374,237 @@ namespace triton {
       }
 
 
+      void x86Semantics::moveMemory_s(triton::uint64 dst, triton::uint64 src, triton::usize size) {
+        std::vector<triton::uint8> area(std::min<triton::usize>(size, triton::engines::symbolic::SymbolicMemory::pageSize));
+        bool backward = (dst > src);
+
+        /* The concrete values are moved by chunks, each one is read before being written (see SymbolicMemory::copy) */
+        for (triton::usize done = 0; done < size;) {
+          triton::usize length = std::min<triton::usize>(size - done, area.size());
+          triton::usize offset = backward ? (size - done - length) : done;
+
+          this->architecture->getConcreteMemoryAreaValue(src + offset, area.data(), length);
+          this->architecture->setConcreteMemoryAreaValue(dst + offset, area.data(), length);
+          done += length;
+        }
+
+        /* The expressions of the memory cells are shared with the destination */
+        this->symbolicEngine->copySymbolicMemory(dst, src, size);
+      }
+
+
+      bool x86Semantics::repString_s(triton::arch::Instruction& inst, triton::arch::OperandWrapper& dst, triton::arch::OperandWrapper& src, const std::string& comment) {
+        auto  index1 = triton::arch::OperandWrapper(this->architecture->getParentRegister(ID_REG_X86_DI));
+        auto  index2 = triton::arch::OperandWrapper(this->architecture->getParentRegister(ID_REG_X86_SI));
+        auto  cx     = triton::arch::OperandWrapper(this->architecture->getParentRegister(ID_REG_X86_CX));
+        auto  df     = triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_X86_DF));
+        auto  pc     = triton::arch::OperandWrapper(this->architecture->getProgramCounter());
+        bool  movs   = (src.getType() == triton::arch::OP_MEM);
+
+        if (!this->modes->isModeEnabled(triton::modes::BULK_STRING_OPERATIONS) || inst.getPrefix() != triton::arch::x86::ID_PREFIX_REP || dst.getType() != triton::arch::OP_MEM)
+          return false;
+
+        /* The number of iterations and the areas must be concrete */
+        if (this->symbolicEngine->isRegisterSymbolized(cx.getConstRegister()) ||
+            this->symbolicEngine->isRegisterSymbolized(df.getConstRegister()) ||
+            this->symbolicEngine->isRegisterSymbolized(index1.getConstRegister()) ||
+            (movs && this->symbolicEngine->isRegisterSymbolized(index2.getConstRegister())))
+          return false;
+
+        triton::uint64 mask     = index1.getConstRegister().getMaxValue().convert_to<triton::uint64>();
+        triton::uint64 count    = this->architecture->getConcreteRegisterValue64(cx.getConstRegister());
+        triton::uint32 size     = dst.getSize();
+        bool           backward = !this->architecture->getConcreteRegisterValue(df.getConstRegister()).is_zero();
+        triton::uint64 to       = dst.getConstMemory().getAddress();
+        triton::uint64 from     = movs ? src.getConstMemory().getAddress() : to;
+
+        /* The areas must not wrap around the address space */
+        if (count > mask / size)
+          return false;
+
+        triton::uint64 total = count * size;
+        if (backward) {
+          if (to + size < total || from + size < total)
+            return false;
+          to   = to + size - total;
+          from = from + size - total;
+        }
+        else if (total - 1 > mask - to || total - 1 > mask - from) {
+          return false;
+        }
+
+        /* A copy overlapping its source against its direction replicates a pattern, unlike memmove */
+        if (movs && from < to + total && to < from + total && (backward ? (to < from) : (to > from)))
+          return false;
+
+        /* Create symbolic operands */
+        auto op1 = this->symbolicEngine->getOperandAst(inst, src);
+        auto op2 = this->symbolicEngine->getOperandAst(inst, index1);
+        auto op3 = movs ? this->symbolicEngine->getOperandAst(inst, index2) : nullptr;
+        auto op4 = this->symbolicEngine->getOperandAst(inst, cx);
+        auto op5 = this->symbolicEngine->getOperandAst(inst, df);
+
+        if (movs) {
+          /* The whole area is moved, no expression is built for the memory */
+          this->moveMemory_s(to, from, total);
+          inst.setStoreAccess(dst.getConstMemory(), op1);
+
+          /* Spread taint in the order of the iterations */
+          if (this->taintEngine->isEnabled()) {
+            for (triton::uint64 index = 0; index < count; index++) {
+              triton::uint64 offset = (backward ? (count - index - 1) : index) * size;
+              this->taintEngine->taintAssignment(triton::arch::MemoryAccess(to + offset, size), triton::arch::MemoryAccess(from + offset, size));
+            }
+          }
+        }
+        else {
+          /* The first iteration stores the register */
+          auto expr1 = this->symbolicEngine->createSymbolicExpression(inst, op1, dst, comment);
+          expr1->isTainted = this->taintEngine->taintAssignment(dst, src);
+
+          /* The next ones are replicated by doubling the filled part of the area */
+          for (triton::uint64 filled = size; filled < total;) {
+            triton::uint64 length = std::min(filled, total - filled);
+            if (backward)
+              this->moveMemory_s(to + total - filled - length, to + total - filled, length);
+            else
+              this->moveMemory_s(to + filled, to, length);
+            filled += length;
+          }
+
+          /* Spread taint */
+          if (this->taintEngine->isEnabled()) {
+            for (triton::uint64 offset = 0; offset < total; offset += size)
+              this->taintEngine->taintAssignment(triton::arch::MemoryAccess(to + offset, size), src.getConstRegister());
+          }
+        }
+
+        /* Create the semantics */
+        auto node2 = this->astCtxt->ite(
+                       this->astCtxt->equal(op5, this->astCtxt->bvfalse()),
+                       this->astCtxt->bvadd(op2, this->astCtxt->bv(total, index1.getBitSize())),
+                       this->astCtxt->bvsub(op2, this->astCtxt->bv(total, index1.getBitSize()))
+                     );
+        auto node4 = this->astCtxt->bv(0, op4->getBitvectorSize());
+        auto node5 = this->astCtxt->bv(inst.getNextAddress(), pc.getBitSize());
+
+        /* Create symbolic expression */
+        auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, node2, index1, "Index (DI) operation");
+        expr2->isTainted = this->taintEngine->taintUnion(index1, index1);
+
+        if (movs) {
+          auto node3 = this->astCtxt->ite(
+                         this->astCtxt->equal(op5, this->astCtxt->bvfalse()),
+                         this->astCtxt->bvadd(op3, this->astCtxt->bv(total, index2.getBitSize())),
+                         this->astCtxt->bvsub(op3, this->astCtxt->bv(total, index2.getBitSize()))
+                       );
+          auto expr3 = this->symbolicEngine->createSymbolicExpression(inst, node3, index2, "Index (SI) operation");
+          expr3->isTainted = this->taintEngine->taintUnion(index2, index2);
+        }
+
+        auto expr4 = this->symbolicEngine->createSymbolicExpression(inst, node4, cx, "Counter operation");
+        auto expr5 = this->symbolicEngine->createSymbolicExpression(inst, node5, pc, "Program Counter");
+
+        /* Spread taint for PC */
+        expr4->isTainted = this->taintEngine->taintUnion(cx, cx);
+        expr5->isTainted = this->taintEngine->taintAssignment(pc, cx);
+
+        return true;
+      }
+
+
+      void x86Semantics::repCompare_s(triton::arch::Instruction& inst, triton::arch::OperandWrapper& dst, triton::arch::OperandWrapper& src) {
+        auto  index1 = triton::arch::OperandWrapper(this->architecture->getParentRegister(ID_REG_X86_SI));
+        auto  index2 = triton::arch::OperandWrapper(this->architecture->getParentRegister(ID_REG_X86_DI));
+        auto  cx     = triton::arch::OperandWrapper(this->architecture->getParentRegister(ID_REG_X86_CX));
+        auto  df     = triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_X86_DF));
+        bool  cmps   = (dst.getType() == triton::arch::OP_MEM);
+        bool  repe   = (inst.getPrefix() == triton::arch::x86::ID_PREFIX_REPE);
+
+        if (!this->modes->isModeEnabled(triton::modes::BULK_STRING_OPERATIONS) || (!repe && inst.getPrefix() != triton::arch::x86::ID_PREFIX_REPNE))
+          return;
+
+        /* Only the string forms, not the SSE comparisons */
+        if (src.getType() != triton::arch::OP_MEM || (!cmps && dst.getType() != triton::arch::OP_REG) || dst.getSize() != src.getSize())
+          return;
+
+        /* The number of iterations, the areas and the scanned value must be concrete */
+        if (this->symbolicEngine->isRegisterSymbolized(cx.getConstRegister()) ||
+            this->symbolicEngine->isRegisterSymbolized(df.getConstRegister()) ||
+            this->symbolicEngine->isRegisterSymbolized(index2.getConstRegister()) ||
+            this->symbolicEngine->isRegisterSymbolized(cmps ? index1.getConstRegister() : dst.getConstRegister()))
+          return;
+
+        triton::uint64  mask     = index2.getConstRegister().getMaxValue().convert_to<triton::uint64>();
+        triton::uint64  count    = this->architecture->getConcreteRegisterValue64(cx.getConstRegister());
+        triton::uint32  size     = src.getSize();
+        bool            backward = !this->architecture->getConcreteRegisterValue(df.getConstRegister()).is_zero();
+        triton::uint64  addr1    = cmps ? dst.getConstMemory().getAddress() : 0;
+        triton::uint64  addr2    = src.getConstMemory().getAddress();
+        triton::uint512 value    = cmps ? 0 : this->architecture->getConcreteRegisterValue(dst.getConstRegister());
+        triton::uint64  skipped  = 0;
+
+        /* The last iteration and the one stopping the repetition are executed as usual */
+        while (skipped + 1 < count) {
+          if (this->symbolicEngine->isMemorySymbolized(addr2, size) || (cmps && this->symbolicEngine->isMemorySymbolized(addr1, size)))
+            break;
+
+          triton::uint512 op1 = cmps ? this->architecture->getConcreteMemoryValue(triton::arch::MemoryAccess(addr1, size)) : value;
+          triton::uint512 op2 = this->architecture->getConcreteMemoryValue(triton::arch::MemoryAccess(addr2, size));
+          if ((op1 == op2) != repe)
+            break;
+
+          /* The next iteration must not wrap around the address space */
+          if (backward ? (addr2 < size || (cmps && addr1 < size)) : (addr2 > mask - size || (cmps && addr1 > mask - size)))
+            break;
+
+          addr1 = backward ? (addr1 - size) : (addr1 + size);
+          addr2 = backward ? (addr2 - size) : (addr2 + size);
+          skipped++;
+        }
+
+        if (skipped == 0)
+          return;
+
+        /* Create symbolic operands */
+        auto op1 = cmps ? this->symbolicEngine->getOperandAst(inst, index1) : nullptr;
+        auto op2 = this->symbolicEngine->getOperandAst(inst, index2);
+        auto op3 = this->symbolicEngine->getOperandAst(inst, cx);
+        auto op4 = this->symbolicEngine->getOperandAst(inst, df);
+
+        /* Create the semantics of the skipped iterations */
+        auto node2 = this->astCtxt->ite(
+                       this->astCtxt->equal(op4, this->astCtxt->bvfalse()),
+                       this->astCtxt->bvadd(op2, this->astCtxt->bv(skipped * size, index2.getBitSize())),
+                       this->astCtxt->bvsub(op2, this->astCtxt->bv(skipped * size, index2.getBitSize()))
+                     );
+        auto node3 = this->astCtxt->bvsub(op3, this->astCtxt->bv(skipped, cx.getBitSize()));
+
+        /* Create symbolic expression */
+        if (cmps) {
+          auto node1 = this->astCtxt->ite(
+                         this->astCtxt->equal(op4, this->astCtxt->bvfalse()),
+                         this->astCtxt->bvadd(op1, this->astCtxt->bv(skipped * size, index1.getBitSize())),
+                         this->astCtxt->bvsub(op1, this->astCtxt->bv(skipped * size, index1.getBitSize()))
+                       );
+          auto expr1 = this->symbolicEngine->createSymbolicExpression(inst, node1, index1, "Index (SI) operation");
+          expr1->isTainted = this->taintEngine->taintUnion(index1, index1);
+        }
+
+        auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, node2, index2, "Index (DI) operation");
+        auto expr3 = this->symbolicEngine->createSymbolicExpression(inst, node3, cx, "Counter operation");
+
+        /* Spread taint */
+        expr2->isTainted = this->taintEngine->taintUnion(index2, index2);
+        expr3->isTainted = this->taintEngine->taintUnion(cx, cx);
+
+        /* The next iteration compares the cells following the skipped ones */
+        if (cmps)
+          dst.getMemory().setAddress(addr1);
+        src.getMemory().setAddress(addr2);
+      }
+
+
       //! Update the FPU x87 Tag Word (whenever an STX register changes)
       void x86Semantics::updateFTW(triton::arch::Instruction& inst, const triton::engines::symbolic::SharedSymbolicExpression& parent) {
         /* Fetch the STX registers */
@@ -1251,26 +1848,26 @@ namespace triton {
          * Create the semantic.
          * af = 0x10 == (0x10 & (regDst ^ op1 ^ op2))
          */
-        auto node = this->astCtxt->ite(
-                      this->astCtxt->equal(
-                        this->astCtxt->bv(0x10, bvSize),
-                        this->astCtxt->bvand(
-                          this->astCtxt->bv(0x10, bvSize),
-                          this->astCtxt->bvxor(
-                            this->astCtxt->extract(high, low, this->astCtxt->reference(parent)),
-                            this->astCtxt->bvxor(op1, op2)
-                          )
-                        )
-                      ),
-                      this->astCtxt->bv(1, 1),
-                      this->astCtxt->bv(0, 1)
-                    );
+        auto astCtxt = this->astCtxt;
+        auto node    = [=]() {
+          return astCtxt->ite(
+                   astCtxt->equal(
+                     astCtxt->bv(0x10, bvSize),
+                     astCtxt->bvand(
+                       astCtxt->bv(0x10, bvSize),
+                       astCtxt->bvxor(
+                         astCtxt->extract(high, low, astCtxt->reference(parent)),
+                         astCtxt->bvxor(op1, op2)
+                       )
+                     )
+                   ),
+                   astCtxt->bv(1, 1),
+                   astCtxt->bv(0, 1)
+                 );
+        };
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_AF), "Adjust flag");
-
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_AF), parent->isTainted);
+        this->flag_s(inst, parent, this->architecture->getRegister(ID_REG_X86_AF), node, "Adjust flag");
       }
 
 
@@ -1392,23 +1989,23 @@ namespace triton {
          * Create the semantic.
          * cf = MSB((op1 & op2) ^ ((op1 ^ op2 ^ parent) & (op1 ^ op2)));
          */
-        auto node = this->astCtxt->extract(bvSize-1, bvSize-1,
-                      this->astCtxt->bvxor(
-                        this->astCtxt->bvand(op1, op2),
-                        this->astCtxt->bvand(
-                          this->astCtxt->bvxor(
-                            this->astCtxt->bvxor(op1, op2),
-                            this->astCtxt->extract(high, low, this->astCtxt->reference(parent))
-                          ),
-                        this->astCtxt->bvxor(op1, op2))
-                      )
-                    );
+        auto astCtxt = this->astCtxt;
+        auto node    = [=]() {
+          return astCtxt->extract(bvSize-1, bvSize-1,
+                   astCtxt->bvxor(
+                     astCtxt->bvand(op1, op2),
+                     astCtxt->bvand(
+                       astCtxt->bvxor(
+                         astCtxt->bvxor(op1, op2),
+                         astCtxt->extract(high, low, astCtxt->reference(parent))
+                       ),
+                     astCtxt->bvxor(op1, op2))
+                   )
+                 );
+        };
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_CF), "Carry flag");
-
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_CF), parent->isTainted);
+        this->flag_s(inst, parent, this->architecture->getRegister(ID_REG_X86_CF), node, "Carry flag");
       }
 
 
@@ -1971,25 +2568,41 @@ namespace triton {
         auto low    = vol ? 0 : dst.getLow();
         auto high   = vol ? bvSize-1 : dst.getHigh();
 
+        /*
+         * With LOOP_INDUCTION_VARIABLES, the borrow of op1 - op2 is the comparison it is, so that the
+         * path manager summarizes the iterations of a loop comparing an induction variable in closed form.
+         */
+        const auto& res = parent->getAst();
+        if (this->modes->isModeEnabled(triton::modes::LOOP_INDUCTION_VARIABLES) &&
+            res->getType() == triton::ast::BVSUB_NODE && res->getChildren()[0] == op1 && res->getChildren()[1] == op2) {
+          auto astCtxt = this->astCtxt;
+          auto node    = [=]() {
+            return astCtxt->ite(astCtxt->bvult(op1, op2), astCtxt->bvtrue(), astCtxt->bvfalse());
+          };
+
+          this->flag_s(inst, parent, this->architecture->getRegister(ID_REG_X86_CF), node, "Carry flag");
+          return;
+        }
+
         /*
          * Create the semantic.
          * cf = extract(bvSize, bvSize (((op1 ^ op2 ^ res) ^ ((op1 ^ res) & (op1 ^ op2)))))
          */
-        auto node = this->astCtxt->extract(bvSize-1, bvSize-1,
-                      this->astCtxt->bvxor(
-                        this->astCtxt->bvxor(op1, this->astCtxt->bvxor(op2, this->astCtxt->extract(high, low, this->astCtxt->reference(parent)))),
-                        this->astCtxt->bvand(
-                          this->astCtxt->bvxor(op1, this->astCtxt->extract(high, low, this->astCtxt->reference(parent))),
-                          this->astCtxt->bvxor(op1, op2)
-                        )
-                      )
-                    );
+        auto astCtxt = this->astCtxt;
+        auto node    = [=]() {
+          return astCtxt->extract(bvSize-1, bvSize-1,
+                   astCtxt->bvxor(
+                     astCtxt->bvxor(op1, astCtxt->bvxor(op2, astCtxt->extract(high, low, astCtxt->reference(parent)))),
+                     astCtxt->bvand(
+                       astCtxt->bvxor(op1, astCtxt->extract(high, low, astCtxt->reference(parent))),
+                       astCtxt->bvxor(op1, op2)
+                     )
+                   )
+                 );
+        };
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_CF), "Carry flag");
-
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_CF), parent->isTainted);
+        this->flag_s(inst, parent, this->architecture->getRegister(ID_REG_X86_CF), node, "Carry flag");
       }
 
 
@@ -2039,18 +2652,18 @@ namespace triton {
          * Create the semantic.
          * of = MSB((op1 ^ ~op2) & (op1 ^ regDst))
          */
-        auto node = this->astCtxt->extract(bvSize-1, bvSize-1,
-                      this->astCtxt->bvand(
-                        this->astCtxt->bvxor(op1, this->astCtxt->bvnot(op2)),
-                        this->astCtxt->bvxor(op1, this->astCtxt->extract(high, low, this->astCtxt->reference(parent)))
-                      )
-                    );
+        auto astCtxt = this->astCtxt;
+        auto node    = [=]() {
+          return astCtxt->extract(bvSize-1, bvSize-1,
+                   astCtxt->bvand(
+                     astCtxt->bvxor(op1, astCtxt->bvnot(op2)),
+                     astCtxt->bvxor(op1, astCtxt->extract(high, low, astCtxt->reference(parent)))
+                   )
+                 );
+        };
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_OF), "Overflow flag");
-
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_OF), parent->isTainted);
+        this->flag_s(inst, parent, this->architecture->getRegister(ID_REG_X86_OF), node, "Overflow flag");
       }
 
 
@@ -2467,18 +3080,18 @@ namespace triton {
          * Create the semantic.
          * of = high:bool((op1 ^ op2) & (op1 ^ regDst))
          */
-        auto node = this->astCtxt->extract(bvSize-1, bvSize-1,
-                      this->astCtxt->bvand(
-                        this->astCtxt->bvxor(op1, op2),
-                        this->astCtxt->bvxor(op1, this->astCtxt->extract(high, low, this->astCtxt->reference(parent)))
-                      )
-                    );
+        auto astCtxt = this->astCtxt;
+        auto node    = [=]() {
+          return astCtxt->extract(bvSize-1, bvSize-1,
+                   astCtxt->bvand(
+                     astCtxt->bvxor(op1, op2),
+                     astCtxt->bvxor(op1, astCtxt->extract(high, low, astCtxt->reference(parent)))
+                   )
+                 );
+        };
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_OF), "Overflow flag");
-
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_OF), parent->isTainted);
+        this->flag_s(inst, parent, this->architecture->getRegister(ID_REG_X86_OF), node, "Overflow flag");
       }
 
 
@@ -2496,24 +3109,13 @@ namespace triton {
          * pf is set to one if there is an even number of bit set to 1 in the least
          * significant byte of the result.
          */
-        auto node = this->astCtxt->bv(1, 1);
-        for (triton::uint32 counter = 0; counter <= triton::bitsize::byte-1; counter++) {
-          node = this->astCtxt->bvxor(
-                   node,
-                   this->astCtxt->extract(0, 0,
-                     this->astCtxt->bvlshr(
-                       this->astCtxt->extract(high, low, this->astCtxt->reference(parent)),
-                       this->astCtxt->bv(counter, triton::bitsize::byte)
-                     )
-                  )
-                );
-        }
+        auto astCtxt = this->astCtxt;
+        auto node    = [=]() {
+          return astCtxt->bvnot(astCtxt->bvparity(astCtxt->extract(high, low, astCtxt->reference(parent))));
+        };
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_PF), "Parity flag");
-
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_PF), parent->isTainted);
+        this->flag_s(inst, parent, this->architecture->getRegister(ID_REG_X86_PF), node, "Parity flag");
       }
 
 
@@ -2532,18 +3134,7 @@ namespace triton {
          * Create the semantics.
          * pf if op2 != 0
          */
-        auto node1 = this->astCtxt->bv(1, 1);
-        for (triton::uint32 counter = 0; counter <= triton::bitsize::byte-1; counter++) {
-          node1 = this->astCtxt->bvxor(
-                   node1,
-                   this->astCtxt->extract(0, 0,
-                     this->astCtxt->bvlshr(
-                       this->astCtxt->extract(high, low, this->astCtxt->reference(parent)),
-                       this->astCtxt->bv(counter, triton::bitsize::byte)
-                     )
-                  )
-                );
-        }
+        auto node1 = this->astCtxt->bvnot(this->astCtxt->bvparity(this->astCtxt->extract(high, low, this->astCtxt->reference(parent))));
 
         auto node2 = this->astCtxt->ite(
                        this->astCtxt->equal(this->astCtxt->zx(bvSize - op2->getBitvectorSize(), op2), this->astCtxt->bv(0, bvSize)),
@@ -2576,13 +3167,13 @@ namespace triton {
          * Create the semantic.
          * sf = high:bool(regDst)
          */
-        auto node = this->astCtxt->extract(high, high, this->astCtxt->reference(parent));
+        auto astCtxt = this->astCtxt;
+        auto node    = [=]() {
+          return astCtxt->extract(high, high, astCtxt->reference(parent));
+        };
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_SF), "Sign flag");
-
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_SF), parent->isTainted);
+        this->flag_s(inst, parent, this->architecture->getRegister(ID_REG_X86_SF), node, "Sign flag");
       }
 
 
@@ -2718,20 +3309,20 @@ namespace triton {
          * Create the semantic.
          * zf = 0 == regDst
          */
-        auto node = this->astCtxt->ite(
-                      this->astCtxt->equal(
-                        this->astCtxt->extract(high, low, this->astCtxt->reference(parent)),
-                        this->astCtxt->bv(0, bvSize)
-                      ),
-                      this->astCtxt->bv(1, 1),
-                      this->astCtxt->bv(0, 1)
-                    );
+        auto astCtxt = this->astCtxt;
+        auto node    = [=]() {
+          return astCtxt->ite(
+                   astCtxt->equal(
+                     astCtxt->extract(high, low, astCtxt->reference(parent)),
+                     astCtxt->bv(0, bvSize)
+                   ),
+                   astCtxt->bv(1, 1),
+                   astCtxt->bv(0, 1)
+                 );
+        };
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_ZF), "Zero flag");
-
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_ZF), parent->isTainted);
+        this->flag_s(inst, parent, this->architecture->getRegister(ID_REG_X86_ZF), node, "Zero flag");
       }
 
 
@@ -3109,7 +3700,7 @@ namespace triton {
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "AND operation");
 
         /* Spread taint */
-        expr->isTainted = this->taintEngine->taintUnion(dst, src);
+        expr->isTainted = this->taintEngine->taintBitwise(triton::ast::BVAND_NODE, dst, src, op1->evaluate().convert_to<triton::uint64>(), op2->evaluate().convert_to<triton::uint64>());
 
         /* Update symbolic flags */
         this->clearFlag_s(inst, this->architecture->getRegister(ID_REG_X86_CF), "Clears carry flag");
@@ -4200,7 +4791,7 @@ namespace triton {
         auto op4 = this->symbolicEngine->getOperandAst(inst, zf);
 
         /* Create the semantics */
-        auto node = this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->bvand(this->astCtxt->bvnot(op3), this->astCtxt->bvnot(op4)), this->astCtxt->bvtrue()), op2, op1);
+        auto node = this->astCtxt->iteFold(this->astCtxt->equal(this->astCtxt->bvand(this->astCtxt->bvnot(op3), this->astCtxt->bvnot(op4)), this->astCtxt->bvtrue()), op2, op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "CMOVA operation");
@@ -4232,7 +4823,7 @@ namespace triton {
         auto op3 = this->symbolicEngine->getOperandAst(inst, cf);
 
         /* Create the semantics */
-        auto node = this->astCtxt->ite(this->astCtxt->equal(op3, this->astCtxt->bvfalse()), op2, op1);
+        auto node = this->astCtxt->iteFold(this->astCtxt->equal(op3, this->astCtxt->bvfalse()), op2, op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "CMOVAE operation");
@@ -4264,7 +4855,7 @@ namespace triton {
         auto op3 = this->symbolicEngine->getOperandAst(inst, cf);
 
         /* Create the semantics */
-        auto node = this->astCtxt->ite(this->astCtxt->equal(op3, this->astCtxt->bvtrue()), op2, op1);
+        auto node = this->astCtxt->iteFold(this->astCtxt->equal(op3, this->astCtxt->bvtrue()), op2, op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "CMOVB operation");
@@ -4298,7 +4889,7 @@ namespace triton {
         auto op4 = this->symbolicEngine->getOperandAst(inst, zf);
 
         /* Create the semantics */
-        auto node = this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->bvor(op3, op4), this->astCtxt->bvtrue()), op2, op1);
+        auto node = this->astCtxt->iteFold(this->astCtxt->equal(this->astCtxt->bvor(op3, op4), this->astCtxt->bvtrue()), op2, op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "CMOVBE operation");
@@ -4330,7 +4921,7 @@ namespace triton {
         auto op3 = this->symbolicEngine->getOperandAst(inst, zf);
 
         /* Create the semantics */
-        auto node = this->astCtxt->ite(this->astCtxt->equal(op3, this->astCtxt->bvtrue()), op2, op1);
+        auto node = this->astCtxt->iteFold(this->astCtxt->equal(op3, this->astCtxt->bvtrue()), op2, op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "CMOVE operation");
@@ -4366,7 +4957,7 @@ namespace triton {
         auto op5 = this->symbolicEngine->getOperandAst(inst, zf);
 
         /* Create the semantics */
-        auto node = this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->bvor(this->astCtxt->bvxor(op3, op4), op5), this->astCtxt->bvfalse()), op2, op1);
+        auto node = this->astCtxt->iteFold(this->astCtxt->equal(this->astCtxt->bvor(this->astCtxt->bvxor(op3, op4), op5), this->astCtxt->bvfalse()), op2, op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "CMOVG operation");
@@ -4400,7 +4991,7 @@ namespace triton {
         auto op4 = this->symbolicEngine->getOperandAst(inst, of);
 
         /* Create the semantics */
-        auto node = this->astCtxt->ite(this->astCtxt->equal(op3, op4), op2, op1);
+        auto node = this->astCtxt->iteFold(this->astCtxt->equal(op3, op4), op2, op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "CMOVGE operation");
@@ -4434,7 +5025,7 @@ namespace triton {
         auto op4 = this->symbolicEngine->getOperandAst(inst, of);
 
         /* Create the semantics */
-        auto node = this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->bvxor(op3, op4), this->astCtxt->bvtrue()), op2, op1);
+        auto node = this->astCtxt->iteFold(this->astCtxt->equal(this->astCtxt->bvxor(op3, op4), this->astCtxt->bvtrue()), op2, op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "CMOVL operation");
@@ -4471,7 +5062,7 @@ namespace triton {
         auto op5 = this->symbolicEngine->getOperandAst(inst, zf);
 
         /* Create the semantics */
-        auto node = this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->bvor(this->astCtxt->bvxor(op3, op4), op5), this->astCtxt->bvtrue()), op2, op1);
+        auto node = this->astCtxt->iteFold(this->astCtxt->equal(this->astCtxt->bvor(this->astCtxt->bvxor(op3, op4), op5), this->astCtxt->bvtrue()), op2, op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "CMOVBE operation");
@@ -4503,7 +5094,7 @@ namespace triton {
         auto op3 = this->symbolicEngine->getOperandAst(inst, zf);
 
         /* Create the semantics */
-        auto node = this->astCtxt->ite(this->astCtxt->equal(op3, this->astCtxt->bvfalse()), op2, op1);
+        auto node = this->astCtxt->iteFold(this->astCtxt->equal(op3, this->astCtxt->bvfalse()), op2, op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "CMOVNE operation");
@@ -4535,7 +5126,7 @@ namespace triton {
         auto op3 = this->symbolicEngine->getOperandAst(inst, of);
 
         /* Create the semantics */
-        auto node = this->astCtxt->ite(this->astCtxt->equal(op3, this->astCtxt->bvfalse()), op2, op1);
+        auto node = this->astCtxt->iteFold(this->astCtxt->equal(op3, this->astCtxt->bvfalse()), op2, op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "CMOVNO operation");
@@ -4567,7 +5158,7 @@ namespace triton {
         auto op3 = this->symbolicEngine->getOperandAst(inst, pf);
 
         /* Create the semantics */
-        auto node = this->astCtxt->ite(this->astCtxt->equal(op3, this->astCtxt->bvfalse()), op2, op1);
+        auto node = this->astCtxt->iteFold(this->astCtxt->equal(op3, this->astCtxt->bvfalse()), op2, op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "CMOVNP operation");
@@ -4599,7 +5190,7 @@ namespace triton {
         auto op3 = this->symbolicEngine->getOperandAst(inst, sf);
 
         /* Create the semantics */
-        auto node = this->astCtxt->ite(this->astCtxt->equal(op3, this->astCtxt->bvfalse()), op2, op1);
+        auto node = this->astCtxt->iteFold(this->astCtxt->equal(op3, this->astCtxt->bvfalse()), op2, op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "CMOVNS operation");
@@ -4631,7 +5222,7 @@ namespace triton {
         auto op3 = this->symbolicEngine->getOperandAst(inst, of);
 
         /* Create the semantics */
-        auto node = this->astCtxt->ite(this->astCtxt->equal(op3, this->astCtxt->bvtrue()), op2, op1);
+        auto node = this->astCtxt->iteFold(this->astCtxt->equal(op3, this->astCtxt->bvtrue()), op2, op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "CMOVO operation");
@@ -4663,7 +5254,7 @@ namespace triton {
         auto op3 = this->symbolicEngine->getOperandAst(inst, pf);
 
         /* Create the semantics */
-        auto node = this->astCtxt->ite(this->astCtxt->equal(op3, this->astCtxt->bvtrue()), op2, op1);
+        auto node = this->astCtxt->iteFold(this->astCtxt->equal(op3, this->astCtxt->bvtrue()), op2, op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "CMOVP operation");
@@ -4695,7 +5286,7 @@ namespace triton {
         auto op3 = this->symbolicEngine->getOperandAst(inst, sf);
 
         /* Create the semantics */
-        auto node = this->astCtxt->ite(this->astCtxt->equal(op3, this->astCtxt->bvtrue()), op2, op1);
+        auto node = this->astCtxt->iteFold(this->astCtxt->equal(op3, this->astCtxt->bvtrue()), op2, op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "CMOVS operation");
@@ -4764,6 +5355,9 @@ namespace triton {
           return;
         }
 
+        /* Skip the iterations which do not stop the repetition */
+        this->repCompare_s(inst, dst, src);
+
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->getOperandAst(inst, dst);
         auto op2 = this->symbolicEngine->getOperandAst(inst, src);
@@ -4825,6 +5419,9 @@ namespace triton {
           return;
         }
 
+        /* Skip the iterations which do not stop the repetition */
+        this->repCompare_s(inst, dst, src);
+
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->getOperandAst(inst, dst);
         auto op2 = this->symbolicEngine->getOperandAst(inst, src);
@@ -4886,6 +5483,9 @@ namespace triton {
           return;
         }
 
+        /* Skip the iterations which do not stop the repetition */
+        this->repCompare_s(inst, dst, src);
+
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->getOperandAst(inst, dst);
         auto op2 = this->symbolicEngine->getOperandAst(inst, src);
@@ -4947,6 +5547,9 @@ namespace triton {
           return;
         }
 
+        /* Skip the iterations which do not stop the repetition */
+        this->repCompare_s(inst, dst, src);
+
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->getOperandAst(inst, dst);
         auto op2 = this->symbolicEngine->getOperandAst(inst, src);
@@ -8125,7 +8728,7 @@ namespace triton {
       void x86Semantics::leave_s(triton::arch::Instruction& inst) {
         auto stack     = this->architecture->getStackPointer();
         auto base      = this->architecture->getParentRegister(ID_REG_X86_BP);
-        auto baseValue = this->architecture->getConcreteRegisterValue(base).convert_to<triton::uint64>();
+        auto baseValue = this->architecture->getConcreteRegisterValue64(base);
         auto bp1       = triton::arch::OperandWrapper(triton::arch::MemoryAccess(baseValue, base.getSize()));
         auto bp2       = triton::arch::OperandWrapper(this->architecture->getParentRegister(ID_REG_X86_BP));
         auto sp        = triton::arch::OperandWrapper(stack);
@@ -9293,6 +9896,10 @@ namespace triton {
           return;
         }
 
+        /* Execute all the iterations at once */
+        if (this->repString_s(inst, dst, src, "MOVSB operation"))
+          return;
+
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->getOperandAst(inst, src);
         auto op2 = this->symbolicEngine->getOperandAst(inst, index1);
@@ -9341,6 +9948,10 @@ namespace triton {
           return;
         }
 
+        /* Execute all the iterations at once */
+        if (this->repString_s(inst, dst, src, "MOVSD operation"))
+          return;
+
         /*
          * F2 0F 10 /r MOVSD xmm1, xmm2
          * F2 0F 10 /r MOVSD xmm1, m64
@@ -9484,6 +10095,10 @@ namespace triton {
           return;
         }
 
+        /* Execute all the iterations at once */
+        if (this->repString_s(inst, dst, src, "MOVSQ operation"))
+          return;
+
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->getOperandAst(inst, src);
         auto op2 = this->symbolicEngine->getOperandAst(inst, index1);
@@ -9532,6 +10147,10 @@ namespace triton {
           return;
         }
 
+        /* Execute all the iterations at once */
+        if (this->repString_s(inst, dst, src, "MOVSW operation"))
+          return;
+
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->getOperandAst(inst, src);
         auto op2 = this->symbolicEngine->getOperandAst(inst, index1);
@@ -9883,7 +10502,7 @@ namespace triton {
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "OR operation");
 
         /* Apply the taint */
-        expr->isTainted = this->taintEngine->taintUnion(dst, src);
+        expr->isTainted = this->taintEngine->taintBitwise(triton::ast::BVOR_NODE, dst, src, op1->evaluate().convert_to<triton::uint64>(), op2->evaluate().convert_to<triton::uint64>());
 
         /* Update symbolic flags */
         this->clearFlag_s(inst, this->architecture->getRegister(ID_REG_X86_CF), "Clears carry flag");
@@ -10080,40 +10699,10 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> packed;
-        packed.reserve(16);
-
-        switch (dst.getBitSize()) {
-
-          /* XMM */
-          case triton::bitsize::dqword:
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(127, 120, op1), this->astCtxt->extract(127, 120, op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(119, 112, op1), this->astCtxt->extract(119, 112, op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(111, 104, op1), this->astCtxt->extract(111, 104, op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(103, 96,  op1), this->astCtxt->extract(103, 96,  op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(95,  88,  op1), this->astCtxt->extract(95,  88,  op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(87,  80,  op1), this->astCtxt->extract(87,  80,  op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(79,  72,  op1), this->astCtxt->extract(79,  72,  op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(71,  64,  op1), this->astCtxt->extract(71,  64,  op2)));
-
-          /* MMX */
-          case triton::bitsize::qword:
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(63,  56,  op1), this->astCtxt->extract(63,  56,  op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(55,  48,  op1), this->astCtxt->extract(55,  48,  op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(47,  40,  op1), this->astCtxt->extract(47,  40,  op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(39,  32,  op1), this->astCtxt->extract(39,  32,  op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(31,  24,  op1), this->astCtxt->extract(31,  24,  op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(23,  16,  op1), this->astCtxt->extract(23,  16,  op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(15,  8,   op1), this->astCtxt->extract(15,  8,   op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(7,   0,   op1), this->astCtxt->extract(7,   0,   op2)));
-            break;
+        if (dst.getBitSize() != triton::bitsize::dqword && dst.getBitSize() != triton::bitsize::qword)
+          throw triton::exceptions::Semantics("x86Semantics::paddb_s(): Invalid operand size.");
 
-          default:
-            throw triton::exceptions::Semantics("x86Semantics::paddb_s(): Invalid operand size.");
-
-        }
-
-        auto node = this->astCtxt->concat(packed);
+        auto node = this->astCtxt->bvlaneadd(op1, op2, triton::bitsize::byte);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PADDB operation");
@@ -10140,28 +10729,10 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> packed;
-        packed.reserve(4);
-
-        switch (dst.getBitSize()) {
-
-          /* XMM */
-          case triton::bitsize::dqword:
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(127, 96, op1), this->astCtxt->extract(127, 96, op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(95,  64, op1), this->astCtxt->extract(95,  64, op2)));
-
-          /* MMX */
-          case triton::bitsize::qword:
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(63,  32, op1), this->astCtxt->extract(63,  32, op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(31,  0,  op1), this->astCtxt->extract(31,  0,  op2)));
-            break;
+        if (dst.getBitSize() != triton::bitsize::dqword && dst.getBitSize() != triton::bitsize::qword)
+          throw triton::exceptions::Semantics("x86Semantics::paddd_s(): Invalid operand size.");
 
-          default:
-            throw triton::exceptions::Semantics("x86Semantics::paddd_s(): Invalid operand size.");
-
-        }
-
-        auto node = this->astCtxt->concat(packed);
+        auto node = this->astCtxt->bvlaneadd(op1, op2, triton::bitsize::dword);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PADDD operation");
@@ -10188,26 +10759,10 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> packed;
-        packed.reserve(2);
-
-        switch (dst.getBitSize()) {
-
-          /* XMM */
-          case triton::bitsize::dqword:
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(127, 64, op1), this->astCtxt->extract(127, 64, op2)));
-
-          /* MMX */
-          case triton::bitsize::qword:
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(63,  0,  op1), this->astCtxt->extract(63,  0,  op2)));
-            break;
+        if (dst.getBitSize() != triton::bitsize::dqword && dst.getBitSize() != triton::bitsize::qword)
+          throw triton::exceptions::Semantics("x86Semantics::paddq_s(): Invalid operand size.");
 
-          default:
-            throw triton::exceptions::Semantics("x86Semantics::paddq_s(): Invalid operand size.");
-
-        }
-
-        auto node = this->astCtxt->concat(packed);
+        auto node = this->astCtxt->bvlaneadd(op1, op2, triton::bitsize::qword);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PADDQ operation");
@@ -10234,32 +10789,10 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> packed;
-        packed.reserve(8);
-
-        switch (dst.getBitSize()) {
-
-          /* XMM */
-          case triton::bitsize::dqword:
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(127, 112, op1), this->astCtxt->extract(127, 112, op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(111, 96,  op1), this->astCtxt->extract(111, 96,  op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(95,  80,  op1), this->astCtxt->extract(95,  80,  op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(79,  64,  op1), this->astCtxt->extract(79,  64,  op2)));
-
-          /* MMX */
-          case triton::bitsize::qword:
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(63,  48,  op1), this->astCtxt->extract(63,  48,  op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(47,  32,  op1), this->astCtxt->extract(47,  32,  op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(31,  16,  op1), this->astCtxt->extract(31,  16,  op2)));
-            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(15,  0,   op1), this->astCtxt->extract(15,  0,   op2)));
-            break;
+        if (dst.getBitSize() != triton::bitsize::dqword && dst.getBitSize() != triton::bitsize::qword)
+          throw triton::exceptions::Semantics("x86Semantics::paddw_s(): Invalid operand size.");
 
-          default:
-            throw triton::exceptions::Semantics("x86Semantics::paddw_s(): Invalid operand size.");
-
-        }
-
-        auto node = this->astCtxt->concat(packed);
+        auto node = this->astCtxt->bvlaneadd(op1, op2, triton::bitsize::word);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PADDW operation");
@@ -10465,22 +10998,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> pck;
-        pck.reserve(dst.getSize());
-
-        for (triton::uint32 index = 0; index < dst.getSize(); index++) {
-          uint32 high = (dst.getBitSize() - 1) - (index * triton::bitsize::byte);
-          uint32 low  = (dst.getBitSize() - triton::bitsize::byte) - (index * triton::bitsize::byte);
-          pck.push_back(this->astCtxt->ite(
-                          this->astCtxt->equal(
-                            this->astCtxt->extract(high, low, op1),
-                            this->astCtxt->extract(high, low, op2)),
-                          this->astCtxt->bv(0xff, triton::bitsize::byte),
-                          this->astCtxt->bv(0x00, triton::bitsize::byte))
-                       );
-        }
-
-        auto node = this->astCtxt->concat(pck);
+        auto node = this->astCtxt->bvlaneeq(op1, op2, triton::bitsize::byte);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PCMPEQB operation");
@@ -10502,22 +11020,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> pck;
-        pck.reserve(dst.getSize() / triton::size::dword);
-
-        for (triton::uint32 index = 0; index < dst.getSize() / triton::size::dword; index++) {
-          uint32 high = (dst.getBitSize() - 1) - (index * triton::bitsize::dword);
-          uint32 low  = (dst.getBitSize() - triton::bitsize::dword) - (index * triton::bitsize::dword);
-          pck.push_back(this->astCtxt->ite(
-                          this->astCtxt->equal(
-                            this->astCtxt->extract(high, low, op1),
-                            this->astCtxt->extract(high, low, op2)),
-                          this->astCtxt->bv(0xffffffff, triton::bitsize::dword),
-                          this->astCtxt->bv(0x00000000, triton::bitsize::dword))
-                       );
-        }
-
-        auto node = this->astCtxt->concat(pck);
+        auto node = this->astCtxt->bvlaneeq(op1, op2, triton::bitsize::dword);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PCMPEQD operation");
@@ -10539,22 +11042,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> pck;
-        pck.reserve(dst.getSize() / triton::size::word);
-
-        for (triton::uint32 index = 0; index < dst.getSize() / triton::size::word; index++) {
-          uint32 high = (dst.getBitSize() - 1) - (index * triton::bitsize::word);
-          uint32 low  = (dst.getBitSize() - triton::bitsize::word) - (index * triton::bitsize::word);
-          pck.push_back(this->astCtxt->ite(
-                          this->astCtxt->equal(
-                            this->astCtxt->extract(high, low, op1),
-                            this->astCtxt->extract(high, low, op2)),
-                          this->astCtxt->bv(0xffff, triton::bitsize::word),
-                          this->astCtxt->bv(0x0000, triton::bitsize::word))
-                       );
-        }
-
-        auto node = this->astCtxt->concat(pck);
+        auto node = this->astCtxt->bvlaneeq(op1, op2, triton::bitsize::word);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PCMPEQW operation");
@@ -10576,22 +11064,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> pck;
-        pck.reserve(dst.getSize());
-
-        for (triton::uint32 index = 0; index < dst.getSize(); index++) {
-          uint32 high = (dst.getBitSize() - 1) - (index * triton::bitsize::byte);
-          uint32 low  = (dst.getBitSize() - triton::bitsize::byte) - (index * triton::bitsize::byte);
-          pck.push_back(this->astCtxt->ite(
-                          this->astCtxt->bvsgt(
-                            this->astCtxt->extract(high, low, op1),
-                            this->astCtxt->extract(high, low, op2)),
-                          this->astCtxt->bv(0xff, triton::bitsize::byte),
-                          this->astCtxt->bv(0x00, triton::bitsize::byte))
-                       );
-        }
-
-        auto node = this->astCtxt->concat(pck);
+        auto node = this->astCtxt->bvlanesgt(op1, op2, triton::bitsize::byte);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PCMPGTB operation");
@@ -10613,22 +11086,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> pck;
-        pck.reserve(dst.getSize());
-
-        for (triton::uint32 index = 0; index < dst.getSize() / triton::size::dword; index++) {
-          uint32 high = (dst.getBitSize() - 1) - (index * triton::bitsize::dword);
-          uint32 low  = (dst.getBitSize() - triton::bitsize::dword) - (index * triton::bitsize::dword);
-          pck.push_back(this->astCtxt->ite(
-                          this->astCtxt->bvsgt(
-                            this->astCtxt->extract(high, low, op1),
-                            this->astCtxt->extract(high, low, op2)),
-                          this->astCtxt->bv(0xffffffff, triton::bitsize::dword),
-                          this->astCtxt->bv(0x00000000, triton::bitsize::dword))
-                       );
-        }
-
-        auto node = this->astCtxt->concat(pck);
+        auto node = this->astCtxt->bvlanesgt(op1, op2, triton::bitsize::dword);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PCMPGTD operation");
@@ -10650,22 +11108,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> pck;
-        pck.reserve(dst.getSize());
-
-        for (triton::uint32 index = 0; index < dst.getSize() / triton::size::word; index++) {
-          uint32 high = (dst.getBitSize() - 1) - (index * triton::bitsize::word);
-          uint32 low  = (dst.getBitSize() - triton::bitsize::word) - (index * triton::bitsize::word);
-          pck.push_back(this->astCtxt->ite(
-                          this->astCtxt->bvsgt(
-                            this->astCtxt->extract(high, low, op1),
-                            this->astCtxt->extract(high, low, op2)),
-                          this->astCtxt->bv(0xffff, triton::bitsize::word),
-                          this->astCtxt->bv(0x0000, triton::bitsize::word))
-                       );
-        }
-
-        auto node = this->astCtxt->concat(pck);
+        auto node = this->astCtxt->bvlanesgt(op1, op2, triton::bitsize::word);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PCMPGTW operation");
@@ -10687,22 +11130,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> pck;
-        pck.reserve(dst.getSize());
-
-        for (triton::uint32 index = 0; index < dst.getSize(); index++) {
-          uint32 high = (dst.getBitSize() - 1) - (index * triton::bitsize::byte);
-          uint32 low  = (dst.getBitSize() - triton::bitsize::byte) - (index * triton::bitsize::byte);
-          pck.push_back(this->astCtxt->ite(
-                          this->astCtxt->bvsle(
-                            this->astCtxt->extract(high, low, op1),
-                            this->astCtxt->extract(high, low, op2)),
-                          this->astCtxt->extract(high, low, op2),
-                          this->astCtxt->extract(high, low, op1))
-                       );
-        }
-
-        auto node = this->astCtxt->concat(pck);
+        auto node = this->astCtxt->bvlaneselect(this->astCtxt->bvlanesgt(op1, op2, triton::bitsize::byte), op1, op2, triton::bitsize::byte);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PMAXSB operation");
@@ -11115,22 +11543,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> pck;
-        pck.reserve(dst.getSize());
-
-        for (triton::uint32 index = 0; index < dst.getSize() / triton::size::dword; index++) {
-          uint32 high = (dst.getBitSize() - 1) - (index * triton::bitsize::dword);
-          uint32 low  = (dst.getBitSize() - triton::bitsize::dword) - (index * triton::bitsize::dword);
-          pck.push_back(this->astCtxt->ite(
-                          this->astCtxt->bvsle(
-                            this->astCtxt->extract(high, low, op1),
-                            this->astCtxt->extract(high, low, op2)),
-                          this->astCtxt->extract(high, low, op2),
-                          this->astCtxt->extract(high, low, op1))
-                       );
-        }
-
-        auto node = this->astCtxt->concat(pck);
+        auto node = this->astCtxt->bvlaneselect(this->astCtxt->bvlanesgt(op1, op2, triton::bitsize::dword), op1, op2, triton::bitsize::dword);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PMAXSD operation");
@@ -11152,22 +11565,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> pck;
-        pck.reserve(dst.getSize());
-
-        for (triton::uint32 index = 0; index < dst.getSize() / triton::size::word; index++) {
-          uint32 high = (dst.getBitSize() - 1) - (index * triton::bitsize::word);
-          uint32 low  = (dst.getBitSize() - triton::bitsize::word) - (index * triton::bitsize::word);
-          pck.push_back(this->astCtxt->ite(
-                          this->astCtxt->bvsle(
-                            this->astCtxt->extract(high, low, op1),
-                            this->astCtxt->extract(high, low, op2)),
-                          this->astCtxt->extract(high, low, op2),
-                          this->astCtxt->extract(high, low, op1))
-                       );
-        }
-
-        auto node = this->astCtxt->concat(pck);
+        auto node = this->astCtxt->bvlaneselect(this->astCtxt->bvlanesgt(op1, op2, triton::bitsize::word), op1, op2, triton::bitsize::word);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PMAXSW operation");
@@ -11300,22 +11698,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> pck;
-        pck.reserve(dst.getSize());
-
-        for (triton::uint32 index = 0; index < dst.getSize(); index++) {
-          uint32 high = (dst.getBitSize() - 1) - (index * triton::bitsize::byte);
-          uint32 low  = (dst.getBitSize() - triton::bitsize::byte) - (index * triton::bitsize::byte);
-          pck.push_back(this->astCtxt->ite(
-                          this->astCtxt->bvsge(
-                            this->astCtxt->extract(high, low, op1),
-                            this->astCtxt->extract(high, low, op2)),
-                          this->astCtxt->extract(high, low, op2),
-                          this->astCtxt->extract(high, low, op1))
-                       );
-        }
-
-        auto node = this->astCtxt->concat(pck);
+        auto node = this->astCtxt->bvlaneselect(this->astCtxt->bvlanesgt(op1, op2, triton::bitsize::byte), op2, op1, triton::bitsize::byte);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PMINSB operation");
@@ -11337,22 +11720,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> pck;
-        pck.reserve(dst.getSize());
-
-        for (triton::uint32 index = 0; index < dst.getSize() / triton::size::dword; index++) {
-          uint32 high = (dst.getBitSize() - 1) - (index * triton::bitsize::dword);
-          uint32 low  = (dst.getBitSize() - triton::bitsize::dword) - (index * triton::bitsize::dword);
-          pck.push_back(this->astCtxt->ite(
-                          this->astCtxt->bvsge(
-                            this->astCtxt->extract(high, low, op1),
-                            this->astCtxt->extract(high, low, op2)),
-                          this->astCtxt->extract(high, low, op2),
-                          this->astCtxt->extract(high, low, op1))
-                       );
-        }
-
-        auto node = this->astCtxt->concat(pck);
+        auto node = this->astCtxt->bvlaneselect(this->astCtxt->bvlanesgt(op1, op2, triton::bitsize::dword), op2, op1, triton::bitsize::dword);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PMINSD operation");
@@ -11361,35 +11729,20 @@ namespace triton {
         expr->isTainted = this->taintEngine->taintUnion(dst, src);
 
         /* Update the symbolic control flow */
-        this->controlFlow_s(inst);
-      }
-
-
-      void x86Semantics::pminsw_s(triton::arch::Instruction& inst) {
-        auto& dst = inst.operands[0];
-        auto& src = inst.operands[1];
-
-        /* Create symbolic operands */
-        auto op1 = this->symbolicEngine->getOperandAst(inst, dst);
-        auto op2 = this->symbolicEngine->getOperandAst(inst, src);
-
-        /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> pck;
-        pck.reserve(dst.getSize());
-
-        for (triton::uint32 index = 0; index < dst.getSize() / triton::size::word; index++) {
-          uint32 high = (dst.getBitSize() - 1) - (index * triton::bitsize::word);
-          uint32 low  = (dst.getBitSize() - triton::bitsize::word) - (index * triton::bitsize::word);
-          pck.push_back(this->astCtxt->ite(
-                          this->astCtxt->bvsge(
-                            this->astCtxt->extract(high, low, op1),
-                            this->astCtxt->extract(high, low, op2)),
-                          this->astCtxt->extract(high, low, op2),
-                          this->astCtxt->extract(high, low, op1))
-                       );
-        }
+        this->controlFlow_s(inst);
+      }
 
-        auto node = this->astCtxt->concat(pck);
+
+      void x86Semantics::pminsw_s(triton::arch::Instruction& inst) {
+        auto& dst = inst.operands[0];
+        auto& src = inst.operands[1];
+
+        /* Create symbolic operands */
+        auto op1 = this->symbolicEngine->getOperandAst(inst, dst);
+        auto op2 = this->symbolicEngine->getOperandAst(inst, src);
+
+        /* Create the semantics */
+        auto node = this->astCtxt->bvlaneselect(this->astCtxt->bvlanesgt(op1, op2, triton::bitsize::word), op2, op1, triton::bitsize::word);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PMINSW operation");
@@ -12041,13 +12394,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src);
 
         /* Create the semantics */
-        auto node = this->astCtxt->bv(0, dst.getBitSize());
-        for (triton::uint32 i = 0; i < src.getBitSize(); ++i) {
-          node = this->astCtxt->bvadd(
-                   node,
-                   this->astCtxt->zx(dst.getBitSize() - 1, this->astCtxt->extract(i, i, op2))
-                 );
-        }
+        auto node = this->astCtxt->bvpopcount(op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "POPCNT operation");
@@ -12063,7 +12410,7 @@ namespace triton {
       void x86Semantics::pop_s(triton::arch::Instruction& inst) {
         bool  stackRelative = false;
         auto  stack         = this->architecture->getStackPointer();
-        auto  stackValue    = this->architecture->getConcreteRegisterValue(stack).convert_to<triton::uint64>();
+        auto  stackValue    = this->architecture->getConcreteRegisterValue64(stack);
         auto& dst           = inst.operands[0];
         auto  src           = triton::arch::OperandWrapper(triton::arch::MemoryAccess(stackValue, dst.getSize()));
 
@@ -12120,7 +12467,7 @@ namespace triton {
 
       void x86Semantics::popal_s(triton::arch::Instruction& inst) {
         auto stack      = this->architecture->getStackPointer();
-        auto stackValue = this->architecture->getConcreteRegisterValue(stack).convert_to<triton::uint64>();
+        auto stackValue = this->architecture->getConcreteRegisterValue64(stack);
         auto dst1       = triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_X86_EDI));
         auto dst2       = triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_X86_ESI));
         auto dst3       = triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_X86_EBP));
@@ -12174,7 +12521,7 @@ namespace triton {
 
       void x86Semantics::popf_s(triton::arch::Instruction& inst) {
         auto  stack      = this->architecture->getStackPointer();
-        auto  stackValue = this->architecture->getConcreteRegisterValue(stack).convert_to<triton::uint64>();
+        auto  stackValue = this->architecture->getConcreteRegisterValue64(stack);
         auto  dst1       = triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_X86_CF));
         auto  dst2       = triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_X86_PF));
         auto  dst3       = triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_X86_AF));
@@ -12237,7 +12584,7 @@ namespace triton {
 
       void x86Semantics::popfd_s(triton::arch::Instruction& inst) {
         auto  stack      = this->architecture->getStackPointer();
-        auto  stackValue = this->architecture->getConcreteRegisterValue(stack).convert_to<triton::uint64>();
+        auto  stackValue = this->architecture->getConcreteRegisterValue64(stack);
         auto  dst1       = triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_X86_CF));
         auto  dst2       = triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_X86_PF));
         auto  dst3       = triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_X86_AF));
@@ -12315,7 +12662,7 @@ namespace triton {
 
       void x86Semantics::popfq_s(triton::arch::Instruction& inst) {
         auto  stack      = this->architecture->getStackPointer();
-        auto  stackValue = this->architecture->getConcreteRegisterValue(stack).convert_to<triton::uint64>();
+        auto  stackValue = this->architecture->getConcreteRegisterValue64(stack);
         auto  dst1       = triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_X86_CF));
         auto  dst2       = triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_X86_PF));
         auto  dst3       = triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_X86_AF));
@@ -13020,40 +13367,10 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> packed;
-        packed.reserve(16);
+        if (dst.getBitSize() != triton::bitsize::dqword && dst.getBitSize() != triton::bitsize::qword)
+          throw triton::exceptions::Semantics("x86Semantics::psubb_s(): Invalid operand size.");
 
-        switch (dst.getBitSize()) {
-
-          /* XMM */
-          case triton::bitsize::dqword:
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(127, 120, op1), this->astCtxt->extract(127, 120, op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(119, 112, op1), this->astCtxt->extract(119, 112, op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(111, 104, op1), this->astCtxt->extract(111, 104, op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(103, 96,  op1), this->astCtxt->extract(103, 96,  op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(95,  88,  op1), this->astCtxt->extract(95,  88,  op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(87,  80,  op1), this->astCtxt->extract(87,  80,  op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(79,  72,  op1), this->astCtxt->extract(79,  72,  op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(71,  64,  op1), this->astCtxt->extract(71,  64,  op2)));
-
-          /* MMX */
-          case triton::bitsize::qword:
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(63,  56,  op1), this->astCtxt->extract(63,  56,  op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(55,  48,  op1), this->astCtxt->extract(55,  48,  op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(47,  40,  op1), this->astCtxt->extract(47,  40,  op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(39,  32,  op1), this->astCtxt->extract(39,  32,  op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(31,  24,  op1), this->astCtxt->extract(31,  24,  op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(23,  16,  op1), this->astCtxt->extract(23,  16,  op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(15,  8,   op1), this->astCtxt->extract(15,  8,   op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(7,   0,   op1), this->astCtxt->extract(7,   0,   op2)));
-            break;
-
-          default:
-            throw triton::exceptions::Semantics("x86Semantics::psubb_s(): Invalid operand size.");
-
-        }
-
-        auto node = this->astCtxt->concat(packed);
+        auto node = this->astCtxt->bvlanesub(op1, op2, triton::bitsize::byte);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PSUBB operation");
@@ -13080,28 +13397,10 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> packed;
-        packed.reserve(4);
+        if (dst.getBitSize() != triton::bitsize::dqword && dst.getBitSize() != triton::bitsize::qword)
+          throw triton::exceptions::Semantics("x86Semantics::psubd_s(): Invalid operand size.");
 
-        switch (dst.getBitSize()) {
-
-          /* XMM */
-          case triton::bitsize::dqword:
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(127, 96, op1), this->astCtxt->extract(127, 96, op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(95,  64, op1), this->astCtxt->extract(95,  64, op2)));
-
-          /* MMX */
-          case triton::bitsize::qword:
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(63,  32, op1), this->astCtxt->extract(63,  32, op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(31,  0,  op1), this->astCtxt->extract(31,  0,  op2)));
-            break;
-
-          default:
-            throw triton::exceptions::Semantics("x86Semantics::psubd_s(): Invalid operand size.");
-
-        }
-
-        auto node = this->astCtxt->concat(packed);
+        auto node = this->astCtxt->bvlanesub(op1, op2, triton::bitsize::dword);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PSUBD operation");
@@ -13128,26 +13427,10 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> packed;
-        packed.reserve(2);
+        if (dst.getBitSize() != triton::bitsize::dqword && dst.getBitSize() != triton::bitsize::qword)
+          throw triton::exceptions::Semantics("x86Semantics::psubq_s(): Invalid operand size.");
 
-        switch (dst.getBitSize()) {
-
-          /* XMM */
-          case triton::bitsize::dqword:
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(127, 64, op1), this->astCtxt->extract(127, 64, op2)));
-
-          /* MMX */
-          case triton::bitsize::qword:
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(63,  0,  op1), this->astCtxt->extract(63,  0,  op2)));
-            break;
-
-          default:
-            throw triton::exceptions::Semantics("x86Semantics::psubq_s(): Invalid operand size.");
-
-        }
-
-        auto node = this->astCtxt->concat(packed);
+        auto node = this->astCtxt->bvlanesub(op1, op2, triton::bitsize::qword);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PSUBQ operation");
@@ -13174,32 +13457,10 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> packed;
-        packed.reserve(8);
+        if (dst.getBitSize() != triton::bitsize::dqword && dst.getBitSize() != triton::bitsize::qword)
+          throw triton::exceptions::Semantics("x86Semantics::psubw_s(): Invalid operand size.");
 
-        switch (dst.getBitSize()) {
-
-          /* XMM */
-          case triton::bitsize::dqword:
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(127, 112, op1), this->astCtxt->extract(127, 112, op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(111, 96,  op1), this->astCtxt->extract(111, 96,  op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(95,  80,  op1), this->astCtxt->extract(95,  80,  op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(79,  64,  op1), this->astCtxt->extract(79,  64,  op2)));
-
-          /* MMX */
-          case triton::bitsize::qword:
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(63,  48,  op1), this->astCtxt->extract(63,  48,  op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(47,  32,  op1), this->astCtxt->extract(47,  32,  op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(31,  16,  op1), this->astCtxt->extract(31,  16,  op2)));
-            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(15,  0,   op1), this->astCtxt->extract(15,  0,   op2)));
-            break;
-
-          default:
-            throw triton::exceptions::Semantics("x86Semantics::psubw_s(): Invalid operand size.");
-
-        }
-
-        auto node = this->astCtxt->concat(packed);
+        auto node = this->astCtxt->bvlanesub(op1, op2, triton::bitsize::word);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PSUBW operation");
@@ -13704,7 +13965,7 @@ namespace triton {
 
       void x86Semantics::pushal_s(triton::arch::Instruction& inst) {
         auto stack      = this->architecture->getStackPointer();
-        auto stackValue = this->architecture->getConcreteRegisterValue(stack).convert_to<triton::uint64>();
+        auto stackValue = this->architecture->getConcreteRegisterValue64(stack);
         auto dst1       = triton::arch::OperandWrapper(triton::arch::MemoryAccess(stackValue-(stack.getSize() * 1), stack.getSize()));
         auto dst2       = triton::arch::OperandWrapper(triton::arch::MemoryAccess(stackValue-(stack.getSize() * 2), stack.getSize()));
         auto dst3       = triton::arch::OperandWrapper(triton::arch::MemoryAccess(stackValue-(stack.getSize() * 3), stack.getSize()));
@@ -14162,7 +14423,7 @@ namespace triton {
 
       void x86Semantics::ret_s(triton::arch::Instruction& inst) {
         auto stack      = this->architecture->getStackPointer();
-        auto stackValue = this->architecture->getConcreteRegisterValue(stack).convert_to<triton::uint64>();
+        auto stackValue = this->architecture->getConcreteRegisterValue64(stack);
         auto pc         = triton::arch::OperandWrapper(this->architecture->getProgramCounter());
         auto sp         = triton::arch::OperandWrapper(triton::arch::MemoryAccess(stackValue, stack.getSize()));
 
@@ -14249,7 +14510,7 @@ namespace triton {
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "ROL operation");
 
         /* Spread taint */
-        expr->isTainted = this->taintEngine->taintUnion(dst, src);
+        expr->isTainted = this->taintEngine->taintShift(triton::ast::BVROL_NODE, dst, src, op2->evaluate().convert_to<triton::uint32>());
 
         /* Update symbolic flags */
         this->cfRol_s(inst, expr, dst, op2bis);
@@ -14321,7 +14582,7 @@ namespace triton {
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "ROR operation");
 
         /* Spread taint */
-        expr->isTainted = this->taintEngine->taintUnion(dst, src);
+        expr->isTainted = this->taintEngine->taintShift(triton::ast::BVROR_NODE, dst, src, op2->evaluate().convert_to<triton::uint32>());
 
         /* Update symbolic flags */
         this->cfRor_s(inst, expr, dst, op2);
@@ -14436,7 +14697,7 @@ namespace triton {
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "SAR operation");
 
         /* Spread taint */
-        expr->isTainted = this->taintEngine->taintUnion(dst, src);
+        expr->isTainted = this->taintEngine->taintShift(triton::ast::BVASHR_NODE, dst, src, op2->evaluate().convert_to<triton::uint32>());
 
         /* Update symbolic flags */
         this->cfSar_s(inst, expr, dst, op1, op2);
@@ -14548,6 +14809,9 @@ namespace triton {
           return;
         }
 
+        /* Skip the iterations which do not stop the repetition */
+        this->repCompare_s(inst, dst, src);
+
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->getOperandAst(inst, dst);
         auto op2 = this->symbolicEngine->getOperandAst(inst, src);
@@ -14600,6 +14864,9 @@ namespace triton {
           return;
         }
 
+        /* Skip the iterations which do not stop the repetition */
+        this->repCompare_s(inst, dst, src);
+
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->getOperandAst(inst, dst);
         auto op2 = this->symbolicEngine->getOperandAst(inst, src);
@@ -14652,6 +14919,9 @@ namespace triton {
           return;
         }
 
+        /* Skip the iterations which do not stop the repetition */
+        this->repCompare_s(inst, dst, src);
+
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->getOperandAst(inst, dst);
         auto op2 = this->symbolicEngine->getOperandAst(inst, src);
@@ -14704,6 +14974,9 @@ namespace triton {
           return;
         }
 
+        /* Skip the iterations which do not stop the repetition */
+        this->repCompare_s(inst, dst, src);
+
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->getOperandAst(inst, dst);
         auto op2 = this->symbolicEngine->getOperandAst(inst, src);
@@ -14749,7 +15022,7 @@ namespace triton {
         auto op3 = this->symbolicEngine->getOperandAst(inst, zf);
 
         /* Create the semantics */
-        auto node = this->astCtxt->ite(
+        auto node = this->astCtxt->iteFold(
                       this->astCtxt->equal(
                         this->astCtxt->bvand(
                           this->astCtxt->bvnot(op2),
@@ -14786,7 +15059,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, cf);
 
         /* Create the semantics */
-        auto node = this->astCtxt->ite(
+        auto node = this->astCtxt->iteFold(
                       this->astCtxt->equal(op2, this->astCtxt->bvfalse()),
                       this->astCtxt->bv(1, dst.getBitSize()),
                       this->astCtxt->bv(0, dst.getBitSize())
@@ -14816,7 +15089,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, cf);
 
         /* Create the semantics */
-        auto node = this->astCtxt->ite(
+        auto node = this->astCtxt->iteFold(
                       this->astCtxt->equal(op2, this->astCtxt->bvtrue()),
                       this->astCtxt->bv(1, dst.getBitSize()),
                       this->astCtxt->bv(0, dst.getBitSize())
@@ -14848,7 +15121,7 @@ namespace triton {
         auto op3 = this->symbolicEngine->getOperandAst(inst, zf);
 
         /* Create the semantics */
-        auto node = this->astCtxt->ite(
+        auto node = this->astCtxt->iteFold(
                       this->astCtxt->equal(this->astCtxt->bvor(op2, op3), this->astCtxt->bvtrue()),
                       this->astCtxt->bv(1, dst.getBitSize()),
                       this->astCtxt->bv(0, dst.getBitSize())
@@ -14879,7 +15152,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, zf);
 
         /* Create the semantics */
-        auto node = this->astCtxt->ite(
+        auto node = this->astCtxt->iteFold(
                       this->astCtxt->equal(op2, this->astCtxt->bvtrue()),
                       this->astCtxt->bv(1, dst.getBitSize()),
                       this->astCtxt->bv(0, dst.getBitSize())
@@ -14913,7 +15186,7 @@ namespace triton {
         auto op4 = this->symbolicEngine->getOperandAst(inst, zf);
 
         /* Create the semantics */
-        auto node = this->astCtxt->ite(
+        auto node = this->astCtxt->iteFold(
                       this->astCtxt->equal(this->astCtxt->bvor(this->astCtxt->bvxor(op2, op3), op4), this->astCtxt->bvfalse()),
                       this->astCtxt->bv(1, dst.getBitSize()),
                       this->astCtxt->bv(0, dst.getBitSize())
@@ -14947,7 +15220,7 @@ namespace triton {
         auto op3 = this->symbolicEngine->getOperandAst(inst, of);
 
         /* Create the semantics */
-        auto node = this->astCtxt->ite(
+        auto node = this->astCtxt->iteFold(
                       this->astCtxt->equal(op2, op3),
                       this->astCtxt->bv(1, dst.getBitSize()),
                       this->astCtxt->bv(0, dst.getBitSize())
@@ -14980,7 +15253,7 @@ namespace triton {
         auto op3 = this->symbolicEngine->getOperandAst(inst, of);
 
         /* Create the semantics */
-        auto node = this->astCtxt->ite(
+        auto node = this->astCtxt->iteFold(
                       this->astCtxt->equal(this->astCtxt->bvxor(op2, op3), this->astCtxt->bvtrue()),
                       this->astCtxt->bv(1, dst.getBitSize()),
                       this->astCtxt->bv(0, dst.getBitSize())
@@ -15015,7 +15288,7 @@ namespace triton {
         auto op4 = this->symbolicEngine->getOperandAst(inst, zf);
 
         /* Create the semantics */
-        auto node = this->astCtxt->ite(
+        auto node = this->astCtxt->iteFold(
                       this->astCtxt->equal(this->astCtxt->bvor(this->astCtxt->bvxor(op2, op3), op4), this->astCtxt->bvtrue()),
                       this->astCtxt->bv(1, dst.getBitSize()),
                       this->astCtxt->bv(0, dst.getBitSize())
@@ -15047,7 +15320,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, zf);
 
         /* Create the semantics */
-        auto node = this->astCtxt->ite(
+        auto node = this->astCtxt->iteFold(
                       this->astCtxt->equal(op2, this->astCtxt->bvfalse()),
                       this->astCtxt->bv(1, dst.getBitSize()),
                       this->astCtxt->bv(0, dst.getBitSize())
@@ -15077,7 +15350,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, of);
 
         /* Create the semantics */
-        auto node = this->astCtxt->ite(
+        auto node = this->astCtxt->iteFold(
                       this->astCtxt->equal(op2, this->astCtxt->bvfalse()),
                       this->astCtxt->bv(1, dst.getBitSize()),
                       this->astCtxt->bv(0, dst.getBitSize())
@@ -15107,7 +15380,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, pf);
 
         /* Create the semantics */
-        auto node = this->astCtxt->ite(
+        auto node = this->astCtxt->iteFold(
                       this->astCtxt->equal(op2, this->astCtxt->bvfalse()),
                       this->astCtxt->bv(1, dst.getBitSize()),
                       this->astCtxt->bv(0, dst.getBitSize())
@@ -15137,7 +15410,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, sf);
 
         /* Create the semantics */
-        auto node = this->astCtxt->ite(
+        auto node = this->astCtxt->iteFold(
                       this->astCtxt->equal(op2, this->astCtxt->bvfalse()),
                       this->astCtxt->bv(1, dst.getBitSize()),
                       this->astCtxt->bv(0, dst.getBitSize())
@@ -15167,7 +15440,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, of);
 
         /* Create the semantics */
-        auto node = this->astCtxt->ite(
+        auto node = this->astCtxt->iteFold(
                       this->astCtxt->equal(op2, this->astCtxt->bvtrue()),
                       this->astCtxt->bv(1, dst.getBitSize()),
                       this->astCtxt->bv(0, dst.getBitSize())
@@ -15197,7 +15470,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, pf);
 
         /* Create the semantics */
-        auto node = this->astCtxt->ite(
+        auto node = this->astCtxt->iteFold(
                       this->astCtxt->equal(op2, this->astCtxt->bvtrue()),
                       this->astCtxt->bv(1, dst.getBitSize()),
                       this->astCtxt->bv(0, dst.getBitSize())
@@ -15227,7 +15500,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, sf);
 
         /* Create the semantics */
-        auto node = this->astCtxt->ite(
+        auto node = this->astCtxt->iteFold(
                       this->astCtxt->equal(op2, this->astCtxt->bvtrue()),
                       this->astCtxt->bv(1, dst.getBitSize()),
                       this->astCtxt->bv(0, dst.getBitSize())
@@ -15276,7 +15549,7 @@ namespace triton {
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "SHL operation");
 
         /* Spread taint */
-        expr->isTainted = this->taintEngine->taintUnion(dst, src);
+        expr->isTainted = this->taintEngine->taintShift(triton::ast::BVSHL_NODE, dst, src, op2->evaluate().convert_to<triton::uint32>());
 
         /* Update symbolic flags */
         this->cfShl_s(inst, expr, dst, op1, op2);
@@ -15448,7 +15721,7 @@ namespace triton {
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "SHR operation");
 
         /* Spread taint */
-        expr->isTainted = this->taintEngine->taintUnion(dst, src);
+        expr->isTainted = this->taintEngine->taintShift(triton::ast::BVLSHR_NODE, dst, src, op2->evaluate().convert_to<triton::uint32>());
 
         /* Update symbolic flags */
         this->cfShr_s(inst, expr, dst, op1, op2);
@@ -15654,6 +15927,10 @@ namespace triton {
           return;
         }
 
+        /* Execute all the iterations at once */
+        if (this->repString_s(inst, dst, src, "STOSB operation"))
+          return;
+
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->getOperandAst(inst, src);
         auto op2 = this->symbolicEngine->getOperandAst(inst, index);
@@ -15693,6 +15970,10 @@ namespace triton {
           return;
         }
 
+        /* Execute all the iterations at once */
+        if (this->repString_s(inst, dst, src, "STOSD operation"))
+          return;
+
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->getOperandAst(inst, src);
         auto op2 = this->symbolicEngine->getOperandAst(inst, index);
@@ -15732,6 +16013,10 @@ namespace triton {
           return;
         }
 
+        /* Execute all the iterations at once */
+        if (this->repString_s(inst, dst, src, "STOSQ operation"))
+          return;
+
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->getOperandAst(inst, src);
         auto op2 = this->symbolicEngine->getOperandAst(inst, index);
@@ -15771,6 +16056,10 @@ namespace triton {
           return;
         }
 
+        /* Execute all the iterations at once */
+        if (this->repString_s(inst, dst, src, "STOSW operation"))
+          return;
+
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->getOperandAst(inst, src);
         auto op2 = this->symbolicEngine->getOperandAst(inst, index);
@@ -16564,15 +16853,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src2);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> pck;
-        pck.reserve(dst.getSize() / triton::size::byte);
-
-        for (triton::uint32 i = 0; i < dst.getSize() / triton::size::byte; ++i) {
-          uint32 high = (dst.getBitSize() - 1) - (i * triton::bitsize::byte);
-          uint32 low = (dst.getBitSize() - triton::bitsize::byte) - (i * triton::bitsize::byte);
-          pck.push_back(this->astCtxt->bvadd(this->astCtxt->extract(high, low, op1), this->astCtxt->extract(high, low, op2)));
-        }
-        auto node = this->astCtxt->concat(pck);
+        auto node = this->astCtxt->bvlaneadd(op1, op2, triton::bitsize::byte);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "VPADDB operation");
@@ -16595,15 +16876,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src2);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> pck;
-        pck.reserve(dst.getSize() / triton::size::dword);
-
-        for (triton::uint32 i = 0; i < dst.getSize() / triton::size::dword; ++i) {
-          uint32 high = (dst.getBitSize() - 1) - (i * triton::bitsize::dword);
-          uint32 low = (dst.getBitSize() - triton::bitsize::dword) - (i * triton::bitsize::dword);
-          pck.push_back(this->astCtxt->bvadd(this->astCtxt->extract(high, low, op1), this->astCtxt->extract(high, low, op2)));
-        }
-        auto node = this->astCtxt->concat(pck);
+        auto node = this->astCtxt->bvlaneadd(op1, op2, triton::bitsize::dword);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "VPADDD operation");
@@ -16626,15 +16899,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src2);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> pck;
-        pck.reserve(dst.getSize() / triton::size::word);
-
-        for (triton::uint32 i = 0; i < dst.getSize() / triton::size::word; ++i) {
-          uint32 high = (dst.getBitSize() - 1) - (i * triton::bitsize::word);
-          uint32 low = (dst.getBitSize() - triton::bitsize::word) - (i * triton::bitsize::word);
-          pck.push_back(this->astCtxt->bvadd(this->astCtxt->extract(high, low, op1), this->astCtxt->extract(high, low, op2)));
-        }
-        auto node = this->astCtxt->concat(pck);
+        auto node = this->astCtxt->bvlaneadd(op1, op2, triton::bitsize::word);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "VPADDW operation");
@@ -16951,22 +17216,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src2);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> pck;
-        pck.reserve(dst.getSize());
-
-        for (triton::uint32 index = 0; index < src1.getSize(); index++) {
-          uint32 high = (src1.getBitSize() - 1) - (index * triton::bitsize::byte);
-          uint32 low  = (src1.getBitSize() - triton::bitsize::byte) - (index * triton::bitsize::byte);
-          pck.push_back(this->astCtxt->ite(
-                          this->astCtxt->equal(
-                            this->astCtxt->extract(high, low, op1),
-                            this->astCtxt->extract(high, low, op2)),
-                          this->astCtxt->bv(0xff, triton::bitsize::byte),
-                          this->astCtxt->bv(0x00, triton::bitsize::byte))
-                       );
-        }
-
-        auto node = this->astCtxt->concat(pck);
+        auto node = this->astCtxt->bvlaneeq(op1, op2, triton::bitsize::byte);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "VPCMPEQB operation");
@@ -16989,22 +17239,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src2);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> pck;
-        pck.reserve(dst.getSize() / triton::size::dword);
-
-        for (triton::uint32 index = 0; index < dst.getSize() / triton::size::dword; index++) {
-          uint32 high = (dst.getBitSize() - 1) - (index * triton::bitsize::dword);
-          uint32 low  = (dst.getBitSize() - triton::bitsize::dword) - (index * triton::bitsize::dword);
-          pck.push_back(this->astCtxt->ite(
-                          this->astCtxt->equal(
-                            this->astCtxt->extract(high, low, op1),
-                            this->astCtxt->extract(high, low, op2)),
-                          this->astCtxt->bv(0xffffffff, triton::bitsize::dword),
-                          this->astCtxt->bv(0x00000000, triton::bitsize::dword))
-                       );
-        }
-
-        auto node = this->astCtxt->concat(pck);
+        auto node = this->astCtxt->bvlaneeq(op1, op2, triton::bitsize::dword);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "VPCMPEQD operation");
@@ -17027,22 +17262,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src2);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> pck;
-        pck.reserve(dst.getSize() / triton::size::qword);
-
-        for (triton::uint32 index = 0; index < dst.getSize() / triton::size::qword; index++) {
-          uint32 high = (dst.getBitSize() - 1) - (index * triton::bitsize::qword);
-          uint32 low  = (dst.getBitSize() - triton::bitsize::qword) - (index * triton::bitsize::qword);
-          pck.push_back(this->astCtxt->ite(
-                          this->astCtxt->equal(
-                            this->astCtxt->extract(high, low, op1),
-                            this->astCtxt->extract(high, low, op2)),
-                          this->astCtxt->bv(0xffffffffffffffff, triton::bitsize::qword),
-                          this->astCtxt->bv(0x0000000000000000, triton::bitsize::qword))
-                       );
-        }
-
-        auto node = this->astCtxt->concat(pck);
+        auto node = this->astCtxt->bvlaneeq(op1, op2, triton::bitsize::qword);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "VPCMPEQQ operation");
@@ -17065,22 +17285,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src2);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> pck;
-        pck.reserve(dst.getSize() / triton::size::word);
-
-        for (triton::uint32 index = 0; index < dst.getSize() / triton::size::word; index++) {
-          uint32 high = (dst.getBitSize() - 1) - (index * triton::bitsize::word);
-          uint32 low  = (dst.getBitSize() - triton::bitsize::word) - (index * triton::bitsize::word);
-          pck.push_back(this->astCtxt->ite(
-                          this->astCtxt->equal(
-                            this->astCtxt->extract(high, low, op1),
-                            this->astCtxt->extract(high, low, op2)),
-                          this->astCtxt->bv(0xffff, triton::bitsize::word),
-                          this->astCtxt->bv(0x0000, triton::bitsize::word))
-                       );
-        }
-
-        auto node = this->astCtxt->concat(pck);
+        auto node = this->astCtxt->bvlaneeq(op1, op2, triton::bitsize::word);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "VPCMPEQW operation");
@@ -17103,22 +17308,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src2);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> pck;
-        pck.reserve(dst.getSize());
-
-        for (triton::uint32 index = 0; index < dst.getSize(); index++) {
-          uint32 high = (dst.getBitSize() - 1) - (index * triton::bitsize::byte);
-          uint32 low  = (dst.getBitSize() - triton::bitsize::byte) - (index * triton::bitsize::byte);
-          pck.push_back(this->astCtxt->ite(
-                          this->astCtxt->bvsgt(
-                            this->astCtxt->extract(high, low, op1),
-                            this->astCtxt->extract(high, low, op2)),
-                          this->astCtxt->bv(0xff, triton::bitsize::byte),
-                          this->astCtxt->bv(0x00, triton::bitsize::byte))
-                       );
-        }
-
-        auto node = this->astCtxt->concat(pck);
+        auto node = this->astCtxt->bvlanesgt(op1, op2, triton::bitsize::byte);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "VPCMPGTB operation");
@@ -17141,22 +17331,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src2);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> pck;
-        pck.reserve(dst.getSize() / triton::size::dword);
-
-        for (triton::uint32 index = 0; index < dst.getSize() / triton::size::dword; index++) {
-          uint32 high = (dst.getBitSize() - 1) - (index * triton::bitsize::dword);
-          uint32 low  = (dst.getBitSize() - triton::bitsize::dword) - (index * triton::bitsize::dword);
-          pck.push_back(this->astCtxt->ite(
-                          this->astCtxt->bvsgt(
-                            this->astCtxt->extract(high, low, op1),
-                            this->astCtxt->extract(high, low, op2)),
-                          this->astCtxt->bv(0xffffffff, triton::bitsize::dword),
-                          this->astCtxt->bv(0x00000000, triton::bitsize::dword))
-                       );
-        }
-
-        auto node = this->astCtxt->concat(pck);
+        auto node = this->astCtxt->bvlanesgt(op1, op2, triton::bitsize::dword);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "VPCMPGTD operation");
@@ -17179,22 +17354,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src2);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> pck;
-        pck.reserve(dst.getSize() / triton::size::word);
-
-        for (triton::uint32 index = 0; index < dst.getSize() / triton::size::word; index++) {
-          uint32 high = (dst.getBitSize() - 1) - (index * triton::bitsize::word);
-          uint32 low  = (dst.getBitSize() - triton::bitsize::word) - (index * triton::bitsize::word);
-          pck.push_back(this->astCtxt->ite(
-                          this->astCtxt->bvsgt(
-                            this->astCtxt->extract(high, low, op1),
-                            this->astCtxt->extract(high, low, op2)),
-                          this->astCtxt->bv(0xffff, triton::bitsize::word),
-                          this->astCtxt->bv(0x0000, triton::bitsize::word))
-                       );
-        }
-
-        auto node = this->astCtxt->concat(pck);
+        auto node = this->astCtxt->bvlanesgt(op1, op2, triton::bitsize::word);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "VPCMPGTW operation");
@@ -17908,19 +18068,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src2);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> pck;
-        pck.reserve(dst.getSize());
-
-        for (triton::uint32 index = 0; index < dst.getSize(); index++) {
-          uint32 high = (dst.getBitSize() - 1) - (index * triton::bitsize::byte);
-          uint32 low  = (dst.getBitSize() - triton::bitsize::byte) - (index * triton::bitsize::byte);
-          pck.push_back(this->astCtxt->bvsub(
-                          this->astCtxt->extract(high, low, op1),
-                          this->astCtxt->extract(high, low, op2))
-                       );
-        }
-
-        auto node = this->astCtxt->concat(pck);
+        auto node = this->astCtxt->bvlanesub(op1, op2, triton::bitsize::byte);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "VPSUBB operation");
@@ -17943,19 +18091,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src2);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> pck;
-        pck.reserve(dst.getSize() / triton::size::dword);
-
-        for (triton::uint32 index = 0; index < dst.getSize() / triton::size::dword; index++) {
-          uint32 high = (dst.getBitSize() - 1) - (index * triton::bitsize::dword);
-          uint32 low  = (dst.getBitSize() - triton::bitsize::dword) - (index * triton::bitsize::dword);
-          pck.push_back(this->astCtxt->bvsub(
-                         this->astCtxt->extract(high, low, op1),
-                         this->astCtxt->extract(high, low, op2))
-                       );
-        }
-
-        auto node = this->astCtxt->concat(pck);
+        auto node = this->astCtxt->bvlanesub(op1, op2, triton::bitsize::dword);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "VPSUBD operation");
@@ -17978,19 +18114,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src2);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> pck;
-        pck.reserve(dst.getSize() / triton::size::qword);
-
-        for (triton::uint32 index = 0; index < dst.getSize() / triton::size::qword; index++) {
-          uint32 high = (dst.getBitSize() - 1) - (index * triton::bitsize::qword);
-          uint32 low  = (dst.getBitSize() - triton::bitsize::qword) - (index * triton::bitsize::qword);
-          pck.push_back(this->astCtxt->bvsub(
-                         this->astCtxt->extract(high, low, op1),
-                         this->astCtxt->extract(high, low, op2))
-                       );
-        }
-
-        auto node = this->astCtxt->concat(pck);
+        auto node = this->astCtxt->bvlanesub(op1, op2, triton::bitsize::qword);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "VPSUBQ operation");
@@ -18013,19 +18137,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->getOperandAst(inst, src2);
 
         /* Create the semantics */
-        std::vector<triton::ast::SharedAbstractNode> pck;
-        pck.reserve(dst.getSize() / triton::size::word);
-
-        for (triton::uint32 index = 0; index < dst.getSize() / triton::size::word; index++) {
-          uint32 high = (dst.getBitSize() - 1) - (index * triton::bitsize::word);
-          uint32 low  = (dst.getBitSize() - triton::bitsize::word) - (index * triton::bitsize::word);
-          pck.push_back(this->astCtxt->bvsub(
-                         this->astCtxt->extract(high, low, op1),
-                         this->astCtxt->extract(high, low, op2))
-                       );
-        }
-
-        auto node = this->astCtxt->concat(pck);
+        auto node = this->astCtxt->bvlanesub(op1, op2, triton::bitsize::word);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "VPSUBW operation");
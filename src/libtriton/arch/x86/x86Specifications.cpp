@@ -17,10 +17,30 @@ namespace triton {
   namespace arch {
     namespace x86 {
 
-      x86Specifications::x86Specifications(triton::arch::architecture_e arch) {
-        if (arch != triton::arch::ARCH_X86 && arch != triton::arch::ARCH_X86_64)
-            throw triton::exceptions::Architecture("x86Specifications::x86Specifications(): Invalid architecture.");
+      x86Specifications::x86Specifications(triton::arch::architecture_e arch)
+        : id2reg(getRegisterTable(arch).id2reg),
+          name2id(getRegisterTable(arch).name2id),
+          regIndex(getRegisterTable(arch).regIndex) {
+      }
+
+
+      const x86Specifications::RegisterTable& x86Specifications::getRegisterTable(triton::arch::architecture_e arch) {
+        /* The tables are immutable, the contexts of an architecture share them */
+        if (arch == triton::arch::ARCH_X86_64) {
+          static const RegisterTable x8664(arch);
+          return x8664;
+        }
+
+        if (arch == triton::arch::ARCH_X86) {
+          static const RegisterTable x86(arch);
+          return x86;
+        }
+
+        throw triton::exceptions::Architecture("x86Specifications::x86Specifications(): Invalid architecture.");
+      }
 
+
+      x86Specifications::RegisterTable::RegisterTable(triton::arch::architecture_e arch) {
         if (arch == triton::arch::ARCH_X86_64) {
           // Fill id2reg and name2id with those available in X86_64 from spec
           #define REG_SPEC(UPPER_NAME, LOWER_NAME, X86_64_UPPER, X86_64_LOWER, X86_64_PARENT, X86_UPPER, X86_LOWER, X86_PARENT, X86_AVAIL)  \
@@ -55,6 +75,11 @@ namespace triton {
           #define REG_SPEC_NO_CAPSTONE REG_SPEC
           #include "triton/x86.spec"
         }
+
+        /* Index the registers by id, a lookup is done for each register access */
+        this->regIndex.fill(nullptr);
+        for (const auto& kv : this->id2reg)
+          this->regIndex[kv.first] = &kv.second;
       }
 
 
@@ -5287,6 +5312,81 @@ namespace triton {
         return tritonId;
       }
 
+
+
+      triton::uint32 x86Specifications::selectSemanticsHandler(const triton::arch::Instruction& inst) const {
+        const auto& operands = inst.operands;
+
+        /* The kinds of the operands, one of REG_REG, REG_IMM, REG_MEM, MEM_REG or MEM_IMM */
+        auto binary = [&](triton::uint32 memImm, triton::uint32 memReg, triton::uint32 regImm, triton::uint32 regMem, triton::uint32 regReg) -> triton::uint32 {
+          if (operands.size() != 2)
+            return ID_HANDLER_INVALID;
+
+          triton::uint32 t1 = operands[0].getType();
+          triton::uint32 t2 = operands[1].getType();
+
+          if (t1 == triton::arch::OP_MEM && t2 == triton::arch::OP_IMM) return memImm;
+          if (t1 == triton::arch::OP_MEM && t2 == triton::arch::OP_REG) return memReg;
+          if (t1 == triton::arch::OP_REG && t2 == triton::arch::OP_IMM) return regImm;
+          if (t1 == triton::arch::OP_REG && t2 == triton::arch::OP_MEM) return regMem;
+          if (t1 == triton::arch::OP_REG && t2 == triton::arch::OP_REG) return regReg;
+
+          return ID_HANDLER_INVALID;
+        };
+
+        /* The conditional jumps on a single flag */
+        auto jcc = [&](triton::uint32 handler) -> triton::uint32 {
+          if (operands.size() != 1 || operands[0].getType() != triton::arch::OP_IMM)
+            return ID_HANDLER_INVALID;
+          return handler;
+        };
+
+        switch (inst.getType()) {
+          case ID_INS_ADD:  return binary(ID_HANDLER_ADD_MEM_IMM, ID_HANDLER_ADD_MEM_REG, ID_HANDLER_ADD_REG_IMM, ID_HANDLER_ADD_REG_MEM, ID_HANDLER_ADD_REG_REG);
+          case ID_INS_CMP:  return binary(ID_HANDLER_CMP_MEM_IMM, ID_HANDLER_CMP_MEM_REG, ID_HANDLER_CMP_REG_IMM, ID_HANDLER_CMP_REG_MEM, ID_HANDLER_CMP_REG_REG);
+          case ID_INS_SUB:  return binary(ID_HANDLER_SUB_MEM_IMM, ID_HANDLER_SUB_MEM_REG, ID_HANDLER_SUB_REG_IMM, ID_HANDLER_SUB_REG_MEM, ID_HANDLER_SUB_REG_REG);
+          case ID_INS_TEST: return binary(ID_HANDLER_TEST_MEM_IMM, ID_HANDLER_TEST_MEM_REG, ID_HANDLER_TEST_REG_IMM, ID_HANDLER_INVALID, ID_HANDLER_TEST_REG_REG);
+          case ID_INS_LEA:  return binary(ID_HANDLER_INVALID, ID_HANDLER_INVALID, ID_HANDLER_INVALID, ID_HANDLER_LEA_REG_MEM, ID_HANDLER_INVALID);
+
+          case ID_INS_MOV: {
+            /* The segment and control registers have their own semantics (see x86Semantics::mov_s) */
+            for (const auto& op : operands) {
+              if (op.getType() != triton::arch::OP_REG)
+                continue;
+              triton::uint32 id = op.getConstRegister().getId();
+              if (id >= triton::arch::ID_REG_X86_CS && id <= triton::arch::ID_REG_X86_SS)
+                return ID_HANDLER_INVALID;
+              if (id >= triton::arch::ID_REG_X86_CR0 && id <= triton::arch::ID_REG_X86_CR15)
+                return ID_HANDLER_INVALID;
+            }
+            return binary(ID_HANDLER_MOV_MEM_IMM, ID_HANDLER_MOV_MEM_REG, ID_HANDLER_MOV_REG_IMM, ID_HANDLER_MOV_REG_MEM, ID_HANDLER_MOV_REG_REG);
+          }
+
+          case ID_INS_PUSH:
+            if (operands.size() == 1 && operands[0].getType() == triton::arch::OP_REG) return ID_HANDLER_PUSH_REG;
+            if (operands.size() == 1 && operands[0].getType() == triton::arch::OP_IMM) return ID_HANDLER_PUSH_IMM;
+            return ID_HANDLER_INVALID;
+
+          case ID_INS_POP:
+            if (operands.size() == 1 && operands[0].getType() == triton::arch::OP_REG) return ID_HANDLER_POP_REG;
+            return ID_HANDLER_INVALID;
+
+          case ID_INS_JAE: return jcc(ID_HANDLER_JAE);
+          case ID_INS_JB:  return jcc(ID_HANDLER_JB);
+          case ID_INS_JE:  return jcc(ID_HANDLER_JE);
+          case ID_INS_JNE: return jcc(ID_HANDLER_JNE);
+          case ID_INS_JNO: return jcc(ID_HANDLER_JNO);
+          case ID_INS_JNP: return jcc(ID_HANDLER_JNP);
+          case ID_INS_JNS: return jcc(ID_HANDLER_JNS);
+          case ID_INS_JO:  return jcc(ID_HANDLER_JO);
+          case ID_INS_JP:  return jcc(ID_HANDLER_JP);
+          case ID_INS_JS:  return jcc(ID_HANDLER_JS);
+
+          default:
+            return ID_HANDLER_INVALID;
+        }
+      }
+
     }; /* x86 namespace */
   }; /* arch namespace */
 }; /* triton namespace */
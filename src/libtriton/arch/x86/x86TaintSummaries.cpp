@@ -0,0 +1,272 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <triton/cpuSize.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/operandWrapper.hpp>
+#include <triton/register.hpp>
+#include <triton/x86Specifications.hpp>
+#include <triton/x86TaintSummaries.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+    namespace x86 {
+
+      x86TaintSummaries::x86TaintSummaries(triton::arch::Architecture* architecture, triton::engines::taint::TaintEngine* taintEngine) {
+        const triton::uint8 arith   = FLAG_AF | FLAG_CF | FLAG_OF | FLAG_PF | FLAG_SF | FLAG_ZF;
+        const triton::uint8 logical = FLAG_PF | FLAG_SF | FLAG_ZF;
+        const triton::uint8 cleared = FLAG_AF | FLAG_CF | FLAG_OF;
+
+        /* The summaries, as spread by the handlers of x86Semantics */
+        const struct {
+          triton::uint32 id;
+          Summary summary;
+        } table[] = {
+          {ID_INS_ADC,    {KIND_UNION_CF, arith,   0}},
+          {ID_INS_ADD,    {KIND_UNION,    arith,   0}},
+          {ID_INS_AND,    {KIND_UNION,    logical, cleared}},
+          {ID_INS_CMP,    {KIND_COMPARE,  arith,   0}},
+          {ID_INS_DEC,    {KIND_UNARY,    arith & ~FLAG_CF, 0}},
+          {ID_INS_INC,    {KIND_UNARY,    arith & ~FLAG_CF, 0}},
+          {ID_INS_LEA,    {KIND_LEA,      0,       0}},
+          {ID_INS_MOV,    {KIND_ASSIGN,   0,       0}},
+          {ID_INS_MOVABS, {KIND_ASSIGN,   0,       0}},
+          {ID_INS_MOVAPD, {KIND_ASSIGN,   0,       0}},
+          {ID_INS_MOVAPS, {KIND_ASSIGN,   0,       0}},
+          {ID_INS_MOVD,   {KIND_ASSIGN,   0,       0}},
+          {ID_INS_MOVDQA, {KIND_ASSIGN,   0,       0}},
+          {ID_INS_MOVDQU, {KIND_ASSIGN,   0,       0}},
+          {ID_INS_MOVSX,  {KIND_ASSIGN,   0,       0}},
+          {ID_INS_MOVSXD, {KIND_ASSIGN,   0,       0}},
+          {ID_INS_MOVUPD, {KIND_ASSIGN,   0,       0}},
+          {ID_INS_MOVUPS, {KIND_ASSIGN,   0,       0}},
+          {ID_INS_MOVZX,  {KIND_ASSIGN,   0,       0}},
+          {ID_INS_NEG,    {KIND_UNARY,    arith,   0}},
+          {ID_INS_NOT,    {KIND_UNARY,    0,       0}},
+          {ID_INS_OR,     {KIND_UNION,    logical, cleared}},
+          {ID_INS_POP,    {KIND_POP,      0,       0}},
+          {ID_INS_PUSH,   {KIND_PUSH,     0,       0}},
+          {ID_INS_SBB,    {KIND_UNION_CF, arith,   0}},
+          {ID_INS_SUB,    {KIND_UNION,    arith,   0}},
+          {ID_INS_TEST,   {KIND_COMPARE,  logical, cleared}},
+          {ID_INS_XOR,    {KIND_UNION,    logical, cleared}},
+        };
+
+        if (architecture == nullptr)
+          throw triton::exceptions::Semantics("x86TaintSummaries::x86TaintSummaries(): The architecture API must be defined.");
+
+        if (taintEngine == nullptr)
+          throw triton::exceptions::Semantics("x86TaintSummaries::x86TaintSummaries(): The taint engines API must be defined.");
+
+        this->architecture = architecture;
+        this->taintEngine  = taintEngine;
+
+        this->summaries.resize(ID_INS_LAST_ITEM, Summary{KIND_NONE, 0, 0});
+        for (const auto& entry : table) {
+          this->summaries[entry.id] = entry.summary;
+        }
+      }
+
+
+      bool x86TaintSummaries::hasSummary(const triton::arch::Instruction& inst) const {
+        if (inst.getType() >= this->summaries.size())
+          return false;
+
+        const Summary& summary = this->summaries[inst.getType()];
+        return summary.kind != KIND_NONE && this->isSupported(inst, summary);
+      }
+
+
+      bool x86TaintSummaries::isSupported(const triton::arch::Instruction& inst, const Summary& summary) const {
+        /* Repeated instructions also update the counter */
+        if (inst.getPrefix() == ID_PREFIX_REP || inst.getPrefix() == ID_PREFIX_REPE || inst.getPrefix() == ID_PREFIX_REPNE)
+          return false;
+
+        switch (summary.kind) {
+          case KIND_ASSIGN:
+            if (inst.operands.size() != 2)
+              return false;
+            /* Moves of control registers also undefine the flags */
+            for (const auto& operand : inst.operands) {
+              if (operand.getType() == OP_REG) {
+                triton::uint32 id = operand.getConstRegister().getId();
+                if (id >= ID_REG_X86_CR0 && id <= ID_REG_X86_CR15)
+                  return false;
+              }
+            }
+            return true;
+
+          case KIND_UNION:
+          case KIND_UNION_CF:
+          case KIND_COMPARE:
+            return inst.operands.size() == 2;
+
+          case KIND_LEA:
+            return inst.operands.size() == 2 && inst.operands[0].getType() == OP_REG && inst.operands[1].getType() == OP_MEM;
+
+          case KIND_UNARY:
+          case KIND_PUSH:
+            return inst.operands.size() == 1;
+
+          /* A pop through the stack pointer moves the stack before computing its destination */
+          case KIND_POP:
+            return inst.operands.size() == 1 && inst.operands[0].getType() == OP_REG;
+
+          default:
+            return false;
+        }
+      }
+
+
+      void x86TaintSummaries::initAddress(triton::arch::MemoryAccess& mem) const {
+        if (mem.getBitSize() < triton::bitsize::byte || mem.getAddress())
+          return;
+
+        const triton::arch::Register& base  = mem.getConstBaseRegister();
+        const triton::arch::Register& index = mem.getConstIndexRegister();
+        const triton::arch::Register& seg   = mem.getConstSegmentRegister();
+        triton::uint32 bitSize              = (this->architecture->isRegisterValid(base) ? base.getBitSize() :
+                                                (this->architecture->isRegisterValid(index) ? index.getBitSize() :
+                                                  (mem.getConstDisplacement().getBitSize() ? mem.getConstDisplacement().getBitSize() :
+                                                    this->architecture->gprBitSize()
+                                                  )
+                                                )
+                                              );
+        triton::uint64 mask                 = (bitSize >= triton::bitsize::qword) ? ~static_cast<triton::uint64>(0) : ((static_cast<triton::uint64>(1) << bitSize) - 1);
+
+        /* The same computation as SymbolicEngine::initLeaAst(), on concrete values -> ((pc + base) + (index * scale) + disp) */
+        triton::uint64 pcPlusBase    = mem.getPcRelative() ? mem.getPcRelative() :
+                                         (this->architecture->isRegisterValid(base) ? this->architecture->getConcreteRegisterValue(base).convert_to<triton::uint64>() : 0);
+        triton::uint64 indexMulScale = (this->architecture->isRegisterValid(index) ? this->architecture->getConcreteRegisterValue(index).convert_to<triton::uint64>() : 0) * mem.getConstScale().getValue();
+        triton::uint64 lea           = ((index.isSubtracted() ? pcPlusBase - indexMulScale : pcPlusBase + indexMulScale) + mem.getConstDisplacement().getValue()) & mask;
+
+        /* Use segments as base address instead of selector into the GDT. */
+        if (this->architecture->isRegisterValid(seg)) {
+          if (bitSize < triton::bitsize::qword && ((lea >> (bitSize - 1)) & 1))
+            lea |= ~mask;
+          lea += this->architecture->getConcreteRegisterValue(seg).convert_to<triton::uint64>();
+          if (seg.getBitSize() < triton::bitsize::qword)
+            lea &= (static_cast<triton::uint64>(1) << seg.getBitSize()) - 1;
+        }
+
+        mem.setAddress(lea);
+      }
+
+
+      void x86TaintSummaries::setFlags(triton::uint8 mask, bool flag) {
+        static const triton::arch::register_e flags[] = {ID_REG_X86_AF, ID_REG_X86_CF, ID_REG_X86_OF, ID_REG_X86_PF, ID_REG_X86_SF, ID_REG_X86_ZF};
+
+        for (triton::uint32 index = 0; index < sizeof(flags) / sizeof(flags[0]); index++) {
+          if (mask & (1 << index))
+            this->taintEngine->setTaintRegister(this->architecture->getRegister(flags[index]), flag);
+        }
+      }
+
+
+      bool x86TaintSummaries::spread(triton::arch::Instruction& inst) {
+        bool flag = triton::engines::taint::UNTAINTED;
+
+        if (!this->hasSummary(inst))
+          return false;
+
+        const Summary& summary = this->summaries[inst.getType()];
+
+        /* Clear previous semantics if exist */
+        inst.symbolicExpressions.clear();
+        inst.getLoadAccess().clear();
+        inst.getReadRegisters().clear();
+        inst.getReadImmediates().clear();
+        inst.getStoreAccess().clear();
+        inst.getWrittenRegisters().clear();
+
+        /* Update instruction address if undefined */
+        if (!inst.getAddress()) {
+          inst.setAddress(this->architecture->getConcreteRegisterValue(this->architecture->getProgramCounter()).convert_to<triton::uint64>());
+        }
+
+        /* Initialize the target address of memory operands */
+        for (auto& operand : inst.operands) {
+          if (operand.getType() == OP_MEM) {
+            this->initAddress(operand.getMemory());
+          }
+        }
+
+        switch (summary.kind) {
+          case KIND_ASSIGN:
+            flag = this->taintEngine->taintAssignment(inst.operands[0], inst.operands[1]);
+            break;
+
+          case KIND_UNION: {
+            auto& dst = inst.operands[0];
+            auto& src = inst.operands[1];
+            /* clear taint if the registers are the same */
+            if (inst.getType() == ID_INS_XOR && dst.getType() == OP_REG && src.getType() == OP_REG && src.getConstRegister() == dst.getConstRegister())
+              this->taintEngine->setTaint(src, false);
+            else
+              flag = this->taintEngine->taintUnion(dst, src);
+            break;
+          }
+
+          case KIND_UNION_CF:
+            this->taintEngine->taintUnion(inst.operands[0], inst.operands[1]);
+            flag = this->taintEngine->taintUnion(inst.operands[0], triton::arch::OperandWrapper(this->architecture->getRegister(ID_REG_X86_CF)));
+            break;
+
+          case KIND_COMPARE:
+            flag = this->taintEngine->isTainted(inst.operands[0]) | this->taintEngine->isTainted(inst.operands[1]);
+            break;
+
+          case KIND_UNARY:
+            flag = this->taintEngine->taintUnion(inst.operands[0], inst.operands[0]);
+            break;
+
+          case KIND_LEA: {
+            const triton::arch::MemoryAccess& src = inst.operands[1].getConstMemory();
+            flag = this->taintEngine->isRegisterTainted(src.getConstBaseRegister()) | this->taintEngine->isRegisterTainted(src.getConstIndexRegister());
+            flag = this->taintEngine->setTaint(inst.operands[0], flag);
+            break;
+          }
+
+          case KIND_PUSH: {
+            const triton::arch::Register& stack = this->architecture->getStackPointer();
+            triton::uint32 size                 = stack.getSize();
+            triton::uint64 mask                 = (stack.getBitSize() >= triton::bitsize::qword) ? ~static_cast<triton::uint64>(0) : ((static_cast<triton::uint64>(1) << stack.getBitSize()) - 1);
+
+            /* If it's an immediate source, the memory access is always based on the arch size */
+            if (inst.operands[0].getType() != OP_IMM)
+              size = inst.operands[0].getSize();
+
+            triton::uint64 addr = (this->architecture->getConcreteRegisterValue(stack).convert_to<triton::uint64>() - size) & mask;
+            flag = this->taintEngine->taintAssignment(triton::arch::OperandWrapper(triton::arch::MemoryAccess(addr, size)), inst.operands[0]);
+            break;
+          }
+
+          case KIND_POP: {
+            const triton::arch::Register& stack = this->architecture->getStackPointer();
+            triton::uint64 addr                 = this->architecture->getConcreteRegisterValue(stack).convert_to<triton::uint64>();
+            flag = this->taintEngine->taintAssignment(inst.operands[0], triton::arch::OperandWrapper(triton::arch::MemoryAccess(addr, inst.operands[0].getSize())));
+            break;
+          }
+
+          default:
+            return false;
+        }
+
+        /* Update the taint of the flags */
+        this->setFlags(summary.spreadFlags, flag);
+        this->setFlags(summary.clearFlags, triton::engines::taint::UNTAINTED);
+
+        inst.setTaint(flag);
+
+        return true;
+      }
+
+    }; /* x86 namespace */
+  }; /* arch namespace */
+}; /* triton namespace */
@@ -7,9 +7,13 @@
 
 #include <algorithm>
 #include <cmath>
+#include <functional>
+#include <limits>
 #include <list>
 #include <new>
+#include <set>
 #include <stack>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -17,6 +21,7 @@
 #include <triton/ast.hpp>
 #include <triton/astContext.hpp>
 #include <triton/astRepresentation.hpp>
+#include <triton/coreUtils.hpp>
 #include <triton/exceptions.hpp>
 #include <triton/symbolicExpression.hpp>
 #include <triton/symbolicVariable.hpp>
@@ -26,22 +31,792 @@
 namespace triton {
   namespace ast {
 
+    /* Returns the mask of a node which fits in 64 bits */
+    static inline triton::uint64 narrowMask(triton::uint32 size) {
+      return (size >= triton::bitsize::qword) ? static_cast<triton::uint64>(-1) : ((static_cast<triton::uint64>(1) << size) - 1);
+    }
+
+
+    /* ====== Node value */
+
+    NodeValue::NodeValue() {
+      this->narrow = 0;
+    }
+
+
+    NodeValue::NodeValue(const NodeValue& other) {
+      this->narrow = other.narrow;
+      if (other.wide)
+        this->wide.reset(new triton::uint512(*other.wide));
+    }
+
+
+    NodeValue& NodeValue::operator=(const NodeValue& other) {
+      if (this != &other) {
+        this->narrow = other.narrow;
+        if (other.wide)
+          this->wide.reset(new triton::uint512(*other.wide));
+        else
+          this->wide.reset();
+      }
+      return *this;
+    }
+
+
+    NodeValue& NodeValue::operator=(const triton::uint512& value) {
+      if (value <= std::numeric_limits<triton::uint64>::max()) {
+        this->narrow = value.convert_to<triton::uint64>();
+        this->wide.reset();
+      }
+      else {
+        this->narrow = (value & std::numeric_limits<triton::uint64>::max()).convert_to<triton::uint64>();
+        if (this->wide)
+          *this->wide = value;
+        else
+          this->wide.reset(new triton::uint512(value));
+      }
+      return *this;
+    }
+
+
+    void NodeValue::setNarrow(triton::uint64 value) {
+      this->narrow = value;
+      this->wide.reset();
+    }
+
+
+    triton::uint512 NodeValue::get(void) const {
+      if (this->wide)
+        return *this->wide;
+      return this->narrow;
+    }
+
+
+    triton::uint64 NodeValue::getNarrow(void) const {
+      return this->narrow;
+    }
+
+
+    /* ====== Node hash */
+
+    /* Multiplies two 64-bit values and folds the 128-bit product (portable XXH_mult64to128) */
+    static inline triton::uint64 mulFold64(triton::uint64 a, triton::uint64 b) {
+      triton::uint64 lolo  = (a & 0xffffffff) * (b & 0xffffffff);
+      triton::uint64 hilo  = (a >> 32) * (b & 0xffffffff);
+      triton::uint64 lohi  = (a & 0xffffffff) * (b >> 32);
+      triton::uint64 hihi  = (a >> 32) * (b >> 32);
+      triton::uint64 cross = (lolo >> 32) + (hilo & 0xffffffff) + lohi;
+      triton::uint64 upper = (hilo >> 32) + (cross >> 32) + hihi;
+      triton::uint64 lower = (cross << 32) | (lolo & 0xffffffff);
+      return lower ^ upper;
+    }
+
+
+    NodeHash::NodeHash() {
+      this->low  = 0x9e3779b185ebca87ULL;
+      this->high = 0xc2b2ae3d27d4eb4fULL;
+    }
+
+
+    void NodeHash::mix(triton::uint64 value) {
+      triton::uint64 low  = this->low ^ value;
+      triton::uint64 high = this->high + value;
+
+      this->low  = mulFold64(low ^ 0x165667b19e3779f9ULL, high ^ 0x85ebca77c2b2ae63ULL);
+      this->high = mulFold64(high ^ 0x27d4eb2f165667c5ULL, ((low << 31) | (low >> 33)) ^ 0x9fb21c651e98df25ULL);
+    }
+
+
+    void NodeHash::mix(const triton::uint512& value) {
+      triton::uint512 v = value;
+
+      /* Values are mixed by limbs of 64 bits, the number of limbs is mixed last */
+      triton::uint32 limbs = 0;
+      do {
+        this->mix(v.convert_to<triton::uint64>());
+        v >>= 64;
+        limbs++;
+      } while (v != 0);
+
+      this->mix(static_cast<triton::uint64>(limbs));
+    }
+
+
+    void NodeHash::mix(const std::string& value) {
+      triton::usize length = value.size();
+
+      for (triton::usize i = 0; i < length; i += 8) {
+        triton::uint64 chunk = 0;
+        for (triton::usize j = i; j < length && j < i + 8; j++)
+          chunk = (chunk << 8) | static_cast<triton::uint8>(value[j]);
+        this->mix(chunk);
+      }
+
+      this->mix(static_cast<triton::uint64>(length));
+    }
+
+
+    void NodeHash::mix(const NodeHash& other) {
+      this->mix(other.low);
+      this->mix(other.high);
+    }
+
+
+    triton::uint128 NodeHash::get(void) const {
+      return (static_cast<triton::uint128>(this->high) << 64) | this->low;
+    }
+
+
+    bool NodeHash::operator==(const NodeHash& other) const {
+      return (this->low == other.low) && (this->high == other.high);
+    }
+
+
+    bool NodeHash::operator!=(const NodeHash& other) const {
+      return !(*this == other);
+    }
+
+
+    bool NodeHash::operator<(const NodeHash& other) const {
+      return (this->high < other.high) || (this->high == other.high && this->low < other.low);
+    }
+
+
+    /* ====== Node domain */
+
+    /* Returns the mask of a domain of any size */
+    static inline triton::uint512 domainMask(triton::uint32 size) {
+      return (size >= triton::bitsize::dqqword) ? ~triton::uint512(0) : ((triton::uint512(1) << size) - 1);
+    }
+
+
+    NodeDomain::NodeDomain(triton::uint32 size) {
+      this->size  = size;
+      this->zeros = 0;
+      this->ones  = 0;
+      this->lower = 0;
+      this->upper = domainMask(size);
+    }
+
+
+    NodeDomain::NodeDomain(triton::uint32 size, const triton::uint512& value) {
+      triton::uint512 mask = domainMask(size);
+      this->size  = size;
+      this->zeros = ~value & mask;
+      this->ones  = value & mask;
+      this->lower = value & mask;
+      this->upper = value & mask;
+    }
+
+
+    NodeDomain::NodeDomain(triton::uint32 size, const triton::uint512& zeros, const triton::uint512& ones, const triton::uint512& lower, const triton::uint512& upper) {
+      this->size  = size;
+      this->zeros = zeros;
+      this->ones  = ones;
+      this->lower = lower;
+      this->upper = upper;
+      this->normalize();
+    }
+
+
+    void NodeDomain::normalize(void) {
+      triton::uint512 mask = domainMask(this->size);
+
+      this->zeros &= mask;
+      this->ones  &= mask;
+      this->upper  = std::min(this->upper, mask);
+      this->lower  = std::max(this->lower, this->ones);
+      this->upper  = std::min(this->upper, ~this->zeros & mask);
+
+      /* Facts which contradict themselves come from unreachable values, they are dropped to stay sound */
+      if ((this->zeros & this->ones) != 0 || this->lower > this->upper) {
+        *this = NodeDomain(this->size);
+        return;
+      }
+
+      /* Bits above the highest bit in which both bounds differ are known */
+      triton::uint512 diff   = this->lower ^ this->upper;
+      triton::uint512 prefix = (diff == 0) ? mask : (mask & ~domainMask(boost::multiprecision::msb(diff) + 1));
+      if ((this->ones & prefix & ~this->lower) != 0 || (this->zeros & prefix & this->lower) != 0) {
+        *this = NodeDomain(this->size);
+        return;
+      }
+
+      this->ones  |= this->lower & prefix;
+      this->zeros |= ~this->lower & prefix;
+    }
+
+
+    triton::uint32 NodeDomain::getBitvectorSize(void) const {
+      return this->size;
+    }
+
+
+    const triton::uint512& NodeDomain::getKnownZeros(void) const {
+      return this->zeros;
+    }
+
+
+    const triton::uint512& NodeDomain::getKnownOnes(void) const {
+      return this->ones;
+    }
+
+
+    const triton::uint512& NodeDomain::getLower(void) const {
+      return this->lower;
+    }
+
+
+    const triton::uint512& NodeDomain::getUpper(void) const {
+      return this->upper;
+    }
+
+
+    bool NodeDomain::isConstant(void) const {
+      return this->size != 0 && this->lower == this->upper;
+    }
+
+
+    bool NodeDomain::contains(const triton::uint512& value) const {
+      return (value & this->zeros) == 0 &&
+             (value & this->ones) == this->ones &&
+             value >= this->lower &&
+             value <= this->upper;
+    }
+
+
+    NodeDomain NodeDomain::join(const NodeDomain& other) const {
+      return NodeDomain(
+        this->size,
+        this->zeros & other.zeros,
+        this->ones & other.ones,
+        std::min(this->lower, other.lower),
+        std::max(this->upper, other.upper)
+      );
+    }
+
+
+    bool NodeDomain::operator==(const NodeDomain& other) const {
+      return this->size == other.size &&
+             this->zeros == other.zeros &&
+             this->ones == other.ones &&
+             this->lower == other.lower &&
+             this->upper == other.upper;
+    }
+
+
+    bool NodeDomain::operator!=(const NodeDomain& other) const {
+      return !(*this == other);
+    }
+
+
+    /* ====== Node parents */
+
+
+    static bool parentLess(const NodeParents::Entry& entry, AbstractNode* node) {
+      return entry.node < node;
+    }
+
+
+    NodeParents::Entry* NodeParents::find(AbstractNode* node) {
+      if (!this->spilled.empty()) {
+        auto it = std::lower_bound(this->spilled.begin(), this->spilled.end(), node, parentLess);
+        return (it != this->spilled.end() && it->node == node) ? &(*it) : nullptr;
+      }
+
+      for (triton::uint32 index = 0; index < this->used; index++) {
+        if (this->inlined[index].node == node)
+          return &this->inlined[index];
+      }
+
+      return nullptr;
+    }
+
+
+    void NodeParents::insert(AbstractNode* node, const WeakAbstractNode& weak) {
+      Entry entry = {node, 1, weak};
+
+      if (this->spilled.empty() && this->used < inlineSize) {
+        this->inlined[this->used++] = std::move(entry);
+        return;
+      }
+
+      /* The inline entries move to the vector */
+      if (this->spilled.empty()) {
+        this->spilled.reserve(inlineSize * 2);
+        for (triton::uint32 index = 0; index < this->used; index++) {
+          this->spilled.push_back(std::move(this->inlined[index]));
+          this->inlined[index].weak.reset();
+        }
+        std::sort(this->spilled.begin(), this->spilled.end(), [](const Entry& a, const Entry& b) { return a.node < b.node; });
+        this->used = 0;
+      }
+
+      this->spilled.insert(std::lower_bound(this->spilled.begin(), this->spilled.end(), node, parentLess), std::move(entry));
+    }
+
+
+    void NodeParents::erase(AbstractNode* node) {
+      if (!this->spilled.empty()) {
+        auto it = std::lower_bound(this->spilled.begin(), this->spilled.end(), node, parentLess);
+        if (it != this->spilled.end() && it->node == node)
+          this->spilled.erase(it);
+        if (this->spilled.empty())
+          std::vector<Entry>().swap(this->spilled);
+        return;
+      }
+
+      for (triton::uint32 index = 0; index < this->used; index++) {
+        if (this->inlined[index].node == node) {
+          /* The last entry takes its place */
+          this->inlined[index] = std::move(this->inlined[this->used - 1]);
+          this->inlined[--this->used].weak.reset();
+          return;
+        }
+      }
+    }
+
+
+    void NodeParents::clear(void) {
+      for (triton::uint32 index = 0; index < this->used; index++)
+        this->inlined[index].weak.reset();
+      this->used = 0;
+      std::vector<Entry>().swap(this->spilled);
+    }
+
+
+    triton::usize NodeParents::size(void) const {
+      return this->spilled.empty() ? this->used : this->spilled.size();
+    }
+
+
+    /* The domain of logical nodes */
+    static const NodeDomain logicalTrue(1, 1);
+    static const NodeDomain logicalFalse(1, 0);
+    static const NodeDomain logicalUnknown(1);
+
+
+    /* Returns the number of trailing bits known to be zero */
+    static triton::uint32 trailingZeros(const NodeDomain& d) {
+      triton::uint512 unknown = ~d.getKnownZeros() & domainMask(d.getBitvectorSize());
+      return (unknown == 0) ? d.getBitvectorSize() : static_cast<triton::uint32>(boost::multiprecision::lsb(unknown));
+    }
+
+
+    /* Returns ~d */
+    static NodeDomain notDomain(const NodeDomain& d) {
+      triton::uint512 mask = domainMask(d.getBitvectorSize());
+      return NodeDomain(d.getBitvectorSize(), d.getKnownOnes(), d.getKnownZeros(), mask - d.getUpper(), mask - d.getLower());
+    }
+
+
+    /* Returns the known bits of d1 + d2 + carry, see LLVM's KnownBits::computeForAddSub() */
+    static NodeDomain addBits(const NodeDomain& d1, const NodeDomain& d2, bool carry) {
+      triton::uint32 size  = d1.getBitvectorSize();
+      triton::uint512 mask = domainMask(size);
+      triton::uint512 cin  = carry ? 1 : 0;
+
+      /* The largest and the smallest possible sums */
+      triton::uint512 sumZero = ((~d1.getKnownZeros() & mask) + (~d2.getKnownZeros() & mask) + cin) & mask;
+      triton::uint512 sumOne  = (d1.getKnownOnes() + d2.getKnownOnes() + cin) & mask;
+
+      /* Carries known in both cases */
+      triton::uint512 carryZero = ~(sumZero ^ d1.getKnownZeros() ^ d2.getKnownZeros()) & mask;
+      triton::uint512 carryOne  = (sumOne ^ d1.getKnownOnes() ^ d2.getKnownOnes()) & mask;
+
+      triton::uint512 known = (d1.getKnownZeros() | d1.getKnownOnes()) & (d2.getKnownZeros() | d2.getKnownOnes()) & (carryZero | carryOne);
+      return NodeDomain(size, ~sumZero & known & mask, sumOne & known, 0, mask);
+    }
+
+
+    /* Returns d with its sign bit flipped, so that signed comparisons become unsigned ones */
+    static NodeDomain flipSign(const NodeDomain& d) {
+      triton::uint32 size  = d.getBitvectorSize();
+      triton::uint512 sign = triton::uint512(1) << (size - 1);
+      triton::uint512 zeros = (d.getKnownZeros() & ~sign) | (d.getKnownOnes() & sign);
+      triton::uint512 ones  = (d.getKnownOnes() & ~sign) | (d.getKnownZeros() & sign);
+
+      if (((d.getKnownZeros() | d.getKnownOnes()) & sign) != 0)
+        return NodeDomain(size, zeros, ones, d.getLower() ^ sign, d.getUpper() ^ sign);
+      return NodeDomain(size, zeros, ones, 0, domainMask(size));
+    }
+
+
+    /* Decides d1 < d2 (or d1 <= d2 if orEqual) on unsigned values */
+    static const NodeDomain& lessThan(const NodeDomain& d1, const NodeDomain& d2, bool orEqual) {
+      if (orEqual ? (d1.getUpper() <= d2.getLower()) : (d1.getUpper() < d2.getLower()))
+        return logicalTrue;
+      if (orEqual ? (d1.getLower() > d2.getUpper()) : (d1.getLower() >= d2.getUpper()))
+        return logicalFalse;
+      return logicalUnknown;
+    }
+
+
+    /* Decides d1 == d2 */
+    static const NodeDomain& equalTo(const NodeDomain& d1, const NodeDomain& d2) {
+      if ((d1.getKnownOnes() & d2.getKnownZeros()) != 0 || (d1.getKnownZeros() & d2.getKnownOnes()) != 0)
+        return logicalFalse;
+      if (d1.getUpper() < d2.getLower() || d2.getUpper() < d1.getLower())
+        return logicalFalse;
+      if (d1.isConstant() && d2.isConstant())
+        return logicalTrue;
+      return logicalUnknown;
+    }
+
+
+    /* Returns the rotation of the bits of a mask to the left */
+    static triton::uint512 rotateMask(const triton::uint512& value, triton::uint32 rot, triton::uint32 size) {
+      rot = rot % size;
+      if (rot == 0)
+        return value;
+      return ((value << rot) | (value >> (size - rot))) & domainMask(size);
+    }
+
+
+    /* Computes the abstract value of a symbolized node from the ones of its children */
+    static NodeDomain computeDomain(AbstractNode* node) {
+      const auto& children = node->getChildren();
+      triton::uint32 size  = node->getBitvectorSize();
+      triton::uint512 mask = domainMask(size);
+
+      switch (node->getType()) {
+        case BVADD_NODE: {
+          /* An n-ary sum (AST_NARY) is the sum of its first operands plus the last one */
+          NodeDomain d1 = children[0]->getDomain();
+          for (triton::uint32 index = 1; index < children.size(); index++) {
+            NodeDomain d2 = children[index]->getDomain();
+            NodeDomain bits = addBits(d1, d2, false);
+            triton::uint512 upper = d1.getUpper() + d2.getUpper();
+            if (size < triton::bitsize::dqqword && upper <= mask)
+              d1 = NodeDomain(size, bits.getKnownZeros(), bits.getKnownOnes(), d1.getLower() + d2.getLower(), upper);
+            else
+              d1 = bits;
+          }
+          return d1;
+        }
+
+        case BVSUB_NODE:
+        case BVNEG_NODE: {
+          NodeDomain d1 = (node->getType() == BVNEG_NODE) ? NodeDomain(size, 0) : children[0]->getDomain();
+          NodeDomain d2 = (node->getType() == BVNEG_NODE) ? children[0]->getDomain() : children[1]->getDomain();
+          NodeDomain bits = addBits(d1, notDomain(d2), true);
+          if (d1.getLower() >= d2.getUpper())
+            return NodeDomain(size, bits.getKnownZeros(), bits.getKnownOnes(), d1.getLower() - d2.getUpper(), d1.getUpper() - d2.getLower());
+          return bits;
+        }
+
+        case BVMUL_NODE: {
+          NodeDomain d1 = children[0]->getDomain();
+          NodeDomain d2 = children[1]->getDomain();
+          triton::uint32 tz = std::min(trailingZeros(d1) + trailingZeros(d2), size);
+          if (size <= triton::bitsize::dqqword / 2 && d1.getUpper() * d2.getUpper() <= mask)
+            return NodeDomain(size, domainMask(tz), 0, d1.getLower() * d2.getLower(), d1.getUpper() * d2.getUpper());
+          return NodeDomain(size, domainMask(tz), 0, 0, mask);
+        }
+
+        case BVAND_NODE:
+        case BVNAND_NODE: {
+          NodeDomain res = children[0]->getDomain();
+          for (triton::uint32 index = 1; index < children.size(); index++) {
+            NodeDomain d2 = children[index]->getDomain();
+            res = NodeDomain(size, res.getKnownZeros() | d2.getKnownZeros(), res.getKnownOnes() & d2.getKnownOnes(), 0, std::min(res.getUpper(), d2.getUpper()));
+          }
+          return (node->getType() == BVNAND_NODE) ? notDomain(res) : res;
+        }
+
+        case BVOR_NODE:
+        case BVNOR_NODE: {
+          NodeDomain res = children[0]->getDomain();
+          for (triton::uint32 index = 1; index < children.size(); index++) {
+            NodeDomain d2 = children[index]->getDomain();
+            res = NodeDomain(size, res.getKnownZeros() & d2.getKnownZeros(), res.getKnownOnes() | d2.getKnownOnes(), std::max(res.getLower(), d2.getLower()), mask);
+          }
+          return (node->getType() == BVNOR_NODE) ? notDomain(res) : res;
+        }
+
+        case BVXOR_NODE:
+        case BVXNOR_NODE: {
+          NodeDomain res = children[0]->getDomain();
+          for (triton::uint32 index = 1; index < children.size(); index++) {
+            NodeDomain d2 = children[index]->getDomain();
+            triton::uint512 known = (res.getKnownZeros() | res.getKnownOnes()) & (d2.getKnownZeros() | d2.getKnownOnes());
+            triton::uint512 ones  = (res.getKnownOnes() & d2.getKnownZeros()) | (res.getKnownZeros() & d2.getKnownOnes());
+            res = NodeDomain(size, known & ~ones, ones, 0, mask);
+          }
+          return (node->getType() == BVXNOR_NODE) ? notDomain(res) : res;
+        }
+
+        case BVNOT_NODE:
+          return notDomain(children[0]->getDomain());
+
+        case BVSHL_NODE: {
+          NodeDomain d1 = children[0]->getDomain();
+          NodeDomain d2 = children[1]->getDomain();
+          if (d2.getLower() >= size)
+            return NodeDomain(size, 0);
+          if (d2.isConstant()) {
+            triton::uint32 shift = d2.getLower().convert_to<triton::uint32>();
+            triton::uint512 zeros = (d1.getKnownZeros() << shift) | domainMask(shift);
+            triton::uint512 upper = d1.getUpper() << shift;
+            /* The bounds are kept if no bit is shifted out */
+            if ((upper >> shift) == d1.getUpper() && upper <= mask)
+              return NodeDomain(size, zeros, d1.getKnownOnes() << shift, d1.getLower() << shift, upper);
+            return NodeDomain(size, zeros, d1.getKnownOnes() << shift, 0, mask);
+          }
+          /* Shifts keep at least the trailing zeros of the value and of the minimal shift */
+          triton::uint32 tz = std::min(trailingZeros(d1) + d2.getLower().convert_to<triton::uint32>(), size);
+          return NodeDomain(size, domainMask(tz), 0, 0, mask);
+        }
+
+        case BVLSHR_NODE: {
+          NodeDomain d1 = children[0]->getDomain();
+          NodeDomain d2 = children[1]->getDomain();
+          if (d2.getLower() >= size)
+            return NodeDomain(size, 0);
+          triton::uint32 shiftMin = d2.getLower().convert_to<triton::uint32>();
+          triton::uint512 lower   = (d2.getUpper() >= size) ? triton::uint512(0) : (d1.getLower() >> d2.getUpper().convert_to<triton::uint32>());
+          if (d2.isConstant())
+            return NodeDomain(size, (d1.getKnownZeros() >> shiftMin) | (mask & ~(mask >> shiftMin)), d1.getKnownOnes() >> shiftMin, lower, d1.getUpper() >> shiftMin);
+          return NodeDomain(size, 0, 0, lower, d1.getUpper() >> shiftMin);
+        }
+
+        case BVASHR_NODE: {
+          NodeDomain d1 = children[0]->getDomain();
+          NodeDomain d2 = children[1]->getDomain();
+          triton::uint512 sign = triton::uint512(1) << (size - 1);
+
+          /* A positive value is shifted as a logical shift */
+          if ((d1.getKnownZeros() & sign) != 0) {
+            if (d2.getLower() >= size)
+              return NodeDomain(size, 0);
+            triton::uint32 shiftMin = d2.getLower().convert_to<triton::uint32>();
+            triton::uint512 lower   = (d2.getUpper() >= size) ? triton::uint512(0) : (d1.getLower() >> d2.getUpper().convert_to<triton::uint32>());
+            return NodeDomain(size, mask & ~(mask >> shiftMin), 0, lower, d1.getUpper() >> shiftMin);
+          }
+
+          if (d2.isConstant()) {
+            triton::uint32 shift = (d2.getLower() >= size) ? size - 1 : d2.getLower().convert_to<triton::uint32>();
+            triton::uint512 high = mask & ~(mask >> shift);
+            return NodeDomain(size, d1.getKnownZeros() >> shift, (d1.getKnownOnes() >> shift) | (((d1.getKnownOnes() & sign) != 0) ? high : triton::uint512(0)), 0, mask);
+          }
+          return NodeDomain(size);
+        }
+
+        case BVUDIV_NODE: {
+          NodeDomain d1 = children[0]->getDomain();
+          NodeDomain d2 = children[1]->getDomain();
+          /* A division by zero returns all ones */
+          if (d2.getLower() == 0)
+            return NodeDomain(size);
+          return NodeDomain(size, 0, 0, d1.getLower() / d2.getUpper(), d1.getUpper() / d2.getLower());
+        }
+
+        case BVUREM_NODE: {
+          NodeDomain d1 = children[0]->getDomain();
+          NodeDomain d2 = children[1]->getDomain();
+          /* A remainder by zero returns the dividend */
+          if (d1.getUpper() < d2.getLower())
+            return d1;
+          if (d2.getLower() == 0)
+            return NodeDomain(size, 0, 0, 0, d1.getUpper());
+          return NodeDomain(size, 0, 0, 0, std::min(d1.getUpper(), d2.getUpper() - 1));
+        }
+
+        case BVROL_NODE:
+        case BVROR_NODE: {
+          if (children[1]->getType() != INTEGER_NODE)
+            return NodeDomain(size);
+          NodeDomain d = children[0]->getDomain();
+          triton::uint32 rot = (reinterpret_cast<IntegerNode*>(children[1].get())->getInteger() % size).convert_to<triton::uint32>();
+          if (node->getType() == BVROR_NODE)
+            rot = (size - rot) % size;
+          return NodeDomain(size, rotateMask(d.getKnownZeros(), rot, size), rotateMask(d.getKnownOnes(), rot, size), 0, mask);
+        }
+
+        case BVLANESELECT_NODE: {
+          /* Each bit is the one of a lane of the first or second operand */
+          NodeDomain d1 = children[1]->getDomain();
+          NodeDomain d2 = children[2]->getDomain();
+          return NodeDomain(size, d1.getKnownZeros() & d2.getKnownZeros(), d1.getKnownOnes() & d2.getKnownOnes(), 0, mask);
+        }
+
+        case BVPARITY_NODE: {
+          NodeDomain d = children[0]->getDomain();
+          if (d.isConstant())
+            return NodeDomain(size, triton::utils::popcount(d.getLower()) & 1);
+          return NodeDomain(size);
+        }
+
+        case BVPOPCOUNT_NODE: {
+          NodeDomain d = children[0]->getDomain();
+          triton::uint512 lower = triton::utils::popcount(d.getKnownOnes());
+          triton::uint512 upper = size - triton::utils::popcount(d.getKnownZeros());
+          return NodeDomain(size, 0, 0, lower, upper);
+        }
+
+        case BSWAP_NODE: {
+          NodeDomain d = children[0]->getDomain();
+          triton::uint512 zeros = 0;
+          triton::uint512 ones  = 0;
+          for (triton::uint32 index = 0; index < size; index += triton::bitsize::byte) {
+            zeros = (zeros << triton::bitsize::byte) | ((d.getKnownZeros() >> index) & 0xff);
+            ones  = (ones << triton::bitsize::byte) | ((d.getKnownOnes() >> index) & 0xff);
+          }
+          return NodeDomain(size, zeros, ones, 0, mask);
+        }
+
+        case CONCAT_NODE: {
+          NodeDomain res = children[0]->getDomain();
+          for (triton::uint32 index = 1; index < children.size(); index++) {
+            NodeDomain d = children[index]->getDomain();
+            triton::uint32 width = d.getBitvectorSize();
+            res = NodeDomain(
+              res.getBitvectorSize() + width,
+              (res.getKnownZeros() << width) | d.getKnownZeros(),
+              (res.getKnownOnes() << width) | d.getKnownOnes(),
+              (res.getLower() << width) | d.getLower(),
+              (res.getUpper() << width) | d.getUpper()
+            );
+          }
+          return res;
+        }
+
+        case EXTRACT_NODE: {
+          NodeDomain d = children[2]->getDomain();
+          triton::uint32 low = reinterpret_cast<IntegerNode*>(children[1].get())->getInteger().convert_to<triton::uint32>();
+          /* The bounds are kept if no bit above the extraction may be set */
+          if ((d.getUpper() >> low) <= mask)
+            return NodeDomain(size, (d.getKnownZeros() >> low) & mask, (d.getKnownOnes() >> low) & mask, d.getLower() >> low, d.getUpper() >> low);
+          return NodeDomain(size, (d.getKnownZeros() >> low) & mask, (d.getKnownOnes() >> low) & mask, 0, mask);
+        }
+
+        case ZX_NODE: {
+          NodeDomain d = children[1]->getDomain();
+          triton::uint512 high = mask & ~domainMask(d.getBitvectorSize());
+          return NodeDomain(size, d.getKnownZeros() | high, d.getKnownOnes(), d.getLower(), d.getUpper());
+        }
+
+        case SX_NODE: {
+          NodeDomain d = children[1]->getDomain();
+          triton::uint512 sign = triton::uint512(1) << (d.getBitvectorSize() - 1);
+          triton::uint512 high = mask & ~domainMask(d.getBitvectorSize());
+          if ((d.getKnownZeros() & sign) != 0)
+            return NodeDomain(size, d.getKnownZeros() | high, d.getKnownOnes(), d.getLower(), d.getUpper());
+          if ((d.getKnownOnes() & sign) != 0)
+            return NodeDomain(size, d.getKnownZeros(), d.getKnownOnes() | high, d.getLower() | high, d.getUpper() | high);
+          return NodeDomain(size, d.getKnownZeros(), d.getKnownOnes(), 0, mask);
+        }
+
+        case ITE_NODE: {
+          NodeDomain cond = children[0]->getDomain();
+          if (cond == logicalTrue)
+            return children[1]->getDomain();
+          if (cond == logicalFalse)
+            return children[2]->getDomain();
+          return children[1]->getDomain().join(children[2]->getDomain());
+        }
+
+        case REFERENCE_NODE:
+          return reinterpret_cast<ReferenceNode*>(node)->getSymbolicExpression()->getAst()->getDomain();
+
+        /* Logical nodes */
+        case EQUAL_NODE:
+        case DISTINCT_NODE: {
+          NodeDomain res = (children[0] == children[1]) ? logicalTrue : equalTo(children[0]->getDomain(), children[1]->getDomain());
+          return (node->getType() == DISTINCT_NODE && res.isConstant()) ? notDomain(res) : res;
+        }
+
+        case BVULT_NODE: return lessThan(children[0]->getDomain(), children[1]->getDomain(), false);
+        case BVULE_NODE: return lessThan(children[0]->getDomain(), children[1]->getDomain(), true);
+        case BVUGT_NODE: return lessThan(children[1]->getDomain(), children[0]->getDomain(), false);
+        case BVUGE_NODE: return lessThan(children[1]->getDomain(), children[0]->getDomain(), true);
+        case BVSLT_NODE: return lessThan(flipSign(children[0]->getDomain()), flipSign(children[1]->getDomain()), false);
+        case BVSLE_NODE: return lessThan(flipSign(children[0]->getDomain()), flipSign(children[1]->getDomain()), true);
+        case BVSGT_NODE: return lessThan(flipSign(children[1]->getDomain()), flipSign(children[0]->getDomain()), false);
+        case BVSGE_NODE: return lessThan(flipSign(children[1]->getDomain()), flipSign(children[0]->getDomain()), true);
+
+        case LNOT_NODE:
+          return notDomain(children[0]->getDomain());
+
+        case LAND_NODE:
+        case LOR_NODE: {
+          /* A false operand decides a conjunction, a true one decides a disjunction */
+          const NodeDomain& decisive = (node->getType() == LAND_NODE) ? logicalFalse : logicalTrue;
+          bool decided = true;
+          for (const auto& child : children) {
+            NodeDomain d = child->getDomain();
+            if (d == decisive)
+              return decisive;
+            decided &= d.isConstant();
+          }
+          return decided ? notDomain(decisive) : logicalUnknown;
+        }
+
+        case LXOR_NODE:
+        case IFF_NODE: {
+          triton::uint512 value = 0;
+          for (const auto& child : children) {
+            NodeDomain d = child->getDomain();
+            if (!d.isConstant())
+              return logicalUnknown;
+            value ^= d.getLower();
+          }
+          return NodeDomain(1, (node->getType() == IFF_NODE) ? (value ^ 1) : value);
+        }
+
+        default:
+          return NodeDomain(size);
+      }
+    }
+
+
     /* ====== Abstract node */
 
     AbstractNode::AbstractNode(triton::ast::ast_e type, const SharedAstContext& ctxt) {
       this->ctxt        = ctxt;
       this->eval        = 0;
-      this->hash        = 0;
+      this->frozen      = false;
+      this->hashDirty   = false;
       this->logical     = false;
       this->level       = 1;
+      this->simplified  = 0;
       this->size        = 0;
       this->symbolized  = false;
       this->type        = type;
+
+      if (this->ctxt != nullptr)
+        this->ctxt->countNode(this->type, true);
+    }
+
+
+    AbstractNode::AbstractNode(const AbstractNode& other)
+      : std::enable_shared_from_this<AbstractNode>(other) {
+      this->children    = other.children;
+      this->ctxt        = other.ctxt;
+      this->domain      = other.domain;
+      this->eval        = other.eval;
+      this->frozen      = false;
+      this->hash        = other.hash;
+      this->hashDirty   = other.hashDirty;
+      this->level       = other.level;
+      this->logical     = other.logical;
+      this->parents     = other.parents;
+      this->simplified  = other.simplified;
+      this->size        = other.size;
+      this->symbolized  = other.symbolized;
+      this->type        = other.type;
+
+      if (this->ctxt != nullptr)
+        this->ctxt->countNode(this->type, true);
     }
 
 
     AbstractNode::~AbstractNode() {
       /* See #828: Release ownership before calling container destructor */
+      if (this->ctxt != nullptr) {
+        this->ctxt->countNode(this->type, false);
+        this->ctxt->release(this->children);
+      }
       this->children.clear();
     }
 
@@ -69,7 +844,13 @@ namespace triton {
 
 
     bool AbstractNode::isSigned(void) const {
-      if ((this->eval >> (this->size-1)) & 1)
+      if (this->size == 0)
+        return false;
+
+      if (this->size <= triton::bitsize::qword)
+        return ((this->eval.getNarrow() >> (this->size-1)) & 1);
+
+      if ((this->eval.get() >> (this->size-1)) & 1)
         return true;
       return false;
     }
@@ -80,6 +861,56 @@ namespace triton {
     }
 
 
+    bool AbstractNode::isFrozen(void) const {
+      return this->frozen;
+    }
+
+
+    bool AbstractNode::isSimplified(triton::ast::simplifier_e simplifier) const {
+      return (this->simplified & simplifier) != 0;
+    }
+
+
+    void AbstractNode::setSimplified(triton::ast::simplifier_e simplifier) {
+      if (this->frozen == false)
+        this->simplified |= simplifier;
+    }
+
+
+    void AbstractNode::freeze(void) {
+      std::vector<AbstractNode*> worklist = {this};
+      std::vector<AbstractNode*> nodes;
+      std::unordered_set<AbstractNode*> visited;
+
+      /* Frozen subtrees are already immutable, they are not visited again */
+      while (!worklist.empty()) {
+        AbstractNode* node = worklist.back();
+        worklist.pop_back();
+
+        if (node->frozen || !visited.insert(node).second)
+          continue;
+
+        nodes.push_back(node);
+        for (const auto& child : node->children)
+          worklist.push_back(child.get());
+
+        if (node->type == REFERENCE_NODE)
+          worklist.push_back(reinterpret_cast<ReferenceNode*>(node)->getSymbolicExpression()->getAst().get());
+      }
+
+      /* Lazy hashes must be resolved now, frozen nodes are never written again */
+      for (AbstractNode* node : nodes)
+        AbstractNode::hashOf(node);
+
+      /* Frozen nodes are not reevaluated, links to their parents are useless */
+      for (AbstractNode* node : nodes) {
+        node->parents.clear();
+        node->frozen = true;
+        node->ctxt->bumpStructureVersion();
+      }
+    }
+
+
     bool AbstractNode::isLogical(void) const {
       switch (this->type) {
         case BVSGE_NODE:
@@ -112,6 +943,23 @@ namespace triton {
     }
 
 
+    bool AbstractNode::isArray(void) const {
+      switch (this->type) {
+        case ARRAY_NODE:
+        case STORE_NODE:
+          return true;
+
+        case REFERENCE_NODE:
+          return reinterpret_cast<const ReferenceNode*>(this)->getSymbolicExpression()->getAst()->isArray();
+
+        default:
+          break;
+      }
+
+      return false;
+    }
+
+
     bool AbstractNode::hasSameConcreteValueAndTypeAs(const SharedAbstractNode& other) const {
       return (this->evaluate() == other->evaluate()) &&
              (this->getBitvectorSize() == other->getBitvectorSize()) &&
@@ -121,25 +969,256 @@ namespace triton {
 
     bool AbstractNode::canReplaceNodeWithoutUpdate(const SharedAbstractNode& other) const {
       return (this->hasSameConcreteValueAndTypeAs(other)) &&
-             (this->isSymbolized() == other->isSymbolized());
+             (this->isSymbolized() == other->isSymbolized()) &&
+             (this->getDomain() == other->getDomain());
+    }
+
+
+    /* The operators whose operands are hashed sorted (see hashStructure()) */
+    static bool isCommutative(triton::ast::ast_e type) {
+      switch (type) {
+        case BVADD_NODE:
+        case BVAND_NODE:
+        case BVMUL_NODE:
+        case BVNAND_NODE:
+        case BVNOR_NODE:
+        case BVOR_NODE:
+        case BVXNOR_NODE:
+        case BVXOR_NODE:
+        case DISTINCT_NODE:
+        case EQUAL_NODE:
+        case LAND_NODE:
+        case LOR_NODE:
+        case LXOR_NODE:
+          return true;
+        default:
+          return false;
+      }
     }
 
 
     bool AbstractNode::equalTo(const SharedAbstractNode& other) const {
-      return (this->evaluate() == other->evaluate()) &&
-             (this->getBitvectorSize() == other->getBitvectorSize()) &&
-             (this->getHash() == other->getHash()) &&
-             (this->getLevel() == other->getLevel());
+      std::set<std::pair<const AbstractNode*, const AbstractNode*>> visited;
+      std::vector<std::pair<const AbstractNode*, const AbstractNode*>> worklist;
+
+      /* The fields which do not depend on the children, the hash first as it is the most selective */
+      auto shallowEqual = [](const AbstractNode* a, const AbstractNode* b) {
+        return (a->getHash() == b->getHash()) &&
+               (a->type == b->type) &&
+               (a->size == b->size) &&
+               (a->level == b->level) &&
+               (a->children.size() == b->children.size()) &&
+               (a->evaluate() == b->evaluate());
+      };
+
+      auto byHash = [](const SharedAbstractNode& a, const SharedAbstractNode& b) {
+        return a->getHash() < b->getHash();
+      };
+
+      if (this == other.get())
+        return true;
+
+      if (!shallowEqual(this, other.get()))
+        return false;
+
+      /* Pairs of nodes are compared once, so that shared sub-trees cost once and deep trees do not recurse */
+      worklist.push_back({this, other.get()});
+      while (!worklist.empty()) {
+        const AbstractNode* a = worklist.back().first;
+        const AbstractNode* b = worklist.back().second;
+        worklist.pop_back();
+
+        if (a == b || !visited.insert({a, b}).second)
+          continue;
+
+        if (!shallowEqual(a, b))
+          return false;
+
+        switch (a->type) {
+          case INTEGER_NODE:
+            if (const_cast<IntegerNode*>(reinterpret_cast<const IntegerNode*>(a))->getInteger() != const_cast<IntegerNode*>(reinterpret_cast<const IntegerNode*>(b))->getInteger())
+              return false;
+            continue;
+
+          case STRING_NODE:
+            if (const_cast<StringNode*>(reinterpret_cast<const StringNode*>(a))->getString() != const_cast<StringNode*>(reinterpret_cast<const StringNode*>(b))->getString())
+              return false;
+            continue;
+
+          case VARIABLE_NODE:
+            if (const_cast<VariableNode*>(reinterpret_cast<const VariableNode*>(a))->getSymbolicVariable()->getId() != const_cast<VariableNode*>(reinterpret_cast<const VariableNode*>(b))->getSymbolicVariable()->getId())
+              return false;
+            continue;
+
+          /* A reference is hashed as the AST of its expression */
+          case REFERENCE_NODE:
+            worklist.push_back({
+              reinterpret_cast<const ReferenceNode*>(a)->getSymbolicExpression()->getAst().get(),
+              reinterpret_cast<const ReferenceNode*>(b)->getSymbolicExpression()->getAst().get()
+            });
+            continue;
+
+          default:
+            break;
+        }
+
+        /* The operands of a commutative operator are paired in the order of their hashes */
+        if (isCommutative(a->type) && a->children.size() > 1) {
+          std::vector<SharedAbstractNode> ca = a->children;
+          std::vector<SharedAbstractNode> cb = b->children;
+          std::stable_sort(ca.begin(), ca.end(), byHash);
+          std::stable_sort(cb.begin(), cb.end(), byHash);
+          for (triton::usize index = 0; index < ca.size(); index++)
+            worklist.push_back({ca[index].get(), cb[index].get()});
+          continue;
+        }
+
+        for (triton::usize index = 0; index < a->children.size(); index++)
+          worklist.push_back({a->children[index].get(), b->children[index].get()});
+      }
+
+      return true;
     }
 
 
     triton::uint512 AbstractNode::evaluate(void) const {
-      return this->eval;
+      return this->eval.get();
+    }
+
+
+    triton::uint64 AbstractNode::evaluateNarrow(void) const {
+      return this->eval.getNarrow();
+    }
+
+
+    NodeDomain AbstractNode::getDomain(void) const {
+      if (this->domain)
+        return *this->domain;
+
+      if (this->symbolized == false)
+        return NodeDomain(this->size, this->evaluate());
+
+      return NodeDomain(this->size);
     }
 
 
-    triton::uint512 AbstractNode::getHash(void) const {
-      return this->hash;
+    triton::uint128 AbstractNode::getHash(void) const {
+      return AbstractNode::hashOf(const_cast<AbstractNode*>(this)).get();
+    }
+
+
+    const triton::ast::NodeHash& AbstractNode::hashOf(AbstractNode* node) {
+      if (node->hashDirty) {
+        node->resolveHash();
+      }
+      return node->hash;
+    }
+
+
+    void AbstractNode::hashStructure(bool commutative) {
+      triton::usize count = this->children.size();
+
+      this->hash = triton::ast::NodeHash();
+      this->hash.mix(static_cast<triton::uint64>(this->type));
+      this->hash.mix(static_cast<triton::uint64>(this->size));
+      this->hash.mix(static_cast<triton::uint64>(count));
+
+      if (!commutative || count < 2) {
+        for (const auto& child : this->children)
+          this->hash.mix(AbstractNode::hashOf(child.get()));
+        return;
+      }
+
+      /* Operands of commutative operators are hashed sorted, so (bvadd a b) and (bvadd b a) have the same hash */
+      if (count == 2) {
+        const NodeHash& h0 = AbstractNode::hashOf(this->children[0].get());
+        const NodeHash& h1 = AbstractNode::hashOf(this->children[1].get());
+        this->hash.mix(h1 < h0 ? h1 : h0);
+        this->hash.mix(h1 < h0 ? h0 : h1);
+        return;
+      }
+
+      std::vector<NodeHash> hashes;
+      hashes.reserve(count);
+      for (const auto& child : this->children)
+        hashes.push_back(AbstractNode::hashOf(child.get()));
+
+      std::sort(hashes.begin(), hashes.end());
+      for (const auto& h : hashes)
+        this->hash.mix(h);
+    }
+
+
+    void AbstractNode::refreshHash(void) {
+      /* Hashes do not depend on values, a re-evaluation keeps them */
+      if (this->ctxt->isReevaluating())
+        return;
+
+      /* The structure changed, the tree may be simplified again */
+      this->simplified = 0;
+
+      if (this->ctxt->isModeEnabled(triton::modes::AST_LAZY_HASH)) {
+        this->hashDirty = true;
+        return;
+      }
+      this->initHash();
+      this->hashDirty = false;
+    }
+
+
+    void AbstractNode::refreshDomain(void) {
+      /* Domains do not depend on values of variables, a re-evaluation keeps them */
+      if (this->ctxt->isReevaluating())
+        return;
+
+      /* The domain of a tree which is not symbolized is its value */
+      if (this->symbolized == false || !this->ctxt->isModeEnabled(triton::modes::AST_ABSTRACT_DOMAIN)) {
+        this->domain.reset();
+        return;
+      }
+
+      this->domain = std::make_shared<const NodeDomain>(computeDomain(this));
+    }
+
+
+    void AbstractNode::resolveHash(void) {
+      std::stack<std::pair<AbstractNode*, bool>> worklist;
+
+      /*
+       *  We use a worklist strategy to avoid recursive calls
+       *  and so stack overflow when going through a big AST.
+       */
+      worklist.push({this, false});
+
+      while (!worklist.empty()) {
+        AbstractNode* node = worklist.top().first;
+        bool postOrder     = worklist.top().second;
+        worklist.pop();
+
+        if (node->hashDirty == false)
+          continue;
+
+        /* All dirty children have been hashed, we can hash this node */
+        if (postOrder) {
+          node->initHash();
+          node->hashDirty = false;
+          continue;
+        }
+
+        worklist.push({node, true});
+
+        for (const auto& child : node->children) {
+          if (child->hashDirty)
+            worklist.push({child.get(), false});
+        }
+
+        /* The hash of a reference is the one of its expression */
+        if (node->type == REFERENCE_NODE) {
+          AbstractNode* ast = reinterpret_cast<ReferenceNode*>(node)->getSymbolicExpression()->getAst().get();
+          if (ast->hashDirty)
+            worklist.push({ast, false});
+        }
+      }
     }
 
 
@@ -149,6 +1228,10 @@ namespace triton {
 
 
     void AbstractNode::initParents(void) {
+      /* A frozen tree never changes */
+      if (this->frozen)
+        return;
+
       auto ancestors = parentsExtraction(this->shared_from_this(), false);
       for (auto& sp : ancestors) {
         sp->init();
@@ -165,50 +1248,60 @@ namespace triton {
       std::vector<SharedAbstractNode> res;
       std::vector<AbstractNode*> toRemove;
 
-      for (auto& kv: parents) {
-        if (auto sp = kv.second.second.lock())
+      this->parents.forEach([&](NodeParents::Entry& entry) {
+        if (auto sp = entry.weak.lock())
           res.push_back(sp);
         else
-          toRemove.push_back(kv.first);
-      }
+          toRemove.push_back(entry.node);
+      });
 
-      for(auto* an: toRemove)
-        parents.erase(an);
+      for (auto* an : toRemove)
+        this->parents.erase(an);
 
       return res;
     }
 
 
     void AbstractNode::setParent(AbstractNode* p) {
-      auto it = parents.find(p);
+      /* Parents of a frozen node are not tracked, it may be shared by other threads */
+      if (this->frozen)
+        return;
 
-      if (it == parents.end()) {
-        auto A = p->shared_from_this();
-        this->parents.insert(std::make_pair(p, std::make_pair(1, WeakAbstractNode(A))));
+      NodeParents::Entry* entry = this->parents.find(p);
+
+      if (entry == nullptr) {
+        this->parents.insert(p, p->shared_from_this());
+        this->ctxt->bumpStructureVersion();
       }
       else {
-        if (it->second.second.expired()) {
-          parents.erase(it);
-          auto A = p->shared_from_this();
-          this->parents.insert(std::make_pair(p, std::make_pair(1, WeakAbstractNode(A))));
+        /* The address of a dead parent was reused */
+        if (entry->weak.expired()) {
+          entry->count = 1;
+          entry->weak  = p->shared_from_this();
+          this->ctxt->bumpStructureVersion();
         }
         // Ptr already in, add it for the counter
         else {
-          it->second.first += 1;
+          entry->count += 1;
         }
       }
     }
 
 
     void AbstractNode::removeParent(AbstractNode* p) {
-      auto it = this->parents.find(p);
+      if (this->frozen)
+        return;
+
+      NodeParents::Entry* entry = this->parents.find(p);
 
-      if (it == parents.end())
+      if (entry == nullptr)
         return;
 
-      it->second.first--;
-      if (it->second.first == 0)
-        this->parents.erase(it);
+      entry->count--;
+      if (entry->count == 0) {
+        this->parents.erase(p);
+        this->ctxt->bumpStructureVersion();
+      }
     }
 
 
@@ -223,47 +1316,109 @@ namespace triton {
     }
 
 
-    void AbstractNode::setChild(triton::uint32 index, const SharedAbstractNode& child) {
-      if (index >= this->children.size())
-        throw triton::exceptions::Ast("AbstractNode::setChild(): Invalid index.");
+    void AbstractNode::setChild(triton::uint32 index, const SharedAbstractNode& child) {
+      if (index >= this->children.size())
+        throw triton::exceptions::Ast("AbstractNode::setChild(): Invalid index.");
+
+      if (child == nullptr)
+        throw triton::exceptions::Ast("AbstractNode::setChild(): child cannot be null.");
+
+      if (this->frozen)
+        throw triton::exceptions::Ast("AbstractNode::setChild(): A frozen node cannot be modified.");
+
+      if (this->children[index] != child) {
+        /* Remove the parent of the old child */
+        this->children[index]->removeParent(this);
+
+        /* Setup the parent of the child */
+        child->setParent(this);
+
+        /* Setup the child of the parent */
+        this->children[index] = child;
+
+        /* Cached traversals of children are outdated */
+        this->ctxt->bumpChildrenVersion();
+
+        /* Init parents. A frozen child has no parent link, the node is the root of the update */
+        if (child->isFrozen())
+          this->initParents();
+        else
+          child->initParents();
+      }
+    }
+
+
+    void AbstractNode::setBitvectorSize(triton::uint32 size) {
+      this->size = size;
+    }
+
+
+    std::string AbstractNode::str(void) const {
+      std::stringstream s;
+      s << this;
+      if (!s.str().empty())
+        return s.str();
+      return nullptr;
+    }
+
+
+    /* ====== array */
+
+
+    ArrayNode::ArrayNode(triton::uint32 indexSize, const SharedAstContext& ctxt): AbstractNode(ARRAY_NODE, ctxt) {
+      this->addChild(this->ctxt->integer(indexSize));
+    }
+
+
+    void ArrayNode::init(bool withParents) {
+      if (this->children.size() < 1)
+        throw triton::exceptions::Ast("ArrayNode::init(): Must take at least one child.");
+
+      if (this->children[0]->getType() != INTEGER_NODE)
+        throw triton::exceptions::Ast("ArrayNode::init(): The size of the indexes must be a INTEGER_NODE.");
+
+      if (this->getIndexSize() == 0 || this->getIndexSize() > triton::bitsize::qword)
+        throw triton::exceptions::Ast("ArrayNode::init(): The size of the indexes must be in [1, 64].");
+
+      /* Init attributes. An array is not a bitvector, its cells are unknown */
+      this->size       = 0;
+      this->eval       = 0;
+      this->level      = 1;
+      this->symbolized = true;
 
-      if (child == nullptr)
-        throw triton::exceptions::Ast("AbstractNode::setChild(): child cannot be null.");
+      /* Init children and spread information */
+      this->children[0]->setParent(this);
+      this->level = this->children[0]->getLevel() + 1;
 
-      if (this->children[index] != child) {
-        /* Remove the parent of the old child */
-        this->children[index]->removeParent(this);
+      /* Init parents if needed */
+      if (withParents) {
+        this->initParents();
+      }
 
-        /* Setup the parent of the child */
-        child->setParent(this);
+      this->refreshDomain();
+      this->refreshHash();
+    }
 
-        /* Setup the child of the parent */
-        this->children[index] = child;
 
-        /* Init parents */
-        child->initParents();
-      }
+    triton::uint32 ArrayNode::getIndexSize(void) const {
+      return reinterpret_cast<IntegerNode*>(this->children[0].get())->getInteger().convert_to<triton::uint32>();
     }
 
 
-    void AbstractNode::setBitvectorSize(triton::uint32 size) {
-      this->size = size;
+    const ArrayMemory& ArrayNode::getMemory(void) const {
+      return this->memory;
     }
 
 
-    std::string AbstractNode::str(void) const {
-      std::stringstream s;
-      s << this;
-      if (!s.str().empty())
-        return s.str();
-      return nullptr;
+    void ArrayNode::initHash(void) {
+      this->hashStructure(false);
     }
 
 
     /* ====== assert */
 
 
-    AssertNode::AssertNode(const SharedAbstractNode& expr): AbstractNode(ASSERT_NODE, expr->getContext()) {
+    AssertNode::AssertNode(const SharedAbstractNode& expr, const SharedAstContext& ctxt): AbstractNode(ASSERT_NODE, ctxt) {
       this->addChild(expr);
     }
 
@@ -293,27 +1448,20 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void AssertNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * this->children[index]->getHash();
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(false);
     }
 
 
     /* ====== bswap */
 
 
-    BswapNode::BswapNode(const SharedAbstractNode& expr): AbstractNode(BSWAP_NODE, expr->getContext()) {
+    BswapNode::BswapNode(const SharedAbstractNode& expr, const SharedAstContext& ctxt): AbstractNode(BSWAP_NODE, ctxt) {
       this->addChild(expr);
     }
 
@@ -327,14 +1475,27 @@ namespace triton {
 
       /* Init attributes */
       this->size       = this->children[0]->getBitvectorSize();
-      this->eval       = this->children[0]->evaluate() & 0xff;
       this->level      = 1;
       this->symbolized = false;
 
       /* Init eval */
-      for (triton::uint32 index = 8 ; index != this->size ; index += triton::bitsize::byte) {
-        this->eval <<= triton::bitsize::byte;
-        this->eval |= ((this->children[0]->evaluate() >> index) & 0xff);
+      if (this->size <= triton::bitsize::qword) {
+        triton::uint64 value = this->children[0]->evaluateNarrow();
+        triton::uint64 eval  = value & 0xff;
+        for (triton::uint32 index = 8 ; index != this->size ; index += triton::bitsize::byte) {
+          eval <<= triton::bitsize::byte;
+          eval |= ((value >> index) & 0xff);
+        }
+        this->eval.setNarrow(eval);
+      }
+      else {
+        triton::uint512 value = this->children[0]->evaluate();
+        triton::uint512 eval  = value & 0xff;
+        for (triton::uint32 index = 8 ; index != this->size ; index += triton::bitsize::byte) {
+          eval <<= triton::bitsize::byte;
+          eval |= ((value >> index) & 0xff);
+        }
+        this->eval = eval;
       }
 
       /* Init children and spread information */
@@ -349,27 +1510,20 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void BswapNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * this->children[index]->getHash();
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(false);
     }
 
 
     /* ====== bvadd */
 
 
-    BvaddNode::BvaddNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2): AbstractNode(BVADD_NODE, expr1->getContext()) {
+    BvaddNode::BvaddNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt): AbstractNode(BVADD_NODE, ctxt) {
       this->addChild(expr1);
       this->addChild(expr2);
     }
@@ -379,15 +1533,30 @@ namespace triton {
       if (this->children.size() < 2)
         throw triton::exceptions::Ast("BvaddNode::init(): Must take at least two children.");
 
-      if (this->children[0]->getBitvectorSize() != this->children[1]->getBitvectorSize())
-        throw triton::exceptions::Ast("BvaddNode::init(): Must take two nodes of same size.");
+      for (triton::uint32 index = 1; index < this->children.size(); index++) {
+        if (this->children[0]->getBitvectorSize() != this->children[index]->getBitvectorSize())
+          throw triton::exceptions::Ast("BvaddNode::init(): Must take nodes of same size.");
+      }
 
       /* Init attributes */
       this->size       = this->children[0]->getBitvectorSize();
-      this->eval       = ((this->children[0]->evaluate() + this->children[1]->evaluate()) & this->getBitvectorMask());
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->size <= triton::bitsize::qword) {
+        triton::uint64 value = this->children[0]->evaluateNarrow();
+        for (triton::uint32 index = 1; index < this->children.size(); index++)
+          value += this->children[index]->evaluateNarrow();
+        this->eval.setNarrow(value & narrowMask(this->size));
+      }
+      else {
+        triton::uint512 value = this->children[0]->evaluate();
+        for (triton::uint32 index = 1; index < this->children.size(); index++)
+          value = (value + this->children[index]->evaluate()) & this->getBitvectorMask();
+        this->eval = value;
+      }
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -400,27 +1569,20 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void BvaddNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * this->children[index]->getHash();
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(true);
     }
 
 
     /* ====== bvand */
 
 
-    BvandNode::BvandNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2): AbstractNode(BVAND_NODE, expr1->getContext()) {
+    BvandNode::BvandNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt): AbstractNode(BVAND_NODE, ctxt) {
       this->addChild(expr1);
       this->addChild(expr2);
     }
@@ -430,15 +1592,30 @@ namespace triton {
       if (this->children.size() < 2)
         throw triton::exceptions::Ast("BvandNode::init(): Must take at least two children.");
 
-      if (this->children[0]->getBitvectorSize() != this->children[1]->getBitvectorSize())
-        throw triton::exceptions::Ast("BvandNode::init(): Must take two nodes of same size.");
+      for (triton::uint32 index = 1; index < this->children.size(); index++) {
+        if (this->children[0]->getBitvectorSize() != this->children[index]->getBitvectorSize())
+          throw triton::exceptions::Ast("BvandNode::init(): Must take nodes of same size.");
+      }
 
       /* Init attributes */
       this->size       = this->children[0]->getBitvectorSize();
-      this->eval       = (this->children[0]->evaluate() & this->children[1]->evaluate());
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->size <= triton::bitsize::qword) {
+        triton::uint64 value = this->children[0]->evaluateNarrow();
+        for (triton::uint32 index = 1; index < this->children.size(); index++)
+          value &= this->children[index]->evaluateNarrow();
+        this->eval.setNarrow(value);
+      }
+      else {
+        triton::uint512 value = this->children[0]->evaluate();
+        for (triton::uint32 index = 1; index < this->children.size(); index++)
+          value &= this->children[index]->evaluate();
+        this->eval = value;
+      }
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -451,27 +1628,20 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void BvandNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * this->children[index]->getHash();
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(true);
     }
 
 
     /* ====== bvashr (shift with sign extension fill) */
 
 
-    BvashrNode::BvashrNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2): AbstractNode(BVASHR_NODE, expr1->getContext()) {
+    BvashrNode::BvashrNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt): AbstractNode(BVASHR_NODE, ctxt) {
       this->addChild(expr1);
       this->addChild(expr2);
     }
@@ -489,7 +1659,12 @@ namespace triton {
         throw triton::exceptions::Ast("BvashrNode::init(): Must take two nodes of same size.");
 
       value = this->children[0]->evaluate();
-      shift = this->children[1]->evaluate().convert_to<triton::uint32>();
+
+      /* A shift of 2^32 or more is clamped to the size before being narrowed */
+      if (this->children[1]->evaluate() >= this->children[0]->getBitvectorSize())
+        shift = this->children[0]->getBitvectorSize();
+      else
+        shift = this->children[1]->evaluate().convert_to<triton::uint32>();
 
       /* Init attributes */
       this->size       = this->children[0]->getBitvectorSize();
@@ -503,8 +1678,7 @@ namespace triton {
       }
 
       if (shift >= this->size && this->children[0]->isSigned()) {
-        this->eval = -1;
-        this->eval &= this->getBitvectorMask();
+        this->eval = (-1 & this->getBitvectorMask());
       }
 
       else if (shift >= this->size && !this->children[0]->isSigned()) {
@@ -516,10 +1690,11 @@ namespace triton {
       }
 
       else {
-        this->eval = value & this->getBitvectorMask();
+        value &= this->getBitvectorMask();
         for (triton::uint32 index = 0; index < shift; index++) {
-          this->eval = (((this->eval >> 1) | mask) & this->getBitvectorMask());
+          value = (((value >> 1) | mask) & this->getBitvectorMask());
         }
+        this->eval = value;
       }
 
       /* Init children and spread information */
@@ -534,27 +1709,279 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void BvashrNode::initHash(void) {
-      triton::uint512 s = this->children.size();
+      this->hashStructure(false);
+    }
+
+
+    /* Returns the width of the lanes of a lane-wise node, which must divide the size of its operands */
+    static triton::uint32 laneWidth(const SharedAbstractNode& node, triton::uint32 size, const std::string& name) {
+      if (node->getType() != INTEGER_NODE)
+        throw triton::exceptions::Ast(name + "::init(): lane must be a INTEGER_NODE.");
+
+      triton::uint512 lane = reinterpret_cast<IntegerNode*>(node.get())->getInteger();
+      if (lane == 0 || lane > size || (size % lane) != 0)
+        throw triton::exceptions::Ast(name + "::init(): lane must divide the size of the operands.");
+
+      return lane.convert_to<triton::uint32>();
+    }
+
+
+    /* ====== bvlaneadd */
+
+
+    BvlaneaddNode::BvlaneaddNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, triton::uint32 lane, const SharedAstContext& ctxt): AbstractNode(BVLANEADD_NODE, ctxt) {
+      this->addChild(expr1);
+      this->addChild(expr2);
+      this->addChild(ctxt->integer(lane));
+    }
+
+
+    void BvlaneaddNode::init(bool withParents) {
+      triton::uint32 lane = 0;
+
+      if (this->children.size() < 3)
+        throw triton::exceptions::Ast("BvlaneaddNode::init(): Must take at least three children.");
+
+      if (this->children[0]->getBitvectorSize() != this->children[1]->getBitvectorSize())
+        throw triton::exceptions::Ast("BvlaneaddNode::init(): Must take two nodes of same size.");
+
+      lane = laneWidth(this->children[2], this->children[0]->getBitvectorSize(), "BvlaneaddNode");
+
+      /* Init attributes */
+      this->size       = this->children[0]->getBitvectorSize();
+      this->eval       = triton::utils::laneAdd(this->children[0]->evaluate(), this->children[1]->evaluate(), this->children[0]->getBitvectorSize(), lane);
+      this->level      = 1;
+      this->symbolized = false;
+
+      /* Init children and spread information */
+      for (triton::uint32 index = 0; index < this->children.size(); index++) {
+        this->children[index]->setParent(this);
+        this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
+      }
+
+      /* Init parents if needed */
+      if (withParents) {
+        this->initParents();
+      }
+
+      this->refreshDomain();
+      this->refreshHash();
+    }
+
+
+    void BvlaneaddNode::initHash(void) {
+      this->hashStructure(false);
+    }
+
+
+    /* ====== bvlaneeq */
+
+
+    BvlaneeqNode::BvlaneeqNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, triton::uint32 lane, const SharedAstContext& ctxt): AbstractNode(BVLANEEQ_NODE, ctxt) {
+      this->addChild(expr1);
+      this->addChild(expr2);
+      this->addChild(ctxt->integer(lane));
+    }
+
+
+    void BvlaneeqNode::init(bool withParents) {
+      triton::uint32 lane = 0;
+
+      if (this->children.size() < 3)
+        throw triton::exceptions::Ast("BvlaneeqNode::init(): Must take at least three children.");
+
+      if (this->children[0]->getBitvectorSize() != this->children[1]->getBitvectorSize())
+        throw triton::exceptions::Ast("BvlaneeqNode::init(): Must take two nodes of same size.");
+
+      lane = laneWidth(this->children[2], this->children[0]->getBitvectorSize(), "BvlaneeqNode");
+
+      /* Init attributes */
+      this->size       = this->children[0]->getBitvectorSize();
+      this->eval       = triton::utils::laneEq(this->children[0]->evaluate(), this->children[1]->evaluate(), this->children[0]->getBitvectorSize(), lane);
+      this->level      = 1;
+      this->symbolized = false;
+
+      /* Init children and spread information */
+      for (triton::uint32 index = 0; index < this->children.size(); index++) {
+        this->children[index]->setParent(this);
+        this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
+      }
+
+      /* Init parents if needed */
+      if (withParents) {
+        this->initParents();
+      }
+
+      this->refreshDomain();
+      this->refreshHash();
+    }
+
+
+    void BvlaneeqNode::initHash(void) {
+      this->hashStructure(false);
+    }
+
+
+    /* ====== bvlaneselect */
+
+
+    BvlaneselectNode::BvlaneselectNode(const SharedAbstractNode& mask, const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, triton::uint32 lane, const SharedAstContext& ctxt): AbstractNode(BVLANESELECT_NODE, ctxt) {
+      this->addChild(mask);
+      this->addChild(expr1);
+      this->addChild(expr2);
+      this->addChild(ctxt->integer(lane));
+    }
+
+
+    void BvlaneselectNode::init(bool withParents) {
+      triton::uint32 lane = 0;
+
+      if (this->children.size() < 4)
+        throw triton::exceptions::Ast("BvlaneselectNode::init(): Must take at least four children.");
+
+      if (this->children[0]->getBitvectorSize() != this->children[1]->getBitvectorSize() || this->children[1]->getBitvectorSize() != this->children[2]->getBitvectorSize())
+        throw triton::exceptions::Ast("BvlaneselectNode::init(): Must take three nodes of same size.");
+
+      lane = laneWidth(this->children[3], this->children[0]->getBitvectorSize(), "BvlaneselectNode");
+
+      /* Init attributes */
+      this->size       = this->children[0]->getBitvectorSize();
+      this->eval       = triton::utils::laneSelect(this->children[0]->evaluate(), this->children[1]->evaluate(), this->children[2]->evaluate(), this->children[0]->getBitvectorSize(), lane);
+      this->level      = 1;
+      this->symbolized = false;
+
+      /* Init children and spread information */
+      for (triton::uint32 index = 0; index < this->children.size(); index++) {
+        this->children[index]->setParent(this);
+        this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
+      }
+
+      /* Init parents if needed */
+      if (withParents) {
+        this->initParents();
+      }
+
+      this->refreshDomain();
+      this->refreshHash();
+    }
+
+
+    void BvlaneselectNode::initHash(void) {
+      this->hashStructure(false);
+    }
+
+
+    /* ====== bvlanesgt */
+
+
+    BvlanesgtNode::BvlanesgtNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, triton::uint32 lane, const SharedAstContext& ctxt): AbstractNode(BVLANESGT_NODE, ctxt) {
+      this->addChild(expr1);
+      this->addChild(expr2);
+      this->addChild(ctxt->integer(lane));
+    }
+
+
+    void BvlanesgtNode::init(bool withParents) {
+      triton::uint32 lane = 0;
+
+      if (this->children.size() < 3)
+        throw triton::exceptions::Ast("BvlanesgtNode::init(): Must take at least three children.");
+
+      if (this->children[0]->getBitvectorSize() != this->children[1]->getBitvectorSize())
+        throw triton::exceptions::Ast("BvlanesgtNode::init(): Must take two nodes of same size.");
+
+      lane = laneWidth(this->children[2], this->children[0]->getBitvectorSize(), "BvlanesgtNode");
+
+      /* Init attributes */
+      this->size       = this->children[0]->getBitvectorSize();
+      this->eval       = triton::utils::laneSgt(this->children[0]->evaluate(), this->children[1]->evaluate(), this->children[0]->getBitvectorSize(), lane);
+      this->level      = 1;
+      this->symbolized = false;
+
+      /* Init children and spread information */
+      for (triton::uint32 index = 0; index < this->children.size(); index++) {
+        this->children[index]->setParent(this);
+        this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
+      }
+
+      /* Init parents if needed */
+      if (withParents) {
+        this->initParents();
+      }
+
+      this->refreshDomain();
+      this->refreshHash();
+    }
+
+
+    void BvlanesgtNode::initHash(void) {
+      this->hashStructure(false);
+    }
+
+
+    /* ====== bvlanesub */
+
+
+    BvlanesubNode::BvlanesubNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, triton::uint32 lane, const SharedAstContext& ctxt): AbstractNode(BVLANESUB_NODE, ctxt) {
+      this->addChild(expr1);
+      this->addChild(expr2);
+      this->addChild(ctxt->integer(lane));
+    }
+
+
+    void BvlanesubNode::init(bool withParents) {
+      triton::uint32 lane = 0;
+
+      if (this->children.size() < 3)
+        throw triton::exceptions::Ast("BvlanesubNode::init(): Must take at least three children.");
+
+      if (this->children[0]->getBitvectorSize() != this->children[1]->getBitvectorSize())
+        throw triton::exceptions::Ast("BvlanesubNode::init(): Must take two nodes of same size.");
+
+      lane = laneWidth(this->children[2], this->children[0]->getBitvectorSize(), "BvlanesubNode");
+
+      /* Init attributes */
+      this->size       = this->children[0]->getBitvectorSize();
+      this->eval       = triton::utils::laneSub(this->children[0]->evaluate(), this->children[1]->evaluate(), this->children[0]->getBitvectorSize(), lane);
+      this->level      = 1;
+      this->symbolized = false;
+
+      /* Init children and spread information */
+      for (triton::uint32 index = 0; index < this->children.size(); index++) {
+        this->children[index]->setParent(this);
+        this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
+      }
+
+      /* Init parents if needed */
+      if (withParents) {
+        this->initParents();
+      }
+
+      this->refreshDomain();
+      this->refreshHash();
+    }
 
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * triton::ast::hash2n(this->children[index]->getHash(), index+1);
-      }
 
-      this->hash = triton::ast::rotl(this->hash, this->level);
+    void BvlanesubNode::initHash(void) {
+      this->hashStructure(false);
     }
 
 
     /* ====== bvlshr (shift with zero filled) */
 
 
-    BvlshrNode::BvlshrNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2): AbstractNode(BVLSHR_NODE, expr1->getContext()) {
+    BvlshrNode::BvlshrNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt): AbstractNode(BVLSHR_NODE, ctxt) {
       this->addChild(expr1);
       this->addChild(expr2);
     }
@@ -569,10 +1996,21 @@ namespace triton {
 
       /* Init attributes */
       this->size       = this->children[0]->getBitvectorSize();
-      this->eval       = (this->children[0]->evaluate() >> this->children[1]->evaluate().convert_to<triton::uint32>());
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->size <= triton::bitsize::qword) {
+        triton::uint64 shift = this->children[1]->evaluateNarrow();
+        this->eval.setNarrow((shift >= this->size) ? 0 : (this->children[0]->evaluateNarrow() >> shift));
+      }
+      else if (this->children[1]->evaluate() >= this->size) {
+        this->eval = 0;
+      }
+      else {
+        this->eval = (this->children[0]->evaluate() >> this->children[1]->evaluate().convert_to<triton::uint32>());
+      }
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -585,27 +2023,20 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void BvlshrNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * triton::ast::hash2n(this->children[index]->getHash(), index+1);
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(false);
     }
 
 
     /* ====== bvmul */
 
 
-    BvmulNode::BvmulNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2): AbstractNode(BVMUL_NODE, expr1->getContext()) {
+    BvmulNode::BvmulNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt): AbstractNode(BVMUL_NODE, ctxt) {
       this->addChild(expr1);
       this->addChild(expr2);
     }
@@ -620,10 +2051,15 @@ namespace triton {
 
       /* Init attributes */
       this->size       = this->children[0]->getBitvectorSize();
-      this->eval       = ((this->children[0]->evaluate() * this->children[1]->evaluate()) & this->getBitvectorMask());
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->size <= triton::bitsize::qword)
+        this->eval.setNarrow((this->children[0]->evaluateNarrow() * this->children[1]->evaluateNarrow()) & narrowMask(this->size));
+      else
+        this->eval = ((this->children[0]->evaluate() * this->children[1]->evaluate()) & this->getBitvectorMask());
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -636,27 +2072,20 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void BvmulNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * this->children[index]->getHash();
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(true);
     }
 
 
     /* ====== bvnand */
 
 
-    BvnandNode::BvnandNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2): AbstractNode(BVNAND_NODE, expr1->getContext()) {
+    BvnandNode::BvnandNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt): AbstractNode(BVNAND_NODE, ctxt) {
       this->addChild(expr1);
       this->addChild(expr2);
     }
@@ -687,27 +2116,20 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void BvnandNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * this->children[index]->getHash();
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(true);
     }
 
 
     /* ====== bvneg */
 
 
-    BvnegNode::BvnegNode(const SharedAbstractNode& expr): AbstractNode(BVNEG_NODE, expr->getContext()) {
+    BvnegNode::BvnegNode(const SharedAbstractNode& expr, const SharedAstContext& ctxt): AbstractNode(BVNEG_NODE, ctxt) {
       this->addChild(expr);
     }
 
@@ -718,10 +2140,15 @@ namespace triton {
 
       /* Init attributes */
       this->size       = this->children[0]->getBitvectorSize();
-      this->eval       = ((-(this->children[0]->evaluate().convert_to<triton::sint512>())).convert_to<triton::uint512>() & this->getBitvectorMask());
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->size <= triton::bitsize::qword)
+        this->eval.setNarrow((0 - this->children[0]->evaluateNarrow()) & narrowMask(this->size));
+      else
+        this->eval = ((-(this->children[0]->evaluate().convert_to<triton::sint512>())).convert_to<triton::uint512>() & this->getBitvectorMask());
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -734,27 +2161,20 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void BvnegNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * this->children[index]->getHash();
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(false);
     }
 
 
     /* ====== bvnor */
 
 
-    BvnorNode::BvnorNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2): AbstractNode(BVNOR_NODE, expr1->getContext()) {
+    BvnorNode::BvnorNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt): AbstractNode(BVNOR_NODE, ctxt) {
       this->addChild(expr1);
       this->addChild(expr2);
     }
@@ -785,27 +2205,20 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void BvnorNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * this->children[index]->getHash();
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(true);
     }
 
 
     /* ====== bvnot */
 
 
-    BvnotNode::BvnotNode(const SharedAbstractNode& expr): AbstractNode(BVNOT_NODE, expr->getContext()) {
+    BvnotNode::BvnotNode(const SharedAbstractNode& expr, const SharedAstContext& ctxt): AbstractNode(BVNOT_NODE, ctxt) {
       this->addChild(expr);
     }
 
@@ -816,10 +2229,15 @@ namespace triton {
 
       /* Init attributes */
       this->size       = this->children[0]->getBitvectorSize();
-      this->eval       = (~this->children[0]->evaluate() & this->getBitvectorMask());
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->size <= triton::bitsize::qword)
+        this->eval.setNarrow(~this->children[0]->evaluateNarrow() & narrowMask(this->size));
+      else
+        this->eval = (~this->children[0]->evaluate() & this->getBitvectorMask());
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -832,27 +2250,20 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void BvnotNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * this->children[index]->getHash();
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(false);
     }
 
 
     /* ====== bvor */
 
 
-    BvorNode::BvorNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2): AbstractNode(BVOR_NODE, expr1->getContext()) {
+    BvorNode::BvorNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt): AbstractNode(BVOR_NODE, ctxt) {
       this->addChild(expr1);
       this->addChild(expr2);
     }
@@ -862,15 +2273,30 @@ namespace triton {
       if (this->children.size() < 2)
         throw triton::exceptions::Ast("BvorNode::init(): Must take at least two children.");
 
-      if (this->children[0]->getBitvectorSize() != this->children[0]->getBitvectorSize())
-        throw triton::exceptions::Ast("BvorNode::init(): Must take two nodes of same size.");
+      for (triton::uint32 index = 1; index < this->children.size(); index++) {
+        if (this->children[0]->getBitvectorSize() != this->children[index]->getBitvectorSize())
+          throw triton::exceptions::Ast("BvorNode::init(): Must take nodes of same size.");
+      }
 
       /* Init attributes */
       this->size       = this->children[0]->getBitvectorSize();
-      this->eval       = (this->children[0]->evaluate() | this->children[1]->evaluate());
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->size <= triton::bitsize::qword) {
+        triton::uint64 value = this->children[0]->evaluateNarrow();
+        for (triton::uint32 index = 1; index < this->children.size(); index++)
+          value |= this->children[index]->evaluateNarrow();
+        this->eval.setNarrow(value);
+      }
+      else {
+        triton::uint512 value = this->children[0]->evaluate();
+        for (triton::uint32 index = 1; index < this->children.size(); index++)
+          value |= this->children[index]->evaluate();
+        this->eval = value;
+      }
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -883,31 +2309,114 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void BvorNode::initHash(void) {
-      triton::uint512 s = this->children.size();
+      this->hashStructure(true);
+    }
+
+
+    /* ====== bvparity */
+
+
+    BvparityNode::BvparityNode(const SharedAbstractNode& expr, const SharedAstContext& ctxt): AbstractNode(BVPARITY_NODE, ctxt) {
+      this->addChild(expr);
+    }
+
 
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
+    void BvparityNode::init(bool withParents) {
+      if (this->children.size() < 1)
+        throw triton::exceptions::Ast("BvparityNode::init(): Must take at least one child.");
+
+      /* Init attributes */
+      this->size       = 1;
+      this->level      = 1;
+      this->symbolized = false;
+
+      /* Init eval */
+      if (this->children[0]->getBitvectorSize() <= triton::bitsize::qword)
+        this->eval.setNarrow(triton::utils::popcount(this->children[0]->evaluateNarrow()) & 1);
+      else
+        this->eval.setNarrow(triton::utils::popcount(this->children[0]->evaluate()) & 1);
+
+      /* Init children and spread information */
+      for (triton::uint32 index = 0; index < this->children.size(); index++) {
+        this->children[index]->setParent(this);
+        this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
+      }
+
+      /* Init parents if needed */
+      if (withParents) {
+        this->initParents();
+      }
+
+      this->refreshDomain();
+      this->refreshHash();
+    }
+
+
+    void BvparityNode::initHash(void) {
+      this->hashStructure(false);
+    }
+
+
+    /* ====== bvpopcount */
+
+
+    BvpopcountNode::BvpopcountNode(const SharedAbstractNode& expr, const SharedAstContext& ctxt): AbstractNode(BVPOPCOUNT_NODE, ctxt) {
+      this->addChild(expr);
+    }
+
+
+    void BvpopcountNode::init(bool withParents) {
+      if (this->children.size() < 1)
+        throw triton::exceptions::Ast("BvpopcountNode::init(): Must take at least one child.");
+
+      /* Init attributes */
+      this->size       = this->children[0]->getBitvectorSize();
+      this->level      = 1;
+      this->symbolized = false;
+
+      /* Init eval */
+      if (this->size <= triton::bitsize::qword)
+        this->eval.setNarrow(triton::utils::popcount(this->children[0]->evaluateNarrow()));
+      else
+        this->eval = triton::utils::popcount(this->children[0]->evaluate());
+
+      /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * this->children[index]->getHash();
+        this->children[index]->setParent(this);
+        this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
       }
 
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      /* Init parents if needed */
+      if (withParents) {
+        this->initParents();
+      }
+
+      this->refreshDomain();
+      this->refreshHash();
+    }
+
+
+    void BvpopcountNode::initHash(void) {
+      this->hashStructure(false);
     }
 
 
     /* ====== bvrol */
 
 
-    BvrolNode::BvrolNode(const SharedAbstractNode& expr, triton::uint32 rot): BvrolNode(expr, expr->getContext()->integer(rot)) {
+    BvrolNode::BvrolNode(const SharedAbstractNode& expr, triton::uint32 rot, const SharedAstContext& ctxt): BvrolNode(expr, ctxt->integer(rot), ctxt) {
     }
 
 
-    BvrolNode::BvrolNode(const SharedAbstractNode& expr, const SharedAbstractNode& rot): AbstractNode(BVROL_NODE, expr->getContext()) {
+    BvrolNode::BvrolNode(const SharedAbstractNode& expr, const SharedAbstractNode& rot, const SharedAstContext& ctxt): AbstractNode(BVROL_NODE, ctxt) {
       this->addChild(expr);
       this->addChild(rot);
     }
@@ -923,12 +2432,12 @@ namespace triton {
       if (this->children[1]->getType() != INTEGER_NODE)
         throw triton::exceptions::Ast("BvrolNode::init(): rot must be a INTEGER_NODE.");
 
-      rot   = reinterpret_cast<IntegerNode*>(this->children[1].get())->getInteger().convert_to<triton::uint32>();
+      /* The amount is reduced before being narrowed, it may not fit on 32 bits */
+      rot   = (reinterpret_cast<IntegerNode*>(this->children[1].get())->getInteger() % this->children[0]->getBitvectorSize()).convert_to<triton::uint32>();
       value = this->children[0]->evaluate();
 
       /* Init attributes */
       this->size       = this->children[0]->getBitvectorSize();
-      rot             %= this->size;
       this->eval       = (((value << rot) | (value >> (this->size - rot))) & this->getBitvectorMask());
       this->level      = 1;
       this->symbolized = false;
@@ -945,31 +2454,24 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void BvrolNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * triton::ast::hash2n(this->children[index]->getHash(), index+1);
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(false);
     }
 
 
     /* ====== bvror */
 
 
-    BvrorNode::BvrorNode(const SharedAbstractNode& expr, triton::uint32 rot): BvrorNode(expr, expr->getContext()->integer(rot)) {
+    BvrorNode::BvrorNode(const SharedAbstractNode& expr, triton::uint32 rot, const SharedAstContext& ctxt): BvrorNode(expr, ctxt->integer(rot), ctxt) {
     }
 
 
-    BvrorNode::BvrorNode(const SharedAbstractNode& expr, const SharedAbstractNode& rot): AbstractNode(BVROR_NODE, expr->getContext()) {
+    BvrorNode::BvrorNode(const SharedAbstractNode& expr, const SharedAbstractNode& rot, const SharedAstContext& ctxt): AbstractNode(BVROR_NODE, ctxt) {
       this->addChild(expr);
       this->addChild(rot);
     }
@@ -985,12 +2487,12 @@ namespace triton {
       if (this->children[1]->getType() != INTEGER_NODE)
         throw triton::exceptions::Ast("BvrorNode::init(): rot must be a INTEGER_NODE.");
 
-      rot   = reinterpret_cast<IntegerNode*>(this->children[1].get())->getInteger().convert_to<triton::uint32>();
+      /* The amount is reduced before being narrowed, it may not fit on 32 bits */
+      rot   = (reinterpret_cast<IntegerNode*>(this->children[1].get())->getInteger() % this->children[0]->getBitvectorSize()).convert_to<triton::uint32>();
       value = this->children[0]->evaluate();
 
       /* Init attributes */
       this->size       = this->children[0]->getBitvectorSize();
-      rot             %= this->size;
       this->eval       = (((value >> rot) | (value << (this->size - rot))) & this->getBitvectorMask());
       this->level      = 1;
       this->symbolized = false;
@@ -1007,27 +2509,20 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void BvrorNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * triton::ast::hash2n(this->children[index]->getHash(), index+1);
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(false);
     }
 
 
     /* ====== bvsdiv */
 
 
-    BvsdivNode::BvsdivNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2): AbstractNode(BVSDIV_NODE, expr1->getContext()) {
+    BvsdivNode::BvsdivNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt): AbstractNode(BVSDIV_NODE, ctxt) {
       this->addChild(expr1);
       this->addChild(expr2);
     }
@@ -1053,8 +2548,7 @@ namespace triton {
       this->symbolized = false;
 
       if (op2Signed == 0) {
-        this->eval = (op1Signed < 0 ? 1 : -1);
-        this->eval &= this->getBitvectorMask();
+        this->eval = ((op1Signed < 0 ? 1 : -1) & this->getBitvectorMask());
       }
       else
         this->eval = ((op1Signed / op2Signed).convert_to<triton::uint512>() & this->getBitvectorMask());
@@ -1071,27 +2565,20 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void BvsdivNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * triton::ast::hash2n(this->children[index]->getHash(), index+1);
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(false);
     }
 
 
     /* ====== bvsge */
 
 
-    BvsgeNode::BvsgeNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2): AbstractNode(BVSGE_NODE, expr1->getContext()) {
+    BvsgeNode::BvsgeNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt): AbstractNode(BVSGE_NODE, ctxt) {
       this->addChild(expr1);
       this->addChild(expr2);
     }
@@ -1129,27 +2616,20 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void BvsgeNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * triton::ast::hash2n(this->children[index]->getHash(), index+1);
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(false);
     }
 
 
     /* ====== bvsgt */
 
 
-    BvsgtNode::BvsgtNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2): AbstractNode(BVSGT_NODE, expr1->getContext()) {
+    BvsgtNode::BvsgtNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt): AbstractNode(BVSGT_NODE, ctxt) {
       this->addChild(expr1);
       this->addChild(expr2);
     }
@@ -1187,27 +2667,20 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void BvsgtNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * triton::ast::hash2n(this->children[index]->getHash(), index+1);
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(false);
     }
 
 
     /* ====== bvshl */
 
 
-    BvshlNode::BvshlNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2): AbstractNode(BVSHL_NODE, expr1->getContext()) {
+    BvshlNode::BvshlNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt): AbstractNode(BVSHL_NODE, ctxt) {
       this->addChild(expr1);
       this->addChild(expr2);
     }
@@ -1222,10 +2695,21 @@ namespace triton {
 
       /* Init attributes */
       this->size       = this->children[0]->getBitvectorSize();
-      this->eval       = ((this->children[0]->evaluate() << this->children[1]->evaluate().convert_to<triton::uint32>()) & this->getBitvectorMask());
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->size <= triton::bitsize::qword) {
+        triton::uint64 shift = this->children[1]->evaluateNarrow();
+        this->eval.setNarrow((shift >= this->size) ? 0 : ((this->children[0]->evaluateNarrow() << shift) & narrowMask(this->size)));
+      }
+      else if (this->children[1]->evaluate() >= this->size) {
+        this->eval = 0;
+      }
+      else {
+        this->eval = ((this->children[0]->evaluate() << this->children[1]->evaluate().convert_to<triton::uint32>()) & this->getBitvectorMask());
+      }
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -1238,27 +2722,20 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void BvshlNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * triton::ast::hash2n(this->children[index]->getHash(), index+1);
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(false);
     }
 
 
     /* ====== bvsle */
 
 
-    BvsleNode::BvsleNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2): AbstractNode(BVSLE_NODE, expr1->getContext()) {
+    BvsleNode::BvsleNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt): AbstractNode(BVSLE_NODE, ctxt) {
       this->addChild(expr1);
       this->addChild(expr2);
     }
@@ -1296,27 +2773,20 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void BvsleNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * triton::ast::hash2n(this->children[index]->getHash(), index+1);
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(false);
     }
 
 
     /* ====== bvslt */
 
 
-    BvsltNode::BvsltNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2): AbstractNode(BVSLT_NODE, expr1->getContext()) {
+    BvsltNode::BvsltNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt): AbstractNode(BVSLT_NODE, ctxt) {
       this->addChild(expr1);
       this->addChild(expr2);
     }
@@ -1354,27 +2824,20 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void BvsltNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * triton::ast::hash2n(this->children[index]->getHash(), index+1);
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(false);
     }
 
 
     /* ====== bvsmod - 2's complement signed remainder (sign follows divisor) */
 
 
-    BvsmodNode::BvsmodNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2): AbstractNode(BVSMOD_NODE, expr1->getContext()) {
+    BvsmodNode::BvsmodNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt): AbstractNode(BVSMOD_NODE, ctxt) {
       this->addChild(expr1);
       this->addChild(expr2);
     }
@@ -1416,27 +2879,20 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void BvsmodNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * triton::ast::hash2n(this->children[index]->getHash(), index+1);
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(false);
     }
 
 
     /* ====== bvsrem - 2's complement signed remainder (sign follows dividend) */
 
 
-    BvsremNode::BvsremNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2): AbstractNode(BVSREM_NODE, expr1->getContext()) {
+    BvsremNode::BvsremNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt): AbstractNode(BVSREM_NODE, ctxt) {
       this->addChild(expr1);
       this->addChild(expr2);
     }
@@ -1478,27 +2934,20 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void BvsremNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * triton::ast::hash2n(this->children[index]->getHash(), index+1);
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(false);
     }
 
 
     /* ====== bvsub */
 
 
-    BvsubNode::BvsubNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2): AbstractNode(BVSUB_NODE, expr1->getContext()) {
+    BvsubNode::BvsubNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt): AbstractNode(BVSUB_NODE, ctxt) {
       this->addChild(expr1);
       this->addChild(expr2);
     }
@@ -1513,10 +2962,15 @@ namespace triton {
 
       /* Init attributes */
       this->size       = this->children[0]->getBitvectorSize();
-      this->eval       = ((this->children[0]->evaluate() - this->children[1]->evaluate()) & this->getBitvectorMask());
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->size <= triton::bitsize::qword)
+        this->eval.setNarrow((this->children[0]->evaluateNarrow() - this->children[1]->evaluateNarrow()) & narrowMask(this->size));
+      else
+        this->eval = ((this->children[0]->evaluate() - this->children[1]->evaluate()) & this->getBitvectorMask());
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -1529,27 +2983,20 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void BvsubNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * triton::ast::hash2n(this->children[index]->getHash(), index+1);
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(false);
     }
 
 
     /* ====== bvudiv */
 
 
-    BvudivNode::BvudivNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2): AbstractNode(BVUDIV_NODE, expr1->getContext()) {
+    BvudivNode::BvudivNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt): AbstractNode(BVUDIV_NODE, ctxt) {
       this->addChild(expr1);
       this->addChild(expr2);
     }
@@ -1584,27 +3031,20 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void BvudivNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * triton::ast::hash2n(this->children[index]->getHash(), index+1);
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(false);
     }
 
 
     /* ====== bvuge */
 
 
-    BvugeNode::BvugeNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2): AbstractNode(BVUGE_NODE, expr1->getContext()) {
+    BvugeNode::BvugeNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt): AbstractNode(BVUGE_NODE, ctxt) {
       this->addChild(expr1);
       this->addChild(expr2);
     }
@@ -1619,10 +3059,15 @@ namespace triton {
 
       /* Init attributes */
       this->size       = 1;
-      this->eval       = (this->children[0]->evaluate() >= this->children[1]->evaluate());
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->children[0]->getBitvectorSize() <= triton::bitsize::qword)
+        this->eval.setNarrow(this->children[0]->evaluateNarrow() >= this->children[1]->evaluateNarrow());
+      else
+        this->eval = (this->children[0]->evaluate() >= this->children[1]->evaluate());
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -1635,27 +3080,20 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void BvugeNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * triton::ast::hash2n(this->children[index]->getHash(), index+1);
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(false);
     }
 
 
     /* ====== bvugt */
 
 
-    BvugtNode::BvugtNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2): AbstractNode(BVUGT_NODE, expr1->getContext()) {
+    BvugtNode::BvugtNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt): AbstractNode(BVUGT_NODE, ctxt) {
       this->addChild(expr1);
       this->addChild(expr2);
     }
@@ -1670,10 +3108,15 @@ namespace triton {
 
       /* Init attributes */
       this->size       = 1;
-      this->eval       = (this->children[0]->evaluate() > this->children[1]->evaluate());
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->children[0]->getBitvectorSize() <= triton::bitsize::qword)
+        this->eval.setNarrow(this->children[0]->evaluateNarrow() > this->children[1]->evaluateNarrow());
+      else
+        this->eval = (this->children[0]->evaluate() > this->children[1]->evaluate());
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -1686,27 +3129,20 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void BvugtNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * triton::ast::hash2n(this->children[index]->getHash(), index+1);
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(false);
     }
 
 
     /* ====== bvule */
 
 
-    BvuleNode::BvuleNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2): AbstractNode(BVULE_NODE, expr1->getContext()) {
+    BvuleNode::BvuleNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt): AbstractNode(BVULE_NODE, ctxt) {
       this->addChild(expr1);
       this->addChild(expr2);
     }
@@ -1721,10 +3157,15 @@ namespace triton {
 
       /* Init attributes */
       this->size       = 1;
-      this->eval       = (this->children[0]->evaluate() <= this->children[1]->evaluate());
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->children[0]->getBitvectorSize() <= triton::bitsize::qword)
+        this->eval.setNarrow(this->children[0]->evaluateNarrow() <= this->children[1]->evaluateNarrow());
+      else
+        this->eval = (this->children[0]->evaluate() <= this->children[1]->evaluate());
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -1737,27 +3178,20 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void BvuleNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * triton::ast::hash2n(this->children[index]->getHash(), index+1);
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(false);
     }
 
 
     /* ====== bvult */
 
 
-    BvultNode::BvultNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2): AbstractNode(BVULT_NODE, expr1->getContext()) {
+    BvultNode::BvultNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt): AbstractNode(BVULT_NODE, ctxt) {
       this->addChild(expr1);
       this->addChild(expr2);
     }
@@ -1772,10 +3206,15 @@ namespace triton {
 
       /* Init attributes */
       this->size       = 1;
-      this->eval       = (this->children[0]->evaluate() < this->children[1]->evaluate());
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->children[0]->getBitvectorSize() <= triton::bitsize::qword)
+        this->eval.setNarrow(this->children[0]->evaluateNarrow() < this->children[1]->evaluateNarrow());
+      else
+        this->eval = (this->children[0]->evaluate() < this->children[1]->evaluate());
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -1788,27 +3227,20 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void BvultNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * triton::ast::hash2n(this->children[index]->getHash(), index+1);
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(false);
     }
 
 
     /* ====== bvurem */
 
 
-    BvuremNode::BvuremNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2): AbstractNode(BVUREM_NODE, expr1->getContext()) {
+    BvuremNode::BvuremNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt): AbstractNode(BVUREM_NODE, ctxt) {
       this->addChild(expr1);
       this->addChild(expr2);
     }
@@ -1843,27 +3275,20 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void BvuremNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * triton::ast::hash2n(this->children[index]->getHash(), index+1);
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(false);
     }
 
 
     /* ====== bvxnor */
 
 
-    BvxnorNode::BvxnorNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2): AbstractNode(BVXNOR_NODE, expr1->getContext()) {
+    BvxnorNode::BvxnorNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt): AbstractNode(BVXNOR_NODE, ctxt) {
       this->addChild(expr1);
       this->addChild(expr2);
     }
@@ -1894,27 +3319,20 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void BvxnorNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * this->children[index]->getHash();
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(true);
     }
 
 
     /* ====== bvxor */
 
 
-    BvxorNode::BvxorNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2): AbstractNode(BVXOR_NODE, expr1->getContext()) {
+    BvxorNode::BvxorNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt): AbstractNode(BVXOR_NODE, ctxt) {
       this->addChild(expr1);
       this->addChild(expr2);
     }
@@ -1924,15 +3342,30 @@ namespace triton {
       if (this->children.size() < 2)
         throw triton::exceptions::Ast("BvxorNode::init(): Must take at least two children.");
 
-      if (this->children[0]->getBitvectorSize() != this->children[1]->getBitvectorSize())
-        throw triton::exceptions::Ast("BvxorNode::init(): Must take two nodes of same size.");
+      for (triton::uint32 index = 1; index < this->children.size(); index++) {
+        if (this->children[0]->getBitvectorSize() != this->children[index]->getBitvectorSize())
+          throw triton::exceptions::Ast("BvxorNode::init(): Must take nodes of same size.");
+      }
 
       /* Init attributes */
       this->size       = this->children[0]->getBitvectorSize();
-      this->eval       = (this->children[0]->evaluate() ^ this->children[1]->evaluate());
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->size <= triton::bitsize::qword) {
+        triton::uint64 value = this->children[0]->evaluateNarrow();
+        for (triton::uint32 index = 1; index < this->children.size(); index++)
+          value ^= this->children[index]->evaluateNarrow();
+        this->eval.setNarrow(value);
+      }
+      else {
+        triton::uint512 value = this->children[0]->evaluate();
+        for (triton::uint32 index = 1; index < this->children.size(); index++)
+          value ^= this->children[index]->evaluate();
+        this->eval = value;
+      }
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -1945,20 +3378,13 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void BvxorNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * this->children[index]->getHash();
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(true);
     }
 
 
@@ -2009,20 +3435,13 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void BvNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * triton::ast::hash2n(this->children[index]->getHash(), index+1);
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(false);
     }
 
 
@@ -2051,27 +3470,20 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void CompoundNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * triton::ast::hash2n(this->children[index]->getHash(), index+1);
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(false);
     }
 
 
     /* ====== concat */
 
 
-    ConcatNode::ConcatNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2): AbstractNode(CONCAT_NODE, expr1->getContext()) {
+    ConcatNode::ConcatNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt): AbstractNode(CONCAT_NODE, ctxt) {
       this->addChild(expr1);
       this->addChild(expr2);
     }
@@ -2092,9 +3504,19 @@ namespace triton {
       if (this->size > triton::bitsize::max_supported)
         throw triton::exceptions::Ast("ConcatNode::init(): Size cannot be greater than triton::bitsize::max_supported.");
 
-      this->eval = this->children[0]->evaluate();
-      for (triton::uint32 index = 0; index < this->children.size()-1; index++)
-        this->eval = ((this->eval << this->children[index+1]->getBitvectorSize()) | this->children[index+1]->evaluate());
+      /* Init eval */
+      if (this->size <= triton::bitsize::qword) {
+        triton::uint64 eval = this->children[0]->evaluateNarrow();
+        for (triton::uint32 index = 0; index < this->children.size()-1; index++)
+          eval = ((eval << this->children[index+1]->getBitvectorSize()) | this->children[index+1]->evaluateNarrow());
+        this->eval.setNarrow(eval);
+      }
+      else {
+        triton::uint512 eval = this->children[0]->evaluate();
+        for (triton::uint32 index = 0; index < this->children.size()-1; index++)
+          eval = ((eval << this->children[index+1]->getBitvectorSize()) | this->children[index+1]->evaluate());
+        this->eval = eval;
+      }
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -2108,27 +3530,20 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void ConcatNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * triton::ast::hash2n(this->children[index]->getHash(), index+1);
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(false);
     }
 
 
     /* ====== Declare */
 
 
-    DeclareNode::DeclareNode(const SharedAbstractNode& var): AbstractNode(DECLARE_NODE, var->getContext()) {
+    DeclareNode::DeclareNode(const SharedAbstractNode& var, const SharedAstContext& ctxt): AbstractNode(DECLARE_NODE, ctxt) {
       this->addChild(var);
     }
 
@@ -2158,27 +3573,20 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void DeclareNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * triton::ast::hash2n(this->children[index]->getHash(), index+1);
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(false);
     }
 
 
     /* ====== Distinct node */
 
 
-    DistinctNode::DistinctNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2): AbstractNode(DISTINCT_NODE, expr1->getContext()) {
+    DistinctNode::DistinctNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt): AbstractNode(DISTINCT_NODE, ctxt) {
       this->addChild(expr1);
       this->addChild(expr2);
     }
@@ -2193,10 +3601,15 @@ namespace triton {
 
       /* Init attributes */
       this->size       = 1;
-      this->eval       = (this->children[0]->evaluate() != this->children[1]->evaluate());
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->children[0]->getBitvectorSize() <= triton::bitsize::qword)
+        this->eval.setNarrow(this->children[0]->evaluateNarrow() != this->children[1]->evaluateNarrow());
+      else
+        this->eval = (this->children[0]->evaluate() != this->children[1]->evaluate());
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -2209,27 +3622,20 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void DistinctNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * this->children[index]->getHash();
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(true);
     }
 
 
     /* ====== equal */
 
 
-    EqualNode::EqualNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2): AbstractNode(EQUAL_NODE, expr1->getContext()) {
+    EqualNode::EqualNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt): AbstractNode(EQUAL_NODE, ctxt) {
       this->addChild(expr1);
       this->addChild(expr2);
     }
@@ -2244,10 +3650,15 @@ namespace triton {
 
       /* Init attributes */
       this->size       = 1;
-      this->eval       = (this->children[0]->evaluate() == this->children[1]->evaluate());
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->children[0]->getBitvectorSize() <= triton::bitsize::qword)
+        this->eval.setNarrow(this->children[0]->evaluateNarrow() == this->children[1]->evaluateNarrow());
+      else
+        this->eval = (this->children[0]->evaluate() == this->children[1]->evaluate());
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -2260,27 +3671,20 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void EqualNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * this->children[index]->getHash();
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(true);
     }
 
 
     /* ====== extract */
 
 
-    ExtractNode::ExtractNode(triton::uint32 high, triton::uint32 low, const SharedAbstractNode& expr): AbstractNode(EXTRACT_NODE, expr->getContext()) {
+    ExtractNode::ExtractNode(triton::uint32 high, triton::uint32 low, const SharedAbstractNode& expr, const SharedAstContext& ctxt): AbstractNode(EXTRACT_NODE, ctxt) {
       this->addChild(this->ctxt->integer(high));
       this->addChild(this->ctxt->integer(low));
       this->addChild(expr);
@@ -2305,10 +3709,15 @@ namespace triton {
 
       /* Init attributes */
       this->size       = ((high - low) + 1);
-      this->eval       = ((this->children[2]->evaluate() >> low) & this->getBitvectorMask());
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (high < this->children[2]->getBitvectorSize() && this->children[2]->getBitvectorSize() <= triton::bitsize::qword)
+        this->eval.setNarrow((this->children[2]->evaluateNarrow() >> low) & narrowMask(this->size));
+      else
+        this->eval = ((this->children[2]->evaluate() >> low) & this->getBitvectorMask());
+
       if (this->size > this->children[2]->getBitvectorSize() || high >= this->children[2]->getBitvectorSize())
         throw triton::exceptions::Ast("ExtractNode::init(): The size of the extraction is higher than the child expression.");
 
@@ -2324,20 +3733,13 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void ExtractNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * triton::ast::hash2n(this->children[index]->getHash(), index+1);
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(false);
     }
 
 
@@ -2375,27 +3777,20 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void ForallNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * triton::ast::hash2n(this->children[index]->getHash(), index+1);
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(false);
     }
 
 
     /* ====== iff */
 
 
-    IffNode::IffNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2): AbstractNode(IFF_NODE, expr1->getContext()) {
+    IffNode::IffNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt): AbstractNode(IFF_NODE, ctxt) {
       this->addChild(expr1);
       this->addChild(expr2);
     }
@@ -2432,20 +3827,13 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void IffNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * triton::ast::hash2n(this->children[index]->getHash(), index+1);
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(false);
     }
 
 
@@ -2469,7 +3857,8 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
@@ -2479,14 +3868,16 @@ namespace triton {
 
 
     void IntegerNode::initHash(void) {
-      this->hash = static_cast<triton::uint64>(this->type) ^ this->value;
+      this->hash = triton::ast::NodeHash();
+      this->hash.mix(static_cast<triton::uint64>(this->type));
+      this->hash.mix(this->value);
     }
 
 
     /* ====== ite */
 
 
-    IteNode::IteNode(const SharedAbstractNode& ifExpr, const SharedAbstractNode& thenExpr, const SharedAbstractNode& elseExpr): AbstractNode(ITE_NODE, ifExpr->getContext()) {
+    IteNode::IteNode(const SharedAbstractNode& ifExpr, const SharedAbstractNode& thenExpr, const SharedAbstractNode& elseExpr, const SharedAstContext& ctxt): AbstractNode(ITE_NODE, ctxt) {
       this->addChild(ifExpr);
       this->addChild(thenExpr);
       this->addChild(elseExpr);
@@ -2508,11 +3899,16 @@ namespace triton {
 
       /* Init attributes */
       this->size       = this->children[1]->getBitvectorSize();
-      this->eval       = this->children[0]->evaluate() ? this->children[1]->evaluate() : this->children[2]->evaluate();
       this->logical    = this->children[1]->isLogical();
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->size <= triton::bitsize::qword)
+        this->eval.setNarrow(this->children[0]->evaluateNarrow() ? this->children[1]->evaluateNarrow() : this->children[2]->evaluateNarrow());
+      else
+        this->eval = this->children[0]->evaluate() ? this->children[1]->evaluate() : this->children[2]->evaluate();
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -2525,27 +3921,20 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void IteNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * triton::ast::hash2n(this->children[index]->getHash(), index+1);
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(false);
     }
 
 
     /* ====== Land */
 
 
-    LandNode::LandNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2): AbstractNode(LAND_NODE, expr1->getContext()) {
+    LandNode::LandNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt): AbstractNode(LAND_NODE, ctxt) {
       this->addChild(expr1);
       this->addChild(expr2);
     }
@@ -2565,7 +3954,7 @@ namespace triton {
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
-        this->eval = this->eval && this->children[index]->evaluate();
+        this->eval.setNarrow(this->eval.getNarrow() && this->children[index]->evaluateNarrow());
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
 
         if (this->children[index]->isLogical() == false)
@@ -2577,27 +3966,20 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void LandNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * this->children[index]->getHash();
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(true);
     }
 
 
     /* ====== Let */
 
 
-    LetNode::LetNode(std::string alias, const SharedAbstractNode& expr2, const SharedAbstractNode& expr3): AbstractNode(LET_NODE, expr2->getContext()) {
+    LetNode::LetNode(std::string alias, const SharedAbstractNode& expr2, const SharedAbstractNode& expr3, const SharedAstContext& ctxt): AbstractNode(LET_NODE, ctxt) {
       this->addChild(this->ctxt->string(alias));
       this->addChild(expr2);
       this->addChild(expr3);
@@ -2629,27 +4011,20 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void LetNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * triton::ast::hash2n(this->children[index]->getHash(), index+1);
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(false);
     }
 
 
     /* ====== Lnot */
 
 
-    LnotNode::LnotNode(const SharedAbstractNode& expr): AbstractNode(LNOT_NODE, expr->getContext()) {
+    LnotNode::LnotNode(const SharedAbstractNode& expr, const SharedAstContext& ctxt): AbstractNode(LNOT_NODE, ctxt) {
       this->addChild(expr);
     }
 
@@ -2679,27 +4054,20 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void LnotNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * this->children[index]->getHash();
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(false);
     }
 
 
     /* ====== Lor */
 
 
-    LorNode::LorNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2): AbstractNode(LOR_NODE, expr1->getContext()) {
+    LorNode::LorNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt): AbstractNode(LOR_NODE, ctxt) {
       this->addChild(expr1);
       this->addChild(expr2);
     }
@@ -2719,7 +4087,7 @@ namespace triton {
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
-        this->eval = this->eval || this->children[index]->evaluate();
+        this->eval.setNarrow(this->eval.getNarrow() || this->children[index]->evaluateNarrow());
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
 
         if (this->children[index]->isLogical() == false)
@@ -2731,27 +4099,20 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void LorNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * this->children[index]->getHash();
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(true);
     }
 
 
     /* ====== Lxor */
 
 
-    LxorNode::LxorNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) : AbstractNode(LXOR_NODE, expr1->getContext()) {
+    LxorNode::LxorNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt) : AbstractNode(LXOR_NODE, ctxt) {
       this->addChild(expr1);
       this->addChild(expr2);
     }
@@ -2771,7 +4132,7 @@ namespace triton {
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
-        this->eval = !this->eval != !this->children[index]->evaluate();
+        this->eval.setNarrow(!this->eval.getNarrow() != !this->children[index]->evaluateNarrow());
         this->level = std::max(this->children[index]->getLevel() + 1, this->level);
 
         if (this->children[index]->isLogical() == false)
@@ -2783,28 +4144,21 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void LxorNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * this->children[index]->getHash();
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(true);
     }
 
 
     /* ====== Reference node */
 
 
-    ReferenceNode::ReferenceNode(const triton::engines::symbolic::SharedSymbolicExpression& expr)
-      : AbstractNode(REFERENCE_NODE, expr->getAst()->getContext())
+    ReferenceNode::ReferenceNode(const triton::engines::symbolic::SharedSymbolicExpression& expr, const SharedAstContext& ctxt)
+      : AbstractNode(REFERENCE_NODE, ctxt)
       , expr(expr) {
     }
 
@@ -2824,12 +4178,13 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void ReferenceNode::initHash(void) {
-      this->hash = this->expr->getAst()->getHash();
+      this->hash = AbstractNode::hashOf(this->expr->getAst().get());
     }
 
 
@@ -2838,6 +4193,121 @@ namespace triton {
     }
 
 
+    /* ====== select */
+
+
+    SelectNode::SelectNode(const SharedAbstractNode& array, const SharedAbstractNode& index, const SharedAstContext& ctxt): AbstractNode(SELECT_NODE, ctxt) {
+      this->addChild(array);
+      this->addChild(index);
+    }
+
+
+    void SelectNode::init(bool withParents) {
+      if (this->children.size() < 2)
+        throw triton::exceptions::Ast("SelectNode::init(): Must take at least two children.");
+
+      if (this->children[0]->isArray() == false)
+        throw triton::exceptions::Ast("SelectNode::init(): The first child must be an array.");
+
+      if (this->children[1]->getBitvectorSize() != triton::ast::getArrayIndexSize(this->children[0]))
+        throw triton::exceptions::Ast("SelectNode::init(): The size of the index must be the one of the indexes of the array.");
+
+      /* Init attributes */
+      this->size       = triton::bitsize::byte;
+      this->level      = 1;
+      this->symbolized = false;
+
+      /* Init eval. A cell never stored is evaluated as zero */
+      const triton::uint8* cell = triton::ast::getArrayMemory(this->children[0]).find(this->children[1]->evaluateNarrow());
+      this->eval.setNarrow(cell ? *cell : 0);
+
+      /* Init children and spread information */
+      for (triton::uint32 index = 0; index < this->children.size(); index++) {
+        this->children[index]->setParent(this);
+        this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
+      }
+
+      /* Init parents if needed */
+      if (withParents) {
+        this->initParents();
+      }
+
+      this->refreshDomain();
+      this->refreshHash();
+    }
+
+
+    void SelectNode::initHash(void) {
+      this->hashStructure(false);
+    }
+
+
+    /* ====== store */
+
+
+    StoreNode::StoreNode(const SharedAbstractNode& array, const SharedAbstractNode& index, const SharedAbstractNode& value, const SharedAstContext& ctxt): AbstractNode(STORE_NODE, ctxt) {
+      this->addChild(array);
+      this->addChild(index);
+      this->addChild(value);
+    }
+
+
+    void StoreNode::init(bool withParents) {
+      if (this->children.size() < 3)
+        throw triton::exceptions::Ast("StoreNode::init(): Must take at least three children.");
+
+      if (this->children[0]->isArray() == false)
+        throw triton::exceptions::Ast("StoreNode::init(): The first child must be an array.");
+
+      if (this->children[1]->getBitvectorSize() != triton::ast::getArrayIndexSize(this->children[0]))
+        throw triton::exceptions::Ast("StoreNode::init(): The size of the index must be the one of the indexes of the array.");
+
+      if (this->children[2]->getBitvectorSize() != triton::bitsize::byte)
+        throw triton::exceptions::Ast("StoreNode::init(): The value must be a byte.");
+
+      /* Init attributes. An array is not a bitvector */
+      this->size       = 0;
+      this->eval       = 0;
+      this->level      = 1;
+      this->symbolized = false;
+
+      /* Init the cells, shared with the ones of the array */
+      this->memory = triton::ast::getArrayMemory(this->children[0]);
+      this->memory.set(this->children[1]->evaluateNarrow(), static_cast<triton::uint8>(this->children[2]->evaluateNarrow()));
+
+      /* Init children and spread information */
+      for (triton::uint32 index = 0; index < this->children.size(); index++) {
+        this->children[index]->setParent(this);
+        this->symbolized |= this->children[index]->isSymbolized();
+        this->level = std::max(this->children[index]->getLevel() + 1, this->level);
+      }
+
+      /* Init parents if needed */
+      if (withParents) {
+        this->initParents();
+      }
+
+      this->refreshDomain();
+      this->refreshHash();
+    }
+
+
+    triton::uint32 StoreNode::getIndexSize(void) const {
+      return this->children[1]->getBitvectorSize();
+    }
+
+
+    const ArrayMemory& StoreNode::getMemory(void) const {
+      return this->memory;
+    }
+
+
+    void StoreNode::initHash(void) {
+      this->hashStructure(false);
+    }
+
+
     /* ====== String node */
 
 
@@ -2858,7 +4328,8 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
@@ -2868,21 +4339,16 @@ namespace triton {
 
 
     void StringNode::initHash(void) {
-      triton::uint32 index = 1;
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      for (std::string::const_iterator it=this->value.cbegin(); it != this->value.cend(); it++) {
-        this->hash = triton::ast::rotl(*it ^ this->hash ^ triton::ast::hash2n(this->hash, index++), *it);
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hash = triton::ast::NodeHash();
+      this->hash.mix(static_cast<triton::uint64>(this->type));
+      this->hash.mix(this->value);
     }
 
 
     /* ====== sx */
 
 
-    SxNode::SxNode(triton::uint32 sizeExt, const SharedAbstractNode& expr): AbstractNode(SX_NODE, expr->getContext()) {
+    SxNode::SxNode(triton::uint32 sizeExt, const SharedAbstractNode& expr, const SharedAstContext& ctxt): AbstractNode(SX_NODE, ctxt) {
       this->addChild(this->ctxt->integer(sizeExt));
       this->addChild(expr);
     }
@@ -2921,20 +4387,13 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void SxNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * triton::ast::hash2n(this->children[index]->getHash(), index+1);
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(false);
     }
 
 
@@ -2949,7 +4408,7 @@ namespace triton {
 
     void VariableNode::init(bool withParents) {
       this->size        = this->symVar->getSize();
-      this->eval        = this->ctxt->getVariableValue(this->symVar->getName()) & this->getBitvectorMask();
+      this->eval        = this->ctxt->getVariableValue(this->symVar->getId()) & this->getBitvectorMask();
       this->symbolized  = true;
       this->level       = 1;
 
@@ -2958,7 +4417,8 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
@@ -2968,22 +4428,18 @@ namespace triton {
 
 
     void VariableNode::initHash(void) {
-      triton::uint32 index = 1;
-      triton::usize  id    = this->symVar->getId();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      for (char c : this->symVar->getName()) {
-        this->hash = triton::ast::rotl(c ^ this->hash ^ triton::ast::hash2n(this->hash, index++), (id & 511));
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hash = triton::ast::NodeHash();
+      this->hash.mix(static_cast<triton::uint64>(this->type));
+      this->hash.mix(static_cast<triton::uint64>(this->size));
+      this->hash.mix(static_cast<triton::uint64>(this->symVar->getId()));
+      this->hash.mix(this->symVar->getName());
     }
 
 
     /* ====== zx */
 
 
-    ZxNode::ZxNode(triton::uint32 sizeExt, const SharedAbstractNode& expr): AbstractNode(ZX_NODE, expr->getContext()) {
+    ZxNode::ZxNode(triton::uint32 sizeExt, const SharedAbstractNode& expr, const SharedAstContext& ctxt): AbstractNode(ZX_NODE, ctxt) {
       this->addChild(this->ctxt->integer(sizeExt));
       this->addChild(expr);
     }
@@ -3005,10 +4461,15 @@ namespace triton {
       if (size > triton::bitsize::max_supported)
         throw triton::exceptions::Ast("ZxNode::init(): Size cannot be greater than triton::bitsize::max_supported.");
 
-      this->eval       = (this->children[1]->evaluate() & this->getBitvectorMask());
       this->level      = 1;
       this->symbolized = false;
 
+      /* Init eval */
+      if (this->children[1]->getBitvectorSize() <= triton::bitsize::qword)
+        this->eval.setNarrow(this->children[1]->evaluateNarrow());
+      else
+        this->eval = (this->children[1]->evaluate() & this->getBitvectorMask());
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
@@ -3021,20 +4482,13 @@ namespace triton {
         this->initParents();
       }
 
-      this->initHash();
+      this->refreshDomain();
+      this->refreshHash();
     }
 
 
     void ZxNode::initHash(void) {
-      triton::uint512 s = this->children.size();
-
-      this->hash = static_cast<triton::uint64>(this->type);
-      if (s) this->hash = this->hash * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++) {
-        this->hash = this->hash * triton::ast::hash2n(this->children[index]->getHash(), index+1);
-      }
-
-      this->hash = triton::ast::rotl(this->hash, this->level);
+      this->hashStructure(false);
     }
 
   }; /* ast namespace */
@@ -3047,12 +4501,20 @@ namespace triton {
 namespace triton {
   namespace ast {
 
+    template TRITON_EXPORT BvaddNode::BvaddNode(const std::list<SharedAbstractNode>& exprs, const SharedAstContext& ctxt);
+    template TRITON_EXPORT BvaddNode::BvaddNode(const std::vector<SharedAbstractNode>& exprs, const SharedAstContext& ctxt);
+    template TRITON_EXPORT BvandNode::BvandNode(const std::list<SharedAbstractNode>& exprs, const SharedAstContext& ctxt);
+    template TRITON_EXPORT BvandNode::BvandNode(const std::vector<SharedAbstractNode>& exprs, const SharedAstContext& ctxt);
+    template TRITON_EXPORT BvorNode::BvorNode(const std::list<SharedAbstractNode>& exprs, const SharedAstContext& ctxt);
+    template TRITON_EXPORT BvorNode::BvorNode(const std::vector<SharedAbstractNode>& exprs, const SharedAstContext& ctxt);
+    template TRITON_EXPORT BvxorNode::BvxorNode(const std::list<SharedAbstractNode>& exprs, const SharedAstContext& ctxt);
+    template TRITON_EXPORT BvxorNode::BvxorNode(const std::vector<SharedAbstractNode>& exprs, const SharedAstContext& ctxt);
     template TRITON_EXPORT CompoundNode::CompoundNode(const std::list<SharedAbstractNode>& exprs, const SharedAstContext& ctxt);
     template TRITON_EXPORT CompoundNode::CompoundNode(const std::vector<SharedAbstractNode>& exprs, const SharedAstContext& ctxt);
     template TRITON_EXPORT ConcatNode::ConcatNode(const std::list<SharedAbstractNode>& exprs, const SharedAstContext& ctxt);
     template TRITON_EXPORT ConcatNode::ConcatNode(const std::vector<SharedAbstractNode>& exprs, const SharedAstContext& ctxt);
-    template TRITON_EXPORT ForallNode::ForallNode(const std::list<SharedAbstractNode>& vars, const SharedAbstractNode& body);
-    template TRITON_EXPORT ForallNode::ForallNode(const std::vector<SharedAbstractNode>& vars, const SharedAbstractNode& body);
+    template TRITON_EXPORT ForallNode::ForallNode(const std::list<SharedAbstractNode>& vars, const SharedAbstractNode& body, const SharedAstContext& ctxt);
+    template TRITON_EXPORT ForallNode::ForallNode(const std::vector<SharedAbstractNode>& vars, const SharedAbstractNode& body, const SharedAstContext& ctxt);
     template TRITON_EXPORT LandNode::LandNode(const std::list<SharedAbstractNode>& exprs, const SharedAstContext& ctxt);
     template TRITON_EXPORT LandNode::LandNode(const std::vector<SharedAbstractNode>& exprs, const SharedAstContext& ctxt);
     template TRITON_EXPORT LorNode::LorNode(const std::list<SharedAbstractNode>& exprs, const SharedAstContext& ctxt);
@@ -3072,7 +4534,7 @@ namespace triton {
 
     /* Representation dispatcher from an abstract node */
     std::ostream& operator<<(std::ostream& stream, AbstractNode* node) {
-      return node->getContext()->print(stream, node);
+      return triton::ast::representations::AstRepresentation::printOperand(stream, node);
     }
 
   }; /* ast namespace */
@@ -3085,33 +4547,23 @@ namespace triton {
 namespace triton {
   namespace ast {
 
-    triton::uint512 hash2n(triton::uint512 hash, triton::uint32 n) {
-      triton::uint512 mask = -1;
-      for (triton::uint32 i = 0; i < n; i++)
-        hash = ((hash * hash) & mask);
-      return hash;
-    }
-
-
-    triton::uint512 rotl(const triton::uint512& value, triton::uint32 shift) {
-      if ((shift &= 511) == 0)
-        return value;
-      return ((value << shift) | (value >> (512 - shift)));
+    triton::sint512 modularSignExtend(AbstractNode* node) {
+      return triton::ast::modularSignExtend(node->evaluate(), node->getBitvectorSize());
     }
 
 
-    triton::sint512 modularSignExtend(AbstractNode* node) {
-      triton::sint512 value = 0;
+    triton::sint512 modularSignExtend(const triton::uint512& value, triton::uint32 size) {
+      triton::sint512 result = 0;
 
-      if ((node->evaluate() >> (node->getBitvectorSize()-1)) & 1) {
-        value = -1;
-        value = ((value << node->getBitvectorSize()) | node->evaluate());
+      if ((value >> (size-1)) & 1) {
+        result = -1;
+        result = ((result << size) | value);
       }
       else {
-        value = node->evaluate();
+        result = value;
       }
 
-      return value;
+      return result;
     }
 
   }; /* ast namespace */
@@ -3131,65 +4583,77 @@ namespace triton {
       if (node == nullptr)
         throw triton::exceptions::Ast("triton::ast::shallowCopy(): node cannot be null.");
 
+      const auto& alloc = node->getContext()->getNodeAllocator();
+
       switch (node->getType()) {
-        case ASSERT_NODE:               newNode = std::make_shared<AssertNode>(*reinterpret_cast<AssertNode*>(node));     break;
-        case BSWAP_NODE:                newNode = std::make_shared<BswapNode>(*reinterpret_cast<BswapNode*>(node));       break;
-        case BVADD_NODE:                newNode = std::make_shared<BvaddNode>(*reinterpret_cast<BvaddNode*>(node));       break;
-        case BVAND_NODE:                newNode = std::make_shared<BvandNode>(*reinterpret_cast<BvandNode*>(node));       break;
-        case BVASHR_NODE:               newNode = std::make_shared<BvashrNode>(*reinterpret_cast<BvashrNode*>(node));     break;
-        case BVLSHR_NODE:               newNode = std::make_shared<BvlshrNode>(*reinterpret_cast<BvlshrNode*>(node));     break;
-        case BVMUL_NODE:                newNode = std::make_shared<BvmulNode>(*reinterpret_cast<BvmulNode*>(node));       break;
-        case BVNAND_NODE:               newNode = std::make_shared<BvnandNode>(*reinterpret_cast<BvnandNode*>(node));     break;
-        case BVNEG_NODE:                newNode = std::make_shared<BvnegNode>(*reinterpret_cast<BvnegNode*>(node));       break;
-        case BVNOR_NODE:                newNode = std::make_shared<BvnorNode>(*reinterpret_cast<BvnorNode*>(node));       break;
-        case BVNOT_NODE:                newNode = std::make_shared<BvnotNode>(*reinterpret_cast<BvnotNode*>(node));       break;
-        case BVOR_NODE:                 newNode = std::make_shared<BvorNode>(*reinterpret_cast<BvorNode*>(node));         break;
-        case BVROL_NODE:                newNode = std::make_shared<BvrolNode>(*reinterpret_cast<BvrolNode*>(node));       break;
-        case BVROR_NODE:                newNode = std::make_shared<BvrorNode>(*reinterpret_cast<BvrorNode*>(node));       break;
-        case BVSDIV_NODE:               newNode = std::make_shared<BvsdivNode>(*reinterpret_cast<BvsdivNode*>(node));     break;
-        case BVSGE_NODE:                newNode = std::make_shared<BvsgeNode>(*reinterpret_cast<BvsgeNode*>(node));       break;
-        case BVSGT_NODE:                newNode = std::make_shared<BvsgtNode>(*reinterpret_cast<BvsgtNode*>(node));       break;
-        case BVSHL_NODE:                newNode = std::make_shared<BvshlNode>(*reinterpret_cast<BvshlNode*>(node));       break;
-        case BVSLE_NODE:                newNode = std::make_shared<BvsleNode>(*reinterpret_cast<BvsleNode*>(node));       break;
-        case BVSLT_NODE:                newNode = std::make_shared<BvsltNode>(*reinterpret_cast<BvsltNode*>(node));       break;
-        case BVSMOD_NODE:               newNode = std::make_shared<BvsmodNode>(*reinterpret_cast<BvsmodNode*>(node));     break;
-        case BVSREM_NODE:               newNode = std::make_shared<BvsremNode>(*reinterpret_cast<BvsremNode*>(node));     break;
-        case BVSUB_NODE:                newNode = std::make_shared<BvsubNode>(*reinterpret_cast<BvsubNode*>(node));       break;
-        case BVUDIV_NODE:               newNode = std::make_shared<BvudivNode>(*reinterpret_cast<BvudivNode*>(node));     break;
-        case BVUGE_NODE:                newNode = std::make_shared<BvugeNode>(*reinterpret_cast<BvugeNode*>(node));       break;
-        case BVUGT_NODE:                newNode = std::make_shared<BvugtNode>(*reinterpret_cast<BvugtNode*>(node));       break;
-        case BVULE_NODE:                newNode = std::make_shared<BvuleNode>(*reinterpret_cast<BvuleNode*>(node));       break;
-        case BVULT_NODE:                newNode = std::make_shared<BvultNode>(*reinterpret_cast<BvultNode*>(node));       break;
-        case BVUREM_NODE:               newNode = std::make_shared<BvuremNode>(*reinterpret_cast<BvuremNode*>(node));     break;
-        case BVXNOR_NODE:               newNode = std::make_shared<BvxnorNode>(*reinterpret_cast<BvxnorNode*>(node));     break;
-        case BVXOR_NODE:                newNode = std::make_shared<BvxorNode>(*reinterpret_cast<BvxorNode*>(node));       break;
-        case BV_NODE:                   newNode = std::make_shared<BvNode>(*reinterpret_cast<BvNode*>(node));             break;
-        case COMPOUND_NODE:             newNode = std::make_shared<CompoundNode>(*reinterpret_cast<CompoundNode*>(node)); break;
-        case CONCAT_NODE:               newNode = std::make_shared<ConcatNode>(*reinterpret_cast<ConcatNode*>(node));     break;
-        case DECLARE_NODE:              newNode = std::make_shared<DeclareNode>(*reinterpret_cast<DeclareNode*>(node));   break;
-        case DISTINCT_NODE:             newNode = std::make_shared<DistinctNode>(*reinterpret_cast<DistinctNode*>(node)); break;
-        case EQUAL_NODE:                newNode = std::make_shared<EqualNode>(*reinterpret_cast<EqualNode*>(node));       break;
-        case EXTRACT_NODE:              newNode = std::make_shared<ExtractNode>(*reinterpret_cast<ExtractNode*>(node));   break;
-        case FORALL_NODE:               newNode = std::make_shared<ForallNode>(*reinterpret_cast<ForallNode*>(node));     break;
-        case IFF_NODE:                  newNode = std::make_shared<IffNode>(*reinterpret_cast<IffNode*>(node));           break;
-        case INTEGER_NODE:              newNode = std::make_shared<IntegerNode>(*reinterpret_cast<IntegerNode*>(node));   break;
-        case ITE_NODE:                  newNode = std::make_shared<IteNode>(*reinterpret_cast<IteNode*>(node));           break;
-        case LAND_NODE:                 newNode = std::make_shared<LandNode>(*reinterpret_cast<LandNode*>(node));         break;
-        case LET_NODE:                  newNode = std::make_shared<LetNode>(*reinterpret_cast<LetNode*>(node));           break;
-        case LNOT_NODE:                 newNode = std::make_shared<LnotNode>(*reinterpret_cast<LnotNode*>(node));         break;
-        case LOR_NODE:                  newNode = std::make_shared<LorNode>(*reinterpret_cast<LorNode*>(node));           break;
-        case LXOR_NODE:                 newNode = std::make_shared<LxorNode>(*reinterpret_cast<LxorNode*>(node));         break;
+        case ARRAY_NODE:                newNode = std::allocate_shared<ArrayNode>(alloc, *reinterpret_cast<ArrayNode*>(node));       break;
+        case ASSERT_NODE:               newNode = std::allocate_shared<AssertNode>(alloc, *reinterpret_cast<AssertNode*>(node));     break;
+        case BSWAP_NODE:                newNode = std::allocate_shared<BswapNode>(alloc, *reinterpret_cast<BswapNode*>(node));       break;
+        case BVADD_NODE:                newNode = std::allocate_shared<BvaddNode>(alloc, *reinterpret_cast<BvaddNode*>(node));       break;
+        case BVAND_NODE:                newNode = std::allocate_shared<BvandNode>(alloc, *reinterpret_cast<BvandNode*>(node));       break;
+        case BVASHR_NODE:               newNode = std::allocate_shared<BvashrNode>(alloc, *reinterpret_cast<BvashrNode*>(node));     break;
+        case BVLANEADD_NODE:            newNode = std::allocate_shared<BvlaneaddNode>(alloc, *reinterpret_cast<BvlaneaddNode*>(node)); break;
+        case BVLANEEQ_NODE:             newNode = std::allocate_shared<BvlaneeqNode>(alloc, *reinterpret_cast<BvlaneeqNode*>(node)); break;
+        case BVLANESELECT_NODE:         newNode = std::allocate_shared<BvlaneselectNode>(alloc, *reinterpret_cast<BvlaneselectNode*>(node)); break;
+        case BVLANESGT_NODE:            newNode = std::allocate_shared<BvlanesgtNode>(alloc, *reinterpret_cast<BvlanesgtNode*>(node)); break;
+        case BVLANESUB_NODE:            newNode = std::allocate_shared<BvlanesubNode>(alloc, *reinterpret_cast<BvlanesubNode*>(node)); break;
+        case BVLSHR_NODE:               newNode = std::allocate_shared<BvlshrNode>(alloc, *reinterpret_cast<BvlshrNode*>(node));     break;
+        case BVMUL_NODE:                newNode = std::allocate_shared<BvmulNode>(alloc, *reinterpret_cast<BvmulNode*>(node));       break;
+        case BVNAND_NODE:               newNode = std::allocate_shared<BvnandNode>(alloc, *reinterpret_cast<BvnandNode*>(node));     break;
+        case BVNEG_NODE:                newNode = std::allocate_shared<BvnegNode>(alloc, *reinterpret_cast<BvnegNode*>(node));       break;
+        case BVNOR_NODE:                newNode = std::allocate_shared<BvnorNode>(alloc, *reinterpret_cast<BvnorNode*>(node));       break;
+        case BVNOT_NODE:                newNode = std::allocate_shared<BvnotNode>(alloc, *reinterpret_cast<BvnotNode*>(node));       break;
+        case BVOR_NODE:                 newNode = std::allocate_shared<BvorNode>(alloc, *reinterpret_cast<BvorNode*>(node));         break;
+        case BVPARITY_NODE:             newNode = std::allocate_shared<BvparityNode>(alloc, *reinterpret_cast<BvparityNode*>(node)); break;
+        case BVPOPCOUNT_NODE:           newNode = std::allocate_shared<BvpopcountNode>(alloc, *reinterpret_cast<BvpopcountNode*>(node)); break;
+        case BVROL_NODE:                newNode = std::allocate_shared<BvrolNode>(alloc, *reinterpret_cast<BvrolNode*>(node));       break;
+        case BVROR_NODE:                newNode = std::allocate_shared<BvrorNode>(alloc, *reinterpret_cast<BvrorNode*>(node));       break;
+        case BVSDIV_NODE:               newNode = std::allocate_shared<BvsdivNode>(alloc, *reinterpret_cast<BvsdivNode*>(node));     break;
+        case BVSGE_NODE:                newNode = std::allocate_shared<BvsgeNode>(alloc, *reinterpret_cast<BvsgeNode*>(node));       break;
+        case BVSGT_NODE:                newNode = std::allocate_shared<BvsgtNode>(alloc, *reinterpret_cast<BvsgtNode*>(node));       break;
+        case BVSHL_NODE:                newNode = std::allocate_shared<BvshlNode>(alloc, *reinterpret_cast<BvshlNode*>(node));       break;
+        case BVSLE_NODE:                newNode = std::allocate_shared<BvsleNode>(alloc, *reinterpret_cast<BvsleNode*>(node));       break;
+        case BVSLT_NODE:                newNode = std::allocate_shared<BvsltNode>(alloc, *reinterpret_cast<BvsltNode*>(node));       break;
+        case BVSMOD_NODE:               newNode = std::allocate_shared<BvsmodNode>(alloc, *reinterpret_cast<BvsmodNode*>(node));     break;
+        case BVSREM_NODE:               newNode = std::allocate_shared<BvsremNode>(alloc, *reinterpret_cast<BvsremNode*>(node));     break;
+        case BVSUB_NODE:                newNode = std::allocate_shared<BvsubNode>(alloc, *reinterpret_cast<BvsubNode*>(node));       break;
+        case BVUDIV_NODE:               newNode = std::allocate_shared<BvudivNode>(alloc, *reinterpret_cast<BvudivNode*>(node));     break;
+        case BVUGE_NODE:                newNode = std::allocate_shared<BvugeNode>(alloc, *reinterpret_cast<BvugeNode*>(node));       break;
+        case BVUGT_NODE:                newNode = std::allocate_shared<BvugtNode>(alloc, *reinterpret_cast<BvugtNode*>(node));       break;
+        case BVULE_NODE:                newNode = std::allocate_shared<BvuleNode>(alloc, *reinterpret_cast<BvuleNode*>(node));       break;
+        case BVULT_NODE:                newNode = std::allocate_shared<BvultNode>(alloc, *reinterpret_cast<BvultNode*>(node));       break;
+        case BVUREM_NODE:               newNode = std::allocate_shared<BvuremNode>(alloc, *reinterpret_cast<BvuremNode*>(node));     break;
+        case BVXNOR_NODE:               newNode = std::allocate_shared<BvxnorNode>(alloc, *reinterpret_cast<BvxnorNode*>(node));     break;
+        case BVXOR_NODE:                newNode = std::allocate_shared<BvxorNode>(alloc, *reinterpret_cast<BvxorNode*>(node));       break;
+        case BV_NODE:                   newNode = std::allocate_shared<BvNode>(alloc, *reinterpret_cast<BvNode*>(node));             break;
+        case COMPOUND_NODE:             newNode = std::allocate_shared<CompoundNode>(alloc, *reinterpret_cast<CompoundNode*>(node)); break;
+        case CONCAT_NODE:               newNode = std::allocate_shared<ConcatNode>(alloc, *reinterpret_cast<ConcatNode*>(node));     break;
+        case DECLARE_NODE:              newNode = std::allocate_shared<DeclareNode>(alloc, *reinterpret_cast<DeclareNode*>(node));   break;
+        case DISTINCT_NODE:             newNode = std::allocate_shared<DistinctNode>(alloc, *reinterpret_cast<DistinctNode*>(node)); break;
+        case EQUAL_NODE:                newNode = std::allocate_shared<EqualNode>(alloc, *reinterpret_cast<EqualNode*>(node));       break;
+        case EXTRACT_NODE:              newNode = std::allocate_shared<ExtractNode>(alloc, *reinterpret_cast<ExtractNode*>(node));   break;
+        case FORALL_NODE:               newNode = std::allocate_shared<ForallNode>(alloc, *reinterpret_cast<ForallNode*>(node));     break;
+        case IFF_NODE:                  newNode = std::allocate_shared<IffNode>(alloc, *reinterpret_cast<IffNode*>(node));           break;
+        case INTEGER_NODE:              newNode = std::allocate_shared<IntegerNode>(alloc, *reinterpret_cast<IntegerNode*>(node));   break;
+        case ITE_NODE:                  newNode = std::allocate_shared<IteNode>(alloc, *reinterpret_cast<IteNode*>(node));           break;
+        case LAND_NODE:                 newNode = std::allocate_shared<LandNode>(alloc, *reinterpret_cast<LandNode*>(node));         break;
+        case LET_NODE:                  newNode = std::allocate_shared<LetNode>(alloc, *reinterpret_cast<LetNode*>(node));           break;
+        case LNOT_NODE:                 newNode = std::allocate_shared<LnotNode>(alloc, *reinterpret_cast<LnotNode*>(node));         break;
+        case LOR_NODE:                  newNode = std::allocate_shared<LorNode>(alloc, *reinterpret_cast<LorNode*>(node));           break;
+        case LXOR_NODE:                 newNode = std::allocate_shared<LxorNode>(alloc, *reinterpret_cast<LxorNode*>(node));         break;
         case REFERENCE_NODE: {
           if (unroll)
             return triton::ast::shallowCopy(reinterpret_cast<ReferenceNode*>(node)->getSymbolicExpression()->getAst().get(), unroll);
           else
-            newNode = std::make_shared<ReferenceNode>(*reinterpret_cast<ReferenceNode*>(node));
+            newNode = std::allocate_shared<ReferenceNode>(alloc, *reinterpret_cast<ReferenceNode*>(node));
           break;
         }
-        case STRING_NODE:               newNode = std::make_shared<StringNode>(*reinterpret_cast<StringNode*>(node));     break;
-        case SX_NODE:                   newNode = std::make_shared<SxNode>(*reinterpret_cast<SxNode*>(node));             break;
+        case SELECT_NODE:               newNode = std::allocate_shared<SelectNode>(alloc, *reinterpret_cast<SelectNode*>(node));     break;
+        case STORE_NODE:                newNode = std::allocate_shared<StoreNode>(alloc, *reinterpret_cast<StoreNode*>(node));       break;
+        case STRING_NODE:               newNode = std::allocate_shared<StringNode>(alloc, *reinterpret_cast<StringNode*>(node));     break;
+        case SX_NODE:                   newNode = std::allocate_shared<SxNode>(alloc, *reinterpret_cast<SxNode*>(node));             break;
         case VARIABLE_NODE:             newNode = node->shared_from_this(); /* Do not duplicate shared var (see #792) */  break;
-        case ZX_NODE:                   newNode = std::make_shared<ZxNode>(*reinterpret_cast<ZxNode*>(node));             break;
+        case ZX_NODE:                   newNode = std::allocate_shared<ZxNode>(alloc, *reinterpret_cast<ZxNode*>(node));             break;
         default:
           throw triton::exceptions::Ast("triton::ast::shallowCopy(): Invalid type node.");
       }
@@ -3206,7 +4670,8 @@ namespace triton {
         }
       }
 
-      return node->getContext()->collect(newNode);
+      /* A copy must stay a distinct instance, do not share it with the hash-consing table */
+      return node->getContext()->collect(newNode, false);
     }
 
 
@@ -3215,6 +4680,16 @@ namespace triton {
       auto nodes = childrenExtraction(node->shared_from_this(), unroll, true);
 
       for (auto&& n : nodes) {
+        /*
+         * A reference is unrolled to the copy of its expression, which the traversal
+         * visits first. All references to an expression share this copy, so that
+         * expressions reused by many instructions are copied once.
+         */
+        if (unroll && n->getType() == REFERENCE_NODE) {
+          exprs[n.get()] = exprs.at(reinterpret_cast<ReferenceNode*>(n.get())->getSymbolicExpression()->getAst().get());
+          continue;
+        }
+
         /* Do a copy of all children */
         const auto& newNode = shallowCopy(n.get(), unroll);
         exprs[n.get()] = newNode;
@@ -3237,29 +4712,98 @@ namespace triton {
     }
 
 
-    /* Returns a vector of unique AST-nodes sorted topologically
+    SharedAbstractNode rebuild(const SharedAstContext& ctxt, const AbstractNode* node, const std::vector<SharedAbstractNode>& children) {
+      auto integerOf = [&children](triton::usize index) -> triton::uint32 {
+        if (index >= children.size() || children[index]->getType() != INTEGER_NODE)
+          throw triton::exceptions::Ast("triton::ast::rebuild(): Expected an integer node.");
+        return reinterpret_cast<IntegerNode*>(children[index].get())->getInteger().convert_to<triton::uint32>();
+      };
+
+      switch (node->getType()) {
+        case BSWAP_NODE:        return ctxt->bswap(children[0]);
+        case BVADD_NODE:        return ctxt->bvadd(children);
+        case BVAND_NODE:        return ctxt->bvand(children);
+        case BVASHR_NODE:       return ctxt->bvashr(children[0], children[1]);
+        case BVLANEADD_NODE:    return ctxt->bvlaneadd(children[0], children[1], integerOf(2));
+        case BVLANEEQ_NODE:     return ctxt->bvlaneeq(children[0], children[1], integerOf(2));
+        case BVLANESELECT_NODE: return ctxt->bvlaneselect(children[0], children[1], children[2], integerOf(3));
+        case BVLANESGT_NODE:    return ctxt->bvlanesgt(children[0], children[1], integerOf(2));
+        case BVLANESUB_NODE:    return ctxt->bvlanesub(children[0], children[1], integerOf(2));
+        case BVLSHR_NODE:       return ctxt->bvlshr(children[0], children[1]);
+        case BVMUL_NODE:        return ctxt->bvmul(children[0], children[1]);
+        case BVNAND_NODE:       return ctxt->bvnand(children[0], children[1]);
+        case BVNEG_NODE:        return ctxt->bvneg(children[0]);
+        case BVNOR_NODE:        return ctxt->bvnor(children[0], children[1]);
+        case BVNOT_NODE:        return ctxt->bvnot(children[0]);
+        case BVOR_NODE:         return ctxt->bvor(children);
+        case BVPARITY_NODE:     return ctxt->bvparity(children[0]);
+        case BVPOPCOUNT_NODE:   return ctxt->bvpopcount(children[0]);
+        case BVROL_NODE:        return ctxt->bvrol(children[0], children[1]);
+        case BVROR_NODE:        return ctxt->bvror(children[0], children[1]);
+        case BVSDIV_NODE:       return ctxt->bvsdiv(children[0], children[1]);
+        case BVSGE_NODE:        return ctxt->bvsge(children[0], children[1]);
+        case BVSGT_NODE:        return ctxt->bvsgt(children[0], children[1]);
+        case BVSHL_NODE:        return ctxt->bvshl(children[0], children[1]);
+        case BVSLE_NODE:        return ctxt->bvsle(children[0], children[1]);
+        case BVSLT_NODE:        return ctxt->bvslt(children[0], children[1]);
+        case BVSMOD_NODE:       return ctxt->bvsmod(children[0], children[1]);
+        case BVSREM_NODE:       return ctxt->bvsrem(children[0], children[1]);
+        case BVSUB_NODE:        return ctxt->bvsub(children[0], children[1]);
+        case BVUDIV_NODE:       return ctxt->bvudiv(children[0], children[1]);
+        case BVUGE_NODE:        return ctxt->bvuge(children[0], children[1]);
+        case BVUGT_NODE:        return ctxt->bvugt(children[0], children[1]);
+        case BVULE_NODE:        return ctxt->bvule(children[0], children[1]);
+        case BVULT_NODE:        return ctxt->bvult(children[0], children[1]);
+        case BVUREM_NODE:       return ctxt->bvurem(children[0], children[1]);
+        case BVXNOR_NODE:       return ctxt->bvxnor(children[0], children[1]);
+        case BVXOR_NODE:        return ctxt->bvxor(children);
+        case CONCAT_NODE:       return ctxt->concat(children);
+        case DISTINCT_NODE:     return ctxt->distinct(children[0], children[1]);
+        case EQUAL_NODE:        return ctxt->equal(children[0], children[1]);
+        case EXTRACT_NODE:      return ctxt->extract(integerOf(0), integerOf(1), children[2]);
+        case IFF_NODE:          return ctxt->iff(children[0], children[1]);
+        case ITE_NODE:          return ctxt->ite(children[0], children[1], children[2]);
+        case LAND_NODE:         return ctxt->land(children);
+        case LNOT_NODE:         return ctxt->lnot(children[0]);
+        case LOR_NODE:          return ctxt->lor(children);
+        case LXOR_NODE:         return ctxt->lxor(children);
+        case SELECT_NODE:       return ctxt->select(children[0], children[1]);
+        case STORE_NODE:        return ctxt->store(children[0], children[1], children[2]);
+        case SX_NODE:           return ctxt->sx(integerOf(0), children[1]);
+        case ZX_NODE:           return ctxt->zx(integerOf(0), children[1]);
+        default:
+          throw triton::exceptions::Ast("triton::ast::rebuild(): This node cannot be rebuilt.");
+      }
+    }
+
+
+    /* Walks unique AST-nodes in topological order
      *
-     * Depending on @descent argument this function produces topologically sorted vector of nodes from DAG consisting of
-     * either parents or children of given @node. This helps to prevent exponential complexity when complex AST are
+     * Depending on @descent argument this function visits topologically sorted nodes from DAG consisting of
+     * either parents or children of given @node. Children are visited before their parents (or parents before
+     * their children if @descent is false). This helps to prevent exponential complexity when complex AST are
      * parsed during z3 conversion, copying and parents reinitialization.
      *
+     * The @count nodes from @roots share the visited nodes, the union of their DAGs is sorted at once.
+     *
      * @unroll - traverses through ReferenceNodes
-     * @revert - reverses the result
      * @descent - if true we traverse through children of nodes, otherwise parents
      */
-    static std::vector<SharedAbstractNode> nodesExtraction(const SharedAbstractNode& node, bool unroll, bool revert, bool descend) {
-      std::vector<SharedAbstractNode> result;
+    static void nodesTraversal(const SharedAbstractNode* roots, triton::usize count, bool unroll, bool descend, const std::function<void(const SharedAbstractNode&)>& visitor) {
       std::unordered_set<AbstractNode*> visited;
       std::stack<std::pair<SharedAbstractNode, bool>> worklist;
 
-      if (node == nullptr)
-        throw triton::exceptions::Ast("triton::ast::nodesExtraction(): Node cannot be null.");
+      for (triton::usize index = 0; index < count; index++) {
+        if (roots[index] == nullptr)
+          throw triton::exceptions::Ast("triton::ast::nodesTraversal(): Node cannot be null.");
+      }
 
       /*
        *  We use a worklist strategy to avoid recursive calls
        *  and so stack overflow when going through a big AST.
        */
-      worklist.push({node, false});
+      for (triton::usize index = count; index-- > 0;)
+        worklist.push({roots[index], false});
 
       while (!worklist.empty()) {
         SharedAbstractNode ast;
@@ -3267,9 +4811,9 @@ namespace triton {
         std::tie(ast, postOrder) = worklist.top();
         worklist.pop();
 
-        /* It means that we visited all children of this node and we can put it in the result */
+        /* It means that we visited all children of this node and we can visit it */
         if (postOrder) {
-          result.push_back(ast);
+          visitor(ast);
           continue;
         }
 
@@ -3296,6 +4840,38 @@ namespace triton {
           }
         }
       }
+    }
+
+
+    static void nodesTraversal(const SharedAbstractNode& node, bool unroll, bool descend, const std::function<void(const SharedAbstractNode&)>& visitor) {
+      nodesTraversal(&node, 1, unroll, descend, visitor);
+    }
+
+
+    /* Returns a vector of unique AST-nodes sorted topologically
+     *
+     * In AST_TRAVERSAL_CACHE mode the sort is cached by the AST context until the children
+     * (@descent) or the parents (!@descent) of the DAG change.
+     *
+     * @unroll - traverses through ReferenceNodes
+     * @revert - reverses the result
+     * @descent - if true we traverse through children of nodes, otherwise parents
+     */
+    static std::vector<SharedAbstractNode> nodesExtraction(const SharedAbstractNode& node, bool unroll, bool revert, bool descend) {
+      std::vector<SharedAbstractNode> result;
+
+      if (node == nullptr)
+        throw triton::exceptions::Ast("triton::ast::nodesExtraction(): Node cannot be null.");
+
+      const auto& ctxt = node->getContext();
+      /* The cache belongs to the context owner, frozen nodes may be traversed by other threads */
+      bool cached = ctxt->isModeEnabled(triton::modes::AST_TRAVERSAL_CACHE) && !node->isFrozen();
+
+      if (!cached || !ctxt->getCachedTraversal(node.get(), unroll, descend, result)) {
+        nodesTraversal(node, unroll, descend, [&result](const SharedAbstractNode& n) { result.push_back(n); });
+        if (cached)
+          ctxt->setCachedTraversal(node.get(), unroll, descend, result);
+      }
 
       /* The result is in reversed topological sort meaning that children go before parents */
       if (!revert) {
@@ -3316,6 +4892,38 @@ namespace triton {
     }
 
 
+    std::vector<SharedAbstractNode> parentsExtraction(const std::vector<SharedAbstractNode>& nodes, bool revert) {
+      std::vector<SharedAbstractNode> result;
+
+      nodesTraversal(nodes.data(), nodes.size(), false, false, [&result](const SharedAbstractNode& n) { result.push_back(n); });
+
+      /* The result is in reversed topological sort meaning that children go before parents */
+      if (!revert) {
+        std::reverse(result.begin(), result.end());
+      }
+
+      return result;
+    }
+
+
+    void childrenTraversal(const SharedAbstractNode& node, bool unroll, const std::function<void(const SharedAbstractNode&)>& visitor) {
+      std::vector<SharedAbstractNode> nodes;
+
+      if (node == nullptr)
+        throw triton::exceptions::Ast("triton::ast::childrenTraversal(): Node cannot be null.");
+
+      /* Reuse a cached sort if there is one, but do not build a vector only to cache it */
+      const auto& ctxt = node->getContext();
+      if (ctxt->isModeEnabled(triton::modes::AST_TRAVERSAL_CACHE) && !node->isFrozen() && ctxt->getCachedTraversal(node.get(), unroll, true, nodes)) {
+        for (const auto& n : nodes)
+          visitor(n);
+        return;
+      }
+
+      nodesTraversal(node, unroll, true, visitor);
+    }
+
+
     std::deque<SharedAbstractNode> search(const SharedAbstractNode& node, triton::ast::ast_e match) {
       std::stack<AbstractNode*>                worklist;
       std::deque<SharedAbstractNode>           result;
@@ -3360,5 +4968,29 @@ namespace triton {
       return ptr->shared_from_this();
     }
 
+
+    const ArrayMemory& getArrayMemory(const SharedAbstractNode& array) {
+      AbstractNode* ptr = triton::ast::dereference(array).get();
+
+      switch (ptr->getType()) {
+        case ARRAY_NODE: return reinterpret_cast<ArrayNode*>(ptr)->getMemory();
+        case STORE_NODE: return reinterpret_cast<StoreNode*>(ptr)->getMemory();
+        default:
+          throw triton::exceptions::Ast("triton::ast::getArrayMemory(): The node must be an array.");
+      }
+    }
+
+
+    triton::uint32 getArrayIndexSize(const SharedAbstractNode& array) {
+      AbstractNode* ptr = triton::ast::dereference(array).get();
+
+      switch (ptr->getType()) {
+        case ARRAY_NODE: return reinterpret_cast<ArrayNode*>(ptr)->getIndexSize();
+        case STORE_NODE: return reinterpret_cast<StoreNode*>(ptr)->getIndexSize();
+        default:
+          throw triton::exceptions::Ast("triton::ast::getArrayIndexSize(): The node must be an array.");
+      }
+    }
+
   }; /* ast namespace */
 }; /* triton namespace */
@@ -0,0 +1,211 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <atomic>
+#include <new>
+#include <thread>
+
+#include <triton/astAllocator.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    NodePool::NodePool() {
+      for (triton::usize i = 0; i < this->classes; i++)
+        this->freeLists[i] = nullptr;
+
+      for (triton::usize i = 0; i < this->classes; i++)
+        this->remoteLists[i].store(nullptr, std::memory_order_relaxed);
+
+      this->cursor        = nullptr;
+      this->limit         = nullptr;
+      this->allocations   = 0;
+      this->deallocations = 0;
+      this->recycled      = 0;
+      this->bytesInUse     = 0;
+      this->bytesAllocated = 0;
+      this->bytesReserved  = 0;
+      this->owner         = std::this_thread::get_id();
+      this->remoteDeallocations.store(0, std::memory_order_relaxed);
+      this->remoteBytes.store(0, std::memory_order_relaxed);
+    }
+
+
+    NodePool::~NodePool() {
+      this->releaseSlabs();
+    }
+
+
+    void NodePool::releaseSlabs(void) {
+      for (const Slab& slab : this->slabs)
+        slab.placement.release(slab.data, slab.size);
+
+      this->slabs.clear();
+      this->bytesReserved = 0;
+
+      for (triton::usize i = 0; i < this->classes; i++) {
+        this->freeLists[i] = nullptr;
+        this->remoteLists[i].store(nullptr, std::memory_order_relaxed);
+      }
+
+      this->cursor = nullptr;
+      this->limit  = nullptr;
+    }
+
+
+    void NodePool::drainRemote(void) {
+      /*
+       * Counters are taken before lists: a chunk is pushed before being
+       * counted, so every counted chunk is in the lists taken below.
+       */
+      triton::usize count = this->remoteDeallocations.exchange(0, std::memory_order_acquire);
+      triton::usize bytes = this->remoteBytes.exchange(0, std::memory_order_acquire);
+
+      this->deallocations += count;
+      this->bytesInUse    -= bytes;
+
+      for (triton::usize i = 0; i < this->classes; i++) {
+        FreeChunk* chunk = this->remoteLists[i].exchange(nullptr, std::memory_order_acquire);
+        while (chunk != nullptr) {
+          FreeChunk* next = chunk->next;
+          chunk->next = this->freeLists[i];
+          this->freeLists[i] = chunk;
+          chunk = next;
+        }
+      }
+    }
+
+
+    void* NodePool::allocate(triton::usize size) {
+      triton::usize index = (size + this->granularity - 1) / this->granularity;
+
+      this->allocations++;
+      this->bytesInUse     += size;
+      this->bytesAllocated += size;
+
+      /* Big requests are forwarded to the global allocator */
+      if (index == 0 || index >= this->classes)
+        return ::operator new(size);
+
+      /* Chunks released by other threads are recycled too */
+      if (this->freeLists[index] == nullptr && this->remoteLists[index].load(std::memory_order_relaxed) != nullptr)
+        this->drainRemote();
+
+      /* Try to recycle a chunk of the same size class */
+      if (this->freeLists[index] != nullptr) {
+        FreeChunk* chunk = this->freeLists[index];
+        this->freeLists[index] = chunk->next;
+        this->recycled++;
+        return chunk;
+      }
+
+      /* Otherwise bump allocate from the current slab */
+      triton::usize bytes = index * this->granularity;
+      if (this->cursor == nullptr || static_cast<triton::usize>(this->limit - this->cursor) < bytes) {
+        triton::usize size = this->slabSize;
+        if (size < this->placement.getGranularity())
+          size = this->placement.getGranularity();
+        char* slab = static_cast<char*>(this->placement.allocate(size));
+        this->slabs.push_back({slab, size, this->placement});
+        this->bytesReserved += size;
+        this->cursor = slab;
+        this->limit  = slab + size;
+      }
+
+      void* p = this->cursor;
+      this->cursor += bytes;
+      return p;
+    }
+
+
+    void NodePool::deallocate(void* p, triton::usize size) {
+      triton::usize index = (size + this->granularity - 1) / this->granularity;
+
+      /* Another thread only pushes the chunk, the owner accounts it later */
+      if (std::this_thread::get_id() != this->owner) {
+        if (index == 0 || index >= this->classes) {
+          ::operator delete(p);
+        }
+        else {
+          FreeChunk* chunk = static_cast<FreeChunk*>(p);
+          chunk->next = this->remoteLists[index].load(std::memory_order_relaxed);
+          while (!this->remoteLists[index].compare_exchange_weak(chunk->next, chunk, std::memory_order_release, std::memory_order_relaxed));
+        }
+        this->remoteBytes.fetch_add(size, std::memory_order_release);
+        this->remoteDeallocations.fetch_add(1, std::memory_order_release);
+        return;
+      }
+
+      this->deallocations++;
+      this->bytesInUse -= size;
+
+      if (index == 0 || index >= this->classes) {
+        ::operator delete(p);
+        return;
+      }
+
+      FreeChunk* chunk = static_cast<FreeChunk*>(p);
+      chunk->next = this->freeLists[index];
+      this->freeLists[index] = chunk;
+    }
+
+
+    void NodePool::trim(void) {
+      this->drainRemote();
+      if (this->allocations == this->deallocations)
+        this->releaseSlabs();
+    }
+
+
+    void NodePool::setPlacement(const triton::utils::MemoryPlacement& placement) {
+      this->placement = placement;
+    }
+
+
+    const triton::utils::MemoryPlacement& NodePool::getPlacement(void) const {
+      return this->placement;
+    }
+
+
+    void NodePool::setOwner(void) {
+      this->owner = std::this_thread::get_id();
+    }
+
+
+    triton::usize NodePool::getAllocations(void) const {
+      return this->allocations;
+    }
+
+
+    triton::usize NodePool::getDeallocations(void) const {
+      return this->deallocations + this->remoteDeallocations.load(std::memory_order_acquire);
+    }
+
+
+    triton::usize NodePool::getRecycled(void) const {
+      return this->recycled;
+    }
+
+
+    triton::usize NodePool::getBytesInUse(void) const {
+      return this->bytesInUse - this->remoteBytes.load(std::memory_order_acquire);
+    }
+
+
+    triton::usize NodePool::getBytesAllocated(void) const {
+      return this->bytesAllocated;
+    }
+
+
+    triton::usize NodePool::getBytesReserved(void) const {
+      return this->bytesReserved;
+    }
+
+  }; /* ast namespace */
+}; /* triton namespace */
@@ -5,8 +5,13 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <algorithm>
+#include <chrono>
+#include <limits>
 #include <list>
 #include <memory>
+#include <string>
+#include <unordered_set>
 #include <vector>
 
 #include <triton/ast.hpp>
@@ -21,13 +26,35 @@ namespace triton {
   namespace ast {
 
     AstContext::AstContext(const triton::modes::SharedModes& modes)
-      : modes(modes) {
+      : modes(modes),
+        pool(std::make_shared<NodePool>()),
+        allocator(pool) {
+      this->oldCursor         = 0;
+      this->consingCursor     = 0;
+      this->consingInsertions = 0;
+      this->constantsCursor   = 0;
+      this->reevaluating      = false;
+      this->structureVersion  = 0;
+      this->childrenVersion   = 0;
+      this->traversalsSize    = 0;
+      this->garbageNodes      = 0;
+      this->garbageBytes      = 0;
+      this->lastAllocations   = 0;
+      this->lastBytes         = 0;
+
+      for (triton::usize index = 0; index < nodeTypes; index++)
+        this->liveNodes[index].store(0, std::memory_order_relaxed);
     }
 
 
     AstContext::~AstContext() {
       this->valueMapping.clear();
-      this->nodes.clear();
+      this->consing.clear();
+      this->constants.clear();
+      this->cones.clear();
+      this->traversals.clear();
+      this->youngNodes.clear();
+      this->oldNodes.clear();
     }
 
 
@@ -37,13 +64,80 @@ namespace triton {
       this->astRepresentation = other.astRepresentation;
       this->modes             = other.modes;
       this->valueMapping      = other.valueMapping;
-      this->nodes             = other.nodes;
+      this->youngNodes        = other.youngNodes;
+      this->oldNodes          = other.oldNodes;
+      this->oldCursor         = other.oldCursor;
+      this->consing           = other.consing;
+      this->consingCursor     = other.consingCursor;
+      this->consingInsertions = other.consingInsertions;
+      this->constants         = other.constants;
+      this->constantsCursor   = other.constantsCursor;
+      this->structureVersion  = other.structureVersion;
+      this->cones             = other.cones;
+      this->childrenVersion   = other.childrenVersion;
+      this->traversalsSize    = other.traversalsSize;
+      this->traversals        = other.traversals;
+      this->garbageNodes      = other.garbageNodes;
+      this->garbageBytes      = other.garbageBytes;
 
       return *this;
     }
 
 
-    SharedAbstractNode AstContext::collect(const SharedAbstractNode& node) {
+    /*
+     * The release worklist is per thread: a node destroyed by a thread may
+     * belong to a context owned by another one (frozen DAGs).
+     */
+    static thread_local std::vector<SharedAbstractNode> pendingRelease;
+    static thread_local bool releasing = false;
+
+
+    void AstContext::release(std::vector<SharedAbstractNode>& nodes) {
+      /*
+       * Nodes owned only by `nodes` are moved into the worklist, others
+       * are just dereferenced. The first caller drains the worklist while
+       * nested calls (from the destructors of released nodes) only feed it.
+       */
+      for (auto& node : nodes) {
+        if (node.use_count() == 1)
+          pendingRelease.push_back(std::move(node));
+      }
+      nodes.clear();
+
+      if (releasing)
+        return;
+
+      releasing = true;
+      while (!pendingRelease.empty()) {
+        SharedAbstractNode node = std::move(pendingRelease.back());
+        pendingRelease.pop_back();
+        node.reset();
+      }
+      releasing = false;
+    }
+
+
+    void AstContext::setOwnerThread(void) {
+      this->pool->setOwner();
+    }
+
+
+    bool AstContext::hasConstantValue(const SharedAbstractNode& node) const {
+      if (node->isSymbolized() == false)
+        return true;
+
+      /* A symbolized node may still have a single possible value */
+      return this->modes->isModeEnabled(triton::modes::AST_ABSTRACT_DOMAIN) && node->getDomain().isConstant();
+    }
+
+
+    SharedAbstractNode AstContext::collect(const SharedAbstractNode& node, bool share) {
+      if (share && this->modes->isModeEnabled(triton::modes::AST_HASH_CONSING)) {
+        SharedAbstractNode canonical = this->hashCons(node);
+        if (canonical != node)
+          return canonical;
+      }
+
       /*
        * We keep references to nodes which belong to a depth in the AST which is
        * a multiple of 10000. Thus, when the root node is destroyed, the stack recursivity
@@ -52,27 +146,363 @@ namespace triton {
        * next allocation of nodes and so on. So, it means that ASTs are destroyed by steps
        * of depth of 10000 which avoids the overflow while keeping a good scale.
        *
+       * Note that since node destructors go through release(), the destruction
+       * itself is iterative. These references now only split the teardown of
+       * a deep AST into steps done by garbage().
+       *
        * See: #753.
        */
       triton::uint32 lvl = node->getLevel();
       if (lvl != 0 && (lvl % 10000) == 0) {
-        this->nodes.push_front(node);
+        this->youngNodes.push_front(node);
       }
       return node;
     }
 
 
-    void AstContext::garbage(void) {
-      this->nodes.erase(std::remove_if(this->nodes.begin(), this->nodes.end(),
-        [](const SharedAbstractNode& n) {
-          return (n.use_count() == 1 ? true : false);
-        }), this->nodes.end()
+    /* Removes expired entries from a list of weak nodes */
+    static void pruneExpired(std::vector<WeakAbstractNode>& list) {
+      list.erase(std::remove_if(list.begin(), list.end(),
+        [](const WeakAbstractNode& n) {
+          return n.expired();
+        }), list.end()
       );
     }
 
 
+    void AstContext::garbage(void) {
+      triton::utils::TraceScope scope(this->tracer.get(), "garbage", "ast");
+      triton::usize deallocations = this->pool->getDeallocations();
+      auto start = std::chrono::steady_clock::now();
+
+      auto isDead = [](const SharedAbstractNode& n) {
+        return (n.use_count() == 1 ? true : false);
+      };
+
+      /* Survivors of the young generation are promoted */
+      this->youngNodes.erase(std::remove_if(this->youngNodes.begin(), this->youngNodes.end(), isDead), this->youngNodes.end());
+      this->oldNodes.insert(this->oldNodes.end(), this->youngNodes.begin(), this->youngNodes.end());
+      this->youngNodes.clear();
+
+      this->oldNodes.erase(std::remove_if(this->oldNodes.begin(), this->oldNodes.end(), isDead), this->oldNodes.end());
+      this->oldCursor = 0;
+
+      this->consingInsertions = 0;
+      for (auto it = this->consing.begin(); it != this->consing.end();) {
+        pruneExpired(it->second);
+        if (it->second.empty())
+          it = this->consing.erase(it);
+        else
+          ++it;
+      }
+
+      /* Dead shared constants release their storage */
+      for (auto& constant : this->constants) {
+        if (constant.expired())
+          constant.reset();
+      }
+
+      /* Cones cached for an old structure version are useless */
+      for (auto it = this->cones.begin(); it != this->cones.end();) {
+        if (it->second.first != this->structureVersion)
+          it = this->cones.erase(it);
+        else
+          ++it;
+      }
+
+      /* Same for traversals, or when their root is dead */
+      for (auto it = this->traversals.begin(); it != this->traversals.end();) {
+        if (it->second.first != this->getTraversalVersion(it->first.second) || it->second.second.back().expired()) {
+          this->traversalsSize -= it->second.second.size();
+          it = this->traversals.erase(it);
+        }
+        else
+          ++it;
+      }
+
+      /* If every node is dead, slabs are released in bulk */
+      this->pool->trim();
+      scope.setValue(this->pool->getDeallocations() - deallocations);
+
+      this->garbageStatistics.fullCycles++;
+      this->endGarbage(start, deallocations);
+    }
+
+
+    void AstContext::garbage(triton::usize budget) {
+      triton::utils::TraceScope scope(this->tracer.get(), "garbageStep", "ast");
+      triton::usize deallocations = this->pool->getDeallocations();
+      auto start = std::chrono::steady_clock::now();
+      triton::usize work = 0;
+
+      /* Young generation: dead nodes are released, survivors are promoted */
+      while (!this->youngNodes.empty() && work < budget) {
+        SharedAbstractNode node = std::move(this->youngNodes.back());
+        this->youngNodes.pop_back();
+        if (node.use_count() > 1)
+          this->oldNodes.push_back(std::move(node));
+        work++;
+      }
+
+      /* Old generation: round-robin over survivors */
+      triton::usize steps = std::min(budget - work, this->oldNodes.size());
+      for (triton::usize i = 0; i < steps; i++) {
+        if (this->oldCursor >= this->oldNodes.size())
+          this->oldCursor = 0;
+        if (this->oldNodes[this->oldCursor].use_count() == 1) {
+          std::swap(this->oldNodes[this->oldCursor], this->oldNodes.back());
+          this->oldNodes.pop_back();
+        }
+        else {
+          this->oldCursor++;
+        }
+        work++;
+      }
+
+      /*
+       * Hash-consing table: round-robin over buckets. The amount of entries
+       * examined is proportional to the amount of insertions since the last
+       * collection, so that the table stays bounded at an amortized O(1) cost.
+       */
+      triton::usize buckets = this->consing.bucket_count();
+      steps = std::min(budget - work, 2 * this->consingInsertions);
+      this->consingInsertions -= std::min(this->consingInsertions, steps / 2 + 1);
+      for (triton::usize i = 0, visited = 0; i < buckets && visited < steps && !this->consing.empty(); i++) {
+        std::vector<triton::uint64> emptyKeys;
+        triton::usize bucket = this->consingCursor++ % buckets;
+        for (auto it = this->consing.begin(bucket); it != this->consing.end(bucket); ++it) {
+          pruneExpired(it->second);
+          if (it->second.empty())
+            emptyKeys.push_back(it->first);
+          visited++;
+        }
+        for (triton::uint64 key : emptyKeys)
+          this->consing.erase(key);
+      }
+
+      /* Shared constants: round-robin over slots */
+      steps = std::min(budget - work, this->constants.size());
+      for (triton::usize i = 0; i < steps; i++) {
+        if (this->constantsCursor >= this->constants.size())
+          this->constantsCursor = 0;
+        auto& constant = this->constants[this->constantsCursor++];
+        if (constant.expired())
+          constant.reset();
+        work++;
+      }
+
+      /* If every node is dead, slabs are released in bulk */
+      this->pool->trim();
+      scope.setValue(this->pool->getDeallocations() - deallocations);
+
+      this->garbageStatistics.incrementalCycles++;
+      this->garbageStatistics.examined += work;
+      this->endGarbage(start, deallocations);
+    }
+
+
+    void AstContext::endGarbage(std::chrono::steady_clock::time_point start, triton::usize deallocations) {
+      auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+      this->garbageStatistics.released += this->pool->getDeallocations() - deallocations;
+      this->garbageStatistics.time     += elapsed.count();
+      this->lastAllocations             = this->pool->getAllocations();
+      this->lastBytes                   = this->pool->getBytesAllocated();
+    }
+
+
+    void AstContext::garbageIfNeeded(void) {
+      if (this->garbageNodes == 0 && this->garbageBytes == 0) {
+        this->garbage(defaultGarbageBudget);
+        return;
+      }
+
+      triton::usize nodes = this->pool->getAllocations() - this->lastAllocations;
+      triton::usize bytes = this->pool->getBytesAllocated() - this->lastBytes;
+
+      if ((this->garbageNodes && nodes >= this->garbageNodes) || (this->garbageBytes && bytes >= this->garbageBytes)) {
+        /* The work is proportional to the allocations since the last collection, thus amortized O(1) per node */
+        triton::usize budget = 2 * nodes;
+        if (budget < defaultGarbageBudget)
+          budget = defaultGarbageBudget;
+        this->garbageStatistics.triggered++;
+        this->garbage(budget);
+      }
+    }
+
+
+    void AstContext::setGarbageThresholds(triton::usize nodes, triton::usize bytes) {
+      this->garbageNodes = nodes;
+      this->garbageBytes = bytes;
+    }
+
+
+    triton::usize AstContext::getGarbageNodesThreshold(void) const {
+      return this->garbageNodes;
+    }
+
+
+    triton::usize AstContext::getGarbageBytesThreshold(void) const {
+      return this->garbageBytes;
+    }
+
+
+    const triton::ast::GarbageStatistics& AstContext::getGarbageStatistics(void) const {
+      return this->garbageStatistics;
+    }
+
+
+    const SharedNodePool& AstContext::getNodePool(void) const {
+      return this->pool;
+    }
+
+
+    const NodeAllocator<AbstractNode>& AstContext::getNodeAllocator(void) const {
+      return this->allocator;
+    }
+
+
+    std::map<triton::ast::ast_e, triton::usize> AstContext::getLiveNodes(void) const {
+      std::map<triton::ast::ast_e, triton::usize> nodes;
+
+      for (triton::usize index = 0; index < nodeTypes; index++) {
+        triton::usize count = this->liveNodes[index].load(std::memory_order_relaxed);
+        if (count)
+          nodes[static_cast<triton::ast::ast_e>(index)] = count;
+      }
+
+      return nodes;
+    }
+
+
+    const triton::utils::SharedEventTracer& AstContext::getTracer(void) const {
+      return this->tracer;
+    }
+
+
+    void AstContext::setTracer(const triton::utils::SharedEventTracer& tracer) {
+      this->tracer = tracer;
+    }
+
+
+    /* Mixes a value into a key */
+    static inline triton::uint64 mixKey(triton::uint64 key, triton::uint64 value) {
+      return key ^ (value + 0x9e3779b97f4a7c15ULL + (key << 6) + (key >> 2));
+    }
+
+
+    /* Returns a key over the kind, size, payload and children identity of a node */
+    static triton::uint64 structuralKey(AbstractNode* node) {
+      triton::uint64 key = mixKey(node->getType(), node->getBitvectorSize());
+
+      switch (node->getType()) {
+        case INTEGER_NODE:
+          key = mixKey(key, (reinterpret_cast<IntegerNode*>(node)->getInteger() & std::numeric_limits<triton::uint64>::max()).convert_to<triton::uint64>());
+          break;
+
+        case STRING_NODE:
+          key = mixKey(key, std::hash<std::string>()(reinterpret_cast<StringNode*>(node)->getString()));
+          break;
+
+        case REFERENCE_NODE:
+          key = mixKey(key, reinterpret_cast<triton::usize>(reinterpret_cast<ReferenceNode*>(node)->getSymbolicExpression().get()));
+          break;
+
+        default:
+          break;
+      }
+
+      for (const auto& child : node->getChildren())
+        key = mixKey(key, reinterpret_cast<triton::usize>(child.get()));
+
+      return key;
+    }
+
+
+    bool AstContext::isStructurallyIdentical(AbstractNode* node1, AbstractNode* node2) const {
+      if (node1->getType() != node2->getType())
+        return false;
+
+      if (node1->getBitvectorSize() != node2->getBitvectorSize())
+        return false;
+
+      switch (node1->getType()) {
+        case INTEGER_NODE:
+          if (reinterpret_cast<IntegerNode*>(node1)->getInteger() != reinterpret_cast<IntegerNode*>(node2)->getInteger())
+            return false;
+          break;
+
+        case STRING_NODE:
+          if (reinterpret_cast<StringNode*>(node1)->getString() != reinterpret_cast<StringNode*>(node2)->getString())
+            return false;
+          break;
+
+        case REFERENCE_NODE:
+          if (reinterpret_cast<ReferenceNode*>(node1)->getSymbolicExpression() != reinterpret_cast<ReferenceNode*>(node2)->getSymbolicExpression())
+            return false;
+          break;
+
+        default:
+          break;
+      }
+
+      const auto& children1 = node1->getChildren();
+      const auto& children2 = node2->getChildren();
+
+      if (children1.size() != children2.size())
+        return false;
+
+      for (triton::usize index = 0; index < children1.size(); index++) {
+        if (children1[index] != children2[index])
+          return false;
+      }
+
+      return true;
+    }
+
+
+    SharedAbstractNode AstContext::hashCons(const SharedAbstractNode& node) {
+      /* Variables are already unique through the valueMapping */
+      if (node->getType() == VARIABLE_NODE)
+        return node;
+
+      auto& entries = this->consing[triton::ast::structuralKey(node.get())];
+
+      for (auto it = entries.begin(); it != entries.end();) {
+        SharedAbstractNode candidate = it->lock();
+        if (candidate == nullptr) {
+          it = entries.erase(it);
+          continue;
+        }
+        /* A frozen node does not follow its variables anymore, it is not shared with new nodes */
+        if (candidate != node && !candidate->isFrozen() && this->isStructurallyIdentical(candidate.get(), node.get())) {
+          /* The new node is dropped, unlink it from its children */
+          for (auto& child : node->getChildren())
+            child->removeParent(node.get());
+          if (node->getType() == REFERENCE_NODE)
+            reinterpret_cast<ReferenceNode*>(node.get())->getSymbolicExpression()->getAst()->removeParent(node.get());
+          return candidate;
+        }
+        ++it;
+      }
+
+      entries.push_back(WeakAbstractNode(node));
+      this->consingInsertions++;
+      return node;
+    }
+
+
+    SharedAbstractNode AstContext::array(triton::uint32 indexSize) {
+      SharedAbstractNode node = std::allocate_shared<ArrayNode>(this->allocator, indexSize, this->shared_from_this());
+      if (node == nullptr)
+        throw triton::exceptions::Ast("AstContext::array(): Not enough memory.");
+      node->init();
+      return this->collect(node);
+    }
+
+
     SharedAbstractNode AstContext::assert_(const SharedAbstractNode& expr) {
-      SharedAbstractNode node = std::make_shared<AssertNode>(expr);
+      SharedAbstractNode node = std::allocate_shared<AssertNode>(this->allocator, expr, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::assert_(): Not enough memory.");
       node->init();
@@ -81,7 +511,7 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::bswap(const SharedAbstractNode& expr) {
-      SharedAbstractNode node = std::make_shared<BswapNode>(expr);
+      SharedAbstractNode node = std::allocate_shared<BswapNode>(this->allocator, expr, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bswap(): Not enough memory.");
       node->init();
@@ -89,16 +519,71 @@ namespace triton {
     }
 
 
-    SharedAbstractNode AstContext::bv(const triton::uint512& value, triton::uint32 size) {
-      SharedAbstractNode node = std::make_shared<BvNode>(value, size, this->shared_from_this());
+    /* Returns the slot of the shared constant of a width and a value */
+    static triton::usize constantSlot(const triton::uint512& value, triton::uint32 size, triton::uint32 smallConstants, triton::usize constantSlots) {
+      triton::usize width = 0;
+
+      switch (size) {
+        case 1:   width = 1; break;
+        case 8:   width = 2; break;
+        case 16:  width = 3; break;
+        case 32:  width = 4; break;
+        case 64:  width = 5; break;
+        case 128: width = 6; break;
+        case 256: width = 7; break;
+        case 512: width = 8; break;
+        default:  break;
+      }
+
+      if (width && value < smallConstants)
+        return (width - 1) * smallConstants + value.convert_to<triton::usize>();
+
+      triton::uint64 key = mixKey(size, (value & std::numeric_limits<triton::uint64>::max()).convert_to<triton::uint64>());
+      key = mixKey(key, ((value >> 64) & std::numeric_limits<triton::uint64>::max()).convert_to<triton::uint64>());
+      return (8 * smallConstants) + (key % constantSlots);
+    }
+
+
+    /*
+     * Constants are shared: bv(0, 1), bv(1, 1) and the small immediates are
+     * built by almost every instruction. A shared constant is frozen, so that
+     * it keeps no link to its many parents and cannot be modified by one of
+     * them. Slots only keep weak references, a dead constant is built again.
+     */
+    SharedAbstractNode AstContext::bv(const triton::uint512& value, triton::uint32 size, bool share) {
+      triton::usize slot = 0;
+
+      if (share && size && size <= triton::bitsize::max_supported) {
+        triton::uint512 masked = (size == triton::bitsize::max_supported) ? value : value & ((triton::uint512(1) << size) - 1);
+
+        if (this->constants.empty())
+          this->constants.resize((8 * smallConstants) + constantSlots);
+
+        slot = constantSlot(masked, size, smallConstants, constantSlots);
+        SharedAbstractNode constant = this->constants[slot].lock();
+        if (constant != nullptr && constant->getBitvectorSize() == size && constant->evaluate() == masked)
+          return constant;
+      }
+
+      SharedAbstractNode node = std::allocate_shared<BvNode>(this->allocator, value, size, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bv(): Not enough memory.");
       node->init();
-      return this->collect(node);
+
+      if (share && size && size <= triton::bitsize::max_supported) {
+        node->freeze();
+        this->constants[slot] = node;
+        return node;
+      }
+
+      return this->collect(node, share);
     }
 
 
     SharedAbstractNode AstContext::bvadd(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
+      if (this->modes->isModeEnabled(triton::modes::AST_NARY))
+        return this->associative(BVADD_NODE, {expr1, expr2});
+
       if (this->modes->isModeEnabled(triton::modes::AST_OPTIMIZATIONS)) {
         /* Optimization: 0 + A = A */
         if (!expr1->isSymbolized() && expr1->evaluate() == 0)
@@ -109,13 +594,13 @@ namespace triton {
           return expr1;
       }
 
-      SharedAbstractNode node = std::make_shared<BvaddNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvaddNode>(this->allocator, expr1, expr2, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvadd(): Not enough memory.");
       node->init();
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
-        if (node->isSymbolized() == false) {
+        if (this->hasConstantValue(node)) {
           return this->bv(node->evaluate(), node->getBitvectorSize());
         }
       }
@@ -124,7 +609,14 @@ namespace triton {
     }
 
 
+    template TRITON_EXPORT SharedAbstractNode AstContext::bvadd(const std::vector<SharedAbstractNode>& exprs);
+    template TRITON_EXPORT SharedAbstractNode AstContext::bvadd(const std::list<SharedAbstractNode>& exprs);
+
+
     SharedAbstractNode AstContext::bvand(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
+      if (this->modes->isModeEnabled(triton::modes::AST_NARY))
+        return this->associative(BVAND_NODE, {expr1, expr2});
+
       if (this->modes->isModeEnabled(triton::modes::AST_OPTIMIZATIONS)) {
         /* Optimization: 0 & A = 0 */
         if (!expr1->isSymbolized() && expr1->evaluate() == 0)
@@ -147,13 +639,13 @@ namespace triton {
           return expr1;
       }
 
-      SharedAbstractNode node = std::make_shared<BvandNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvandNode>(this->allocator, expr1, expr2, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvand(): Not enough memory.");
       node->init();
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
-        if (node->isSymbolized() == false) {
+        if (this->hasConstantValue(node)) {
           return this->bv(node->evaluate(), node->getBitvectorSize());
         }
       }
@@ -162,6 +654,10 @@ namespace triton {
     }
 
 
+    template TRITON_EXPORT SharedAbstractNode AstContext::bvand(const std::vector<SharedAbstractNode>& exprs);
+    template TRITON_EXPORT SharedAbstractNode AstContext::bvand(const std::list<SharedAbstractNode>& exprs);
+
+
     SharedAbstractNode AstContext::bvashr(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
       if (this->modes->isModeEnabled(triton::modes::AST_OPTIMIZATIONS)) {
         /* Optimization: 0 >> A = 0 */
@@ -173,13 +669,13 @@ namespace triton {
           return expr1;
       }
 
-      SharedAbstractNode node = std::make_shared<BvashrNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvashrNode>(this->allocator, expr1, expr2, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvashr(): Not enough memory.");
       node->init();
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
-        if (node->isSymbolized() == false) {
+        if (this->hasConstantValue(node)) {
           return this->bv(node->evaluate(), node->getBitvectorSize());
         }
       }
@@ -189,7 +685,7 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::bvfalse(void) {
-      SharedAbstractNode node = std::make_shared<BvNode>(0, 1, this->shared_from_this());
+      SharedAbstractNode node = std::allocate_shared<BvNode>(this->allocator, 0, 1, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvfalse(): Not enough memory.");
       node->init();
@@ -197,6 +693,106 @@ namespace triton {
     }
 
 
+    SharedAbstractNode AstContext::bvlaneadd(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, triton::uint32 lane) {
+      if (this->modes->isModeEnabled(triton::modes::AST_OPTIMIZATIONS)) {
+        /* Optimization: 0 + A = A */
+        if (!expr1->isSymbolized() && expr1->evaluate() == 0)
+          return expr2;
+
+        /* Optimization: A + 0 = A */
+        if (!expr2->isSymbolized() && expr2->evaluate() == 0)
+          return expr1;
+      }
+
+      SharedAbstractNode node = std::allocate_shared<BvlaneaddNode>(this->allocator, expr1, expr2, lane, this->shared_from_this());
+      if (node == nullptr)
+        throw triton::exceptions::Ast("AstContext::bvlaneadd(): Not enough memory.");
+      node->init();
+
+      if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
+        if (this->hasConstantValue(node)) {
+          return this->bv(node->evaluate(), node->getBitvectorSize());
+        }
+      }
+
+      return this->collect(node);
+    }
+
+
+    SharedAbstractNode AstContext::bvlaneeq(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, triton::uint32 lane) {
+      SharedAbstractNode node = std::allocate_shared<BvlaneeqNode>(this->allocator, expr1, expr2, lane, this->shared_from_this());
+      if (node == nullptr)
+        throw triton::exceptions::Ast("AstContext::bvlaneeq(): Not enough memory.");
+      node->init();
+
+      if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
+        if (this->hasConstantValue(node)) {
+          return this->bv(node->evaluate(), node->getBitvectorSize());
+        }
+      }
+
+      return this->collect(node);
+    }
+
+
+    SharedAbstractNode AstContext::bvlaneselect(const SharedAbstractNode& mask, const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, triton::uint32 lane) {
+      SharedAbstractNode node = std::allocate_shared<BvlaneselectNode>(this->allocator, mask, expr1, expr2, lane, this->shared_from_this());
+      if (node == nullptr)
+        throw triton::exceptions::Ast("AstContext::bvlaneselect(): Not enough memory.");
+      node->init();
+
+      if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
+        if (this->hasConstantValue(node)) {
+          return this->bv(node->evaluate(), node->getBitvectorSize());
+        }
+      }
+
+      return this->collect(node);
+    }
+
+
+    SharedAbstractNode AstContext::bvlanesgt(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, triton::uint32 lane) {
+      SharedAbstractNode node = std::allocate_shared<BvlanesgtNode>(this->allocator, expr1, expr2, lane, this->shared_from_this());
+      if (node == nullptr)
+        throw triton::exceptions::Ast("AstContext::bvlanesgt(): Not enough memory.");
+      node->init();
+
+      if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
+        if (this->hasConstantValue(node)) {
+          return this->bv(node->evaluate(), node->getBitvectorSize());
+        }
+      }
+
+      return this->collect(node);
+    }
+
+
+    SharedAbstractNode AstContext::bvlanesub(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, triton::uint32 lane) {
+      if (this->modes->isModeEnabled(triton::modes::AST_OPTIMIZATIONS)) {
+        /* Optimization: A - 0 = A */
+        if (!expr2->isSymbolized() && expr2->evaluate() == 0)
+          return expr1;
+
+        /* Optimization: A - A = 0 */
+        if (expr1->equalTo(expr2))
+          return this->bv(0, expr1->getBitvectorSize());
+      }
+
+      SharedAbstractNode node = std::allocate_shared<BvlanesubNode>(this->allocator, expr1, expr2, lane, this->shared_from_this());
+      if (node == nullptr)
+        throw triton::exceptions::Ast("AstContext::bvlanesub(): Not enough memory.");
+      node->init();
+
+      if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
+        if (this->hasConstantValue(node)) {
+          return this->bv(node->evaluate(), node->getBitvectorSize());
+        }
+      }
+
+      return this->collect(node);
+    }
+
+
     SharedAbstractNode AstContext::bvlshr(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
       if (this->modes->isModeEnabled(triton::modes::AST_OPTIMIZATIONS)) {
         /* Optimization: 0 >> A = 0 */
@@ -212,13 +808,13 @@ namespace triton {
           return this->bv(0, expr1->getBitvectorSize());
       }
 
-      SharedAbstractNode node = std::make_shared<BvlshrNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvlshrNode>(this->allocator, expr1, expr2, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvlshr(): Not enough memory.");
       node->init();
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
-        if (node->isSymbolized() == false) {
+        if (this->hasConstantValue(node)) {
           return this->bv(node->evaluate(), node->getBitvectorSize());
         }
       }
@@ -246,13 +842,13 @@ namespace triton {
           return expr1;
       }
 
-      SharedAbstractNode node = std::make_shared<BvmulNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvmulNode>(this->allocator, expr1, expr2, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvmul(): Not enough memory.");
       node->init();
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
-        if (node->isSymbolized() == false) {
+        if (this->hasConstantValue(node)) {
           return this->bv(node->evaluate(), node->getBitvectorSize());
         }
       }
@@ -262,13 +858,13 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::bvnand(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvnandNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvnandNode>(this->allocator, expr1, expr2, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvnand(): Not enough memory.");
       node->init();
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
-        if (node->isSymbolized() == false) {
+        if (this->hasConstantValue(node)) {
           return this->bv(node->evaluate(), node->getBitvectorSize());
         }
       }
@@ -278,13 +874,13 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::bvneg(const SharedAbstractNode& expr) {
-      SharedAbstractNode node = std::make_shared<BvnegNode>(expr);
+      SharedAbstractNode node = std::allocate_shared<BvnegNode>(this->allocator, expr, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvneg(): Not enough memory.");
       node->init();
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
-        if (node->isSymbolized() == false) {
+        if (this->hasConstantValue(node)) {
           return this->bv(node->evaluate(), node->getBitvectorSize());
         }
       }
@@ -294,13 +890,13 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::bvnor(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvnorNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvnorNode>(this->allocator, expr1, expr2, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvnor(): Not enough memory.");
       node->init();
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
-        if (node->isSymbolized() == false) {
+        if (this->hasConstantValue(node)) {
           return this->bv(node->evaluate(), node->getBitvectorSize());
         }
       }
@@ -310,13 +906,13 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::bvnot(const SharedAbstractNode& expr) {
-      SharedAbstractNode node = std::make_shared<BvnotNode>(expr);
+      SharedAbstractNode node = std::allocate_shared<BvnotNode>(this->allocator, expr, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvnot(): Not enough memory.");
       node->init();
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
-        if (node->isSymbolized() == false) {
+        if (this->hasConstantValue(node)) {
           return this->bv(node->evaluate(), node->getBitvectorSize());
         }
       }
@@ -326,6 +922,9 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::bvor(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
+      if (this->modes->isModeEnabled(triton::modes::AST_NARY))
+        return this->associative(BVOR_NODE, {expr1, expr2});
+
       if (this->modes->isModeEnabled(triton::modes::AST_OPTIMIZATIONS)) {
         /* Optimization: 0 | A = A */
         if (!expr1->isSymbolized() && expr1->evaluate() == 0)
@@ -343,18 +942,54 @@ namespace triton {
         if (!expr2->isSymbolized() && expr2->evaluate() == expr2->getBitvectorMask())
           return this->bv(expr2->getBitvectorMask(), expr2->getBitvectorSize());
 
-        /* Optimization: A | A = A */
-        if (expr1->equalTo(expr2))
-          return expr1;
+        /* Optimization: A | A = A */
+        if (expr1->equalTo(expr2))
+          return expr1;
+      }
+
+      SharedAbstractNode node = std::allocate_shared<BvorNode>(this->allocator, expr1, expr2, this->shared_from_this());
+      if (node == nullptr)
+        throw triton::exceptions::Ast("AstContext::bvor(): Not enough memory.");
+      node->init();
+
+      if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
+        if (this->hasConstantValue(node)) {
+          return this->bv(node->evaluate(), node->getBitvectorSize());
+        }
+      }
+
+      return this->collect(node);
+    }
+
+
+    template TRITON_EXPORT SharedAbstractNode AstContext::bvor(const std::vector<SharedAbstractNode>& exprs);
+    template TRITON_EXPORT SharedAbstractNode AstContext::bvor(const std::list<SharedAbstractNode>& exprs);
+
+
+    SharedAbstractNode AstContext::bvparity(const SharedAbstractNode& expr) {
+      SharedAbstractNode node = std::allocate_shared<BvparityNode>(this->allocator, expr, this->shared_from_this());
+      if (node == nullptr)
+        throw triton::exceptions::Ast("AstContext::bvparity(): Not enough memory.");
+      node->init();
+
+      if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
+        if (this->hasConstantValue(node)) {
+          return this->bv(node->evaluate(), node->getBitvectorSize());
+        }
       }
 
-      SharedAbstractNode node = std::make_shared<BvorNode>(expr1, expr2);
+      return this->collect(node);
+    }
+
+
+    SharedAbstractNode AstContext::bvpopcount(const SharedAbstractNode& expr) {
+      SharedAbstractNode node = std::allocate_shared<BvpopcountNode>(this->allocator, expr, this->shared_from_this());
       if (node == nullptr)
-        throw triton::exceptions::Ast("AstContext::bvor(): Not enough memory.");
+        throw triton::exceptions::Ast("AstContext::bvpopcount(): Not enough memory.");
       node->init();
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
-        if (node->isSymbolized() == false) {
+        if (this->hasConstantValue(node)) {
           return this->bv(node->evaluate(), node->getBitvectorSize());
         }
       }
@@ -364,13 +999,13 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::bvrol(const SharedAbstractNode& expr, triton::uint32 rot) {
-      SharedAbstractNode node = std::make_shared<BvrolNode>(expr, rot);
+      SharedAbstractNode node = std::allocate_shared<BvrolNode>(this->allocator, expr, rot, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvrol(): Not enough memory.");
       node->init();
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
-        if (node->isSymbolized() == false) {
+        if (this->hasConstantValue(node)) {
           return this->bv(node->evaluate(), node->getBitvectorSize());
         }
       }
@@ -398,13 +1033,13 @@ namespace triton {
       }
 
       /* Otherwise, we concretize the index rotation */
-      SharedAbstractNode node = std::make_shared<BvrolNode>(expr, this->integer(rot->evaluate()));
+      SharedAbstractNode node = std::allocate_shared<BvrolNode>(this->allocator, expr, this->integer(rot->evaluate()), this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvrol(): Not enough memory.");
       node->init();
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
-        if (node->isSymbolized() == false) {
+        if (this->hasConstantValue(node)) {
           return this->bv(node->evaluate(), node->getBitvectorSize());
         }
       }
@@ -414,13 +1049,13 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::bvror(const SharedAbstractNode& expr, triton::uint32 rot) {
-      SharedAbstractNode node = std::make_shared<BvrorNode>(expr, rot);
+      SharedAbstractNode node = std::allocate_shared<BvrorNode>(this->allocator, expr, rot, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvror(): Not enough memory.");
       node->init();
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
-        if (node->isSymbolized() == false) {
+        if (this->hasConstantValue(node)) {
           return this->bv(node->evaluate(), node->getBitvectorSize());
         }
       }
@@ -448,13 +1083,13 @@ namespace triton {
       }
 
       /* Otherwise, we concretize the index rotation */
-      SharedAbstractNode node = std::make_shared<BvrorNode>(expr, this->integer(rot->evaluate()));
+      SharedAbstractNode node = std::allocate_shared<BvrorNode>(this->allocator, expr, this->integer(rot->evaluate()), this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvror(): Not enough memory.");
       node->init();
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
-        if (node->isSymbolized() == false) {
+        if (this->hasConstantValue(node)) {
           return this->bv(node->evaluate(), node->getBitvectorSize());
         }
       }
@@ -470,13 +1105,13 @@ namespace triton {
           return expr1;
       }
 
-      SharedAbstractNode node = std::make_shared<BvsdivNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvsdivNode>(this->allocator, expr1, expr2, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvsdiv(): Not enough memory.");
       node->init();
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
-        if (node->isSymbolized() == false) {
+        if (this->hasConstantValue(node)) {
           return this->bv(node->evaluate(), node->getBitvectorSize());
         }
       }
@@ -486,19 +1121,33 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::bvsge(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvsgeNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvsgeNode>(this->allocator, expr1, expr2, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvsge(): Not enough memory.");
       node->init();
+
+      if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
+        if (node->isSymbolized() && this->hasConstantValue(node)) {
+          return this->equal(this->bvtrue(), this->bv(node->evaluate(), 1));
+        }
+      }
+
       return this->collect(node);
     }
 
 
     SharedAbstractNode AstContext::bvsgt(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvsgtNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvsgtNode>(this->allocator, expr1, expr2, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvsgt(): Not enough memory.");
       node->init();
+
+      if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
+        if (node->isSymbolized() && this->hasConstantValue(node)) {
+          return this->equal(this->bvtrue(), this->bv(node->evaluate(), 1));
+        }
+      }
+
       return this->collect(node);
     }
 
@@ -518,13 +1167,13 @@ namespace triton {
           return this->bv(0, expr1->getBitvectorSize());
       }
 
-      SharedAbstractNode node = std::make_shared<BvshlNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvshlNode>(this->allocator, expr1, expr2, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvshl(): Not enough memory.");
       node->init();
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
-        if (node->isSymbolized() == false) {
+        if (this->hasConstantValue(node)) {
           return this->bv(node->evaluate(), node->getBitvectorSize());
         }
       }
@@ -534,31 +1183,45 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::bvsle(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvsleNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvsleNode>(this->allocator, expr1, expr2, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvsle(): Not enough memory.");
       node->init();
+
+      if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
+        if (node->isSymbolized() && this->hasConstantValue(node)) {
+          return this->equal(this->bvtrue(), this->bv(node->evaluate(), 1));
+        }
+      }
+
       return this->collect(node);
     }
 
 
     SharedAbstractNode AstContext::bvslt(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvsltNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvsltNode>(this->allocator, expr1, expr2, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvslt(): Not enough memory.");
       node->init();
+
+      if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
+        if (node->isSymbolized() && this->hasConstantValue(node)) {
+          return this->equal(this->bvtrue(), this->bv(node->evaluate(), 1));
+        }
+      }
+
       return this->collect(node);
     }
 
 
     SharedAbstractNode AstContext::bvsmod(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvsmodNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvsmodNode>(this->allocator, expr1, expr2, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvsmod(): Not enough memory.");
       node->init();
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
-        if (node->isSymbolized() == false) {
+        if (this->hasConstantValue(node)) {
           return this->bv(node->evaluate(), node->getBitvectorSize());
         }
       }
@@ -568,13 +1231,13 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::bvsrem(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvsremNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvsremNode>(this->allocator, expr1, expr2, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvsrem(): Not enough memory.");
       node->init();
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
-        if (node->isSymbolized() == false) {
+        if (this->hasConstantValue(node)) {
           return this->bv(node->evaluate(), node->getBitvectorSize());
         }
       }
@@ -598,13 +1261,13 @@ namespace triton {
           return this->bv(0, expr1->getBitvectorSize());
       }
 
-      SharedAbstractNode node = std::make_shared<BvsubNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvsubNode>(this->allocator, expr1, expr2, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvsub(): Not enough memory.");
       node->init();
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
-        if (node->isSymbolized() == false) {
+        if (this->hasConstantValue(node)) {
           return this->bv(node->evaluate(), node->getBitvectorSize());
         }
       }
@@ -614,7 +1277,7 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::bvtrue(void) {
-      SharedAbstractNode node = std::make_shared<BvNode>(1, 1, this->shared_from_this());
+      SharedAbstractNode node = std::allocate_shared<BvNode>(this->allocator, 1, 1, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvtrue(): Not enough memory.");
       node->init();
@@ -629,13 +1292,13 @@ namespace triton {
           return expr1;
       }
 
-      SharedAbstractNode node = std::make_shared<BvudivNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvudivNode>(this->allocator, expr1, expr2, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvudiv(): Not enough memory.");
       node->init();
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
-        if (node->isSymbolized() == false) {
+        if (this->hasConstantValue(node)) {
           return this->bv(node->evaluate(), node->getBitvectorSize());
         }
       }
@@ -645,49 +1308,77 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::bvuge(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvugeNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvugeNode>(this->allocator, expr1, expr2, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvuge(): Not enough memory.");
       node->init();
+
+      if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
+        if (node->isSymbolized() && this->hasConstantValue(node)) {
+          return this->equal(this->bvtrue(), this->bv(node->evaluate(), 1));
+        }
+      }
+
       return this->collect(node);
     }
 
 
     SharedAbstractNode AstContext::bvugt(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvugtNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvugtNode>(this->allocator, expr1, expr2, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvugt(): Not enough memory.");
       node->init();
+
+      if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
+        if (node->isSymbolized() && this->hasConstantValue(node)) {
+          return this->equal(this->bvtrue(), this->bv(node->evaluate(), 1));
+        }
+      }
+
       return this->collect(node);
     }
 
 
     SharedAbstractNode AstContext::bvule(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvuleNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvuleNode>(this->allocator, expr1, expr2, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvule(): Not enough memory.");
       node->init();
+
+      if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
+        if (node->isSymbolized() && this->hasConstantValue(node)) {
+          return this->equal(this->bvtrue(), this->bv(node->evaluate(), 1));
+        }
+      }
+
       return this->collect(node);
     }
 
 
     SharedAbstractNode AstContext::bvult(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvultNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvultNode>(this->allocator, expr1, expr2, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvult(): Not enough memory.");
       node->init();
+
+      if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
+        if (node->isSymbolized() && this->hasConstantValue(node)) {
+          return this->equal(this->bvtrue(), this->bv(node->evaluate(), 1));
+        }
+      }
+
       return this->collect(node);
     }
 
 
     SharedAbstractNode AstContext::bvurem(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvuremNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvuremNode>(this->allocator, expr1, expr2, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvurem(): Not enough memory.");
       node->init();
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
-        if (node->isSymbolized() == false) {
+        if (this->hasConstantValue(node)) {
           return this->bv(node->evaluate(), node->getBitvectorSize());
         }
       }
@@ -697,13 +1388,13 @@ namespace triton {
 
 
      SharedAbstractNode AstContext::bvxnor(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvxnorNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvxnorNode>(this->allocator, expr1, expr2, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvxnor(): Not enough memory.");
       node->init();
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
-        if (node->isSymbolized() == false) {
+        if (this->hasConstantValue(node)) {
           return this->bv(node->evaluate(), node->getBitvectorSize());
         }
       }
@@ -713,6 +1404,9 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::bvxor(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
+      if (this->modes->isModeEnabled(triton::modes::AST_NARY))
+        return this->associative(BVXOR_NODE, {expr1, expr2});
+
       if (this->modes->isModeEnabled(triton::modes::AST_OPTIMIZATIONS)) {
         /* Optimization: A ^ 0 = A */
         if (!expr2->isSymbolized() && expr2->evaluate() == 0)
@@ -727,13 +1421,13 @@ namespace triton {
           return this->bv(0, expr1->getBitvectorSize());
       }
 
-      SharedAbstractNode node = std::make_shared<BvxorNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvxorNode>(this->allocator, expr1, expr2, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvxor(): Not enough memory.");
       node->init();
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
-        if (node->isSymbolized() == false) {
+        if (this->hasConstantValue(node)) {
           return this->bv(node->evaluate(), node->getBitvectorSize());
         }
       }
@@ -742,18 +1436,22 @@ namespace triton {
     }
 
 
+    template TRITON_EXPORT SharedAbstractNode AstContext::bvxor(const std::vector<SharedAbstractNode>& exprs);
+    template TRITON_EXPORT SharedAbstractNode AstContext::bvxor(const std::list<SharedAbstractNode>& exprs);
+
+
     template TRITON_EXPORT SharedAbstractNode AstContext::compound(const std::vector<SharedAbstractNode>& exprs);
     template TRITON_EXPORT SharedAbstractNode AstContext::compound(const std::list<SharedAbstractNode>& exprs);
 
 
     SharedAbstractNode AstContext::concat(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<ConcatNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<ConcatNode>(this->allocator, expr1, expr2, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::concat(): Not enough memory.");
       node->init();
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
-        if (node->isSymbolized() == false) {
+        if (this->hasConstantValue(node)) {
           return this->bv(node->evaluate(), node->getBitvectorSize());
         }
       }
@@ -775,7 +1473,7 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::declare(const SharedAbstractNode& var) {
-      SharedAbstractNode node = std::make_shared<DeclareNode>(var);
+      SharedAbstractNode node = std::allocate_shared<DeclareNode>(this->allocator, var, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::declare(): Not enough memory.");
       node->init();
@@ -784,19 +1482,33 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::distinct(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<DistinctNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<DistinctNode>(this->allocator, expr1, expr2, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::distinct(): Not enough memory.");
       node->init();
+
+      if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
+        if (node->isSymbolized() && this->hasConstantValue(node)) {
+          return this->equal(this->bvtrue(), this->bv(node->evaluate(), 1));
+        }
+      }
+
       return this->collect(node);
     }
 
 
     SharedAbstractNode AstContext::equal(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<EqualNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<EqualNode>(this->allocator, expr1, expr2, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::equal(): Not enough memory.");
       node->init();
+
+      if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
+        if (node->isSymbolized() && this->hasConstantValue(node)) {
+          return this->equal(this->bvtrue(), this->bv(node->evaluate(), 1));
+        }
+      }
+
       return this->collect(node);
     }
 
@@ -813,13 +1525,13 @@ namespace triton {
         }
       }
 
-      SharedAbstractNode node = std::make_shared<ExtractNode>(high, low, expr);
+      SharedAbstractNode node = std::allocate_shared<ExtractNode>(this->allocator, high, low, expr, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::extract(): Not enough memory.");
       node->init();
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
-        if (node->isSymbolized() == false) {
+        if (this->hasConstantValue(node)) {
           return this->bv(node->evaluate(), node->getBitvectorSize());
         }
       }
@@ -833,7 +1545,7 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::iff(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<IffNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<IffNode>(this->allocator, expr1, expr2, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::iff(): Not enough memory.");
       node->init();
@@ -842,7 +1554,7 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::integer(const triton::uint512& value) {
-      SharedAbstractNode node = std::make_shared<IntegerNode>(value, this->shared_from_this());
+      SharedAbstractNode node = std::allocate_shared<IntegerNode>(this->allocator, value, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::integer(): Not enough memory.");
       node->init();
@@ -854,12 +1566,12 @@ namespace triton {
       if (this->modes->isModeEnabled(triton::modes::AST_OPTIMIZATIONS) ||
           this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
         /* Optimization: False ? A : B => B, True ? A : B => A */
-        if (!ifExpr->isSymbolized()) {
+        if (this->hasConstantValue(ifExpr)) {
           return ifExpr->evaluate() ? thenExpr : elseExpr;
         }
       }
 
-      SharedAbstractNode node = std::make_shared<IteNode>(ifExpr, thenExpr, elseExpr);
+      SharedAbstractNode node = std::allocate_shared<IteNode>(this->allocator, ifExpr, thenExpr, elseExpr, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::ite(): Not enough memory.");
       node->init();
@@ -868,8 +1580,20 @@ namespace triton {
     }
 
 
+    SharedAbstractNode AstContext::iteFold(const SharedAbstractNode& ifExpr, const SharedAbstractNode& thenExpr, const SharedAbstractNode& elseExpr) {
+      /* A concrete condition keeps its value, only the selected expression is assigned */
+      if (ifExpr->isSymbolized() == false) {
+        return ifExpr->evaluate() ? thenExpr : elseExpr;
+      }
+      return this->ite(ifExpr, thenExpr, elseExpr);
+    }
+
+
     SharedAbstractNode AstContext::land(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<LandNode>(expr1, expr2);
+      if (this->modes->isModeEnabled(triton::modes::AST_NARY))
+        return this->associative(LAND_NODE, {expr1, expr2});
+
+      SharedAbstractNode node = std::allocate_shared<LandNode>(this->allocator, expr1, expr2, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::land(): Not enough memory.");
       node->init();
@@ -882,7 +1606,7 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::let(std::string alias, const SharedAbstractNode& expr2, const SharedAbstractNode& expr3) {
-      SharedAbstractNode node = std::make_shared<LetNode>(alias, expr2, expr3);
+      SharedAbstractNode node = std::allocate_shared<LetNode>(this->allocator, alias, expr2, expr3, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::let(): Not enough memory.");
       node->init();
@@ -891,7 +1615,7 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::lnot(const SharedAbstractNode& expr) {
-      SharedAbstractNode node = std::make_shared<LnotNode>(expr);
+      SharedAbstractNode node = std::allocate_shared<LnotNode>(this->allocator, expr, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::lnot(): Not enough memory.");
       node->init();
@@ -900,7 +1624,10 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::lor(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<LorNode>(expr1, expr2);
+      if (this->modes->isModeEnabled(triton::modes::AST_NARY))
+        return this->associative(LOR_NODE, {expr1, expr2});
+
+      SharedAbstractNode node = std::allocate_shared<LorNode>(this->allocator, expr1, expr2, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::lor(): Not enough memory.");
       node->init();
@@ -913,7 +1640,7 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::lxor(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<LxorNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<LxorNode>(this->allocator, expr1, expr2, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::lxor(): Not enough memory");
       node->init();
@@ -926,7 +1653,26 @@ namespace triton {
 
 
     SharedAbstractNode AstContext::reference(const triton::engines::symbolic::SharedSymbolicExpression& expr) {
-      SharedAbstractNode node = std::make_shared<ReferenceNode>(expr);
+      if (this->modes->isModeEnabled(triton::modes::AST_OPTIMIZATIONS)) {
+        const SharedAbstractNode& ast = expr->getAst();
+        if (ast != nullptr) {
+          /*
+           * Optimization: a reference to an expression which is itself a reference is the
+           * inner reference, so that chains do not grow through the copies of a value, and
+           * a constant or a variable is shared instead of being referenced.
+           */
+          switch (ast->getType()) {
+            case REFERENCE_NODE:
+            case BV_NODE:
+            case VARIABLE_NODE:
+              return ast;
+            default:
+              break;
+          }
+        }
+      }
+
+      SharedAbstractNode node = std::allocate_shared<ReferenceNode>(this->allocator, expr, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::reference(): Not enough memory.");
       node->init();
@@ -934,8 +1680,39 @@ namespace triton {
     }
 
 
+    SharedAbstractNode AstContext::select(const SharedAbstractNode& array, const SharedAbstractNode& index) {
+      if (this->modes->isModeEnabled(triton::modes::AST_OPTIMIZATIONS)) {
+        /* Optimization: read over write. The stores at other concrete indexes are skipped */
+        SharedAbstractNode ptr = triton::ast::dereference(array);
+        while (ptr->getType() == STORE_NODE) {
+          const SharedAbstractNode& storeIndex = ptr->getChildren()[1];
+          if (storeIndex == index || (!storeIndex->isSymbolized() && !index->isSymbolized() && storeIndex->evaluate() == index->evaluate()))
+            return ptr->getChildren()[2];
+          if (storeIndex->isSymbolized() || index->isSymbolized())
+            break;
+          ptr = triton::ast::dereference(ptr->getChildren()[0]);
+        }
+      }
+
+      SharedAbstractNode node = std::allocate_shared<SelectNode>(this->allocator, array, index, this->shared_from_this());
+      if (node == nullptr)
+        throw triton::exceptions::Ast("AstContext::select(): Not enough memory.");
+      node->init();
+      return this->collect(node);
+    }
+
+
+    SharedAbstractNode AstContext::store(const SharedAbstractNode& array, const SharedAbstractNode& index, const SharedAbstractNode& value) {
+      SharedAbstractNode node = std::allocate_shared<StoreNode>(this->allocator, array, index, value, this->shared_from_this());
+      if (node == nullptr)
+        throw triton::exceptions::Ast("AstContext::store(): Not enough memory.");
+      node->init();
+      return this->collect(node);
+    }
+
+
     SharedAbstractNode AstContext::string(std::string value) {
-      SharedAbstractNode node = std::make_shared<StringNode>(value, this->shared_from_this());
+      SharedAbstractNode node = std::allocate_shared<StringNode>(this->allocator, value, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::string(): Not enough memory.");
       node->init();
@@ -948,13 +1725,13 @@ namespace triton {
       if (sizeExt == 0)
         return expr;
 
-      SharedAbstractNode node = std::make_shared<SxNode>(sizeExt, expr);
+      SharedAbstractNode node = std::allocate_shared<SxNode>(this->allocator, sizeExt, expr, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::sx(): Not enough memory.");
       node->init();
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
-        if (node->isSymbolized() == false) {
+        if (this->hasConstantValue(node)) {
           return this->bv(node->evaluate(), node->getBitvectorSize());
         }
       }
@@ -965,21 +1742,31 @@ namespace triton {
 
     SharedAbstractNode AstContext::variable(const triton::engines::symbolic::SharedSymbolicVariable& symVar) {
       // try to get node from variable pool
-      auto it = this->valueMapping.find(symVar->getName());
-      if (it != this->valueMapping.end()) {
-        if (auto node = it->second.first.lock()) {
+      triton::usize id = symVar->getId();
+      if (this->findVariable(id) != nullptr) {
+        VariableValue& entry = this->valueMapping[id];
+        if (auto node = entry.node.lock()) {
           if (node->getBitvectorSize() != symVar->getSize()) {
             throw triton::exceptions::Ast("AstContext::variable(): Missmatching variable size.");
           }
           // This node already exist, just return it
-          return node;
+          if (!node->isFrozen())
+            return node;
+          // A frozen node keeps its value, new nodes use a fresh variable node
+          SharedAbstractNode fresh = std::allocate_shared<VariableNode>(this->allocator, symVar, this->shared_from_this());
+          if (fresh == nullptr) {
+            throw triton::exceptions::Ast("AstContext::variable(): Not enough memory");
+          }
+          entry.node = fresh;
+          fresh->init();
+          return this->collect(fresh);
         }
         throw triton::exceptions::Ast("AstContext::variable(): This symbolic variable is dead.");
       }
       else {
         // if not found, create a new variable node
-        SharedAbstractNode node = std::make_shared<VariableNode>(symVar, this->shared_from_this());
-        this->initVariable(symVar->getName(), 0, node);
+        SharedAbstractNode node = std::allocate_shared<VariableNode>(this->allocator, symVar, this->shared_from_this());
+        this->initVariable(id, 0, node);
         if (node == nullptr) {
           throw triton::exceptions::Ast("AstContext::variable(): Not enough memory");
         }
@@ -994,13 +1781,13 @@ namespace triton {
       if (sizeExt == 0)
         return expr;
 
-      SharedAbstractNode node = std::make_shared<ZxNode>(sizeExt, expr);
+      SharedAbstractNode node = std::allocate_shared<ZxNode>(this->allocator, sizeExt, expr, this->shared_from_this());
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::zx(): Not enough memory.");
       node->init();
 
       if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
-        if (node->isSymbolized() == false) {
+        if (this->hasConstantValue(node)) {
           return this->bv(node->evaluate(), node->getBitvectorSize());
         }
       }
@@ -1009,57 +1796,307 @@ namespace triton {
     }
 
 
+    /* Returns the id of a variable name (see TRITON_SYMVAR_NAME), false if it is not the name of a variable */
+    static bool getVariableId(const std::string& name, triton::usize& id) {
+      const triton::usize prefix = sizeof(TRITON_SYMVAR_NAME) - 1;
+
+      if (name.size() <= prefix || name.compare(0, prefix, TRITON_SYMVAR_NAME) != 0)
+        return false;
+
+      /* Names are formatted from ids, without leading zeros */
+      if (name[prefix] == '0' && name.size() > prefix + 1)
+        return false;
+
+      id = 0;
+      for (triton::usize index = prefix; index < name.size(); index++) {
+        if (name[index] < '0' || name[index] > '9')
+          return false;
+        id = id * 10 + (name[index] - '0');
+      }
+
+      return true;
+    }
+
+
+    const AstContext::VariableValue* AstContext::findVariable(triton::usize id) const {
+      if (id >= this->valueMapping.size() || !this->valueMapping[id].initialized)
+        return nullptr;
+      return &this->valueMapping[id];
+    }
+
+
+    void AstContext::initVariable(triton::usize id, const triton::uint512& value, const SharedAbstractNode& node) {
+      if (this->findVariable(id) != nullptr)
+        throw triton::exceptions::Ast("AstContext::initVariable(): Ast variable already initialized.");
+
+      if (id >= this->valueMapping.size())
+        this->valueMapping.resize(id + 1, VariableValue{WeakAbstractNode(), 0, false});
+
+      this->valueMapping[id] = VariableValue{node, value, true};
+    }
+
+
     void AstContext::initVariable(const std::string& name, const triton::uint512& value, const SharedAbstractNode& node) {
-      auto it = this->valueMapping.find(name);
-      if (it == this->valueMapping.end()) {
-        this->valueMapping.insert(std::make_pair(name, std::make_pair(node, value)));
+      triton::usize id = 0;
+      if (!getVariableId(name, id))
+        throw triton::exceptions::Ast("AstContext::initVariable(): Invalid variable name.");
+      this->initVariable(id, value, node);
+    }
+
+
+    void AstContext::updateVariable(triton::usize id, const triton::uint512& value) {
+      if (this->findVariable(id) == nullptr)
+        throw triton::exceptions::Ast("AstContext::updateVariable(): This symbolic variable is not assigned at any AbstractNode or does not exist.");
+
+      VariableValue& entry = this->valueMapping[id];
+      if (auto node = entry.node.lock()) {
+        /* Nothing depends on the variable value if it does not change */
+        if (entry.value == value)
+          return;
+        entry.value = value;
+        /* Frozen nodes keep their evaluation */
+        if (!node->isFrozen())
+          this->reevaluate(id, node);
       }
       else {
-        throw triton::exceptions::Ast("AstContext::initVariable(): Ast variable already initialized.");
+        throw triton::exceptions::Ast("AstContext::updateVariable(): This symbolic variable is dead.");
       }
     }
 
 
     void AstContext::updateVariable(const std::string& name, const triton::uint512& value) {
-      auto it = this->valueMapping.find(name);
-      if (it != this->valueMapping.end()) {
-        if (auto node = it->second.first.lock()) {
-          it->second.second = value;
-          node->initParents();
+      triton::usize id = 0;
+      if (!getVariableId(name, id))
+        throw triton::exceptions::Ast("AstContext::updateVariable(): This symbolic variable is not assigned at any AbstractNode or does not exist.");
+      this->updateVariable(id, value);
+    }
+
+
+    void AstContext::reevaluate(triton::usize id, const SharedAbstractNode& node) {
+      auto& cone = this->cones[id];
+
+      /* The cone is computed again only if new parent links appeared since it was cached */
+      if (cone.second.empty() || cone.first != this->structureVersion) {
+        auto ancestors = parentsExtraction(node, false);
+        cone.second.assign(ancestors.begin(), ancestors.end());
+        cone.first = this->structureVersion;
+      }
+
+      /*
+       * Nodes are visited in topological order (the variable first). A node
+       * is re-initialized only if one of its dependencies changed, and it is
+       * marked as changed only if its value differs after re-initialization.
+       * The value of an array is not its cells, an array is always changed.
+       */
+      std::unordered_set<AbstractNode*> changed;
+      this->reevaluating = true;
+      for (const auto& weak : cone.second) {
+        SharedAbstractNode ancestor = weak.lock();
+        if (ancestor != nullptr)
+          this->reevaluateNode(ancestor, ancestor == node, changed);
+      }
+      this->reevaluating = false;
+    }
+
+
+    void AstContext::reevaluateNode(const SharedAbstractNode& node, bool root, std::unordered_set<AbstractNode*>& changed) {
+      if (!root) {
+        bool dirty = false;
+        if (node->getType() == REFERENCE_NODE) {
+          dirty = (changed.find(reinterpret_cast<ReferenceNode*>(node.get())->getSymbolicExpression()->getAst().get()) != changed.end());
         }
         else {
-          throw triton::exceptions::Ast("AstContext::updateVariable(): This symbolic variable is dead.");
+          for (const auto& child : node->getChildren()) {
+            if (changed.find(child.get()) != changed.end()) {
+              dirty = true;
+              break;
+            }
+          }
         }
+        if (!dirty)
+          return;
       }
-      else {
-        throw triton::exceptions::Ast("AstContext::updateVariable(): This symbolic variable is not assigned at any AbstractNode or does not exist.");
+
+      triton::uint512 before = node->evaluate();
+      node->init();
+      if (root || node->isArray() || node->evaluate() != before)
+        changed.insert(node.get());
+    }
+
+
+    void AstContext::updateVariables(const std::vector<std::pair<triton::usize, triton::uint512>>& values) {
+      std::vector<std::pair<VariableValue*, SharedAbstractNode>> entries;
+      std::vector<SharedAbstractNode> roots;
+      triton::usize id = 0;
+
+      /* All the variables are checked before a value is updated */
+      for (const auto& item : values) {
+        if (this->findVariable(item.first) == nullptr)
+          throw triton::exceptions::Ast("AstContext::updateVariables(): This symbolic variable is not assigned at any AbstractNode or does not exist.");
+
+        VariableValue& entry = this->valueMapping[item.first];
+        SharedAbstractNode node = entry.node.lock();
+        if (node == nullptr)
+          throw triton::exceptions::Ast("AstContext::updateVariables(): This symbolic variable is dead.");
+
+        entries.push_back({&entry, node});
+      }
+
+      for (triton::usize index = 0; index < values.size(); index++) {
+        VariableValue& entry = *entries[index].first;
+        const SharedAbstractNode& node = entries[index].second;
+
+        /* Nothing depends on the variable value if it does not change */
+        if (entry.value == values[index].second)
+          continue;
+        entry.value = values[index].second;
+
+        /* Frozen nodes keep their evaluation */
+        if (!node->isFrozen()) {
+          roots.push_back(node);
+          id = values[index].first;
+        }
+      }
+
+      if (roots.empty())
+        return;
+
+      /* A single variable reuses its cached cone */
+      if (roots.size() == 1) {
+        this->reevaluate(id, roots.front());
+        return;
       }
+
+      /* The union of the cones, sorted at once so that a node shared by several cones is re-evaluated once */
+      std::unordered_set<AbstractNode*> rootSet;
+      std::unordered_set<AbstractNode*> changed;
+
+      for (const auto& root : roots)
+        rootSet.insert(root.get());
+
+      auto ancestors = parentsExtraction(roots, false);
+      this->reevaluating = true;
+      for (const auto& ancestor : ancestors)
+        this->reevaluateNode(ancestor, rootSet.find(ancestor.get()) != rootSet.end(), changed);
+      this->reevaluating = false;
     }
 
 
-    SharedAbstractNode AstContext::getVariableNode(const std::string& name) {
-      auto it = this->valueMapping.find(name);
-      if (it != this->valueMapping.end()) {
-        if (auto node = it->second.first.lock())
-          return node;
-        else
-          throw triton::exceptions::Ast("AstContext::getVariableNode(): This symbolic variable is dead.");
+    void AstContext::bumpStructureVersion(void) {
+      this->structureVersion++;
+    }
+
+
+    triton::usize AstContext::getStructureVersion(void) const {
+      return this->structureVersion;
+    }
+
+
+    bool AstContext::isReevaluating(void) const {
+      return this->reevaluating;
+    }
+
+
+    void AstContext::bumpChildrenVersion(void) {
+      this->childrenVersion++;
+    }
+
+
+    /*
+     * Kinds of traversal: bit 0 is set for children, bit 1 if references are unrolled.
+     * Children only change through setChild() or a new AST given to an expression, while
+     * parents change each time a node is built.
+     */
+    triton::usize AstContext::getTraversalVersion(triton::uint32 kind) const {
+      return (kind & 1) ? this->childrenVersion : this->structureVersion;
+    }
+
+
+    bool AstContext::getCachedTraversal(const AbstractNode* node, bool unroll, bool descend, std::vector<SharedAbstractNode>& nodes) const {
+      triton::uint32 kind = (descend ? 1 : 0) | (unroll ? 2 : 0);
+
+      auto it = this->traversals.find({node, kind});
+      if (it == this->traversals.end() || it->second.first != this->getTraversalVersion(kind))
+        return false;
+
+      /* The root is the last node. If it is not `node`, the address has been reused */
+      const auto& entries = it->second.second;
+      if (entries.back().lock().get() != node)
+        return false;
+
+      nodes.clear();
+      nodes.reserve(entries.size());
+      for (const auto& entry : entries) {
+        /* A parent may have been released since */
+        SharedAbstractNode n = entry.lock();
+        if (n == nullptr) {
+          nodes.clear();
+          return false;
+        }
+        nodes.push_back(std::move(n));
       }
 
-      return nullptr;
+      return true;
     }
 
 
-    const triton::uint512& AstContext::getVariableValue(const std::string& name) const {
-      auto it = this->valueMapping.find(name);
-      if (it != this->valueMapping.end()) {
-        if (auto node = it->second.first.lock())
-          return it->second.second;
-        else
-          throw triton::exceptions::Ast("AstContext::getVariableValue(): This symbolic variable is dead.");
+    void AstContext::setCachedTraversal(const AbstractNode* node, bool unroll, bool descend, const std::vector<SharedAbstractNode>& nodes) {
+      triton::uint32 kind = (descend ? 1 : 0) | (unroll ? 2 : 0);
+
+      if (!this->modes->isModeEnabled(triton::modes::AST_TRAVERSAL_CACHE) || nodes.empty())
+        return;
+
+      if (this->traversalsSize + nodes.size() > this->traversalCacheBudget) {
+        this->traversals.clear();
+        this->traversalsSize = 0;
       }
 
-      throw triton::exceptions::Ast("AstContext::updateVariable(): Variable does not exist.");
+      auto& entry = this->traversals[{node, kind}];
+      this->traversalsSize -= entry.second.size();
+      this->traversalsSize += nodes.size();
+
+      entry.first = this->getTraversalVersion(kind);
+      entry.second.assign(nodes.begin(), nodes.end());
+    }
+
+
+    SharedAbstractNode AstContext::getVariableNode(triton::usize id) {
+      const VariableValue* entry = this->findVariable(id);
+      if (entry == nullptr)
+        return nullptr;
+
+      if (auto node = entry->node.lock())
+        return node;
+
+      throw triton::exceptions::Ast("AstContext::getVariableNode(): This symbolic variable is dead.");
+    }
+
+
+    SharedAbstractNode AstContext::getVariableNode(const std::string& name) {
+      triton::usize id = 0;
+      if (!getVariableId(name, id))
+        return nullptr;
+      return this->getVariableNode(id);
+    }
+
+
+    const triton::uint512& AstContext::getVariableValue(triton::usize id) const {
+      const VariableValue* entry = this->findVariable(id);
+      if (entry == nullptr)
+        throw triton::exceptions::Ast("AstContext::getVariableValue(): Variable does not exist.");
+
+      if (entry->node.expired())
+        throw triton::exceptions::Ast("AstContext::getVariableValue(): This symbolic variable is dead.");
+
+      return entry->value;
+    }
+
+
+    const triton::uint512& AstContext::getVariableValue(const std::string& name) const {
+      triton::usize id = 0;
+      if (!getVariableId(name, id))
+        throw triton::exceptions::Ast("AstContext::getVariableValue(): Variable does not exist.");
+      return this->getVariableValue(id);
     }
 
 
@@ -1078,6 +2115,170 @@ namespace triton {
     }
 
 
+    std::ostream& AstContext::printShared(std::ostream& stream, AbstractNode* node) {
+      return this->astRepresentation.printShared(stream, node);
+    }
+
+
+    std::ostream& AstContext::printBindings(std::ostream& stream, const std::vector<AbstractNode*>& roots) {
+      return this->astRepresentation.printBindings(stream, roots);
+    }
+
+
+    void AstContext::clearBindings(void) {
+      this->astRepresentation.clearBindings();
+    }
+
+
+    SharedAbstractNode AstContext::associative(triton::ast::ast_e kind, const std::vector<SharedAbstractNode>& exprs) {
+      if (exprs.empty())
+        throw triton::exceptions::Ast("AstContext::associative(): Must take at least one node.");
+
+      if (!this->modes->isModeEnabled(triton::modes::AST_NARY)) {
+        /* Two operands keep the optimizations of the binary builders */
+        if (exprs.size() == 2) {
+          switch (kind) {
+            case BVADD_NODE: return this->bvadd(exprs[0], exprs[1]);
+            case BVAND_NODE: return this->bvand(exprs[0], exprs[1]);
+            case BVOR_NODE:  return this->bvor(exprs[0], exprs[1]);
+            case BVXOR_NODE: return this->bvxor(exprs[0], exprs[1]);
+            default:
+              break;
+          }
+        }
+        return this->associativeNode(kind, exprs);
+      }
+
+      bool logical = (kind == LAND_NODE || kind == LOR_NODE);
+      triton::uint32 size = exprs[0]->getBitvectorSize();
+      triton::uint512 mask = exprs[0]->getBitvectorMask();
+
+      /* The neutral and the absorbing constants of the operator */
+      triton::uint512 identity = 0;
+      triton::uint512 absorbing = 0;
+      bool absorbs = false;
+      switch (kind) {
+        case BVADD_NODE:
+        case BVXOR_NODE:
+          break;
+        case BVAND_NODE:
+          identity = mask;
+          absorbs = true;
+          break;
+        case BVOR_NODE:
+          absorbing = mask;
+          absorbs = true;
+          break;
+        case LAND_NODE:
+          identity = 1;
+          absorbs = true;
+          break;
+        case LOR_NODE:
+          absorbing = 1;
+          absorbs = true;
+          break;
+        default:
+          throw triton::exceptions::Ast("AstContext::associative(): Invalid operator.");
+      }
+
+      /* Flattens the nested nodes of the operator, unless another node uses them, and merges the constants */
+      triton::uint512 constant = identity;
+      std::vector<SharedAbstractNode> operands;
+      std::vector<SharedAbstractNode> worklist(exprs.rbegin(), exprs.rend());
+      bool folding = this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING);
+
+      while (!worklist.empty()) {
+        SharedAbstractNode expr = std::move(worklist.back());
+        worklist.pop_back();
+
+        if (expr->getType() == kind && expr->getParents().empty()) {
+          const auto& children = expr->getChildren();
+          worklist.insert(worklist.end(), children.rbegin(), children.rend());
+          continue;
+        }
+
+        if ((!logical && expr->getType() == BV_NODE) || (folding && this->hasConstantValue(expr))) {
+          triton::uint512 value = expr->evaluate();
+          switch (kind) {
+            case BVADD_NODE: constant = (constant + value) & mask; break;
+            case BVAND_NODE: constant = constant & value; break;
+            case BVOR_NODE:  constant = constant | value; break;
+            case BVXOR_NODE: constant = constant ^ value; break;
+            case LAND_NODE:  constant = (constant != 0 && value != 0); break;
+            default:         constant = (constant != 0 || value != 0); break;
+          }
+          continue;
+        }
+
+        operands.push_back(expr);
+      }
+
+      if (absorbs && constant == absorbing)
+        return logical ? this->equal(this->bvtrue(), absorbing ? this->bvtrue() : this->bvfalse()) : this->bv(absorbing, size);
+
+      /* The operands are sorted by hash, the same operands in any order give the same node and equal ones are adjacent */
+      std::stable_sort(operands.begin(), operands.end(), [](const SharedAbstractNode& a, const SharedAbstractNode& b) {
+        return a->getHash() < b->getHash();
+      });
+
+      /* x & x = x, x | x = x and x ^ x = 0 */
+      if (kind != BVADD_NODE) {
+        std::vector<SharedAbstractNode> unique;
+        unique.reserve(operands.size());
+        for (auto& operand : operands) {
+          if (!unique.empty() && unique.back()->getHash() == operand->getHash() && unique.back()->equalTo(operand)) {
+            if (kind == BVXOR_NODE)
+              unique.pop_back();
+            continue;
+          }
+          unique.push_back(std::move(operand));
+        }
+        operands.swap(unique);
+      }
+
+      /* The constant is the last operand */
+      if (operands.empty() || constant != identity) {
+        if (logical)
+          operands.push_back(this->equal(this->bvtrue(), constant ? this->bvtrue() : this->bvfalse()));
+        else
+          operands.push_back(this->bv(constant, size));
+      }
+
+      if (operands.size() == 1)
+        return operands[0];
+
+      return this->associativeNode(kind, operands);
+    }
+
+
+    SharedAbstractNode AstContext::associativeNode(triton::ast::ast_e kind, const std::vector<SharedAbstractNode>& exprs) {
+      SharedAbstractNode node = nullptr;
+
+      switch (kind) {
+        case BVADD_NODE: node = std::allocate_shared<BvaddNode>(this->allocator, exprs, this->shared_from_this()); break;
+        case BVAND_NODE: node = std::allocate_shared<BvandNode>(this->allocator, exprs, this->shared_from_this()); break;
+        case BVOR_NODE:  node = std::allocate_shared<BvorNode>(this->allocator, exprs, this->shared_from_this());  break;
+        case BVXOR_NODE: node = std::allocate_shared<BvxorNode>(this->allocator, exprs, this->shared_from_this()); break;
+        case LAND_NODE:  node = std::allocate_shared<LandNode>(this->allocator, exprs, this->shared_from_this());  break;
+        case LOR_NODE:   node = std::allocate_shared<LorNode>(this->allocator, exprs, this->shared_from_this());   break;
+        default:
+          throw triton::exceptions::Ast("AstContext::associativeNode(): Invalid operator.");
+      }
+
+      if (node == nullptr)
+        throw triton::exceptions::Ast("AstContext::associativeNode(): Not enough memory.");
+      node->init();
+
+      if (kind != LAND_NODE && kind != LOR_NODE && this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
+        if (this->hasConstantValue(node)) {
+          return this->bv(node->evaluate(), node->getBitvectorSize());
+        }
+      }
+
+      return this->collect(node);
+    }
+
+
     SharedAbstractNode AstContext::simplify_concat(std::vector<SharedAbstractNode> exprs) {
       /*
        * Optimization: concatenate extractions in one if possible. We are
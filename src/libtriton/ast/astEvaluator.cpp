@@ -0,0 +1,959 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <stack>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <triton/astEvaluator.hpp>
+#include <triton/coreUtils.hpp>
+#include <triton/cpuSize.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/symbolicExpression.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    static inline triton::uint64 narrowMask(triton::uint32 size) {
+      return (size >= triton::bitsize::qword) ? static_cast<triton::uint64>(-1) : ((static_cast<triton::uint64>(1) << size) - 1);
+    }
+
+
+    static inline triton::uint512 wideMask(triton::uint32 size) {
+      triton::uint512 mask = -1;
+      mask = mask >> (512 - size);
+      return mask;
+    }
+
+
+    static inline triton::sint64 narrowSignExtend(triton::uint64 value, triton::uint32 size) {
+      if (size < triton::bitsize::qword && ((value >> (size - 1)) & 1))
+        value |= ~narrowMask(size);
+      return static_cast<triton::sint64>(value);
+    }
+
+
+    /* Returns true if the operator has a native implementation on 64-bit registers */
+    static bool isNarrowOperator(triton::ast::ast_e type) {
+      switch (type) {
+        /* Lane-wise operators are evaluated on the wide registers */
+        case BVLANEADD_NODE:
+        case BVLANEEQ_NODE:
+        case BVLANESELECT_NODE:
+        case BVLANESGT_NODE:
+        case BVLANESUB_NODE:
+        case BVSDIV_NODE:
+        case BVSMOD_NODE:
+        case BVSREM_NODE:
+          return false;
+        default:
+          return true;
+      }
+    }
+
+
+    /*
+     * Returns the stores of the array of a select above its deepest concrete stores, the
+     * last one first, and the cells of the array below them. The concrete stores are
+     * read from the cells, the other ones are compared with the index by the bytecode.
+     */
+    static const ArrayMemory& storesOf(AbstractNode* node, std::vector<AbstractNode*>& stores) {
+      std::vector<AbstractNode*> chain;
+      triton::usize symbolic = 0;
+
+      AbstractNode* array = triton::ast::dereference(node->getChildren()[0]).get();
+      while (array->getType() == STORE_NODE) {
+        const auto& children = array->getChildren();
+        chain.push_back(array);
+        if (children[1]->isSymbolized() || children[2]->isSymbolized())
+          symbolic = chain.size();
+        array = triton::ast::dereference(children[0]).get();
+      }
+      chain.push_back(array);
+
+      stores.assign(chain.begin(), chain.begin() + symbolic);
+      return triton::ast::getArrayMemory(chain[symbolic]->shared_from_this());
+    }
+
+
+    /* Returns the nodes whose values are read by the instruction of a node */
+    static std::vector<AbstractNode*> operandsOf(AbstractNode* node) {
+      std::vector<AbstractNode*> result;
+      const auto& children = node->getChildren();
+
+      switch (node->getType()) {
+        case REFERENCE_NODE:
+          result.push_back(reinterpret_cast<ReferenceNode*>(node)->getSymbolicExpression()->getAst().get());
+          break;
+
+        case BVROL_NODE:
+        case BVROR_NODE:
+        case DECLARE_NODE:
+          result.push_back(children[0].get());
+          break;
+
+        case SX_NODE:
+        case ZX_NODE:
+          result.push_back(children[1].get());
+          break;
+
+        case BVLANEADD_NODE:
+        case BVLANEEQ_NODE:
+        case BVLANESGT_NODE:
+        case BVLANESUB_NODE:
+          result.push_back(children[0].get());
+          result.push_back(children[1].get());
+          break;
+
+        case BVLANESELECT_NODE:
+          result.push_back(children[0].get());
+          result.push_back(children[1].get());
+          result.push_back(children[2].get());
+          break;
+
+        case EXTRACT_NODE:
+        case LET_NODE:
+          result.push_back(children[2].get());
+          break;
+
+        /* The index, then the index and the value of each store which is not in the cells */
+        case SELECT_NODE: {
+          std::vector<AbstractNode*> stores;
+          storesOf(node, stores);
+          result.push_back(children[1].get());
+          for (AbstractNode* store : stores) {
+            result.push_back(store->getChildren()[1].get());
+            result.push_back(store->getChildren()[2].get());
+          }
+          break;
+        }
+
+        case COMPOUND_NODE:
+        case FORALL_NODE:
+        case VARIABLE_NODE:
+          break;
+
+        default:
+          for (const auto& child : children)
+            result.push_back(child.get());
+          break;
+      }
+
+      return result;
+    }
+
+
+    AstEvaluator::AstEvaluator(const SharedAbstractNode& node) {
+      if (node == nullptr)
+        throw triton::exceptions::Ast("AstEvaluator::AstEvaluator(): Node cannot be null.");
+
+      this->lanes       = 0;
+      this->narrowCount = 0;
+      this->root        = 0;
+      this->wideCount   = 0;
+      this->compile(node);
+    }
+
+
+    triton::uint32 AstEvaluator::allocate(triton::uint32 size) {
+      triton::uint32 reg = static_cast<triton::uint32>(this->sizes.size());
+
+      this->sizes.push_back(size);
+      if (size <= triton::bitsize::qword)
+        this->indexes.push_back(this->narrowCount++);
+      else
+        this->indexes.push_back(this->wideCount++);
+
+      return reg;
+    }
+
+
+    void AstEvaluator::compile(const SharedAbstractNode& node) {
+      std::unordered_map<AbstractNode*, triton::uint32> registers;
+      std::unordered_set<AbstractNode*> visited;
+      std::stack<std::pair<AbstractNode*, bool>> worklist;
+      std::vector<triton::usize> loads;
+
+      /*
+       *  We use a worklist strategy to avoid recursive calls
+       *  and so stack overflow when going through a big AST.
+       */
+      worklist.push({node.get(), false});
+
+      while (!worklist.empty()) {
+        AbstractNode* ast;
+        bool postOrder;
+        std::tie(ast, postOrder) = worklist.top();
+        worklist.pop();
+
+        if (!postOrder) {
+          if (!visited.insert(ast).second)
+            continue;
+
+          /* A sub-tree without symbolic variable is folded into a constant */
+          if (!ast->isSymbolized()) {
+            triton::uint32 reg = this->allocate(ast->getBitvectorSize());
+            this->constants.push_back({reg, ast->evaluate()});
+            registers[ast] = reg;
+            continue;
+          }
+
+          worklist.push({ast, true});
+          for (AbstractNode* op : operandsOf(ast)) {
+            if (visited.find(op) == visited.end())
+              worklist.push({op, false});
+          }
+          continue;
+        }
+
+        /* All operands have been compiled, we can compile this node */
+        std::vector<AbstractNode*> ops = operandsOf(ast);
+
+        switch (ast->getType()) {
+          case DECLARE_NODE:
+          case LET_NODE:
+          case REFERENCE_NODE:
+            registers[ast] = registers.at(ops[0]);
+            continue;
+
+          case COMPOUND_NODE:
+          case FORALL_NODE: {
+            triton::uint32 reg = this->allocate(ast->getBitvectorSize());
+            this->constants.push_back({reg, ast->evaluate()});
+            registers[ast] = reg;
+            continue;
+          }
+
+          default:
+            break;
+        }
+
+        /* Arrays are only read through the selects */
+        if (ast->isArray())
+          throw triton::exceptions::Ast("AstEvaluator::compile(): An array cannot be evaluated.");
+
+        Instruction inst;
+        inst.type   = ast->getType();
+        inst.size   = ast->getBitvectorSize();
+        inst.dst    = this->allocate(inst.size);
+        inst.first  = static_cast<triton::uint32>(this->operands.size());
+        inst.count  = static_cast<triton::uint32>(ops.size());
+        inst.imm1   = 0;
+        inst.imm2   = 0;
+        inst.narrow = (inst.size <= triton::bitsize::qword) && isNarrowOperator(inst.type);
+
+        for (AbstractNode* op : ops) {
+          triton::uint32 reg = registers.at(op);
+          inst.narrow &= (this->sizes[reg] <= triton::bitsize::qword);
+          this->operands.push_back(reg);
+        }
+
+        const auto& children = ast->getChildren();
+        switch (inst.type) {
+          case BVROL_NODE:
+          case BVROR_NODE:
+            inst.imm1 = reinterpret_cast<IntegerNode*>(children[1].get())->getInteger().convert_to<triton::uint32>() % inst.size;
+            break;
+
+          case BVLANEADD_NODE:
+          case BVLANEEQ_NODE:
+          case BVLANESELECT_NODE:
+          case BVLANESGT_NODE:
+          case BVLANESUB_NODE:
+            inst.imm1 = reinterpret_cast<IntegerNode*>(children.back().get())->getInteger().convert_to<triton::uint32>();
+            break;
+
+          case EXTRACT_NODE:
+            inst.imm1 = reinterpret_cast<IntegerNode*>(children[0].get())->getInteger().convert_to<triton::uint32>();
+            inst.imm2 = reinterpret_cast<IntegerNode*>(children[1].get())->getInteger().convert_to<triton::uint32>();
+            break;
+
+          case SX_NODE:
+          case ZX_NODE:
+            inst.imm1 = reinterpret_cast<IntegerNode*>(children[0].get())->getInteger().convert_to<triton::uint32>();
+            break;
+
+          case SELECT_NODE: {
+            std::vector<AbstractNode*> stores;
+            inst.imm1 = static_cast<triton::uint32>(this->arrays.size());
+            this->arrays.push_back(storesOf(ast, stores));
+            break;
+          }
+
+          case VARIABLE_NODE:
+            loads.push_back(this->code.size());
+            this->variables.push_back(reinterpret_cast<VariableNode*>(ast)->getSymbolicVariable());
+            break;
+
+          default:
+            break;
+        }
+
+        registers[ast] = inst.dst;
+        this->code.push_back(inst);
+      }
+
+      /* Inputs are sorted by variable id */
+      std::vector<triton::engines::symbolic::SharedSymbolicVariable> loaded = this->variables;
+      std::sort(this->variables.begin(), this->variables.end(),
+        [](const triton::engines::symbolic::SharedSymbolicVariable& a, const triton::engines::symbolic::SharedSymbolicVariable& b) {
+          return a->getId() < b->getId();
+        }
+      );
+      this->variables.erase(std::unique(this->variables.begin(), this->variables.end(),
+        [](const triton::engines::symbolic::SharedSymbolicVariable& a, const triton::engines::symbolic::SharedSymbolicVariable& b) {
+          return a->getId() == b->getId();
+        }
+      ), this->variables.end());
+
+      for (triton::usize i = 0; i < loads.size(); i++) {
+        auto it = std::lower_bound(this->variables.begin(), this->variables.end(), loaded[i],
+          [](const triton::engines::symbolic::SharedSymbolicVariable& a, const triton::engines::symbolic::SharedSymbolicVariable& b) {
+            return a->getId() < b->getId();
+          }
+        );
+        this->code[loads[i]].imm1 = static_cast<triton::uint32>(it - this->variables.begin());
+      }
+
+      this->root = registers.at(node.get());
+    }
+
+
+
+
+    triton::uint512 AstEvaluator::read(triton::uint32 reg, triton::usize lane) const {
+      triton::usize index = this->indexes[reg] * this->lanes + lane;
+
+      if (this->sizes[reg] <= triton::bitsize::qword)
+        return this->narrowRegisters[index];
+      return this->wideRegisters[index];
+    }
+
+
+    void AstEvaluator::write(triton::uint32 reg, triton::usize lane, const triton::uint512& value) {
+      triton::usize index = this->indexes[reg] * this->lanes + lane;
+
+      if (this->sizes[reg] <= triton::bitsize::qword)
+        this->narrowRegisters[index] = value.convert_to<triton::uint64>();
+      else
+        this->wideRegisters[index] = value;
+    }
+
+
+    /* Applies `f` on each lane. Kept as a plain loop so that it can be vectorized by the compiler */
+    template <typename F>
+    static inline void forEachLane(triton::uint64* dst, triton::usize lanes, F f) {
+      for (triton::usize lane = 0; lane < lanes; lane++)
+        dst[lane] = f(lane);
+    }
+
+
+    void AstEvaluator::executeNarrow(const Instruction& inst) {
+      const triton::uint32* ops = this->operands.data() + inst.first;
+      const triton::usize n     = this->lanes;
+      triton::uint64* base      = this->narrowRegisters.data();
+      triton::uint64* d         = base + this->indexes[inst.dst] * n;
+      const triton::uint64* a   = (inst.count > 0) ? base + this->indexes[ops[0]] * n : nullptr;
+      const triton::uint64* b   = (inst.count > 1) ? base + this->indexes[ops[1]] * n : nullptr;
+      const triton::uint64* c   = (inst.count > 2) ? base + this->indexes[ops[2]] * n : nullptr;
+      triton::uint64 mask       = narrowMask(inst.size);
+
+      switch (inst.type) {
+        case ASSERT_NODE:
+          forEachLane(d, n, [&](triton::usize l) { return a[l] & mask; });
+          break;
+
+        case BSWAP_NODE:
+          forEachLane(d, n, [&](triton::usize l) {
+            triton::uint64 result = a[l] & 0xff;
+            for (triton::uint32 index = 8 ; index != inst.size ; index += triton::bitsize::byte) {
+              result <<= triton::bitsize::byte;
+              result |= ((a[l] >> index) & 0xff);
+            }
+            return result;
+          });
+          break;
+
+        case BVADD_NODE:
+          forEachLane(d, n, [&](triton::usize l) { return (a[l] + b[l]) & mask; });
+          for (triton::uint32 index = 2; index < inst.count; index++) {
+            const triton::uint64* src = base + this->indexes[ops[index]] * n;
+            forEachLane(d, n, [&](triton::usize l) { return (d[l] + src[l]) & mask; });
+          }
+          break;
+
+        case BVAND_NODE:
+          forEachLane(d, n, [&](triton::usize l) { return a[l] & b[l]; });
+          for (triton::uint32 index = 2; index < inst.count; index++) {
+            const triton::uint64* src = base + this->indexes[ops[index]] * n;
+            forEachLane(d, n, [&](triton::usize l) { return d[l] & src[l]; });
+          }
+          break;
+
+        case BVASHR_NODE:
+          forEachLane(d, n, [&](triton::usize l) {
+            triton::uint64 shift = b[l];
+            triton::sint64 value = narrowSignExtend(a[l], inst.size);
+            if (shift >= inst.size)
+              return (value < 0) ? mask : 0;
+            return static_cast<triton::uint64>(value >> shift) & mask;
+          });
+          break;
+
+        case BVLSHR_NODE:
+          forEachLane(d, n, [&](triton::usize l) {
+            triton::uint64 shift = b[l];
+            return (shift >= inst.size) ? 0 : (a[l] >> shift);
+          });
+          break;
+
+        case BVMUL_NODE:
+          forEachLane(d, n, [&](triton::usize l) { return (a[l] * b[l]) & mask; });
+          break;
+
+        case BVNAND_NODE:
+          forEachLane(d, n, [&](triton::usize l) { return ~(a[l] & b[l]) & mask; });
+          break;
+
+        case BVNEG_NODE:
+          forEachLane(d, n, [&](triton::usize l) { return (0 - a[l]) & mask; });
+          break;
+
+        case BVNOR_NODE:
+          forEachLane(d, n, [&](triton::usize l) { return ~(a[l] | b[l]) & mask; });
+          break;
+
+        case BVNOT_NODE:
+          forEachLane(d, n, [&](triton::usize l) { return ~a[l] & mask; });
+          break;
+
+        case BVOR_NODE:
+          forEachLane(d, n, [&](triton::usize l) { return a[l] | b[l]; });
+          for (triton::uint32 index = 2; index < inst.count; index++) {
+            const triton::uint64* src = base + this->indexes[ops[index]] * n;
+            forEachLane(d, n, [&](triton::usize l) { return d[l] | src[l]; });
+          }
+          break;
+
+        case BVPARITY_NODE:
+          forEachLane(d, n, [&](triton::usize l) { return static_cast<triton::uint64>(triton::utils::popcount(a[l]) & 1); });
+          break;
+
+        case BVPOPCOUNT_NODE:
+          forEachLane(d, n, [&](triton::usize l) { return static_cast<triton::uint64>(triton::utils::popcount(a[l])); });
+          break;
+
+        case BVROL_NODE:
+          if (inst.imm1 == 0)
+            forEachLane(d, n, [&](triton::usize l) { return a[l]; });
+          else
+            forEachLane(d, n, [&](triton::usize l) { return ((a[l] << inst.imm1) | (a[l] >> (inst.size - inst.imm1))) & mask; });
+          break;
+
+        case BVROR_NODE:
+          if (inst.imm1 == 0)
+            forEachLane(d, n, [&](triton::usize l) { return a[l]; });
+          else
+            forEachLane(d, n, [&](triton::usize l) { return ((a[l] >> inst.imm1) | (a[l] << (inst.size - inst.imm1))) & mask; });
+          break;
+
+        case BVSGE_NODE:
+        case BVSGT_NODE:
+        case BVSLE_NODE:
+        case BVSLT_NODE: {
+          triton::uint32 size1 = this->sizes[ops[0]];
+          triton::uint32 size2 = this->sizes[ops[1]];
+          triton::ast::ast_e type = inst.type;
+          forEachLane(d, n, [&](triton::usize l) {
+            triton::sint64 op1 = narrowSignExtend(a[l], size1);
+            triton::sint64 op2 = narrowSignExtend(b[l], size2);
+            switch (type) {
+              case BVSGE_NODE: return static_cast<triton::uint64>(op1 >= op2);
+              case BVSGT_NODE: return static_cast<triton::uint64>(op1 > op2);
+              case BVSLE_NODE: return static_cast<triton::uint64>(op1 <= op2);
+              default:         return static_cast<triton::uint64>(op1 < op2);
+            }
+          });
+          break;
+        }
+
+        case BVSHL_NODE:
+          forEachLane(d, n, [&](triton::usize l) {
+            triton::uint64 shift = b[l];
+            return (shift >= inst.size) ? 0 : ((a[l] << shift) & mask);
+          });
+          break;
+
+        case BVSUB_NODE:
+          forEachLane(d, n, [&](triton::usize l) { return (a[l] - b[l]) & mask; });
+          break;
+
+        case BVUDIV_NODE:
+          forEachLane(d, n, [&](triton::usize l) { return (b[l] == 0) ? mask : (a[l] / b[l]); });
+          break;
+
+        case BVUGE_NODE:
+          forEachLane(d, n, [&](triton::usize l) { return static_cast<triton::uint64>(a[l] >= b[l]); });
+          break;
+
+        case BVUGT_NODE:
+          forEachLane(d, n, [&](triton::usize l) { return static_cast<triton::uint64>(a[l] > b[l]); });
+          break;
+
+        case BVULE_NODE:
+          forEachLane(d, n, [&](triton::usize l) { return static_cast<triton::uint64>(a[l] <= b[l]); });
+          break;
+
+        case BVULT_NODE:
+          forEachLane(d, n, [&](triton::usize l) { return static_cast<triton::uint64>(a[l] < b[l]); });
+          break;
+
+        case BVUREM_NODE:
+          forEachLane(d, n, [&](triton::usize l) { return (b[l] == 0) ? a[l] : (a[l] % b[l]); });
+          break;
+
+        case BVXNOR_NODE:
+          forEachLane(d, n, [&](triton::usize l) { return ~(a[l] ^ b[l]) & mask; });
+          break;
+
+        case BVXOR_NODE:
+          forEachLane(d, n, [&](triton::usize l) { return a[l] ^ b[l]; });
+          for (triton::uint32 index = 2; index < inst.count; index++) {
+            const triton::uint64* src = base + this->indexes[ops[index]] * n;
+            forEachLane(d, n, [&](triton::usize l) { return d[l] ^ src[l]; });
+          }
+          break;
+
+        case CONCAT_NODE:
+          forEachLane(d, n, [&](triton::usize l) { return a[l]; });
+          for (triton::uint32 index = 1; index < inst.count; index++) {
+            const triton::uint64* src = base + this->indexes[ops[index]] * n;
+            triton::uint32 size = this->sizes[ops[index]];
+            forEachLane(d, n, [&](triton::usize l) { return (d[l] << size) | src[l]; });
+          }
+          break;
+
+        case DISTINCT_NODE:
+          forEachLane(d, n, [&](triton::usize l) { return static_cast<triton::uint64>(a[l] != b[l]); });
+          break;
+
+        case EQUAL_NODE:
+          forEachLane(d, n, [&](triton::usize l) { return static_cast<triton::uint64>(a[l] == b[l]); });
+          break;
+
+        case EXTRACT_NODE:
+          forEachLane(d, n, [&](triton::usize l) { return (a[l] >> inst.imm2) & mask; });
+          break;
+
+        case IFF_NODE:
+          forEachLane(d, n, [&](triton::usize l) { return static_cast<triton::uint64>((a[l] && b[l]) || (!a[l] && !b[l])); });
+          break;
+
+        case ITE_NODE:
+          forEachLane(d, n, [&](triton::usize l) { return a[l] ? b[l] : c[l]; });
+          break;
+
+        case LAND_NODE:
+          std::fill(d, d + n, static_cast<triton::uint64>(1));
+          for (triton::uint32 index = 0; index < inst.count; index++) {
+            const triton::uint64* src = base + this->indexes[ops[index]] * n;
+            forEachLane(d, n, [&](triton::usize l) { return static_cast<triton::uint64>(d[l] && src[l]); });
+          }
+          break;
+
+        case LNOT_NODE:
+          forEachLane(d, n, [&](triton::usize l) { return static_cast<triton::uint64>(!a[l]); });
+          break;
+
+        case LOR_NODE:
+          std::fill(d, d + n, static_cast<triton::uint64>(0));
+          for (triton::uint32 index = 0; index < inst.count; index++) {
+            const triton::uint64* src = base + this->indexes[ops[index]] * n;
+            forEachLane(d, n, [&](triton::usize l) { return static_cast<triton::uint64>(d[l] || src[l]); });
+          }
+          break;
+
+        case LXOR_NODE:
+          std::fill(d, d + n, static_cast<triton::uint64>(0));
+          for (triton::uint32 index = 0; index < inst.count; index++) {
+            const triton::uint64* src = base + this->indexes[ops[index]] * n;
+            forEachLane(d, n, [&](triton::usize l) { return static_cast<triton::uint64>(!d[l] != !src[l]); });
+          }
+          break;
+
+        case SELECT_NODE: {
+          const ArrayMemory& memory = this->arrays[inst.imm1];
+          forEachLane(d, n, [&](triton::usize l) {
+            /* The last store at the index, otherwise the cells */
+            for (triton::uint32 index = 1; index + 1 < inst.count; index += 2) {
+              if (base[this->indexes[ops[index]] * n + l] == a[l])
+                return base[this->indexes[ops[index + 1]] * n + l];
+            }
+            const triton::uint8* cell = memory.find(a[l]);
+            return static_cast<triton::uint64>(cell ? *cell : 0);
+          });
+          break;
+        }
+
+        case SX_NODE: {
+          triton::uint32 size = this->sizes[ops[0]];
+          triton::uint64 ext  = ~narrowMask(size);
+          forEachLane(d, n, [&](triton::usize l) { return (((a[l] >> (size - 1)) == 0) ? a[l] : (a[l] | ext)) & mask; });
+          break;
+        }
+
+        case ZX_NODE:
+          forEachLane(d, n, [&](triton::usize l) { return a[l]; });
+          break;
+
+        default:
+          throw triton::exceptions::Ast("AstEvaluator::executeNarrow(): Invalid operator.");
+      }
+    }
+
+
+    void AstEvaluator::executeWide(const Instruction& inst, triton::usize lane) {
+      const triton::uint32* ops = this->operands.data() + inst.first;
+      triton::uint512 mask      = wideMask(inst.size);
+      triton::uint512 result    = 0;
+
+      switch (inst.type) {
+        case ASSERT_NODE:
+          result = this->read(ops[0], lane) & mask;
+          break;
+
+        case BSWAP_NODE: {
+          triton::uint512 value = this->read(ops[0], lane);
+          result = value & 0xff;
+          for (triton::uint32 index = 8 ; index != inst.size ; index += triton::bitsize::byte) {
+            result <<= triton::bitsize::byte;
+            result |= ((value >> index) & 0xff);
+          }
+          break;
+        }
+
+        case BVADD_NODE:
+          result = (this->read(ops[0], lane) + this->read(ops[1], lane)) & mask;
+          for (triton::uint32 index = 2; index < inst.count; index++)
+            result = (result + this->read(ops[index], lane)) & mask;
+          break;
+
+        case BVAND_NODE:
+          result = this->read(ops[0], lane) & this->read(ops[1], lane);
+          for (triton::uint32 index = 2; index < inst.count; index++)
+            result &= this->read(ops[index], lane);
+          break;
+
+        case BVASHR_NODE: {
+          triton::uint512 value  = this->read(ops[0], lane);
+          triton::uint512 amount = this->read(ops[1], lane);
+          bool isSigned          = ((value >> (inst.size - 1)) & 1) != 0;
+          if (amount >= inst.size) {
+            result = isSigned ? mask : 0;
+            break;
+          }
+          triton::uint32 shift = amount.convert_to<triton::uint32>();
+          if (isSigned)
+            result = ((value >> shift) | (mask & ~(mask >> shift))) & mask;
+          else
+            result = value >> shift;
+          break;
+        }
+
+        case BVLANEADD_NODE:
+          result = triton::utils::laneAdd(this->read(ops[0], lane), this->read(ops[1], lane), inst.size, inst.imm1);
+          break;
+
+        case BVLANEEQ_NODE:
+          result = triton::utils::laneEq(this->read(ops[0], lane), this->read(ops[1], lane), inst.size, inst.imm1);
+          break;
+
+        case BVLANESELECT_NODE:
+          result = triton::utils::laneSelect(this->read(ops[0], lane), this->read(ops[1], lane), this->read(ops[2], lane), inst.size, inst.imm1);
+          break;
+
+        case BVLANESGT_NODE:
+          result = triton::utils::laneSgt(this->read(ops[0], lane), this->read(ops[1], lane), inst.size, inst.imm1);
+          break;
+
+        case BVLANESUB_NODE:
+          result = triton::utils::laneSub(this->read(ops[0], lane), this->read(ops[1], lane), inst.size, inst.imm1);
+          break;
+
+        case BVLSHR_NODE: {
+          triton::uint512 amount = this->read(ops[1], lane);
+          result = (amount >= inst.size) ? 0 : (this->read(ops[0], lane) >> amount.convert_to<triton::uint32>());
+          break;
+        }
+
+        case BVMUL_NODE:
+          result = (this->read(ops[0], lane) * this->read(ops[1], lane)) & mask;
+          break;
+
+        case BVNAND_NODE:
+          result = ~(this->read(ops[0], lane) & this->read(ops[1], lane)) & mask;
+          break;
+
+        case BVNEG_NODE:
+          result = (-(this->read(ops[0], lane).convert_to<triton::sint512>())).convert_to<triton::uint512>() & mask;
+          break;
+
+        case BVNOR_NODE:
+          result = ~(this->read(ops[0], lane) | this->read(ops[1], lane)) & mask;
+          break;
+
+        case BVNOT_NODE:
+          result = ~this->read(ops[0], lane) & mask;
+          break;
+
+        case BVOR_NODE:
+          result = this->read(ops[0], lane) | this->read(ops[1], lane);
+          for (triton::uint32 index = 2; index < inst.count; index++)
+            result |= this->read(ops[index], lane);
+          break;
+
+        case BVPARITY_NODE:
+          result = triton::utils::popcount(this->read(ops[0], lane)) & 1;
+          break;
+
+        case BVPOPCOUNT_NODE:
+          result = triton::utils::popcount(this->read(ops[0], lane));
+          break;
+
+        case BVROL_NODE: {
+          triton::uint512 value = this->read(ops[0], lane);
+          result = ((value << inst.imm1) | (value >> (inst.size - inst.imm1))) & mask;
+          break;
+        }
+
+        case BVROR_NODE: {
+          triton::uint512 value = this->read(ops[0], lane);
+          result = ((value >> inst.imm1) | (value << (inst.size - inst.imm1))) & mask;
+          break;
+        }
+
+        case BVSDIV_NODE: {
+          triton::sint512 op1Signed = triton::ast::modularSignExtend(this->read(ops[0], lane), inst.size);
+          triton::sint512 op2Signed = triton::ast::modularSignExtend(this->read(ops[1], lane), inst.size);
+          if (op2Signed == 0)
+            result = ((op1Signed < 0 ? 1 : -1) & mask);
+          else
+            result = ((op1Signed / op2Signed).convert_to<triton::uint512>() & mask);
+          break;
+        }
+
+        case BVSGE_NODE:
+          result = (triton::ast::modularSignExtend(this->read(ops[0], lane), this->sizes[ops[0]]) >= triton::ast::modularSignExtend(this->read(ops[1], lane), this->sizes[ops[1]]));
+          break;
+
+        case BVSGT_NODE:
+          result = (triton::ast::modularSignExtend(this->read(ops[0], lane), this->sizes[ops[0]]) > triton::ast::modularSignExtend(this->read(ops[1], lane), this->sizes[ops[1]]));
+          break;
+
+        case BVSHL_NODE: {
+          triton::uint512 amount = this->read(ops[1], lane);
+          result = (amount >= inst.size) ? 0 : ((this->read(ops[0], lane) << amount.convert_to<triton::uint32>()) & mask);
+          break;
+        }
+
+        case BVSLE_NODE:
+          result = (triton::ast::modularSignExtend(this->read(ops[0], lane), this->sizes[ops[0]]) <= triton::ast::modularSignExtend(this->read(ops[1], lane), this->sizes[ops[1]]));
+          break;
+
+        case BVSLT_NODE:
+          result = (triton::ast::modularSignExtend(this->read(ops[0], lane), this->sizes[ops[0]]) < triton::ast::modularSignExtend(this->read(ops[1], lane), this->sizes[ops[1]]));
+          break;
+
+        case BVSMOD_NODE: {
+          triton::uint512 op1 = this->read(ops[0], lane);
+          triton::uint512 op2 = this->read(ops[1], lane);
+          if (op2 == 0) {
+            result = op1;
+          }
+          else {
+            triton::sint512 op1Signed = triton::ast::modularSignExtend(op1, inst.size);
+            triton::sint512 op2Signed = triton::ast::modularSignExtend(op2, inst.size);
+            result = ((((op1Signed % op2Signed) + op2Signed) % op2Signed).convert_to<triton::uint512>() & mask);
+          }
+          break;
+        }
+
+        case BVSREM_NODE: {
+          triton::uint512 op1 = this->read(ops[0], lane);
+          triton::uint512 op2 = this->read(ops[1], lane);
+          if (op2 == 0) {
+            result = op1;
+          }
+          else {
+            triton::sint512 op1Signed = triton::ast::modularSignExtend(op1, inst.size);
+            triton::sint512 op2Signed = triton::ast::modularSignExtend(op2, inst.size);
+            result = ((op1Signed - ((op1Signed / op2Signed) * op2Signed)).convert_to<triton::uint512>() & mask);
+          }
+          break;
+        }
+
+        case BVSUB_NODE:
+          result = (this->read(ops[0], lane) - this->read(ops[1], lane)) & mask;
+          break;
+
+        case BVUDIV_NODE: {
+          triton::uint512 op2 = this->read(ops[1], lane);
+          result = (op2 == 0) ? mask : (this->read(ops[0], lane) / op2);
+          break;
+        }
+
+        case BVUGE_NODE:
+          result = (this->read(ops[0], lane) >= this->read(ops[1], lane));
+          break;
+
+        case BVUGT_NODE:
+          result = (this->read(ops[0], lane) > this->read(ops[1], lane));
+          break;
+
+        case BVULE_NODE:
+          result = (this->read(ops[0], lane) <= this->read(ops[1], lane));
+          break;
+
+        case BVULT_NODE:
+          result = (this->read(ops[0], lane) < this->read(ops[1], lane));
+          break;
+
+        case BVUREM_NODE: {
+          triton::uint512 op2 = this->read(ops[1], lane);
+          result = (op2 == 0) ? this->read(ops[0], lane) : (this->read(ops[0], lane) % op2);
+          break;
+        }
+
+        case BVXNOR_NODE:
+          result = ~(this->read(ops[0], lane) ^ this->read(ops[1], lane)) & mask;
+          break;
+
+        case BVXOR_NODE:
+          result = this->read(ops[0], lane) ^ this->read(ops[1], lane);
+          for (triton::uint32 index = 2; index < inst.count; index++)
+            result ^= this->read(ops[index], lane);
+          break;
+
+        case CONCAT_NODE:
+          result = this->read(ops[0], lane);
+          for (triton::uint32 index = 1; index < inst.count; index++)
+            result = ((result << this->sizes[ops[index]]) | this->read(ops[index], lane));
+          break;
+
+        case DISTINCT_NODE:
+          result = (this->read(ops[0], lane) != this->read(ops[1], lane));
+          break;
+
+        case EQUAL_NODE:
+          result = (this->read(ops[0], lane) == this->read(ops[1], lane));
+          break;
+
+        case EXTRACT_NODE:
+          result = (this->read(ops[0], lane) >> inst.imm2) & mask;
+          break;
+
+        case ITE_NODE:
+          result = this->read(ops[0], lane) ? this->read(ops[1], lane) : this->read(ops[2], lane);
+          break;
+
+        case SX_NODE: {
+          triton::uint32 size   = this->sizes[ops[0]];
+          triton::uint512 value = this->read(ops[0], lane);
+          result = ((((value >> (size - 1)) == 0) ? value : (value | ~wideMask(size))) & mask);
+          break;
+        }
+
+        case ZX_NODE:
+          result = this->read(ops[0], lane) & mask;
+          break;
+
+        default:
+          throw triton::exceptions::Ast("AstEvaluator::executeWide(): Invalid operator.");
+      }
+
+      this->write(inst.dst, lane, result);
+    }
+
+
+    void AstEvaluator::run(const std::vector<triton::uint512>* inputs, triton::usize lanes) {
+      for (triton::usize lane = 0; lane < lanes; lane++) {
+        if (inputs[lane].size() != this->variables.size())
+          throw triton::exceptions::Ast("AstEvaluator::run(): Invalid number of values.");
+      }
+
+      /* Registers are laid out lane by lane, constants are replicated on each lane */
+      if (this->lanes != lanes) {
+        this->lanes = lanes;
+        this->narrowRegisters.assign(this->narrowCount * lanes, 0);
+        this->wideRegisters.assign(this->wideCount * lanes, 0);
+        for (const auto& constant : this->constants) {
+          for (triton::usize lane = 0; lane < lanes; lane++)
+            this->write(constant.first, lane, constant.second);
+        }
+      }
+
+      for (const auto& inst : this->code) {
+        if (inst.type == VARIABLE_NODE) {
+          triton::uint512 mask = wideMask(inst.size);
+          for (triton::usize lane = 0; lane < lanes; lane++)
+            this->write(inst.dst, lane, inputs[lane][inst.imm1] & mask);
+        }
+        else if (inst.narrow) {
+          this->executeNarrow(inst);
+        }
+        else {
+          for (triton::usize lane = 0; lane < lanes; lane++)
+            this->executeWide(inst, lane);
+        }
+      }
+    }
+
+
+    const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& AstEvaluator::getVariables(void) const {
+      return this->variables;
+    }
+
+
+    triton::usize AstEvaluator::getNumberOfInstructions(void) const {
+      return this->code.size();
+    }
+
+
+    triton::uint32 AstEvaluator::getBitvectorSize(void) const {
+      return this->sizes[this->root];
+    }
+
+
+    triton::uint512 AstEvaluator::evaluate(const std::vector<triton::uint512>& values) {
+      this->run(&values, 1);
+      return this->read(this->root, 0);
+    }
+
+
+    std::vector<triton::uint512> AstEvaluator::evaluateBatch(const std::vector<std::vector<triton::uint512>>& inputs) {
+      std::vector<triton::uint512> outputs;
+
+      if (inputs.empty())
+        return outputs;
+
+      this->run(inputs.data(), inputs.size());
+
+      outputs.reserve(inputs.size());
+      for (triton::usize lane = 0; lane < inputs.size(); lane++)
+        outputs.push_back(this->read(this->root, lane));
+
+      return outputs;
+    }
+
+  }; /* ast namespace */
+}; /* triton namespace */
@@ -0,0 +1,981 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <cctype>
+#include <limits>
+#include <stack>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <triton/astContext.hpp>
+#include <triton/astRewriter.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/symbolicExpression.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    /* Marks an unbound variable of a substitution */
+    static const triton::uint32 unbound = std::numeric_limits<triton::uint32>::max();
+
+
+    /* Operators allowed in rewrite rules with their arity. Operands and result have the same size. */
+    static const std::map<std::string, std::pair<triton::ast::ast_e, triton::uint32>> ruleOperators = {
+      {"bvadd",  {BVADD_NODE,  2}},
+      {"bvand",  {BVAND_NODE,  2}},
+      {"bvashr", {BVASHR_NODE, 2}},
+      {"bvlshr", {BVLSHR_NODE, 2}},
+      {"bvmul",  {BVMUL_NODE,  2}},
+      {"bvnand", {BVNAND_NODE, 2}},
+      {"bvneg",  {BVNEG_NODE,  1}},
+      {"bvnor",  {BVNOR_NODE,  2}},
+      {"bvnot",  {BVNOT_NODE,  1}},
+      {"bvor",   {BVOR_NODE,   2}},
+      {"bvsdiv", {BVSDIV_NODE, 2}},
+      {"bvshl",  {BVSHL_NODE,  2}},
+      {"bvsmod", {BVSMOD_NODE, 2}},
+      {"bvsrem", {BVSREM_NODE, 2}},
+      {"bvsub",  {BVSUB_NODE,  2}},
+      {"bvudiv", {BVUDIV_NODE, 2}},
+      {"bvurem", {BVUREM_NODE, 2}},
+      {"bvxnor", {BVXNOR_NODE, 2}},
+      {"bvxor",  {BVXOR_NODE,  2}},
+    };
+
+
+    /* The default rules: algebraic identities and mixed boolean-arithmetic (MBA) identities */
+    static const char* defaultRules[][3] = {
+      /* Commutativity and associativity */
+      {"add-comm",        "(bvadd ?a ?b)",                                 "(bvadd ?b ?a)"},
+      {"mul-comm",        "(bvmul ?a ?b)",                                 "(bvmul ?b ?a)"},
+      {"and-comm",        "(bvand ?a ?b)",                                 "(bvand ?b ?a)"},
+      {"or-comm",         "(bvor ?a ?b)",                                  "(bvor ?b ?a)"},
+      {"xor-comm",        "(bvxor ?a ?b)",                                 "(bvxor ?b ?a)"},
+      {"add-assoc",       "(bvadd (bvadd ?a ?b) ?c)",                      "(bvadd ?a (bvadd ?b ?c))"},
+      {"mul-assoc",       "(bvmul (bvmul ?a ?b) ?c)",                      "(bvmul ?a (bvmul ?b ?c))"},
+      {"and-assoc",       "(bvand (bvand ?a ?b) ?c)",                      "(bvand ?a (bvand ?b ?c))"},
+      {"or-assoc",        "(bvor (bvor ?a ?b) ?c)",                        "(bvor ?a (bvor ?b ?c))"},
+      {"xor-assoc",       "(bvxor (bvxor ?a ?b) ?c)",                      "(bvxor ?a (bvxor ?b ?c))"},
+
+      /* Neutral and absorbing elements */
+      {"add-0",           "(bvadd ?a 0)",                                  "?a"},
+      {"sub-0",           "(bvsub ?a 0)",                                  "?a"},
+      {"mul-0",           "(bvmul ?a 0)",                                  "0"},
+      {"mul-1",           "(bvmul ?a 1)",                                  "?a"},
+      {"mul-m1",          "(bvmul ?a -1)",                                 "(bvneg ?a)"},
+      {"and-0",           "(bvand ?a 0)",                                  "0"},
+      {"and-m1",          "(bvand ?a -1)",                                 "?a"},
+      {"or-0",            "(bvor ?a 0)",                                   "?a"},
+      {"or-m1",           "(bvor ?a -1)",                                  "-1"},
+      {"xor-0",           "(bvxor ?a 0)",                                  "?a"},
+      {"xor-m1",          "(bvxor ?a -1)",                                 "(bvnot ?a)"},
+      {"shl-0",           "(bvshl ?a 0)",                                  "?a"},
+      {"lshr-0",          "(bvlshr ?a 0)",                                 "?a"},
+      {"ashr-0",          "(bvashr ?a 0)",                                 "?a"},
+
+      /* Idempotence and complements */
+      {"and-self",        "(bvand ?a ?a)",                                 "?a"},
+      {"or-self",         "(bvor ?a ?a)",                                  "?a"},
+      {"xor-self",        "(bvxor ?a ?a)",                                 "0"},
+      {"sub-self",        "(bvsub ?a ?a)",                                 "0"},
+      {"and-not",         "(bvand ?a (bvnot ?a))",                         "0"},
+      {"or-not",          "(bvor ?a (bvnot ?a))",                          "-1"},
+      {"xor-not",         "(bvxor ?a (bvnot ?a))",                         "-1"},
+      {"add-not",         "(bvadd ?a (bvnot ?a))",                         "-1"},
+      {"add-neg",         "(bvadd ?a (bvneg ?a))",                         "0"},
+      {"not-not",         "(bvnot (bvnot ?a))",                            "?a"},
+      {"neg-neg",         "(bvneg (bvneg ?a))",                            "?a"},
+      {"and-absorb",      "(bvand ?a (bvor ?a ?b))",                       "?a"},
+      {"or-absorb",       "(bvor ?a (bvand ?a ?b))",                       "?a"},
+
+      /* Arithmetic */
+      {"sub-to-add",      "(bvsub ?a ?b)",                                 "(bvadd ?a (bvneg ?b))"},
+      {"add-to-sub",      "(bvadd ?a (bvneg ?b))",                         "(bvsub ?a ?b)"},
+      {"neg-to-not",      "(bvneg ?a)",                                    "(bvadd (bvnot ?a) 1)"},
+      {"not-to-neg",      "(bvadd (bvnot ?a) 1)",                          "(bvneg ?a)"},
+      {"add-self",        "(bvadd ?a ?a)",                                 "(bvmul 2 ?a)"},
+      {"mul-factor",      "(bvadd (bvmul ?a ?b) (bvmul ?a ?c))",           "(bvmul ?a (bvadd ?b ?c))"},
+      {"mul-factor-1",    "(bvadd (bvmul ?a ?b) ?a)",                      "(bvmul ?a (bvadd ?b 1))"},
+
+      /* Mixed boolean-arithmetic */
+      {"mba-or-1",        "(bvadd (bvxor ?a ?b) (bvand ?a ?b))",           "(bvor ?a ?b)"},
+      {"mba-or-2",        "(bvsub (bvadd ?a ?b) (bvand ?a ?b))",           "(bvor ?a ?b)"},
+      {"mba-or-3",        "(bvadd (bvand ?a (bvnot ?b)) ?b)",              "(bvor ?a ?b)"},
+      {"mba-add-1",       "(bvadd (bvxor ?a ?b) (bvmul 2 (bvand ?a ?b)))", "(bvadd ?a ?b)"},
+      {"mba-add-2",       "(bvadd (bvand ?a ?b) (bvor ?a ?b))",            "(bvadd ?a ?b)"},
+      {"mba-xor-1",       "(bvsub (bvor ?a ?b) (bvand ?a ?b))",            "(bvxor ?a ?b)"},
+      {"mba-xor-2",       "(bvor (bvand ?a (bvnot ?b)) (bvand (bvnot ?a) ?b))", "(bvxor ?a ?b)"},
+      {"mba-and-1",       "(bvsub (bvor ?a ?b) (bvxor ?a ?b))",            "(bvand ?a ?b)"},
+      {"mba-and-2",       "(bvsub (bvadd ?a ?b) (bvor ?a ?b))",            "(bvand ?a ?b)"},
+      {"mba-and-3",       "(bvsub (bvadd ?a ?b) (bvxor ?a ?b))",           "(bvmul 2 (bvand ?a ?b))"},
+      {"mba-andnot",      "(bvsub (bvor ?a ?b) ?b)",                       "(bvand ?a (bvnot ?b))"},
+      {"mba-split",       "(bvadd (bvand ?a (bvnot ?b)) (bvand ?a ?b))",   "?a"},
+    };
+
+
+    /* Returns true if nodes of this type are logical */
+    static bool isLogicalType(triton::ast::ast_e type) {
+      switch (type) {
+        case BVSGE_NODE:
+        case BVSGT_NODE:
+        case BVSLE_NODE:
+        case BVSLT_NODE:
+        case BVUGE_NODE:
+        case BVUGT_NODE:
+        case BVULE_NODE:
+        case BVULT_NODE:
+        case DISTINCT_NODE:
+        case EQUAL_NODE:
+        case IFF_NODE:
+        case LAND_NODE:
+        case LNOT_NODE:
+        case LOR_NODE:
+        case LXOR_NODE:
+          return true;
+        default:
+          return false;
+      }
+    }
+
+
+    /* Returns true if nodes of this type are loaded with their operands, others are opaque */
+    static bool isSupportedType(triton::ast::ast_e type) {
+      switch (type) {
+        case BSWAP_NODE:
+        case BVADD_NODE:
+        case BVAND_NODE:
+        case BVASHR_NODE:
+        case BVLANEADD_NODE:
+        case BVLANEEQ_NODE:
+        case BVLANESELECT_NODE:
+        case BVLANESGT_NODE:
+        case BVLANESUB_NODE:
+        case BVLSHR_NODE:
+        case BVMUL_NODE:
+        case BVNAND_NODE:
+        case BVNEG_NODE:
+        case BVNOR_NODE:
+        case BVNOT_NODE:
+        case BVOR_NODE:
+        case BVPARITY_NODE:
+        case BVPOPCOUNT_NODE:
+        case BVROL_NODE:
+        case BVROR_NODE:
+        case BVSDIV_NODE:
+        case BVSHL_NODE:
+        case BVSMOD_NODE:
+        case BVSREM_NODE:
+        case BVSUB_NODE:
+        case BVUDIV_NODE:
+        case BVUREM_NODE:
+        case BVXNOR_NODE:
+        case BVXOR_NODE:
+        case CONCAT_NODE:
+        case EXTRACT_NODE:
+        case ITE_NODE:
+        case SX_NODE:
+        case ZX_NODE:
+          return true;
+        default:
+          return isLogicalType(type);
+      }
+    }
+
+
+    /* Returns a constant of a rule modulo 2^size */
+    static triton::uint512 wrapConstant(triton::sint64 value, triton::uint32 size) {
+      triton::uint512 mask = -1;
+      mask = mask >> (512 - size);
+
+      if (value >= 0)
+        return triton::uint512(value) & mask;
+
+      /* -k mod 2^size = mask - (k - 1) */
+      return (mask - triton::uint512(-(value + 1))) & mask;
+    }
+
+
+    /* Folds the operators of rules which do not need a signed interpretation. Returns false for others. */
+    static bool foldOperator(triton::ast::ast_e type, triton::uint32 size, const std::vector<triton::uint512>& values, triton::uint512& result) {
+      triton::uint512 mask = -1;
+      mask = mask >> (512 - size);
+
+      switch (type) {
+        case BVADD_NODE:  result = (values[0] + values[1]) & mask; return true;
+        case BVAND_NODE:  result = (values[0] & values[1]); return true;
+        case BVMUL_NODE:  result = (values[0] * values[1]) & mask; return true;
+        case BVNAND_NODE: result = ~(values[0] & values[1]) & mask; return true;
+        case BVNEG_NODE:  result = (~values[0] + 1) & mask; return true;
+        case BVNOR_NODE:  result = ~(values[0] | values[1]) & mask; return true;
+        case BVNOT_NODE:  result = ~values[0] & mask; return true;
+        case BVOR_NODE:   result = (values[0] | values[1]); return true;
+        case BVSUB_NODE:  result = (values[0] - values[1]) & mask; return true;
+        case BVXNOR_NODE: result = ~(values[0] ^ values[1]) & mask; return true;
+        case BVXOR_NODE:  result = (values[0] ^ values[1]); return true;
+        case BVSHL_NODE:  result = (values[1] >= size) ? triton::uint512(0) : ((values[0] << values[1].convert_to<triton::uint32>()) & mask); return true;
+        case BVLSHR_NODE: result = (values[1] >= size) ? triton::uint512(0) : (values[0] >> values[1].convert_to<triton::uint32>()); return true;
+        default:
+          return false;
+      }
+    }
+
+
+    /* Splits an s-expression into tokens */
+    static std::vector<std::string> tokenize(const std::string& text) {
+      std::vector<std::string> tokens;
+      std::string current;
+
+      for (char c : text) {
+        if (c == '(' || c == ')' || std::isspace(static_cast<unsigned char>(c))) {
+          if (!current.empty()) {
+            tokens.push_back(current);
+            current.clear();
+          }
+          if (c == '(' || c == ')')
+            tokens.push_back(std::string(1, c));
+        }
+        else {
+          current += c;
+        }
+      }
+
+      if (!current.empty())
+        tokens.push_back(current);
+
+      return tokens;
+    }
+
+
+    bool AstRewriter::ENode::operator==(const ENode& other) const {
+      return this->type == other.type &&
+             this->size == other.size &&
+             this->imm1 == other.imm1 &&
+             this->imm2 == other.imm2 &&
+             this->leaf == other.leaf &&
+             this->children == other.children;
+    }
+
+
+    std::size_t AstRewriter::ENodeHash::operator()(const ENode& node) const {
+      std::size_t hash = static_cast<std::size_t>(node.type);
+
+      auto mix = [&hash](std::size_t value) {
+        hash ^= value + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+      };
+
+      mix(node.size);
+      mix(node.imm1);
+      mix(node.imm2);
+      mix(node.leaf);
+      for (triton::uint32 child : node.children)
+        mix(child);
+
+      return hash;
+    }
+
+
+    AstRewriter::AstRewriter(const SharedAstContext& ctxt) {
+      if (ctxt == nullptr)
+        throw triton::exceptions::Ast("AstRewriter::AstRewriter(): The AST context cannot be null.");
+
+      this->ctxt           = ctxt;
+      this->nodeBudget     = 10000;
+      this->iterationLimit = 12;
+      this->matchLimit     = 1000;
+      this->iterations     = 0;
+
+      for (const auto& rule : defaultRules)
+        this->addRule(rule[0], rule[1], rule[2]);
+    }
+
+
+    AstRewriter::Pattern AstRewriter::parse(const std::vector<std::string>& tokens, triton::usize& index, std::map<std::string, triton::uint32>& variables, bool lhs) const {
+      Pattern pattern;
+
+      pattern.kind     = PATTERN_CONSTANT;
+      pattern.type     = INVALID_NODE;
+      pattern.variable = 0;
+      pattern.constant = 0;
+
+      if (index >= tokens.size())
+        throw triton::exceptions::Ast("AstRewriter::parse(): Unexpected end of pattern.");
+
+      const std::string& token = tokens[index++];
+
+      /* A variable */
+      if (token[0] == '?') {
+        auto it = variables.find(token);
+        if (it == variables.end()) {
+          if (!lhs)
+            throw triton::exceptions::Ast("AstRewriter::parse(): Variable " + token + " is not bound by the left-hand side.");
+          it = variables.insert({token, static_cast<triton::uint32>(variables.size())}).first;
+        }
+        pattern.kind     = PATTERN_VARIABLE;
+        pattern.variable = it->second;
+        return pattern;
+      }
+
+      /* An operator */
+      if (token == "(") {
+        if (index >= tokens.size())
+          throw triton::exceptions::Ast("AstRewriter::parse(): Unexpected end of pattern.");
+
+        auto it = ruleOperators.find(tokens[index++]);
+        if (it == ruleOperators.end())
+          throw triton::exceptions::Ast("AstRewriter::parse(): Unsupported operator " + tokens[index - 1] + ".");
+
+        pattern.kind = PATTERN_OPERATOR;
+        pattern.type = it->second.first;
+        while (index < tokens.size() && tokens[index] != ")")
+          pattern.children.push_back(this->parse(tokens, index, variables, lhs));
+
+        if (index++ >= tokens.size())
+          throw triton::exceptions::Ast("AstRewriter::parse(): Missing parenthesis.");
+
+        if (pattern.children.size() != it->second.second)
+          throw triton::exceptions::Ast("AstRewriter::parse(): Wrong number of operands for " + it->first + ".");
+
+        return pattern;
+      }
+
+      /* A constant */
+      try {
+        triton::usize end = 0;
+        pattern.constant = std::stoll(token, &end, 0);
+        if (end != token.size())
+          throw std::invalid_argument(token);
+      }
+      catch (const std::exception&) {
+        throw triton::exceptions::Ast("AstRewriter::parse(): Invalid token " + token + ".");
+      }
+
+      return pattern;
+    }
+
+
+    void AstRewriter::addRule(const std::string& name, const std::string& lhs, const std::string& rhs) {
+      std::map<std::string, triton::uint32> variables;
+      triton::usize index = 0;
+      Rule rule;
+
+      rule.name = name;
+
+      std::vector<std::string> tokens = tokenize(lhs);
+      rule.lhs = this->parse(tokens, index, variables, true);
+      if (index != tokens.size())
+        throw triton::exceptions::Ast("AstRewriter::addRule(): Trailing tokens in the left-hand side of " + name + ".");
+
+      if (rule.lhs.kind != PATTERN_OPERATOR)
+        throw triton::exceptions::Ast("AstRewriter::addRule(): The left-hand side of " + name + " must be an operator.");
+
+      index  = 0;
+      tokens = tokenize(rhs);
+      rule.rhs = this->parse(tokens, index, variables, false);
+      if (index != tokens.size())
+        throw triton::exceptions::Ast("AstRewriter::addRule(): Trailing tokens in the right-hand side of " + name + ".");
+
+      rule.variables = static_cast<triton::uint32>(variables.size());
+      this->rules.push_back(rule);
+    }
+
+
+    triton::usize AstRewriter::getNumberOfRules(void) const {
+      return this->rules.size();
+    }
+
+
+    void AstRewriter::setNodeBudget(triton::usize budget) {
+      this->nodeBudget = budget;
+    }
+
+
+    void AstRewriter::setIterationLimit(triton::usize limit) {
+      this->iterationLimit = limit;
+    }
+
+
+    triton::usize AstRewriter::getNumberOfNodes(void) const {
+      return this->enodes.size();
+    }
+
+
+    triton::usize AstRewriter::getNumberOfIterations(void) const {
+      return this->iterations;
+    }
+
+
+    void AstRewriter::clear(void) {
+      this->enodes.clear();
+      this->owners.clear();
+      this->classes.clear();
+      this->leaders.clear();
+      this->memo.clear();
+      this->leaves.clear();
+      this->constantLeaves.clear();
+      this->opaqueLeaves.clear();
+      this->iterations = 0;
+    }
+
+
+    triton::uint32 AstRewriter::find(triton::uint32 cls) {
+      triton::uint32 root = cls;
+
+      while (this->leaders[root] != root)
+        root = this->leaders[root];
+
+      /* Path compression */
+      while (this->leaders[cls] != root) {
+        triton::uint32 next = this->leaders[cls];
+        this->leaders[cls] = root;
+        cls = next;
+      }
+
+      return root;
+    }
+
+
+    triton::uint32 AstRewriter::add(ENode node) {
+      for (auto& child : node.children)
+        child = this->find(child);
+
+      auto it = this->memo.find(node);
+      if (it != this->memo.end())
+        return this->find(this->owners[it->second]);
+
+      triton::uint32 id  = static_cast<triton::uint32>(this->enodes.size());
+      triton::uint32 cls = static_cast<triton::uint32>(this->classes.size());
+
+      EClass eclass;
+      eclass.nodes.push_back(id);
+      eclass.size     = node.size;
+      eclass.logical  = node.leaf ? this->leaves[node.leaf - 1]->isLogical() : isLogicalType(node.type);
+      eclass.constant = (node.type == BV_NODE);
+      eclass.value    = eclass.constant ? this->leaves[node.leaf - 1]->evaluate() : 0;
+
+      this->enodes.push_back(node);
+      this->owners.push_back(cls);
+      this->leaders.push_back(cls);
+      this->classes.push_back(eclass);
+      this->memo.emplace(node, id);
+
+      this->fold(cls, node);
+
+      return this->find(cls);
+    }
+
+
+    triton::uint32 AstRewriter::addConstant(const triton::uint512& value, triton::uint32 size) {
+      auto it = this->constantLeaves.find({size, value});
+
+      if (it == this->constantLeaves.end()) {
+        this->leaves.push_back(this->ctxt->bv(value, size));
+        it = this->constantLeaves.insert({{size, value}, static_cast<triton::uint32>(this->leaves.size())}).first;
+      }
+
+      ENode node;
+      node.type = BV_NODE;
+      node.size = size;
+      node.imm1 = 0;
+      node.imm2 = 0;
+      node.leaf = it->second;
+
+      return this->add(node);
+    }
+
+
+    triton::uint32 AstRewriter::addLeaf(const SharedAbstractNode& leaf) {
+      auto it = this->opaqueLeaves.find(leaf.get());
+
+      if (it == this->opaqueLeaves.end()) {
+        this->leaves.push_back(leaf);
+        it = this->opaqueLeaves.insert({leaf.get(), static_cast<triton::uint32>(this->leaves.size())}).first;
+      }
+
+      ENode node;
+      node.type = leaf->getType();
+      node.size = leaf->getBitvectorSize();
+      node.imm1 = 0;
+      node.imm2 = 0;
+      node.leaf = it->second;
+
+      return this->add(node);
+    }
+
+
+    bool AstRewriter::merge(triton::uint32 cls1, triton::uint32 cls2) {
+      cls1 = this->find(cls1);
+      cls2 = this->find(cls2);
+
+      if (cls1 == cls2)
+        return false;
+
+      /* The biggest class absorbs the other one */
+      if (this->classes[cls1].nodes.size() < this->classes[cls2].nodes.size())
+        std::swap(cls1, cls2);
+
+      EClass& dst = this->classes[cls1];
+      EClass& src = this->classes[cls2];
+
+      this->leaders[cls2] = cls1;
+      dst.nodes.insert(dst.nodes.end(), src.nodes.begin(), src.nodes.end());
+      src.nodes.clear();
+
+      if (!dst.constant && src.constant) {
+        dst.constant = true;
+        dst.value    = src.value;
+      }
+
+      return true;
+    }
+
+
+    bool AstRewriter::fold(triton::uint32 cls, const ENode& node) {
+      std::vector<triton::uint512> values;
+      triton::uint512 value = 0;
+
+      cls = this->find(cls);
+      if (this->classes[cls].constant || this->classes[cls].logical || node.leaf)
+        return false;
+
+      for (triton::uint32 child : node.children) {
+        const EClass& eclass = this->classes[this->find(child)];
+        if (!eclass.constant || eclass.logical)
+          return false;
+        values.push_back(eclass.value);
+      }
+
+      /* Other operators are evaluated by building their node over the constants */
+      if (!foldOperator(node.type, node.size, values, value)) {
+        std::vector<SharedAbstractNode> children;
+        for (triton::uint32 child : node.children) {
+          const EClass& eclass = this->classes[this->find(child)];
+          children.push_back(this->leaves[this->constantLeaves.at({eclass.size, eclass.value}) - 1]);
+        }
+        value = this->build(node, children)->evaluate();
+      }
+
+      return this->merge(cls, this->addConstant(value, node.size));
+    }
+
+
+    void AstRewriter::rebuild(void) {
+      /*
+       * Merges may make nodes of different classes congruent. Nodes are canonicalized
+       * and congruent classes merged until a fixpoint is reached.
+       */
+      for (;;) {
+        std::vector<std::pair<triton::uint32, triton::uint32>> pending;
+        bool merged = false;
+
+        this->memo.clear();
+        for (triton::uint32 cls = 0; cls < this->classes.size(); cls++) {
+          if (this->find(cls) != cls)
+            continue;
+
+          for (triton::uint32 id : this->classes[cls].nodes) {
+            ENode& node = this->enodes[id];
+            for (auto& child : node.children)
+              child = this->find(child);
+
+            this->owners[id] = cls;
+            auto it = this->memo.emplace(node, id);
+            if (!it.second && this->owners[it.first->second] != cls)
+              pending.push_back({this->owners[it.first->second], cls});
+          }
+        }
+
+        for (const auto& p : pending)
+          merged |= this->merge(p.first, p.second);
+
+        /* Operands which became constants are folded */
+        for (triton::uint32 cls = 0; cls < this->classes.size(); cls++) {
+          if (this->find(cls) != cls || this->classes[cls].constant)
+            continue;
+          for (triton::uint32 id : std::vector<triton::uint32>(this->classes[cls].nodes)) {
+            if (this->fold(cls, ENode(this->enodes[id]))) {
+              merged = true;
+              break;
+            }
+          }
+        }
+
+        if (!merged)
+          break;
+      }
+
+      /* Drops duplicated nodes */
+      for (triton::uint32 cls = 0; cls < this->classes.size(); cls++) {
+        if (this->find(cls) != cls)
+          continue;
+
+        auto& nodes = this->classes[cls].nodes;
+        std::vector<triton::uint32> unique;
+        for (triton::uint32 id : nodes) {
+          auto it = this->memo.find(this->enodes[id]);
+          if (it != this->memo.end() && it->second == id)
+            unique.push_back(id);
+        }
+        nodes.swap(unique);
+      }
+    }
+
+
+    triton::uint32 AstRewriter::load(const SharedAbstractNode& root) {
+      std::unordered_map<AbstractNode*, triton::uint32> loaded;
+
+      for (const auto& node : triton::ast::childrenExtraction(root, true /* unroll */, true /* children first */)) {
+        AbstractNode* n = node.get();
+        triton::uint32 cls = 0;
+
+        /* Integers are immediates of their parent */
+        if (n->getType() == INTEGER_NODE || n->getType() == STRING_NODE)
+          continue;
+
+        if (n->getType() == REFERENCE_NODE) {
+          cls = loaded.at(reinterpret_cast<ReferenceNode*>(n)->getSymbolicExpression()->getAst().get());
+        }
+        else if (!n->isSymbolized() && !n->isLogical() && n->getBitvectorSize() > 0) {
+          cls = this->addConstant(n->evaluate(), n->getBitvectorSize());
+        }
+        else if (!isSupportedType(n->getType())) {
+          cls = this->addLeaf(node);
+        }
+        else {
+          ENode enode;
+          enode.type = n->getType();
+          enode.size = n->getBitvectorSize();
+          enode.imm1 = 0;
+          enode.imm2 = 0;
+          enode.leaf = 0;
+
+          const auto& children = n->getChildren();
+          switch (enode.type) {
+            case EXTRACT_NODE:
+              enode.imm1 = reinterpret_cast<IntegerNode*>(children[0].get())->getInteger().convert_to<triton::uint32>();
+              enode.imm2 = reinterpret_cast<IntegerNode*>(children[1].get())->getInteger().convert_to<triton::uint32>();
+              break;
+            case SX_NODE:
+            case ZX_NODE:
+              enode.imm1 = reinterpret_cast<IntegerNode*>(children[0].get())->getInteger().convert_to<triton::uint32>();
+              break;
+            case BVROL_NODE:
+            case BVROR_NODE:
+              enode.imm1 = reinterpret_cast<IntegerNode*>(children[1].get())->getInteger().convert_to<triton::uint32>();
+              break;
+            case BVLANEADD_NODE:
+            case BVLANEEQ_NODE:
+            case BVLANESELECT_NODE:
+            case BVLANESGT_NODE:
+            case BVLANESUB_NODE:
+              enode.imm1 = reinterpret_cast<IntegerNode*>(children.back().get())->getInteger().convert_to<triton::uint32>();
+              break;
+            default:
+              break;
+          }
+
+          for (const auto& child : children) {
+            if (child->getType() != INTEGER_NODE)
+              enode.children.push_back(loaded.at(child.get()));
+          }
+
+          /* The rules are binary, an n-ary node (AST_NARY) is loaded as a chain of binary ones */
+          if (enode.children.size() > 2 && (enode.type == BVADD_NODE || enode.type == BVAND_NODE || enode.type == BVOR_NODE || enode.type == BVXOR_NODE)) {
+            std::vector<triton::uint32> operands;
+            operands.swap(enode.children);
+            enode.children = {operands[0], operands[1]};
+            for (triton::usize index = 2; index < operands.size(); index++) {
+              triton::uint32 lhs = this->add(enode);
+              enode.children = {lhs, operands[index]};
+            }
+          }
+
+          cls = this->add(enode);
+        }
+
+        loaded[n] = cls;
+      }
+
+      return this->find(loaded.at(root.get()));
+    }
+
+
+    void AstRewriter::match(std::vector<std::pair<const Pattern*, triton::uint32>>& goals, std::vector<triton::uint32>& substitution, std::vector<std::vector<triton::uint32>>& substitutions) {
+      if (substitutions.size() >= this->matchLimit)
+        return;
+
+      /* All goals are matched */
+      if (goals.empty()) {
+        substitutions.push_back(substitution);
+        return;
+      }
+
+      auto goal = goals.back();
+      goals.pop_back();
+
+      const Pattern& pattern = *goal.first;
+      triton::uint32 cls     = this->find(goal.second);
+
+      switch (pattern.kind) {
+        case PATTERN_VARIABLE: {
+          triton::uint32 bound = substitution[pattern.variable];
+          if (bound == unbound) {
+            substitution[pattern.variable] = cls;
+            this->match(goals, substitution, substitutions);
+            substitution[pattern.variable] = unbound;
+          }
+          else if (this->find(bound) == cls) {
+            this->match(goals, substitution, substitutions);
+          }
+          break;
+        }
+
+        case PATTERN_CONSTANT: {
+          const EClass& eclass = this->classes[cls];
+          if (eclass.constant && !eclass.logical && eclass.value == wrapConstant(pattern.constant, eclass.size))
+            this->match(goals, substitution, substitutions);
+          break;
+        }
+
+        case PATTERN_OPERATOR: {
+          for (triton::uint32 id : this->classes[cls].nodes) {
+            const ENode& node = this->enodes[id];
+            if (node.type != pattern.type || node.leaf || node.children.size() != pattern.children.size())
+              continue;
+
+            /* Operands are matched from the first one */
+            for (triton::usize index = pattern.children.size(); index > 0; index--)
+              goals.push_back({&pattern.children[index - 1], node.children[index - 1]});
+
+            this->match(goals, substitution, substitutions);
+            goals.resize(goals.size() - pattern.children.size());
+          }
+          break;
+        }
+      }
+
+      goals.push_back(goal);
+    }
+
+
+    triton::uint32 AstRewriter::instantiate(const Pattern& pattern, const std::vector<triton::uint32>& substitution, triton::uint32 size) {
+      switch (pattern.kind) {
+        case PATTERN_VARIABLE:
+          return this->find(substitution[pattern.variable]);
+
+        case PATTERN_CONSTANT:
+          return this->addConstant(wrapConstant(pattern.constant, size), size);
+
+        default: {
+          ENode node;
+          node.type = pattern.type;
+          node.size = size;
+          node.imm1 = 0;
+          node.imm2 = 0;
+          node.leaf = 0;
+          for (const auto& child : pattern.children)
+            node.children.push_back(this->instantiate(child, substitution, size));
+          return this->add(node);
+        }
+      }
+    }
+
+
+    void AstRewriter::saturate(void) {
+      triton::usize limit = this->enodes.size() + this->nodeBudget;
+
+      for (this->iterations = 0; this->iterations < this->iterationLimit; this->iterations++) {
+        std::vector<std::tuple<const Rule*, triton::uint32, std::vector<triton::uint32>>> matches;
+        std::unordered_map<triton::uint32, std::vector<triton::uint32>> operators;
+        bool changed = false;
+
+        /* Classes are indexed by the operators of their nodes */
+        for (triton::uint32 cls = 0; cls < this->classes.size(); cls++) {
+          if (this->find(cls) != cls || this->classes[cls].logical)
+            continue;
+          for (triton::uint32 id : this->classes[cls].nodes) {
+            auto& list = operators[this->enodes[id].type];
+            if (!this->enodes[id].leaf && (list.empty() || list.back() != cls))
+              list.push_back(cls);
+          }
+        }
+
+        /* Matches are collected first, the e-graph is not modified meanwhile */
+        for (const auto& rule : this->rules) {
+          triton::usize count = 0;
+          for (triton::uint32 cls : operators[rule.lhs.type]) {
+            if (count >= this->matchLimit)
+              break;
+
+            std::vector<std::pair<const Pattern*, triton::uint32>> goals(1, {&rule.lhs, cls});
+            std::vector<triton::uint32> substitution(rule.variables, unbound);
+            std::vector<std::vector<triton::uint32>> substitutions;
+            this->match(goals, substitution, substitutions);
+            for (auto& s : substitutions) {
+              matches.emplace_back(&rule, cls, std::move(s));
+              count++;
+            }
+          }
+        }
+
+        for (const auto& m : matches) {
+          triton::uint32 cls = std::get<1>(m);
+          triton::uint32 rhs = this->instantiate(std::get<0>(m)->rhs, std::get<2>(m), this->classes[this->find(cls)].size);
+          changed |= this->merge(cls, rhs);
+          if (this->enodes.size() >= limit)
+            break;
+        }
+
+        this->rebuild();
+
+        if (!changed || this->enodes.size() >= limit) {
+          this->iterations++;
+          break;
+        }
+      }
+    }
+
+
+    SharedAbstractNode AstRewriter::build(const ENode& node, const std::vector<SharedAbstractNode>& children) const {
+      if (node.leaf)
+        return this->leaves[node.leaf - 1];
+
+      switch (node.type) {
+        case BSWAP_NODE:    return this->ctxt->bswap(children[0]);
+        case BVADD_NODE:    return this->ctxt->bvadd(children[0], children[1]);
+        case BVAND_NODE:    return this->ctxt->bvand(children[0], children[1]);
+        case BVASHR_NODE:   return this->ctxt->bvashr(children[0], children[1]);
+        case BVLANEADD_NODE: return this->ctxt->bvlaneadd(children[0], children[1], node.imm1);
+        case BVLANEEQ_NODE: return this->ctxt->bvlaneeq(children[0], children[1], node.imm1);
+        case BVLANESELECT_NODE: return this->ctxt->bvlaneselect(children[0], children[1], children[2], node.imm1);
+        case BVLANESGT_NODE: return this->ctxt->bvlanesgt(children[0], children[1], node.imm1);
+        case BVLANESUB_NODE: return this->ctxt->bvlanesub(children[0], children[1], node.imm1);
+        case BVLSHR_NODE:   return this->ctxt->bvlshr(children[0], children[1]);
+        case BVMUL_NODE:    return this->ctxt->bvmul(children[0], children[1]);
+        case BVNAND_NODE:   return this->ctxt->bvnand(children[0], children[1]);
+        case BVNEG_NODE:    return this->ctxt->bvneg(children[0]);
+        case BVNOR_NODE:    return this->ctxt->bvnor(children[0], children[1]);
+        case BVNOT_NODE:    return this->ctxt->bvnot(children[0]);
+        case BVOR_NODE:     return this->ctxt->bvor(children[0], children[1]);
+        case BVPARITY_NODE: return this->ctxt->bvparity(children[0]);
+        case BVPOPCOUNT_NODE: return this->ctxt->bvpopcount(children[0]);
+        case BVROL_NODE:    return this->ctxt->bvrol(children[0], node.imm1);
+        case BVROR_NODE:    return this->ctxt->bvror(children[0], node.imm1);
+        case BVSDIV_NODE:   return this->ctxt->bvsdiv(children[0], children[1]);
+        case BVSGE_NODE:    return this->ctxt->bvsge(children[0], children[1]);
+        case BVSGT_NODE:    return this->ctxt->bvsgt(children[0], children[1]);
+        case BVSHL_NODE:    return this->ctxt->bvshl(children[0], children[1]);
+        case BVSLE_NODE:    return this->ctxt->bvsle(children[0], children[1]);
+        case BVSLT_NODE:    return this->ctxt->bvslt(children[0], children[1]);
+        case BVSMOD_NODE:   return this->ctxt->bvsmod(children[0], children[1]);
+        case BVSREM_NODE:   return this->ctxt->bvsrem(children[0], children[1]);
+        case BVSUB_NODE:    return this->ctxt->bvsub(children[0], children[1]);
+        case BVUDIV_NODE:   return this->ctxt->bvudiv(children[0], children[1]);
+        case BVUGE_NODE:    return this->ctxt->bvuge(children[0], children[1]);
+        case BVUGT_NODE:    return this->ctxt->bvugt(children[0], children[1]);
+        case BVULE_NODE:    return this->ctxt->bvule(children[0], children[1]);
+        case BVULT_NODE:    return this->ctxt->bvult(children[0], children[1]);
+        case BVUREM_NODE:   return this->ctxt->bvurem(children[0], children[1]);
+        case BVXNOR_NODE:   return this->ctxt->bvxnor(children[0], children[1]);
+        case BVXOR_NODE:    return this->ctxt->bvxor(children[0], children[1]);
+        case CONCAT_NODE:   return this->ctxt->concat(children);
+        case DISTINCT_NODE: return this->ctxt->distinct(children[0], children[1]);
+        case EQUAL_NODE:    return this->ctxt->equal(children[0], children[1]);
+        case EXTRACT_NODE:  return this->ctxt->extract(node.imm1, node.imm2, children[0]);
+        case IFF_NODE:      return this->ctxt->iff(children[0], children[1]);
+        case ITE_NODE:      return this->ctxt->ite(children[0], children[1], children[2]);
+        case LAND_NODE:     return this->ctxt->land(children);
+        case LNOT_NODE:     return this->ctxt->lnot(children[0]);
+        case LOR_NODE:      return this->ctxt->lor(children);
+        case LXOR_NODE:     return this->ctxt->lxor(children);
+        case SX_NODE:       return this->ctxt->sx(node.imm1, children[0]);
+        case ZX_NODE:       return this->ctxt->zx(node.imm1, children[0]);
+        default:
+          throw triton::exceptions::Ast("AstRewriter::build(): Invalid type of node.");
+      }
+    }
+
+
+    SharedAbstractNode AstRewriter::extract(triton::uint32 root) {
+      const double infinity = std::numeric_limits<double>::infinity();
+      std::vector<double> costs(this->classes.size(), infinity);
+      std::vector<triton::uint32> best(this->classes.size(), 0);
+      bool changed = true;
+
+      /*
+       * The cost of a node is its number of nodes as a tree. Costs are relaxed until
+       * a fixpoint, classes being numbered roughly from operands to users.
+       */
+      while (changed) {
+        changed = false;
+        for (triton::uint32 cls = 0; cls < this->classes.size(); cls++) {
+          if (this->find(cls) != cls)
+            continue;
+          for (triton::uint32 id : this->classes[cls].nodes) {
+            double cost = 1;
+            for (triton::uint32 child : this->enodes[id].children)
+              cost += costs[this->find(child)];
+            if (cost < costs[cls]) {
+              costs[cls] = cost;
+              best[cls]  = id;
+              changed    = true;
+            }
+          }
+        }
+      }
+
+      /* Builds the AST of the best nodes, operands first */
+      std::unordered_map<triton::uint32, SharedAbstractNode> built;
+      std::stack<std::pair<triton::uint32, bool>> worklist;
+
+      worklist.push({this->find(root), false});
+      while (!worklist.empty()) {
+        triton::uint32 cls = worklist.top().first;
+        bool postOrder     = worklist.top().second;
+        worklist.pop();
+
+        if (built.find(cls) != built.end())
+          continue;
+
+        const ENode& node = this->enodes[best[cls]];
+        if (postOrder) {
+          std::vector<SharedAbstractNode> children;
+          for (triton::uint32 child : node.children)
+            children.push_back(built.at(this->find(child)));
+          built[cls] = this->build(node, children);
+          continue;
+        }
+
+        worklist.push({cls, true});
+        for (triton::uint32 child : node.children) {
+          if (built.find(this->find(child)) == built.end())
+            worklist.push({this->find(child), false});
+        }
+      }
+
+      return built.at(this->find(root));
+    }
+
+
+    SharedAbstractNode AstRewriter::simplify(const SharedAbstractNode& node) {
+      if (node == nullptr)
+        throw triton::exceptions::Ast("AstRewriter::simplify(): The node cannot be null.");
+
+      this->clear();
+
+      triton::uint32 root = this->load(node);
+      this->rebuild();
+      this->saturate();
+
+      return this->extract(root);
+    }
+
+  }; /* ast namespace */
+}; /* triton namespace */
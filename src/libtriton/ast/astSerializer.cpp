@@ -0,0 +1,548 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <stack>
+#include <unordered_map>
+#include <utility>
+
+#include <triton/astContext.hpp>
+#include <triton/astSerializer.hpp>
+#include <triton/cpuSize.hpp>
+#include <triton/exceptions.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    /*
+     * Layout of the format. All integers are little-endian.
+     *
+     *  header      magic[8], version:u32, reserved:u32, then for each section: offset:u64, count:u64
+     *  nodes       type:u32, first:u32, count:u32, payload:u32
+     *  children    node:u32
+     *  constants   offset:u32, length:u32 (little-endian bytes in the blob)
+     *  strings     offset:u32, length:u32 (bytes in the blob)
+     *  variables   id:u64, origin:u64, type:u32, size:u32, alias:u32, comment:u32, value:u32, reserved:u32
+     *  expressions id:u64, node:u32, type:u32, comment:u32, flags:u32
+     *  roots       node:u32
+     *  blob        bytes
+     *
+     * The payload of a node is a constant for INTEGER, a string for STRING, a variable for
+     * VARIABLE and an expression for REFERENCE. Children and expressions only refer to nodes
+     * which come before them in the node table.
+     */
+    static const char magic[8] = {'T', 'R', 'T', 'N', 'D', 'A', 'G', '\0'};
+
+    enum section_e {
+      NODES_SECTION,
+      CHILDREN_SECTION,
+      CONSTANTS_SECTION,
+      STRINGS_SECTION,
+      VARIABLES_SECTION,
+      EXPRESSIONS_SECTION,
+      ROOTS_SECTION,
+      BLOB_SECTION,
+      SECTIONS,
+    };
+
+    /* The size of a record of each section */
+    static const triton::usize recordSizes[SECTIONS] = {16, 4, 8, 8, 40, 24, 4, 1};
+
+    /* The size of the header */
+    static const triton::usize headerSize = 16 + SECTIONS * 16;
+
+    /* Expression flags */
+    static const triton::uint32 taintedFlag = 1;
+
+
+    /* Appends a little-endian integer */
+    static void put(std::string& out, triton::uint64 value, triton::usize bytes) {
+      for (triton::usize index = 0; index < bytes; index++)
+        out.push_back(static_cast<char>((value >> (index * 8)) & 0xff));
+    }
+
+
+    /* Reads a little-endian integer */
+    static triton::uint64 get(const triton::uint8* data, triton::usize bytes) {
+      triton::uint64 value = 0;
+      for (triton::usize index = bytes; index > 0; index--)
+        value = (value << 8) | data[index - 1];
+      return value;
+    }
+
+
+    /* Returns the index of a string in the string table, adding it if needed */
+    static triton::uint32 addString(const std::string& value, std::string& strings, std::string& blob, std::unordered_map<std::string, triton::uint32>& indexes) {
+      auto it = indexes.find(value);
+      if (it != indexes.end())
+        return it->second;
+
+      triton::uint32 index = static_cast<triton::uint32>(strings.size() / recordSizes[STRINGS_SECTION]);
+      put(strings, blob.size(), 4);
+      put(strings, value.size(), 4);
+      blob.append(value);
+      indexes[value] = index;
+      return index;
+    }
+
+
+    /* Returns the index of a constant in the constant table, adding it if needed */
+    static triton::uint32 addConstant(const triton::uint512& value, std::string& constants, std::string& blob, std::map<triton::uint512, triton::uint32>& indexes) {
+      auto it = indexes.find(value);
+      if (it != indexes.end())
+        return it->second;
+
+      triton::uint32 index = static_cast<triton::uint32>(constants.size() / recordSizes[CONSTANTS_SECTION]);
+      triton::usize offset = blob.size();
+      for (triton::uint512 v = value; v != 0; v >>= 8)
+        blob.push_back(static_cast<char>((v & 0xff).convert_to<triton::uint32>()));
+      put(constants, offset, 4);
+      put(constants, blob.size() - offset, 4);
+      indexes[value] = index;
+      return index;
+    }
+
+
+    AstSerializer::AstSerializer(const SharedAstContext& ctxt) {
+      this->ctxt = ctxt;
+    }
+
+
+    void AstSerializer::serialize(std::ostream& stream, const std::vector<SharedAbstractNode>& roots, const std::vector<triton::engines::symbolic::SharedSymbolicExpression>& exprs) const {
+      std::string sections[SECTIONS];
+      std::unordered_map<AbstractNode*, triton::uint32> nodeIndexes;
+      std::unordered_map<triton::engines::symbolic::SymbolicExpression*, triton::uint32> exprIndexes;
+      std::unordered_map<triton::engines::symbolic::SymbolicVariable*, triton::uint32> varIndexes;
+      std::unordered_map<std::string, triton::uint32> stringIndexes;
+      std::map<triton::uint512, triton::uint32> constantIndexes;
+      std::string& blob = sections[BLOB_SECTION];
+
+      /* Returns the index of an expression, adding it once its AST is written */
+      auto addExpression = [&](triton::engines::symbolic::SymbolicExpression* expr) -> triton::uint32 {
+        auto it = exprIndexes.find(expr);
+        if (it != exprIndexes.end())
+          return it->second;
+
+        triton::uint32 index = static_cast<triton::uint32>(exprIndexes.size());
+        std::string& out = sections[EXPRESSIONS_SECTION];
+        put(out, expr->getId(), 8);
+        put(out, nodeIndexes.at(expr->getAst().get()), 4);
+        put(out, expr->getType(), 4);
+        put(out, addString(expr->getComment(), sections[STRINGS_SECTION], blob, stringIndexes), 4);
+        put(out, expr->isTainted ? taintedFlag : 0, 4);
+        exprIndexes[expr] = index;
+        return index;
+      };
+
+      /* Writes a node whose dependencies are written */
+      auto addNode = [&](AbstractNode* node) {
+        triton::uint32 first   = static_cast<triton::uint32>(sections[CHILDREN_SECTION].size() / recordSizes[CHILDREN_SECTION]);
+        triton::uint32 count   = 0;
+        triton::uint32 payload = 0;
+
+        switch (node->getType()) {
+          case INTEGER_NODE:
+            payload = addConstant(reinterpret_cast<IntegerNode*>(node)->getInteger(), sections[CONSTANTS_SECTION], blob, constantIndexes);
+            break;
+
+          case STRING_NODE:
+            payload = addString(reinterpret_cast<StringNode*>(node)->getString(), sections[STRINGS_SECTION], blob, stringIndexes);
+            break;
+
+          case REFERENCE_NODE:
+            payload = addExpression(reinterpret_cast<ReferenceNode*>(node)->getSymbolicExpression().get());
+            break;
+
+          case VARIABLE_NODE: {
+            const auto& var = reinterpret_cast<VariableNode*>(node)->getSymbolicVariable();
+            auto it = varIndexes.find(var.get());
+            if (it == varIndexes.end()) {
+              std::string& out = sections[VARIABLES_SECTION];
+              payload = static_cast<triton::uint32>(varIndexes.size());
+              put(out, var->getId(), 8);
+              put(out, var->getOrigin(), 8);
+              put(out, var->getType(), 4);
+              put(out, var->getSize(), 4);
+              put(out, addString(var->getAlias(), sections[STRINGS_SECTION], blob, stringIndexes), 4);
+              put(out, addString(var->getComment(), sections[STRINGS_SECTION], blob, stringIndexes), 4);
+              put(out, addConstant(node->evaluate(), sections[CONSTANTS_SECTION], blob, constantIndexes), 4);
+              put(out, 0, 4);
+              varIndexes[var.get()] = payload;
+            }
+            else {
+              payload = it->second;
+            }
+            break;
+          }
+
+          default:
+            for (const auto& child : node->getChildren()) {
+              put(sections[CHILDREN_SECTION], nodeIndexes.at(child.get()), 4);
+              count++;
+            }
+            break;
+        }
+
+        std::string& out = sections[NODES_SECTION];
+        put(out, node->getType(), 4);
+        put(out, first, 4);
+        put(out, count, 4);
+        put(out, payload, 4);
+        nodeIndexes[node] = static_cast<triton::uint32>(nodeIndexes.size());
+      };
+
+      /*
+       * Nodes are written in post order. The AST of an expression is a dependency
+       * of its references. We use a worklist strategy to avoid recursive calls
+       * and so stack overflow when going through a big AST.
+       */
+      auto addTree = [&](AbstractNode* root) {
+        std::stack<std::pair<AbstractNode*, bool>> worklist;
+        worklist.push({root, false});
+
+        while (!worklist.empty()) {
+          AbstractNode* node = worklist.top().first;
+          bool postOrder     = worklist.top().second;
+          worklist.pop();
+
+          if (nodeIndexes.find(node) != nodeIndexes.end())
+            continue;
+
+          if (postOrder) {
+            addNode(node);
+            continue;
+          }
+
+          worklist.push({node, true});
+          if (node->getType() == REFERENCE_NODE) {
+            worklist.push({reinterpret_cast<ReferenceNode*>(node)->getSymbolicExpression()->getAst().get(), false});
+          }
+          else {
+            const auto& children = node->getChildren();
+            for (auto it = children.rbegin(); it != children.rend(); ++it)
+              worklist.push({it->get(), false});
+          }
+        }
+      };
+
+      for (const auto& root : roots) {
+        if (root == nullptr)
+          throw triton::exceptions::Ast("AstSerializer::serialize(): The node cannot be null.");
+        addTree(root.get());
+        put(sections[ROOTS_SECTION], nodeIndexes.at(root.get()), 4);
+      }
+
+      for (const auto& expr : exprs) {
+        if (expr == nullptr)
+          throw triton::exceptions::Ast("AstSerializer::serialize(): The expression cannot be null.");
+        addTree(expr->getAst().get());
+        addExpression(expr.get());
+      }
+
+      if (blob.size() > 0xffffffff)
+        throw triton::exceptions::Ast("AstSerializer::serialize(): Constants and strings do not fit in the format.");
+
+      /* Header */
+      std::string header(magic, sizeof(magic));
+      put(header, AstSerializer::version, 4);
+      put(header, 0, 4);
+
+      triton::usize offset = headerSize;
+      for (triton::usize index = 0; index < SECTIONS; index++) {
+        put(header, offset, 8);
+        put(header, (index == BLOB_SECTION) ? sections[index].size() : sections[index].size() / recordSizes[index], 8);
+        /* Sections are aligned on 8 bytes, the padding is not counted */
+        while (sections[index].size() % 8)
+          sections[index].push_back('\0');
+        offset += sections[index].size();
+      }
+
+      stream.write(header.data(), header.size());
+      for (const auto& section : sections)
+        stream.write(section.data(), section.size());
+
+      if (!stream)
+        throw triton::exceptions::Ast("AstSerializer::serialize(): Cannot write into the stream.");
+    }
+
+
+    std::vector<SharedAbstractNode> AstSerializer::deserialize(const void* data, triton::usize size) {
+      const triton::uint8* base = reinterpret_cast<const triton::uint8*>(data);
+      const triton::uint8* sections[SECTIONS];
+      triton::usize counts[SECTIONS];
+
+      this->variables.clear();
+      this->expressions.clear();
+
+      /* Header */
+      if (base == nullptr || size < headerSize || std::memcmp(base, magic, sizeof(magic)) != 0)
+        throw triton::exceptions::Ast("AstSerializer::deserialize(): Not a serialized AST.");
+
+      if (get(base + 8, 4) != AstSerializer::version)
+        throw triton::exceptions::Ast("AstSerializer::deserialize(): Unsupported version.");
+
+      for (triton::usize index = 0; index < SECTIONS; index++) {
+        triton::uint64 offset = get(base + 16 + index * 16, 8);
+        triton::uint64 count  = get(base + 24 + index * 16, 8);
+        if (offset > size || count > (size - offset) / recordSizes[index])
+          throw triton::exceptions::Ast("AstSerializer::deserialize(): Truncated section.");
+        sections[index] = base + offset;
+        counts[index]   = static_cast<triton::usize>(count);
+      }
+
+      /* Accessors of records */
+      auto field = [&](section_e section, triton::usize index, triton::usize offset, triton::usize bytes) -> triton::uint64 {
+        if (index >= counts[section])
+          throw triton::exceptions::Ast("AstSerializer::deserialize(): Invalid index.");
+        return get(sections[section] + index * recordSizes[section] + offset, bytes);
+      };
+
+      auto span = [&](section_e section, triton::usize index) -> std::pair<const triton::uint8*, triton::usize> {
+        triton::uint64 offset = field(section, index, 0, 4);
+        triton::uint64 length = field(section, index, 4, 4);
+        if (offset > counts[BLOB_SECTION] || length > counts[BLOB_SECTION] - offset)
+          throw triton::exceptions::Ast("AstSerializer::deserialize(): Invalid blob range.");
+        return {sections[BLOB_SECTION] + offset, static_cast<triton::usize>(length)};
+      };
+
+      auto constant = [&](triton::usize index) -> triton::uint512 {
+        auto bytes = span(CONSTANTS_SECTION, index);
+        if (bytes.second > triton::size::dqqword)
+          throw triton::exceptions::Ast("AstSerializer::deserialize(): Constant too large.");
+        triton::uint512 value = 0;
+        for (triton::usize i = bytes.second; i > 0; i--)
+          value = (value << 8) | bytes.first[i - 1];
+        return value;
+      };
+
+      auto string = [&](triton::usize index) -> std::string {
+        auto bytes = span(STRINGS_SECTION, index);
+        return std::string(reinterpret_cast<const char*>(bytes.first), bytes.second);
+      };
+
+      std::vector<SharedAbstractNode> nodes(counts[NODES_SECTION]);
+      this->variables.resize(counts[VARIABLES_SECTION]);
+      this->expressions.resize(counts[EXPRESSIONS_SECTION]);
+
+      /* Returns a node which must come before `current` */
+      auto nodeAt = [&](triton::uint64 index, triton::usize current) -> const SharedAbstractNode& {
+        if (index >= current)
+          throw triton::exceptions::Ast("AstSerializer::deserialize(): Nodes are not in topological order.");
+        return nodes[static_cast<triton::usize>(index)];
+      };
+
+      auto expressionAt = [&](triton::usize index, triton::usize current) -> const triton::engines::symbolic::SharedSymbolicExpression& {
+        if (index >= this->expressions.size())
+          throw triton::exceptions::Ast("AstSerializer::deserialize(): Invalid expression.");
+        if (this->expressions[index] == nullptr) {
+          auto expr = std::make_shared<triton::engines::symbolic::SymbolicExpression>(
+            nodeAt(field(EXPRESSIONS_SECTION, index, 8, 4), current),
+            static_cast<triton::usize>(field(EXPRESSIONS_SECTION, index, 0, 8)),
+            static_cast<triton::engines::symbolic::expression_e>(field(EXPRESSIONS_SECTION, index, 12, 4)),
+            string(field(EXPRESSIONS_SECTION, index, 16, 4))
+          );
+          expr->isTainted = (field(EXPRESSIONS_SECTION, index, 20, 4) & taintedFlag) != 0;
+          this->expressions[index] = expr;
+        }
+        return this->expressions[index];
+      };
+
+      auto variableAt = [&](triton::usize index) -> SharedAbstractNode {
+        if (index >= this->variables.size())
+          throw triton::exceptions::Ast("AstSerializer::deserialize(): Invalid variable.");
+        auto var = std::make_shared<triton::engines::symbolic::SymbolicVariable>(
+          static_cast<triton::engines::symbolic::variable_e>(field(VARIABLES_SECTION, index, 16, 4)),
+          field(VARIABLES_SECTION, index, 8, 8),
+          static_cast<triton::usize>(field(VARIABLES_SECTION, index, 0, 8)),
+          static_cast<triton::uint32>(field(VARIABLES_SECTION, index, 20, 4)),
+          string(field(VARIABLES_SECTION, index, 24, 4))
+        );
+        var->setComment(string(field(VARIABLES_SECTION, index, 28, 4)));
+
+        /* A variable already known by the context is shared */
+        bool known = (this->ctxt->getVariableNode(var->getId()) != nullptr);
+        SharedAbstractNode node = this->ctxt->variable(var);
+        if (!known)
+          this->ctxt->updateVariable(var->getId(), constant(field(VARIABLES_SECTION, index, 32, 4)));
+        this->variables[index] = reinterpret_cast<VariableNode*>(node.get())->getSymbolicVariable();
+        return node;
+      };
+
+      /* Returns the value of an integer operand */
+      auto integer = [](const SharedAbstractNode& node) -> triton::uint512 {
+        if (node->getType() != INTEGER_NODE)
+          throw triton::exceptions::Ast("AstSerializer::deserialize(): Expected an integer node.");
+        return reinterpret_cast<IntegerNode*>(node.get())->getInteger();
+      };
+
+      for (triton::usize index = 0; index < nodes.size(); index++) {
+        triton::ast::ast_e type = static_cast<triton::ast::ast_e>(field(NODES_SECTION, index, 0, 4));
+        triton::uint64 first    = field(NODES_SECTION, index, 4, 4);
+        triton::uint64 count    = field(NODES_SECTION, index, 8, 4);
+        triton::uint64 payload  = field(NODES_SECTION, index, 12, 4);
+
+        if (first > counts[CHILDREN_SECTION] || count > counts[CHILDREN_SECTION] - first)
+          throw triton::exceptions::Ast("AstSerializer::deserialize(): Invalid children.");
+
+        std::vector<SharedAbstractNode> c;
+        c.reserve(static_cast<triton::usize>(count));
+        for (triton::uint64 i = 0; i < count; i++)
+          c.push_back(nodeAt(field(CHILDREN_SECTION, static_cast<triton::usize>(first + i), 0, 4), index));
+
+        /* Checks the number of operands */
+        auto arity = [&](triton::usize expected) {
+          if (c.size() != expected)
+            throw triton::exceptions::Ast("AstSerializer::deserialize(): Invalid number of children.");
+        };
+
+        auto variadic = [&](triton::usize minimum) {
+          if (c.size() < minimum)
+            throw triton::exceptions::Ast("AstSerializer::deserialize(): Invalid number of children.");
+        };
+
+        SharedAbstractNode node = nullptr;
+        switch (type) {
+          case INTEGER_NODE:    node = this->ctxt->integer(constant(static_cast<triton::usize>(payload))); break;
+          case STRING_NODE:     node = this->ctxt->string(string(static_cast<triton::usize>(payload))); break;
+          case VARIABLE_NODE:   node = variableAt(static_cast<triton::usize>(payload)); break;
+          case REFERENCE_NODE:  node = this->ctxt->reference(expressionAt(static_cast<triton::usize>(payload), index)); break;
+
+          case ARRAY_NODE:      arity(1); node = this->ctxt->array(integer(c[0]).convert_to<triton::uint32>()); break;
+          case ASSERT_NODE:     arity(1); node = this->ctxt->assert_(c[0]); break;
+          case BSWAP_NODE:      arity(1); node = this->ctxt->bswap(c[0]); break;
+          case BVNEG_NODE:      arity(1); node = this->ctxt->bvneg(c[0]); break;
+          case BVNOT_NODE:      arity(1); node = this->ctxt->bvnot(c[0]); break;
+          case BVPARITY_NODE:   arity(1); node = this->ctxt->bvparity(c[0]); break;
+          case BVPOPCOUNT_NODE: arity(1); node = this->ctxt->bvpopcount(c[0]); break;
+          case DECLARE_NODE:    arity(1); node = this->ctxt->declare(c[0]); break;
+          case LNOT_NODE:       arity(1); node = this->ctxt->lnot(c[0]); break;
+
+          case BVADD_NODE:      variadic(2); node = this->ctxt->bvadd(c); break;
+          case BVAND_NODE:      variadic(2); node = this->ctxt->bvand(c); break;
+          case BVASHR_NODE:     arity(2); node = this->ctxt->bvashr(c[0], c[1]); break;
+          case BVLSHR_NODE:     arity(2); node = this->ctxt->bvlshr(c[0], c[1]); break;
+          case BVMUL_NODE:      arity(2); node = this->ctxt->bvmul(c[0], c[1]); break;
+          case BVNAND_NODE:     arity(2); node = this->ctxt->bvnand(c[0], c[1]); break;
+          case BVNOR_NODE:      arity(2); node = this->ctxt->bvnor(c[0], c[1]); break;
+          case BVOR_NODE:       variadic(2); node = this->ctxt->bvor(c); break;
+          case BVSDIV_NODE:     arity(2); node = this->ctxt->bvsdiv(c[0], c[1]); break;
+          case BVSGE_NODE:      arity(2); node = this->ctxt->bvsge(c[0], c[1]); break;
+          case BVSGT_NODE:      arity(2); node = this->ctxt->bvsgt(c[0], c[1]); break;
+          case BVSHL_NODE:      arity(2); node = this->ctxt->bvshl(c[0], c[1]); break;
+          case BVSLE_NODE:      arity(2); node = this->ctxt->bvsle(c[0], c[1]); break;
+          case BVSLT_NODE:      arity(2); node = this->ctxt->bvslt(c[0], c[1]); break;
+          case BVSMOD_NODE:     arity(2); node = this->ctxt->bvsmod(c[0], c[1]); break;
+          case BVSREM_NODE:     arity(2); node = this->ctxt->bvsrem(c[0], c[1]); break;
+          case BVSUB_NODE:      arity(2); node = this->ctxt->bvsub(c[0], c[1]); break;
+          case BVUDIV_NODE:     arity(2); node = this->ctxt->bvudiv(c[0], c[1]); break;
+          case BVUGE_NODE:      arity(2); node = this->ctxt->bvuge(c[0], c[1]); break;
+          case BVUGT_NODE:      arity(2); node = this->ctxt->bvugt(c[0], c[1]); break;
+          case BVULE_NODE:      arity(2); node = this->ctxt->bvule(c[0], c[1]); break;
+          case BVULT_NODE:      arity(2); node = this->ctxt->bvult(c[0], c[1]); break;
+          case BVUREM_NODE:     arity(2); node = this->ctxt->bvurem(c[0], c[1]); break;
+          case BVXNOR_NODE:     arity(2); node = this->ctxt->bvxnor(c[0], c[1]); break;
+          case BVXOR_NODE:      variadic(2); node = this->ctxt->bvxor(c); break;
+          case DISTINCT_NODE:   arity(2); node = this->ctxt->distinct(c[0], c[1]); break;
+          case EQUAL_NODE:      arity(2); node = this->ctxt->equal(c[0], c[1]); break;
+          case IFF_NODE:        arity(2); node = this->ctxt->iff(c[0], c[1]); break;
+          case SELECT_NODE:     arity(2); node = this->ctxt->select(c[0], c[1]); break;
+
+          case BVROL_NODE:
+            arity(2);
+            if (c[1]->getType() != INTEGER_NODE)
+              node = this->ctxt->bvrol(c[0], c[1]);
+            /* An amount taken from a node may not fit on 32 bits, the node builder keeps it whole */
+            else if (integer(c[1]) > std::numeric_limits<triton::uint32>::max())
+              node = this->ctxt->bvrol(c[0], this->ctxt->bv(integer(c[1]), triton::bitsize::max_supported));
+            else
+              node = this->ctxt->bvrol(c[0], integer(c[1]).convert_to<triton::uint32>());
+            break;
+
+          case BVROR_NODE:
+            arity(2);
+            if (c[1]->getType() != INTEGER_NODE)
+              node = this->ctxt->bvror(c[0], c[1]);
+            /* An amount taken from a node may not fit on 32 bits, the node builder keeps it whole */
+            else if (integer(c[1]) > std::numeric_limits<triton::uint32>::max())
+              node = this->ctxt->bvror(c[0], this->ctxt->bv(integer(c[1]), triton::bitsize::max_supported));
+            else
+              node = this->ctxt->bvror(c[0], integer(c[1]).convert_to<triton::uint32>());
+            break;
+
+          case BVLANEADD_NODE:    arity(3); node = this->ctxt->bvlaneadd(c[0], c[1], integer(c[2]).convert_to<triton::uint32>()); break;
+          case BVLANEEQ_NODE:     arity(3); node = this->ctxt->bvlaneeq(c[0], c[1], integer(c[2]).convert_to<triton::uint32>()); break;
+          case BVLANESELECT_NODE: arity(4); node = this->ctxt->bvlaneselect(c[0], c[1], c[2], integer(c[3]).convert_to<triton::uint32>()); break;
+          case BVLANESGT_NODE:    arity(3); node = this->ctxt->bvlanesgt(c[0], c[1], integer(c[2]).convert_to<triton::uint32>()); break;
+          case BVLANESUB_NODE:    arity(3); node = this->ctxt->bvlanesub(c[0], c[1], integer(c[2]).convert_to<triton::uint32>()); break;
+
+          case BV_NODE:         arity(2); node = this->ctxt->bv(integer(c[0]), integer(c[1]).convert_to<triton::uint32>()); break;
+          case EXTRACT_NODE:    arity(3); node = this->ctxt->extract(integer(c[0]).convert_to<triton::uint32>(), integer(c[1]).convert_to<triton::uint32>(), c[2]); break;
+          case ITE_NODE:        arity(3); node = this->ctxt->ite(c[0], c[1], c[2]); break;
+          case STORE_NODE:      arity(3); node = this->ctxt->store(c[0], c[1], c[2]); break;
+          case SX_NODE:         arity(2); node = this->ctxt->sx(integer(c[0]).convert_to<triton::uint32>(), c[1]); break;
+          case ZX_NODE:         arity(2); node = this->ctxt->zx(integer(c[0]).convert_to<triton::uint32>(), c[1]); break;
+
+          case LET_NODE:
+            arity(3);
+            if (c[0]->getType() != STRING_NODE)
+              throw triton::exceptions::Ast("AstSerializer::deserialize(): Expected a string node.");
+            node = this->ctxt->let(reinterpret_cast<StringNode*>(c[0].get())->getString(), c[1], c[2]);
+            break;
+
+          case COMPOUND_NODE:   variadic(1); node = this->ctxt->compound(c); break;
+          case CONCAT_NODE:     variadic(2); node = this->ctxt->concat(c); break;
+          case LAND_NODE:       variadic(2); node = this->ctxt->land(c); break;
+          case LOR_NODE:        variadic(2); node = this->ctxt->lor(c); break;
+          case LXOR_NODE:       variadic(2); node = this->ctxt->lxor(c); break;
+
+          case FORALL_NODE:
+            variadic(2);
+            node = this->ctxt->forall(std::vector<SharedAbstractNode>(c.begin(), c.end() - 1), c.back());
+            break;
+
+          default:
+            throw triton::exceptions::Ast("AstSerializer::deserialize(): Invalid kind of node.");
+        }
+
+        nodes[index] = node;
+      }
+
+      /* Expressions which are not referenced */
+      for (triton::usize index = 0; index < this->expressions.size(); index++)
+        expressionAt(index, nodes.size());
+
+      std::vector<SharedAbstractNode> roots;
+      roots.reserve(counts[ROOTS_SECTION]);
+      for (triton::usize index = 0; index < counts[ROOTS_SECTION]; index++)
+        roots.push_back(nodeAt(field(ROOTS_SECTION, index, 0, 4), nodes.size()));
+
+      return roots;
+    }
+
+
+    std::vector<SharedAbstractNode> AstSerializer::deserialize(std::istream& stream) {
+      std::string buffer((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+      return this->deserialize(buffer.data(), buffer.size());
+    }
+
+
+    const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& AstSerializer::getVariables(void) const {
+      return this->variables;
+    }
+
+
+    const std::vector<triton::engines::symbolic::SharedSymbolicExpression>& AstSerializer::getExpressions(void) const {
+      return this->expressions;
+    }
+
+  }; /* ast namespace */
+}; /* triton namespace */
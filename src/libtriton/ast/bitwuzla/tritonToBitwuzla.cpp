@@ -25,6 +25,7 @@ namespace triton {
 
     TritonToBitwuzla::~TritonToBitwuzla() {
       this->translatedNodes.clear();
+      this->arrays.clear();
       this->variables.clear();
       this->symbols.clear();
     }
@@ -62,6 +63,17 @@ namespace triton {
 
       switch (node->getType()) {
 
+        /* All the arrays with the same size of indexes are the same memory, an uninterpreted array of bytes */
+        case ARRAY_NODE: {
+          auto indexSize = triton::ast::getArrayIndexSize(node);
+          auto it = this->arrays.find(indexSize);
+          if (it == this->arrays.end()) {
+            auto* sort = bitwuzla_mk_array_sort(bzla, bitwuzla_mk_bv_sort(bzla, indexSize), bitwuzla_mk_bv_sort(bzla, triton::bitsize::byte));
+            it = this->arrays.insert({indexSize, bitwuzla_mk_const(bzla, sort, ("memory_" + std::to_string(indexSize)).c_str())}).first;
+          }
+          return it->second;
+        }
+
         case BSWAP_NODE: {
           auto bvsize = node->getBitvectorSize();
           auto* bvsort = bitwuzla_mk_bv_sort(bzla, bvsize);
@@ -79,14 +91,60 @@ namespace triton {
         }
 
         case BVADD_NODE:
-          return bitwuzla_mk_term2(bzla, BITWUZLA_KIND_BV_ADD, children[0], children[1]);
+          return bitwuzla_mk_term(bzla, BITWUZLA_KIND_BV_ADD, children.size(), children.data());
 
         case BVAND_NODE:
-          return bitwuzla_mk_term2(bzla, BITWUZLA_KIND_BV_AND, children[0], children[1]);
+          return bitwuzla_mk_term(bzla, BITWUZLA_KIND_BV_AND, children.size(), children.data());
 
         case BVASHR_NODE:
           return bitwuzla_mk_term2(bzla, BITWUZLA_KIND_BV_ASHR, children[0], children[1]);
 
+        /* Lane-wise nodes are expanded into one operation per lane */
+        case BVLANEADD_NODE:
+        case BVLANEEQ_NODE:
+        case BVLANESELECT_NODE:
+        case BVLANESGT_NODE:
+        case BVLANESUB_NODE: {
+          auto bvsize  = node->getBitvectorSize();
+          auto lane    = reinterpret_cast<IntegerNode*>(node->getChildren().back().get())->getInteger().convert_to<triton::uint32>();
+          auto* sort   = bitwuzla_mk_bv_sort(bzla, lane);
+          auto* zero   = bitwuzla_mk_bv_zero(bzla, sort);
+          auto* ones   = bitwuzla_mk_bv_ones(bzla, sort);
+          auto* one    = bitwuzla_mk_bv_one(bzla, bitwuzla_mk_bv_sort(bzla, 1));
+          const BitwuzlaTerm* retval = nullptr;
+
+          for (triton::uint32 low = 0 ; low != bvsize ; low += lane) {
+            triton::uint32 high = low + lane - 1;
+            auto* op1 = bitwuzla_mk_term1_indexed2(bzla, BITWUZLA_KIND_BV_EXTRACT, children[0], high, low);
+            auto* op2 = bitwuzla_mk_term1_indexed2(bzla, BITWUZLA_KIND_BV_EXTRACT, children[1], high, low);
+            const BitwuzlaTerm* value = nullptr;
+
+            switch (node->getType()) {
+              case BVLANEADD_NODE:
+                value = bitwuzla_mk_term2(bzla, BITWUZLA_KIND_BV_ADD, op1, op2);
+                break;
+              case BVLANEEQ_NODE:
+                value = bitwuzla_mk_term3(bzla, BITWUZLA_KIND_ITE, bitwuzla_mk_term2(bzla, BITWUZLA_KIND_EQUAL, op1, op2), ones, zero);
+                break;
+              case BVLANESGT_NODE:
+                value = bitwuzla_mk_term3(bzla, BITWUZLA_KIND_ITE, bitwuzla_mk_term2(bzla, BITWUZLA_KIND_BV_SGT, op1, op2), ones, zero);
+                break;
+              case BVLANESUB_NODE:
+                value = bitwuzla_mk_term2(bzla, BITWUZLA_KIND_BV_SUB, op1, op2);
+                break;
+              default: {
+                auto* op3 = bitwuzla_mk_term1_indexed2(bzla, BITWUZLA_KIND_BV_EXTRACT, children[2], high, low);
+                auto* msb = bitwuzla_mk_term1_indexed2(bzla, BITWUZLA_KIND_BV_EXTRACT, children[0], high, high);
+                value = bitwuzla_mk_term3(bzla, BITWUZLA_KIND_ITE, bitwuzla_mk_term2(bzla, BITWUZLA_KIND_EQUAL, msb, one), op2, op3);
+                break;
+              }
+            }
+
+            retval = (low == 0) ? value : bitwuzla_mk_term2(bzla, BITWUZLA_KIND_BV_CONCAT, value, retval);
+          }
+          return retval;
+        }
+
         case BVLSHR_NODE:
           return bitwuzla_mk_term2(bzla, BITWUZLA_KIND_BV_SHR, children[0], children[1]);
 
@@ -106,7 +164,23 @@ namespace triton {
           return bitwuzla_mk_term1(bzla, BITWUZLA_KIND_BV_NOT, children[0]);
 
         case BVOR_NODE:
-          return bitwuzla_mk_term2(bzla, BITWUZLA_KIND_BV_OR, children[0], children[1]);
+          return bitwuzla_mk_term(bzla, BITWUZLA_KIND_BV_OR, children.size(), children.data());
+
+        case BVPARITY_NODE:
+          return bitwuzla_mk_term1(bzla, BITWUZLA_KIND_BV_REDXOR, children[0]);
+
+        case BVPOPCOUNT_NODE: {
+          auto bvsize = node->getBitvectorSize();
+          if (bvsize == 1)
+            return children[0];
+          auto* retval = bitwuzla_mk_term1_indexed1(bzla, BITWUZLA_KIND_BV_ZERO_EXTEND, bitwuzla_mk_term1_indexed2(bzla, BITWUZLA_KIND_BV_EXTRACT, children[0], 0, 0), bvsize - 1);
+          for (triton::uint32 index = 1 ; index != bvsize ; index++) {
+            retval = bitwuzla_mk_term2(bzla, BITWUZLA_KIND_BV_ADD, retval,
+                      bitwuzla_mk_term1_indexed1(bzla, BITWUZLA_KIND_BV_ZERO_EXTEND, bitwuzla_mk_term1_indexed2(bzla, BITWUZLA_KIND_BV_EXTRACT, children[0], index, index), bvsize - 1)
+                     );
+          }
+          return retval;
+        }
 
         case BVROL_NODE: {
           auto childNodes = node->getChildren();
@@ -169,7 +243,7 @@ namespace triton {
           return bitwuzla_mk_term2(bzla, BITWUZLA_KIND_BV_XNOR, children[0], children[1]);
 
         case BVXOR_NODE:
-          return bitwuzla_mk_term2(bzla, BITWUZLA_KIND_BV_XOR, children[0], children[1]);
+          return bitwuzla_mk_term(bzla, BITWUZLA_KIND_BV_XOR, children.size(), children.data());
 
         case BV_NODE: {
           auto childNodes = node->getChildren();
@@ -239,6 +313,12 @@ namespace triton {
           return this->translatedNodes.at(ref);
         }
 
+        case SELECT_NODE:
+          return bitwuzla_mk_term2(bzla, BITWUZLA_KIND_ARRAY_SELECT, children[0], children[1]);
+
+        case STORE_NODE:
+          return bitwuzla_mk_term3(bzla, BITWUZLA_KIND_ARRAY_STORE, children[0], children[1], children[2]);
+
         case STRING_NODE: {
           std::string value = reinterpret_cast<triton::ast::StringNode*>(node.get())->getString();
 
@@ -0,0 +1,208 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include <triton/astJit.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/tritonToLLVM.hpp>
+
+#include <llvm/Analysis/TargetTransformInfo.h>
+#include <llvm/Config/llvm-config.h>
+#include <llvm/ExecutionEngine/Orc/JITTargetMachineBuilder.h>
+#include <llvm/ExecutionEngine/Orc/ThreadSafeModule.h>
+#include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/LegacyPassManager.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Support/Error.h>
+#include <llvm/Support/TargetSelect.h>
+#include <llvm/Target/TargetMachine.h>
+#include <llvm/Transforms/IPO.h>
+#include <llvm/Transforms/IPO/PassManagerBuilder.h>
+#include <llvm/Transforms/Utils/Cloning.h>
+
+
+
+namespace triton {
+  namespace ast {
+
+    /* Returns the value of an LLVM expected or throws its error */
+    template <typename T>
+    static T check(llvm::Expected<T> value, const char* what) {
+      if (!value)
+        throw triton::exceptions::AstLifting(std::string("AstJit::AstJit(): ") + what + ": " + llvm::toString(value.takeError()));
+      return std::move(*value);
+    }
+
+
+    AstJit::AstJit(const SharedAbstractNode& node) {
+      static std::once_flag initialized;
+
+      if (node == nullptr)
+        throw triton::exceptions::AstLifting("AstJit::AstJit(): Node cannot be null.");
+
+      this->size = node->getBitvectorSize();
+      if (this->size == 0 || this->size > 64)
+        throw triton::exceptions::AstLifting("AstJit::AstJit(): The result must be at most 64-bit long.");
+
+      /* The arguments of the lifted function are named by the variables */
+      std::map<std::string, triton::usize> indexes;
+      for (const auto& var : triton::ast::search(node, triton::ast::VARIABLE_NODE))
+        this->variables.push_back(reinterpret_cast<VariableNode*>(var.get())->getSymbolicVariable());
+
+      std::sort(this->variables.begin(), this->variables.end(), [](const triton::engines::symbolic::SharedSymbolicVariable& a, const triton::engines::symbolic::SharedSymbolicVariable& b) {
+        return a->getId() < b->getId();
+      });
+      this->variables.erase(std::unique(this->variables.begin(), this->variables.end()), this->variables.end());
+
+      for (triton::usize index = 0; index < this->variables.size(); index++)
+        indexes[this->variables[index]->getName()] = index;
+
+      std::call_once(initialized, []() {
+        llvm::InitializeNativeTarget();
+        llvm::InitializeNativeTargetAsmPrinter();
+      });
+
+      auto builder       = check(llvm::orc::JITTargetMachineBuilder::detectHost(), "Cannot detect the host");
+      auto targetMachine = check(builder.createTargetMachine(), "Cannot create the target machine");
+
+      /* The context is owned by the JIT once the module is added */
+      auto context = std::make_unique<llvm::LLVMContext>();
+      std::unique_ptr<llvm::Module> module;
+      {
+        triton::ast::TritonToLLVM lifter(*context);
+        module = llvm::CloneModule(*lifter.convert(node, "__triton", false));
+      }
+      module->setDataLayout(targetMachine->createDataLayout());
+      module->setTargetTriple(targetMachine->getTargetTriple().str());
+
+      /* The lifted function is inlined into the loop */
+      auto* expr = module->getFunction("__triton");
+      expr->setLinkage(llvm::GlobalValue::InternalLinkage);
+
+      /*
+       * void __triton_jit(const uint64* inputs, uint64* outputs, uint64 count) {
+       *   for (uint64 i = 0; i < count; i++)
+       *     outputs[i] = __triton(inputs[i * variables + 0], ..., inputs[i * variables + n]);
+       * }
+       */
+      auto* i64      = llvm::Type::getInt64Ty(*context);
+      auto* ptr      = llvm::PointerType::getUnqual(i64);
+      auto* funcType = llvm::FunctionType::get(llvm::Type::getVoidTy(*context), {ptr, ptr, i64}, false /* isVarArg */);
+      auto* func     = llvm::Function::Create(funcType, llvm::Function::ExternalLinkage, "__triton_jit", module.get());
+
+      auto* inputs  = func->getArg(0);
+      auto* outputs = func->getArg(1);
+      auto* count   = func->getArg(2);
+
+      auto* entry = llvm::BasicBlock::Create(*context, "entry", func);
+      auto* loop  = llvm::BasicBlock::Create(*context, "loop", func);
+      auto* exit  = llvm::BasicBlock::Create(*context, "exit", func);
+
+      llvm::IRBuilder<> ir(entry);
+      ir.CreateCondBr(ir.CreateICmpEQ(count, ir.getInt64(0)), exit, loop);
+
+      ir.SetInsertPoint(loop);
+      auto* i   = ir.CreatePHI(i64, 2);
+      auto* row = ir.CreateMul(i, ir.getInt64(this->variables.size()));
+
+      std::vector<llvm::Value*> args;
+      for (auto& arg : expr->args()) {
+        auto it = indexes.find(arg.getName().str());
+        if (it == indexes.end())
+          throw triton::exceptions::AstLifting("AstJit::AstJit(): Unknown argument of the lifted function.");
+        auto* value = ir.CreateLoad(i64, ir.CreateGEP(i64, inputs, ir.CreateAdd(row, ir.getInt64(it->second))));
+        args.push_back(ir.CreateTrunc(value, arg.getType()));
+      }
+
+      auto* result = ir.CreateZExt(ir.CreateCall(expr, args), i64);
+      ir.CreateStore(result, ir.CreateGEP(i64, outputs, i));
+
+      auto* next = ir.CreateAdd(i, ir.getInt64(1));
+      i->addIncoming(ir.getInt64(0), entry);
+      i->addIncoming(next, loop);
+      ir.CreateCondBr(ir.CreateICmpEQ(next, count), exit, loop);
+
+      ir.SetInsertPoint(exit);
+      ir.CreateRetVoid();
+
+      /* Apply LLVM optimizations (-O2) for the host */
+      llvm::legacy::PassManager pm;
+      llvm::PassManagerBuilder pmb;
+      pmb.OptLevel = 2;
+      pmb.Inliner = llvm::createFunctionInliningPass(2, 0, false);
+      pmb.LoopVectorize = true;
+      pmb.SLPVectorize = true;
+      targetMachine->adjustPassManager(pmb);
+      pm.add(llvm::createTargetTransformInfoWrapperPass(targetMachine->getTargetIRAnalysis()));
+      pmb.populateModulePassManager(pm);
+      pm.run(*module);
+
+      /* Compile the module */
+      this->jit = check(llvm::orc::LLJITBuilder().setJITTargetMachineBuilder(std::move(builder)).create(), "Cannot create the JIT");
+
+      if (auto err = this->jit->addIRModule(llvm::orc::ThreadSafeModule(std::move(module), std::move(context))))
+        throw triton::exceptions::AstLifting("AstJit::AstJit(): Cannot add the module: " + llvm::toString(std::move(err)));
+
+      auto symbol = check(this->jit->lookup("__triton_jit"), "Cannot find the compiled code");
+      #if LLVM_VERSION_MAJOR >= 15
+      this->function = symbol.toPtr<Function>();
+      #else
+      this->function = reinterpret_cast<Function>(symbol.getAddress());
+      #endif
+    }
+
+
+    const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& AstJit::getVariables(void) const {
+      return this->variables;
+    }
+
+
+    triton::uint32 AstJit::getBitvectorSize(void) const {
+      return this->size;
+    }
+
+
+    triton::uint64 AstJit::evaluate(const std::vector<triton::uint64>& values) const {
+      triton::uint64 output = 0;
+
+      if (values.size() != this->variables.size())
+        throw triton::exceptions::Ast("AstJit::evaluate(): Invalid number of values.");
+
+      this->function(values.data(), &output, 1);
+
+      return output;
+    }
+
+
+    std::vector<triton::uint64> AstJit::evaluateBatch(const std::vector<std::vector<triton::uint64>>& inputs) const {
+      std::vector<triton::uint64> rows;
+      std::vector<triton::uint64> outputs(inputs.size());
+
+      rows.reserve(inputs.size() * this->variables.size());
+      for (const auto& values : inputs) {
+        if (values.size() != this->variables.size())
+          throw triton::exceptions::Ast("AstJit::evaluateBatch(): Invalid number of values.");
+        rows.insert(rows.end(), values.begin(), values.end());
+      }
+
+      this->evaluateBatch(rows.data(), outputs.data(), inputs.size());
+
+      return outputs;
+    }
+
+
+    void AstJit::evaluateBatch(const triton::uint64* inputs, triton::uint64* outputs, triton::usize count) const {
+      this->function(inputs, outputs, count);
+    }
+
+  }; /* ast namespace */
+}; /* triton namespace */
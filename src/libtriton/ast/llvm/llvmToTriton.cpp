@@ -5,6 +5,9 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <utility>
+#include <vector>
+
 #include <triton/exceptions.hpp>
 #include <triton/llvmToTriton.hpp>
 
@@ -30,7 +33,10 @@ namespace triton {
         /* Check if the instruction is a call */
         if (call != nullptr) {
           if (call->getCalledFunction()->getName().find("llvm.bswap.i") != std::string::npos) {
-            return this->actx->bswap(this->do_convert(call->getOperand(0)));
+            return this->actx->bswap(this->operand(call, 0));
+          }
+          if (call->getCalledFunction()->getName().find("llvm.ctpop.i") != std::string::npos) {
+            return this->actx->bvpopcount(this->operand(call, 0));
           }
           throw triton::exceptions::AstLifting("LLVMToTriton::do_convert(): LLVM call not supported");
         }
@@ -38,20 +44,20 @@ namespace triton {
         switch (instruction->getOpcode()) {
 
           case llvm::Instruction::AShr: {
-            auto LHS = this->do_convert(instruction->getOperand(0));
-            auto RHS = this->do_convert(instruction->getOperand(1));
+            auto LHS = this->operand(instruction, 0);
+            auto RHS = this->operand(instruction, 1);
             return this->actx->bvashr(LHS, RHS);
           }
 
           case llvm::Instruction::Add: {
-            auto LHS = this->do_convert(instruction->getOperand(0));
-            auto RHS = this->do_convert(instruction->getOperand(1));
+            auto LHS = this->operand(instruction, 0);
+            auto RHS = this->operand(instruction, 1);
             return this->actx->bvadd(LHS, RHS);
           }
 
           case llvm::Instruction::And: {
-            auto LHS = this->do_convert(instruction->getOperand(0));
-            auto RHS = this->do_convert(instruction->getOperand(1));
+            auto LHS = this->operand(instruction, 0);
+            auto RHS = this->operand(instruction, 1);
             /* LLVM does not distinct a logical AND of the bitwise AND */
             if (LHS->isLogical() && RHS->isLogical()) {
               return this->actx->ite(this->actx->land(LHS, RHS), this->actx->bvtrue(), this->actx->bvfalse());
@@ -61,8 +67,8 @@ namespace triton {
 
           case llvm::Instruction::ICmp: {
             triton::ast::SharedAbstractNode node = nullptr;
-            auto LHS = this->do_convert(instruction->getOperand(0));
-            auto RHS = this->do_convert(instruction->getOperand(1));
+            auto LHS = this->operand(instruction, 0);
+            auto RHS = this->operand(instruction, 1);
             if (icmp != nullptr) {
               switch (icmp->getPredicate()) {
                 case llvm::ICmpInst::ICMP_EQ:   return this->actx->equal(LHS, RHS);
@@ -84,20 +90,20 @@ namespace triton {
           }
 
           case llvm::Instruction::LShr: {
-            auto LHS = this->do_convert(instruction->getOperand(0));
-            auto RHS = this->do_convert(instruction->getOperand(1));
+            auto LHS = this->operand(instruction, 0);
+            auto RHS = this->operand(instruction, 1);
             return this->actx->bvlshr(LHS, RHS);
           }
 
           case llvm::Instruction::Mul: {
-            auto LHS = this->do_convert(instruction->getOperand(0));
-            auto RHS = this->do_convert(instruction->getOperand(1));
+            auto LHS = this->operand(instruction, 0);
+            auto RHS = this->operand(instruction, 1);
             return this->actx->bvmul(LHS, RHS);
           }
 
           case llvm::Instruction::Or: {
-            auto LHS = this->do_convert(instruction->getOperand(0));
-            auto RHS = this->do_convert(instruction->getOperand(1));
+            auto LHS = this->operand(instruction, 0);
+            auto RHS = this->operand(instruction, 1);
             /* LLVM does not distinct a logical OR of the bitwise OR */
             if (LHS->isLogical() && RHS->isLogical()) {
               return this->actx->ite(this->actx->lor(LHS, RHS), this->actx->bvtrue(), this->actx->bvfalse());
@@ -106,33 +112,33 @@ namespace triton {
           }
 
           case llvm::Instruction::Ret:
-            return this->do_convert(instruction->getOperand(0));
+            return this->operand(instruction, 0);
 
           case llvm::Instruction::SDiv: {
-            auto LHS = this->do_convert(instruction->getOperand(0));
-            auto RHS = this->do_convert(instruction->getOperand(1));
+            auto LHS = this->operand(instruction, 0);
+            auto RHS = this->operand(instruction, 1);
             return this->actx->bvsdiv(LHS, RHS);
           }
 
           case llvm::Instruction::SExt: {
             /* Final size */
             auto size = instruction->getType()->getIntegerBitWidth();
-            auto node = this->do_convert(instruction->getOperand(0));
+            auto node = this->operand(instruction, 0);
             /* Size of the child */
             auto csze = instruction->getOperand(0)->getType()->getIntegerBitWidth();
             return this->actx->sx(size - csze, node);
           }
 
           case llvm::Instruction::SRem: {
-            auto LHS = this->do_convert(instruction->getOperand(0));
-            auto RHS = this->do_convert(instruction->getOperand(1));
+            auto LHS = this->operand(instruction, 0);
+            auto RHS = this->operand(instruction, 1);
             return this->actx->bvsrem(LHS, RHS);
           }
 
           case llvm::Instruction::Select: {
-            auto nif    = this->do_convert(instruction->getOperand(0));
-            auto nthen  = this->do_convert(instruction->getOperand(1));
-            auto nelse  = this->do_convert(instruction->getOperand(2));
+            auto nif    = this->operand(instruction, 0);
+            auto nthen  = this->operand(instruction, 1);
+            auto nelse  = this->operand(instruction, 2);
 
             /*
              * In some cases, LLVM simplifies the icmp by a constant
@@ -147,38 +153,38 @@ namespace triton {
           }
 
           case llvm::Instruction::Shl: {
-            auto LHS = this->do_convert(instruction->getOperand(0));
-            auto RHS = this->do_convert(instruction->getOperand(1));
+            auto LHS = this->operand(instruction, 0);
+            auto RHS = this->operand(instruction, 1);
             return this->actx->bvshl(LHS, RHS);
           }
 
           case llvm::Instruction::Sub: {
-            auto LHS = this->do_convert(instruction->getOperand(0));
-            auto RHS = this->do_convert(instruction->getOperand(1));
+            auto LHS = this->operand(instruction, 0);
+            auto RHS = this->operand(instruction, 1);
             return this->actx->bvsub(LHS, RHS);
           }
 
           case llvm::Instruction::Trunc: {
             auto size = instruction->getType()->getIntegerBitWidth();
-            auto node = this->do_convert(instruction->getOperand(0));
+            auto node = this->operand(instruction, 0);
             return this->actx->extract(size - 1, 0, node);
           }
 
           case llvm::Instruction::UDiv: {
-            auto LHS = this->do_convert(instruction->getOperand(0));
-            auto RHS = this->do_convert(instruction->getOperand(1));
+            auto LHS = this->operand(instruction, 0);
+            auto RHS = this->operand(instruction, 1);
             return this->actx->bvudiv(LHS, RHS);
           }
 
           case llvm::Instruction::URem: {
-            auto LHS = this->do_convert(instruction->getOperand(0));
-            auto RHS = this->do_convert(instruction->getOperand(1));
+            auto LHS = this->operand(instruction, 0);
+            auto RHS = this->operand(instruction, 1);
             return this->actx->bvurem(LHS, RHS);
           }
 
           case llvm::Instruction::Xor: {
-            auto LHS = this->do_convert(instruction->getOperand(0));
-            auto RHS = this->do_convert(instruction->getOperand(1));
+            auto LHS = this->operand(instruction, 0);
+            auto RHS = this->operand(instruction, 1);
             /* LLVM does not distinct a logical XOR of the bitwise XOR */
             if (LHS->isLogical() && RHS->isLogical()) {
               return this->actx->ite(this->actx->lxor(LHS, RHS), this->actx->bvtrue(), this->actx->bvfalse());
@@ -189,7 +195,7 @@ namespace triton {
           case llvm::Instruction::ZExt: {
             /* Final size */
             auto size = instruction->getType()->getIntegerBitWidth();
-            auto node = this->do_convert(instruction->getOperand(0));
+            auto node = this->operand(instruction, 0);
             /* Size of the child */
             auto csze = instruction->getOperand(0)->getType()->getIntegerBitWidth();
             return this->actx->zx(size - csze, node);
@@ -224,7 +230,55 @@ namespace triton {
       llvm::Instruction* returnInstruction = entryBlock.getTerminator();
 
       /* Let's convert everything */
-      return this->do_convert(returnInstruction);
+      return this->convert(returnInstruction);
+    }
+
+
+    SharedAbstractNode LLVMToTriton::convert(llvm::Value* root) {
+      std::vector<std::pair<llvm::Value*, bool>> worklist;
+
+      /* The operands are converted before their users, once per value and without recursion */
+      this->values.clear();
+      try {
+        worklist.push_back({root, false});
+        while (!worklist.empty()) {
+          llvm::Value* value = worklist.back().first;
+          bool post = worklist.back().second;
+          worklist.pop_back();
+
+          if (this->values.find(value) != this->values.end())
+            continue;
+
+          if (post) {
+            this->values[value] = this->do_convert(value);
+            continue;
+          }
+
+          worklist.push_back({value, true});
+          if (auto* instruction = llvm::dyn_cast_or_null<llvm::Instruction>(value)) {
+            for (auto i = instruction->getNumOperands(); i > 0; i--) {
+              /* The callee of a call is not an operand of the node */
+              llvm::Value* operand = instruction->getOperand(i - 1);
+              if (!llvm::isa<llvm::Function>(operand))
+                worklist.push_back({operand, false});
+            }
+          }
+        }
+      }
+      catch (...) {
+        this->values.clear();
+        throw;
+      }
+
+      SharedAbstractNode node = this->values.at(root);
+      this->values.clear();
+
+      return node;
+    }
+
+
+    const SharedAbstractNode& LLVMToTriton::operand(llvm::Instruction* instruction, triton::uint32 index) const {
+      return this->values.at(instruction->getOperand(index));
     }
 
   }; /* ast namespace */
@@ -8,6 +8,7 @@
 #include <algorithm>
 #include <list>
 #include <map>
+#include <set>
 #include <vector>
 
 #include <triton/astEnums.hpp>
@@ -33,6 +34,7 @@ namespace triton {
 
     void TritonToLLVM::createFunction(const triton::ast::SharedAbstractNode& node, const char* fname) {
       // Collect used symbolic variables.
+      this->llvmVars.clear();
       auto vars = triton::ast::search(node, triton::ast::VARIABLE_NODE);
 
       //! Sort symbolic variables
@@ -81,7 +83,59 @@ namespace triton {
     }
 
 
-    std::shared_ptr<llvm::Module> TritonToLLVM::convert(const triton::ast::SharedAbstractNode& node, const char* fname, bool optimize) {
+    void TritonToLLVM::createFunction(const std::vector<std::pair<std::string, triton::ast::SharedAbstractNode>>& outputs, const char* fname, std::vector<llvm::Value*>& pointers) {
+      std::vector<triton::ast::SharedAbstractNode> vars;
+      std::vector<llvm::Type*> argsType;
+
+      this->llvmVars.clear();
+      pointers.clear();
+
+      // Collect the symbolic variables used by all the outputs, sorted by id
+      std::set<triton::ast::SharedAbstractNode> known;
+      for (const auto& output : outputs) {
+        for (const auto& var : triton::ast::search(output.second, triton::ast::VARIABLE_NODE)) {
+          if (known.insert(var).second)
+            vars.push_back(var);
+        }
+      }
+
+      std::sort(vars.begin(), vars.end(), [](const triton::ast::SharedAbstractNode& a, const triton::ast::SharedAbstractNode& b) {
+        return reinterpret_cast<triton::ast::VariableNode*>(a.get())->getSymbolicVariable()->getId() < reinterpret_cast<triton::ast::VariableNode*>(b.get())->getSymbolicVariable()->getId();
+      });
+
+      // Each symbolic variable is an input argument (of any size, such as flags), each output a pointer argument
+      for (const auto& var : vars)
+        argsType.push_back(llvm::IntegerType::get(this->llvmContext, var->getBitvectorSize()));
+
+      for (const auto& output : outputs)
+        argsType.push_back(llvm::PointerType::getUnqual(llvm::IntegerType::get(this->llvmContext, output.second->getBitvectorSize())));
+
+      /* Declare LLVM function */
+      auto* funcType = llvm::FunctionType::get(llvm::Type::getVoidTy(this->llvmContext), argsType, false /* isVarArg */);
+      auto* llvmFunc = llvm::Function::Create(funcType, llvm::Function::ExternalLinkage, fname, this->llvmModule.get());
+
+      /* Rename parameters, the inputs by the alias of their variable if any */
+      llvm::Function::arg_iterator params = llvmFunc->arg_begin();
+      for (const auto& node : vars) {
+        auto var = reinterpret_cast<triton::ast::VariableNode*>(node.get())->getSymbolicVariable();
+        auto* param = params++;
+        param->setName(var->getAlias().empty() ? var->getName() : var->getAlias());
+        this->llvmVars[node] = param;
+      }
+
+      for (const auto& output : outputs) {
+        auto* param = params++;
+        param->setName(output.first);
+        pointers.push_back(param);
+      }
+
+      // The outputs are computed in one basic block
+      auto* llvmBasicBlock = llvm::BasicBlock::Create(this->llvmContext, "entry", llvmFunc);
+      this->llvmIR.SetInsertPoint(llvmBasicBlock);
+    }
+
+
+    void TritonToLLVM::lift(const triton::ast::SharedAbstractNode& node, const char* fname) {
       std::unordered_map<triton::ast::SharedAbstractNode, llvm::Value*> results;
 
       /* Create the LLVM function */
@@ -97,15 +151,75 @@ namespace triton {
 
       /* Create the return instruction */
       this->llvmIR.CreateRet(results.at(node));
+    }
+
+
+    void TritonToLLVM::optimize(void) {
+      llvm::legacy::PassManager pm;
+      llvm::PassManagerBuilder pmb;
+      pmb.OptLevel = 3;
+      pmb.SizeLevel = 2;
+      pmb.populateModulePassManager(pm);
+      pm.run(*this->llvmModule);
+    }
+
+
+    std::shared_ptr<llvm::Module> TritonToLLVM::convert(const triton::ast::SharedAbstractNode& node, const char* fname, bool optimize) {
+      this->lift(node, fname);
 
       /* Apply LLVM optimizations (-03 -Oz) if enabled */
       if (optimize) {
-        llvm::legacy::PassManager pm;
-        llvm::PassManagerBuilder pmb;
-        pmb.OptLevel = 3;
-        pmb.SizeLevel = 2;
-        pmb.populateModulePassManager(pm);
-        pm.run(*this->llvmModule);
+        this->optimize();
+      }
+
+      return this->llvmModule;
+    }
+
+
+    std::shared_ptr<llvm::Module> TritonToLLVM::convert(const std::vector<triton::ast::SharedAbstractNode>& nodes, const std::vector<std::string>& fnames, bool optimize) {
+      if (nodes.size() != fnames.size())
+        throw triton::exceptions::AstLifting("TritonToLLVM::convert(): Expects a name for each node.");
+
+      /* The functions share the context and the module */
+      for (triton::usize index = 0; index < nodes.size(); index++) {
+        if (this->llvmModule->getFunction(fnames[index]) != nullptr)
+          throw triton::exceptions::AstLifting("TritonToLLVM::convert(): The names of the functions must be unique.");
+        this->lift(nodes[index], fnames[index].c_str());
+      }
+
+      /* Apply LLVM optimizations (-03 -Oz) once on the whole module if enabled */
+      if (optimize) {
+        this->optimize();
+      }
+
+      return this->llvmModule;
+    }
+
+
+    std::shared_ptr<llvm::Module> TritonToLLVM::convert(const std::vector<std::pair<std::string, triton::ast::SharedAbstractNode>>& outputs, const char* fname, bool optimize) {
+      std::unordered_map<triton::ast::SharedAbstractNode, llvm::Value*> results;
+      std::vector<llvm::Value*> pointers;
+
+      /* Create the LLVM function */
+      this->createFunction(outputs, fname, pointers);
+
+      /* Lift Triton ASTs to LLVM IR, the nodes shared by several outputs are lifted once */
+      for (triton::usize index = 0; index < outputs.size(); index++) {
+        auto nodes = triton::ast::childrenExtraction(outputs[index].second, true /* unroll*/, true /* revert */);
+        for (const auto& node : nodes) {
+          if (node->getBitvectorSize() && results.find(node) == results.end()) {
+            results.insert(std::make_pair(node, this->do_convert(node, &results)));
+          }
+        }
+        this->llvmIR.CreateStore(results.at(outputs[index].second), pointers[index]);
+      }
+
+      /* Create the return instruction */
+      this->llvmIR.CreateRetVoid();
+
+      /* Apply LLVM optimizations (-03 -Oz) if enabled */
+      if (optimize) {
+        this->optimize();
       }
 
       return this->llvmModule;
@@ -143,15 +257,53 @@ namespace triton {
           return this->llvmIR.CreateCall(bswap, children[0]);
         }
 
-        case triton::ast::BVADD_NODE:
-          return this->llvmIR.CreateAdd(children[0], children[1]);
+        case triton::ast::BVADD_NODE: {
+          auto* current = this->llvmIR.CreateAdd(children[0], children[1]);
+          for (triton::usize index = 2; index < children.size(); index++)
+            current = this->llvmIR.CreateAdd(current, children[index]);
+          return current;
+        }
 
         case triton::ast::BVAND_NODE:
-          return this->llvmIR.CreateAnd(children[0], children[1]);
+          return this->llvmIR.CreateAnd(children);
 
         case triton::ast::BVASHR_NODE:
           return this->llvmIR.CreateAShr(children[0], children[1]);
 
+        /* Lane-wise nodes are expanded into one operation per lane, the lifting back from LLVM has no vector type */
+        case triton::ast::BVLANEADD_NODE:
+        case triton::ast::BVLANEEQ_NODE:
+        case triton::ast::BVLANESELECT_NODE:
+        case triton::ast::BVLANESGT_NODE:
+        case triton::ast::BVLANESUB_NODE: {
+          auto  lane   = reinterpret_cast<triton::ast::IntegerNode*>(node->getChildren().back().get())->getInteger().convert_to<uint32_t>();
+          auto  size   = node->getBitvectorSize();
+          auto* type   = llvm::Type::getIntNTy(this->llvmContext, lane);
+          llvm::Value* result = llvm::ConstantInt::get(children[0]->getType(), 0);
+
+          for (uint32_t low = 0; low != size; low += lane) {
+            auto* op1 = this->llvmIR.CreateTrunc(this->llvmIR.CreateLShr(children[0], low), type);
+            auto* op2 = this->llvmIR.CreateTrunc(this->llvmIR.CreateLShr(children[1], low), type);
+            llvm::Value* value = nullptr;
+
+            switch (node->getType()) {
+              case triton::ast::BVLANEADD_NODE: value = this->llvmIR.CreateAdd(op1, op2); break;
+              case triton::ast::BVLANEEQ_NODE:  value = this->llvmIR.CreateSExt(this->llvmIR.CreateICmpEQ(op1, op2), type); break;
+              case triton::ast::BVLANESGT_NODE: value = this->llvmIR.CreateSExt(this->llvmIR.CreateICmpSGT(op1, op2), type); break;
+              case triton::ast::BVLANESUB_NODE: value = this->llvmIR.CreateSub(op1, op2); break;
+              default: {
+                auto* op3 = this->llvmIR.CreateTrunc(this->llvmIR.CreateLShr(children[2], low), type);
+                value = this->llvmIR.CreateSelect(this->llvmIR.CreateICmpSLT(op1, llvm::ConstantInt::get(type, 0)), op2, op3);
+                break;
+              }
+            }
+
+            result = this->llvmIR.CreateOr(result, this->llvmIR.CreateShl(this->llvmIR.CreateZExt(value, children[0]->getType()), low));
+          }
+
+          return result;
+        }
+
         case triton::ast::BVLSHR_NODE:
           return this->llvmIR.CreateLShr(children[0], children[1]);
 
@@ -171,7 +323,17 @@ namespace triton {
           return this->llvmIR.CreateNot(children[0]);
 
         case triton::ast::BVOR_NODE:
-          return this->llvmIR.CreateOr(children[0], children[1]);
+          return this->llvmIR.CreateOr(children);
+
+        case triton::ast::BVPARITY_NODE: {
+          llvm::Function* ctpop = llvm::Intrinsic::getDeclaration(this->llvmModule.get(), llvm::Intrinsic::ctpop, children[0]->getType());
+          return this->llvmIR.CreateTrunc(this->llvmIR.CreateCall(ctpop, children[0]), llvm::Type::getInt1Ty(this->llvmContext));
+        }
+
+        case triton::ast::BVPOPCOUNT_NODE: {
+          llvm::Function* ctpop = llvm::Intrinsic::getDeclaration(this->llvmModule.get(), llvm::Intrinsic::ctpop, children[0]->getType());
+          return this->llvmIR.CreateCall(ctpop, children[0]);
+        }
 
         // bvrol(expr, rot) = ((expr << (rot % size)) | (expr >> (size - (rot % size))))
         case triton::ast::BVROL_NODE: {
@@ -238,8 +400,12 @@ namespace triton {
         case triton::ast::BVXNOR_NODE:
           return this->llvmIR.CreateNot(this->llvmIR.CreateXor(children[0], children[1]));
 
-        case triton::ast::BVXOR_NODE:
-          return this->llvmIR.CreateXor(children[0], children[1]);
+        case triton::ast::BVXOR_NODE: {
+          auto* current = this->llvmIR.CreateXor(children[0], children[1]);
+          for (triton::usize index = 2; index < children.size(); index++)
+            current = this->llvmIR.CreateXor(current, children[index]);
+          return current;
+        }
 
         case triton::ast::BV_NODE:
           return llvm::ConstantInt::get(this->llvmContext, llvm::APInt(node->getBitvectorSize(), node->evaluate().convert_to<uint64>(), false));
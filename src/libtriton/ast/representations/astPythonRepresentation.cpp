@@ -23,11 +23,17 @@ namespace triton {
       /* Representation dispatcher from an abstract node */
       std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::AbstractNode* node) {
         switch (node->getType()) {
+          case ARRAY_NODE:                return this->print(stream, reinterpret_cast<triton::ast::ArrayNode*>(node)); break;
           case ASSERT_NODE:               return this->print(stream, reinterpret_cast<triton::ast::AssertNode*>(node)); break;
           case BSWAP_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BswapNode*>(node)); break;
           case BVADD_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvaddNode*>(node)); break;
           case BVAND_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvandNode*>(node)); break;
           case BVASHR_NODE:               return this->print(stream, reinterpret_cast<triton::ast::BvashrNode*>(node)); break;
+          case BVLANEADD_NODE:                 return this->print(stream, reinterpret_cast<triton::ast::BvlaneaddNode*>(node)); break;
+          case BVLANEEQ_NODE:                  return this->print(stream, reinterpret_cast<triton::ast::BvlaneeqNode*>(node)); break;
+          case BVLANESELECT_NODE:              return this->print(stream, reinterpret_cast<triton::ast::BvlaneselectNode*>(node)); break;
+          case BVLANESGT_NODE:                 return this->print(stream, reinterpret_cast<triton::ast::BvlanesgtNode*>(node)); break;
+          case BVLANESUB_NODE:                 return this->print(stream, reinterpret_cast<triton::ast::BvlanesubNode*>(node)); break;
           case BVLSHR_NODE:               return this->print(stream, reinterpret_cast<triton::ast::BvlshrNode*>(node)); break;
           case BVMUL_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvmulNode*>(node)); break;
           case BVNAND_NODE:               return this->print(stream, reinterpret_cast<triton::ast::BvnandNode*>(node)); break;
@@ -35,6 +41,8 @@ namespace triton {
           case BVNOR_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvnorNode*>(node)); break;
           case BVNOT_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvnotNode*>(node)); break;
           case BVOR_NODE:                 return this->print(stream, reinterpret_cast<triton::ast::BvorNode*>(node)); break;
+          case BVPARITY_NODE:             return this->print(stream, reinterpret_cast<triton::ast::BvparityNode*>(node)); break;
+          case BVPOPCOUNT_NODE:           return this->print(stream, reinterpret_cast<triton::ast::BvpopcountNode*>(node)); break;
           case BVROL_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvrolNode*>(node)); break;
           case BVROR_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvrorNode*>(node)); break;
           case BVSDIV_NODE:               return this->print(stream, reinterpret_cast<triton::ast::BvsdivNode*>(node)); break;
@@ -71,6 +79,8 @@ namespace triton {
           case LOR_NODE:                  return this->print(stream, reinterpret_cast<triton::ast::LorNode*>(node)); break;
           case LXOR_NODE:                 return this->print(stream, reinterpret_cast<triton::ast::LxorNode*>(node)); break;
           case REFERENCE_NODE:            return this->print(stream, reinterpret_cast<triton::ast::ReferenceNode*>(node)); break;
+          case SELECT_NODE:               return this->print(stream, reinterpret_cast<triton::ast::SelectNode*>(node)); break;
+          case STORE_NODE:                return this->print(stream, reinterpret_cast<triton::ast::StoreNode*>(node)); break;
           case STRING_NODE:               return this->print(stream, reinterpret_cast<triton::ast::StringNode*>(node)); break;
           case SX_NODE:                   return this->print(stream, reinterpret_cast<triton::ast::SxNode*>(node)); break;
           case VARIABLE_NODE:             return this->print(stream, reinterpret_cast<triton::ast::VariableNode*>(node)); break;
@@ -82,6 +92,13 @@ namespace triton {
       }
 
 
+      /* array representation */
+      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::ArrayNode* node) {
+        stream << "memory_" << node->getIndexSize();
+        return stream;
+      }
+
+
       /* assert representation */
       std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::AssertNode* node) {
         stream << "assert(" << node->getChildren()[0] << ")";
@@ -98,14 +115,26 @@ namespace triton {
 
       /* bvadd representation */
       std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvaddNode* node) {
-        stream << "((" << node->getChildren()[0] << " + " << node->getChildren()[1] << ") & 0x" << std::hex << node->getBitvectorMask() << std::dec << ")";
+        triton::usize size = node->getChildren().size();
+
+        stream << "((" << node->getChildren()[0];
+        for (triton::usize index = 1; index < size; index++)
+          stream << " + " << node->getChildren()[index];
+        stream << ") & 0x" << std::hex << node->getBitvectorMask() << std::dec << ")";
+
         return stream;
       }
 
 
       /* bvand representation */
       std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvandNode* node) {
-        stream << "(" << node->getChildren()[0] << " & " << node->getChildren()[1] << ")";
+        triton::usize size = node->getChildren().size();
+
+        stream << "(" << node->getChildren()[0];
+        for (triton::usize index = 1; index < size; index++)
+          stream << " & " << node->getChildren()[index];
+        stream << ")";
+
         return stream;
       }
 
@@ -117,6 +146,54 @@ namespace triton {
       }
 
 
+      /* Returns the width of the lanes of a lane-wise node */
+      static triton::uint32 laneWidth(triton::ast::AbstractNode* node) {
+        return reinterpret_cast<triton::ast::IntegerNode*>(node->getChildren().back().get())->getInteger().convert_to<triton::uint32>();
+      }
+
+
+      /* Lane-wise nodes are displayed as calls to the lane-wise functions of the Python lifting, `name` is the one of the node */
+      static std::ostream& printLanes(std::ostream& stream, triton::ast::AbstractNode* node, const char* name) {
+        const auto& children = node->getChildren();
+
+        stream << name << "(";
+        for (triton::usize i = 0; i + 1 < children.size(); i++)
+          stream << children[i] << ", ";
+        stream << node->getBitvectorSize() << ", " << laneWidth(node) << ")";
+        return stream;
+      }
+
+
+      /* bvlaneadd representation */
+      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvlaneaddNode* node) {
+        return printLanes(stream, node, "laneadd");
+      }
+
+
+      /* bvlaneeq representation */
+      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvlaneeqNode* node) {
+        return printLanes(stream, node, "laneeq");
+      }
+
+
+      /* bvlaneselect representation */
+      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvlaneselectNode* node) {
+        return printLanes(stream, node, "laneselect");
+      }
+
+
+      /* bvlanesgt representation */
+      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvlanesgtNode* node) {
+        return printLanes(stream, node, "lanesgt");
+      }
+
+
+      /* bvlanesub representation */
+      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvlanesubNode* node) {
+        return printLanes(stream, node, "lanesub");
+      }
+
+
       /* bvlshr representation */
       std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvlshrNode* node) {
         stream << "(" << node->getChildren()[0] << " >> " << node->getChildren()[1] << ")";
@@ -161,7 +238,27 @@ namespace triton {
 
       /* bvor representation */
       std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvorNode* node) {
-        stream << "(" << node->getChildren()[0] << " | " << node->getChildren()[1] << ")";
+        triton::usize size = node->getChildren().size();
+
+        stream << "(" << node->getChildren()[0];
+        for (triton::usize index = 1; index < size; index++)
+          stream << " | " << node->getChildren()[index];
+        stream << ")";
+
+        return stream;
+      }
+
+
+      /* bvparity representation */
+      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvparityNode* node) {
+        stream << "(bin(" << node->getChildren()[0] << ").count('1') & 0x1)";
+        return stream;
+      }
+
+
+      /* bvpopcount representation */
+      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvpopcountNode* node) {
+        stream << "bin(" << node->getChildren()[0] << ").count('1')";
         return stream;
       }
 
@@ -294,7 +391,13 @@ namespace triton {
 
       /* bvxor representation */
       std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvxorNode* node) {
-        stream << "(" << node->getChildren()[0] << " ^ " << node->getChildren()[1] << ")";
+        triton::usize size = node->getChildren().size();
+
+        stream << "(" << node->getChildren()[0];
+        for (triton::usize index = 1; index < size; index++)
+          stream << " ^ " << node->getChildren()[index];
+        stream << ")";
+
         return stream;
       }
 
@@ -468,6 +571,20 @@ namespace triton {
       }
 
 
+      /* select representation */
+      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::SelectNode* node) {
+        stream << node->getChildren()[0] << "[" << node->getChildren()[1] << "]";
+        return stream;
+      }
+
+
+      /* store representation */
+      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::StoreNode* node) {
+        stream << "store(" << node->getChildren()[0] << ", " << node->getChildren()[1] << ", " << node->getChildren()[2] << ")";
+        return stream;
+      }
+
+
       /* string representation */
       std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::StringNode* node) {
         stream << node->getString();
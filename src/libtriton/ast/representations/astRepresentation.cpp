@@ -5,9 +5,12 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <algorithm>
 #include <new>
 #include <memory>
+#include <utility>
 
+#include <triton/astContext.hpp>
 #include <triton/astRepresentation.hpp>
 #include <triton/exceptions.hpp>
 
@@ -20,6 +23,7 @@ namespace triton {
       AstRepresentation::AstRepresentation() {
         /* Set the default representation */
         this->mode = triton::ast::representations::SMT_REPRESENTATION;
+        this->nextBinding = 0;
 
         /* Init representations interface */
         this->representations[triton::ast::representations::SMT_REPRESENTATION] = std::unique_ptr<triton::ast::representations::AstSmtRepresentation>(new(std::nothrow) triton::ast::representations::AstSmtRepresentation());
@@ -57,8 +61,253 @@ namespace triton {
       }
 
 
+      /*
+       * The representation printing on the calling thread. Operands are printed
+       * through it, so that they follow its mode and bindings even if they belong
+       * to another context (frozen nodes).
+       */
+      static thread_local AstRepresentation* activeRepresentation = nullptr;
+
+
       std::ostream& AstRepresentation::print(std::ostream& stream, AbstractNode* node) {
-        return this->representations[this->mode]->print(stream, node);
+        if (!this->bindings.empty()) {
+          auto it = this->bindings.find(node);
+          if (it != this->bindings.end())
+            return this->printName(stream, it->second);
+        }
+
+        AstRepresentation* previous = activeRepresentation;
+        activeRepresentation = this;
+        try {
+          this->representations[this->mode]->print(stream, node);
+        }
+        catch (...) {
+          activeRepresentation = previous;
+          throw;
+        }
+        activeRepresentation = previous;
+
+        return stream;
+      }
+
+
+      std::ostream& AstRepresentation::printOperand(std::ostream& stream, AbstractNode* node) {
+        if (activeRepresentation != nullptr)
+          return activeRepresentation->print(stream, node);
+        return node->getContext()->print(stream, node);
+      }
+
+
+      /* Returns true if the operands of the node are printed as they are (they may use names bound by the node) */
+      static bool isOpaque(const AbstractNode* node) {
+        switch (node->getType()) {
+          case FORALL_NODE:
+          case LET_NODE:
+          case REFERENCE_NODE:
+            return true;
+          default:
+            return false;
+        }
+      }
+
+
+      /* Returns true if the node is a term whose printing is longer than a name */
+      static bool isBindable(const AbstractNode* node) {
+        switch (node->getType()) {
+          case ARRAY_NODE:
+          case ASSERT_NODE:
+          case BV_NODE:
+          case COMPOUND_NODE:
+          case DECLARE_NODE:
+          case INTEGER_NODE:
+          case REFERENCE_NODE:
+          case STRING_NODE:
+          case VARIABLE_NODE:
+            return false;
+          default:
+            return true;
+        }
+      }
+
+
+      /*
+       * The nesting of the operands printed in place above which a Python node is bound even if it is used
+       * once. CPython is slow to compile deep expressions and rejects them beyond 200 nested parentheses.
+       */
+      static const triton::usize pythonNesting = 32;
+
+
+      std::vector<std::vector<AbstractNode*>> AstRepresentation::bind(const std::vector<AbstractNode*>& roots) {
+        std::unordered_map<AbstractNode*, triton::uint32> uses;
+        std::unordered_map<AbstractNode*, triton::usize> levels;
+        std::unordered_map<AbstractNode*, triton::usize> nesting;
+        std::vector<std::pair<AbstractNode*, bool>> worklist;
+        std::vector<AbstractNode*> order;
+
+        /* Count how many times each node is printed and sort nodes, operands first */
+        for (AbstractNode* root : roots) {
+          uses[root]++;
+          worklist.push_back({root, false});
+          while (!worklist.empty()) {
+            AbstractNode* node = worklist.back().first;
+            bool post = worklist.back().second;
+            worklist.pop_back();
+
+            if (post) {
+              order.push_back(node);
+              continue;
+            }
+
+            if (levels.find(node) != levels.end())
+              continue;
+
+            levels[node] = 0;
+            worklist.push_back({node, true});
+
+            if (isOpaque(node) || this->bindings.find(node) != this->bindings.end())
+              continue;
+
+            for (const auto& child : node->getChildren()) {
+              uses[child.get()]++;
+              if (levels.find(child.get()) == levels.end())
+                worklist.push_back({child.get(), false});
+            }
+          }
+        }
+
+        /*
+         * The level of a bound node is one more than the highest level of
+         * the bound nodes its printing uses, so that a level only uses names
+         * of lower levels.
+         */
+        std::vector<std::vector<AbstractNode*>> groups;
+        for (AbstractNode* node : order) {
+          if (isOpaque(node) || this->bindings.find(node) != this->bindings.end())
+            continue;
+
+          /* Bound and opaque operands are printed as names, their nesting is 0 */
+          triton::usize level = 0;
+          triton::usize depth = 0;
+          for (const auto& child : node->getChildren()) {
+            level = std::max(level, levels[child.get()]);
+            depth = std::max(depth, nesting[child.get()]);
+          }
+          depth++;
+
+          bool deep = (this->mode == triton::ast::representations::PYTHON_REPRESENTATION && depth > pythonNesting);
+          if ((uses[node] > 1 || deep) && isBindable(node)) {
+            if (groups.size() <= level)
+              groups.resize(level + 1);
+            groups[level].push_back(node);
+            level++;
+            depth = 0;
+          }
+          levels[node] = level;
+          nesting[node] = depth;
+        }
+
+        for (const auto& group : groups) {
+          for (AbstractNode* node : group) {
+            this->bindings[node] = this->nextBinding++;
+          }
+        }
+
+        return groups;
+      }
+
+
+      std::ostream& AstRepresentation::printName(std::ostream& stream, triton::usize name) const {
+        if (this->mode == triton::ast::representations::PYTHON_REPRESENTATION)
+          stream << "node_" << name;
+        else
+          stream << "node!" << name;
+        return stream;
+      }
+
+
+      std::ostream& AstRepresentation::printShared(std::ostream& stream, AbstractNode* node) {
+        auto groups = this->bind({node});
+
+        try {
+          /* (let ((node!0 <expr>) (node!1 <expr>)) (let ((node!2 <expr>)) <node>)) */
+          if (this->mode == triton::ast::representations::SMT_REPRESENTATION) {
+            for (const auto& group : groups) {
+              stream << "(let (";
+              for (triton::usize index = 0; index < group.size(); index++) {
+                stream << (index ? " (" : "(");
+                this->printName(stream, this->bindings[group[index]]) << " ";
+                this->representations[this->mode]->print(stream, group[index]) << ")";
+              }
+              stream << ") ";
+            }
+            this->print(stream, node);
+            for (triton::usize index = 0; index < groups.size(); index++) {
+              stream << ")";
+            }
+          }
+
+          /* (node_0 := <expr>, node_1 := <expr>, <node>)[-1] */
+          else if (!groups.empty()) {
+            stream << "(";
+            for (const auto& group : groups) {
+              for (AbstractNode* n : group) {
+                this->printName(stream, this->bindings[n]) << " := ";
+                this->representations[this->mode]->print(stream, n) << ", ";
+              }
+            }
+            this->print(stream, node) << ")[-1]";
+          }
+
+          else {
+            this->print(stream, node);
+          }
+        }
+        catch (...) {
+          this->clearBindings(groups);
+          throw;
+        }
+
+        this->clearBindings(groups);
+        return stream;
+      }
+
+
+      std::ostream& AstRepresentation::printBindings(std::ostream& stream, const std::vector<AbstractNode*>& roots) {
+        for (const auto& group : this->bind(roots)) {
+          for (AbstractNode* node : group) {
+            if (this->mode == triton::ast::representations::SMT_REPRESENTATION) {
+              stream << "(define-fun ";
+              this->printName(stream, this->bindings[node]);
+              if (node->isLogical())
+                stream << " () Bool ";
+              else
+                stream << " () (_ BitVec " << std::dec << node->getBitvectorSize() << ") ";
+              this->representations[this->mode]->print(stream, node) << ")" << std::endl;
+            }
+            else {
+              this->printName(stream, this->bindings[node]) << " = ";
+              this->representations[this->mode]->print(stream, node) << std::endl;
+            }
+          }
+        }
+        return stream;
+      }
+
+
+      void AstRepresentation::clearBindings(void) {
+        this->bindings.clear();
+        this->nextBinding = 0;
+      }
+
+
+      void AstRepresentation::clearBindings(const std::vector<std::vector<AbstractNode*>>& groups) {
+        for (const auto& group : groups) {
+          for (AbstractNode* node : group) {
+            this->bindings.erase(node);
+          }
+        }
+        if (this->bindings.empty())
+          this->nextBinding = 0;
       }
 
     };
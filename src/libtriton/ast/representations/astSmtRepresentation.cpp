@@ -23,11 +23,17 @@ namespace triton {
       /* Representation dispatcher from an abstract node */
       std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::AbstractNode* node) {
         switch (node->getType()) {
+          case ARRAY_NODE:                return this->print(stream, reinterpret_cast<triton::ast::ArrayNode*>(node)); break;
           case ASSERT_NODE:               return this->print(stream, reinterpret_cast<triton::ast::AssertNode*>(node)); break;
           case BSWAP_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BswapNode*>(node)); break;
           case BVADD_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvaddNode*>(node)); break;
           case BVAND_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvandNode*>(node)); break;
           case BVASHR_NODE:               return this->print(stream, reinterpret_cast<triton::ast::BvashrNode*>(node)); break;
+          case BVLANEADD_NODE:                 return this->print(stream, reinterpret_cast<triton::ast::BvlaneaddNode*>(node)); break;
+          case BVLANEEQ_NODE:                  return this->print(stream, reinterpret_cast<triton::ast::BvlaneeqNode*>(node)); break;
+          case BVLANESELECT_NODE:              return this->print(stream, reinterpret_cast<triton::ast::BvlaneselectNode*>(node)); break;
+          case BVLANESGT_NODE:                 return this->print(stream, reinterpret_cast<triton::ast::BvlanesgtNode*>(node)); break;
+          case BVLANESUB_NODE:                 return this->print(stream, reinterpret_cast<triton::ast::BvlanesubNode*>(node)); break;
           case BVLSHR_NODE:               return this->print(stream, reinterpret_cast<triton::ast::BvlshrNode*>(node)); break;
           case BVMUL_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvmulNode*>(node)); break;
           case BVNAND_NODE:               return this->print(stream, reinterpret_cast<triton::ast::BvnandNode*>(node)); break;
@@ -35,6 +41,8 @@ namespace triton {
           case BVNOR_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvnorNode*>(node)); break;
           case BVNOT_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvnotNode*>(node)); break;
           case BVOR_NODE:                 return this->print(stream, reinterpret_cast<triton::ast::BvorNode*>(node)); break;
+          case BVPARITY_NODE:             return this->print(stream, reinterpret_cast<triton::ast::BvparityNode*>(node)); break;
+          case BVPOPCOUNT_NODE:           return this->print(stream, reinterpret_cast<triton::ast::BvpopcountNode*>(node)); break;
           case BVROL_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvrolNode*>(node)); break;
           case BVROR_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvrorNode*>(node)); break;
           case BVSDIV_NODE:               return this->print(stream, reinterpret_cast<triton::ast::BvsdivNode*>(node)); break;
@@ -71,6 +79,8 @@ namespace triton {
           case LOR_NODE:                  return this->print(stream, reinterpret_cast<triton::ast::LorNode*>(node)); break;
           case LXOR_NODE:                 return this->print(stream, reinterpret_cast<triton::ast::LxorNode*>(node)); break;
           case REFERENCE_NODE:            return this->print(stream, reinterpret_cast<triton::ast::ReferenceNode*>(node)); break;
+          case SELECT_NODE:               return this->print(stream, reinterpret_cast<triton::ast::SelectNode*>(node)); break;
+          case STORE_NODE:                return this->print(stream, reinterpret_cast<triton::ast::StoreNode*>(node)); break;
           case STRING_NODE:               return this->print(stream, reinterpret_cast<triton::ast::StringNode*>(node)); break;
           case SX_NODE:                   return this->print(stream, reinterpret_cast<triton::ast::SxNode*>(node)); break;
           case VARIABLE_NODE:             return this->print(stream, reinterpret_cast<triton::ast::VariableNode*>(node)); break;
@@ -82,6 +92,13 @@ namespace triton {
       }
 
 
+      /* array representation */
+      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::ArrayNode* node) {
+        stream << "memory_" << node->getIndexSize();
+        return stream;
+      }
+
+
       /* assert representation */
       std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::AssertNode* node) {
         stream << "(assert " << node->getChildren()[0] << ")";
@@ -98,14 +115,22 @@ namespace triton {
 
       /* bvadd representation */
       std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvaddNode* node) {
-        stream << "(bvadd " << node->getChildren()[0] << " " << node->getChildren()[1] << ")";
+        stream << "(bvadd";
+        for (const auto& child : node->getChildren())
+          stream << " " << child;
+        stream << ")";
+
         return stream;
       }
 
 
       /* bvand representation */
       std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvandNode* node) {
-        stream << "(bvand " << node->getChildren()[0] << " " << node->getChildren()[1] << ")";
+        stream << "(bvand";
+        for (const auto& child : node->getChildren())
+          stream << " " << child;
+        stream << ")";
+
         return stream;
       }
 
@@ -117,6 +142,81 @@ namespace triton {
       }
 
 
+      /* Returns the width of the lanes of a lane-wise node */
+      static triton::uint32 laneWidth(triton::ast::AbstractNode* node) {
+        return reinterpret_cast<triton::ast::IntegerNode*>(node->getChildren().back().get())->getInteger().convert_to<triton::uint32>();
+      }
+
+
+      /* Lane-wise nodes are displayed as the concatenation of one operation per lane, `op` displays the one of the lane [high:low] */
+      template <typename F>
+      static std::ostream& printLanes(std::ostream& stream, triton::ast::AbstractNode* node, F op) {
+        const auto& children = node->getChildren();
+        triton::uint32 size  = node->getBitvectorSize();
+        triton::uint32 lane  = laneWidth(node);
+
+        stream << "(let ((value1 " << children[0] << ") (value2 " << children[1] << ")";
+        if (children.size() > 3)
+          stream << " (value3 " << children[2] << ")";
+        stream << ") ";
+
+        if (lane != size)
+          stream << "(concat";
+        for (triton::uint32 index = size / lane; index != 0; index--) {
+          triton::uint32 low = (index - 1) * lane;
+          stream << ((lane != size) ? " " : "");
+          op(low + lane - 1, low);
+        }
+        if (lane != size)
+          stream << ")";
+        stream << ")";
+
+        return stream;
+      }
+
+
+      /* bvlaneadd representation */
+      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvlaneaddNode* node) {
+        return printLanes(stream, node, [&](triton::uint32 high, triton::uint32 low) {
+          stream << "(bvadd ((_ extract " << high << " " << low << ") value1) ((_ extract " << high << " " << low << ") value2))";
+        });
+      }
+
+
+      /* bvlaneeq representation */
+      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvlaneeqNode* node) {
+        triton::uint32 lane = laneWidth(node);
+        return printLanes(stream, node, [&](triton::uint32 high, triton::uint32 low) {
+          stream << "(ite (= ((_ extract " << high << " " << low << ") value1) ((_ extract " << high << " " << low << ") value2)) (bvnot (_ bv0 " << lane << ")) (_ bv0 " << lane << "))";
+        });
+      }
+
+
+      /* bvlaneselect representation */
+      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvlaneselectNode* node) {
+        return printLanes(stream, node, [&](triton::uint32 high, triton::uint32 low) {
+          stream << "(ite (= ((_ extract " << high << " " << high << ") value1) (_ bv1 1)) ((_ extract " << high << " " << low << ") value2) ((_ extract " << high << " " << low << ") value3))";
+        });
+      }
+
+
+      /* bvlanesgt representation */
+      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvlanesgtNode* node) {
+        triton::uint32 lane = laneWidth(node);
+        return printLanes(stream, node, [&](triton::uint32 high, triton::uint32 low) {
+          stream << "(ite (bvsgt ((_ extract " << high << " " << low << ") value1) ((_ extract " << high << " " << low << ") value2)) (bvnot (_ bv0 " << lane << ")) (_ bv0 " << lane << "))";
+        });
+      }
+
+
+      /* bvlanesub representation */
+      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvlanesubNode* node) {
+        return printLanes(stream, node, [&](triton::uint32 high, triton::uint32 low) {
+          stream << "(bvsub ((_ extract " << high << " " << low << ") value1) ((_ extract " << high << " " << low << ") value2))";
+        });
+      }
+
+
       /* bvlshr representation */
       std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvlshrNode* node) {
         stream << "(bvlshr " << node->getChildren()[0] << " " << node->getChildren()[1] << ")";
@@ -161,7 +261,46 @@ namespace triton {
 
       /* bvor representation */
       std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvorNode* node) {
-        stream << "(bvor " << node->getChildren()[0] << " " << node->getChildren()[1] << ")";
+        stream << "(bvor";
+        for (const auto& child : node->getChildren())
+          stream << " " << child;
+        stream << ")";
+
+        return stream;
+      }
+
+
+      /* bvparity representation */
+      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvparityNode* node) {
+        triton::uint32 size = node->getChildren()[0]->getBitvectorSize();
+
+        stream << "(let ((value " << node->getChildren()[0] << ")) ";
+        if (size > 1)
+          stream << "(bvxor";
+        for (triton::uint32 index = 0; index < size; index++)
+          stream << ((size > 1) ? " " : "") << "((_ extract " << index << " " << index << ") value)";
+        if (size > 1)
+          stream << ")";
+        stream << ")";
+
+        return stream;
+      }
+
+
+      /* bvpopcount representation */
+      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvpopcountNode* node) {
+        triton::uint32 size = node->getBitvectorSize();
+
+        if (size == 1) {
+          stream << node->getChildren()[0];
+          return stream;
+        }
+
+        stream << "(let ((value " << node->getChildren()[0] << ")) (bvadd";
+        for (triton::uint32 index = 0; index < size; index++)
+          stream << " ((_ zero_extend " << (size - 1) << ") ((_ extract " << index << " " << index << ") value))";
+        stream << "))";
+
         return stream;
       }
 
@@ -294,7 +433,11 @@ namespace triton {
 
       /* bvxor representation */
       std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvxorNode* node) {
-        stream << "(bvxor " << node->getChildren()[0] << " " << node->getChildren()[1] << ")";
+        stream << "(bvxor";
+        for (const auto& child : node->getChildren())
+          stream << " " << child;
+        stream << ")";
+
         return stream;
       }
 
@@ -466,6 +609,20 @@ namespace triton {
       }
 
 
+      /* select representation */
+      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::SelectNode* node) {
+        stream << "(select " << node->getChildren()[0] << " " << node->getChildren()[1] << ")";
+        return stream;
+      }
+
+
+      /* store representation */
+      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::StoreNode* node) {
+        stream << "(store " << node->getChildren()[0] << " " << node->getChildren()[1] << " " << node->getChildren()[2] << ")";
+        return stream;
+      }
+
+
       /* string representation */
       std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::StringNode* node) {
         stream << node->getString();
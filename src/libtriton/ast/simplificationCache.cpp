@@ -0,0 +1,91 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <triton/exceptions.hpp>
+#include <triton/simplificationCache.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    SimplificationCache::SimplificationCache(triton::usize capacity) {
+      this->capacity = capacity;
+    }
+
+
+    void SimplificationCache::evict(void) {
+      while (this->entries.size() > this->capacity) {
+        this->entries.erase(this->recent.back());
+        this->recent.pop_back();
+      }
+    }
+
+
+    SharedAbstractNode SimplificationCache::simplify(triton::ast::simplifier_e simplifier, const SharedAbstractNode& node, const std::function<SharedAbstractNode(const SharedAbstractNode&)>& simplify) {
+      if (node == nullptr)
+        throw triton::exceptions::Ast("SimplificationCache::simplify(): node cannot be null.");
+
+      /* The tree is already a result of the simplifier */
+      if (node->isSimplified(simplifier))
+        return node;
+
+      Key key(static_cast<triton::uint8>(simplifier), node->getHash());
+
+      auto it = this->entries.find(key);
+      if (it != this->entries.end()) {
+        if (it->second.output->getHash() == it->second.hash) {
+          this->recent.splice(this->recent.begin(), this->recent, it->second.position);
+          return it->second.output;
+        }
+        /* The result has been updated since */
+        this->recent.erase(it->second.position);
+        this->entries.erase(it);
+      }
+
+      SharedAbstractNode output = simplify(node);
+      output->setSimplified(simplifier);
+
+      if (this->capacity) {
+        this->recent.push_front(key);
+        this->entries[key] = {output, output->getHash(), this->recent.begin()};
+        this->evict();
+      }
+
+      return output;
+    }
+
+
+    void SimplificationCache::clear(void) {
+      this->entries.clear();
+      this->recent.clear();
+    }
+
+
+    triton::usize SimplificationCache::size(void) const {
+      return this->entries.size();
+    }
+
+
+    triton::usize SimplificationCache::getBytes(void) const {
+      /* A node of a map holds its value, three links and a color. A node of a list holds its value and two links. */
+      return this->entries.size() * (sizeof(std::map<Key, Entry>::value_type) + 4 * sizeof(void*) + sizeof(Key) + 2 * sizeof(void*));
+    }
+
+
+    triton::usize SimplificationCache::getCapacity(void) const {
+      return this->capacity;
+    }
+
+
+    void SimplificationCache::setCapacity(triton::usize capacity) {
+      this->capacity = capacity;
+      this->evict();
+    }
+
+  }; /* ast namespace */
+}; /* triton namespace */
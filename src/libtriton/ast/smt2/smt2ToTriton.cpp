@@ -0,0 +1,947 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <cctype>
+#include <streambuf>
+
+#include <triton/astContext.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/smt2ToTriton.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    namespace {
+
+      /* A read-only stream buffer over a string, without copy */
+      class StringBuffer : public std::streambuf {
+        public:
+          StringBuffer(const std::string& data) {
+            char* begin = const_cast<char*>(data.data());
+            this->setg(begin, begin, begin + data.size());
+          }
+      };
+
+
+      /* The kinds of the terms being parsed */
+      enum frame_e {
+        FRAME_APPLY,        /* An application, its operands being parsed */
+        FRAME_LET_BINDING,  /* A let, its bindings being parsed */
+        FRAME_LET_BODY,     /* A let, its body being parsed */
+        FRAME_ANNOTATION,   /* An annotated term, the term being parsed */
+      };
+
+
+      /* A term being parsed */
+      struct Frame {
+        frame_e kind;
+        std::string op;
+        std::vector<triton::uint32> indexes;
+        std::vector<SharedAbstractNode> args;
+        std::vector<std::pair<std::string, SharedAbstractNode>> bindings;
+
+        Frame(frame_e kind) : kind(kind) {}
+      };
+
+
+      /* The operators */
+      enum operator_e {
+        OP_AND, OP_ARRAY_SELECT, OP_ARRAY_STORE, OP_BVADD, OP_BVAND, OP_BVASHR, OP_BVCOMP, OP_BVLSHR, OP_BVMUL,
+        OP_BVNAND, OP_BVNEG, OP_BVNOR, OP_BVNOT, OP_BVOR, OP_BVSDIV, OP_BVSGE, OP_BVSGT, OP_BVSHL, OP_BVSLE,
+        OP_BVSLT, OP_BVSMOD, OP_BVSREM, OP_BVSUB, OP_BVUDIV, OP_BVUGE, OP_BVUGT, OP_BVULE, OP_BVULT, OP_BVUREM,
+        OP_BVXNOR, OP_BVXOR, OP_CONCAT, OP_DISTINCT, OP_EQUAL, OP_EXTRACT, OP_IMPLIES, OP_ITE, OP_NOT, OP_OR,
+        OP_REPEAT, OP_ROTATE_LEFT, OP_ROTATE_RIGHT, OP_SIGN_EXTEND, OP_XOR, OP_ZERO_EXTEND,
+      };
+
+
+      const std::unordered_map<std::string, operator_e> operators = {
+        {"and",          OP_AND},
+        {"select",       OP_ARRAY_SELECT},
+        {"store",        OP_ARRAY_STORE},
+        {"bvadd",        OP_BVADD},
+        {"bvand",        OP_BVAND},
+        {"bvashr",       OP_BVASHR},
+        {"bvcomp",       OP_BVCOMP},
+        {"bvlshr",       OP_BVLSHR},
+        {"bvmul",        OP_BVMUL},
+        {"bvnand",       OP_BVNAND},
+        {"bvneg",        OP_BVNEG},
+        {"bvnor",        OP_BVNOR},
+        {"bvnot",        OP_BVNOT},
+        {"bvor",         OP_BVOR},
+        {"bvsdiv",       OP_BVSDIV},
+        {"bvsge",        OP_BVSGE},
+        {"bvsgt",        OP_BVSGT},
+        {"bvshl",        OP_BVSHL},
+        {"bvsle",        OP_BVSLE},
+        {"bvslt",        OP_BVSLT},
+        {"bvsmod",       OP_BVSMOD},
+        {"bvsrem",       OP_BVSREM},
+        {"bvsub",        OP_BVSUB},
+        {"bvudiv",       OP_BVUDIV},
+        {"bvuge",        OP_BVUGE},
+        {"bvugt",        OP_BVUGT},
+        {"bvule",        OP_BVULE},
+        {"bvult",        OP_BVULT},
+        {"bvurem",       OP_BVUREM},
+        {"bvxnor",       OP_BVXNOR},
+        {"bvxor",        OP_BVXOR},
+        {"concat",       OP_CONCAT},
+        {"distinct",     OP_DISTINCT},
+        {"=",            OP_EQUAL},
+        {"extract",      OP_EXTRACT},
+        {"=>",           OP_IMPLIES},
+        {"ite",          OP_ITE},
+        {"not",          OP_NOT},
+        {"or",           OP_OR},
+        {"repeat",       OP_REPEAT},
+        {"rotate_left",  OP_ROTATE_LEFT},
+        {"rotate_right", OP_ROTATE_RIGHT},
+        {"sign_extend",  OP_SIGN_EXTEND},
+        {"xor",          OP_XOR},
+        {"zero_extend",  OP_ZERO_EXTEND},
+      };
+
+    };
+
+
+    struct Smt2ToTriton::Source {
+      //! The stream buffer, null when replaying tokens.
+      std::streambuf* buffer;
+
+      //! The tokens replayed, e.g. the body of a macro.
+      const std::vector<Token>* tokens;
+
+      //! The position of the next token replayed.
+      triton::usize position;
+    };
+
+
+    Smt2ToTriton::Smt2ToTriton(const triton::ast::SharedAstContext& ctxt, const DeclarationHandler& handler)
+      : astCtxt(ctxt), handler(handler) {
+      if (ctxt == nullptr)
+        throw triton::exceptions::AstLifting("Smt2ToTriton::Smt2ToTriton(): The AST context must be defined.");
+      this->line = 0;
+      this->reset();
+    }
+
+
+    void Smt2ToTriton::setVariable(const std::string& name, const triton::engines::symbolic::SharedSymbolicVariable& var) {
+      if (var == nullptr)
+        throw triton::exceptions::AstLifting("Smt2ToTriton::setVariable(): The variable must be defined.");
+      this->mapping[name] = var;
+    }
+
+
+    void Smt2ToTriton::reset(void) {
+      this->symbols.clear();
+      this->macros.clear();
+      this->assertions.clear();
+      this->declared.assign(1, {});
+      this->asserted.clear();
+      this->level  = 1;
+      this->levels = 1;
+    }
+
+
+    const std::vector<SharedAbstractNode>& Smt2ToTriton::getAssertions(void) const {
+      return this->assertions;
+    }
+
+
+    void Smt2ToTriton::error(const std::string& message) const {
+      throw triton::exceptions::AstLifting("Smt2ToTriton::parse(): " + message + " (line " + std::to_string(this->line) + ").");
+    }
+
+
+    void Smt2ToTriton::next(Source& source, Token& token) {
+      token.text.clear();
+
+      /* The tokens of a macro are replayed */
+      if (source.tokens != nullptr) {
+        if (source.position < source.tokens->size())
+          token = (*source.tokens)[source.position++];
+        else
+          token.kind = TOKEN_EOF;
+        return;
+      }
+
+      std::streambuf* buffer = source.buffer;
+      const int eof = std::streambuf::traits_type::eof();
+      int c = buffer->sbumpc();
+
+      /* Skips the spaces and the comments */
+      while (true) {
+        if (c == eof) {
+          token.kind = TOKEN_EOF;
+          return;
+        }
+        if (c == ';') {
+          while ((c = buffer->sbumpc()) != eof && c != '\n');
+          continue;
+        }
+        if (c == '\n')
+          this->line++;
+        else if (!std::isspace(c))
+          break;
+        c = buffer->sbumpc();
+      }
+
+      switch (c) {
+        case '(':
+          token.kind = TOKEN_LPAREN;
+          return;
+
+        case ')':
+          token.kind = TOKEN_RPAREN;
+          return;
+
+        /* A doubled quote is a quote of the string */
+        case '"':
+          token.kind = TOKEN_STRING;
+          while (true) {
+            c = buffer->sbumpc();
+            if (c == eof)
+              this->error("Unterminated string");
+            if (c == '"') {
+              if (buffer->sgetc() != '"')
+                return;
+              buffer->sbumpc();
+            }
+            if (c == '\n')
+              this->line++;
+            token.text.push_back(static_cast<char>(c));
+          }
+
+        case '|':
+          token.kind = TOKEN_SYMBOL;
+          while ((c = buffer->sbumpc()) != '|') {
+            if (c == eof)
+              this->error("Unterminated symbol");
+            if (c == '\n')
+              this->line++;
+            token.text.push_back(static_cast<char>(c));
+          }
+          return;
+
+        default:
+          token.kind = TOKEN_SYMBOL;
+          token.text.push_back(static_cast<char>(c));
+          while ((c = buffer->sgetc()) != eof && !std::isspace(c) && c != '(' && c != ')' && c != ';' && c != '"' && c != '|') {
+            token.text.push_back(static_cast<char>(c));
+            buffer->sbumpc();
+          }
+          return;
+      }
+    }
+
+
+    void Smt2ToTriton::expect(Source& source, Token& token, token_e kind) {
+      static const char* names[] = {"the end of the script", "(", ")", "a symbol", "a string"};
+
+      this->next(source, token);
+      if (token.kind != kind)
+        this->error(std::string("Expected ") + names[kind]);
+    }
+
+
+    void Smt2ToTriton::skip(Source& source, Token& token) {
+      triton::usize depth = 1;
+
+      while (depth) {
+        this->next(source, token);
+        switch (token.kind) {
+          case TOKEN_LPAREN: depth++; break;
+          case TOKEN_RPAREN: depth--; break;
+          case TOKEN_EOF:    this->error("Unbalanced parenthesis");
+          default:           break;
+        }
+      }
+    }
+
+
+    triton::uint32 Smt2ToTriton::numeral(const Token& token) const {
+      triton::uint64 value = 0;
+
+      if (token.kind != TOKEN_SYMBOL || token.text.empty())
+        this->error("Expected a numeral");
+
+      for (char c : token.text) {
+        if (!std::isdigit(static_cast<unsigned char>(c)))
+          this->error("Expected a numeral instead of " + token.text);
+        value = value * 10 + (c - '0');
+        if (value > 0xffffffff)
+          this->error("The numeral " + token.text + " is too large");
+      }
+
+      return static_cast<triton::uint32>(value);
+    }
+
+
+    triton::uint32 Smt2ToTriton::parseSort(Source& source, Token& token, triton::uint32& array) {
+      array = 0;
+
+      if (token.kind == TOKEN_SYMBOL && token.text == "Bool")
+        return 0;
+
+      if (token.kind != TOKEN_LPAREN)
+        this->error("Expected a sort");
+
+      this->expect(source, token, TOKEN_SYMBOL);
+
+      /* (_ BitVec n) */
+      if (token.text == "_") {
+        this->expect(source, token, TOKEN_SYMBOL);
+        if (token.text != "BitVec")
+          this->error("Unsupported sort " + token.text);
+        this->next(source, token);
+        triton::uint32 size = this->numeral(token);
+        if (size == 0)
+          this->error("A bit-vector must have at least one bit");
+        this->expect(source, token, TOKEN_RPAREN);
+        return size;
+      }
+
+      /* (Array (_ BitVec n) (_ BitVec 8)), the memory of Triton */
+      if (token.text == "Array") {
+        triton::uint32 nested = 0;
+        this->next(source, token);
+        triton::uint32 index = this->parseSort(source, token, nested);
+        if (index == 0 || nested)
+          this->error("The indexes of an array must be bit-vectors");
+        this->next(source, token);
+        if (this->parseSort(source, token, nested) != 8 || nested)
+          this->error("The values of an array must be bytes");
+        this->expect(source, token, TOKEN_RPAREN);
+        array = index;
+        return 0;
+      }
+
+      this->error("Unsupported sort " + token.text);
+    }
+
+
+    SharedAbstractNode Smt2ToTriton::atom(const Token& token) {
+      const std::string& text = token.text;
+
+      if (token.kind != TOKEN_SYMBOL)
+        this->error("Expected a term");
+
+      /* #b0101 */
+      if (text.size() > 2 && text[0] == '#' && text[1] == 'b') {
+        triton::uint512 value = 0;
+        for (triton::usize i = 2; i < text.size(); i++) {
+          if (text[i] != '0' && text[i] != '1')
+            this->error("Invalid binary literal " + text);
+          value = (value << 1) | (text[i] - '0');
+        }
+        return this->astCtxt->bv(value, static_cast<triton::uint32>(text.size() - 2));
+      }
+
+      /* #xdead */
+      if (text.size() > 2 && text[0] == '#' && text[1] == 'x') {
+        triton::uint512 value = 0;
+        for (triton::usize i = 2; i < text.size(); i++) {
+          char c = static_cast<char>(std::tolower(static_cast<unsigned char>(text[i])));
+          if (!std::isxdigit(static_cast<unsigned char>(c)))
+            this->error("Invalid hexadecimal literal " + text);
+          value = (value << 4) | (std::isdigit(static_cast<unsigned char>(c)) ? c - '0' : c - 'a' + 10);
+        }
+        return this->astCtxt->bv(value, static_cast<triton::uint32>((text.size() - 2) * 4));
+      }
+
+      /* A symbol of the script or of the let (or the macro) being parsed */
+      auto it = this->symbols.find(text);
+      if (it != this->symbols.end()) {
+        for (auto binding = it->second.rbegin(); binding != it->second.rend(); ++binding) {
+          if (binding->level == 0 || binding->level == this->level)
+            return binding->node;
+        }
+      }
+
+      if (text == "true")
+        return this->astCtxt->equal(this->astCtxt->bvtrue(), this->astCtxt->bvtrue());
+
+      if (text == "false")
+        return this->astCtxt->equal(this->astCtxt->bvtrue(), this->astCtxt->bvfalse());
+
+      if (std::isdigit(static_cast<unsigned char>(text[0])))
+        this->error("Integers are not supported");
+
+      this->error("Unknown symbol " + text);
+    }
+
+
+    SharedAbstractNode Smt2ToTriton::apply(const std::string& op, const std::vector<triton::uint32>& indexes, std::vector<SharedAbstractNode>& args) {
+      auto& ctxt = this->astCtxt;
+
+      /* A function defined with arguments is expanded in a level of its own */
+      auto macro = this->macros.find(op);
+      if (macro != this->macros.end() && indexes.empty()) {
+        const Macro& definition = macro->second;
+        triton::usize outer = this->level;
+
+        if (args.size() != definition.arguments.size())
+          this->error("The function " + op + " takes " + std::to_string(definition.arguments.size()) + " arguments");
+
+        this->level = ++this->levels;
+        for (triton::usize i = 0; i < args.size(); i++)
+          this->bind(definition.arguments[i], args[i], this->level);
+
+        Source body = {nullptr, &definition.body, 0};
+        Token token;
+        this->next(body, token);
+        SharedAbstractNode node = this->parseTerm(body, token);
+        this->next(body, token);
+        if (token.kind != TOKEN_EOF)
+          this->error("The body of the function " + op + " is not a single term");
+
+        for (auto it = definition.arguments.rbegin(); it != definition.arguments.rend(); ++it)
+          this->unbind(*it);
+        this->level = outer;
+
+        return node;
+      }
+
+      auto it = operators.find(op);
+      if (it == operators.end())
+        this->error("Unsupported operator " + op);
+
+      auto arity = [&](triton::usize minimum, triton::usize maximum, triton::usize indexed) {
+        if (args.size() < minimum || args.size() > maximum)
+          this->error("Wrong number of operands for " + op);
+        if (indexes.size() != indexed)
+          this->error("Wrong number of indexes for " + op);
+      };
+
+      const triton::usize any = static_cast<triton::usize>(-1);
+
+      switch (it->second) {
+        /* The n-ary bit-vector operators */
+        case OP_BVADD:  arity(2, any, 0); return ctxt->bvadd(args);
+        case OP_BVAND:  arity(2, any, 0); return ctxt->bvand(args);
+        case OP_BVOR:   arity(2, any, 0); return ctxt->bvor(args);
+        case OP_BVXOR:  arity(2, any, 0); return ctxt->bvxor(args);
+        case OP_CONCAT: arity(2, any, 0); return ctxt->concat(args);
+
+        case OP_BVMUL:
+        case OP_BVSUB: {
+          arity(2, any, 0);
+          SharedAbstractNode node = args[0];
+          for (triton::usize i = 1; i < args.size(); i++)
+            node = (it->second == OP_BVMUL) ? ctxt->bvmul(node, args[i]) : ctxt->bvsub(node, args[i]);
+          return node;
+        }
+
+        /* The binary bit-vector operators */
+        case OP_BVASHR: arity(2, 2, 0); return ctxt->bvashr(args[0], args[1]);
+        case OP_BVLSHR: arity(2, 2, 0); return ctxt->bvlshr(args[0], args[1]);
+        case OP_BVNAND: arity(2, 2, 0); return ctxt->bvnand(args[0], args[1]);
+        case OP_BVNOR:  arity(2, 2, 0); return ctxt->bvnor(args[0], args[1]);
+        case OP_BVSDIV: arity(2, 2, 0); return ctxt->bvsdiv(args[0], args[1]);
+        case OP_BVSHL:  arity(2, 2, 0); return ctxt->bvshl(args[0], args[1]);
+        case OP_BVSMOD: arity(2, 2, 0); return ctxt->bvsmod(args[0], args[1]);
+        case OP_BVSREM: arity(2, 2, 0); return ctxt->bvsrem(args[0], args[1]);
+        case OP_BVUDIV: arity(2, 2, 0); return ctxt->bvudiv(args[0], args[1]);
+        case OP_BVUREM: arity(2, 2, 0); return ctxt->bvurem(args[0], args[1]);
+        case OP_BVXNOR: arity(2, 2, 0); return ctxt->bvxnor(args[0], args[1]);
+        case OP_BVCOMP: arity(2, 2, 0); return ctxt->ite(ctxt->equal(args[0], args[1]), ctxt->bv(1, 1), ctxt->bv(0, 1));
+
+        /* The comparisons */
+        case OP_BVSGE:  arity(2, 2, 0); return ctxt->bvsge(args[0], args[1]);
+        case OP_BVSGT:  arity(2, 2, 0); return ctxt->bvsgt(args[0], args[1]);
+        case OP_BVSLE:  arity(2, 2, 0); return ctxt->bvsle(args[0], args[1]);
+        case OP_BVSLT:  arity(2, 2, 0); return ctxt->bvslt(args[0], args[1]);
+        case OP_BVUGE:  arity(2, 2, 0); return ctxt->bvuge(args[0], args[1]);
+        case OP_BVUGT:  arity(2, 2, 0); return ctxt->bvugt(args[0], args[1]);
+        case OP_BVULE:  arity(2, 2, 0); return ctxt->bvule(args[0], args[1]);
+        case OP_BVULT:  arity(2, 2, 0); return ctxt->bvult(args[0], args[1]);
+
+        /* The unary bit-vector operators */
+        case OP_BVNEG:  arity(1, 1, 0); return ctxt->bvneg(args[0]);
+        case OP_BVNOT:  arity(1, 1, 0); return ctxt->bvnot(args[0]);
+
+        /* The indexed operators */
+        case OP_EXTRACT:      arity(1, 1, 2); return ctxt->extract(indexes[0], indexes[1], args[0]);
+        case OP_ROTATE_LEFT:  arity(1, 1, 1); return ctxt->bvrol(args[0], indexes[0]);
+        case OP_ROTATE_RIGHT: arity(1, 1, 1); return ctxt->bvror(args[0], indexes[0]);
+        case OP_SIGN_EXTEND:  arity(1, 1, 1); return ctxt->sx(indexes[0], args[0]);
+        case OP_ZERO_EXTEND:  arity(1, 1, 1); return ctxt->zx(indexes[0], args[0]);
+
+        case OP_REPEAT: {
+          arity(1, 1, 1);
+          if (indexes[0] == 0)
+            this->error("A bit-vector must be repeated at least once");
+          if (indexes[0] == 1)
+            return args[0];
+          return ctxt->concat(std::vector<SharedAbstractNode>(indexes[0], args[0]));
+        }
+
+        /* The logical operators */
+        case OP_NOT: arity(1, 1, 0); return ctxt->lnot(args[0]);
+        case OP_AND: arity(1, any, 0); return (args.size() == 1) ? args[0] : ctxt->land(args);
+        case OP_OR:  arity(1, any, 0); return (args.size() == 1) ? args[0] : ctxt->lor(args);
+        case OP_XOR: arity(2, any, 0); return ctxt->lxor(args);
+
+        /* Right associative */
+        case OP_IMPLIES: {
+          arity(2, any, 0);
+          SharedAbstractNode node = args.back();
+          for (triton::usize i = args.size() - 1; i > 0; i--)
+            node = ctxt->lor(ctxt->lnot(args[i - 1]), node);
+          return node;
+        }
+
+        /* Chainable */
+        case OP_EQUAL: {
+          std::vector<SharedAbstractNode> pairs;
+          arity(2, any, 0);
+          for (triton::usize i = 1; i < args.size(); i++)
+            pairs.push_back(args[0]->isLogical() ? ctxt->iff(args[i - 1], args[i]) : ctxt->equal(args[i - 1], args[i]));
+          return (pairs.size() == 1) ? pairs[0] : ctxt->land(pairs);
+        }
+
+        /* Pairwise */
+        case OP_DISTINCT: {
+          std::vector<SharedAbstractNode> pairs;
+          arity(2, any, 0);
+          for (triton::usize i = 0; i < args.size(); i++) {
+            for (triton::usize j = i + 1; j < args.size(); j++)
+              pairs.push_back(args[0]->isLogical() ? ctxt->lnot(ctxt->iff(args[i], args[j])) : ctxt->distinct(args[i], args[j]));
+          }
+          return (pairs.size() == 1) ? pairs[0] : ctxt->land(pairs);
+        }
+
+        /* The ite of Triton only selects bit-vectors */
+        case OP_ITE: {
+          arity(3, 3, 0);
+          if (args[1]->isLogical())
+            return ctxt->lor(ctxt->land(args[0], args[1]), ctxt->land(ctxt->lnot(args[0]), args[2]));
+          return ctxt->ite(args[0], args[1], args[2]);
+        }
+
+        /* The arrays */
+        case OP_ARRAY_SELECT: arity(2, 2, 0); return ctxt->select(args[0], args[1]);
+        case OP_ARRAY_STORE:  arity(3, 3, 0); return ctxt->store(args[0], args[1], args[2]);
+      }
+
+      this->error("Unsupported operator " + op);
+    }
+
+
+    SharedAbstractNode Smt2ToTriton::parseTerm(Source& source, Token& token) {
+      std::vector<Frame> frames;
+      SharedAbstractNode result = nullptr;
+
+      while (true) {
+        /* Reads a term, or opens a term whose operands follow */
+        if (token.kind != TOKEN_LPAREN) {
+          result = this->atom(token);
+        }
+        else {
+          this->next(source, token);
+
+          /* ((_ op i...) t...) */
+          if (token.kind == TOKEN_LPAREN) {
+            Frame frame(FRAME_APPLY);
+            this->expect(source, token, TOKEN_SYMBOL);
+            if (token.text != "_")
+              this->error("Expected an indexed operator");
+            this->expect(source, token, TOKEN_SYMBOL);
+            frame.op = token.text;
+            for (this->next(source, token); token.kind != TOKEN_RPAREN; this->next(source, token))
+              frame.indexes.push_back(this->numeral(token));
+            frames.push_back(std::move(frame));
+            this->next(source, token);
+            continue;
+          }
+
+          if (token.kind != TOKEN_SYMBOL)
+            this->error("Expected an operator");
+
+          /* (_ bvN w) */
+          if (token.text == "_") {
+            triton::uint512 value = 0;
+            this->expect(source, token, TOKEN_SYMBOL);
+            if (token.text.size() < 3 || token.text.compare(0, 2, "bv") != 0)
+              this->error("Unsupported literal " + token.text);
+            for (triton::usize i = 2; i < token.text.size(); i++) {
+              if (!std::isdigit(static_cast<unsigned char>(token.text[i])))
+                this->error("Invalid decimal literal " + token.text);
+              value = value * 10 + (token.text[i] - '0');
+            }
+            this->next(source, token);
+            triton::uint32 size = this->numeral(token);
+            this->expect(source, token, TOKEN_RPAREN);
+            result = this->astCtxt->bv(value, size);
+          }
+
+          /* (let ((x t)...) body), the terms being parsed before x is bound */
+          else if (token.text == "let") {
+            Frame frame(FRAME_LET_BINDING);
+            this->expect(source, token, TOKEN_LPAREN);
+            this->expect(source, token, TOKEN_LPAREN);
+            this->expect(source, token, TOKEN_SYMBOL);
+            frame.bindings.push_back({token.text, nullptr});
+            frames.push_back(std::move(frame));
+            this->next(source, token);
+            continue;
+          }
+
+          /* (! t attributes) */
+          else if (token.text == "!") {
+            frames.emplace_back(FRAME_ANNOTATION);
+            this->next(source, token);
+            continue;
+          }
+
+          else {
+            Frame frame(FRAME_APPLY);
+            frame.op = token.text;
+            frames.push_back(std::move(frame));
+            this->next(source, token);
+            if (token.kind == TOKEN_RPAREN)
+              this->error("Missing operands for " + frames.back().op);
+            continue;
+          }
+        }
+
+        /* Gives the term read to the terms it closes */
+        while (true) {
+          if (frames.empty())
+            return result;
+
+          Frame& frame = frames.back();
+
+          if (frame.kind == FRAME_APPLY) {
+            frame.args.push_back(result);
+            this->next(source, token);
+            if (token.kind != TOKEN_RPAREN)
+              break;
+            result = this->apply(frame.op, frame.indexes, frame.args);
+            frames.pop_back();
+          }
+
+          else if (frame.kind == FRAME_LET_BINDING) {
+            frame.bindings.back().second = result;
+            this->expect(source, token, TOKEN_RPAREN);
+            this->next(source, token);
+            if (token.kind == TOKEN_LPAREN) {
+              this->expect(source, token, TOKEN_SYMBOL);
+              frame.bindings.push_back({token.text, nullptr});
+              this->next(source, token);
+              break;
+            }
+            if (token.kind != TOKEN_RPAREN)
+              this->error("Expected a binding");
+            for (const auto& binding : frame.bindings)
+              this->bind(binding.first, binding.second, this->level);
+            frame.kind = FRAME_LET_BODY;
+            this->next(source, token);
+            break;
+          }
+
+          else if (frame.kind == FRAME_LET_BODY) {
+            for (auto it = frame.bindings.rbegin(); it != frame.bindings.rend(); ++it)
+              this->unbind(it->first);
+            this->expect(source, token, TOKEN_RPAREN);
+            frames.pop_back();
+          }
+
+          /* Only :named is meaningful, it defines a symbol of the script */
+          else {
+            for (this->next(source, token); token.kind != TOKEN_RPAREN; this->next(source, token)) {
+              if (token.kind == TOKEN_LPAREN)
+                this->skip(source, token);
+              else if (token.kind == TOKEN_EOF)
+                this->error("Unbalanced parenthesis");
+              else if (token.kind == TOKEN_SYMBOL && token.text == ":named") {
+                this->expect(source, token, TOKEN_SYMBOL);
+                this->declare(token.text);
+                this->bind(token.text, result, 0);
+              }
+            }
+            frames.pop_back();
+          }
+        }
+      }
+    }
+
+
+    SharedAbstractNode Smt2ToTriton::constant(const std::string& name, triton::uint32 size, triton::uint32 array) {
+      triton::engines::symbolic::SharedSymbolicVariable var = nullptr;
+      triton::uint32 bits = (size == 0) ? 1 : size;
+
+      if (array)
+        return this->astCtxt->array(array);
+
+      auto it = this->mapping.find(name);
+      if (it != this->mapping.end())
+        var = it->second;
+      else if (this->handler)
+        var = this->handler(name, bits);
+
+      if (var == nullptr) {
+        if (auto node = this->astCtxt->getVariableNode(name))
+          var = reinterpret_cast<VariableNode*>(node.get())->getSymbolicVariable();
+      }
+
+      if (var == nullptr)
+        this->error("No variable for the constant " + name);
+
+      if (var->getSize() != bits)
+        this->error("The variable of the constant " + name + " is not of " + std::to_string(bits) + " bits");
+
+      /* A Boolean is a bit equal to 1 */
+      if (size == 0)
+        return this->astCtxt->equal(this->astCtxt->variable(var), this->astCtxt->bvtrue());
+
+      return this->astCtxt->variable(var);
+    }
+
+
+    void Smt2ToTriton::bind(const std::string& name, const SharedAbstractNode& node, triton::usize level) {
+      this->symbols[name].push_back({node, level});
+    }
+
+
+    void Smt2ToTriton::unbind(const std::string& name) {
+      auto it = this->symbols.find(name);
+      if (it == this->symbols.end())
+        return;
+      it->second.pop_back();
+      if (it->second.empty())
+        this->symbols.erase(it);
+    }
+
+
+    void Smt2ToTriton::declare(const std::string& name) {
+      if (this->symbols.find(name) != this->symbols.end() || this->macros.find(name) != this->macros.end())
+        this->error("The symbol " + name + " is already declared");
+      this->declared.back().push_back(name);
+    }
+
+
+    void Smt2ToTriton::forget(const std::string& name) {
+      if (this->macros.erase(name) == 0)
+        this->unbind(name);
+    }
+
+
+    void Smt2ToTriton::purge(void) {
+      for (auto it = this->symbols.begin(); it != this->symbols.end();) {
+        auto& bindings = it->second;
+        while (!bindings.empty() && bindings.back().level != 0)
+          bindings.pop_back();
+        if (bindings.empty())
+          it = this->symbols.erase(it);
+        else
+          ++it;
+      }
+      this->level = 1;
+    }
+
+
+    bool Smt2ToTriton::parseCommand(Source& source, Token& token) {
+      triton::uint32 array = 0;
+
+      this->expect(source, token, TOKEN_SYMBOL);
+      const std::string command = token.text;
+
+      if (command == "assert") {
+        this->next(source, token);
+        SharedAbstractNode node = this->parseTerm(source, token);
+        if (!node->isLogical())
+          this->error("An assertion must be a Boolean");
+        this->expect(source, token, TOKEN_RPAREN);
+        this->assertions.push_back(node);
+      }
+
+      else if (command == "declare-fun" || command == "declare-const") {
+        this->expect(source, token, TOKEN_SYMBOL);
+        const std::string name = token.text;
+        if (command == "declare-fun") {
+          this->expect(source, token, TOKEN_LPAREN);
+          this->next(source, token);
+          if (token.kind != TOKEN_RPAREN)
+            this->error("Uninterpreted functions are not supported");
+        }
+        this->next(source, token);
+        triton::uint32 size = this->parseSort(source, token, array);
+        this->expect(source, token, TOKEN_RPAREN);
+        this->declare(name);
+        this->bind(name, this->constant(name, size, array), 0);
+      }
+
+      else if (command == "define-fun") {
+        Macro macro;
+        this->expect(source, token, TOKEN_SYMBOL);
+        const std::string name = token.text;
+
+        this->expect(source, token, TOKEN_LPAREN);
+        for (this->next(source, token); token.kind != TOKEN_RPAREN; this->next(source, token)) {
+          if (token.kind != TOKEN_LPAREN)
+            this->error("Expected an argument");
+          this->expect(source, token, TOKEN_SYMBOL);
+          macro.arguments.push_back(token.text);
+          this->next(source, token);
+          this->parseSort(source, token, array);
+          this->expect(source, token, TOKEN_RPAREN);
+        }
+
+        /* The sort of the result is the one of the body */
+        this->next(source, token);
+        this->parseSort(source, token, array);
+        this->next(source, token);
+
+        /* A function without argument is a shared term */
+        if (macro.arguments.empty()) {
+          SharedAbstractNode node = this->parseTerm(source, token);
+          this->expect(source, token, TOKEN_RPAREN);
+          this->declare(name);
+          this->bind(name, node, 0);
+        }
+
+        /* The others are kept as the tokens of their body */
+        else {
+          triton::usize depth = 0;
+          do {
+            if (token.kind == TOKEN_EOF)
+              this->error("Unbalanced parenthesis");
+            if (token.kind == TOKEN_LPAREN)
+              depth++;
+            else if (token.kind == TOKEN_RPAREN && depth-- == 0)
+              this->error("Expected a term");
+            macro.body.push_back(token);
+            if (depth)
+              this->next(source, token);
+          } while (depth);
+          this->expect(source, token, TOKEN_RPAREN);
+          this->declare(name);
+          this->macros[name] = std::move(macro);
+        }
+      }
+
+      else if (command == "push" || command == "pop") {
+        triton::uint32 count = 1;
+        this->next(source, token);
+        if (token.kind != TOKEN_RPAREN) {
+          count = this->numeral(token);
+          this->expect(source, token, TOKEN_RPAREN);
+        }
+        if (command == "push") {
+          for (triton::uint32 i = 0; i < count; i++) {
+            this->declared.emplace_back();
+            this->asserted.push_back(this->assertions.size());
+          }
+        }
+        else {
+          if (count >= this->declared.size())
+            this->error("Popping more scopes than pushed");
+          for (triton::uint32 i = 0; i < count; i++) {
+            for (auto it = this->declared.back().rbegin(); it != this->declared.back().rend(); ++it)
+              this->forget(*it);
+            this->declared.pop_back();
+            this->assertions.resize(this->asserted.back());
+            this->asserted.pop_back();
+          }
+        }
+      }
+
+      else if (command == "reset") {
+        this->expect(source, token, TOKEN_RPAREN);
+        this->reset();
+      }
+
+      /* The scopes are popped, the declarations of the script are kept */
+      else if (command == "reset-assertions") {
+        this->expect(source, token, TOKEN_RPAREN);
+        while (this->declared.size() > 1) {
+          for (auto it = this->declared.back().rbegin(); it != this->declared.back().rend(); ++it)
+            this->forget(*it);
+          this->declared.pop_back();
+        }
+        this->asserted.clear();
+        this->assertions.clear();
+      }
+
+      else if (command == "exit") {
+        this->expect(source, token, TOKEN_RPAREN);
+        return false;
+      }
+
+      /* The commands of a solver are ignored */
+      else if (command.compare(0, 4, "set-") == 0 || command.compare(0, 4, "get-") == 0 || command.compare(0, 9, "check-sat") == 0 || command == "echo") {
+        this->skip(source, token);
+      }
+
+      else {
+        this->error("Unsupported command " + command);
+      }
+
+      return true;
+    }
+
+
+    const std::vector<SharedAbstractNode>& Smt2ToTriton::parse(std::istream& stream) {
+      Source source = {stream.rdbuf(), nullptr, 0};
+      Token token;
+
+      if (source.buffer == nullptr)
+        throw triton::exceptions::AstLifting("Smt2ToTriton::parse(): The stream has no buffer.");
+
+      this->line = 1;
+
+      try {
+        for (this->next(source, token); token.kind != TOKEN_EOF; this->next(source, token)) {
+          if (token.kind != TOKEN_LPAREN)
+            this->error("Expected a command");
+          if (!this->parseCommand(source, token))
+            break;
+        }
+      }
+      catch (...) {
+        this->purge();
+        throw;
+      }
+
+      return this->assertions;
+    }
+
+
+    const std::vector<SharedAbstractNode>& Smt2ToTriton::parse(const std::string& script) {
+      StringBuffer buffer(script);
+      std::istream stream(&buffer);
+      return this->parse(stream);
+    }
+
+
+    SharedAbstractNode Smt2ToTriton::parseTerm(const std::string& term) {
+      StringBuffer buffer(term);
+      Source source = {&buffer, nullptr, 0};
+      SharedAbstractNode node = nullptr;
+      Token token;
+
+      this->line = 1;
+
+      try {
+        this->next(source, token);
+        node = this->parseTerm(source, token);
+        this->expect(source, token, TOKEN_EOF);
+      }
+      catch (...) {
+        this->purge();
+        throw;
+      }
+
+      return node;
+    }
+
+  }; /* ast namespace */
+}; /* triton namespace */
@@ -0,0 +1,432 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <stack>
+#include <tuple>
+#include <unordered_set>
+
+#include <triton/exceptions.hpp>
+#include <triton/symbolicExpression.hpp>
+#include <triton/tritonToSmt2.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    /* Returns the nodes whose terms are operands of the term of a node */
+    static std::vector<AbstractNode*> operandsOf(AbstractNode* node) {
+      std::vector<AbstractNode*> result;
+      const auto& children = node->getChildren();
+
+      switch (node->getType()) {
+        case REFERENCE_NODE:
+          result.push_back(reinterpret_cast<ReferenceNode*>(node)->getSymbolicExpression()->getAst().get());
+          break;
+
+        case ARRAY_NODE:
+        case BV_NODE:
+        case INTEGER_NODE:
+        case STRING_NODE:
+        case VARIABLE_NODE:
+          break;
+
+        case BVROL_NODE:
+        case BVROR_NODE:
+          result.push_back(children[0].get());
+          break;
+
+        case SX_NODE:
+        case ZX_NODE:
+          result.push_back(children[1].get());
+          break;
+
+        case EXTRACT_NODE:
+          result.push_back(children[2].get());
+          break;
+
+        case LET_NODE:
+          result.push_back(children[1].get());
+          result.push_back(children[2].get());
+          break;
+
+        case BVLANEADD_NODE:
+        case BVLANEEQ_NODE:
+        case BVLANESELECT_NODE:
+        case BVLANESGT_NODE:
+        case BVLANESUB_NODE:
+          for (triton::usize index = 0; index + 1 < children.size(); index++)
+            result.push_back(children[index].get());
+          break;
+
+        case COMPOUND_NODE:
+        case DECLARE_NODE:
+        case FORALL_NODE:
+          throw triton::exceptions::AstLifting("TritonToSmt2::convert(): This node cannot be converted.");
+
+        default:
+          for (const auto& child : children)
+            result.push_back(child.get());
+          break;
+      }
+
+      return result;
+    }
+
+
+    /* Returns the integer of the `index`-th child of a node */
+    static std::string integerOf(AbstractNode* node, triton::usize index) {
+      return reinterpret_cast<IntegerNode*>(node->getChildren()[index].get())->getInteger().str();
+    }
+
+
+    /* The nodes which are a standard SMT-LIB2 operator */
+    static const std::unordered_map<triton::uint32, std::string> operators = {
+      {BVADD_NODE,    "bvadd"},
+      {BVAND_NODE,    "bvand"},
+      {BVASHR_NODE,   "bvashr"},
+      {BVLSHR_NODE,   "bvlshr"},
+      {BVMUL_NODE,    "bvmul"},
+      {BVNAND_NODE,   "bvnand"},
+      {BVNEG_NODE,    "bvneg"},
+      {BVNOR_NODE,    "bvnor"},
+      {BVNOT_NODE,    "bvnot"},
+      {BVOR_NODE,     "bvor"},
+      {BVSDIV_NODE,   "bvsdiv"},
+      {BVSGE_NODE,    "bvsge"},
+      {BVSGT_NODE,    "bvsgt"},
+      {BVSHL_NODE,    "bvshl"},
+      {BVSLE_NODE,    "bvsle"},
+      {BVSLT_NODE,    "bvslt"},
+      {BVSMOD_NODE,   "bvsmod"},
+      {BVSREM_NODE,   "bvsrem"},
+      {BVSUB_NODE,    "bvsub"},
+      {BVUDIV_NODE,   "bvudiv"},
+      {BVUGE_NODE,    "bvuge"},
+      {BVUGT_NODE,    "bvugt"},
+      {BVULE_NODE,    "bvule"},
+      {BVULT_NODE,    "bvult"},
+      {BVUREM_NODE,   "bvurem"},
+      {BVXNOR_NODE,   "bvxnor"},
+      {BVXOR_NODE,    "bvxor"},
+      {CONCAT_NODE,   "concat"},
+      {DISTINCT_NODE, "distinct"},
+      {ITE_NODE,      "ite"},
+      {SELECT_NODE,   "select"},
+      {STORE_NODE,    "store"},
+    };
+
+
+    /* Returns `(op a b ...)` */
+    static std::string apply(const std::string& op, const std::vector<std::string>& ops) {
+      std::string term = "(" + op;
+      for (const auto& operand : ops)
+        term += " " + operand;
+      return term + ")";
+    }
+
+
+    TritonToSmt2::TritonToSmt2() {
+      this->counter = 0;
+      this->reset();
+    }
+
+
+    /* Returns the name of the memory whose indexes have `indexSize` bits */
+    static std::string memoryOf(triton::uint32 indexSize) {
+      return "memory_" + std::to_string(indexSize);
+    }
+
+
+    std::string TritonToSmt2::sort(AbstractNode* node) const {
+      if (node->isLogical())
+        return "Bool";
+      if (node->isArray())
+        return "(Array (_ BitVec " + std::to_string(getArrayIndexSize(node->shared_from_this())) + ") (_ BitVec 8))";
+      return "(_ BitVec " + std::to_string(node->getBitvectorSize()) + ")";
+    }
+
+
+    std::string TritonToSmt2::print(AbstractNode* node, const std::vector<std::string>& ops) const {
+      const auto& children = node->getChildren();
+
+      switch (node->getType()) {
+        case ARRAY_NODE:
+          return memoryOf(getArrayIndexSize(node->shared_from_this()));
+
+        case ASSERT_NODE:
+        case REFERENCE_NODE:
+          return ops[0];
+
+        case BSWAP_NODE: {
+          /* The bytes in reverse order, the lowest one first */
+          if (node->getBitvectorSize() == triton::bitsize::byte)
+            return ops[0];
+          std::string term = "(let ((value " + ops[0] + ")) (concat";
+          for (triton::uint32 low = 0; low < node->getBitvectorSize(); low += triton::bitsize::byte)
+            term += " ((_ extract " + std::to_string(low + 7) + " " + std::to_string(low) + ") value)";
+          return term + "))";
+        }
+
+        case BVLANEADD_NODE:
+        case BVLANEEQ_NODE:
+        case BVLANESELECT_NODE:
+        case BVLANESGT_NODE:
+        case BVLANESUB_NODE: {
+          triton::uint32 size = node->getBitvectorSize();
+          triton::uint32 lane = std::stoul(integerOf(node, children.size() - 1));
+          std::string ones    = "(bvnot (_ bv0 " + std::to_string(lane) + "))";
+          std::string zero    = "(_ bv0 " + std::to_string(lane) + ")";
+          std::string term    = "(let ((value1 " + ops[0] + ") (value2 " + ops[1] + ")";
+          std::vector<std::string> lanes;
+
+          if (ops.size() > 2)
+            term += " (value3 " + ops[2] + ")";
+          term += ") ";
+
+          /* The highest lane first */
+          for (triton::uint32 index = size / lane; index != 0; index--) {
+            triton::uint32 low = (index - 1) * lane;
+            std::string range  = "(_ extract " + std::to_string(low + lane - 1) + " " + std::to_string(low) + ")";
+            std::string sign   = "(_ extract " + std::to_string(low + lane - 1) + " " + std::to_string(low + lane - 1) + ")";
+
+            switch (node->getType()) {
+              case BVLANEADD_NODE:    lanes.push_back("(bvadd (" + range + " value1) (" + range + " value2))"); break;
+              case BVLANESUB_NODE:    lanes.push_back("(bvsub (" + range + " value1) (" + range + " value2))"); break;
+              case BVLANEEQ_NODE:     lanes.push_back("(ite (= (" + range + " value1) (" + range + " value2)) " + ones + " " + zero + ")"); break;
+              case BVLANESGT_NODE:    lanes.push_back("(ite (bvsgt (" + range + " value1) (" + range + " value2)) " + ones + " " + zero + ")"); break;
+              case BVLANESELECT_NODE: lanes.push_back("(ite (= (" + sign + " value1) (_ bv1 1)) (" + range + " value2) (" + range + " value3))"); break;
+              default: break;
+            }
+          }
+
+          /* A concatenation has two operands at least */
+          if (lanes.size() == 1)
+            return term + lanes.front() + ")";
+          return term + apply("concat", lanes) + ")";
+        }
+
+        case BVPARITY_NODE: {
+          triton::uint32 size = children[0]->getBitvectorSize();
+          if (size == 1)
+            return ops[0];
+          std::string term = "(let ((value " + ops[0] + ")) (bvxor";
+          for (triton::uint32 index = 0; index < size; index++)
+            term += " ((_ extract " + std::to_string(index) + " " + std::to_string(index) + ") value)";
+          return term + "))";
+        }
+
+        case BVPOPCOUNT_NODE: {
+          triton::uint32 size = node->getBitvectorSize();
+          if (size == 1)
+            return ops[0];
+          std::string term = "(let ((value " + ops[0] + ")) (bvadd";
+          for (triton::uint32 index = 0; index < size; index++)
+            term += " ((_ zero_extend " + std::to_string(size - 1) + ") ((_ extract " + std::to_string(index) + " " + std::to_string(index) + ") value))";
+          return term + "))";
+        }
+
+        case BVROL_NODE:
+          return "((_ rotate_left " + integerOf(node, 1) + ") " + ops[0] + ")";
+
+        case BVROR_NODE:
+          return "((_ rotate_right " + integerOf(node, 1) + ") " + ops[0] + ")";
+
+        case BV_NODE:
+          return "(_ bv" + integerOf(node, 0) + " " + integerOf(node, 1) + ")";
+
+        case EXTRACT_NODE:
+          return "((_ extract " + integerOf(node, 0) + " " + integerOf(node, 1) + ") " + ops[0] + ")";
+
+        case EQUAL_NODE:
+        case IFF_NODE:
+          return apply("=", ops);
+
+        case INTEGER_NODE:
+          return reinterpret_cast<IntegerNode*>(node)->getInteger().str();
+
+        case LAND_NODE:
+          return apply("and", ops);
+
+        case LET_NODE:
+          return "(let ((" + reinterpret_cast<StringNode*>(children[0].get())->getString() + " " + ops[0] + ")) " + ops[1] + ")";
+
+        case LNOT_NODE:
+          return apply("not", ops);
+
+        case LOR_NODE:
+          return apply("or", ops);
+
+        case LXOR_NODE:
+          return apply("xor", ops);
+
+        case STRING_NODE:
+          return reinterpret_cast<StringNode*>(node)->getString();
+
+        case SX_NODE:
+          return "((_ sign_extend " + integerOf(node, 0) + ") " + ops[0] + ")";
+
+        case VARIABLE_NODE:
+          return reinterpret_cast<VariableNode*>(node)->getSymbolicVariable()->getName();
+
+        case ZX_NODE:
+          return "((_ zero_extend " + integerOf(node, 0) + ") " + ops[0] + ")";
+
+        default: {
+          /* The other nodes are their standard SMT-LIB2 operator applied to their operands */
+          auto it = operators.find(node->getType());
+          if (it == operators.end())
+            throw triton::exceptions::AstLifting("TritonToSmt2::print(): Invalid kind of node.");
+          return apply(it->second, ops);
+        }
+      }
+    }
+
+
+    std::string TritonToSmt2::convert(const SharedAbstractNode& node, std::ostream& stream) {
+      std::unordered_map<AbstractNode*, std::string> texts;
+      std::unordered_map<AbstractNode*, triton::usize> uses;
+      std::unordered_set<AbstractNode*> bound;
+      std::vector<AbstractNode*> order;
+      std::unordered_set<AbstractNode*> visited;
+      std::stack<std::pair<AbstractNode*, bool>> worklist;
+
+      if (node == nullptr)
+        throw triton::exceptions::AstLifting("TritonToSmt2::convert(): node cannot be null.");
+
+      /*
+       *  We use a worklist strategy to avoid recursive calls
+       *  and so stack overflow when going through a big AST.
+       */
+      worklist.push({node.get(), false});
+      while (!worklist.empty()) {
+        AbstractNode* ast;
+        bool postOrder;
+        std::tie(ast, postOrder) = worklist.top();
+        worklist.pop();
+
+        if (postOrder) {
+          order.push_back(ast);
+          continue;
+        }
+
+        if (!visited.insert(ast).second)
+          continue;
+
+        /* A term defined by a previous conversion is referred to by its name */
+        auto it = this->terms.find(ast);
+        if (it != this->terms.end()) {
+          texts[ast] = it->second.name;
+          continue;
+        }
+
+        worklist.push({ast, true});
+        for (AbstractNode* op : operandsOf(ast)) {
+          uses[op]++;
+          if (visited.find(op) == visited.end())
+            worklist.push({op, false});
+        }
+      }
+
+      for (AbstractNode* ast : order) {
+        std::vector<AbstractNode*> operands = operandsOf(ast);
+        std::vector<std::string> ops;
+        bool isBound = (ast->getType() == STRING_NODE);
+
+        for (AbstractNode* op : operands) {
+          ops.push_back(texts.at(op));
+          isBound |= (bound.find(op) != bound.end());
+        }
+
+        /* The symbols of a let are only bound in its body */
+        if (ast->getType() == LET_NODE)
+          isBound = (bound.find(operands[0]) != bound.end());
+
+        if (isBound)
+          bound.insert(ast);
+
+        if (ast->getType() == VARIABLE_NODE) {
+          const auto& var = reinterpret_cast<VariableNode*>(ast)->getSymbolicVariable();
+          if (this->variables.find(var->getName()) == this->variables.end()) {
+            stream << "(declare-fun " << var->getName() << " () (_ BitVec " << var->getSize() << "))" << std::endl;
+            this->variables[var->getName()] = var;
+            this->declared.back().push_back(var->getName());
+          }
+        }
+
+        /* All the arrays with the same size of indexes are the same memory, declared once */
+        if (ast->getType() == ARRAY_NODE) {
+          std::string name = memoryOf(getArrayIndexSize(ast->shared_from_this()));
+          if (this->memories.insert(name).second) {
+            stream << "(declare-fun " << name << " () " << this->sort(ast) << ")" << std::endl;
+            this->declared.back().push_back(name);
+          }
+        }
+
+        std::string text = this->print(ast, ops);
+
+        /* A term used several times is defined once */
+        switch (ast->getType()) {
+          case ARRAY_NODE:
+          case BV_NODE:
+          case INTEGER_NODE:
+          case REFERENCE_NODE:
+          case STRING_NODE:
+          case VARIABLE_NODE:
+            break;
+
+          default:
+            if (uses[ast] > 1 && !isBound) {
+              std::string name = "t!" + std::to_string(this->counter++);
+              stream << "(define-fun " << name << " () " << this->sort(ast) << " " << text << ")" << std::endl;
+              this->terms[ast] = {name, this->scopes.size() - 1};
+              this->scopes.back().push_back(ast->shared_from_this());
+              text = name;
+            }
+            break;
+        }
+
+        texts[ast] = text;
+      }
+
+      return texts.at(node.get());
+    }
+
+
+    void TritonToSmt2::push(void) {
+      this->scopes.emplace_back();
+      this->declared.emplace_back();
+    }
+
+
+    void TritonToSmt2::pop(triton::usize count) {
+      if (count >= this->scopes.size())
+        throw triton::exceptions::AstLifting("TritonToSmt2::pop(): Not enough scopes opened.");
+
+      while (count--) {
+        for (const auto& ast : this->scopes.back())
+          this->terms.erase(ast.get());
+        for (const auto& name : this->declared.back()) {
+          this->variables.erase(name);
+          this->memories.erase(name);
+        }
+        this->scopes.pop_back();
+        this->declared.pop_back();
+      }
+    }
+
+
+    void TritonToSmt2::reset(void) {
+      this->terms.clear();
+      this->memories.clear();
+      this->variables.clear();
+      this->scopes.assign(1, {});
+      this->declared.assign(1, {});
+    }
+
+  }; /* ast namespace */
+}; /* triton namespace */
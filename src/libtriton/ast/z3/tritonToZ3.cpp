@@ -5,10 +5,17 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
 #include <vector>
 
 #include <triton/cpuSize.hpp>
 #include <triton/exceptions.hpp>
+#include <triton/executor.hpp>
 #include <triton/symbolicExpression.hpp>
 #include <triton/symbolicVariable.hpp>
 #include <triton/tritonToZ3.hpp>
@@ -18,6 +25,10 @@
 namespace triton {
   namespace ast {
 
+    /* The number of nodes to convert from which the branches of a node are converted in parallel */
+    static const triton::usize parallelThreshold = 100000;
+
+
     TritonToZ3::TritonToZ3(bool eval)
       : context() {
       this->isEval = eval;
@@ -38,6 +49,17 @@ namespace triton {
 
     z3::expr TritonToZ3::convert(const triton::ast::SharedAbstractNode& node) {
       std::unordered_map<triton::ast::SharedAbstractNode, z3::expr> results;
+      std::vector<triton::ast::SharedAbstractNode> converted;
+      bool bound = false;
+
+      if (node == nullptr)
+        throw triton::exceptions::AstLifting("TritonToZ3::convert(): node cannot be null.");
+
+      /* The branches of a large node are converted in parallel, the nodes above them by the walk */
+      if (this->split(node, results, nullptr, converted)) {
+        this->walk(node, results, nullptr, converted, bound);
+        return results.at(node);
+      }
 
       auto nodes = triton::ast::childrenExtraction(node, true /* unroll*/, true /* revert */);
 
@@ -49,6 +71,254 @@ namespace triton {
     }
 
 
+    z3::expr TritonToZ3::convert(const triton::ast::SharedAbstractNode& node, triton::ast::TermCache<z3::expr>& cache) {
+      std::unordered_map<triton::ast::SharedAbstractNode, z3::expr> results;
+      std::vector<triton::ast::SharedAbstractNode> converted;
+      bool bound = false;
+
+      if (node == nullptr)
+        throw triton::exceptions::AstLifting("TritonToZ3::convert(): node cannot be null.");
+
+      this->split(node, results, &cache, converted);
+      this->walk(node, results, &cache, converted, bound);
+
+      /* The terms depending on the symbols of a let are not kept, the symbols may be bound again by the next query */
+      if (!bound) {
+        for (const auto& n : converted) {
+          if (n->getType() != REFERENCE_NODE)
+            cache.insert(n, results.at(n));
+        }
+      }
+
+      return results.at(node);
+    }
+
+
+    void TritonToZ3::walk(const triton::ast::SharedAbstractNode& node, std::unordered_map<triton::ast::SharedAbstractNode, z3::expr>& results,
+                          const triton::ast::TermCache<z3::expr>* cache, std::vector<triton::ast::SharedAbstractNode>& converted, bool& bound) {
+      std::vector<std::pair<triton::ast::SharedAbstractNode, bool>> worklist;
+
+      /* Post-order walk which does not descend into the nodes already converted */
+      worklist.push_back(std::make_pair(node, false));
+      while (!worklist.empty()) {
+        auto n = worklist.back().first;
+        auto visited = worklist.back().second;
+        worklist.pop_back();
+
+        if (results.find(n) != results.end())
+          continue;
+
+        if (visited) {
+          results.insert(std::make_pair(n, this->do_convert(n, &results)));
+          converted.push_back(n);
+          bound |= (n->getType() == LET_NODE || n->getType() == STRING_NODE);
+          continue;
+        }
+
+        /* The term of a reference is the one of its expression, which may be updated */
+        if (cache != nullptr && n->getType() != REFERENCE_NODE) {
+          if (const z3::expr* term = cache->find(n)) {
+            results.insert(std::make_pair(n, *term));
+            continue;
+          }
+        }
+
+        worklist.push_back(std::make_pair(n, true));
+
+        /* References are unrolled */
+        if (n->getType() == REFERENCE_NODE) {
+          worklist.push_back(std::make_pair(reinterpret_cast<triton::ast::ReferenceNode*>(n.get())->getSymbolicExpression()->getAst(), false));
+          continue;
+        }
+
+        const auto& children = n->getChildren();
+        for (auto it = children.rbegin(); it != children.rend(); it++)
+          worklist.push_back(std::make_pair(*it, false));
+      }
+    }
+
+
+    bool TritonToZ3::split(const triton::ast::SharedAbstractNode& node, std::unordered_map<triton::ast::SharedAbstractNode, z3::expr>& results,
+                           const triton::ast::TermCache<z3::expr>* cache, std::vector<triton::ast::SharedAbstractNode>& converted) {
+      const triton::usize shared = static_cast<triton::usize>(-1);
+      auto& executor = triton::utils::Executor::getDefault();
+      triton::usize threads = executor.getThreads();
+
+      if (threads < 2)
+        return false;
+
+      auto isCached = [cache](const triton::ast::SharedAbstractNode& n) {
+        return cache != nullptr && n->getType() != REFERENCE_NODE && cache->find(n) != nullptr;
+      };
+
+      /* The branches are the children of the first node with several children */
+      triton::ast::SharedAbstractNode top = node;
+      while (!isCached(top)) {
+        if (top->getType() == REFERENCE_NODE)
+          top = reinterpret_cast<triton::ast::ReferenceNode*>(top.get())->getSymbolicExpression()->getAst();
+        else if (top->getChildren().size() == 1)
+          top = top->getChildren()[0];
+        else
+          break;
+      }
+
+      const auto& branches = top->getChildren();
+      if (isCached(top) || branches.size() < 2)
+        return false;
+
+      /* Each node not cached is owned by the only branch reaching it, the ones reached by several branches are converted by each of them */
+      std::unordered_map<const triton::ast::AbstractNode*, triton::usize> owners;
+      std::vector<triton::ast::SharedAbstractNode> frontier;
+      std::vector<triton::usize> sizes(branches.size(), 0);
+      triton::usize sharedNodes = 0;
+      triton::usize total = 0;
+
+      for (triton::usize index = 0; index < branches.size(); index++) {
+        std::vector<triton::ast::SharedAbstractNode> worklist = {branches[index]};
+        while (!worklist.empty()) {
+          auto n = worklist.back();
+          worklist.pop_back();
+
+          auto it = owners.find(n.get());
+          if (it == owners.end()) {
+            owners[n.get()] = index;
+            if (isCached(n)) {
+              frontier.push_back(n);
+              continue;
+            }
+            sizes[index]++;
+            total++;
+          }
+          else if (it->second == index || it->second == shared) {
+            continue;
+          }
+          else {
+            /* The nodes below were owned by the same branch, they are shared too */
+            if (isCached(n)) {
+              it->second = shared;
+              continue;
+            }
+            sizes[it->second]--;
+            it->second = shared;
+            sharedNodes++;
+          }
+
+          /* The symbols of a let are bound by the walk of its parent */
+          if (n->getType() == LET_NODE || n->getType() == STRING_NODE)
+            return false;
+
+          if (n->getType() == REFERENCE_NODE) {
+            worklist.push_back(reinterpret_cast<triton::ast::ReferenceNode*>(n.get())->getSymbolicExpression()->getAst());
+            continue;
+          }
+
+          for (const auto& child : n->getChildren())
+            worklist.push_back(child);
+        }
+      }
+
+      /* Not worth the translation of the terms, or too many nodes converted several times */
+      if (total < parallelThreshold || sharedNodes * 8 > total)
+        return false;
+
+      /* The branches are spread over the groups, the largest ones first to the least loaded group */
+      triton::usize count = std::min<triton::usize>(threads, branches.size());
+      std::vector<std::vector<triton::usize>> groups(count);
+      std::vector<triton::usize> order(branches.size());
+      std::priority_queue<std::pair<triton::usize, triton::usize>, std::vector<std::pair<triton::usize, triton::usize>>, std::greater<std::pair<triton::usize, triton::usize>>> loads;
+
+      for (triton::usize index = 0; index < order.size(); index++)
+        order[index] = index;
+      std::sort(order.begin(), order.end(), [&sizes](triton::usize a, triton::usize b) { return sizes[a] > sizes[b]; });
+
+      for (triton::usize group = 0; group < count; group++)
+        loads.push(std::make_pair(0, group));
+
+      for (auto index : order) {
+        auto load = loads.top();
+        loads.pop();
+        groups[load.second].push_back(index);
+        loads.push(std::make_pair(load.first + sizes[index], load.second));
+      }
+
+      /* Each group is converted into its own context, the terms of the cached nodes are translated into it first */
+      std::vector<std::unique_ptr<TritonToZ3>> workers(count);
+      std::vector<std::unordered_map<triton::ast::SharedAbstractNode, z3::expr>> outputs(count);
+      std::vector<std::vector<triton::ast::SharedAbstractNode>> nodes(count);
+      std::exception_ptr error = nullptr;
+      std::mutex errorLock;
+
+      z3::expr_vector terms(this->context);
+      for (const auto& n : frontier)
+        terms.push_back(*cache->find(n));
+
+      for (triton::usize group = 0; group < count; group++) {
+        workers[group].reset(new TritonToZ3(this->isEval));
+        if (frontier.empty())
+          continue;
+
+        z3::expr_vector seeds(workers[group]->context, Z3_ast_vector_translate(this->context, terms, workers[group]->context));
+        for (triton::usize index = 0; index < frontier.size(); index++)
+          outputs[group].insert(std::make_pair(frontier[index], seeds[index]));
+      }
+
+      std::vector<triton::utils::SharedExecutorTask> tasks;
+      for (triton::usize group = 0; group < count; group++) {
+        tasks.push_back(executor.submit([&, group](const triton::utils::ExecutorTask&) {
+          try {
+            bool bound = false;
+            for (auto index : groups[group])
+              workers[group]->walk(branches[index], outputs[group], nullptr, nodes[group], bound);
+          }
+          catch (...) {
+            std::lock_guard<std::mutex> guard(errorLock);
+            if (error == nullptr)
+              error = std::current_exception();
+          }
+        }, triton::utils::PRIORITY_HIGH));
+      }
+
+      for (const auto& task : tasks)
+        executor.wait(task);
+
+      if (error != nullptr)
+        std::rethrow_exception(error);
+
+      /* The terms of each group are translated at once, the nodes they share keep a single translation */
+      for (triton::usize group = 0; group < count; group++) {
+        z3::expr_vector local(workers[group]->context);
+        for (const auto& n : nodes[group])
+          local.push_back(outputs[group].at(n));
+
+        z3::expr_vector translated(this->context, Z3_ast_vector_translate(workers[group]->context, local, this->context));
+        for (triton::usize index = 0; index < nodes[group].size(); index++) {
+          if (results.insert(std::make_pair(nodes[group][index], translated[index])).second)
+            converted.push_back(nodes[group][index]);
+        }
+
+        this->variables.insert(workers[group]->variables.begin(), workers[group]->variables.end());
+      }
+
+      return true;
+    }
+
+
+    z3::context& TritonToZ3::getContext(void) {
+      return this->context;
+    }
+
+
+    z3::expr TritonToZ3::balanced(Z3_ast (*mk)(Z3_context, Z3_ast, Z3_ast), const std::vector<z3::expr>& ops, triton::usize begin, triton::usize end) {
+      if (end - begin == 1)
+        return ops[begin];
+
+      triton::usize middle = begin + (end - begin) / 2;
+      z3::expr lhs = this->balanced(mk, ops, begin, middle);
+      z3::expr rhs = this->balanced(mk, ops, middle, end);
+      return to_expr(this->context, mk(this->context, lhs, rhs));
+    }
+
+
     z3::expr TritonToZ3::do_convert(const triton::ast::SharedAbstractNode& node, std::unordered_map<triton::ast::SharedAbstractNode, z3::expr>* results) {
       if (node == nullptr)
         throw triton::exceptions::AstLifting("TritonToZ3::do_convert(): node cannot be null.");
@@ -61,6 +331,13 @@ namespace triton {
 
       switch (node->getType()) {
 
+        /* All the arrays with the same size of indexes are the same memory, an uninterpreted array of bytes */
+        case ARRAY_NODE: {
+          auto indexSize = triton::ast::getArrayIndexSize(node);
+          std::string name = "memory_" + std::to_string(indexSize);
+          return this->context.constant(name.c_str(), this->context.array_sort(this->context.bv_sort(indexSize), this->context.bv_sort(triton::bitsize::byte)));
+        }
+
         case BSWAP_NODE: {
           auto bvsize = node->getBitvectorSize();
           auto retval = to_expr(this->context, Z3_mk_bvand(this->context, children[0], this->context.bv_val(0xff, bvsize)));
@@ -77,14 +354,58 @@ namespace triton {
         }
 
         case BVADD_NODE:
-          return to_expr(this->context, Z3_mk_bvadd(this->context, children[0], children[1]));
+          return this->balanced(Z3_mk_bvadd, children, 0, children.size());
 
         case BVAND_NODE:
-          return to_expr(this->context, Z3_mk_bvand(this->context, children[0], children[1]));
+          return this->balanced(Z3_mk_bvand, children, 0, children.size());
 
         case BVASHR_NODE:
           return to_expr(this->context, Z3_mk_bvashr(this->context, children[0], children[1]));
 
+        /* Lane-wise nodes are expanded into one operation per lane */
+        case BVLANEADD_NODE:
+        case BVLANEEQ_NODE:
+        case BVLANESELECT_NODE:
+        case BVLANESGT_NODE:
+        case BVLANESUB_NODE: {
+          auto bvsize = node->getBitvectorSize();
+          auto lane   = reinterpret_cast<triton::ast::IntegerNode*>(node->getChildren().back().get())->getInteger().convert_to<triton::uint32>();
+          auto zero   = this->context.bv_val(0, lane);
+          auto ones   = to_expr(this->context, Z3_mk_bvnot(this->context, zero));
+          z3::expr retval(this->context);
+
+          for (triton::uint32 low = 0 ; low != bvsize ; low += lane) {
+            triton::uint32 high = low + lane - 1;
+            auto op1 = to_expr(this->context, Z3_mk_extract(this->context, high, low, children[0]));
+            auto op2 = to_expr(this->context, Z3_mk_extract(this->context, high, low, children[1]));
+            z3::expr value(this->context);
+
+            switch (node->getType()) {
+              case BVLANEADD_NODE:
+                value = to_expr(this->context, Z3_mk_bvadd(this->context, op1, op2));
+                break;
+              case BVLANEEQ_NODE:
+                value = to_expr(this->context, Z3_mk_ite(this->context, Z3_mk_eq(this->context, op1, op2), ones, zero));
+                break;
+              case BVLANESGT_NODE:
+                value = to_expr(this->context, Z3_mk_ite(this->context, Z3_mk_bvsgt(this->context, op1, op2), ones, zero));
+                break;
+              case BVLANESUB_NODE:
+                value = to_expr(this->context, Z3_mk_bvsub(this->context, op1, op2));
+                break;
+              default: {
+                auto op3 = to_expr(this->context, Z3_mk_extract(this->context, high, low, children[2]));
+                auto msb = to_expr(this->context, Z3_mk_extract(this->context, high, high, children[0]));
+                value = to_expr(this->context, Z3_mk_ite(this->context, Z3_mk_eq(this->context, msb, this->context.bv_val(1, 1)), op2, op3));
+                break;
+              }
+            }
+
+            retval = (low == 0) ? value : to_expr(this->context, Z3_mk_concat(this->context, value, retval));
+          }
+          return to_expr(this->context, retval);
+        }
+
         case BVLSHR_NODE:
           return to_expr(this->context, Z3_mk_bvlshr(this->context, children[0], children[1]));
 
@@ -104,7 +425,29 @@ namespace triton {
           return to_expr(this->context, Z3_mk_bvnot(this->context, children[0]));
 
         case BVOR_NODE:
-          return to_expr(this->context, Z3_mk_bvor(this->context, children[0], children[1]));
+          return this->balanced(Z3_mk_bvor, children, 0, children.size());
+
+        case BVPARITY_NODE: {
+          auto bvsize = node->getChildren()[0]->getBitvectorSize();
+          auto retval = to_expr(this->context, Z3_mk_extract(this->context, 0, 0, children[0]));
+          for (triton::uint32 index = 1 ; index != bvsize ; index++) {
+            retval = to_expr(this->context, Z3_mk_bvxor(this->context, retval, to_expr(this->context, Z3_mk_extract(this->context, index, index, children[0]))));
+          }
+          return to_expr(this->context, retval);
+        }
+
+        case BVPOPCOUNT_NODE: {
+          auto bvsize = node->getBitvectorSize();
+          if (bvsize == 1)
+            return to_expr(this->context, children[0]);
+          auto retval = to_expr(this->context, Z3_mk_zero_ext(this->context, bvsize - 1, Z3_mk_extract(this->context, 0, 0, children[0])));
+          for (triton::uint32 index = 1 ; index != bvsize ; index++) {
+            retval = to_expr(this->context, Z3_mk_bvadd(this->context, retval,
+                       to_expr(this->context, Z3_mk_zero_ext(this->context, bvsize - 1, Z3_mk_extract(this->context, index, index, children[0])))
+                     ));
+          }
+          return to_expr(this->context, retval);
+        }
 
         case BVROL_NODE: {
           triton::uint32 rot = reinterpret_cast<triton::ast::IntegerNode*>(node->getChildren()[1].get())->getInteger().convert_to<triton::uint32>();
@@ -165,7 +508,7 @@ namespace triton {
           return to_expr(this->context, Z3_mk_bvxnor(this->context, children[0], children[1]));
 
         case BVXOR_NODE:
-          return to_expr(this->context, Z3_mk_bvxor(this->context, children[0], children[1]));
+          return this->balanced(Z3_mk_bvxor, children, 0, children.size());
 
         case BV_NODE:
           return this->context.bv_val(this->getStringValue(children[0]).c_str(), children[1].get_numeral_uint());
@@ -232,16 +575,12 @@ namespace triton {
         }
 
         case LAND_NODE: {
-          z3::expr currentValue = children[0];
-          z3::expr nextValue(this->context);
-
-          for (triton::uint32 idx = 1; idx < children.size(); idx++) {
-            nextValue = children[idx];
-            Z3_ast ops[] = {currentValue, nextValue};
-            currentValue = to_expr(this->context, Z3_mk_and(this->context, 2, ops));
-          }
+          /* One conjunction of all the operands, a flat path predicate stays flat */
+          std::vector<Z3_ast> ops;
+          for (const auto& child : children)
+            ops.push_back(child);
 
-          return currentValue;
+          return to_expr(this->context, Z3_mk_and(this->context, static_cast<unsigned>(ops.size()), ops.data()));
         }
 
         case LET_NODE: {
@@ -257,16 +596,11 @@ namespace triton {
         }
 
         case LOR_NODE: {
-          z3::expr currentValue = children[0];
-          z3::expr nextValue(this->context);
+          std::vector<Z3_ast> ops;
+          for (const auto& child : children)
+            ops.push_back(child);
 
-          for (triton::uint32 idx = 1; idx < children.size(); idx++) {
-            nextValue = children[idx];
-            Z3_ast ops[] = {currentValue, nextValue};
-            currentValue = to_expr(this->context, Z3_mk_or(this->context, 2, ops));
-          }
-
-          return currentValue;
+          return to_expr(this->context, Z3_mk_or(this->context, static_cast<unsigned>(ops.size()), ops.data()));
         }
 
         case LXOR_NODE: {
@@ -284,6 +618,12 @@ namespace triton {
         case REFERENCE_NODE:
           return results->at(reinterpret_cast<triton::ast::ReferenceNode*>(node.get())->getSymbolicExpression()->getAst());
 
+        case SELECT_NODE:
+          return to_expr(this->context, Z3_mk_select(this->context, children[0], children[1]));
+
+        case STORE_NODE:
+          return to_expr(this->context, Z3_mk_store(this->context, children[0], children[1], children[2]));
+
         case STRING_NODE: {
           std::string value = reinterpret_cast<triton::ast::StringNode*>(node.get())->getString();
 
@@ -6,6 +6,8 @@
 */
 
 #include <list>
+#include <utility>
+#include <vector>
 
 #include <triton/astContext.hpp>
 #include <triton/exceptions.hpp>
@@ -22,6 +24,54 @@ namespace triton {
 
 
     SharedAbstractNode Z3ToTriton::convert(const z3::expr& expr) {
+      std::vector<std::pair<z3::expr, bool>> worklist;
+
+      /*
+       * The arguments are converted before their applications, once per Z3 AST
+       * (the results of the solver are DAGs) and without recursion.
+       */
+      this->nodes.clear();
+      try {
+        worklist.push_back({expr, false});
+        while (!worklist.empty()) {
+          z3::expr current = worklist.back().first;
+          bool post = worklist.back().second;
+          worklist.pop_back();
+
+          unsigned id = Z3_get_ast_id(current.ctx(), current);
+          if (this->nodes.find(id) != this->nodes.end())
+            continue;
+
+          if (post) {
+            this->nodes[id] = this->visit(current);
+            continue;
+          }
+
+          worklist.push_back({current, true});
+          if (current.is_app()) {
+            for (triton::uint32 i = current.num_args(); i > 0; i--)
+              worklist.push_back({current.arg(i - 1), false});
+          }
+        }
+      }
+      catch (...) {
+        this->nodes.clear();
+        throw;
+      }
+
+      SharedAbstractNode node = this->nodes.at(Z3_get_ast_id(expr.ctx(), expr));
+      this->nodes.clear();
+
+      return node;
+    }
+
+
+    const SharedAbstractNode& Z3ToTriton::child(const z3::expr& expr, triton::uint32 index) const {
+      return this->nodes.at(Z3_get_ast_id(expr.ctx(), expr.arg(index)));
+    }
+
+
+    SharedAbstractNode Z3ToTriton::visit(const z3::expr& expr) {
       SharedAbstractNode node = nullptr;
 
       /* Currently, only support application node (TODO) */
@@ -40,30 +90,30 @@ namespace triton {
         case Z3_OP_EQ: {
           if (expr.num_args() != 2)
             throw triton::exceptions::AstLifting("Z3ToTriton::visit(): Z3_OP_EQ must contain two arguments.");
-          node = this->astCtxt->equal(this->convert(expr.arg(0)), this->convert(expr.arg(1)));
+          node = this->astCtxt->equal(this->child(expr, 0), this->child(expr, 1));
           break;
         }
 
         case Z3_OP_DISTINCT: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstLifting("Z3ToTriton::visit(): Z3_OP_DISTINCT must contain at least two arguments.");
-          node = this->astCtxt->distinct(this->convert(expr.arg(0)), this->convert(expr.arg(1)));
+          node = this->astCtxt->distinct(this->child(expr, 0), this->child(expr, 1));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = this->astCtxt->distinct(node, this->convert(expr.arg(i)));
+            node = this->astCtxt->distinct(node, this->child(expr, i));
           break;
         }
 
         case Z3_OP_IFF: {
           if (expr.num_args() != 2)
             throw triton::exceptions::AstLifting("Z3ToTriton::visit(): Z3_OP_IFF must contain two arguments.");
-          node = this->astCtxt->iff(this->convert(expr.arg(0)), this->convert(expr.arg(1)));
+          node = this->astCtxt->iff(this->child(expr, 0), this->child(expr, 1));
           break;
         }
 
         case Z3_OP_ITE: {
           if (expr.num_args() != 3)
             throw triton::exceptions::AstLifting("Z3ToTriton::visit(): Z3_OP_ITE must contain three arguments.");
-          node = this->astCtxt->ite(this->convert(expr.arg(0)), this->convert(expr.arg(1)), this->convert(expr.arg(2)));
+          node = this->astCtxt->ite(this->child(expr, 0), this->child(expr, 1), this->child(expr, 2));
           break;
         }
 
@@ -73,7 +123,7 @@ namespace triton {
 
           std::vector<SharedAbstractNode> args;
           for (triton::uint32 i = 0; i < expr.num_args(); i++) {
-            args.push_back(this->convert(expr.arg(i)));
+            args.push_back(this->child(expr, i));
           }
 
           node = this->astCtxt->land(args);
@@ -86,7 +136,7 @@ namespace triton {
 
           std::vector<SharedAbstractNode> args;
           for (triton::uint32 i = 0; i < expr.num_args(); i++) {
-            args.push_back(this->convert(expr.arg(i)));
+            args.push_back(this->child(expr, i));
           }
 
           node = this->astCtxt->lor(args);
@@ -96,14 +146,14 @@ namespace triton {
         case Z3_OP_XOR: {
           if (expr.num_args() != 2)
             throw triton::exceptions::AstLifting("Z3ToTriton::visit(): Z3_OP_XOR must contain two arguments.");
-          node = this->astCtxt->lxor(this->convert(expr.arg(0)), this->convert(expr.arg(1)));
+          node = this->astCtxt->lxor(this->child(expr, 0), this->child(expr, 1));
           break;
         }
 
         case Z3_OP_NOT: {
           if (expr.num_args() != 1)
             throw triton::exceptions::AstLifting("Z3ToTriton::visit(): Z3_OP_NOT must contain one argument.");
-          node = this->astCtxt->lnot(this->convert(expr.arg(0)));
+          node = this->astCtxt->lnot(this->child(expr, 0));
           break;
         }
 
@@ -117,34 +167,34 @@ namespace triton {
         case Z3_OP_BNEG: {
           if (expr.num_args() != 1)
             throw triton::exceptions::AstLifting("Z3ToTriton::visit(): Z3_OP_BNEG must contain one argument.");
-          node = this->astCtxt->bvneg(this->convert(expr.arg(0)));
+          node = this->astCtxt->bvneg(this->child(expr, 0));
           break;
         }
 
         case Z3_OP_BADD: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstLifting("Z3ToTriton::visit(): Z3_OP_BADD must contain at least two arguments.");
-          node = this->astCtxt->bvadd(this->convert(expr.arg(0)), this->convert(expr.arg(1)));
+          node = this->astCtxt->bvadd(this->child(expr, 0), this->child(expr, 1));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = this->astCtxt->bvadd(node, this->convert(expr.arg(i)));
+            node = this->astCtxt->bvadd(node, this->child(expr, i));
           break;
         }
 
         case Z3_OP_BSUB: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstLifting("Z3ToTriton::visit(): Z3_OP_BSUB must contain at least two arguments.");
-          node = this->astCtxt->bvsub(this->convert(expr.arg(0)), this->convert(expr.arg(1)));
+          node = this->astCtxt->bvsub(this->child(expr, 0), this->child(expr, 1));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = this->astCtxt->bvsub(node, this->convert(expr.arg(i)));
+            node = this->astCtxt->bvsub(node, this->child(expr, i));
           break;
         }
 
         case Z3_OP_BMUL: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstLifting("Z3ToTriton::visit(): Z3_OP_BMUL must contain at least two arguments.");
-          node = this->astCtxt->bvmul(this->convert(expr.arg(0)), this->convert(expr.arg(1)));
+          node = this->astCtxt->bvmul(this->child(expr, 0), this->child(expr, 1));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = this->astCtxt->bvmul(node, this->convert(expr.arg(i)));
+            node = this->astCtxt->bvmul(node, this->child(expr, i));
           break;
         }
 
@@ -152,9 +202,9 @@ namespace triton {
         case Z3_OP_BSDIV: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstLifting("Z3ToTriton::visit(): Z3_OP_BSDIV must contain at least two arguments.");
-          node = this->astCtxt->bvsdiv(this->convert(expr.arg(0)), this->convert(expr.arg(1)));
+          node = this->astCtxt->bvsdiv(this->child(expr, 0), this->child(expr, 1));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = this->astCtxt->bvsdiv(node, this->convert(expr.arg(i)));
+            node = this->astCtxt->bvsdiv(node, this->child(expr, i));
           break;
         }
 
@@ -162,9 +212,9 @@ namespace triton {
         case Z3_OP_BUDIV: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstLifting("Z3ToTriton::visit(): Z3_OP_BUDIV must contain at least two arguments.");
-          node = this->astCtxt->bvudiv(this->convert(expr.arg(0)), this->convert(expr.arg(1)));
+          node = this->astCtxt->bvudiv(this->child(expr, 0), this->child(expr, 1));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = this->astCtxt->bvudiv(node, this->convert(expr.arg(i)));
+            node = this->astCtxt->bvudiv(node, this->child(expr, i));
           break;
         }
 
@@ -172,9 +222,9 @@ namespace triton {
         case Z3_OP_BSREM: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstLifting("Z3ToTriton::visit(): Z3_OP_BSREM must contain at least two arguments.");
-          node = this->astCtxt->bvsrem(this->convert(expr.arg(0)), this->convert(expr.arg(1)));
+          node = this->astCtxt->bvsrem(this->child(expr, 0), this->child(expr, 1));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = this->astCtxt->bvsrem(node, this->convert(expr.arg(i)));
+            node = this->astCtxt->bvsrem(node, this->child(expr, i));
           break;
         }
 
@@ -182,9 +232,9 @@ namespace triton {
         case Z3_OP_BUREM: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstLifting("Z3ToTriton::visit(): Z3_OP_BUREM must contain at least two arguments.");
-          node = this->astCtxt->bvurem(this->convert(expr.arg(0)), this->convert(expr.arg(1)));
+          node = this->astCtxt->bvurem(this->child(expr, 0), this->child(expr, 1));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = this->astCtxt->bvurem(node, this->convert(expr.arg(i)));
+            node = this->astCtxt->bvurem(node, this->child(expr, i));
           break;
         }
 
@@ -192,142 +242,142 @@ namespace triton {
         case Z3_OP_BSMOD: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstLifting("Z3ToTriton::visit(): Z3_OP_BSMOD must contain at least two arguments.");
-          node = this->astCtxt->bvsmod(this->convert(expr.arg(0)), this->convert(expr.arg(1)));
+          node = this->astCtxt->bvsmod(this->child(expr, 0), this->child(expr, 1));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = this->astCtxt->bvsmod(node, this->convert(expr.arg(i)));
+            node = this->astCtxt->bvsmod(node, this->child(expr, i));
           break;
         }
 
         case Z3_OP_ULEQ: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstLifting("Z3ToTriton::visit(): Z3_OP_ULEQ must contain at least two arguments.");
-          node = this->astCtxt->bvule(this->convert(expr.arg(0)), this->convert(expr.arg(1)));
+          node = this->astCtxt->bvule(this->child(expr, 0), this->child(expr, 1));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = this->astCtxt->bvule(node, this->convert(expr.arg(i)));
+            node = this->astCtxt->bvule(node, this->child(expr, i));
           break;
         }
 
         case Z3_OP_SLEQ: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstLifting("Z3ToTriton::visit(): Z3_OP_SLEQ must contain at least two arguments.");
-          node = this->astCtxt->bvsle(this->convert(expr.arg(0)), this->convert(expr.arg(1)));
+          node = this->astCtxt->bvsle(this->child(expr, 0), this->child(expr, 1));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = this->astCtxt->bvsle(node, this->convert(expr.arg(i)));
+            node = this->astCtxt->bvsle(node, this->child(expr, i));
           break;
         }
 
         case Z3_OP_UGEQ: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstLifting("Z3ToTriton::visit(): Z3_OP_UGEQ must contain at least two arguments.");
-          node = this->astCtxt->bvuge(this->convert(expr.arg(0)), this->convert(expr.arg(1)));
+          node = this->astCtxt->bvuge(this->child(expr, 0), this->child(expr, 1));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = this->astCtxt->bvuge(node, this->convert(expr.arg(i)));
+            node = this->astCtxt->bvuge(node, this->child(expr, i));
           break;
         }
 
         case Z3_OP_SGEQ: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstLifting("Z3ToTriton::visit(): Z3_OP_SGEQ must contain at least two arguments.");
-          node = this->astCtxt->bvsge(this->convert(expr.arg(0)), this->convert(expr.arg(1)));
+          node = this->astCtxt->bvsge(this->child(expr, 0), this->child(expr, 1));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = this->astCtxt->bvsge(node, this->convert(expr.arg(i)));
+            node = this->astCtxt->bvsge(node, this->child(expr, i));
           break;
         }
 
         case Z3_OP_ULT: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstLifting("Z3ToTriton::visit(): Z3_OP_ULT must contain at least two arguments.");
-          node = this->astCtxt->bvult(this->convert(expr.arg(0)), this->convert(expr.arg(1)));
+          node = this->astCtxt->bvult(this->child(expr, 0), this->child(expr, 1));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = this->astCtxt->bvult(node, this->convert(expr.arg(i)));
+            node = this->astCtxt->bvult(node, this->child(expr, i));
           break;
         }
 
         case Z3_OP_SLT: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstLifting("Z3ToTriton::visit(): Z3_OP_SLT must contain at least two arguments.");
-          node = this->astCtxt->bvslt(this->convert(expr.arg(0)), this->convert(expr.arg(1)));
+          node = this->astCtxt->bvslt(this->child(expr, 0), this->child(expr, 1));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = this->astCtxt->bvslt(node, this->convert(expr.arg(i)));
+            node = this->astCtxt->bvslt(node, this->child(expr, i));
           break;
         }
 
         case Z3_OP_UGT: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstLifting("Z3ToTriton::visit(): Z3_OP_UGT must contain at least two arguments.");
-          node = this->astCtxt->bvugt(this->convert(expr.arg(0)), this->convert(expr.arg(1)));
+          node = this->astCtxt->bvugt(this->child(expr, 0), this->child(expr, 1));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = this->astCtxt->bvugt(node, this->convert(expr.arg(i)));
+            node = this->astCtxt->bvugt(node, this->child(expr, i));
           break;
         }
 
         case Z3_OP_SGT: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstLifting("Z3ToTriton::visit(): Z3_OP_SGT must contain at least two arguments.");
-          node = this->astCtxt->bvsgt(this->convert(expr.arg(0)), this->convert(expr.arg(1)));
+          node = this->astCtxt->bvsgt(this->child(expr, 0), this->child(expr, 1));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = this->astCtxt->bvsgt(node, this->convert(expr.arg(i)));
+            node = this->astCtxt->bvsgt(node, this->child(expr, i));
           break;
         }
 
         case Z3_OP_BAND: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstLifting("Z3ToTriton::visit(): Z3_OP_BAND must contain at least two arguments.");
-          node = this->astCtxt->bvand(this->convert(expr.arg(0)), this->convert(expr.arg(1)));
+          node = this->astCtxt->bvand(this->child(expr, 0), this->child(expr, 1));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = this->astCtxt->bvand(node, this->convert(expr.arg(i)));
+            node = this->astCtxt->bvand(node, this->child(expr, i));
           break;
         }
 
         case Z3_OP_BOR: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstLifting("Z3ToTriton::visit(): Z3_OP_BOR must contain at least two arguments.");
-          node = this->astCtxt->bvor(this->convert(expr.arg(0)), this->convert(expr.arg(1)));
+          node = this->astCtxt->bvor(this->child(expr, 0), this->child(expr, 1));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = this->astCtxt->bvor(node, this->convert(expr.arg(i)));
+            node = this->astCtxt->bvor(node, this->child(expr, i));
           break;
         }
 
         case Z3_OP_BNOT: {
           if (expr.num_args() != 1)
             throw triton::exceptions::AstLifting("Z3ToTriton::visit(): Z3_OP_BNOT must contain one argument.");
-          node = this->astCtxt->bvnot(this->convert(expr.arg(0)));
+          node = this->astCtxt->bvnot(this->child(expr, 0));
           break;
         }
 
         case Z3_OP_BXOR: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstLifting("Z3ToTriton::visit(): Z3_OP_BXOR must contain at least two arguments.");
-          node = this->astCtxt->bvxor(this->convert(expr.arg(0)), this->convert(expr.arg(1)));
+          node = this->astCtxt->bvxor(this->child(expr, 0), this->child(expr, 1));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = this->astCtxt->bvxor(node, this->convert(expr.arg(i)));
+            node = this->astCtxt->bvxor(node, this->child(expr, i));
           break;
         }
 
         case Z3_OP_BNAND: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstLifting("Z3ToTriton::visit(): Z3_OP_BNAND must contain at least two arguments.");
-          node = this->astCtxt->bvnand(this->convert(expr.arg(0)), this->convert(expr.arg(1)));
+          node = this->astCtxt->bvnand(this->child(expr, 0), this->child(expr, 1));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = this->astCtxt->bvnand(node, this->convert(expr.arg(i)));
+            node = this->astCtxt->bvnand(node, this->child(expr, i));
           break;
         }
 
         case Z3_OP_BNOR: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstLifting("Z3ToTriton::visit(): Z3_OP_BNOR must contain at least two arguments.");
-          node = this->astCtxt->bvnor(this->convert(expr.arg(0)), this->convert(expr.arg(1)));
+          node = this->astCtxt->bvnor(this->child(expr, 0), this->child(expr, 1));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = this->astCtxt->bvnor(node, this->convert(expr.arg(i)));
+            node = this->astCtxt->bvnor(node, this->child(expr, i));
           break;
         }
 
         case Z3_OP_BXNOR: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstLifting("Z3ToTriton::visit(): Z3_OP_BXNOR must contain at least two arguments.");
-          node = this->astCtxt->bvxnor(this->convert(expr.arg(0)), this->convert(expr.arg(1)));
+          node = this->astCtxt->bvxnor(this->child(expr, 0), this->child(expr, 1));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = this->astCtxt->bvxnor(node, this->convert(expr.arg(i)));
+            node = this->astCtxt->bvxnor(node, this->child(expr, i));
           break;
         }
 
@@ -337,7 +387,7 @@ namespace triton {
 
           std::vector<SharedAbstractNode> args;
           for (triton::uint32 i = 0; i < expr.num_args(); i++) {
-            args.push_back(this->convert(expr.arg(i)));
+            args.push_back(this->child(expr, i));
           }
 
           node = this->astCtxt->concat(args);
@@ -347,62 +397,62 @@ namespace triton {
         case Z3_OP_SIGN_EXT: {
           if (expr.num_args() != 1)
             throw triton::exceptions::AstLifting("Z3ToTriton::visit(): Z3_OP_SIGN_EXT must contain one argument.");
-          node = this->astCtxt->sx(expr.hi(), this->convert(expr.arg(0)));
+          node = this->astCtxt->sx(expr.hi(), this->child(expr, 0));
           break;
         }
 
         case Z3_OP_ZERO_EXT: {
           if (expr.num_args() != 1)
             throw triton::exceptions::AstLifting("Z3ToTriton::visit(): Z3_OP_ZERO_EXT must contain one argument.");
-          node = this->astCtxt->zx(expr.hi(), this->convert(expr.arg(0)));
+          node = this->astCtxt->zx(expr.hi(), this->child(expr, 0));
           break;
         }
 
         case Z3_OP_EXTRACT: {
           if (expr.num_args() != 1)
             throw triton::exceptions::AstLifting("Z3ToTriton::visit(): Z3_OP_EXTRACT must contain one argument.");
-          node = this->astCtxt->extract(expr.hi(), expr.lo(), this->convert(expr.arg(0)));
+          node = this->astCtxt->extract(expr.hi(), expr.lo(), this->child(expr, 0));
           break;
         }
 
         case Z3_OP_BSHL: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstLifting("Z3ToTriton::visit(): Z3_OP_BSHL must contain at least two arguments.");
-          node = this->astCtxt->bvshl(this->convert(expr.arg(0)), this->convert(expr.arg(1)));
+          node = this->astCtxt->bvshl(this->child(expr, 0), this->child(expr, 1));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = this->astCtxt->bvshl(node, this->convert(expr.arg(i)));
+            node = this->astCtxt->bvshl(node, this->child(expr, i));
           break;
         }
 
         case Z3_OP_BLSHR: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstLifting("Z3ToTriton::visit(): Z3_OP_BLSHR must contain at least two arguments.");
-          node = this->astCtxt->bvlshr(this->convert(expr.arg(0)), this->convert(expr.arg(1)));
+          node = this->astCtxt->bvlshr(this->child(expr, 0), this->child(expr, 1));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = this->astCtxt->bvlshr(node, this->convert(expr.arg(i)));
+            node = this->astCtxt->bvlshr(node, this->child(expr, i));
           break;
         }
 
         case Z3_OP_BASHR: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstLifting("Z3ToTriton::visit(): Z3_OP_BASHR must contain at least two arguments.");
-          node = this->astCtxt->bvashr(this->convert(expr.arg(0)), this->convert(expr.arg(1)));
+          node = this->astCtxt->bvashr(this->child(expr, 0), this->child(expr, 1));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = this->astCtxt->bvashr(node, this->convert(expr.arg(i)));
+            node = this->astCtxt->bvashr(node, this->child(expr, i));
           break;
         }
 
         case Z3_OP_ROTATE_LEFT: {
           if (expr.num_args() != 1)
             throw triton::exceptions::AstLifting("Z3ToTriton::visit(): Z3_OP_ROTATE_LEFT must contain one argument.");
-          node = this->astCtxt->bvrol(this->convert(expr.arg(0)), expr.hi());
+          node = this->astCtxt->bvrol(this->child(expr, 0), expr.hi());
           break;
         }
 
         case Z3_OP_ROTATE_RIGHT: {
           if (expr.num_args() != 1)
             throw triton::exceptions::AstLifting("Z3ToTriton::visit(): Z3_OP_ROTATE_RIGHT must contain one argument.");
-          node = this->astCtxt->bvror(this->convert(expr.arg(0)), expr.hi());
+          node = this->astCtxt->bvror(this->child(expr, 0), expr.hi());
           break;
         }
 
@@ -419,9 +469,29 @@ namespace triton {
         }
 
         /* Variable or string */
+        case Z3_OP_SELECT: {
+          if (expr.num_args() != 2)
+            throw triton::exceptions::AstLifting("Z3ToTriton::visit(): Z3_OP_SELECT must contain two arguments.");
+          node = this->astCtxt->select(this->child(expr, 0), this->child(expr, 1));
+          break;
+        }
+
+        case Z3_OP_STORE: {
+          if (expr.num_args() != 3)
+            throw triton::exceptions::AstLifting("Z3ToTriton::visit(): Z3_OP_STORE must contain three arguments.");
+          node = this->astCtxt->store(this->child(expr, 0), this->child(expr, 1), this->child(expr, 2));
+          break;
+        }
+
         case Z3_OP_UNINTERPRETED: {
           std::string name = function.name().str();
 
+          /* The memories are the arrays of bytes */
+          if (expr.get_sort().is_array()) {
+            node = this->astCtxt->array(expr.get_sort().array_domain().bv_size());
+            break;
+          }
+
           node = this->astCtxt->getVariableNode(name);
           if (node == nullptr)
             node = this->astCtxt->string(name);
@@ -0,0 +1,275 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <exception>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <triton/api.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/tritonC.h>
+
+
+
+/*! The context of the C interface. */
+struct triton_context {
+  //! The API of the context.
+  triton::API api;
+
+  //! The message of the last error.
+  std::string error;
+
+  triton_context(triton::arch::architecture_e arch) : api(arch) {
+  }
+};
+
+
+namespace {
+
+  /*! Runs `f` on the API of the context and records the error it throws. */
+  template <typename F>
+  triton_status_t guard(triton_context_t* ctx, F f) {
+    if (ctx == nullptr)
+      return TRITON_ERROR;
+
+    try {
+      f(ctx->api);
+      return TRITON_OK;
+    }
+    catch (const std::exception& e) {
+      ctx->error = e.what();
+    }
+    catch (...) {
+      ctx->error = "Unknown error.";
+    }
+
+    return TRITON_ERROR;
+  }
+
+
+  /*! Returns the register of a C id. */
+  const triton::arch::Register& registerOf(triton::API& api, triton::uint32 id) {
+    auto regId = static_cast<triton::arch::register_e>(id);
+    if (!api.isRegisterValid(regId))
+      throw triton::exceptions::API("triton_register(): Invalid register id.");
+    return api.getRegister(regId);
+  }
+
+
+  /*! Returns the AST of a query. */
+  triton::ast::SharedAbstractNode queryOf(triton::API& api, const triton_query_t& query) {
+    auto actx = api.getAstContext();
+
+    if (query.kind == TRITON_QUERY_EXPRESSION) {
+      auto expr = api.getSymbolicExpression(static_cast<triton::usize>(query.operand));
+      auto node = expr->getAst();
+      if (!node->isLogical())
+        node = actx->distinct(node, actx->bv(0, node->getBitvectorSize()));
+      if (query.with_path)
+        node = actx->land(api.getPathPredicate(), node);
+      return node;
+    }
+
+    if (query.kind == TRITON_QUERY_FLIP) {
+      const auto& pcs = api.getPathConstraints();
+      if (query.operand >= pcs.size())
+        throw triton::exceptions::API("triton_solve(): Invalid path constraint index.");
+
+      std::vector<triton::ast::SharedAbstractNode> predicates;
+      for (triton::usize i = 0; i < query.operand; i++)
+        predicates.push_back(pcs[i].getTakenPredicate());
+
+      for (const auto& branch : pcs[query.operand].getBranchConstraints()) {
+        if (std::get<0>(branch) == false) {
+          predicates.push_back(std::get<3>(branch));
+          return actx->land(predicates);
+        }
+      }
+
+      throw triton::exceptions::API("triton_solve(): The path constraint has no branch to flip.");
+    }
+
+    throw triton::exceptions::API("triton_solve(): Invalid query kind.");
+  }
+
+}
+
+
+
+triton_context_t* triton_create(uint32_t arch) {
+  try {
+    return new triton_context(static_cast<triton::arch::architecture_e>(arch));
+  }
+  catch (...) {
+    return nullptr;
+  }
+}
+
+
+void triton_destroy(triton_context_t* ctx) {
+  delete ctx;
+}
+
+
+const char* triton_last_error(const triton_context_t* ctx) {
+  if (ctx == nullptr)
+    return "Invalid context.";
+  return ctx->error.c_str();
+}
+
+
+triton_status_t triton_set_mode(triton_context_t* ctx, uint32_t mode, int32_t enabled) {
+  return guard(ctx, [&](triton::API& api) {
+    api.setMode(static_cast<triton::modes::mode_e>(mode), enabled != 0);
+  });
+}
+
+
+triton_status_t triton_reset(triton_context_t* ctx) {
+  return guard(ctx, [&](triton::API& api) {
+    api.reset();
+  });
+}
+
+
+size_t triton_process(triton_context_t* ctx, const triton_instruction_t* instructions, size_t count, triton_instruction_result_t* results) {
+  size_t done = 0;
+
+  guard(ctx, [&](triton::API& api) {
+    const auto& pc = api.getCpuInstance()->getProgramCounter();
+
+    for (; done < count; done++) {
+      const triton_instruction_t& in = instructions[done];
+      triton::arch::Instruction inst(in.address, in.opcode, in.size);
+
+      api.processing(inst);
+
+      if (results != nullptr) {
+        triton_instruction_result_t& out = results[done];
+        out.next       = api.getConcreteRegisterValue(pc).convert_to<triton::uint64>();
+        out.type       = inst.getType();
+        out.size       = inst.getSize();
+        out.branch     = inst.isBranch();
+        out.taken      = inst.isConditionTaken();
+        out.symbolized = inst.isSymbolized();
+        out.tainted    = inst.isTainted();
+      }
+    }
+  });
+
+  return done;
+}
+
+
+triton_status_t triton_set_memory(triton_context_t* ctx, uint64_t address, const uint8_t* values, size_t size) {
+  return guard(ctx, [&](triton::API& api) {
+    api.setConcreteMemoryAreaValue(address, values, size);
+  });
+}
+
+
+triton_status_t triton_get_memory(triton_context_t* ctx, uint64_t address, uint8_t* values, size_t size) {
+  return guard(ctx, [&](triton::API& api) {
+    api.getConcreteMemoryAreaValue(address, values, size);
+  });
+}
+
+
+triton_status_t triton_symbolize_memory(triton_context_t* ctx, uint64_t address, size_t size, uint64_t* variables) {
+  return guard(ctx, [&](triton::API& api) {
+    auto vars = api.symbolizeMemoryArea(address, size);
+    if (variables != nullptr) {
+      for (size_t i = 0; i < vars.size(); i++)
+        variables[i] = vars[i]->getId();
+    }
+  });
+}
+
+
+triton_status_t triton_get_register_id(triton_context_t* ctx, const char* name, uint32_t* id) {
+  return guard(ctx, [&](triton::API& api) {
+    *id = api.getRegister(std::string(name)).getId();
+  });
+}
+
+
+triton_status_t triton_set_registers(triton_context_t* ctx, const uint32_t* ids, const uint64_t* values, size_t count) {
+  return guard(ctx, [&](triton::API& api) {
+    for (size_t i = 0; i < count; i++)
+      api.setConcreteRegisterValue(registerOf(api, ids[i]), values[i]);
+  });
+}
+
+
+triton_status_t triton_get_registers(triton_context_t* ctx, const uint32_t* ids, uint64_t* values, size_t count) {
+  return guard(ctx, [&](triton::API& api) {
+    for (size_t i = 0; i < count; i++)
+      values[i] = api.getConcreteRegisterValue(registerOf(api, ids[i])).convert_to<triton::uint64>();
+  });
+}
+
+
+triton_status_t triton_symbolize_registers(triton_context_t* ctx, const uint32_t* ids, size_t count, uint64_t* variables) {
+  return guard(ctx, [&](triton::API& api) {
+    for (size_t i = 0; i < count; i++) {
+      auto var = api.symbolizeRegister(registerOf(api, ids[i]));
+      if (variables != nullptr)
+        variables[i] = var->getId();
+    }
+  });
+}
+
+
+triton_status_t triton_get_register_expression(triton_context_t* ctx, uint32_t id, uint64_t* expression) {
+  return guard(ctx, [&](triton::API& api) {
+    const auto& expr = api.getSymbolicRegister(registerOf(api, id));
+    if (expr == nullptr)
+      throw triton::exceptions::API("triton_get_register_expression(): The register has no symbolic expression.");
+    *expression = expr->getId();
+  });
+}
+
+
+size_t triton_get_path_constraints_size(triton_context_t* ctx) {
+  size_t size = 0;
+
+  guard(ctx, [&](triton::API& api) {
+    size = api.getPathConstraints().size();
+  });
+
+  return size;
+}
+
+
+triton_status_t triton_solve(triton_context_t* ctx, const triton_query_t* queries, size_t count, triton_answer_t* answers, triton_model_entry_t* models, size_t capacity) {
+  return guard(ctx, [&](triton::API& api) {
+    size_t used = 0;
+
+    for (size_t i = 0; i < count; i++) {
+      triton::engines::solver::status_e status = triton::engines::solver::UNKNOWN;
+      auto model = api.getModel(queryOf(api, queries[i]), &status, queries[i].timeout);
+
+      triton_answer_t& answer = answers[i];
+      answer.status    = status;
+      answer.truncated = (model.size() > capacity - used);
+      answer.offset    = used;
+      answer.count     = 0;
+
+      if (answer.truncated)
+        continue;
+
+      for (const auto& item : model) {
+        models[used].variable = item.first;
+        models[used].value    = item.second.getNarrowValue();
+        used++;
+      }
+
+      answer.count = model.size();
+    }
+  });
+}
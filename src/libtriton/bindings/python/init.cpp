@@ -92,6 +92,18 @@ namespace triton {
         initCpuSizeNamespace(cpuSizeDict);
         PyObject* idCpuSizeClass = xPyClass_New(nullptr, cpuSizeDict, xPyString_FromString("CPUSIZE"));
 
+        /* Create the EMULATION namespace ============================================================ */
+
+        PyObject* emulationDict = xPyDict_New();
+        initEmulationNamespace(emulationDict);
+        PyObject* idEmulationClass = xPyClass_New(nullptr, emulationDict, xPyString_FromString("EMULATION"));
+
+        /* Create the EXPLORATION namespace ========================================================== */
+
+        PyObject* explorationDict = xPyDict_New();
+        initExplorationNamespace(explorationDict);
+        PyObject* idExplorationClass = xPyClass_New(nullptr, explorationDict, xPyString_FromString("EXPLORATION"));
+
         /* Create the EXTEND namespace ================================================================ */
 
         PyObject* extendDict = xPyDict_New();
@@ -152,6 +164,12 @@ namespace triton {
         initSymbolicNamespace(symbolicDict);
         PyObject* idSymbolicClass = xPyClass_New(nullptr, symbolicDict, xPyString_FromString("SYMBOLIC"));
 
+        /* Create the TRACE namespace ================================================================ */
+
+        PyObject* traceDict = xPyDict_New();
+        initTraceNamespace(traceDict);
+        PyObject* idTraceClass = xPyClass_New(nullptr, traceDict, xPyString_FromString("TRACE"));
+
         /* Create the VERSION namespace ============================================================== */
 
         PyObject* versionDict = xPyDict_New();
@@ -168,6 +186,8 @@ namespace triton {
         PyModule_AddObject(triton::bindings::python::tritonModule, "CALLBACK",            idCallbackClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "CONDITION",           idConditionsClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "CPUSIZE",             idCpuSizeClass);
+        PyModule_AddObject(triton::bindings::python::tritonModule, "EMULATION",           idEmulationClass);
+        PyModule_AddObject(triton::bindings::python::tritonModule, "EXPLORATION",         idExplorationClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "EXTEND",              idExtendClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "MODE",                idModeClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "OPCODE",              idOpcodesClass);
@@ -178,6 +198,7 @@ namespace triton {
         PyModule_AddObject(triton::bindings::python::tritonModule, "SOLVER",              idSolverClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "SOLVER_STATE",        idSolverStateClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "SYMBOLIC",            idSymbolicClass);
+        PyModule_AddObject(triton::bindings::python::tritonModule, "TRACE",               idTraceClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "VERSION",             idVersionClass);
 
         return triton::bindings::python::tritonModule;
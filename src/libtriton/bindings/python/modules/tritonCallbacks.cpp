@@ -35,9 +35,13 @@ to wrap more generic concepts.
 - \ref py_BitsVector_page
 - \ref py_Immediate_page
 - \ref py_Instruction_page
+- \ref py_ListView_page
+- \ref py_MapView_page
 - \ref py_MemoryAccess_page
+- \ref py_Namespace_page
 - \ref py_PathConstraint_page
 - \ref py_Register_page
+- \ref py_SolverFuture_page
 - \ref py_SolverModel_page
 - \ref py_SymbolicExpression_page
 - \ref py_SymbolicVariable_page
@@ -52,6 +56,8 @@ to wrap more generic concepts.
 - \ref py_CALLBACK_page
 - \ref py_CONDITION_page
 - \ref py_CPUSIZE_page
+- \ref py_EMULATION_page
+- \ref py_EXPLORATION_page
 - \ref py_EXTEND_page
 - \ref py_MODE_page
 - \ref py_OPCODE_page
@@ -62,6 +68,7 @@ to wrap more generic concepts.
 - \ref py_SOLVER_page
 - \ref py_SOLVER_STATE_page
 - \ref py_SYMBOLIC_page
+- \ref py_TRACE_page
 - \ref py_VERSION_page
 
 */
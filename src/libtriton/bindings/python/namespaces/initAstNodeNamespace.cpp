@@ -26,12 +26,18 @@ The AST_NODE namespace contains all kinds of nodes.
 <hr>
 
 - **AST_NODE.ANY**
+- **AST_NODE.ARRAY**
 - **AST_NODE.ASSERT**
 - **AST_NODE.BSWAP**
 - **AST_NODE.BV**
 - **AST_NODE.BVADD**
 - **AST_NODE.BVAND**
 - **AST_NODE.BVASHR**
+- **AST_NODE.BVLANEADD**
+- **AST_NODE.BVLANEEQ**
+- **AST_NODE.BVLANESELECT**
+- **AST_NODE.BVLANESGT**
+- **AST_NODE.BVLANESUB**
 - **AST_NODE.BVLSHR**
 - **AST_NODE.BVMUL**
 - **AST_NODE.BVNAND**
@@ -39,6 +45,8 @@ The AST_NODE namespace contains all kinds of nodes.
 - **AST_NODE.BVNOR**
 - **AST_NODE.BVNOT**
 - **AST_NODE.BVOR**
+- **AST_NODE.BVPARITY**
+- **AST_NODE.BVPOPCOUNT**
 - **AST_NODE.BVROL**
 - **AST_NODE.BVROR**
 - **AST_NODE.BVSDIV**
@@ -74,6 +82,8 @@ The AST_NODE namespace contains all kinds of nodes.
 - **AST_NODE.LNOT**
 - **AST_NODE.LOR**
 - **AST_NODE.REFERENCE**
+- **AST_NODE.SELECT**
+- **AST_NODE.STORE**
 - **AST_NODE.STRING**
 - **AST_NODE.SX**
 - **AST_NODE.VARIABLE**
@@ -89,12 +99,18 @@ namespace triton {
 
       void initAstNodeNamespace(PyObject* astNodeDict) {
         xPyDict_SetItemString(astNodeDict, "ANY",               PyLong_FromUint32(triton::ast::ANY_NODE));
+        xPyDict_SetItemString(astNodeDict, "ARRAY",             PyLong_FromUint32(triton::ast::ARRAY_NODE));
         xPyDict_SetItemString(astNodeDict, "ASSERT",            PyLong_FromUint32(triton::ast::ASSERT_NODE));
         xPyDict_SetItemString(astNodeDict, "BSWAP",             PyLong_FromUint32(triton::ast::BSWAP_NODE));
         xPyDict_SetItemString(astNodeDict, "BV",                PyLong_FromUint32(triton::ast::BV_NODE));
         xPyDict_SetItemString(astNodeDict, "BVADD",             PyLong_FromUint32(triton::ast::BVADD_NODE));
         xPyDict_SetItemString(astNodeDict, "BVAND",             PyLong_FromUint32(triton::ast::BVAND_NODE));
         xPyDict_SetItemString(astNodeDict, "BVASHR",            PyLong_FromUint32(triton::ast::BVASHR_NODE));
+        xPyDict_SetItemString(astNodeDict, "BVLANEADD",         PyLong_FromUint32(triton::ast::BVLANEADD_NODE));
+        xPyDict_SetItemString(astNodeDict, "BVLANEEQ",          PyLong_FromUint32(triton::ast::BVLANEEQ_NODE));
+        xPyDict_SetItemString(astNodeDict, "BVLANESELECT",      PyLong_FromUint32(triton::ast::BVLANESELECT_NODE));
+        xPyDict_SetItemString(astNodeDict, "BVLANESGT",         PyLong_FromUint32(triton::ast::BVLANESGT_NODE));
+        xPyDict_SetItemString(astNodeDict, "BVLANESUB",         PyLong_FromUint32(triton::ast::BVLANESUB_NODE));
         xPyDict_SetItemString(astNodeDict, "BVLSHR",            PyLong_FromUint32(triton::ast::BVLSHR_NODE));
         xPyDict_SetItemString(astNodeDict, "BVMUL",             PyLong_FromUint32(triton::ast::BVMUL_NODE));
         xPyDict_SetItemString(astNodeDict, "BVNAND",            PyLong_FromUint32(triton::ast::BVNAND_NODE));
@@ -102,6 +118,8 @@ namespace triton {
         xPyDict_SetItemString(astNodeDict, "BVNOR",             PyLong_FromUint32(triton::ast::BVNOR_NODE));
         xPyDict_SetItemString(astNodeDict, "BVNOT",             PyLong_FromUint32(triton::ast::BVNOT_NODE));
         xPyDict_SetItemString(astNodeDict, "BVOR",              PyLong_FromUint32(triton::ast::BVOR_NODE));
+        xPyDict_SetItemString(astNodeDict, "BVPARITY",          PyLong_FromUint32(triton::ast::BVPARITY_NODE));
+        xPyDict_SetItemString(astNodeDict, "BVPOPCOUNT",        PyLong_FromUint32(triton::ast::BVPOPCOUNT_NODE));
         xPyDict_SetItemString(astNodeDict, "BVROL",             PyLong_FromUint32(triton::ast::BVROL_NODE));
         xPyDict_SetItemString(astNodeDict, "BVROR",             PyLong_FromUint32(triton::ast::BVROR_NODE));
         xPyDict_SetItemString(astNodeDict, "BVSDIV",            PyLong_FromUint32(triton::ast::BVSDIV_NODE));
@@ -137,6 +155,8 @@ namespace triton {
         xPyDict_SetItemString(astNodeDict, "LNOT",              PyLong_FromUint32(triton::ast::LNOT_NODE));
         xPyDict_SetItemString(astNodeDict, "LOR",               PyLong_FromUint32(triton::ast::LOR_NODE));
         xPyDict_SetItemString(astNodeDict, "REFERENCE",         PyLong_FromUint32(triton::ast::REFERENCE_NODE));
+        xPyDict_SetItemString(astNodeDict, "SELECT",            PyLong_FromUint32(triton::ast::SELECT_NODE));
+        xPyDict_SetItemString(astNodeDict, "STORE",             PyLong_FromUint32(triton::ast::STORE_NODE));
         xPyDict_SetItemString(astNodeDict, "STRING",            PyLong_FromUint32(triton::ast::STRING_NODE));
         xPyDict_SetItemString(astNodeDict, "SX",                PyLong_FromUint32(triton::ast::SX_NODE));
         xPyDict_SetItemString(astNodeDict, "VARIABLE",          PyLong_FromUint32(triton::ast::VARIABLE_NODE));
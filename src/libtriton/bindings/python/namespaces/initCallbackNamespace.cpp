@@ -31,6 +31,10 @@ The CALLBACK namespace contains all kinds of callbacks.
 \section CALLBACK_py_api Python API - Items of the CALLBACK namespace
 <hr>
 
+- **CALLBACK.GET_CONCRETE_MEMORY_AREA_VALUE**<br>
+The callback takes as arguments a \ref py_TritonContext_page, a base address and a size. Callbacks will be called once each time
+that the Triton library will need to LOAD a concrete memory area (e.g. `getConcreteMemoryAreaValue()`). The callback must return nothing.
+
 - **CALLBACK.GET_CONCRETE_MEMORY_VALUE**<br>
 The callback takes as arguments a \ref py_TritonContext_page and a \ref py_MemoryAccess_page. Callbacks will be called each time that the
 Triton library will need to LOAD a concrete memory value. The callback must return nothing.
@@ -39,6 +43,15 @@ Triton library will need to LOAD a concrete memory value. The callback must retu
 The callback takes as arguments a \ref py_TritonContext_page and a \ref py_Register_page. Callbacks will be called each time that the
 Triton library will need to GET a concrete register value. The callback must return nothing.
 
+- **CALLBACK.GET_UNDEFINED_MEMORY_PAGE**<br>
+The callback takes as arguments a \ref py_TritonContext_page, the address of a page and its size (4 KB). Callbacks will be called, before
+a LOAD of a concrete memory value or area, on each page of the LOAD whose bytes are all undefined. The callback may define the page (e.g.
+by fetching it from a debugger with `setConcreteMemoryAreaValue()`), it is then not reported again. The callback must return nothing.
+
+- **CALLBACK.SET_CONCRETE_MEMORY_AREA_VALUE**<br>
+The callback takes as arguments a \ref py_TritonContext_page, a base address and the bytes of the area. Callbacks will be called once
+each time that the Triton library will need to STORE a concrete memory area (e.g. `setConcreteMemoryAreaValue()`). The callback must return nothing.
+
 - **CALLBACK.SET_CONCRETE_MEMORY_VALUE**<br>
 The callback takes as arguments a \ref py_TritonContext_page, a \ref py_MemoryAccess_page and an integer. Callbacks will be called
 each time that the Triton library will need to STORE a concrete memory value. The callback must return nothing.
@@ -61,11 +74,14 @@ namespace triton {
     namespace python {
 
       void initCallbackNamespace(PyObject* callbackDict) {
-        xPyDict_SetItemString(callbackDict, "GET_CONCRETE_MEMORY_VALUE",   PyLong_FromUint32(triton::callbacks::GET_CONCRETE_MEMORY_VALUE));
-        xPyDict_SetItemString(callbackDict, "GET_CONCRETE_REGISTER_VALUE", PyLong_FromUint32(triton::callbacks::GET_CONCRETE_REGISTER_VALUE));
-        xPyDict_SetItemString(callbackDict, "SET_CONCRETE_MEMORY_VALUE",   PyLong_FromUint32(triton::callbacks::SET_CONCRETE_MEMORY_VALUE));
-        xPyDict_SetItemString(callbackDict, "SET_CONCRETE_REGISTER_VALUE", PyLong_FromUint32(triton::callbacks::SET_CONCRETE_REGISTER_VALUE));
-        xPyDict_SetItemString(callbackDict, "SYMBOLIC_SIMPLIFICATION",     PyLong_FromUint32(triton::callbacks::SYMBOLIC_SIMPLIFICATION));
+        xPyDict_SetItemString(callbackDict, "GET_CONCRETE_MEMORY_AREA_VALUE", PyLong_FromUint32(triton::callbacks::GET_CONCRETE_MEMORY_AREA_VALUE));
+        xPyDict_SetItemString(callbackDict, "GET_CONCRETE_MEMORY_VALUE",      PyLong_FromUint32(triton::callbacks::GET_CONCRETE_MEMORY_VALUE));
+        xPyDict_SetItemString(callbackDict, "GET_CONCRETE_REGISTER_VALUE",    PyLong_FromUint32(triton::callbacks::GET_CONCRETE_REGISTER_VALUE));
+        xPyDict_SetItemString(callbackDict, "GET_UNDEFINED_MEMORY_PAGE",      PyLong_FromUint32(triton::callbacks::GET_UNDEFINED_MEMORY_PAGE));
+        xPyDict_SetItemString(callbackDict, "SET_CONCRETE_MEMORY_AREA_VALUE", PyLong_FromUint32(triton::callbacks::SET_CONCRETE_MEMORY_AREA_VALUE));
+        xPyDict_SetItemString(callbackDict, "SET_CONCRETE_MEMORY_VALUE",      PyLong_FromUint32(triton::callbacks::SET_CONCRETE_MEMORY_VALUE));
+        xPyDict_SetItemString(callbackDict, "SET_CONCRETE_REGISTER_VALUE",    PyLong_FromUint32(triton::callbacks::SET_CONCRETE_REGISTER_VALUE));
+        xPyDict_SetItemString(callbackDict, "SYMBOLIC_SIMPLIFICATION",        PyLong_FromUint32(triton::callbacks::SYMBOLIC_SIMPLIFICATION));
       }
 
     }; /* python namespace */
@@ -0,0 +1,75 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <triton/archEnums.hpp>
+#include <triton/pythonBindings.hpp>
+#include <triton/pythonUtils.hpp>
+#include <triton/pythonXFunctions.hpp>
+
+
+
+/*! \page py_EMULATION_page EMULATION
+    \brief [**python api**] All information about the EMULATION Python namespace.
+
+\tableofcontents
+
+\section EMULATION_py_description Description
+<hr>
+
+The EMULATION namespace contains all reasons an emulation stops (see `TritonContext.emulate()`).
+
+\section EMULATION_py_api Python API - Items of the EMULATION namespace
+<hr>
+
+- **EMULATION.ADDRESS**<br>
+The program counter reached an address of `stops`.
+
+- **EMULATION.COUNT**<br>
+`maxInstructions` instructions are executed.
+
+- **EMULATION.EXIT**<br>
+A syscall ended the program, the exit status is the `status` of the result.
+
+- **EMULATION.HOOK**<br>
+A hook returned `False`.
+
+- **EMULATION.SYMBOLIC_PC**<br>
+A control flow instruction left a symbolized program counter.
+
+- **EMULATION.SYSCALL**<br>
+A syscall has no handler. The emulation stops after its instruction, with the number and the arguments of the syscall in their registers.
+
+- **EMULATION.UNDEFINED**<br>
+The program counter reached undefined code.
+
+- **EMULATION.UNSUPPORTED**<br>
+The instruction at the program counter is not supported.
+
+*/
+
+
+
+namespace triton {
+  namespace bindings {
+    namespace python {
+
+      void initEmulationNamespace(PyObject* emulationDict) {
+        PyDict_Clear(emulationDict);
+
+        xPyDict_SetItemString(emulationDict, "ADDRESS",     PyLong_FromUint32(triton::arch::EMULATION_ADDRESS));
+        xPyDict_SetItemString(emulationDict, "COUNT",       PyLong_FromUint32(triton::arch::EMULATION_COUNT));
+        xPyDict_SetItemString(emulationDict, "EXIT",        PyLong_FromUint32(triton::arch::EMULATION_EXIT));
+        xPyDict_SetItemString(emulationDict, "HOOK",        PyLong_FromUint32(triton::arch::EMULATION_HOOK));
+        xPyDict_SetItemString(emulationDict, "SYMBOLIC_PC", PyLong_FromUint32(triton::arch::EMULATION_SYMBOLIC_PC));
+        xPyDict_SetItemString(emulationDict, "SYSCALL",     PyLong_FromUint32(triton::arch::EMULATION_SYSCALL));
+        xPyDict_SetItemString(emulationDict, "UNDEFINED",   PyLong_FromUint32(triton::arch::EMULATION_UNDEFINED));
+        xPyDict_SetItemString(emulationDict, "UNSUPPORTED", PyLong_FromUint32(triton::arch::EMULATION_UNSUPPORTED));
+      }
+
+    }; /* python namespace */
+  }; /* bindings namespace */
+}; /* triton namespace */
@@ -0,0 +1,55 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <triton/explorationEnums.hpp>
+#include <triton/pythonBindings.hpp>
+#include <triton/pythonUtils.hpp>
+#include <triton/pythonXFunctions.hpp>
+
+
+
+/*! \page py_EXPLORATION_page EXPLORATION
+    \brief [**python api**] All information about the EXPLORATION Python namespace.
+
+\tableofcontents
+
+\section EXPLORATION_py_description Description
+<hr>
+
+The EXPLORATION namespace contains all kinds of strategies of `TritonContext.explore()`.
+
+\section EXPLORATION_py_api Python API - Items of the EXPLORATION namespace
+<hr>
+
+- **EXPLORATION.COVERAGE_GUIDED**<br>
+The seeds covering the most new edges first, the branches covered by previous runs are not flipped.
+
+- **EXPLORATION.DEPTH_FIRST**<br>
+The last seed generated first.
+
+- **EXPLORATION.GENERATIONAL**<br>
+The seeds covering the most new edges first, each one flipping the branches after the one of its parent.
+
+*/
+
+
+
+namespace triton {
+  namespace bindings {
+    namespace python {
+
+      void initExplorationNamespace(PyObject* explorationDict) {
+        PyDict_Clear(explorationDict);
+
+        xPyDict_SetItemString(explorationDict, "COVERAGE_GUIDED", PyLong_FromUint32(triton::engines::exploration::COVERAGE_GUIDED));
+        xPyDict_SetItemString(explorationDict, "DEPTH_FIRST",     PyLong_FromUint32(triton::engines::exploration::DEPTH_FIRST));
+        xPyDict_SetItemString(explorationDict, "GENERATIONAL",    PyLong_FromUint32(triton::engines::exploration::GENERATIONAL));
+      }
+
+    }; /* python namespace */
+  }; /* bindings namespace */
+}; /* triton namespace */
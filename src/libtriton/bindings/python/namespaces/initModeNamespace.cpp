@@ -33,28 +33,157 @@ The MODE namespace contains all kinds of modes.
 
 - **MODE.ALIGNED_MEMORY**<br>
 Enabled, Triton will keep a map of aligned memory to reduce the symbolic memory explosion of `LOAD` and `STORE` accesses.
+A load of a stored range returns the expression of the store and a load inside it one extract of it. A store into a stored
+range keeps the bytes it does not overwrite, so that a load over several stores is the concatenation of one node per store,
+only the bytes outside the stores being read one by one.
+
+- **MODE.AST_ABSTRACT_DOMAIN**<br>
+Enabled, symbolized nodes track the bits known to be zero or one and the unsigned bounds of their values (see `getDomain()`).
+Path constraints which always hold are not recorded and `isSat()` answers constraints decided by their domain without
+calling the solver. With `CONSTANT_FOLDING`, symbolized nodes whose domain holds a single value are folded too.
+
+- **MODE.AST_DEPTH_LIMIT**<br>
+Enabled, a new symbolized expression whose AST is deeper than the depth limit gets the concrete value of its AST or a fresh symbolic
+variable tied to it (see `setSymbolicDepthLimit()`). This bounds the cost of the next instructions reading it and the formulas sent to
+the solver. Unlike the maximum depth of the symbolic budget, deeper branches are still recorded as path constraints.
+
+- **MODE.AST_EQUALITY_SATURATION**<br>
+Enabled, constraints given to `getModel()`, `getModels()` and `isSat()` are first simplified by equality saturation
+(see `AstRewriter`). This may shrink obfuscated expressions (e.g. MBA) before they reach the solver.
+
+- **MODE.AST_HASH_CONSING**<br>
+Enabled, building a node structurally identical (same kind, size, payload and children) to a living one returns the
+existing node instead of allocating a new one. As nodes are shared, modifying a node (e.g. `setChild()`) affects all its users.
+
+- **MODE.AST_LAZY_HASH**<br>
+Enabled, the hash of a node is computed the first time it is requested (e.g. `getHash()`, `equalTo()`) instead
+of when the node is built or updated. This reduces the cost of building nodes which are never compared.
+
+- **MODE.AST_NARY**<br>
+Enabled, the `bvadd`, `bvand`, `bvor`, `bvxor`, `land` and `lor` nodes take any number of operands. Building one of them
+over a node of the same operator which is not used by another node merges their operands, so that a sum or a xor reduction
+of unrolled code is one node instead of a chain as deep as its operands. The constant operands are merged into one, placed
+last, and the others are sorted by hash: the same operands in any order give the same node. Equal operands of `bvand`,
+`bvor`, `land` and `lor` are kept once, and pairs of equal operands of `bvxor` cancel each other. The solvers get a native
+n-ary term or a balanced tree of binary ones.
 
 - **MODE.AST_OPTIMIZATIONS**<br>
 Enabled, Triton will reduces the depth of the trees using classical arithmetic optimisations.
 
+- **MODE.AST_TRAVERSAL_CACHE**<br>
+Enabled, the topological sorts of nodes used by unrolling, slicing and solver conversions are cached by the AST context
+and reused until the children of a node or the parent links of the DAG change.
+
+- **MODE.BULK_STRING_OPERATIONS**<br>
+Enabled, an x86 `rep movs` or `rep stos` whose counter, indexes and direction flag are not symbolized executes all its
+iterations at once: the concrete values are moved as `memmove` does and the expressions of the memory cells are copied
+to the destination without building new ones. The counter is set to zero and the program counter to the next instruction.
+A `repe` or `repne` `cmps` or `scas` skips its leading iterations which compare concrete memory cells without stopping the
+repetition, and executes the next iteration as usual. A copy overlapping its source against its direction, or an area
+wrapping around the address space, is still executed one iteration at a time.
+
 - **MODE.CONCRETIZE_UNDEFINED_REGISTERS**<br>
 Enabled, Triton will concretize every register tagged as undefined (see #750).
 
 - **MODE.CONSTANT_FOLDING**<br>
 Enabled, Triton will perform a constant folding optimization of sub ASTs which do not contain symbolic variables.
 
+- **MODE.DEAD_FLAGS_ELIMINATION**<br>
+Enabled, while `processing()` runs over a list of instructions or `processBlock()` runs over a block, the expression of
+a flag is only recorded if the flag is read before being written again: by the semantics of a next instruction of the
+block, through the API, or because it is still live at the exit of the block. The expressions of dead flags are never
+recorded. This applies to the flags of all architectures (e.g. `n`, `z`, `c` and `v` of ARM32 and AArch64). A flag
+recorded after its instruction is not in the symbolic expressions of the instruction, and the comment of its expression
+only holds the address of the instruction. The mode is not used while the symbolic engine is disabled or with `ONLY_ON_TAINTED`.
+
+- **MODE.INTERNED_COMMENTS**<br>
+Enabled, the comment of an expression built by an instruction (e.g. `ADD operation - 0x400000: add rax, rbx`) is formatted
+once per address and type of instruction, and shared by the expressions of its next executions. On long traces, this avoids
+formatting the instruction and allocating a string for every expression. The bytes of a store share their comment whether
+this mode is enabled or not.
+
+- **MODE.LAZY_FLAGS**<br>
+Enabled, the expressions of the `af`, `cf`, `of`, `pf`, `sf` and `zf` flags written by the x86 arithmetic and logical
+instructions are built only when the flags are read: by the semantics of a next instruction, or through the API
+(e.g. `getRegisterAst()`, `getSymbolicRegister()`, `getConcreteRegisterValue()`). A flag overwritten before being read
+never builds its AST. A deferred flag is neither in the symbolic expressions nor in the written registers of its
+instruction, and the comment of its expression only holds the address of the instruction. The mode is not used while
+the symbolic engine is disabled or with `ONLY_ON_TAINTED`.
+
+- **MODE.LOOP_INDUCTION_VARIABLES**<br>
+Enabled, while `processing()` runs over a list of instructions or `processBlock()` runs over a block, a register the
+block steps by the same constant (e.g. `inc rcx`, `add rsi, 4`) at two executions in a row is an induction variable
+of a loop: from the next execution, its expression at the exit of the block is its expression before the loop plus the
+sum of the steps, instead of a chain growing with the iterations. With `PC_LOOP_SUMMARIZATION`, the iterations of a
+branch comparing an induction variable to a loop invariant (e.g. `cmp rcx, rdx; jb`) are summarized in closed form: the
+comparison of the greatest (or the least) value of the variable, and the constraint that the variable does not wrap
+around between the first and the last iteration, instead of the conjunction of all iterations. The x86 carry flag of
+`cmp` and `sub` is then built as the unsigned comparison it is. The other branches are summarized as before.
+
+- **MODE.MEMORY_ARRAY**<br>
+Enabled, the memory is also modeled as an SMT array of bytes indexed by addresses. A load or a store whose address is
+symbolized is a `select` or a `store` of the array instead of an access at its concrete address, if the cells its
+address may reach are at most 1024 (see `setPointerPolicyLimits()`): the bounds of its address are the ones of its domain, thus `AST_ABSTRACT_DOMAIN`
+must be enabled too. The cells reached are stored into the array before the access if their expression or their
+concrete value changed since they were last stored. The accesses at a concrete address are unchanged. A store at a
+symbolic address writes the cells of its concrete address as selects of the array, the other cells it may reach are
+only read as such by the next accesses at a symbolic address. The accesses whose address may reach more cells follow
+the pointer policy of their instruction (see `setPointerPolicy()`).
+
+- **MODE.NO_COMMENTS**<br>
+Enabled, the symbolic expressions built by the engine have no comment (see `SymbolicExpression.getComment()`). Comments set
+later with `SymbolicExpression.setComment()` are kept.
+
 - **MODE.ONLY_ON_SYMBOLIZED**<br>
 Enabled, Triton will perform symbolic execution only on symbolized expressions.
 
 - **MODE.ONLY_ON_TAINTED**<br>
 Enabled, Triton will perform symbolic execution only on tainted instructions.
 
+- **MODE.PC_DEDUPLICATION**<br>
+Enabled, a branch whose source, destination and taken predicate (by structural hash) are those of a path constraint
+already recorded only increments the count of that constraint (see `PathConstraint.getCount()`), it adds nothing to
+the path predicate.
+
+- **MODE.PC_LOOP_SUMMARIZATION**<br>
+Enabled, the consecutive iterations of a conditional branch taken to the same destination, e.g. the header of a tight
+loop, are summarized into one path constraint whose taken predicate is the conjunction of theirs and whose branch not
+taken leaves the loop at one of them. The most recent iterations (see `setFlippableIterations()`) stay apart and can
+be flipped as before, and any summarized one can be flipped with `getPredicateToFlipIteration()`.
+
 - **MODE.PC_TRACKING_SYMBOLIC**<br>
 Enabled, Triton will track path constraints only if they are symbolized. This mode is enabled by default.
 
+- **MODE.PRUNE_DEAD_EXPRESSIONS**<br>
+Enabled, when a register or a flag is written, the AST of its previous definition is replaced by its concrete
+value if nothing read it. This releases the ASTs of dead definitions (e.g. flags written by almost every
+instruction) as soon as they are overwritten.
+
+- **MODE.SEMANTICS_CACHE**<br>
+Enabled, the expressions built by the semantics of an x86 instruction (moves, arithmetic and logical operations,
+comparisons, `lea`, ...) are recorded the first time its address is executed, and rebuilt over the ASTs of its new
+operands the next times, without running its semantics again. The cache is only used while the symbolic engine is
+enabled, the taint engine is disabled and nothing is tainted, and none of `AST_ABSTRACT_DOMAIN`, `AST_HASH_CONSING`,
+`AST_OPTIMIZATIONS`, `CONCRETIZE_UNDEFINED_REGISTERS`, `CONSTANT_FOLDING`, `DEAD_FLAGS_ELIMINATION`, `LAZY_FLAGS` and
+`SYMBOLIZE_INDEX_ROTATION` is enabled.
+
 - **MODE.SYMBOLIZE_INDEX_ROTATION**<br>
 Enabled, Triton will symbolize the index of rotation for `bvror` and `bvrol` nodes. This mode increases the complexity of solving.
 
+- **MODE.TAINT_BIT_PRECISE**<br>
+Enabled, the taint of the registers of 64 bits or less is tracked bit by bit: tainting or untainting a
+sub-register only changes its bits, the moves and extensions copy the taint of the bits they read, and the x86
+`and`, `or`, shifts and rotations only taint the bits of the result the tainted bits reach (a bit cleared by an
+untainted `and` operand, or set by an untainted `or` operand, is untainted). The other operations taint the
+whole destination if one of its bits or of the source is tainted. Combined with `ONLY_ON_TAINTED`, the
+instructions whose tainted bits do not reach the destination are not built.
+
+- **MODE.TAINT_SUMMARIES**<br>
+Enabled and if the symbolic engine is disabled, the x86 instructions with a taint summary (moves, arithmetic
+and logical operations, comparisons, `lea`, `push` and `pop`) only spread the taint from their operands,
+without building their semantics. Neither the concrete state nor the implicit and explicit semantics of these
+instructions are updated, they are expected to be synchronized by the caller, as a tracer does.
+
 - **MODE.TAINT_THROUGH_POINTERS**<br>
 Enabled, the taint is spread if an index pointer is already tainted (see #725).
 */
@@ -67,13 +196,33 @@ namespace triton {
 
       void initModeNamespace(PyObject* modeDict) {
         xPyDict_SetItemString(modeDict, "ALIGNED_MEMORY",                 PyLong_FromUint32(triton::modes::ALIGNED_MEMORY));
+        xPyDict_SetItemString(modeDict, "AST_ABSTRACT_DOMAIN",            PyLong_FromUint32(triton::modes::AST_ABSTRACT_DOMAIN));
+        xPyDict_SetItemString(modeDict, "AST_DEPTH_LIMIT",                PyLong_FromUint32(triton::modes::AST_DEPTH_LIMIT));
+        xPyDict_SetItemString(modeDict, "AST_EQUALITY_SATURATION",        PyLong_FromUint32(triton::modes::AST_EQUALITY_SATURATION));
+        xPyDict_SetItemString(modeDict, "AST_HASH_CONSING",               PyLong_FromUint32(triton::modes::AST_HASH_CONSING));
+        xPyDict_SetItemString(modeDict, "AST_LAZY_HASH",                  PyLong_FromUint32(triton::modes::AST_LAZY_HASH));
+        xPyDict_SetItemString(modeDict, "AST_NARY",                       PyLong_FromUint32(triton::modes::AST_NARY));
         xPyDict_SetItemString(modeDict, "AST_OPTIMIZATIONS",              PyLong_FromUint32(triton::modes::AST_OPTIMIZATIONS));
+        xPyDict_SetItemString(modeDict, "AST_TRAVERSAL_CACHE",            PyLong_FromUint32(triton::modes::AST_TRAVERSAL_CACHE));
+        xPyDict_SetItemString(modeDict, "BULK_STRING_OPERATIONS",         PyLong_FromUint32(triton::modes::BULK_STRING_OPERATIONS));
         xPyDict_SetItemString(modeDict, "CONCRETIZE_UNDEFINED_REGISTERS", PyLong_FromUint32(triton::modes::CONCRETIZE_UNDEFINED_REGISTERS));
         xPyDict_SetItemString(modeDict, "CONSTANT_FOLDING",               PyLong_FromUint32(triton::modes::CONSTANT_FOLDING));
+        xPyDict_SetItemString(modeDict, "DEAD_FLAGS_ELIMINATION",         PyLong_FromUint32(triton::modes::DEAD_FLAGS_ELIMINATION));
+        xPyDict_SetItemString(modeDict, "INTERNED_COMMENTS",              PyLong_FromUint32(triton::modes::INTERNED_COMMENTS));
+        xPyDict_SetItemString(modeDict, "LAZY_FLAGS",                     PyLong_FromUint32(triton::modes::LAZY_FLAGS));
+        xPyDict_SetItemString(modeDict, "LOOP_INDUCTION_VARIABLES",       PyLong_FromUint32(triton::modes::LOOP_INDUCTION_VARIABLES));
+        xPyDict_SetItemString(modeDict, "MEMORY_ARRAY",                   PyLong_FromUint32(triton::modes::MEMORY_ARRAY));
+        xPyDict_SetItemString(modeDict, "NO_COMMENTS",                    PyLong_FromUint32(triton::modes::NO_COMMENTS));
         xPyDict_SetItemString(modeDict, "ONLY_ON_SYMBOLIZED",             PyLong_FromUint32(triton::modes::ONLY_ON_SYMBOLIZED));
         xPyDict_SetItemString(modeDict, "ONLY_ON_TAINTED",                PyLong_FromUint32(triton::modes::ONLY_ON_TAINTED));
+        xPyDict_SetItemString(modeDict, "PC_DEDUPLICATION",               PyLong_FromUint32(triton::modes::PC_DEDUPLICATION));
+        xPyDict_SetItemString(modeDict, "PC_LOOP_SUMMARIZATION",          PyLong_FromUint32(triton::modes::PC_LOOP_SUMMARIZATION));
         xPyDict_SetItemString(modeDict, "PC_TRACKING_SYMBOLIC",           PyLong_FromUint32(triton::modes::PC_TRACKING_SYMBOLIC));
+        xPyDict_SetItemString(modeDict, "PRUNE_DEAD_EXPRESSIONS",         PyLong_FromUint32(triton::modes::PRUNE_DEAD_EXPRESSIONS));
+        xPyDict_SetItemString(modeDict, "SEMANTICS_CACHE",                PyLong_FromUint32(triton::modes::SEMANTICS_CACHE));
         xPyDict_SetItemString(modeDict, "SYMBOLIZE_INDEX_ROTATION",       PyLong_FromUint32(triton::modes::SYMBOLIZE_INDEX_ROTATION));
+        xPyDict_SetItemString(modeDict, "TAINT_BIT_PRECISE",              PyLong_FromUint32(triton::modes::TAINT_BIT_PRECISE));
+        xPyDict_SetItemString(modeDict, "TAINT_SUMMARIES",                PyLong_FromUint32(triton::modes::TAINT_SUMMARIES));
         xPyDict_SetItemString(modeDict, "TAINT_THROUGH_POINTERS",         PyLong_FromUint32(triton::modes::TAINT_THROUGH_POINTERS));
       }
 
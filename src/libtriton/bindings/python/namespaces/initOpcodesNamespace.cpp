@@ -6,6 +6,7 @@
 */
 
 #include <triton/pythonBindings.hpp>
+#include <triton/pythonObjects.hpp>
 #include <triton/pythonUtils.hpp>
 #include <triton/pythonXFunctions.hpp>
 #include <triton/aarch64Specifications.hpp>
@@ -2186,10 +2187,8 @@ namespace triton {
   namespace bindings {
     namespace python {
 
-      void initOpcodesNamespace(PyObject* opcodesDict) {
-        PyDict_Clear(opcodesDict);
-
-        PyObject* x86OpcodesDict = xPyDict_New();
+      /* Sets the X86 opcodes, on first access */
+      static void initX86OpcodesNamespace(PyObject* x86OpcodesDict) {
 
         xPyDict_SetItemString(x86OpcodesDict, "INVALID", PyLong_FromUint32(triton::arch::x86::ID_INS_INVALID));
         xPyDict_SetItemString(x86OpcodesDict, "AAA", PyLong_FromUint32(triton::arch::x86::ID_INS_AAA));
@@ -3487,10 +3486,11 @@ namespace triton {
         xPyDict_SetItemString(x86OpcodesDict, "XSTORE", PyLong_FromUint32(triton::arch::x86::ID_INS_XSTORE));
         xPyDict_SetItemString(x86OpcodesDict, "XTEST", PyLong_FromUint32(triton::arch::x86::ID_INS_XTEST));
 
-        PyObject* x86OpcodesDictClass = xPyClass_New(nullptr, x86OpcodesDict, xPyString_FromString("X86"));
-        xPyDict_SetItemString(opcodesDict, "X86", x86OpcodesDictClass);
+      }
 
-        PyObject* Aarch64OpcodesDict = xPyDict_New();
+
+      /* Sets the AArch64 opcodes, on first access */
+      static void initAArch64OpcodesNamespace(PyObject* Aarch64OpcodesDict) {
 
         xPyDict_SetItemString(Aarch64OpcodesDict, "ABS", PyLong_FromUint32(triton::arch::arm::aarch64::ID_INS_ABS));
         xPyDict_SetItemString(Aarch64OpcodesDict, "ADC", PyLong_FromUint32(triton::arch::arm::aarch64::ID_INS_ADC));
@@ -3909,10 +3909,11 @@ namespace triton {
         xPyDict_SetItemString(Aarch64OpcodesDict, "ZIP1", PyLong_FromUint32(triton::arch::arm::aarch64::ID_INS_ZIP1));
         xPyDict_SetItemString(Aarch64OpcodesDict, "ZIP2", PyLong_FromUint32(triton::arch::arm::aarch64::ID_INS_ZIP2));
 
-        PyObject* Aarch64OpcodesDictClass = xPyClass_New(nullptr, Aarch64OpcodesDict, xPyString_FromString("AARCH64"));
-        xPyDict_SetItemString(opcodesDict, "AARCH64", Aarch64OpcodesDictClass);
+      }
+
 
-        PyObject* arm32OpcodesDict = xPyDict_New();
+      /* Sets the ARM32 opcodes, on first access */
+      static void initArm32OpcodesNamespace(PyObject* arm32OpcodesDict) {
 
         xPyDict_SetItemString(arm32OpcodesDict, "ADC", PyLong_FromUint32(triton::arch::arm::arm32::ID_INS_ADC));
         xPyDict_SetItemString(arm32OpcodesDict, "ADC", PyLong_FromUint32(triton::arch::arm::arm32::ID_INS_ADC));
@@ -4348,8 +4349,15 @@ namespace triton {
         xPyDict_SetItemString(arm32OpcodesDict, "VPUSH", PyLong_FromUint32(triton::arch::arm::arm32::ID_INS_VPUSH));
         xPyDict_SetItemString(arm32OpcodesDict, "VPOP", PyLong_FromUint32(triton::arch::arm::arm32::ID_INS_VPOP));
 
-        PyObject* arm32OpcodesDictClass = xPyClass_New(nullptr, arm32OpcodesDict, xPyString_FromString("ARM32"));
-        xPyDict_SetItemString(opcodesDict, "ARM32", arm32OpcodesDictClass);
+      }
+
+
+      void initOpcodesNamespace(PyObject* opcodesDict) {
+        PyDict_Clear(opcodesDict);
+
+        xPyDict_SetItemString(opcodesDict, "AARCH64", PyNamespace("AARCH64", initAArch64OpcodesNamespace));
+        xPyDict_SetItemString(opcodesDict, "ARM32", PyNamespace("ARM32", initArm32OpcodesNamespace));
+        xPyDict_SetItemString(opcodesDict, "X86", PyNamespace("X86", initX86OpcodesNamespace));
       }
 
     }; /* python namespace */
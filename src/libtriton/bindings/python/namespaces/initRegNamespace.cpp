@@ -75,61 +75,54 @@ namespace triton {
   namespace bindings {
     namespace python {
 
-      void initRegNamespace(PyObject* registersDict) {
-        PyDict_Clear(registersDict);
-
-        // Create X86 REG namespace
-
-        PyObject* x86RegistersDict = xPyDict_New();
-
+      /* Sets the X86 registers, on first access */
+      static void initX86RegNamespace(PyObject* x86RegistersDict) {
         #define REG_SPEC(UPPER_NAME, _1, _2, _3, _4, _5, _6, _7, X86_AVAIL) \
           if (X86_AVAIL) \
             xPyDict_SetItemString(x86RegistersDict, #UPPER_NAME, PyLong_FromUint32(triton::arch::ID_REG_X86_##UPPER_NAME));
         // Use REG not available in capstone as normal register
         #define REG_SPEC_NO_CAPSTONE REG_SPEC
         #include "triton/x86.spec"
+      }
 
-        PyObject* x86RegistersDictClass = xPyClass_New(nullptr, x86RegistersDict, xPyString_FromString("X86"));
-        xPyDict_SetItemString(registersDict, "X86", x86RegistersDictClass);
-
-        // Create X86_64 REG namespace
-
-        PyObject* x8664RegistersDict = xPyDict_New();
 
+      /* Sets the X86_64 registers, on first access */
+      static void initX8664RegNamespace(PyObject* x8664RegistersDict) {
         #define REG_SPEC(UPPER_NAME, _1, _2, _3, _4, _5, _6, _7, _8) \
           xPyDict_SetItemString(x8664RegistersDict, #UPPER_NAME, PyLong_FromUint32(triton::arch::ID_REG_X86_##UPPER_NAME));
         // Use REG not available in capstone as normal register
         #define REG_SPEC_NO_CAPSTONE REG_SPEC
         #include "triton/x86.spec"
+      }
 
-        PyObject* x8664RegistersDictClass = xPyClass_New(nullptr, x8664RegistersDict, xPyString_FromString("X86_64"));
-        xPyDict_SetItemString(registersDict, "X86_64", x8664RegistersDictClass);
-
-        // Create AArch64 REG namespace
-
-        PyObject* aarch64RegistersDict = xPyDict_New();
 
+      /* Sets the AArch64 registers, on first access */
+      static void initAArch64RegNamespace(PyObject* aarch64RegistersDict) {
         #define REG_SPEC(UPPER_NAME, _1, _2, _3, _4, _5) \
           xPyDict_SetItemString(aarch64RegistersDict, #UPPER_NAME, PyLong_FromUint32(triton::arch::ID_REG_AARCH64_##UPPER_NAME));
         // Use REG not available in capstone as normal register
         #define REG_SPEC_NO_CAPSTONE REG_SPEC
         #include "triton/aarch64.spec"
+      }
 
-        PyObject* aarch64RegistersDictClass = xPyClass_New(nullptr, aarch64RegistersDict, xPyString_FromString("AARCH64"));
-        xPyDict_SetItemString(registersDict, "AARCH64", aarch64RegistersDictClass);
-
-        // Create ARM32 REG namespace
-
-        PyObject* arm32RegistersDict = xPyDict_New();
 
+      /* Sets the ARM32 registers, on first access */
+      static void initArm32RegNamespace(PyObject* arm32RegistersDict) {
         #define REG_SPEC(UPPER_NAME, _1, _2, _3, _4, _5) \
           xPyDict_SetItemString(arm32RegistersDict, #UPPER_NAME, PyLong_FromUint32(triton::arch::ID_REG_ARM32_##UPPER_NAME));
         // Use REG not available in capstone as normal register
         #define REG_SPEC_NO_CAPSTONE REG_SPEC
         #include "triton/arm32.spec"
+      }
+
+
+      void initRegNamespace(PyObject* registersDict) {
+        PyDict_Clear(registersDict);
 
-        PyObject* arm32RegistersDictClass = xPyClass_New(nullptr, arm32RegistersDict, xPyString_FromString("ARM32"));
-        xPyDict_SetItemString(registersDict, "ARM32", arm32RegistersDictClass);
+        xPyDict_SetItemString(registersDict, "AARCH64", PyNamespace("AARCH64", initAArch64RegNamespace));
+        xPyDict_SetItemString(registersDict, "ARM32", PyNamespace("ARM32", initArm32RegNamespace));
+        xPyDict_SetItemString(registersDict, "X86", PyNamespace("X86", initX86RegNamespace));
+        xPyDict_SetItemString(registersDict, "X86_64", PyNamespace("X86_64", initX8664RegNamespace));
       }
 
     }; /* python namespace */
@@ -27,6 +27,21 @@ The SOLVER namespace contains all kinds of solver status.
 
 - **SOLVER.Z3**
 - **SOLVER.BITWUZLA**
+- **SOLVER.PORTFOLIO**<br>
+Races all the solvers above on every query, each on its own thread. The first answer is returned and the other solvers are interrupted
+(see `setSolverPortfolio()` and `getSolverPortfolioWins()`).
+- **SOLVER.LOCAL_SEARCH**<br>
+Searches a model by mutating the values of the variables, from their concrete values, and evaluating the query. Checksums and comparisons
+of inputs are solved in a few milliseconds. The queries it does not solve within its budget, the UNSAT ones included, are handed off to
+an SMT solver (see `setSolverLocalSearchBudget()` and `setSolverLocalSearchFallback()`). It may be a solver of the portfolio.
+- **SOLVER.EXTERNAL**<br>
+Sends the queries in SMT-LIB2 to a solver Triton is not linked with, e.g. cvc5 or Yices, run as a pool of subprocesses reused from one
+query to the next (see `setSolverExternalCommand()` and `setSolverExternalPoolSize()`). The process of a query exceeding its timeout or
+its memory limit is killed, a crash of the solver does not take Triton down.
+- **SOLVER.REMOTE**<br>
+Sends the queries in the binary AST format to solver servers, e.g. the `solver_server` example run on the machines of a cluster (see
+`setSolverRemoteEndpoints()`). A query always goes to the same server, so that the identical queries of several tracers are solved
+once and answered by the cache of this server.
 
 */
 
@@ -45,6 +60,12 @@ namespace triton {
         #if defined(TRITON_BITWUZLA_INTERFACE)
         xPyDict_SetItemString(solverDict, "BITWUZLA", PyLong_FromUint32(triton::engines::solver::SOLVER_BITWUZLA));
         #endif
+        #if defined(TRITON_Z3_INTERFACE) || defined(TRITON_BITWUZLA_INTERFACE)
+        xPyDict_SetItemString(solverDict, "PORTFOLIO", PyLong_FromUint32(triton::engines::solver::SOLVER_PORTFOLIO));
+        #endif
+        xPyDict_SetItemString(solverDict, "LOCAL_SEARCH", PyLong_FromUint32(triton::engines::solver::SOLVER_LOCAL_SEARCH));
+        xPyDict_SetItemString(solverDict, "EXTERNAL", PyLong_FromUint32(triton::engines::solver::SOLVER_EXTERNAL));
+        xPyDict_SetItemString(solverDict, "REMOTE", PyLong_FromUint32(triton::engines::solver::SOLVER_REMOTE));
       }
 
     }; /* python namespace */
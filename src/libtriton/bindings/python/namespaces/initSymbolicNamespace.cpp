@@ -20,15 +20,26 @@
 \section SYMBOLIC_py_description Description
 <hr>
 
-The SYMBOLIC namespace contains all types of symbolic expressions and variables.
+The SYMBOLIC namespace contains all types of symbolic expressions and variables, the policies of the symbolic budget, the policies
+of the ASTs deeper than the depth limit (see `setSymbolicDepthLimit()`) and the policies of the dereferences of symbolic addresses
+(see `setPointerPolicy()`).
 
 \section SYMBOLIC_py_api Python API - Items of the SYMBOLIC namespace
 <hr>
 
+- **SYMBOLIC.CONCRETIZE_DEEPEST_EXPRESSIONS**
+- **SYMBOLIC.CONCRETIZE_DEEP_EXPRESSION**
+- **SYMBOLIC.CONCRETIZE_OLDEST_MEMORY**
+- **SYMBOLIC.CONCRETIZE_POINTER**
+- **SYMBOLIC.CONSTRAIN_POINTER**
+- **SYMBOLIC.FORK_POINTER**
 - **SYMBOLIC.MEMORY_EXPRESSION**
 - **SYMBOLIC.MEMORY_VARIABLE**
 - **SYMBOLIC.REGISTER_EXPRESSION**
+- **SYMBOLIC.REFUSE_NEW_SYMBOLS**
 - **SYMBOLIC.REGISTER_VARIABLE**
+- **SYMBOLIC.SYMBOLIC_POINTER**
+- **SYMBOLIC.SYMBOLIZE_DEEP_EXPRESSION**
 - **SYMBOLIC.UNDEFINED_VARIABLE**
 - **SYMBOLIC.VOLATILE_EXPRESSION**
 
@@ -41,10 +52,19 @@ namespace triton {
     namespace python {
 
       void initSymbolicNamespace(PyObject* symbolicDict) {
+        xPyDict_SetItemString(symbolicDict, "CONCRETIZE_DEEPEST_EXPRESSIONS", PyLong_FromUint32(triton::engines::symbolic::CONCRETIZE_DEEPEST_EXPRESSIONS));
+        xPyDict_SetItemString(symbolicDict, "CONCRETIZE_DEEP_EXPRESSION", PyLong_FromUint32(triton::engines::symbolic::CONCRETIZE_DEEP_EXPRESSION));
+        xPyDict_SetItemString(symbolicDict, "CONCRETIZE_OLDEST_MEMORY", PyLong_FromUint32(triton::engines::symbolic::CONCRETIZE_OLDEST_MEMORY));
+        xPyDict_SetItemString(symbolicDict, "CONCRETIZE_POINTER",    PyLong_FromUint32(triton::engines::symbolic::CONCRETIZE_POINTER));
+        xPyDict_SetItemString(symbolicDict, "CONSTRAIN_POINTER",     PyLong_FromUint32(triton::engines::symbolic::CONSTRAIN_POINTER));
+        xPyDict_SetItemString(symbolicDict, "FORK_POINTER",          PyLong_FromUint32(triton::engines::symbolic::FORK_POINTER));
         xPyDict_SetItemString(symbolicDict, "MEMORY_EXPRESSION",     PyLong_FromUint32(triton::engines::symbolic::MEMORY_EXPRESSION));
         xPyDict_SetItemString(symbolicDict, "MEMORY_VARIABLE",       PyLong_FromUint32(triton::engines::symbolic::MEMORY_VARIABLE));
+        xPyDict_SetItemString(symbolicDict, "REFUSE_NEW_SYMBOLS",    PyLong_FromUint32(triton::engines::symbolic::REFUSE_NEW_SYMBOLS));
         xPyDict_SetItemString(symbolicDict, "REGISTER_EXPRESSION",   PyLong_FromUint32(triton::engines::symbolic::REGISTER_EXPRESSION));
         xPyDict_SetItemString(symbolicDict, "REGISTER_VARIABLE",     PyLong_FromUint32(triton::engines::symbolic::REGISTER_VARIABLE));
+        xPyDict_SetItemString(symbolicDict, "SYMBOLIC_POINTER",      PyLong_FromUint32(triton::engines::symbolic::SYMBOLIC_POINTER));
+        xPyDict_SetItemString(symbolicDict, "SYMBOLIZE_DEEP_EXPRESSION", PyLong_FromUint32(triton::engines::symbolic::SYMBOLIZE_DEEP_EXPRESSION));
         xPyDict_SetItemString(symbolicDict, "UNDEFINED_VARIABLE",    PyLong_FromUint32(triton::engines::symbolic::UNDEFINED_VARIABLE));
         xPyDict_SetItemString(symbolicDict, "VOLATILE_EXPRESSION",   PyLong_FromUint32(triton::engines::symbolic::VOLATILE_EXPRESSION));
       }
@@ -0,0 +1,57 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <triton/archEnums.hpp>
+#include <triton/pythonBindings.hpp>
+#include <triton/pythonUtils.hpp>
+#include <triton/pythonXFunctions.hpp>
+
+
+
+/*! \page py_TRACE_page TRACE
+    \brief [**python api**] All information about the TRACE Python namespace.
+
+\tableofcontents
+
+\section TRACE_py_description Description
+<hr>
+
+The TRACE namespace contains all formats of trace read by `processTrace()`.
+
+\section TRACE_py_api Python API - Items of the TRACE namespace
+<hr>
+
+- **TRACE.BINARY**<br>
+Little-endian records of an address, an opcode, the register values and the memory areas to set before the instruction.
+
+- **TRACE.COMPACT**<br>
+The `TTRC` magic and a version (1:u8), then little-endian records of an address:u64, a thread:u32, an opcode (size:u8), the registers whose
+values changed since the previous record of the thread (count:u8, then id:u16 of \ref py_REG_page, size:u8, value), and the memory areas read
+then written by the instruction (count:u8, then address:u64, size:u8, bytes for each of them).
+
+- **TRACE.TEXT**<br>
+One instruction per line, e.g: `0x400000 4889d8 rbx=0x1234 [0x1000]=deadbeef`.
+
+*/
+
+
+
+namespace triton {
+  namespace bindings {
+    namespace python {
+
+      void initTraceNamespace(PyObject* traceDict) {
+        PyDict_Clear(traceDict);
+
+        xPyDict_SetItemString(traceDict, "BINARY",  PyLong_FromUint32(triton::arch::TRACE_BINARY));
+        xPyDict_SetItemString(traceDict, "COMPACT", PyLong_FromUint32(triton::arch::TRACE_COMPACT));
+        xPyDict_SetItemString(traceDict, "TEXT",    PyLong_FromUint32(triton::arch::TRACE_TEXT));
+      }
+
+    }; /* python namespace */
+  }; /* bindings namespace */
+}; /* triton namespace */
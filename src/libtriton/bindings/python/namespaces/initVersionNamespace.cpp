@@ -31,6 +31,7 @@ The VERSION namespace contains all version numbers.
 - **VERSION.MINOR**
 - **VERSION.BITWUZLA_INTERFACE**
 - **VERSION.LLVM_INTERFACE**
+- **VERSION.UNICORN_INTERFACE**
 - **VERSION.Z3_INTERFACE**
 
 */
@@ -63,6 +64,12 @@ namespace triton {
         #else
           xPyDict_SetItemString(versionDict, "LLVM_INTERFACE", Py_False);
         #endif
+
+        #ifdef TRITON_UNICORN_INTERFACE
+          xPyDict_SetItemString(versionDict, "UNICORN_INTERFACE", Py_True);
+        #else
+          xPyDict_SetItemString(versionDict, "UNICORN_INTERFACE", Py_False);
+        #endif
       }
 
     }; /* python namespace */
@@ -18,6 +18,8 @@
 #endif
 
 #include <cstring>
+#include <unordered_map>
+#include <vector>
 
 
 
@@ -58,6 +60,10 @@ This class is used to build your own AST nodes.
 \section AstContext_py_api Python API - Methods of the AstContext class
 <hr>
 
+- <b>\ref py_AstNode_page array(integer indexSize)</b><br>
+Creates an `array` node, the memory as an array of bytes indexed by `indexSize`-bit bitvectors. All the arrays with the same `indexSize` are the same memory.<br>
+e.g: `memory_64`.
+
 - <b>\ref py_AstNode_page assert_(\ref py_AstNode_page node)</b><br>
 Creates a `assert` node.
 e.g: `(assert node)`.
@@ -85,6 +91,26 @@ e.g: `(bvashr node1 epxr2)`.
 - <b>\ref py_AstNode_page bvfalse(void)</b><br>
 This is an alias on the `(_ bv0 1)` ast expression.
 
+- <b>\ref py_AstNode_page bvlaneadd(\ref py_AstNode_page node1, \ref py_AstNode_page node2, integer lane)</b><br>
+Creates a `bvlaneadd` node, the addition of each `lane`-bit lane of `node1` and `node2`.<br>
+e.g: `((_ bvlaneadd 8) node1 node2)`.
+
+- <b>\ref py_AstNode_page bvlaneeq(\ref py_AstNode_page node1, \ref py_AstNode_page node2, integer lane)</b><br>
+Creates a `bvlaneeq` node, each `lane`-bit lane is all ones if the lanes of `node1` and `node2` are equal, zero otherwise.<br>
+e.g: `((_ bvlaneeq 8) node1 node2)`.
+
+- <b>\ref py_AstNode_page bvlaneselect(\ref py_AstNode_page mask, \ref py_AstNode_page node1, \ref py_AstNode_page node2, integer lane)</b><br>
+Creates a `bvlaneselect` node, each `lane`-bit lane of `node1` if the most significant bit of the lane of `mask` is set, of `node2` otherwise.<br>
+e.g: `((_ bvlaneselect 8) mask node1 node2)`.
+
+- <b>\ref py_AstNode_page bvlanesgt(\ref py_AstNode_page node1, \ref py_AstNode_page node2, integer lane)</b><br>
+Creates a `bvlanesgt` node, each `lane`-bit lane is all ones if the lane of `node1` is signed greater than the one of `node2`, zero otherwise.<br>
+e.g: `((_ bvlanesgt 8) node1 node2)`.
+
+- <b>\ref py_AstNode_page bvlanesub(\ref py_AstNode_page node1, \ref py_AstNode_page node2, integer lane)</b><br>
+Creates a `bvlanesub` node, the subtraction of each `lane`-bit lane of `node2` from the one of `node1`.<br>
+e.g: `((_ bvlanesub 8) node1 node2)`.
+
 - <b>\ref py_AstNode_page bvlshr(\ref py_AstNode_page node1, \ref py_AstNode_page node2)</b><br>
 Creates a `bvlshr` node (logical shift right).<br>
 e.g: `(lshr node1 epxr2)`.
@@ -113,6 +139,14 @@ e.g: `(bvnot node1)`.
 Creates a `bvor` node.<br>
 e.g: `(bvor node1 node2)`.
 
+- <b>\ref py_AstNode_page bvparity(\ref py_AstNode_page node)</b><br>
+Creates a 1-bit `bvparity` node, set if the number of set bits of `node` is odd.<br>
+e.g: `(bvparity node)`.
+
+- <b>\ref py_AstNode_page bvpopcount(\ref py_AstNode_page node)</b><br>
+Creates a `bvpopcount` node, the number of set bits of `node`.<br>
+e.g: `(bvpopcount node)`.
+
 - <b>\ref py_AstNode_page bvror(\ref py_AstNode_page node, \ref py_AstNode_page rot)</b><br>
 Creates a `bvror` node (rotate right).<br>
 e.g: `((_ rotate_right rot) node)`.
@@ -240,9 +274,18 @@ Creates a logical `XOR` on several nodes.
 e.g: `(xor node1 node2 node3 node4)`.
 
 - <b>\ref py_AstNode_page reference(\ref py_SymbolicExpression_page expr)</b><br>
-Creates a reference node (SSA-based).<br>
+Creates a reference node (SSA-based). When the `AST_OPTIMIZATIONS` mode is enabled, the AST of an
+expression which is a reference, a constant or a variable is returned instead.<br>
 e.g: `ref!123`.
 
+- <b>\ref py_AstNode_page select(\ref py_AstNode_page array, \ref py_AstNode_page index)</b><br>
+Creates a `select` node, the byte of `array` at `index`.<br>
+e.g: `(select array index)`.
+
+- <b>\ref py_AstNode_page store(\ref py_AstNode_page array, \ref py_AstNode_page index, \ref py_AstNode_page value)</b><br>
+Creates a `store` node, the array `array` where the byte at `index` is `value`.<br>
+e.g: `(store array index value)`.
+
 - <b>\ref py_AstNode_page string(string s)</b><br>
 Creates a `string` node.
 
@@ -267,15 +310,41 @@ Returns the first non referene node encountered.
 - <b>\ref py_AstNode_page duplicate(\ref py_AstNode_page node)</b><br>
 Duplicates the node and returns a new instance as \ref py_AstNode_page.
 
+- <b>dict getGarbageStats(void)</b><br>
+Returns the cost of the garbage collections as a dictionary with the `fullCycles`, `incrementalCycles`, `triggered`,
+`examined`, `released` and `time` (in nanoseconds) keys.
+
+- <b>dict getNodeArrays(\ref py_AstNode_page node, bool unroll=False)</b><br>
+Returns the structure of an AST as flat arrays, built in one traversal without creating a \ref py_AstNode_page per node. The
+unique nodes are numbered children first, the root being the last one. The dictionary has the `kinds` (the \ref py_AST_NODE_page
+of each node), `sizes` (their bitvector size), `offsets` and `children` keys, each one a `bytes` of native unsigned 32-bit
+integers: the children of the node `i` are `children[offsets[i]:offsets[i+1]]`, by index. They are read without copy with
+`memoryview(array).cast("I")` or `numpy.frombuffer(array, dtype=numpy.uint32)`. If `unroll` is true, the child of a reference
+is the AST of its expression.
+
+- <b>dict getNodePoolStats(void)</b><br>
+Returns the allocation counters of the node pool as a dictionary with the `allocations`, `deallocations`, `recycled`,
+`bytesInUse` and `bytesReserved` keys.
+
 - <b>[\ref py_AstNode_page, ...] search(\ref py_AstNode_page node, \ref py_AST_NODE_page match)</b><br>
 Returns a list of collected matched nodes via a depth-first pre order traversal.
 
+- <b>void setGarbageThresholds(integer nodes, integer bytes)</b><br>
+Sets the number of nodes and of bytes allocated since the last garbage collection which trigger one after a processed
+instruction, 0 to disable a threshold. Without thresholds, a small incremental collection runs after each instruction.
+
 - <b>z3::expr tritonToZ3(\ref py_AstNode_page node)</b><br>
 Convert a Triton AST to a Z3 AST.
 
 - <b>\ref py_AstNode_page unroll(\ref py_AstNode_page node)</b><br>
 Unrolls the SSA form of a given AST.
 
+- <b>void visit(\ref py_AstNode_page node, dict callbacks, bool unroll=False, bool childrenFirst=True)</b><br>
+Calls `callbacks[kind](n)` on each unique node `n` of an AST whose \ref py_AST_NODE_page `kind` is a key of `callbacks`, or
+`callbacks[AST_NODE.ANY_NODE](n)` if it is not and this key is. The traversal runs in C++ and only the nodes visited get a
+\ref py_AstNode_page, e.g. `visit(node, {AST_NODE.BVADD: f, AST_NODE.BVMUL: g})`. If `childrenFirst` is true, the children of a
+node are visited before it, otherwise after it. If `unroll` is true, references are unrolled.
+
 - <b>\ref py_AstNode_page z3ToTriton(z3::expr expr)</b><br>
 Convert a Z3 AST to a Triton AST.
 
@@ -354,6 +423,19 @@ namespace triton {
       }
 
 
+      static PyObject* AstContext_array(PyObject* self, PyObject* indexSize) {
+        if (!PyLong_Check(indexSize) && !PyInt_Check(indexSize))
+          return PyErr_Format(PyExc_TypeError, "array(): expected an integer as argument");
+
+        try {
+          return PyAstNode(PyAstContext_AsAstContext(self)->array(PyLong_AsUint32(indexSize)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* AstContext_assert(PyObject* self, PyObject* op1) {
         if (!PyAstNode_Check(op1))
           return PyErr_Format(PyExc_TypeError, "assert_(): expected a AstNode as first argument");
@@ -496,6 +578,150 @@ namespace triton {
       }
 
 
+      static PyObject* AstContext_bvlaneadd(PyObject* self, PyObject* args) {
+        PyObject* op1 = nullptr;
+        PyObject* op2 = nullptr;
+        PyObject* op3 = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OOO", &op1, &op2, &op3) == false) {
+          return PyErr_Format(PyExc_TypeError, "bvlaneadd(): Invalid number of arguments");
+        }
+
+        if (op1 == nullptr || !PyAstNode_Check(op1))
+          return PyErr_Format(PyExc_TypeError, "bvlaneadd(): expected a AstNode as first argument");
+
+        if (op2 == nullptr || !PyAstNode_Check(op2))
+          return PyErr_Format(PyExc_TypeError, "bvlaneadd(): expected a AstNode as second argument");
+
+        if (op3 == nullptr || (!PyLong_Check(op3) && !PyInt_Check(op3)))
+          return PyErr_Format(PyExc_TypeError, "bvlaneadd(): expected an integer as third argument");
+
+        try {
+          return PyAstNode(PyAstContext_AsAstContext(self)->bvlaneadd(PyAstNode_AsAstNode(op1), PyAstNode_AsAstNode(op2), PyLong_AsUint32(op3)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* AstContext_bvlaneeq(PyObject* self, PyObject* args) {
+        PyObject* op1 = nullptr;
+        PyObject* op2 = nullptr;
+        PyObject* op3 = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OOO", &op1, &op2, &op3) == false) {
+          return PyErr_Format(PyExc_TypeError, "bvlaneeq(): Invalid number of arguments");
+        }
+
+        if (op1 == nullptr || !PyAstNode_Check(op1))
+          return PyErr_Format(PyExc_TypeError, "bvlaneeq(): expected a AstNode as first argument");
+
+        if (op2 == nullptr || !PyAstNode_Check(op2))
+          return PyErr_Format(PyExc_TypeError, "bvlaneeq(): expected a AstNode as second argument");
+
+        if (op3 == nullptr || (!PyLong_Check(op3) && !PyInt_Check(op3)))
+          return PyErr_Format(PyExc_TypeError, "bvlaneeq(): expected an integer as third argument");
+
+        try {
+          return PyAstNode(PyAstContext_AsAstContext(self)->bvlaneeq(PyAstNode_AsAstNode(op1), PyAstNode_AsAstNode(op2), PyLong_AsUint32(op3)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* AstContext_bvlaneselect(PyObject* self, PyObject* args) {
+        PyObject* op1 = nullptr;
+        PyObject* op2 = nullptr;
+        PyObject* op3 = nullptr;
+        PyObject* op4 = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OOOO", &op1, &op2, &op3, &op4) == false) {
+          return PyErr_Format(PyExc_TypeError, "bvlaneselect(): Invalid number of arguments");
+        }
+
+        if (op1 == nullptr || !PyAstNode_Check(op1))
+          return PyErr_Format(PyExc_TypeError, "bvlaneselect(): expected a AstNode as first argument");
+
+        if (op2 == nullptr || !PyAstNode_Check(op2))
+          return PyErr_Format(PyExc_TypeError, "bvlaneselect(): expected a AstNode as second argument");
+
+        if (op3 == nullptr || !PyAstNode_Check(op3))
+          return PyErr_Format(PyExc_TypeError, "bvlaneselect(): expected a AstNode as third argument");
+
+        if (op4 == nullptr || (!PyLong_Check(op4) && !PyInt_Check(op4)))
+          return PyErr_Format(PyExc_TypeError, "bvlaneselect(): expected an integer as fourth argument");
+
+        try {
+          return PyAstNode(PyAstContext_AsAstContext(self)->bvlaneselect(PyAstNode_AsAstNode(op1), PyAstNode_AsAstNode(op2), PyAstNode_AsAstNode(op3), PyLong_AsUint32(op4)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* AstContext_bvlanesgt(PyObject* self, PyObject* args) {
+        PyObject* op1 = nullptr;
+        PyObject* op2 = nullptr;
+        PyObject* op3 = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OOO", &op1, &op2, &op3) == false) {
+          return PyErr_Format(PyExc_TypeError, "bvlanesgt(): Invalid number of arguments");
+        }
+
+        if (op1 == nullptr || !PyAstNode_Check(op1))
+          return PyErr_Format(PyExc_TypeError, "bvlanesgt(): expected a AstNode as first argument");
+
+        if (op2 == nullptr || !PyAstNode_Check(op2))
+          return PyErr_Format(PyExc_TypeError, "bvlanesgt(): expected a AstNode as second argument");
+
+        if (op3 == nullptr || (!PyLong_Check(op3) && !PyInt_Check(op3)))
+          return PyErr_Format(PyExc_TypeError, "bvlanesgt(): expected an integer as third argument");
+
+        try {
+          return PyAstNode(PyAstContext_AsAstContext(self)->bvlanesgt(PyAstNode_AsAstNode(op1), PyAstNode_AsAstNode(op2), PyLong_AsUint32(op3)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* AstContext_bvlanesub(PyObject* self, PyObject* args) {
+        PyObject* op1 = nullptr;
+        PyObject* op2 = nullptr;
+        PyObject* op3 = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OOO", &op1, &op2, &op3) == false) {
+          return PyErr_Format(PyExc_TypeError, "bvlanesub(): Invalid number of arguments");
+        }
+
+        if (op1 == nullptr || !PyAstNode_Check(op1))
+          return PyErr_Format(PyExc_TypeError, "bvlanesub(): expected a AstNode as first argument");
+
+        if (op2 == nullptr || !PyAstNode_Check(op2))
+          return PyErr_Format(PyExc_TypeError, "bvlanesub(): expected a AstNode as second argument");
+
+        if (op3 == nullptr || (!PyLong_Check(op3) && !PyInt_Check(op3)))
+          return PyErr_Format(PyExc_TypeError, "bvlanesub(): expected an integer as third argument");
+
+        try {
+          return PyAstNode(PyAstContext_AsAstContext(self)->bvlanesub(PyAstNode_AsAstNode(op1), PyAstNode_AsAstNode(op2), PyLong_AsUint32(op3)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* AstContext_bvlshr(PyObject* self, PyObject* args) {
         PyObject* op1 = nullptr;
         PyObject* op2 = nullptr;
@@ -642,6 +868,32 @@ namespace triton {
       }
 
 
+      static PyObject* AstContext_bvparity(PyObject* self, PyObject* op1) {
+        if (!PyAstNode_Check(op1))
+          return PyErr_Format(PyExc_TypeError, "bvparity(): expected a AstNode as first argument");
+
+        try {
+          return PyAstNode(PyAstContext_AsAstContext(self)->bvparity(PyAstNode_AsAstNode(op1)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* AstContext_bvpopcount(PyObject* self, PyObject* op1) {
+        if (!PyAstNode_Check(op1))
+          return PyErr_Format(PyExc_TypeError, "bvpopcount(): expected a AstNode as first argument");
+
+        try {
+          return PyAstNode(PyAstContext_AsAstContext(self)->bvpopcount(PyAstNode_AsAstNode(op1)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* AstContext_bvror(PyObject* self, PyObject* args) {
         PyObject* op1 = nullptr;
         PyObject* op2 = nullptr;
@@ -1299,6 +1551,90 @@ namespace triton {
       }
 
 
+      static PyObject* AstContext_getNodeArrays(PyObject* self, PyObject* args) {
+        PyObject* node   = nullptr;
+        PyObject* unroll = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &node, &unroll) == false) {
+          return PyErr_Format(PyExc_TypeError, "getNodeArrays(): Invalid number of arguments");
+        }
+
+        if (node == nullptr || !PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "getNodeArrays(): Expects a AstNode as first argument.");
+
+        if (unroll != nullptr && !PyBool_Check(unroll))
+          return PyErr_Format(PyExc_TypeError, "getNodeArrays(): Expects a boolean as second argument.");
+
+        try {
+          bool flag = (unroll != nullptr) ? PyLong_AsBool(unroll) : false;
+          std::unordered_map<const triton::ast::AbstractNode*, triton::uint32> indexes;
+          std::vector<triton::uint32> kinds;
+          std::vector<triton::uint32> sizes;
+          std::vector<triton::uint32> offsets;
+          std::vector<triton::uint32> children;
+
+          /* The children are visited before their parents, so they already have an index */
+          triton::ast::childrenTraversal(PyAstNode_AsAstNode(node), flag, [&](const triton::ast::SharedAbstractNode& n) {
+            indexes[n.get()] = static_cast<triton::uint32>(kinds.size());
+            kinds.push_back(n->getType());
+            sizes.push_back(n->getBitvectorSize());
+            offsets.push_back(static_cast<triton::uint32>(children.size()));
+            for (const auto& child : n->getChildren())
+              children.push_back(indexes[child.get()]);
+            if (flag && n->getType() == triton::ast::REFERENCE_NODE)
+              children.push_back(indexes[reinterpret_cast<triton::ast::ReferenceNode*>(n.get())->getSymbolicExpression()->getAst().get()]);
+          });
+          offsets.push_back(static_cast<triton::uint32>(children.size()));
+
+          PyObject* ret = xPyDict_New();
+          xPyDict_SetItemString(ret, "kinds",    PyBytes_FromStringAndSize(reinterpret_cast<const char*>(kinds.data()), kinds.size() * sizeof(triton::uint32)));
+          xPyDict_SetItemString(ret, "sizes",    PyBytes_FromStringAndSize(reinterpret_cast<const char*>(sizes.data()), sizes.size() * sizeof(triton::uint32)));
+          xPyDict_SetItemString(ret, "offsets",  PyBytes_FromStringAndSize(reinterpret_cast<const char*>(offsets.data()), offsets.size() * sizeof(triton::uint32)));
+          xPyDict_SetItemString(ret, "children", PyBytes_FromStringAndSize(reinterpret_cast<const char*>(children.data()), children.size() * sizeof(triton::uint32)));
+          return ret;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* AstContext_getNodePoolStats(PyObject* self, PyObject* noarg) {
+        try {
+          const auto& pool = PyAstContext_AsAstContext(self)->getNodePool();
+          PyObject* ret = xPyDict_New();
+          xPyDict_SetItem(ret, xPyString_FromString("allocations"),   PyLong_FromUsize(pool->getAllocations()));
+          xPyDict_SetItem(ret, xPyString_FromString("deallocations"), PyLong_FromUsize(pool->getDeallocations()));
+          xPyDict_SetItem(ret, xPyString_FromString("recycled"),      PyLong_FromUsize(pool->getRecycled()));
+          xPyDict_SetItem(ret, xPyString_FromString("bytesInUse"),    PyLong_FromUsize(pool->getBytesInUse()));
+          xPyDict_SetItem(ret, xPyString_FromString("bytesReserved"), PyLong_FromUsize(pool->getBytesReserved()));
+          return ret;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* AstContext_getGarbageStats(PyObject* self, PyObject* noarg) {
+        try {
+          const auto& stats = PyAstContext_AsAstContext(self)->getGarbageStatistics();
+          PyObject* ret = xPyDict_New();
+          xPyDict_SetItem(ret, xPyString_FromString("fullCycles"),        PyLong_FromUsize(stats.fullCycles));
+          xPyDict_SetItem(ret, xPyString_FromString("incrementalCycles"), PyLong_FromUsize(stats.incrementalCycles));
+          xPyDict_SetItem(ret, xPyString_FromString("triggered"),         PyLong_FromUsize(stats.triggered));
+          xPyDict_SetItem(ret, xPyString_FromString("examined"),          PyLong_FromUsize(stats.examined));
+          xPyDict_SetItem(ret, xPyString_FromString("released"),          PyLong_FromUsize(stats.released));
+          xPyDict_SetItem(ret, xPyString_FromString("time"),              PyLong_FromUint64(stats.time));
+          return ret;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* AstContext_iff(PyObject* self, PyObject* args) {
         PyObject* op1 = nullptr;
         PyObject* op2 = nullptr;
@@ -1512,6 +1848,84 @@ namespace triton {
       }
 
 
+      static PyObject* AstContext_select(PyObject* self, PyObject* args) {
+        PyObject* op1 = nullptr;
+        PyObject* op2 = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &op1, &op2) == false) {
+          return PyErr_Format(PyExc_TypeError, "select(): Invalid number of arguments");
+        }
+
+        if (op1 == nullptr || !PyAstNode_Check(op1))
+          return PyErr_Format(PyExc_TypeError, "select(): expected a AstNode as first argument");
+
+        if (op2 == nullptr || !PyAstNode_Check(op2))
+          return PyErr_Format(PyExc_TypeError, "select(): expected a AstNode as second argument");
+
+        try {
+          return PyAstNode(PyAstContext_AsAstContext(self)->select(PyAstNode_AsAstNode(op1), PyAstNode_AsAstNode(op2)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* AstContext_setGarbageThresholds(PyObject* self, PyObject* args) {
+        PyObject* op1 = nullptr;
+        PyObject* op2 = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &op1, &op2) == false) {
+          return PyErr_Format(PyExc_TypeError, "setGarbageThresholds(): Invalid number of arguments");
+        }
+
+        if (op1 == nullptr || (!PyLong_Check(op1) && !PyInt_Check(op1)))
+          return PyErr_Format(PyExc_TypeError, "setGarbageThresholds(): expected an integer as first argument");
+
+        if (op2 == nullptr || (!PyLong_Check(op2) && !PyInt_Check(op2)))
+          return PyErr_Format(PyExc_TypeError, "setGarbageThresholds(): expected an integer as second argument");
+
+        try {
+          PyAstContext_AsAstContext(self)->setGarbageThresholds(PyLong_AsUsize(op1), PyLong_AsUsize(op2));
+          Py_INCREF(Py_None);
+          return Py_None;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* AstContext_store(PyObject* self, PyObject* args) {
+        PyObject* op1 = nullptr;
+        PyObject* op2 = nullptr;
+        PyObject* op3 = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OOO", &op1, &op2, &op3) == false) {
+          return PyErr_Format(PyExc_TypeError, "store(): Invalid number of arguments");
+        }
+
+        if (op1 == nullptr || !PyAstNode_Check(op1))
+          return PyErr_Format(PyExc_TypeError, "store(): expected a AstNode as first argument");
+
+        if (op2 == nullptr || !PyAstNode_Check(op2))
+          return PyErr_Format(PyExc_TypeError, "store(): expected a AstNode as second argument");
+
+        if (op3 == nullptr || !PyAstNode_Check(op3))
+          return PyErr_Format(PyExc_TypeError, "store(): expected a AstNode as third argument");
+
+        try {
+          return PyAstNode(PyAstContext_AsAstContext(self)->store(PyAstNode_AsAstNode(op1), PyAstNode_AsAstNode(op2), PyAstNode_AsAstNode(op3)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* AstContext_string(PyObject* self, PyObject* expr) {
         if (!PyStr_Check(expr))
           return PyErr_Format(PyExc_TypeError, "string(): expected a string as first argument");
@@ -1562,6 +1976,88 @@ namespace triton {
       }
 
 
+      static PyObject* AstContext_visit(PyObject* self, PyObject* args) {
+        PyObject* node          = nullptr;
+        PyObject* callbacks     = nullptr;
+        PyObject* unroll        = nullptr;
+        PyObject* childrenFirst = nullptr;
+        PyObject* key           = nullptr;
+        PyObject* value         = nullptr;
+        Py_ssize_t pos          = 0;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OOOO", &node, &callbacks, &unroll, &childrenFirst) == false) {
+          return PyErr_Format(PyExc_TypeError, "visit(): Invalid number of arguments");
+        }
+
+        if (node == nullptr || !PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "visit(): Expects a AstNode as first argument.");
+
+        if (callbacks == nullptr || !PyDict_Check(callbacks))
+          return PyErr_Format(PyExc_TypeError, "visit(): Expects a dict as second argument.");
+
+        if (unroll != nullptr && !PyBool_Check(unroll))
+          return PyErr_Format(PyExc_TypeError, "visit(): Expects a boolean as third argument.");
+
+        if (childrenFirst != nullptr && !PyBool_Check(childrenFirst))
+          return PyErr_Format(PyExc_TypeError, "visit(): Expects a boolean as fourth argument.");
+
+        /* The callbacks by kind of node */
+        std::unordered_map<triton::uint32, PyObject*> functions;
+        while (PyDict_Next(callbacks, &pos, &key, &value)) {
+          if (!PyLong_Check(key) && !PyInt_Check(key))
+            return PyErr_Format(PyExc_TypeError, "visit(): Expects AST_NODE as keys.");
+          if (!PyCallable_Check(value))
+            return PyErr_Format(PyExc_TypeError, "visit(): Expects callables as values.");
+          functions[PyLong_AsUint32(key)] = value;
+        }
+
+        auto any = functions.find(triton::ast::ANY_NODE);
+        PyObject* fallback = (any != functions.end()) ? any->second : nullptr;
+
+        auto call = [&](const triton::ast::SharedAbstractNode& n) {
+          auto it = functions.find(n->getType());
+          PyObject* cb = (it != functions.end()) ? it->second : fallback;
+          if (cb == nullptr)
+            return;
+
+          PyObject* cbArgs = xPyTuple_New(1);
+          PyTuple_SetItem(cbArgs, 0, PyAstNode(n));
+
+          /* Call the callback */
+          PyObject* ret = PyObject_CallObject(cb, cbArgs);
+          Py_DECREF(cbArgs);
+
+          /* Check the call */
+          if (ret == nullptr) {
+            throw triton::exceptions::PyCallbacks();
+          }
+
+          Py_DECREF(ret);
+        };
+
+        try {
+          bool flag = (unroll != nullptr) ? PyLong_AsBool(unroll) : false;
+          if (childrenFirst == nullptr || PyLong_AsBool(childrenFirst)) {
+            triton::ast::childrenTraversal(PyAstNode_AsAstNode(node), flag, call);
+          }
+          else {
+            for (const auto& n : triton::ast::childrenExtraction(PyAstNode_AsAstNode(node), flag, false))
+              call(n);
+          }
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* AstContext_variable(PyObject* self, PyObject* symVar) {
         if (!PySymbolicVariable_Check(symVar))
           return PyErr_Format(PyExc_TypeError, "variable(): expected a SymbolicVariable as first argument");
@@ -1692,6 +2188,7 @@ namespace triton {
 
       //! AstContext methods.
       PyMethodDef AstContext_callbacks[] = {
+        {"array",           AstContext_array,           METH_O,           ""},
         {"assert_",         AstContext_assert,          METH_O,           ""},
         {"bswap",           AstContext_bswap,           METH_O,           ""},
         {"bv",              AstContext_bv,              METH_VARARGS,     ""},
@@ -1699,6 +2196,11 @@ namespace triton {
         {"bvand",           AstContext_bvand,           METH_VARARGS,     ""},
         {"bvashr",          AstContext_bvashr,          METH_VARARGS,     ""},
         {"bvfalse",         AstContext_bvfalse,         METH_NOARGS,      ""},
+        {"bvlaneadd",       AstContext_bvlaneadd,       METH_VARARGS,     ""},
+        {"bvlaneeq",        AstContext_bvlaneeq,        METH_VARARGS,     ""},
+        {"bvlaneselect",    AstContext_bvlaneselect,    METH_VARARGS,     ""},
+        {"bvlanesgt",       AstContext_bvlanesgt,       METH_VARARGS,     ""},
+        {"bvlanesub",       AstContext_bvlanesub,       METH_VARARGS,     ""},
         {"bvlshr",          AstContext_bvlshr,          METH_VARARGS,     ""},
         {"bvmul",           AstContext_bvmul,           METH_VARARGS,     ""},
         {"bvnand",          AstContext_bvnand,          METH_VARARGS,     ""},
@@ -1706,6 +2208,8 @@ namespace triton {
         {"bvnor",           AstContext_bvnor,           METH_VARARGS,     ""},
         {"bvnot",           AstContext_bvnot,           METH_O,           ""},
         {"bvor",            AstContext_bvor,            METH_VARARGS,     ""},
+        {"bvparity",        AstContext_bvparity,        METH_O,           ""},
+        {"bvpopcount",      AstContext_bvpopcount,      METH_O,           ""},
         {"bvrol",           AstContext_bvrol,           METH_VARARGS,     ""},
         {"bvror",           AstContext_bvror,           METH_VARARGS,     ""},
         {"bvsdiv",          AstContext_bvsdiv,          METH_VARARGS,     ""},
@@ -1735,6 +2239,9 @@ namespace triton {
         {"equal",           AstContext_equal,           METH_VARARGS,     ""},
         {"extract",         AstContext_extract,         METH_VARARGS,     ""},
         {"forall",          AstContext_forall,          METH_VARARGS,     ""},
+        {"getGarbageStats", AstContext_getGarbageStats, METH_NOARGS,      ""},
+        {"getNodeArrays",   AstContext_getNodeArrays,   METH_VARARGS,     ""},
+        {"getNodePoolStats", AstContext_getNodePoolStats, METH_NOARGS,    ""},
         {"iff",             AstContext_iff,             METH_VARARGS,     ""},
         {"ite",             AstContext_ite,             METH_VARARGS,     ""},
         {"land",            AstContext_land,            METH_O,           ""},
@@ -1744,10 +2251,14 @@ namespace triton {
         {"lxor",            AstContext_lxor,            METH_O,           ""},
         {"reference",       AstContext_reference,       METH_O,           ""},
         {"search",          AstContext_search,          METH_VARARGS,     ""},
+        {"select",          AstContext_select,          METH_VARARGS,     ""},
+        {"setGarbageThresholds", AstContext_setGarbageThresholds, METH_VARARGS, ""},
+        {"store",           AstContext_store,           METH_VARARGS,     ""},
         {"string",          AstContext_string,          METH_O,           ""},
         {"sx",              AstContext_sx,              METH_VARARGS,     ""},
         {"unroll",          AstContext_unroll,          METH_O,           ""},
         {"variable",        AstContext_variable,        METH_O,           ""},
+        {"visit",           AstContext_visit,           METH_VARARGS,     ""},
         {"zx",              AstContext_zx,              METH_VARARGS,     ""},
         #ifdef TRITON_Z3_INTERFACE
         {"tritonToZ3",      AstContext_tritonToZ3,      METH_O,           ""},
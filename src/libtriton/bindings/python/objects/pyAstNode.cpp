@@ -57,6 +57,10 @@ Compares the current tree to another one.
 - <b>integer evaluate(void)</b><br>
 Evaluates the tree and returns its value.
 
+- <b>void freeze(void)</b><br>
+Makes the tree immutable. A frozen tree keeps its current evaluation, it is not updated anymore when its variables change,
+and it may be used as operand of nodes of other contexts.
+
 - <b>integer getBitvectorMask(void)</b><br>
 Returns the mask of the node vector according to its size.<br>
 e.g: `0xffffffff`
@@ -68,7 +72,7 @@ Returns the node vector size.
 Returns the list of child nodes.
 
 - <b>integer getHash(void)</b><br>
-Returns the hash (signature) of the AST.
+Returns the 128-bit structural hash (signature) of the AST. Operands of commutative operators are hashed in a canonical order.
 
 - <b>integer getInteger(void)</b><br>
 Returns the integer of the node. Only available on `INTEGER_NODE`, raises an exception otherwise.
@@ -92,6 +96,9 @@ Returns the symbolic variable of the node. Only available on `VARIABLE_NODE`, ra
 Returns the type of the node.<br>
 e.g: `AST_NODE.BVADD`
 
+- <b>bool isFrozen(void)</b><br>
+Returns true if the tree is frozen.
+
 - <b>bool isLogical(void)</b><br>
 Returns true if it's a logical node.
 e.g: `AST_NODE.EQUAL`, `AST_NODE.LNOT`, `AST_NODE.LAND`...
@@ -173,6 +180,18 @@ namespace triton {
       }
 
 
+      static PyObject* AstNode_freeze(PyObject* self, PyObject* noarg) {
+        try {
+          PyAstNode_AsAstNode(self)->freeze();
+          Py_INCREF(Py_None);
+          return Py_None;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* AstNode_getBitvectorMask(PyObject* self, PyObject* noarg) {
         try {
           return PyLong_FromUint512(PyAstNode_AsAstNode(self)->getBitvectorMask());
@@ -213,7 +232,7 @@ namespace triton {
 
       static PyObject* AstNode_getHash(PyObject* self, PyObject* noarg) {
         try {
-          return PyLong_FromUint512(PyAstNode_AsAstNode(self)->getHash());
+          return PyLong_FromUint128(PyAstNode_AsAstNode(self)->getHash());
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -317,6 +336,18 @@ namespace triton {
       }
 
 
+      static PyObject* AstNode_isFrozen(PyObject* self, PyObject* noarg) {
+        try {
+          if (PyAstNode_AsAstNode(self)->isFrozen())
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* AstNode_isLogical(PyObject* self, PyObject* noarg) {
         try {
           if (PyAstNode_AsAstNode(self)->isLogical())
@@ -822,6 +853,7 @@ namespace triton {
       PyMethodDef AstNode_callbacks[] = {
         {"equalTo",                 AstNode_equalTo,                METH_O,          ""},
         {"evaluate",                AstNode_evaluate,               METH_NOARGS,     ""},
+        {"freeze",                  AstNode_freeze,                 METH_NOARGS,     ""},
         {"getBitvectorMask",        AstNode_getBitvectorMask,       METH_NOARGS,     ""},
         {"getBitvectorSize",        AstNode_getBitvectorSize,       METH_NOARGS,     ""},
         {"getChildren",             AstNode_getChildren,            METH_NOARGS,     ""},
@@ -833,6 +865,7 @@ namespace triton {
         {"getSymbolicExpression",   AstNode_getSymbolicExpression,  METH_NOARGS,     ""},
         {"getSymbolicVariable",     AstNode_getSymbolicVariable,    METH_NOARGS,     ""},
         {"getType",                 AstNode_getType,                METH_NOARGS,     ""},
+        {"isFrozen",                AstNode_isFrozen,               METH_NOARGS,     ""},
         {"isLogical",               AstNode_isLogical,              METH_NOARGS,     ""},
         {"isSigned",                AstNode_isSigned,               METH_NOARGS,     ""},
         {"isSymbolized",            AstNode_isSymbolized,           METH_NOARGS,     ""},
@@ -220,6 +220,9 @@ Returns true if the instruction performs a write back. Mainly used for AArch64 i
 - <b>bool isThumb(void)</b><br>
 Returns true if the instruction is a Thumb instruction.
 
+- <b>void reset(integer addr, bytes opcode)</b><br>
+Clears the instruction and sets its address and opcode, so that a processing loop reuses one instance.
+
 - <b>void setAddress(integer addr)</b><br>
 Sets the address of the instruction.
 
@@ -665,6 +668,35 @@ namespace triton {
       }
 
 
+      static PyObject* Instruction_reset(PyObject* self, PyObject* args) {
+        PyObject* addr = nullptr;
+        PyObject* opc  = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &addr, &opc) == false) {
+          return PyErr_Format(PyExc_TypeError, "Instruction::reset(): Invalid number of arguments");
+        }
+
+        if (addr == nullptr || (!PyLong_Check(addr) && !PyInt_Check(addr)))
+          return PyErr_Format(PyExc_TypeError, "Instruction::reset(): Expects an integer as first argument.");
+
+        if (opc == nullptr || !PyBytes_Check(opc))
+          return PyErr_Format(PyExc_TypeError, "Instruction::reset(): Expects bytes as second argument.");
+
+        try {
+          triton::uint8* opcode = reinterpret_cast<triton::uint8*>(PyBytes_AsString(opc));
+          triton::uint32 size   = static_cast<triton::uint32>(PyBytes_Size(opc));
+
+          PyInstruction_AsInstruction(self)->reset(PyLong_AsUint64(addr), opcode, size);
+          Py_INCREF(Py_None);
+          return Py_None;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* Instruction_setOpcode(PyObject* self, PyObject* opc) {
         try {
           if (!PyBytes_Check(opc))
@@ -747,6 +779,7 @@ namespace triton {
         {"isTainted",                 Instruction_isTainted,                METH_NOARGS,     ""},
         {"isWriteBack",               Instruction_isWriteBack,              METH_NOARGS,     ""},
         {"isThumb",                   Instruction_isThumb,                  METH_NOARGS,     ""},
+        {"reset",                     Instruction_reset,                    METH_VARARGS,    ""},
         {"setAddress",                Instruction_setAddress,               METH_O,          ""},
         {"setOpcode",                 Instruction_setOpcode,                METH_O,          ""},
         {"setThreadId",               Instruction_setThreadId,              METH_O,          ""},
@@ -0,0 +1,248 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <triton/pythonObjects.hpp>
+#include <triton/pythonUtils.hpp>
+#include <triton/pythonXFunctions.hpp>
+#include <triton/api.hpp>
+#include <triton/exceptions.hpp>
+
+
+
+/*! \page py_Namespace_page Namespace
+    \brief [**python api**] All information about the Namespace Python object.
+
+\tableofcontents
+
+\section py_Namespace_description Description
+<hr>
+
+This object holds the attributes of the large namespaces, which are only created when they are first accessed:
+the architectures of the \ref py_OPCODE_page and \ref py_REG_page namespaces are filled on first access, and the
+`registers` attribute of a \ref py_TritonContext_page creates the \ref py_Register_page of a name when it is accessed.
+Importing `triton` or creating a context therefore does not depend on the number of opcodes and registers.
+
+~~~~~~~~~~~~~{.py}
+>>> from triton import TritonContext, ARCH, OPCODE
+
+>>> OPCODE.X86.ADD == OPCODE.X86.ADD
+True
+
+>>> ctxt = TritonContext(ARCH.X86_64)
+>>> ctxt.registers.rax
+rax:64 bv[63..0]
+
+>>> 'rax' in dir(ctxt.registers)
+True
+
+~~~~~~~~~~~~~
+
+*/
+
+
+
+namespace triton {
+  namespace bindings {
+    namespace python {
+
+      /* Sets all the attributes of a namespace */
+      static void Namespace_fillAll(Namespace_Object* self) {
+        if (self->fill != nullptr) {
+          auto fill = self->fill;
+          self->fill = nullptr;
+          fill(self->dict);
+        }
+
+        if (self->api != nullptr && self->api->getArchitecture() != triton::arch::ARCH_INVALID) {
+          for (const auto& reg : self->api->getAllRegisters()) {
+            std::string name = reg.second.getName();
+            if (PyDict_GetItemString(self->dict, name.c_str()) == nullptr)
+              xPyDict_SetItemString(self->dict, name.c_str(), PyRegister(reg.second));
+          }
+        }
+      }
+
+
+      //! Namespace destructor.
+      void Namespace_dealloc(PyObject* self) {
+        Py_XDECREF(((Namespace_Object*)self)->name);
+        Py_XDECREF(((Namespace_Object*)self)->dict);
+        Py_TYPE(self)->tp_free((PyObject*)self);
+      }
+
+
+      static PyObject* Namespace_dir(PyObject* self, PyObject* noarg) {
+        Namespace_fillAll((Namespace_Object*)self);
+
+        PyObject* names = PyDict_Keys(((Namespace_Object*)self)->dict);
+        if (names != nullptr)
+          PyList_Sort(names);
+
+        return names;
+      }
+
+
+      static PyObject* Namespace_getattro(PyObject* self, PyObject* name) {
+        auto* ns = (Namespace_Object*)self;
+
+        /* The attributes of the static namespaces are all set on first access */
+        if (ns->fill != nullptr)
+          Namespace_fillAll(ns);
+
+        PyObject* item = PyDict_GetItem(ns->dict, name);
+        if (item != nullptr) {
+          Py_INCREF(item);
+          return item;
+        }
+
+        if (!PyStr_Check(name))
+          return PyObject_GenericGetAttr(self, name);
+
+        std::string str = PyStr_AsString(name);
+
+        if (str == "__dict__") {
+          Namespace_fillAll(ns);
+          Py_INCREF(ns->dict);
+          return ns->dict;
+        }
+
+        /* The registers are created on access, by their exact name */
+        if (ns->api != nullptr && ns->api->getArchitecture() != triton::arch::ARCH_INVALID) {
+          try {
+            const triton::arch::Register& reg = ns->api->getRegister(str);
+            if (reg.getName() == str) {
+              item = PyRegister(reg);
+              PyDict_SetItem(ns->dict, name, item);
+              return item;
+            }
+          }
+          catch (const triton::exceptions::Exception&) {
+            /* Not a register, falls back to the generic attributes */
+          }
+        }
+
+        return PyObject_GenericGetAttr(self, name);
+      }
+
+
+      static PyObject* Namespace_repr(PyObject* self) {
+        return PyStr_FromFormat("<namespace %s>", PyStr_AsString(((Namespace_Object*)self)->name));
+      }
+
+
+      //! Namespace methods.
+      PyMethodDef Namespace_callbacks[] = {
+        {"__dir__",   Namespace_dir,    METH_NOARGS,    ""},
+        {nullptr,     nullptr,          0,              nullptr}
+      };
+
+
+      PyTypeObject Namespace_Type = {
+        PyVarObject_HEAD_INIT(&PyType_Type, 0)
+        "Namespace",                                /* tp_name */
+        sizeof(Namespace_Object),                   /* tp_basicsize */
+        0,                                          /* tp_itemsize */
+        (destructor)Namespace_dealloc,              /* tp_dealloc */
+        #if IS_PY3_8
+        0,                                          /* tp_vectorcall_offset */
+        #else
+        0,                                          /* tp_print */
+        #endif
+        0,                                          /* tp_getattr */
+        0,                                          /* tp_setattr */
+        0,                                          /* tp_compare */
+        (reprfunc)Namespace_repr,                   /* tp_repr */
+        0,                                          /* tp_as_number */
+        0,                                          /* tp_as_sequence */
+        0,                                          /* tp_as_mapping */
+        0,                                          /* tp_hash */
+        0,                                          /* tp_call */
+        0,                                          /* tp_str */
+        (getattrofunc)Namespace_getattro,           /* tp_getattro */
+        0,                                          /* tp_setattro */
+        0,                                          /* tp_as_buffer */
+        Py_TPFLAGS_DEFAULT,                         /* tp_flags */
+        "Namespace objects",                        /* tp_doc */
+        0,                                          /* tp_traverse */
+        0,                                          /* tp_clear */
+        0,                                          /* tp_richcompare */
+        0,                                          /* tp_weaklistoffset */
+        0,                                          /* tp_iter */
+        0,                                          /* tp_iternext */
+        Namespace_callbacks,                        /* tp_methods */
+        0,                                          /* tp_members */
+        0,                                          /* tp_getset */
+        0,                                          /* tp_base */
+        0,                                          /* tp_dict */
+        0,                                          /* tp_descr_get */
+        0,                                          /* tp_descr_set */
+        0,                                          /* tp_dictoffset */
+        0,                                          /* tp_init */
+        0,                                          /* tp_alloc */
+        0,                                          /* tp_new */
+        0,                                          /* tp_free */
+        0,                                          /* tp_is_gc */
+        0,                                          /* tp_bases */
+        0,                                          /* tp_mro */
+        0,                                          /* tp_cache */
+        0,                                          /* tp_subclasses */
+        0,                                          /* tp_weaklist */
+        0,                                          /* tp_del */
+        #if IS_PY3
+          0,                                        /* tp_version_tag */
+          0,                                        /* tp_finalize */
+          #if IS_PY3_8
+            0,                                      /* tp_vectorcall */
+            #if !IS_PY3_9
+              0,                                    /* bpo-37250: kept for backwards compatibility in CPython 3.8 only */
+            #endif
+          #endif
+        #else
+          0                                         /* tp_version_tag */
+        #endif
+      };
+
+
+      PyObject* PyNamespace(const char* name, void (*fill)(PyObject* dict)) {
+        Namespace_Object* object;
+
+        PyType_Ready(&Namespace_Type);
+        object = PyObject_NEW(Namespace_Object, &Namespace_Type);
+        if (object != NULL) {
+          object->name = xPyString_FromString(name);
+          object->dict = xPyDict_New();
+          object->fill = fill;
+          object->api  = nullptr;
+        }
+
+        return (PyObject*)object;
+      }
+
+
+      PyObject* PyNamespace(triton::API* api) {
+        Namespace_Object* object;
+
+        PyType_Ready(&Namespace_Type);
+        object = PyObject_NEW(Namespace_Object, &Namespace_Type);
+        if (object != NULL) {
+          object->name = xPyString_FromString("registers");
+          object->dict = xPyDict_New();
+          object->fill = nullptr;
+          object->api  = api;
+        }
+
+        return (PyObject*)object;
+      }
+
+
+      void PyNamespace_Detach(PyObject* self) {
+        ((Namespace_Object*)self)->api = nullptr;
+      }
+
+    }; /* python namespace */
+  }; /* bindings namespace */
+}; /* triton namespace */
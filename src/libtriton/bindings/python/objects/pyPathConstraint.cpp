@@ -78,6 +78,13 @@ of the branch instruction and the destination address is the destination of the
 is the source address and 0x55667788 is the destination if and only if the branch is taken, otherwise the destination is the next
 instruction address.
 
+- <b>integer getCount(void)</b><br>
+Returns the number of times the branch was taken, the loop iterations it summarizes (see \ref py_MODE_page `PC_LOOP_SUMMARIZATION`)
+and its duplicates (see \ref py_MODE_page `PC_DEDUPLICATION`) included.
+
+- <b>[\ref py_AstNode_page, ...] getIterations(void)</b><br>
+Returns the taken predicates of the loop iterations summarized, oldest first. Empty if it does not summarize iterations.
+
 - <b>integer getTakenAddress(void)</b><br>
 Returns the address of the taken branch.
 
@@ -129,6 +136,32 @@ namespace triton {
       }
 
 
+      static PyObject* PathConstraint_getCount(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyPathConstraint_AsPathConstraint(self)->getCount());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* PathConstraint_getIterations(PyObject* self, PyObject* noarg) {
+        try {
+          const auto& iterations = PyPathConstraint_AsPathConstraint(self)->getIterations();
+          PyObject* ret = xPyList_New(iterations.size());
+
+          for (triton::usize index = 0; index != iterations.size(); index++)
+            PyList_SetItem(ret, index, PyAstNode(iterations[index]));
+
+          return ret;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* PathConstraint_getTakenAddress(PyObject* self, PyObject* noarg) {
         try {
           return PyLong_FromUint64(PyPathConstraint_AsPathConstraint(self)->getTakenAddress());
@@ -174,6 +207,8 @@ namespace triton {
       //! PathConstraint methods.
       PyMethodDef PathConstraint_callbacks[] = {
         {"getBranchConstraints",        PathConstraint_getBranchConstraints,      METH_NOARGS,    ""},
+        {"getCount",                    PathConstraint_getCount,                  METH_NOARGS,    ""},
+        {"getIterations",               PathConstraint_getIterations,             METH_NOARGS,    ""},
         {"getTakenAddress",             PathConstraint_getTakenAddress,           METH_NOARGS,    ""},
         {"getTakenPredicate",           PathConstraint_getTakenPredicate,         METH_NOARGS,    ""},
         {"getThreadId",                 PathConstraint_getThreadId,               METH_NOARGS,    ""},
@@ -0,0 +1,331 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <triton/pythonObjects.hpp>
+#include <triton/pythonUtils.hpp>
+#include <triton/pythonXFunctions.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/solverFuture.hpp>
+
+
+
+/*! \page py_SolverFuture_page SolverFuture
+    \brief [**python api**] All information about the SolverFuture Python object.
+
+\tableofcontents
+
+\section py_SolverFuture_description Description
+<hr>
+
+This object is the handle of a query solved in the background, returned by `TritonContext.getModelAsync()` and
+`TritonContext.isSatAsync()`. The query is a copy of the constraint, the context may keep processing instructions
+while it is solved. The accessors of the answer wait for the query to be done, releasing the GIL. A cancelled query
+is interrupted if it is running and its status is `SOLVER_STATE.UNKNOWN`.
+
+~~~~~~~~~~~~~{.py}
+>>> from triton import TritonContext, ARCH, SOLVER_STATE
+
+>>> ctxt = TritonContext(ARCH.X86_64)
+>>> ast = ctxt.getAstContext()
+>>> x = ast.variable(ctxt.newSymbolicVariable(8))
+
+>>> future = ctxt.getModelAsync(x * ast.bv(3, 8) == ast.bv(21, 8))
+>>> future.getStatus() == SOLVER_STATE.SAT
+True
+>>> hex(future.getModel()[0].getValue())
+'0x7'
+
+~~~~~~~~~~~~~
+
+\section SolverFuture_py_api Python API - Methods of the SolverFuture class
+<hr>
+
+- <b>void cancel(void)</b><br>
+Cancels the query. It is interrupted if it is running.
+
+- <b>dict getModel(void)</b><br>
+Returns the model of the query as a dictionary of {integer SymVarId : \ref py_SolverModel_page model}, once done. It is empty
+for a `isSatAsync()` query.
+
+- <b>integer getSolvingTime(void)</b><br>
+Returns the solving time (in milliseconds), once done.
+
+- <b>\ref py_SOLVER_STATE_page getStatus(void)</b><br>
+Returns the status of the query, once done.
+
+- <b>bool isCancelled(void)</b><br>
+Returns true if the query is cancelled.
+
+- <b>bool isDone(void)</b><br>
+Returns true if the query is done.
+
+- <b>bool isSat(void)</b><br>
+Returns true if the query is satisfiable, once done.
+
+- <b>bool wait(integer timeout=None)</b><br>
+Waits for the query to be done, at most `timeout` milliseconds if defined. Returns true if the query is done.
+
+*/
+
+
+
+namespace triton {
+  namespace bindings {
+    namespace python {
+
+      //! SolverFuture destructor.
+      void SolverFuture_dealloc(PyObject* self) {
+        std::cout << std::flush;
+        delete PySolverFuture_AsSolverFuture(self);
+        Py_TYPE(self)->tp_free((PyObject*)self);
+      }
+
+
+      static PyObject* SolverFuture_cancel(PyObject* self, PyObject* noarg) {
+        try {
+          PySolverFuture_AsSolverFuture(self)->cancel();
+          Py_INCREF(Py_None);
+          return Py_None;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* SolverFuture_getModel(PyObject* self, PyObject* noarg) {
+        try {
+          auto* future = PySolverFuture_AsSolverFuture(self);
+
+          /* Solving may take a while, other Python threads may run */
+          Py_BEGIN_ALLOW_THREADS
+          future->wait();
+          Py_END_ALLOW_THREADS
+
+          PyObject* dict = xPyDict_New();
+          for (const auto& item : future->getModel())
+            xPyDict_SetItem(dict, PyLong_FromUsize(item.first), PySolverModel(item.second));
+
+          return dict;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* SolverFuture_getSolvingTime(PyObject* self, PyObject* noarg) {
+        try {
+          auto* future = PySolverFuture_AsSolverFuture(self);
+
+          Py_BEGIN_ALLOW_THREADS
+          future->wait();
+          Py_END_ALLOW_THREADS
+
+          return PyLong_FromUint32(future->getSolvingTime());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* SolverFuture_getStatus(PyObject* self, PyObject* noarg) {
+        try {
+          auto* future = PySolverFuture_AsSolverFuture(self);
+
+          Py_BEGIN_ALLOW_THREADS
+          future->wait();
+          Py_END_ALLOW_THREADS
+
+          return PyLong_FromUint32(future->getStatus());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* SolverFuture_isCancelled(PyObject* self, PyObject* noarg) {
+        try {
+          if (PySolverFuture_AsSolverFuture(self)->isCancelled() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* SolverFuture_isDone(PyObject* self, PyObject* noarg) {
+        try {
+          if (PySolverFuture_AsSolverFuture(self)->isDone() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* SolverFuture_isSat(PyObject* self, PyObject* noarg) {
+        try {
+          auto* future = PySolverFuture_AsSolverFuture(self);
+
+          Py_BEGIN_ALLOW_THREADS
+          future->wait();
+          Py_END_ALLOW_THREADS
+
+          if (future->isSat() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* SolverFuture_wait(PyObject* self, PyObject* args, PyObject* kwargs) {
+        PyObject* timeout = nullptr;
+        bool done = true;
+
+        static char* keywords[] = {
+          (char*)"timeout",
+          nullptr
+        };
+
+        /* Extract Keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|O", keywords, &timeout) == false) {
+          return PyErr_Format(PyExc_TypeError, "SolverFuture::wait(): Invalid keyword argument.");
+        }
+
+        if (timeout != nullptr && timeout != Py_None && (!PyLong_Check(timeout) && !PyInt_Check(timeout))) {
+          return PyErr_Format(PyExc_TypeError, "SolverFuture::wait(): Expects an integer as timeout keyword.");
+        }
+
+        try {
+          auto* future = PySolverFuture_AsSolverFuture(self);
+
+          if (timeout == nullptr || timeout == Py_None) {
+            Py_BEGIN_ALLOW_THREADS
+            future->wait();
+            Py_END_ALLOW_THREADS
+          }
+          else {
+            triton::uint32 ms = PyLong_AsUint32(timeout);
+            Py_BEGIN_ALLOW_THREADS
+            done = future->waitFor(ms);
+            Py_END_ALLOW_THREADS
+          }
+
+          if (done == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      //! SolverFuture methods.
+      PyMethodDef SolverFuture_callbacks[] = {
+        {"cancel",          SolverFuture_cancel,                                          METH_NOARGS,                   ""},
+        {"getModel",        SolverFuture_getModel,                                        METH_NOARGS,                   ""},
+        {"getSolvingTime",  SolverFuture_getSolvingTime,                                  METH_NOARGS,                   ""},
+        {"getStatus",       SolverFuture_getStatus,                                       METH_NOARGS,                   ""},
+        {"isCancelled",     SolverFuture_isCancelled,                                     METH_NOARGS,                   ""},
+        {"isDone",          SolverFuture_isDone,                                          METH_NOARGS,                   ""},
+        {"isSat",           SolverFuture_isSat,                                           METH_NOARGS,                   ""},
+        {"wait",            (PyCFunction)(void*)(PyCFunctionWithKeywords)SolverFuture_wait, METH_VARARGS | METH_KEYWORDS,  ""},
+        {nullptr,           nullptr,                                                      0,                             nullptr}
+      };
+
+
+      PyTypeObject SolverFuture_Type = {
+        PyVarObject_HEAD_INIT(&PyType_Type, 0)
+        "SolverFuture",                             /* tp_name */
+        sizeof(SolverFuture_Object),                /* tp_basicsize */
+        0,                                          /* tp_itemsize */
+        (destructor)SolverFuture_dealloc,           /* tp_dealloc */
+        #if IS_PY3_8
+        0,                                          /* tp_vectorcall_offset */
+        #else
+        0,                                          /* tp_print */
+        #endif
+        0,                                          /* tp_getattr */
+        0,                                          /* tp_setattr */
+        0,                                          /* tp_compare */
+        0,                                          /* tp_repr */
+        0,                                          /* tp_as_number */
+        0,                                          /* tp_as_sequence */
+        0,                                          /* tp_as_mapping */
+        0,                                          /* tp_hash */
+        0,                                          /* tp_call */
+        0,                                          /* tp_str */
+        0,                                          /* tp_getattro */
+        0,                                          /* tp_setattro */
+        0,                                          /* tp_as_buffer */
+        Py_TPFLAGS_DEFAULT,                         /* tp_flags */
+        "SolverFuture objects",                     /* tp_doc */
+        0,                                          /* tp_traverse */
+        0,                                          /* tp_clear */
+        0,                                          /* tp_richcompare */
+        0,                                          /* tp_weaklistoffset */
+        0,                                          /* tp_iter */
+        0,                                          /* tp_iternext */
+        SolverFuture_callbacks,                     /* tp_methods */
+        0,                                          /* tp_members */
+        0,                                          /* tp_getset */
+        0,                                          /* tp_base */
+        0,                                          /* tp_dict */
+        0,                                          /* tp_descr_get */
+        0,                                          /* tp_descr_set */
+        0,                                          /* tp_dictoffset */
+        0,                                          /* tp_init */
+        0,                                          /* tp_alloc */
+        0,                                          /* tp_new */
+        0,                                          /* tp_free */
+        0,                                          /* tp_is_gc */
+        0,                                          /* tp_bases */
+        0,                                          /* tp_mro */
+        0,                                          /* tp_cache */
+        0,                                          /* tp_subclasses */
+        0,                                          /* tp_weaklist */
+        0,                                          /* tp_del */
+        #if IS_PY3
+          0,                                        /* tp_version_tag */
+          0,                                        /* tp_finalize */
+          #if IS_PY3_8
+            0,                                      /* tp_vectorcall */
+            #if !IS_PY3_9
+              0,                                    /* bpo-37250: kept for backwards compatibility in CPython 3.8 only */
+            #endif
+          #endif
+        #else
+          0                                         /* tp_version_tag */
+        #endif
+      };
+
+
+      PyObject* PySolverFuture(const triton::engines::solver::SolverFuture& future) {
+        SolverFuture_Object* object;
+
+        PyType_Ready(&SolverFuture_Type);
+        object = PyObject_NEW(SolverFuture_Object, &SolverFuture_Type);
+        if (object != NULL)
+          object->future = new triton::engines::solver::SolverFuture(future);
+
+        return (PyObject*)object;
+      }
+
+    }; /* python namespace */
+  }; /* bindings namespace */
+}; /* triton namespace */
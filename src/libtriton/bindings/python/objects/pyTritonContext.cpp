@@ -13,6 +13,10 @@
 #include <triton/exceptions.hpp>
 #include <triton/register.hpp>
 
+#include <exception>
+#include <fstream>
+#include <memory>
+
 
 
 /*! \page py_TritonContext_page TritonContext
@@ -34,13 +38,49 @@ libTriton offers Python bindings on top of its C++ API which allow you to build
 
 ~~~~~~~~~~~~~
 
+\subsection triton_py_threads Threads
+
+`getModel()`, `getModels()`, `isSat()`, `liftToLLVM()`, `processTrace()`, `simplify()` with the solver or LLVM and `synthesize()`
+release the GIL while the C++ code runs, and the callbacks take it back to run. Contexts do not share any state, so several threads may
+solve through their own contexts concurrently. A context is not thread-safe though: while one of these calls runs, other threads must not use
+the context nor its objects (nodes, expressions, variables). Threads which share a context must serialize their calls, e.g. with a
+`threading.Lock` per context.
+
+~~~~~~~~~~~~~{.py}
+>>> import threading
+>>>
+>>> def solve(ctx, lock, node, models):
+...     with lock:
+...         models.append(ctx.getModel(node))
+
+~~~~~~~~~~~~~
+
 \section tritonContext_py_api Python API - Methods of the TritonContext class
 <hr>
 
 \subsection TritonContext_py_api_methods Methods
 
-- <b>void addCallback(\ref py_CALLBACK_page kind, function cb)</b><br>
-Adds a callback at specific internal points. Your callback will be called each time the point is reached.
+- <b>void addCallback(\ref py_CALLBACK_page kind, function cb, [list ranges])</b><br>
+Adds a callback at specific internal points. Your callback will be called each time the point is reached. The `GET_CONCRETE_MEMORY_VALUE`
+and `SET_CONCRETE_MEMORY_VALUE` callbacks may take a list of `(start, end)` address ranges and of page addresses: they are then only
+called for the accesses overlapping one of them, which is checked without calling Python.
+
+- <b>void addSimplificationPass(string name)</b><br>
+Adds the native simplification pass `name`, applied by `simplify()` before the callbacks: `neutral` (`x + 0`, `x * 1`, ...), `absorbing`
+(`x * 0`, `x | -1`, ...), `idempotence` (`x & x`, `x | x`), `complement` (`x ^ x`, `x ^ ~x`, `x + ~x`, ...), `involution` (`~~x`, `--x`, ...),
+`absorption` (`x & (x | y)`, `x | (x & y)`) and `mba-linear`, which normalizes the linear mixed boolean-arithmetic expressions of up to
+4 operands, e.g. `(x & y) + (x | y)` to `x + y`. The passes are applied in this order.
+
+- <b>void addSolverProfile(string name, [string, ...] tactics=[], string engine="")</b><br>
+Adds a solver profile, or replaces the one of the same name: the z3 `tactics` applied in sequence, the last one deciding the query
+(e.g. `["simplify", "solve-eqs", "bit-blast", "sat"]`), and the Bitwuzla `engine` (e.g. `fun` or `prop`). Empty for their defaults.
+The profiles `default`, `qfbv` (that z3 pipeline) and `arithmetic` (the `prop` engine of Bitwuzla) are defined. See `setSolverProfile()`
+and `setSolverProfileSelection()`.
+
+- <b>void applyModel(dict model)</b><br>
+Sets the concrete values of the variables of a model, as returned by `getModel()` (a dictionary of \ref py_SolverModel_page by variable id),
+e.g. to validate a solution. It is the same as calling `setConcreteVariableValue()` for each variable, but the ASTs are re-evaluated once
+over all the nodes depending on them instead of once per variable.
 
 - <b>void assignSymbolicExpressionToMemory(\ref py_SymbolicExpression_page symExpr, \ref py_MemoryAccess_page mem)</b><br>
 Assigns a \ref py_SymbolicExpression_page to a \ref py_MemoryAccess_page area. **Be careful**, use this function only if you know what you are doing.
@@ -53,6 +93,10 @@ The symbolic expression (`symExpr`) must be aligned to the targeted size registe
 - <b>bool buildSemantics(\ref py_Instruction_page inst)</b><br>
 Builds the instruction semantics. Returns true if the instruction is supported. You must define an architecture before.
 
+- <b>[bool, ...] checkEquivalences([(\ref py_AstNode_page node1, \ref py_AstNode_page node2), ...])</b><br>
+Checks the equivalence of each pair of nodes and returns, for each one, true if it is equivalent, false if it is not and
+None if the solver could not tell (see `isEquivalent()`). The queries not refuted by the evaluation are sent to the solver together.
+
 - <b>void clearCallbacks(void)</b><br>
 Clears recorded callbacks.
 
@@ -65,9 +109,33 @@ Clears concrete values assigned to the memory cells.
 - <b>void clearConcreteMemoryValue(integer addr, integer size)</b><br>
 Clears concrete values assigned to the memory cells from `addr` to `addr + size`.
 
+- <b>void clearCoverage(void)</b><br>
+Clears the coverage of the processing (see `getCoverage()`).
+
 - <b>void clearPathConstraints(void)</b><br>
 Clears the current path predicate.
 
+- <b>void clearSimplificationCache(void)</b><br>
+Removes the results of `simplify()` cached for the solver and LLVM simplifications.
+
+- <b>void clearSimplificationMemo(void)</b><br>
+Removes the simplifications of the passes and callbacks memoized by `simplify()` and resets their statistics.
+
+- <b>void clearSolverCache(void)</b><br>
+Removes the answers recorded by the solver cache and resets its statistics.
+
+- <b>void clearSolverStatistics(void)</b><br>
+Resets the statistics of the solver queries (see `getSolverStatistics()`).
+
+- <b>void clearStatistics(void)</b><br>
+Resets the statistics of the processing (see `getStatistics()`).
+
+- <b>void clearSynthesisCache(void)</b><br>
+Removes the nodes cached by the synthesizer (see `synthesize()`).
+
+- <b>void clearTrace(void)</b><br>
+Removes the events recorded by the tracer (see `setTracing()`).
+
 - <b>void concretizeAllMemory(void)</b><br>
 Concretizes all symbolic memory references.
 
@@ -80,6 +148,9 @@ Concretizes a specific symbolic memory reference.
 - <b>void concretizeMemory(\ref py_MemoryAccess_page mem)</b><br>
 Concretizes a specific symbolic memory reference.
 
+- <b>void concretizeMemoryArea(integer baseAddr, integer size)</b><br>
+Concretizes the symbolic memory references of [baseAddr, baseAddr+size).
+
 - <b>void concretizeRegister(\ref py_Register_page reg)</b><br>
 Concretizes a specific symbolic register reference.
 
@@ -101,6 +172,19 @@ Disassembles a concrete memory area from `addr` and returns a list of at most `c
 - <b>[\ref py_Instruction_page inst, ...] disassembly(integer addr)</b><br>
 Disassembles a concrete memory area from `addr` to control flow instruction and returns a list of disassembled instructions.
 
+- <b>dict emulate(integer start, [integer, ...] stops=[], integer maxInstructions=0, bool stopOnSymbolicPc=False, dict hooks={}, bool syscalls=False, bool native=False)</b><br>
+Emulates from `start` in C++: decodes the instructions from the concrete memory and processes them block by block until an address of
+`stops` (`start` excepted), `maxInstructions` instructions if it is not 0, a control flow instruction leaving a symbolized program counter
+if `stopOnSymbolicPc` is true, undefined code or an unsupported instruction. `hooks` maps addresses to callables `hook(ctx, addr)` called
+before their instruction, with the program counter set to it; a hook returning `False` stops the emulation, otherwise it resumes from the
+concrete program counter, which the hook may change. Python is only called by the hooks. Returns a dictionary holding the \ref py_EMULATION_page
+`reason` of the stop, the `pc` to resume from, the number of `instructions` and `blocks` executed and the exit `status` of the program.
+With `syscalls`, the Linux syscalls of x86-64 and AArch64 are executed natively (`read`, `write`, `open`, `openat`, `close`, `fstat`, `mmap`,
+`brk`, `exit` and `exit_group`, see `setSyscallFile()`); a syscall without handler stops the emulation after its instruction.
+With `native`, the blocks starting without symbolized or tainted register run on Unicorn until they touch a symbolized or tainted page, a
+stop, a hook or a syscall, and the next block runs in Triton; the memory callbacks are not called and `native` holds the number of these
+instructions. Triton must be built with `UNICORN_INTERFACE` (see `VERSION.UNICORN_INTERFACE`), x86-64 and AArch64 only.
+
 - <b>void enableSymbolicEngine(bool flag)</b><br>
 Enables or disables the symbolic execution engine.
 
@@ -110,6 +194,21 @@ Enables or disables the taint engine.
 - <b>integer evaluateAstViaSolver(\ref py_AstNode_page node)</b><br>
 Evaluates an AST via the solver and returns the concrete value.
 
+- <b>dict explore(integer entry, integer strategy=EXPLORATION.GENERATIONAL, [integer, ...] exits=[], integer maxRuns=0, integer maxInstructions=100000, integer maxGenerations=0, integer timeLimit=0, bool parallel=False, integer timeout=0, bool unsatCores=False)</b><br>
+Explores the paths from `entry`, with the current values of the symbolic variables as first input. Each run forks the context, sets its input
+and processes the blocks until an address of `exits`, an undefined or unsupported instruction, or `maxInstructions` instructions. The branches
+not taken by a run are flipped to generate the next inputs, picked by the \ref py_EXPLORATION_page `strategy`. The exploration stops once the
+worklist is empty, after `maxRuns` runs or `timeLimit` milliseconds if they are not 0, and the seeds of a generation above `maxGenerations`
+are not flipped if it is not 0. `parallel`, `timeout` and `unsatCores` are the ones of `solveAllBranchFlips()`, the UNSAT cores of a run
+pruning the flips of the next ones. The values of the symbolic variables are restored once done. Returns a dictionary holding the number
+of `runs`, `instructions`, `flips`, `solved` and `pruned` flips, the covered `edges` as a list of (branch address, destination), the edge hits
+`bitmap` as bytes, and the `corpus` of the inputs which covered new edges as a list of dictionaries holding their `input` as
+{integer SymVarId : integer value}, `generation`, `score` (the number of new edges), `bound`, `srcAddr` and `dstAddr`.
+
+- <b>\ref py_TritonContext_page fork(void)</b><br>
+Returns a new context in the state of this one. Memories, registers, symbolic and taint states are shared until written,
+so that forking is cheap. Both contexts share the AST context and the modes. Callbacks are not copied.
+
 - <b>[\ref py_Register_page, ...] getAllRegisters(void)</b><br>
 Returns the list of all registers. Each item of this list is a \ref py_Register_page.
 
@@ -125,6 +224,10 @@ Returns the current AST representation mode.
 - <b>bytes getConcreteMemoryAreaValue(integer baseAddr, integer size)</b><br>
 Returns the concrete value of a memory area.
 
+- <b>void getConcreteMemoryAreaValue(integer baseAddr, buffer area)</b><br>
+Reads the concrete value of the memory area of `len(area)` bytes from `baseAddr` into `area`, a writable contiguous buffer such as a `bytearray`,
+a `memoryview` or a numpy array, without intermediate copies.
+
 - <b>integer getConcreteMemoryValue(integer addr)</b><br>
 Returns the concrete value of a memory cell.
 
@@ -137,6 +240,22 @@ Returns the concrete value of a register.
 - <b>integer getConcreteVariableValue(\ref py_SymbolicVariable_page symVar)</b><br>
 Returns the concrete value of a symbolic variable.
 
+- <b>dict getCoverage(void)</b><br>
+Returns the coverage recorded once `setCoverage()` is enabled, shared with the forks, as a dictionary holding the processed `addresses` as a
+sorted list, the `edges` as {(integer address of the control flow instruction, integer destination) : integer hits}, their `bitmap` of 65536
+hits by hash as bytes (the one of `explore()`), the `branches` of the path constraints as {(integer source, integer destination) : (integer
+taken, integer notTaken)} and the `uncovered` branches never taken as a list of (source, destination), in the order they were found.
+
+- <b>integer getExecutorThreads(void)</b><br>
+Returns the number of threads running the asynchronous queries, the portfolio solver and the parallel synthesis (see `setExecutorThreads()`).
+
+- <b>\ref py_AstNode_page getFlatPathPredicate(void)</b><br>
+Returns the current path predicate as one N-ary logical conjunction of each taken branch. Unlike the chain of binary conjunctions
+of `getPathPredicate()`, its depth does not grow with the path.
+
+- <b>dict getFunctionSummaries(void)</b><br>
+Returns the built-in function models bound to addresses as a dictionary of {integer addr : string symbol}.
+
 - <b>integer getGprBitSize(void)</b><br>
 Returns the size in bits of the General Purpose Registers.
 
@@ -149,13 +268,44 @@ Returns the AST corresponding to the \ref py_Immediate_page.
 - <b>\ref py_AstNode_page getMemoryAst(\ref py_MemoryAccess_page mem)</b><br>
 Returns the AST corresponding to the \ref py_MemoryAccess_page with the SSA form.
 
+- <b>[integer, ...] getMemoryTaintLabels(integer addr)</b><br>
+Returns the sorted taint labels of an address.
+
+- <b>[integer, ...] getMemoryTaintLabels(\ref py_MemoryAccess_page mem)</b><br>
+Returns the sorted union of the taint labels of a memory.
+
+- <b>dict getMemoryUsage(void)</b><br>
+Returns the memory used by each subsystem as a dictionary of {string subsystem : dict}, each subsystem being a dictionary with the number of
+its objects (`count`) and of its `bytes`: the live AST nodes (`astNodes`, which also holds the bytes `reserved` by the node pool and the live
+nodes by kind as a dictionary of {\ref py_AST_NODE_page kind : integer count} in `kinds`), the `symbolicExpressions`, the bytes of memory with
+a symbolic expression (`symbolicMemory`), the entries of the `alignedMemory`, the `taintedMemory` bytes, the `taintedRegisters`, the defined
+bytes of the `concreteMemory`, the pages read in place from the mapped areas (`mappedMemory`), shared with the contexts and processes
+mapping them, the `pathConstraints` and the entries of the `solverCache`, of the `simplificationCache` and of the
+`synthesisCache`. The counts are maintained incrementally. Apart from the AST nodes, the bytes are estimated and do not include the nodes
+and expressions the objects keep alive.
+
 - <b>dict getModel(\ref py_AstNode_page node, status=False, timeout=0)</b><br>
 Computes and returns a model as a dictionary of {integer symVarId : \ref py_SolverModel_page model} from a symbolic constraint.
 If status is True, returns a tuple of (dict model, \ref py_SOLVER_STATE_page status, integer solvingTime).
 
-- <b>[dict, ...] getModels(\ref py_AstNode_page node, integer limit, status=False, timeout=0)</b><br>
+- <b>\ref py_SolverFuture_page getModelAsync(\ref py_AstNode_page node, timeout=0)</b><br>
+Computes a model from a symbolic constraint on the threads of the solver (see `setSolverThreads()`) and returns its future at once.
+The constraint is copied, the context may keep processing instructions while it is solved.
+
+- <b>[dict, ...] getModels(\ref py_AstNode_page node, integer limit, status=False, timeout=0, variables=None, callback=None)</b><br>
 Computes and returns several models from a symbolic constraint. The `limit` is the number of models returned.
 If status is True, returns a tuple of ([dict model, ...], \ref py_SOLVER_STATE_page status, integer solvingTime).
+If `variables` is a list of \ref py_SymbolicVariable_page, the models are projected onto them: only their values are
+returned and two models are distinct if they differ on them. If `callback` is defined, it is called with each model as
+it is found instead of returning the list, the enumeration stops if it returns False, and the number of models is returned.
+
+- <b>dict getModelWithAssumptions([\ref py_AstNode_page, ...] assumptions, status=False, timeout=0)</b><br>
+Computes and returns a model as a dictionary of {integer symVarId : \ref py_SolverModel_page model} from the constraints of the solver
+session and the `assumptions`, which are not kept once the check is done. If status is True, returns a tuple of (dict model,
+\ref py_SOLVER_STATE_page status, integer solvingTime).
+
+- <b>integer getNumberOfSpilledPathConstraints(void)</b><br>
+Returns the number of path constraints whose predicates are spilled into the file set by `setPathConstraintsSpilling()` and not faulted in.
 
 - <b>\ref py_Register_page getParentRegister(\ref py_Register_page reg)</b><br>
 Returns the parent \ref py_Register_page from a \ref py_Register_page.
@@ -163,18 +313,41 @@ Returns the parent \ref py_Register_page from a \ref py_Register_page.
 - <b>[\ref py_Register_page, ...] getParentRegisters(void)</b><br>
 Returns the list of parent registers. Each item of this list is a \ref py_Register_page.
 
-- <b>[\ref py_PathConstraint_page, ...] getPathConstraints(void)</b><br>
-Returns the logical conjunction vector of path constraints as a list of \ref py_PathConstraint_page.
+- <b>\ref py_ListView_page getPathConstraints(void)</b><br>
+Returns the logical conjunction vector of path constraints as a lazy list of \ref py_PathConstraint_page.
 
 - <b>\ref py_AstNode_page getPathPredicate(void)</b><br>
-Returns the current path predicate as an AST of logical conjunction of each taken branch.
+Returns the current path predicate as an AST of logical conjunction of each taken branch. The conjunction is updated as the
+constraints are pushed and popped, asking it after each branch does not rebuild it.
 
 - <b>integer getPathPredicateSize(void)</b><br>
 Returns the size of the path predicate (number of constraints).
 
+- <b>\ref py_SYMBOLIC_page getPointerPolicy(integer addr=None)</b><br>
+Returns the policy of the dereferences of symbolic addresses by the instruction at `addr`, or the default policy if `addr` is not given
+(see `setPointerPolicy()`).
+
+- <b>dict getPointerStatistics(void)</b><br>
+Returns the dereferences of symbolic addresses by instruction, as a dictionary of {integer addr : dict}. Each dictionary of
+{string name : integer value} counts the `dereferences` of the instruction, the ones `concretized` without constraint, `constrained`,
+`forked` (with the `branches` of their path constraints) and kept `symbolic`, and the `fallbacks` of `SYMBOLIC.SYMBOLIC_POINTER` whose
+address reached too many cells.
+
+- <b>\ref py_AstNode_page getPredicateToFlipIteration(integer index, integer iteration)</b><br>
+Returns the predicate which takes the loop iterations of the path constraint at `index` before `iteration`, and not `iteration`,
+after the path constraints before it. A path constraint which does not summarize iterations (see \ref py_MODE_page `PC_LOOP_SUMMARIZATION`)
+has the iteration 0.
+
 - <b>[\ref py_AstNode_page, ...] getPredicatesToReachAddress(integer addr)</b><br>
 Returns path predicates which may reach the targeted address.
 
+- <b>dict getProfile(integer n)</b><br>
+Returns the top `n` of the statistics recorded once `setStatistics()` is enabled, as a dictionary of {string name : list}: the `opcodes`
+which allocated the most AST nodes as [(integer type, {`instructions`, `nodes`, `expressions`}), ...], the `addresses` processed the most
+as [(integer address, {`instructions`, `nodes`, `expressions`}), ...] and the basic `blocks` entered the most as
+[(integer address, {`executions`, `instructions`, `nodes`}), ...], the first one being the costliest or the hottest.
+A basic block starts after each instruction which modifies the control flow.
+
 - <b>\ref py_Register_page getRegister(\ref py_REG_page id)</b><br>
 Returns the \ref py_Register_page class corresponding to a \ref py_REG_page id.
 
@@ -184,14 +357,92 @@ Returns the \ref py_Register_page class corresponding to a string.
 - <b>\ref py_AstNode_page getRegisterAst(\ref py_Register_page reg)</b><br>
 Returns the AST corresponding to the \ref py_Register_page with the SSA form.
 
+- <b>integer getRegisterTaintBits(\ref py_Register_page reg)</b><br>
+Returns the tainted bits of a register, from its lowest bit. All the bits of a tainted register are tainted, unless
+\ref py_MODE_page `TAINT_BIT_PRECISE` tracks them.
+
+- <b>[integer, ...] getRegisterTaintLabels(\ref py_Register_page reg)</b><br>
+Returns the sorted taint labels of a register.
+
+- <b>\ref py_AstNode_page getRelevantPathPredicate(\ref py_AstNode_page node)</b><br>
+Returns the logical conjunction of the path constraints which share symbolic variables with `node`, directly or through other
+path constraints. The constraints are partitioned by the variables they share, so that solving `node` with this predicate only
+gives the solver the constraints it depends on, e.g. `getModel(land([getRelevantPathPredicate(lnot(pc)), lnot(pc)]))`. The variables
+of the other constraints are not in the model and keep their values.
+
+- <b>integer getSimplificationCacheSize(void)</b><br>
+Returns the number of results of the solver and LLVM simplifications cached.
+
+- <b>[string, ...] getSimplificationPasses(void)</b><br>
+Returns the names of the native simplification passes added, in their order.
+
+- <b>dict getSimplificationStatistics(void)</b><br>
+Returns the statistics of `simplify()` as a dictionary of {string name : value}, with the `memoHits`, the nodes whose simplification
+was memoized, and the `passes`, a dictionary of {string name : dict} giving the `calls` and `rewrites` of each native pass.
+
 - <b>\ref py_SOLVER_page getSolver(void)</b><br>
 Returns the SMT solver engine currently used.
 
+- <b>dict getSolverAnalyticStatistics(void)</b><br>
+Returns the statistics of the analytic solver (see `setSolverAnalytic()`) as a dictionary of {string name : integer value}, with the
+`queries` analyzed, the ones `decided` without solver, the ones whose residue was `delegated` to the solver and the `variables` solved
+analytically.
+
+- <b>dict getSolverBudgetStatistics(void)</b><br>
+Returns the state of the adaptive timeouts of the branch flips (see `setSolverAdaptiveTimeouts()`) as a dictionary of {string name : integer value},
+with the `budget` of the exploration (0 for unlimited), the solving time `spent` and the flips `retried` after a timeout, in milliseconds for the times.
+
+- <b>dict getSolverCacheStatistics(void)</b><br>
+Returns the statistics of the solver cache as a dictionary of {string name : integer value}, with the `hits` and `misses` of the
+queries, the `counterexamples` answering queries which missed it (a recent model, the concrete values or a recent UNSAT query)
+and the `size` of the cache.
+
+- <b>dict getSolverLocalSearchStatistics(void)</b><br>
+Returns the statistics of the local search solver (see `SOLVER.LOCAL_SEARCH`) as a dictionary of {string name : integer value}, with
+the queries answered by the search (`hits`) and the ones handed off to the fallback solver (`handoffs`).
+
+- <b>\ref py_SOLVER_page getSolverPortfolioWinner(void)</b><br>
+Returns the solver which answered the last query of the portfolio solver (see `SOLVER.PORTFOLIO`) first, or None if none answered.
+
+- <b>dict getSolverPortfolioWins(void)</b><br>
+Returns the number of queries the solvers of the portfolio solver answered first, as a dictionary of {\ref py_SOLVER_page solver : integer value}.
+
+- <b>dict getSolverPreprocessingStatistics(void)</b><br>
+Returns the statistics of the preprocessing of the queries (see `setSolverPreprocessing()`) as a dictionary of {string name : integer value},
+with the `queries` preprocessed, the ones `decided` without solver, the variables `fixed` to a constant and `eliminated` with their defining
+equality, the conjuncts `dropped` and the zero extensions `narrowed`.
+
+- <b>dict getSolverProfileStatistics(void)</b><br>
+Returns the number of queries solved with each solver profile as a dictionary of {string name : integer value}.
+
+- <b>dict getSolverStatistics(void)</b><br>
+Returns the statistics of the solver queries recorded once `setSolverStatistics()` is enabled, as a dictionary of {string name : value}, with
+the queries answered by status (`sat`, `unsat`, `timeout`, `outofmem` and `unknown`), the ones answered by the solver cache (`hits`), the
+`histogram` of the solving times as a list of counts by decade of milliseconds (`[0, 1)`, `[1, 10)`, ..., `[100000, inf)`), the total solving
+`time` in milliseconds, the `nodes` translated for the solver and the ones of the `largest` query, the `memory` peak in megabytes (Triton and
+its solver processes) and the number of `slow` queries written (see `setSolverSlowQueryDump()`).
+
+- <b>integer getSolverThreads(void)</b><br>
+Returns the maximum number of queries of `getModelAsync()` and `isSatAsync()` solved at once.
+
+- <b>dict getStatistics(void)</b><br>
+Returns the statistics of the processing recorded once `setStatistics()` is enabled, as a dictionary of {string name : value}, with the
+`instructions` processed, the AST `nodes` they allocated and the symbolic `expressions` they kept, the `phases` of the processing as a
+dictionary of {string phase : {`count`, `time`}} with the times in nanoseconds (`disassembly`, `preIrInit`, `semantics`, `postIrInit`,
+`taint`, `pathConstraint` and `callbacks`) and the `opcodes` as a dictionary of {integer type : {`instructions`, `nodes`, `expressions`}}.
+The phases nest: the time of the semantics includes the one of the taint, of the path constraints and of the callbacks they trigger.
+
+- <b>integer getSymbolicDepthLimit(void)</b><br>
+Returns the maximum depth of the ASTs of new expressions with `MODE.AST_DEPTH_LIMIT` (see `setSymbolicDepthLimit()`).
+
+- <b>\ref py_SYMBOLIC_page getSymbolicDepthPolicy(void)</b><br>
+Returns the policy applied to the ASTs of new expressions deeper than the depth limit.
+
 - <b>\ref py_SymbolicExpression_page getSymbolicExpression(integer symExprId)</b><br>
 Returns the symbolic expression corresponding to an id.
 
-- <b>dict getSymbolicExpressions(void)</b><br>
-Returns all symbolic expressions as a dictionary of {integer SymExprId : \ref py_SymbolicExpression_page expr}.
+- <b>\ref py_MapView_page getSymbolicExpressions(void)</b><br>
+Returns all symbolic expressions as a lazy dictionary of {integer SymExprId : \ref py_SymbolicExpression_page expr}.
 
 - <b>dict getSymbolicMemory(void)</b><br>
 Returns the map of symbolic memory as {integer address : \ref py_SymbolicExpression_page expr}.
@@ -220,11 +471,17 @@ Returns the symbolic variable corresponding to a symbolic variable id.
 - <b>\ref py_SymbolicVariable_page getSymbolicVariable(string symVarName)</b><br>
 Returns the symbolic variable corresponding to a symbolic variable name.
 
-- <b>dict getSymbolicVariables(void)</b><br>
-Returns all symbolic variables as a dictionary of {integer SymVarId : \ref py_SymbolicVariable_page var}.
+- <b>\ref py_MapView_page getSymbolicVariables(void)</b><br>
+Returns all symbolic variables as a lazy dictionary of {integer SymVarId : \ref py_SymbolicVariable_page var}.
+
+- <b>integer getSynthesisCacheSize(void)</b><br>
+Returns the number of nodes cached by the synthesizer, the ones which cannot be synthesized included.
 
-- <b>[integer, ...] getTaintedMemory(void)</b><br>
-Returns the list of all tainted addresses.
+- <b>bytes getSyscallFile(string path)</b><br>
+Returns the content of the file `path` of the emulated syscalls, like `/dev/stdout`.
+
+- <b>\ref py_ListView_page getTaintedMemory(void)</b><br>
+Returns the lazy list of all tainted addresses, sorted.
 
 - <b>[\ref py_Register_page, ...] getTaintedRegisters(void)</b><br>
 Returns the list of all tainted registers.
@@ -232,6 +489,16 @@ Returns the list of all tainted registers.
 - <b>[\ref py_SymbolicExpression_page, ...] getTaintedSymbolicExpressions(void)</b><br>
 Returns the list of all tainted symbolic expressions.
 
+- <b>integer getThread(void)</b><br>
+Returns the id of the guest thread whose registers are the current ones. By default, 0.
+
+- <b>[integer, ...] getThreads(void)</b><br>
+Returns the ids of the guest threads which have registers, the current one included.
+
+- <b>[\ref py_AstNode_page, ...] getUnsatCore([\ref py_AstNode_page, ...] conjuncts, timeout=0)</b><br>
+Returns an UNSAT core of the logical `conjuncts`, a subset of them whose conjunction is UNSAT, or an empty list if their conjunction
+is not UNSAT. The core is not minimal. It is recorded into the solver cache, a query containing all its conjuncts being UNSAT.
+
 - <b>bool isArchitectureValid(void)</b><br>
 Returns true if the architecture is valid.
 
@@ -241,6 +508,10 @@ Returns true if memory cells have a defined concrete value.
 - <b>bool isConcreteMemoryValueDefined(integer addr, integer size)</b><br>
 Returns true if memory cells have a defined concrete value.
 
+- <b>bool isEquivalent(\ref py_AstNode_page node1, \ref py_AstNode_page node2)</b><br>
+Returns true if both nodes are equivalent. They are evaluated on corner and random inputs first, their difference
+refuting them without the solver, and the solver is only queried (through the cache of its answers) if they agree.
+
 - <b>bool isFlag(\ref py_Register_page reg)</b><br>
 Returns true if the register is a flag.
 
@@ -259,6 +530,9 @@ Returns true if the memory is tainted.
 - <b>bool isModeEnabled(\ref py_MODE_page mode)</b><br>
 Returns true if the mode is enabled.
 
+- <b>bool isOpaquePredicate(\ref py_AstNode_page node)</b><br>
+Returns true if the logical node is an opaque predicate, i.e. always true or always false (see `isEquivalent()`).
+
 - <b>bool isRegister(\ref py_Register_page reg)</b><br>
 Returns true if the register is a register (see also isFlag()).
 
@@ -274,6 +548,12 @@ Returns true if the register is valid.
 - <b>bool isSat(\ref py_AstNode_page node)</b><br>
 Returns true if an expression is satisfiable.
 
+- <b>\ref py_SolverFuture_page isSatAsync(\ref py_AstNode_page node, timeout=0)</b><br>
+Checks the satisfiability of an expression on the threads of the solver (see `setSolverThreads()`) and returns its future at once.
+
+- <b>bool isSymbolicBudgetExceeded(void)</b><br>
+Returns true if the live AST nodes or the symbolic expressions exceed the budget of the symbolic engine.
+
 - <b>bool isSymbolicEngineEnabled(void)</b><br>
 Returns true if the symbolic execution engine is enabled.
 
@@ -286,17 +566,53 @@ Returns true if the taint engine is enabled.
 - <b>bool isThumb(void)</b><br>
 Returns true if execution mode is Thumb (only valid for ARM32).
 
+- <b>string liftToC(\ref py_AstNode_page node, string fname="__triton")</b><br>
+Lifts an AST node and all its references to a self-contained C function named `fname`, which any C compiler builds without Triton nor LLVM.
+The bitvectors of 64 bits or less are `uint64_t`, the ones of 128 bits or less are `unsigned __int128`, and each node used is computed once into a local.
+The symbolic variables are the arguments of the function, ordered by id.
+
+- <b>string liftToC(\ref py_SymbolicExpression_page expr, string fname="__triton")</b><br>
+Lifts a symbolic expression and all its references to a self-contained C function named `fname`.
+
+- <b>string liftToC([\ref py_Instruction_page, ...] block, string fname="__triton")</b><br>
+Lifts a basic block (or a trace segment) into one self-contained C function named `fname`, with the same arguments as `liftToLLVM()`. The context is not modified.
+
 - <b>string liftToLLVM(\ref py_AstNode_page node, string fname="__triton", bool optimize=False)</b><br>
 Lifts an AST node and all its references to LLVM IR. `fname` is the name of the LLVM function, by default it's `__triton`. If `optimize` is true, perform optimizations (-O3 -Oz).
 
 - <b>string liftToLLVM(\ref py_SymbolicExpression_page expr, string fname="__triton", bool optimize=False)</b><br>
 Lifts a symbolic expression and all its references to LLVM IR. `fname` is the name of the LLVM function, by default it's `__triton`. If `optimize` is true, perform optimizations (-O3 -Oz).
 
-- <b>string liftToPython(\ref py_SymbolicExpression_page expr)</b><br>
-Lifts a symbolic expression and all its references to Python format.
+- <b>string liftToLLVM([\ref py_AstNode_page, ...] nodes, string fname="__triton", bool optimize=False)</b><br>
+Lifts a list of AST nodes (or symbolic expressions) and all their references into one LLVM module. The function of the i-th node is named `fname_i`. If `optimize` is true, perform optimizations (-O3 -Oz) once on the whole module.
+
+- <b>string liftToLLVM([\ref py_Instruction_page, ...] block, string fname="__triton", bool optimize=False)</b><br>
+Lifts a basic block (or a trace segment) into one LLVM function named `fname`. The block is executed from the current concrete state, without modifying the context. The registers and the memory read by the block are the input arguments of the function (named `rax`, `mem_0x1000`, ...), the registers and the memory it writes are output pointer arguments (named `rax_out`, `mem_0x1000_out`, ...). If `optimize` is true, perform optimizations (-O3 -Oz).
+
+- <b>string liftToPython(\ref py_SymbolicExpression_page expr, bool shared=False)</b><br>
+Lifts a symbolic expression and all its references to Python format. If `shared` is true, nodes used more than once are assigned once, in topological order, and deeply nested nodes are assigned too so that the code compiles fast.
+
+- <b>string liftToSMT(\ref py_SymbolicExpression_page expr, bool assert_=False, bool shared=False)</b><br>
+Lifts a symbolic expression and all its references to SMT format. If `assert_` is true, then (assert <expr>). If `shared` is true,
+nodes used more than once are defined once with `define-fun`.
 
-- <b>string liftToSMT(\ref py_SymbolicExpression_page expr, bool assert_=False)</b><br>
-Lifts a symbolic expression and all its references to SMT format. If `assert_` is true, then (assert <expr>).
+- <b>void loadSnapshot(string path)</b><br>
+Replaces the state of the context by the one saved at `path` by `saveSnapshot()`. The file is mapped in memory and its pages of memory
+are read in place until they are written, so that restoring a large state is near-instant.
+
+- <b>void loadSynthesisCache(string path)</b><br>
+Adds the nodes of the cache saved at `path` by `saveSynthesisCache()` to the cache of the synthesizer.
+
+- <b>void mapConcreteMemoryArea(integer baseAddr, buffer area)</b><br>
+Sets the concrete value of a memory area to a contiguous buffer (`bytes`, `bytearray`, `memoryview`, `mmap`, numpy array, ...), without copying
+it. The pages fully covered by the area are only copied once they are written, and the buffer is kept alive as long as the memory (and its copies)
+use it. The changes of a mutable buffer are seen by the pages not written yet.
+
+- <b>integer mapConcreteMemoryFile(integer baseAddr, string path, integer offset=0, integer size=0)</b><br>
+Sets the concrete value of a memory area to the `size` bytes of the file at `path` from `offset`, to the end of the file if `size` is 0, and returns
+the number of bytes mapped. The file is mapped read-only, its pages are only loaded once they are read and copied once they are written.
+The contexts of the process mapping the same part of a file share its mapping, and the processes share its pages, so the text of a binary
+loaded by many workers is held once.
 
 - <b>\ref py_SymbolicExpression_page newSymbolicExpression(\ref py_AstNode_page node, string comment)</b><br>
 Returns a new symbolic expression. Note that if there are simplification passes recorded, simplifications will be applied.
@@ -307,18 +623,76 @@ Returns a new symbolic variable.
 - <b>void popPathConstraint(void)</b><br>
 Pops the last constraints added to the path predicate.
 
+- <b>void popSolverScope(integer count=1)</b><br>
+Closes the `count` innermost scopes of the solver session and drops the constraints asserted in them.
+
+- <b>tuple processBlock(integer addr)</b><br>
+Decodes and processes the instructions from `addr` up to a control flow instruction, an unsupported instruction or undefined code. Returns a tuple of ([\ref py_Instruction_page inst, ...], integer next), `next` being the concrete program counter after the control flow instruction, otherwise the address where the block stopped. You must define an architecture before.
+
+- <b>integer processTrace(buffer|string trace, \ref py_TRACE_page format, integer decoders=0)</b><br>
+Processes the instructions of a trace in order and returns the number of instructions processed. The trace is either a buffer (bytes, bytearray,
+memoryview...), which is read in place, or the path of a file, which is mapped in memory. The registers and memory cells of a record are set before
+its instruction is processed. A `TRACE.COMPACT` trace only sets the recorded values which differ from the emulated ones (the memory writes after the
+instruction), so the symbolic state the trace agrees with is kept, and each of its threads has its own registers. The trace is read and processed
+without the GIL (see \ref triton_py_threads). With `decoders` threads, the instructions are decoded ahead of their processing, which hides most of
+the decoding cost (the Arm32 traces are always decoded sequentially). You must define an architecture before.
+
 - <b>bool processing(\ref py_Instruction_page inst)</b><br>
-Processes an instruction and updates engines according to the instruction semantics. Returns true if the instruction is supported. You must define an architecture before.
+Processes an instruction and updates engines according to the instruction semantics. Returns true if the instruction is supported. A list of instructions is processed in order and true is returned if all of them are supported. You must define an architecture before.
 
 - <b>void pushPathConstraint(\ref py_AstNode_page node)</b><br>
 Pushs constraints to the current path predicate.
 
+- <b>void pushSolverConstraint(\ref py_AstNode_page node)</b><br>
+Asserts a constraint into the solver session. The constraint holds until the scope it was asserted in is popped. The solver session
+keeps the solver and the translation of the nodes across queries, so that the nodes shared with the constraints already asserted are
+not translated again.
+
+- <b>void pushSolverScope(void)</b><br>
+Opens a new scope in the solver session.
+
 - <b>void removeCallback(\ref py_CALLBACK_page kind, function cb)</b><br>
 Removes a recorded callback.
 
+- <b>void removeFunctionSummary(integer addr)</b><br>
+Removes the built-in function model bound to `addr`.
+
+- <b>void removeSimplificationPass(string name)</b><br>
+Removes the native simplification pass `name`.
+
+- <b>void removeMark(void)</b><br>
+Removes the mark of `setMark()`, if any.
+
+- <b>void removeThread(integer tid)</b><br>
+Removes the registers of the guest thread `tid`, which must not be the current one.
+
 - <b>void reset(void)</b><br>
 Resets everything.
 
+- <b>void resetPointerStatistics(void)</b><br>
+Clears the statistics of the dereferences of symbolic addresses (see `getPointerStatistics()`). The policies are kept.
+
+- <b>void resetSolverBudget(void)</b><br>
+Forgets the history of the branches of the adaptive timeouts and the solving time spent, for a new exploration.
+
+- <b>void resetSolverSession(void)</b><br>
+Drops all the scopes and constraints of the solver session.
+
+- <b>void rollbackToMark(void)</b><br>
+Restores the state marked by `setMark()`. Only the pages and the entries written since the mark are released, the mark is kept for the next
+rollbacks. The modes, callbacks and coverage are not restored.
+
+- <b>void saveSnapshot(string path)</b><br>
+Saves the state of the context at `path`: the architecture, the modes, the concrete registers and memory, the symbolic expressions,
+variables and path constraints, and the taint. Callbacks and the solver are not saved.
+
+- <b>void saveSynthesisCache(string path)</b><br>
+Saves the cache of the synthesizer at `path`. The nodes are keyed by their structure whatever their variables are, so that the subexpressions
+synthesized by a run are lookups in the next ones once the cache is loaded by `loadSynthesisCache()`.
+
+- <b>void saveTrace(string path)</b><br>
+Saves the events recorded by the tracer at `path` in the JSON format of Chrome (`chrome://tracing`, Perfetto), see `setTracing()`.
+
 - <b>void setArchitecture(\ref py_ARCH_page arch)</b><br>
 Initializes an architecture. This function must be called before any call to the rest of the API.
 
@@ -329,8 +703,9 @@ Sets the AST representation.
 Sets the concrete value of a memory area. Note that setting a concrete value will probably imply a desynchronization with
 the symbolic state (if it exists). You should probably use the concretize functions after this.
 
-- <b>void setConcreteMemoryAreaValue(integer baseAddr, bytes opcodes)</b><br>
-Sets the concrete value of a memory area. Note that setting a concrete value will probably imply a desynchronization with
+- <b>void setConcreteMemoryAreaValue(integer baseAddr, buffer area)</b><br>
+Sets the concrete value of a memory area to the bytes of a contiguous buffer (`bytes`, `bytearray`, `memoryview`, numpy array, ...), copied straight
+into the memory. Note that setting a concrete value will probably imply a desynchronization with
 the symbolic state (if it exists). You should probably use the concretize functions after this.
 
 - <b>void setConcreteMemoryValue(integer addr, integer value)</b><br>
@@ -348,34 +723,214 @@ the symbolic state (if it exists). You should probably use the concretize functi
 - <b>void setConcreteVariableValue(\ref py_SymbolicVariable_page symVar, integer value)</b><br>
 Sets the concrete value of a symbolic variable.
 
+- <b>void setCoverage(bool flag)</b><br>
+Enables or disables the coverage of the processing: the addresses processed, the edges of the control flow instructions and the branches of
+the path constraints taken or not (see `getCoverage()`). It is recorded natively, without a callback per instruction. By default, disabled.
+
+- <b>void setExecutorThreads(integer threads)</b><br>
+Defines the number of threads running the asynchronous queries, the portfolio solver and the parallel synthesis, at least one. The threads are
+shared by all the contexts of the process, and their tasks are stolen by the idle threads. Waits for the running tasks. By default, the number
+of hardware threads.
+
+- <b>void setFlippableIterations(integer count)</b><br>
+Defines the number of the most recent iterations of a loop branch which are not summarized with \ref py_MODE_page `PC_LOOP_SUMMARIZATION`,
+at least one. By default, 1.
+
+- <b>void setFunctionSummary(integer addr, string symbol)</b><br>
+Binds the built-in model of the libc function `symbol` (`memcpy`, `memmove`, `memset`, `strcmp`, `strlen` or `strncpy`) to `addr`.
+When the instruction at `addr` is processed, the model is executed instead: it reads its arguments from the calling convention of
+the architecture, updates the memories, sets the return value and returns to the caller. The loop over the bytes of a string is
+summarized by a single path constraint. The address of the function must be resolved by the caller (e.g. from the relocations of the binary).
+
+- <b>void setMark(void)</b><br>
+Marks the current state as the one restored by `rollbackToMark()`: the concrete, symbolic and taint registers and memory, the path constraints
+and the syscalls. The state is shared with the mark until written, so that a rollback costs what was written since the mark.
+
 - <b>void setMode(\ref py_MODE_page mode, bool flag)</b><br>
 Enables or disables a specific mode.
 
+- <b>void setPathConstraintsSpilling(string path, integer resident=1024)</b><br>
+Spills the cold path constraints into the file at `path`, keeping the `resident` most recent ones in memory. Once twice `resident` path
+constraints are in memory, the predicates of the oldest `resident` ones are serialized with the AST they depend on and released. They are
+faulted back in from the file when they are read, e.g. by `getPathConstraints()` or `getPathPredicate()`, and released again at the next
+spill, so that long runs keep a bounded memory and can still flip their old branches. The file is removed when no fork uses it. An empty
+path stops spilling.
+
+- <b>void setPointerPolicy(\ref py_SYMBOLIC_page policy, integer addr=None)</b><br>
+Defines how the instruction at `addr`, or every instruction without its own policy if `addr` is not given, dereferences a symbolic address.
+`SYMBOLIC.CONCRETIZE_POINTER` (the default) uses the concrete address. `SYMBOLIC.CONSTRAIN_POINTER` also pushes the path constraint that
+the address is the concrete one, so that the models keep the cells read. `SYMBOLIC.FORK_POINTER` pushes a path constraint with one branch
+per address the solver finds the pointer may take with the path predicate, the concrete one taken, so that the other addresses may be reached
+by flipping them. `SYMBOLIC.SYMBOLIC_POINTER` reads and writes the memory array as with \ref py_MODE_page `MEMORY_ARRAY` if the address
+reaches few enough cells, and constrains it otherwise. The load and the store of an instruction at the same address are constrained once.
+
+- <b>void setPointerPolicyLimits(integer arrayCells=1024, integer forkValues=8)</b><br>
+Defines the maximum number of cells the address of an access kept symbolic may reach (also with \ref py_MODE_page `MEMORY_ARRAY`), and the
+maximum number of branches of the path constraint of a fork, which costs a query of the solver per branch.
+
+- <b>bool setRegisterTaintBits(\ref py_Register_page reg, integer bits)</b><br>
+Sets the tainted bits of a register, from its lowest bit, the other bits of its parent keep their taint. Without
+\ref py_MODE_page `TAINT_BIT_PRECISE`, the register is tainted if a bit is. Returns true if a bit is tainted.
+
+- <b>void setSimplificationCacheCapacity(integer entries)</b><br>
+Defines the maximum number of results of the solver and LLVM simplifications cached, 4096 by default and 0 disables the cache.
+The results are recorded by the structural hash of the simplified node, so that the same subtree built again by another instruction is
+not simplified again. The least recently used result is evicted first. A result simplified again is returned as is.
+
+- <b>void setSimplificationIterations(integer iterations)</b><br>
+Defines the maximum number of times a node is rewritten by the simplification passes and callbacks until it stops changing, 16 by default.
+The simplifications are memoized by node, so that a subtree simplified and unchanged since is not simplified nor walked again until a
+callback or a pass is added or removed.
+
 - <b>void setSolver(\ref py_SOLVER_page solver)</b><br>
 Defines an SMT solver
 
+- <b>void setSolverAdaptiveTimeouts(bool flag)</b><br>
+Enables or disables the adaptive timeouts of `solveAllBranchFlips()`, which then replace its `timeout`. The timeout of a flip grows with the
+size of its query and follows the previous answers at the same branch address. The flips which time out are retried at 4 times their timeout
+once the other ones are done, up to the max timeout, and the flips left once the budget is spent are `SOLVER_STATE.UNKNOWN` (see
+`setSolverBudget()`). By default, disabled.
+
+- <b>void setSolverBudget(integer ms, integer base=1000, integer max=60000)</b><br>
+Defines the solving time of an exploration with the adaptive timeouts (0 for unlimited) and the base and max timeouts of a query, in milliseconds.
+The time spent is reset.
+
+- <b>void setSolverCacheCapacity(integer entries)</b><br>
+Defines the maximum number of answers recorded by the solver cache, 0 (the default) disables the cache. Once enabled, the SAT and UNSAT
+answers of `getModel()` and `isSat()` are recorded by the structural hash of their constraint, and an equivalent constraint built
+again over the same variables is answered without calling the solver. The least recently used answer is evicted first.
+
+- <b>void setSolverCacheFile(string path)</b><br>
+Defines the backing file of the solver cache. The answers it holds are loaded and the new ones are appended to it, so that they
+may be reused by another context or another run. An empty path detaches the file.
+
+- <b>void setSolverExternalCommand([string, ...])</b><br>
+Defines the command running the external solver (see `SOLVER.EXTERNAL`), e.g. `["cvc5", "--lang=smt2", "--incremental"]` or `["z3", "-in"]`.
+The solver reads the SMT-LIB2 commands on its standard input and answers on its standard output.
+
+- <b>void setSolverExternalPoolSize(integer size)</b><br>
+Defines the max number of idle processes of the external solver (see `SOLVER.EXTERNAL`) kept for the next queries. By default, 4.
+
 - <b>void setSolverMemoryLimit(integer megabytes)</b><br>
 Defines a solver memory consumption limit (in megabytes)
 
+- <b>void setSolverAnalytic(bool flag)</b><br>
+Enables or disables the analytic solving of the queries of `getModel()` and `isSat()`, after their preprocessing: the components of
+variables whose conjuncts are simple enough (linear comparisons of one variable to a constant, the flags of these comparisons and the
+equalities `x == y + c`) are solved as intervals in microseconds, and only the other conjuncts are sent to the solver. The models are
+completed with the values of these variables. By default, disabled.
+
+- <b>void setSolverLocalSearchBudget(integer ms)</b><br>
+Defines the time budget of the local search solver (see `SOLVER.LOCAL_SEARCH`) for each query, in milliseconds. By default, 100 ms.
+
+- <b>void setSolverLocalSearchFallback(\ref py_SOLVER_page solver)</b><br>
+Defines the solver the local search solver (see `SOLVER.LOCAL_SEARCH`) hands the queries off to once its budget is spent. By default, the
+SMT solver Triton is built with. If None, the queries the search does not solve are `SOLVER_STATE.UNKNOWN`.
+
+- <b>void setSolverPortfolio([\ref py_SOLVER_page, ...])</b><br>
+Defines the solvers raced by the portfolio solver (see `SOLVER.PORTFOLIO`). By default, all the solvers Triton is built with.
+
+- <b>void setSolverPreprocessing(bool flag)</b><br>
+Enables or disables the preprocessing of the queries of `getModel()` and `isSat()` before they are sent to the solver: the variables fixed
+to a constant are substituted, the variables defined by an equality and used nowhere else are eliminated, and the comparisons of zero
+extensions are narrowed. The models are completed with the values of these variables. By default, disabled.
+
+- <b>void setSolverProfile(string name)</b><br>
+Forces the solver profile `name` (see `addSolverProfile()`) for the queries of `getModel()`, `isSat()`, `getModels()` and their background
+tasks. If None, the profiles are selected by the class of the queries (see `setSolverProfileSelection()`).
+
+- <b>void setSolverProfileSelection(bool flag)</b><br>
+Enables or disables the selection of the solver profiles by the class of the queries: the queries whose multiplications, divisions
+and remainders (by a symbolic value) are at least one of their sixteen nodes are solved with the `arithmetic` profile, the other ones
+with the `qfbv` profile. Redefine these profiles to change how a class is solved. By default, disabled, the queries keep the default
+solvers.
+
+- <b>void setSolverRemoteEndpoints([string, ...])</b><br>
+Defines the solver servers of the remote solver (see `SOLVER.REMOTE`), e.g. `["solver1:7000", "solver2:7000"]`. A query goes to the
+server picked by its hash, the next ones are tried if it is down, and the query is UNKNOWN if none can be reached.
+
+- <b>void setSolverSlowQueryDump(string directory, integer ms)</b><br>
+Writes the queries solved in more than `ms` milliseconds into `directory`, as SMT-LIB2 scripts named by the hash of the query and headed by
+comments holding the solver, the status, the solving time, the timeout and the size of the query. The statistics must be enabled (see
+`setSolverStatistics()`). An empty `directory` writes none.
+
+- <b>void setSolverStatistics(bool flag)</b><br>
+Enables or disables the recording of the statistics of the solver queries (see `getSolverStatistics()`). By default, disabled.
+
+- <b>void setSolverThreads(integer threads)</b><br>
+Defines the maximum number of queries of `getModelAsync()` and `isSatAsync()` solved at once on the threads of the process
+(see `setExecutorThreads()`). By default, the number of hardware threads.
+
 - <b>void setSolverTimeout(integer ms)</b><br>
 Defines a solver timeout (in milliseconds)
 
+- <b>void setStatistics(bool flag)</b><br>
+Enables or disables the recording of the statistics of the processing (see `getStatistics()`). By default, disabled.
+
+- <b>void setSymbolicBudget(integer maxDepth=0, integer maxNodes=0, integer maxExpressions=0, \ref py_SYMBOLIC_page policy=SYMBOLIC.CONCRETIZE_DEEPEST_EXPRESSIONS)</b><br>
+Defines the budget of the symbolic engine. A limit of 0 is unbounded. A new expression deeper than `maxDepth` gets the concrete value of
+its AST, and deeper branches are not recorded as path constraints. When the live AST nodes exceed `maxNodes` or the symbolic expressions
+exceed `maxExpressions`, `policy` concretizes the registers and memory cells holding the deepest ASTs, concretizes the oldest memory cells
+or refuses new symbolic variables (and new symbolic expressions get their concrete value).
+
+- <b>void setSymbolicDepthLimit(integer depth, \ref py_SYMBOLIC_page policy=SYMBOLIC.CONCRETIZE_DEEP_EXPRESSION)</b><br>
+Defines the maximum depth of the ASTs of new expressions with `MODE.AST_DEPTH_LIMIT`, at least one. A deeper AST is replaced by its concrete
+value (`SYMBOLIC.CONCRETIZE_DEEP_EXPRESSION`) or by a fresh symbolic variable whose concrete value is the one of the AST
+(`SYMBOLIC.SYMBOLIZE_DEEP_EXPRESSION`), unless the budget refuses new symbolic variables. By default, 4096 and `SYMBOLIC.CONCRETIZE_DEEP_EXPRESSION`.
+
+- <b>void setSyscallFile(string path, bytes content, bool symbolize=False)</b><br>
+Defines the content of the file `path` of the emulated syscalls. The descriptors 0, 1 and 2 are opened on `/dev/stdin`, `/dev/stdout` and
+`/dev/stderr`. If `symbolize` is true, the bytes read from the file are symbolized at once.
+
+- <b>void setSyscallLayout(integer heap, integer mmap)</b><br>
+Defines the start of the heap and the address of the first mapping of the emulated syscalls, aligned on a page. By default, 0x10000000 and 0x7f0000000000.
+
 - <b>bool setTaintMemory(\ref py_MemoryAccess_page mem, bool flag)</b><br>
 Sets the targeted memory as tainted or not. Returns true if the memory is still tainted.
 
 - <b>bool setTaintRegister(\ref py_Register_page reg, bool flag)</b><br>
 Sets the targeted register as tainted or not. Returns true if the register is still tainted.
 
+- <b>void setThread(integer tid)</b><br>
+Switches the concrete, symbolic and taint registers to the ones of the guest thread `tid`, the memory is shared by all the threads.
+A new thread starts with a copy of the current registers. A switch does not depend on the number of registers which are symbolic
+or tainted, e.g. to process the instructions of several threads in the order they were scheduled.
+
 - <b>void setThumb(bool state)</b><br>
 Sets CPU state to Thumb mode (only valid for ARM32).
 
+- <b>void setTraceCapacity(integer capacity)</b><br>
+Defines the maximum number of events kept by the tracer, the oldest ones are overwritten. Clears the events. By default, 65536.
+
+- <b>void setTracing(bool flag)</b><br>
+Enables or disables the recording of the events of the processing, the solver, the garbage collections of the AST nodes and the
+synthesizer with their duration and their thread (see `saveTrace()`). By default, disabled.
+
+- <b>void shareDisassemblyCache(\ref py_TritonContext_page ctx)</b><br>
+Uses the cache of the decoded instructions of `ctx`, a context of the same architecture, e.g. to analyze the
+same binary from several contexts without decoding its instructions again. The Capstone handles are already
+shared by the contexts of the same architecture. Setting the architecture again gives the context its own cache.
+
 - <b>\ref py_AstNode_page simplify(\ref py_AstNode_page node, bool solver=False, bool llvm=False)</b><br>
 Calls all simplification callbacks recorded and returns a new simplified node. If the `solver` flag is
 set to True, Triton will use the current solver instance to simplify the given `node`. If `llvm` is true,
 we use LLVM to simplify node.
 
-- <b>dict sliceExpressions(\ref py_SymbolicExpression_page expr)</b><br>
-Slices expressions from a given one (backward slicing) and returns all symbolic expressions as a dictionary of {integer SymExprId : \ref py_SymbolicExpression_page expr}.
+- <b>\ref py_MapView_page sliceExpressions(\ref py_SymbolicExpression_page expr)</b><br>
+Slices expressions from a given one (backward slicing) and returns all symbolic expressions as a lazy dictionary of {integer SymExprId : \ref py_SymbolicExpression_page expr}.
+
+- <b>dict sliceExpressionsMany([\ref py_SymbolicExpression_page expr, ...])</b><br>
+Slices expressions from several ones and returns the union of their slices as a dictionary of {integer SymExprId : \ref py_SymbolicExpression_page expr}.
+Expressions the slices have in common are visited once.
+
+- <b>[dict, ...] solveAllBranchFlips(bool parallel=False, bool skipCovered=True, integer limit=0, integer timeout=0, bool unsatCores=False)</b><br>
+Solves the branches not taken by the path constraints, each one with the predicates taken before it, and returns them as a list of
+dictionaries holding the `index` of their path constraint, their `srcAddr`, `dstAddr` and `predicate`, and the `status`, `solvingTime`
+and `model` of their query. The predicates taken are asserted once into a solver session, or the queries are solved on the threads of
+the solver if `parallel` is true. If `skipCovered` is true, a branch taken by the trace or already flipped is skipped. At most `limit`
+branches are flipped if it is not 0, and `timeout` is the timeout (in milliseconds) of each query. If `unsatCores` is true, the UNSAT core
+of each UNSAT flip is computed (see `getUnsatCore()`) and returned as its `core`, and the next flips containing a core are UNSAT without
+the solver, their `pruned` being true.
 
 - <b>\ref py_SymbolicVariable_page symbolizeExpression(integer symExprId, integer symVarSize, string symVarAlias)</b><br>
 Converts a symbolic expression to a symbolic variable. `symVarSize` must be in bits. This function returns the new symbolic variable created.
@@ -383,11 +938,26 @@ Converts a symbolic expression to a symbolic variable. `symVarSize` must be in b
 - <b>\ref py_SymbolicVariable_page symbolizeMemory(\ref py_MemoryAccess_page mem, string symVarAlias)</b><br>
 Converts a symbolic memory expression to a symbolic variable. This function returns the new symbolic variable created.
 
+- <b>[\ref py_SymbolicVariable_page, ...] symbolizeMemoryArea(integer baseAddr, integer size, integer granularity=1, string aliasPrefix="")</b><br>
+Converts the memory area [baseAddr, baseAddr+size) to symbolic variables of `granularity` bytes, which must be a power of two dividing `size`.
+If `aliasPrefix` is given, the variables are aliased `aliasPrefix_0`, `aliasPrefix_1`... This function returns the list of the new symbolic variables created.
+
 - <b>\ref py_SymbolicVariable_page symbolizeRegister(\ref py_Register_page reg, string symVarAlias)</b><br>
 Converts a symbolic register expression to a symbolic variable. This function returns the new symbolic variable created.
 
-- <b>\ref py_AstNode_page synthesize(\ref py_AstNode_page node, bool constant=True, bool subexpr=True, bool opaque=False)</b><br>
+- <b>dict syncFuzzer(integer entry, string fuzzer, string output, [\ref py_SymbolicVariable_page, ...] input, [integer, ...] exits=[], integer maxInstructions=100000, bool newEdgesOnly=True, bool parallel=False, integer timeout=0, bool unsatCores=False, integer timeLimit=0, integer interval=1000)</b><br>
+Runs from `entry` the new testcases of the fuzzer instance directory `fuzzer` (e.g. `out/default` of AFL++) and writes back the inputs taking
+the branches it did not cover into the queue of `output`, a directory of its sync directory (e.g. `out/triton`) from which it imports them.
+The bytes of a testcase are the values of the byte variables of `input`, the runs stopping as the ones of `explore()`. The testcases after the
+last one synchronized are run, only the seeds and the ones tagged with `+cov` if `newEdgesOnly` is true, and the branches whose edge is not in
+the `fuzz_bitmap` of the fuzzer or covered by a previous run are flipped in one batch. The coverage map follows the layout of the QEMU mode of
+AFL and is saved in `output/fuzz_bitmap`. `parallel`, `timeout` and `unsatCores` are the ones of `solveAllBranchFlips()`. If `timeLimit` is not
+0, it synchronizes every `interval` milliseconds for `timeLimit` milliseconds. Returns a dictionary holding the number of new `entries`, of
+`skipped` ones, of `runs`, `instructions`, `flips`, `solved` and `pruned` flips, and of testcases `written`.
+
+- <b>\ref py_AstNode_page synthesize(\ref py_AstNode_page node, bool constant=True, bool subexpr=True, bool opaque=False, bool parallel=False)</b><br>
 Synthesizes a given node. If `constant` is defined to True, performs a constant synthesis. If `opaque` is true, perform opaque constant synthesis. If `subexpr` is defined to True, performs synthesis on sub-expressions.
+If `parallel` is defined to True, the oracles of the sub-expressions are looked up on all cores, the output is the same.
 
 - <b>bool taintAssignment(\ref py_MemoryAccess_page memDst, \ref py_Immediate_page immSrc)</b><br>
 Taints `memDst` from `immSrc` with an assignment - `memDst` is untained. Returns true if the `memDst` is still tainted.
@@ -411,14 +981,16 @@ Taints `regDst` from `MemSrc` with an assignment - `regDst` is tainted if `memSr
 Taints `regDst` from `regSrc` with an assignment - `regDst` is tainted if `regSrc` is tainted, otherwise
 `regDst` is untained. Return true if `regDst` is tainted.
 
-- <b>bool taintMemory(integer addr)</b><br>
-Taints an address. Returns true if the address is tainted.
+- <b>bool taintMemory(integer addr, integer label=None)</b><br>
+Taints an address. If a `label` is given, it is added to the taint labels of the address, they are merged
+by the spreading rules so that the labels of an item tell from which sources it comes. Returns true if the
+address is tainted.
 
-- <b>bool taintMemory(\ref py_MemoryAccess_page mem)</b><br>
-Taints a memory. Returns true if the memory is tainted.
+- <b>bool taintMemory(\ref py_MemoryAccess_page mem, integer label=None)</b><br>
+Taints a memory, with an optional `label` added to its taint labels. Returns true if the memory is tainted.
 
-- <b>bool taintRegister(\ref py_Register_page reg)</b><br>
-Taints a register. Returns true if the register is tainted.
+- <b>bool taintRegister(\ref py_Register_page reg, integer label=None)</b><br>
+Taints a register, with an optional `label` added to its taint labels. Returns true if the register is tainted.
 
 - <b>bool taintUnion(\ref py_MemoryAccess_page memDst, \ref py_Immediate_page immSrc)</b><br>
 Taints `memDst` from `immSrc` with an union - `memDst` does not changes. Returns true if `memDst` is tainted.
@@ -459,35 +1031,33 @@ namespace triton {
   namespace bindings {
     namespace python {
 
+      static void TritonContext_clearRegistersAttribute(PyObject* self) {
+        /* The registers attribute may outlive the context, it keeps the registers already accessed */
+        if (((TritonContext_Object*)(self))->regAttr != nullptr) {
+          PyNamespace_Detach(((TritonContext_Object*)(self))->regAttr);
+          Py_CLEAR(((TritonContext_Object*)(self))->regAttr);
+        }
+      }
+
+
       static void TritonContext_dealloc(PyObject* self) {
         if (((TritonContext_Object*)self)->ref == false)
           delete PyTritonContext_AsTritonContext(self);
-        Py_XDECREF(((TritonContext_Object*)self)->regAttr);
+        TritonContext_clearRegistersAttribute(self);
         Py_TYPE(self)->tp_free((PyObject*)self);
       }
 
 
-      static void TritonContext_fillRegistersAttribute(PyObject* self) {
-        /* Fill self->regAttr */
-        auto& regs = PyTritonContext_AsTritonContext(self)->getAllRegisters();
-
-        PyObject* registersDict = xPyDict_New();
-        for (auto& reg : regs)
-          xPyDict_SetItem(registersDict, xPyString_FromString(reg.second.getName().c_str()), PyRegister(reg.second));
-
-        Py_XDECREF(((TritonContext_Object*)(self))->regAttr);
-        ((TritonContext_Object*)(self))->regAttr = xPyClass_New(nullptr, registersDict, xPyString_FromString("registers"));
-      }
-
-
       static PyObject* TritonContext_addCallback(PyObject* self, PyObject* args) {
         PyObject* function = nullptr;
         PyObject* mode     = nullptr;
+        PyObject* ranges   = nullptr;
         PyObject* cb       = nullptr;
         PyObject* cb_self  = nullptr;
+        triton::callbacks::memoryRanges cranges;
 
         /* Extract arguments */
-        if (PyArg_ParseTuple(args, "|OO", &mode, &function) == false) {
+        if (PyArg_ParseTuple(args, "|OOO", &mode, &function, &ranges) == false) {
           return PyErr_Format(PyExc_TypeError, "TritonContext::addCallback(): Invalid number of arguments");
         }
 
@@ -497,6 +1067,33 @@ namespace triton {
         if (function == nullptr || !PyCallable_Check(function))
           return PyErr_Format(PyExc_TypeError, "TritonContext::addCallback(): Expects a function as second argument.");
 
+        /* The ranges only filter the accesses of the memory value callbacks */
+        if (ranges != nullptr && ranges != Py_None) {
+          triton::uint32 kind = PyLong_AsUint32(mode);
+          if (kind != callbacks::GET_CONCRETE_MEMORY_VALUE && kind != callbacks::SET_CONCRETE_MEMORY_VALUE)
+            return PyErr_Format(PyExc_TypeError, "TritonContext::addCallback(): Only GET_CONCRETE_MEMORY_VALUE and SET_CONCRETE_MEMORY_VALUE callbacks take ranges.");
+
+          if (!PyList_Check(ranges))
+            return PyErr_Format(PyExc_TypeError, "TritonContext::addCallback(): Expects a list of (start, end) ranges or page addresses as third argument.");
+
+          for (Py_ssize_t i = 0; i < PyList_Size(ranges); i++) {
+            PyObject* item = PyList_GetItem(ranges, i);
+            if (PyLong_Check(item) || PyInt_Check(item)) {
+              /* A page address, the range is the page holding it */
+              triton::uint64 page = PyLong_AsUint64(item) & ~static_cast<triton::uint64>(triton::arch::ConcreteMemory::pageSize - 1);
+              cranges.emplace_back(page, page + triton::arch::ConcreteMemory::pageSize);
+            }
+            else if (PyTuple_Check(item) && PyTuple_Size(item) == 2 &&
+                     (PyLong_Check(PyTuple_GetItem(item, 0)) || PyInt_Check(PyTuple_GetItem(item, 0))) &&
+                     (PyLong_Check(PyTuple_GetItem(item, 1)) || PyInt_Check(PyTuple_GetItem(item, 1)))) {
+              cranges.emplace_back(PyLong_AsUint64(PyTuple_GetItem(item, 0)), PyLong_AsUint64(PyTuple_GetItem(item, 1)));
+            }
+            else {
+              return PyErr_Format(PyExc_TypeError, "TritonContext::addCallback(): Expects a list of (start, end) ranges or page addresses as third argument.");
+            }
+          }
+        }
+
         if (PyMethod_Check(function)) {
           cb_self = PyMethod_GET_SELF(function);
           cb = PyMethod_GET_FUNCTION(function);
@@ -511,9 +1108,46 @@ namespace triton {
         try {
           switch (static_cast<triton::callbacks::callback_e>(PyLong_AsUint32(mode))) {
 
+            case callbacks::GET_CONCRETE_MEMORY_AREA_VALUE:
+            case callbacks::GET_UNDEFINED_MEMORY_PAGE:
+              PyTritonContext_AsTritonContext(self)->addCallback(static_cast<triton::callbacks::callback_e>(PyLong_AsUint32(mode)), callbacks::getConcreteMemoryAreaValueCallback([cb_self, cb](triton::API& api, triton::uint64 baseAddr, triton::usize size) {
+                /********* Lambda *********/
+                triton::bindings::python::PyGilGuard gil;
+                PyObject* args = nullptr;
+
+                /* Create function args */
+                if (cb_self) {
+                  args = triton::bindings::python::xPyTuple_New(4);
+                  PyTuple_SetItem(args, 0, cb_self);
+                  PyTuple_SetItem(args, 1, triton::bindings::python::PyTritonContextRef(api));
+                  PyTuple_SetItem(args, 2, triton::bindings::python::PyLong_FromUint64(baseAddr));
+                  PyTuple_SetItem(args, 3, triton::bindings::python::PyLong_FromUsize(size));
+                  Py_INCREF(cb_self);
+                }
+                else {
+                  args = triton::bindings::python::xPyTuple_New(3);
+                  PyTuple_SetItem(args, 0, triton::bindings::python::PyTritonContextRef(api));
+                  PyTuple_SetItem(args, 1, triton::bindings::python::PyLong_FromUint64(baseAddr));
+                  PyTuple_SetItem(args, 2, triton::bindings::python::PyLong_FromUsize(size));
+                }
+
+                /* Call the callback */
+                PyObject* ret = PyObject_CallObject(cb, args);
+
+                /* Check the call */
+                if (ret == nullptr) {
+                  throw triton::exceptions::PyCallbacks();
+                }
+
+                Py_DECREF(args);
+                /********* End of lambda *********/
+              }, cb));
+              break;
+
             case callbacks::GET_CONCRETE_MEMORY_VALUE:
               PyTritonContext_AsTritonContext(self)->addCallback(callbacks::GET_CONCRETE_MEMORY_VALUE, callbacks::getConcreteMemoryValueCallback([cb_self, cb](triton::API& api, const triton::arch::MemoryAccess& mem) {
                 /********* Lambda *********/
+                triton::bindings::python::PyGilGuard gil;
                 PyObject* args = nullptr;
 
                 /* Create function args */
@@ -540,12 +1174,13 @@ namespace triton {
 
                 Py_DECREF(args);
                 /********* End of lambda *********/
-              }, cb));
+              }, cb), cranges);
               break;
 
             case callbacks::GET_CONCRETE_REGISTER_VALUE:
               PyTritonContext_AsTritonContext(self)->addCallback(callbacks::GET_CONCRETE_REGISTER_VALUE, callbacks::getConcreteRegisterValueCallback([cb_self, cb](triton::API& api, const triton::arch::Register& reg){
                 /********* Lambda *********/
+                triton::bindings::python::PyGilGuard gil;
                 PyObject* args = nullptr;
 
                 /* Create function args */
@@ -575,9 +1210,45 @@ namespace triton {
               }, cb));
               break;
 
+            case callbacks::SET_CONCRETE_MEMORY_AREA_VALUE:
+              PyTritonContext_AsTritonContext(self)->addCallback(callbacks::SET_CONCRETE_MEMORY_AREA_VALUE, callbacks::setConcreteMemoryAreaValueCallback([cb_self, cb](triton::API& api, triton::uint64 baseAddr, const std::vector<triton::uint8>& values) {
+                /********* Lambda *********/
+                triton::bindings::python::PyGilGuard gil;
+                PyObject* args = nullptr;
+
+                /* Create function args */
+                if (cb_self) {
+                  args = triton::bindings::python::xPyTuple_New(4);
+                  PyTuple_SetItem(args, 0, cb_self);
+                  PyTuple_SetItem(args, 1, triton::bindings::python::PyTritonContextRef(api));
+                  PyTuple_SetItem(args, 2, triton::bindings::python::PyLong_FromUint64(baseAddr));
+                  PyTuple_SetItem(args, 3, PyBytes_FromStringAndSize(reinterpret_cast<const char*>(values.data()), values.size()));
+                  Py_INCREF(cb_self);
+                }
+                else {
+                  args = triton::bindings::python::xPyTuple_New(3);
+                  PyTuple_SetItem(args, 0, triton::bindings::python::PyTritonContextRef(api));
+                  PyTuple_SetItem(args, 1, triton::bindings::python::PyLong_FromUint64(baseAddr));
+                  PyTuple_SetItem(args, 2, PyBytes_FromStringAndSize(reinterpret_cast<const char*>(values.data()), values.size()));
+                }
+
+                /* Call the callback */
+                PyObject* ret = PyObject_CallObject(cb, args);
+
+                /* Check the call */
+                if (ret == nullptr) {
+                  throw triton::exceptions::PyCallbacks();
+                }
+
+                Py_DECREF(args);
+                /********* End of lambda *********/
+              }, cb));
+              break;
+
             case callbacks::SET_CONCRETE_MEMORY_VALUE:
               PyTritonContext_AsTritonContext(self)->addCallback(callbacks::SET_CONCRETE_MEMORY_VALUE, callbacks::setConcreteMemoryValueCallback([cb_self, cb](triton::API& api, const triton::arch::MemoryAccess& mem, const triton::uint512& value) {
                 /********* Lambda *********/
+                triton::bindings::python::PyGilGuard gil;
                 PyObject* args = nullptr;
 
                 /* Create function args */
@@ -606,12 +1277,13 @@ namespace triton {
 
                 Py_DECREF(args);
                 /********* End of lambda *********/
-              }, cb));
+              }, cb), cranges);
               break;
 
             case callbacks::SET_CONCRETE_REGISTER_VALUE:
               PyTritonContext_AsTritonContext(self)->addCallback(callbacks::SET_CONCRETE_REGISTER_VALUE, callbacks::setConcreteRegisterValueCallback([cb_self, cb](triton::API& api, const triton::arch::Register& reg, const triton::uint512& value){
                 /********* Lambda *********/
+                triton::bindings::python::PyGilGuard gil;
                 PyObject* args = nullptr;
 
                 /* Create function args */
@@ -646,6 +1318,7 @@ namespace triton {
             case callbacks::SYMBOLIC_SIMPLIFICATION:
               PyTritonContext_AsTritonContext(self)->addCallback(callbacks::SYMBOLIC_SIMPLIFICATION, callbacks::symbolicSimplificationCallback([cb_self, cb](triton::API& api, triton::ast::SharedAbstractNode node) {
                 /********* Lambda *********/
+                triton::bindings::python::PyGilGuard gil;
                 PyObject* args = nullptr;
 
                 /* Create function args */
@@ -698,29 +1371,12 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_assignSymbolicExpressionToMemory(PyObject* self, PyObject* args) {
-        PyObject* se  = nullptr;
-        PyObject* mem = nullptr;
-
-        /* Extract arguments */
-        if (PyArg_ParseTuple(args, "|OO", &se, &mem) == false) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::assignSymbolicExpressionToMemory(): Invalid number of arguments");
-        }
-
-        if (se == nullptr || (!PySymbolicExpression_Check(se)))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::assignSymbolicExpressionToMemory(): Expects a SymbolicExpression as first argument.");
-
-        if (mem == nullptr || (!PyMemoryAccess_Check(mem)))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::assignSymbolicExpressionToMemory(): Expects a MemoryAccess as second argument.");
-
-        const triton::engines::symbolic::SharedSymbolicExpression& arg1 = PySymbolicExpression_AsSymbolicExpression(se);
-        triton::arch::MemoryAccess arg2 = *PyMemoryAccess_AsMemoryAccess(mem);
+      static PyObject* TritonContext_addSimplificationPass(PyObject* self, PyObject* name) {
+        if (name == nullptr || !PyStr_Check(name))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::addSimplificationPass(): Expects a string as argument.");
 
         try {
-          PyTritonContext_AsTritonContext(self)->assignSymbolicExpressionToMemory(arg1, arg2);
-        }
-        catch (const triton::exceptions::PyCallbacks&) {
-          return nullptr;
+          PyTritonContext_AsTritonContext(self)->addSimplificationPass(std::string(PyStr_AsString(name)));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -731,29 +1387,54 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_assignSymbolicExpressionToRegister(PyObject* self, PyObject* args) {
-        PyObject* se  = nullptr;
-        PyObject* reg = nullptr;
+      static PyObject* TritonContext_addSolverProfile(PyObject* self, PyObject* args, PyObject* kwargs) {
+        triton::engines::solver::SolverProfile profile;
 
-        /* Extract arguments */
-        if (PyArg_ParseTuple(args, "|OO", &se, &reg) == false) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::assignSymbolicExpressionToRegister(): Invalid number of arguments");
+        PyObject* name    = nullptr;
+        PyObject* tactics = nullptr;
+        PyObject* engine  = nullptr;
+
+        static char* keywords[] = {
+          (char*)"name",
+          (char*)"tactics",
+          (char*)"engine",
+          nullptr
+        };
+
+        /* Extract Keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OOO", keywords, &name, &tactics, &engine) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::addSolverProfile(): Invalid keyword argument.");
         }
 
-        if (se == nullptr || (!PySymbolicExpression_Check(se)))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::assignSymbolicExpressionToRegister(): Expects a SymbolicExpression as first argument.");
+        if (name == nullptr || !PyStr_Check(name)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::addSolverProfile(): Expects a string as name argument.");
+        }
 
-        if (reg == nullptr || (!PyRegister_Check(reg)))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::assignSymbolicExpressionToRegister(): Expects a Register as second argument.");
+        if (tactics != nullptr && !PyList_Check(tactics)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::addSolverProfile(): Expects a list of strings as tactics keyword.");
+        }
 
-        const triton::engines::symbolic::SharedSymbolicExpression& arg1 = PySymbolicExpression_AsSymbolicExpression(se);
-        triton::arch::Register arg2 = *PyRegister_AsRegister(reg);
+        if (engine != nullptr && !PyStr_Check(engine)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::addSolverProfile(): Expects a string as engine keyword.");
+        }
 
-        try {
-          PyTritonContext_AsTritonContext(self)->assignSymbolicExpressionToRegister(arg1, arg2);
+        profile.name = PyStr_AsString(name);
+
+        if (tactics != nullptr) {
+          for (Py_ssize_t i = 0; i < PyList_Size(tactics); i++) {
+            PyObject* tactic = PyList_GetItem(tactics, i);
+            if (!PyStr_Check(tactic))
+              return PyErr_Format(PyExc_TypeError, "TritonContext::addSolverProfile(): Expects a list of strings as tactics keyword.");
+            profile.tactics.push_back(PyStr_AsString(tactic));
+          }
         }
-        catch (const triton::exceptions::PyCallbacks&) {
-          return nullptr;
+
+        if (engine != nullptr) {
+          profile.engine = PyStr_AsString(engine);
+        }
+
+        try {
+          PyTritonContext_AsTritonContext(self)->getSolverProfiles()->setProfile(profile);
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -764,8 +1445,105 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_buildSemantics(PyObject* self, PyObject* inst) {
-        if (!PyInstruction_Check(inst))
+      static PyObject* TritonContext_applyModel(PyObject* self, PyObject* model) {
+        std::unordered_map<triton::usize, triton::engines::solver::SolverModel> ret;
+        PyObject* key   = nullptr;
+        PyObject* value = nullptr;
+        Py_ssize_t pos  = 0;
+
+        if (model == nullptr || !PyDict_Check(model))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::applyModel(): Expects a dictionary of SolverModel as argument.");
+
+        while (PyDict_Next(model, &pos, &key, &value)) {
+          if (!PySolverModel_Check(value))
+            return PyErr_Format(PyExc_TypeError, "TritonContext::applyModel(): Expects a dictionary of SolverModel as argument.");
+          const triton::engines::solver::SolverModel* item = PySolverModel_AsSolverModel(value);
+          ret[item->getId()] = *item;
+        }
+
+        try {
+          PyTritonContext_AsTritonContext(self)->applyModel(ret);
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_assignSymbolicExpressionToMemory(PyObject* self, PyObject* args) {
+        PyObject* se  = nullptr;
+        PyObject* mem = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &se, &mem) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::assignSymbolicExpressionToMemory(): Invalid number of arguments");
+        }
+
+        if (se == nullptr || (!PySymbolicExpression_Check(se)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::assignSymbolicExpressionToMemory(): Expects a SymbolicExpression as first argument.");
+
+        if (mem == nullptr || (!PyMemoryAccess_Check(mem)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::assignSymbolicExpressionToMemory(): Expects a MemoryAccess as second argument.");
+
+        const triton::engines::symbolic::SharedSymbolicExpression& arg1 = PySymbolicExpression_AsSymbolicExpression(se);
+        triton::arch::MemoryAccess arg2 = *PyMemoryAccess_AsMemoryAccess(mem);
+
+        try {
+          PyTritonContext_AsTritonContext(self)->assignSymbolicExpressionToMemory(arg1, arg2);
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_assignSymbolicExpressionToRegister(PyObject* self, PyObject* args) {
+        PyObject* se  = nullptr;
+        PyObject* reg = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &se, &reg) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::assignSymbolicExpressionToRegister(): Invalid number of arguments");
+        }
+
+        if (se == nullptr || (!PySymbolicExpression_Check(se)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::assignSymbolicExpressionToRegister(): Expects a SymbolicExpression as first argument.");
+
+        if (reg == nullptr || (!PyRegister_Check(reg)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::assignSymbolicExpressionToRegister(): Expects a Register as second argument.");
+
+        const triton::engines::symbolic::SharedSymbolicExpression& arg1 = PySymbolicExpression_AsSymbolicExpression(se);
+        triton::arch::Register arg2 = *PyRegister_AsRegister(reg);
+
+        try {
+          PyTritonContext_AsTritonContext(self)->assignSymbolicExpressionToRegister(arg1, arg2);
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_buildSemantics(PyObject* self, PyObject* inst) {
+        if (!PyInstruction_Check(inst))
           return PyErr_Format(PyExc_TypeError, "TritonContext::buildSemantics(): Expects an Instruction as argument.");
 
         try {
@@ -782,6 +1560,45 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_checkEquivalences(PyObject* self, PyObject* pairs) {
+        std::vector<std::pair<triton::ast::SharedAbstractNode, triton::ast::SharedAbstractNode>> cpairs;
+        std::vector<triton::engines::solver::Equivalence> results;
+
+        if (!PyList_Check(pairs))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::checkEquivalences(): Expects a list of (AstNode, AstNode) as argument.");
+
+        for (Py_ssize_t i = 0; i < PyList_Size(pairs); i++) {
+          PyObject* pair = PyList_GetItem(pairs, i);
+          if (!PyTuple_Check(pair) || PyTuple_Size(pair) != 2 || !PyAstNode_Check(PyTuple_GetItem(pair, 0)) || !PyAstNode_Check(PyTuple_GetItem(pair, 1)))
+            return PyErr_Format(PyExc_TypeError, "TritonContext::checkEquivalences(): Expects a list of (AstNode, AstNode) as argument.");
+          cpairs.emplace_back(PyAstNode_AsAstNode(PyTuple_GetItem(pair, 0)), PyAstNode_AsAstNode(PyTuple_GetItem(pair, 1)));
+        }
+
+        try {
+          auto ctx = PyTritonContext_AsTritonContext(self);
+          PyAllowThreads([&]() { results = ctx->checkEquivalences(cpairs); });
+
+          PyObject* ret = xPyList_New(results.size());
+          for (triton::usize i = 0; i < results.size(); i++) {
+            PyObject* item = Py_None;
+            if (results[i].status == triton::engines::solver::UNSAT)
+              item = Py_True;
+            else if (results[i].status == triton::engines::solver::SAT)
+              item = Py_False;
+            Py_INCREF(item);
+            PyList_SetItem(ret, i, item);
+          }
+          return ret;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* TritonContext_clearCallbacks(PyObject* self, PyObject* noarg) {
         try {
           PyTritonContext_AsTritonContext(self)->clearCallbacks();
@@ -851,6 +1668,19 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_clearCoverage(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->getCoverage()->clear();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_clearPathConstraints(PyObject* self, PyObject* noarg) {
         try {
           PyTritonContext_AsTritonContext(self)->clearPathConstraints();
@@ -864,6 +1694,115 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_clearSimplificationCache(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->clearSimplificationCache();
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_clearSimplificationMemo(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->clearSimplificationMemo();
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_clearSolverCache(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->getSolverCache()->clear();
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_clearSolverStatistics(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->getSolverStatistics()->clear();
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_clearStatistics(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->getStatistics()->clear();
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_clearSynthesisCache(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->clearSynthesisCache();
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_clearTrace(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->getTracer()->clear();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_concretizeAllMemory(PyObject* self, PyObject* noarg) {
         try {
           PyTritonContext_AsTritonContext(self)->concretizeAllMemory();
@@ -932,6 +1871,36 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_concretizeMemoryArea(PyObject* self, PyObject* args) {
+        PyObject* baseAddr = nullptr;
+        PyObject* size     = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &baseAddr, &size) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::concretizeMemoryArea(): Invalid number of arguments");
+        }
+
+        if (baseAddr == nullptr || (!PyLong_Check(baseAddr) && !PyInt_Check(baseAddr)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::concretizeMemoryArea(): Expects an integer as first argument.");
+
+        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::concretizeMemoryArea(): Expects an integer as second argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->concretizeMemoryArea(PyLong_AsUint64(baseAddr), PyLong_AsUsize(size));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_concretizeRegister(PyObject* self, PyObject* reg) {
         if (!PyRegister_Check(reg))
           return PyErr_Format(PyExc_TypeError, "TritonContext::concretizeRegister(): Expects a Register as argument.");
@@ -1121,27 +2090,156 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_enableSymbolicEngine(PyObject* self, PyObject* flag) {
-        if (!PyBool_Check(flag))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::enableSymbolicEngine(): Expects an boolean as argument.");
+      static PyObject* TritonContext_emulate(PyObject* self, PyObject* args, PyObject* kwargs) {
+        triton::arch::EmulationOptions options;
 
-        try {
-          PyTritonContext_AsTritonContext(self)->enableSymbolicEngine(PyLong_AsBool(flag));
+        PyObject* start            = nullptr;
+        PyObject* stops            = nullptr;
+        PyObject* maxInstructions  = nullptr;
+        PyObject* stopOnSymbolicPc = nullptr;
+        PyObject* hooks            = nullptr;
+        PyObject* syscalls         = nullptr;
+        PyObject* native           = nullptr;
+        PyObject* ret              = nullptr;
+
+        static char* keywords[] = {
+          (char*)"start",
+          (char*)"stops",
+          (char*)"maxInstructions",
+          (char*)"stopOnSymbolicPc",
+          (char*)"hooks",
+          (char*)"syscalls",
+          (char*)"native",
+          nullptr
+        };
+
+        /* Extract Keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "O|OOOOOO", keywords, &start, &stops, &maxInstructions, &stopOnSymbolicPc, &hooks, &syscalls, &native) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::emulate(): Invalid keyword argument.");
         }
-        catch (const triton::exceptions::PyCallbacks&) {
-          return nullptr;
+
+        if (!PyLong_Check(start) && !PyInt_Check(start)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::emulate(): Expects an integer as start.");
         }
-        catch (const triton::exceptions::Exception& e) {
-          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+
+        if (stops != nullptr && !PyList_Check(stops)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::emulate(): Expects a list of integers as stops keyword.");
         }
 
-        Py_INCREF(Py_None);
-        return Py_None;
-      }
+        if (maxInstructions != nullptr && (!PyLong_Check(maxInstructions) && !PyInt_Check(maxInstructions))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::emulate(): Expects an integer as maxInstructions keyword.");
+        }
 
+        if (stopOnSymbolicPc != nullptr && !PyBool_Check(stopOnSymbolicPc)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::emulate(): Expects a boolean as stopOnSymbolicPc keyword.");
+        }
 
-      static PyObject* TritonContext_enableTaintEngine(PyObject* self, PyObject* flag) {
-        if (!PyBool_Check(flag))
+        if (hooks != nullptr && !PyDict_Check(hooks)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::emulate(): Expects a dictionary of {integer : callable} as hooks keyword.");
+        }
+
+        if (syscalls != nullptr && !PyBool_Check(syscalls)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::emulate(): Expects a boolean as syscalls keyword.");
+        }
+
+        if (native != nullptr && !PyBool_Check(native)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::emulate(): Expects a boolean as native keyword.");
+        }
+
+        if (stops != nullptr) {
+          for (Py_ssize_t i = 0; i < PyList_Size(stops); i++) {
+            PyObject* item = PyList_GetItem(stops, i);
+            if (!PyLong_Check(item) && !PyInt_Check(item))
+              return PyErr_Format(PyExc_TypeError, "TritonContext::emulate(): Expects a list of integers as stops keyword.");
+            options.stops.insert(PyLong_AsUint64(item));
+          }
+        }
+
+        if (maxInstructions != nullptr)
+          options.maxInstructions = PyLong_AsUsize(maxInstructions);
+
+        if (stopOnSymbolicPc != nullptr)
+          options.stopOnSymbolicPc = PyLong_AsBool(stopOnSymbolicPc);
+
+        if (syscalls != nullptr)
+          options.syscalls = PyLong_AsBool(syscalls);
+
+        if (native != nullptr)
+          options.native = PyLong_AsBool(native);
+
+        if (hooks != nullptr) {
+          PyObject* key   = nullptr;
+          PyObject* value = nullptr;
+          Py_ssize_t pos  = 0;
+
+          /* The callables are owned by the dictionary during the emulation */
+          while (PyDict_Next(hooks, &pos, &key, &value)) {
+            if ((!PyLong_Check(key) && !PyInt_Check(key)) || !PyCallable_Check(value))
+              return PyErr_Format(PyExc_TypeError, "TritonContext::emulate(): Expects a dictionary of {integer : callable} as hooks keyword.");
+
+            options.hooks[PyLong_AsUint64(key)] = [value](triton::API& api, triton::uint64 addr) {
+              triton::bindings::python::PyGilGuard gil;
+              PyObject* args = triton::bindings::python::xPyTuple_New(2);
+              PyTuple_SetItem(args, 0, triton::bindings::python::PyTritonContextRef(api));
+              PyTuple_SetItem(args, 1, triton::bindings::python::PyLong_FromUint64(addr));
+
+              PyObject* ret = PyObject_CallObject(value, args);
+              Py_DECREF(args);
+              if (ret == nullptr) {
+                throw triton::exceptions::PyCallbacks();
+              }
+
+              /* Only False stops the emulation */
+              bool resume = (ret != Py_False);
+              Py_DECREF(ret);
+              return resume;
+            };
+          }
+        }
+
+        try {
+          auto result = PyTritonContext_AsTritonContext(self)->emulate(PyLong_AsUint64(start), options);
+
+          ret = xPyDict_New();
+          xPyDict_SetItemString(ret, "blocks",       PyLong_FromUsize(result.blocks));
+          xPyDict_SetItemString(ret, "instructions", PyLong_FromUsize(result.instructions));
+          xPyDict_SetItemString(ret, "native",       PyLong_FromUsize(result.native));
+          xPyDict_SetItemString(ret, "pc",           PyLong_FromUint64(result.pc));
+          xPyDict_SetItemString(ret, "reason",       PyLong_FromUint32(result.reason));
+          xPyDict_SetItemString(ret, "status",       PyLong_FromUint64(result.status));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_enableSymbolicEngine(PyObject* self, PyObject* flag) {
+        if (!PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::enableSymbolicEngine(): Expects an boolean as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->enableSymbolicEngine(PyLong_AsBool(flag));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_enableTaintEngine(PyObject* self, PyObject* flag) {
+        if (!PyBool_Check(flag))
           return PyErr_Format(PyExc_TypeError, "TritonContext::enableTaintEngine(): Expects an boolean as argument.");
 
         try {
@@ -1178,6 +2276,177 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_explore(PyObject* self, PyObject* args, PyObject* kwargs) {
+        triton::engines::exploration::ExplorationOptions options;
+
+        PyObject* entry           = nullptr;
+        PyObject* strategy        = nullptr;
+        PyObject* exits           = nullptr;
+        PyObject* maxRuns         = nullptr;
+        PyObject* maxInstructions = nullptr;
+        PyObject* maxGenerations  = nullptr;
+        PyObject* timeLimit       = nullptr;
+        PyObject* parallel        = nullptr;
+        PyObject* timeout         = nullptr;
+        PyObject* unsatCores      = nullptr;
+        PyObject* ret             = nullptr;
+
+        static char* keywords[] = {
+          (char*)"entry",
+          (char*)"strategy",
+          (char*)"exits",
+          (char*)"maxRuns",
+          (char*)"maxInstructions",
+          (char*)"maxGenerations",
+          (char*)"timeLimit",
+          (char*)"parallel",
+          (char*)"timeout",
+          (char*)"unsatCores",
+          nullptr
+        };
+
+        /* Extract Keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "O|OOOOOOOOO", keywords, &entry, &strategy, &exits, &maxRuns, &maxInstructions, &maxGenerations, &timeLimit, &parallel, &timeout, &unsatCores) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::explore(): Invalid keyword argument.");
+        }
+
+        if (!PyLong_Check(entry) && !PyInt_Check(entry)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::explore(): Expects an integer as entry.");
+        }
+
+        if (strategy != nullptr && (!PyLong_Check(strategy) && !PyInt_Check(strategy))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::explore(): Expects an EXPLORATION as strategy keyword.");
+        }
+
+        if (exits != nullptr && !PyList_Check(exits)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::explore(): Expects a list of integers as exits keyword.");
+        }
+
+        if (maxRuns != nullptr && (!PyLong_Check(maxRuns) && !PyInt_Check(maxRuns))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::explore(): Expects an integer as maxRuns keyword.");
+        }
+
+        if (maxInstructions != nullptr && (!PyLong_Check(maxInstructions) && !PyInt_Check(maxInstructions))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::explore(): Expects an integer as maxInstructions keyword.");
+        }
+
+        if (maxGenerations != nullptr && (!PyLong_Check(maxGenerations) && !PyInt_Check(maxGenerations))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::explore(): Expects an integer as maxGenerations keyword.");
+        }
+
+        if (timeLimit != nullptr && (!PyLong_Check(timeLimit) && !PyInt_Check(timeLimit))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::explore(): Expects an integer as timeLimit keyword.");
+        }
+
+        if (parallel != nullptr && !PyBool_Check(parallel)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::explore(): Expects a boolean as parallel keyword.");
+        }
+
+        if (timeout != nullptr && (!PyLong_Check(timeout) && !PyInt_Check(timeout))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::explore(): Expects an integer as timeout keyword.");
+        }
+
+        if (unsatCores != nullptr && !PyBool_Check(unsatCores)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::explore(): Expects a boolean as unsatCores keyword.");
+        }
+
+        if (strategy != nullptr)
+          options.strategy = static_cast<triton::engines::exploration::strategy_e>(PyLong_AsUint32(strategy));
+
+        if (exits != nullptr) {
+          for (Py_ssize_t i = 0; i < PyList_Size(exits); i++) {
+            PyObject* item = PyList_GetItem(exits, i);
+            if (!PyLong_Check(item) && !PyInt_Check(item))
+              return PyErr_Format(PyExc_TypeError, "TritonContext::explore(): Expects a list of integers as exits keyword.");
+            options.exits.insert(PyLong_AsUint64(item));
+          }
+        }
+
+        if (maxRuns != nullptr)
+          options.maxRuns = PyLong_AsUsize(maxRuns);
+
+        if (maxInstructions != nullptr)
+          options.maxInstructions = PyLong_AsUsize(maxInstructions);
+
+        if (maxGenerations != nullptr)
+          options.maxGenerations = PyLong_AsUsize(maxGenerations);
+
+        if (timeLimit != nullptr)
+          options.timeLimit = PyLong_AsUint64(timeLimit);
+
+        if (parallel != nullptr)
+          options.parallel = PyLong_AsBool(parallel);
+
+        if (timeout != nullptr)
+          options.timeout = PyLong_AsUint32(timeout);
+
+        if (unsatCores != nullptr)
+          options.unsatCores = PyLong_AsBool(unsatCores);
+
+        try {
+          auto result = PyTritonContext_AsTritonContext(self)->explore(PyLong_AsUint64(entry), options);
+
+          PyObject* corpus = xPyList_New(result.corpus.size());
+          for (triton::usize i = 0; i < result.corpus.size(); i++) {
+            const auto& seed = result.corpus[i];
+
+            PyObject* input = xPyDict_New();
+            for (const auto& item : seed.input)
+              xPyDict_SetItem(input, PyLong_FromUsize(item.first), PyLong_FromUint512(item.second));
+
+            PyObject* dict = xPyDict_New();
+            xPyDict_SetItemString(dict, "bound",      PyLong_FromUsize(seed.bound));
+            xPyDict_SetItemString(dict, "dstAddr",    PyLong_FromUint64(seed.dstAddr));
+            xPyDict_SetItemString(dict, "generation", PyLong_FromUsize(seed.generation));
+            xPyDict_SetItemString(dict, "input",      input);
+            xPyDict_SetItemString(dict, "score",      PyLong_FromUsize(seed.score));
+            xPyDict_SetItemString(dict, "srcAddr",    PyLong_FromUint64(seed.srcAddr));
+            PyList_SetItem(corpus, i, dict);
+          }
+
+          PyObject* edges = xPyList_New(result.edges.size());
+          triton::usize index = 0;
+          for (const auto& edge : result.edges) {
+            PyObject* pair = xPyTuple_New(2);
+            PyTuple_SetItem(pair, 0, PyLong_FromUint64(edge.first));
+            PyTuple_SetItem(pair, 1, PyLong_FromUint64(edge.second));
+            PyList_SetItem(edges, index++, pair);
+          }
+
+          ret = xPyDict_New();
+          xPyDict_SetItemString(ret, "bitmap",       PyBytes_FromStringAndSize(reinterpret_cast<const char*>(result.bitmap.data()), result.bitmap.size()));
+          xPyDict_SetItemString(ret, "corpus",       corpus);
+          xPyDict_SetItemString(ret, "edges",        edges);
+          xPyDict_SetItemString(ret, "flips",        PyLong_FromUsize(result.flips));
+          xPyDict_SetItemString(ret, "instructions", PyLong_FromUsize(result.instructions));
+          xPyDict_SetItemString(ret, "pruned",       PyLong_FromUsize(result.pruned));
+          xPyDict_SetItemString(ret, "runs",         PyLong_FromUsize(result.runs));
+          xPyDict_SetItemString(ret, "solved",       PyLong_FromUsize(result.solved));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_fork(PyObject* self, PyObject* noarg) {
+        try {
+          return PyTritonContext(PyTritonContext_AsTritonContext(self)->fork());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* TritonContext_getAllRegisters(PyObject* self, PyObject* noarg) {
         PyObject* ret = nullptr;
 
@@ -1250,22 +2519,51 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "TritonContext::getConcreteMemoryAreaValue(): Invalid number of arguments");
         }
 
+        /* getConcreteMemoryAreaValue(integer, buffer) reads the area into the buffer */
+        if (size != nullptr && PyObject_CheckBuffer(size)) {
+          Py_buffer view;
+
+          if (PyObject_GetBuffer(size, &view, PyBUF_WRITABLE) != 0) {
+            PyErr_Clear();
+            return PyErr_Format(PyExc_TypeError, "TritonContext::getConcreteMemoryAreaValue(): Expects an integer or a writable contiguous buffer as second argument.");
+          }
+
+          try {
+            PyTritonContext_AsTritonContext(self)->getConcreteMemoryAreaValue(PyLong_AsUint64(addr), reinterpret_cast<triton::uint8*>(view.buf), static_cast<triton::usize>(view.len));
+          }
+          catch (const triton::exceptions::PyCallbacks&) {
+            PyBuffer_Release(&view);
+            return nullptr;
+          }
+          catch (const triton::exceptions::Exception& e) {
+            PyBuffer_Release(&view);
+            return PyErr_Format(PyExc_TypeError, "%s", e.what());
+          }
+
+          PyBuffer_Release(&view);
+          Py_INCREF(Py_None);
+          return Py_None;
+        }
+
         try {
-          std::vector<triton::uint8> vv = PyTritonContext_AsTritonContext(self)->getConcreteMemoryAreaValue(PyLong_AsUint64(addr), PyLong_AsUsize(size));
-          area = new triton::uint8[vv.size()];
+          triton::uint64 baseAddr = PyLong_AsUint64(addr);
+          triton::usize length    = PyLong_AsUsize(size);
 
-          for (triton::usize index = 0; index < vv.size(); index++)
-            area[index] = vv[index];
+          /* The area is copied straight into the bytes object */
+          ret = PyBytes_FromStringAndSize(nullptr, length);
+          if (ret == nullptr)
+            return nullptr;
 
-          ret = PyBytes_FromStringAndSize(reinterpret_cast<const char*>(area), vv.size());
-          delete[] area;
+          area = reinterpret_cast<triton::uint8*>(PyBytes_AsString(ret));
+          PyTritonContext_AsTritonContext(self)->getConcreteMemoryAreaValue(baseAddr, area, length);
           return ret;
-
         }
         catch (const triton::exceptions::PyCallbacks&) {
+          Py_XDECREF(ret);
           return nullptr;
         }
         catch (const triton::exceptions::Exception& e) {
+          Py_XDECREF(ret);
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
@@ -1323,6 +2621,104 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_getCoverage(PyObject* self, PyObject* noarg) {
+        try {
+          triton::arch::Coverage* coverage = PyTritonContext_AsTritonContext(self)->getCoverage();
+          auto addresses = coverage->getAddresses();
+          auto bitmap    = coverage->getBitmap();
+          auto uncovered = coverage->getUncoveredBranches();
+
+          PyObject* list = xPyList_New(addresses.size());
+          triton::usize index = 0;
+          for (triton::uint64 address : addresses)
+            PyList_SetItem(list, index++, PyLong_FromUint64(address));
+
+          PyObject* edges = xPyDict_New();
+          for (const auto& item : coverage->getEdges()) {
+            PyObject* edge = xPyTuple_New(2);
+            PyTuple_SetItem(edge, 0, PyLong_FromUint64(item.first.first));
+            PyTuple_SetItem(edge, 1, PyLong_FromUint64(item.first.second));
+            xPyDict_SetItem(edges, edge, PyLong_FromUsize(item.second));
+          }
+
+          PyObject* branches = xPyDict_New();
+          for (const auto& item : coverage->getBranches()) {
+            PyObject* branch = xPyTuple_New(2);
+            PyTuple_SetItem(branch, 0, PyLong_FromUint64(item.first.first));
+            PyTuple_SetItem(branch, 1, PyLong_FromUint64(item.first.second));
+            PyObject* counts = xPyTuple_New(2);
+            PyTuple_SetItem(counts, 0, PyLong_FromUsize(item.second.taken));
+            PyTuple_SetItem(counts, 1, PyLong_FromUsize(item.second.notTaken));
+            xPyDict_SetItem(branches, branch, counts);
+          }
+
+          PyObject* frontier = xPyList_New(uncovered.size());
+          for (triton::usize i = 0; i < uncovered.size(); i++) {
+            PyObject* branch = xPyTuple_New(2);
+            PyTuple_SetItem(branch, 0, PyLong_FromUint64(uncovered[i].first));
+            PyTuple_SetItem(branch, 1, PyLong_FromUint64(uncovered[i].second));
+            PyList_SetItem(frontier, i, branch);
+          }
+
+          PyObject* ret = xPyDict_New();
+          xPyDict_SetItemString(ret, "addresses", list);
+          xPyDict_SetItemString(ret, "bitmap",    PyBytes_FromStringAndSize(reinterpret_cast<const char*>(bitmap.data()), bitmap.size()));
+          xPyDict_SetItemString(ret, "branches",  branches);
+          xPyDict_SetItemString(ret, "edges",     edges);
+          xPyDict_SetItemString(ret, "uncovered", frontier);
+          return ret;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getExecutorThreads(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getExecutor().getThreads());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getFlatPathPredicate(PyObject* self, PyObject* noarg) {
+        try {
+          return PyAstNode(PyTritonContext_AsTritonContext(self)->getFlatPathPredicate());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getFunctionSummaries(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          auto summaries = PyTritonContext_AsTritonContext(self)->getFunctionSummaries();
+
+          ret = xPyDict_New();
+          for (auto it = summaries.begin(); it != summaries.end(); it++) {
+            xPyDict_SetItem(ret, PyLong_FromUint64(it->first), PyStr_FromString(it->second.c_str()));
+          }
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* TritonContext_getGprBitSize(PyObject* self, PyObject* noarg) {
         try {
           return PyLong_FromUint32(PyTritonContext_AsTritonContext(self)->getGprBitSize());
@@ -1381,6 +2777,79 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_getMemoryTaintLabels(PyObject* self, PyObject* mem) {
+        PyObject* ret = nullptr;
+        triton::engines::taint::TaintLabels labels;
+
+        try {
+          if (PyMemoryAccess_Check(mem))
+            labels = PyTritonContext_AsTritonContext(self)->getMemoryTaintLabels(*PyMemoryAccess_AsMemoryAccess(mem));
+
+          else if (PyLong_Check(mem) || PyInt_Check(mem))
+            labels = PyTritonContext_AsTritonContext(self)->getMemoryTaintLabels(PyLong_AsUint64(mem));
+
+          else
+            return PyErr_Format(PyExc_TypeError, "TritonContext::getMemoryTaintLabels(): Expects a MemoryAccess or an integer as argument.");
+
+          std::vector<triton::uint32> list = labels.getLabels();
+          ret = xPyList_New(list.size());
+          for (triton::usize index = 0; index < list.size(); index++)
+            PyList_SetItem(ret, index, PyLong_FromUint32(list[index]));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getMemoryUsage(PyObject* self, PyObject* noarg) {
+        try {
+          triton::MemoryUsage usage = PyTritonContext_AsTritonContext(self)->getMemoryUsage();
+          PyObject* kinds = xPyDict_New();
+          PyObject* ret = xPyDict_New();
+
+          auto entry = [](const triton::MemoryUsageEntry& entry) {
+            PyObject* item = xPyDict_New();
+            xPyDict_SetItemString(item, "bytes", PyLong_FromUsize(entry.bytes));
+            xPyDict_SetItemString(item, "count", PyLong_FromUsize(entry.count));
+            return item;
+          };
+
+          for (const auto& kind : usage.astNodesByKind)
+            xPyDict_SetItem(kinds, PyLong_FromUint32(kind.first), PyLong_FromUsize(kind.second));
+
+          PyObject* astNodes = entry(usage.astNodes);
+          xPyDict_SetItemString(astNodes, "kinds",    kinds);
+          xPyDict_SetItemString(astNodes, "reserved", PyLong_FromUsize(usage.astReservedBytes));
+
+          xPyDict_SetItemString(ret, "alignedMemory",       entry(usage.alignedMemory));
+          xPyDict_SetItemString(ret, "astNodes",            astNodes);
+          xPyDict_SetItemString(ret, "concreteMemory",      entry(usage.concreteMemory));
+          xPyDict_SetItemString(ret, "mappedMemory",        entry(usage.mappedMemory));
+          xPyDict_SetItemString(ret, "pathConstraints",     entry(usage.pathConstraints));
+          xPyDict_SetItemString(ret, "simplificationCache", entry(usage.simplificationCache));
+          xPyDict_SetItemString(ret, "solverCache",         entry(usage.solverCache));
+          xPyDict_SetItemString(ret, "symbolicExpressions", entry(usage.symbolicExpressions));
+          xPyDict_SetItemString(ret, "symbolicMemory",      entry(usage.symbolicMemory));
+          xPyDict_SetItemString(ret, "synthesisCache",      entry(usage.synthesisCache));
+          xPyDict_SetItemString(ret, "taintedMemory",       entry(usage.taintedMemory));
+          xPyDict_SetItemString(ret, "taintedRegisters",    entry(usage.taintedRegisters));
+          return ret;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* TritonContext_getModel(PyObject* self, PyObject* args, PyObject* kwargs) {
         triton::engines::solver::status_e status;
         triton::uint32 solvingTime = 0;
@@ -1420,8 +2889,13 @@ namespace triton {
         }
 
         try {
+          std::unordered_map<triton::usize, triton::engines::solver::SolverModel> model;
+          auto ctx   = PyTritonContext_AsTritonContext(self);
+          auto cnode = PyAstNode_AsAstNode(node);
+
+          PyAllowThreads([&]() { model = ctx->getModel(cnode, &status, timeout_c, &solvingTime); });
+
           dict = triton::bindings::python::xPyDict_New();
-          auto model = PyTritonContext_AsTritonContext(self)->getModel(PyAstNode_AsAstNode(node), &status, timeout_c, &solvingTime);
           for (auto it = model.begin(); it != model.end(); it++) {
             xPyDict_SetItem(dict, PyLong_FromUsize(it->first), PySolverModel(it->second));
           }
@@ -1445,44 +2919,29 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_getModels(PyObject* self, PyObject* args, PyObject* kwargs) {
-        triton::engines::solver::status_e status;
-        triton::uint32 solvingTime = 0;
+      static PyObject* TritonContext_getModelAsync(PyObject* self, PyObject* args, PyObject* kwargs) {
         triton::uint32 timeout_c = 0;
 
-        PyObject* ret     = nullptr;
         PyObject* node    = nullptr;
-        PyObject* limit   = nullptr;
-        PyObject* wb      = nullptr;
         PyObject* timeout = nullptr;
 
         static char* keywords[] = {
           (char*)"node",
-          (char*)"limit",
-          (char*)"status",
           (char*)"timeout",
           nullptr
         };
 
         /* Extract Keywords */
-        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OOOO", keywords, &node, &limit, &wb, &timeout) == false) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::getModel(): Invalid keyword argument.");
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OO", keywords, &node, &timeout) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getModelAsync(): Invalid keyword argument.");
         }
 
         if (node == nullptr || !PyAstNode_Check(node)) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::getModels(): Expects a AstNode as node argument.");
-        }
-
-        if (limit == nullptr || (!PyLong_Check(limit) && !PyInt_Check(limit))) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::getModels(): Expects an integer as limit argument.");
-        }
-
-        if (wb != nullptr && !PyBool_Check(wb)) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::getModel(): Expects a boolean as status keyword.");
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getModelAsync(): Expects a AstNode as node argument.");
         }
 
         if (timeout != nullptr && (!PyLong_Check(timeout) && !PyInt_Check(timeout))) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::getModel(): Expects a integer as timeout keyword.");
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getModelAsync(): Expects a integer as timeout keyword.");
         }
 
         if (timeout != nullptr) {
@@ -1490,20 +2949,7 @@ namespace triton {
         }
 
         try {
-          auto models = PyTritonContext_AsTritonContext(self)->getModels(PyAstNode_AsAstNode(node), PyLong_AsUint32(limit), &status, timeout_c, &solvingTime);
-          triton::uint32 index = 0;
-
-          ret = xPyList_New(models.size());
-          for (auto it = models.begin(); it != models.end(); it++) {
-            PyObject* mdict = xPyDict_New();
-            auto model = *it;
-
-            for (auto it2 = model.begin(); it2 != model.end(); it2++) {
-              xPyDict_SetItem(mdict, PyLong_FromUsize(it2->first), PySolverModel(it2->second));
-            }
-            if (model.size() > 0)
-              PyList_SetItem(ret, index++, mdict);
-          }
+          return PySolverFuture(PyTritonContext_AsTritonContext(self)->getModelAsync(PyAstNode_AsAstNode(node), timeout_c));
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1511,10 +2957,149 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
+      }
 
-        if (wb != nullptr && PyLong_AsBool(wb) == true) {
-          PyObject* tuple = triton::bindings::python::xPyTuple_New(3);
-          PyTuple_SetItem(tuple, 0, ret);
+
+      static PyObject* TritonContext_getModels(PyObject* self, PyObject* args, PyObject* kwargs) {
+        std::vector<triton::engines::symbolic::SharedSymbolicVariable> vars;
+        triton::engines::solver::status_e status;
+        triton::uint32 solvingTime = 0;
+        triton::uint32 timeout_c = 0;
+
+        PyObject* ret       = nullptr;
+        PyObject* node      = nullptr;
+        PyObject* limit     = nullptr;
+        PyObject* wb        = nullptr;
+        PyObject* timeout   = nullptr;
+        PyObject* variables = nullptr;
+        PyObject* callback  = nullptr;
+
+        static char* keywords[] = {
+          (char*)"node",
+          (char*)"limit",
+          (char*)"status",
+          (char*)"timeout",
+          (char*)"variables",
+          (char*)"callback",
+          nullptr
+        };
+
+        /* Extract Keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OOOOOO", keywords, &node, &limit, &wb, &timeout, &variables, &callback) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getModels(): Invalid keyword argument.");
+        }
+
+        if (node == nullptr || !PyAstNode_Check(node)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getModels(): Expects a AstNode as node argument.");
+        }
+
+        if (limit == nullptr || (!PyLong_Check(limit) && !PyInt_Check(limit))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getModels(): Expects an integer as limit argument.");
+        }
+
+        if (wb != nullptr && !PyBool_Check(wb)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getModels(): Expects a boolean as status keyword.");
+        }
+
+        if (timeout != nullptr && (!PyLong_Check(timeout) && !PyInt_Check(timeout))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getModels(): Expects a integer as timeout keyword.");
+        }
+
+        if (variables != nullptr && variables != Py_None) {
+          if (!PyList_Check(variables)) {
+            return PyErr_Format(PyExc_TypeError, "TritonContext::getModels(): Expects a list of SymbolicVariable as variables keyword.");
+          }
+          for (Py_ssize_t i = 0; i < PyList_Size(variables); i++) {
+            PyObject* item = PyList_GetItem(variables, i);
+            if (!PySymbolicVariable_Check(item)) {
+              return PyErr_Format(PyExc_TypeError, "TritonContext::getModels(): Each element of variables must be a SymbolicVariable.");
+            }
+            vars.push_back(PySymbolicVariable_AsSymbolicVariable(item));
+          }
+        }
+
+        if (callback != nullptr && callback != Py_None && !PyCallable_Check(callback)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getModels(): Expects a function as callback keyword.");
+        }
+
+        if (timeout != nullptr) {
+          timeout_c = PyLong_AsUint32(timeout);
+        }
+
+        try {
+          auto ctx    = PyTritonContext_AsTritonContext(self);
+          auto cnode  = PyAstNode_AsAstNode(node);
+          auto climit = PyLong_AsUint32(limit);
+
+          auto toDict = [](const std::unordered_map<triton::usize, triton::engines::solver::SolverModel>& model) {
+            PyObject* mdict = xPyDict_New();
+            for (auto it = model.begin(); it != model.end(); it++) {
+              xPyDict_SetItem(mdict, PyLong_FromUsize(it->first), PySolverModel(it->second));
+            }
+            return mdict;
+          };
+
+          /* The models are given to the callback as they are found */
+          if (callback != nullptr && callback != Py_None) {
+            triton::usize count = 0;
+            PyAllowThreads([&]() {
+              count = ctx->enumerateModels(cnode, climit, [callback, &toDict](const std::unordered_map<triton::usize, triton::engines::solver::SolverModel>& model) {
+                PyGilGuard gil;
+                PyObject* cbargs = xPyTuple_New(1);
+                PyTuple_SetItem(cbargs, 0, toDict(model));
+
+                /* Call the callback */
+                PyObject* cbret = PyObject_CallObject(callback, cbargs);
+                Py_DECREF(cbargs);
+
+                /* Check the call */
+                if (cbret == nullptr) {
+                  throw triton::exceptions::PyCallbacks();
+                }
+
+                /* The enumeration stops if the callback returns False */
+                bool next = (cbret != Py_False);
+                Py_DECREF(cbret);
+                return next;
+              }, vars, &status, timeout_c, &solvingTime);
+            });
+
+            ret = PyLong_FromUsize(count);
+          }
+
+          else {
+            std::vector<std::unordered_map<triton::usize, triton::engines::solver::SolverModel>> models;
+
+            PyAllowThreads([&]() {
+              if (vars.empty())
+                models = ctx->getModels(cnode, climit, &status, timeout_c, &solvingTime);
+              else
+                ctx->enumerateModels(cnode, climit, [&models](const std::unordered_map<triton::usize, triton::engines::solver::SolverModel>& model) {
+                  models.push_back(model);
+                  return true;
+                }, vars, &status, timeout_c, &solvingTime);
+            });
+
+            ret = xPyList_New(0);
+            for (auto it = models.begin(); it != models.end(); it++) {
+              if (it->size() == 0)
+                continue;
+              PyObject* mdict = toDict(*it);
+              PyList_Append(ret, mdict);
+              Py_DECREF(mdict);
+            }
+          }
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        if (wb != nullptr && PyLong_AsBool(wb) == true) {
+          PyObject* tuple = triton::bindings::python::xPyTuple_New(3);
+          PyTuple_SetItem(tuple, 0, ret);
           PyTuple_SetItem(tuple, 1, PyLong_FromUint32(status));
           PyTuple_SetItem(tuple, 2, PyLong_FromUint32(solvingTime));
           return tuple;
@@ -1524,6 +3109,78 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_getModelWithAssumptions(PyObject* self, PyObject* args, PyObject* kwargs) {
+        triton::engines::solver::status_e status;
+        std::vector<triton::ast::SharedAbstractNode> assumptions;
+        triton::uint32 solvingTime = 0;
+        triton::uint32 timeout_c = 0;
+
+        PyObject* dict    = nullptr;
+        PyObject* nodes   = nullptr;
+        PyObject* wb      = nullptr;
+        PyObject* timeout = nullptr;
+
+        static char* keywords[] = {
+          (char*)"assumptions",
+          (char*)"status",
+          (char*)"timeout",
+          nullptr
+        };
+
+        /* Extract Keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OOO", keywords, &nodes, &wb, &timeout) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getModelWithAssumptions(): Invalid keyword argument.");
+        }
+
+        if (nodes == nullptr || !PyList_Check(nodes)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getModelWithAssumptions(): Expects a list of AstNode as assumptions argument.");
+        }
+
+        for (Py_ssize_t i = 0; i < PyList_Size(nodes); i++) {
+          PyObject* node = PyList_GetItem(nodes, i);
+          if (!PyAstNode_Check(node))
+            return PyErr_Format(PyExc_TypeError, "TritonContext::getModelWithAssumptions(): Expects a list of AstNode as assumptions argument.");
+          assumptions.push_back(PyAstNode_AsAstNode(node));
+        }
+
+        if (wb != nullptr && !PyBool_Check(wb)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getModelWithAssumptions(): Expects a boolean as status keyword.");
+        }
+
+        if (timeout != nullptr && (!PyLong_Check(timeout) && !PyInt_Check(timeout))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getModelWithAssumptions(): Expects a integer as timeout keyword.");
+        }
+
+        if (timeout != nullptr) {
+          timeout_c = PyLong_AsUint32(timeout);
+        }
+
+        try {
+          dict = triton::bindings::python::xPyDict_New();
+          auto model = PyTritonContext_AsTritonContext(self)->getModelWithAssumptions(assumptions, &status, timeout_c, &solvingTime);
+          for (auto it = model.begin(); it != model.end(); it++) {
+            xPyDict_SetItem(dict, PyLong_FromUsize(it->first), PySolverModel(it->second));
+          }
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        if (wb != nullptr && PyLong_AsBool(wb) == true) {
+          PyObject* tuple = triton::bindings::python::xPyTuple_New(3);
+          PyTuple_SetItem(tuple, 0, dict);
+          PyTuple_SetItem(tuple, 1, PyLong_FromUint32(status));
+          PyTuple_SetItem(tuple, 2, PyLong_FromUint32(solvingTime));
+          return tuple;
+        }
+
+        return dict;
+      }
+
+
       static PyObject* TritonContext_getParentRegisters(PyObject* self, PyObject* noarg) {
         PyObject* ret = nullptr;
 
@@ -1551,13 +3208,7 @@ namespace triton {
         PyObject* ret = nullptr;
 
         try {
-          triton::uint32 index = 0;
-          const auto& pc = PyTritonContext_AsTritonContext(self)->getPathConstraints();
-
-          ret = xPyList_New(pc.size());
-          for (auto it = pc.begin(); it != pc.end(); it++) {
-            PyList_SetItem(ret, index++, PyPathConstraint(*it));
-          }
+          ret = PyListView(PyTritonContext_AsTritonContext(self)->getPathConstraints());
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1585,8 +3236,89 @@ namespace triton {
 
       static PyObject* TritonContext_getPathPredicateSize(PyObject* self, PyObject* noarg) {
         try {
-          const auto& pc = PyTritonContext_AsTritonContext(self)->getPathConstraints();
-          return PyLong_FromUsize(pc.size());
+          /* The spilled path constraints are not faulted in */
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getSizeOfPathConstraints());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getPredicateToFlipIteration(PyObject* self, PyObject* args) {
+        PyObject* index     = nullptr;
+        PyObject* iteration = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &index, &iteration) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getPredicateToFlipIteration(): Invalid number of arguments");
+        }
+
+        if (index == nullptr || (!PyLong_Check(index) && !PyInt_Check(index)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getPredicateToFlipIteration(): Expects an integer as first argument.");
+
+        if (iteration == nullptr || (!PyLong_Check(iteration) && !PyInt_Check(iteration)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getPredicateToFlipIteration(): Expects an integer as second argument.");
+
+        try {
+          return PyAstNode(PyTritonContext_AsTritonContext(self)->getPredicateToFlipIteration(PyLong_AsUsize(index), PyLong_AsUsize(iteration)));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getPointerPolicy(PyObject* self, PyObject* args) {
+        PyObject* addr = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|O", &addr) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getPointerPolicy(): Invalid number of arguments");
+        }
+
+        if (addr != nullptr && addr != Py_None && (!PyLong_Check(addr) && !PyInt_Check(addr)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getPointerPolicy(): Expects an address as argument.");
+
+        try {
+          const auto* policy = PyTritonContext_AsTritonContext(self)->getConcretizationPolicy();
+          if (addr == nullptr || addr == Py_None)
+            return PyLong_FromUint32(policy->getPolicy());
+          return PyLong_FromUint32(policy->getPolicy(PyLong_AsUint64(addr)));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getPointerStatistics(PyObject* self, PyObject* noarg) {
+        try {
+          const auto* policy = PyTritonContext_AsTritonContext(self)->getConcretizationPolicy();
+          PyObject* ret = xPyDict_New();
+
+          for (const auto& site : policy->getStatistics()) {
+            PyObject* item = xPyDict_New();
+            xPyDict_SetItemString(item, "branches",     PyLong_FromUsize(site.second.branches));
+            xPyDict_SetItemString(item, "concretized",  PyLong_FromUsize(site.second.concretized));
+            xPyDict_SetItemString(item, "constrained",  PyLong_FromUsize(site.second.constrained));
+            xPyDict_SetItemString(item, "dereferences", PyLong_FromUsize(site.second.dereferences));
+            xPyDict_SetItemString(item, "fallbacks",    PyLong_FromUsize(site.second.fallbacks));
+            xPyDict_SetItemString(item, "forked",       PyLong_FromUsize(site.second.forked));
+            xPyDict_SetItemString(item, "symbolic",     PyLong_FromUsize(site.second.symbolic));
+            xPyDict_SetItem(ret, PyLong_FromUint64(site.first), item);
+          }
+
+          return ret;
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1623,6 +3355,67 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_getProfile(PyObject* self, PyObject* n) {
+        if (n == nullptr || (!PyLong_Check(n) && !PyInt_Check(n)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getProfile(): Expects an integer as argument.");
+
+        try {
+          const auto* statistics = PyTritonContext_AsTritonContext(self)->getStatistics();
+          auto topOpcodes   = statistics->getTopOpcodes(PyLong_AsUsize(n));
+          auto topAddresses = statistics->getTopAddresses(PyLong_AsUsize(n));
+          auto topBlocks    = statistics->getTopBlocks(PyLong_AsUsize(n));
+          PyObject* opcodes   = xPyList_New(topOpcodes.size());
+          PyObject* addresses = xPyList_New(topAddresses.size());
+          PyObject* blocks    = xPyList_New(topBlocks.size());
+          PyObject* ret       = xPyDict_New();
+
+          for (triton::usize index = 0; index < topOpcodes.size(); index++) {
+            PyObject* item = xPyDict_New();
+            PyObject* pair = xPyTuple_New(2);
+            xPyDict_SetItemString(item, "expressions",  PyLong_FromUsize(topOpcodes[index].second.expressions));
+            xPyDict_SetItemString(item, "instructions", PyLong_FromUsize(topOpcodes[index].second.instructions));
+            xPyDict_SetItemString(item, "nodes",        PyLong_FromUsize(topOpcodes[index].second.nodes));
+            PyTuple_SetItem(pair, 0, PyLong_FromUint32(topOpcodes[index].first));
+            PyTuple_SetItem(pair, 1, item);
+            PyList_SetItem(opcodes, index, pair);
+          }
+
+          for (triton::usize index = 0; index < topAddresses.size(); index++) {
+            PyObject* item = xPyDict_New();
+            PyObject* pair = xPyTuple_New(2);
+            xPyDict_SetItemString(item, "expressions",  PyLong_FromUsize(topAddresses[index].second.expressions));
+            xPyDict_SetItemString(item, "instructions", PyLong_FromUsize(topAddresses[index].second.instructions));
+            xPyDict_SetItemString(item, "nodes",        PyLong_FromUsize(topAddresses[index].second.nodes));
+            PyTuple_SetItem(pair, 0, PyLong_FromUint64(topAddresses[index].first));
+            PyTuple_SetItem(pair, 1, item);
+            PyList_SetItem(addresses, index, pair);
+          }
+
+          for (triton::usize index = 0; index < topBlocks.size(); index++) {
+            PyObject* item = xPyDict_New();
+            PyObject* pair = xPyTuple_New(2);
+            xPyDict_SetItemString(item, "executions",   PyLong_FromUsize(topBlocks[index].second.executions));
+            xPyDict_SetItemString(item, "instructions", PyLong_FromUsize(topBlocks[index].second.instructions));
+            xPyDict_SetItemString(item, "nodes",        PyLong_FromUsize(topBlocks[index].second.nodes));
+            PyTuple_SetItem(pair, 0, PyLong_FromUint64(topBlocks[index].first));
+            PyTuple_SetItem(pair, 1, item);
+            PyList_SetItem(blocks, index, pair);
+          }
+
+          xPyDict_SetItemString(ret, "addresses", addresses);
+          xPyDict_SetItemString(ret, "blocks",    blocks);
+          xPyDict_SetItemString(ret, "opcodes",   opcodes);
+          return ret;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* TritonContext_getRegister(PyObject* self, PyObject* regIn) {
         try {
           if (regIn != nullptr && (PyLong_Check(regIn) || PyInt_Check(regIn))) {
@@ -1666,9 +3459,12 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_getSolver(PyObject* self, PyObject* noarg) {
+      static PyObject* TritonContext_getRegisterTaintBits(PyObject* self, PyObject* reg) {
+        if (!PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getRegisterTaintBits(): Expects a Register as argument.");
+
         try {
-          return PyLong_FromUint32(PyTritonContext_AsTritonContext(self)->getSolver());
+          return PyLong_FromUint64(PyTritonContext_AsTritonContext(self)->getRegisterTaintBits(*PyRegister_AsRegister(reg)));
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1679,12 +3475,17 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_getSymbolicExpression(PyObject* self, PyObject* symExprId) {
-        if (!PyLong_Check(symExprId) && !PyInt_Check(symExprId))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::getSymbolicExpression(): Expects an integer as argument.");
+      static PyObject* TritonContext_getRegisterTaintLabels(PyObject* self, PyObject* reg) {
+        PyObject* ret = nullptr;
+
+        if (!PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getRegisterTaintLabels(): Expects a Register as argument.");
 
         try {
-          return PySymbolicExpression(PyTritonContext_AsTritonContext(self)->getSymbolicExpression(PyLong_AsUsize(symExprId)));
+          std::vector<triton::uint32> list = PyTritonContext_AsTritonContext(self)->getRegisterTaintLabels(*PyRegister_AsRegister(reg)).getLabels();
+          ret = xPyList_New(list.size());
+          for (triton::usize index = 0; index < list.size(); index++)
+            PyList_SetItem(ret, index, PyLong_FromUint32(list[index]));
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1692,18 +3493,17 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
+
+        return ret;
       }
 
 
-      static PyObject* TritonContext_getSymbolicExpressions(PyObject* self, PyObject* noarg) {
-        PyObject* ret = nullptr;
+      static PyObject* TritonContext_getRelevantPathPredicate(PyObject* self, PyObject* node) {
+        if (!PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getRelevantPathPredicate(): Expects an AstNode as argument.");
 
         try {
-          const auto& expressions = PyTritonContext_AsTritonContext(self)->getSymbolicExpressions();
-
-          ret = xPyDict_New();
-          for (auto it = expressions.begin(); it != expressions.end(); it++)
-            xPyDict_SetItem(ret, PyLong_FromUsize(it->first), PySymbolicExpression(it->second));
+          return PyAstNode(PyTritonContext_AsTritonContext(self)->getRelevantPathPredicate(PyAstNode_AsAstNode(node)));
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1711,34 +3511,12 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
-
-        return ret;
       }
 
 
-      static PyObject* TritonContext_getSymbolicMemory(PyObject* self, PyObject* args) {
-        PyObject* ret  = nullptr;
-        PyObject* addr = nullptr;
-
-        /* Extract arguments */
-        if (PyArg_ParseTuple(args, "|O", &addr) == false) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::getSymbolicMemory(): Invalid number of arguments");
-        }
-
+      static PyObject* TritonContext_getSimplificationCacheSize(PyObject* self, PyObject* noarg) {
         try {
-          if (addr == nullptr) {
-            auto regs = PyTritonContext_AsTritonContext(self)->getSymbolicMemory();
-
-            ret = xPyDict_New();
-            for (auto it = regs.begin(); it != regs.end(); it++) {
-              xPyDict_SetItem(ret, PyLong_FromUint64(it->first), PySymbolicExpression(it->second));
-            }
-          }
-          else if (addr != nullptr && (PyLong_Check(addr) || PyInt_Check(addr))) {
-            ret = PySymbolicExpression(PyTritonContext_AsTritonContext(self)->getSymbolicMemory(PyLong_AsUint64(addr)));
-          }
-          else
-            return PyErr_Format(PyExc_TypeError, "TritonContext::getSymbolicMemory(): Expects an integer or nothing as argument.");
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getSimplificationCacheSize());
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1746,22 +3524,16 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
-
-        return ret;
       }
 
 
-      static PyObject* TritonContext_getSymbolicMemoryValue(PyObject* self, PyObject* mem) {
-        if (!PyLong_Check(mem) && !PyInt_Check(mem) && !PyMemoryAccess_Check(mem))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::getSymbolicMemoryValue(): Expects an integer or a MemoryAccess as argument.");
-
+      static PyObject* TritonContext_getSimplificationPasses(PyObject* self, PyObject* noarg) {
         try {
-          if (PyLong_Check(mem) || PyInt_Check(mem))
-            return PyLong_FromUint512(PyTritonContext_AsTritonContext(self)->getSymbolicMemoryValue(PyLong_AsUint64(mem)));
-          return PyLong_FromUint512(PyTritonContext_AsTritonContext(self)->getSymbolicMemoryValue(*PyMemoryAccess_AsMemoryAccess(mem)));
-        }
-        catch (const triton::exceptions::PyCallbacks&) {
-          return nullptr;
+          auto passes = PyTritonContext_AsTritonContext(self)->getSimplificationPasses();
+          PyObject* ret = xPyList_New(passes.size());
+          for (triton::usize index = 0; index < passes.size(); index++)
+            PyList_SetItem(ret, index, PyStr_FromString(passes[index].c_str()));
+          return ret;
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -1769,16 +3541,20 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_getSymbolicRegisters(PyObject* self, PyObject* noarg) {
-        PyObject* ret = nullptr;
-
+      static PyObject* TritonContext_getSimplificationStatistics(PyObject* self, PyObject* noarg) {
         try {
-          auto regs = PyTritonContext_AsTritonContext(self)->getSymbolicRegisters();
-
-          ret = xPyDict_New();
-          for (auto it = regs.begin(); it != regs.end(); it++) {
-            xPyDict_SetItem(ret, PyLong_FromUint64(it->first), PySymbolicExpression(it->second));
+          auto* ctx = PyTritonContext_AsTritonContext(self);
+          PyObject* ret = xPyDict_New();
+          PyObject* passes = xPyDict_New();
+          for (const auto& it : ctx->getSimplificationPassStatistics()) {
+            PyObject* pass = xPyDict_New();
+            xPyDict_SetItemString(pass, "calls",    PyLong_FromUsize(it.second.calls));
+            xPyDict_SetItemString(pass, "rewrites", PyLong_FromUsize(it.second.rewrites));
+            xPyDict_SetItemString(passes, it.first.c_str(), pass);
           }
+          xPyDict_SetItemString(ret, "memoHits", PyLong_FromUsize(ctx->getSimplificationMemoHits()));
+          xPyDict_SetItemString(ret, "passes",   passes);
+          return ret;
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1786,17 +3562,12 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
-
-        return ret;
       }
 
 
-      static PyObject* TritonContext_getSymbolicRegister(PyObject* self, PyObject* reg) {
-        if (!PyRegister_Check(reg))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::getSymbolicRegister(): Expects a Register as argument.");
-
+      static PyObject* TritonContext_getSolver(PyObject* self, PyObject* noarg) {
         try {
-          return PySymbolicExpression(PyTritonContext_AsTritonContext(self)->getSymbolicRegister(*PyRegister_AsRegister(reg)));
+          return PyLong_FromUint32(PyTritonContext_AsTritonContext(self)->getSolver());
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1807,12 +3578,15 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_getSymbolicRegisterValue(PyObject* self, PyObject* reg) {
-        if (!PyRegister_Check(reg))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::getSymbolicRegisterValue(): Expects a Register as argument.");
-
+      static PyObject* TritonContext_getSolverAnalyticStatistics(PyObject* self, PyObject* noarg) {
         try {
-          return PyLong_FromUint512(PyTritonContext_AsTritonContext(self)->getSymbolicRegisterValue(*PyRegister_AsRegister(reg)));
+          const auto* analytic = PyTritonContext_AsTritonContext(self)->getSolverAnalytic();
+          PyObject* ret = xPyDict_New();
+          xPyDict_SetItemString(ret, "decided",   PyLong_FromUsize(analytic->getDecided()));
+          xPyDict_SetItemString(ret, "delegated", PyLong_FromUsize(analytic->getDelegated()));
+          xPyDict_SetItemString(ret, "queries",   PyLong_FromUsize(analytic->getQueries()));
+          xPyDict_SetItemString(ret, "variables", PyLong_FromUsize(analytic->getVariables()));
+          return ret;
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1823,16 +3597,14 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_getSymbolicVariable(PyObject* self, PyObject* arg) {
+      static PyObject* TritonContext_getSolverBudgetStatistics(PyObject* self, PyObject* noarg) {
         try {
-          if (PyLong_Check(arg) || PyInt_Check(arg))
-            return PySymbolicVariable(PyTritonContext_AsTritonContext(self)->getSymbolicVariable(PyLong_AsUsize(arg)));
-
-          else if (PyStr_Check(arg))
-            return PySymbolicVariable(PyTritonContext_AsTritonContext(self)->getSymbolicVariable(PyStr_AsString(arg)));
-
-          else
-            return PyErr_Format(PyExc_TypeError, "TritonContext::getSymbolicVariable(): Expects an integer or a string as argument.");
+          const auto* budget = PyTritonContext_AsTritonContext(self)->getSolverBudget();
+          PyObject* ret = xPyDict_New();
+          xPyDict_SetItemString(ret, "budget",  PyLong_FromUint64(budget->getBudget()));
+          xPyDict_SetItemString(ret, "retried", PyLong_FromUsize(budget->getRetries()));
+          xPyDict_SetItemString(ret, "spent",   PyLong_FromUint64(budget->getSpent()));
+          return ret;
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1843,15 +3615,15 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_getSymbolicVariables(PyObject* self, PyObject* noarg) {
-        PyObject* ret = nullptr;
-
+      static PyObject* TritonContext_getSolverCacheStatistics(PyObject* self, PyObject* noarg) {
         try {
-          const auto& variables = PyTritonContext_AsTritonContext(self)->getSymbolicVariables();
-
-          ret = xPyDict_New();
-          for (auto sv: variables)
-            xPyDict_SetItem(ret, PyLong_FromUsize(sv.first), PySymbolicVariable(sv.second));
+          const auto* cache = PyTritonContext_AsTritonContext(self)->getSolverCache();
+          PyObject* ret = xPyDict_New();
+          xPyDict_SetItemString(ret, "counterexamples", PyLong_FromUsize(cache->getCounterexampleHits()));
+          xPyDict_SetItemString(ret, "hits",            PyLong_FromUsize(cache->getHits()));
+          xPyDict_SetItemString(ret, "misses",          PyLong_FromUsize(cache->getMisses()));
+          xPyDict_SetItemString(ret, "size",            PyLong_FromUsize(cache->size()));
+          return ret;
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1859,24 +3631,16 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
-
-        return ret;
       }
 
 
-      static PyObject* TritonContext_getTaintedMemory(PyObject* self, PyObject* noarg) {
-        PyObject* ret = nullptr;
-        triton::usize size = 0, index = 0;
-
+      static PyObject* TritonContext_getSolverLocalSearchStatistics(PyObject* self, PyObject* noarg) {
         try {
-          std::unordered_set<triton::uint64> addresses = PyTritonContext_AsTritonContext(self)->getTaintedMemory();
-
-          size = addresses.size();
-          ret = xPyList_New(size);
-          for (auto it = addresses.begin(); it != addresses.end(); it++) {
-            PyList_SetItem(ret, index, PyLong_FromUint64(*it));
-            index++;
-          }
+          const auto* search = PyTritonContext_AsTritonContext(self)->getSolverLocalSearch();
+          PyObject* ret = xPyDict_New();
+          xPyDict_SetItemString(ret, "handoffs", PyLong_FromUsize(search->getHandoffs()));
+          xPyDict_SetItemString(ret, "hits",     PyLong_FromUsize(search->getHits()));
+          return ret;
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1884,24 +3648,18 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
-
-        return ret;
       }
 
 
-      static PyObject* TritonContext_getTaintedRegisters(PyObject* self, PyObject* noarg) {
-        PyObject* ret = nullptr;
-        triton::usize size = 0, index = 0;
-
+      #if defined(TRITON_Z3_INTERFACE) || defined(TRITON_BITWUZLA_INTERFACE)
+      static PyObject* TritonContext_getSolverPortfolioWinner(PyObject* self, PyObject* noarg) {
         try {
-          std::unordered_set<const triton::arch::Register*> registers = PyTritonContext_AsTritonContext(self)->getTaintedRegisters();
-
-          size = registers.size();
-          ret = xPyList_New(size);
-          for (const auto* reg: registers) {
-            PyList_SetItem(ret, index, PyRegister(*reg));
-            index++;
+          auto winner = PyTritonContext_AsTritonContext(self)->getSolverPortfolio()->getLastWinner();
+          if (winner == triton::engines::solver::SOLVER_INVALID) {
+            Py_INCREF(Py_None);
+            return Py_None;
           }
+          return PyLong_FromUint32(winner);
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1909,24 +3667,15 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
-
-        return ret;
       }
 
 
-      static PyObject* TritonContext_getTaintedSymbolicExpressions(PyObject* self, PyObject* noarg) {
-        PyObject* ret = nullptr;
-        triton::usize size = 0, index = 0;
-
+      static PyObject* TritonContext_getSolverPortfolioWins(PyObject* self, PyObject* noarg) {
         try {
-          auto expressions = PyTritonContext_AsTritonContext(self)->getTaintedSymbolicExpressions();
-
-          size = expressions.size();
-          ret = xPyList_New(size);
-          for (auto it = expressions.begin(); it != expressions.end(); it++) {
-            PyList_SetItem(ret, index, PySymbolicExpression(*it));
-            index++;
-          }
+          PyObject* ret = xPyDict_New();
+          for (const auto& it : PyTritonContext_AsTritonContext(self)->getSolverPortfolio()->getWins())
+            xPyDict_SetItem(ret, PyLong_FromUint32(it.first), PyLong_FromUsize(it.second));
+          return ret;
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1934,16 +3683,21 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
-
-        return ret;
       }
+      #endif
 
 
-      static PyObject* TritonContext_isArchitectureValid(PyObject* self, PyObject* noarg) {
+      static PyObject* TritonContext_getSolverPreprocessingStatistics(PyObject* self, PyObject* noarg) {
         try {
-          if (PyTritonContext_AsTritonContext(self)->isArchitectureValid() == true)
-            Py_RETURN_TRUE;
-          Py_RETURN_FALSE;
+          const auto* preprocessor = PyTritonContext_AsTritonContext(self)->getSolverPreprocessor();
+          PyObject* ret = xPyDict_New();
+          xPyDict_SetItemString(ret, "decided",    PyLong_FromUsize(preprocessor->getDecided()));
+          xPyDict_SetItemString(ret, "dropped",    PyLong_FromUsize(preprocessor->getDroppedConjuncts()));
+          xPyDict_SetItemString(ret, "eliminated", PyLong_FromUsize(preprocessor->getEliminatedVariables()));
+          xPyDict_SetItemString(ret, "fixed",      PyLong_FromUsize(preprocessor->getFixedVariables()));
+          xPyDict_SetItemString(ret, "narrowed",   PyLong_FromUsize(preprocessor->getNarrowedNodes()));
+          xPyDict_SetItemString(ret, "queries",    PyLong_FromUsize(preprocessor->getQueries()));
+          return ret;
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1954,34 +3708,12 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_isConcreteMemoryValueDefined(PyObject* self, PyObject* args) {
-        PyObject* baseAddr        = nullptr;
-        PyObject* size            = nullptr;
-
-        /* Extract arguments */
-        if (PyArg_ParseTuple(args, "|OO", &baseAddr, &size) == false) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::isConcreteMemoryValueDefined(): Invalid number of arguments");
-        }
-
+      static PyObject* TritonContext_getSolverProfileStatistics(PyObject* self, PyObject* noarg) {
         try {
-          if (baseAddr && PyMemoryAccess_Check(baseAddr)) {
-            if (PyTritonContext_AsTritonContext(self)->isConcreteMemoryValueDefined(*PyMemoryAccess_AsMemoryAccess(baseAddr)) == true)
-              Py_RETURN_TRUE;
-            Py_RETURN_FALSE;
-          }
-          else if (baseAddr && (PyLong_Check(baseAddr) || PyInt_Check(baseAddr))) {
-            if (size && (PyLong_Check(size) || PyInt_Check(size))) {
-              if (PyTritonContext_AsTritonContext(self)->isConcreteMemoryValueDefined(PyLong_AsUint64(baseAddr), PyLong_AsUsize(size)) == true)
-                Py_RETURN_TRUE;
-              Py_RETURN_FALSE;
-            }
-            else {
-              return PyErr_Format(PyExc_TypeError, "TritonContext::isConcreteMemoryValueDefined(): Expects a size (integer) as second argument.");
-            }
-          }
-          else {
-            return PyErr_Format(PyExc_TypeError, "TritonContext::isConcreteMemoryValueDefined(): Expects a base address (integer) as arguments or a memory cells.");
-          }
+          PyObject* ret = xPyDict_New();
+          for (const auto& selection : PyTritonContext_AsTritonContext(self)->getSolverProfiles()->getSelections())
+            xPyDict_SetItemString(ret, selection.first.c_str(), PyLong_FromUsize(selection.second));
+          return ret;
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1992,14 +3724,29 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_isFlag(PyObject* self, PyObject* reg) {
-        if (!PyRegister_Check(reg))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::isFlag(): Expects a Register as argument.");
-
+      static PyObject* TritonContext_getSolverStatistics(PyObject* self, PyObject* noarg) {
         try {
-          if (PyTritonContext_AsTritonContext(self)->isFlag(*PyRegister_AsRegister(reg)) == true)
-            Py_RETURN_TRUE;
-          Py_RETURN_FALSE;
+          const auto* statistics = PyTritonContext_AsTritonContext(self)->getSolverStatistics();
+          std::vector<triton::usize> histogram = statistics->getHistogram();
+          PyObject* buckets = xPyList_New(histogram.size());
+          PyObject* ret = xPyDict_New();
+
+          for (triton::usize index = 0; index < histogram.size(); index++)
+            PyList_SetItem(buckets, index, PyLong_FromUsize(histogram[index]));
+
+          xPyDict_SetItemString(ret, "histogram", buckets);
+          xPyDict_SetItemString(ret, "hits",      PyLong_FromUsize(statistics->getCacheHits()));
+          xPyDict_SetItemString(ret, "largest",   PyLong_FromUsize(statistics->getLargestQuery()));
+          xPyDict_SetItemString(ret, "memory",    PyLong_FromUsize(statistics->getPeakMemory()));
+          xPyDict_SetItemString(ret, "nodes",     PyLong_FromUsize(statistics->getNodes()));
+          xPyDict_SetItemString(ret, "outofmem",  PyLong_FromUsize(statistics->getQueries(triton::engines::solver::OUTOFMEM)));
+          xPyDict_SetItemString(ret, "sat",       PyLong_FromUsize(statistics->getQueries(triton::engines::solver::SAT)));
+          xPyDict_SetItemString(ret, "slow",      PyLong_FromUsize(statistics->getSlowQueries()));
+          xPyDict_SetItemString(ret, "time",      PyLong_FromUint64(statistics->getTotalTime()));
+          xPyDict_SetItemString(ret, "timeout",   PyLong_FromUsize(statistics->getQueries(triton::engines::solver::TIMEOUT)));
+          xPyDict_SetItemString(ret, "unknown",   PyLong_FromUsize(statistics->getQueries(triton::engines::solver::UNKNOWN)));
+          xPyDict_SetItemString(ret, "unsat",     PyLong_FromUsize(statistics->getQueries(triton::engines::solver::UNSAT)));
+          return ret;
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -2010,20 +3757,9 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_isMemorySymbolized(PyObject* self, PyObject* mem) {
+      static PyObject* TritonContext_getSolverThreads(PyObject* self, PyObject* noarg) {
         try {
-          if (PyMemoryAccess_Check(mem)) {
-            if (PyTritonContext_AsTritonContext(self)->isMemorySymbolized(*PyMemoryAccess_AsMemoryAccess(mem)) == true)
-              Py_RETURN_TRUE;
-          }
-
-          else if (PyLong_Check(mem) || PyInt_Check(mem)) {
-            if (PyTritonContext_AsTritonContext(self)->isMemorySymbolized(PyLong_AsUint64(mem)) == true)
-              Py_RETURN_TRUE;
-          }
-
-          else
-            return PyErr_Format(PyExc_TypeError, "TritonContext::isMemorySymbolized(): Expects a MemoryAccess or an integer as argument.");
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getSolverThreads());
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -2031,25 +3767,39 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
-
-        Py_RETURN_FALSE;
       }
 
 
-      static PyObject* TritonContext_isMemoryTainted(PyObject* self, PyObject* mem) {
+      static PyObject* TritonContext_getStatistics(PyObject* self, PyObject* noarg) {
         try {
-          if (PyMemoryAccess_Check(mem)) {
-            if (PyTritonContext_AsTritonContext(self)->isMemoryTainted(*PyMemoryAccess_AsMemoryAccess(mem)) == true)
-              Py_RETURN_TRUE;
+          const auto* statistics = PyTritonContext_AsTritonContext(self)->getStatistics();
+          PyObject* phases = xPyDict_New();
+          PyObject* opcodes = xPyDict_New();
+          PyObject* ret = xPyDict_New();
+
+          for (triton::usize index = 0; index < triton::arch::PHASE_LAST; index++) {
+            auto phase = static_cast<triton::arch::phase_e>(index);
+            const auto& stats = statistics->getPhase(phase);
+            PyObject* item = xPyDict_New();
+            xPyDict_SetItemString(item, "count", PyLong_FromUsize(stats.count));
+            xPyDict_SetItemString(item, "time",  PyLong_FromUint64(stats.time));
+            xPyDict_SetItemString(phases, triton::arch::ProcessingStatistics::getPhaseName(phase), item);
           }
 
-          else if (PyLong_Check(mem) || PyInt_Check(mem)) {
-            if (PyTritonContext_AsTritonContext(self)->isMemoryTainted(PyLong_AsUint64(mem)) == true)
-              Py_RETURN_TRUE;
+          for (const auto& opcode : statistics->getOpcodes()) {
+            PyObject* item = xPyDict_New();
+            xPyDict_SetItemString(item, "expressions",  PyLong_FromUsize(opcode.second.expressions));
+            xPyDict_SetItemString(item, "instructions", PyLong_FromUsize(opcode.second.instructions));
+            xPyDict_SetItemString(item, "nodes",        PyLong_FromUsize(opcode.second.nodes));
+            xPyDict_SetItem(opcodes, PyLong_FromUint32(opcode.first), item);
           }
 
-          else
-            return PyErr_Format(PyExc_TypeError, "TritonContext::isMemoryTainted(): Expects a MemoryAccess or an integer as argument.");
+          xPyDict_SetItemString(ret, "expressions",  PyLong_FromUsize(statistics->getExpressions()));
+          xPyDict_SetItemString(ret, "instructions", PyLong_FromUsize(statistics->getInstructions()));
+          xPyDict_SetItemString(ret, "nodes",        PyLong_FromUsize(statistics->getNodes()));
+          xPyDict_SetItemString(ret, "opcodes",      opcodes);
+          xPyDict_SetItemString(ret, "phases",       phases);
+          return ret;
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -2057,19 +3807,12 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
-
-        Py_RETURN_FALSE;
       }
 
 
-      static PyObject* TritonContext_isRegister(PyObject* self, PyObject* reg) {
-        if (!PyRegister_Check(reg))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::isRegister(): Expects a Register as argument.");
-
+      static PyObject* TritonContext_getSymbolicDepthLimit(PyObject* self, PyObject* noarg) {
         try {
-          if (PyTritonContext_AsTritonContext(self)->isRegister(*PyRegister_AsRegister(reg)) == true)
-            Py_RETURN_TRUE;
-          Py_RETURN_FALSE;
+          return PyLong_FromUint32(PyTritonContext_AsTritonContext(self)->getSymbolicDepthLimit());
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -2080,14 +3823,9 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_isRegisterSymbolized(PyObject* self, PyObject* reg) {
-        if (!PyRegister_Check(reg))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::isRegisterSymbolized(): Expects a Register as argument.");
-
+      static PyObject* TritonContext_getSymbolicDepthPolicy(PyObject* self, PyObject* noarg) {
         try {
-          if (PyTritonContext_AsTritonContext(self)->isRegisterSymbolized(*PyRegister_AsRegister(reg)) == true)
-            Py_RETURN_TRUE;
-          Py_RETURN_FALSE;
+          return PyLong_FromUint32(PyTritonContext_AsTritonContext(self)->getSymbolicDepthPolicy());
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -2098,14 +3836,12 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_isRegisterTainted(PyObject* self, PyObject* reg) {
-        if (!PyRegister_Check(reg))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::isRegisterTainted(): Expects a Register as argument.");
+      static PyObject* TritonContext_getSymbolicExpression(PyObject* self, PyObject* symExprId) {
+        if (!PyLong_Check(symExprId) && !PyInt_Check(symExprId))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getSymbolicExpression(): Expects an integer as argument.");
 
         try {
-          if (PyTritonContext_AsTritonContext(self)->isRegisterTainted(*PyRegister_AsRegister(reg)) == true)
-            Py_RETURN_TRUE;
-          Py_RETURN_FALSE;
+          return PySymbolicExpression(PyTritonContext_AsTritonContext(self)->getSymbolicExpression(PyLong_AsUsize(symExprId)));
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -2116,14 +3852,11 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_isRegisterValid(PyObject* self, PyObject* reg) {
-        if (!PyRegister_Check(reg))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::isRegisterValid(): Expects a Register as argument.");
+      static PyObject* TritonContext_getSymbolicExpressions(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
 
         try {
-          if (PyTritonContext_AsTritonContext(self)->isRegisterValid(*PyRegister_AsRegister(reg)) == true)
-            Py_RETURN_TRUE;
-          Py_RETURN_FALSE;
+          ret = PyMapView(PyTritonContext_AsTritonContext(self)->getSymbolicExpressions());
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -2131,17 +3864,34 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
+
+        return ret;
       }
 
 
-      static PyObject* TritonContext_isSat(PyObject* self, PyObject* node) {
-        if (!PyAstNode_Check(node))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::isSat(): Expects a AstNode as argument.");
+      static PyObject* TritonContext_getSymbolicMemory(PyObject* self, PyObject* args) {
+        PyObject* ret  = nullptr;
+        PyObject* addr = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|O", &addr) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getSymbolicMemory(): Invalid number of arguments");
+        }
 
         try {
-          if (PyTritonContext_AsTritonContext(self)->isSat(PyAstNode_AsAstNode(node)) == true)
-            Py_RETURN_TRUE;
-          Py_RETURN_FALSE;
+          if (addr == nullptr) {
+            auto regs = PyTritonContext_AsTritonContext(self)->getSymbolicMemory();
+
+            ret = xPyDict_New();
+            for (auto it = regs.begin(); it != regs.end(); it++) {
+              xPyDict_SetItem(ret, PyLong_FromUint64(it->first), PySymbolicExpression(it->second));
+            }
+          }
+          else if (addr != nullptr && (PyLong_Check(addr) || PyInt_Check(addr))) {
+            ret = PySymbolicExpression(PyTritonContext_AsTritonContext(self)->getSymbolicMemory(PyLong_AsUint64(addr)));
+          }
+          else
+            return PyErr_Format(PyExc_TypeError, "TritonContext::getSymbolicMemory(): Expects an integer or nothing as argument.");
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -2149,14 +3899,19 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
+
+        return ret;
       }
 
 
-      static PyObject* TritonContext_isSymbolicEngineEnabled(PyObject* self, PyObject* noarg) {
+      static PyObject* TritonContext_getSymbolicMemoryValue(PyObject* self, PyObject* mem) {
+        if (!PyLong_Check(mem) && !PyInt_Check(mem) && !PyMemoryAccess_Check(mem))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getSymbolicMemoryValue(): Expects an integer or a MemoryAccess as argument.");
+
         try {
-          if (PyTritonContext_AsTritonContext(self)->isSymbolicEngineEnabled() == true)
-            Py_RETURN_TRUE;
-          Py_RETURN_FALSE;
+          if (PyLong_Check(mem) || PyInt_Check(mem))
+            return PyLong_FromUint512(PyTritonContext_AsTritonContext(self)->getSymbolicMemoryValue(PyLong_AsUint64(mem)));
+          return PyLong_FromUint512(PyTritonContext_AsTritonContext(self)->getSymbolicMemoryValue(*PyMemoryAccess_AsMemoryAccess(mem)));
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -2167,14 +3922,16 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_isSymbolicExpressionExists(PyObject* self, PyObject* symExprId) {
-        if (!PyInt_Check(symExprId) && !PyLong_Check(symExprId))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::isSymbolicExpressionExists(): Expects an integer as argument.");
+      static PyObject* TritonContext_getSymbolicRegisters(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
 
         try {
-          if (PyTritonContext_AsTritonContext(self)->isSymbolicExpressionExists(PyLong_AsUsize(symExprId)) == true)
-            Py_RETURN_TRUE;
-          Py_RETURN_FALSE;
+          auto regs = PyTritonContext_AsTritonContext(self)->getSymbolicRegisters();
+
+          ret = xPyDict_New();
+          for (auto it = regs.begin(); it != regs.end(); it++) {
+            xPyDict_SetItem(ret, PyLong_FromUint64(it->first), PySymbolicExpression(it->second));
+          }
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -2182,17 +3939,17 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
+
+        return ret;
       }
 
 
-      static PyObject* TritonContext_isModeEnabled(PyObject* self, PyObject* mode) {
-        if (!PyInt_Check(mode) && !PyLong_Check(mode))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::isModeEnabled(): Expects a MODE as argument.");
+      static PyObject* TritonContext_getSymbolicRegister(PyObject* self, PyObject* reg) {
+        if (!PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getSymbolicRegister(): Expects a Register as argument.");
 
         try {
-          if (PyTritonContext_AsTritonContext(self)->isModeEnabled(static_cast<triton::modes::mode_e>(PyLong_AsUint32(mode))) == true)
-            Py_RETURN_TRUE;
-          Py_RETURN_FALSE;
+          return PySymbolicExpression(PyTritonContext_AsTritonContext(self)->getSymbolicRegister(*PyRegister_AsRegister(reg)));
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -2203,10 +3960,247 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_isTaintEngineEnabled(PyObject* self, PyObject* noarg) {
+      static PyObject* TritonContext_getSymbolicRegisterValue(PyObject* self, PyObject* reg) {
+        if (!PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getSymbolicRegisterValue(): Expects a Register as argument.");
+
         try {
-          if (PyTritonContext_AsTritonContext(self)->isTaintEngineEnabled() == true)
-            Py_RETURN_TRUE;
+          return PyLong_FromUint512(PyTritonContext_AsTritonContext(self)->getSymbolicRegisterValue(*PyRegister_AsRegister(reg)));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getSymbolicVariable(PyObject* self, PyObject* arg) {
+        try {
+          if (PyLong_Check(arg) || PyInt_Check(arg))
+            return PySymbolicVariable(PyTritonContext_AsTritonContext(self)->getSymbolicVariable(PyLong_AsUsize(arg)));
+
+          else if (PyStr_Check(arg))
+            return PySymbolicVariable(PyTritonContext_AsTritonContext(self)->getSymbolicVariable(PyStr_AsString(arg)));
+
+          else
+            return PyErr_Format(PyExc_TypeError, "TritonContext::getSymbolicVariable(): Expects an integer or a string as argument.");
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getSymbolicVariables(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          ret = PyMapView(PyTritonContext_AsTritonContext(self)->getSymbolicVariables());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getSynthesisCacheSize(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getSynthesisCacheSize());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getSyscallFile(PyObject* self, PyObject* path) {
+        if (path == nullptr || !PyStr_Check(path))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getSyscallFile(): Expects a string as argument.");
+
+        try {
+          const std::vector<triton::uint8>& content = PyTritonContext_AsTritonContext(self)->getSyscallFile(PyStr_AsString(path));
+          return PyBytes_FromStringAndSize(reinterpret_cast<const char*>(content.data()), content.size());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getTaintedMemory(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          ret = PyListView(PyTritonContext_AsTritonContext(self)->getTaintedMemory());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getTaintedRegisters(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+        triton::usize size = 0, index = 0;
+
+        try {
+          std::unordered_set<const triton::arch::Register*> registers = PyTritonContext_AsTritonContext(self)->getTaintedRegisters();
+
+          size = registers.size();
+          ret = xPyList_New(size);
+          for (const auto* reg: registers) {
+            PyList_SetItem(ret, index, PyRegister(*reg));
+            index++;
+          }
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getTaintedSymbolicExpressions(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+        triton::usize size = 0, index = 0;
+
+        try {
+          auto expressions = PyTritonContext_AsTritonContext(self)->getTaintedSymbolicExpressions();
+
+          size = expressions.size();
+          ret = xPyList_New(size);
+          for (auto it = expressions.begin(); it != expressions.end(); it++) {
+            PyList_SetItem(ret, index, PySymbolicExpression(*it));
+            index++;
+          }
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getThread(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUint32(PyTritonContext_AsTritonContext(self)->getThread());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getThreads(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          std::vector<triton::uint32> threads = PyTritonContext_AsTritonContext(self)->getThreads();
+
+          ret = xPyList_New(threads.size());
+          for (triton::usize index = 0; index < threads.size(); index++)
+            PyList_SetItem(ret, index, PyLong_FromUint32(threads[index]));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getUnsatCore(PyObject* self, PyObject* args, PyObject* kwargs) {
+        std::vector<triton::ast::SharedAbstractNode> conjuncts;
+        triton::uint32 timeout_c = 0;
+
+        PyObject* nodes   = nullptr;
+        PyObject* timeout = nullptr;
+        PyObject* ret     = nullptr;
+
+        static char* keywords[] = {
+          (char*)"conjuncts",
+          (char*)"timeout",
+          nullptr
+        };
+
+        /* Extract Keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OO", keywords, &nodes, &timeout) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getUnsatCore(): Invalid keyword argument.");
+        }
+
+        if (nodes == nullptr || !PyList_Check(nodes)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getUnsatCore(): Expects a list of AstNode as conjuncts argument.");
+        }
+
+        for (Py_ssize_t i = 0; i < PyList_Size(nodes); i++) {
+          PyObject* node = PyList_GetItem(nodes, i);
+          if (!PyAstNode_Check(node))
+            return PyErr_Format(PyExc_TypeError, "TritonContext::getUnsatCore(): Expects a list of AstNode as conjuncts argument.");
+          conjuncts.push_back(PyAstNode_AsAstNode(node));
+        }
+
+        if (timeout != nullptr && (!PyLong_Check(timeout) && !PyInt_Check(timeout))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getUnsatCore(): Expects a integer as timeout keyword.");
+        }
+
+        if (timeout != nullptr) {
+          timeout_c = PyLong_AsUint32(timeout);
+        }
+
+        try {
+          auto ctx = PyTritonContext_AsTritonContext(self);
+          std::vector<triton::ast::SharedAbstractNode> core;
+
+          PyAllowThreads([&]() { core = ctx->getUnsatCore(conjuncts, nullptr, timeout_c); });
+
+          ret = xPyList_New(core.size());
+          for (triton::usize index = 0; index < core.size(); index++)
+            PyList_SetItem(ret, index, PyAstNode(core[index]));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_isArchitectureValid(PyObject* self, PyObject* noarg) {
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isArchitectureValid() == true)
+            Py_RETURN_TRUE;
           Py_RETURN_FALSE;
         }
         catch (const triton::exceptions::PyCallbacks&) {
@@ -2217,11 +4211,1644 @@ namespace triton {
         }
       }
 
-      static PyObject* TritonContext_isThumb(PyObject* self, PyObject* noarg) {
+
+      static PyObject* TritonContext_isConcreteMemoryValueDefined(PyObject* self, PyObject* args) {
+        PyObject* baseAddr        = nullptr;
+        PyObject* size            = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &baseAddr, &size) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isConcreteMemoryValueDefined(): Invalid number of arguments");
+        }
+
+        try {
+          if (baseAddr && PyMemoryAccess_Check(baseAddr)) {
+            if (PyTritonContext_AsTritonContext(self)->isConcreteMemoryValueDefined(*PyMemoryAccess_AsMemoryAccess(baseAddr)) == true)
+              Py_RETURN_TRUE;
+            Py_RETURN_FALSE;
+          }
+          else if (baseAddr && (PyLong_Check(baseAddr) || PyInt_Check(baseAddr))) {
+            if (size && (PyLong_Check(size) || PyInt_Check(size))) {
+              if (PyTritonContext_AsTritonContext(self)->isConcreteMemoryValueDefined(PyLong_AsUint64(baseAddr), PyLong_AsUsize(size)) == true)
+                Py_RETURN_TRUE;
+              Py_RETURN_FALSE;
+            }
+            else {
+              return PyErr_Format(PyExc_TypeError, "TritonContext::isConcreteMemoryValueDefined(): Expects a size (integer) as second argument.");
+            }
+          }
+          else {
+            return PyErr_Format(PyExc_TypeError, "TritonContext::isConcreteMemoryValueDefined(): Expects a base address (integer) as arguments or a memory cells.");
+          }
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isEquivalent(PyObject* self, PyObject* args) {
+        PyObject* node1 = nullptr;
+        PyObject* node2 = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &node1, &node2) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isEquivalent(): Invalid number of arguments");
+        }
+
+        if (node1 == nullptr || !PyAstNode_Check(node1))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isEquivalent(): Expects a AstNode as first argument.");
+
+        if (node2 == nullptr || !PyAstNode_Check(node2))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isEquivalent(): Expects a AstNode as second argument.");
+
+        try {
+          auto ctx    = PyTritonContext_AsTritonContext(self);
+          auto cnode1 = PyAstNode_AsAstNode(node1);
+          auto cnode2 = PyAstNode_AsAstNode(node2);
+          bool equ    = false;
+
+          PyAllowThreads([&]() { equ = ctx->isEquivalent(cnode1, cnode2); });
+
+          if (equ == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isFlag(PyObject* self, PyObject* reg) {
+        if (!PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isFlag(): Expects a Register as argument.");
+
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isFlag(*PyRegister_AsRegister(reg)) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isMemorySymbolized(PyObject* self, PyObject* mem) {
+        try {
+          if (PyMemoryAccess_Check(mem)) {
+            if (PyTritonContext_AsTritonContext(self)->isMemorySymbolized(*PyMemoryAccess_AsMemoryAccess(mem)) == true)
+              Py_RETURN_TRUE;
+          }
+
+          else if (PyLong_Check(mem) || PyInt_Check(mem)) {
+            if (PyTritonContext_AsTritonContext(self)->isMemorySymbolized(PyLong_AsUint64(mem)) == true)
+              Py_RETURN_TRUE;
+          }
+
+          else
+            return PyErr_Format(PyExc_TypeError, "TritonContext::isMemorySymbolized(): Expects a MemoryAccess or an integer as argument.");
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_RETURN_FALSE;
+      }
+
+
+      static PyObject* TritonContext_isMemoryTainted(PyObject* self, PyObject* mem) {
+        try {
+          if (PyMemoryAccess_Check(mem)) {
+            if (PyTritonContext_AsTritonContext(self)->isMemoryTainted(*PyMemoryAccess_AsMemoryAccess(mem)) == true)
+              Py_RETURN_TRUE;
+          }
+
+          else if (PyLong_Check(mem) || PyInt_Check(mem)) {
+            if (PyTritonContext_AsTritonContext(self)->isMemoryTainted(PyLong_AsUint64(mem)) == true)
+              Py_RETURN_TRUE;
+          }
+
+          else
+            return PyErr_Format(PyExc_TypeError, "TritonContext::isMemoryTainted(): Expects a MemoryAccess or an integer as argument.");
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_RETURN_FALSE;
+      }
+
+
+      static PyObject* TritonContext_isOpaquePredicate(PyObject* self, PyObject* node) {
+        if (!PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isOpaquePredicate(): Expects a AstNode as argument.");
+
+        try {
+          auto ctx    = PyTritonContext_AsTritonContext(self);
+          auto cnode  = PyAstNode_AsAstNode(node);
+          bool opaque = false;
+
+          PyAllowThreads([&]() { opaque = ctx->isOpaquePredicate(cnode); });
+
+          if (opaque == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isRegister(PyObject* self, PyObject* reg) {
+        if (!PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isRegister(): Expects a Register as argument.");
+
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isRegister(*PyRegister_AsRegister(reg)) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isRegisterSymbolized(PyObject* self, PyObject* reg) {
+        if (!PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isRegisterSymbolized(): Expects a Register as argument.");
+
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isRegisterSymbolized(*PyRegister_AsRegister(reg)) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isRegisterTainted(PyObject* self, PyObject* reg) {
+        if (!PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isRegisterTainted(): Expects a Register as argument.");
+
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isRegisterTainted(*PyRegister_AsRegister(reg)) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isRegisterValid(PyObject* self, PyObject* reg) {
+        if (!PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isRegisterValid(): Expects a Register as argument.");
+
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isRegisterValid(*PyRegister_AsRegister(reg)) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isSat(PyObject* self, PyObject* node) {
+        if (!PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isSat(): Expects a AstNode as argument.");
+
+        try {
+          auto ctx   = PyTritonContext_AsTritonContext(self);
+          auto cnode = PyAstNode_AsAstNode(node);
+          bool sat   = false;
+
+          PyAllowThreads([&]() { sat = ctx->isSat(cnode); });
+
+          if (sat == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isSatAsync(PyObject* self, PyObject* args, PyObject* kwargs) {
+        triton::uint32 timeout_c = 0;
+
+        PyObject* node    = nullptr;
+        PyObject* timeout = nullptr;
+
+        static char* keywords[] = {
+          (char*)"node",
+          (char*)"timeout",
+          nullptr
+        };
+
+        /* Extract Keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OO", keywords, &node, &timeout) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isSatAsync(): Invalid keyword argument.");
+        }
+
+        if (node == nullptr || !PyAstNode_Check(node)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isSatAsync(): Expects a AstNode as node argument.");
+        }
+
+        if (timeout != nullptr && (!PyLong_Check(timeout) && !PyInt_Check(timeout))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isSatAsync(): Expects a integer as timeout keyword.");
+        }
+
+        if (timeout != nullptr) {
+          timeout_c = PyLong_AsUint32(timeout);
+        }
+
+        try {
+          return PySolverFuture(PyTritonContext_AsTritonContext(self)->isSatAsync(PyAstNode_AsAstNode(node), timeout_c));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isSymbolicEngineEnabled(PyObject* self, PyObject* noarg) {
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isSymbolicEngineEnabled() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isSymbolicBudgetExceeded(PyObject* self, PyObject* noarg) {
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isSymbolicBudgetExceeded() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isSymbolicExpressionExists(PyObject* self, PyObject* symExprId) {
+        if (!PyInt_Check(symExprId) && !PyLong_Check(symExprId))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isSymbolicExpressionExists(): Expects an integer as argument.");
+
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isSymbolicExpressionExists(PyLong_AsUsize(symExprId)) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isModeEnabled(PyObject* self, PyObject* mode) {
+        if (!PyInt_Check(mode) && !PyLong_Check(mode))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isModeEnabled(): Expects a MODE as argument.");
+
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isModeEnabled(static_cast<triton::modes::mode_e>(PyLong_AsUint32(mode))) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isTaintEngineEnabled(PyObject* self, PyObject* noarg) {
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isTaintEngineEnabled() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+      static PyObject* TritonContext_isThumb(PyObject* self, PyObject* noarg) {
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isThumb() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_liftToC(PyObject* self, PyObject* args, PyObject* kwargs) {
+        std::vector<triton::arch::Instruction> block;
+        PyObject* node      = nullptr;
+        PyObject* fname     = nullptr;
+
+        static char* keywords[] = {
+          (char*)"node",
+          (char*)"fname",
+          nullptr
+        };
+
+        /* Extract keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OO", keywords, &node, &fname) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToC(): Invalid number of arguments");
+        }
+
+        if (node == nullptr || (!PySymbolicExpression_Check(node) && !PyAstNode_Check(node) && !PyList_Check(node)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToC(): Expects a SymbolicExpression, a AstNode or a list of Instruction as node argument.");
+
+        if (PyList_Check(node)) {
+          for (Py_ssize_t i = 0; i < PyList_Size(node); i++) {
+            PyObject* item = PyList_GetItem(node, i);
+            if (!PyInstruction_Check(item))
+              return PyErr_Format(PyExc_TypeError, "TritonContext::liftToC(): Each item of the list must be an Instruction.");
+            block.push_back(*PyInstruction_AsInstruction(item));
+          }
+        }
+
+        if (fname != nullptr && !PyStr_Check(fname))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToC(): Expects a string as fname argument.");
+
+        if (fname == nullptr)
+          fname = PyStr_FromString("__triton");
+
+        try {
+          std::ostringstream stream;
+          auto ctx          = PyTritonContext_AsTritonContext(self);
+          std::string cname = PyStr_AsString(fname);
+
+          if (PySymbolicExpression_Check(node))
+            ctx->liftToC(stream, PySymbolicExpression_AsSymbolicExpression(node), cname.c_str());
+          else if (PyAstNode_Check(node))
+            ctx->liftToC(stream, PyAstNode_AsAstNode(node), cname.c_str());
+          else
+            ctx->liftToC(stream, block, cname.c_str());
+
+          return xPyString_FromString(stream.str().c_str());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_liftToLLVM(PyObject* self, PyObject* args, PyObject* kwargs) {
+        std::vector<triton::ast::SharedAbstractNode> nodes;
+        std::vector<triton::arch::Instruction> block;
+        PyObject* node      = nullptr;
+        PyObject* fname     = nullptr;
+        PyObject* optimize  = nullptr;
+
+        static char* keywords[] = {
+          (char*)"node",
+          (char*)"fname",
+          (char*)"optimize",
+          nullptr
+        };
+
+        /* Extract keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OOO", keywords, &node, &fname, &optimize) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToLLVM(): Invalid number of arguments");
+        }
+
+        if (node == nullptr || (!PySymbolicExpression_Check(node) && !PyAstNode_Check(node) && !PyList_Check(node)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToLLVM(): Expects a SymbolicExpression, a AstNode, a list of them or a list of Instruction as node argument.");
+
+        if (PyList_Check(node)) {
+          for (Py_ssize_t i = 0; i < PyList_Size(node); i++) {
+            PyObject* item = PyList_GetItem(node, i);
+            if (PySymbolicExpression_Check(item))
+              nodes.push_back(PySymbolicExpression_AsSymbolicExpression(item)->getAst());
+            else if (PyAstNode_Check(item))
+              nodes.push_back(PyAstNode_AsAstNode(item));
+            else if (PyInstruction_Check(item))
+              block.push_back(*PyInstruction_AsInstruction(item));
+            else
+              return PyErr_Format(PyExc_TypeError, "TritonContext::liftToLLVM(): Each item of the list must be a SymbolicExpression, a AstNode or an Instruction.");
+          }
+          if (!nodes.empty() && !block.empty())
+            return PyErr_Format(PyExc_TypeError, "TritonContext::liftToLLVM(): Expects a list of nodes or a list of Instruction, not both.");
+        }
+
+        if (fname != nullptr && !PyStr_Check(fname))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToLLVM(): Expects a string as fname argument.");
+
+        if (optimize != nullptr && !PyBool_Check(optimize))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToLLVM(): Expects a boolean as optimize argument.");
+
+        if (fname == nullptr)
+          fname = PyStr_FromString("__triton");
+
+        if (optimize == nullptr)
+          optimize = PyLong_FromUint32(false);
+
+        try {
+          std::ostringstream stream;
+          triton::ast::SharedAbstractNode cnode = nullptr;
+          auto ctx          = PyTritonContext_AsTritonContext(self);
+          std::string cname = PyStr_AsString(fname);
+          bool coptimize    = PyLong_AsBool(optimize);
+
+          if (PySymbolicExpression_Check(node))
+            cnode = PySymbolicExpression_AsSymbolicExpression(node)->getAst();
+          else if (PyAstNode_Check(node))
+            cnode = PyAstNode_AsAstNode(node);
+
+          PyAllowThreads([&]() {
+            if (!block.empty())
+              ctx->liftToLLVM(stream, block, cname.c_str(), coptimize);
+            else if (cnode == nullptr)
+              ctx->liftToLLVM(stream, nodes, cname.c_str(), coptimize);
+            else
+              ctx->liftToLLVM(stream, cnode, cname.c_str(), coptimize);
+          });
+
+          return xPyString_FromString(stream.str().c_str());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_liftToPython(PyObject* self, PyObject* args) {
+        PyObject* expr        = nullptr;
+        PyObject* sharedFlag  = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &expr, &sharedFlag) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToPython(): Invalid number of arguments");
+        }
+
+        if (expr == nullptr || !PySymbolicExpression_Check(expr))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToPython(): Expects a SymbolicExpression as first argument.");
+
+        if (sharedFlag != nullptr && !PyBool_Check(sharedFlag))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToPython(): Expects a boolean as second argument.");
+
+        if (sharedFlag == nullptr)
+          sharedFlag = PyLong_FromUint32(false);
+
+        try {
+          std::ostringstream stream;
+          PyTritonContext_AsTritonContext(self)->liftToPython(stream, PySymbolicExpression_AsSymbolicExpression(expr), PyLong_AsBool(sharedFlag));
+          return xPyString_FromString(stream.str().c_str());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_liftToSMT(PyObject* self, PyObject* args) {
+        PyObject* expr        = nullptr;
+        PyObject* assertFlag  = nullptr;
+        PyObject* sharedFlag  = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OOO", &expr, &assertFlag, &sharedFlag) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToSMT(): Invalid number of arguments");
+        }
+
+        if (expr == nullptr || !PySymbolicExpression_Check(expr))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToSMT(): Expects a SymbolicExpression as first argument.");
+
+        if (assertFlag != nullptr && !PyBool_Check(assertFlag))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToSMT(): Expects a boolean as second argument.");
+
+        if (sharedFlag != nullptr && !PyBool_Check(sharedFlag))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToSMT(): Expects a boolean as third argument.");
+
+        if (assertFlag == nullptr)
+          assertFlag = PyLong_FromUint32(false);
+
+        if (sharedFlag == nullptr)
+          sharedFlag = PyLong_FromUint32(false);
+
+        try {
+          std::ostringstream stream;
+          PyTritonContext_AsTritonContext(self)->liftToSMT(stream, PySymbolicExpression_AsSymbolicExpression(expr), PyLong_AsBool(assertFlag), PyLong_AsBool(sharedFlag));
+          return xPyString_FromString(stream.str().c_str());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_loadSnapshot(PyObject* self, PyObject* path) {
+        if (path == nullptr || !PyStr_Check(path))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::loadSnapshot(): Expects a string as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->loadSnapshot(PyStr_AsString(path));
+          TritonContext_clearRegistersAttribute(self);
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_loadSynthesisCache(PyObject* self, PyObject* path) {
+        if (path == nullptr || !PyStr_Check(path))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::loadSynthesisCache(): Expects a string as argument.");
+
+        std::ifstream file(PyStr_AsString(path), std::ios::binary);
+        if (!file.is_open())
+          return PyErr_Format(PyExc_TypeError, "TritonContext::loadSynthesisCache(): Cannot open %s.", PyStr_AsString(path));
+
+        try {
+          PyTritonContext_AsTritonContext(self)->loadSynthesisCache(file);
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_mapConcreteMemoryArea(PyObject* self, PyObject* args) {
+        PyObject* addr = nullptr;
+        PyObject* area = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &addr, &area) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::mapConcreteMemoryArea(): Invalid number of arguments");
+        }
+
+        if (addr == nullptr || (!PyLong_Check(addr) && !PyInt_Check(addr)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::mapConcreteMemoryArea(): Expects an integer as first argument.");
+
+        if (area == nullptr || !PyObject_CheckBuffer(area))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::mapConcreteMemoryArea(): Expects a buffer as second argument.");
+
+        Py_buffer* view = new Py_buffer;
+        if (PyObject_GetBuffer(area, view, PyBUF_SIMPLE) != 0) {
+          delete view;
+          PyErr_Clear();
+          return PyErr_Format(PyExc_TypeError, "TritonContext::mapConcreteMemoryArea(): Expects a contiguous buffer as second argument.");
+        }
+
+        /* The memory and its copies keep the buffer exported, it is released by the last of them */
+        std::shared_ptr<const void> owner(view, [](Py_buffer* view) {
+          if (Py_IsInitialized()) {
+            PyGILState_STATE state = PyGILState_Ensure();
+            PyBuffer_Release(view);
+            PyGILState_Release(state);
+          }
+          delete view;
+        });
+
+        try {
+          PyTritonContext_AsTritonContext(self)->mapConcreteMemoryArea(PyLong_AsUint64(addr), reinterpret_cast<const triton::uint8*>(view->buf), static_cast<triton::usize>(view->len), owner);
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_mapConcreteMemoryFile(PyObject* self, PyObject* args) {
+        PyObject* addr   = nullptr;
+        PyObject* path   = nullptr;
+        PyObject* offset = nullptr;
+        PyObject* size   = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OOOO", &addr, &path, &offset, &size) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::mapConcreteMemoryFile(): Invalid number of arguments");
+        }
+
+        if (addr == nullptr || (!PyLong_Check(addr) && !PyInt_Check(addr)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::mapConcreteMemoryFile(): Expects an integer as first argument.");
+
+        if (path == nullptr || !PyStr_Check(path))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::mapConcreteMemoryFile(): Expects a string as second argument.");
+
+        if (offset != nullptr && !PyLong_Check(offset) && !PyInt_Check(offset))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::mapConcreteMemoryFile(): Expects an integer as third argument.");
+
+        if (size != nullptr && !PyLong_Check(size) && !PyInt_Check(size))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::mapConcreteMemoryFile(): Expects an integer as fourth argument.");
+
+        try {
+          triton::uint64 coffset = (offset != nullptr) ? PyLong_AsUint64(offset) : 0;
+          triton::usize csize    = (size != nullptr) ? PyLong_AsUsize(size) : 0;
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->mapConcreteMemoryFile(PyLong_AsUint64(addr), PyStr_AsString(path), coffset, csize));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_newSymbolicExpression(PyObject* self, PyObject* args) {
+        PyObject* node          = nullptr;
+        PyObject* comment       = nullptr;
+        std::string ccomment    = "";
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &node, &comment) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::newSymbolicExpression(): Invalid number of arguments");
+        }
+
+        if (node == nullptr || (!PyAstNode_Check(node)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::newSymbolicExpression(): Expects a AstNode as first argument.");
+
+        if (comment != nullptr && !PyStr_Check(comment))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::newSymbolicExpression(): Expects a sting as second argument.");
+
+        if (comment != nullptr)
+          ccomment = PyStr_AsString(comment);
+
+        try {
+          return PySymbolicExpression(PyTritonContext_AsTritonContext(self)->newSymbolicExpression(PyAstNode_AsAstNode(node), ccomment));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_newSymbolicVariable(PyObject* self, PyObject* args) {
+        PyObject* size      = nullptr;
+        PyObject* alias     = nullptr;
+        std::string calias  = "";
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &size, &alias) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::newSymbolicVariable(): Invalid number of arguments");
+        }
+
+        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::newSymbolicVariable(): Expects an integer as first argument.");
+
+        if (alias != nullptr && !PyStr_Check(alias))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::newSymbolicVariable(): Expects a sting as second  argument.");
+
+        if (alias != nullptr)
+          calias = PyStr_AsString(alias);
+
+        try {
+          return PySymbolicVariable(PyTritonContext_AsTritonContext(self)->newSymbolicVariable(PyLong_AsUint32(size), calias));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_popPathConstraint(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->popPathConstraint();
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_popSolverScope(PyObject* self, PyObject* args) {
+        PyObject* count = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|O", &count) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::popSolverScope(): Invalid number of arguments");
+        }
+
+        if (count != nullptr && (!PyLong_Check(count) && !PyInt_Check(count)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::popSolverScope(): Expects an integer as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->popSolverScope(count != nullptr ? PyLong_AsUint32(count) : 1);
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_processBlock(PyObject* self, PyObject* addr) {
+        PyObject* ret = nullptr;
+        triton::usize index = 0;
+        triton::uint64 next = 0;
+
+        if (!PyLong_Check(addr) && !PyInt_Check(addr))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::processBlock(): Expects an integer as argument.");
+
+        try {
+          auto insts = PyTritonContext_AsTritonContext(self)->processBlock(PyLong_AsUint64(addr), &next);
+
+          ret = xPyList_New(insts.size());
+          for (auto& inst : insts)
+            PyList_SetItem(ret, index++, PyInstruction(inst));
+
+          PyObject* tuple = triton::bindings::python::xPyTuple_New(2);
+          PyTuple_SetItem(tuple, 0, ret);
+          PyTuple_SetItem(tuple, 1, PyLong_FromUint64(next));
+          return tuple;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_processTrace(PyObject* self, PyObject* args) {
+        PyObject* trace    = nullptr;
+        PyObject* format   = nullptr;
+        PyObject* decoders = nullptr;
+        Py_buffer view;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OOO", &trace, &format, &decoders) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::processTrace(): Invalid number of arguments");
+        }
+
+        if (trace == nullptr || (!PyStr_Check(trace) && !PyObject_CheckBuffer(trace)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::processTrace(): Expects a buffer or a path as first argument.");
+
+        if (format == nullptr || (!PyLong_Check(format) && !PyInt_Check(format)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::processTrace(): Expects a TRACE as second argument.");
+
+        if (decoders != nullptr && !PyLong_Check(decoders) && !PyInt_Check(decoders))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::processTrace(): Expects an integer as third argument.");
+
+        try {
+          auto cformat = static_cast<triton::arch::trace_e>(PyLong_AsUint32(format));
+          triton::usize cdecoders = decoders != nullptr ? PyLong_AsUsize(decoders) : 0;
+          std::exception_ptr error;
+          triton::usize count = 0;
+          auto ctx = PyTritonContext_AsTritonContext(self);
+
+          /* A file is mapped in memory, a buffer is read in place */
+          if (PyStr_Check(trace)) {
+            std::string path = PyStr_AsString(trace);
+            PyAllowThreads([&]() { count = ctx->processTrace(path, cformat, cdecoders); });
+            return PyLong_FromUsize(count);
+          }
+
+          if (PyObject_GetBuffer(trace, &view, PyBUF_SIMPLE) != 0) {
+            PyErr_Clear();
+            return PyErr_Format(PyExc_TypeError, "TritonContext::processTrace(): Expects a contiguous buffer as first argument.");
+          }
+
+          /* The callbacks take the GIL back (see PyGilGuard) */
+          try {
+            PyAllowThreads([&]() { count = ctx->processTrace(reinterpret_cast<const triton::uint8*>(view.buf), static_cast<triton::usize>(view.len), cformat, cdecoders); });
+          }
+          catch (...) {
+            error = std::current_exception();
+          }
+
+          PyBuffer_Release(&view);
+
+          if (error)
+            std::rethrow_exception(error);
+
+          return PyLong_FromUsize(count);
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_processing(PyObject* self, PyObject* inst) {
+        bool ret = true;
+
+        if (!PyInstruction_Check(inst) && !PyList_Check(inst))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::processing(): Expects an Instruction or a list of Instruction as argument.");
+
+        if (PyList_Check(inst)) {
+          for (Py_ssize_t i = 0; i < PyList_Size(inst); i++) {
+            if (!PyInstruction_Check(PyList_GetItem(inst, i)))
+              return PyErr_Format(PyExc_TypeError, "TritonContext::processing(): Expects a list of Instruction as argument.");
+          }
+        }
+
+        try {
+          /* The instructions of the list are processed as a block, then copied back in place */
+          if (PyList_Check(inst)) {
+            std::vector<triton::arch::Instruction> block;
+            block.reserve(PyList_Size(inst));
+            for (Py_ssize_t i = 0; i < PyList_Size(inst); i++)
+              block.push_back(*PyInstruction_AsInstruction(PyList_GetItem(inst, i)));
+
+            ret = PyTritonContext_AsTritonContext(self)->processing(block);
+
+            for (Py_ssize_t i = 0; i < PyList_Size(inst); i++)
+              *PyInstruction_AsInstruction(PyList_GetItem(inst, i)) = std::move(block[i]);
+          }
+          else {
+            ret = PyTritonContext_AsTritonContext(self)->processing(*PyInstruction_AsInstruction(inst));
+          }
+
+          if (ret)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_pushPathConstraint(PyObject* self, PyObject* node) {
+        if (!PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::pushPathConstraint(): Expects an AstNode as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->pushPathConstraint(PyAstNode_AsAstNode(node));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_pushSolverConstraint(PyObject* self, PyObject* node) {
+        if (!PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::pushSolverConstraint(): Expects an AstNode as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->pushSolverConstraint(PyAstNode_AsAstNode(node));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_pushSolverScope(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->pushSolverScope();
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_removeCallback(PyObject* self, PyObject* args) {
+        PyObject* cb       = nullptr;
+        PyObject* cb_self  = nullptr;
+        PyObject* function = nullptr;
+        PyObject* mode     = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &mode, &function) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::removeCallback(): Invalid number of arguments");
+        }
+
+        if (mode == nullptr || (!PyLong_Check(mode) && !PyInt_Check(mode)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::removeCallback(): Expects a CALLBACK as first argument.");
+
+        if (function == nullptr || !PyCallable_Check(function))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::removeCallback(): Expects a function as second argument.");
+
+        /* Get the callback (class or static) */
+        if (PyMethod_Check(function)) {
+          cb_self = PyMethod_GET_SELF(function);
+          cb = PyMethod_GET_FUNCTION(function);
+        }
+        else {
+          cb = function;
+        }
+
+        try {
+          switch (static_cast<triton::callbacks::callback_e>(PyLong_AsUint32(mode))) {
+            case callbacks::GET_CONCRETE_MEMORY_AREA_VALUE:
+            case callbacks::GET_UNDEFINED_MEMORY_PAGE:
+              PyTritonContext_AsTritonContext(self)->removeCallback(static_cast<triton::callbacks::callback_e>(PyLong_AsUint32(mode)), callbacks::getConcreteMemoryAreaValueCallback(nullptr, cb));
+              break;
+            case callbacks::GET_CONCRETE_MEMORY_VALUE:
+              PyTritonContext_AsTritonContext(self)->removeCallback(callbacks::GET_CONCRETE_MEMORY_VALUE, callbacks::getConcreteMemoryValueCallback(nullptr, cb));
+              break;
+            case callbacks::GET_CONCRETE_REGISTER_VALUE:
+              PyTritonContext_AsTritonContext(self)->removeCallback(callbacks::GET_CONCRETE_REGISTER_VALUE, callbacks::getConcreteRegisterValueCallback(nullptr, cb));
+              break;
+            case callbacks::SET_CONCRETE_MEMORY_AREA_VALUE:
+              PyTritonContext_AsTritonContext(self)->removeCallback(callbacks::SET_CONCRETE_MEMORY_AREA_VALUE, callbacks::setConcreteMemoryAreaValueCallback(nullptr, cb));
+              break;
+            case callbacks::SET_CONCRETE_MEMORY_VALUE:
+              PyTritonContext_AsTritonContext(self)->removeCallback(callbacks::SET_CONCRETE_MEMORY_VALUE, callbacks::setConcreteMemoryValueCallback(nullptr, cb));
+              break;
+            case callbacks::SET_CONCRETE_REGISTER_VALUE:
+              PyTritonContext_AsTritonContext(self)->removeCallback(callbacks::SET_CONCRETE_REGISTER_VALUE, callbacks::setConcreteRegisterValueCallback(nullptr, cb));
+              break;
+            case callbacks::SYMBOLIC_SIMPLIFICATION:
+              PyTritonContext_AsTritonContext(self)->removeCallback(callbacks::SYMBOLIC_SIMPLIFICATION, callbacks::symbolicSimplificationCallback(nullptr, cb));
+              break;
+            default:
+              return PyErr_Format(PyExc_TypeError, "TritonContext::removeCallback(): Invalid kind of callback.");
+          }
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_DECREF(cb);
+        if (cb_self != nullptr) {
+          Py_DECREF(cb_self);
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_removeFunctionSummary(PyObject* self, PyObject* addr) {
+        if (!PyLong_Check(addr) && !PyInt_Check(addr))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::removeFunctionSummary(): Expects an integer as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->removeFunctionSummary(PyLong_AsUint64(addr));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_removeSimplificationPass(PyObject* self, PyObject* name) {
+        if (name == nullptr || !PyStr_Check(name))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::removeSimplificationPass(): Expects a string as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->removeSimplificationPass(PyStr_AsString(name));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_removeMark(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->removeMark();
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_removeThread(PyObject* self, PyObject* tid) {
+        if (tid == nullptr || (!PyLong_Check(tid) && !PyInt_Check(tid)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::removeThread(): Expects an integer as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->removeThread(PyLong_AsUint32(tid));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_reset(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->reset();
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_resetPointerStatistics(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->getConcretizationPolicy()->resetStatistics();
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_resetSolverBudget(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->getSolverBudget()->reset();
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_resetSolverSession(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->resetSolverSession();
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_rollbackToMark(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->rollbackToMark();
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_saveSnapshot(PyObject* self, PyObject* path) {
+        if (path == nullptr || !PyStr_Check(path))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::saveSnapshot(): Expects a string as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->saveSnapshot(PyStr_AsString(path));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_saveSynthesisCache(PyObject* self, PyObject* path) {
+        if (path == nullptr || !PyStr_Check(path))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::saveSynthesisCache(): Expects a string as argument.");
+
+        std::ofstream file(PyStr_AsString(path), std::ios::binary);
+        if (!file.is_open())
+          return PyErr_Format(PyExc_TypeError, "TritonContext::saveSynthesisCache(): Cannot open %s.", PyStr_AsString(path));
+
+        try {
+          PyTritonContext_AsTritonContext(self)->saveSynthesisCache(file);
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_saveTrace(PyObject* self, PyObject* path) {
+        if (path == nullptr || !PyStr_Check(path))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::saveTrace(): Expects a string as argument.");
+
+        std::ofstream file(PyStr_AsString(path));
+        if (!file.is_open())
+          return PyErr_Format(PyExc_TypeError, "TritonContext::saveTrace(): Cannot open %s.", PyStr_AsString(path));
+
+        try {
+          PyTritonContext_AsTritonContext(self)->getTracer()->writeChromeTrace(file);
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setArchitecture(PyObject* self, PyObject* arg) {
+        if (!PyLong_Check(arg) && !PyInt_Check(arg))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setArchitecture(): Expects an ARCH as argument.");
+
+        try {
+          /* Set the architecture */
+          PyTritonContext_AsTritonContext(self)->setArchitecture(static_cast<triton::arch::architecture_e>(PyLong_AsUint32(arg)));
+          TritonContext_clearRegistersAttribute(self);
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setAstRepresentationMode(PyObject* self, PyObject* arg) {
+        if (!PyLong_Check(arg) && !PyInt_Check(arg))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setAstRepresentationMode(): Expects an AST_REPRESENTATION as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setAstRepresentationMode(static_cast<triton::ast::representations::mode_e>(PyLong_AsUint32(arg)));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setConcreteMemoryAreaValue(PyObject* self, PyObject* args) {
+        std::vector<triton::uint8> vv;
+        PyObject* baseAddr  = nullptr;
+        PyObject* values    = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &baseAddr, &values) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteMemoryAreaValue(): Invalid number of arguments");
+        }
+
+        if (baseAddr == nullptr || (!PyLong_Check(baseAddr) && !PyInt_Check(baseAddr)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteMemoryAreaValue(): Expects an integer as first argument.");
+
+        if (values == nullptr)
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteMemoryAreaValue(): Expects a list or a buffer as second argument.");
+
+        // Python object: List
+        if (PyList_Check(values)) {
+          for (Py_ssize_t i = 0; i < PyList_Size(values); i++) {
+            PyObject* item = PyList_GetItem(values, i);
+
+            if ((!PyLong_Check(item) && !PyInt_Check(item)) || PyLong_AsUint32(item) > 0xff)
+              return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteMemoryAreaValue(): Each item of the list must be a 8-bits integer.");
+
+            vv.push_back(static_cast<triton::uint8>(PyLong_AsUint32(item) & 0xff));
+          }
+
+          try {
+            PyTritonContext_AsTritonContext(self)->setConcreteMemoryAreaValue(PyLong_AsUint64(baseAddr), vv);
+          }
+          catch (const triton::exceptions::PyCallbacks&) {
+            return nullptr;
+          }
+          catch (const triton::exceptions::Exception& e) {
+            return PyErr_Format(PyExc_TypeError, "%s", e.what());
+          }
+        }
+
+        // Python object: Buffer (bytes, bytearray, memoryview, array, numpy, ...)
+        else if (PyObject_CheckBuffer(values)) {
+          Py_buffer view;
+
+          /* The buffer is copied straight into the memory */
+          if (PyObject_GetBuffer(values, &view, PyBUF_SIMPLE) != 0) {
+            PyErr_Clear();
+            return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteMemoryAreaValue(): Expects a contiguous buffer as second argument.");
+          }
+
+          try {
+            PyTritonContext_AsTritonContext(self)->setConcreteMemoryAreaValue(PyLong_AsUint64(baseAddr), reinterpret_cast<const triton::uint8*>(view.buf), static_cast<triton::usize>(view.len));
+          }
+          catch (const triton::exceptions::PyCallbacks&) {
+            PyBuffer_Release(&view);
+            return nullptr;
+          }
+          catch (const triton::exceptions::Exception& e) {
+            PyBuffer_Release(&view);
+            return PyErr_Format(PyExc_TypeError, "%s", e.what());
+          }
+
+          PyBuffer_Release(&view);
+        }
+
+        // Invalid Python object
+        else
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteMemoryAreaValue(): Expects a list or a buffer as second argument.");
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setConcreteMemoryValue(PyObject* self, PyObject* args) {
+        PyObject* mem    = nullptr;
+        PyObject* value  = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &mem, &value) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteMemoryValue(): Invalid number of arguments");
+        }
+
+        /* setConcreteMemoryValue(integer, integer) */
+        if (mem != nullptr && (PyLong_Check(mem) || PyInt_Check(mem))) {
+          if (value == nullptr || (!PyLong_Check(value) && !PyInt_Check(value)))
+            return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteMemoryValue(): Expects a value as second argument.");
+
+          triton::uint64 addr   = PyLong_AsUint64(mem);
+          triton::uint32 cvalue = PyLong_AsUint32(value);
+
+          if (cvalue > 0xff)
+            return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteMemoryValue(): Value must be on 8 bits.");
+
+          try {
+            PyTritonContext_AsTritonContext(self)->setConcreteMemoryValue(addr, static_cast<triton::uint8>(cvalue & 0xff));
+          }
+          catch (const triton::exceptions::PyCallbacks&) {
+            return nullptr;
+          }
+          catch (const triton::exceptions::Exception& e) {
+            return PyErr_Format(PyExc_TypeError, "%s", e.what());
+          }
+
+        }
+
+        /* setConcreteMemoryValue(MemoryAccess) */
+        else if (mem != nullptr && PyMemoryAccess_Check(mem)) {
+          if (value == nullptr || (!PyLong_Check(value) && !PyInt_Check(value)))
+            return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteMemoryValue(): Expects a value as second argument.");
+          try {
+            triton::uint512 cvalue = PyLong_AsUint512(value);
+            PyTritonContext_AsTritonContext(self)->setConcreteMemoryValue(*PyMemoryAccess_AsMemoryAccess(mem), cvalue);
+          }
+          catch (const triton::exceptions::PyCallbacks&) {
+            return nullptr;
+          }
+          catch (const triton::exceptions::Exception& e) {
+            return PyErr_Format(PyExc_TypeError, "%s", e.what());
+          }
+        }
+
+        /* Invalid */
+        else
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteMemoryValue(): Expects a MemoryAccess or an integer as first argument.");
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setConcreteRegisterValue(PyObject* self, PyObject* args) {
+        PyObject* reg    = nullptr;
+        PyObject* value  = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &reg, &value) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteRegisterValue(): Invalid number of arguments");
+        }
+
+        if (reg == nullptr || !PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteRegisterValue(): Expects a Register as first argument.");
+
+        if (value == nullptr || (!PyLong_Check(value) && !PyInt_Check(value)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteRegisterValue(): Expects a value as second argument.");
+
+        try {
+          triton::uint512 cvalue = PyLong_AsUint512(value);
+          PyTritonContext_AsTritonContext(self)->setConcreteRegisterValue(*PyRegister_AsRegister(reg), cvalue);
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setConcreteVariableValue(PyObject* self, PyObject* args) {
+        PyObject* symVar = nullptr;
+        PyObject* value  = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &symVar, &value) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteVariableValue(): Invalid number of arguments");
+        }
+
+        if (symVar == nullptr || !PySymbolicVariable_Check(symVar))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteVariableValue(): Bad argument type.");
+
+        if (value == nullptr)
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteVariableValue(): Expects a second argument as integer value.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setConcreteVariableValue(PySymbolicVariable_AsSymbolicVariable(symVar), PyLong_AsUint512(value));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setCoverage(PyObject* self, PyObject* flag) {
+        if (flag == nullptr || !PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setCoverage(): Expects a boolean as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->getCoverage()->setEnabled(PyLong_AsBool(flag));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setExecutorThreads(PyObject* self, PyObject* threads) {
+        if (threads == nullptr || (!PyLong_Check(threads) && !PyInt_Check(threads)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setExecutorThreads(): Expects an integer as argument.");
+
+        try {
+          auto& executor = PyTritonContext_AsTritonContext(self)->getExecutor();
+          triton::usize count = PyLong_AsUsize(threads);
+          PyAllowThreads([&]() { executor.setThreads(count); });
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setFlippableIterations(PyObject* self, PyObject* count) {
+        if (count == nullptr || (!PyLong_Check(count) && !PyInt_Check(count)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setFlippableIterations(): Expects an integer as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setFlippableIterations(PyLong_AsUsize(count));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setFunctionSummary(PyObject* self, PyObject* args) {
+        PyObject* addr   = nullptr;
+        PyObject* symbol = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &addr, &symbol) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setFunctionSummary(): Invalid number of arguments");
+        }
+
+        if (addr == nullptr || (!PyLong_Check(addr) && !PyInt_Check(addr)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setFunctionSummary(): Expects an integer as first argument.");
+
+        if (symbol == nullptr || !PyStr_Check(symbol))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setFunctionSummary(): Expects a string as second argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setFunctionSummary(PyLong_AsUint64(addr), PyStr_AsString(symbol));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setMark(PyObject* self, PyObject* noarg) {
         try {
-          if (PyTritonContext_AsTritonContext(self)->isThumb() == true)
-            Py_RETURN_TRUE;
-          Py_RETURN_FALSE;
+          PyTritonContext_AsTritonContext(self)->setMark();
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -2229,50 +5856,59 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
+
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
 
-      static PyObject* TritonContext_liftToLLVM(PyObject* self, PyObject* args, PyObject* kwargs) {
-        PyObject* node      = nullptr;
-        PyObject* fname     = nullptr;
-        PyObject* optimize  = nullptr;
+      static PyObject* TritonContext_setMode(PyObject* self, PyObject* args) {
+        PyObject* mode = nullptr;
+        PyObject* flag = nullptr;
 
-        static char* keywords[] = {
-          (char*)"node",
-          (char*)"fname",
-          (char*)"optimize",
-          nullptr
-        };
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &mode, &flag) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setMode(): Invalid number of arguments");
+        }
 
-        /* Extract keywords */
-        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OOO", keywords, &node, &fname, &optimize) == false) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToLLVM(): Invalid number of arguments");
+        if (mode == nullptr || (!PyLong_Check(mode) && !PyInt_Check(mode)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setMode(): Expects a MODE as argument.");
+
+        if (flag == nullptr || !PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setMode(): Expects an boolean flag as second argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setMode(static_cast<triton::modes::mode_e>(PyLong_AsUint32(mode)), PyLong_AsBool(flag));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
         }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
 
-        if (node == nullptr || (!PySymbolicExpression_Check(node) && !PyAstNode_Check(node)))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToLLVM(): Expects a SymbolicExpression or a AstNode as node argument.");
 
-        if (fname != nullptr && !PyStr_Check(fname))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToLLVM(): Expects a string as fname argument.");
+      static PyObject* TritonContext_setPathConstraintsSpilling(PyObject* self, PyObject* args) {
+        PyObject* path     = nullptr;
+        PyObject* resident = nullptr;
 
-        if (optimize != nullptr && !PyBool_Check(optimize))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToLLVM(): Expects a boolean as optimize argument.");
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &path, &resident) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setPathConstraintsSpilling(): Invalid number of arguments");
+        }
 
-        if (fname == nullptr)
-          fname = PyStr_FromString("__triton");
+        if (path == nullptr || !PyStr_Check(path))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setPathConstraintsSpilling(): Expects a string as first argument.");
 
-        if (optimize == nullptr)
-          optimize = PyLong_FromUint32(false);
+        if (resident != nullptr && !PyLong_Check(resident) && !PyInt_Check(resident))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setPathConstraintsSpilling(): Expects an integer as second argument.");
 
         try {
-          std::ostringstream stream;
-          if (PySymbolicExpression_Check(node)) {
-            PyTritonContext_AsTritonContext(self)->liftToLLVM(stream, PySymbolicExpression_AsSymbolicExpression(node), PyStr_AsString(fname), PyLong_AsBool(optimize));
-          }
-          else {
-            PyTritonContext_AsTritonContext(self)->liftToLLVM(stream, PyAstNode_AsAstNode(node), PyStr_AsString(fname), PyLong_AsBool(optimize));
-          }
-          return xPyString_FromString(stream.str().c_str());
+          PyTritonContext_AsTritonContext(self)->setPathConstraintsSpilling(PyStr_AsString(path), resident != nullptr ? PyLong_AsUsize(resident) : 1024);
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -2286,14 +5922,28 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_liftToPython(PyObject* self, PyObject* expr) {
-        if (!PySymbolicExpression_Check(expr))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToPython(): Expects a SymbolicExpression as first argument.");
+      static PyObject* TritonContext_setPointerPolicy(PyObject* self, PyObject* args) {
+        PyObject* policy = nullptr;
+        PyObject* addr   = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &policy, &addr) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setPointerPolicy(): Invalid number of arguments");
+        }
+
+        if (policy == nullptr || (!PyLong_Check(policy) && !PyInt_Check(policy)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setPointerPolicy(): Expects a SYMBOLIC policy as first argument.");
+
+        if (addr != nullptr && addr != Py_None && (!PyLong_Check(addr) && !PyInt_Check(addr)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setPointerPolicy(): Expects an address as second argument.");
 
         try {
-          std::ostringstream stream;
-          PyTritonContext_AsTritonContext(self)->liftToPython(stream, PySymbolicExpression_AsSymbolicExpression(expr));
-          return xPyString_FromString(stream.str().c_str());
+          auto* concretization = PyTritonContext_AsTritonContext(self)->getConcretizationPolicy();
+          auto kind = static_cast<triton::engines::symbolic::pointer_policy_e>(PyLong_AsUint32(policy));
+          if (addr == nullptr || addr == Py_None)
+            concretization->setPolicy(kind);
+          else
+            concretization->setPolicy(PyLong_AsUint64(addr), kind);
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -2307,28 +5957,26 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_liftToSMT(PyObject* self, PyObject* args) {
-        PyObject* expr        = nullptr;
-        PyObject* assertFlag  = nullptr;
+      static PyObject* TritonContext_setPointerPolicyLimits(PyObject* self, PyObject* args) {
+        PyObject* arrayCells = nullptr;
+        PyObject* forkValues = nullptr;
 
         /* Extract arguments */
-        if (PyArg_ParseTuple(args, "|OO", &expr, &assertFlag) == false) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToSMT(): Invalid number of arguments");
+        if (PyArg_ParseTuple(args, "|OO", &arrayCells, &forkValues) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setPointerPolicyLimits(): Invalid number of arguments");
         }
 
-        if (expr == nullptr || !PySymbolicExpression_Check(expr))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToSMT(): Expects a SymbolicExpression as first argument.");
-
-        if (assertFlag != nullptr && !PyBool_Check(assertFlag))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::liftToSMT(): Expects a boolean as second argument.");
+        if (arrayCells != nullptr && (!PyLong_Check(arrayCells) && !PyInt_Check(arrayCells)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setPointerPolicyLimits(): Expects an integer as first argument.");
 
-        if (assertFlag == nullptr)
-          assertFlag = PyLong_FromUint32(false);
+        if (forkValues != nullptr && (!PyLong_Check(forkValues) && !PyInt_Check(forkValues)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setPointerPolicyLimits(): Expects an integer as second argument.");
 
         try {
-          std::ostringstream stream;
-          PyTritonContext_AsTritonContext(self)->liftToSMT(stream, PySymbolicExpression_AsSymbolicExpression(expr), PyLong_AsBool(assertFlag));
-          return xPyString_FromString(stream.str().c_str());
+          PyTritonContext_AsTritonContext(self)->getConcretizationPolicy()->setLimits(
+            arrayCells != nullptr ? PyLong_AsUsize(arrayCells) : 1024,
+            forkValues != nullptr ? PyLong_AsUint32(forkValues) : 8
+          );
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -2342,27 +5990,25 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_newSymbolicExpression(PyObject* self, PyObject* args) {
-        PyObject* node          = nullptr;
-        PyObject* comment       = nullptr;
-        std::string ccomment    = "";
+      static PyObject* TritonContext_setRegisterTaintBits(PyObject* self, PyObject* args) {
+        PyObject* reg  = nullptr;
+        PyObject* bits = nullptr;
 
         /* Extract arguments */
-        if (PyArg_ParseTuple(args, "|OO", &node, &comment) == false) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::newSymbolicExpression(): Invalid number of arguments");
+        if (PyArg_ParseTuple(args, "|OO", &reg, &bits) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setRegisterTaintBits(): Invalid number of arguments");
         }
 
-        if (node == nullptr || (!PyAstNode_Check(node)))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::newSymbolicExpression(): Expects a AstNode as first argument.");
-
-        if (comment != nullptr && !PyStr_Check(comment))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::newSymbolicExpression(): Expects a sting as second argument.");
+        if (reg == nullptr || !PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setRegisterTaintBits(): Expects a Register as first argument.");
 
-        if (comment != nullptr)
-          ccomment = PyStr_AsString(comment);
+        if (bits == nullptr || (!PyLong_Check(bits) && !PyInt_Check(bits)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setRegisterTaintBits(): Expects an integer as second argument.");
 
         try {
-          return PySymbolicExpression(PyTritonContext_AsTritonContext(self)->newSymbolicExpression(PyAstNode_AsAstNode(node), ccomment));
+          if (PyTritonContext_AsTritonContext(self)->setRegisterTaintBits(*PyRegister_AsRegister(reg), PyLong_AsUint64(bits)) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -2373,27 +6019,44 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_newSymbolicVariable(PyObject* self, PyObject* args) {
-        PyObject* size      = nullptr;
-        PyObject* alias     = nullptr;
-        std::string calias  = "";
+      static PyObject* TritonContext_setSymbolicBudget(PyObject* self, PyObject* args, PyObject* kwargs) {
+        PyObject* maxDepth        = nullptr;
+        PyObject* maxNodes        = nullptr;
+        PyObject* maxExpressions  = nullptr;
+        PyObject* policy          = nullptr;
 
-        /* Extract arguments */
-        if (PyArg_ParseTuple(args, "|OO", &size, &alias) == false) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::newSymbolicVariable(): Invalid number of arguments");
+        static char* keywords[] = {
+          (char*)"maxDepth",
+          (char*)"maxNodes",
+          (char*)"maxExpressions",
+          (char*)"policy",
+          nullptr
+        };
+
+        /* Extract keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OOOO", keywords, &maxDepth, &maxNodes, &maxExpressions, &policy) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSymbolicBudget(): Invalid number of arguments");
         }
 
-        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size)))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::newSymbolicVariable(): Expects an integer as first argument.");
+        if (maxDepth != nullptr && !PyLong_Check(maxDepth) && !PyInt_Check(maxDepth))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSymbolicBudget(): Expects an integer as maxDepth argument.");
 
-        if (alias != nullptr && !PyStr_Check(alias))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::newSymbolicVariable(): Expects a sting as second  argument.");
+        if (maxNodes != nullptr && !PyLong_Check(maxNodes) && !PyInt_Check(maxNodes))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSymbolicBudget(): Expects an integer as maxNodes argument.");
 
-        if (alias != nullptr)
-          calias = PyStr_AsString(alias);
+        if (maxExpressions != nullptr && !PyLong_Check(maxExpressions) && !PyInt_Check(maxExpressions))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSymbolicBudget(): Expects an integer as maxExpressions argument.");
+
+        if (policy != nullptr && !PyLong_Check(policy) && !PyInt_Check(policy))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSymbolicBudget(): Expects a SYMBOLIC policy as policy argument.");
 
         try {
-          return PySymbolicVariable(PyTritonContext_AsTritonContext(self)->newSymbolicVariable(PyLong_AsUint32(size), calias));
+          PyTritonContext_AsTritonContext(self)->setSymbolicBudget(
+            maxDepth       ? PyLong_AsUint32(maxDepth)      : 0,
+            maxNodes       ? PyLong_AsUsize(maxNodes)       : 0,
+            maxExpressions ? PyLong_AsUsize(maxExpressions) : 0,
+            policy         ? static_cast<triton::engines::symbolic::budget_policy_e>(PyLong_AsUint32(policy)) : triton::engines::symbolic::CONCRETIZE_DEEPEST_EXPRESSIONS
+          );
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -2401,12 +6064,38 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
+
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
 
-      static PyObject* TritonContext_popPathConstraint(PyObject* self, PyObject* noarg) {
+      static PyObject* TritonContext_setSymbolicDepthLimit(PyObject* self, PyObject* args, PyObject* kwargs) {
+        PyObject* depth   = nullptr;
+        PyObject* policy  = nullptr;
+
+        static char* keywords[] = {
+          (char*)"depth",
+          (char*)"policy",
+          nullptr
+        };
+
+        /* Extract keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "O|O", keywords, &depth, &policy) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSymbolicDepthLimit(): Invalid number of arguments");
+        }
+
+        if (!PyLong_Check(depth) && !PyInt_Check(depth))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSymbolicDepthLimit(): Expects an integer as depth argument.");
+
+        if (policy != nullptr && !PyLong_Check(policy) && !PyInt_Check(policy))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSymbolicDepthLimit(): Expects a SYMBOLIC policy as policy argument.");
+
         try {
-          PyTritonContext_AsTritonContext(self)->popPathConstraint();
+          PyTritonContext_AsTritonContext(self)->setSymbolicDepthLimit(
+            PyLong_AsUint32(depth),
+            policy ? static_cast<triton::engines::symbolic::depth_policy_e>(PyLong_AsUint32(policy)) : triton::engines::symbolic::CONCRETIZE_DEEP_EXPRESSION
+          );
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -2414,38 +6103,66 @@ namespace triton {
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
+
         Py_INCREF(Py_None);
         return Py_None;
       }
 
 
-      static PyObject* TritonContext_processing(PyObject* self, PyObject* inst) {
-        if (!PyInstruction_Check(inst))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::processing(): Expects an Instruction as argument.");
+      static PyObject* TritonContext_setSimplificationCacheCapacity(PyObject* self, PyObject* entries) {
+        if (entries == nullptr || (!PyLong_Check(entries) && !PyInt_Check(entries)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSimplificationCacheCapacity(): Expects an integer as argument.");
 
         try {
-          if (PyTritonContext_AsTritonContext(self)->processing(*PyInstruction_AsInstruction(inst)))
-            Py_RETURN_TRUE;
-          Py_RETURN_FALSE;
+          PyTritonContext_AsTritonContext(self)->setSimplificationCacheCapacity(PyLong_AsUsize(entries));
         }
-        catch (const triton::exceptions::PyCallbacks&) {
-          return nullptr;
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setSimplificationIterations(PyObject* self, PyObject* iterations) {
+        if (iterations == nullptr || (!PyLong_Check(iterations) && !PyInt_Check(iterations)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSimplificationIterations(): Expects an integer as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setSimplificationIterations(PyLong_AsUint32(iterations));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
+
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
 
-      static PyObject* TritonContext_pushPathConstraint(PyObject* self, PyObject* node) {
-        if (!PyAstNode_Check(node))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::pushPathConstraint(): Expects an AstNode as argument.");
+      static PyObject* TritonContext_setSolver(PyObject* self, PyObject* solver) {
+        if (solver == nullptr || (!PyLong_Check(solver) && !PyInt_Check(solver)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSolver(): Expects a SOLVER as argument.");
 
         try {
-          PyTritonContext_AsTritonContext(self)->pushPathConstraint(PyAstNode_AsAstNode(node));
+          PyTritonContext_AsTritonContext(self)->setSolver(static_cast<triton::engines::solver::solver_e>(PyLong_AsUint32(solver)));
         }
-        catch (const triton::exceptions::PyCallbacks&) {
-          return nullptr;
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setSolverAdaptiveTimeouts(PyObject* self, PyObject* flag) {
+        if (flag == nullptr || !PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSolverAdaptiveTimeouts(): Expects a boolean as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->getSolverBudget()->setEnabled(PyLong_AsBool(flag));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -2456,63 +6173,91 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_removeCallback(PyObject* self, PyObject* args) {
-        PyObject* cb       = nullptr;
-        PyObject* cb_self  = nullptr;
-        PyObject* function = nullptr;
-        PyObject* mode     = nullptr;
+      static PyObject* TritonContext_setSolverBudget(PyObject* self, PyObject* args) {
+        PyObject* ms   = nullptr;
+        PyObject* base = nullptr;
+        PyObject* max  = nullptr;
 
         /* Extract arguments */
-        if (PyArg_ParseTuple(args, "|OO", &mode, &function) == false) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::removeCallback(): Invalid number of arguments");
+        if (PyArg_ParseTuple(args, "|OOO", &ms, &base, &max) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSolverBudget(): Invalid number of arguments");
         }
 
-        if (mode == nullptr || (!PyLong_Check(mode) && !PyInt_Check(mode)))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::removeCallback(): Expects a CALLBACK as first argument.");
+        if (ms == nullptr || (!PyLong_Check(ms) && !PyInt_Check(ms)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSolverBudget(): Expects an integer as first argument.");
 
-        if (function == nullptr || !PyCallable_Check(function))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::removeCallback(): Expects a function as second argument.");
+        if (base != nullptr && (!PyLong_Check(base) && !PyInt_Check(base)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSolverBudget(): Expects an integer as second argument.");
 
-        /* Get the callback (class or static) */
-        if (PyMethod_Check(function)) {
-          cb_self = PyMethod_GET_SELF(function);
-          cb = PyMethod_GET_FUNCTION(function);
+        if (max != nullptr && (!PyLong_Check(max) && !PyInt_Check(max)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSolverBudget(): Expects an integer as third argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->getSolverBudget()->setBudget(
+            PyLong_AsUint64(ms),
+            base != nullptr ? PyLong_AsUint32(base) : 1000,
+            max != nullptr ? PyLong_AsUint32(max) : 60000
+          );
         }
-        else {
-          cb = function;
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setSolverCacheCapacity(PyObject* self, PyObject* entries) {
+        if (entries == nullptr || (!PyLong_Check(entries) && !PyInt_Check(entries)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSolverCacheCapacity(): Expects an integer as argument.");
+
         try {
-          switch (static_cast<triton::callbacks::callback_e>(PyLong_AsUint32(mode))) {
-            case callbacks::GET_CONCRETE_MEMORY_VALUE:
-              PyTritonContext_AsTritonContext(self)->removeCallback(callbacks::GET_CONCRETE_MEMORY_VALUE, callbacks::getConcreteMemoryValueCallback(nullptr, cb));
-              break;
-            case callbacks::GET_CONCRETE_REGISTER_VALUE:
-              PyTritonContext_AsTritonContext(self)->removeCallback(callbacks::GET_CONCRETE_REGISTER_VALUE, callbacks::getConcreteRegisterValueCallback(nullptr, cb));
-              break;
-            case callbacks::SET_CONCRETE_MEMORY_VALUE:
-              PyTritonContext_AsTritonContext(self)->removeCallback(callbacks::SET_CONCRETE_MEMORY_VALUE, callbacks::setConcreteMemoryValueCallback(nullptr, cb));
-              break;
-            case callbacks::SET_CONCRETE_REGISTER_VALUE:
-              PyTritonContext_AsTritonContext(self)->removeCallback(callbacks::SET_CONCRETE_REGISTER_VALUE, callbacks::setConcreteRegisterValueCallback(nullptr, cb));
-              break;
-            case callbacks::SYMBOLIC_SIMPLIFICATION:
-              PyTritonContext_AsTritonContext(self)->removeCallback(callbacks::SYMBOLIC_SIMPLIFICATION, callbacks::symbolicSimplificationCallback(nullptr, cb));
-              break;
-            default:
-              return PyErr_Format(PyExc_TypeError, "TritonContext::removeCallback(): Invalid kind of callback.");
-          }
+          PyTritonContext_AsTritonContext(self)->getSolverCache()->setCapacity(PyLong_AsUsize(entries));
         }
-        catch (const triton::exceptions::PyCallbacks&) {
-          return nullptr;
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setSolverCacheFile(PyObject* self, PyObject* path) {
+        if (path == nullptr || !PyStr_Check(path))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSolverCacheFile(): Expects a string as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->getSolverCache()->setBackingFile(PyStr_AsString(path));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
-        Py_DECREF(cb);
-        if (cb_self != nullptr) {
-          Py_DECREF(cb_self);
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setSolverExternalCommand(PyObject* self, PyObject* command) {
+        std::vector<std::string> args;
+
+        if (command == nullptr || !PyList_Check(command))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSolverExternalCommand(): Expects a list of strings as argument.");
+
+        for (Py_ssize_t i = 0; i < PyList_Size(command); i++) {
+          PyObject* item = PyList_GetItem(command, i);
+          if (!PyStr_Check(item))
+            return PyErr_Format(PyExc_TypeError, "TritonContext::setSolverExternalCommand(): Each item of the list must be a string.");
+          args.push_back(PyStr_AsString(item));
+        }
+
+        try {
+          PyTritonContext_AsTritonContext(self)->getSolverExternal()->setCommand(args);
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
         Py_INCREF(Py_None);
@@ -2520,12 +6265,12 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_reset(PyObject* self, PyObject* noarg) {
+      static PyObject* TritonContext_setSolverExternalPoolSize(PyObject* self, PyObject* size) {
+        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSolverExternalPoolSize(): Expects an integer as argument.");
+
         try {
-          PyTritonContext_AsTritonContext(self)->reset();
-        }
-        catch (const triton::exceptions::PyCallbacks&) {
-          return nullptr;
+          PyTritonContext_AsTritonContext(self)->getSolverExternal()->setPoolSize(PyLong_AsUsize(size));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -2536,17 +6281,12 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_setArchitecture(PyObject* self, PyObject* arg) {
-        if (!PyLong_Check(arg) && !PyInt_Check(arg))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::setArchitecture(): Expects an ARCH as argument.");
+      static PyObject* TritonContext_setSolverMemoryLimit(PyObject* self, PyObject* megabytes) {
+        if (megabytes == nullptr || (!PyLong_Check(megabytes) && !PyInt_Check(megabytes)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSolverMemoryLimit(): Expects an integer as argument.");
 
         try {
-          /* Set the architecture */
-          PyTritonContext_AsTritonContext(self)->setArchitecture(static_cast<triton::arch::architecture_e>(PyLong_AsUint32(arg)));
-          TritonContext_fillRegistersAttribute(self);
-        }
-        catch (const triton::exceptions::PyCallbacks&) {
-          return nullptr;
+          PyTritonContext_AsTritonContext(self)->setSolverMemoryLimit(PyLong_AsUint32(megabytes));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -2557,15 +6297,12 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_setAstRepresentationMode(PyObject* self, PyObject* arg) {
-        if (!PyLong_Check(arg) && !PyInt_Check(arg))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::setAstRepresentationMode(): Expects an AST_REPRESENTATION as argument.");
+      static PyObject* TritonContext_setSolverAnalytic(PyObject* self, PyObject* flag) {
+        if (flag == nullptr || !PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSolverAnalytic(): Expects a boolean as argument.");
 
         try {
-          PyTritonContext_AsTritonContext(self)->setAstRepresentationMode(static_cast<triton::ast::representations::mode_e>(PyLong_AsUint32(arg)));
-        }
-        catch (const triton::exceptions::PyCallbacks&) {
-          return nullptr;
+          PyTritonContext_AsTritonContext(self)->getSolverAnalytic()->setEnabled(PyLong_AsBool(flag));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -2576,163 +6313,136 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_setConcreteMemoryAreaValue(PyObject* self, PyObject* args) {
-        std::vector<triton::uint8> vv;
-        PyObject* baseAddr  = nullptr;
-        PyObject* values    = nullptr;
+      static PyObject* TritonContext_setSolverLocalSearchBudget(PyObject* self, PyObject* ms) {
+        if (ms == nullptr || (!PyLong_Check(ms) && !PyInt_Check(ms)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSolverLocalSearchBudget(): Expects an integer as argument.");
 
-        /* Extract arguments */
-        if (PyArg_ParseTuple(args, "|OO", &baseAddr, &values) == false) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteMemoryAreaValue(): Invalid number of arguments");
+        try {
+          PyTritonContext_AsTritonContext(self)->getSolverLocalSearch()->setBudget(PyLong_AsUint32(ms));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
-        if (baseAddr == nullptr || (!PyLong_Check(baseAddr) && !PyInt_Check(baseAddr)))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteMemoryAreaValue(): Expects an integer as first argument.");
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
 
-        if (values == nullptr)
-          return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteMemoryAreaValue(): Expects a list or bytes as second argument.");
 
-        // Python object: List
-        if (PyList_Check(values)) {
-          for (Py_ssize_t i = 0; i < PyList_Size(values); i++) {
-            PyObject* item = PyList_GetItem(values, i);
+      static PyObject* TritonContext_setSolverLocalSearchFallback(PyObject* self, PyObject* solver) {
+        triton::engines::solver::solver_e kind = triton::engines::solver::SOLVER_INVALID;
 
-            if ((!PyLong_Check(item) && !PyInt_Check(item)) || PyLong_AsUint32(item) > 0xff)
-              return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteMemoryAreaValue(): Each item of the list must be a 8-bits integer.");
+        if (solver == nullptr || (solver != Py_None && !PyLong_Check(solver) && !PyInt_Check(solver)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSolverLocalSearchFallback(): Expects a SOLVER or None as argument.");
 
-            vv.push_back(static_cast<triton::uint8>(PyLong_AsUint32(item) & 0xff));
-          }
+        if (solver != Py_None)
+          kind = static_cast<triton::engines::solver::solver_e>(PyLong_AsUint32(solver));
 
-          try {
-            PyTritonContext_AsTritonContext(self)->setConcreteMemoryAreaValue(PyLong_AsUint64(baseAddr), vv);
-          }
-          catch (const triton::exceptions::PyCallbacks&) {
-            return nullptr;
-          }
-          catch (const triton::exceptions::Exception& e) {
-            return PyErr_Format(PyExc_TypeError, "%s", e.what());
-          }
+        try {
+          PyTritonContext_AsTritonContext(self)->getSolverLocalSearch()->setFallback(kind);
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
-        // Python object: Bytes
-        else if (PyBytes_Check(values)) {
-          triton::uint8* area = reinterpret_cast<triton::uint8*>(PyBytes_AsString(values));
-          triton::usize  size = static_cast<triton::usize>(PyBytes_Size(values));
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
 
-          try {
-            PyTritonContext_AsTritonContext(self)->setConcreteMemoryAreaValue(PyLong_AsUint64(baseAddr), area, size);
-          }
-          catch (const triton::exceptions::PyCallbacks&) {
-            return nullptr;
-          }
-          catch (const triton::exceptions::Exception& e) {
-            return PyErr_Format(PyExc_TypeError, "%s", e.what());
-          }
-        }
 
-        // Python object: ByteArray
-        else if (PyByteArray_Check(values)) {
-          triton::uint8* area = reinterpret_cast<triton::uint8*>(PyByteArray_AsString(values));
-          triton::usize  size = static_cast<triton::usize>(PyByteArray_Size(values));
+      #if defined(TRITON_Z3_INTERFACE) || defined(TRITON_BITWUZLA_INTERFACE)
+      static PyObject* TritonContext_setSolverPortfolio(PyObject* self, PyObject* solvers) {
+        std::vector<triton::engines::solver::solver_e> kinds;
 
-          try {
-            PyTritonContext_AsTritonContext(self)->setConcreteMemoryAreaValue(PyLong_AsUint64(baseAddr), area, size);
-          }
-          catch (const triton::exceptions::PyCallbacks&) {
-            return nullptr;
-          }
-          catch (const triton::exceptions::Exception& e) {
-            return PyErr_Format(PyExc_TypeError, "%s", e.what());
-          }
+        if (solvers == nullptr || !PyList_Check(solvers))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSolverPortfolio(): Expects a list of SOLVER as argument.");
+
+        for (Py_ssize_t i = 0; i < PyList_Size(solvers); i++) {
+          PyObject* solver = PyList_GetItem(solvers, i);
+          if (!PyLong_Check(solver) && !PyInt_Check(solver))
+            return PyErr_Format(PyExc_TypeError, "TritonContext::setSolverPortfolio(): Each item of the list must be a SOLVER.");
+          kinds.push_back(static_cast<triton::engines::solver::solver_e>(PyLong_AsUint32(solver)));
         }
 
-        // Invalid Python object
-        else
-          return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteMemoryAreaValue(): Expects a list or bytes as second argument.");
+        try {
+          PyTritonContext_AsTritonContext(self)->getSolverPortfolio()->setBackends(kinds);
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
 
         Py_INCREF(Py_None);
         return Py_None;
       }
+      #endif
 
 
-      static PyObject* TritonContext_setConcreteMemoryValue(PyObject* self, PyObject* args) {
-        PyObject* mem    = nullptr;
-        PyObject* value  = nullptr;
+      static PyObject* TritonContext_setSolverPreprocessing(PyObject* self, PyObject* flag) {
+        if (flag == nullptr || !PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSolverPreprocessing(): Expects a boolean as argument.");
 
-        /* Extract arguments */
-        if (PyArg_ParseTuple(args, "|OO", &mem, &value) == false) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteMemoryValue(): Invalid number of arguments");
+        try {
+          PyTritonContext_AsTritonContext(self)->getSolverPreprocessor()->setEnabled(PyLong_AsBool(flag));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
-        /* setConcreteMemoryValue(integer, integer) */
-        if (mem != nullptr && (PyLong_Check(mem) || PyInt_Check(mem))) {
-          if (value == nullptr || (!PyLong_Check(value) && !PyInt_Check(value)))
-            return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteMemoryValue(): Expects a value as second argument.");
-
-          triton::uint64 addr   = PyLong_AsUint64(mem);
-          triton::uint32 cvalue = PyLong_AsUint32(value);
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
 
-          if (cvalue > 0xff)
-            return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteMemoryValue(): Value must be on 8 bits.");
 
-          try {
-            PyTritonContext_AsTritonContext(self)->setConcreteMemoryValue(addr, static_cast<triton::uint8>(cvalue & 0xff));
-          }
-          catch (const triton::exceptions::PyCallbacks&) {
-            return nullptr;
-          }
-          catch (const triton::exceptions::Exception& e) {
-            return PyErr_Format(PyExc_TypeError, "%s", e.what());
-          }
+      static PyObject* TritonContext_setSolverProfile(PyObject* self, PyObject* name) {
+        if (name == nullptr || (name != Py_None && !PyStr_Check(name)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSolverProfile(): Expects a string or None as argument.");
 
+        try {
+          PyTritonContext_AsTritonContext(self)->getSolverProfiles()->setForced(name == Py_None ? "" : PyStr_AsString(name));
         }
-
-        /* setConcreteMemoryValue(MemoryAccess) */
-        else if (mem != nullptr && PyMemoryAccess_Check(mem)) {
-          if (value == nullptr || (!PyLong_Check(value) && !PyInt_Check(value)))
-            return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteMemoryValue(): Expects a value as second argument.");
-          try {
-            triton::uint512 cvalue = PyLong_AsUint512(value);
-            PyTritonContext_AsTritonContext(self)->setConcreteMemoryValue(*PyMemoryAccess_AsMemoryAccess(mem), cvalue);
-          }
-          catch (const triton::exceptions::PyCallbacks&) {
-            return nullptr;
-          }
-          catch (const triton::exceptions::Exception& e) {
-            return PyErr_Format(PyExc_TypeError, "%s", e.what());
-          }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
-        /* Invalid */
-        else
-          return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteMemoryValue(): Expects a MemoryAccess or an integer as first argument.");
-
         Py_INCREF(Py_None);
         return Py_None;
       }
 
 
-      static PyObject* TritonContext_setConcreteRegisterValue(PyObject* self, PyObject* args) {
-        PyObject* reg    = nullptr;
-        PyObject* value  = nullptr;
+      static PyObject* TritonContext_setSolverProfileSelection(PyObject* self, PyObject* flag) {
+        if (flag == nullptr || !PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSolverProfileSelection(): Expects a boolean as argument.");
 
-        /* Extract arguments */
-        if (PyArg_ParseTuple(args, "|OO", &reg, &value) == false) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteRegisterValue(): Invalid number of arguments");
+        try {
+          PyTritonContext_AsTritonContext(self)->getSolverProfiles()->setEnabled(PyLong_AsBool(flag));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
-        if (reg == nullptr || !PyRegister_Check(reg))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteRegisterValue(): Expects a Register as first argument.");
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
 
-        if (value == nullptr || (!PyLong_Check(value) && !PyInt_Check(value)))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteRegisterValue(): Expects a value as second argument.");
 
-        try {
-          triton::uint512 cvalue = PyLong_AsUint512(value);
-          PyTritonContext_AsTritonContext(self)->setConcreteRegisterValue(*PyRegister_AsRegister(reg), cvalue);
+      static PyObject* TritonContext_setSolverRemoteEndpoints(PyObject* self, PyObject* endpoints) {
+        std::vector<std::string> args;
+
+        if (endpoints == nullptr || !PyList_Check(endpoints))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSolverRemoteEndpoints(): Expects a list of strings as argument.");
+
+        for (Py_ssize_t i = 0; i < PyList_Size(endpoints); i++) {
+          PyObject* item = PyList_GetItem(endpoints, i);
+          if (!PyStr_Check(item))
+            return PyErr_Format(PyExc_TypeError, "TritonContext::setSolverRemoteEndpoints(): Each item of the list must be a string.");
+          args.push_back(PyStr_AsString(item));
         }
-        catch (const triton::exceptions::PyCallbacks&) {
-          return nullptr;
+
+        try {
+          PyTritonContext_AsTritonContext(self)->getSolverRemote()->setEndpoints(args);
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -2743,26 +6453,23 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_setConcreteVariableValue(PyObject* self, PyObject* args) {
-        PyObject* symVar = nullptr;
-        PyObject* value  = nullptr;
+      static PyObject* TritonContext_setSolverSlowQueryDump(PyObject* self, PyObject* args) {
+        PyObject* directory = nullptr;
+        PyObject* ms        = nullptr;
 
         /* Extract arguments */
-        if (PyArg_ParseTuple(args, "|OO", &symVar, &value) == false) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteVariableValue(): Invalid number of arguments");
+        if (PyArg_ParseTuple(args, "|OO", &directory, &ms) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSolverSlowQueryDump(): Invalid number of arguments");
         }
 
-        if (symVar == nullptr || !PySymbolicVariable_Check(symVar))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteVariableValue(): Bad argument type.");
+        if (directory == nullptr || !PyStr_Check(directory))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSolverSlowQueryDump(): Expects a string as first argument.");
 
-        if (value == nullptr)
-          return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteVariableValue(): Expects a second argument as integer value.");
+        if (ms == nullptr || (!PyLong_Check(ms) && !PyInt_Check(ms)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSolverSlowQueryDump(): Expects an integer as second argument.");
 
         try {
-          PyTritonContext_AsTritonContext(self)->setConcreteVariableValue(PySymbolicVariable_AsSymbolicVariable(symVar), PyLong_AsUint512(value));
-        }
-        catch (const triton::exceptions::PyCallbacks&) {
-          return nullptr;
+          PyTritonContext_AsTritonContext(self)->getSolverStatistics()->setSlowQueryDump(PyStr_AsString(directory), PyLong_AsUint32(ms));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -2773,26 +6480,44 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_setMode(PyObject* self, PyObject* args) {
-        PyObject* mode = nullptr;
-        PyObject* flag = nullptr;
+      static PyObject* TritonContext_setSolverStatistics(PyObject* self, PyObject* flag) {
+        if (flag == nullptr || !PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSolverStatistics(): Expects a boolean as argument.");
 
-        /* Extract arguments */
-        if (PyArg_ParseTuple(args, "|OO", &mode, &flag) == false) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::setMode(): Invalid number of arguments");
+        try {
+          PyTritonContext_AsTritonContext(self)->getSolverStatistics()->setEnabled(PyLong_AsBool(flag));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
-        if (mode == nullptr || (!PyLong_Check(mode) && !PyInt_Check(mode)))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::setMode(): Expects a MODE as argument.");
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
 
-        if (flag == nullptr || !PyBool_Check(flag))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::setMode(): Expects an boolean flag as second argument.");
+
+      static PyObject* TritonContext_setSolverThreads(PyObject* self, PyObject* threads) {
+        if (threads == nullptr || (!PyLong_Check(threads) && !PyInt_Check(threads)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSolverThreads(): Expects an integer as argument.");
 
         try {
-          PyTritonContext_AsTritonContext(self)->setMode(static_cast<triton::modes::mode_e>(PyLong_AsUint32(mode)), PyLong_AsBool(flag));
+          PyTritonContext_AsTritonContext(self)->setSolverThreads(PyLong_AsUsize(threads));
         }
-        catch (const triton::exceptions::PyCallbacks&) {
-          return nullptr;
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setSolverTimeout(PyObject* self, PyObject* ms) {
+        if (ms == nullptr || (!PyLong_Check(ms) && !PyInt_Check(ms)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSolverTimeout(): Expects an integer as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setSolverTimeout(PyLong_AsUint32(ms));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -2803,12 +6528,12 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_setSolver(PyObject* self, PyObject* solver) {
-        if (solver == nullptr || (!PyLong_Check(solver) && !PyInt_Check(solver)))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::setSolver(): Expects a SOLVER as argument.");
+      static PyObject* TritonContext_setStatistics(PyObject* self, PyObject* flag) {
+        if (flag == nullptr || !PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setStatistics(): Expects a boolean as argument.");
 
         try {
-          PyTritonContext_AsTritonContext(self)->setSolver(static_cast<triton::engines::solver::solver_e>(PyLong_AsUint32(solver)));
+          PyTritonContext_AsTritonContext(self)->getStatistics()->setEnabled(PyLong_AsBool(flag));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -2819,12 +6544,40 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_setSolverMemoryLimit(PyObject* self, PyObject* megabytes) {
-        if (megabytes == nullptr || (!PyLong_Check(megabytes) && !PyInt_Check(megabytes)))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::setSolverMemoryLimit(): Expects an integer as argument.");
+      static PyObject* TritonContext_setSyscallFile(PyObject* self, PyObject* args) {
+        PyObject* path      = nullptr;
+        PyObject* content   = nullptr;
+        PyObject* symbolize = nullptr;
+        Py_buffer view;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OOO", &path, &content, &symbolize) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSyscallFile(): Invalid number of arguments");
+        }
+
+        if (path == nullptr || !PyStr_Check(path))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSyscallFile(): Expects a string as first argument.");
+
+        if (content == nullptr || !PyObject_CheckBuffer(content))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSyscallFile(): Expects a buffer as second argument.");
+
+        if (symbolize != nullptr && !PyBool_Check(symbolize))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSyscallFile(): Expects a boolean as third argument.");
+
+        if (PyObject_GetBuffer(content, &view, PyBUF_SIMPLE) != 0) {
+          PyErr_Clear();
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSyscallFile(): Expects a contiguous buffer as second argument.");
+        }
+
+        const triton::uint8* data = reinterpret_cast<const triton::uint8*>(view.buf);
+        std::vector<triton::uint8> bytes(data, data + view.len);
+        PyBuffer_Release(&view);
 
         try {
-          PyTritonContext_AsTritonContext(self)->setSolverMemoryLimit(PyLong_AsUint32(megabytes));
+          PyTritonContext_AsTritonContext(self)->setSyscallFile(PyStr_AsString(path), bytes, symbolize != nullptr && PyLong_AsBool(symbolize));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -2835,12 +6588,26 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_setSolverTimeout(PyObject* self, PyObject* ms) {
-        if (ms == nullptr || (!PyLong_Check(ms) && !PyInt_Check(ms)))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::setSolverTimeout(): Expects an integer as argument.");
+      static PyObject* TritonContext_setSyscallLayout(PyObject* self, PyObject* args) {
+        PyObject* heap = nullptr;
+        PyObject* mmap = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &heap, &mmap) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSyscallLayout(): Invalid number of arguments");
+        }
+
+        if (heap == nullptr || (!PyLong_Check(heap) && !PyInt_Check(heap)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSyscallLayout(): Expects an integer as first argument.");
+
+        if (mmap == nullptr || (!PyLong_Check(mmap) && !PyInt_Check(mmap)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSyscallLayout(): Expects an integer as second argument.");
 
         try {
-          PyTritonContext_AsTritonContext(self)->setSolverTimeout(PyLong_AsUint32(ms));
+          PyTritonContext_AsTritonContext(self)->setSyscallLayout(PyLong_AsUint64(heap), PyLong_AsUint64(mmap));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -2909,6 +6676,25 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_setThread(PyObject* self, PyObject* tid) {
+        if (tid == nullptr || (!PyLong_Check(tid) && !PyInt_Check(tid)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setThread(): Expects an integer as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setThread(PyLong_AsUint32(tid));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_setThumb(PyObject* self, PyObject* state) {
         if (state == nullptr || !PyBool_Check(state))
           return PyErr_Format(PyExc_TypeError, "TritonContext::setThumb(): Expects an boolean as argument.");
@@ -2925,6 +6711,54 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_setTraceCapacity(PyObject* self, PyObject* capacity) {
+        if (capacity == nullptr || (!PyLong_Check(capacity) && !PyInt_Check(capacity)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setTraceCapacity(): Expects an integer as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->getTracer()->setCapacity(PyLong_AsUsize(capacity));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setTracing(PyObject* self, PyObject* flag) {
+        if (flag == nullptr || !PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setTracing(): Expects a boolean as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->getTracer()->setEnabled(PyLong_AsBool(flag));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_shareDisassemblyCache(PyObject* self, PyObject* ctx) {
+        if (ctx == nullptr || !PyTritonContext_Check(ctx))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::shareDisassemblyCache(): Expects a TritonContext as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setDisassemblyCache(PyTritonContext_AsTritonContext(ctx)->getDisassemblyCache());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_simplify(PyObject* self, PyObject* args, PyObject* kwargs) {
         PyObject* node   = nullptr;
         PyObject* solver = nullptr;
@@ -2958,7 +6792,18 @@ namespace triton {
           llvm = PyLong_FromUint32(false);
 
         try {
-          return PyAstNode(PyTritonContext_AsTritonContext(self)->simplify(PyAstNode_AsAstNode(node), PyLong_AsBool(solver), PyLong_AsBool(llvm)));
+          auto ctx     = PyTritonContext_AsTritonContext(self);
+          auto cnode   = PyAstNode_AsAstNode(node);
+          bool csolver = PyLong_AsBool(solver);
+          bool cllvm   = PyLong_AsBool(llvm);
+
+          /* Only the solver and LLVM are worth releasing the GIL for */
+          if (csolver || cllvm)
+            PyAllowThreads([&]() { cnode = ctx->simplify(cnode, csolver, cllvm); });
+          else
+            cnode = ctx->simplify(cnode, csolver, cllvm);
+
+          return PyAstNode(cnode);
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -2976,10 +6821,40 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "TritonContext::sliceExpressions(): Expects a SymbolicExpression as argument.");
 
         try {
-          auto exprs = PyTritonContext_AsTritonContext(self)->sliceExpressions(PySymbolicExpression_AsSymbolicExpression(expr));
+          ret = PyMapView(PyTritonContext_AsTritonContext(self)->sliceExpressions(PySymbolicExpression_AsSymbolicExpression(expr)));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_sliceExpressionsMany(PyObject* self, PyObject* exprs) {
+        std::vector<triton::engines::symbolic::SharedSymbolicExpression> roots;
+        PyObject* ret = nullptr;
+
+        if (!PyList_Check(exprs))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::sliceExpressionsMany(): Expects a list of SymbolicExpression as argument.");
+
+        for (Py_ssize_t i = 0; i < PyList_Size(exprs); i++) {
+          PyObject* item = PyList_GetItem(exprs, i);
+
+          if (!PySymbolicExpression_Check(item))
+            return PyErr_Format(PyExc_TypeError, "TritonContext::sliceExpressionsMany(): Each item of the list must be a SymbolicExpression.");
+
+          roots.push_back(PySymbolicExpression_AsSymbolicExpression(item));
+        }
+
+        try {
+          auto slice = PyTritonContext_AsTritonContext(self)->sliceExpressionsMany(roots);
 
           ret = xPyDict_New();
-          for (auto it = exprs.begin(); it != exprs.end(); it++)
+          for (auto it = slice.begin(); it != slice.end(); it++)
             xPyDict_SetItem(ret, PyLong_FromUsize(it->first), PySymbolicExpression(it->second));
         }
         catch (const triton::exceptions::PyCallbacks&) {
@@ -2993,6 +6868,104 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_solveAllBranchFlips(PyObject* self, PyObject* args, PyObject* kwargs) {
+        triton::engines::solver::BranchFlipOptions options;
+
+        PyObject* parallel    = nullptr;
+        PyObject* skipCovered = nullptr;
+        PyObject* limit       = nullptr;
+        PyObject* timeout     = nullptr;
+        PyObject* unsatCores  = nullptr;
+        PyObject* ret         = nullptr;
+
+        static char* keywords[] = {
+          (char*)"parallel",
+          (char*)"skipCovered",
+          (char*)"limit",
+          (char*)"timeout",
+          (char*)"unsatCores",
+          nullptr
+        };
+
+        /* Extract Keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OOOOO", keywords, &parallel, &skipCovered, &limit, &timeout, &unsatCores) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::solveAllBranchFlips(): Invalid keyword argument.");
+        }
+
+        if (parallel != nullptr && !PyBool_Check(parallel)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::solveAllBranchFlips(): Expects a boolean as parallel keyword.");
+        }
+
+        if (skipCovered != nullptr && !PyBool_Check(skipCovered)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::solveAllBranchFlips(): Expects a boolean as skipCovered keyword.");
+        }
+
+        if (limit != nullptr && (!PyLong_Check(limit) && !PyInt_Check(limit))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::solveAllBranchFlips(): Expects an integer as limit keyword.");
+        }
+
+        if (timeout != nullptr && (!PyLong_Check(timeout) && !PyInt_Check(timeout))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::solveAllBranchFlips(): Expects an integer as timeout keyword.");
+        }
+
+        if (unsatCores != nullptr && !PyBool_Check(unsatCores)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::solveAllBranchFlips(): Expects a boolean as unsatCores keyword.");
+        }
+
+        if (parallel != nullptr)
+          options.parallel = PyLong_AsBool(parallel);
+
+        if (skipCovered != nullptr)
+          options.skipCovered = PyLong_AsBool(skipCovered);
+
+        if (limit != nullptr)
+          options.limit = PyLong_AsUsize(limit);
+
+        if (timeout != nullptr)
+          options.timeout = PyLong_AsUint32(timeout);
+
+        if (unsatCores != nullptr)
+          options.unsatCores = PyLong_AsBool(unsatCores);
+
+        try {
+          auto flips = PyTritonContext_AsTritonContext(self)->solveAllBranchFlips(options);
+
+          ret = xPyList_New(flips.size());
+          for (triton::usize i = 0; i < flips.size(); i++) {
+            const auto& flip = flips[i];
+
+            PyObject* model = xPyDict_New();
+            for (const auto& item : flip.model)
+              xPyDict_SetItem(model, PyLong_FromUsize(item.first), PySolverModel(item.second));
+
+            PyObject* core = xPyList_New(flip.core.size());
+            for (triton::usize index = 0; index < flip.core.size(); index++)
+              PyList_SetItem(core, index, PyAstNode(flip.core[index]));
+
+            PyObject* dict = xPyDict_New();
+            xPyDict_SetItemString(dict, "core",        core);
+            xPyDict_SetItemString(dict, "dstAddr",     PyLong_FromUint64(flip.dstAddr));
+            xPyDict_SetItemString(dict, "index",       PyLong_FromUsize(flip.index));
+            xPyDict_SetItemString(dict, "model",       model);
+            xPyDict_SetItemString(dict, "predicate",   PyAstNode(flip.predicate));
+            xPyDict_SetItemString(dict, "pruned",      PyBool_FromLong(flip.pruned));
+            xPyDict_SetItemString(dict, "solvingTime", PyLong_FromUint32(flip.solvingTime));
+            xPyDict_SetItemString(dict, "srcAddr",     PyLong_FromUint64(flip.srcAddr));
+            xPyDict_SetItemString(dict, "status",      PyLong_FromUint32(flip.status));
+            PyList_SetItem(ret, i, dict);
+          }
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* TritonContext_symbolizeExpression(PyObject* self, PyObject* args) {
         PyObject* exprId        = nullptr;
         PyObject* symVarSize    = nullptr;
@@ -3059,6 +7032,57 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_symbolizeMemoryArea(PyObject* self, PyObject* args) {
+        PyObject* ret           = nullptr;
+        PyObject* baseAddr      = nullptr;
+        PyObject* size          = nullptr;
+        PyObject* granularity   = nullptr;
+        PyObject* aliasPrefix   = nullptr;
+        triton::uint32 cgran    = triton::size::byte;
+        std::string cprefix     = "";
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OOOO", &baseAddr, &size, &granularity, &aliasPrefix) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::symbolizeMemoryArea(): Invalid number of arguments");
+        }
+
+        if (baseAddr == nullptr || (!PyLong_Check(baseAddr) && !PyInt_Check(baseAddr)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::symbolizeMemoryArea(): Expects an integer as first argument.");
+
+        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::symbolizeMemoryArea(): Expects an integer as second argument.");
+
+        if (granularity != nullptr && (!PyLong_Check(granularity) && !PyInt_Check(granularity)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::symbolizeMemoryArea(): Expects an integer as third argument.");
+
+        if (aliasPrefix != nullptr && !PyStr_Check(aliasPrefix))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::symbolizeMemoryArea(): Expects a sting as fourth argument.");
+
+        if (granularity != nullptr)
+          cgran = PyLong_AsUint32(granularity);
+
+        if (aliasPrefix != nullptr)
+          cprefix = PyStr_AsString(aliasPrefix);
+
+        try {
+          auto symVars = PyTritonContext_AsTritonContext(self)->symbolizeMemoryArea(PyLong_AsUint64(baseAddr), PyLong_AsUsize(size), cgran, cprefix);
+          triton::usize index = 0;
+
+          ret = xPyList_New(symVars.size());
+          for (const auto& symVar : symVars)
+            PyList_SetItem(ret, index++, PySymbolicVariable(symVar));
+
+          return ret;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* TritonContext_symbolizeRegister(PyObject* self, PyObject* args) {
         PyObject* reg           = nullptr;
         PyObject* symVarAlias   = nullptr;
@@ -3090,22 +7114,174 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_syncFuzzer(PyObject* self, PyObject* args, PyObject* kwargs) {
+        triton::engines::exploration::FuzzerBridgeOptions options;
+
+        PyObject* entry           = nullptr;
+        PyObject* fuzzer          = nullptr;
+        PyObject* output          = nullptr;
+        PyObject* input           = nullptr;
+        PyObject* exits           = nullptr;
+        PyObject* maxInstructions = nullptr;
+        PyObject* newEdgesOnly    = nullptr;
+        PyObject* parallel        = nullptr;
+        PyObject* timeout         = nullptr;
+        PyObject* unsatCores      = nullptr;
+        PyObject* timeLimit       = nullptr;
+        PyObject* interval        = nullptr;
+        PyObject* ret             = nullptr;
+
+        static char* keywords[] = {
+          (char*)"entry",
+          (char*)"fuzzer",
+          (char*)"output",
+          (char*)"input",
+          (char*)"exits",
+          (char*)"maxInstructions",
+          (char*)"newEdgesOnly",
+          (char*)"parallel",
+          (char*)"timeout",
+          (char*)"unsatCores",
+          (char*)"timeLimit",
+          (char*)"interval",
+          nullptr
+        };
+
+        /* Extract Keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "OOOO|OOOOOOOO", keywords, &entry, &fuzzer, &output, &input, &exits, &maxInstructions, &newEdgesOnly, &parallel, &timeout, &unsatCores, &timeLimit, &interval) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::syncFuzzer(): Invalid keyword argument.");
+        }
+
+        if (!PyLong_Check(entry) && !PyInt_Check(entry)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::syncFuzzer(): Expects an integer as entry.");
+        }
+
+        if (!PyStr_Check(fuzzer)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::syncFuzzer(): Expects a string as fuzzer.");
+        }
+
+        if (!PyStr_Check(output)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::syncFuzzer(): Expects a string as output.");
+        }
+
+        if (!PyList_Check(input)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::syncFuzzer(): Expects a list of SymbolicVariable as input.");
+        }
+
+        if (exits != nullptr && !PyList_Check(exits)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::syncFuzzer(): Expects a list of integers as exits keyword.");
+        }
+
+        if (maxInstructions != nullptr && (!PyLong_Check(maxInstructions) && !PyInt_Check(maxInstructions))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::syncFuzzer(): Expects an integer as maxInstructions keyword.");
+        }
+
+        if (newEdgesOnly != nullptr && !PyBool_Check(newEdgesOnly)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::syncFuzzer(): Expects a boolean as newEdgesOnly keyword.");
+        }
+
+        if (parallel != nullptr && !PyBool_Check(parallel)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::syncFuzzer(): Expects a boolean as parallel keyword.");
+        }
+
+        if (timeout != nullptr && (!PyLong_Check(timeout) && !PyInt_Check(timeout))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::syncFuzzer(): Expects an integer as timeout keyword.");
+        }
+
+        if (unsatCores != nullptr && !PyBool_Check(unsatCores)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::syncFuzzer(): Expects a boolean as unsatCores keyword.");
+        }
+
+        if (timeLimit != nullptr && (!PyLong_Check(timeLimit) && !PyInt_Check(timeLimit))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::syncFuzzer(): Expects an integer as timeLimit keyword.");
+        }
+
+        if (interval != nullptr && (!PyLong_Check(interval) && !PyInt_Check(interval))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::syncFuzzer(): Expects an integer as interval keyword.");
+        }
+
+        options.fuzzer = PyStr_AsString(fuzzer);
+        options.output = PyStr_AsString(output);
+
+        for (Py_ssize_t i = 0; i < PyList_Size(input); i++) {
+          PyObject* item = PyList_GetItem(input, i);
+          if (!PySymbolicVariable_Check(item))
+            return PyErr_Format(PyExc_TypeError, "TritonContext::syncFuzzer(): Each element of input must be a SymbolicVariable.");
+          options.input.push_back(PySymbolicVariable_AsSymbolicVariable(item)->getId());
+        }
+
+        if (exits != nullptr) {
+          for (Py_ssize_t i = 0; i < PyList_Size(exits); i++) {
+            PyObject* item = PyList_GetItem(exits, i);
+            if (!PyLong_Check(item) && !PyInt_Check(item))
+              return PyErr_Format(PyExc_TypeError, "TritonContext::syncFuzzer(): Expects a list of integers as exits keyword.");
+            options.exits.insert(PyLong_AsUint64(item));
+          }
+        }
+
+        if (maxInstructions != nullptr)
+          options.maxInstructions = PyLong_AsUsize(maxInstructions);
+
+        if (newEdgesOnly != nullptr)
+          options.newEdgesOnly = PyLong_AsBool(newEdgesOnly);
+
+        if (parallel != nullptr)
+          options.parallel = PyLong_AsBool(parallel);
+
+        if (timeout != nullptr)
+          options.timeout = PyLong_AsUint32(timeout);
+
+        if (unsatCores != nullptr)
+          options.unsatCores = PyLong_AsBool(unsatCores);
+
+        if (timeLimit != nullptr)
+          options.timeLimit = PyLong_AsUint64(timeLimit);
+
+        if (interval != nullptr)
+          options.interval = PyLong_AsUint32(interval);
+
+        try {
+          auto result = PyTritonContext_AsTritonContext(self)->syncFuzzer(PyLong_AsUint64(entry), options);
+
+          ret = xPyDict_New();
+          xPyDict_SetItemString(ret, "entries",      PyLong_FromUsize(result.entries));
+          xPyDict_SetItemString(ret, "flips",        PyLong_FromUsize(result.flips));
+          xPyDict_SetItemString(ret, "instructions", PyLong_FromUsize(result.instructions));
+          xPyDict_SetItemString(ret, "pruned",       PyLong_FromUsize(result.pruned));
+          xPyDict_SetItemString(ret, "runs",         PyLong_FromUsize(result.runs));
+          xPyDict_SetItemString(ret, "skipped",      PyLong_FromUsize(result.skipped));
+          xPyDict_SetItemString(ret, "solved",       PyLong_FromUsize(result.solved));
+          xPyDict_SetItemString(ret, "written",      PyLong_FromUsize(result.written));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* TritonContext_synthesize(PyObject* self, PyObject* args, PyObject* kwargs) {
         PyObject* node     = nullptr;
         PyObject* constant = nullptr;
         PyObject* subexpr  = nullptr;
         PyObject* opaque   = nullptr;
+        PyObject* parallel = nullptr;
 
         static char* keywords[] = {
           (char*)"node",
           (char*)"constant",
           (char*)"subexpr",
           (char*)"opaque",
+          (char*)"parallel",
           nullptr
         };
 
         /* Extract keywords */
-        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OOOO", keywords, &node, &constant, &subexpr, &opaque) == false) {
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OOOOO", keywords, &node, &constant, &subexpr, &opaque, &parallel) == false) {
           return PyErr_Format(PyExc_TypeError, "TritonContext::synthesize(): Invalid number of arguments");
         }
 
@@ -3121,6 +7297,9 @@ namespace triton {
         if (opaque != nullptr && !PyBool_Check(opaque))
           return PyErr_Format(PyExc_TypeError, "TritonContext::synthesize(): Expects a boolean as opaque argument.");
 
+        if (parallel != nullptr && !PyBool_Check(parallel))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::synthesize(): Expects a boolean as parallel argument.");
+
         if (constant == nullptr)
           constant = PyLong_FromUint32(true);
 
@@ -3130,8 +7309,20 @@ namespace triton {
         if (opaque == nullptr)
           opaque = PyLong_FromUint32(false);
 
+        if (parallel == nullptr)
+          parallel = PyLong_FromUint32(false);
+
         try {
-          auto result = PyTritonContext_AsTritonContext(self)->synthesize(PyAstNode_AsAstNode(node), PyLong_AsBool(constant), PyLong_AsBool(subexpr), PyLong_AsBool(opaque));
+          triton::engines::synthesis::SynthesisResult result;
+          auto ctx       = PyTritonContext_AsTritonContext(self);
+          auto cnode     = PyAstNode_AsAstNode(node);
+          bool cconstant = PyLong_AsBool(constant);
+          bool csubexpr  = PyLong_AsBool(subexpr);
+          bool copaque   = PyLong_AsBool(opaque);
+          bool cparallel = PyLong_AsBool(parallel);
+
+          PyAllowThreads([&]() { result = ctx->synthesize(cnode, cconstant, csubexpr, copaque, cparallel); });
+
           if (result.successful()) {
             return PyAstNode(result.getOutput());
           }
@@ -3195,15 +7386,30 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_taintMemory(PyObject* self, PyObject* mem) {
+      static PyObject* TritonContext_taintMemory(PyObject* self, PyObject* args) {
+        PyObject* mem   = nullptr;
+        PyObject* label = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "O|O", &mem, &label) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::taintMemory(): Invalid number of arguments");
+        }
+
+        if (label != nullptr && label != Py_None && !PyLong_Check(label) && !PyInt_Check(label))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::taintMemory(): Expects an integer as label.");
+
         try {
+          bool labeled = (label != nullptr && label != Py_None);
+
           if (PyMemoryAccess_Check(mem)) {
-            if (PyTritonContext_AsTritonContext(self)->taintMemory(*PyMemoryAccess_AsMemoryAccess(mem)) == true)
+            const triton::arch::MemoryAccess& access = *PyMemoryAccess_AsMemoryAccess(mem);
+            if ((labeled ? PyTritonContext_AsTritonContext(self)->taintMemory(access, PyLong_AsUint32(label)) : PyTritonContext_AsTritonContext(self)->taintMemory(access)) == true)
               Py_RETURN_TRUE;
           }
 
           else if (PyLong_Check(mem) || PyInt_Check(mem)) {
-            if (PyTritonContext_AsTritonContext(self)->taintMemory(PyLong_AsUint64(mem)) == true)
+            triton::uint64 addr = PyLong_AsUint64(mem);
+            if ((labeled ? PyTritonContext_AsTritonContext(self)->taintMemory(addr, PyLong_AsUint32(label)) : PyTritonContext_AsTritonContext(self)->taintMemory(addr)) == true)
               Py_RETURN_TRUE;
           }
 
@@ -3220,12 +7426,26 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_taintRegister(PyObject* self, PyObject* reg) {
+      static PyObject* TritonContext_taintRegister(PyObject* self, PyObject* args) {
+        PyObject* reg   = nullptr;
+        PyObject* label = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "O|O", &reg, &label) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::taintRegister(): Invalid number of arguments");
+        }
+
         if (!PyRegister_Check(reg))
           return PyErr_Format(PyExc_TypeError, "TritonContext::taintRegister(): Expects a Register as argument.");
 
+        if (label != nullptr && label != Py_None && !PyLong_Check(label) && !PyInt_Check(label))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::taintRegister(): Expects an integer as label.");
+
         try {
-          if (PyTritonContext_AsTritonContext(self)->taintRegister(*PyRegister_AsRegister(reg)) == true)
+          bool labeled = (label != nullptr && label != Py_None);
+          const triton::arch::Register& target = *PyRegister_AsRegister(reg);
+
+          if ((labeled ? PyTritonContext_AsTritonContext(self)->taintRegister(target, PyLong_AsUint32(label)) : PyTritonContext_AsTritonContext(self)->taintRegister(target)) == true)
             Py_RETURN_TRUE;
           Py_RETURN_FALSE;
         }
@@ -3327,6 +7547,19 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_getNumberOfSpilledPathConstraints(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getNumberOfSpilledPathConstraints());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* TritonContext_getParentRegister(PyObject* self, PyObject* reg) {
         if (!PyRegister_Check(reg))
           return PyErr_Format(PyExc_TypeError, "TritonContext::getParentRegister(): Expects a Register as argument.");
@@ -3352,9 +7585,9 @@ namespace triton {
             if (PyTritonContext_AsTritonContext(self)->getArchitecture() == triton::arch::ARCH_INVALID)
               return PyErr_Format(PyExc_TypeError, "__getattr__.registers: Architecture is not defined.");
 
-            /* Maybe null if TritonContext was created over the PyTritonContextRef function */
+            /* The registers are created on access */
             if (((TritonContext_Object*)(self))->regAttr == nullptr)
-              TritonContext_fillRegistersAttribute(self);
+              ((TritonContext_Object*)(self))->regAttr = PyNamespace(PyTritonContext_AsTritonContext(self));
 
             Py_INCREF(((TritonContext_Object*)(self))->regAttr);
             return ((TritonContext_Object*)(self))->regAttr;
@@ -3374,24 +7607,40 @@ namespace triton {
       //! TritonContext methods.
       PyMethodDef TritonContext_callbacks[] = {
         {"addCallback",                         (PyCFunction)TritonContext_addCallback,                                 METH_VARARGS,                  ""},
+        {"addSimplificationPass",               (PyCFunction)TritonContext_addSimplificationPass,                       METH_O,                        ""},
+        {"addSolverProfile",                    (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_addSolverProfile, METH_VARARGS | METH_KEYWORDS,  ""},
+        {"applyModel",                          (PyCFunction)TritonContext_applyModel,                                  METH_O,                        ""},
         {"assignSymbolicExpressionToMemory",    (PyCFunction)TritonContext_assignSymbolicExpressionToMemory,            METH_VARARGS,                  ""},
         {"assignSymbolicExpressionToRegister",  (PyCFunction)TritonContext_assignSymbolicExpressionToRegister,          METH_VARARGS,                  ""},
         {"buildSemantics",                      (PyCFunction)TritonContext_buildSemantics,                              METH_O,                        ""},
+        {"checkEquivalences",                   (PyCFunction)TritonContext_checkEquivalences,                           METH_O,                        ""},
         {"clearCallbacks",                      (PyCFunction)TritonContext_clearCallbacks,                              METH_NOARGS,                   ""},
         {"clearModes",                          (PyCFunction)TritonContext_clearModes,                                  METH_NOARGS,                   ""},
         {"clearConcreteMemoryValue",            (PyCFunction)TritonContext_clearConcreteMemoryValue,                    METH_VARARGS,                  ""},
+        {"clearCoverage",                       (PyCFunction)TritonContext_clearCoverage,                               METH_NOARGS,                   ""},
         {"clearPathConstraints",                (PyCFunction)TritonContext_clearPathConstraints,                        METH_NOARGS,                   ""},
+        {"clearSimplificationCache",            (PyCFunction)TritonContext_clearSimplificationCache,                    METH_NOARGS,                   ""},
+        {"clearSimplificationMemo",             (PyCFunction)TritonContext_clearSimplificationMemo,                     METH_NOARGS,                   ""},
+        {"clearSolverCache",                    (PyCFunction)TritonContext_clearSolverCache,                            METH_NOARGS,                   ""},
+        {"clearSolverStatistics",               (PyCFunction)TritonContext_clearSolverStatistics,                       METH_NOARGS,                   ""},
+        {"clearStatistics",                     (PyCFunction)TritonContext_clearStatistics,                             METH_NOARGS,                   ""},
+        {"clearSynthesisCache",                 (PyCFunction)TritonContext_clearSynthesisCache,                         METH_NOARGS,                   ""},
+        {"clearTrace",                          (PyCFunction)TritonContext_clearTrace,                                  METH_NOARGS,                   ""},
         {"concretizeAllMemory",                 (PyCFunction)TritonContext_concretizeAllMemory,                         METH_NOARGS,                   ""},
         {"concretizeAllRegister",               (PyCFunction)TritonContext_concretizeAllRegister,                       METH_NOARGS,                   ""},
         {"concretizeMemory",                    (PyCFunction)TritonContext_concretizeMemory,                            METH_O,                        ""},
+        {"concretizeMemoryArea",                (PyCFunction)TritonContext_concretizeMemoryArea,                        METH_VARARGS,                  ""},
         {"concretizeRegister",                  (PyCFunction)TritonContext_concretizeRegister,                          METH_O,                        ""},
         {"createSymbolicMemoryExpression",      (PyCFunction)TritonContext_createSymbolicMemoryExpression,              METH_VARARGS,                  ""},
         {"createSymbolicRegisterExpression",    (PyCFunction)TritonContext_createSymbolicRegisterExpression,            METH_VARARGS,                  ""},
         {"createSymbolicVolatileExpression",    (PyCFunction)TritonContext_createSymbolicVolatileExpression,            METH_VARARGS,                  ""},
         {"disassembly",                         (PyCFunction)TritonContext_disassembly,                                 METH_VARARGS,                  ""},
+        {"emulate",                             (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_emulate,    METH_VARARGS | METH_KEYWORDS,  ""},
         {"enableSymbolicEngine",                (PyCFunction)TritonContext_enableSymbolicEngine,                        METH_O,                        ""},
         {"enableTaintEngine",                   (PyCFunction)TritonContext_enableTaintEngine,                           METH_O,                        ""},
         {"evaluateAstViaSolver",                (PyCFunction)TritonContext_evaluateAstViaSolver,                        METH_O,                        ""},
+        {"explore",                             (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_explore,    METH_VARARGS | METH_KEYWORDS,  ""},
+        {"fork",                                (PyCFunction)TritonContext_fork,                                        METH_NOARGS,                   ""},
         {"getAllRegisters",                     (PyCFunction)TritonContext_getAllRegisters,                             METH_NOARGS,                   ""},
         {"getArchitecture",                     (PyCFunction)TritonContext_getArchitecture,                             METH_NOARGS,                   ""},
         {"getAstContext",                       (PyCFunction)TritonContext_getAstContext,                               METH_NOARGS,                   ""},
@@ -3400,21 +7649,55 @@ namespace triton {
         {"getConcreteMemoryValue",              (PyCFunction)TritonContext_getConcreteMemoryValue,                      METH_O,                        ""},
         {"getConcreteRegisterValue",            (PyCFunction)TritonContext_getConcreteRegisterValue,                    METH_O,                        ""},
         {"getConcreteVariableValue",            (PyCFunction)TritonContext_getConcreteVariableValue,                    METH_O,                        ""},
+        {"getCoverage",                         (PyCFunction)TritonContext_getCoverage,                                 METH_NOARGS,                   ""},
+        {"getExecutorThreads",                  (PyCFunction)TritonContext_getExecutorThreads,                          METH_NOARGS,                   ""},
+        {"getFlatPathPredicate",                (PyCFunction)TritonContext_getFlatPathPredicate,                        METH_NOARGS,                   ""},
+        {"getFunctionSummaries",                (PyCFunction)TritonContext_getFunctionSummaries,                        METH_NOARGS,                   ""},
         {"getGprBitSize",                       (PyCFunction)TritonContext_getGprBitSize,                               METH_NOARGS,                   ""},
         {"getGprSize",                          (PyCFunction)TritonContext_getGprSize,                                  METH_NOARGS,                   ""},
         {"getImmediateAst",                     (PyCFunction)TritonContext_getImmediateAst,                             METH_O,                        ""},
         {"getMemoryAst",                        (PyCFunction)TritonContext_getMemoryAst,                                METH_O,                        ""},
+        {"getMemoryTaintLabels",                (PyCFunction)TritonContext_getMemoryTaintLabels,                        METH_O,                        ""},
+        {"getMemoryUsage",                      (PyCFunction)TritonContext_getMemoryUsage,                              METH_NOARGS,                   ""},
         {"getModel",                            (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_getModel,    METH_VARARGS | METH_KEYWORDS,  ""},
+        {"getModelAsync",                       (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_getModelAsync, METH_VARARGS | METH_KEYWORDS,  ""},
         {"getModels",                           (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_getModels,   METH_VARARGS | METH_KEYWORDS,  ""},
+        {"getModelWithAssumptions",             (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_getModelWithAssumptions,  METH_VARARGS | METH_KEYWORDS,  ""},
+        {"getNumberOfSpilledPathConstraints",   (PyCFunction)TritonContext_getNumberOfSpilledPathConstraints,           METH_NOARGS,                   ""},
         {"getParentRegister",                   (PyCFunction)TritonContext_getParentRegister,                           METH_O,                        ""},
         {"getParentRegisters",                  (PyCFunction)TritonContext_getParentRegisters,                          METH_NOARGS,                   ""},
         {"getPathConstraints",                  (PyCFunction)TritonContext_getPathConstraints,                          METH_NOARGS,                   ""},
         {"getPathPredicate",                    (PyCFunction)TritonContext_getPathPredicate,                            METH_NOARGS,                   ""},
         {"getPathPredicateSize",                (PyCFunction)TritonContext_getPathPredicateSize,                        METH_NOARGS,                   ""},
+        {"getPointerPolicy",                    (PyCFunction)TritonContext_getPointerPolicy,                            METH_VARARGS,                  ""},
+        {"getPointerStatistics",                (PyCFunction)TritonContext_getPointerStatistics,                        METH_NOARGS,                   ""},
+        {"getPredicateToFlipIteration",         (PyCFunction)TritonContext_getPredicateToFlipIteration,                 METH_VARARGS,                  ""},
         {"getPredicatesToReachAddress",         (PyCFunction)TritonContext_getPredicatesToReachAddress,                 METH_O,                        ""},
+        {"getProfile",                          (PyCFunction)TritonContext_getProfile,                                  METH_O,                        ""},
         {"getRegister",                         (PyCFunction)TritonContext_getRegister,                                 METH_O,                        ""},
         {"getRegisterAst",                      (PyCFunction)TritonContext_getRegisterAst,                              METH_O,                        ""},
+        {"getRegisterTaintBits",                (PyCFunction)TritonContext_getRegisterTaintBits,                        METH_O,                        ""},
+        {"getRegisterTaintLabels",              (PyCFunction)TritonContext_getRegisterTaintLabels,                      METH_O,                        ""},
+        {"getRelevantPathPredicate",            (PyCFunction)TritonContext_getRelevantPathPredicate,                    METH_O,                        ""},
+        {"getSimplificationCacheSize",          (PyCFunction)TritonContext_getSimplificationCacheSize,                  METH_NOARGS,                   ""},
+        {"getSimplificationPasses",             (PyCFunction)TritonContext_getSimplificationPasses,                     METH_NOARGS,                   ""},
+        {"getSimplificationStatistics",         (PyCFunction)TritonContext_getSimplificationStatistics,                 METH_NOARGS,                   ""},
         {"getSolver",                           (PyCFunction)TritonContext_getSolver,                                   METH_NOARGS,                   ""},
+        {"getSolverAnalyticStatistics",         (PyCFunction)TritonContext_getSolverAnalyticStatistics,                 METH_NOARGS,                   ""},
+        {"getSolverBudgetStatistics",           (PyCFunction)TritonContext_getSolverBudgetStatistics,                   METH_NOARGS,                   ""},
+        {"getSolverCacheStatistics",            (PyCFunction)TritonContext_getSolverCacheStatistics,                    METH_NOARGS,                   ""},
+        {"getSolverLocalSearchStatistics",      (PyCFunction)TritonContext_getSolverLocalSearchStatistics,              METH_NOARGS,                   ""},
+        #if defined(TRITON_Z3_INTERFACE) || defined(TRITON_BITWUZLA_INTERFACE)
+        {"getSolverPortfolioWinner",            (PyCFunction)TritonContext_getSolverPortfolioWinner,                    METH_NOARGS,                   ""},
+        {"getSolverPortfolioWins",              (PyCFunction)TritonContext_getSolverPortfolioWins,                      METH_NOARGS,                   ""},
+        #endif
+        {"getSolverPreprocessingStatistics",    (PyCFunction)TritonContext_getSolverPreprocessingStatistics,            METH_NOARGS,                   ""},
+        {"getSolverProfileStatistics",          (PyCFunction)TritonContext_getSolverProfileStatistics,                  METH_NOARGS,                   ""},
+        {"getSolverStatistics",                 (PyCFunction)TritonContext_getSolverStatistics,                         METH_NOARGS,                   ""},
+        {"getSolverThreads",                    (PyCFunction)TritonContext_getSolverThreads,                            METH_NOARGS,                   ""},
+        {"getStatistics",                       (PyCFunction)TritonContext_getStatistics,                               METH_NOARGS,                   ""},
+        {"getSymbolicDepthLimit",               (PyCFunction)TritonContext_getSymbolicDepthLimit,                       METH_NOARGS,                   ""},
+        {"getSymbolicDepthPolicy",              (PyCFunction)TritonContext_getSymbolicDepthPolicy,                      METH_NOARGS,                   ""},
         {"getSymbolicExpression",               (PyCFunction)TritonContext_getSymbolicExpression,                       METH_O,                        ""},
         {"getSymbolicExpressions",              (PyCFunction)TritonContext_getSymbolicExpressions,                      METH_NOARGS,                   ""},
         {"getSymbolicMemory",                   (PyCFunction)TritonContext_getSymbolicMemory,                           METH_VARARGS,                  ""},
@@ -3424,56 +7707,129 @@ namespace triton {
         {"getSymbolicRegisters",                (PyCFunction)TritonContext_getSymbolicRegisters,                        METH_NOARGS,                   ""},
         {"getSymbolicVariable",                 (PyCFunction)TritonContext_getSymbolicVariable,                         METH_O,                        ""},
         {"getSymbolicVariables",                (PyCFunction)TritonContext_getSymbolicVariables,                        METH_NOARGS,                   ""},
+        {"getSynthesisCacheSize",               (PyCFunction)TritonContext_getSynthesisCacheSize,                       METH_NOARGS,                   ""},
+        {"getSyscallFile",                      (PyCFunction)TritonContext_getSyscallFile,                              METH_O,                        ""},
         {"getTaintedMemory",                    (PyCFunction)TritonContext_getTaintedMemory,                            METH_NOARGS,                   ""},
         {"getTaintedRegisters",                 (PyCFunction)TritonContext_getTaintedRegisters,                         METH_NOARGS,                   ""},
         {"getTaintedSymbolicExpressions",       (PyCFunction)TritonContext_getTaintedSymbolicExpressions,               METH_NOARGS,                   ""},
+        {"getThread",                           (PyCFunction)TritonContext_getThread,                                   METH_NOARGS,                   ""},
+        {"getThreads",                          (PyCFunction)TritonContext_getThreads,                                  METH_NOARGS,                   ""},
+        {"getUnsatCore",                        (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_getUnsatCore, METH_VARARGS | METH_KEYWORDS, ""},
         {"isArchitectureValid",                 (PyCFunction)TritonContext_isArchitectureValid,                         METH_NOARGS,                   ""},
         {"isConcreteMemoryValueDefined",        (PyCFunction)TritonContext_isConcreteMemoryValueDefined,                METH_VARARGS,                  ""},
+        {"isEquivalent",                        (PyCFunction)TritonContext_isEquivalent,                                METH_VARARGS,                  ""},
         {"isFlag",                              (PyCFunction)TritonContext_isFlag,                                      METH_O,                        ""},
         {"isMemorySymbolized",                  (PyCFunction)TritonContext_isMemorySymbolized,                          METH_O,                        ""},
         {"isMemoryTainted",                     (PyCFunction)TritonContext_isMemoryTainted,                             METH_O,                        ""},
         {"isModeEnabled",                       (PyCFunction)TritonContext_isModeEnabled,                               METH_O,                        ""},
+        {"isOpaquePredicate",                   (PyCFunction)TritonContext_isOpaquePredicate,                           METH_O,                        ""},
         {"isRegister",                          (PyCFunction)TritonContext_isRegister,                                  METH_O,                        ""},
         {"isRegisterSymbolized",                (PyCFunction)TritonContext_isRegisterSymbolized,                        METH_O,                        ""},
         {"isRegisterTainted",                   (PyCFunction)TritonContext_isRegisterTainted,                           METH_O,                        ""},
         {"isRegisterValid",                     (PyCFunction)TritonContext_isRegisterValid,                             METH_O,                        ""},
         {"isSat",                               (PyCFunction)TritonContext_isSat,                                       METH_O,                        ""},
+        {"isSatAsync",                          (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_isSatAsync,  METH_VARARGS | METH_KEYWORDS,  ""},
+        {"isSymbolicBudgetExceeded",            (PyCFunction)TritonContext_isSymbolicBudgetExceeded,                    METH_NOARGS,                   ""},
         {"isSymbolicEngineEnabled",             (PyCFunction)TritonContext_isSymbolicEngineEnabled,                     METH_NOARGS,                   ""},
         {"isSymbolicExpressionExists",          (PyCFunction)TritonContext_isSymbolicExpressionExists,                  METH_O,                        ""},
         {"isTaintEngineEnabled",                (PyCFunction)TritonContext_isTaintEngineEnabled,                        METH_NOARGS,                   ""},
         {"isThumb",                             (PyCFunction)TritonContext_isThumb,                                     METH_NOARGS,                   ""},
+        {"liftToC",                             (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_liftToC,      METH_VARARGS | METH_KEYWORDS,  ""},
         {"liftToLLVM",                          (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_liftToLLVM,  METH_VARARGS | METH_KEYWORDS,  ""},
-        {"liftToPython",                        (PyCFunction)TritonContext_liftToPython,                                METH_O,                        ""},
+        {"liftToPython",                        (PyCFunction)TritonContext_liftToPython,                                METH_VARARGS,                  ""},
         {"liftToSMT",                           (PyCFunction)TritonContext_liftToSMT,                                   METH_VARARGS,                  ""},
+        {"loadSnapshot",                        (PyCFunction)TritonContext_loadSnapshot,                                METH_O,                        ""},
+        {"loadSynthesisCache",                  (PyCFunction)TritonContext_loadSynthesisCache,                          METH_O,                        ""},
+        {"mapConcreteMemoryArea",               (PyCFunction)TritonContext_mapConcreteMemoryArea,                       METH_VARARGS,                  ""},
+        {"mapConcreteMemoryFile",               (PyCFunction)TritonContext_mapConcreteMemoryFile,                       METH_VARARGS,                  ""},
         {"newSymbolicExpression",               (PyCFunction)TritonContext_newSymbolicExpression,                       METH_VARARGS,                  ""},
         {"newSymbolicVariable",                 (PyCFunction)TritonContext_newSymbolicVariable,                         METH_VARARGS,                  ""},
         {"popPathConstraint",                   (PyCFunction)TritonContext_popPathConstraint,                           METH_NOARGS,                   ""},
+        {"popSolverScope",                      (PyCFunction)TritonContext_popSolverScope,                              METH_VARARGS,                  ""},
+        {"processBlock",                        (PyCFunction)TritonContext_processBlock,                                METH_O,                        ""},
+        {"processTrace",                        (PyCFunction)TritonContext_processTrace,                                METH_VARARGS,                  ""},
         {"processing",                          (PyCFunction)TritonContext_processing,                                  METH_O,                        ""},
         {"pushPathConstraint",                  (PyCFunction)TritonContext_pushPathConstraint,                          METH_O,                        ""},
+        {"pushSolverConstraint",                (PyCFunction)TritonContext_pushSolverConstraint,                        METH_O,                        ""},
+        {"pushSolverScope",                     (PyCFunction)TritonContext_pushSolverScope,                             METH_NOARGS,                   ""},
         {"removeCallback",                      (PyCFunction)TritonContext_removeCallback,                              METH_VARARGS,                  ""},
+        {"removeFunctionSummary",               (PyCFunction)TritonContext_removeFunctionSummary,                       METH_O,                        ""},
+        {"removeSimplificationPass",            (PyCFunction)TritonContext_removeSimplificationPass,                    METH_O,                        ""},
+        {"removeMark",                          (PyCFunction)TritonContext_removeMark,                                  METH_NOARGS,                   ""},
+        {"removeThread",                        (PyCFunction)TritonContext_removeThread,                                METH_O,                        ""},
         {"reset",                               (PyCFunction)TritonContext_reset,                                       METH_NOARGS,                   ""},
+        {"resetPointerStatistics",              (PyCFunction)TritonContext_resetPointerStatistics,                      METH_NOARGS,                   ""},
+        {"resetSolverBudget",                   (PyCFunction)TritonContext_resetSolverBudget,                           METH_NOARGS,                   ""},
+        {"resetSolverSession",                  (PyCFunction)TritonContext_resetSolverSession,                          METH_NOARGS,                   ""},
+        {"rollbackToMark",                      (PyCFunction)TritonContext_rollbackToMark,                              METH_NOARGS,                   ""},
+        {"saveSnapshot",                        (PyCFunction)TritonContext_saveSnapshot,                                METH_O,                        ""},
+        {"saveSynthesisCache",                  (PyCFunction)TritonContext_saveSynthesisCache,                          METH_O,                        ""},
+        {"saveTrace",                           (PyCFunction)TritonContext_saveTrace,                                   METH_O,                        ""},
         {"setArchitecture",                     (PyCFunction)TritonContext_setArchitecture,                             METH_O,                        ""},
         {"setAstRepresentationMode",            (PyCFunction)TritonContext_setAstRepresentationMode,                    METH_O,                        ""},
         {"setConcreteMemoryAreaValue",          (PyCFunction)TritonContext_setConcreteMemoryAreaValue,                  METH_VARARGS,                  ""},
         {"setConcreteMemoryValue",              (PyCFunction)TritonContext_setConcreteMemoryValue,                      METH_VARARGS,                  ""},
         {"setConcreteRegisterValue",            (PyCFunction)TritonContext_setConcreteRegisterValue,                    METH_VARARGS,                  ""},
         {"setConcreteVariableValue",            (PyCFunction)TritonContext_setConcreteVariableValue,                    METH_VARARGS,                  ""},
+        {"setCoverage",                         (PyCFunction)TritonContext_setCoverage,                                 METH_O,                        ""},
+        {"setExecutorThreads",                  (PyCFunction)TritonContext_setExecutorThreads,                          METH_O,                        ""},
+        {"setFlippableIterations",              (PyCFunction)TritonContext_setFlippableIterations,                      METH_O,                        ""},
+        {"setFunctionSummary",                  (PyCFunction)TritonContext_setFunctionSummary,                          METH_VARARGS,                  ""},
+        {"setMark",                             (PyCFunction)TritonContext_setMark,                                     METH_NOARGS,                   ""},
         {"setMode",                             (PyCFunction)TritonContext_setMode,                                     METH_VARARGS,                  ""},
+        {"setPathConstraintsSpilling",          (PyCFunction)TritonContext_setPathConstraintsSpilling,                  METH_VARARGS,                  ""},
+        {"setPointerPolicy",                    (PyCFunction)TritonContext_setPointerPolicy,                            METH_VARARGS,                  ""},
+        {"setPointerPolicyLimits",              (PyCFunction)TritonContext_setPointerPolicyLimits,                      METH_VARARGS,                  ""},
+        {"setRegisterTaintBits",                (PyCFunction)TritonContext_setRegisterTaintBits,                        METH_VARARGS,                  ""},
+        {"setSimplificationCacheCapacity",      (PyCFunction)TritonContext_setSimplificationCacheCapacity,              METH_O,                        ""},
+        {"setSimplificationIterations",         (PyCFunction)TritonContext_setSimplificationIterations,                 METH_O,                        ""},
         {"setSolver",                           (PyCFunction)TritonContext_setSolver,                                   METH_O,                        ""},
+        {"setSolverAdaptiveTimeouts",           (PyCFunction)TritonContext_setSolverAdaptiveTimeouts,                   METH_O,                        ""},
+        {"setSolverBudget",                     (PyCFunction)TritonContext_setSolverBudget,                             METH_VARARGS,                  ""},
+        {"setSolverCacheCapacity",              (PyCFunction)TritonContext_setSolverCacheCapacity,                      METH_O,                        ""},
+        {"setSolverCacheFile",                  (PyCFunction)TritonContext_setSolverCacheFile,                          METH_O,                        ""},
+        {"setSolverExternalCommand",            (PyCFunction)TritonContext_setSolverExternalCommand,                    METH_O,                        ""},
+        {"setSolverExternalPoolSize",           (PyCFunction)TritonContext_setSolverExternalPoolSize,                   METH_O,                        ""},
         {"setSolverMemoryLimit",                (PyCFunction)TritonContext_setSolverMemoryLimit,                        METH_O,                        ""},
+        {"setSolverAnalytic",                   (PyCFunction)TritonContext_setSolverAnalytic,                           METH_O,                        ""},
+        {"setSolverLocalSearchBudget",          (PyCFunction)TritonContext_setSolverLocalSearchBudget,                  METH_O,                        ""},
+        {"setSolverLocalSearchFallback",        (PyCFunction)TritonContext_setSolverLocalSearchFallback,                METH_O,                        ""},
+        #if defined(TRITON_Z3_INTERFACE) || defined(TRITON_BITWUZLA_INTERFACE)
+        {"setSolverPortfolio",                  (PyCFunction)TritonContext_setSolverPortfolio,                          METH_O,                        ""},
+        #endif
+        {"setSolverPreprocessing",              (PyCFunction)TritonContext_setSolverPreprocessing,                      METH_O,                        ""},
+        {"setSolverProfile",                    (PyCFunction)TritonContext_setSolverProfile,                            METH_O,                        ""},
+        {"setSolverProfileSelection",           (PyCFunction)TritonContext_setSolverProfileSelection,                   METH_O,                        ""},
+        {"setSolverRemoteEndpoints",            (PyCFunction)TritonContext_setSolverRemoteEndpoints,                    METH_O,                        ""},
+        {"setSolverSlowQueryDump",              (PyCFunction)TritonContext_setSolverSlowQueryDump,                      METH_VARARGS,                  ""},
+        {"setSolverStatistics",                 (PyCFunction)TritonContext_setSolverStatistics,                         METH_O,                        ""},
+        {"setSolverThreads",                    (PyCFunction)TritonContext_setSolverThreads,                            METH_O,                        ""},
         {"setSolverTimeout",                    (PyCFunction)TritonContext_setSolverTimeout,                            METH_O,                        ""},
+        {"setStatistics",                       (PyCFunction)TritonContext_setStatistics,                               METH_O,                        ""},
+        {"setSymbolicBudget",                   (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_setSymbolicBudget, METH_VARARGS | METH_KEYWORDS,  ""},
+        {"setSymbolicDepthLimit",               (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_setSymbolicDepthLimit, METH_VARARGS | METH_KEYWORDS,  ""},
+        {"setSyscallFile",                      (PyCFunction)TritonContext_setSyscallFile,                              METH_VARARGS,                  ""},
+        {"setSyscallLayout",                    (PyCFunction)TritonContext_setSyscallLayout,                            METH_VARARGS,                  ""},
         {"setTaintMemory",                      (PyCFunction)TritonContext_setTaintMemory,                              METH_VARARGS,                  ""},
         {"setTaintRegister",                    (PyCFunction)TritonContext_setTaintRegister,                            METH_VARARGS,                  ""},
+        {"setThread",                           (PyCFunction)TritonContext_setThread,                                   METH_O,                        ""},
         {"setThumb",                            (PyCFunction)TritonContext_setThumb,                                    METH_O,                        ""},
+        {"setTraceCapacity",                    (PyCFunction)TritonContext_setTraceCapacity,                            METH_O,                        ""},
+        {"setTracing",                          (PyCFunction)TritonContext_setTracing,                                  METH_O,                        ""},
+        {"shareDisassemblyCache",               (PyCFunction)TritonContext_shareDisassemblyCache,                       METH_O,                        ""},
         {"simplify",                            (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_simplify,    METH_VARARGS | METH_KEYWORDS,  ""},
         {"sliceExpressions",                    (PyCFunction)TritonContext_sliceExpressions,                            METH_O,                        ""},
+        {"sliceExpressionsMany",                (PyCFunction)TritonContext_sliceExpressionsMany,                        METH_O,                        ""},
+        {"solveAllBranchFlips",                 (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_solveAllBranchFlips, METH_VARARGS | METH_KEYWORDS,  ""},
         {"symbolizeExpression",                 (PyCFunction)TritonContext_symbolizeExpression,                         METH_VARARGS,                  ""},
         {"symbolizeMemory",                     (PyCFunction)TritonContext_symbolizeMemory,                             METH_VARARGS,                  ""},
+        {"symbolizeMemoryArea",                 (PyCFunction)TritonContext_symbolizeMemoryArea,                         METH_VARARGS,                  ""},
         {"symbolizeRegister",                   (PyCFunction)TritonContext_symbolizeRegister,                           METH_VARARGS,                  ""},
+        {"syncFuzzer",                          (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_syncFuzzer,  METH_VARARGS | METH_KEYWORDS,  ""},
         {"synthesize",                          (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_synthesize,  METH_VARARGS | METH_KEYWORDS,  ""},
         {"taintAssignment",                     (PyCFunction)TritonContext_taintAssignment,                             METH_VARARGS,                  ""},
-        {"taintMemory",                         (PyCFunction)TritonContext_taintMemory,                                 METH_O,                        ""},
-        {"taintRegister",                       (PyCFunction)TritonContext_taintRegister,                               METH_O,                        ""},
+        {"taintMemory",                         (PyCFunction)TritonContext_taintMemory,                                 METH_VARARGS,                  ""},
+        {"taintRegister",                       (PyCFunction)TritonContext_taintRegister,                               METH_VARARGS,                  ""},
         {"taintUnion",                          (PyCFunction)TritonContext_taintUnion,                                  METH_VARARGS,                  ""},
         {"untaintMemory",                       (PyCFunction)TritonContext_untaintMemory,                               METH_O,                        ""},
         {"untaintRegister",                     (PyCFunction)TritonContext_untaintRegister,                             METH_O,                        ""},
@@ -3572,6 +7928,22 @@ namespace triton {
       }
 
 
+      PyObject* PyTritonContext(triton::API* api) {
+        PyType_Ready(&TritonContext_Type);
+        TritonContext_Object* object = PyObject_NEW(TritonContext_Object, &TritonContext_Type);
+
+        if (object != nullptr) {
+          object->api = api;
+          object->ref = false;
+          object->regAttr = nullptr;
+        }
+        else
+          delete api;
+
+        return (PyObject*)object;
+      }
+
+
       PyObject* PyTritonContextRef(triton::API& api) {
         PyType_Ready(&TritonContext_Type);
         TritonContext_Object* object = PyObject_NEW(TritonContext_Object, &TritonContext_Type);
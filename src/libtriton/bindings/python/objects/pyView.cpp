@@ -0,0 +1,723 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <triton/pythonObjects.hpp>
+#include <triton/pythonUtils.hpp>
+#include <triton/pythonXFunctions.hpp>
+#include <triton/exceptions.hpp>
+
+#include <algorithm>
+#include <iostream>
+
+
+
+/*! \page py_MapView_page MapView
+    \brief [**python api**] All information about the MapView Python object.
+
+\tableofcontents
+
+\section py_MapView_description Description
+<hr>
+
+This object is a read-only mapping returned by `TritonContext.getSymbolicExpressions()`, `TritonContext.getSymbolicVariables()`
+and `TritonContext.sliceExpressions()`. It is a snapshot of the engine when it is returned and behaves as a dictionary sorted by
+key, except that the Python object of a value is only created when the value is accessed. On large traces, counting, looking up
+or iterating over the keys does not allocate a wrapper per element.
+
+~~~~~~~~~~~~~{.py}
+>>> from triton import TritonContext, ARCH, Instruction
+
+>>> ctxt = TritonContext(ARCH.X86_64)
+>>> ctxt.processing(Instruction(b"\x48\x31\xc0")) # xor rax, rax
+True
+
+>>> exprs = ctxt.getSymbolicExpressions()
+>>> len(exprs)
+7
+>>> 0 in exprs
+True
+>>> print(exprs[0])
+(define-fun ref!0 () (_ BitVec 64) (bvxor (_ bv0 64) (_ bv0 64))) ; XOR operation
+
+~~~~~~~~~~~~~
+
+\section MapView_py_api Python API - Methods of the MapView class
+<hr>
+
+- <b>object get(integer key, object default=None)</b><br>
+Returns the value of `key`, `default` if there is none.
+
+- <b>iterator items(void)</b><br>
+Returns an iterator over the (key, value) tuples.
+
+- <b>iterator keys(void)</b><br>
+Returns an iterator over the keys.
+
+- <b>iterator values(void)</b><br>
+Returns an iterator over the values.
+
+*/
+
+
+
+/*! \page py_ListView_page ListView
+    \brief [**python api**] All information about the ListView Python object.
+
+\tableofcontents
+
+\section py_ListView_description Description
+<hr>
+
+This object is a read-only sequence returned by `TritonContext.getPathConstraints()` and `TritonContext.getTaintedMemory()`
+(whose addresses are sorted). It is a snapshot of the engine when it is returned and behaves as a list, except that the Python
+object of an item is only created when the item is accessed. It supports `len()`, indexing (negative indexes and slices
+included, a slice being a list), iteration, `in` and the comparison with lists.
+
+~~~~~~~~~~~~~{.py}
+>>> from triton import TritonContext, ARCH, MemoryAccess, CPUSIZE
+
+>>> ctxt = TritonContext(ARCH.X86_64)
+>>> ctxt.taintMemory(MemoryAccess(0x1000, CPUSIZE.WORD))
+True
+>>> ctxt.getTaintedMemory() == [0x1000, 0x1001]
+True
+
+~~~~~~~~~~~~~
+
+*/
+
+
+
+namespace triton {
+  namespace bindings {
+    namespace python {
+
+      /* The items of a map, sorted by key */
+      template <typename V>
+      class MapViewOf : public View {
+        private:
+          //! The items.
+          std::vector<std::pair<triton::usize, V>> items;
+
+          //! Returns the Python object of a value.
+          PyObject* (*convert)(const V&);
+
+        public:
+          MapViewOf(const std::unordered_map<triton::usize, V>& items, PyObject* (*convert)(const V&))
+            : items(items.begin(), items.end()), convert(convert) {
+            std::sort(this->items.begin(), this->items.end(), [](const std::pair<triton::usize, V>& a, const std::pair<triton::usize, V>& b) {
+              return a.first < b.first;
+            });
+          }
+
+          triton::usize size(void) const {
+            return this->items.size();
+          }
+
+          PyObject* key(triton::usize index) const {
+            return PyLong_FromUsize(this->items[index].first);
+          }
+
+          PyObject* value(triton::usize index) const {
+            return this->convert(this->items[index].second);
+          }
+
+          bool find(PyObject* key, triton::usize& index) const {
+            if (!PyLong_Check(key) && !PyInt_Check(key))
+              return false;
+
+            PyObject* zero = PyLong_FromUint32(0);
+            int negative   = PyObject_RichCompareBool(key, zero, Py_LT);
+            Py_DECREF(zero);
+            if (negative != 0)
+              return false;
+
+            triton::usize id = 0;
+            try {
+              id = PyLong_AsUsize(key);
+            }
+            catch (const triton::exceptions::Exception&) {
+              return false;
+            }
+
+            auto it = std::lower_bound(this->items.begin(), this->items.end(), id, [](const std::pair<triton::usize, V>& item, triton::usize id) {
+              return item.first < id;
+            });
+
+            if (it == this->items.end() || it->first != id)
+              return false;
+
+            index = static_cast<triton::usize>(it - this->items.begin());
+            return true;
+          }
+      };
+
+
+      /* The items of a list, keyed by their index */
+      template <typename V>
+      class ListViewOf : public View {
+        private:
+          //! The items.
+          std::vector<V> items;
+
+          //! Returns the Python object of an item.
+          PyObject* (*convert)(const V&);
+
+        public:
+          ListViewOf(std::vector<V>&& items, PyObject* (*convert)(const V&))
+            : items(std::move(items)), convert(convert) {
+          }
+
+          triton::usize size(void) const {
+            return this->items.size();
+          }
+
+          PyObject* key(triton::usize index) const {
+            return PyLong_FromUsize(index);
+          }
+
+          PyObject* value(triton::usize index) const {
+            return this->convert(this->items[index]);
+          }
+
+          bool find(PyObject* key, triton::usize& index) const {
+            if (!PyLong_Check(key) && !PyInt_Check(key))
+              return false;
+
+            Py_ssize_t i = PyLong_AsSsize_t(key);
+            if (i == -1 && PyErr_Occurred()) {
+              PyErr_Clear();
+              return false;
+            }
+
+            /* Negative indexes start from the end */
+            if (i < 0)
+              i += static_cast<Py_ssize_t>(this->items.size());
+
+            if (i < 0 || static_cast<triton::usize>(i) >= this->items.size())
+              return false;
+
+            index = static_cast<triton::usize>(i);
+            return true;
+          }
+      };
+
+
+      /* Returns the Python object of an address */
+      static PyObject* PyAddress(const triton::uint64& addr) {
+        return PyLong_FromUint64(addr);
+      }
+
+
+      /* Returns a new view object */
+      static PyObject* PyView(PyTypeObject* type, View* view) {
+        View_Object* object;
+
+        PyType_Ready(type);
+        object = PyObject_NEW(View_Object, type);
+        if (object != NULL)
+          object->view = view;
+        else
+          delete view;
+
+        return (PyObject*)object;
+      }
+
+
+      /* Returns a new iterator over the keys (0), the values (1) or the items (2) of a view */
+      static PyObject* PyViewIterator(PyObject* view, triton::uint32 kind) {
+        ViewIterator_Object* object;
+
+        PyType_Ready(&ViewIterator_Type);
+        object = PyObject_NEW(ViewIterator_Object, &ViewIterator_Type);
+        if (object != NULL) {
+          Py_INCREF(view);
+          object->view  = view;
+          object->index = 0;
+          object->kind  = kind;
+        }
+
+        return (PyObject*)object;
+      }
+
+
+      /* Returns a dict (MapView) or a list (ListView) of all the items of a view */
+      static PyObject* View_materialize(PyObject* self) {
+        auto* view = PyView_AsView(self);
+
+        if (PyListView_Check(self)) {
+          PyObject* list = xPyList_New(view->size());
+          for (triton::usize index = 0; index < view->size(); index++)
+            PyList_SetItem(list, index, view->value(index));
+          return list;
+        }
+
+        PyObject* dict = xPyDict_New();
+        for (triton::usize index = 0; index < view->size(); index++)
+          xPyDict_SetItem(dict, view->key(index), view->value(index));
+        return dict;
+      }
+
+
+      //! View destructor.
+      void View_dealloc(PyObject* self) {
+        std::cout << std::flush;
+        delete PyView_AsView(self);
+        Py_TYPE(self)->tp_free((PyObject*)self);
+      }
+
+
+      static Py_ssize_t View_length(PyObject* self) {
+        return static_cast<Py_ssize_t>(PyView_AsView(self)->size());
+      }
+
+
+      static PyObject* View_repr(PyObject* self) {
+        PyObject* copy = View_materialize(self);
+        PyObject* repr = PyObject_Repr(copy);
+        Py_DECREF(copy);
+        return repr;
+      }
+
+
+      static PyObject* View_richcompare(PyObject* self, PyObject* other, int op) {
+        PyObject* result = nullptr;
+
+        if (op != Py_EQ && op != Py_NE) {
+          Py_INCREF(Py_NotImplemented);
+          return Py_NotImplemented;
+        }
+
+        /* The views are compared as the dict or the list they stand for */
+        PyObject* left  = View_materialize(self);
+        PyObject* right = (PyListView_Check(other) || PyMapView_Check(other)) ? View_materialize(other) : (Py_INCREF(other), other);
+
+        result = PyObject_RichCompare(left, right, op);
+        Py_DECREF(left);
+        Py_DECREF(right);
+
+        return result;
+      }
+
+
+      static int MapView_contains(PyObject* self, PyObject* key) {
+        triton::usize index = 0;
+        return PyView_AsView(self)->find(key, index) ? 1 : 0;
+      }
+
+
+      static PyObject* MapView_subscript(PyObject* self, PyObject* key) {
+        triton::usize index = 0;
+
+        if (!PyView_AsView(self)->find(key, index)) {
+          PyErr_SetObject(PyExc_KeyError, key);
+          return nullptr;
+        }
+
+        return PyView_AsView(self)->value(index);
+      }
+
+
+      static PyObject* MapView_iter(PyObject* self) {
+        return PyViewIterator(self, 0);
+      }
+
+
+      static PyObject* MapView_get(PyObject* self, PyObject* args) {
+        PyObject* key   = nullptr;
+        PyObject* other = Py_None;
+        triton::usize index = 0;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "O|O", &key, &other) == false) {
+          return PyErr_Format(PyExc_TypeError, "MapView::get(): Invalid number of arguments");
+        }
+
+        if (PyView_AsView(self)->find(key, index))
+          return PyView_AsView(self)->value(index);
+
+        Py_INCREF(other);
+        return other;
+      }
+
+
+      static PyObject* MapView_items(PyObject* self, PyObject* noarg) {
+        return PyViewIterator(self, 2);
+      }
+
+
+      static PyObject* MapView_keys(PyObject* self, PyObject* noarg) {
+        return PyViewIterator(self, 0);
+      }
+
+
+      static PyObject* MapView_values(PyObject* self, PyObject* noarg) {
+        return PyViewIterator(self, 1);
+      }
+
+
+      static PyObject* ListView_item(PyObject* self, Py_ssize_t i) {
+        auto* view = PyView_AsView(self);
+
+        if (i < 0 || static_cast<triton::usize>(i) >= view->size()) {
+          PyErr_SetString(PyExc_IndexError, "ListView index out of range");
+          return nullptr;
+        }
+
+        return view->value(static_cast<triton::usize>(i));
+      }
+
+
+      static PyObject* ListView_subscript(PyObject* self, PyObject* key) {
+        auto* view = PyView_AsView(self);
+        triton::usize index = 0;
+
+        if (PySlice_Check(key)) {
+          Py_ssize_t start = 0, stop = 0, step = 0, length = 0;
+
+          #if IS_PY3
+          if (PySlice_GetIndicesEx(key, view->size(), &start, &stop, &step, &length) != 0)
+          #else
+          if (PySlice_GetIndicesEx(reinterpret_cast<PySliceObject*>(key), view->size(), &start, &stop, &step, &length) != 0)
+          #endif
+            return nullptr;
+
+          PyObject* list = xPyList_New(length);
+          for (Py_ssize_t i = 0; i < length; i++)
+            PyList_SetItem(list, i, view->value(static_cast<triton::usize>(start + i * step)));
+          return list;
+        }
+
+        if (!PyLong_Check(key) && !PyInt_Check(key))
+          return PyErr_Format(PyExc_TypeError, "ListView indices must be integers or slices.");
+
+        if (!view->find(key, index)) {
+          PyErr_SetString(PyExc_IndexError, "ListView index out of range");
+          return nullptr;
+        }
+
+        return view->value(index);
+      }
+
+
+      static PyObject* ListView_iter(PyObject* self) {
+        return PyViewIterator(self, 1);
+      }
+
+
+      //! ViewIterator destructor.
+      void ViewIterator_dealloc(PyObject* self) {
+        Py_XDECREF(((ViewIterator_Object*)self)->view);
+        Py_TYPE(self)->tp_free((PyObject*)self);
+      }
+
+
+      static PyObject* ViewIterator_next(PyObject* self) {
+        auto* iterator = (ViewIterator_Object*)self;
+        auto* view     = PyView_AsView(iterator->view);
+
+        if (iterator->index >= view->size())
+          return nullptr;
+
+        triton::usize index = iterator->index++;
+
+        switch (iterator->kind) {
+          case 0:
+            return view->key(index);
+          case 1:
+            return view->value(index);
+          default: {
+            PyObject* item = xPyTuple_New(2);
+            PyTuple_SetItem(item, 0, view->key(index));
+            PyTuple_SetItem(item, 1, view->value(index));
+            return item;
+          }
+        }
+      }
+
+
+      //! MapView methods.
+      PyMethodDef MapView_callbacks[] = {
+        {"get",     MapView_get,      METH_VARARGS,     ""},
+        {"items",   MapView_items,    METH_NOARGS,      ""},
+        {"keys",    MapView_keys,     METH_NOARGS,      ""},
+        {"values",  MapView_values,   METH_NOARGS,      ""},
+        {nullptr,   nullptr,          0,                nullptr}
+      };
+
+
+      //! ListView methods.
+      PyMethodDef ListView_callbacks[] = {
+        {nullptr,   nullptr,          0,                nullptr}
+      };
+
+
+      PyMappingMethods MapView_MappingMethods = {
+        View_length,                                /* mp_length */
+        MapView_subscript,                          /* mp_subscript */
+        0,                                          /* mp_ass_subscript */
+      };
+
+
+      PySequenceMethods MapView_SequenceMethods = {
+        View_length,                                /* sq_length */
+        0,                                          /* sq_concat */
+        0,                                          /* sq_repeat */
+        0,                                          /* sq_item */
+        0,                                          /* sq_slice */
+        0,                                          /* sq_ass_item */
+        0,                                          /* sq_ass_slice */
+        MapView_contains,                           /* sq_contains */
+        0,                                          /* sq_inplace_concat */
+        0,                                          /* sq_inplace_repeat */
+      };
+
+
+      PyMappingMethods ListView_MappingMethods = {
+        View_length,                                /* mp_length */
+        ListView_subscript,                         /* mp_subscript */
+        0,                                          /* mp_ass_subscript */
+      };
+
+
+      PySequenceMethods ListView_SequenceMethods = {
+        View_length,                                /* sq_length */
+        0,                                          /* sq_concat */
+        0,                                          /* sq_repeat */
+        ListView_item,                              /* sq_item */
+        0,                                          /* sq_slice */
+        0,                                          /* sq_ass_item */
+        0,                                          /* sq_ass_slice */
+        0,                                          /* sq_contains */
+        0,                                          /* sq_inplace_concat */
+        0,                                          /* sq_inplace_repeat */
+      };
+
+
+      PyTypeObject MapView_Type = {
+        PyVarObject_HEAD_INIT(&PyType_Type, 0)
+        "MapView",                                  /* tp_name */
+        sizeof(View_Object),                        /* tp_basicsize */
+        0,                                          /* tp_itemsize */
+        (destructor)View_dealloc,                   /* tp_dealloc */
+        #if IS_PY3_8
+        0,                                          /* tp_vectorcall_offset */
+        #else
+        0,                                          /* tp_print */
+        #endif
+        0,                                          /* tp_getattr */
+        0,                                          /* tp_setattr */
+        0,                                          /* tp_compare */
+        (reprfunc)View_repr,                        /* tp_repr */
+        0,                                          /* tp_as_number */
+        &MapView_SequenceMethods,                   /* tp_as_sequence */
+        &MapView_MappingMethods,                    /* tp_as_mapping */
+        0,                                          /* tp_hash */
+        0,                                          /* tp_call */
+        0,                                          /* tp_str */
+        0,                                          /* tp_getattro */
+        0,                                          /* tp_setattro */
+        0,                                          /* tp_as_buffer */
+        Py_TPFLAGS_DEFAULT,                         /* tp_flags */
+        "MapView objects",                          /* tp_doc */
+        0,                                          /* tp_traverse */
+        0,                                          /* tp_clear */
+        (richcmpfunc)View_richcompare,              /* tp_richcompare */
+        0,                                          /* tp_weaklistoffset */
+        (getiterfunc)MapView_iter,                  /* tp_iter */
+        0,                                          /* tp_iternext */
+        MapView_callbacks,                          /* tp_methods */
+        0,                                          /* tp_members */
+        0,                                          /* tp_getset */
+        0,                                          /* tp_base */
+        0,                                          /* tp_dict */
+        0,                                          /* tp_descr_get */
+        0,                                          /* tp_descr_set */
+        0,                                          /* tp_dictoffset */
+        0,                                          /* tp_init */
+        0,                                          /* tp_alloc */
+        0,                                          /* tp_new */
+        0,                                          /* tp_free */
+        0,                                          /* tp_is_gc */
+        0,                                          /* tp_bases */
+        0,                                          /* tp_mro */
+        0,                                          /* tp_cache */
+        0,                                          /* tp_subclasses */
+        0,                                          /* tp_weaklist */
+        0,                                          /* tp_del */
+        #if IS_PY3
+          0,                                        /* tp_version_tag */
+          0,                                        /* tp_finalize */
+          #if IS_PY3_8
+            0,                                      /* tp_vectorcall */
+            #if !IS_PY3_9
+              0,                                    /* bpo-37250: kept for backwards compatibility in CPython 3.8 only */
+            #endif
+          #endif
+        #else
+          0                                         /* tp_version_tag */
+        #endif
+      };
+
+
+      PyTypeObject ListView_Type = {
+        PyVarObject_HEAD_INIT(&PyType_Type, 0)
+        "ListView",                                 /* tp_name */
+        sizeof(View_Object),                        /* tp_basicsize */
+        0,                                          /* tp_itemsize */
+        (destructor)View_dealloc,                   /* tp_dealloc */
+        #if IS_PY3_8
+        0,                                          /* tp_vectorcall_offset */
+        #else
+        0,                                          /* tp_print */
+        #endif
+        0,                                          /* tp_getattr */
+        0,                                          /* tp_setattr */
+        0,                                          /* tp_compare */
+        (reprfunc)View_repr,                        /* tp_repr */
+        0,                                          /* tp_as_number */
+        &ListView_SequenceMethods,                  /* tp_as_sequence */
+        &ListView_MappingMethods,                   /* tp_as_mapping */
+        0,                                          /* tp_hash */
+        0,                                          /* tp_call */
+        0,                                          /* tp_str */
+        0,                                          /* tp_getattro */
+        0,                                          /* tp_setattro */
+        0,                                          /* tp_as_buffer */
+        Py_TPFLAGS_DEFAULT,                         /* tp_flags */
+        "ListView objects",                         /* tp_doc */
+        0,                                          /* tp_traverse */
+        0,                                          /* tp_clear */
+        (richcmpfunc)View_richcompare,              /* tp_richcompare */
+        0,                                          /* tp_weaklistoffset */
+        (getiterfunc)ListView_iter,                 /* tp_iter */
+        0,                                          /* tp_iternext */
+        ListView_callbacks,                         /* tp_methods */
+        0,                                          /* tp_members */
+        0,                                          /* tp_getset */
+        0,                                          /* tp_base */
+        0,                                          /* tp_dict */
+        0,                                          /* tp_descr_get */
+        0,                                          /* tp_descr_set */
+        0,                                          /* tp_dictoffset */
+        0,                                          /* tp_init */
+        0,                                          /* tp_alloc */
+        0,                                          /* tp_new */
+        0,                                          /* tp_free */
+        0,                                          /* tp_is_gc */
+        0,                                          /* tp_bases */
+        0,                                          /* tp_mro */
+        0,                                          /* tp_cache */
+        0,                                          /* tp_subclasses */
+        0,                                          /* tp_weaklist */
+        0,                                          /* tp_del */
+        #if IS_PY3
+          0,                                        /* tp_version_tag */
+          0,                                        /* tp_finalize */
+          #if IS_PY3_8
+            0,                                      /* tp_vectorcall */
+            #if !IS_PY3_9
+              0,                                    /* bpo-37250: kept for backwards compatibility in CPython 3.8 only */
+            #endif
+          #endif
+        #else
+          0                                         /* tp_version_tag */
+        #endif
+      };
+
+
+      PyTypeObject ViewIterator_Type = {
+        PyVarObject_HEAD_INIT(&PyType_Type, 0)
+        "ViewIterator",                             /* tp_name */
+        sizeof(ViewIterator_Object),                /* tp_basicsize */
+        0,                                          /* tp_itemsize */
+        (destructor)ViewIterator_dealloc,           /* tp_dealloc */
+        #if IS_PY3_8
+        0,                                          /* tp_vectorcall_offset */
+        #else
+        0,                                          /* tp_print */
+        #endif
+        0,                                          /* tp_getattr */
+        0,                                          /* tp_setattr */
+        0,                                          /* tp_compare */
+        0,                                          /* tp_repr */
+        0,                                          /* tp_as_number */
+        0,                                          /* tp_as_sequence */
+        0,                                          /* tp_as_mapping */
+        0,                                          /* tp_hash */
+        0,                                          /* tp_call */
+        0,                                          /* tp_str */
+        0,                                          /* tp_getattro */
+        0,                                          /* tp_setattro */
+        0,                                          /* tp_as_buffer */
+        Py_TPFLAGS_DEFAULT,                         /* tp_flags */
+        "ViewIterator objects",                     /* tp_doc */
+        0,                                          /* tp_traverse */
+        0,                                          /* tp_clear */
+        0,                                          /* tp_richcompare */
+        0,                                          /* tp_weaklistoffset */
+        PyObject_SelfIter,                          /* tp_iter */
+        (iternextfunc)ViewIterator_next,            /* tp_iternext */
+        0,                                          /* tp_methods */
+        0,                                          /* tp_members */
+        0,                                          /* tp_getset */
+        0,                                          /* tp_base */
+        0,                                          /* tp_dict */
+        0,                                          /* tp_descr_get */
+        0,                                          /* tp_descr_set */
+        0,                                          /* tp_dictoffset */
+        0,                                          /* tp_init */
+        0,                                          /* tp_alloc */
+        0,                                          /* tp_new */
+        0,                                          /* tp_free */
+        0,                                          /* tp_is_gc */
+        0,                                          /* tp_bases */
+        0,                                          /* tp_mro */
+        0,                                          /* tp_cache */
+        0,                                          /* tp_subclasses */
+        0,                                          /* tp_weaklist */
+        0,                                          /* tp_del */
+        #if IS_PY3
+          0,                                        /* tp_version_tag */
+          0,                                        /* tp_finalize */
+          #if IS_PY3_8
+            0,                                      /* tp_vectorcall */
+            #if !IS_PY3_9
+              0,                                    /* bpo-37250: kept for backwards compatibility in CPython 3.8 only */
+            #endif
+          #endif
+        #else
+          0                                         /* tp_version_tag */
+        #endif
+      };
+
+
+      PyObject* PyListView(const std::vector<triton::engines::symbolic::PathConstraint>& items) {
+        std::vector<triton::engines::symbolic::PathConstraint> copy(items);
+        return PyView(&ListView_Type, new ListViewOf<triton::engines::symbolic::PathConstraint>(std::move(copy), PyPathConstraint));
+      }
+
+
+      PyObject* PyListView(const std::unordered_set<triton::uint64>& items) {
+        std::vector<triton::uint64> addresses(items.begin(), items.end());
+        std::sort(addresses.begin(), addresses.end());
+        return PyView(&ListView_Type, new ListViewOf<triton::uint64>(std::move(addresses), PyAddress));
+      }
+
+
+      PyObject* PyMapView(const std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicExpression>& items) {
+        return PyView(&MapView_Type, new MapViewOf<triton::engines::symbolic::SharedSymbolicExpression>(items, PySymbolicExpression));
+      }
+
+
+      PyObject* PyMapView(const std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicVariable>& items) {
+        return PyView(&MapView_Type, new MapViewOf<triton::engines::symbolic::SharedSymbolicVariable>(items, PySymbolicVariable));
+      }
+
+    }; /* python namespace */
+  }; /* bindings namespace */
+}; /* triton namespace */
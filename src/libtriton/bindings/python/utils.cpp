@@ -12,6 +12,7 @@
 #include <triton/tritonTypes.hpp>
 
 #include <limits>
+#include <string>
 
 
 
@@ -19,6 +20,64 @@ namespace triton {
   namespace bindings {
     namespace python {
 
+      /* Returns a triton::uint{128,256,512} from a pyObject, the negative values are wrapped as in two's complement */
+      template <typename T>
+      static T PyLong_AsWideUint(PyObject* vv, const char* name) {
+        const triton::usize size = std::numeric_limits<T>::digits / 8;
+        unsigned char bytes[size];
+        int overflow = 0;
+
+        if (vv == NULL || !PyLong_Check(vv)) {
+          if (vv != NULL && PyInt_Check(vv)) {
+            return PyInt_AsLong(vv);
+          }
+          throw triton::exceptions::Bindings(std::string("triton::bindings::python::") + name + "(): Bad internal call.");
+        }
+
+        /* Most of the values fit in 64 bits */
+        long long small = PyLong_AsLongLongAndOverflow(vv, &overflow);
+        if (overflow == 0) {
+          if (small < 0)
+            return ~T(static_cast<triton::uint64>(~small));
+          return T(static_cast<triton::uint64>(small));
+        }
+
+        /* The others are copied at once */
+        #if PY_VERSION_HEX >= 0x030D0000
+        if (_PyLong_AsByteArray(reinterpret_cast<PyLongObject*>(vv), bytes, size, 1 /* little endian */, overflow < 0 /* signed */, 1 /* exceptions */) != 0) {
+        #else
+        if (_PyLong_AsByteArray(reinterpret_cast<PyLongObject*>(vv), bytes, size, 1 /* little endian */, overflow < 0 /* signed */) != 0) {
+        #endif
+          PyErr_Clear();
+          throw triton::exceptions::Bindings(std::string("triton::bindings::python::") + name + "(): long int too large to convert.");
+        }
+
+        T x = 0;
+        boost::multiprecision::import_bits(x, bytes, bytes + size, 8, false /* least significant first */);
+        return x;
+      }
+
+
+      /* Returns a PyObject from a triton::uint{128,256,512} */
+      template <typename T>
+      static PyObject* PyLong_FromWideUint(const T& value) {
+        const triton::usize size = std::numeric_limits<T>::digits / 8;
+        unsigned char bytes[size] = {0};
+
+        // it is mandatory to let Python deal with small numbers (static objects)
+        if (value <= std::numeric_limits<long>::max())
+          return PyInt_FromLong(value.template convert_to<long>());
+
+        /* Most of the values fit in 64 bits */
+        if (value <= std::numeric_limits<triton::uint64>::max())
+          return PyLong_FromUnsignedLongLong(value.template convert_to<triton::uint64>());
+
+        /* The others are copied at once */
+        boost::multiprecision::export_bits(value, bytes, 8, false /* least significant first */);
+        return _PyLong_FromByteArray(bytes, size, 1 /* little endian */, 0 /* unsigned */);
+      }
+
+
       bool PyLong_AsBool(PyObject* obj) {
         return (PyObject_IsTrue(obj) != 0);
       }
@@ -141,89 +200,17 @@ namespace triton {
 
 
       triton::uint128 PyLong_AsUint128(PyObject* vv) {
-        triton::uint128 x = 0, prev = 0;
-        PyLongObject* v = nullptr;
-        Py_ssize_t i = 0;
-        bool n = false;
-
-        if (vv == NULL || !PyLong_Check(vv)) {
-          if (vv != NULL && PyInt_Check(vv)) {
-            return PyInt_AsLong(vv);
-          }
-          throw triton::exceptions::Bindings("triton::bindings::python::PyLong_AsUint128(): Bad internal call.");
-        }
-
-        v = reinterpret_cast<PyLongObject*>(vv);
-        n = (Py_SIZE(v) < 0);
-        i = n ? -Py_SIZE(v) : Py_SIZE(v);
-        x = 0;
-
-        while (--i >= 0) {
-          prev = x;
-          x = (x << PyLong_SHIFT) | v->ob_digit[i];
-          if ((x >> PyLong_SHIFT) != prev)
-            throw triton::exceptions::Bindings("triton::bindings::python::PyLong_AsUint128(): long int too large to convert.");
-        }
-
-        return (n ? ((~x)+1) : x);
+        return PyLong_AsWideUint<triton::uint128>(vv, "PyLong_AsUint128");
       }
 
 
       triton::uint256 PyLong_AsUint256(PyObject* vv) {
-        triton::uint256 x = 0, prev = 0;
-        PyLongObject* v = nullptr;
-        Py_ssize_t i = 0;
-        bool n = false;
-
-        if (vv == NULL || !PyLong_Check(vv)) {
-          if (vv != NULL && PyInt_Check(vv)) {
-            return PyInt_AsLong(vv);
-          }
-          throw triton::exceptions::Bindings("triton::bindings::python::PyLong_AsUint256(): Bad internal call.");
-        }
-
-        v = reinterpret_cast<PyLongObject*>(vv);
-        n = (Py_SIZE(v) < 0);
-        i = n ? -Py_SIZE(v) : Py_SIZE(v);
-        x = 0;
-
-        while (--i >= 0) {
-          prev = x;
-          x = (x << PyLong_SHIFT) | v->ob_digit[i];
-          if ((x >> PyLong_SHIFT) != prev)
-            throw triton::exceptions::Bindings("triton::bindings::python::PyLong_AsUint256(): long int too large to convert.");
-        }
-
-        return (n ? ((~x)+1) : x);
+        return PyLong_AsWideUint<triton::uint256>(vv, "PyLong_AsUint256");
       }
 
 
       triton::uint512 PyLong_AsUint512(PyObject* vv) {
-        triton::uint512 x = 0, prev = 0;
-        PyLongObject* v = nullptr;
-        Py_ssize_t i = 0;
-        bool n = false;
-
-        if (vv == NULL || !PyLong_Check(vv)) {
-          if (vv != NULL && PyInt_Check(vv)) {
-            return PyInt_AsLong(vv);
-          }
-          throw triton::exceptions::Bindings("triton::bindings::python::PyLong_AsUint512(): Bad internal call.");
-        }
-
-        v = reinterpret_cast<PyLongObject*>(vv);
-        n = (Py_SIZE(v) < 0);
-        i = n ? -Py_SIZE(v) : Py_SIZE(v);
-        x = 0;
-
-        while (--i >= 0) {
-          prev = x;
-          x = (x << PyLong_SHIFT) | v->ob_digit[i];
-          if ((x >> PyLong_SHIFT) != prev)
-            throw triton::exceptions::Bindings("triton::bindings::python::PyLong_AsUint512(): long int too large to convert.");
-        }
-
-        return (n ? ((~x)+1) : x);
+        return PyLong_AsWideUint<triton::uint512>(vv, "PyLong_AsUint512");
       }
 
 
@@ -232,30 +219,11 @@ namespace triton {
         #if defined(__i386) || defined(_M_IX86)
         return PyInt_FromLong(static_cast<long>(value));
         #else
-        PyLongObject* v;
-        triton::__uint t;
-        int ndigits = 0;
-
         // it is mandatory to let Python deal with small numbers (static objects)
         if (value <= std::numeric_limits<long>::max())
           return PyInt_FromLong(static_cast<long>(value));
 
-        /* Count the number of Python digits. */
-        t = value;
-        while (t) {
-          ++ndigits;
-          t >>= PyLong_SHIFT;
-        }
-
-        v = _PyLong_New(ndigits);
-        digit* p = v->ob_digit;
-        Py_SIZE(v) = ndigits;
-        while (value) {
-          *p++ = static_cast<digit>(value & PyLong_MASK);
-          value >>= PyLong_SHIFT;
-        }
-
-        return (PyObject*)v;
+        return PyLong_FromUnsignedLongLong(value);
         #endif
       }
 
@@ -265,30 +233,11 @@ namespace triton {
         #if defined(__i386) || defined(_M_IX86)
         return PyInt_FromLong(static_cast<long>(value));
         #else
-        PyLongObject* v;
-        triton::usize t;
-        int ndigits = 0;
-
         // it is mandatory to let Python deal with small numbers (static objects)
         if (value <= std::numeric_limits<long>::max())
           return PyInt_FromLong(static_cast<long>(value));
 
-        /* Count the number of Python digits. */
-        t = value;
-        while (t) {
-          ++ndigits;
-          t >>= PyLong_SHIFT;
-        }
-
-        v = _PyLong_New(ndigits);
-        digit* p = v->ob_digit;
-        Py_SIZE(v) = ndigits;
-        while (value) {
-          *p++ = static_cast<digit>(value & PyLong_MASK);
-          value >>= PyLong_SHIFT;
-        }
-
-        return (PyObject*)v;
+        return PyLong_FromUnsignedLongLong(value);
         #endif
       }
 
@@ -301,117 +250,29 @@ namespace triton {
 
       /* Returns a PyObject from a 64-bits integer */
       PyObject* PyLong_FromUint64(triton::uint64 value) {
-        PyLongObject* v;
-        triton::uint64 t;
-        int ndigits = 0;
-
         // it is mandatory to let Python deal with small numbers (static objects)
         if (value <= std::numeric_limits<long>::max())
           return PyInt_FromLong(static_cast<long>(value));
 
-        /* Count the number of Python digits. */
-        t = value;
-        while (t) {
-          ++ndigits;
-          t >>= PyLong_SHIFT;
-        }
-
-        v = _PyLong_New(ndigits);
-        digit* p = v->ob_digit;
-        Py_SIZE(v) = ndigits;
-        while (value) {
-          *p++ = static_cast<digit>(value & PyLong_MASK);
-          value >>= PyLong_SHIFT;
-        }
-
-        return (PyObject*)v;
+        return PyLong_FromUnsignedLongLong(value);
       }
 
 
       /* Returns a PyObject from a 128-bits integer */
       PyObject* PyLong_FromUint128(triton::uint128 value) {
-        PyLongObject* v;
-        triton::uint128 t;
-        int ndigits = 0;
-
-        // it is mandatory to let Python deal with small numbers (static objects)
-        if (value <= std::numeric_limits<long>::max())
-          return PyInt_FromLong(value.convert_to<long>());
-
-        /* Count the number of Python digits. */
-        t = value;
-        while (t) {
-          ++ndigits;
-          t >>= PyLong_SHIFT;
-        }
-
-        v = _PyLong_New(ndigits);
-        digit* p = v->ob_digit;
-        Py_SIZE(v) = ndigits;
-        while (value) {
-          *p++ = (value & PyLong_MASK).convert_to<digit>();
-          value >>= PyLong_SHIFT;
-        }
-
-        return (PyObject*)v;
+        return PyLong_FromWideUint(value);
       }
 
 
       /* Returns a PyObject from a 256-bits integer */
       PyObject* PyLong_FromUint256(triton::uint256 value) {
-        PyLongObject* v;
-        triton::uint256 t;
-        int ndigits = 0;
-
-        // it is mandatory to let Python deal with small numbers (static objects)
-        if (value <= std::numeric_limits<long>::max())
-          return PyInt_FromLong(value.convert_to<long>());
-
-        /* Count the number of Python digits. */
-        t = value;
-        while (t) {
-          ++ndigits;
-          t >>= PyLong_SHIFT;
-        }
-
-        v = _PyLong_New(ndigits);
-        digit* p = v->ob_digit;
-        Py_SIZE(v) = ndigits;
-        while (value) {
-          *p++ = (value & PyLong_MASK).convert_to<digit>();
-          value >>= PyLong_SHIFT;
-        }
-
-        return (PyObject*)v;
+        return PyLong_FromWideUint(value);
       }
 
 
       /* Returns a PyObject from a 512-bits integer */
       PyObject* PyLong_FromUint512(triton::uint512 value) {
-        PyLongObject* v;
-        triton::uint512 t = 0;
-        int ndigits = 0;
-
-        // it is mandatory to let Python deal with small numbers (static objects)
-        if (value <= std::numeric_limits<long>::max())
-          return PyInt_FromLong(value.convert_to<long>());
-
-        /* Count the number of Python digits. */
-        t = value;
-        while (t) {
-          ++ndigits;
-          t >>= PyLong_SHIFT;
-        }
-
-        v = _PyLong_New(ndigits);
-        digit* p = v->ob_digit;
-        Py_SIZE(v) = ndigits;
-        while (value) {
-          *p++ = (value & PyLong_MASK).convert_to<digit>();
-          value >>= PyLong_SHIFT;
-        }
-
-        return (PyObject*)v;
+        return PyLong_FromWideUint(value);
       }
 
     }; /* python namespace */
@@ -5,6 +5,8 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <algorithm>
+
 #include <triton/api.hpp>
 #include <triton/callbacks.hpp>
 #include <triton/exceptions.hpp>
@@ -15,24 +17,52 @@ namespace triton {
   namespace callbacks {
 
     Callbacks::Callbacks(triton::API& api) : api(api) {
-      this->defined   = false;
-      this->mget      = false;
-      this->mload     = false;
-      this->mput      = false;
-      this->mstore    = false;
+      this->kinds      = 0;
+      this->mget       = false;
+      this->mload      = false;
+      this->mloadarea  = false;
+      this->mpage      = false;
+      this->mput       = false;
+      this->mstore     = false;
+      this->mstorearea = false;
+
+      this->simplificationVersion = 0;
+    }
+
+
+    void Callbacks::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, triton::uint64 baseAddr, triton::usize size)> cb) {
+      switch (kind) {
+        case triton::callbacks::GET_CONCRETE_MEMORY_AREA_VALUE:
+          this->getConcreteMemoryAreaValueCallbacks.push_back(cb);
+          break;
+
+        case triton::callbacks::GET_UNDEFINED_MEMORY_PAGE:
+          this->getUndefinedMemoryPageCallbacks.push_back(cb);
+          break;
+
+        default:
+          return;
+      }
+      this->kinds |= (1 << kind);
     }
 
 
     void Callbacks::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&)> cb) {
+      this->addCallback(kind, cb, triton::callbacks::memoryRanges());
+    }
+
+
+    void Callbacks::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&)> cb, const triton::callbacks::memoryRanges& ranges) {
       switch (kind) {
         case triton::callbacks::GET_CONCRETE_MEMORY_VALUE:
+          this->getConcreteMemoryValueRanges.push_back(Callbacks::normalizeRanges(ranges));
           this->getConcreteMemoryValueCallbacks.push_back(cb);
           break;
 
         default:
           return;
       }
-      this->defined = true;
+      this->kinds |= (1 << kind);
     }
 
 
@@ -45,20 +75,39 @@ namespace triton {
         default:
           return;
       }
-      this->defined = true;
+      this->kinds |= (1 << kind);
+    }
+
+
+    void Callbacks::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, triton::uint64 baseAddr, const std::vector<triton::uint8>& values)> cb) {
+      switch (kind) {
+        case triton::callbacks::SET_CONCRETE_MEMORY_AREA_VALUE:
+          this->setConcreteMemoryAreaValueCallbacks.push_back(cb);
+          break;
+
+        default:
+          return;
+      }
+      this->kinds |= (1 << kind);
     }
 
 
     void Callbacks::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&, const triton::uint512& value)> cb) {
+      this->addCallback(kind, cb, triton::callbacks::memoryRanges());
+    }
+
+
+    void Callbacks::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&, const triton::uint512& value)> cb, const triton::callbacks::memoryRanges& ranges) {
       switch (kind) {
         case triton::callbacks::SET_CONCRETE_MEMORY_VALUE:
+          this->setConcreteMemoryValueRanges.push_back(Callbacks::normalizeRanges(ranges));
           this->setConcreteMemoryValueCallbacks.push_back(cb);
           break;
 
         default:
           return;
       }
-      this->defined = true;
+      this->kinds |= (1 << kind);
     }
 
 
@@ -71,7 +120,7 @@ namespace triton {
         default:
           return;
       }
-      this->defined = true;
+      this->kinds |= (1 << kind);
     }
 
 
@@ -79,49 +128,102 @@ namespace triton {
       switch (kind) {
         case triton::callbacks::SYMBOLIC_SIMPLIFICATION:
           this->symbolicSimplificationCallbacks.push_back(cb);
+          this->simplificationVersion++;
           break;
 
         default:
           return;
       }
-      this->defined = true;
+      this->kinds |= (1 << kind);
     }
 
 
     void Callbacks::clearCallbacks(void) {
+      this->getConcreteMemoryAreaValueCallbacks.clear();
       this->getConcreteMemoryValueCallbacks.clear();
       this->getConcreteRegisterValueCallbacks.clear();
+      this->getUndefinedMemoryPageCallbacks.clear();
+      this->setConcreteMemoryAreaValueCallbacks.clear();
       this->setConcreteMemoryValueCallbacks.clear();
       this->setConcreteRegisterValueCallbacks.clear();
       this->symbolicSimplificationCallbacks.clear();
-      this->defined = false;
+      this->getConcreteMemoryValueRanges.clear();
+      this->setConcreteMemoryValueRanges.clear();
+      this->simplificationVersion++;
+      this->kinds = 0;
     }
 
 
     template <typename T>
-    void Callbacks::removeSingleCallback(std::list<T>& container, T cb) {
+    triton::usize Callbacks::removeSingleCallback(triton::callbacks::callback_e kind, std::vector<T>& container, T cb) {
       for (auto it = container.begin(); it != container.end(); ++it) {
         if (cb == *it) {
+          triton::usize index = it - container.begin();
           container.erase(it);
-          return;
+          if (container.empty())
+            this->kinds &= ~(1 << kind);
+          return index;
         }
       }
       throw triton::exceptions::Exception("Unable to find callback for removal");
     }
 
 
-    void Callbacks::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&)> cb) {
+    triton::callbacks::memoryRanges Callbacks::normalizeRanges(const triton::callbacks::memoryRanges& ranges) {
+      triton::callbacks::memoryRanges sorted = ranges;
+      triton::callbacks::memoryRanges merged;
+
+      std::sort(sorted.begin(), sorted.end());
+      for (const auto& range : sorted) {
+        if (range.first >= range.second)
+          throw triton::exceptions::Callbacks("Callbacks::addCallback(): A range must be [start, end) with start < end.");
+        if (!merged.empty() && range.first <= merged.back().second)
+          merged.back().second = std::max(merged.back().second, range.second);
+        else
+          merged.push_back(range);
+      }
+
+      return merged;
+    }
+
+
+    bool Callbacks::overlaps(const triton::callbacks::memoryRanges& ranges, triton::uint64 addr, triton::uint32 size) {
+      if (ranges.empty())
+        return true;
+
+      /* The ranges are disjoint, their ends are sorted too: the first one ending after addr is the only candidate */
+      auto it = std::upper_bound(ranges.begin(), ranges.end(), addr, [](triton::uint64 a, const std::pair<triton::uint64, triton::uint64>& r) {
+        return a < r.second;
+      });
+
+      return it != ranges.end() && (it->first <= addr || it->first - addr < size);
+    }
+
+
+    void Callbacks::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, triton::uint64 baseAddr, triton::usize size)> cb) {
       switch (kind) {
-        case triton::callbacks::GET_CONCRETE_MEMORY_VALUE:
-          this->removeSingleCallback(this->getConcreteMemoryValueCallbacks, cb);
+        case triton::callbacks::GET_CONCRETE_MEMORY_AREA_VALUE:
+          this->removeSingleCallback(kind, this->getConcreteMemoryAreaValueCallbacks, cb);
+          break;
+
+        case triton::callbacks::GET_UNDEFINED_MEMORY_PAGE:
+          this->removeSingleCallback(kind, this->getUndefinedMemoryPageCallbacks, cb);
           break;
 
         default:
           throw triton::exceptions::Exception("Incorrect callback kind for removal");
       }
+    }
+
 
-      if (this->countCallbacks() == 0) {
-        this->defined = false;
+    void Callbacks::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&)> cb) {
+      switch (kind) {
+        case triton::callbacks::GET_CONCRETE_MEMORY_VALUE:
+          this->getConcreteMemoryValueRanges.erase(this->getConcreteMemoryValueRanges.begin() + this->removeSingleCallback(kind, this->getConcreteMemoryValueCallbacks, cb));
+          break;
+
+        default:
+          throw triton::exceptions::Exception("Incorrect callback kind for removal");
       }
     }
 
@@ -129,15 +231,23 @@ namespace triton {
     void Callbacks::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::Register&)> cb) {
       switch (kind) {
         case triton::callbacks::GET_CONCRETE_REGISTER_VALUE:
-          this->removeSingleCallback(this->getConcreteRegisterValueCallbacks, cb);
+          this->removeSingleCallback(kind, this->getConcreteRegisterValueCallbacks, cb);
           break;
 
         default:
           throw triton::exceptions::Exception("Incorrect callback kind for removal");
       }
+    }
+
 
-      if (this->countCallbacks() == 0) {
-        this->defined = false;
+    void Callbacks::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, triton::uint64 baseAddr, const std::vector<triton::uint8>& values)> cb) {
+      switch (kind) {
+        case triton::callbacks::SET_CONCRETE_MEMORY_AREA_VALUE:
+          this->removeSingleCallback(kind, this->setConcreteMemoryAreaValueCallbacks, cb);
+          break;
+
+        default:
+          throw triton::exceptions::Exception("Incorrect callback kind for removal");
       }
     }
 
@@ -145,55 +255,48 @@ namespace triton {
     void Callbacks::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&, const triton::uint512& value)> cb) {
       switch (kind) {
         case triton::callbacks::SET_CONCRETE_MEMORY_VALUE:
-          this->removeSingleCallback(this->setConcreteMemoryValueCallbacks, cb);
+          this->setConcreteMemoryValueRanges.erase(this->setConcreteMemoryValueRanges.begin() + this->removeSingleCallback(kind, this->setConcreteMemoryValueCallbacks, cb));
           break;
 
         default:
           throw triton::exceptions::Exception("Incorrect callback kind for removal");
       }
-
-      if (this->countCallbacks() == 0) {
-        this->defined = false;
-      }
     }
 
 
     void Callbacks::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::Register&, const triton::uint512& value)> cb) {
       switch (kind) {
         case triton::callbacks::SET_CONCRETE_REGISTER_VALUE:
-          this->removeSingleCallback(this->setConcreteRegisterValueCallbacks, cb);
+          this->removeSingleCallback(kind, this->setConcreteRegisterValueCallbacks, cb);
           break;
 
         default:
           throw triton::exceptions::Exception("Incorrect callback kind for removal");
       }
-
-      if (this->countCallbacks() == 0) {
-        this->defined = false;
-      }
     }
 
 
     void Callbacks::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<triton::ast::SharedAbstractNode(triton::API&, const triton::ast::SharedAbstractNode&)> cb) {
       switch (kind) {
         case triton::callbacks::SYMBOLIC_SIMPLIFICATION:
-          this->removeSingleCallback(this->symbolicSimplificationCallbacks, cb);
+          this->removeSingleCallback(kind, this->symbolicSimplificationCallbacks, cb);
+          this->simplificationVersion++;
           break;
 
         default:
           throw triton::exceptions::Exception("Incorrect callback kind for removal");
       }
-
-      if (this->countCallbacks() == 0) {
-        this->defined = false;
-      }
     }
 
 
     triton::ast::SharedAbstractNode Callbacks::processCallbacks(triton::callbacks::callback_e kind, triton::ast::SharedAbstractNode node) {
+      triton::arch::PhaseTimer timer(this->api.getStatistics(), triton::arch::PHASE_CALLBACKS);
+
       switch (kind) {
         case triton::callbacks::SYMBOLIC_SIMPLIFICATION: {
-          for (auto& function: this->symbolicSimplificationCallbacks) {
+          for (triton::usize index = 0; index < this->symbolicSimplificationCallbacks.size(); index++) {
+            /* A copy, the callback may add callbacks */
+            const auto function = this->symbolicSimplificationCallbacks[index];
             // Reinject node in next callback
             node = function(this->api, node);
             if (node == nullptr)
@@ -209,14 +312,24 @@ namespace triton {
 
 
     void Callbacks::processCallbacks(triton::callbacks::callback_e kind, const triton::arch::MemoryAccess& mem) {
+      triton::arch::PhaseTimer timer(this->api.getStatistics(), triton::arch::PHASE_CALLBACKS);
+
       switch (kind) {
         case triton::callbacks::GET_CONCRETE_MEMORY_VALUE: {
+          /* The undefined pages of the access are loaded first */
+          this->processUndefinedPages(mem.getAddress(), mem.getSize());
+
           /* Check if we are already in the callback to avoid infinite recursion */
           if (this->mload) {
             break;
           }
 
-          for (auto& function: this->getConcreteMemoryValueCallbacks) {
+          for (triton::usize index = 0; index < this->getConcreteMemoryValueCallbacks.size(); index++) {
+            /* Only the callbacks whose ranges overlap the access are called */
+            if (!Callbacks::overlaps(this->getConcreteMemoryValueRanges[index], mem.getAddress(), mem.getSize()))
+              continue;
+            /* A copy, the callback may add callbacks */
+            const auto function = this->getConcreteMemoryValueCallbacks[index];
             this->mload = true;
             function(this->api, mem);
             if (mem.getLeaAst() != nullptr) {
@@ -235,6 +348,8 @@ namespace triton {
 
 
     void Callbacks::processCallbacks(triton::callbacks::callback_e kind, const triton::arch::Register& reg) {
+      triton::arch::PhaseTimer timer(this->api.getStatistics(), triton::arch::PHASE_CALLBACKS);
+
       switch (kind) {
         case triton::callbacks::GET_CONCRETE_REGISTER_VALUE: {
           /* Check if we are already in the callback to avoid infinite recursion */
@@ -242,7 +357,9 @@ namespace triton {
             break;
           }
 
-          for (auto& function: this->getConcreteRegisterValueCallbacks) {
+          for (triton::usize index = 0; index < this->getConcreteRegisterValueCallbacks.size(); index++) {
+            /* A copy, the callback may add callbacks */
+            const auto function = this->getConcreteRegisterValueCallbacks[index];
             this->mget = true;
             function(this->api, reg);
             this->mget = false;
@@ -258,6 +375,8 @@ namespace triton {
 
 
     void Callbacks::processCallbacks(triton::callbacks::callback_e kind, const triton::arch::MemoryAccess& mem, const triton::uint512& value) {
+      triton::arch::PhaseTimer timer(this->api.getStatistics(), triton::arch::PHASE_CALLBACKS);
+
       switch (kind) {
         case triton::callbacks::SET_CONCRETE_MEMORY_VALUE: {
           /* Check if we are already in the callback to avoid infinite recursion */
@@ -265,7 +384,12 @@ namespace triton {
             break;
           }
 
-          for (auto& function: this->setConcreteMemoryValueCallbacks) {
+          for (triton::usize index = 0; index < this->setConcreteMemoryValueCallbacks.size(); index++) {
+            /* Only the callbacks whose ranges overlap the access are called */
+            if (!Callbacks::overlaps(this->setConcreteMemoryValueRanges[index], mem.getAddress(), mem.getSize()))
+              continue;
+            /* A copy, the callback may add callbacks */
+            const auto function = this->setConcreteMemoryValueCallbacks[index];
             this->mstore = true;
             function(this->api, mem, value);
             this->mstore = false;
@@ -281,6 +405,8 @@ namespace triton {
 
 
     void Callbacks::processCallbacks(triton::callbacks::callback_e kind, const triton::arch::Register& reg, const triton::uint512& value) {
+      triton::arch::PhaseTimer timer(this->api.getStatistics(), triton::arch::PHASE_CALLBACKS);
+
       switch (kind) {
         case triton::callbacks::SET_CONCRETE_REGISTER_VALUE: {
           /* Check if we are already in the callback to avoid infinite recursion */
@@ -288,7 +414,9 @@ namespace triton {
             break;
           }
 
-          for (auto& function: this->setConcreteRegisterValueCallbacks) {
+          for (triton::usize index = 0; index < this->setConcreteRegisterValueCallbacks.size(); index++) {
+            /* A copy, the callback may add callbacks */
+            const auto function = this->setConcreteRegisterValueCallbacks[index];
             this->mput = true;
             function(this->api, reg, value);
             this->mput = false;
@@ -303,35 +431,93 @@ namespace triton {
     }
 
 
-    triton::usize Callbacks::countCallbacks(void) const {
-      triton::usize count = 0;
+    void Callbacks::processCallbacks(triton::callbacks::callback_e kind, triton::uint64 baseAddr, triton::usize size) {
+      triton::arch::PhaseTimer timer(this->api.getStatistics(), triton::arch::PHASE_CALLBACKS);
+
+      switch (kind) {
+        case triton::callbacks::GET_CONCRETE_MEMORY_AREA_VALUE: {
+          /* Check if we are already in the callback to avoid infinite recursion */
+          if (!this->mloadarea) {
+            for (triton::usize index = 0; index < this->getConcreteMemoryAreaValueCallbacks.size(); index++) {
+              /* A copy, the callback may add callbacks */
+              const auto function = this->getConcreteMemoryAreaValueCallbacks[index];
+              this->mloadarea = true;
+              function(this->api, baseAddr, size);
+              this->mloadarea = false;
+            }
+          }
+
+          /* The pages still undefined are loaded by their own callbacks */
+          this->processUndefinedPages(baseAddr, size);
+          break;
+        }
 
-      count += this->getConcreteMemoryValueCallbacks.size();
-      count += this->getConcreteRegisterValueCallbacks.size();
-      count += this->setConcreteMemoryValueCallbacks.size();
-      count += this->setConcreteRegisterValueCallbacks.size();
-      count += this->symbolicSimplificationCallbacks.size();
+        case triton::callbacks::GET_UNDEFINED_MEMORY_PAGE:
+          this->processUndefinedPages(baseAddr, size);
+          break;
 
-      return count;
+        default:
+          throw triton::exceptions::Callbacks("Callbacks::processCallbacks(): Invalid kind of callback for this C++ polymorphism.");
+      };
     }
 
 
-    bool Callbacks::isDefined(triton::callbacks::callback_e kind) const {
+    void Callbacks::processCallbacks(triton::callbacks::callback_e kind, triton::uint64 baseAddr, const triton::uint8* area, triton::usize size) {
+      triton::arch::PhaseTimer timer(this->api.getStatistics(), triton::arch::PHASE_CALLBACKS);
+
       switch (kind) {
-        case GET_CONCRETE_MEMORY_VALUE:   return !this->getConcreteMemoryValueCallbacks.empty();
-        case GET_CONCRETE_REGISTER_VALUE: return !this->getConcreteRegisterValueCallbacks.empty();
-        case SET_CONCRETE_MEMORY_VALUE:   return !this->setConcreteMemoryValueCallbacks.empty();
-        case SET_CONCRETE_REGISTER_VALUE: return !this->setConcreteRegisterValueCallbacks.empty();
-        case SYMBOLIC_SIMPLIFICATION:     return !this->symbolicSimplificationCallbacks.empty();
-        default: {
-          return false;
+        case triton::callbacks::SET_CONCRETE_MEMORY_AREA_VALUE: {
+          /* Check if we are already in the callback to avoid infinite recursion */
+          if (this->mstorearea || this->setConcreteMemoryAreaValueCallbacks.empty()) {
+            break;
+          }
+
+          const std::vector<triton::uint8> values(area, area + size);
+          for (triton::usize index = 0; index < this->setConcreteMemoryAreaValueCallbacks.size(); index++) {
+            /* A copy, the callback may add callbacks */
+            const auto function = this->setConcreteMemoryAreaValueCallbacks[index];
+            this->mstorearea = true;
+            function(this->api, baseAddr, values);
+            this->mstorearea = false;
+          }
+
+          break;
         }
-      }
+
+        default:
+          throw triton::exceptions::Callbacks("Callbacks::processCallbacks(): Invalid kind of callback for this C++ polymorphism.");
+      };
     }
 
 
-    bool Callbacks::isDefined(void) const {
-      return this->defined;
+    void Callbacks::processUndefinedPages(triton::uint64 baseAddr, triton::usize size) {
+      const triton::uint64 pageSize = triton::arch::ConcreteMemory::pageSize;
+
+      /* Check if we are already in the callback to avoid infinite recursion */
+      if (this->mpage || this->getUndefinedMemoryPageCallbacks.empty() || size == 0) {
+        return;
+      }
+
+      const triton::arch::ConcreteMemory& memory = this->api.getConcreteMemory();
+      triton::uint64 page = baseAddr & ~(pageSize - 1);
+      triton::uint64 last = (baseAddr + size - 1) & ~(pageSize - 1);
+
+      while (true) {
+        /* A page is reported only if none of its bytes is defined */
+        if (!memory.isPageDefined(page)) {
+          for (triton::usize index = 0; index < this->getUndefinedMemoryPageCallbacks.size(); index++) {
+            /* A copy, the callback may add callbacks */
+            const auto function = this->getUndefinedMemoryPageCallbacks[index];
+            this->mpage = true;
+            function(this->api, page, pageSize);
+            this->mpage = false;
+          }
+        }
+
+        if (page == last)
+          break;
+        page += pageSize;
+      }
     }
 
   }; /* callbacks namespace */
@@ -0,0 +1,220 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <chrono>
+#include <memory>
+
+#include <triton/api.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/explorationEngine.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace exploration {
+
+      ExplorationEngine::ExplorationEngine(triton::API* ctx, const ExplorationOptions& options) {
+        if (ctx == nullptr)
+          throw triton::exceptions::ExplorationEngine("ExplorationEngine::ExplorationEngine(): The context cannot be null.");
+
+        if (options.maxInstructions == 0)
+          throw triton::exceptions::ExplorationEngine("ExplorationEngine::ExplorationEngine(): The max number of instructions must be positive.");
+
+        this->ctx     = ctx;
+        this->options = options;
+      }
+
+
+      bool ExplorationEngine::cover(triton::uint64 src, triton::uint64 dst, ExplorationResult& result) {
+        /* The hits by hash of the edge, as the coverage of the processing records them */
+        triton::uint8& hits = result.bitmap[triton::arch::Coverage::getEdgeIndex(src, dst)];
+
+        if (hits < 0xff)
+          hits++;
+
+        return result.edges.insert({src, dst}).second;
+      }
+
+
+      std::vector<triton::engines::symbolic::PathConstraint> ExplorationEngine::execute(const Seed& seed, triton::uint64 entry, ExplorationResult& result, triton::usize& score) {
+        std::unique_ptr<triton::API> state(this->ctx->fork());
+        triton::usize count = 0;
+        triton::uint64 pc = entry;
+
+        for (const auto& item : seed.input)
+          state->setConcreteVariableValue(state->getSymbolicVariable(item.first), item.second);
+
+        score = 0;
+        while (count < this->options.maxInstructions && this->options.exits.find(pc) == this->options.exits.end()) {
+          std::vector<triton::arch::Instruction> block;
+          triton::uint64 next = pc;
+
+          /* An instruction which cannot be decoded ends the run */
+          try {
+            block = state->processBlock(pc, &next);
+          }
+          catch (const triton::exceptions::Exception&) {
+            break;
+          }
+
+          count += block.size();
+
+          /* The block stopped at an undefined or unsupported instruction */
+          if (block.empty() || !block.back().isControlFlow())
+            break;
+
+          if (ExplorationEngine::cover(block.back().getAddress(), next, result))
+            score++;
+
+          pc = next;
+        }
+
+        result.runs++;
+        result.instructions += count;
+
+        return state->getPathConstraints();
+      }
+
+
+      ExplorationResult ExplorationEngine::explore(triton::uint64 entry) {
+        auto start = std::chrono::steady_clock::now();
+        std::unique_ptr<ExplorationStrategy> builtin;
+        std::set<std::map<triton::usize, triton::uint512>> tried;
+        std::vector<triton::engines::symbolic::PathConstraint> trace;
+        std::vector<std::vector<triton::uint128>> cores;
+        ExplorationStrategy* strategy = this->options.customStrategy;
+        ExplorationResult result;
+        Seed first;
+
+        if (strategy == nullptr) {
+          switch (this->options.strategy) {
+            case COVERAGE_GUIDED: builtin.reset(new CoverageGuidedStrategy()); break;
+            case DEPTH_FIRST:     builtin.reset(new DepthFirstStrategy());     break;
+            case GENERATIONAL:    builtin.reset(new GenerationalStrategy());   break;
+            default:
+              throw triton::exceptions::ExplorationEngine("ExplorationEngine::explore(): Invalid strategy.");
+          }
+          strategy = builtin.get();
+        }
+
+        /* The forks share the values of the variables, the ones of the context are restored once done */
+        for (const auto& item : this->ctx->getSymbolicVariables())
+          first.input[item.first] = this->ctx->getConcreteVariableValue(item.second);
+
+        auto restore = [&]() {
+          for (const auto& item : first.input)
+            this->ctx->getAstContext()->updateVariable(item.first, item.second);
+        };
+
+        auto isExhausted = [&]() {
+          if (this->options.maxRuns && result.runs >= this->options.maxRuns)
+            return true;
+          if (this->options.timeLimit) {
+            auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+            return static_cast<triton::uint64>(elapsed) >= this->options.timeLimit;
+          }
+          return false;
+        };
+
+        result.bitmap.resize(BITMAP_SIZE, 0);
+
+        try {
+          /* The trace of the last run, the seed picked next is often the one just executed */
+          std::map<triton::usize, triton::uint512> last = first.input;
+          trace = this->execute(first, entry, result, first.score);
+          tried.insert(first.input);
+          result.corpus.push_back(first);
+          strategy->push(first);
+
+          while (!strategy->empty() && !isExhausted()) {
+            Seed parent = strategy->pop();
+            triton::usize score = 0;
+
+            if (this->options.maxGenerations && parent.generation >= this->options.maxGenerations)
+              continue;
+
+            /* The worklist holds the inputs, their trace is executed again */
+            if (parent.input != last) {
+              trace = this->execute(parent, entry, result, score);
+              last  = parent.input;
+            }
+
+            triton::engines::solver::BranchFlipOptions flipOptions;
+            flipOptions.parallel = this->options.parallel;
+            flipOptions.start    = parent.bound;
+            flipOptions.timeout  = this->options.timeout;
+            if (strategy->isCoverageGuided())
+              flipOptions.covered = result.edges;
+
+            flipOptions.unsatCores = this->options.unsatCores;
+            if (this->options.unsatCores)
+              flipOptions.cores = cores;
+
+            auto flips = this->ctx->solveBranchFlips(trace, flipOptions);
+            result.flips += flips.size();
+
+            /* The cores of this run prune the flips of the next ones */
+            for (const auto& flip : flips) {
+              if (flip.pruned)
+                result.pruned++;
+              if (flip.core.empty())
+                continue;
+              std::vector<triton::uint128> hashes;
+              for (const auto& node : flip.core)
+                hashes.push_back(node->getHash());
+              cores.push_back(std::move(hashes));
+            }
+
+            for (const auto& flip : flips) {
+              if (flip.status != triton::engines::solver::SAT)
+                continue;
+
+              result.solved++;
+              if (isExhausted())
+                break;
+
+              /* The variables created by the run are not inputs of the context */
+              Seed child;
+              child.input = parent.input;
+              for (const auto& item : flip.model) {
+                auto it = child.input.find(item.first);
+                if (it != child.input.end())
+                  it->second = item.second.getValue();
+              }
+
+              if (!tried.insert(child.input).second)
+                continue;
+
+              child.bound      = strategy->getBound(parent, flip.index);
+              child.generation = parent.generation + 1;
+              child.srcAddr    = flip.srcAddr;
+              child.dstAddr    = flip.dstAddr;
+
+              trace = this->execute(child, entry, result, child.score);
+              last  = child.input;
+
+              if (child.score)
+                result.corpus.push_back(child);
+
+              strategy->push(child);
+            }
+          }
+        }
+        catch (...) {
+          restore();
+          throw;
+        }
+
+        restore();
+
+        return result;
+      }
+
+    };
+  };
+};
@@ -0,0 +1,106 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+
+#include <triton/exceptions.hpp>
+#include <triton/explorationStrategy.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace exploration {
+
+      GenerationalStrategy::GenerationalStrategy() {
+        this->pushed = 0;
+      }
+
+
+      bool GenerationalStrategy::isWorse(const Entry& a, const Entry& b) {
+        if (a.seed.score != b.seed.score)
+          return a.seed.score < b.seed.score;
+        return a.order > b.order;
+      }
+
+
+      void GenerationalStrategy::push(const Seed& seed) {
+        this->heap.push_back({seed, this->pushed++});
+        std::push_heap(this->heap.begin(), this->heap.end(), GenerationalStrategy::isWorse);
+      }
+
+
+      Seed GenerationalStrategy::pop(void) {
+        if (this->heap.empty())
+          throw triton::exceptions::ExplorationEngine("GenerationalStrategy::pop(): The worklist is empty.");
+
+        std::pop_heap(this->heap.begin(), this->heap.end(), GenerationalStrategy::isWorse);
+        Seed seed = std::move(this->heap.back().seed);
+        this->heap.pop_back();
+
+        return seed;
+      }
+
+
+      bool GenerationalStrategy::empty(void) const {
+        return this->heap.empty();
+      }
+
+
+      triton::usize GenerationalStrategy::getBound(const Seed& /*parent*/, triton::usize index) const {
+        return index + 1;
+      }
+
+
+      bool GenerationalStrategy::isCoverageGuided(void) const {
+        return false;
+      }
+
+
+      triton::usize CoverageGuidedStrategy::getBound(const Seed& /*parent*/, triton::usize /*index*/) const {
+        return 0;
+      }
+
+
+      bool CoverageGuidedStrategy::isCoverageGuided(void) const {
+        return true;
+      }
+
+
+      void DepthFirstStrategy::push(const Seed& seed) {
+        this->stack.push_back(seed);
+      }
+
+
+      Seed DepthFirstStrategy::pop(void) {
+        if (this->stack.empty())
+          throw triton::exceptions::ExplorationEngine("DepthFirstStrategy::pop(): The worklist is empty.");
+
+        Seed seed = std::move(this->stack.back());
+        this->stack.pop_back();
+
+        return seed;
+      }
+
+
+      bool DepthFirstStrategy::empty(void) const {
+        return this->stack.empty();
+      }
+
+
+      triton::usize DepthFirstStrategy::getBound(const Seed& /*parent*/, triton::usize index) const {
+        return index + 1;
+      }
+
+
+      bool DepthFirstStrategy::isCoverageGuided(void) const {
+        return false;
+      }
+
+    };
+  };
+};
@@ -0,0 +1,424 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <thread>
+
+#include <triton/api.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/fuzzerBridge.hpp>
+
+#if defined(_WIN32)
+  #include <windows.h>
+#else
+  #include <dirent.h>
+  #include <sys/stat.h>
+#endif
+
+
+
+namespace triton {
+  namespace engines {
+    namespace exploration {
+
+      /* The buckets of the hits of an edge, as AFL classifies them */
+      static triton::uint8 getBucket(triton::uint8 hits) {
+        if (hits <= 2)   return hits;
+        if (hits == 3)   return 4;
+        if (hits <= 7)   return 8;
+        if (hits <= 15)  return 16;
+        if (hits <= 31)  return 32;
+        if (hits <= 127) return 64;
+        return 128;
+      }
+
+
+      static std::string join(const std::string& dir, const std::string& name) {
+        return dir + "/" + name;
+      }
+
+
+      static std::string getName(std::string path) {
+        while (path.size() > 1 && (path.back() == '/' || path.back() == '\\'))
+          path.pop_back();
+
+        auto pos = path.find_last_of("/\\");
+        return (pos == std::string::npos) ? path : path.substr(pos + 1);
+      }
+
+
+      static void makeDirectory(const std::string& path) {
+        #if defined(_WIN32)
+          if (!CreateDirectoryA(path.c_str(), nullptr) && GetLastError() != ERROR_ALREADY_EXISTS)
+            throw triton::exceptions::ExplorationEngine("FuzzerBridge::FuzzerBridge(): Cannot create " + path + ".");
+        #else
+          struct stat info;
+          if (mkdir(path.c_str(), 0700) != 0 && (stat(path.c_str(), &info) != 0 || !S_ISDIR(info.st_mode)))
+            throw triton::exceptions::ExplorationEngine("FuzzerBridge::FuzzerBridge(): Cannot create " + path + ".");
+        #endif
+      }
+
+
+      /* The testcases `id:NNNNNN,...` of a queue, by id. A missing queue is empty, the fuzzer may not have started yet */
+      static std::map<triton::uint32, std::string> listQueue(const std::string& queue) {
+        std::map<triton::uint32, std::string> entries;
+        std::vector<std::string> names;
+
+        #if defined(_WIN32)
+          WIN32_FIND_DATAA data;
+          HANDLE find = FindFirstFileA(join(queue, "id:*").c_str(), &data);
+          if (find != INVALID_HANDLE_VALUE) {
+            do {
+              if (!(data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
+                names.push_back(data.cFileName);
+            } while (FindNextFileA(find, &data));
+            FindClose(find);
+          }
+        #else
+          DIR* dir = opendir(queue.c_str());
+          if (dir != nullptr) {
+            while (struct dirent* entry = readdir(dir))
+              names.push_back(entry->d_name);
+            closedir(dir);
+          }
+        #endif
+
+        for (const auto& name : names) {
+          char* end = nullptr;
+          if (name.compare(0, 3, "id:") != 0 || name.size() < 4 || !std::isdigit(static_cast<unsigned char>(name[3])))
+            continue;
+          entries[static_cast<triton::uint32>(std::strtoul(name.c_str() + 3, &end, 10))] = name;
+        }
+
+        return entries;
+      }
+
+
+      static bool readFile(const std::string& path, std::vector<triton::uint8>& data) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+          return false;
+        data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        return true;
+      }
+
+
+      /* Written under a hidden name then renamed, so that the fuzzer never reads a partial file */
+      static void writeFile(const std::string& dir, const std::string& name, const triton::uint8* data, triton::usize size) {
+        std::string tmp  = join(dir, "." + name + ".tmp");
+        std::string path = join(dir, name);
+
+        {
+          std::ofstream file(tmp, std::ios::binary | std::ios::trunc);
+          if (!file || !file.write(reinterpret_cast<const char*>(data), size))
+            throw triton::exceptions::ExplorationEngine("FuzzerBridge::sync(): Cannot write " + tmp + ".");
+        }
+
+        #if defined(_WIN32)
+          std::remove(path.c_str());
+        #endif
+
+        if (std::rename(tmp.c_str(), path.c_str()) != 0)
+          throw triton::exceptions::ExplorationEngine("FuzzerBridge::sync(): Cannot write " + path + ".");
+      }
+
+
+      FuzzerBridge::FuzzerBridge(triton::API* ctx, const FuzzerBridgeOptions& options) {
+        if (ctx == nullptr)
+          throw triton::exceptions::ExplorationEngine("FuzzerBridge::FuzzerBridge(): The context cannot be null.");
+
+        if (options.fuzzer.empty() || options.output.empty())
+          throw triton::exceptions::ExplorationEngine("FuzzerBridge::FuzzerBridge(): The directories of the fuzzer and of the bridge are needed.");
+
+        if (options.maxInstructions == 0)
+          throw triton::exceptions::ExplorationEngine("FuzzerBridge::FuzzerBridge(): The max number of instructions must be positive.");
+
+        for (triton::usize id : options.input) {
+          if (ctx->getSymbolicVariable(id)->getSize() != triton::bitsize::byte)
+            throw triton::exceptions::ExplorationEngine("FuzzerBridge::FuzzerBridge(): The variables of the input must be bytes.");
+        }
+
+        this->ctx     = ctx;
+        this->options = options;
+        this->nextId  = 0;
+
+        makeDirectory(options.output);
+        makeDirectory(join(options.output, "queue"));
+        makeDirectory(join(options.output, ".synced"));
+
+        /* The bridge resumes after its last testcase and with its map */
+        auto entries = listQueue(join(options.output, "queue"));
+        if (!entries.empty())
+          this->nextId = entries.rbegin()->first + 1;
+
+        if (!readFile(join(options.output, "fuzz_bitmap"), this->virgin) || this->virgin.size() != BITMAP_SIZE)
+          this->virgin.assign(BITMAP_SIZE, 0xff);
+      }
+
+
+      triton::usize FuzzerBridge::getEdge(triton::uint64 src, triton::uint64 dst) {
+        triton::usize prev = static_cast<triton::usize>((src >> 4) ^ (src << 8)) % BITMAP_SIZE;
+        triton::usize cur  = static_cast<triton::usize>((dst >> 4) ^ (dst << 8)) % BITMAP_SIZE;
+        return cur ^ (prev >> 1);
+      }
+
+
+      bool FuzzerBridge::mergeTrace(std::vector<triton::uint8>& virgin, const std::vector<triton::uint8>& trace) {
+        bool news = false;
+
+        if (virgin.size() != trace.size())
+          throw triton::exceptions::ExplorationEngine("FuzzerBridge::mergeTrace(): The maps must have the same size.");
+
+        for (triton::usize i = 0; i < trace.size(); i++) {
+          triton::uint8 bucket = getBucket(trace[i]);
+          if (bucket & virgin[i]) {
+            virgin[i] &= ~bucket;
+            news = true;
+          }
+        }
+
+        return news;
+      }
+
+
+      std::vector<triton::engines::symbolic::PathConstraint> FuzzerBridge::execute(const std::vector<triton::uint8>& data, triton::uint64 entry, std::map<triton::uint64, triton::uint64>& blocks, FuzzerBridgeResult& result) {
+        std::unique_ptr<triton::API> state(this->ctx->fork());
+        std::vector<triton::uint8> trace(BITMAP_SIZE, 0);
+        triton::usize count = 0;
+        triton::uint64 pc = entry;
+
+        for (triton::usize i = 0; i < this->options.input.size(); i++)
+          state->setConcreteVariableValue(state->getSymbolicVariable(this->options.input[i]), i < data.size() ? data[i] : 0);
+
+        /* The entry block is reached from the block 0, as the first one AFL records */
+        trace[FuzzerBridge::getEdge(0, entry)]++;
+
+        while (count < this->options.maxInstructions && this->options.exits.find(pc) == this->options.exits.end()) {
+          std::vector<triton::arch::Instruction> block;
+          triton::uint64 next = pc;
+
+          /* An instruction which cannot be decoded ends the run */
+          try {
+            block = state->processBlock(pc, &next);
+          }
+          catch (const triton::exceptions::Exception&) {
+            break;
+          }
+
+          count += block.size();
+
+          /* The block stopped at an undefined or unsupported instruction */
+          if (block.empty() || !block.back().isControlFlow())
+            break;
+
+          /* The edge into an exit is recorded, the run stops before executing it */
+          blocks[block.back().getAddress()] = pc;
+          triton::uint8& hits = trace[FuzzerBridge::getEdge(pc, next)];
+          if (hits < 0xff)
+            hits++;
+
+          pc = next;
+        }
+
+        FuzzerBridge::mergeTrace(this->virgin, trace);
+
+        result.runs++;
+        result.instructions += count;
+
+        return state->getPathConstraints();
+      }
+
+
+      void FuzzerBridge::flip(const std::vector<triton::uint8>& data, triton::uint32 src, const std::vector<triton::engines::symbolic::PathConstraint>& trace, const std::map<triton::uint64, triton::uint64>& blocks, FuzzerBridgeResult& result) {
+        triton::engines::solver::BranchFlipOptions flipOptions;
+        std::set<std::vector<triton::uint8>> written;
+        std::map<triton::usize, triton::usize> offsets;
+
+        flipOptions.parallel   = this->options.parallel;
+        flipOptions.timeout    = this->options.timeout;
+        flipOptions.unsatCores = this->options.unsatCores;
+        if (this->options.unsatCores)
+          flipOptions.cores = this->cores;
+
+        /* The branches whose edge the fuzzer or a previous run covered are not flipped */
+        for (const auto& pc : trace) {
+          for (const auto& branch : pc.getBranchConstraints()) {
+            auto it = blocks.find(std::get<1>(branch));
+            if (it != blocks.end() && this->virgin[FuzzerBridge::getEdge(it->second, std::get<2>(branch))] != 0xff)
+              flipOptions.covered.insert({std::get<1>(branch), std::get<2>(branch)});
+          }
+        }
+
+        for (triton::usize i = 0; i < this->options.input.size(); i++)
+          offsets[this->options.input[i]] = i;
+
+        auto flips = this->ctx->solveBranchFlips(trace, flipOptions);
+        result.flips += flips.size();
+
+        for (const auto& flip : flips) {
+          if (flip.pruned)
+            result.pruned++;
+
+          if (!flip.core.empty()) {
+            std::vector<triton::uint128> hashes;
+            for (const auto& node : flip.core)
+              hashes.push_back(node->getHash());
+            this->cores.push_back(std::move(hashes));
+          }
+
+          if (flip.status != triton::engines::solver::SAT)
+            continue;
+
+          result.solved++;
+
+          /* The variables created by the run are not bytes of the input */
+          std::vector<triton::uint8> input = data;
+          for (const auto& item : flip.model) {
+            auto it = offsets.find(item.first);
+            if (it == offsets.end())
+              continue;
+            if (it->second >= input.size())
+              input.resize(it->second + 1, 0);
+            input[it->second] = static_cast<triton::uint8>(item.second.getValue());
+          }
+
+          /* The edge is covered by the input, the next runs do not flip it again */
+          auto it = blocks.find(flip.srcAddr);
+          if (it != blocks.end())
+            this->virgin[FuzzerBridge::getEdge(it->second, flip.dstAddr)] &= ~getBucket(1);
+
+          if (input == data || !written.insert(input).second)
+            continue;
+
+          char name[64];
+          std::snprintf(name, sizeof(name), "id:%06u,src:%06u", this->nextId++, src);
+          writeFile(join(this->options.output, "queue"), name, input.data(), input.size());
+          result.written++;
+        }
+      }
+
+
+      void FuzzerBridge::step(triton::uint64 entry, FuzzerBridgeResult& result) {
+        std::string synced = join(join(this->options.output, ".synced"), getName(this->options.fuzzer));
+        std::string tag    = "sync:" + getName(this->options.output);
+        std::vector<triton::uint8> bitmap;
+        std::vector<triton::uint8> last;
+        triton::uint32 minAccept = 0;
+
+        /* The id of the next testcase of the fuzzer, as AFL records it */
+        if (readFile(synced, last) && last.size() == sizeof(minAccept))
+          minAccept = last[0] | (last[1] << 8) | (last[2] << 16) | (static_cast<triton::uint32>(last[3]) << 24);
+
+        /* The edges the fuzzer covered, its map holding virgin bits too */
+        if (readFile(join(this->options.fuzzer, "fuzz_bitmap"), bitmap) && bitmap.size() == BITMAP_SIZE) {
+          for (triton::usize i = 0; i < BITMAP_SIZE; i++)
+            this->virgin[i] &= bitmap[i];
+        }
+
+        auto entries = listQueue(join(this->options.fuzzer, "queue"));
+        for (auto it = entries.lower_bound(minAccept); it != entries.end(); it++) {
+          const std::string& name = it->second;
+          std::vector<triton::uint8> data;
+
+          result.entries++;
+
+          bool selected = name.find(tag) == std::string::npos;
+          if (selected && this->options.newEdgesOnly)
+            selected = name.find("+cov") != std::string::npos || name.find("orig:") != std::string::npos;
+
+          if (selected && readFile(join(join(this->options.fuzzer, "queue"), name), data)) {
+            std::map<triton::uint64, triton::uint64> blocks;
+            auto trace = this->execute(data, entry, blocks, result);
+            this->flip(data, it->first, trace, blocks, result);
+          }
+          else {
+            result.skipped++;
+          }
+
+          /* Recorded after each testcase, a bridge restarted after an error does not run it again */
+          minAccept = it->first + 1;
+          triton::uint8 bytes[4] = {
+            static_cast<triton::uint8>(minAccept),
+            static_cast<triton::uint8>(minAccept >> 8),
+            static_cast<triton::uint8>(minAccept >> 16),
+            static_cast<triton::uint8>(minAccept >> 24),
+          };
+          writeFile(join(this->options.output, ".synced"), getName(this->options.fuzzer), bytes, sizeof(bytes));
+        }
+
+        writeFile(this->options.output, "fuzz_bitmap", this->virgin.data(), this->virgin.size());
+      }
+
+
+      FuzzerBridgeResult FuzzerBridge::sync(triton::uint64 entry) {
+        std::map<triton::usize, triton::uint512> values;
+        FuzzerBridgeResult result;
+
+        /* The forks share the values of the variables, the ones of the context are restored once done */
+        for (triton::usize id : this->options.input)
+          values[id] = this->ctx->getConcreteVariableValue(this->ctx->getSymbolicVariable(id));
+
+        auto restore = [&]() {
+          for (const auto& item : values)
+            this->ctx->getAstContext()->updateVariable(item.first, item.second);
+        };
+
+        try {
+          this->step(entry, result);
+        }
+        catch (...) {
+          restore();
+          throw;
+        }
+
+        restore();
+
+        return result;
+      }
+
+
+      FuzzerBridgeResult FuzzerBridge::watch(triton::uint64 entry) {
+        auto start = std::chrono::steady_clock::now();
+        FuzzerBridgeResult result;
+
+        while (true) {
+          FuzzerBridgeResult round = this->sync(entry);
+
+          result.entries      += round.entries;
+          result.skipped      += round.skipped;
+          result.runs         += round.runs;
+          result.instructions += round.instructions;
+          result.flips        += round.flips;
+          result.solved       += round.solved;
+          result.pruned       += round.pruned;
+          result.written      += round.written;
+
+          auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+          if (static_cast<triton::uint64>(elapsed) + this->options.interval >= this->options.timeLimit)
+            break;
+
+          std::this_thread::sleep_for(std::chrono::milliseconds(this->options.interval));
+        }
+
+        return result;
+      }
+
+
+      const std::vector<triton::uint8>& FuzzerBridge::getBitmap(void) const {
+        return this->virgin;
+      }
+
+    };
+  };
+};
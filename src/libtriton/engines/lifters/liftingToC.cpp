@@ -0,0 +1,527 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <cctype>
+#include <functional>
+#include <map>
+#include <sstream>
+#include <unordered_set>
+
+#include <triton/astEnums.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/liftingToC.hpp>
+#include <triton/symbolicVariable.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace lifters {
+
+      /* Returns the number of bits of the C type holding a bitvector of `size` bits */
+      static triton::uint32 holder(triton::uint32 size) {
+        return (size <= triton::bitsize::qword) ? triton::bitsize::qword : triton::bitsize::dqword;
+      }
+
+
+      /* Returns the unsigned C type holding a bitvector of `size` bits */
+      static std::string utype(triton::uint32 size) {
+        return (holder(size) == triton::bitsize::qword) ? "uint64_t" : "triton_uint128";
+      }
+
+
+      /* Returns the suffix of the helpers working on a bitvector of `size` bits */
+      static std::string suffix(triton::uint32 size) {
+        return (holder(size) == triton::bitsize::qword) ? "64" : "128";
+      }
+
+
+      /* Returns the value of an integer node */
+      static triton::uint32 integer(const triton::ast::SharedAbstractNode& node) {
+        return reinterpret_cast<triton::ast::IntegerNode*>(node.get())->getInteger().convert_to<triton::uint32>();
+      }
+
+
+      /* Returns a C literal of a bitvector of `size` bits */
+      static std::string literal(const triton::uint512& value, triton::uint32 size) {
+        std::ostringstream s;
+
+        if (holder(size) == triton::bitsize::qword) {
+          s << "UINT64_C(0x" << std::hex << value << ")";
+        }
+        else {
+          triton::uint512 high = value >> triton::bitsize::qword;
+          triton::uint512 low  = value & 0xffffffffffffffff;
+          if (high == 0)
+            s << "((triton_uint128)UINT64_C(0x" << std::hex << low << "))";
+          else
+            s << "(((triton_uint128)UINT64_C(0x" << std::hex << high << ") << 64) | UINT64_C(0x" << low << "))";
+        }
+
+        return s.str();
+      }
+
+
+      /* Returns the mask of a bitvector of `size` bits */
+      static std::string mask(triton::uint32 size) {
+        return literal((triton::uint512(1) << size) - 1, size);
+      }
+
+
+      /* Masks `expr` to `size` bits, if the C type holding it is wider */
+      static std::string fit(const std::string& expr, triton::uint32 size) {
+        if (size == holder(size))
+          return expr;
+        return "(" + expr + " & " + mask(size) + ")";
+      }
+
+
+      /* Converts `expr` held for `from` bits to the C type holding `to` bits */
+      static std::string cast(const std::string& expr, triton::uint32 from, triton::uint32 to) {
+        if (holder(from) == holder(to))
+          return expr;
+        return "((" + utype(to) + ")" + expr + ")";
+      }
+
+
+      /* Returns true if `name` may be the name of an argument */
+      static bool isIdentifier(const std::string& name) {
+        if (name.empty() || std::isdigit(static_cast<unsigned char>(name[0])))
+          return false;
+
+        for (char c : name) {
+          if (!std::isalnum(static_cast<unsigned char>(c)) && c != '_')
+            return false;
+        }
+
+        /* The names of the locals and of the helpers */
+        return name.compare(0, 5, "node_") != 0 && name.compare(0, 4, "ref_") != 0 && name.compare(0, 7, "triton_") != 0;
+      }
+
+
+      LiftingToC::LiftingToC() {
+      }
+
+
+      void LiftingToC::requiredFunctions(std::ostream& stream, triton::uint32 bits) {
+        std::string n = (bits == triton::bitsize::qword) ? "64" : "128";
+        std::string u = (bits == triton::bitsize::qword) ? "uint64_t" : "triton_uint128";
+        std::string s = (bits == triton::bitsize::qword) ? "int64_t" : "triton_sint128";
+
+        stream << "#ifndef TRITON_LIFTING_TO_C_" << n << std::endl;
+        stream << "#define TRITON_LIFTING_TO_C_" << n << std::endl;
+        stream << std::endl;
+
+        if (bits == triton::bitsize::qword) {
+          stream << "#include <stdint.h>" << std::endl;
+        }
+        else {
+          stream << "typedef unsigned __int128 triton_uint128;" << std::endl;
+          stream << "typedef __int128 triton_sint128;" << std::endl;
+        }
+
+        stream << std::endl;
+        stream << "static inline " << u << " triton_mask" << n << "(unsigned int w) {" << std::endl;
+        stream << "  return (w == " << bits << ") ? ~(" << u << ")0 : (((" << u << ")1 << w) - 1);" << std::endl;
+        stream << "}" << std::endl;
+
+        stream << std::endl;
+        stream << "static inline " << s << " triton_sx" << n << "(" << u << " x, unsigned int w) {" << std::endl;
+        stream << "  return (" << s << ")(x << (" << bits << " - w)) >> (" << bits << " - w);" << std::endl;
+        stream << "}" << std::endl;
+
+        stream << std::endl;
+        stream << "static inline " << u << " triton_ashr" << n << "(" << u << " x, " << u << " y, unsigned int w) {" << std::endl;
+        stream << "  if (y >= w)" << std::endl;
+        stream << "    return (triton_sx" << n << "(x, w) < 0) ? triton_mask" << n << "(w) : 0;" << std::endl;
+        stream << "  return (" << u << ")(triton_sx" << n << "(x, w) >> y) & triton_mask" << n << "(w);" << std::endl;
+        stream << "}" << std::endl;
+
+        /* The division of the smallest value by -1 overflows in C, its results are computed apart */
+        stream << std::endl;
+        stream << "static inline " << u << " triton_sdiv" << n << "(" << u << " x, " << u << " y, unsigned int w) {" << std::endl;
+        stream << "  " << s << " a = triton_sx" << n << "(x, w), b = triton_sx" << n << "(y, w);" << std::endl;
+        stream << "  if (b == 0)" << std::endl;
+        stream << "    return (a < 0) ? 1 : triton_mask" << n << "(w);" << std::endl;
+        stream << "  if (b == -1)" << std::endl;
+        stream << "    return (0 - x) & triton_mask" << n << "(w);" << std::endl;
+        stream << "  return (" << u << ")(a / b) & triton_mask" << n << "(w);" << std::endl;
+        stream << "}" << std::endl;
+
+        stream << std::endl;
+        stream << "static inline " << u << " triton_srem" << n << "(" << u << " x, " << u << " y, unsigned int w) {" << std::endl;
+        stream << "  " << s << " a = triton_sx" << n << "(x, w), b = triton_sx" << n << "(y, w);" << std::endl;
+        stream << "  if (b == 0)" << std::endl;
+        stream << "    return x;" << std::endl;
+        stream << "  if (b == -1)" << std::endl;
+        stream << "    return 0;" << std::endl;
+        stream << "  return (" << u << ")(a % b) & triton_mask" << n << "(w);" << std::endl;
+        stream << "}" << std::endl;
+
+        stream << std::endl;
+        stream << "static inline " << u << " triton_smod" << n << "(" << u << " x, " << u << " y, unsigned int w) {" << std::endl;
+        stream << "  " << s << " a = triton_sx" << n << "(x, w), b = triton_sx" << n << "(y, w), r = 0;" << std::endl;
+        stream << "  if (b == 0)" << std::endl;
+        stream << "    return x;" << std::endl;
+        stream << "  if (b == -1)" << std::endl;
+        stream << "    return 0;" << std::endl;
+        stream << "  r = a % b;" << std::endl;
+        stream << "  if (r != 0 && ((r < 0) != (b < 0)))" << std::endl;
+        stream << "    r += b;" << std::endl;
+        stream << "  return (" << u << ")r & triton_mask" << n << "(w);" << std::endl;
+        stream << "}" << std::endl;
+
+        stream << std::endl;
+        stream << "static inline " << u << " triton_popcount" << n << "(" << u << " x) {" << std::endl;
+        stream << "  " << u << " r = 0;" << std::endl;
+        stream << "  for (; x != 0; x &= x - 1)" << std::endl;
+        stream << "    r++;" << std::endl;
+        stream << "  return r;" << std::endl;
+        stream << "}" << std::endl;
+
+        stream << std::endl;
+        stream << "static inline " << u << " triton_bswap" << n << "(" << u << " x, unsigned int w) {" << std::endl;
+        stream << "  " << u << " r = 0;" << std::endl;
+        stream << "  unsigned int i = 0;" << std::endl;
+        stream << "  for (i = 0; i < w; i += 8)" << std::endl;
+        stream << "    r = (r << 8) | ((x >> i) & 0xff);" << std::endl;
+        stream << "  return r;" << std::endl;
+        stream << "}" << std::endl;
+
+        stream << std::endl;
+        stream << "#endif /* TRITON_LIFTING_TO_C_" << n << " */" << std::endl;
+        stream << std::endl;
+      }
+
+
+      std::unordered_map<triton::ast::AbstractNode*, std::string> LiftingToC::body(std::ostream& stream, const std::vector<triton::ast::SharedAbstractNode>& roots, std::vector<std::pair<std::string, triton::uint32>>& arguments, bool& wide) const {
+        std::unordered_map<triton::ast::AbstractNode*, std::string> values;
+        std::unordered_map<triton::ast::AbstractNode*, triton::usize> references;
+        std::map<triton::usize, triton::engines::symbolic::SharedSymbolicVariable> variables;
+        std::unordered_map<triton::usize, std::string> argumentOf;
+        std::vector<triton::ast::SharedAbstractNode> nodes;
+        std::unordered_set<triton::ast::AbstractNode*> seen;
+        std::unordered_set<std::string> names;
+
+        /* The nodes of all roots in topological order, the nodes shared by several roots are computed once */
+        for (const auto& root : roots) {
+          for (const auto& node : triton::ast::childrenExtraction(root, true /* unroll */, true /* revert */)) {
+            if (seen.insert(node.get()).second)
+              nodes.push_back(node);
+          }
+        }
+
+        /* The nodes of the symbolic expressions referenced are named after them, the variables are the arguments */
+        for (const auto& node : nodes) {
+          if (node->getBitvectorSize() > triton::bitsize::dqword)
+            throw triton::exceptions::LiftingEngine("LiftingToC::liftToC(): Bitvectors wider than 128 bits are not supported.");
+
+          if (node->getBitvectorSize() > triton::bitsize::qword)
+            wide = true;
+
+          if (node->getType() == triton::ast::REFERENCE_NODE) {
+            const auto& expr = reinterpret_cast<triton::ast::ReferenceNode*>(node.get())->getSymbolicExpression();
+            references.insert({expr->getAst().get(), expr->getId()});
+          }
+
+          else if (node->getType() == triton::ast::VARIABLE_NODE) {
+            const auto& var = reinterpret_cast<triton::ast::VariableNode*>(node.get())->getSymbolicVariable();
+            variables[var->getId()] = var;
+          }
+        }
+
+        for (const auto& item : variables) {
+          const auto& var  = item.second;
+          std::string name = (isIdentifier(var->getAlias()) && names.find(var->getAlias()) == names.end()) ? var->getAlias() : var->getName();
+
+          names.insert(name);
+          argumentOf[var->getId()] = name;
+          arguments.push_back({name, var->getSize()});
+        }
+
+        triton::usize count = 0;
+        for (const auto& node : nodes) {
+          auto* n                  = node.get();
+          auto& children           = node->getChildren();
+          triton::uint32 size      = node->getBitvectorSize();
+          std::string expr;
+
+          /* Returns the C expression of the child `i` */
+          auto child = [&](triton::usize i) -> const std::string& {
+            auto it = values.find(children[i].get());
+            if (it == values.end())
+              throw triton::exceptions::LiftingEngine("LiftingToC::liftToC(): Unsupported operand.");
+            return it->second;
+          };
+
+          /* Joins the children with the C operator `op` */
+          auto join = [&](const std::string& op) {
+            std::string e = "(" + child(0);
+            for (triton::usize i = 1; i < children.size(); i++)
+              e += " " + op + " " + child(i);
+            return e + ")";
+          };
+
+          /* The signed value of the child `i` */
+          auto sx = [&](triton::usize i) {
+            std::ostringstream s;
+            s << "triton_sx" << suffix(children[i]->getBitvectorSize()) << "(" << child(i) << ", " << children[i]->getBitvectorSize() << ")";
+            return s.str();
+          };
+
+          /* A call to the helper `name` on the children `x` and `y` */
+          auto helper = [&](const std::string& name) {
+            std::ostringstream s;
+            s << "triton_" << name << suffix(size) << "(" << child(0) << ", " << child(1) << ", " << size << ")";
+            return s.str();
+          };
+
+          /* The lane-wise nodes are the union of one operation per lane, `op` returns the one of the lane `i` */
+          auto lanes = [&](triton::uint32 lane, const std::function<std::string(const std::string&, const std::string&, const std::string&)>& op) {
+            std::string lmask = literal((triton::uint512(1) << lane) - 1, size);
+            std::string lsign = literal(triton::uint512(1) << (lane - 1), size);
+            std::string e;
+            for (triton::uint32 i = 0; i < size; i += lane) {
+              std::ostringstream s;
+              s << "(" << utype(size) << ")(" << op(std::to_string(i), lmask, lsign) << ")";
+              if (i)
+                s << " << " << i;
+              e += (e.empty() ? "(" : " | ") + std::string("(") + s.str() + ")";
+            }
+            return e + ")";
+          };
+
+          switch (node->getType()) {
+            case triton::ast::BV_NODE:
+              values[n] = literal(node->evaluate(), size);
+              continue;
+
+            case triton::ast::VARIABLE_NODE:
+              values[n] = argumentOf.at(reinterpret_cast<triton::ast::VariableNode*>(n)->getSymbolicVariable()->getId());
+              continue;
+
+            case triton::ast::REFERENCE_NODE:
+              values[n] = values.at(reinterpret_cast<triton::ast::ReferenceNode*>(n)->getSymbolicExpression()->getAst().get());
+              continue;
+
+            /* Only operands of other nodes */
+            case triton::ast::INTEGER_NODE:
+            case triton::ast::STRING_NODE:
+              continue;
+
+            case triton::ast::BVADD_NODE:     expr = fit(join("+"), size); break;
+            case triton::ast::BVAND_NODE:     expr = join("&"); break;
+            case triton::ast::BVOR_NODE:      expr = join("|"); break;
+            case triton::ast::BVXOR_NODE:     expr = join("^"); break;
+            case triton::ast::BVSUB_NODE:     expr = fit(join("-"), size); break;
+            case triton::ast::BVMUL_NODE:     expr = fit(join("*"), size); break;
+            case triton::ast::BVNAND_NODE:    expr = fit("~" + join("&"), size); break;
+            case triton::ast::BVNOR_NODE:     expr = fit("~" + join("|"), size); break;
+            case triton::ast::BVXNOR_NODE:    expr = fit("~" + join("^"), size); break;
+            case triton::ast::BVNOT_NODE:     expr = fit("~" + child(0), size); break;
+            case triton::ast::BVNEG_NODE:     expr = fit("(0 - " + child(0) + ")", size); break;
+            case triton::ast::BVSHL_NODE:     expr = "((" + child(1) + " >= " + std::to_string(size) + ") ? 0 : " + fit("(" + child(0) + " << " + child(1) + ")", size) + ")"; break;
+            case triton::ast::BVLSHR_NODE:    expr = "((" + child(1) + " >= " + std::to_string(size) + ") ? 0 : (" + child(0) + " >> " + child(1) + "))"; break;
+            case triton::ast::BVASHR_NODE:    expr = helper("ashr"); break;
+            case triton::ast::BVUDIV_NODE:    expr = "((" + child(1) + " == 0) ? " + mask(size) + " : (" + child(0) + " / " + child(1) + "))"; break;
+            case triton::ast::BVUREM_NODE:    expr = "((" + child(1) + " == 0) ? " + child(0) + " : (" + child(0) + " % " + child(1) + "))"; break;
+            case triton::ast::BVSDIV_NODE:    expr = helper("sdiv"); break;
+            case triton::ast::BVSREM_NODE:    expr = helper("srem"); break;
+            case triton::ast::BVSMOD_NODE:    expr = helper("smod"); break;
+            case triton::ast::BVUGE_NODE:     expr = join(">="); break;
+            case triton::ast::BVUGT_NODE:     expr = join(">"); break;
+            case triton::ast::BVULE_NODE:     expr = join("<="); break;
+            case triton::ast::BVULT_NODE:     expr = join("<"); break;
+            case triton::ast::BVSGE_NODE:     expr = "(" + sx(0) + " >= " + sx(1) + ")"; break;
+            case triton::ast::BVSGT_NODE:     expr = "(" + sx(0) + " > " + sx(1) + ")"; break;
+            case triton::ast::BVSLE_NODE:     expr = "(" + sx(0) + " <= " + sx(1) + ")"; break;
+            case triton::ast::BVSLT_NODE:     expr = "(" + sx(0) + " < " + sx(1) + ")"; break;
+            case triton::ast::EQUAL_NODE:     expr = join("=="); break;
+            case triton::ast::DISTINCT_NODE:  expr = join("!="); break;
+            case triton::ast::IFF_NODE:       expr = join("=="); break;
+            case triton::ast::LAND_NODE:      expr = join("&&"); break;
+            case triton::ast::LOR_NODE:       expr = join("||"); break;
+            case triton::ast::LXOR_NODE:      expr = join("^"); break;
+            case triton::ast::LNOT_NODE:      expr = "(!" + child(0) + ")"; break;
+            case triton::ast::ITE_NODE:       expr = "(" + child(0) + " ? " + child(1) + " : " + child(2) + ")"; break;
+            case triton::ast::LET_NODE:       expr = child(2); break;
+
+            case triton::ast::BSWAP_NODE:
+              expr = "triton_bswap" + suffix(size) + "(" + child(0) + ", " + std::to_string(size) + ")";
+              break;
+
+            case triton::ast::BVPOPCOUNT_NODE:
+              expr = "triton_popcount" + suffix(size) + "(" + child(0) + ")";
+              break;
+
+            case triton::ast::BVPARITY_NODE:
+              expr = "(" + cast("triton_popcount" + suffix(children[0]->getBitvectorSize()) + "(" + child(0) + ")", children[0]->getBitvectorSize(), size) + " & 1)";
+              break;
+
+            case triton::ast::BVROL_NODE:
+            case triton::ast::BVROR_NODE: {
+              triton::uint32 rot = integer(children[1]) % size;
+              if (node->getType() == triton::ast::BVROR_NODE && rot)
+                rot = size - rot;
+              if (rot == 0)
+                expr = child(0);
+              else
+                expr = fit("((" + child(0) + " << " + std::to_string(rot) + ") | (" + child(0) + " >> " + std::to_string(size - rot) + "))", size);
+              break;
+            }
+
+            case triton::ast::CONCAT_NODE: {
+              triton::uint32 shift = size;
+              expr = "(";
+              for (triton::usize i = 0; i < children.size(); i++) {
+                shift -= children[i]->getBitvectorSize();
+                expr += (i ? " | " : "") + cast(child(i), children[i]->getBitvectorSize(), size);
+                if (shift)
+                  expr += " << " + std::to_string(shift);
+              }
+              expr += ")";
+              break;
+            }
+
+            case triton::ast::EXTRACT_NODE: {
+              triton::uint32 low = integer(children[1]);
+              std::string value = child(2);
+              if (low)
+                value = "(" + value + " >> " + std::to_string(low) + ")";
+              expr = fit(cast(value, children[2]->getBitvectorSize(), size), size);
+              break;
+            }
+
+            case triton::ast::ZX_NODE:
+              expr = cast(child(1), children[1]->getBitvectorSize(), size);
+              break;
+
+            case triton::ast::SX_NODE:
+              if (integer(children[0]) == 0)
+                expr = child(1);
+              else
+                expr = fit("((" + utype(size) + ")(" + (holder(size) == triton::bitsize::qword ? "int64_t" : "triton_sint128") + ")" + sx(1) + ")", size);
+              break;
+
+            case triton::ast::BVLANEADD_NODE:
+              expr = lanes(integer(children.back()), [&](const std::string& i, const std::string& m, const std::string&) {
+                return "((" + child(0) + " >> " + i + ") + (" + child(1) + " >> " + i + ")) & " + m;
+              });
+              break;
+
+            case triton::ast::BVLANESUB_NODE:
+              expr = lanes(integer(children.back()), [&](const std::string& i, const std::string& m, const std::string&) {
+                return "((" + child(0) + " >> " + i + ") - (" + child(1) + " >> " + i + ")) & " + m;
+              });
+              break;
+
+            case triton::ast::BVLANEEQ_NODE:
+              expr = lanes(integer(children.back()), [&](const std::string& i, const std::string& m, const std::string&) {
+                return "(((" + child(0) + " >> " + i + ") & " + m + ") == ((" + child(1) + " >> " + i + ") & " + m + ")) ? " + m + " : 0";
+              });
+              break;
+
+            case triton::ast::BVLANESGT_NODE:
+              expr = lanes(integer(children.back()), [&](const std::string& i, const std::string& m, const std::string& sign) {
+                return "((((" + child(0) + " >> " + i + ") & " + m + ") ^ " + sign + ") > (((" + child(1) + " >> " + i + ") & " + m + ") ^ " + sign + ")) ? " + m + " : 0";
+              });
+              break;
+
+            case triton::ast::BVLANESELECT_NODE:
+              expr = lanes(integer(children.back()), [&](const std::string& i, const std::string& m, const std::string& sign) {
+                return "(((" + child(0) + " >> " + i + ") & " + sign + ") ? (" + child(1) + " >> " + i + ") : (" + child(2) + " >> " + i + ")) & " + m;
+              });
+              break;
+
+            default:
+              throw triton::exceptions::LiftingEngine("LiftingToC::liftToC(): Unsupported node kind.");
+          }
+
+          /* Each node is computed once into a local */
+          std::ostringstream name;
+          auto ref = references.find(n);
+          if (ref != references.end())
+            name << "ref_" << ref->second;
+          else
+            name << "node_" << count++;
+
+          stream << "  const " << utype(size) << " " << name.str() << " = " << expr << ";" << std::endl;
+          values[n] = name.str();
+        }
+
+        return values;
+      }
+
+
+      std::ostream& LiftingToC::function(std::ostream& stream, const std::vector<std::pair<std::string, triton::ast::SharedAbstractNode>>& outputs, const char* fname, bool returned) {
+        std::vector<std::pair<std::string, triton::uint32>> arguments;
+        std::vector<triton::ast::SharedAbstractNode> roots;
+        std::ostringstream locals;
+        bool wide = false;
+
+        for (const auto& output : outputs)
+          roots.push_back(output.second);
+
+        auto values = this->body(locals, roots, arguments, wide);
+
+        /* Print required functions */
+        this->requiredFunctions(stream, triton::bitsize::qword);
+        if (wide)
+          this->requiredFunctions(stream, triton::bitsize::dqword);
+
+        /* Print the signature */
+        stream << (returned ? utype(roots[0]->getBitvectorSize()) : "void") << " " << fname << "(";
+        for (triton::usize i = 0; i < arguments.size(); i++)
+          stream << (i ? ", " : "") << utype(arguments[i].second) << " " << arguments[i].first;
+        for (triton::usize i = 0; !returned && i < outputs.size(); i++)
+          stream << ((i || !arguments.empty()) ? ", " : "") << utype(roots[i]->getBitvectorSize()) << "* " << outputs[i].first;
+        if (arguments.empty() && (returned || outputs.empty()))
+          stream << "void";
+        stream << ") {" << std::endl;
+
+        /* The arguments may be given with bits above their size */
+        for (const auto& arg : arguments) {
+          if (arg.second != holder(arg.second))
+            stream << "  " << arg.first << " &= " << mask(arg.second) << ";" << std::endl;
+        }
+
+        /* Print the locals and the results */
+        stream << locals.str();
+        if (returned) {
+          stream << "  return " << values.at(roots[0].get()) << ";" << std::endl;
+        }
+        else {
+          for (triton::usize i = 0; i < outputs.size(); i++)
+            stream << "  *" << outputs[i].first << " = " << values.at(roots[i].get()) << ";" << std::endl;
+        }
+        stream << "}" << std::endl;
+
+        return stream;
+      }
+
+
+      std::ostream& LiftingToC::liftToC(std::ostream& stream, const triton::engines::symbolic::SharedSymbolicExpression& expr, const char* fname) {
+        return this->liftToC(stream, expr->getAst(), fname);
+      }
+
+
+      std::ostream& LiftingToC::liftToC(std::ostream& stream, const triton::ast::SharedAbstractNode& node, const char* fname) {
+        return this->function(stream, {{"", node}}, fname, true);
+      }
+
+
+      std::ostream& LiftingToC::liftToC(std::ostream& stream, const std::vector<std::pair<std::string, triton::ast::SharedAbstractNode>>& outputs, const char* fname) {
+        for (const auto& output : outputs) {
+          if (!isIdentifier(output.first))
+            throw triton::exceptions::LiftingEngine("LiftingToC::liftToC(): Invalid name of output.");
+        }
+        return this->function(stream, outputs, fname, false);
+      }
+
+    }; /* lifters namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
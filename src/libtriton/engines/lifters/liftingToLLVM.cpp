@@ -8,6 +8,7 @@
 #include <memory>
 #include <ostream>
 #include <string>
+#include <vector>
 
 #include <triton/astContext.hpp>
 #include <triton/liftingToLLVM.hpp>
@@ -53,6 +54,50 @@ namespace triton {
       }
 
 
+      std::ostream& LiftingToLLVM::liftToLLVM(std::ostream& stream, const std::vector<triton::ast::SharedAbstractNode>& nodes, const char* fname, bool optimize) {
+        std::vector<std::string> fnames;
+
+        /* The LLVM context, shared by all the functions */
+        llvm::LLVMContext context;
+
+        /* The lifter Triton -> LLVM */
+        triton::ast::TritonToLLVM lifter(context);
+
+        /* Lift ASTs to LLVM IR, one function per node */
+        for (triton::usize index = 0; index < nodes.size(); index++)
+          fnames.push_back(std::string(fname) + "_" + std::to_string(index));
+        auto llvmModule = lifter.convert(nodes, fnames, optimize);
+
+        /* Print the LLVM module into the stream */
+        std::string dump;
+        llvm::raw_string_ostream llvmStream(dump);
+        llvmModule->print(llvmStream, nullptr);
+        stream << dump;
+
+        return stream;
+      }
+
+
+      std::ostream& LiftingToLLVM::liftToLLVM(std::ostream& stream, const std::vector<std::pair<std::string, triton::ast::SharedAbstractNode>>& outputs, const char* fname, bool optimize) {
+        /* The LLVM context */
+        llvm::LLVMContext context;
+
+        /* The lifter Triton -> LLVM */
+        triton::ast::TritonToLLVM lifter(context);
+
+        /* Lift ASTs to LLVM IR, one function for all the outputs */
+        auto llvmModule = lifter.convert(outputs, fname, optimize);
+
+        /* Print the LLVM module into the stream */
+        std::string dump;
+        llvm::raw_string_ostream llvmStream(dump);
+        llvmModule->print(llvmStream, nullptr);
+        stream << dump;
+
+        return stream;
+      }
+
+
       triton::ast::SharedAbstractNode LiftingToLLVM::simplifyAstViaLLVM(const triton::ast::SharedAbstractNode& node) const {
         llvm::LLVMContext context;
 
@@ -53,7 +53,70 @@ namespace triton {
       }
 
 
-      std::ostream& LiftingToPython::liftToPython(std::ostream& stream, const triton::engines::symbolic::SharedSymbolicExpression& expr) {
+      void LiftingToPython::laneFunctions(std::ostream& stream) {
+        /* The lanes of 8, 16, 32 and 64 bits are numpy vectors, the others are computed one by one */
+        stream << "def lanes(size, lane, *values):" << std::endl;
+        stream << "    if lane not in (8, 16, 32, 64):" << std::endl;
+        stream << "        return None, None" << std::endl;
+        stream << "    try:" << std::endl;
+        stream << "        import numpy" << std::endl;
+        stream << "    except ImportError:" << std::endl;
+        stream << "        return None, None" << std::endl;
+        stream << "    dtype = numpy.dtype('<u%d' % (lane // 8))" << std::endl;
+        stream << "    return numpy, [numpy.frombuffer((v & ((1 << size) - 1)).to_bytes(size // 8, 'little'), dtype=dtype) for v in values]" << std::endl;
+
+        stream << std::endl;
+        stream << "def unlanes(vector, dtype):" << std::endl;
+        stream << "    return int.from_bytes(vector.astype(dtype).tobytes(), 'little')" << std::endl;
+
+        stream << std::endl;
+        stream << "def laneadd(a, b, size, lane):" << std::endl;
+        stream << "    np, v = lanes(size, lane, a, b)" << std::endl;
+        stream << "    if np:" << std::endl;
+        stream << "        return unlanes(v[0] + v[1], v[0].dtype)" << std::endl;
+        stream << "    m = (1 << lane) - 1" << std::endl;
+        stream << "    return sum((((a >> i) + (b >> i)) & m) << i for i in range(0, size, lane))" << std::endl;
+
+        stream << std::endl;
+        stream << "def lanesub(a, b, size, lane):" << std::endl;
+        stream << "    np, v = lanes(size, lane, a, b)" << std::endl;
+        stream << "    if np:" << std::endl;
+        stream << "        return unlanes(v[0] - v[1], v[0].dtype)" << std::endl;
+        stream << "    m = (1 << lane) - 1" << std::endl;
+        stream << "    return sum((((a >> i) - (b >> i)) & m) << i for i in range(0, size, lane))" << std::endl;
+
+        stream << std::endl;
+        stream << "def laneeq(a, b, size, lane):" << std::endl;
+        stream << "    np, v = lanes(size, lane, a, b)" << std::endl;
+        stream << "    if np:" << std::endl;
+        stream << "        return unlanes(np.where(v[0] == v[1], ~v[0].dtype.type(0), v[0].dtype.type(0)), v[0].dtype)" << std::endl;
+        stream << "    m = (1 << lane) - 1" << std::endl;
+        stream << "    return sum((m if ((a >> i) & m) == ((b >> i) & m) else 0) << i for i in range(0, size, lane))" << std::endl;
+
+        stream << std::endl;
+        stream << "def lanesgt(a, b, size, lane):" << std::endl;
+        stream << "    np, v = lanes(size, lane, a, b)" << std::endl;
+        stream << "    if np:" << std::endl;
+        stream << "        signed = '<i%d' % (lane // 8)" << std::endl;
+        stream << "        return unlanes(np.where(v[0].view(signed) > v[1].view(signed), ~v[0].dtype.type(0), v[0].dtype.type(0)), v[0].dtype)" << std::endl;
+        stream << "    m = (1 << lane) - 1" << std::endl;
+        stream << "    s = 1 << (lane - 1)" << std::endl;
+        stream << "    return sum((m if (((a >> i) & m) ^ s) > (((b >> i) & m) ^ s) else 0) << i for i in range(0, size, lane))" << std::endl;
+
+        stream << std::endl;
+        stream << "def laneselect(mask, a, b, size, lane):" << std::endl;
+        stream << "    np, v = lanes(size, lane, mask, a, b)" << std::endl;
+        stream << "    if np:" << std::endl;
+        stream << "        return unlanes(np.where(v[0] >> v[0].dtype.type(lane - 1), v[1], v[2]), v[0].dtype)" << std::endl;
+        stream << "    m = (1 << lane) - 1" << std::endl;
+        stream << "    s = 1 << (lane - 1)" << std::endl;
+        stream << "    return sum((((a if (mask >> i) & s else b) >> i) & m) << i for i in range(0, size, lane))" << std::endl;
+
+        stream << std::endl;
+      }
+
+
+      std::ostream& LiftingToPython::liftToPython(std::ostream& stream, const triton::engines::symbolic::SharedSymbolicExpression& expr, bool shared) {
         /* Save the AST representation mode */
         triton::ast::representations::mode_e mode = this->astCtxt->getRepresentationMode();
         this->astCtxt->setRepresentationMode(triton::ast::representations::PYTHON_REPRESENTATION);
@@ -72,8 +135,16 @@ namespace triton {
           symVars[var->getId()] = var;
         }
 
-        /* Print required functions */
+        /* Print required functions, and the lane-wise ones if the slice has lane-wise nodes */
         this->requiredFunctions(stream);
+        for (const auto& n : triton::ast::childrenExtraction(expr->getAst(), true /* unroll */, false /* revert */)) {
+          auto type = n->getType();
+          if (type == triton::ast::BVLANEADD_NODE || type == triton::ast::BVLANEEQ_NODE || type == triton::ast::BVLANESELECT_NODE ||
+              type == triton::ast::BVLANESGT_NODE || type == triton::ast::BVLANESUB_NODE) {
+            this->laneFunctions(stream);
+            break;
+          }
+        }
 
         /* Print symbolic variables */
         for (const auto& var : symVars) {
@@ -85,9 +156,22 @@ namespace triton {
         /* Sort SSA */
         std::sort(symExprs.begin(), symExprs.end());
 
+        /* Print shared nodes once as assignments */
+        if (shared) {
+          std::vector<triton::ast::AbstractNode*> roots;
+          for (const auto& id : symExprs) {
+            roots.push_back(ssa[id]->getAst().get());
+          }
+          this->astCtxt->printBindings(stream, roots);
+        }
+
         /* Print symbolic expressions */
         for (const auto& id : symExprs) {
-          stream << ssa[id]->getFormattedExpression() << std::endl;
+          stream << *ssa[id] << std::endl;
+        }
+
+        if (shared) {
+          this->astCtxt->clearBindings();
         }
 
         /* Restore the AST representation mode */
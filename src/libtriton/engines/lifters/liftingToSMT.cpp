@@ -114,7 +114,7 @@ namespace triton {
       }
 
 
-      std::ostream& LiftingToSMT::liftToSMT(std::ostream& stream, const triton::engines::symbolic::SharedSymbolicExpression& expr, bool assert_) {
+      std::ostream& LiftingToSMT::liftToSMT(std::ostream& stream, const triton::engines::symbolic::SharedSymbolicExpression& expr, bool assert_, bool shared) {
         /* Save the AST representation mode */
         triton::ast::representations::mode_e mode = this->astCtxt->getRepresentationMode();
         this->astCtxt->setRepresentationMode(triton::ast::representations::SMT_REPRESENTATION);
@@ -150,14 +150,9 @@ namespace triton {
           symExprs.pop_back();
         }
 
-        /* Print symbolic expressions */
-        for (const auto& id : symExprs) {
-          stream << ssa[id]->getFormattedExpression() << std::endl;
-        }
-
+        /* Collect conjuncts to print in separate asserts */
+        std::vector<triton::ast::SharedAbstractNode> exprs;
         if (assert_) {
-          /* Print conjuncts in separate asserts */
-          std::vector<triton::ast::SharedAbstractNode> exprs;
           std::vector<triton::ast::SharedAbstractNode> wl{expr->getAst()};
 
           while (!wl.empty()) {
@@ -173,7 +168,26 @@ namespace triton {
               wl.push_back(child);
             }
           }
+        }
 
+        /* Print shared nodes once as functions */
+        if (shared) {
+          std::vector<triton::ast::AbstractNode*> roots;
+          for (const auto& id : symExprs) {
+            roots.push_back(ssa[id]->getAst().get());
+          }
+          for (auto it = exprs.crbegin(); it != exprs.crend(); ++it) {
+            roots.push_back(it->get());
+          }
+          this->astCtxt->printBindings(stream, roots);
+        }
+
+        /* Print symbolic expressions */
+        for (const auto& id : symExprs) {
+          stream << *ssa[id] << std::endl;
+        }
+
+        if (assert_) {
           for (auto it = exprs.crbegin(); it != exprs.crend(); ++it) {
             this->astCtxt->print(stream, this->astCtxt->assert_(*it).get());
             stream << std::endl;
@@ -183,6 +197,10 @@ namespace triton {
           stream << "(get-model)" << std::endl;
         }
 
+        if (shared) {
+          this->astCtxt->clearBindings();
+        }
+
         /* Restore the AST representation mode */
         this->astCtxt->setRepresentationMode(mode);
 
@@ -0,0 +1,991 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <functional>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <triton/analyticSolver.hpp>
+#include <triton/astContext.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/symbolicExpression.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      /* The widest term solved analytically, the products of its coefficients fit in 512 bits */
+      static const triton::uint32 maxWidth = 256;
+
+      /* The number of points of a comparison solved through the inverse of its coefficient */
+      static const triton::usize maxPoints = 16;
+
+      /* The number of candidates checked on a component before it is left to the solver */
+      static const triton::usize maxCandidates = 256;
+
+
+      /* Sorted and disjoint unsigned intervals [lo, hi] */
+      using Ranges = std::vector<std::pair<triton::uint512, triton::uint512>>;
+
+
+      /* The linear term (a * (var & mask) + b) & mask of a comparison, its mask being the one of its width */
+      struct Linear {
+        triton::engines::symbolic::SharedSymbolicVariable var;
+        triton::uint512 a = 0;
+        triton::uint512 b = 0;
+        triton::uint32 width = 0;
+      };
+
+
+      /* The comparison of a term, true if the value of the term is in the ranges */
+      struct Atom {
+        Linear term;
+        Ranges ranges;
+      };
+
+
+      /* The equality x = (s * y + d) & mask, s being 1 or -1 */
+      struct Relation {
+        triton::engines::symbolic::SharedSymbolicVariable x;
+        triton::engines::symbolic::SharedSymbolicVariable y;
+        triton::uint512 s = 0;
+        triton::uint512 d = 0;
+      };
+
+
+      /* What a conjunct is to the analytic solver */
+      enum parsed_e {
+        PARSED_NONE,      /* Not solved analytically */
+        PARSED_FALSE,     /* Constant false */
+        PARSED_TRUE,      /* Constant true */
+        PARSED_ATOM,      /* A comparison of a term */
+        PARSED_RELATION,  /* An equality of two variables */
+      };
+
+
+      /* Returns the node a reference points to, the node itself otherwise */
+      static triton::ast::AbstractNode* deref(triton::ast::AbstractNode* node) {
+        while (node->getType() == triton::ast::REFERENCE_NODE)
+          node = reinterpret_cast<triton::ast::ReferenceNode*>(node)->getSymbolicExpression()->getAst().get();
+        return node;
+      }
+
+
+      /* Returns the value of an integer node */
+      static triton::uint32 integerOf(const triton::ast::SharedAbstractNode& node) {
+        return reinterpret_cast<triton::ast::IntegerNode*>(node.get())->getInteger().convert_to<triton::uint32>();
+      }
+
+
+      /* Returns the ids of the variables of a node */
+      static std::unordered_set<triton::usize> variablesOf(const triton::ast::SharedAbstractNode& node) {
+        std::unordered_set<triton::usize> ids;
+
+        triton::ast::childrenTraversal(node, true /* unroll */, [&ids](const triton::ast::SharedAbstractNode& n) {
+          if (n->getType() == triton::ast::VARIABLE_NODE)
+            ids.insert(reinterpret_cast<triton::ast::VariableNode*>(n.get())->getSymbolicVariable()->getId());
+        });
+
+        return ids;
+      }
+
+
+      /* Returns the mask of a width */
+      static triton::uint512 maskOf(triton::uint32 width) {
+        return (triton::uint512(1) << width) - 1;
+      }
+
+
+      /* Returns the inverse of an odd value modulo 2^width, each Newton step doubling its correct bits */
+      static triton::uint512 inverseOf(const triton::uint512& value, triton::uint32 width) {
+        triton::uint512 mask = maskOf(width);
+        triton::uint512 inverse = value & mask;
+
+        for (triton::uint32 bits = 3; bits < width; bits *= 2)
+          inverse = (inverse * ((2 - ((value * inverse) & mask)) & mask)) & mask;
+
+        return inverse;
+      }
+
+
+      /* Returns true if a value is in the ranges */
+      static bool contains(const Ranges& ranges, const triton::uint512& value) {
+        for (const auto& range : ranges) {
+          if (value < range.first)
+            return false;
+          if (value <= range.second)
+            return true;
+        }
+        return false;
+      }
+
+
+      /* Sorts the ranges and merges the ones which overlap or touch */
+      static Ranges normalize(Ranges ranges) {
+        Ranges merged;
+
+        std::sort(ranges.begin(), ranges.end());
+        for (const auto& range : ranges) {
+          if (!merged.empty() && range.first <= merged.back().second + 1)
+            merged.back().second = std::max(merged.back().second, range.second);
+          else
+            merged.push_back(range);
+        }
+
+        return merged;
+      }
+
+
+      /* Returns the values of [0, mask] which are not in the ranges */
+      static Ranges complement(const Ranges& ranges, triton::uint32 width) {
+        triton::uint512 mask = maskOf(width);
+        triton::uint512 next = 0;
+        bool done = false;
+        Ranges result;
+
+        for (const auto& range : ranges) {
+          if (range.first > next)
+            result.push_back({next, range.first - 1});
+          if (range.second == mask) {
+            done = true;
+            break;
+          }
+          next = range.second + 1;
+        }
+
+        if (!done)
+          result.push_back({next, mask});
+
+        return result;
+      }
+
+
+      /* Returns the values which are in both ranges */
+      static Ranges intersect(const Ranges& lhs, const Ranges& rhs) {
+        Ranges result;
+        triton::usize i = 0;
+        triton::usize j = 0;
+
+        while (i < lhs.size() && j < rhs.size()) {
+          triton::uint512 lo = std::max(lhs[i].first, rhs[j].first);
+          triton::uint512 hi = std::min(lhs[i].second, rhs[j].second);
+
+          if (lo <= hi)
+            result.push_back({lo, hi});
+
+          if (lhs[i].second < rhs[j].second)
+            i++;
+          else
+            j++;
+        }
+
+        return result;
+      }
+
+
+      /* Returns the ranges of (s * v + k) & mask for the values v of the ranges, s being 1 or -1 */
+      static Ranges affine(const Ranges& ranges, bool negated, const triton::uint512& k, triton::uint32 width) {
+        triton::uint512 mask = maskOf(width);
+        Ranges result;
+
+        for (const auto& range : ranges) {
+          triton::uint512 lo = negated ? ((k - range.second) & mask) : ((range.first + k) & mask);
+          triton::uint512 hi = negated ? ((k - range.first) & mask) : ((range.second + k) & mask);
+
+          /* The range wraps around */
+          if (lo > hi) {
+            result.push_back({0, hi});
+            result.push_back({lo, mask});
+          }
+          else {
+            result.push_back({lo, hi});
+          }
+        }
+
+        return normalize(result);
+      }
+
+
+      /* Returns the ranges of a comparison of a term to a constant, term op value */
+      static Ranges rangesOf(triton::ast::ast_e op, const triton::uint512& value, triton::uint32 width) {
+        triton::uint512 mask = maskOf(width);
+
+        switch (op) {
+          case triton::ast::EQUAL_NODE:     return {{value, value}};
+          case triton::ast::DISTINCT_NODE:  return complement({{value, value}}, width);
+          case triton::ast::BVULT_NODE:     return value == 0 ? Ranges() : Ranges({{0, value - 1}});
+          case triton::ast::BVULE_NODE:     return {{0, value}};
+          case triton::ast::BVUGT_NODE:     return value == mask ? Ranges() : Ranges({{value + 1, mask}});
+          case triton::ast::BVUGE_NODE:     return {{value, mask}};
+          default:
+            throw triton::exceptions::SolverEngine("AnalyticSolver::rangesOf(): Invalid comparison.");
+        }
+      }
+
+
+      /* Returns the comparison of the swapped operands, a op b being b swapped(op) a */
+      static triton::ast::ast_e swapped(triton::ast::ast_e op) {
+        switch (op) {
+          case triton::ast::BVSGE_NODE: return triton::ast::BVSLE_NODE;
+          case triton::ast::BVSGT_NODE: return triton::ast::BVSLT_NODE;
+          case triton::ast::BVSLE_NODE: return triton::ast::BVSGE_NODE;
+          case triton::ast::BVSLT_NODE: return triton::ast::BVSGT_NODE;
+          case triton::ast::BVUGE_NODE: return triton::ast::BVULE_NODE;
+          case triton::ast::BVUGT_NODE: return triton::ast::BVULT_NODE;
+          case triton::ast::BVULE_NODE: return triton::ast::BVUGE_NODE;
+          case triton::ast::BVULT_NODE: return triton::ast::BVUGT_NODE;
+          default:                      return op;
+        }
+      }
+
+
+      /* Returns the unsigned comparison of a signed one, both operands being offset by 2^(width-1) */
+      static triton::ast::ast_e unsignedOf(triton::ast::ast_e op) {
+        switch (op) {
+          case triton::ast::BVSGE_NODE: return triton::ast::BVUGE_NODE;
+          case triton::ast::BVSGT_NODE: return triton::ast::BVUGT_NODE;
+          case triton::ast::BVSLE_NODE: return triton::ast::BVULE_NODE;
+          case triton::ast::BVSLT_NODE: return triton::ast::BVULT_NODE;
+          default:                      return op;
+        }
+      }
+
+
+      /* Returns the value of a term for a value of its variable */
+      static triton::uint512 evaluate(const Linear& term, const triton::uint512& value) {
+        triton::uint512 mask = maskOf(term.width);
+        return (term.a * (value & mask) + term.b) & mask;
+      }
+
+
+      /* Scales a term by a constant */
+      static void scale(Linear& term, const triton::uint512& k) {
+        triton::uint512 mask = maskOf(term.width);
+        term.a = (term.a * (k & mask)) & mask;
+        term.b = (term.b * (k & mask)) & mask;
+        if (term.a == 0)
+          term.var = nullptr;
+      }
+
+
+      /* Adds two terms of the same width, false if they have different variables */
+      static bool add(const Linear& lhs, const Linear& rhs, Linear& term) {
+        triton::uint512 mask = maskOf(lhs.width);
+
+        if (lhs.var && rhs.var && lhs.var->getId() != rhs.var->getId())
+          return false;
+
+        term.var   = lhs.var ? lhs.var : rhs.var;
+        term.a     = (lhs.a + rhs.a) & mask;
+        term.b     = (lhs.b + rhs.b) & mask;
+        term.width = lhs.width;
+        if (term.a == 0)
+          term.var = nullptr;
+
+        return true;
+      }
+
+
+      /* Computes the linear term of a bitvector node, false if it is not linear in one variable */
+      static bool linearOf(triton::ast::AbstractNode* node, Linear& term) {
+        node = deref(node);
+
+        triton::uint32 width = node->getBitvectorSize();
+        if (width == 0 || width > maxWidth)
+          return false;
+
+        term = Linear();
+        term.width = width;
+
+        if (!node->isSymbolized()) {
+          term.b = node->evaluate() & maskOf(width);
+          return true;
+        }
+
+        const auto& children = node->getChildren();
+
+        switch (node->getType()) {
+          case triton::ast::VARIABLE_NODE: {
+            term.var = reinterpret_cast<triton::ast::VariableNode*>(node)->getSymbolicVariable();
+            term.a = 1;
+            return term.var->getSize() <= maxWidth;
+          }
+
+          case triton::ast::BVADD_NODE:
+          case triton::ast::BVSUB_NODE: {
+            Linear lhs, rhs;
+            if (!linearOf(children[0].get(), lhs) || !linearOf(children[1].get(), rhs))
+              return false;
+            if (node->getType() == triton::ast::BVSUB_NODE)
+              scale(rhs, maskOf(width));
+            /* The operands of an n-ary sum (AST_NARY) are added one by one */
+            for (triton::usize index = 2; index < children.size(); index++) {
+              Linear sum;
+              if (!add(lhs, rhs, sum) || !linearOf(children[index].get(), rhs))
+                return false;
+              lhs = sum;
+            }
+            return add(lhs, rhs, term);
+          }
+
+          case triton::ast::BVNEG_NODE:
+          case triton::ast::BVNOT_NODE: {
+            if (!linearOf(children[0].get(), term))
+              return false;
+            /* ~x is -x - 1 */
+            scale(term, maskOf(width));
+            if (node->getType() == triton::ast::BVNOT_NODE)
+              term.b = (term.b + maskOf(width)) & maskOf(width);
+            return true;
+          }
+
+          case triton::ast::BVMUL_NODE: {
+            Linear lhs, rhs;
+            if (!linearOf(children[0].get(), lhs) || !linearOf(children[1].get(), rhs))
+              return false;
+            if (lhs.var && rhs.var)
+              return false;
+            term = lhs.var ? lhs : rhs;
+            scale(term, lhs.var ? rhs.b : lhs.b);
+            return true;
+          }
+
+          case triton::ast::BVSHL_NODE: {
+            Linear shift;
+            if (!linearOf(children[1].get(), shift) || shift.var)
+              return false;
+            if (!linearOf(children[0].get(), term))
+              return false;
+            if (shift.b >= width) {
+              term.var = nullptr;
+              term.a = 0;
+              term.b = 0;
+              return true;
+            }
+            scale(term, triton::uint512(1) << shift.b.convert_to<triton::uint32>());
+            return true;
+          }
+
+          /* Only the extension of a variable, its value being the one of the variable */
+          case triton::ast::ZX_NODE: {
+            Linear operand;
+            if (!linearOf(children[1].get(), operand))
+              return false;
+            if (operand.var && (operand.a != 1 || operand.b != 0 || operand.width != operand.var->getSize()))
+              return false;
+            term.var = operand.var;
+            term.a   = operand.a;
+            term.b   = operand.b;
+            return true;
+          }
+
+          /* Only the low bits, the term being computed modulo their width */
+          case triton::ast::EXTRACT_NODE: {
+            Linear operand;
+            if (integerOf(children[1]) != 0 || !linearOf(children[2].get(), operand))
+              return false;
+            term.var = operand.var;
+            term.a   = operand.a & maskOf(width);
+            term.b   = operand.b & maskOf(width);
+            if (term.a == 0)
+              term.var = nullptr;
+            return true;
+          }
+
+          default:
+            return false;
+        }
+      }
+
+
+      /* Parses a conjunct, negated if it is under an odd number of lnot */
+      static parsed_e parse(triton::ast::AbstractNode* node, bool negated, Atom& atom, Relation& relation) {
+        node = deref(node);
+
+        if (!node->isSymbolized())
+          return ((node->evaluate() != 0) != negated) ? PARSED_TRUE : PARSED_FALSE;
+
+        const auto& children = node->getChildren();
+        triton::ast::ast_e op = node->getType();
+
+        switch (op) {
+          case triton::ast::LNOT_NODE:
+            return parse(children[0].get(), !negated, atom, relation);
+
+          case triton::ast::EQUAL_NODE:
+          case triton::ast::DISTINCT_NODE:
+          case triton::ast::BVSGE_NODE:
+          case triton::ast::BVSGT_NODE:
+          case triton::ast::BVSLE_NODE:
+          case triton::ast::BVSLT_NODE:
+          case triton::ast::BVUGE_NODE:
+          case triton::ast::BVUGT_NODE:
+          case triton::ast::BVULE_NODE:
+          case triton::ast::BVULT_NODE:
+            break;
+
+          default:
+            return PARSED_NONE;
+        }
+
+        triton::ast::AbstractNode* lhs = deref(children[0].get());
+        triton::ast::AbstractNode* rhs = deref(children[1].get());
+
+        /* The flags, (ite cond k1 k2) compared to a constant, are their condition or its negation */
+        if (op == triton::ast::EQUAL_NODE || op == triton::ast::DISTINCT_NODE) {
+          if (lhs->getType() != triton::ast::ITE_NODE)
+            std::swap(lhs, rhs);
+
+          if (lhs->getType() == triton::ast::ITE_NODE && !rhs->isSymbolized()) {
+            const auto& branches = lhs->getChildren();
+            if (!branches[1]->isSymbolized() && !branches[2]->isSymbolized()) {
+              triton::uint512 value = rhs->evaluate();
+              bool whenTrue  = (branches[1]->evaluate() == value) != (op == triton::ast::DISTINCT_NODE);
+              bool whenFalse = (branches[2]->evaluate() == value) != (op == triton::ast::DISTINCT_NODE);
+              if (whenTrue == whenFalse)
+                return (whenTrue != negated) ? PARSED_TRUE : PARSED_FALSE;
+              return parse(branches[0].get(), negated != whenFalse, atom, relation);
+            }
+          }
+        }
+
+        Linear left, right;
+        if (!linearOf(lhs, left) || !linearOf(rhs, right))
+          return PARSED_NONE;
+
+        triton::uint32 width = left.width;
+        triton::uint512 mask = maskOf(width);
+        triton::uint512 value = 0;
+
+        if (op == triton::ast::EQUAL_NODE || op == triton::ast::DISTINCT_NODE) {
+          /* An equality of two variables, both solved from the one of them */
+          if (left.var && right.var && left.var->getId() != right.var->getId()) {
+            bool unit = (left.a == 1 || left.a == mask) && (right.a == 1 || right.a == mask);
+            bool full = left.var->getSize() == width && right.var->getSize() == width;
+            if ((op == triton::ast::EQUAL_NODE) == negated || !unit || !full)
+              return PARSED_NONE;
+            /* a1.x + b1 = a2.y + b2, so x = a1.a2.y + a1.(b2 - b1) */
+            relation.x = left.var;
+            relation.y = right.var;
+            relation.s = (left.a * right.a) & mask;
+            relation.d = (left.a * ((right.b - left.b) & mask)) & mask;
+            return PARSED_RELATION;
+          }
+          /* left - right compared to zero */
+          scale(right, mask);
+          if (!add(left, right, atom.term))
+            return PARSED_NONE;
+        }
+        else {
+          if (right.var && left.var)
+            return PARSED_NONE;
+          if (right.var) {
+            std::swap(left, right);
+            op = swapped(op);
+          }
+          atom.term = left;
+          value = right.b;
+        }
+
+        /* The signed orders are the unsigned ones of the operands offset by 2^(width-1) */
+        if (unsignedOf(op) != op) {
+          triton::uint512 offset = triton::uint512(1) << (width - 1);
+          atom.term.b = (atom.term.b + offset) & mask;
+          value = (value + offset) & mask;
+          op = unsignedOf(op);
+        }
+
+        atom.ranges = rangesOf(op, value, width);
+        if (negated)
+          atom.ranges = complement(atom.ranges, width);
+
+        if (atom.term.var == nullptr)
+          return contains(atom.ranges, atom.term.b) ? PARSED_TRUE : PARSED_FALSE;
+
+        if (atom.ranges.empty())
+          return PARSED_FALSE;
+
+        if (atom.ranges.size() == 1 && atom.ranges.front().first == 0 && atom.ranges.front().second == mask)
+          return PARSED_TRUE;
+
+        return PARSED_ATOM;
+      }
+
+
+      /* Computes the values of the variable of an atom satisfying it, false if they are not intervals of the variable */
+      static bool preimage(const Atom& atom, Ranges& values) {
+        const Linear& term = atom.term;
+        triton::uint32 size = term.var->getSize();
+        triton::uint512 mask = maskOf(term.width);
+        Ranges base;
+
+        /* Only the low bits of the variable are compared */
+        if (term.width < size)
+          return false;
+
+        if (term.a == 1 || term.a == mask) {
+          /* a.v + b in R, so v in a.(R - b) */
+          base = affine(atom.ranges, term.a == mask, term.a == mask ? term.b : ((0 - term.b) & mask), term.width);
+        }
+        else if ((term.a & 1) == 1) {
+          triton::uint512 inverse = inverseOf(term.a, term.width);
+          triton::usize points = 0;
+
+          for (const auto& range : atom.ranges) {
+            points += (range.second - range.first).convert_to<triton::usize>() + 1;
+            if (range.second - range.first >= maxPoints || points > maxPoints)
+              return false;
+            for (triton::uint512 p = range.first; p <= range.second; p++) {
+              triton::uint512 v = (inverse * ((p - term.b) & mask)) & mask;
+              base.push_back({v, v});
+            }
+          }
+          base = normalize(base);
+        }
+        else {
+          return false;
+        }
+
+        /* A zero extension, the variable has fewer bits than the term */
+        values = intersect(base, {{0, maskOf(size)}});
+
+        return true;
+      }
+
+
+      /* The variables of a component related by their equalities, each one being (s * root + d) & mask */
+      class Relations {
+        private:
+          struct Parent {
+            triton::usize id;
+            triton::uint512 s;
+            triton::uint512 d;
+          };
+
+          std::unordered_map<triton::usize, Parent> parents;
+
+        public:
+          /* A variable x is (s * root + d) & mask, s being 1 or -1 */
+          triton::usize find(triton::usize id, triton::uint512& s, triton::uint512& d, triton::uint32 size) {
+            triton::uint512 mask = maskOf(size);
+            s = 1;
+            d = 0;
+
+            auto it = this->parents.find(id);
+            while (it != this->parents.end()) {
+              /* x = s.p + d and p = s'.q + d', so x = s.s'.q + s.d' + d */
+              d = (s * it->second.d + d) & mask;
+              s = (s * it->second.s) & mask;
+              id = it->second.id;
+              it = this->parents.find(id);
+            }
+
+            return id;
+          }
+
+          /* Relates the roots of x and y, the relation being x = (s * y + d) & mask. Returns the atom on the root if they are already related */
+          bool relate(const Relation& relation, Atom& atom) {
+            triton::uint32 size = relation.x->getSize();
+            triton::uint512 mask = maskOf(size);
+            triton::uint512 sx, dx, sy, dy;
+
+            triton::usize rx = this->find(relation.x->getId(), sx, dx, size);
+            triton::usize ry = this->find(relation.y->getId(), sy, dy, size);
+
+            /* sx.r + dx = s.(sy.r + dy) + d, so (sx - s.sy).r + (dx - s.dy - d) = 0 */
+            if (rx == ry) {
+              atom.term.a     = (sx - relation.s * sy) & mask;
+              atom.term.b     = (dx - relation.s * dy - relation.d) & mask;
+              atom.term.width = size;
+              atom.ranges     = {{0, 0}};
+              return true;
+            }
+
+            /* rx = sx.(x - dx) = sx.(s.(sy.ry + dy) + d - dx) */
+            Parent parent;
+            parent.id = ry;
+            parent.s  = (sx * relation.s * sy) & mask;
+            parent.d  = (sx * ((relation.s * dy + relation.d - dx) & mask)) & mask;
+            this->parents[rx] = parent;
+
+            return false;
+          }
+      };
+
+
+      /* Solves the atoms of the variables sharing a root, filling their values if they are SAT */
+      static triton::engines::solver::status_e solveRoot(const triton::ast::SharedAstContext& ctxt, Relations& related, triton::usize root, const std::vector<Atom>& atoms,
+          const std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicVariable>& variables, std::vector<SolverModel>& values) {
+        const auto& rootVar = variables.at(root);
+        triton::uint32 size = rootVar->getSize();
+        triton::uint512 mask = maskOf(size);
+        Ranges domain = {{0, mask}};
+        std::vector<Atom> checks;
+        triton::uint512 s, d;
+
+        for (Atom atom : atoms) {
+          if (related.find(atom.term.var->getId(), s, d, size) != root)
+            continue;
+
+          /* The relations of a variable built from its root, x being (s * r + d) & mask */
+          if (atom.term.var->getId() != root && atom.term.width == size) {
+            atom.term.b   = (atom.term.a * d + atom.term.b) & mask;
+            atom.term.a   = (atom.term.a * s) & mask;
+            atom.term.var = rootVar;
+            if (atom.term.a == 0) {
+              if (!contains(atom.ranges, atom.term.b))
+                return triton::engines::solver::UNSAT;
+              continue;
+            }
+          }
+
+          Ranges pre;
+          if (atom.term.var->getId() == root && preimage(atom, pre)) {
+            domain = intersect(domain, pre);
+            if (domain.empty())
+              return triton::engines::solver::UNSAT;
+          }
+          else {
+            checks.push_back(atom);
+          }
+        }
+
+        /* The values of the variables for a value of the root */
+        auto valuesOf = [&](const triton::uint512& value) {
+          std::unordered_map<triton::usize, triton::uint512> out;
+          for (const auto& var : variables) {
+            triton::uint512 vs, vd;
+            if (related.find(var.first, vs, vd, size) == root)
+              out[var.first] = (vs * value + vd) & mask;
+          }
+          return out;
+        };
+
+        auto satisfies = [&](const triton::uint512& value) {
+          if (!contains(domain, value))
+            return false;
+          if (checks.empty())
+            return true;
+          std::unordered_map<triton::usize, triton::uint512> current = valuesOf(value);
+          for (const auto& check : checks) {
+            if (!contains(check.ranges, evaluate(check.term, current[check.term.var->getId()])))
+              return false;
+          }
+          return true;
+        };
+
+        /* The concrete value of a variable, 0 if it is unknown */
+        auto concreteOf = [&ctxt](const triton::engines::symbolic::SharedSymbolicVariable& var) -> triton::uint512 {
+          try {
+            return ctxt->getVariableValue(var->getId()) & maskOf(var->getSize());
+          }
+          catch (const triton::exceptions::Exception&) {
+          }
+          return 0;
+        };
+
+        /* The concrete value is kept if it is a solution, the model staying close to the current input */
+        std::vector<triton::uint512> candidates = {concreteOf(rootVar)};
+
+        /* The low bits satisfying a check, the high bits being the concrete ones */
+        for (const auto& check : checks) {
+          const Linear& term = check.term;
+          triton::uint512 m = maskOf(term.width);
+
+          if (term.width >= term.var->getSize() || (term.a & 1) == 0)
+            continue;
+
+          Ranges low;
+          if (term.a == 1 || term.a == m)
+            low = affine(check.ranges, term.a == m, term.a == m ? term.b : ((0 - term.b) & m), term.width);
+          else if (check.ranges.front().first == check.ranges.front().second) {
+            triton::uint512 v = (inverseOf(term.a, term.width) * ((check.ranges.front().first - term.b) & m)) & m;
+            low = {{v, v}};
+          }
+
+          related.find(term.var->getId(), s, d, size);
+          triton::uint512 high = concreteOf(term.var) & ~m;
+
+          for (triton::usize i = 0; i < low.size() && i < 2; i++) {
+            /* r = s.(x - d) */
+            triton::uint512 x = high | low[i].first;
+            candidates.push_back((s * ((x - d) & mask)) & mask);
+          }
+        }
+
+        for (const auto& range : domain) {
+          candidates.push_back(range.first);
+          candidates.push_back(range.second);
+        }
+
+        /* Then the first values of each interval */
+        for (const auto& range : domain) {
+          for (triton::uint512 v = range.first + 1; v < range.second && candidates.size() < maxCandidates; v++)
+            candidates.push_back(v);
+        }
+
+        for (triton::usize i = 0; i < candidates.size() && i < maxCandidates; i++) {
+          if (satisfies(candidates[i])) {
+            for (const auto& value : valuesOf(candidates[i]))
+              values.push_back(SolverModel(variables.at(value.first), value.second));
+            return triton::engines::solver::SAT;
+          }
+        }
+
+        return triton::engines::solver::UNKNOWN;
+      }
+
+
+      /* Solves the atoms and relations of a component, filling the values of its variables if it is SAT */
+      static triton::engines::solver::status_e solveComponent(const triton::ast::SharedAstContext& ctxt, std::vector<Atom>& atoms, const std::vector<Relation>& relations,
+          const std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicVariable>& variables, std::vector<SolverModel>& values) {
+        Relations related;
+        triton::uint512 s, d;
+
+        for (const auto& relation : relations) {
+          Atom atom;
+          if (related.relate(relation, atom)) {
+            if (atom.term.a == 0) {
+              if (atom.term.b != 0)
+                return triton::engines::solver::UNSAT;
+              continue;
+            }
+            /* The equalities closing a cycle are atoms on the root */
+            atom.term.var = variables.at(related.find(relation.x->getId(), s, d, relation.x->getSize()));
+            atoms.push_back(atom);
+          }
+        }
+
+        /* The variables of a conjunct are not all in its term, e.g. x == y * 0, a component may have several roots */
+        std::vector<triton::usize> roots;
+        for (const auto& var : variables) {
+          triton::usize root = related.find(var.first, s, d, var.second->getSize());
+          if (root == var.first)
+            roots.push_back(root);
+        }
+
+        /* The values are only kept if the whole component is solved, otherwise it is left to the solver */
+        std::vector<SolverModel> solution;
+        triton::engines::solver::status_e st = triton::engines::solver::SAT;
+
+        for (auto root : roots) {
+          triton::engines::solver::status_e rst = solveRoot(ctxt, related, root, atoms, variables, solution);
+          if (rst == triton::engines::solver::UNSAT)
+            return rst;
+          if (rst == triton::engines::solver::UNKNOWN)
+            st = rst;
+        }
+
+        if (st == triton::engines::solver::SAT)
+          values.insert(values.end(), solution.begin(), solution.end());
+
+        return st;
+      }
+
+
+      AnalyticSolver::AnalyticSolver() {
+        this->decided   = 0;
+        this->delegated = 0;
+        this->enabled   = false;
+        this->queries   = 0;
+        this->variables = 0;
+      }
+
+
+      bool AnalyticSolver::isEnabled(void) const {
+        return this->enabled;
+      }
+
+
+      void AnalyticSolver::setEnabled(bool flag) {
+        this->enabled = flag;
+      }
+
+
+      AnalyticQuery AnalyticSolver::solve(const triton::ast::SharedAbstractNode& node) const {
+        std::vector<triton::ast::SharedAbstractNode> conjuncts;
+        std::vector<triton::ast::SharedAbstractNode> worklist = {node};
+        AnalyticQuery query;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("AnalyticSolver::solve(): node cannot be null.");
+
+        const triton::ast::SharedAstContext& ctxt = node->getContext();
+
+        /* Flattens the conjunction */
+        while (!worklist.empty()) {
+          triton::ast::SharedAbstractNode conjunct = worklist.back();
+          triton::ast::AbstractNode* ast = deref(conjunct.get());
+          worklist.pop_back();
+
+          if (ast->getType() == triton::ast::LAND_NODE) {
+            const auto& children = ast->getChildren();
+            worklist.insert(worklist.end(), children.rbegin(), children.rend());
+          }
+          else {
+            conjuncts.push_back(conjunct);
+          }
+        }
+
+        /* The components of the variables sharing a conjunct */
+        std::unordered_map<triton::usize, triton::usize> components;
+        std::vector<std::unordered_set<triton::usize>> ids(conjuncts.size());
+
+        std::function<triton::usize(triton::usize)> find = [&](triton::usize id) {
+          auto it = components.find(id);
+          if (it == components.end() || it->second == id)
+            return id;
+          return it->second = find(it->second);
+        };
+
+        std::vector<parsed_e> kinds(conjuncts.size(), PARSED_NONE);
+        std::vector<Atom> atoms(conjuncts.size());
+        std::vector<Relation> relations(conjuncts.size());
+
+        for (triton::usize i = 0; i < conjuncts.size() && query.decided == triton::engines::solver::UNKNOWN; i++) {
+          ids[i] = variablesOf(conjuncts[i]);
+
+          for (auto id : ids[i]) {
+            if (components.find(id) == components.end())
+              components[id] = id;
+            components[find(id)] = find(*ids[i].begin());
+          }
+
+          kinds[i] = parse(conjuncts[i].get(), false, atoms[i], relations[i]);
+          if (kinds[i] == PARSED_FALSE)
+            query.decided = triton::engines::solver::UNSAT;
+        }
+
+        if (query.decided == triton::engines::solver::UNSAT) {
+          std::lock_guard<std::mutex> guard(this->lock);
+          this->queries++;
+          this->decided++;
+          return query;
+        }
+
+        /* A component is solved if all its conjuncts are parsed */
+        struct Component {
+          bool parsed = true;
+          std::vector<triton::usize> conjuncts;
+          std::vector<Atom> atoms;
+          std::vector<Relation> relations;
+          std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicVariable> variables;
+        };
+
+        std::unordered_map<triton::usize, Component> solved;
+        std::vector<triton::usize> order;
+
+        for (triton::usize i = 0; i < conjuncts.size(); i++) {
+          if (ids[i].empty())
+            continue;
+
+          triton::usize root = find(*ids[i].begin());
+          if (solved.find(root) == solved.end())
+            order.push_back(root);
+
+          Component& component = solved[root];
+          component.conjuncts.push_back(i);
+
+          switch (kinds[i]) {
+            case PARSED_ATOM:
+              component.atoms.push_back(atoms[i]);
+              component.variables[atoms[i].term.var->getId()] = atoms[i].term.var;
+              break;
+
+            case PARSED_RELATION:
+              component.relations.push_back(relations[i]);
+              component.variables[relations[i].x->getId()] = relations[i].x;
+              component.variables[relations[i].y->getId()] = relations[i].y;
+              break;
+
+            case PARSED_TRUE:
+              break;
+
+            default:
+              component.parsed = false;
+              break;
+          }
+        }
+
+        std::vector<triton::ast::SharedAbstractNode> residue;
+        triton::usize variables = 0;
+
+        for (auto root : order) {
+          Component& component = solved[root];
+          triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+
+          /* Only constant conjuncts, e.g. x == x */
+          if (component.parsed && component.variables.empty())
+            st = triton::engines::solver::SAT;
+          else if (component.parsed)
+            st = solveComponent(ctxt, component.atoms, component.relations, component.variables, query.values);
+
+          if (st == triton::engines::solver::UNSAT) {
+            query.decided = triton::engines::solver::UNSAT;
+            query.values.clear();
+            break;
+          }
+
+          if (st == triton::engines::solver::SAT) {
+            variables += component.variables.size();
+            continue;
+          }
+
+          for (auto index : component.conjuncts)
+            residue.push_back(conjuncts[index]);
+        }
+
+        if (query.decided == triton::engines::solver::UNKNOWN) {
+          if (residue.empty())
+            query.decided = triton::engines::solver::SAT;
+          else if (residue.size() == conjuncts.size())
+            query.residue = node;
+          else if (residue.size() == 1)
+            query.residue = residue.front();
+          else
+            query.residue = ctxt->land(residue);
+        }
+
+        std::lock_guard<std::mutex> guard(this->lock);
+        this->queries++;
+        this->decided   += (query.decided != triton::engines::solver::UNKNOWN);
+        this->delegated += (query.residue != nullptr);
+        this->variables += (query.decided == triton::engines::solver::UNSAT) ? 0 : variables;
+
+        return query;
+      }
+
+
+      triton::usize AnalyticSolver::getQueries(void) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->queries;
+      }
+
+
+      triton::usize AnalyticSolver::getDecided(void) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->decided;
+      }
+
+
+      triton::usize AnalyticSolver::getDelegated(void) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->delegated;
+      }
+
+
+      triton::usize AnalyticSolver::getVariables(void) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->variables;
+      }
+
+    };
+  };
+};
@@ -8,11 +8,13 @@
 #include <fstream>
 #include <regex>
 #include <string>
+#include <unordered_set>
 
 #include <triton/astContext.hpp>
 #include <triton/bitwuzlaSolver.hpp>
 #include <triton/exceptions.hpp>
 #include <triton/solverModel.hpp>
+#include <triton/solverProfiles.hpp>
 #include <triton/symbolicExpression.hpp>
 #include <triton/symbolicVariable.hpp>
 #include <triton/tritonToBitwuzla.hpp>
@@ -26,6 +28,7 @@ namespace triton {
       BitwuzlaSolver::BitwuzlaSolver() {
         this->timeout = 0;
         this->memoryLimit = 0;
+        this->interrupted = false;
 
         // Set bitwuzla abort function.
         bitwuzla_set_abort_callback(this->abortCallback);
@@ -35,6 +38,12 @@ namespace triton {
       int32_t BitwuzlaSolver::terminateCallback(void* state) {
         auto p = reinterpret_cast<SolverParams*>(state);
 
+        // Check interruption.
+        if (p->interrupted->load()) {
+          p->status = triton::engines::solver::UNKNOWN;
+          return 1;
+        }
+
         // Count elapsed time.
         auto delta = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now() - p->start).count();
 
@@ -92,11 +101,35 @@ namespace triton {
                                                                                             triton::engines::solver::status_e* status,
                                                                                             triton::uint32 timeout,
                                                                                             triton::uint32* solvingTime) const {
+        std::vector<std::unordered_map<triton::usize, SolverModel>> ret;
+
+        this->enumerateModels(node, limit, [&ret](const std::unordered_map<triton::usize, SolverModel>& model) {
+          ret.push_back(model);
+          return true;
+        }, {}, status, timeout, solvingTime);
+
+        return ret;
+      }
+
+
+      triton::usize BitwuzlaSolver::enumerateModels(const triton::ast::SharedAbstractNode& node,
+                                                    triton::uint32 limit,
+                                                    const ModelCallback& callback,
+                                                    const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& variables,
+                                                    triton::engines::solver::status_e* status,
+                                                    triton::uint32 timeout,
+                                                    triton::uint32* solvingTime) const {
+        std::unordered_set<triton::usize> projection;
+        triton::usize count = 0;
+
         if (node == nullptr)
-          throw triton::exceptions::SolverEngine("BitwuzlaSolver::getModels(): Node cannot be null.");
+          throw triton::exceptions::SolverEngine("BitwuzlaSolver::enumerateModels(): Node cannot be null.");
 
         if (node->isLogical() == false)
-          throw triton::exceptions::SolverEngine("BitwuzlaSolver::getModels(): Must be a logical node.");
+          throw triton::exceptions::SolverEngine("BitwuzlaSolver::enumerateModels(): Must be a logical node.");
+
+        for (const auto& var : variables)
+          projection.insert(var->getId());
 
         // Create solver.
         auto bzla = bitwuzla_new();
@@ -105,15 +138,19 @@ namespace triton {
           bitwuzla_set_option(bzla, BITWUZLA_OPT_INCREMENTAL, 1);
         }
 
+        // The engine of the profile of the query (see SolverProfileScope), the propagation-based ones only check once.
+        const SolverProfile* profile = SolverProfileScope::current();
+        if (profile && !profile->engine.empty() && limit <= 1) {
+          bitwuzla_set_option_str(bzla, BITWUZLA_OPT_ENGINE, profile->engine.c_str());
+        }
+
         // Convert Triton' AST to solver terms.
         auto bzlaAst = triton::ast::TritonToBitwuzla();
         bitwuzla_assert(bzla, bzlaAst.convert(node, bzla));
 
-        // Set solving params.
-        SolverParams p(this->timeout, this->memoryLimit);
-        if (this->timeout || this->memoryLimit) {
-          bitwuzla_set_termination_callback(bzla, this->terminateCallback, reinterpret_cast<void*>(&p));
-        }
+        // Set solving params. The callback also polls the interruption of the solver.
+        SolverParams p(timeout ? timeout : this->timeout, this->memoryLimit, &this->interrupted);
+        bitwuzla_set_termination_callback(bzla, this->terminateCallback, reinterpret_cast<void*>(&p));
 
         // Get time of solving start.
         auto start = std::chrono::system_clock::now();
@@ -136,14 +173,17 @@ namespace triton {
           }
         }
 
-        std::vector<std::unordered_map<triton::usize, SolverModel>> ret;
         while(res == BITWUZLA_SAT && limit >= 1) {
           std::vector<const BitwuzlaTerm*> solution;
           solution.reserve(bzlaAst.getVariables().size());
 
-          // Parse model.
+          // Parse model, only the variables of the projection are enumerated.
           std::unordered_map<triton::usize, SolverModel> model;
           for (const auto& it : bzlaAst.getVariables()) {
+            if (!projection.empty() && projection.find(it.second->getId()) == projection.end()) {
+              continue;
+            }
+
             const char* svalue = bitwuzla_get_bv_value(bzla, it.first);
             auto value = this->fromBvalueToUint512(svalue);
             auto m = SolverModel(it.second, value);
@@ -161,8 +201,19 @@ namespace triton {
             break;
           }
 
-          // Push model.
-          ret.push_back(model);
+          // Hand out the model, the caller may stop the enumeration.
+          count++;
+          bool next = false;
+          try {
+            next = callback(model);
+          }
+          catch (...) {
+            bitwuzla_delete(bzla);
+            throw;
+          }
+          if (!next) {
+            break;
+          }
 
           if (--limit) {
             // Escape last model.
@@ -186,7 +237,7 @@ namespace triton {
 
         bitwuzla_delete(bzla);
 
-        return ret;
+        return count;
       }
 
 
@@ -202,6 +253,80 @@ namespace triton {
       }
 
 
+      std::vector<triton::ast::SharedAbstractNode> BitwuzlaSolver::getUnsatCore(const std::vector<triton::ast::SharedAbstractNode>& conjuncts, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        std::unordered_map<const BitwuzlaTerm*, triton::usize> indexes;
+        std::vector<triton::ast::SharedAbstractNode> core;
+
+        if (conjuncts.empty())
+          throw triton::exceptions::SolverEngine("BitwuzlaSolver::getUnsatCore(): Expects at least one conjunct.");
+
+        for (const auto& node : conjuncts) {
+          if (node == nullptr)
+            throw triton::exceptions::SolverEngine("BitwuzlaSolver::getUnsatCore(): Node cannot be null.");
+          if (node->isLogical() == false)
+            throw triton::exceptions::SolverEngine("BitwuzlaSolver::getUnsatCore(): Must be a logical node.");
+        }
+
+        // Create solver. The unsat assumptions are only computed by an incremental solver.
+        auto bzla = bitwuzla_new();
+        bitwuzla_set_option(bzla, BITWUZLA_OPT_INCREMENTAL, 1);
+
+        // Convert Triton' AST to solver terms, each conjunct is assumed.
+        auto bzlaAst = triton::ast::TritonToBitwuzla();
+        for (triton::usize i = 0; i < conjuncts.size(); i++) {
+          auto term = bzlaAst.convert(conjuncts[i], bzla);
+          indexes.emplace(term, i);
+          bitwuzla_assume(bzla, term);
+        }
+
+        // Set solving params. The callback also polls the interruption of the solver.
+        SolverParams p(timeout ? timeout : this->timeout, this->memoryLimit, &this->interrupted);
+        bitwuzla_set_termination_callback(bzla, this->terminateCallback, reinterpret_cast<void*>(&p));
+
+        // Get time of solving start.
+        auto start = std::chrono::system_clock::now();
+
+        // Check result.
+        auto res = bitwuzla_check_sat(bzla);
+
+        // Get time of solving end.
+        auto end = std::chrono::system_clock::now();
+
+        if (solvingTime)
+          *solvingTime = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+
+        // Write back status.
+        if (status) {
+          switch (res) {
+            case BITWUZLA_SAT:
+              *status = triton::engines::solver::SAT;
+              break;
+            case BITWUZLA_UNSAT:
+              *status = triton::engines::solver::UNSAT;
+              break;
+            case BITWUZLA_UNKNOWN:
+              *status = p.status;
+              break;
+          }
+        }
+
+        // Map the unsat assumptions back to their conjuncts.
+        if (res == BITWUZLA_UNSAT) {
+          size_t size = 0;
+          auto assumptions = bitwuzla_get_unsat_assumptions(bzla, &size);
+          for (size_t i = 0; i < size; i++) {
+            auto it = indexes.find(assumptions[i]);
+            if (it != indexes.end())
+              core.push_back(conjuncts[it->second]);
+          }
+        }
+
+        bitwuzla_delete(bzla);
+
+        return core;
+      }
+
+
       std::unordered_map<triton::usize, SolverModel> BitwuzlaSolver::getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
         auto models = this->getModels(node, 1, status, timeout, solvingTime);
         return models.empty() ? std::unordered_map<triton::usize, SolverModel>() : models.front();
@@ -247,6 +372,11 @@ namespace triton {
       }
 
 
+      void BitwuzlaSolver::interrupt(void) {
+        this->interrupted = true;
+      }
+
+
       triton::uint512 BitwuzlaSolver::fromBvalueToUint512(const char* value) const {
         triton::usize   len = strlen(value);
         triton::usize   pos = 0;
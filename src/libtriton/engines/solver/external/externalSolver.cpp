@@ -0,0 +1,593 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <chrono>
+#include <exception>
+#include <sstream>
+
+#include <triton/exceptions.hpp>
+#include <triton/externalSolver.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      /* Splits an answer into its parentheses, symbols and literals */
+      static std::vector<std::string> tokenize(const std::string& answer) {
+        std::vector<std::string> tokens;
+        std::string token;
+
+        for (triton::usize index = 0; index < answer.size(); index++) {
+          char c = answer[index];
+
+          if (c == '|') {
+            triton::usize end = answer.find('|', index + 1);
+            if (end == std::string::npos)
+              end = answer.size();
+            token += answer.substr(index + 1, end - index - 1);
+            index = end;
+          }
+          else if (c == '(' || c == ')' || c == ' ' || c == '\t' || c == '\r' || c == '\n') {
+            if (!token.empty())
+              tokens.push_back(token);
+            if (c == '(' || c == ')')
+              tokens.push_back(std::string(1, c));
+            token.clear();
+          }
+          else {
+            token += c;
+          }
+        }
+
+        if (!token.empty())
+          tokens.push_back(token);
+
+        return tokens;
+      }
+
+
+      /* Parses the value #x.., #b.. or (_ bv.. size) starting at tokens[index] */
+      static bool parseValue(const std::vector<std::string>& tokens, triton::usize& index, triton::uint512& value) {
+        value = 0;
+
+        if (index >= tokens.size())
+          return false;
+
+        const std::string& token = tokens[index];
+
+        if (token.size() > 2 && token[0] == '#' && token[1] == 'x') {
+          for (triton::usize i = 2; i < token.size(); i++) {
+            char c = token[i];
+            triton::uint32 digit = (c >= '0' && c <= '9') ? c - '0' : (c | 0x20) - 'a' + 10;
+            value = (value << 4) | digit;
+          }
+          return true;
+        }
+
+        if (token.size() > 2 && token[0] == '#' && token[1] == 'b') {
+          for (triton::usize i = 2; i < token.size(); i++)
+            value = (value << 1) | (token[i] - '0');
+          return true;
+        }
+
+        if (token == "(" && index + 4 < tokens.size() && tokens[index + 1] == "_" && tokens[index + 2].compare(0, 2, "bv") == 0) {
+          for (triton::usize i = 2; i < tokens[index + 2].size(); i++)
+            value = value * 10 + (tokens[index + 2][i] - '0');
+          index += 4;
+          return true;
+        }
+
+        return false;
+      }
+
+
+      ExternalSolver::ExternalSolver() {
+        this->interrupted = false;
+        this->memoryLimit = 0;
+        this->poolSize    = 4;
+        this->timeout     = 0;
+        this->sessionLog.assign(1, "");
+      }
+
+
+      ExternalSolver::ExternalSolver(const ExternalSolver& other) {
+        this->interrupted = false;
+        this->memoryLimit = other.memoryLimit;
+        this->pool        = other.pool;
+        this->poolSize    = other.poolSize;
+        this->timeout     = other.timeout;
+        this->sessionLog.assign(1, "");
+      }
+
+
+      std::unique_ptr<Smt2Process> ExternalSolver::acquire(void) const {
+        std::unique_ptr<Smt2Process> process = this->pool->acquire();
+
+        std::lock_guard<std::mutex> guard(this->runningLock);
+        this->running.insert(process.get());
+
+        return process;
+      }
+
+
+      void ExternalSolver::release(std::unique_ptr<Smt2Process> process, bool reuse) const {
+        {
+          std::lock_guard<std::mutex> guard(this->runningLock);
+          this->running.erase(process.get());
+        }
+
+        if (reuse)
+          this->pool->release(std::move(process));
+      }
+
+
+      triton::uint32 ExternalSolver::getQueryTimeout(triton::uint32 timeout) const {
+        return timeout ? timeout : this->timeout;
+      }
+
+
+      triton::ast::SharedAbstractNode ExternalSolver::getQueryNode(const triton::ast::SharedAbstractNode& node, const char* where) const {
+        triton::ast::SharedAbstractNode onode = node;
+
+        if (onode == nullptr)
+          throw triton::exceptions::SolverEngine(std::string(where) + ": node cannot be null.");
+
+        /* The query is asserted, not its assert() */
+        if (onode->getType() == triton::ast::ASSERT_NODE)
+          onode = onode->getChildren()[0];
+
+        if (onode->isLogical() == false)
+          throw triton::exceptions::SolverEngine(std::string(where) + ": Must be a logical node.");
+
+        if (this->pool == nullptr)
+          throw triton::exceptions::SolverEngine(std::string(where) + ": No command defined.");
+
+        return onode;
+      }
+
+
+      triton::engines::solver::status_e ExternalSolver::check(Smt2Process& process, const std::string& commands, triton::uint32 timeout, bool& healthy) const {
+        std::string errors;
+        std::string answer;
+
+        if (!process.send(commands + "(check-sat)\n")) {
+          healthy = false;
+          return this->memoryLimit ? triton::engines::solver::OUTOFMEM : triton::engines::solver::UNKNOWN;
+        }
+
+        /* The errors of the commands come before the answer of check-sat */
+        while (true) {
+          if (!process.receive(answer, timeout)) {
+            healthy = false;
+            if (this->interrupted)
+              return triton::engines::solver::UNKNOWN;
+            if (process.isAlive()) {
+              process.kill();
+              return triton::engines::solver::TIMEOUT;
+            }
+            return this->memoryLimit ? triton::engines::solver::OUTOFMEM : triton::engines::solver::UNKNOWN;
+          }
+
+          if (answer.compare(0, 6, "(error") != 0)
+            break;
+
+          errors += answer;
+        }
+
+        if (!errors.empty()) {
+          healthy = false;
+          throw triton::exceptions::SolverEngine("ExternalSolver::check(): " + errors);
+        }
+
+        if (answer == "sat")
+          return triton::engines::solver::SAT;
+
+        if (answer == "unsat")
+          return triton::engines::solver::UNSAT;
+
+        if (answer == "unknown" || answer == "timeout")
+          return triton::engines::solver::UNKNOWN;
+
+        healthy = false;
+        throw triton::exceptions::SolverEngine("ExternalSolver::check(): Unexpected answer: " + answer);
+      }
+
+
+      bool ExternalSolver::getValues(Smt2Process& process, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& variables, triton::uint32 timeout, std::unordered_map<triton::usize, SolverModel>& model) const {
+        std::unordered_map<std::string, triton::engines::symbolic::SharedSymbolicVariable> names;
+        std::string answer = "(get-value (";
+
+        for (const auto& var : variables) {
+          names[var->getName()] = var;
+          answer += " " + var->getName();
+        }
+
+        if (!process.send(answer + "))\n") || !process.receive(answer, timeout)) {
+          process.kill();
+          return false;
+        }
+
+        if (answer.compare(0, 6, "(error") == 0)
+          throw triton::exceptions::SolverEngine("ExternalSolver::getValues(): " + answer);
+
+        std::vector<std::string> tokens = tokenize(answer);
+        for (triton::usize index = 0; index < tokens.size(); index++) {
+          auto it = names.find(tokens[index]);
+          if (it == names.end())
+            continue;
+
+          triton::uint512 value = 0;
+          if (parseValue(tokens, ++index, value)) {
+            SolverModel trionModel = SolverModel(it->second, value);
+            model[trionModel.getId()] = trionModel;
+          }
+        }
+
+        return true;
+      }
+
+
+      std::unordered_map<triton::usize, SolverModel> ExternalSolver::getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        auto models = this->getModels(node, 1, status, timeout, solvingTime);
+        return models.empty() ? std::unordered_map<triton::usize, SolverModel>() : models.front();
+      }
+
+
+      std::vector<std::unordered_map<triton::usize, SolverModel>> ExternalSolver::getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        std::vector<std::unordered_map<triton::usize, SolverModel>> ret;
+
+        this->enumerateModels(node, limit, [&ret](const std::unordered_map<triton::usize, SolverModel>& model) {
+          ret.push_back(model);
+          return true;
+        }, {}, status, timeout, solvingTime);
+
+        return ret;
+      }
+
+
+      triton::usize ExternalSolver::enumerateModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, const ModelCallback& callback, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& variables, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        triton::ast::SharedAbstractNode onode = this->getQueryNode(node, "ExternalSolver::enumerateModels()");
+        std::vector<triton::engines::symbolic::SharedSymbolicVariable> vars;
+        triton::ast::TritonToSmt2 printer;
+        std::ostringstream script;
+        triton::usize count = 0;
+        bool healthy = true;
+
+        /* Each query is scoped, the process is clean once it is done */
+        script << "(push 1)" << std::endl;
+        std::string term = printer.convert(onode, script);
+        script << "(assert " << term << ")" << std::endl;
+
+        /* Only the variables of the projection are asked for and enumerated */
+        for (const auto& var : variables) {
+          if (printer.variables.find(var->getName()) != printer.variables.end())
+            vars.push_back(var);
+        }
+        if (variables.empty()) {
+          for (const auto& it : printer.variables)
+            vars.push_back(it.second);
+        }
+
+        auto start = std::chrono::system_clock::now();
+
+        if (this->interrupted) {
+          if (status)
+            *status = triton::engines::solver::UNKNOWN;
+          return count;
+        }
+
+        std::unique_ptr<Smt2Process> process = this->acquire();
+
+        try {
+          triton::uint32 ms = this->getQueryTimeout(timeout);
+          triton::engines::solver::status_e st = this->check(*process, script.str(), ms, healthy);
+
+          /* Write back the status code of the first constraint */
+          if (status)
+            *status = st;
+
+          while (st == triton::engines::solver::SAT && limit >= 1) {
+            std::unordered_map<triton::usize, SolverModel> smodel;
+
+            if (vars.empty() || !this->getValues(*process, vars, ms, smodel)) {
+              healthy &= !vars.empty();
+              break;
+            }
+
+            /* Check that model is available */
+            if (smodel.empty())
+              break;
+
+            /* Hand out the model, the caller may stop the enumeration */
+            count++;
+            if (!callback(smodel))
+              break;
+
+            if (--limit) {
+              /* Escape last models */
+              std::ostringstream block;
+              block << "(assert (or";
+              for (const auto& it : smodel)
+                block << " (distinct " << it.second.getVariable()->getName() << " (_ bv" << it.second.getValue() << " " << it.second.getVariable()->getSize() << "))";
+              block << "))" << std::endl;
+
+              /* Get next model */
+              st = this->check(*process, block.str(), ms, healthy);
+            }
+          }
+
+          if (healthy)
+            healthy = process->send("(pop 1)\n");
+        }
+        catch (...) {
+          this->release(std::move(process), false);
+          throw;
+        }
+
+        this->release(std::move(process), healthy);
+
+        auto end = std::chrono::system_clock::now();
+
+        if (solvingTime)
+          *solvingTime = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+
+        return count;
+      }
+
+
+      bool ExternalSolver::isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        triton::ast::SharedAbstractNode onode = this->getQueryNode(node, "ExternalSolver::isSat()");
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+        triton::ast::TritonToSmt2 printer;
+        std::ostringstream script;
+        bool healthy = true;
+
+        script << "(push 1)" << std::endl;
+        std::string term = printer.convert(onode, script);
+        script << "(assert " << term << ")" << std::endl;
+
+        auto start = std::chrono::system_clock::now();
+
+        if (!this->interrupted) {
+          std::unique_ptr<Smt2Process> process = this->acquire();
+
+          try {
+            st = this->check(*process, script.str(), this->getQueryTimeout(timeout), healthy);
+            if (healthy)
+              healthy = process->send("(pop 1)\n");
+          }
+          catch (...) {
+            this->release(std::move(process), false);
+            throw;
+          }
+
+          this->release(std::move(process), healthy);
+        }
+
+        auto end = std::chrono::system_clock::now();
+
+        if (solvingTime)
+          *solvingTime = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+
+        if (status)
+          *status = st;
+
+        return st == triton::engines::solver::SAT;
+      }
+
+
+      std::string ExternalSolver::getName(void) const {
+        return "external";
+      }
+
+
+      void ExternalSolver::setTimeout(triton::uint32 ms) {
+        this->timeout = ms;
+      }
+
+
+      void ExternalSolver::setMemoryLimit(triton::uint32 limit) {
+        this->memoryLimit = limit;
+
+        /* The idle processes are dropped if the limit changes */
+        if (this->pool && this->pool->getMemoryLimit() != limit)
+          this->pool->setMemoryLimit(limit);
+      }
+
+
+      void ExternalSolver::interrupt(void) {
+        std::lock_guard<std::mutex> guard(this->runningLock);
+
+        this->interrupted = true;
+        for (auto* process : this->running)
+          process->kill();
+      }
+
+
+      Smt2Process& ExternalSolver::getSession(void) {
+        if (this->pool == nullptr)
+          throw triton::exceptions::SolverEngine("ExternalSolver::getSession(): No command defined.");
+
+        /* A process killed by a timeout is replaced, the constraints of its scopes are sent again */
+        if (this->session == nullptr || !this->session->isAlive()) {
+          std::string replay;
+
+          this->session = this->pool->acquire();
+          for (triton::usize scope = 0; scope < this->sessionLog.size(); scope++) {
+            if (scope)
+              replay += "(push 1)\n";
+            replay += this->sessionLog[scope];
+          }
+
+          if (!this->session->send(replay))
+            throw triton::exceptions::SolverEngine("ExternalSolver::getSession(): The solver process died.");
+        }
+
+        return *this->session;
+      }
+
+
+      void ExternalSolver::pushConstraint(const triton::ast::SharedAbstractNode& node) {
+        triton::ast::SharedAbstractNode onode = this->getQueryNode(node, "ExternalSolver::pushConstraint()");
+        Smt2Process& process = this->getSession();
+        std::ostringstream commands;
+
+        std::string term = this->sessionAst.convert(onode, commands);
+        commands << "(assert " << term << ")" << std::endl;
+
+        this->sessionLog.back() += commands.str();
+        process.send(commands.str());
+      }
+
+
+      void ExternalSolver::push(void) {
+        Smt2Process& process = this->getSession();
+
+        this->sessionAst.push();
+        this->sessionLog.emplace_back();
+        process.send("(push 1)\n");
+      }
+
+
+      void ExternalSolver::pop(triton::uint32 count) {
+        if (count >= this->sessionLog.size())
+          throw triton::exceptions::SolverEngine("ExternalSolver::pop(): Not enough scopes opened.");
+
+        if (count) {
+          Smt2Process& process = this->getSession();
+
+          this->sessionAst.pop(count);
+          this->sessionLog.resize(this->sessionLog.size() - count);
+          process.send("(pop " + std::to_string(count) + ")\n");
+        }
+      }
+
+
+      std::unordered_map<triton::usize, SolverModel> ExternalSolver::checkWithAssumptions(const std::vector<triton::ast::SharedAbstractNode>& assumptions, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) {
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+        std::vector<triton::engines::symbolic::SharedSymbolicVariable> vars;
+        std::unordered_map<triton::usize, SolverModel> ret;
+        std::ostringstream commands;
+        std::exception_ptr error;
+        bool healthy = true;
+
+        std::vector<triton::ast::SharedAbstractNode> nodes;
+        for (const auto& node : assumptions)
+          nodes.push_back(this->getQueryNode(node, "ExternalSolver::checkWithAssumptions()"));
+
+        Smt2Process& process = this->getSession();
+
+        /* The assumptions are scoped, their declarations and definitions are dropped with them */
+        commands << "(push 1)" << std::endl;
+        this->sessionAst.push();
+        try {
+          for (const auto& node : nodes) {
+            std::string term = this->sessionAst.convert(node, commands);
+            commands << "(assert " << term << ")" << std::endl;
+          }
+        }
+        catch (...) {
+          this->sessionAst.pop();
+          throw;
+        }
+
+        for (const auto& it : this->sessionAst.variables)
+          vars.push_back(it.second);
+        this->sessionAst.pop();
+
+        auto start = std::chrono::system_clock::now();
+
+        if (!this->interrupted) {
+          {
+            std::lock_guard<std::mutex> guard(this->runningLock);
+            this->running.insert(&process);
+          }
+
+          try {
+            triton::uint32 ms = this->getQueryTimeout(timeout);
+            st = this->check(process, commands.str(), ms, healthy);
+            if (st == triton::engines::solver::SAT && !vars.empty())
+              healthy &= this->getValues(process, vars, ms, ret);
+            if (healthy)
+              healthy = process.send("(pop 1)\n");
+          }
+          catch (...) {
+            error   = std::current_exception();
+            healthy = false;
+          }
+
+          {
+            std::lock_guard<std::mutex> guard(this->runningLock);
+            this->running.erase(&process);
+          }
+
+          /* The process is replaced on the next use of the session */
+          if (!healthy) {
+            process.kill();
+            this->session.reset();
+          }
+
+          if (error)
+            std::rethrow_exception(error);
+        }
+
+        auto end = std::chrono::system_clock::now();
+
+        if (solvingTime)
+          *solvingTime = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+
+        if (status)
+          *status = st;
+
+        return ret;
+      }
+
+
+      void ExternalSolver::resetSession(void) {
+        this->session.reset();
+        this->sessionAst.reset();
+        this->sessionLog.assign(1, "");
+      }
+
+
+      std::vector<std::string> ExternalSolver::getCommand(void) const {
+        if (this->pool == nullptr)
+          return {};
+        return this->pool->getCommand();
+      }
+
+
+      void ExternalSolver::setCommand(const std::vector<std::string>& command) {
+        if (command.empty()) {
+          this->pool = nullptr;
+        }
+        else {
+          this->pool.reset(new Smt2ProcessPool(command, this->poolSize));
+          this->pool->setMemoryLimit(this->memoryLimit);
+        }
+
+        /* The solver session moves to the new solver on its next use */
+        this->session.reset();
+      }
+
+
+      triton::usize ExternalSolver::getPoolSize(void) const {
+        return this->poolSize;
+      }
+
+
+      void ExternalSolver::setPoolSize(triton::usize size) {
+        this->poolSize = size;
+        if (this->pool)
+          this->pool->setSize(size);
+      }
+
+    };
+  };
+};
@@ -0,0 +1,362 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+
+#include <triton/exceptions.hpp>
+#include <triton/smt2Process.hpp>
+
+#if !defined(_WIN32)
+  #include <fcntl.h>
+  #include <poll.h>
+  #include <signal.h>
+  #include <sys/resource.h>
+  #include <sys/socket.h>
+  #include <sys/wait.h>
+  #include <unistd.h>
+#endif
+
+/* Writing to a dead process must not raise SIGPIPE in the tracer */
+#if defined(MSG_NOSIGNAL)
+  #define TRITON_SEND_FLAGS MSG_NOSIGNAL
+#else
+  #define TRITON_SEND_FLAGS 0
+#endif
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      #if defined(_WIN32)
+
+      Smt2Process::Smt2Process(const std::vector<std::string>& command, triton::uint32 memoryLimit) {
+        throw triton::exceptions::SolverEngine("Smt2Process::Smt2Process(): Solver subprocesses are not supported on this platform.");
+      }
+
+      Smt2Process::~Smt2Process() {
+      }
+
+      bool Smt2Process::isAlive(void) {
+        return false;
+      }
+
+      bool Smt2Process::send(const std::string& commands) {
+        return false;
+      }
+
+      bool Smt2Process::receive(std::string& answer, triton::uint32 timeout) {
+        return false;
+      }
+
+      void Smt2Process::kill(void) {
+      }
+
+      #else
+
+      /* Creates a pair of connected sockets, not inherited by the other processes spawned */
+      static void newChannel(int fds[2]) {
+        #if defined(SOCK_CLOEXEC)
+        if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds) != 0)
+          throw triton::exceptions::SolverEngine("Smt2Process::Smt2Process(): Cannot create the channels of the process.");
+        #else
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0)
+          throw triton::exceptions::SolverEngine("Smt2Process::Smt2Process(): Cannot create the channels of the process.");
+        fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+        fcntl(fds[1], F_SETFD, FD_CLOEXEC);
+        #endif
+
+        #if defined(SO_NOSIGPIPE)
+        int on = 1;
+        setsockopt(fds[0], SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+        #endif
+      }
+
+
+      Smt2Process::Smt2Process(const std::vector<std::string>& command, triton::uint32 memoryLimit) {
+        std::vector<char*> argv;
+        int input[2];
+        int output[2];
+        int status[2];
+
+        this->dead   = false;
+        this->input  = -1;
+        this->output = -1;
+        this->pid    = -1;
+
+        if (command.empty())
+          throw triton::exceptions::SolverEngine("Smt2Process::Smt2Process(): The command cannot be empty.");
+
+        /* Everything the child needs is ready before the fork, it only calls async-signal-safe functions */
+        for (const auto& arg : command)
+          argv.push_back(const_cast<char*>(arg.c_str()));
+        argv.push_back(nullptr);
+
+        newChannel(input);
+        newChannel(output);
+        newChannel(status);
+
+        pid_t child = fork();
+        if (child < 0) {
+          for (int fd : {input[0], input[1], output[0], output[1], status[0], status[1]})
+            close(fd);
+          throw triton::exceptions::SolverEngine("Smt2Process::Smt2Process(): Cannot fork.");
+        }
+
+        if (child == 0) {
+          int null = open("/dev/null", O_WRONLY);
+          dup2(input[1], STDIN_FILENO);
+          dup2(output[1], STDOUT_FILENO);
+          if (null >= 0)
+            dup2(null, STDERR_FILENO);
+
+          if (memoryLimit) {
+            struct rlimit limit;
+            limit.rlim_cur = static_cast<rlim_t>(memoryLimit) << 20;
+            limit.rlim_max = static_cast<rlim_t>(memoryLimit) << 20;
+            setrlimit(RLIMIT_AS, &limit);
+          }
+
+          execvp(argv[0], argv.data());
+
+          /* The parent reads the error on the status channel, closed on success by exec */
+          int error = errno;
+          ::send(status[1], &error, sizeof(error), TRITON_SEND_FLAGS);
+          _exit(127);
+        }
+
+        close(input[1]);
+        close(output[1]);
+        close(status[1]);
+
+        this->pid    = child;
+        this->input  = input[0];
+        this->output = output[0];
+
+        int error = 0;
+        ssize_t n;
+        do {
+          n = read(status[0], &error, sizeof(error));
+        } while (n < 0 && errno == EINTR);
+        close(status[0]);
+
+        if (n > 0) {
+          this->kill();
+          this->isAlive();
+          throw triton::exceptions::SolverEngine("Smt2Process::Smt2Process(): Cannot run " + command.front() + ": " + std::strerror(error) + ".");
+        }
+      }
+
+
+      Smt2Process::~Smt2Process() {
+        if (this->input >= 0)
+          close(this->input);
+        if (this->output >= 0)
+          close(this->output);
+
+        if (this->pid > 0) {
+          ::kill(static_cast<pid_t>(this->pid), SIGKILL);
+          waitpid(static_cast<pid_t>(this->pid), nullptr, 0);
+        }
+      }
+
+
+      bool Smt2Process::isAlive(void) {
+        if (this->pid > 0 && waitpid(static_cast<pid_t>(this->pid), nullptr, WNOHANG) == static_cast<pid_t>(this->pid)) {
+          this->pid  = -1;
+          this->dead = true;
+        }
+        return !this->dead;
+      }
+
+
+      bool Smt2Process::send(const std::string& commands) {
+        const char* data = commands.c_str();
+        triton::usize size = commands.size();
+
+        while (size && !this->dead) {
+          ssize_t n = ::send(this->input, data, size, TRITON_SEND_FLAGS);
+          if (n < 0 && errno == EINTR)
+            continue;
+          if (n <= 0) {
+            this->dead = true;
+            break;
+          }
+          data += n;
+          size -= n;
+        }
+
+        return !this->dead;
+      }
+
+
+      bool Smt2Process::receive(std::string& answer, triton::uint32 timeout) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
+        char chunk[4096];
+
+        while (!this->extract(answer)) {
+          if (this->dead)
+            return false;
+
+          int wait = -1;
+          if (timeout) {
+            auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()).count();
+            if (left <= 0)
+              return false;
+            wait = static_cast<int>(left);
+          }
+
+          struct pollfd fd;
+          fd.fd      = this->output;
+          fd.events  = POLLIN;
+          fd.revents = 0;
+
+          int ready = poll(&fd, 1, wait);
+          if (ready < 0 && errno == EINTR)
+            continue;
+          if (ready == 0)
+            return false;
+
+          ssize_t n = read(this->output, chunk, sizeof(chunk));
+          if (n < 0 && errno == EINTR)
+            continue;
+          if (n <= 0) {
+            this->dead = true;
+            return false;
+          }
+
+          this->buffer.append(chunk, n);
+        }
+
+        return true;
+      }
+
+
+      void Smt2Process::kill(void) {
+        if (this->pid > 0)
+          ::kill(static_cast<pid_t>(this->pid), SIGKILL);
+      }
+
+      #endif
+
+
+      bool Smt2Process::extract(std::string& answer) {
+        triton::usize start = this->buffer.find_first_not_of(" \t\r\n");
+
+        if (start == std::string::npos) {
+          this->buffer.clear();
+          return false;
+        }
+
+        /* An atom, e.g. sat */
+        if (this->buffer[start] != '(') {
+          triton::usize end = this->buffer.find_first_of(" \t\r\n", start);
+          if (end == std::string::npos)
+            return false;
+          answer = this->buffer.substr(start, end - start);
+          this->buffer.erase(0, end);
+          return true;
+        }
+
+        /* A s-expression, its strings and quoted symbols may hold parentheses */
+        triton::usize depth = 0;
+        for (triton::usize index = start; index < this->buffer.size(); index++) {
+          char c = this->buffer[index];
+
+          if (c == '"' || c == '|') {
+            index = this->buffer.find(c, index + 1);
+            if (index == std::string::npos)
+              return false;
+          }
+          else if (c == '(') {
+            depth++;
+          }
+          else if (c == ')' && --depth == 0) {
+            answer = this->buffer.substr(start, index + 1 - start);
+            this->buffer.erase(0, index + 1);
+            return true;
+          }
+        }
+
+        return false;
+      }
+
+
+      Smt2ProcessPool::Smt2ProcessPool(const std::vector<std::string>& command, triton::usize size) {
+        this->command     = command;
+        this->memoryLimit = 0;
+        this->size        = size;
+      }
+
+
+      std::unique_ptr<Smt2Process> Smt2ProcessPool::acquire(void) {
+        triton::uint32 limit = 0;
+
+        {
+          std::lock_guard<std::mutex> guard(this->lock);
+          while (!this->idle.empty()) {
+            std::unique_ptr<Smt2Process> process = std::move(this->idle.back());
+            this->idle.pop_back();
+            if (process->isAlive())
+              return process;
+          }
+          limit = this->memoryLimit;
+        }
+
+        /* The values of the variables are asked for once a query is sat */
+        std::unique_ptr<Smt2Process> process(new Smt2Process(this->command, limit));
+        process->send("(set-option :produce-models true)\n");
+
+        return process;
+      }
+
+
+      void Smt2ProcessPool::release(std::unique_ptr<Smt2Process> process) {
+        std::lock_guard<std::mutex> guard(this->lock);
+
+        if (process && process->isAlive() && this->idle.size() < this->size)
+          this->idle.push_back(std::move(process));
+      }
+
+
+      const std::vector<std::string>& Smt2ProcessPool::getCommand(void) const {
+        return this->command;
+      }
+
+
+      triton::usize Smt2ProcessPool::getSize(void) {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->size;
+      }
+
+
+      void Smt2ProcessPool::setSize(triton::usize size) {
+        std::lock_guard<std::mutex> guard(this->lock);
+        this->size = size;
+        if (this->idle.size() > size)
+          this->idle.resize(size);
+      }
+
+
+      triton::uint32 Smt2ProcessPool::getMemoryLimit(void) {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->memoryLimit;
+      }
+
+
+      void Smt2ProcessPool::setMemoryLimit(triton::uint32 limit) {
+        std::lock_guard<std::mutex> guard(this->lock);
+        this->memoryLimit = limit;
+        this->idle.clear();
+      }
+
+    };
+  };
+};
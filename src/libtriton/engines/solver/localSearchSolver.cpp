@@ -0,0 +1,702 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <tuple>
+#include <unordered_set>
+
+#include <triton/astContext.hpp>
+#include <triton/astEvaluator.hpp>
+#include <triton/config.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/localSearchSolver.hpp>
+#include <triton/symbolicExpression.hpp>
+#ifdef TRITON_Z3_INTERFACE
+  #include <triton/z3Solver.hpp>
+#endif
+#ifdef TRITON_BITWUZLA_INTERFACE
+  #include <triton/bitwuzlaSolver.hpp>
+#endif
+#if defined(TRITON_Z3_INTERFACE) || defined(TRITON_BITWUZLA_INTERFACE)
+  #include <triton/portfolioSolver.hpp>
+#endif
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      /* An operand of a conjunct, compiled */
+      struct LocalSearchSide {
+        std::unique_ptr<triton::ast::AstEvaluator> evaluator;
+
+        /* The index of each input of the evaluator in the assignment */
+        std::vector<triton::usize> inputs;
+
+        /* The values given to the evaluator */
+        std::vector<triton::uint512> values;
+
+        triton::uint512 evaluate(const std::vector<triton::uint512>& assignment) {
+          for (triton::usize i = 0; i < this->inputs.size(); i++)
+            this->values[i] = assignment[this->inputs[i]];
+          return this->evaluator->evaluate(this->values);
+        }
+      };
+
+
+      /* A conjunct of the query */
+      struct LocalSearchConjunct {
+        /* The comparison of the operands, or LNOT_NODE/LAND_NODE for a boolean which must be false/true */
+        triton::ast::ast_e type;
+
+        /* The size of the operands */
+        triton::uint32 size;
+
+        /* The operands of a comparison, only `lhs` for a boolean */
+        LocalSearchSide lhs;
+        LocalSearchSide rhs;
+
+        /* The index of the variables read, in the assignment */
+        std::vector<triton::usize> variables;
+
+        /* The cost of the conjunct in the current assignment, 0 if it is satisfied */
+        double cost;
+
+        /* The distance between the operands in the current assignment */
+        triton::uint512 distance;
+      };
+
+
+      /* Returns the comparison holding when `type` does not */
+      static triton::ast::ast_e negateComparison(triton::ast::ast_e type) {
+        switch (type) {
+          case triton::ast::BVSGE_NODE:    return triton::ast::BVSLT_NODE;
+          case triton::ast::BVSGT_NODE:    return triton::ast::BVSLE_NODE;
+          case triton::ast::BVSLE_NODE:    return triton::ast::BVSGT_NODE;
+          case triton::ast::BVSLT_NODE:    return triton::ast::BVSGE_NODE;
+          case triton::ast::BVUGE_NODE:    return triton::ast::BVULT_NODE;
+          case triton::ast::BVUGT_NODE:    return triton::ast::BVULE_NODE;
+          case triton::ast::BVULE_NODE:    return triton::ast::BVUGT_NODE;
+          case triton::ast::BVULT_NODE:    return triton::ast::BVUGE_NODE;
+          case triton::ast::DISTINCT_NODE: return triton::ast::EQUAL_NODE;
+          case triton::ast::EQUAL_NODE:    return triton::ast::DISTINCT_NODE;
+          default:
+            throw triton::exceptions::SolverEngine("LocalSearchSolver::negateComparison(): Invalid comparison.");
+        }
+      }
+
+
+      static bool isComparison(triton::ast::ast_e type) {
+        switch (type) {
+          case triton::ast::BVSGE_NODE:
+          case triton::ast::BVSGT_NODE:
+          case triton::ast::BVSLE_NODE:
+          case triton::ast::BVSLT_NODE:
+          case triton::ast::BVUGE_NODE:
+          case triton::ast::BVUGT_NODE:
+          case triton::ast::BVULE_NODE:
+          case triton::ast::BVULT_NODE:
+          case triton::ast::DISTINCT_NODE:
+          case triton::ast::EQUAL_NODE:
+            return true;
+          default:
+            return false;
+        }
+      }
+
+
+      static triton::ast::SharedAbstractNode unrollReference(triton::ast::SharedAbstractNode node) {
+        while (node->getType() == triton::ast::REFERENCE_NODE)
+          node = reinterpret_cast<triton::ast::ReferenceNode*>(node.get())->getSymbolicExpression()->getAst();
+        return node;
+      }
+
+
+      /*
+       * Splits a query into conjuncts, the comparisons being kept so that the distance
+       * between their operands guides the search. A branch predicate such as
+       * (= (ite c 1 0) 1) is seen through, its conjunct is `c`.
+       */
+      static void splitQuery(const triton::ast::SharedAbstractNode& root, std::vector<std::tuple<triton::ast::SharedAbstractNode, bool>>& conjuncts) {
+        std::vector<std::tuple<triton::ast::SharedAbstractNode, bool>> worklist = {std::make_tuple(root, false)};
+
+        while (!worklist.empty()) {
+          triton::ast::SharedAbstractNode node;
+          bool negated;
+          std::tie(node, negated) = worklist.back();
+          worklist.pop_back();
+
+          node = unrollReference(node);
+          const auto& children = node->getChildren();
+
+          switch (node->getType()) {
+            case triton::ast::ASSERT_NODE:
+              worklist.push_back(std::make_tuple(children[0], negated));
+              continue;
+
+            case triton::ast::LNOT_NODE:
+              worklist.push_back(std::make_tuple(children[0], !negated));
+              continue;
+
+            case triton::ast::LAND_NODE:
+            case triton::ast::LOR_NODE:
+              /* A conjunction, or the negation of a disjunction */
+              if ((node->getType() == triton::ast::LAND_NODE) != negated)
+                break;
+              for (const auto& child : children)
+                worklist.push_back(std::make_tuple(child, negated));
+              continue;
+
+            case triton::ast::DISTINCT_NODE:
+            case triton::ast::EQUAL_NODE: {
+              triton::ast::SharedAbstractNode ite   = unrollReference(children[0]);
+              triton::ast::SharedAbstractNode value = unrollReference(children[1]);
+              if (ite->getType() != triton::ast::ITE_NODE)
+                std::swap(ite, value);
+              if (ite->getType() != triton::ast::ITE_NODE || value->isSymbolized())
+                break;
+
+              const auto& branches = ite->getChildren();
+              if (branches[1]->isSymbolized() || branches[2]->isSymbolized())
+                break;
+
+              triton::uint512 k = value->evaluate();
+              bool taken    = (branches[1]->evaluate() == k);
+              bool notTaken = (branches[2]->evaluate() == k);
+              if (taken == notTaken)
+                break;
+
+              /* (= (ite c k x) k) holds iff c holds */
+              bool negate = negated ^ (node->getType() == triton::ast::DISTINCT_NODE) ^ notTaken;
+              worklist.push_back(std::make_tuple(branches[0], negate));
+              continue;
+            }
+
+            default:
+              break;
+          }
+
+          conjuncts.push_back(std::make_tuple(node, negated));
+        }
+      }
+
+
+      /* Returns the value of `size` bits made of random bits */
+      static triton::uint512 randomValue(std::mt19937_64& rng, triton::uint32 size) {
+        triton::uint512 value = 0;
+
+        for (triton::uint32 bits = 0; bits < size; bits += 64)
+          value = (value << 64) | triton::uint512(rng());
+
+        return value & ((triton::uint512(1) << size) - 1);
+      }
+
+
+      /* Evaluates a conjunct on an assignment, its cost is 0 if it is satisfied */
+      static double evaluateConjunct(LocalSearchConjunct& conjunct, const std::vector<triton::uint512>& assignment, triton::uint512& distance) {
+        triton::uint512 mask = (triton::uint512(1) << conjunct.size) - 1;
+        triton::uint512 a    = conjunct.lhs.evaluate(assignment);
+        triton::uint512 b    = 0;
+        bool sat             = false;
+
+        distance = 0;
+
+        switch (conjunct.type) {
+          case triton::ast::LAND_NODE:
+            return (a != 0) ? 0.0 : 1.0;
+
+          case triton::ast::LNOT_NODE:
+            return (a == 0) ? 0.0 : 1.0;
+
+          default:
+            b = conjunct.rhs.evaluate(assignment);
+            break;
+        }
+
+        /* Signed comparisons are unsigned comparisons once the sign bits are flipped */
+        switch (conjunct.type) {
+          case triton::ast::BVSGE_NODE:
+          case triton::ast::BVSGT_NODE:
+          case triton::ast::BVSLE_NODE:
+          case triton::ast::BVSLT_NODE:
+            a ^= triton::uint512(1) << (conjunct.size - 1);
+            b ^= triton::uint512(1) << (conjunct.size - 1);
+            break;
+          default:
+            break;
+        }
+
+        switch (conjunct.type) {
+          case triton::ast::EQUAL_NODE:
+            sat      = (a == b);
+            distance = std::min((a - b) & mask, (b - a) & mask);
+            break;
+
+          case triton::ast::DISTINCT_NODE:
+            sat      = (a != b);
+            distance = 1;
+            break;
+
+          case triton::ast::BVSLT_NODE:
+          case triton::ast::BVULT_NODE:
+            sat      = (a < b);
+            distance = a - b + 1;
+            break;
+
+          case triton::ast::BVSLE_NODE:
+          case triton::ast::BVULE_NODE:
+            sat      = (a <= b);
+            distance = a - b;
+            break;
+
+          case triton::ast::BVSGT_NODE:
+          case triton::ast::BVUGT_NODE:
+            sat      = (a > b);
+            distance = b - a + 1;
+            break;
+
+          case triton::ast::BVSGE_NODE:
+          case triton::ast::BVUGE_NODE:
+            sat      = (a >= b);
+            distance = b - a;
+            break;
+
+          default:
+            break;
+        }
+
+        if (sat) {
+          distance = 0;
+          return 0.0;
+        }
+
+        /* An unsatisfied conjunct costs 1 plus a fraction growing with the distance of its operands */
+        distance &= mask;
+        return 1.0 + std::min(0.999, std::ldexp(distance.convert_to<double>(), -static_cast<int>(conjunct.size)));
+      }
+
+
+      LocalSearchSolver::LocalSearchSolver() {
+        this->budget      = 100;
+        this->handoffs    = 0;
+        this->hits        = 0;
+        this->interrupted = false;
+        this->memoryLimit = 0;
+        this->seed        = 0x5eed;
+        this->timeout     = 0;
+
+        #if defined(TRITON_Z3_INTERFACE)
+        this->setFallback(triton::engines::solver::SOLVER_Z3);
+        #elif defined(TRITON_BITWUZLA_INTERFACE)
+        this->setFallback(triton::engines::solver::SOLVER_BITWUZLA);
+        #else
+        this->setFallback(triton::engines::solver::SOLVER_INVALID);
+        #endif
+      }
+
+
+      bool LocalSearchSolver::search(const triton::ast::SharedAbstractNode& node, triton::uint32 ms, std::unordered_map<triton::usize, SolverModel>& model) const {
+        std::vector<std::tuple<triton::ast::SharedAbstractNode, bool>> parts;
+        std::vector<LocalSearchConjunct> conjuncts;
+        std::vector<triton::engines::symbolic::SharedSymbolicVariable> variables;
+        std::unordered_map<triton::usize, triton::usize> indexes;
+        std::vector<std::vector<triton::usize>> readers;
+        std::vector<triton::uint512> assignment;
+        std::vector<triton::uint512> best;
+
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(ms);
+
+        splitQuery(node, parts);
+
+        /* Compiles the conjuncts, and numbers their variables */
+        auto compile = [&](LocalSearchSide& side, const triton::ast::SharedAbstractNode& operand) {
+          side.evaluator.reset(new triton::ast::AstEvaluator(operand));
+          for (const auto& var : side.evaluator->getVariables()) {
+            auto it = indexes.find(var->getId());
+            if (it == indexes.end()) {
+              it = indexes.emplace(var->getId(), variables.size()).first;
+              variables.push_back(var);
+            }
+            side.inputs.push_back(it->second);
+          }
+          side.values.resize(side.inputs.size());
+        };
+
+        try {
+          for (const auto& part : parts) {
+            const triton::ast::SharedAbstractNode& pnode = std::get<0>(part);
+            bool negated = std::get<1>(part);
+
+            /* A constant conjunct holds or not whatever the assignment */
+            if (!pnode->isSymbolized()) {
+              if ((pnode->evaluate() != 0) == negated)
+                return false;
+              continue;
+            }
+
+            conjuncts.emplace_back();
+            LocalSearchConjunct& conjunct = conjuncts.back();
+
+            if (isComparison(pnode->getType())) {
+              const auto& children = pnode->getChildren();
+              conjunct.type = negated ? negateComparison(pnode->getType()) : pnode->getType();
+              conjunct.size = children[0]->getBitvectorSize();
+              compile(conjunct.lhs, children[0]);
+              compile(conjunct.rhs, children[1]);
+            }
+            else {
+              conjunct.type = negated ? triton::ast::LNOT_NODE : triton::ast::LAND_NODE;
+              conjunct.size = 1;
+              compile(conjunct.lhs, pnode);
+            }
+
+            std::unordered_set<triton::usize> read(conjunct.lhs.inputs.begin(), conjunct.lhs.inputs.end());
+            read.insert(conjunct.rhs.inputs.begin(), conjunct.rhs.inputs.end());
+            conjunct.variables.assign(read.begin(), read.end());
+            std::sort(conjunct.variables.begin(), conjunct.variables.end());
+          }
+        }
+        catch (const triton::exceptions::Exception&) {
+          /* The evaluator does not support this query */
+          return false;
+        }
+
+        /* The conjuncts reading each variable */
+        readers.resize(variables.size());
+        for (triton::usize index = 0; index < conjuncts.size(); index++) {
+          for (triton::usize var : conjuncts[index].variables)
+            readers[var].push_back(index);
+        }
+
+        /* The search starts from the concrete values of the variables */
+        assignment.resize(variables.size());
+        for (triton::usize index = 0; index < variables.size(); index++) {
+          try {
+            assignment[index] = node->getContext()->getVariableValue(variables[index]->getId());
+          }
+          catch (const triton::exceptions::Exception&) {
+            assignment[index] = 0;
+          }
+          assignment[index] &= (triton::uint512(1) << variables[index]->getSize()) - 1;
+        }
+
+        double total = 0;
+        for (auto& conjunct : conjuncts) {
+          conjunct.cost = evaluateConjunct(conjunct, assignment, conjunct.distance);
+          total += conjunct.cost;
+        }
+
+        std::mt19937_64 rng(this->seed);
+        std::vector<triton::usize> unsat;
+        std::vector<triton::uint512> candidates;
+        triton::usize stalled = 0;
+        double bestTotal = total;
+        best = assignment;
+
+        /* The cost of the query once `var` is set to `value` */
+        auto costWith = [&](triton::usize var, const triton::uint512& value) {
+          triton::uint512 saved = assignment[var];
+          triton::uint512 distance;
+          double cost = total;
+
+          assignment[var] = value;
+          for (triton::usize index : readers[var]) {
+            cost -= conjuncts[index].cost;
+            cost += evaluateConjunct(conjuncts[index], assignment, distance);
+          }
+          assignment[var] = saved;
+
+          return cost;
+        };
+
+        auto assign = [&](triton::usize var, const triton::uint512& value) {
+          assignment[var] = value;
+          for (triton::usize index : readers[var]) {
+            total -= conjuncts[index].cost;
+            conjuncts[index].cost = evaluateConjunct(conjuncts[index], assignment, conjuncts[index].distance);
+            total += conjuncts[index].cost;
+          }
+        };
+
+        for (triton::usize step = 0; ; step++) {
+          unsat.clear();
+          for (triton::usize index = 0; index < conjuncts.size(); index++) {
+            if (conjuncts[index].cost > 0)
+              unsat.push_back(index);
+          }
+
+          if (unsat.empty())
+            break;
+
+          if (this->interrupted || std::chrono::steady_clock::now() >= deadline)
+            return false;
+
+          /* Mutates the variables of an unsatisfied conjunct */
+          const LocalSearchConjunct& target = conjuncts[unsat[rng() % unsat.size()]];
+          triton::usize bestVar = 0;
+          triton::uint512 bestValue = 0;
+          double bestCost = total;
+          bool improved = false;
+
+          for (triton::usize var : target.variables) {
+            triton::uint32 size  = variables[var]->getSize();
+            triton::uint512 mask = (triton::uint512(1) << size) - 1;
+            const triton::uint512& x = assignment[var];
+
+            candidates.clear();
+            for (triton::uint32 bit = 0; bit < size; bit++)
+              candidates.push_back(x ^ (triton::uint512(1) << bit));
+            candidates.push_back((x + 1) & mask);
+            candidates.push_back((x - 1) & mask);
+            candidates.push_back((x + target.distance) & mask);
+            candidates.push_back((x - target.distance) & mask);
+            candidates.push_back(randomValue(rng, size));
+
+            for (const auto& value : candidates) {
+              double cost = costWith(var, value);
+              if (cost < bestCost) {
+                bestCost  = cost;
+                bestVar   = var;
+                bestValue = value;
+                improved  = true;
+              }
+            }
+          }
+
+          if (improved) {
+            assign(bestVar, bestValue);
+          }
+          else if (!target.variables.empty()) {
+            /* A local minimum, a random walk step */
+            triton::usize var = target.variables[rng() % target.variables.size()];
+            assign(var, randomValue(rng, variables[var]->getSize()));
+          }
+
+          if (total < bestTotal) {
+            bestTotal = total;
+            best      = assignment;
+            stalled   = 0;
+          }
+
+          /* Restarts from a random assignment once the search is stuck */
+          else if (++stalled >= 1000) {
+            for (triton::usize var = 0; var < variables.size(); var++)
+              assign(var, randomValue(rng, variables[var]->getSize()));
+            stalled = 0;
+          }
+        }
+
+        for (triton::usize index = 0; index < variables.size(); index++)
+          model[variables[index]->getId()] = SolverModel(variables[index], assignment[index]);
+
+        return true;
+      }
+
+
+      triton::uint32 LocalSearchSolver::getQueryBudget(triton::uint32 timeout) const {
+        triton::uint32 t = timeout ? timeout : this->timeout;
+
+        if (t && t < this->budget)
+          return t;
+        return this->budget;
+      }
+
+
+      void LocalSearchSolver::record(bool hit) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+
+        if (hit)
+          this->hits++;
+        else
+          this->handoffs++;
+      }
+
+
+      std::unordered_map<triton::usize, SolverModel> LocalSearchSolver::getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        auto models = this->getModels(node, 1, status, timeout, solvingTime);
+        return models.empty() ? std::unordered_map<triton::usize, SolverModel>() : models.front();
+      }
+
+
+      std::vector<std::unordered_map<triton::usize, SolverModel>> LocalSearchSolver::getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        std::vector<std::unordered_map<triton::usize, SolverModel>> ret;
+        std::unordered_map<triton::usize, SolverModel> model;
+        triton::uint32 fallbackTime = 0;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("LocalSearchSolver::getModels(): Node cannot be null.");
+
+        if (node->isLogical() == false)
+          throw triton::exceptions::SolverEngine("LocalSearchSolver::getModels(): Must be a logical node.");
+
+        auto start = std::chrono::system_clock::now();
+
+        /* The search finds one model, several ones are enumerated by the fallback */
+        if ((limit <= 1 || this->fallback == nullptr) && this->search(node, this->getQueryBudget(timeout), model)) {
+          this->record(true);
+          if (status)
+            *status = triton::engines::solver::SAT;
+          if (limit)
+            ret.push_back(model);
+        }
+
+        else if (this->fallback != nullptr && !this->interrupted) {
+          this->record(false);
+          ret = this->fallback->getModels(node, limit, status, timeout, &fallbackTime);
+        }
+
+        else if (status) {
+          *status = triton::engines::solver::UNKNOWN;
+        }
+
+        auto end = std::chrono::system_clock::now();
+
+        if (solvingTime)
+          *solvingTime = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+
+        return ret;
+      }
+
+
+      bool LocalSearchSolver::isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+        std::unordered_map<triton::usize, SolverModel> model;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("LocalSearchSolver::isSat(): Node cannot be null.");
+
+        if (node->isLogical() == false)
+          throw triton::exceptions::SolverEngine("LocalSearchSolver::isSat(): Must be a logical node.");
+
+        auto start = std::chrono::system_clock::now();
+
+        if (this->search(node, this->getQueryBudget(timeout), model)) {
+          this->record(true);
+          st = triton::engines::solver::SAT;
+        }
+
+        else if (this->fallback != nullptr && !this->interrupted) {
+          this->record(false);
+          this->fallback->isSat(node, &st, timeout);
+        }
+
+        auto end = std::chrono::system_clock::now();
+
+        if (solvingTime)
+          *solvingTime = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+
+        if (status)
+          *status = st;
+
+        return st == triton::engines::solver::SAT;
+      }
+
+
+      std::string LocalSearchSolver::getName(void) const {
+        return "local search";
+      }
+
+
+      void LocalSearchSolver::setTimeout(triton::uint32 ms) {
+        this->timeout = ms;
+        if (this->fallback)
+          this->fallback->setTimeout(ms);
+      }
+
+
+      void LocalSearchSolver::setMemoryLimit(triton::uint32 limit) {
+        this->memoryLimit = limit;
+        if (this->fallback)
+          this->fallback->setMemoryLimit(limit);
+      }
+
+
+      void LocalSearchSolver::interrupt(void) {
+        this->interrupted = true;
+        if (this->fallback)
+          this->fallback->interrupt();
+      }
+
+
+      triton::uint32 LocalSearchSolver::getBudget(void) const {
+        return this->budget;
+      }
+
+
+      void LocalSearchSolver::setBudget(triton::uint32 ms) {
+        this->budget = ms;
+      }
+
+
+      triton::engines::solver::solver_e LocalSearchSolver::getFallback(void) const {
+        return this->fallbackKind;
+      }
+
+
+      void LocalSearchSolver::setFallback(triton::engines::solver::solver_e kind) {
+        std::unique_ptr<SolverInterface> solver;
+
+        switch (kind) {
+          case triton::engines::solver::SOLVER_INVALID:
+            break;
+          #ifdef TRITON_Z3_INTERFACE
+          case triton::engines::solver::SOLVER_Z3:
+            solver.reset(new(std::nothrow) triton::engines::solver::Z3Solver());
+            break;
+          #endif
+          #ifdef TRITON_BITWUZLA_INTERFACE
+          case triton::engines::solver::SOLVER_BITWUZLA:
+            solver.reset(new(std::nothrow) triton::engines::solver::BitwuzlaSolver());
+            break;
+          #endif
+          #if defined(TRITON_Z3_INTERFACE) || defined(TRITON_BITWUZLA_INTERFACE)
+          case triton::engines::solver::SOLVER_PORTFOLIO:
+            solver.reset(new(std::nothrow) triton::engines::solver::PortfolioSolver());
+            break;
+          #endif
+          default:
+            throw triton::exceptions::SolverEngine("LocalSearchSolver::setFallback(): Solver not supported.");
+        }
+
+        if (kind != triton::engines::solver::SOLVER_INVALID && solver == nullptr)
+          throw triton::exceptions::SolverEngine("LocalSearchSolver::setFallback(): Not enough memory.");
+
+        if (solver) {
+          solver->setTimeout(this->timeout);
+          solver->setMemoryLimit(this->memoryLimit);
+          if (this->interrupted)
+            solver->interrupt();
+        }
+
+        this->fallback     = std::move(solver);
+        this->fallbackKind = kind;
+      }
+
+
+      void LocalSearchSolver::setSeed(triton::uint64 seed) {
+        this->seed = seed;
+      }
+
+
+      triton::usize LocalSearchSolver::getHits(void) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->hits;
+      }
+
+
+      triton::usize LocalSearchSolver::getHandoffs(void) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->handoffs;
+      }
+
+    };
+  };
+};
@@ -0,0 +1,261 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <chrono>
+#include <exception>
+#include <vector>
+
+#include <triton/config.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/executor.hpp>
+#include <triton/localSearchSolver.hpp>
+#include <triton/portfolioSolver.hpp>
+#include <triton/solverProfiles.hpp>
+#ifdef TRITON_Z3_INTERFACE
+  #include <triton/z3Solver.hpp>
+#endif
+#ifdef TRITON_BITWUZLA_INTERFACE
+  #include <triton/bitwuzlaSolver.hpp>
+#endif
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      PortfolioSolver::PortfolioSolver() {
+        this->lastWinner  = triton::engines::solver::SOLVER_INVALID;
+        this->memoryLimit = 0;
+        this->timeout     = 0;
+
+        #ifdef TRITON_Z3_INTERFACE
+        this->backends.push_back(triton::engines::solver::SOLVER_Z3);
+        #endif
+        #ifdef TRITON_BITWUZLA_INTERFACE
+        this->backends.push_back(triton::engines::solver::SOLVER_BITWUZLA);
+        #endif
+      }
+
+
+      std::unique_ptr<SolverInterface> PortfolioSolver::newBackend(triton::engines::solver::solver_e kind) const {
+        std::unique_ptr<SolverInterface> solver;
+
+        switch (kind) {
+          #ifdef TRITON_Z3_INTERFACE
+          case triton::engines::solver::SOLVER_Z3:
+            solver.reset(new(std::nothrow) triton::engines::solver::Z3Solver());
+            break;
+          #endif
+          #ifdef TRITON_BITWUZLA_INTERFACE
+          case triton::engines::solver::SOLVER_BITWUZLA:
+            solver.reset(new(std::nothrow) triton::engines::solver::BitwuzlaSolver());
+            break;
+          #endif
+          case triton::engines::solver::SOLVER_LOCAL_SEARCH: {
+            /* The SMT solvers of the portfolio are raced against the search, it does not hand off */
+            auto* search = new(std::nothrow) triton::engines::solver::LocalSearchSolver();
+            if (search)
+              search->setFallback(triton::engines::solver::SOLVER_INVALID);
+            solver.reset(search);
+            break;
+          }
+          default:
+            throw triton::exceptions::SolverEngine("PortfolioSolver::newBackend(): Solver not supported.");
+        }
+
+        if (solver == nullptr)
+          throw triton::exceptions::SolverEngine("PortfolioSolver::newBackend(): Not enough memory.");
+
+        solver->setTimeout(this->timeout);
+        solver->setMemoryLimit(this->memoryLimit);
+
+        return solver;
+      }
+
+
+      std::vector<std::unordered_map<triton::usize, SolverModel>> PortfolioSolver::race(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime, const char* where) const {
+        /* The state of a solver of the race */
+        struct Run {
+          std::unique_ptr<SolverInterface> solver;
+          std::vector<std::unordered_map<triton::usize, SolverModel>> models;
+          triton::engines::solver::status_e status = triton::engines::solver::UNKNOWN;
+          std::string error;
+        };
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine(std::string(where) + ": Node cannot be null.");
+
+        if (this->backends.empty())
+          throw triton::exceptions::SolverEngine(std::string(where) + ": The portfolio is empty.");
+
+        /* Z3 drops the assert() root, all the solvers are given the same root */
+        triton::ast::SharedAbstractNode query = node;
+        if (query->getType() == triton::ast::ASSERT_NODE)
+          query = query->getChildren()[0];
+
+        /*
+         * The solvers only read the query. Its traversal is computed here, so that it is cached
+         * by its context (AST_TRAVERSAL_CACHE) before the threads look for it.
+         */
+        triton::ast::childrenExtraction(query, true /* unroll */, true /* revert */);
+
+        std::vector<Run> runs(this->backends.size());
+        for (triton::usize index = 0; index < runs.size(); index++)
+          runs[index].solver = this->newBackend(this->backends[index]);
+
+        auto& executor = triton::utils::Executor::getDefault();
+        std::vector<triton::utils::SharedExecutorTask> tasks(runs.size());
+        const SolverProfile* profile = SolverProfileScope::current();
+        std::mutex raceLock;
+        triton::usize winner = runs.size();
+
+        auto start = std::chrono::system_clock::now();
+
+        /*
+         * The solvers race on the executor of the process. Once a solver answers, the others are
+         * interrupted and the ones not started yet are cancelled. All the tasks are submitted before a
+         * solver may cancel the other ones.
+         */
+        std::unique_lock<std::mutex> submitGuard(raceLock);
+        for (triton::usize index = 0; index < runs.size(); index++) {
+          tasks[index] = executor.submit([&, index](const triton::utils::ExecutorTask&) {
+            Run& run = runs[index];
+
+            try {
+              /* The profile of the query, the tasks are waited for */
+              SolverProfileScope scope(profile);
+              run.models = run.solver->getModels(query, limit, &run.status, timeout);
+            }
+            catch (const std::exception& e) {
+              run.error  = e.what();
+              run.status = triton::engines::solver::UNKNOWN;
+            }
+
+            if (run.status != triton::engines::solver::SAT && run.status != triton::engines::solver::UNSAT)
+              return;
+
+            /* The first answer wins, the other solvers are interrupted */
+            std::lock_guard<std::mutex> guard(raceLock);
+            if (winner == runs.size()) {
+              winner = index;
+              for (triton::usize other = 0; other < runs.size(); other++) {
+                if (other != index) {
+                  tasks[other]->cancel();
+                  runs[other].solver->interrupt();
+                }
+              }
+            }
+          }, triton::utils::PRIORITY_HIGH);
+        }
+        submitGuard.unlock();
+
+        for (const auto& task : tasks)
+          executor.wait(task);
+
+        auto end = std::chrono::system_clock::now();
+
+        if (solvingTime)
+          *solvingTime = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+
+        /* Nobody answered, the first solver which did not fail gives the status */
+        if (winner == runs.size()) {
+          for (triton::usize index = 0; index < runs.size() && winner == runs.size(); index++) {
+            if (runs[index].error.empty())
+              winner = index;
+          }
+
+          {
+            std::lock_guard<std::mutex> guard(this->lock);
+            this->lastWinner = triton::engines::solver::SOLVER_INVALID;
+          }
+
+          if (winner == runs.size())
+            throw triton::exceptions::SolverEngine(std::string(where) + ": " + runs.front().error);
+        }
+        else {
+          std::lock_guard<std::mutex> guard(this->lock);
+          this->lastWinner = this->backends[winner];
+          this->wins[this->lastWinner]++;
+        }
+
+        if (status)
+          *status = runs[winner].status;
+
+        return runs[winner].models;
+      }
+
+
+      std::unordered_map<triton::usize, SolverModel> PortfolioSolver::getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        auto models = this->race(node, 1, status, timeout, solvingTime, "PortfolioSolver::getModel()");
+        return models.empty() ? std::unordered_map<triton::usize, SolverModel>() : models.front();
+      }
+
+
+      std::vector<std::unordered_map<triton::usize, SolverModel>> PortfolioSolver::getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        return this->race(node, limit, status, timeout, solvingTime, "PortfolioSolver::getModels()");
+      }
+
+
+      bool PortfolioSolver::isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+
+        this->race(node, 0, &st, timeout, solvingTime, "PortfolioSolver::isSat()");
+
+        if (status)
+          *status = st;
+
+        return st == triton::engines::solver::SAT;
+      }
+
+
+      std::string PortfolioSolver::getName(void) const {
+        return "portfolio";
+      }
+
+
+      void PortfolioSolver::setTimeout(triton::uint32 ms) {
+        this->timeout = ms;
+      }
+
+
+      void PortfolioSolver::setMemoryLimit(triton::uint32 limit) {
+        this->memoryLimit = limit;
+      }
+
+
+      const std::vector<triton::engines::solver::solver_e>& PortfolioSolver::getBackends(void) const {
+        return this->backends;
+      }
+
+
+      void PortfolioSolver::setBackends(const std::vector<triton::engines::solver::solver_e>& kinds) {
+        if (kinds.empty())
+          throw triton::exceptions::SolverEngine("PortfolioSolver::setBackends(): The portfolio cannot be empty.");
+
+        /* Checks that every kind is supported */
+        for (const auto& kind : kinds)
+          this->newBackend(kind);
+
+        this->backends = kinds;
+      }
+
+
+      triton::engines::solver::solver_e PortfolioSolver::getLastWinner(void) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->lastWinner;
+      }
+
+
+      std::map<triton::engines::solver::solver_e, triton::usize> PortfolioSolver::getWins(void) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->wins;
+      }
+
+    };
+  };
+};
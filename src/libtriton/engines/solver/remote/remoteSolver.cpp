@@ -0,0 +1,257 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <chrono>
+#include <functional>
+#include <sstream>
+
+#include <triton/astSerializer.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/remoteSolver.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      /* The time given to reach a server (in milliseconds) */
+      static const triton::uint32 connectTimeout = 5000;
+
+      /* The time given to a server on top of the timeout of its query, e.g. to send its answer (in milliseconds) */
+      static const triton::uint32 answerSlack = 5000;
+
+      /* The max number of idle connections kept to each server */
+      static const triton::usize maxIdle = 8;
+
+
+      RemoteSolver::RemoteSolver() {
+        this->interrupted = false;
+        this->memoryLimit = 0;
+        this->timeout     = 0;
+      }
+
+
+      RemoteSolver::RemoteSolver(const RemoteSolver& other) {
+        this->interrupted = false;
+        this->memoryLimit = other.memoryLimit;
+        this->servers     = other.servers;
+        this->timeout     = other.timeout;
+      }
+
+
+      std::unique_ptr<SolverSocket> RemoteSolver::acquire(triton::usize index) const {
+        std::unique_ptr<SolverSocket> socket;
+
+        {
+          std::lock_guard<std::mutex> guard(this->servers->lock);
+          auto& idle = this->servers->idle[index];
+          while (!idle.empty() && socket == nullptr) {
+            socket = std::move(idle.back());
+            idle.pop_back();
+            if (!socket->isAlive())
+              socket.reset();
+          }
+        }
+
+        if (socket == nullptr)
+          socket = SolverSocket::connect(this->servers->endpoints[index], connectTimeout);
+
+        if (socket != nullptr) {
+          std::lock_guard<std::mutex> guard(this->runningLock);
+          this->running.insert(socket.get());
+        }
+
+        return socket;
+      }
+
+
+      void RemoteSolver::release(triton::usize index, std::unique_ptr<SolverSocket> socket, bool reuse) const {
+        {
+          std::lock_guard<std::mutex> guard(this->runningLock);
+          this->running.erase(socket.get());
+        }
+
+        if (reuse) {
+          std::lock_guard<std::mutex> guard(this->servers->lock);
+          if (this->servers->idle[index].size() < maxIdle)
+            this->servers->idle[index].push_back(std::move(socket));
+        }
+      }
+
+
+      RemoteAnswer RemoteSolver::query(const triton::ast::SharedAbstractNode& node, triton::engines::solver::remote_e kind, triton::uint32 limit, triton::uint32 timeout, const char* where) const {
+        RemoteAnswer answer;
+        RemoteQuery query;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine(std::string(where) + ": node cannot be null.");
+
+        if (node->isLogical() == false)
+          throw triton::exceptions::SolverEngine(std::string(where) + ": Must be a logical node.");
+
+        if (this->servers == nullptr)
+          throw triton::exceptions::SolverEngine(std::string(where) + ": No endpoint defined.");
+
+        /* The references are unrolled, so that the same query has the same bytes in every tracer */
+        std::ostringstream stream;
+        triton::ast::AstSerializer(node->getContext()).serialize(stream, {triton::ast::newInstance(node.get(), true /* unroll */)});
+
+        query.kind        = kind;
+        query.limit       = limit;
+        query.timeout     = timeout ? timeout : this->timeout;
+        query.memoryLimit = this->memoryLimit;
+        query.ast         = stream.str();
+
+        std::string message = query.encode();
+        std::string reply;
+
+        /* The same query always goes to the same server first, the next ones take over if it is down */
+        triton::usize count = this->servers->endpoints.size();
+        triton::usize first = std::hash<std::string>()(query.ast) % count;
+
+        for (triton::usize attempt = 0; attempt < count && !this->interrupted; attempt++) {
+          triton::usize index = (first + attempt) % count;
+          std::unique_ptr<SolverSocket> socket = this->acquire(index);
+          if (socket == nullptr)
+            continue;
+
+          if (!socket->send(message) || !socket->receive(reply, query.timeout ? query.timeout + answerSlack : 0)) {
+            /* A server which is still connected did not answer in time, the others would not do better */
+            bool alive = socket->isAlive();
+            this->release(index, std::move(socket), false);
+            if (alive && !this->interrupted)
+              answer.status = triton::engines::solver::TIMEOUT;
+            if (alive || this->interrupted)
+              break;
+            continue;
+          }
+
+          if (!answer.decode(reply)) {
+            this->release(index, std::move(socket), false);
+            throw triton::exceptions::SolverEngine(std::string(where) + ": Malformed answer from " + this->servers->endpoints[index] + ".");
+          }
+
+          this->release(index, std::move(socket), true);
+
+          if (!answer.error.empty())
+            throw triton::exceptions::SolverEngine(std::string(where) + ": " + this->servers->endpoints[index] + ": " + answer.error);
+
+          return answer;
+        }
+
+        answer.models.clear();
+        return answer;
+      }
+
+
+      std::unordered_map<triton::usize, SolverModel> RemoteSolver::getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        auto models = this->getModels(node, 1, status, timeout, solvingTime);
+        return models.empty() ? std::unordered_map<triton::usize, SolverModel>() : models.front();
+      }
+
+
+      std::vector<std::unordered_map<triton::usize, SolverModel>> RemoteSolver::getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicVariable> variables;
+        std::vector<std::unordered_map<triton::usize, SolverModel>> ret;
+
+        auto start = std::chrono::system_clock::now();
+        RemoteAnswer answer = this->query(node, REMOTE_GET_MODELS, limit, timeout, "RemoteSolver::getModels()");
+        auto end = std::chrono::system_clock::now();
+
+        /* The servers answer with the ids of the variables */
+        for (const auto& var : triton::ast::search(node, triton::ast::VARIABLE_NODE)) {
+          const auto& symVar = reinterpret_cast<triton::ast::VariableNode*>(var.get())->getSymbolicVariable();
+          variables[symVar->getId()] = symVar;
+        }
+
+        for (const auto& model : answer.models) {
+          std::unordered_map<triton::usize, SolverModel> smodel;
+          for (const auto& entry : model) {
+            auto it = variables.find(entry.first);
+            if (it != variables.end())
+              smodel[entry.first] = SolverModel(it->second, entry.second);
+          }
+          if (!smodel.empty())
+            ret.push_back(smodel);
+        }
+
+        if (status)
+          *status = answer.status;
+
+        if (solvingTime)
+          *solvingTime = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+
+        return ret;
+      }
+
+
+      bool RemoteSolver::isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        auto start = std::chrono::system_clock::now();
+        RemoteAnswer answer = this->query(node, REMOTE_IS_SAT, 0, timeout, "RemoteSolver::isSat()");
+        auto end = std::chrono::system_clock::now();
+
+        if (status)
+          *status = answer.status;
+
+        if (solvingTime)
+          *solvingTime = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+
+        return answer.status == triton::engines::solver::SAT;
+      }
+
+
+      std::string RemoteSolver::getName(void) const {
+        return "remote";
+      }
+
+
+      void RemoteSolver::setTimeout(triton::uint32 ms) {
+        this->timeout = ms;
+      }
+
+
+      void RemoteSolver::setMemoryLimit(triton::uint32 limit) {
+        this->memoryLimit = limit;
+      }
+
+
+      void RemoteSolver::interrupt(void) {
+        std::lock_guard<std::mutex> guard(this->runningLock);
+
+        this->interrupted = true;
+        for (auto* socket : this->running)
+          socket->kill();
+      }
+
+
+      std::vector<std::string> RemoteSolver::getEndpoints(void) const {
+        if (this->servers == nullptr)
+          return {};
+        return this->servers->endpoints;
+      }
+
+
+      void RemoteSolver::setEndpoints(const std::vector<std::string>& endpoints) {
+        if (endpoints.empty()) {
+          this->servers = nullptr;
+          return;
+        }
+
+        for (const auto& endpoint : endpoints) {
+          if (endpoint.rfind(':') == std::string::npos)
+            throw triton::exceptions::SolverEngine("RemoteSolver::setEndpoints(): Invalid endpoint " + endpoint + ", expects host:port.");
+        }
+
+        this->servers = std::make_shared<Servers>();
+        this->servers->endpoints = endpoints;
+        this->servers->idle.resize(endpoints.size());
+      }
+
+    };
+  };
+};
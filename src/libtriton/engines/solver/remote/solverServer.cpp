@@ -0,0 +1,293 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <exception>
+
+#include <triton/astContext.hpp>
+#include <triton/astSerializer.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/modes.hpp>
+#include <triton/solverServer.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      /* The time a listener waits for a connection before checking that the server still runs (in milliseconds) */
+      static const triton::uint32 acceptTimeout = 100;
+
+
+      SolverServer::SolverServer(triton::engines::solver::solver_e kind) {
+        this->busy     = 0;
+        this->capacity = 65536;
+        this->hits     = 0;
+        this->kind     = kind;
+        this->queries  = 0;
+        this->running  = false;
+        this->workers  = std::max<triton::usize>(1, std::thread::hardware_concurrency());
+      }
+
+
+      SolverServer::~SolverServer() {
+        this->stop();
+      }
+
+
+      triton::uint16 SolverServer::start(const std::string& endpoint) {
+        if (this->running)
+          throw triton::exceptions::SolverEngine("SolverServer::start(): The server is already running.");
+
+        if (this->kind == triton::engines::solver::SOLVER_CUSTOM || this->kind == triton::engines::solver::SOLVER_REMOTE)
+          throw triton::exceptions::SolverEngine("SolverServer::start(): The queries must be solved by a local solver.");
+
+        /* The solver is checked once, before the first query */
+        triton::engines::solver::SolverEngine engine;
+        engine.setSolver(this->kind);
+
+        this->listener.reset(new SolverListener(endpoint));
+        this->running  = true;
+        this->acceptor = std::thread(&SolverServer::accept, this);
+
+        return this->listener->getPort();
+      }
+
+
+      void SolverServer::stop(void) {
+        if (!this->running.exchange(false))
+          return;
+
+        this->listener->close();
+        this->acceptor.join();
+
+        /* The threads solving a query send their answer to a closed connection */
+        std::lock_guard<std::mutex> guard(this->clientsLock);
+        for (auto& client : this->clients)
+          client->socket->kill();
+        for (auto& client : this->clients)
+          client->thread.join();
+
+        this->clients.clear();
+        this->listener.reset();
+      }
+
+
+      bool SolverServer::isRunning(void) const {
+        return this->running;
+      }
+
+
+      void SolverServer::accept(void) {
+        while (this->running) {
+          std::unique_ptr<SolverSocket> socket = this->listener->accept(acceptTimeout);
+          std::lock_guard<std::mutex> guard(this->clientsLock);
+
+          /* The threads of the closed connections are joined */
+          for (auto it = this->clients.begin(); it != this->clients.end();) {
+            if ((*it)->finished) {
+              (*it)->thread.join();
+              it = this->clients.erase(it);
+            }
+            else {
+              it++;
+            }
+          }
+
+          if (socket == nullptr || !this->running)
+            continue;
+
+          this->clients.emplace_back(new Client());
+          Client& client = *this->clients.back();
+          client.finished = false;
+          client.socket   = std::move(socket);
+          client.thread   = std::thread(&SolverServer::serve, this, std::ref(client));
+        }
+      }
+
+
+      void SolverServer::serve(Client& client) {
+        triton::engines::solver::SolverEngine engine;
+        std::string message;
+
+        engine.setSolver(this->kind);
+
+        while (this->running && client.socket->receive(message, 0)) {
+          RemoteAnswer answer;
+          RemoteQuery query;
+
+          if (query.decode(message))
+            answer = this->answer(query, engine);
+          else
+            answer.error = "Malformed query.";
+
+          if (!client.socket->send(answer.encode()))
+            break;
+        }
+
+        client.finished = true;
+      }
+
+
+      RemoteAnswer SolverServer::answer(const RemoteQuery& query, triton::engines::solver::SolverEngine& engine) {
+        std::shared_ptr<Result> result;
+        std::string key = query.getKey();
+        RemoteAnswer answer;
+
+        this->queries++;
+
+        /* The first thread receiving a query solves it, the other ones wait for its answer */
+        {
+          std::unique_lock<std::mutex> guard(this->resultsLock);
+          while (result == nullptr) {
+            auto it = this->results.find(key);
+            if (it == this->results.end()) {
+              result = std::make_shared<Result>();
+              result->cached = false;
+              result->done   = false;
+              this->results[key] = result;
+              break;
+            }
+
+            std::shared_ptr<Result> other = it->second;
+            this->resultDone.wait(guard, [&other]() { return other->done; });
+
+            /* An answer which is not cached depends on the limits of its query, which is solved again */
+            if (other->cached) {
+              this->hits++;
+              answer = other->answer;
+              answer.cached = true;
+              return answer;
+            }
+          }
+        }
+
+        try {
+          answer = this->solve(query, engine);
+        }
+        catch (const std::exception& e) {
+          answer = RemoteAnswer();
+          answer.error = e.what();
+        }
+
+        {
+          std::lock_guard<std::mutex> guard(this->resultsLock);
+          result->answer = answer;
+          result->cached = answer.error.empty() && (answer.status == triton::engines::solver::SAT || answer.status == triton::engines::solver::UNSAT);
+          result->done   = true;
+
+          if (result->cached) {
+            this->order.push_back(key);
+            while (this->order.size() > this->capacity) {
+              this->results.erase(this->order.front());
+              this->order.pop_front();
+            }
+          }
+          else {
+            this->results.erase(key);
+          }
+        }
+
+        this->resultDone.notify_all();
+        return answer;
+      }
+
+
+      RemoteAnswer SolverServer::solve(const RemoteQuery& query, triton::engines::solver::SolverEngine& engine) {
+        RemoteAnswer answer;
+
+        {
+          std::unique_lock<std::mutex> guard(this->workersLock);
+          this->workerFree.wait(guard, [this]() { return this->busy < this->workers; });
+          this->busy++;
+        }
+
+        try {
+          /* Each query is loaded into its own AST context, dropped once it is solved */
+          triton::modes::SharedModes modes = std::make_shared<triton::modes::Modes>();
+          triton::ast::SharedAstContext ctxt = std::make_shared<triton::ast::AstContext>(modes);
+          triton::ast::AstSerializer serializer(ctxt);
+
+          std::vector<triton::ast::SharedAbstractNode> roots = serializer.deserialize(query.ast.data(), query.ast.size());
+          if (roots.size() != 1)
+            throw triton::exceptions::SolverEngine("SolverServer::solve(): Expects one node per query.");
+
+          engine.setMemoryLimit(query.memoryLimit);
+
+          if (query.kind == REMOTE_IS_SAT) {
+            engine.isSat(roots.front(), &answer.status, query.timeout, &answer.solvingTime);
+          }
+          else {
+            for (const auto& model : engine.getModels(roots.front(), query.limit, &answer.status, query.timeout, &answer.solvingTime)) {
+              answer.models.emplace_back();
+              for (const auto& it : model)
+                answer.models.back().push_back({it.first, it.second.getValue()});
+            }
+          }
+        }
+        catch (...) {
+          std::lock_guard<std::mutex> guard(this->workersLock);
+          this->busy--;
+          this->workerFree.notify_one();
+          throw;
+        }
+
+        {
+          std::lock_guard<std::mutex> guard(this->workersLock);
+          this->busy--;
+        }
+
+        this->workerFree.notify_one();
+        return answer;
+      }
+
+
+      triton::usize SolverServer::getWorkers(void) {
+        std::lock_guard<std::mutex> guard(this->workersLock);
+        return this->workers;
+      }
+
+
+      void SolverServer::setWorkers(triton::usize workers) {
+        {
+          std::lock_guard<std::mutex> guard(this->workersLock);
+          this->workers = std::max<triton::usize>(1, workers);
+        }
+        this->workerFree.notify_all();
+      }
+
+
+      triton::usize SolverServer::getCacheCapacity(void) {
+        std::lock_guard<std::mutex> guard(this->resultsLock);
+        return this->capacity;
+      }
+
+
+      void SolverServer::setCacheCapacity(triton::usize capacity) {
+        std::lock_guard<std::mutex> guard(this->resultsLock);
+
+        this->capacity = capacity;
+        while (this->order.size() > this->capacity) {
+          this->results.erase(this->order.front());
+          this->order.pop_front();
+        }
+      }
+
+
+      triton::usize SolverServer::getQueries(void) const {
+        return this->queries;
+      }
+
+
+      triton::usize SolverServer::getHits(void) const {
+        return this->hits;
+      }
+
+    };
+  };
+};
@@ -0,0 +1,580 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+
+#include <triton/exceptions.hpp>
+#include <triton/solverSocket.hpp>
+
+#if !defined(_WIN32)
+  #include <fcntl.h>
+  #include <netdb.h>
+  #include <netinet/in.h>
+  #include <netinet/tcp.h>
+  #include <poll.h>
+  #include <sys/socket.h>
+  #include <unistd.h>
+#endif
+
+/* Writing to a closed connection must not raise SIGPIPE in the tracer */
+#if defined(MSG_NOSIGNAL)
+  #define TRITON_SEND_FLAGS MSG_NOSIGNAL
+#else
+  #define TRITON_SEND_FLAGS 0
+#endif
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      /* The max size of a message, a larger size is a corrupted stream */
+      static const triton::usize maxMessageSize = 1ULL << 31;
+
+
+      /* Appends `value` on `size` bytes, little-endian */
+      static void put(std::string& out, triton::uint64 value, triton::usize size) {
+        for (triton::usize index = 0; index < size; index++)
+          out.push_back(static_cast<char>((value >> (index * 8)) & 0xff));
+      }
+
+
+      /* Reads `size` bytes at `offset`, little-endian. Returns false past the end of `in` */
+      static bool get(const std::string& in, triton::usize& offset, triton::usize size, triton::uint64& value) {
+        if (offset > in.size() || size > in.size() - offset)
+          return false;
+
+        value = 0;
+        for (triton::usize index = 0; index < size; index++)
+          value |= static_cast<triton::uint64>(static_cast<triton::uint8>(in[offset + index])) << (index * 8);
+        offset += size;
+
+        return true;
+      }
+
+
+      /* Returns the milliseconds of the steady clock */
+      static triton::uint64 now(void) {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+      }
+
+
+      /* Splits "host:port", the host may be a bracketed IPv6 address */
+      static bool splitEndpoint(const std::string& endpoint, std::string& host, std::string& port) {
+        triton::usize colon = endpoint.rfind(':');
+        if (colon == std::string::npos || colon + 1 == endpoint.size())
+          return false;
+
+        host = endpoint.substr(0, colon);
+        port = endpoint.substr(colon + 1);
+        if (host.size() >= 2 && host.front() == '[' && host.back() == ']')
+          host = host.substr(1, host.size() - 2);
+
+        return true;
+      }
+
+
+      std::string RemoteQuery::encode(void) const {
+        std::string message;
+
+        message.reserve(16 + this->ast.size());
+        put(message, this->kind, 4);
+        put(message, this->limit, 4);
+        put(message, this->timeout, 4);
+        put(message, this->memoryLimit, 4);
+        message += this->ast;
+
+        return message;
+      }
+
+
+      bool RemoteQuery::decode(const std::string& message) {
+        triton::usize offset = 0;
+        triton::uint64 fields[4];
+
+        for (triton::uint64& field : fields) {
+          if (!get(message, offset, 4, field))
+            return false;
+        }
+
+        this->kind        = static_cast<triton::uint32>(fields[0]);
+        this->limit       = static_cast<triton::uint32>(fields[1]);
+        this->timeout     = static_cast<triton::uint32>(fields[2]);
+        this->memoryLimit = static_cast<triton::uint32>(fields[3]);
+        this->ast         = message.substr(offset);
+
+        return this->kind == REMOTE_IS_SAT || this->kind == REMOTE_GET_MODELS;
+      }
+
+
+      std::string RemoteQuery::getKey(void) const {
+        std::string key;
+
+        /* The limits of the solver are left out, only the answers which do not depend on them are cached */
+        key.reserve(8 + this->ast.size());
+        put(key, this->kind, 4);
+        put(key, (this->kind == REMOTE_GET_MODELS) ? this->limit : 0, 4);
+        key += this->ast;
+
+        return key;
+      }
+
+
+      RemoteAnswer::RemoteAnswer() {
+        this->cached      = false;
+        this->solvingTime = 0;
+        this->status      = triton::engines::solver::UNKNOWN;
+      }
+
+
+      /*
+       * The layout of an answer is:
+       *
+       *  status:u32, solvingTime:u32, cached:u32, error size:u32, error, models:u32
+       *  then, for each model, entries:u32 and, for each entry, id:u64, size:u32, value (little-endian)
+       */
+      std::string RemoteAnswer::encode(void) const {
+        std::string message;
+
+        put(message, this->status, 4);
+        put(message, this->solvingTime, 4);
+        put(message, this->cached ? 1 : 0, 4);
+        put(message, this->error.size(), 4);
+        message += this->error;
+        put(message, this->models.size(), 4);
+
+        for (const auto& model : this->models) {
+          put(message, model.size(), 4);
+          for (const auto& entry : model) {
+            std::string value;
+            for (triton::uint512 v = entry.second; v != 0; v >>= 8)
+              value.push_back(static_cast<char>((v & 0xff).convert_to<triton::uint32>()));
+            put(message, entry.first, 8);
+            put(message, value.size(), 4);
+            message += value;
+          }
+        }
+
+        return message;
+      }
+
+
+      bool RemoteAnswer::decode(const std::string& message) {
+        triton::usize offset = 0;
+        triton::uint64 status, time, cached, size, count;
+
+        if (!get(message, offset, 4, status) || !get(message, offset, 4, time) || !get(message, offset, 4, cached) || !get(message, offset, 4, size))
+          return false;
+
+        if (status > triton::engines::solver::UNKNOWN || size > message.size() - offset)
+          return false;
+
+        this->status      = static_cast<triton::engines::solver::status_e>(status);
+        this->solvingTime = static_cast<triton::uint32>(time);
+        this->cached      = (cached != 0);
+        this->error       = message.substr(offset, static_cast<triton::usize>(size));
+        offset += static_cast<triton::usize>(size);
+
+        if (!get(message, offset, 4, count))
+          return false;
+
+        this->models.clear();
+        for (triton::uint64 index = 0; index < count; index++) {
+          triton::uint64 entries;
+          if (!get(message, offset, 4, entries))
+            return false;
+
+          this->models.emplace_back();
+          for (triton::uint64 entry = 0; entry < entries; entry++) {
+            triton::uint64 id, bytes;
+            if (!get(message, offset, 8, id) || !get(message, offset, 4, bytes) || bytes > 64 || bytes > message.size() - offset)
+              return false;
+
+            triton::uint512 value = 0;
+            for (triton::usize byte = 0; byte < bytes; byte++)
+              value |= triton::uint512(static_cast<triton::uint8>(message[offset + byte])) << (byte * 8);
+            offset += static_cast<triton::usize>(bytes);
+
+            this->models.back().push_back({static_cast<triton::usize>(id), value});
+          }
+        }
+
+        return offset == message.size();
+      }
+
+
+      #if defined(_WIN32)
+
+      SolverSocket::SolverSocket(int fd) {
+        throw triton::exceptions::SolverEngine("SolverSocket::SolverSocket(): Remote solvers are not supported on this platform.");
+      }
+
+      SolverSocket::~SolverSocket() {
+      }
+
+      std::unique_ptr<SolverSocket> SolverSocket::connect(const std::string& endpoint, triton::uint32 timeout) {
+        throw triton::exceptions::SolverEngine("SolverSocket::connect(): Remote solvers are not supported on this platform.");
+      }
+
+      bool SolverSocket::fill(triton::usize size, triton::uint64 deadline) {
+        return false;
+      }
+
+      bool SolverSocket::isAlive(void) {
+        return false;
+      }
+
+      bool SolverSocket::send(const std::string& message) {
+        return false;
+      }
+
+      bool SolverSocket::receive(std::string& message, triton::uint32 timeout) {
+        return false;
+      }
+
+      void SolverSocket::kill(void) {
+      }
+
+      SolverListener::SolverListener(const std::string& endpoint) {
+        throw triton::exceptions::SolverEngine("SolverListener::SolverListener(): Solver servers are not supported on this platform.");
+      }
+
+      SolverListener::~SolverListener() {
+      }
+
+      triton::uint16 SolverListener::getPort(void) const {
+        return 0;
+      }
+
+      std::unique_ptr<SolverSocket> SolverListener::accept(triton::uint32 timeout) {
+        return nullptr;
+      }
+
+      void SolverListener::close(void) {
+      }
+
+      #else
+
+      /* Creates a socket, not inherited by the processes spawned (see `Smt2Process`) */
+      static int newSocket(int family, int type, int protocol) {
+        #if defined(SOCK_CLOEXEC)
+        int fd = socket(family, type | SOCK_CLOEXEC, protocol);
+        #else
+        int fd = socket(family, type, protocol);
+        if (fd >= 0)
+          fcntl(fd, F_SETFD, FD_CLOEXEC);
+        #endif
+
+        #if defined(SO_NOSIGPIPE)
+        int on = 1;
+        if (fd >= 0)
+          setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+        #endif
+
+        return fd;
+      }
+
+
+      SolverSocket::SolverSocket(int fd) {
+        int on = 1;
+
+        this->dead = (fd < 0);
+        this->fd   = fd;
+
+        /* The messages are small and answered, they are not delayed */
+        if (fd >= 0)
+          setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+      }
+
+
+      SolverSocket::~SolverSocket() {
+        if (this->fd >= 0)
+          ::close(this->fd);
+      }
+
+
+      std::unique_ptr<SolverSocket> SolverSocket::connect(const std::string& endpoint, triton::uint32 timeout) {
+        struct addrinfo hints;
+        struct addrinfo* addresses = nullptr;
+        std::string host, port;
+
+        if (!splitEndpoint(endpoint, host, port))
+          throw triton::exceptions::SolverEngine("SolverSocket::connect(): Invalid endpoint " + endpoint + ", expects host:port.");
+
+        std::memset(&hints, 0, sizeof(hints));
+        hints.ai_family   = AF_UNSPEC;
+        hints.ai_socktype = SOCK_STREAM;
+
+        if (getaddrinfo(host.c_str(), port.c_str(), &hints, &addresses) != 0)
+          return nullptr;
+
+        int fd = -1;
+        for (struct addrinfo* address = addresses; address != nullptr && fd < 0; address = address->ai_next) {
+          fd = newSocket(address->ai_family, address->ai_socktype, address->ai_protocol);
+          if (fd < 0)
+            continue;
+
+          /* Connects without blocking, so that an unreachable server is given up after the timeout */
+          int flags = fcntl(fd, F_GETFL, 0);
+          fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+
+          int error = 0;
+          if (::connect(fd, address->ai_addr, address->ai_addrlen) != 0) {
+            error = errno;
+            if (error == EINPROGRESS) {
+              struct pollfd pfd;
+              pfd.fd      = fd;
+              pfd.events  = POLLOUT;
+              pfd.revents = 0;
+
+              int ready;
+              do {
+                ready = poll(&pfd, 1, timeout ? static_cast<int>(timeout) : -1);
+              } while (ready < 0 && errno == EINTR);
+
+              socklen_t length = sizeof(error);
+              error = ETIMEDOUT;
+              if (ready > 0)
+                getsockopt(fd, SOL_SOCKET, SO_ERROR, &error, &length);
+            }
+          }
+
+          if (error != 0) {
+            ::close(fd);
+            fd = -1;
+            continue;
+          }
+
+          fcntl(fd, F_SETFL, flags);
+        }
+
+        freeaddrinfo(addresses);
+
+        if (fd < 0)
+          return nullptr;
+
+        return std::unique_ptr<SolverSocket>(new SolverSocket(fd));
+      }
+
+
+      bool SolverSocket::isAlive(void) {
+        if (this->dead)
+          return false;
+
+        /* An idle connection is not readable, unless its peer closed it */
+        struct pollfd pfd;
+        pfd.fd      = this->fd;
+        pfd.events  = POLLIN;
+        pfd.revents = 0;
+
+        if (poll(&pfd, 1, 0) > 0) {
+          char byte;
+          if ((pfd.revents & (POLLERR | POLLHUP | POLLNVAL)) || recv(this->fd, &byte, 1, MSG_PEEK) <= 0)
+            this->dead = true;
+        }
+
+        return !this->dead;
+      }
+
+
+      bool SolverSocket::send(const std::string& message) {
+        std::string frame;
+
+        if (message.size() >= maxMessageSize)
+          throw triton::exceptions::SolverEngine("SolverSocket::send(): The message is too large.");
+
+        put(frame, message.size(), 4);
+        frame += message;
+
+        const char* data = frame.data();
+        triton::usize size = frame.size();
+
+        while (size && !this->dead) {
+          ssize_t n = ::send(this->fd, data, size, TRITON_SEND_FLAGS);
+          if (n < 0 && errno == EINTR)
+            continue;
+          if (n <= 0) {
+            this->dead = true;
+            break;
+          }
+          data += n;
+          size -= n;
+        }
+
+        return !this->dead;
+      }
+
+
+      bool SolverSocket::fill(triton::usize size, triton::uint64 deadline) {
+        char chunk[65536];
+
+        while (this->buffer.size() < size) {
+          if (this->dead)
+            return false;
+
+          int wait = -1;
+          if (deadline) {
+            triton::uint64 current = now();
+            if (current >= deadline)
+              return false;
+            wait = static_cast<int>(deadline - current);
+          }
+
+          struct pollfd pfd;
+          pfd.fd      = this->fd;
+          pfd.events  = POLLIN;
+          pfd.revents = 0;
+
+          int ready = poll(&pfd, 1, wait);
+          if (ready < 0 && errno == EINTR)
+            continue;
+          if (ready == 0)
+            return false;
+
+          ssize_t n = recv(this->fd, chunk, sizeof(chunk), 0);
+          if (n < 0 && errno == EINTR)
+            continue;
+          if (n <= 0) {
+            this->dead = true;
+            return false;
+          }
+
+          this->buffer.append(chunk, n);
+        }
+
+        return true;
+      }
+
+
+      bool SolverSocket::receive(std::string& message, triton::uint32 timeout) {
+        triton::uint64 deadline = timeout ? now() + timeout : 0;
+        triton::usize offset = 0;
+        triton::uint64 size = 0;
+
+        if (!this->fill(4, deadline))
+          return false;
+
+        get(this->buffer, offset, 4, size);
+        if (size >= maxMessageSize) {
+          this->kill();
+          return false;
+        }
+
+        if (!this->fill(4 + static_cast<triton::usize>(size), deadline))
+          return false;
+
+        message = this->buffer.substr(4, static_cast<triton::usize>(size));
+        this->buffer.erase(0, 4 + static_cast<triton::usize>(size));
+
+        return true;
+      }
+
+
+      void SolverSocket::kill(void) {
+        this->dead = true;
+        if (this->fd >= 0)
+          shutdown(this->fd, SHUT_RDWR);
+      }
+
+
+      SolverListener::SolverListener(const std::string& endpoint) {
+        struct addrinfo hints;
+        struct addrinfo* addresses = nullptr;
+        std::string host, port;
+
+        this->closed = false;
+        this->fd     = -1;
+        this->port   = 0;
+
+        if (!splitEndpoint(endpoint, host, port))
+          throw triton::exceptions::SolverEngine("SolverListener::SolverListener(): Invalid endpoint " + endpoint + ", expects host:port.");
+
+        std::memset(&hints, 0, sizeof(hints));
+        hints.ai_family   = AF_UNSPEC;
+        hints.ai_socktype = SOCK_STREAM;
+        hints.ai_flags    = AI_PASSIVE;
+
+        if (getaddrinfo(host.empty() ? nullptr : host.c_str(), port.c_str(), &hints, &addresses) != 0)
+          throw triton::exceptions::SolverEngine("SolverListener::SolverListener(): Cannot resolve " + endpoint + ".");
+
+        for (struct addrinfo* address = addresses; address != nullptr && this->fd < 0; address = address->ai_next) {
+          int on = 1;
+
+          this->fd = newSocket(address->ai_family, address->ai_socktype, address->ai_protocol);
+          if (this->fd < 0)
+            continue;
+
+          setsockopt(this->fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+          if (bind(this->fd, address->ai_addr, address->ai_addrlen) != 0 || listen(this->fd, SOMAXCONN) != 0) {
+            ::close(this->fd);
+            this->fd = -1;
+          }
+        }
+
+        freeaddrinfo(addresses);
+
+        if (this->fd < 0)
+          throw triton::exceptions::SolverEngine("SolverListener::SolverListener(): Cannot listen to " + endpoint + ": " + std::strerror(errno) + ".");
+
+        struct sockaddr_storage address;
+        socklen_t length = sizeof(address);
+        if (getsockname(this->fd, reinterpret_cast<struct sockaddr*>(&address), &length) == 0) {
+          if (address.ss_family == AF_INET)
+            this->port = ntohs(reinterpret_cast<struct sockaddr_in*>(&address)->sin_port);
+          else if (address.ss_family == AF_INET6)
+            this->port = ntohs(reinterpret_cast<struct sockaddr_in6*>(&address)->sin6_port);
+        }
+      }
+
+
+      SolverListener::~SolverListener() {
+        if (this->fd >= 0)
+          ::close(this->fd);
+      }
+
+
+      triton::uint16 SolverListener::getPort(void) const {
+        return this->port;
+      }
+
+
+      std::unique_ptr<SolverSocket> SolverListener::accept(triton::uint32 timeout) {
+        struct pollfd pfd;
+        pfd.fd      = this->fd;
+        pfd.events  = POLLIN;
+        pfd.revents = 0;
+
+        if (this->closed || poll(&pfd, 1, static_cast<int>(timeout)) <= 0 || this->closed)
+          return nullptr;
+
+        int client = ::accept(this->fd, nullptr, nullptr);
+        if (client < 0)
+          return nullptr;
+
+        fcntl(client, F_SETFD, FD_CLOEXEC);
+        #if defined(SO_NOSIGPIPE)
+        int on = 1;
+        setsockopt(client, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+        #endif
+
+        return std::unique_ptr<SolverSocket>(new SolverSocket(client));
+      }
+
+
+      void SolverListener::close(void) {
+        this->closed = true;
+        shutdown(this->fd, SHUT_RDWR);
+      }
+
+      #endif
+
+    };
+  };
+};
@@ -0,0 +1,154 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <unordered_set>
+
+#include <triton/exceptions.hpp>
+#include <triton/solverBudget.hpp>
+#include <triton/symbolicVariable.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      SolverBudget::SolverBudget() {
+        this->budget      = 0;
+        this->baseTimeout = 1000;
+        this->enabled     = false;
+        this->maxTimeout  = 60000;
+        this->retries     = 0;
+        this->spent       = 0;
+      }
+
+
+      bool SolverBudget::isEnabled(void) const {
+        return this->enabled;
+      }
+
+
+      void SolverBudget::setEnabled(bool flag) {
+        this->enabled = flag;
+      }
+
+
+      triton::uint32 SolverBudget::getTimeout(const triton::ast::SharedAbstractNode& node, triton::uint64 address) const {
+        std::unordered_set<triton::usize> variables;
+        triton::usize nodes = 0;
+        triton::uint64 timeout = 0;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverBudget::getTimeout(): node cannot be null.");
+
+        auto it = this->branches.find(address);
+
+        /* Escalated once the previous timeout is spent */
+        if (it != this->branches.end() && it->second.status == triton::engines::solver::TIMEOUT) {
+          timeout = static_cast<triton::uint64>(it->second.timeout) * 4;
+        }
+        else {
+          triton::ast::childrenTraversal(node, true /* unroll */, [&](const triton::ast::SharedAbstractNode& n) {
+            if (n->getType() == triton::ast::VARIABLE_NODE)
+              variables.insert(reinterpret_cast<triton::ast::VariableNode*>(n.get())->getSymbolicVariable()->getId());
+            else if (n->getType() != triton::ast::REFERENCE_NODE)
+              nodes++;
+          });
+
+          triton::usize log = 0;
+          while ((static_cast<triton::uint64>(1) << (log + 1)) <= nodes + 1)
+            log++;
+
+          timeout = static_cast<triton::uint64>(this->baseTimeout * (1.0 + log / 4.0 + variables.size() / 32.0));
+
+          /* Answered before, the query of the branch is likely as cheap */
+          if (it != this->branches.end()) {
+            triton::uint64 least = std::max<triton::uint64>(this->baseTimeout / 10, 1);
+            timeout = std::min(timeout, std::max(least, static_cast<triton::uint64>(it->second.time) * 4));
+          }
+        }
+
+        timeout = std::min<triton::uint64>(timeout, this->maxTimeout);
+        if (this->budget)
+          timeout = std::min(timeout, this->budget - std::min(this->spent, this->budget));
+
+        return static_cast<triton::uint32>(std::max<triton::uint64>(timeout, 1));
+      }
+
+
+      void SolverBudget::record(triton::uint64 address, triton::engines::solver::status_e status, triton::uint32 timeout, triton::uint32 time) {
+        auto it = this->branches.find(address);
+
+        if (it != this->branches.end() && it->second.status == triton::engines::solver::TIMEOUT)
+          this->retries++;
+
+        History& history = this->branches[address];
+        history.status  = status;
+        history.timeout = timeout;
+        history.time    = time;
+
+        this->spent += time;
+      }
+
+
+      bool SolverBudget::isRetryable(triton::uint64 address) const {
+        auto it = this->branches.find(address);
+        return it != this->branches.end() && it->second.status == triton::engines::solver::TIMEOUT && it->second.timeout < this->maxTimeout;
+      }
+
+
+      bool SolverBudget::isExhausted(void) const {
+        return this->budget != 0 && this->spent >= this->budget;
+      }
+
+
+      triton::uint32 SolverBudget::getBaseTimeout(void) const {
+        return this->baseTimeout;
+      }
+
+
+      triton::uint32 SolverBudget::getMaxTimeout(void) const {
+        return this->maxTimeout;
+      }
+
+
+      triton::uint64 SolverBudget::getBudget(void) const {
+        return this->budget;
+      }
+
+
+      triton::uint64 SolverBudget::getSpent(void) const {
+        return this->spent;
+      }
+
+
+      triton::usize SolverBudget::getRetries(void) const {
+        return this->retries;
+      }
+
+
+      void SolverBudget::setBudget(triton::uint64 budget, triton::uint32 baseTimeout, triton::uint32 maxTimeout) {
+        if (baseTimeout == 0 || maxTimeout < baseTimeout)
+          throw triton::exceptions::SolverEngine("SolverBudget::setBudget(): The base timeout must be positive and at most the max timeout.");
+
+        this->budget      = budget;
+        this->baseTimeout = baseTimeout;
+        this->maxTimeout  = maxTimeout;
+        this->spent       = 0;
+      }
+
+
+      void SolverBudget::reset(void) {
+        this->branches.clear();
+        this->retries = 0;
+        this->spent   = 0;
+      }
+
+    };
+  };
+};
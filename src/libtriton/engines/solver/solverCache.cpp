@@ -0,0 +1,389 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+#include <triton/astContext.hpp>
+#include <triton/astEvaluator.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/solverCache.hpp>
+#include <triton/symbolicExpression.hpp>
+#include <triton/symbolicVariable.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      SolverCache::SolverCache() {
+        this->capacity        = 0;
+        this->counterexamples = 0;
+        this->hits            = 0;
+        this->misses          = 0;
+        this->values          = 0;
+      }
+
+
+      SolverCache::Key SolverCache::keyOf(const triton::ast::SharedAbstractNode& node) {
+        triton::uint128 hash = node->getHash();
+        return Key(static_cast<triton::uint64>(hash >> 64), static_cast<triton::uint64>(hash));
+      }
+
+
+      bool SolverCache::find(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e& status, std::unordered_map<triton::usize, SolverModel>* model) {
+        std::lock_guard<std::mutex> guard(this->lock);
+
+        if (this->capacity == 0 || node == nullptr)
+          return false;
+
+        auto it = this->entries.find(SolverCache::keyOf(node));
+
+        /* A SAT entry of an isSat() query does not answer a getModel() one */
+        if (it == this->entries.end() || (model != nullptr && !it->second.hasModel && it->second.status == triton::engines::solver::SAT)) {
+          this->misses++;
+          return false;
+        }
+
+        /* The entry becomes the most recently used one */
+        Entry& entry = it->second;
+        this->uses.splice(this->uses.begin(), this->uses, entry.use);
+        this->hits++;
+
+        status = entry.status;
+        if (model != nullptr) {
+          model->clear();
+          if (!entry.values.empty()) {
+            /* The values are given back to the variables of the query */
+            for (const auto& var : triton::ast::search(node, triton::ast::VARIABLE_NODE)) {
+              const auto& symVar = reinterpret_cast<triton::ast::VariableNode*>(var.get())->getSymbolicVariable();
+              auto value = entry.values.find(symVar->getId());
+              if (value != entry.values.end())
+                (*model)[symVar->getId()] = SolverModel(symVar, value->second);
+            }
+          }
+        }
+
+        return true;
+      }
+
+
+      std::vector<SolverCache::Key> SolverCache::conjunctsOf(const triton::ast::SharedAbstractNode& node) {
+        std::vector<triton::ast::AbstractNode*> worklist;
+        std::vector<Key> conjuncts;
+
+        worklist.push_back(node.get());
+        while (!worklist.empty()) {
+          auto* current = worklist.back();
+          worklist.pop_back();
+
+          if (current->getType() == triton::ast::REFERENCE_NODE) {
+            worklist.push_back(reinterpret_cast<triton::ast::ReferenceNode*>(current)->getSymbolicExpression()->getAst().get());
+            continue;
+          }
+
+          if (current->getType() == triton::ast::LAND_NODE) {
+            for (const auto& child : current->getChildren())
+              worklist.push_back(child.get());
+            continue;
+          }
+
+          /* E.g. the (= true true) of the path predicate */
+          if (!current->isSymbolized() && current->evaluate() != 0)
+            continue;
+
+          conjuncts.push_back(SolverCache::keyOf(current->shared_from_this()));
+        }
+
+        std::sort(conjuncts.begin(), conjuncts.end());
+        conjuncts.erase(std::unique(conjuncts.begin(), conjuncts.end()), conjuncts.end());
+
+        return conjuncts;
+      }
+
+
+      bool SolverCache::findCounterexample(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e& status, std::unordered_map<triton::usize, SolverModel>* model) {
+        std::lock_guard<std::mutex> guard(this->lock);
+
+        if (this->capacity == 0 || node == nullptr)
+          return false;
+
+        /* A query containing all the conjuncts of an UNSAT query is UNSAT */
+        if (!this->unsatConjuncts.empty()) {
+          auto conjuncts = SolverCache::conjunctsOf(node);
+          for (const auto& unsat : this->unsatConjuncts) {
+            if (std::includes(conjuncts.begin(), conjuncts.end(), unsat.begin(), unsat.end())) {
+              this->counterexamples++;
+              status = triton::engines::solver::UNSAT;
+              if (model != nullptr)
+                model->clear();
+              return true;
+            }
+          }
+        }
+
+        try {
+          triton::ast::AstEvaluator evaluator(node);
+          const auto& variables = evaluator.getVariables();
+          const auto& ctxt = node->getContext();
+          std::vector<std::vector<triton::uint512>> inputs;
+
+          /* The concrete values first, then the recent models. The values missing from a model are the concrete ones. */
+          inputs.push_back(std::vector<triton::uint512>());
+          for (const auto& var : variables)
+            inputs.front().push_back(ctxt->getVariableValue(var->getId()));
+
+          for (const auto& values : this->models) {
+            std::vector<triton::uint512> input = inputs.front();
+            bool known = false;
+            for (triton::usize index = 0; index < variables.size(); index++) {
+              auto it = values.find(variables[index]->getId());
+              if (it != values.end()) {
+                input[index] = it->second;
+                known = true;
+              }
+            }
+            if (known)
+              inputs.push_back(std::move(input));
+          }
+
+          auto outputs = evaluator.evaluateBatch(inputs);
+          for (triton::usize lane = 0; lane < outputs.size(); lane++) {
+            if (outputs[lane] == 0)
+              continue;
+
+            this->counterexamples++;
+            status = triton::engines::solver::SAT;
+            if (model != nullptr) {
+              model->clear();
+              for (triton::usize index = 0; index < variables.size(); index++)
+                (*model)[variables[index]->getId()] = SolverModel(variables[index], inputs[lane][index]);
+            }
+            return true;
+          }
+        }
+        catch (const triton::exceptions::Exception&) {
+          /* The query cannot be evaluated, e.g. a variable is dead */
+        }
+
+        return false;
+      }
+
+
+      void SolverCache::insert(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e status, const std::unordered_map<triton::usize, SolverModel>* model) {
+        std::lock_guard<std::mutex> guard(this->lock);
+
+        if (this->capacity == 0 || node == nullptr)
+          return;
+
+        if (status != triton::engines::solver::SAT && status != triton::engines::solver::UNSAT)
+          return;
+
+        Entry entry;
+        entry.status   = status;
+        entry.hasModel = (model != nullptr);
+        if (model != nullptr) {
+          for (const auto& it : *model)
+            entry.values[it.first] = it.second.getValue();
+        }
+
+        /* Counterexamples of the next queries */
+        if (status == triton::engines::solver::SAT && !entry.values.empty()) {
+          this->models.push_front(entry.values);
+          if (this->models.size() > SolverCache::modelsCapacity)
+            this->models.pop_back();
+        }
+        else if (status == triton::engines::solver::UNSAT) {
+          auto conjuncts = SolverCache::conjunctsOf(node);
+          if (!conjuncts.empty()) {
+            this->unsatConjuncts.push_front(std::move(conjuncts));
+            if (this->unsatConjuncts.size() > SolverCache::unsatCapacity)
+              this->unsatConjuncts.pop_back();
+          }
+        }
+
+        Key key = SolverCache::keyOf(node);
+        this->store(key, entry);
+        this->record(key, entry);
+      }
+
+
+      void SolverCache::insertUnsatCore(const std::vector<triton::ast::SharedAbstractNode>& core) {
+        std::lock_guard<std::mutex> guard(this->lock);
+        std::vector<Key> conjuncts;
+
+        if (this->capacity == 0)
+          return;
+
+        for (const auto& node : core) {
+          auto keys = SolverCache::conjunctsOf(node);
+          conjuncts.insert(conjuncts.end(), keys.begin(), keys.end());
+        }
+
+        std::sort(conjuncts.begin(), conjuncts.end());
+        conjuncts.erase(std::unique(conjuncts.begin(), conjuncts.end()), conjuncts.end());
+
+        if (!conjuncts.empty()) {
+          this->unsatConjuncts.push_front(std::move(conjuncts));
+          if (this->unsatConjuncts.size() > SolverCache::unsatCapacity)
+            this->unsatConjuncts.pop_back();
+        }
+      }
+
+
+      void SolverCache::record(const Key& key, Entry& entry) {
+        auto it = this->entries.find(key);
+        if (it != this->entries.end()) {
+          this->values -= it->second.values.size();
+          this->uses.erase(it->second.use);
+          this->entries.erase(it);
+        }
+
+        this->values += entry.values.size();
+        this->uses.push_front(key);
+        entry.use = this->uses.begin();
+        this->entries.insert(std::make_pair(key, std::move(entry)));
+        this->evict();
+      }
+
+
+      void SolverCache::evict(void) {
+        while (this->entries.size() > this->capacity) {
+          auto it = this->entries.find(this->uses.back());
+          this->values -= it->second.values.size();
+          this->entries.erase(it);
+          this->uses.pop_back();
+        }
+      }
+
+
+      void SolverCache::store(const Key& key, const Entry& entry) const {
+        if (this->path.empty())
+          return;
+
+        std::ofstream file(this->path, std::ios::app);
+        if (!file.is_open())
+          throw triton::exceptions::SolverEngine("SolverCache::store(): Cannot open the backing file.");
+
+        file << std::hex << key.first << " " << key.second << std::dec << " " << entry.status << " " << entry.hasModel << " " << entry.values.size();
+        for (const auto& it : entry.values)
+          file << " " << it.first << " 0x" << std::hex << it.second << std::dec;
+        file << std::endl;
+      }
+
+
+      bool SolverCache::isEnabled(void) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->capacity != 0;
+      }
+
+
+      triton::usize SolverCache::getCapacity(void) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->capacity;
+      }
+
+
+      void SolverCache::setCapacity(triton::usize capacity) {
+        std::lock_guard<std::mutex> guard(this->lock);
+
+        this->capacity = capacity;
+        this->evict();
+      }
+
+
+      void SolverCache::setBackingFile(const std::string& path) {
+        std::lock_guard<std::mutex> guard(this->lock);
+
+        this->path = path;
+        if (path.empty())
+          return;
+
+        /* A missing file is created by the first entry stored */
+        std::ifstream file(path);
+        if (!file.is_open())
+          return;
+
+        /* One entry per line: key (hex), status, model flag, number of values, then the values by variable id */
+        std::string line;
+        while (std::getline(file, line)) {
+          std::istringstream stream(line);
+          triton::uint32 status = 0;
+          triton::usize count = 0;
+          Key key;
+          Entry entry;
+
+          stream >> std::hex >> key.first >> key.second >> std::dec >> status >> entry.hasModel >> count;
+          if (stream.fail())
+            throw triton::exceptions::SolverEngine("SolverCache::setBackingFile(): Malformed entry.");
+
+          for (triton::usize index = 0; index < count; index++) {
+            triton::usize id = 0;
+            std::string value;
+            stream >> id >> value;
+            if (stream.fail())
+              throw triton::exceptions::SolverEngine("SolverCache::setBackingFile(): Malformed entry.");
+            entry.values[id] = triton::uint512(value);
+          }
+
+          entry.status = static_cast<triton::engines::solver::status_e>(status);
+          this->record(key, entry);
+        }
+      }
+
+
+      triton::usize SolverCache::getHits(void) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->hits;
+      }
+
+
+      triton::usize SolverCache::getMisses(void) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->misses;
+      }
+
+
+      triton::usize SolverCache::getCounterexampleHits(void) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->counterexamples;
+      }
+
+
+      triton::usize SolverCache::size(void) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->entries.size();
+      }
+
+
+      triton::usize SolverCache::getBytes(void) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+
+        /* A node of an unordered map holds its value, a link and the hash, and has a bucket. A node of a list holds its value and two links. */
+        triton::usize entry = sizeof(std::unordered_map<Key, Entry, KeyHash>::value_type) + 3 * sizeof(void*) + sizeof(Key) + 2 * sizeof(void*);
+        triton::usize value = sizeof(std::unordered_map<triton::usize, triton::uint512>::value_type) + 3 * sizeof(void*);
+        return this->entries.size() * entry + this->values * value;
+      }
+
+
+      void SolverCache::clear(void) {
+        std::lock_guard<std::mutex> guard(this->lock);
+        this->entries.clear();
+        this->values = 0;
+        this->models.clear();
+        this->unsatConjuncts.clear();
+        this->uses.clear();
+        this->counterexamples = 0;
+        this->hits            = 0;
+        this->misses          = 0;
+      }
+
+    };
+  };
+};
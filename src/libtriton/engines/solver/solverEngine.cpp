@@ -5,6 +5,16 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <algorithm>
+#include <map>
+#include <random>
+#include <set>
+#include <thread>
+#include <tuple>
+#include <utility>
+
+#include <triton/astContext.hpp>
+#include <triton/astEvaluator.hpp>
 #include <triton/config.hpp>
 #include <triton/exceptions.hpp>
 #include <triton/solverEngine.hpp>
@@ -16,7 +26,10 @@ namespace triton {
     namespace solver {
 
       SolverEngine::SolverEngine() {
-        this->kind = triton::engines::solver::SOLVER_INVALID;
+        this->kind        = triton::engines::solver::SOLVER_INVALID;
+        this->memoryLimit = 0;
+        this->threads     = std::max<triton::usize>(1, std::thread::hardware_concurrency());
+        this->timeout     = 0;
         #if defined(TRITON_Z3_INTERFACE)
         /* By default we initialized the z3 solver */
         this->setSolver(triton::engines::solver::SOLVER_Z3);
@@ -38,33 +51,55 @@ namespace triton {
       }
 
 
-      void SolverEngine::setSolver(triton::engines::solver::solver_e kind) {
+      std::unique_ptr<triton::engines::solver::SolverInterface> SolverEngine::newSolver(triton::engines::solver::solver_e kind, const char* where) const {
+        std::unique_ptr<triton::engines::solver::SolverInterface> solver;
+
         /* Allocate and init the good solver */
         switch (kind) {
           #ifdef TRITON_Z3_INTERFACE
           case triton::engines::solver::SOLVER_Z3:
-            /* init the new instance */
-            this->solver.reset(new(std::nothrow) triton::engines::solver::Z3Solver());
-            if (this->solver == nullptr)
-              throw triton::exceptions::SolverEngine("SolverEngine::setSolver(): Not enough memory.");
+            solver.reset(new(std::nothrow) triton::engines::solver::Z3Solver());
             break;
           #endif
           #ifdef TRITON_BITWUZLA_INTERFACE
           case triton::engines::solver::SOLVER_BITWUZLA:
-            /* init the new instance */
-            this->solver.reset(new(std::nothrow) triton::engines::solver::BitwuzlaSolver());
-            if (this->solver == nullptr)
-              throw triton::exceptions::SolverEngine("SolverEngine::setSolver(): Not enough memory.");
+            solver.reset(new(std::nothrow) triton::engines::solver::BitwuzlaSolver());
+            break;
+          #endif
+          #if defined(TRITON_Z3_INTERFACE) || defined(TRITON_BITWUZLA_INTERFACE)
+          case triton::engines::solver::SOLVER_PORTFOLIO:
+            solver.reset(new(std::nothrow) triton::engines::solver::PortfolioSolver());
             break;
           #endif
+          case triton::engines::solver::SOLVER_LOCAL_SEARCH:
+            solver.reset(new(std::nothrow) triton::engines::solver::LocalSearchSolver());
+            break;
+          case triton::engines::solver::SOLVER_EXTERNAL:
+            solver.reset(new(std::nothrow) triton::engines::solver::ExternalSolver());
+            break;
+          case triton::engines::solver::SOLVER_REMOTE:
+            solver.reset(new(std::nothrow) triton::engines::solver::RemoteSolver());
+            break;
 
           default:
-            throw triton::exceptions::SolverEngine("SolverEngine::setSolver(): Solver not supported.");
-            break;
+            throw triton::exceptions::SolverEngine(std::string(where) + ": Solver not supported.");
         }
 
+        if (solver == nullptr)
+          throw triton::exceptions::SolverEngine(std::string(where) + ": Not enough memory.");
+
+        return solver;
+      }
+
+
+      void SolverEngine::setSolver(triton::engines::solver::solver_e kind) {
+        /* init the new instance */
+        this->solver = this->newSolver(kind, "SolverEngine::setSolver()");
+
         /* Setup global variables */
-        this->kind = kind;
+        this->kind        = kind;
+        this->memoryLimit = 0;
+        this->timeout     = 0;
       }
 
 
@@ -76,7 +111,9 @@ namespace triton {
         this->solver.reset(customSolver);
 
         /* Setup global variables */
-        this->kind = triton::engines::solver::SOLVER_CUSTOM;
+        this->kind        = triton::engines::solver::SOLVER_CUSTOM;
+        this->memoryLimit = 0;
+        this->timeout     = 0;
       }
 
 
@@ -87,24 +124,759 @@ namespace triton {
       }
 
 
+      triton::engines::solver::AnalyticSolver* SolverEngine::getAnalytic(void) {
+        return &this->analytic;
+      }
+
+
+      triton::engines::solver::SolverBudget* SolverEngine::getBudget(void) {
+        return &this->budget;
+      }
+
+
+      triton::engines::solver::SolverCache* SolverEngine::getCache(void) {
+        return &this->cache;
+      }
+
+
+      triton::engines::solver::ExternalSolver* SolverEngine::getExternal(void) {
+        if (this->kind != triton::engines::solver::SOLVER_EXTERNAL)
+          throw triton::exceptions::SolverEngine("SolverEngine::getExternal(): Solver instance must be a SOLVER_EXTERNAL.");
+        return reinterpret_cast<triton::engines::solver::ExternalSolver*>(this->solver.get());
+      }
+
+
+      triton::engines::solver::RemoteSolver* SolverEngine::getRemote(void) {
+        if (this->kind != triton::engines::solver::SOLVER_REMOTE)
+          throw triton::exceptions::SolverEngine("SolverEngine::getRemote(): Solver instance must be a SOLVER_REMOTE.");
+        return reinterpret_cast<triton::engines::solver::RemoteSolver*>(this->solver.get());
+      }
+
+
+      triton::engines::solver::SolverPreprocessor* SolverEngine::getPreprocessor(void) {
+        return &this->preprocessor;
+      }
+
+
+      triton::engines::solver::SolverProfiles* SolverEngine::getProfiles(void) {
+        return &this->profiles;
+      }
+
+
+      triton::engines::solver::SolverStatistics* SolverEngine::getStatistics(void) {
+        return &this->statistics;
+      }
+
+
+      triton::engines::solver::LocalSearchSolver* SolverEngine::getLocalSearch(void) {
+        if (this->kind != triton::engines::solver::SOLVER_LOCAL_SEARCH)
+          throw triton::exceptions::SolverEngine("SolverEngine::getLocalSearch(): Solver instance must be a SOLVER_LOCAL_SEARCH.");
+        return reinterpret_cast<triton::engines::solver::LocalSearchSolver*>(this->solver.get());
+      }
+
+
+      #if defined(TRITON_Z3_INTERFACE) || defined(TRITON_BITWUZLA_INTERFACE)
+      triton::engines::solver::PortfolioSolver* SolverEngine::getPortfolio(void) {
+        if (this->kind != triton::engines::solver::SOLVER_PORTFOLIO)
+          throw triton::exceptions::SolverEngine("SolverEngine::getPortfolio(): Solver instance must be a SOLVER_PORTFOLIO.");
+        return reinterpret_cast<triton::engines::solver::PortfolioSolver*>(this->solver.get());
+      }
+      #endif
+
+
+      bool SolverEngine::lookup(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e& status, std::unordered_map<triton::usize, SolverModel>* model) const {
+        if (this->cache.find(node, status, model))
+          return true;
+
+        /* Answered without the solver, the next identical query hits the cache */
+        if (this->cache.findCounterexample(node, status, model)) {
+          this->cache.insert(node, status, model);
+          return true;
+        }
+
+        return false;
+      }
+
+
+      /* Returns the tracer of the context of a query, null if there is none */
+      static triton::utils::EventTracer* getTracer(const triton::ast::SharedAbstractNode& node) {
+        if (node == nullptr || node->getContext() == nullptr)
+          return nullptr;
+        return node->getContext()->getTracer().get();
+      }
+
+
+      triton::uint32 SolverEngine::getQueryTimeout(triton::uint32 timeout) const {
+        return timeout ? timeout : this->timeout;
+      }
+
+
+      triton::engines::solver::status_e SolverEngine::query(const triton::ast::SharedAbstractNode& node, std::unordered_map<triton::usize, SolverModel>* model, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        triton::utils::TraceScope scope(getTracer(node), "query", "solver");
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+        triton::uint32 time = 0;
+        PreprocessedQuery query;
+
+        if (this->preprocessor.isEnabled())
+          query = this->preprocessor.preprocess(node);
+        else
+          query.node = node;
+
+        /* Only the residue of the constraints solved analytically is sent to the solver */
+        AnalyticQuery analytic;
+        if (query.decided == triton::engines::solver::UNKNOWN && this->analytic.isEnabled()) {
+          analytic = this->analytic.solve(query.node);
+          query.decided = analytic.decided;
+          if (analytic.residue)
+            query.node = analytic.residue;
+        }
+
+        /* Decided by the preprocessing, e.g. all its conjuncts were fixing equalities */
+        if (query.decided != triton::engines::solver::UNKNOWN) {
+          st = query.decided;
+        }
+        else {
+          /* The profile of the query, applied by the solvers of this thread */
+          SolverProfileScope profile(this->profiles.select(query.node));
+          if (model)
+            *model = this->solver->getModel(query.node, &st, timeout, &time);
+          else
+            this->solver->isSat(query.node, &st, timeout, &time);
+        }
+
+        if (model && st == triton::engines::solver::SAT) {
+          for (const auto& value : analytic.values)
+            (*model)[value.getId()] = value;
+          this->preprocessor.reconstruct(query, *model);
+        }
+
+        if (solvingTime)
+          *solvingTime = time;
+
+        this->statistics.record(query.node, st, time, this->getQueryTimeout(timeout), this->solver->getName());
+        scope.setValue(st);
+
+        return st;
+      }
+
+
       std::unordered_map<triton::usize, SolverModel> SolverEngine::getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        std::unordered_map<triton::usize, SolverModel> model;
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+
         if (!this->solver)
-          return std::unordered_map<triton::usize, SolverModel>{};
-        return this->solver->getModel(node, status, timeout, solvingTime);
+          return model;
+
+        if (this->lookup(node, st, &model)) {
+          this->statistics.recordHit(st);
+          if (status)
+            *status = st;
+          if (solvingTime)
+            *solvingTime = 0;
+          return model;
+        }
+
+        st = this->query(node, &model, timeout, solvingTime);
+        this->cache.insert(node, st, &model);
+
+        if (status)
+          *status = st;
+
+        return model;
       }
 
 
       std::vector<std::unordered_map<triton::usize, SolverModel>> SolverEngine::getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        std::vector<std::unordered_map<triton::usize, SolverModel>> models;
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+        triton::uint32 time = 0;
+
         if (!this->solver)
-          return std::vector<std::unordered_map<triton::usize, SolverModel>>{};
-        return this->solver->getModels(node, limit, status, timeout, solvingTime);
+          return models;
+
+        triton::utils::TraceScope scope(getTracer(node), "getModels", "solver");
+        {
+          SolverProfileScope profile(this->profiles.select(node));
+          models = this->solver->getModels(node, limit, &st, timeout, &time);
+        }
+        this->statistics.record(node, st, time, this->getQueryTimeout(timeout), this->solver->getName());
+        scope.setValue(models.size());
+
+        if (status)
+          *status = st;
+        if (solvingTime)
+          *solvingTime = time;
+
+        return models;
+      }
+
+
+      triton::usize SolverEngine::enumerateModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, const ModelCallback& callback, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& variables, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+        triton::uint32 time = 0;
+
+        if (!this->solver)
+          return 0;
+
+        triton::utils::TraceScope scope(getTracer(node), "enumerateModels", "solver");
+        SolverProfileScope profile(this->profiles.select(node));
+        triton::usize count = this->solver->enumerateModels(node, limit, callback, variables, &st, timeout, &time);
+        this->statistics.record(node, st, time, this->getQueryTimeout(timeout), this->solver->getName());
+        scope.setValue(count);
+
+        if (status)
+          *status = st;
+        if (solvingTime)
+          *solvingTime = time;
+
+        return count;
       }
 
 
       bool SolverEngine::isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+
         if (!this->solver)
           return false;
-        return this->solver->isSat(node, status, timeout, solvingTime);
+
+        if (this->lookup(node, st, nullptr)) {
+          this->statistics.recordHit(st);
+          if (status)
+            *status = st;
+          if (solvingTime)
+            *solvingTime = 0;
+          return st == triton::engines::solver::SAT;
+        }
+
+        st = this->query(node, nullptr, timeout, solvingTime);
+        this->cache.insert(node, st, nullptr);
+
+        if (status)
+          *status = st;
+
+        return st == triton::engines::solver::SAT;
+      }
+
+
+      SolverFuture SolverEngine::submit(const triton::ast::SharedAbstractNode& node, bool needModel, triton::uint32 timeout, const char* where) {
+        std::unordered_map<triton::usize, SolverModel> model;
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+
+        if (!this->solver)
+          throw triton::exceptions::SolverEngine(std::string(where) + ": Solver undefined.");
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine(std::string(where) + ": Node cannot be null.");
+
+        if (this->kind == triton::engines::solver::SOLVER_CUSTOM)
+          throw triton::exceptions::SolverEngine(std::string(where) + ": Custom solvers cannot be queried in the background.");
+
+        if (this->lookup(node, st, needModel ? &model : nullptr)) {
+          this->statistics.recordHit(st);
+          return SolverFuture(st, model);
+        }
+
+        /*
+         * The queries of the tasks done are released here, by the thread owning their
+         * context (see `AstContext`), and not by the threads of the pool.
+         */
+        auto end = std::remove_if(this->tasks.begin(), this->tasks.end(), [](const std::shared_ptr<SolverTask>& task) {
+          std::lock_guard<std::mutex> guard(task->lock);
+          return task->done;
+        });
+        this->tasks.erase(end, this->tasks.end());
+
+        auto task = std::make_shared<SolverTask>();
+
+        /* The query is a frozen copy, the caller keeps building and updating nodes while it is solved */
+        task->node = triton::ast::newInstance(node.get(), true /* unroll */);
+        task->node->freeze();
+
+        /* One solver per task, so that it may be interrupted alone. The external ones share their processes, the remote ones their servers */
+        if (this->kind == triton::engines::solver::SOLVER_EXTERNAL)
+          task->solver.reset(new triton::engines::solver::ExternalSolver(*this->getExternal()));
+        else if (this->kind == triton::engines::solver::SOLVER_REMOTE)
+          task->solver.reset(new triton::engines::solver::RemoteSolver(*this->getRemote()));
+        else
+          task->solver = this->newSolver(this->kind, where);
+        task->solver->setTimeout(this->timeout);
+        task->solver->setMemoryLimit(this->memoryLimit);
+        #if defined(TRITON_Z3_INTERFACE) || defined(TRITON_BITWUZLA_INTERFACE)
+        if (this->kind == triton::engines::solver::SOLVER_PORTFOLIO)
+          reinterpret_cast<triton::engines::solver::PortfolioSolver*>(task->solver.get())->setBackends(this->getPortfolio()->getBackends());
+        #endif
+        if (this->kind == triton::engines::solver::SOLVER_LOCAL_SEARCH) {
+          auto* search = reinterpret_cast<triton::engines::solver::LocalSearchSolver*>(task->solver.get());
+          search->setBudget(this->getLocalSearch()->getBudget());
+          search->setFallback(this->getLocalSearch()->getFallback());
+        }
+
+        task->cache      = this->cache.isEnabled() ? &this->cache : nullptr;
+        task->statistics = this->statistics.isEnabled() ? &this->statistics : nullptr;
+        task->needModel  = needModel;
+        task->profile    = this->profiles.select(node);
+        task->timeout    = this->getQueryTimeout(timeout);
+
+        if (this->pool == nullptr)
+          this->pool.reset(new triton::engines::solver::SolverPool(this->threads));
+
+        this->tasks.push_back(task);
+        this->pool->submit(task);
+
+        return SolverFuture(task);
+      }
+
+
+      SolverFuture SolverEngine::getModelAsync(const triton::ast::SharedAbstractNode& node, triton::uint32 timeout) {
+        return this->submit(node, true, timeout, "SolverEngine::getModelAsync()");
+      }
+
+
+      SolverFuture SolverEngine::isSatAsync(const triton::ast::SharedAbstractNode& node, triton::uint32 timeout) {
+        return this->submit(node, false, timeout, "SolverEngine::isSatAsync()");
+      }
+
+
+      std::vector<triton::ast::SharedAbstractNode> SolverEngine::getUnsatCore(const std::vector<triton::ast::SharedAbstractNode>& conjuncts, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+        std::vector<triton::ast::SharedAbstractNode> core;
+        triton::uint32 time = 0;
+
+        if (!this->solver)
+          return core;
+
+        if (conjuncts.empty())
+          throw triton::exceptions::SolverEngine("SolverEngine::getUnsatCore(): Expects at least one conjunct.");
+
+        auto node = (conjuncts.size() == 1) ? conjuncts.front() : conjuncts.front()->getContext()->land(conjuncts);
+
+        triton::utils::TraceScope scope(getTracer(node), "getUnsatCore", "solver");
+        core = this->solver->getUnsatCore(conjuncts, &st, timeout, &time);
+        this->statistics.record(node, st, time, this->getQueryTimeout(timeout), this->solver->getName());
+        scope.setValue(core.size());
+
+        this->cache.insert(node, st, nullptr);
+        if (st == triton::engines::solver::UNSAT)
+          this->cache.insertUnsatCore(core);
+
+        if (status)
+          *status = st;
+        if (solvingTime)
+          *solvingTime = time;
+
+        return core;
+      }
+
+
+      std::vector<BranchFlip> SolverEngine::solveBranchFlips(const std::vector<triton::engines::symbolic::PathConstraint>& pathConstraints, const BranchFlipOptions& options) {
+        std::set<std::pair<triton::uint64, triton::uint64>> covered;
+        std::vector<triton::ast::SharedAbstractNode> prefix;
+        std::vector<BranchFlip> flips;
+
+        /* The UNSAT cores, by the hashes of their predicates, and the first position of each predicate of the prefix */
+        std::vector<std::vector<triton::uint128>> cores;
+        std::map<triton::uint128, triton::usize> positions;
+
+        if (options.unsatCores)
+          cores = options.cores;
+
+        if (!this->solver)
+          throw triton::exceptions::SolverEngine("SolverEngine::solveBranchFlips(): Solver undefined.");
+
+        /* The branches taken by the trace are covered */
+        if (options.skipCovered) {
+          covered = options.covered;
+          for (const auto& pc : pathConstraints) {
+            for (const auto& branch : pc.getBranchConstraints()) {
+              if (std::get<0>(branch))
+                covered.insert({std::get<1>(branch), std::get<2>(branch)});
+            }
+          }
+        }
+
+        /* The branches not taken, each one flipped once */
+        for (triton::usize index = options.start; index < pathConstraints.size(); index++) {
+          const auto& pc = pathConstraints[index];
+
+          if (!pc.isMultipleBranches())
+            continue;
+
+          for (const auto& branch : pc.getBranchConstraints()) {
+            if (options.limit && flips.size() >= options.limit)
+              break;
+
+            if (std::get<0>(branch))
+              continue;
+
+            if (options.skipCovered && !covered.insert({std::get<1>(branch), std::get<2>(branch)}).second)
+              continue;
+
+            BranchFlip flip;
+            flip.index     = index;
+            flip.srcAddr   = std::get<1>(branch);
+            flip.dstAddr   = std::get<2>(branch);
+            flip.predicate = std::get<3>(branch);
+            flips.push_back(flip);
+          }
+        }
+
+        /* The query of a flip, the predicates taken before it and the branch */
+        auto query = [&](const BranchFlip& flip) {
+          while (prefix.size() < flip.index) {
+            prefix.push_back(pathConstraints[prefix.size()].getTakenPredicate());
+            if (options.unsatCores)
+              positions.emplace(prefix.back()->getHash(), prefix.size() - 1);
+          }
+
+          if (flip.index == 0)
+            return flip.predicate;
+
+          std::vector<triton::ast::SharedAbstractNode> exprs(prefix.begin(), prefix.begin() + flip.index);
+          exprs.push_back(flip.predicate);
+          return flip.predicate->getContext()->land(exprs);
+        };
+
+        /* True if the query of a flip, built before, contains an UNSAT core. The flip is then UNSAT. */
+        auto prune = [&](BranchFlip& flip) {
+          if (cores.empty())
+            return false;
+
+          triton::uint128 hash = flip.predicate->getHash();
+          for (const auto& core : cores) {
+            bool contained = std::all_of(core.begin(), core.end(), [&](const triton::uint128& h) {
+              auto it = positions.find(h);
+              return h == hash || (it != positions.end() && it->second < flip.index);
+            });
+            if (contained) {
+              flip.status      = triton::engines::solver::UNSAT;
+              flip.pruned      = true;
+              flip.solvingTime = 0;
+              flip.model.clear();
+              return true;
+            }
+          }
+
+          return false;
+        };
+
+        /* Records the UNSAT core of an UNSAT flip */
+        auto learn = [&](BranchFlip& flip, triton::uint32 timeout) {
+          triton::engines::solver::status_e status = triton::engines::solver::UNKNOWN;
+
+          if (!options.unsatCores || flip.status != triton::engines::solver::UNSAT || flip.pruned)
+            return;
+
+          std::vector<triton::ast::SharedAbstractNode> conjuncts(prefix.begin(), prefix.begin() + flip.index);
+          conjuncts.push_back(flip.predicate);
+
+          auto core = this->getUnsatCore(conjuncts, &status, timeout);
+          if (status != triton::engines::solver::UNSAT || core.empty())
+            return;
+
+          std::vector<triton::uint128> hashes;
+          for (const auto& node : core)
+            hashes.push_back(node->getHash());
+          cores.push_back(std::move(hashes));
+          flip.core = std::move(core);
+        };
+
+        /* The timeout of a flip, false if the budget is spent and the flip is left UNKNOWN */
+        auto timeoutOf = [&](const BranchFlip& flip, const triton::ast::SharedAbstractNode& node, triton::uint32& timeout) {
+          if (!this->budget.isEnabled()) {
+            timeout = options.timeout;
+            return true;
+          }
+          if (this->budget.isExhausted())
+            return false;
+          timeout = this->budget.getTimeout(node, flip.srcAddr);
+          return true;
+        };
+
+        /* Solves the flips of a batch sorted by index, and returns the ones to retry at a higher timeout */
+        auto solve = [&](const std::vector<triton::usize>& batch) {
+          std::vector<triton::usize> retries;
+
+          auto done = [&](triton::usize index, triton::uint32 timeout) {
+            const BranchFlip& flip = flips[index];
+            if (!this->budget.isEnabled())
+              return;
+            this->budget.record(flip.srcAddr, flip.status, timeout, flip.solvingTime);
+            if (flip.status == triton::engines::solver::TIMEOUT && this->budget.isRetryable(flip.srcAddr))
+              retries.push_back(index);
+          };
+
+          if (options.parallel && this->kind != triton::engines::solver::SOLVER_CUSTOM) {
+            std::vector<std::tuple<triton::usize, triton::uint32, SolverFuture>> futures;
+
+            for (triton::usize index : batch) {
+              auto node = query(flips[index]);
+              triton::uint32 timeout = 0;
+              if (prune(flips[index]))
+                continue;
+              if (timeoutOf(flips[index], node, timeout))
+                futures.emplace_back(index, timeout, this->submit(node, true, timeout, "SolverEngine::solveBranchFlips()"));
+            }
+
+            for (auto& future : futures) {
+              BranchFlip& flip = flips[std::get<0>(future)];
+              flip.status      = std::get<2>(future).getStatus();
+              flip.model       = std::get<2>(future).getModel();
+              flip.solvingTime = std::get<2>(future).getSolvingTime();
+              done(std::get<0>(future), std::get<1>(future));
+              learn(flip, std::get<1>(future));
+            }
+
+            return retries;
+          }
+
+          #ifdef TRITON_Z3_INTERFACE
+          if (this->kind == triton::engines::solver::SOLVER_Z3) {
+            /* A session of its own, the prefix is asserted once and the session of the engine is left as is */
+            auto session = this->newSolver(this->kind, "SolverEngine::solveBranchFlips()");
+            session->setTimeout(this->timeout);
+            session->setMemoryLimit(this->memoryLimit);
+
+            triton::usize asserted = 0;
+            for (triton::usize index : batch) {
+              BranchFlip& flip = flips[index];
+              triton::uint32 timeout = 0;
+              auto node = query(flip);
+
+              if (prune(flip))
+                continue;
+
+              if (this->lookup(node, flip.status, &flip.model)) {
+                this->statistics.recordHit(flip.status);
+                continue;
+              }
+
+              if (!timeoutOf(flip, node, timeout))
+                continue;
+
+              while (asserted < flip.index)
+                session->pushConstraint(prefix[asserted++]);
+
+              flip.model = session->checkWithAssumptions({flip.predicate}, &flip.status, timeout, &flip.solvingTime);
+              this->cache.insert(node, flip.status, &flip.model);
+              this->statistics.record(node, flip.status, flip.solvingTime, this->getQueryTimeout(timeout), session->getName());
+              done(index, timeout);
+              learn(flip, timeout);
+            }
+
+            return retries;
+          }
+          #endif
+
+          for (triton::usize index : batch) {
+            BranchFlip& flip = flips[index];
+            triton::uint32 timeout = 0;
+            auto node = query(flip);
+
+            if (prune(flip))
+              continue;
+
+            if (timeoutOf(flip, node, timeout)) {
+              flip.model = this->getModel(node, &flip.status, timeout, &flip.solvingTime);
+              done(index, timeout);
+              learn(flip, timeout);
+            }
+          }
+
+          return retries;
+        };
+
+        /* The flips which timed out are retried at a higher timeout once the other ones are done, while the budget lasts */
+        std::vector<triton::usize> batch(flips.size());
+        for (triton::usize index = 0; index < flips.size(); index++)
+          batch[index] = index;
+
+        while (!batch.empty())
+          batch = solve(batch);
+
+        return flips;
+      }
+
+
+      bool SolverEngine::sample(const triton::ast::SharedAbstractNode& node, const EquivalenceOptions& options, std::vector<triton::engines::symbolic::SharedSymbolicVariable>& variables, std::vector<std::vector<triton::uint512>>& inputs, std::vector<triton::uint512>& outputs) const {
+        try {
+          triton::ast::AstEvaluator evaluator(node);
+          std::mt19937_64 rng(options.seed);
+
+          variables = evaluator.getVariables();
+          inputs.clear();
+
+          /* The corner values: 0, 1, -1, the signed minimum and maximum */
+          for (triton::uint32 corner = 0; corner < 5; corner++) {
+            std::vector<triton::uint512> input;
+            for (const auto& var : variables) {
+              triton::uint512 mask = -1;
+              mask = mask >> (512 - var->getSize());
+              switch (corner) {
+                case 0:  input.push_back(0); break;
+                case 1:  input.push_back(1); break;
+                case 2:  input.push_back(mask); break;
+                case 3:  input.push_back((mask >> 1) + 1); break;
+                default: input.push_back(mask >> 1); break;
+              }
+            }
+            inputs.push_back(std::move(input));
+          }
+
+          /* The random inputs, of random bits or small positive or negative values */
+          for (triton::usize lane = 0; lane < options.samples; lane++) {
+            std::vector<triton::uint512> input;
+            for (const auto& var : variables) {
+              triton::uint512 mask  = -1;
+              triton::uint512 value = 0;
+              mask = mask >> (512 - var->getSize());
+              switch (rng() % 4) {
+                case 0:
+                  value = rng() % 16;
+                  break;
+                case 1:
+                  value = 0 - triton::uint512(rng() % 16);
+                  break;
+                default:
+                  for (triton::uint32 bits = 0; bits < var->getSize(); bits += 64)
+                    value = (value << 64) | triton::uint512(rng());
+                  break;
+              }
+              input.push_back(value & mask);
+            }
+            inputs.push_back(std::move(input));
+          }
+
+          outputs = evaluator.evaluateBatch(inputs);
+          return true;
+        }
+        catch (const triton::exceptions::Exception&) {
+          return false;
+        }
+      }
+
+
+      void SolverEngine::solveEquivalences(const std::vector<std::pair<triton::usize, triton::ast::SharedAbstractNode>>& queries, const EquivalenceOptions& options, std::vector<Equivalence>& results) {
+        #if defined(TRITON_Z3_INTERFACE) || defined(TRITON_BITWUZLA_INTERFACE)
+        if (options.parallel && this->kind != triton::engines::solver::SOLVER_CUSTOM) {
+          std::vector<std::pair<triton::usize, SolverFuture>> futures;
+
+          for (const auto& query : queries)
+            futures.emplace_back(query.first, this->submit(query.second, true, options.timeout, "SolverEngine::checkEquivalences()"));
+
+          for (auto& future : futures) {
+            results[future.first].status         = future.second.getStatus();
+            results[future.first].counterexample = future.second.getModel();
+          }
+          return;
+        }
+        #endif
+
+        for (const auto& query : queries) {
+          Equivalence& result = results[query.first];
+          result.counterexample = this->getModel(query.second, &result.status, options.timeout);
+        }
+      }
+
+
+      std::vector<Equivalence> SolverEngine::checkEquivalences(const std::vector<std::pair<triton::ast::SharedAbstractNode, triton::ast::SharedAbstractNode>>& pairs, const EquivalenceOptions& options) {
+        std::vector<std::pair<triton::usize, triton::ast::SharedAbstractNode>> queries;
+        std::vector<Equivalence> results(pairs.size());
+
+        if (!this->solver && options.useSolver)
+          throw triton::exceptions::SolverEngine("SolverEngine::checkEquivalences(): Solver undefined.");
+
+        for (triton::usize index = 0; index < pairs.size(); index++) {
+          const auto& a = pairs[index].first;
+          const auto& b = pairs[index].second;
+
+          if (a == nullptr || b == nullptr)
+            throw triton::exceptions::SolverEngine("SolverEngine::checkEquivalences(): Node cannot be null.");
+
+          if (a->isLogical() != b->isLogical() || a->getBitvectorSize() != b->getBitvectorSize())
+            throw triton::exceptions::SolverEngine("SolverEngine::checkEquivalences(): Both sides must have the same sort.");
+
+          /* The same tree is equivalent */
+          if (a->equalTo(b)) {
+            results[index].status = triton::engines::solver::UNSAT;
+            continue;
+          }
+
+          /* The query is SAT on the inputs telling both sides apart */
+          auto ctxt  = a->getContext();
+          auto query = a->isLogical() ? ctxt->lnot(ctxt->iff(a, b)) : ctxt->distinct(a, b);
+
+          std::vector<triton::engines::symbolic::SharedSymbolicVariable> variables;
+          std::vector<std::vector<triton::uint512>> inputs;
+          std::vector<triton::uint512> outputs;
+          if (this->sample(query, options, variables, inputs, outputs)) {
+            auto it = std::find_if(outputs.begin(), outputs.end(), [](const triton::uint512& value) { return value != 0; });
+            if (it != outputs.end()) {
+              const auto& input = inputs[it - outputs.begin()];
+              results[index].status    = triton::engines::solver::SAT;
+              results[index].evaluated = true;
+              for (triton::usize i = 0; i < variables.size(); i++)
+                results[index].counterexample[variables[i]->getId()] = SolverModel(variables[i], input[i]);
+              continue;
+            }
+          }
+
+          if (options.useSolver)
+            queries.emplace_back(index, query);
+        }
+
+        this->solveEquivalences(queries, options, results);
+
+        return results;
+      }
+
+
+      Equivalence SolverEngine::checkOpaquePredicate(const triton::ast::SharedAbstractNode& node, const EquivalenceOptions& options) {
+        std::vector<Equivalence> results(1);
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverEngine::checkOpaquePredicate(): Node cannot be null.");
+
+        if (!node->isLogical())
+          throw triton::exceptions::SolverEngine("SolverEngine::checkOpaquePredicate(): Must be a logical node.");
+
+        if (!this->solver && options.useSolver)
+          throw triton::exceptions::SolverEngine("SolverEngine::checkOpaquePredicate(): Solver undefined.");
+
+        /* A predicate taking both values is not opaque, the first inputs giving the other value are the counterexample */
+        std::vector<triton::engines::symbolic::SharedSymbolicVariable> variables;
+        std::vector<std::vector<triton::uint512>> inputs;
+        std::vector<triton::uint512> outputs;
+        bool value = (node->evaluate() != 0);
+        if (this->sample(node, options, variables, inputs, outputs)) {
+          value = (outputs.front() != 0);
+          auto it = std::find_if(outputs.begin(), outputs.end(), [&](const triton::uint512& output) { return (output != 0) != value; });
+          if (it != outputs.end()) {
+            const auto& input = inputs[it - outputs.begin()];
+            results[0].status    = triton::engines::solver::SAT;
+            results[0].evaluated = true;
+            for (triton::usize i = 0; i < variables.size(); i++)
+              results[0].counterexample[variables[i]->getId()] = SolverModel(variables[i], input[i]);
+            return results[0];
+          }
+        }
+
+        /* Otherwise, it is opaque if it never takes the other value */
+        if (options.useSolver)
+          this->solveEquivalences({{0, value ? node->getContext()->lnot(node) : node}}, options, results);
+
+        return results[0];
+      }
+
+
+      triton::usize SolverEngine::getThreads(void) const {
+        return this->threads;
+      }
+
+
+      void SolverEngine::setThreads(triton::usize threads) {
+        this->threads = std::max<triton::usize>(1, threads);
+        if (this->pool != nullptr)
+          this->pool->setThreads(this->threads);
       }
 
 
@@ -118,6 +890,7 @@ namespace triton {
       void SolverEngine::setTimeout(triton::uint32 ms) {
         if (this->solver) {
           this->solver->setTimeout(ms);
+          this->timeout = ms;
         }
       }
 
@@ -125,6 +898,57 @@ namespace triton {
       void SolverEngine::setMemoryLimit(triton::uint32 limit) {
         if (this->solver) {
           this->solver->setMemoryLimit(limit);
+          this->memoryLimit = limit;
+        }
+      }
+
+
+      void SolverEngine::pushConstraint(const triton::ast::SharedAbstractNode& node) {
+        if (!this->solver)
+          throw triton::exceptions::SolverEngine("SolverEngine::pushConstraint(): Solver undefined.");
+        this->solver->pushConstraint(node);
+      }
+
+
+      void SolverEngine::push(void) {
+        if (!this->solver)
+          throw triton::exceptions::SolverEngine("SolverEngine::push(): Solver undefined.");
+        this->solver->push();
+      }
+
+
+      void SolverEngine::pop(triton::uint32 count) {
+        if (!this->solver)
+          throw triton::exceptions::SolverEngine("SolverEngine::pop(): Solver undefined.");
+        this->solver->pop(count);
+      }
+
+
+      std::unordered_map<triton::usize, SolverModel> SolverEngine::checkWithAssumptions(const std::vector<triton::ast::SharedAbstractNode>& assumptions, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) {
+        std::unordered_map<triton::usize, SolverModel> model;
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+        triton::uint32 time = 0;
+
+        if (!this->solver)
+          return model;
+
+        triton::utils::TraceScope scope(assumptions.empty() ? nullptr : getTracer(assumptions.front()), "checkWithAssumptions", "solver");
+        model = this->solver->checkWithAssumptions(assumptions, &st, timeout, &time);
+        this->statistics.record(nullptr, st, time, this->getQueryTimeout(timeout), this->solver->getName());
+        scope.setValue(st);
+
+        if (status)
+          *status = st;
+        if (solvingTime)
+          *solvingTime = time;
+
+        return model;
+      }
+
+
+      void SolverEngine::resetSession(void) {
+        if (this->solver) {
+          this->solver->resetSession();
         }
       }
 
@@ -0,0 +1,126 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <chrono>
+
+#include <triton/exceptions.hpp>
+#include <triton/solverFuture.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      SolverFuture::SolverFuture() {
+      }
+
+
+      SolverFuture::SolverFuture(const std::shared_ptr<SolverTask>& task) {
+        this->task = task;
+      }
+
+
+      SolverFuture::SolverFuture(triton::engines::solver::status_e status, const std::unordered_map<triton::usize, SolverModel>& model) {
+        this->task = std::make_shared<SolverTask>();
+        this->task->done   = true;
+        this->task->model  = model;
+        this->task->status = status;
+      }
+
+
+      const SolverTask& SolverFuture::result(void) const {
+        if (this->task == nullptr)
+          throw triton::exceptions::SolverEngine("SolverFuture::result(): Invalid future.");
+
+        std::unique_lock<std::mutex> guard(this->task->lock);
+        this->task->finished.wait(guard, [this]() { return this->task->done; });
+
+        if (!this->task->error.empty())
+          throw triton::exceptions::SolverEngine(this->task->error);
+
+        return *this->task;
+      }
+
+
+      bool SolverFuture::isValid(void) const {
+        return this->task != nullptr;
+      }
+
+
+      bool SolverFuture::isDone(void) const {
+        if (this->task == nullptr)
+          return false;
+
+        std::lock_guard<std::mutex> guard(this->task->lock);
+        return this->task->done;
+      }
+
+
+      void SolverFuture::wait(void) const {
+        if (this->task == nullptr)
+          throw triton::exceptions::SolverEngine("SolverFuture::wait(): Invalid future.");
+
+        std::unique_lock<std::mutex> guard(this->task->lock);
+        this->task->finished.wait(guard, [this]() { return this->task->done; });
+      }
+
+
+      bool SolverFuture::waitFor(triton::uint32 ms) const {
+        if (this->task == nullptr)
+          throw triton::exceptions::SolverEngine("SolverFuture::waitFor(): Invalid future.");
+
+        std::unique_lock<std::mutex> guard(this->task->lock);
+        return this->task->finished.wait_for(guard, std::chrono::milliseconds(ms), [this]() { return this->task->done; });
+      }
+
+
+      void SolverFuture::cancel(void) {
+        if (this->task == nullptr)
+          throw triton::exceptions::SolverEngine("SolverFuture::cancel(): Invalid future.");
+
+        std::lock_guard<std::mutex> guard(this->task->lock);
+        if (this->task->done)
+          return;
+
+        this->task->cancelled = true;
+        if (this->task->solver)
+          this->task->solver->interrupt();
+      }
+
+
+      bool SolverFuture::isCancelled(void) const {
+        if (this->task == nullptr)
+          return false;
+
+        std::lock_guard<std::mutex> guard(this->task->lock);
+        return this->task->cancelled;
+      }
+
+
+      triton::engines::solver::status_e SolverFuture::getStatus(void) const {
+        return this->result().status;
+      }
+
+
+      bool SolverFuture::isSat(void) const {
+        return this->result().status == triton::engines::solver::SAT;
+      }
+
+
+      const std::unordered_map<triton::usize, SolverModel>& SolverFuture::getModel(void) const {
+        return this->result().model;
+      }
+
+
+      triton::uint32 SolverFuture::getSolvingTime(void) const {
+        return this->result().solvingTime;
+      }
+
+    };
+  };
+};
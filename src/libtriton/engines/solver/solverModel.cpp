@@ -5,8 +5,10 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <algorithm>
 #include <cstdlib>
 
+#include <triton/exceptions.hpp>
 #include <triton/solverModel.hpp>
 #include <triton/symbolicEnums.hpp>
 
@@ -27,6 +29,12 @@ namespace triton {
       }
 
 
+      SolverModel::SolverModel(const triton::engines::symbolic::SharedSymbolicVariable& variable, triton::uint64 value) {
+        this->value.setNarrow(value);
+        this->variable = variable;
+      }
+
+
       SolverModel::SolverModel(const SolverModel& other) {
         this->copy(other);
       }
@@ -44,7 +52,12 @@ namespace triton {
 
 
       triton::uint512 SolverModel::getValue(void) const {
-        return this->value;
+        return this->value.get();
+      }
+
+
+      triton::uint64 SolverModel::getNarrowValue(void) const {
+        return this->value.getNarrow();
       }
 
 
@@ -64,6 +77,67 @@ namespace triton {
       }
 
 
+      DenseModel::DenseModel() {
+        this->count = 0;
+      }
+
+
+      DenseModel::DenseModel(const std::unordered_map<triton::usize, SolverModel>& model) {
+        triton::usize size = 0;
+
+        this->count = 0;
+        for (const auto& item : model)
+          size = std::max(size, item.first + 1);
+
+        this->models.resize(size);
+        for (const auto& item : model)
+          this->set(item.second);
+      }
+
+
+      void DenseModel::set(const SolverModel& model) {
+        triton::usize id = model.getId();
+
+        if (id >= this->models.size())
+          this->models.resize(id + 1);
+
+        if (this->models[id].getVariable() == nullptr)
+          this->count++;
+
+        this->models[id] = model;
+      }
+
+
+      bool DenseModel::contains(triton::usize id) const {
+        return this->find(id) != nullptr;
+      }
+
+
+      const SolverModel* DenseModel::find(triton::usize id) const {
+        if (id >= this->models.size() || this->models[id].getVariable() == nullptr)
+          return nullptr;
+        return &this->models[id];
+      }
+
+
+      triton::uint512 DenseModel::getValue(triton::usize id) const {
+        const SolverModel* model = this->find(id);
+        if (model == nullptr)
+          throw triton::exceptions::SolverModel("DenseModel::getValue(): The variable is not part of the model.");
+        return model->getValue();
+      }
+
+
+      triton::usize DenseModel::size(void) const {
+        return this->count;
+      }
+
+
+      bool DenseModel::empty(void) const {
+        return this->count == 0;
+      }
+
+
       std::ostream& operator<<(std::ostream& stream, const SolverModel& model) {
         stream << model.getVariable() << " = 0x" << std::hex << model.getValue() << std::dec;
         return stream;
@@ -0,0 +1,146 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <exception>
+#include <vector>
+
+#include <triton/astContext.hpp>
+#include <triton/solverPool.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      SolverPool::SolverPool(triton::usize threads)
+        : executor(triton::utils::Executor::getDefault()) {
+        this->stopping = false;
+        this->target   = (threads == 0) ? 1 : threads;
+      }
+
+
+      SolverPool::~SolverPool() {
+        std::vector<triton::utils::SharedExecutorTask> submitted;
+
+        {
+          std::lock_guard<std::mutex> guard(this->lock);
+          this->stopping = true;
+
+          /* The pending tasks are done, cancelled */
+          for (const auto& task : this->pending) {
+            std::lock_guard<std::mutex> taskGuard(task->lock);
+            task->cancelled = true;
+            task->done      = true;
+            task->finished.notify_all();
+          }
+          this->pending.clear();
+
+          /* The running ones are interrupted */
+          for (const auto& item : this->running) {
+            std::lock_guard<std::mutex> taskGuard(item.first->lock);
+            item.first->cancelled = true;
+            item.first->solver->interrupt();
+            submitted.push_back(item.second);
+          }
+        }
+
+        /* Their executor tasks refer to the pool */
+        for (const auto& task : submitted)
+          this->executor.wait(task);
+      }
+
+
+      void SolverPool::submit(const std::shared_ptr<SolverTask>& task) {
+        std::lock_guard<std::mutex> guard(this->lock);
+        this->pending.push_back(task);
+        this->dispatch();
+      }
+
+
+      void SolverPool::dispatch(void) {
+        while (!this->stopping && !this->pending.empty() && this->running.size() < this->target) {
+          std::shared_ptr<SolverTask> task = this->pending.front();
+          this->pending.pop_front();
+
+          /* The executor task erases itself under the lock, once it is recorded */
+          this->running[task.get()] = this->executor.submit([this, task](const triton::utils::ExecutorTask&) {
+            SolverPool::solve(*task);
+            std::lock_guard<std::mutex> guard(this->lock);
+            this->running.erase(task.get());
+            this->dispatch();
+          }, triton::utils::PRIORITY_NORMAL);
+        }
+      }
+
+
+      triton::usize SolverPool::getThreads(void) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->target;
+      }
+
+
+      void SolverPool::setThreads(triton::usize threads) {
+        std::lock_guard<std::mutex> guard(this->lock);
+        this->target = (threads == 0) ? 1 : threads;
+        this->dispatch();
+      }
+
+
+      void SolverPool::solve(SolverTask& task) {
+        triton::engines::solver::status_e status = triton::engines::solver::UNKNOWN;
+        std::unordered_map<triton::usize, SolverModel> model;
+        triton::uint32 solvingTime = 0;
+        std::string error;
+
+        {
+          std::lock_guard<std::mutex> guard(task.lock);
+          if (task.cancelled) {
+            task.done = true;
+            task.finished.notify_all();
+            return;
+          }
+        }
+
+        try {
+          triton::utils::TraceScope scope(task.node->getContext()->getTracer().get(), "asyncQuery", "solver");
+          SolverProfileScope profile(task.profile);
+          if (task.needModel)
+            model = task.solver->getModel(task.node, &status, task.timeout, &solvingTime);
+          else
+            task.solver->isSat(task.node, &status, task.timeout, &solvingTime);
+          if (task.statistics != nullptr)
+            task.statistics->record(task.node, status, solvingTime, task.timeout, task.solver->getName());
+          scope.setValue(status);
+        }
+        catch (const std::exception& e) {
+          error = e.what();
+        }
+
+        std::lock_guard<std::mutex> guard(task.lock);
+
+        /* A cancelled query is UNKNOWN, even if the solver answered before being interrupted */
+        if (task.cancelled) {
+          status = triton::engines::solver::UNKNOWN;
+          model.clear();
+          error.clear();
+        }
+        else if (error.empty() && task.cache != nullptr) {
+          task.cache->insert(task.node, status, task.needModel ? &model : nullptr);
+        }
+
+        task.error       = error;
+        task.model       = std::move(model);
+        task.solvingTime = solvingTime;
+        task.status      = status;
+        task.done        = true;
+        task.finished.notify_all();
+      }
+
+    };
+  };
+};
@@ -0,0 +1,507 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <unordered_set>
+
+#include <triton/astContext.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/solverPreprocessor.hpp>
+#include <triton/symbolicExpression.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      /* The number of rewriting rounds of a query, each one may enable new rewritings */
+      static const triton::usize maxRounds = 8;
+
+
+      /* Returns the node a reference points to, the node itself otherwise */
+      static triton::ast::AbstractNode* deref(triton::ast::AbstractNode* node) {
+        while (node->getType() == triton::ast::REFERENCE_NODE)
+          node = reinterpret_cast<triton::ast::ReferenceNode*>(node)->getSymbolicExpression()->getAst().get();
+        return node;
+      }
+
+
+      /* Returns the value of an integer node */
+      static triton::uint32 integerOf(const triton::ast::SharedAbstractNode& node) {
+        return reinterpret_cast<triton::ast::IntegerNode*>(node.get())->getInteger().convert_to<triton::uint32>();
+      }
+
+
+      /* Returns the operand of a zero extension, (zx k a) or (concat 0 a), null otherwise */
+      static triton::ast::SharedAbstractNode zeroExtended(triton::ast::AbstractNode* node) {
+        node = deref(node);
+
+        if (node->getType() == triton::ast::ZX_NODE)
+          return node->getChildren()[1];
+
+        if (node->getType() == triton::ast::CONCAT_NODE && node->getChildren().size() == 2) {
+          const auto& high = node->getChildren()[0];
+          if (!high->isSymbolized() && high->evaluate() == 0)
+            return node->getChildren()[1];
+        }
+
+        return nullptr;
+      }
+
+
+      /* Returns the symbolic variable of a variable node, null otherwise */
+      static triton::engines::symbolic::SharedSymbolicVariable variableOf(triton::ast::AbstractNode* node) {
+        node = deref(node);
+        if (node->getType() == triton::ast::VARIABLE_NODE)
+          return reinterpret_cast<triton::ast::VariableNode*>(node)->getSymbolicVariable();
+        return nullptr;
+      }
+
+
+      /* Returns the ids of the variables of a node */
+      static std::unordered_set<triton::usize> variablesOf(const triton::ast::SharedAbstractNode& node) {
+        std::unordered_set<triton::usize> ids;
+
+        triton::ast::childrenTraversal(node, true /* unroll */, [&ids](const triton::ast::SharedAbstractNode& n) {
+          if (n->getType() == triton::ast::VARIABLE_NODE)
+            ids.insert(reinterpret_cast<triton::ast::VariableNode*>(n.get())->getSymbolicVariable()->getId());
+        });
+
+        return ids;
+      }
+
+
+      /* Returns a constant logical node */
+      static triton::ast::SharedAbstractNode constant(const triton::ast::SharedAstContext& ctxt, bool value) {
+        return ctxt->equal(ctxt->bvtrue(), value ? ctxt->bvtrue() : ctxt->bvfalse());
+      }
+
+
+      /* Builds a comparison */
+      static triton::ast::SharedAbstractNode compare(const triton::ast::SharedAstContext& ctxt, triton::ast::ast_e type, const triton::ast::SharedAbstractNode& lhs, const triton::ast::SharedAbstractNode& rhs) {
+        switch (type) {
+          case triton::ast::DISTINCT_NODE: return ctxt->distinct(lhs, rhs);
+          case triton::ast::EQUAL_NODE:    return ctxt->equal(lhs, rhs);
+          case triton::ast::BVUGE_NODE:    return ctxt->bvuge(lhs, rhs);
+          case triton::ast::BVUGT_NODE:    return ctxt->bvugt(lhs, rhs);
+          case triton::ast::BVULE_NODE:    return ctxt->bvule(lhs, rhs);
+          case triton::ast::BVULT_NODE:    return ctxt->bvult(lhs, rhs);
+          default:
+            throw triton::exceptions::SolverEngine("SolverPreprocessor::compare(): Invalid comparison.");
+        }
+      }
+
+
+      /* Narrows the extraction of a zero extension to its operand, returns null if it cannot be */
+      static triton::ast::SharedAbstractNode narrowExtract(const triton::ast::SharedAstContext& ctxt, triton::ast::AbstractNode* node) {
+        const auto& children = node->getChildren();
+        triton::ast::SharedAbstractNode operand = zeroExtended(children[2].get());
+
+        if (operand == nullptr)
+          return nullptr;
+
+        triton::uint32 high = integerOf(children[0]);
+        triton::uint32 low  = integerOf(children[1]);
+        triton::uint32 size = operand->getBitvectorSize();
+
+        /* Only the bits of the operand are extracted */
+        if (high < size)
+          return ctxt->extract(high, low, operand);
+
+        /* Only the zeros are extracted */
+        if (low >= size)
+          return ctxt->bv(0, high - low + 1);
+
+        return nullptr;
+      }
+
+
+      /* Narrows a comparison of zero extensions to their operands, returns null if it cannot be */
+      static triton::ast::SharedAbstractNode narrowComparison(const triton::ast::SharedAstContext& ctxt, const triton::ast::SharedAbstractNode& node) {
+        triton::ast::AbstractNode* ast = deref(node.get());
+        triton::ast::ast_e type = ast->getType();
+
+        switch (type) {
+          case triton::ast::DISTINCT_NODE:
+          case triton::ast::EQUAL_NODE:
+          case triton::ast::BVUGE_NODE:
+          case triton::ast::BVUGT_NODE:
+          case triton::ast::BVULE_NODE:
+          case triton::ast::BVULT_NODE:
+            break;
+          default:
+            return nullptr;
+        }
+
+        const auto& lhs = ast->getChildren()[0];
+        const auto& rhs = ast->getChildren()[1];
+        triton::ast::SharedAbstractNode a = zeroExtended(lhs.get());
+        triton::ast::SharedAbstractNode b = zeroExtended(rhs.get());
+
+        if (a && b && a->getBitvectorSize() == b->getBitvectorSize())
+          return compare(ctxt, type, a, b);
+
+        /* A zero extension compared to a constant */
+        bool left = (a == nullptr);
+        triton::ast::SharedAbstractNode operand = left ? b : a;
+        const triton::ast::SharedAbstractNode& other = left ? lhs : rhs;
+
+        if (operand == nullptr || other->isSymbolized())
+          return nullptr;
+
+        triton::uint32 size = operand->getBitvectorSize();
+        triton::uint512 value = other->evaluate();
+
+        if (value >> size == 0) {
+          auto cst = ctxt->bv(value, size);
+          return left ? compare(ctxt, type, cst, operand) : compare(ctxt, type, operand, cst);
+        }
+
+        /* The constant is out of the range of the extension */
+        switch (type) {
+          case triton::ast::DISTINCT_NODE: return constant(ctxt, true);
+          case triton::ast::EQUAL_NODE:    return constant(ctxt, false);
+          case triton::ast::BVUGE_NODE:
+          case triton::ast::BVUGT_NODE:    return constant(ctxt, left);
+          default:                         return constant(ctxt, !left);
+        }
+      }
+
+
+      /*
+       * Rebuilds `root` with the fixed variables replaced by their value and the extractions
+       * of zero extensions narrowed. The nodes left unchanged are shared, `memo` maps the
+       * nodes rewritten (references included) to their new node.
+       */
+      static triton::ast::SharedAbstractNode rewrite(const triton::ast::SharedAbstractNode& root, const std::unordered_map<triton::usize, SolverModel>& fixed, std::unordered_map<triton::ast::AbstractNode*, triton::ast::SharedAbstractNode>& memo, triton::usize& narrowed) {
+        const triton::ast::SharedAstContext& ctxt = root->getContext();
+
+        auto lookup = [&memo](const triton::ast::SharedAbstractNode& node) -> const triton::ast::SharedAbstractNode& {
+          auto it = memo.find(node.get());
+          return it != memo.end() ? it->second : node;
+        };
+
+        for (const auto& node : triton::ast::childrenExtraction(root, true /* unroll */, true /* children first */)) {
+          triton::ast::AbstractNode* n = node.get();
+
+          if (memo.find(n) != memo.end())
+            continue;
+
+          switch (n->getType()) {
+            case triton::ast::REFERENCE_NODE: {
+              triton::ast::AbstractNode* target = deref(n);
+              auto it = memo.find(target);
+              if (it != memo.end() && it->second.get() != target)
+                memo[n] = it->second;
+              continue;
+            }
+
+            case triton::ast::VARIABLE_NODE: {
+              const auto& var = reinterpret_cast<triton::ast::VariableNode*>(n)->getSymbolicVariable();
+              auto it = fixed.find(var->getId());
+              if (it != fixed.end())
+                memo[n] = ctxt->bv(it->second.getValue(), var->getSize());
+              continue;
+            }
+
+            case triton::ast::BV_NODE:
+            case triton::ast::INTEGER_NODE:
+            case triton::ast::STRING_NODE:
+              continue;
+
+            default:
+              break;
+          }
+
+          std::vector<triton::ast::SharedAbstractNode> children;
+          bool changed = false;
+
+          for (const auto& child : n->getChildren()) {
+            children.push_back(lookup(child));
+            changed |= (children.back() != child);
+          }
+
+          triton::ast::SharedAbstractNode result = changed ? triton::ast::rebuild(ctxt, n, children) : nullptr;
+
+          if (n->getType() == triton::ast::EXTRACT_NODE) {
+            triton::ast::SharedAbstractNode narrow = narrowExtract(ctxt, result ? result.get() : n);
+            if (narrow) {
+              result = narrow;
+              narrowed++;
+            }
+          }
+
+          if (result)
+            memo[n] = result;
+        }
+
+        return lookup(root);
+      }
+
+
+      SolverPreprocessor::SolverPreprocessor() {
+        this->decided             = 0;
+        this->droppedConjuncts    = 0;
+        this->eliminatedVariables = 0;
+        this->enabled             = false;
+        this->fixedVariables      = 0;
+        this->narrowedNodes       = 0;
+        this->queries             = 0;
+      }
+
+
+      bool SolverPreprocessor::isEnabled(void) const {
+        return this->enabled;
+      }
+
+
+      void SolverPreprocessor::setEnabled(bool flag) {
+        this->enabled = flag;
+      }
+
+
+      PreprocessedQuery SolverPreprocessor::preprocess(const triton::ast::SharedAbstractNode& node) const {
+        std::unordered_map<triton::usize, SolverModel> fixed;
+        std::vector<triton::ast::SharedAbstractNode> conjuncts;
+        std::vector<triton::ast::SharedAbstractNode> worklist = {node};
+        triton::usize dropped = 0;
+        triton::usize narrowed = 0;
+        PreprocessedQuery query;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverPreprocessor::preprocess(): node cannot be null.");
+
+        const triton::ast::SharedAstContext& ctxt = node->getContext();
+
+        /* Flattens the conjunction */
+        while (!worklist.empty()) {
+          triton::ast::SharedAbstractNode conjunct = worklist.back();
+          triton::ast::AbstractNode* ast = deref(conjunct.get());
+          worklist.pop_back();
+
+          if (ast->getType() == triton::ast::LAND_NODE) {
+            const auto& children = ast->getChildren();
+            worklist.insert(worklist.end(), children.rbegin(), children.rend());
+          }
+          else {
+            conjuncts.push_back(conjunct);
+          }
+        }
+
+        try {
+          bool changed = true;
+
+          for (triton::usize round = 0; changed && round < maxRounds && query.decided == triton::engines::solver::UNKNOWN; round++) {
+            std::unordered_map<triton::usize, SolverModel> fixing;
+            std::vector<triton::ast::SharedAbstractNode> kept;
+            changed = false;
+
+            /* Drops the constant conjuncts, narrows the comparisons and collects the x == const */
+            for (auto conjunct : conjuncts) {
+              triton::ast::SharedAbstractNode narrow = narrowComparison(ctxt, conjunct);
+              if (narrow) {
+                conjunct = narrow;
+                narrowed++;
+                changed = true;
+              }
+
+              triton::ast::AbstractNode* ast = deref(conjunct.get());
+
+              if (!conjunct->isSymbolized()) {
+                if (conjunct->evaluate() == 0) {
+                  query.decided = triton::engines::solver::UNSAT;
+                  break;
+                }
+                dropped++;
+                changed = true;
+                continue;
+              }
+
+              if ((ast->getType() == triton::ast::EQUAL_NODE || ast->getType() == triton::ast::IFF_NODE) && ast->getChildren()[0]->equalTo(ast->getChildren()[1])) {
+                dropped++;
+                changed = true;
+                continue;
+              }
+
+              if (ast->getType() == triton::ast::EQUAL_NODE) {
+                const auto& lhs = ast->getChildren()[0];
+                const auto& rhs = ast->getChildren()[1];
+                auto var = variableOf(lhs.get());
+                auto cst = rhs;
+
+                if (var == nullptr || rhs->isSymbolized()) {
+                  var = variableOf(rhs.get());
+                  cst = lhs;
+                }
+
+                /* A second equality of the same variable is kept, substituted it is decided */
+                if (var && !cst->isSymbolized() && fixing.find(var->getId()) == fixing.end()) {
+                  fixing[var->getId()] = SolverModel(var, cst->evaluate());
+                  dropped++;
+                  changed = true;
+                  continue;
+                }
+              }
+
+              kept.push_back(conjunct);
+            }
+
+            if (query.decided != triton::engines::solver::UNKNOWN)
+              break;
+
+            for (const auto& it : fixing) {
+              fixed[it.first] = it.second;
+              query.fixed.push_back(it.second);
+            }
+
+            /* Substitutes the fixed variables and narrows the extractions */
+            std::unordered_map<triton::ast::AbstractNode*, triton::ast::SharedAbstractNode> memo;
+            triton::usize before = narrowed;
+            for (auto& conjunct : kept) {
+              triton::ast::SharedAbstractNode result = rewrite(conjunct, fixing, memo, narrowed);
+              changed |= (result != conjunct);
+              conjunct = result;
+            }
+            changed |= (narrowed != before);
+
+            /* Eliminates the variables defined by an equality and used nowhere else */
+            std::vector<std::unordered_set<triton::usize>> vars;
+            std::unordered_map<triton::usize, triton::usize> uses;
+            for (const auto& conjunct : kept) {
+              vars.push_back(variablesOf(conjunct));
+              for (triton::usize id : vars.back())
+                uses[id]++;
+            }
+
+            conjuncts.clear();
+            for (triton::usize index = 0; index < kept.size(); index++) {
+              triton::ast::AbstractNode* ast = deref(kept[index].get());
+
+              if (ast->getType() == triton::ast::EQUAL_NODE) {
+                bool eliminated = false;
+
+                for (triton::uint32 side = 0; side < 2 && !eliminated; side++) {
+                  auto var = variableOf(ast->getChildren()[side].get());
+                  const auto& term = ast->getChildren()[1 - side];
+
+                  if (var == nullptr || uses[var->getId()] != 1 || variablesOf(term).count(var->getId()))
+                    continue;
+
+                  /* The value of the variable is computed from the models, the term must be evaluable */
+                  try {
+                    query.eliminated.push_back({var, std::make_shared<triton::ast::AstEvaluator>(term)});
+                    eliminated = true;
+                  }
+                  catch (const triton::exceptions::Exception&) {
+                  }
+                }
+
+                if (eliminated) {
+                  for (triton::usize id : vars[index])
+                    uses[id]--;
+                  changed = true;
+                  continue;
+                }
+              }
+
+              conjuncts.push_back(kept[index]);
+            }
+          }
+        }
+        catch (const triton::exceptions::Exception&) {
+          /* A node cannot be rewritten, the query is sent as is */
+          PreprocessedQuery original;
+          original.node = node;
+          std::lock_guard<std::mutex> guard(this->lock);
+          this->queries++;
+          return original;
+        }
+
+        if (query.decided == triton::engines::solver::UNKNOWN) {
+          if (conjuncts.empty())
+            query.decided = triton::engines::solver::SAT;
+          else if (conjuncts.size() == 1)
+            query.node = conjuncts.front();
+          else
+            query.node = ctxt->land(conjuncts);
+        }
+
+        if (query.decided == triton::engines::solver::UNSAT) {
+          query.fixed.clear();
+          query.eliminated.clear();
+        }
+
+        std::lock_guard<std::mutex> guard(this->lock);
+        this->queries++;
+        this->decided             += (query.decided != triton::engines::solver::UNKNOWN);
+        this->droppedConjuncts    += dropped;
+        this->eliminatedVariables += query.eliminated.size();
+        this->fixedVariables      += query.fixed.size();
+        this->narrowedNodes       += narrowed;
+
+        return query;
+      }
+
+
+      void SolverPreprocessor::reconstruct(const PreprocessedQuery& query, std::unordered_map<triton::usize, SolverModel>& model) const {
+        for (const auto& value : query.fixed)
+          model[value.getId()] = value;
+
+        /* A variable is eliminated before the variables of its term, its value is computed after theirs */
+        for (auto it = query.eliminated.rbegin(); it != query.eliminated.rend(); it++) {
+          std::vector<triton::uint512> values;
+
+          for (const auto& var : it->second->getVariables()) {
+            auto m = model.find(var->getId());
+            if (m == model.end())
+              m = model.insert({var->getId(), SolverModel(var, 0)}).first;
+            values.push_back(m->second.getValue());
+          }
+
+          model[it->first->getId()] = SolverModel(it->first, it->second->evaluate(values));
+        }
+      }
+
+
+      triton::usize SolverPreprocessor::getQueries(void) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->queries;
+      }
+
+
+      triton::usize SolverPreprocessor::getDecided(void) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->decided;
+      }
+
+
+      triton::usize SolverPreprocessor::getFixedVariables(void) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->fixedVariables;
+      }
+
+
+      triton::usize SolverPreprocessor::getEliminatedVariables(void) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->eliminatedVariables;
+      }
+
+
+      triton::usize SolverPreprocessor::getDroppedConjuncts(void) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->droppedConjuncts;
+      }
+
+
+      triton::usize SolverPreprocessor::getNarrowedNodes(void) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->narrowedNodes;
+      }
+
+    };
+  };
+};
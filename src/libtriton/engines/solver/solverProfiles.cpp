@@ -0,0 +1,235 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <unordered_set>
+
+#include <triton/exceptions.hpp>
+#include <triton/solverProfiles.hpp>
+#include <triton/symbolicVariable.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      /* The profile applied to the queries of the calling thread */
+      static thread_local const SolverProfile* currentProfile = nullptr;
+
+
+      SolverProfiles::SolverProfiles() {
+        SolverProfile qfbv;
+        SolverProfile arithmetic;
+        SolverProfile none;
+
+        none.name = "default";
+
+        qfbv.name    = "qfbv";
+        qfbv.tactics = {"simplify", "solve-eqs", "bit-blast", "sat"};
+
+        arithmetic.name   = "arithmetic";
+        arithmetic.engine = "prop";
+
+        this->enabled = false;
+        this->classes = {qfbv.name, arithmetic.name};
+
+        this->setProfile(none);
+        this->setProfile(qfbv);
+        this->setProfile(arithmetic);
+      }
+
+
+      bool SolverProfiles::isEnabled(void) const {
+        return this->enabled;
+      }
+
+
+      void SolverProfiles::setEnabled(bool flag) {
+        this->enabled = flag;
+      }
+
+
+      std::shared_ptr<const SolverProfile> SolverProfiles::find(const std::string& name, const char* where) const {
+        auto it = this->profiles.find(name);
+        if (it == this->profiles.end())
+          throw triton::exceptions::SolverEngine(std::string(where) + ": Unknown profile " + name + ".");
+        return it->second;
+      }
+
+
+      void SolverProfiles::setProfile(const SolverProfile& profile) {
+        if (profile.name.empty())
+          throw triton::exceptions::SolverEngine("SolverProfiles::setProfile(): The profile needs a name.");
+
+        std::lock_guard<std::mutex> guard(this->lock);
+        this->profiles[profile.name] = std::make_shared<const SolverProfile>(profile);
+      }
+
+
+      SolverProfile SolverProfiles::getProfile(const std::string& name) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return *this->find(name, "SolverProfiles::getProfile()");
+      }
+
+
+      std::vector<std::string> SolverProfiles::getNames(void) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        std::vector<std::string> names;
+
+        for (const auto& profile : this->profiles)
+          names.push_back(profile.first);
+
+        return names;
+      }
+
+
+      void SolverProfiles::setClassProfile(triton::engines::solver::query_class_e cls, const std::string& name) {
+        std::lock_guard<std::mutex> guard(this->lock);
+
+        if (static_cast<triton::usize>(cls) >= this->classes.size())
+          throw triton::exceptions::SolverEngine("SolverProfiles::setClassProfile(): Invalid class of queries.");
+
+        this->find(name, "SolverProfiles::setClassProfile()");
+        this->classes[cls] = name;
+      }
+
+
+      std::string SolverProfiles::getClassProfile(triton::engines::solver::query_class_e cls) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+
+        if (static_cast<triton::usize>(cls) >= this->classes.size())
+          throw triton::exceptions::SolverEngine("SolverProfiles::getClassProfile(): Invalid class of queries.");
+
+        return this->classes[cls];
+      }
+
+
+      void SolverProfiles::setForced(const std::string& name) {
+        std::lock_guard<std::mutex> guard(this->lock);
+
+        if (!name.empty())
+          this->find(name, "SolverProfiles::setForced()");
+
+        this->forced = name;
+      }
+
+
+      std::string SolverProfiles::getForced(void) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->forced;
+      }
+
+
+      std::shared_ptr<const SolverProfile> SolverProfiles::select(const triton::ast::SharedAbstractNode& node) const {
+        std::string name;
+
+        {
+          std::lock_guard<std::mutex> guard(this->lock);
+          if (!this->forced.empty())
+            name = this->forced;
+          else if (!this->enabled || node == nullptr)
+            return nullptr;
+        }
+
+        /* The features are computed out of the lock, the query may be large */
+        if (name.empty()) {
+          triton::engines::solver::query_class_e cls = SolverProfiles::classify(SolverProfiles::getFeatures(node));
+          std::lock_guard<std::mutex> guard(this->lock);
+          name = this->classes[cls];
+        }
+
+        std::lock_guard<std::mutex> guard(this->lock);
+        auto it = this->profiles.find(name);
+        if (it == this->profiles.end())
+          return nullptr;
+
+        this->selections[name]++;
+
+        return it->second;
+      }
+
+
+      std::map<std::string, triton::usize> SolverProfiles::getSelections(void) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->selections;
+      }
+
+
+      QueryFeatures SolverProfiles::getFeatures(const triton::ast::SharedAbstractNode& node) {
+        std::unordered_set<triton::usize> variables;
+        QueryFeatures features;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverProfiles::getFeatures(): node cannot be null.");
+
+        triton::ast::childrenTraversal(node, true /* unroll */, [&](const triton::ast::SharedAbstractNode& n) {
+          switch (n->getType()) {
+            case triton::ast::REFERENCE_NODE:
+              return;
+
+            case triton::ast::VARIABLE_NODE:
+              variables.insert(reinterpret_cast<triton::ast::VariableNode*>(n.get())->getSymbolicVariable()->getId());
+              break;
+
+            case triton::ast::BVMUL_NODE:
+            case triton::ast::BVSDIV_NODE:
+            case triton::ast::BVSMOD_NODE:
+            case triton::ast::BVSREM_NODE:
+            case triton::ast::BVUDIV_NODE:
+            case triton::ast::BVUREM_NODE:
+              /* A multiplication by a constant is a sum of shifts */
+              if (n->getType() != triton::ast::BVMUL_NODE || (n->getChildren()[0]->isSymbolized() && n->getChildren()[1]->isSymbolized()))
+                features.arithmetic++;
+              break;
+
+            default:
+              break;
+          }
+
+          features.nodes++;
+          if (!n->isLogical())
+            features.width = std::max(features.width, n->getBitvectorSize());
+        });
+
+        features.variables = variables.size();
+
+        return features;
+      }
+
+
+      triton::engines::solver::query_class_e SolverProfiles::classify(const QueryFeatures& features) {
+        if (features.arithmetic && features.arithmetic * 16 >= features.nodes)
+          return triton::engines::solver::QUERY_ARITHMETIC;
+        return triton::engines::solver::QUERY_BITVECTOR;
+      }
+
+
+      SolverProfileScope::SolverProfileScope(const std::shared_ptr<const SolverProfile>& profile)
+        : profile(profile), previous(currentProfile) {
+        currentProfile = profile.get();
+      }
+
+
+      SolverProfileScope::SolverProfileScope(const SolverProfile* profile)
+        : previous(currentProfile) {
+        currentProfile = profile;
+      }
+
+
+      SolverProfileScope::~SolverProfileScope() {
+        currentProfile = this->previous;
+      }
+
+
+      const SolverProfile* SolverProfileScope::current(void) {
+        return currentProfile;
+      }
+
+    };
+  };
+};
@@ -0,0 +1,242 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+#if defined(__unix__) || defined(__APPLE__)
+  #include <sys/resource.h>
+#endif
+
+#include <triton/exceptions.hpp>
+#include <triton/solverStatistics.hpp>
+#include <triton/tritonToSmt2.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      /* Returns the name of a status */
+      static const char* statusName(triton::engines::solver::status_e status) {
+        switch (status) {
+          case triton::engines::solver::UNSAT:    return "UNSAT";
+          case triton::engines::solver::SAT:      return "SAT";
+          case triton::engines::solver::TIMEOUT:  return "TIMEOUT";
+          case triton::engines::solver::OUTOFMEM: return "OUTOFMEM";
+          default:                                return "UNKNOWN";
+        }
+      }
+
+
+      /* Returns the max resident set (in megabytes) of the process and of its children, 0 if unknown */
+      static triton::usize residentMemory(void) {
+        #if defined(__unix__) || defined(__APPLE__)
+        struct rusage self, children;
+        if (getrusage(RUSAGE_SELF, &self) != 0 || getrusage(RUSAGE_CHILDREN, &children) != 0)
+          return 0;
+        triton::usize peak = std::max<triton::usize>(self.ru_maxrss, children.ru_maxrss);
+          #if defined(__APPLE__)
+          /* In bytes */
+          return peak >> 20;
+          #else
+          /* In kilobytes */
+          return peak >> 10;
+          #endif
+        #else
+        return 0;
+        #endif
+      }
+
+
+      SolverStatistics::SolverStatistics() {
+        this->enabled            = false;
+        this->slowQueryThreshold = 0;
+        this->clear();
+      }
+
+
+      bool SolverStatistics::isEnabled(void) const {
+        return this->enabled;
+      }
+
+
+      void SolverStatistics::setEnabled(bool flag) {
+        this->enabled = flag;
+      }
+
+
+      void SolverStatistics::recordHit(triton::engines::solver::status_e status) const {
+        if (!this->enabled)
+          return;
+
+        std::lock_guard<std::mutex> guard(this->lock);
+        this->queries[status]++;
+        this->cacheHits++;
+      }
+
+
+      void SolverStatistics::record(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e status, triton::uint32 time, triton::uint32 timeout, const std::string& solver) const {
+        triton::usize count = 0;
+        triton::usize bucket = 0;
+        bool slow = false;
+
+        if (!this->enabled)
+          return;
+
+        /* The nodes the solver translates, the references are looked through */
+        if (node != nullptr) {
+          triton::ast::childrenTraversal(node, true /* unroll */, [&count](const triton::ast::SharedAbstractNode& n) {
+            if (n->getType() != triton::ast::REFERENCE_NODE)
+              count++;
+          });
+        }
+
+        for (triton::uint64 bound = 1; bucket + 1 < SolverStatistics::buckets && time >= bound; bound *= 10)
+          bucket++;
+
+        if (node != nullptr && !this->slowQueryDirectory.empty() && time > this->slowQueryThreshold)
+          slow = this->dump(node, status, time, timeout, count, solver);
+
+        triton::usize memory = residentMemory();
+        std::lock_guard<std::mutex> guard(this->lock);
+
+        this->queries[status]++;
+        this->histogram[bucket]++;
+        this->totalTime  += time;
+        this->nodes      += count;
+        this->largest     = std::max(this->largest, count);
+        this->peakMemory  = std::max(this->peakMemory, memory);
+        this->slowQueries += slow;
+      }
+
+
+      bool SolverStatistics::dump(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e status, triton::uint32 time, triton::uint32 timeout, triton::usize count, const std::string& solver) const {
+        triton::ast::SharedAbstractNode onode = node;
+        triton::ast::TritonToSmt2 printer;
+        std::ostringstream script;
+        std::ostringstream path;
+        std::string term;
+
+        /* The query is asserted, not its assert() */
+        if (onode->getType() == triton::ast::ASSERT_NODE)
+          onode = onode->getChildren()[0];
+
+        if (!onode->isLogical())
+          return false;
+
+        try {
+          term = printer.convert(onode, script);
+        }
+        catch (const triton::exceptions::Exception&) {
+          return false;
+        }
+
+        /* Named by the hash of the query, the same query is written once */
+        path << this->slowQueryDirectory << "/query-" << std::hex << static_cast<triton::uint64>(node->getHash()) << ".smt2";
+
+        std::ofstream file(path.str());
+        if (!file.is_open())
+          throw triton::exceptions::SolverEngine("SolverStatistics::dump(): Cannot open " + path.str() + ".");
+
+        file << "; solver: "    << solver << std::endl;
+        file << "; status: "    << statusName(status) << std::endl;
+        file << "; time: "      << time << " ms" << std::endl;
+        file << "; timeout: "   << timeout << " ms" << std::endl;
+        file << "; nodes: "     << count << std::endl;
+        file << "; variables: " << printer.variables.size() << std::endl;
+        file << script.str();
+        file << "(assert " << term << ")" << std::endl;
+        file << "(check-sat)" << std::endl;
+        file << "(exit)" << std::endl;
+
+        return true;
+      }
+
+
+      triton::usize SolverStatistics::getQueries(triton::engines::solver::status_e status) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        auto it = this->queries.find(status);
+        return it != this->queries.end() ? it->second : 0;
+      }
+
+
+      triton::usize SolverStatistics::getCacheHits(void) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->cacheHits;
+      }
+
+
+      std::vector<triton::usize> SolverStatistics::getHistogram(void) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->histogram;
+      }
+
+
+      triton::uint64 SolverStatistics::getTotalTime(void) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->totalTime;
+      }
+
+
+      triton::usize SolverStatistics::getNodes(void) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->nodes;
+      }
+
+
+      triton::usize SolverStatistics::getLargestQuery(void) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->largest;
+      }
+
+
+      triton::usize SolverStatistics::getPeakMemory(void) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->peakMemory;
+      }
+
+
+      triton::usize SolverStatistics::getSlowQueries(void) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->slowQueries;
+      }
+
+
+      const std::string& SolverStatistics::getSlowQueryDirectory(void) const {
+        return this->slowQueryDirectory;
+      }
+
+
+      triton::uint32 SolverStatistics::getSlowQueryThreshold(void) const {
+        return this->slowQueryThreshold;
+      }
+
+
+      void SolverStatistics::setSlowQueryDump(const std::string& directory, triton::uint32 threshold) {
+        this->slowQueryDirectory = directory;
+        this->slowQueryThreshold = threshold;
+      }
+
+
+      void SolverStatistics::clear(void) {
+        std::lock_guard<std::mutex> guard(this->lock);
+        this->cacheHits   = 0;
+        this->histogram   = std::vector<triton::usize>(SolverStatistics::buckets, 0);
+        this->largest     = 0;
+        this->nodes       = 0;
+        this->peakMemory  = 0;
+        this->queries.clear();
+        this->slowQueries = 0;
+        this->totalTime   = 0;
+      }
+
+    };
+  };
+};
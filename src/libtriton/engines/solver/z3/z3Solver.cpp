@@ -11,6 +11,7 @@
 #include <triton/astContext.hpp>
 #include <triton/exceptions.hpp>
 #include <triton/solverModel.hpp>
+#include <triton/solverProfiles.hpp>
 #include <triton/symbolicVariable.hpp>
 #include <triton/tritonToZ3.hpp>
 #include <triton/tritonTypes.hpp>
@@ -23,6 +24,17 @@ namespace triton {
   namespace engines {
     namespace solver {
 
+      /* Returns the model of a numeral, read natively when it fits in 64 bits instead of parsing its decimal string */
+      static SolverModel toModel(const triton::engines::symbolic::SharedSymbolicVariable& variable, const z3::expr& exp) {
+        uint64_t value = 0;
+
+        if (exp.is_bv() && exp.get_sort().bv_size() <= 64 && Z3_get_numeral_uint64(exp.ctx(), exp, &value))
+          return SolverModel(variable, static_cast<triton::uint64>(value));
+
+        return SolverModel(variable, triton::uint512(std::string(Z3_get_numeral_string(exp.ctx(), exp))));
+      }
+
+
       z3::expr Z3Solver::mk_or(z3::expr_vector args) {
         std::vector<Z3_ast> array;
 
@@ -36,28 +48,45 @@ namespace triton {
       Z3Solver::Z3Solver() {
         this->timeout = 0;
         this->memoryLimit = 0;
+        this->sessionScopes = 0;
+        this->interrupted = false;
       }
 
 
       std::vector<std::unordered_map<triton::usize, SolverModel>> Z3Solver::getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
         std::vector<std::unordered_map<triton::usize, SolverModel>> ret;
+
+        this->enumerateModels(node, limit, [&ret](const std::unordered_map<triton::usize, SolverModel>& model) {
+          ret.push_back(model);
+          return true;
+        }, {}, status, timeout, solvingTime);
+
+        return ret;
+      }
+
+
+      triton::usize Z3Solver::enumerateModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, const ModelCallback& callback, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& variables, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        std::unordered_set<triton::usize> projection;
         triton::ast::SharedAbstractNode onode = node;
-        triton::ast::TritonToZ3 z3Ast{false};
+        triton::usize count = 0;
+
+        for (const auto& var : variables)
+          projection.insert(var->getId());
 
         try {
           if (onode == nullptr)
-            throw triton::exceptions::SolverEngine("Z3Solver::getModels(): node cannot be null.");
+            throw triton::exceptions::SolverEngine("Z3Solver::enumerateModels(): node cannot be null.");
 
           /* Z3 does not need an assert() as root node */
           if (node->getType() == triton::ast::ASSERT_NODE)
             onode = node->getChildren()[0];
 
           if (onode->isLogical() == false)
-            throw triton::exceptions::SolverEngine("Z3Solver::getModels(): Must be a logical node.");
+            throw triton::exceptions::SolverEngine("Z3Solver::enumerateModels(): Must be a logical node.");
 
-          z3::expr      expr = z3Ast.convert(onode);
+          z3::expr      expr = this->convertQuery(onode);
           z3::context&  ctx  = expr.ctx();
-          z3::solver    solver(ctx);
+          z3::solver    solver = this->newSolver(ctx);
 
           /* Create a solver and add the expression */
           solver.add(expr);
@@ -83,7 +112,7 @@ namespace triton {
           auto start = std::chrono::system_clock::now();
 
           /* Get first model */
-          z3::check_result res = solver.check();
+          z3::check_result res = this->check(solver);
 
           /* Write back the status code of the first constraint */
           this->writeBackStatus(solver, res, status);
@@ -104,35 +133,40 @@ namespace triton {
               /* Get the name as std::string from a z3 variable */
               std::string varName = z3Variable.name().str();
 
+              /* Only the variables of the projection are enumerated */
+              auto var = this->queryAst->variables.find(varName);
+              if (var == this->queryAst->variables.end())
+                continue;
+              if (!projection.empty() && projection.find(var->second->getId()) == projection.end())
+                continue;
+
               /* Get z3 expr */
               z3::expr exp = m.get_const_interp(z3Variable);
 
               /* Get the size of a z3 expr */
               triton::uint32 bvSize = exp.get_sort().bv_size();
 
-              /* Get the value of a z3 expr */
-              std::string svalue = Z3_get_numeral_string(ctx, exp);
-
-              /* Convert a string value to a integer value */
-              triton::uint512 value = triton::uint512(svalue);
-
-              /* Create a triton model */
-              SolverModel trionModel = SolverModel(z3Ast.variables[varName], value);
+              /* Create a triton model from the value of a z3 expr */
+              SolverModel trionModel = toModel(var->second, exp);
 
               /* Map the result */
               smodel[trionModel.getId()] = trionModel;
 
               /* Uniq result */
-              if (exp.get_sort().is_bv())
-                args.push_back(ctx.bv_const(varName.c_str(), bvSize) != ctx.bv_val(svalue.c_str(), bvSize));
+              if (exp.get_sort().is_bv()) {
+                z3::expr z3Value = (bvSize <= 64) ? ctx.bv_val(static_cast<uint64_t>(trionModel.getNarrowValue()), bvSize) : exp;
+                args.push_back(ctx.bv_const(varName.c_str(), bvSize) != z3Value);
+              }
             }
 
             /* Check that model is available */
             if (smodel.empty())
               break;
 
-            /* Push model */
-            ret.push_back(smodel);
+            /* Hand out the model, the caller may stop the enumeration */
+            count++;
+            if (!callback(smodel))
+              break;
 
             if (--limit) {
               /* Escape last models */
@@ -141,7 +175,7 @@ namespace triton {
               }
 
               /* Get next model */
-              res = solver.check();
+              res = this->check(solver);
             }
           }
 
@@ -156,18 +190,16 @@ namespace triton {
             if (status) {
               *status = triton::engines::solver::OUTOFMEM;
             }
-            return {};
+            return count;
           }
-          throw triton::exceptions::SolverEngine(std::string("Z3Solver::getModels(): ") + e.msg());
+          throw triton::exceptions::SolverEngine(std::string("Z3Solver::enumerateModels(): ") + e.msg());
         }
 
-        return ret;
+        return count;
       }
 
 
       bool Z3Solver::isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
-        triton::ast::TritonToZ3 z3Ast{false};
-
         if (node == nullptr)
           throw triton::exceptions::SolverEngine("Z3Solver::isSat(): node cannot be null.");
 
@@ -175,9 +207,9 @@ namespace triton {
           throw triton::exceptions::SolverEngine("Z3Solver::isSat(): Must be a logical node.");
 
         try {
-          z3::expr      expr = z3Ast.convert(node);
+          z3::expr      expr = this->convertQuery(node);
           z3::context&  ctx  = expr.ctx();
-          z3::solver    solver(ctx);
+          z3::solver    solver = this->newSolver(ctx);
 
           /* Create a solver and add the expression */
           solver.add(expr);
@@ -202,7 +234,7 @@ namespace triton {
           /* Get time of solving start */
           auto start = std::chrono::system_clock::now();
 
-          z3::check_result res = solver.check();
+          z3::check_result res = this->check(solver);
 
           /* Get time of solving end */
           auto end = std::chrono::system_clock::now();
@@ -225,6 +257,85 @@ namespace triton {
       }
 
 
+      std::vector<triton::ast::SharedAbstractNode> Z3Solver::getUnsatCore(const std::vector<triton::ast::SharedAbstractNode>& conjuncts, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        std::vector<triton::ast::SharedAbstractNode> core;
+
+        if (conjuncts.empty())
+          throw triton::exceptions::SolverEngine("Z3Solver::getUnsatCore(): Expects at least one conjunct.");
+
+        for (const auto& node : conjuncts) {
+          if (node == nullptr)
+            throw triton::exceptions::SolverEngine("Z3Solver::getUnsatCore(): node cannot be null.");
+          if (node->isLogical() == false)
+            throw triton::exceptions::SolverEngine("Z3Solver::getUnsatCore(): Must be a logical node.");
+        }
+
+        try {
+          z3::expr      first = this->convertQuery(conjuncts.front());
+          z3::context&  ctx   = first.ctx();
+          z3::solver    solver(ctx);
+          z3::expr_vector literals(ctx);
+          std::unordered_map<std::string, triton::usize> indexes;
+
+          /* Each conjunct is implied by a tracking literal, the core of the solver being a set of literals */
+          for (triton::usize i = 0; i < conjuncts.size(); i++) {
+            std::string name = "__core_" + std::to_string(i);
+            z3::expr literal = ctx.bool_const(name.c_str());
+            solver.add(z3::implies(literal, i ? this->convertQuery(conjuncts[i]) : first));
+            literals.push_back(literal);
+            indexes[name] = i;
+          }
+
+          z3::params p(ctx);
+
+          /* Define the timeout */
+          if (timeout) {
+            p.set(":timeout", timeout);
+          }
+          else if (this->timeout) {
+            p.set(":timeout", this->timeout);
+          }
+
+          /* Define memory limit */
+          if (this->memoryLimit) {
+            p.set(":max_memory", this->memoryLimit);
+          }
+
+          solver.set(p);
+
+          /* Get time of solving start */
+          auto start = std::chrono::system_clock::now();
+
+          z3::check_result res = this->check(solver, &literals);
+
+          /* Get time of solving end */
+          auto end = std::chrono::system_clock::now();
+
+          if (solvingTime)
+            *solvingTime = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+
+          this->writeBackStatus(solver, res, status);
+
+          if (res == z3::unsat) {
+            z3::expr_vector literalsCore = solver.unsat_core();
+            for (triton::uint32 i = 0; i < literalsCore.size(); i++)
+              core.push_back(conjuncts[indexes.at(literalsCore[i].decl().name().str())]);
+          }
+
+          return core;
+        }
+        catch (const z3::exception& e) {
+          if (!strcmp(e.msg(), "max. memory exceeded")) {
+            if (status) {
+              *status = triton::engines::solver::OUTOFMEM;
+            }
+            return {};
+          }
+          throw triton::exceptions::SolverEngine(std::string("Z3Solver::getUnsatCore(): ") + e.msg());
+        }
+      }
+
+
       std::unordered_map<triton::usize, SolverModel> Z3Solver::getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32 *solvingTime) const {
         std::unordered_map<triton::usize, SolverModel> ret;
         std::vector<std::unordered_map<triton::usize, SolverModel>> allModels;
@@ -276,7 +387,7 @@ namespace triton {
           if (expr.get_sort().is_bool())
             res = Z3_get_bool_value(expr.ctx(), expr) == Z3_L_TRUE ? true : false;
           else
-            res = triton::uint512{Z3_get_numeral_string(expr.ctx(), expr)};
+            res = toModel(nullptr, expr).getValue();
 
           return res;
         }
@@ -286,6 +397,21 @@ namespace triton {
       }
 
 
+      z3::solver Z3Solver::newSolver(z3::context& ctx) const {
+        const SolverProfile* profile = SolverProfileScope::current();
+
+        if (profile == nullptr || profile->tactics.empty())
+          return z3::solver(ctx);
+
+        /* The tactics of the profile applied in sequence */
+        z3::tactic pipeline(ctx, profile->tactics.front().c_str());
+        for (triton::usize i = 1; i < profile->tactics.size(); i++)
+          pipeline = pipeline & z3::tactic(ctx, profile->tactics[i].c_str());
+
+        return pipeline.mk_solver();
+      }
+
+
       void Z3Solver::writeBackStatus(z3::solver& solver, z3::check_result res, triton::engines::solver::status_e* status) const {
         if (status != nullptr) {
           switch (res) {
@@ -301,6 +427,11 @@ namespace triton {
               if (solver.reason_unknown() == "timeout") {
                 *status = triton::engines::solver::TIMEOUT;
               }
+              /* The incremental solver of a session reports its timeout as canceled */
+              else if (solver.reason_unknown() == "canceled") {
+                std::lock_guard<std::mutex> guard(this->runningLock);
+                *status = this->interrupted ? triton::engines::solver::UNKNOWN : triton::engines::solver::TIMEOUT;
+              }
               else if (solver.reason_unknown() == "max. memory exceeded") {
                 *status = triton::engines::solver::OUTOFMEM;
               }
@@ -313,6 +444,41 @@ namespace triton {
       }
 
 
+      z3::check_result Z3Solver::check(z3::solver& solver, const z3::expr_vector* assumptions) const {
+        z3::check_result res = z3::unknown;
+
+        {
+          std::lock_guard<std::mutex> guard(this->runningLock);
+          if (this->interrupted)
+            return z3::unknown;
+          this->running.insert(&solver.ctx());
+        }
+
+        try {
+          res = assumptions ? solver.check(*assumptions) : solver.check();
+        }
+        catch (...) {
+          std::lock_guard<std::mutex> guard(this->runningLock);
+          this->running.erase(&solver.ctx());
+          throw;
+        }
+
+        std::lock_guard<std::mutex> guard(this->runningLock);
+        this->running.erase(&solver.ctx());
+
+        return res;
+      }
+
+
+      void Z3Solver::interrupt(void) {
+        std::lock_guard<std::mutex> guard(this->runningLock);
+
+        this->interrupted = true;
+        for (auto* ctx : this->running)
+          ctx->interrupt();
+      }
+
+
       std::string Z3Solver::getName(void) const {
         return "z3";
       }
@@ -327,6 +493,169 @@ namespace triton {
         this->memoryLimit = limit;
       }
 
+
+      z3::expr Z3Solver::convertQuery(const triton::ast::SharedAbstractNode& node) const {
+        if (this->queryAst == nullptr)
+          this->queryAst.reset(new triton::ast::TritonToZ3(false));
+
+        return this->queryAst->convert(node, this->queryTerms);
+      }
+
+
+      void Z3Solver::initSession(void) {
+        if (this->session)
+          return;
+
+        this->sessionAst.reset(new triton::ast::TritonToZ3(false));
+        this->session.reset(new z3::solver(this->sessionAst->getContext()));
+        this->sessionScopes = 0;
+      }
+
+
+      z3::expr Z3Solver::convertSessionNode(const triton::ast::SharedAbstractNode& node, const char* where) {
+        triton::ast::SharedAbstractNode onode = node;
+
+        if (onode == nullptr)
+          throw triton::exceptions::SolverEngine(std::string(where) + ": node cannot be null.");
+
+        /* Z3 does not need an assert() as root node */
+        if (onode->getType() == triton::ast::ASSERT_NODE)
+          onode = onode->getChildren()[0];
+
+        if (onode->isLogical() == false)
+          throw triton::exceptions::SolverEngine(std::string(where) + ": Must be a logical node.");
+
+        this->initSession();
+
+        return this->sessionAst->convert(onode, this->sessionTerms);
+      }
+
+
+      void Z3Solver::pushConstraint(const triton::ast::SharedAbstractNode& node) {
+        try {
+          z3::expr expr = this->convertSessionNode(node, "Z3Solver::pushConstraint()");
+          this->session->add(expr);
+        }
+        catch (const z3::exception& e) {
+          throw triton::exceptions::SolverEngine(std::string("Z3Solver::pushConstraint(): ") + e.msg());
+        }
+      }
+
+
+      void Z3Solver::push(void) {
+        this->initSession();
+        this->session->push();
+        this->sessionScopes++;
+      }
+
+
+      void Z3Solver::pop(triton::uint32 count) {
+        if (count > this->sessionScopes)
+          throw triton::exceptions::SolverEngine("Z3Solver::pop(): Not enough scopes opened.");
+
+        if (count) {
+          this->session->pop(count);
+          this->sessionScopes -= count;
+        }
+      }
+
+
+      std::unordered_map<triton::usize, SolverModel> Z3Solver::checkWithAssumptions(const std::vector<triton::ast::SharedAbstractNode>& assumptions, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) {
+        std::unordered_map<triton::usize, SolverModel> ret;
+        bool scoped = false;
+
+        try {
+          this->initSession();
+
+          z3::context& ctx = this->sessionAst->getContext();
+          z3::expr_vector exprs(ctx);
+
+          for (const auto& node : assumptions)
+            exprs.push_back(this->convertSessionNode(node, "Z3Solver::checkWithAssumptions()"));
+
+          z3::params p(ctx);
+
+          /* Define the timeout */
+          if (timeout) {
+            p.set(":timeout", timeout);
+          }
+          else if (this->timeout) {
+            p.set(":timeout", this->timeout);
+          }
+
+          /* Define memory limit */
+          if (this->memoryLimit) {
+            p.set(":max_memory", this->memoryLimit);
+          }
+
+          this->session->set(p);
+
+          /* The assumptions are asserted in a scope of their own, dropped once the check is done */
+          this->session->push();
+          scoped = true;
+          for (triton::uint32 i = 0; i < exprs.size(); i++)
+            this->session->add(exprs[i]);
+
+          /* Get time of solving start */
+          auto start = std::chrono::system_clock::now();
+
+          z3::check_result res = this->check(*this->session);
+
+          /* Get time of solving end */
+          auto end = std::chrono::system_clock::now();
+
+          if (solvingTime)
+            *solvingTime = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+
+          this->writeBackStatus(*this->session, res, status);
+
+          if (res == z3::sat) {
+            z3::model m = this->session->get_model();
+
+            /* Traversing the model */
+            for (triton::uint32 i = 0; i < m.size(); i++) {
+              z3::func_decl z3Variable = m[i];
+              std::string varName = z3Variable.name().str();
+
+              /* Only the symbolic variables of the session are reported */
+              auto it = this->sessionAst->variables.find(varName);
+              if (it == this->sessionAst->variables.end())
+                continue;
+
+              z3::expr exp = m.get_const_interp(z3Variable);
+
+              SolverModel trionModel = toModel(it->second, exp);
+              ret[trionModel.getId()] = trionModel;
+            }
+          }
+
+          scoped = false;
+          this->session->pop();
+        }
+        catch (const z3::exception& e) {
+          if (scoped)
+            this->session->pop();
+          if (!strcmp(e.msg(), "max. memory exceeded")) {
+            if (status) {
+              *status = triton::engines::solver::OUTOFMEM;
+            }
+            return {};
+          }
+          throw triton::exceptions::SolverEngine(std::string("Z3Solver::checkWithAssumptions(): ") + e.msg());
+        }
+
+        return ret;
+      }
+
+
+      void Z3Solver::resetSession(void) {
+        /* The solver and the terms are released before their context */
+        this->session.reset();
+        this->sessionTerms.clear();
+        this->sessionAst.reset();
+        this->sessionScopes = 0;
+      }
+
     };
   };
 };
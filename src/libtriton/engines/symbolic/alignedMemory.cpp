@@ -0,0 +1,180 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <iterator>
+
+#include <triton/alignedMemory.hpp>
+#include <triton/cpuSize.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace symbolic {
+
+      std::map<triton::uint64, AlignedMemory::Entry>& AlignedMemory::detach(void) {
+        if (this->entries == nullptr)
+          this->entries = std::make_shared<std::map<triton::uint64, Entry>>();
+
+        /* Copy on write */
+        else if (this->entries.use_count() > 1)
+          this->entries = std::make_shared<std::map<triton::uint64, Entry>>(*this->entries);
+
+        return *this->entries;
+      }
+
+
+      std::map<triton::uint64, AlignedMemory::Entry>::const_iterator AlignedMemory::firstOverlap(triton::uint64 addr, triton::usize size) const {
+        const std::map<triton::uint64, Entry>& map = *this->entries;
+        auto it = map.lower_bound(addr);
+
+        /* Entries do not overlap, only the previous one may contain addr */
+        if (it != map.begin()) {
+          auto previous = std::prev(it);
+          if (addr - previous->first < previous->second.size)
+            return previous;
+        }
+
+        if (it != map.end() && it->first - addr < size)
+          return it;
+
+        return map.end();
+      }
+
+
+      const SharedSymbolicExpression& AlignedMemory::get(triton::uint64 addr, triton::uint32 size) const {
+        static const SharedSymbolicExpression none = nullptr;
+
+        if (this->entries == nullptr)
+          return none;
+
+        auto it = this->entries->find(addr);
+        if (it == this->entries->end() || it->second.size != size)
+          return none;
+
+        /* A fragment of a wider expression is not the expression of the range */
+        if (it->second.offset != 0 || it->second.expr->getAst()->getBitvectorSize() != size * triton::bitsize::byte)
+          return none;
+
+        return it->second.expr;
+      }
+
+
+      const SharedSymbolicExpression& AlignedMemory::getCovering(triton::uint64 addr, triton::uint32 size, triton::uint64& base) const {
+        static const SharedSymbolicExpression none = nullptr;
+
+        if (this->entries == nullptr || size == 0)
+          return none;
+
+        auto it = this->firstOverlap(addr, size);
+        if (it == this->entries->end() || it->first > addr)
+          return none;
+
+        /* The entry holds addr, it must also hold the last byte */
+        if ((addr - it->first) + size > it->second.size)
+          return none;
+
+        base = it->first - it->second.offset;
+        return it->second.expr;
+      }
+
+
+      bool AlignedMemory::contains(triton::uint64 addr, triton::uint32 size) const {
+        return this->get(addr, size) != nullptr;
+      }
+
+
+      std::vector<std::pair<triton::uint64, AlignedMemory::Entry>> AlignedMemory::getOverlapping(triton::uint64 addr, triton::uint32 size) const {
+        std::vector<std::pair<triton::uint64, Entry>> ret;
+
+        if (this->entries == nullptr || size == 0)
+          return ret;
+
+        for (auto it = this->firstOverlap(addr, size); it != this->entries->end() && (it->first - addr < size || it->first < addr); it++) {
+          triton::uint64 first = std::max(it->first, addr);
+          triton::uint64 last  = std::min(it->first + it->second.size, addr + size);
+          Entry entry          = it->second;
+
+          entry.offset += static_cast<triton::uint32>(first - it->first);
+          entry.size    = static_cast<triton::uint32>(last - first);
+          ret.push_back(std::make_pair(first, entry));
+        }
+
+        return ret;
+      }
+
+
+      void AlignedMemory::set(triton::uint64 addr, triton::uint32 size, const SharedSymbolicExpression& expr) {
+        this->erase(addr, size);
+        this->detach()[addr] = Entry{size, 0, expr};
+      }
+
+
+      void AlignedMemory::erase(triton::uint64 addr, triton::usize size) {
+        if (this->entries == nullptr || size == 0)
+          return;
+
+        /* Most writes do not overlap an entry, look before copying shared entries */
+        if (this->firstOverlap(addr, size) == this->entries->end())
+          return;
+
+        std::map<triton::uint64, Entry>& map = this->detach();
+        auto it = this->firstOverlap(addr, size);
+
+        /* The entry holding addr keeps the bytes below the range */
+        if (it->first < addr) {
+          Entry& entry = map[it->first];
+          Entry  upper = entry;
+
+          entry.size = static_cast<triton::uint32>(addr - it->first);
+          if (addr + size - it->first < upper.size) {
+            /* The range is inside the entry, it also keeps the bytes above the range */
+            triton::uint32 skip = static_cast<triton::uint32>(addr + size - it->first);
+            map[addr + size] = Entry{upper.size - skip, upper.offset + skip, upper.expr};
+            return;
+          }
+          it++;
+        }
+
+        /* The entries inside the range are removed, the last one keeps the bytes above the range */
+        while (it != map.end() && it->first - addr < size) {
+          triton::uint64 end = it->first + it->second.size;
+          if (end - addr > size) {
+            triton::uint32 skip = static_cast<triton::uint32>(addr + size - it->first);
+            map[addr + size] = Entry{it->second.size - skip, it->second.offset + skip, it->second.expr};
+          }
+          it = map.erase(it);
+        }
+
+        if (map.empty())
+          this->entries = nullptr;
+      }
+
+
+      void AlignedMemory::clear(void) {
+        this->entries = nullptr;
+      }
+
+
+      bool AlignedMemory::empty(void) const {
+        return this->entries == nullptr;
+      }
+
+
+      triton::usize AlignedMemory::size(void) const {
+        return this->entries ? this->entries->size() : 0;
+      }
+
+
+      triton::usize AlignedMemory::getBytes(void) const {
+        return this->size() * (sizeof(std::map<triton::uint64, Entry>::value_type) + 4 * sizeof(void*));
+      }
+
+    }; /* symbolic namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
@@ -0,0 +1,111 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <triton/concretizationPolicy.hpp>
+#include <triton/exceptions.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace symbolic {
+
+      static void checkPolicy(triton::engines::symbolic::pointer_policy_e policy) {
+        switch (policy) {
+          case CONCRETIZE_POINTER:
+          case CONSTRAIN_POINTER:
+          case FORK_POINTER:
+          case SYMBOLIC_POINTER:
+            break;
+          default:
+            throw triton::exceptions::SymbolicEngine("ConcretizationPolicy::setPolicy(): Invalid pointer policy.");
+        }
+      }
+
+
+      ConcretizationPolicy::ConcretizationPolicy() {
+        this->arrayCells = 1024;
+        this->forkValues = 8;
+        this->policy     = triton::engines::symbolic::CONCRETIZE_POINTER;
+      }
+
+
+      triton::engines::symbolic::pointer_policy_e ConcretizationPolicy::getPolicy(void) const {
+        return this->policy;
+      }
+
+
+      triton::engines::symbolic::pointer_policy_e ConcretizationPolicy::getPolicy(triton::uint64 addr) const {
+        if (this->sites.empty())
+          return this->policy;
+
+        auto it = this->sites.find(addr);
+        if (it == this->sites.end())
+          return this->policy;
+
+        return it->second;
+      }
+
+
+      void ConcretizationPolicy::setPolicy(triton::engines::symbolic::pointer_policy_e policy) {
+        checkPolicy(policy);
+        this->policy = policy;
+      }
+
+
+      void ConcretizationPolicy::setPolicy(triton::uint64 addr, triton::engines::symbolic::pointer_policy_e policy) {
+        checkPolicy(policy);
+        this->sites[addr] = policy;
+      }
+
+
+      void ConcretizationPolicy::removePolicy(triton::uint64 addr) {
+        this->sites.erase(addr);
+      }
+
+
+      triton::usize ConcretizationPolicy::getArrayCells(void) const {
+        return this->arrayCells;
+      }
+
+
+      triton::uint32 ConcretizationPolicy::getForkValues(void) const {
+        return this->forkValues;
+      }
+
+
+      void ConcretizationPolicy::setLimits(triton::usize arrayCells, triton::uint32 forkValues) {
+        if (arrayCells == 0 || forkValues == 0)
+          throw triton::exceptions::SymbolicEngine("ConcretizationPolicy::setLimits(): The limits must be at least one.");
+
+        this->arrayCells = arrayCells;
+        this->forkValues = forkValues;
+      }
+
+
+      ConcretizationPolicy::Statistics& ConcretizationPolicy::record(triton::uint64 addr) {
+        auto it = this->statistics.find(addr);
+        if (it == this->statistics.end())
+          it = this->statistics.emplace(addr, Statistics{0, 0, 0, 0, 0, 0, 0}).first;
+
+        it->second.dereferences++;
+        return it->second;
+      }
+
+
+      const std::unordered_map<triton::uint64, ConcretizationPolicy::Statistics>& ConcretizationPolicy::getStatistics(void) const {
+        return this->statistics;
+      }
+
+
+      void ConcretizationPolicy::resetStatistics(void) {
+        this->statistics.clear();
+      }
+
+    }; /* symbolic namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
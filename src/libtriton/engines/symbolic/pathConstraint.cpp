@@ -14,46 +14,70 @@ namespace triton {
   namespace engines {
     namespace symbolic {
 
+      /* The branches of a path constraint without branch */
+      static const std::vector<std::tuple<bool, triton::uint64, triton::uint64, triton::ast::SharedAbstractNode>> noBranches;
+
+
       PathConstraint::PathConstraint() {
-        this->tid = static_cast<triton::uint32>(-1);
+        this->count = 1;
+        this->tid   = static_cast<triton::uint32>(-1);
       }
 
 
       PathConstraint::PathConstraint(const PathConstraint &other) {
-        this->branches  = other.branches;
-        this->comment   = other.comment;
-        this->tid       = other.tid;
+        this->branches    = other.branches;
+        this->comment     = other.comment;
+        this->count       = other.count;
+        this->iterations  = other.iterations;
+        this->tid         = other.tid;
       }
 
 
       PathConstraint::~PathConstraint() {
         /* See #828: Release ownership before calling container destructor */
-        this->branches.clear();
+        this->branches.reset();
+        this->iterations.clear();
       }
 
 
       PathConstraint& PathConstraint::operator=(const PathConstraint &other) {
-        this->branches  = other.branches;
-        this->comment   = other.comment;
-        this->tid       = other.tid;
+        this->branches    = other.branches;
+        this->comment     = other.comment;
+        this->count       = other.count;
+        this->iterations  = other.iterations;
+        this->tid         = other.tid;
         return *this;
       }
 
 
+      std::vector<std::tuple<bool, triton::uint64, triton::uint64, triton::ast::SharedAbstractNode>>& PathConstraint::detachBranches(void) {
+        if (this->branches == nullptr)
+          this->branches = std::make_shared<std::vector<std::tuple<bool, triton::uint64, triton::uint64, triton::ast::SharedAbstractNode>>>();
+
+        else if (this->branches.use_count() > 1)
+          this->branches = std::make_shared<std::vector<std::tuple<bool, triton::uint64, triton::uint64, triton::ast::SharedAbstractNode>>>(*this->branches);
+
+        return *this->branches;
+      }
+
+
       void PathConstraint::addBranchConstraint(bool taken, triton::uint64 srcAddr, triton::uint64 dstAddr, const triton::ast::SharedAbstractNode& pc) {
         if (pc == nullptr)
           throw triton::exceptions::PathConstraint("PathConstraint::addBranchConstraint(): The PC node cannot be null.");
-        this->branches.push_back(std::make_tuple(taken, srcAddr, dstAddr, pc));
+        this->detachBranches().push_back(std::make_tuple(taken, srcAddr, dstAddr, pc));
       }
 
 
       const std::vector<std::tuple<bool, triton::uint64, triton::uint64, triton::ast::SharedAbstractNode>>& PathConstraint::getBranchConstraints(void) const {
-        return this->branches;
+        if (this->branches == nullptr)
+          return noBranches;
+        return *this->branches;
       }
 
 
       triton::uint64 PathConstraint::getTakenAddress(void) const {
-        for (auto it = this->branches.begin(); it != this->branches.end(); it++) {
+        const auto& branches = this->getBranchConstraints();
+        for (auto it = branches.begin(); it != branches.end(); it++) {
           if (std::get<0>(*it) == true)
             return std::get<2>(*it);
         }
@@ -62,7 +86,8 @@ namespace triton {
 
 
       triton::ast::SharedAbstractNode PathConstraint::getTakenPredicate(void) const {
-        for (auto it = this->branches.begin(); it != this->branches.end(); it++) {
+        const auto& branches = this->getBranchConstraints();
+        for (auto it = branches.begin(); it != branches.end(); it++) {
           if (std::get<0>(*it) == true)
             return std::get<3>(*it);
         }
@@ -71,9 +96,10 @@ namespace triton {
 
 
       bool PathConstraint::isMultipleBranches(void) const {
-        if (this->branches.size() == 0)
+        const auto& branches = this->getBranchConstraints();
+        if (branches.size() == 0)
           throw triton::exceptions::PathConstraint("PathConstraint::isMultipleBranches(): Path Constraint is empty.");
-        else if (this->branches.size() == 1)
+        else if (branches.size() == 1)
           return false;
         return true;
       }
@@ -98,6 +124,69 @@ namespace triton {
         this->comment = comment;
       }
 
+
+      triton::usize PathConstraint::getCount(void) const {
+        return this->count;
+      }
+
+
+      void PathConstraint::setCount(triton::usize count) {
+        this->count = count;
+      }
+
+
+      const std::vector<triton::ast::SharedAbstractNode>& PathConstraint::getIterations(void) const {
+        return this->iterations;
+      }
+
+
+      void PathConstraint::setIterations(const std::vector<triton::ast::SharedAbstractNode>& iterations) {
+        this->iterations = iterations;
+      }
+
+
+      std::vector<triton::ast::SharedAbstractNode> PathConstraint::getPredicates(void) const {
+        std::vector<triton::ast::SharedAbstractNode> predicates;
+
+        for (const auto& branch : this->getBranchConstraints())
+          predicates.push_back(std::get<3>(branch));
+        predicates.insert(predicates.end(), this->iterations.begin(), this->iterations.end());
+
+        return predicates;
+      }
+
+
+      void PathConstraint::setPredicates(const std::vector<triton::ast::SharedAbstractNode>& predicates) {
+        if (predicates.size() != this->getBranchConstraints().size() + this->iterations.size())
+          throw triton::exceptions::PathConstraint("PathConstraint::setPredicates(): Invalid number of predicates.");
+
+        auto predicate = predicates.begin();
+        for (auto& branch : this->detachBranches())
+          std::get<3>(branch) = *predicate++;
+
+        for (auto& iteration : this->iterations)
+          iteration = *predicate++;
+      }
+
+
+      void PathConstraint::addIteration(const triton::ast::SharedAbstractNode& predicate, triton::usize count, const triton::ast::SharedAbstractNode& taken, const triton::ast::SharedAbstractNode& notTaken) {
+        if (predicate == nullptr || taken == nullptr || notTaken == nullptr)
+          throw triton::exceptions::PathConstraint("PathConstraint::addIteration(): The predicates cannot be null.");
+
+        if (this->getBranchConstraints().size() != 2)
+          throw triton::exceptions::PathConstraint("PathConstraint::addIteration(): Only the branches with two targets summarize iterations.");
+
+        /* The first iteration is the constraint itself */
+        if (this->iterations.empty())
+          this->iterations.push_back(this->getTakenPredicate());
+
+        this->iterations.push_back(predicate);
+        this->count += count;
+
+        for (auto& branch : this->detachBranches())
+          std::get<3>(branch) = std::get<0>(branch) ? taken : notTaken;
+      }
+
     }; /* symbolic namespace */
   }; /* engines namespace */
 }; /*triton namespace */
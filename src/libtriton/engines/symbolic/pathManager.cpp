@@ -5,10 +5,18 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <algorithm>
+#include <sstream>
+#include <tuple>
+#include <unordered_set>
+
 #include <triton/astContext.hpp>
+#include <triton/astSerializer.hpp>
 #include <triton/exceptions.hpp>
 #include <triton/pathManager.hpp>
 #include <triton/symbolicEnums.hpp>
+#include <triton/symbolicExpression.hpp>
+#include <triton/symbolicVariable.hpp>
 
 
 
@@ -16,33 +24,270 @@ namespace triton {
   namespace engines {
     namespace symbolic {
 
+      /* Returns the key of a path constraint deduplicated with PC_DEDUPLICATION */
+      static std::tuple<triton::uint64, triton::uint64, triton::uint128> fingerprintOf(const triton::engines::symbolic::PathConstraint& pco) {
+        return std::make_tuple(std::get<1>(pco.getBranchConstraints().front()), pco.getTakenAddress(), pco.getTakenPredicate()->getHash());
+      }
+
+
+      /* Returns true if two path constraints are iterations of a same loop branch */
+      static bool isSameIteration(const triton::engines::symbolic::PathConstraint& pc1, const triton::engines::symbolic::PathConstraint& pc2) {
+        const auto& branches1 = pc1.getBranchConstraints();
+        const auto& branches2 = pc2.getBranchConstraints();
+
+        if (branches1.size() != 2 || branches2.size() != 2 || pc1.getThreadId() != pc2.getThreadId())
+          return false;
+
+        for (triton::usize index = 0; index < 2; index++) {
+          if (std::get<0>(branches1[index]) != std::get<0>(branches2[index]) ||
+              std::get<1>(branches1[index]) != std::get<1>(branches2[index]) ||
+              std::get<2>(branches1[index]) != std::get<2>(branches2[index]))
+            return false;
+        }
+
+        return true;
+      }
+
+
+      /* An ordered comparison whose operands are split into a root and a constant offset, the root being nullptr for a constant */
+      struct InductionComparison {
+        triton::ast::ast_e kind;
+        triton::ast::SharedAbstractNode operands[2];
+        triton::ast::SharedAbstractNode roots[2];
+        triton::uint512 offsets[2];
+      };
+
+
+      /* Returns the AST of a reference, the node otherwise */
+      static triton::ast::SharedAbstractNode unreference(const triton::ast::SharedAbstractNode& node) {
+        if (node->getType() == triton::ast::REFERENCE_NODE)
+          return reinterpret_cast<triton::ast::ReferenceNode*>(node.get())->getSymbolicExpression()->getAst();
+        return node;
+      }
+
+
+      /* Splits `node` into a root plus a constant offset, through the references and the additions of constants of a bounded depth */
+      static void splitInduction(const triton::ast::SharedAbstractNode& node, triton::ast::SharedAbstractNode& root, triton::uint512& offset) {
+        triton::uint512 mask = node->getBitvectorMask();
+        triton::ast::SharedAbstractNode n = node;
+
+        offset = 0;
+        for (triton::uint32 depth = 0; depth < 16; depth++) {
+          n = unreference(n);
+
+          if (n->getType() == triton::ast::BV_NODE) {
+            offset = (offset + n->evaluate()) & mask;
+            root   = nullptr;
+            return;
+          }
+
+          if ((n->getType() == triton::ast::BVADD_NODE || n->getType() == triton::ast::BVSUB_NODE) && n->getChildren().size() == 2 && n->getChildren()[1]->getType() == triton::ast::BV_NODE) {
+            if (n->getType() == triton::ast::BVADD_NODE)
+              offset = (offset + n->getChildren()[1]->evaluate()) & mask;
+            else
+              offset = (offset + mask + 1 - n->getChildren()[1]->evaluate()) & mask;
+            n = n->getChildren()[0];
+            continue;
+          }
+
+          /* The low part of a register written with a zero extension (e.g. a 32-bit register of x86-64) */
+          if (n->getType() == triton::ast::EXTRACT_NODE && n->getChildren()[1]->evaluate() == 0) {
+            triton::ast::SharedAbstractNode parent = unreference(n->getChildren()[2]);
+            if (parent->getType() == triton::ast::ZX_NODE && parent->getChildren()[1]->getBitvectorSize() == n->getBitvectorSize()) {
+              n = parent->getChildren()[1];
+              continue;
+            }
+          }
+
+          break;
+        }
+
+        root = n;
+      }
+
+
+      /* Returns true if the predicate `node` is an ordered comparison, through negations, references and the flags holding it */
+      static bool getInductionComparison(const triton::ast::SharedAbstractNode& node, InductionComparison& cmp) {
+        triton::ast::SharedAbstractNode n = node;
+        bool negated = false;
+
+        for (triton::uint32 depth = 0; depth < 16; depth++) {
+          const auto& children = n->getChildren();
+
+          switch (n->getType()) {
+            case triton::ast::REFERENCE_NODE:
+              n = unreference(n);
+              continue;
+
+            case triton::ast::LNOT_NODE:
+              negated = !negated;
+              n = children[0];
+              continue;
+
+            /* A flag compared to a constant */
+            case triton::ast::EQUAL_NODE:
+              if (children[0]->getBitvectorSize() != 1 || children[1]->getType() != triton::ast::BV_NODE)
+                return false;
+              negated = (children[1]->evaluate() == 0) ? !negated : negated;
+              n = children[0];
+              continue;
+
+            /* A flag set from a comparison */
+            case triton::ast::ITE_NODE:
+              if (children[1]->getType() != triton::ast::BV_NODE || children[2]->getType() != triton::ast::BV_NODE ||
+                  children[1]->getBitvectorSize() != 1 || children[1]->evaluate() == children[2]->evaluate())
+                return false;
+              negated = (children[1]->evaluate() == 0) ? !negated : negated;
+              n = children[0];
+              continue;
+
+            case triton::ast::EXTRACT_NODE:
+              if (children[2]->getBitvectorSize() != 1)
+                return false;
+              n = children[2];
+              continue;
+
+            case triton::ast::BVSGE_NODE:
+            case triton::ast::BVSGT_NODE:
+            case triton::ast::BVSLE_NODE:
+            case triton::ast::BVSLT_NODE:
+            case triton::ast::BVUGE_NODE:
+            case triton::ast::BVUGT_NODE:
+            case triton::ast::BVULE_NODE:
+            case triton::ast::BVULT_NODE:
+              break;
+
+            default:
+              return false;
+          }
+
+          cmp.kind = n->getType();
+          if (negated) {
+            switch (cmp.kind) {
+              case triton::ast::BVSGE_NODE: cmp.kind = triton::ast::BVSLT_NODE; break;
+              case triton::ast::BVSGT_NODE: cmp.kind = triton::ast::BVSLE_NODE; break;
+              case triton::ast::BVSLE_NODE: cmp.kind = triton::ast::BVSGT_NODE; break;
+              case triton::ast::BVSLT_NODE: cmp.kind = triton::ast::BVSGE_NODE; break;
+              case triton::ast::BVUGE_NODE: cmp.kind = triton::ast::BVULT_NODE; break;
+              case triton::ast::BVUGT_NODE: cmp.kind = triton::ast::BVULE_NODE; break;
+              case triton::ast::BVULE_NODE: cmp.kind = triton::ast::BVUGT_NODE; break;
+              default:                      cmp.kind = triton::ast::BVUGE_NODE; break;
+            }
+          }
+
+          for (triton::usize index = 0; index < 2; index++) {
+            cmp.operands[index] = children[index];
+            splitInduction(children[index], cmp.roots[index], cmp.offsets[index]);
+          }
+
+          return true;
+        }
+
+        return false;
+      }
+
+
+      /* Returns true if both roots are the same constant or node */
+      static bool isSameRoot(const triton::ast::SharedAbstractNode& root1, const triton::ast::SharedAbstractNode& root2) {
+        if (root1 == nullptr || root2 == nullptr)
+          return root1 == root2;
+        return root1 == root2 || root1->getHash() == root2->getHash();
+      }
+
+
       PathManager::PathManager(const triton::modes::SharedModes& modes, const triton::ast::SharedAstContext& astCtxt)
         : modes(modes), astCtxt(astCtxt) {
+        this->coverage            = nullptr;
+        this->flippableIterations = 1;
+        this->maxDepth            = 0;
+        this->residentConstraints = 0;
+        this->statistics          = nullptr;
+      }
+
+
+      triton::usize PathManager::FingerprintHash::operator()(const std::tuple<triton::uint64, triton::uint64, triton::uint128>& key) const {
+        triton::uint64 hash = std::get<2>(key).convert_to<triton::uint64>() ^ (std::get<2>(key) >> 64).convert_to<triton::uint64>();
+        hash ^= std::get<0>(key) * 0x9e3779b97f4a7c15ULL;
+        hash ^= std::get<1>(key) * 0xc2b2ae3d27d4eb4fULL;
+        return static_cast<triton::usize>(hash);
       }
 
 
       PathManager::PathManager(const PathManager& other)
         : modes(other.modes), astCtxt(other.astCtxt) {
-        this->pathConstraints = other.pathConstraints;
+        /* The structures are shared, the components are rebuilt from the variables when asked */
+        this->chunks              = other.chunks;
+        this->constraintVariables = other.constraintVariables;
+        this->coverage            = other.coverage;
+        this->directs             = other.directs;
+        this->fingerprints        = other.fingerprints;
+        this->flippableIterations = other.flippableIterations;
+        this->maxDepth            = other.maxDepth;
+        this->pathConstraints     = other.pathConstraints;
+        this->prefixes            = other.prefixes;
+        this->residentConstraints = other.residentConstraints;
+        this->spill               = other.spill;
+        this->statistics          = other.statistics;
+        this->targets             = other.targets;
       }
 
 
       PathManager& PathManager::operator=(const PathManager& other) {
-        this->astCtxt         = other.astCtxt;
-        this->modes           = other.modes;
-        this->pathConstraints = other.pathConstraints;
+        this->astCtxt             = other.astCtxt;
+        this->chunks              = other.chunks;
+        this->components.clear();
+        this->constraintVariables = other.constraintVariables;
+        this->directs             = other.directs;
+        this->fingerprints        = other.fingerprints;
+        this->flippableIterations = other.flippableIterations;
+        this->maxDepth            = other.maxDepth;
+        this->modes               = other.modes;
+        this->pathConstraints     = other.pathConstraints;
+        this->prefixes            = other.prefixes;
+        this->residentConstraints = other.residentConstraints;
+        this->snapshot.clear();
+        this->spill               = other.spill;
+        this->targets             = other.targets;
         return *this;
       }
 
 
+      void PathManager::setStatistics(triton::arch::ProcessingStatistics* statistics) {
+        this->statistics = statistics;
+      }
+
+
+      void PathManager::setCoverage(triton::arch::Coverage* coverage) {
+        this->coverage = coverage;
+      }
+
+
       triton::usize PathManager::getSizeOfPathConstraints(void) const {
         return this->pathConstraints.size();
       }
 
 
+      const triton::utils::PersistentVector<triton::engines::symbolic::PathConstraint>& PathManager::getPersistentPathConstraints(void) const {
+        return this->pathConstraints;
+      }
+
+
       /* Returns the logical conjunction vector of path constraint */
       const std::vector<triton::engines::symbolic::PathConstraint>& PathManager::getPathConstraints(void) const {
-        return this->pathConstraints;
+        this->restore();
+
+        /* The path constraints copied share their branches */
+        this->snapshot.reserve(this->pathConstraints.size());
+        while (this->snapshot.size() < this->pathConstraints.size())
+          this->snapshot.push_back(this->pathConstraints[this->snapshot.size()]);
+        return this->snapshot;
+      }
+
+
+      triton::engines::symbolic::PathConstraint& PathManager::modifyPathConstraint(triton::usize index) {
+        if (this->snapshot.size() > index)
+          this->snapshot.resize(index);
+        return this->pathConstraints.modify(index);
       }
 
 
@@ -50,6 +295,7 @@ namespace triton {
       std::vector<triton::engines::symbolic::PathConstraint> PathManager::getPathConstraintsOfThread(triton::uint32 threadId) const {
         std::vector<triton::engines::symbolic::PathConstraint> ret;
 
+        this->restore();
         for (auto& pc : this->pathConstraints) {
           if (pc.getThreadId() == threadId) {
             ret.push_back(pc);
@@ -68,16 +314,12 @@ namespace triton {
           return {};
         }
 
-        if (start < pcsize && end > pcsize) {
-          std::vector<triton::engines::symbolic::PathConstraint>::const_iterator first = this->pathConstraints.begin() + start;
-          std::vector<triton::engines::symbolic::PathConstraint>::const_iterator last  = this->pathConstraints.end();
-          return {first, last};
-        }
-
-        if (start < pcsize && end < pcsize && end > start) {
-          std::vector<triton::engines::symbolic::PathConstraint>::const_iterator first = this->pathConstraints.begin() + start;
-          std::vector<triton::engines::symbolic::PathConstraint>::const_iterator last  = this->pathConstraints.begin() + end;
-          return {first, last};
+        if (start < pcsize && end > start) {
+          std::vector<triton::engines::symbolic::PathConstraint> ret;
+          this->restore();
+          for (triton::usize index = start; index < std::min(end, pcsize); index++)
+            ret.push_back(this->pathConstraints[index]);
+          return ret;
         }
 
         throw triton::exceptions::PathManager("PathManager::getPathConstraints(): Invalid items extraction.");
@@ -86,73 +328,412 @@ namespace triton {
 
       /* Returns the current path predicate as an AST of logical conjunction of each taken branch. */
       triton::ast::SharedAbstractNode PathManager::getPathPredicate(void) const {
-        std::vector<triton::engines::symbolic::PathConstraint>::const_iterator it;
+        this->restore();
+        return this->getPrefixPredicate(this->pathConstraints.size());
+      }
+
+
+      /* Returns the current path predicate as one logical conjunction of each taken branch. */
+      triton::ast::SharedAbstractNode PathManager::getFlatPathPredicate(void) const {
+        std::vector<triton::ast::SharedAbstractNode> predicates;
+
+        predicates.reserve(this->pathConstraints.size() + 1);
+        this->restore();
 
         /* by default PC is T (top) */
-        auto node = this->astCtxt->equal(
-                      this->astCtxt->bvtrue(),
-                      this->astCtxt->bvtrue()
-                    );
+        predicates.push_back(this->astCtxt->equal(
+          this->astCtxt->bvtrue(),
+          this->astCtxt->bvtrue()
+        ));
+
+        for (const auto& pc : this->pathConstraints)
+          predicates.push_back(pc.getTakenPredicate());
+
+        /* At least two operands, T is kept even if there is no constraint */
+        if (predicates.size() == 1)
+          return predicates.front();
+
+        return this->astCtxt->land(predicates);
+      }
+
+
+      triton::usize PathManager::findComponent(triton::usize id) const {
+        while (true) {
+          auto it = this->components.find(id);
+          if (it == this->components.end()) {
+            this->components[id] = id;
+            return id;
+          }
 
-        /* Then, we create a conjunction of path constraint */
-        for (it = this->pathConstraints.begin(); it != this->pathConstraints.end(); it++) {
-          node = this->astCtxt->land(node, it->getTakenPredicate());
+          if (it->second == id)
+            return id;
+
+          /* Path halving */
+          it->second = this->components[it->second];
+          id = it->second;
         }
+      }
 
-        return node;
+
+      void PathManager::updateComponents(void) const {
+        /* Constraints were popped, the forest is rebuilt from the variables still recorded */
+        if (this->components.empty()) {
+          for (const auto& vars : this->constraintVariables) {
+            for (const auto& id : vars) {
+              auto root = this->findComponent(vars.front());
+              this->components[this->findComponent(id)] = root;
+            }
+          }
+        }
+
+        /* Variables of the new constraints */
+        for (triton::usize index = this->constraintVariables.size(); index < this->pathConstraints.size(); index++) {
+          std::vector<triton::usize> vars;
+
+          for (const auto& node : triton::ast::search(this->pathConstraints[index].getTakenPredicate(), triton::ast::VARIABLE_NODE))
+            vars.push_back(reinterpret_cast<triton::ast::VariableNode*>(node.get())->getSymbolicVariable()->getId());
+
+          for (const auto& id : vars) {
+            auto root = this->findComponent(vars.front());
+            this->components[this->findComponent(id)] = root;
+          }
+
+          this->constraintVariables.push_back(std::move(vars));
+        }
+      }
+
+
+      triton::ast::SharedAbstractNode PathManager::getRelevantPathPredicate(const triton::ast::SharedAbstractNode& node) const {
+        std::unordered_set<triton::usize> roots;
+
+        if (node == nullptr)
+          throw triton::exceptions::PathManager("PathManager::getRelevantPathPredicate(): The node cannot be null.");
+
+        this->restore();
+        this->updateComponents();
+
+        /* The components of the variables of the node */
+        for (const auto& var : triton::ast::search(node, triton::ast::VARIABLE_NODE))
+          roots.insert(this->findComponent(reinterpret_cast<triton::ast::VariableNode*>(var.get())->getSymbolicVariable()->getId()));
+
+        /* by default PC is T (top) */
+        auto predicate = this->astCtxt->equal(
+                           this->astCtxt->bvtrue(),
+                           this->astCtxt->bvtrue()
+                         );
+
+        /* Then, we create a conjunction of the path constraints of these components */
+        for (triton::usize index = 0; index < this->pathConstraints.size(); index++) {
+          const auto& vars = this->constraintVariables[index];
+          if (!vars.empty() && roots.find(this->findComponent(vars.front())) != roots.end())
+            predicate = this->astCtxt->land(predicate, this->pathConstraints[index].getTakenPredicate());
+        }
+
+        return predicate;
       }
 
 
+      triton::ast::SharedAbstractNode PathManager::getPrefixPredicate(triton::usize index) const {
+        /* by default PC is T (top) */
+        if (this->prefixes.empty()) {
+          this->prefixes.push_back(this->astCtxt->equal(
+            this->astCtxt->bvtrue(),
+            this->astCtxt->bvtrue()
+          ));
+        }
+
+        /* Then, we continue the conjunction up to the path constraint */
+        while (this->prefixes.size() <= index) {
+          auto node = this->astCtxt->land(this->prefixes.back(), this->pathConstraints[this->prefixes.size() - 1].getTakenPredicate());
+          this->prefixes.push_back(node);
+        }
+
+        return this->prefixes[index];
+      }
+
 
       std::vector<triton::ast::SharedAbstractNode> PathManager::getPredicatesToReachAddress(triton::uint64 addr) const {
+        static const triton::utils::PersistentVector<Target> none;
         std::vector<triton::ast::SharedAbstractNode> predicates;
 
-        /* by default PC is T (top) */
-        auto node = this->astCtxt->equal(
-                      this->astCtxt->bvtrue(),
-                      this->astCtxt->bvtrue()
-                    );
-
-        /* Go through all path constraints */
-        for (auto pc = this->pathConstraints.begin(); pc != this->pathConstraints.end(); pc++) {
-          auto branches = pc->getBranchConstraints();
-          bool isMultib = (branches.size() >= 2);
-
-          /* Check if one of the branch constraint may reach the targeted address */
-          for (auto branch = branches.begin(); branch != branches.end(); branch++) {
+        const auto* found = this->targets.find(addr);
+        const auto& hits  = found ? *found : none;
+
+        this->restore();
+
+        /* The branches reaching the address and the direct branches are merged in the order of the path */
+        auto hit    = hits.begin();
+        auto direct = this->directs.begin();
+
+        while (hit != hits.end() || direct != this->directs.end()) {
+          bool isHit = (direct == this->directs.end() || (hit != hits.end() && std::tie(hit->constraint, hit->branch, hit->kind) < std::tie(direct->constraint, direct->branch, direct->kind)));
+          Target target = isHit ? *hit : *direct;
+
+          if (isHit)
+            ++hit;
+          else
+            ++direct;
+
+          const auto& node   = this->getPrefixPredicate(target.constraint);
+          const auto& branch = this->pathConstraints[target.constraint].getBranchConstraints()[target.branch];
+
+          switch (target.kind) {
             /* if source branch == target, add the current path predicate */
-            if (std::get<1>(*branch) == addr) {
+            case 0:
               predicates.push_back(node);
-            }
+              break;
+
             /*
              * if dst branch == target, do the conjunction of the current
              * path predicate and the branch constraint.
              */
-            if (std::get<2>(*branch) == addr) {
-              predicates.push_back(this->astCtxt->land(node, std::get<3>(*branch)));
-            }
+            case 1:
+              predicates.push_back(this->astCtxt->land(node, std::get<3>(branch)));
+              break;
+
             /*
              * if it's a direct branch (call reg, jmp reg) and not a standalone
              * constraint. Try to reach the targeted address.
              */
-            if (isMultib == false && std::get<1>(*branch) != 0 && std::get<2>(*branch) != 0) {
-              if (std::get<3>(*branch)->getType() == triton::ast::EQUAL_NODE) {
-                auto ip = std::get<3>(*branch)->getChildren()[0];
-                predicates.push_back(this->astCtxt->land(node, this->astCtxt->equal(ip, this->astCtxt->bv(addr, ip->getBitvectorSize()))));
-              }
+            default: {
+              auto ip = std::get<3>(branch)->getChildren()[0];
+              predicates.push_back(this->astCtxt->land(node, this->astCtxt->equal(ip, this->astCtxt->bv(addr, ip->getBitvectorSize()))));
+              break;
             }
-          } /* branch constraints */
-
-          /* Continue to create the conjunction of the current path predicate */
-          node = this->astCtxt->land(node, pc->getTakenPredicate());
-        } /* path constraint */
+          }
+        }
 
         return predicates;
       }
 
 
+      void PathManager::indexLastPathConstraint(void) {
+        triton::usize index = this->pathConstraints.size() - 1;
+        const auto& branches = this->pathConstraints[index].getBranchConstraints();
+        bool isMultib = (branches.size() >= 2);
+
+        for (triton::usize b = 0; b < branches.size(); b++) {
+          const auto& branch = branches[b];
+
+          this->targets.modify(std::get<1>(branch)).push_back({index, b, 0});
+          this->targets.modify(std::get<2>(branch)).push_back({index, b, 1});
+
+          if (isMultib == false && std::get<1>(branch) != 0 && std::get<2>(branch) != 0 && std::get<3>(branch)->getType() == triton::ast::EQUAL_NODE)
+            this->directs.push_back({index, b, 2});
+        }
+      }
+
+
+      void PathManager::recordPathConstraint(const triton::engines::symbolic::PathConstraint& pco) {
+        /* A duplicate adds nothing to the path predicate, it is counted */
+        if (this->modes->isModeEnabled(triton::modes::PC_DEDUPLICATION)) {
+          const auto* index = this->fingerprints.find(fingerprintOf(pco));
+          if (index != nullptr) {
+            auto& pc = this->modifyPathConstraint(*index);
+            pc.setCount(pc.getCount() + pco.getCount());
+            return;
+          }
+        }
+
+        if (this->modes->isModeEnabled(triton::modes::PC_LOOP_SUMMARIZATION) && this->summarizeIteration(pco))
+          return;
+
+        this->pushPathConstraint(pco);
+      }
+
+
+      bool PathManager::summarizeIteration(const triton::engines::symbolic::PathConstraint& pco) {
+        triton::usize size = this->pathConstraints.size();
+        triton::usize kept = this->flippableIterations;
+
+        if (size < kept + 1)
+          return false;
+
+        /* The most recent iterations, and before them the summary of the older ones (or the first iteration) */
+        triton::usize summary = size - kept - 1;
+        if (summary < this->getSpilledEnd())
+          this->restore();
+
+        for (triton::usize index = summary; index < size; index++) {
+          const auto& pc = this->pathConstraints[index];
+          if (!isSameIteration(pc, pco) || (index != summary && !pc.getIterations().empty()))
+            return false;
+        }
+
+        std::vector<triton::engines::symbolic::PathConstraint> recent;
+        for (triton::usize index = size - kept; index < size; index++)
+          recent.push_back(this->pathConstraints[index]);
+        for (triton::usize index = 0; index < kept; index++)
+          this->popPathConstraint();
+
+        /* The oldest recent iteration is summarized, in place since the summary is now the last constraint */
+        auto& pc = this->modifyPathConstraint(summary);
+        const auto* fingerprint = this->fingerprints.find(fingerprintOf(pc));
+        if (fingerprint != nullptr && *fingerprint == summary)
+          this->fingerprints.erase(fingerprintOf(pc));
+
+        /* The comparisons of an induction variable to a loop invariant are summarized in closed form */
+        triton::ast::SharedAbstractNode taken = nullptr;
+        if (this->modes->isModeEnabled(triton::modes::LOOP_INDUCTION_VARIABLES))
+          taken = this->summarizeInduction(pc, recent.front().getTakenPredicate());
+        if (taken == nullptr)
+          taken = this->astCtxt->land(pc.getTakenPredicate(), recent.front().getTakenPredicate());
+
+        pc.addIteration(recent.front().getTakenPredicate(), recent.front().getCount(), taken, this->astCtxt->lnot(taken));
+
+        /* Its branches are unchanged, only what depends on its predicates is dropped */
+        if (this->prefixes.size() > summary + 1)
+          this->prefixes.truncate(summary + 1);
+
+        if (this->constraintVariables.size() > summary) {
+          this->constraintVariables.truncate(summary);
+          this->components.clear();
+        }
+
+        for (triton::usize index = 1; index < kept; index++)
+          this->pushPathConstraint(recent[index]);
+        this->pushPathConstraint(pco);
+
+        return true;
+      }
+
+
+      triton::ast::SharedAbstractNode PathManager::summarizeInduction(const triton::engines::symbolic::PathConstraint& pc, const triton::ast::SharedAbstractNode& next) const {
+        const auto& iterations = pc.getIterations();
+        InductionComparison first, last, current;
+
+        /* The iterations already summarized, the first and the last one of them */
+        triton::usize count = iterations.empty() ? 1 : iterations.size();
+        const auto& firstPredicate = iterations.empty() ? pc.getTakenPredicate() : iterations.front();
+        const auto& lastPredicate  = iterations.empty() ? pc.getTakenPredicate() : iterations.back();
+
+        if (!getInductionComparison(firstPredicate, first) || !getInductionComparison(lastPredicate, last) || !getInductionComparison(next, current))
+          return nullptr;
+
+        if (first.kind != current.kind || last.kind != current.kind)
+          return nullptr;
+
+        /* One operand is the loop invariant, the other one the induction variable */
+        triton::usize side = 2;
+        for (triton::usize index = 0; index < 2; index++) {
+          triton::usize other = 1 - index;
+          if (isSameRoot(first.roots[index], current.roots[index]) && isSameRoot(last.roots[index], current.roots[index]) &&
+              isSameRoot(first.roots[other], current.roots[other]) && isSameRoot(last.roots[other], current.roots[other]) &&
+              first.offsets[other] == current.offsets[other] && last.offsets[other] == current.offsets[other] &&
+              last.offsets[index] != current.offsets[index])
+            side = index;
+        }
+
+        if (side == 2)
+          return nullptr;
+
+        /* The induction variable steps by the same constant at each iteration, without wrapping around */
+        triton::uint32 size  = current.operands[side]->getBitvectorSize();
+        triton::uint512 mask = current.operands[side]->getBitvectorMask();
+        triton::uint512 step = (current.offsets[side] + mask + 1 - last.offsets[side]) & mask;
+        if (((last.offsets[side] + mask + 1 - first.offsets[side]) & mask) != ((step * (count - 1)) & mask))
+          return nullptr;
+
+        bool increasing = (step >> (size - 1)) == 0;
+        triton::uint512 magnitude = increasing ? step : (mask + 1 - step);
+        if (magnitude * count > mask)
+          return nullptr;
+
+        /* The predicates are built with the induction variable as first operand */
+        triton::ast::ast_e kind = current.kind;
+        if (side == 1) {
+          switch (kind) {
+            case triton::ast::BVSGE_NODE: kind = triton::ast::BVSLE_NODE; break;
+            case triton::ast::BVSGT_NODE: kind = triton::ast::BVSLT_NODE; break;
+            case triton::ast::BVSLE_NODE: kind = triton::ast::BVSGE_NODE; break;
+            case triton::ast::BVSLT_NODE: kind = triton::ast::BVSGT_NODE; break;
+            case triton::ast::BVUGE_NODE: kind = triton::ast::BVULE_NODE; break;
+            case triton::ast::BVUGT_NODE: kind = triton::ast::BVULT_NODE; break;
+            case triton::ast::BVULE_NODE: kind = triton::ast::BVUGE_NODE; break;
+            default:                      kind = triton::ast::BVUGT_NODE; break;
+          }
+        }
+
+        bool isSigned = (kind == triton::ast::BVSGE_NODE || kind == triton::ast::BVSGT_NODE || kind == triton::ast::BVSLE_NODE || kind == triton::ast::BVSLT_NODE);
+        bool isUpper  = (kind == triton::ast::BVSLE_NODE || kind == triton::ast::BVSLT_NODE || kind == triton::ast::BVULE_NODE || kind == triton::ast::BVULT_NODE);
+
+        /*
+         * The values of the induction variable are between the first and the current one if it does not wrap
+         * around, and the comparison to a bound holds for all of them if it holds for the extreme one: the
+         * greatest against an upper bound, the least against a lower bound.
+         */
+        const auto& x1 = first.operands[side];
+        const auto& x2 = current.operands[side];
+        triton::ast::SharedAbstractNode guard = nullptr;
+        if (isSigned)
+          guard = increasing ? this->astCtxt->bvsle(x1, x2) : this->astCtxt->bvsge(x1, x2);
+        else
+          guard = increasing ? this->astCtxt->bvule(x1, x2) : this->astCtxt->bvuge(x1, x2);
+
+        const auto& extreme = (isUpper == increasing) ? next : firstPredicate;
+        triton::ast::SharedAbstractNode summary = guard->isSymbolized() ? this->astCtxt->land(guard, extreme) : extreme;
+        if (!guard->isSymbolized() && guard->evaluate() == 0)
+          return nullptr;
+
+        /* The summary so far must be the closed form of its iterations, it does not hold the conjunction of others */
+        if (count > 1) {
+          const auto& previous = (isUpper == increasing) ? lastPredicate : firstPredicate;
+          triton::ast::SharedAbstractNode expected = previous;
+          if (guard->isSymbolized()) {
+            triton::ast::SharedAbstractNode g = nullptr;
+            const auto& y = last.operands[side];
+            if (isSigned)
+              g = increasing ? this->astCtxt->bvsle(x1, y) : this->astCtxt->bvsge(x1, y);
+            else
+              g = increasing ? this->astCtxt->bvule(x1, y) : this->astCtxt->bvuge(x1, y);
+            expected = this->astCtxt->land(g, previous);
+          }
+          if (expected != pc.getTakenPredicate() && expected->getHash() != pc.getTakenPredicate()->getHash())
+            return nullptr;
+        }
+
+        return summary;
+      }
+
+
+      triton::usize PathManager::getFlippableIterations(void) const {
+        return this->flippableIterations;
+      }
+
+
+      void PathManager::setFlippableIterations(triton::usize count) {
+        if (count == 0)
+          throw triton::exceptions::PathManager("PathManager::setFlippableIterations(): At least one iteration must be flippable.");
+        this->flippableIterations = count;
+      }
+
+
+      triton::ast::SharedAbstractNode PathManager::getPredicateToFlipIteration(triton::usize index, triton::usize iteration) const {
+        if (index >= this->pathConstraints.size())
+          throw triton::exceptions::PathManager("PathManager::getPredicateToFlipIteration(): Invalid index.");
+
+        this->restore();
+        const auto& pc = this->pathConstraints[index];
+        const auto& iterations = pc.getIterations();
+
+        if (iteration >= std::max<triton::usize>(iterations.size(), 1))
+          throw triton::exceptions::PathManager("PathManager::getPredicateToFlipIteration(): Invalid iteration.");
+
+        if (iterations.empty())
+          return this->astCtxt->land(this->getPrefixPredicate(index), this->astCtxt->lnot(pc.getTakenPredicate()));
+
+        /* The iterations before it are taken */
+        auto node = this->getPrefixPredicate(index);
+        for (triton::usize i = 0; i < iteration; i++)
+          node = this->astCtxt->land(node, iterations[i]);
+
+        return this->astCtxt->land(node, this->astCtxt->lnot(iterations[iteration]));
+      }
+
+
       /* Pushs constraints of a branch instruction to the path predicate. */
       void PathManager::pushPathConstraint(const triton::arch::Instruction& inst, const triton::engines::symbolic::SharedSymbolicExpression& expr) {
+        triton::arch::PhaseTimer timer(this->statistics, triton::arch::PHASE_PATH_CONSTRAINT);
         triton::engines::symbolic::PathConstraint pco;
         triton::uint64 srcAddr = 0;
         triton::uint64 dstAddr = 0;
@@ -170,6 +751,14 @@ namespace triton {
         if (this->modes->isModeEnabled(triton::modes::ONLY_ON_TAINTED) && !expr->isTainted)
           return;
 
+        /* If AST_ABSTRACT_DOMAIN is enabled, Triton will skip branches whose target can only be one address. */
+        if (this->modes->isModeEnabled(triton::modes::AST_ABSTRACT_DOMAIN) && pc->isSymbolized() && pc->getDomain().isConstant())
+          return;
+
+        /* Branches deeper than the budget are not recorded, they would not be solved anyway */
+        if (this->maxDepth && pc->getLevel() > this->maxDepth)
+          return;
+
         /* Basic block taken */
         srcAddr = inst.getAddress();
         dstAddr = pc->evaluate().convert_to<triton::uint64>();
@@ -213,7 +802,7 @@ namespace triton {
             bb2pc           /* expr which must be true to take the branch */
           );
 
-          this->pathConstraints.push_back(pco);
+          this->recordPathConstraint(pco);
         }
 
         /* Direct branch */
@@ -225,13 +814,20 @@ namespace triton {
             /* expr which must be true to take the branch */
             this->astCtxt->equal(pc, this->astCtxt->bv(dstAddr, size))
           );
-          this->pathConstraints.push_back(pco);
+          this->recordPathConstraint(pco);
+        }
+
+        /* The branches of an instruction, the deduplicated and summarized ones included */
+        if (this->coverage != nullptr && this->coverage->isEnabled()) {
+          for (const auto& branch : pco.getBranchConstraints())
+            this->coverage->recordBranch(std::get<0>(branch), std::get<1>(branch), std::get<2>(branch));
         }
       }
 
 
       /* Pushes constraint created from node to the current path predicate. */
       void PathManager::pushPathConstraint(const triton::ast::SharedAbstractNode& node) {
+        triton::arch::PhaseTimer timer(this->statistics, triton::arch::PHASE_PATH_CONSTRAINT);
         triton::engines::symbolic::PathConstraint pco;
 
         if (node->isLogical() == false)
@@ -241,6 +837,10 @@ namespace triton {
         if (this->modes->isModeEnabled(triton::modes::PC_TRACKING_SYMBOLIC) && !node->isSymbolized())
           return;
 
+        /* If AST_ABSTRACT_DOMAIN is enabled, Triton will skip constraints which always hold. */
+        if (this->modes->isModeEnabled(triton::modes::AST_ABSTRACT_DOMAIN) && node->isSymbolized() && !node->getDomain().contains(0))
+          return;
+
         pco.addBranchConstraint(
           true, /* always taken   */
           0,    /* from: not used */
@@ -248,26 +848,205 @@ namespace triton {
           node  /* expr which must be true to take the branch */
         );
 
-        this->pathConstraints.push_back(pco);
+        this->recordPathConstraint(pco);
       }
 
 
       /* Pushes constraint to the current path predicate. */
       void PathManager::pushPathConstraint(const triton::engines::symbolic::PathConstraint& pco) {
+        triton::arch::PhaseTimer timer(this->statistics, triton::arch::PHASE_PATH_CONSTRAINT);
         this->pathConstraints.push_back(pco);
+        this->indexLastPathConstraint();
+
+        if (this->modes->isModeEnabled(triton::modes::PC_DEDUPLICATION) && !this->fingerprints.contains(fingerprintOf(pco)))
+          this->fingerprints.set(fingerprintOf(pco), this->pathConstraints.size() - 1);
+
+        if (this->spill != nullptr)
+          this->spillColdConstraints();
       }
 
 
       /* Pops the last constraints added to the path predicate. */
       void PathManager::popPathConstraint(void) {
-        if (this->pathConstraints.size())
-          this->pathConstraints.pop_back();
+        if (this->pathConstraints.empty())
+          return;
+
+        /* The entries of the last path constraint are the last ones of their lists */
+        triton::usize index = this->pathConstraints.size() - 1;
+
+        /* The chunks reaching it are faulted in and forgotten, it is spilled again with the next ones */
+        while (!this->chunks.empty() && this->chunks.back().first + this->chunks.back().count > index) {
+          this->fault(this->chunks.back());
+          this->chunks.pop_back();
+        }
+
+        const auto& branches = this->pathConstraints.back().getBranchConstraints();
+
+        for (auto branch = branches.rbegin(); branch != branches.rend(); branch++) {
+          for (auto addr : {std::get<2>(*branch), std::get<1>(*branch)}) {
+            auto& list = this->targets.modify(addr);
+            list.pop_back();
+            if (list.empty())
+              this->targets.erase(addr);
+          }
+        }
+
+        while (!this->directs.empty() && this->directs.back().constraint == index)
+          this->directs.pop_back();
+
+        if (!this->fingerprints.empty()) {
+          auto fingerprint = fingerprintOf(this->pathConstraints.back());
+          const auto* recorded = this->fingerprints.find(fingerprint);
+          if (recorded != nullptr && *recorded == index)
+            this->fingerprints.erase(fingerprint);
+        }
+
+        /* The variables of the constraint are forgotten, the components are rebuilt when asked */
+        if (this->constraintVariables.size() > index) {
+          this->constraintVariables.truncate(index);
+          this->components.clear();
+        }
+
+        /* The conjunctions up to the last path constraint are still valid */
+        if (this->prefixes.size() > index + 1)
+          this->prefixes.truncate(index + 1);
+
+        if (this->snapshot.size() > index)
+          this->snapshot.resize(index);
+
+        this->pathConstraints.pop_back();
       }
 
 
       /* Clears the current path predicate. */
       void PathManager::clearPathConstraints(void) {
+        this->chunks.clear();
+        this->components.clear();
+        this->constraintVariables.clear();
+        this->directs.clear();
+        this->fingerprints.clear();
         this->pathConstraints.clear();
+        this->prefixes.clear();
+        this->snapshot.clear();
+        this->targets.clear();
+      }
+
+
+      triton::usize PathManager::getSpilledEnd(void) const {
+        if (this->chunks.empty())
+          return 0;
+        return this->chunks.back().first + this->chunks.back().count;
+      }
+
+
+      void PathManager::spillColdConstraints(void) {
+        /* The iterations read by the loop summarization stay in memory */
+        triton::usize count = std::max(this->residentConstraints, this->flippableIterations + 1);
+        triton::usize first = this->getSpilledEnd();
+
+        if (this->pathConstraints.size() - first < 2 * count)
+          return;
+
+        std::vector<triton::ast::SharedAbstractNode> roots;
+        for (triton::usize index = first; index < first + count; index++) {
+          auto predicates = this->pathConstraints[index].getPredicates();
+          roots.insert(roots.end(), predicates.begin(), predicates.end());
+        }
+
+        std::ostringstream stream;
+        triton::ast::AstSerializer(this->astCtxt).serialize(stream, roots);
+        std::string record = stream.str();
+
+        SpilledChunk chunk;
+        chunk.first    = first;
+        chunk.count    = count;
+        chunk.offset   = this->spill->append(record);
+        chunk.size     = record.size();
+        chunk.resident = true;
+        this->chunks.push_back(chunk);
+
+        /* The chunks faulted in since the last spill are released with the new one */
+        for (auto& spilled : this->chunks) {
+          if (spilled.resident)
+            this->evict(spilled);
+        }
+      }
+
+
+      void PathManager::evict(SpilledChunk& chunk) const {
+        for (triton::usize index = chunk.first; index < chunk.first + chunk.count; index++) {
+          auto pc = this->pathConstraints[index];
+          pc.setPredicates(std::vector<triton::ast::SharedAbstractNode>(pc.getPredicates().size(), nullptr));
+          this->pathConstraints.modify(index) = pc;
+        }
+
+        /* The conjunctions and the copies holding its predicates are dropped */
+        if (this->prefixes.size() > chunk.first + 1)
+          this->prefixes.truncate(chunk.first + 1);
+
+        if (this->snapshot.size() > chunk.first)
+          this->snapshot.resize(chunk.first);
+
+        chunk.resident = false;
+      }
+
+
+      void PathManager::fault(SpilledChunk& chunk) const {
+        if (chunk.resident)
+          return;
+
+        auto file  = this->spill->read(chunk.offset, chunk.size);
+        auto roots = triton::ast::AstSerializer(this->astCtxt).deserialize(file->getData(), file->getSize());
+        auto root  = roots.begin();
+
+        for (triton::usize index = chunk.first; index < chunk.first + chunk.count; index++) {
+          auto pc = this->pathConstraints[index];
+          triton::usize count = pc.getPredicates().size();
+
+          if (static_cast<triton::usize>(roots.end() - root) < count)
+            throw triton::exceptions::PathManager("PathManager::fault(): The spill file is corrupted.");
+
+          pc.setPredicates(std::vector<triton::ast::SharedAbstractNode>(root, root + count));
+          this->pathConstraints.modify(index) = pc;
+          root += count;
+        }
+
+        chunk.resident = true;
+      }
+
+
+      void PathManager::restore(void) const {
+        for (auto& chunk : this->chunks)
+          this->fault(chunk);
+      }
+
+
+      void PathManager::setSpilling(const std::string& path, triton::usize resident) {
+        if (!path.empty() && resident == 0)
+          throw triton::exceptions::PathManager("PathManager::setSpilling(): At least one path constraint must be resident.");
+
+        /* The path constraints spilled are faulted in before the file changes */
+        this->restore();
+        this->chunks.clear();
+        this->residentConstraints = resident;
+
+        /* The file is kept if it does not change, the copies may still read it */
+        if (path.empty())
+          this->spill = nullptr;
+        else if (this->spill == nullptr || this->spill->getPath() != path)
+          this->spill = std::make_shared<triton::engines::symbolic::SpillFile>(path);
+      }
+
+
+      triton::usize PathManager::getNumberOfSpilledPathConstraints(void) const {
+        triton::usize count = 0;
+
+        for (const auto& chunk : this->chunks) {
+          if (!chunk.resident)
+            count += chunk.count;
+        }
+
+        return count;
       }
 
     }; /* symbolic namespace */
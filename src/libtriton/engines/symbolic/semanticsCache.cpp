@@ -0,0 +1,442 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <cstring>
+#include <utility>
+
+#include <triton/exceptions.hpp>
+#include <triton/semanticsCache.hpp>
+#include <triton/symbolicEngine.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace symbolic {
+
+      SemanticsCache::SemanticsCache() {
+        this->inst    = nullptr;
+        this->failed  = false;
+        this->pending = -1;
+      }
+
+
+      void SemanticsCache::record(const triton::arch::Instruction& inst, triton::arch::architecture_e arch) {
+        this->abort();
+
+        this->inst         = &inst;
+        this->current.arch = arch;
+        this->current.bytes.assign(inst.getOpcode(), inst.getOpcode() + inst.getSize());
+
+        /* The effective addresses of the memory operands are read by the semantics of lea */
+        for (triton::uint32 index = 0; index < inst.operands.size(); index++) {
+          const triton::arch::OperandWrapper& operand = inst.operands[index];
+          if (operand.getType() == triton::arch::OP_MEM && operand.getConstMemory().getLeaAst() != nullptr) {
+            Event event;
+            event.kind    = READ_LEA;
+            event.operand = index;
+            this->addRead(event, operand.getConstMemory().getLeaAst());
+          }
+        }
+      }
+
+
+      void SemanticsCache::commit(triton::arch::Instruction& inst) {
+        if (this->inst != &inst) {
+          this->abort();
+          return;
+        }
+
+        this->resolve();
+
+        if (!this->failed) {
+          for (const auto& reg : inst.getUndefinedRegisters())
+            this->current.undefined.push_back(reg);
+
+          if (this->templates.size() >= capacity)
+            this->templates.clear();
+
+          this->templates[inst.getAddress()] = std::move(this->current);
+        }
+
+        this->abort();
+      }
+
+
+      void SemanticsCache::abort(void) {
+        this->current     = Template();
+        this->inst        = nullptr;
+        this->failed      = false;
+        this->pending     = -1;
+        this->nodes.clear();
+        this->expressions.clear();
+      }
+
+
+      bool SemanticsCache::isRecording(void) const {
+        return this->inst != nullptr;
+      }
+
+
+      void SemanticsCache::resolve(void) {
+        if (this->pending < 0)
+          return;
+
+        /* The symbolic engine returns the last expression added to the instruction */
+        if (this->inst->symbolicExpressions.empty())
+          this->failed = true;
+        else
+          this->expressions[this->inst->symbolicExpressions.back().get()] = static_cast<triton::uint32>(this->pending);
+
+        this->pending = -1;
+      }
+
+
+      triton::uint32 SemanticsCache::findOperand(const triton::arch::MemoryAccess& mem) {
+        for (triton::uint32 index = 0; index < this->inst->operands.size(); index++) {
+          const triton::arch::OperandWrapper& operand = this->inst->operands[index];
+          if (operand.getType() == triton::arch::OP_MEM && &operand.getConstMemory() == &mem)
+            return index;
+        }
+
+        /* The memory is not an operand of the instruction, it cannot be found again on replay */
+        this->failed = true;
+        return 0;
+      }
+
+
+      void SemanticsCache::addRead(Event& event, const triton::ast::SharedAbstractNode& node) {
+        Op op;
+        op.type  = triton::ast::INVALID_NODE;
+        op.imm1  = 0;
+        op.imm2  = 0;
+        op.size  = 0;
+        op.event = static_cast<triton::uint32>(this->current.events.size());
+
+        event.node = static_cast<triton::uint32>(this->current.ops.size());
+        this->nodes[node] = event.node;
+        this->current.ops.push_back(op);
+        this->current.events.push_back(event);
+      }
+
+
+      void SemanticsCache::addWrite(Event& event, const triton::ast::SharedAbstractNode& node) {
+        this->resolve();
+        if (this->failed)
+          return;
+
+        event.node = this->compile(node);
+        if (this->failed)
+          return;
+
+        this->pending = static_cast<triton::sint64>(this->current.events.size());
+        this->current.events.push_back(event);
+      }
+
+
+      triton::uint32 SemanticsCache::compile(const triton::ast::SharedAbstractNode& root) {
+        std::vector<std::pair<triton::ast::SharedAbstractNode, bool>> worklist;
+
+        worklist.push_back({root, false});
+        while (!worklist.empty() && !this->failed) {
+          triton::ast::SharedAbstractNode node = worklist.back().first;
+          bool postOrder                       = worklist.back().second;
+          worklist.pop_back();
+
+          if (this->nodes.find(node) != this->nodes.end())
+            continue;
+
+          Op op;
+          op.type  = node->getType();
+          op.imm1  = 0;
+          op.imm2  = 0;
+          op.size  = 0;
+          op.event = 0;
+
+          if (op.type == triton::ast::REFERENCE_NODE) {
+            /* Only the expressions created by the semantics itself are known on replay */
+            auto it = this->expressions.find(reinterpret_cast<triton::ast::ReferenceNode*>(node.get())->getSymbolicExpression().get());
+            if (it == this->expressions.end()) {
+              this->failed = true;
+              break;
+            }
+            op.event = it->second;
+          }
+
+          else if (op.type == triton::ast::BV_NODE) {
+            op.size  = node->getBitvectorSize();
+            op.value = node->evaluate();
+          }
+
+          else if (!postOrder) {
+            worklist.push_back({node, true});
+            for (const auto& child : node->getChildren()) {
+              if (child->getType() != triton::ast::INTEGER_NODE)
+                worklist.push_back({child, false});
+            }
+            continue;
+          }
+
+          else {
+            const auto& children = node->getChildren();
+            switch (op.type) {
+              case triton::ast::EXTRACT_NODE:
+                op.imm1 = reinterpret_cast<triton::ast::IntegerNode*>(children[0].get())->getInteger().convert_to<triton::uint32>();
+                op.imm2 = reinterpret_cast<triton::ast::IntegerNode*>(children[1].get())->getInteger().convert_to<triton::uint32>();
+                break;
+
+              case triton::ast::SX_NODE:
+              case triton::ast::ZX_NODE:
+                op.imm1 = reinterpret_cast<triton::ast::IntegerNode*>(children[0].get())->getInteger().convert_to<triton::uint32>();
+                break;
+
+              case triton::ast::BVROL_NODE:
+              case triton::ast::BVROR_NODE:
+                op.imm1 = reinterpret_cast<triton::ast::IntegerNode*>(children[1].get())->getInteger().convert_to<triton::uint32>();
+                break;
+
+              case triton::ast::BVLANEADD_NODE:
+              case triton::ast::BVLANEEQ_NODE:
+              case triton::ast::BVLANESELECT_NODE:
+              case triton::ast::BVLANESGT_NODE:
+              case triton::ast::BVLANESUB_NODE:
+                op.imm1 = reinterpret_cast<triton::ast::IntegerNode*>(children.back().get())->getInteger().convert_to<triton::uint32>();
+                break;
+
+              case triton::ast::BSWAP_NODE:      case triton::ast::BVADD_NODE:      case triton::ast::BVAND_NODE:
+              case triton::ast::BVASHR_NODE:     case triton::ast::BVLSHR_NODE:     case triton::ast::BVMUL_NODE:
+              case triton::ast::BVNAND_NODE:     case triton::ast::BVNEG_NODE:      case triton::ast::BVNOR_NODE:
+              case triton::ast::BVNOT_NODE:      case triton::ast::BVOR_NODE:       case triton::ast::BVPARITY_NODE:
+              case triton::ast::BVPOPCOUNT_NODE: case triton::ast::BVSDIV_NODE:     case triton::ast::BVSGE_NODE:
+              case triton::ast::BVSGT_NODE:      case triton::ast::BVSHL_NODE:      case triton::ast::BVSLE_NODE:
+              case triton::ast::BVSLT_NODE:      case triton::ast::BVSMOD_NODE:     case triton::ast::BVSREM_NODE:
+              case triton::ast::BVSUB_NODE:      case triton::ast::BVUDIV_NODE:     case triton::ast::BVUGE_NODE:
+              case triton::ast::BVUGT_NODE:      case triton::ast::BVULE_NODE:      case triton::ast::BVULT_NODE:
+              case triton::ast::BVUREM_NODE:     case triton::ast::BVXNOR_NODE:     case triton::ast::BVXOR_NODE:
+              case triton::ast::CONCAT_NODE:     case triton::ast::DISTINCT_NODE:   case triton::ast::EQUAL_NODE:
+              case triton::ast::IFF_NODE:        case triton::ast::ITE_NODE:        case triton::ast::LAND_NODE:
+              case triton::ast::LNOT_NODE:       case triton::ast::LOR_NODE:        case triton::ast::LXOR_NODE:
+                break;
+
+              /* Variables and the other nodes are not rebuilt */
+              default:
+                this->failed = true;
+                continue;
+            }
+
+            for (const auto& child : children) {
+              if (child->getType() != triton::ast::INTEGER_NODE)
+                op.children.push_back(this->nodes.at(child));
+            }
+          }
+
+          this->nodes[node] = static_cast<triton::uint32>(this->current.ops.size());
+          this->current.ops.push_back(std::move(op));
+        }
+
+        if (this->failed)
+          return 0;
+
+        return this->nodes.at(root);
+      }
+
+
+      void SemanticsCache::readImmediate(const triton::arch::Immediate& imm, const triton::ast::SharedAbstractNode& node) {
+        Event event;
+        event.kind = READ_IMMEDIATE;
+        event.imm  = imm;
+        this->resolve();
+        this->addRead(event, node);
+      }
+
+
+      void SemanticsCache::readMemory(const triton::arch::MemoryAccess& mem, const triton::ast::SharedAbstractNode& node) {
+        Event event;
+        event.kind    = READ_MEMORY;
+        event.operand = this->findOperand(mem);
+        this->resolve();
+        this->addRead(event, node);
+      }
+
+
+      void SemanticsCache::readRegister(const triton::arch::Register& reg, const triton::ast::SharedAbstractNode& node) {
+        Event event;
+        event.kind = READ_REGISTER;
+        event.reg  = reg;
+        this->resolve();
+        this->addRead(event, node);
+      }
+
+
+      void SemanticsCache::writeMemory(const triton::arch::MemoryAccess& mem, const triton::ast::SharedAbstractNode& node, const std::string& comment) {
+        Event event;
+        event.kind    = WRITE_MEMORY;
+        event.operand = this->findOperand(mem);
+        event.comment = comment;
+        this->addWrite(event, node);
+      }
+
+
+      void SemanticsCache::writeRegister(const triton::arch::Register& reg, const triton::ast::SharedAbstractNode& node, const std::string& comment) {
+        Event event;
+        event.kind    = WRITE_REGISTER;
+        event.reg     = reg;
+        event.comment = comment;
+        this->addWrite(event, node);
+      }
+
+
+      void SemanticsCache::writeVolatile(const triton::ast::SharedAbstractNode& node, const std::string& comment) {
+        Event event;
+        event.kind    = WRITE_VOLATILE;
+        event.comment = comment;
+        this->addWrite(event, node);
+      }
+
+
+      triton::ast::SharedAbstractNode SemanticsCache::build(const triton::ast::SharedAstContext& astCtxt, const Op& op, const std::vector<triton::ast::SharedAbstractNode>& built, const std::vector<SharedSymbolicExpression>& exprs) const {
+        std::vector<triton::ast::SharedAbstractNode> children;
+
+        children.reserve(op.children.size());
+        for (triton::uint32 child : op.children)
+          children.push_back(built[child]);
+
+        switch (op.type) {
+          case triton::ast::BV_NODE:        return astCtxt->bv(op.value, op.size);
+          case triton::ast::REFERENCE_NODE: return astCtxt->reference(exprs[op.event]);
+          case triton::ast::BSWAP_NODE:     return astCtxt->bswap(children[0]);
+          case triton::ast::BVADD_NODE:     return astCtxt->bvadd(children);
+          case triton::ast::BVAND_NODE:     return astCtxt->bvand(children);
+          case triton::ast::BVASHR_NODE:    return astCtxt->bvashr(children[0], children[1]);
+          case triton::ast::BVLANEADD_NODE: return astCtxt->bvlaneadd(children[0], children[1], op.imm1);
+          case triton::ast::BVLANEEQ_NODE:  return astCtxt->bvlaneeq(children[0], children[1], op.imm1);
+          case triton::ast::BVLANESELECT_NODE: return astCtxt->bvlaneselect(children[0], children[1], children[2], op.imm1);
+          case triton::ast::BVLANESGT_NODE: return astCtxt->bvlanesgt(children[0], children[1], op.imm1);
+          case triton::ast::BVLANESUB_NODE: return astCtxt->bvlanesub(children[0], children[1], op.imm1);
+          case triton::ast::BVLSHR_NODE:    return astCtxt->bvlshr(children[0], children[1]);
+          case triton::ast::BVMUL_NODE:     return astCtxt->bvmul(children[0], children[1]);
+          case triton::ast::BVNAND_NODE:    return astCtxt->bvnand(children[0], children[1]);
+          case triton::ast::BVNEG_NODE:     return astCtxt->bvneg(children[0]);
+          case triton::ast::BVNOR_NODE:     return astCtxt->bvnor(children[0], children[1]);
+          case triton::ast::BVNOT_NODE:     return astCtxt->bvnot(children[0]);
+          case triton::ast::BVOR_NODE:      return astCtxt->bvor(children);
+          case triton::ast::BVPARITY_NODE:  return astCtxt->bvparity(children[0]);
+          case triton::ast::BVPOPCOUNT_NODE: return astCtxt->bvpopcount(children[0]);
+          case triton::ast::BVROL_NODE:     return astCtxt->bvrol(children[0], op.imm1);
+          case triton::ast::BVROR_NODE:     return astCtxt->bvror(children[0], op.imm1);
+          case triton::ast::BVSDIV_NODE:    return astCtxt->bvsdiv(children[0], children[1]);
+          case triton::ast::BVSGE_NODE:     return astCtxt->bvsge(children[0], children[1]);
+          case triton::ast::BVSGT_NODE:     return astCtxt->bvsgt(children[0], children[1]);
+          case triton::ast::BVSHL_NODE:     return astCtxt->bvshl(children[0], children[1]);
+          case triton::ast::BVSLE_NODE:     return astCtxt->bvsle(children[0], children[1]);
+          case triton::ast::BVSLT_NODE:     return astCtxt->bvslt(children[0], children[1]);
+          case triton::ast::BVSMOD_NODE:    return astCtxt->bvsmod(children[0], children[1]);
+          case triton::ast::BVSREM_NODE:    return astCtxt->bvsrem(children[0], children[1]);
+          case triton::ast::BVSUB_NODE:     return astCtxt->bvsub(children[0], children[1]);
+          case triton::ast::BVUDIV_NODE:    return astCtxt->bvudiv(children[0], children[1]);
+          case triton::ast::BVUGE_NODE:     return astCtxt->bvuge(children[0], children[1]);
+          case triton::ast::BVUGT_NODE:     return astCtxt->bvugt(children[0], children[1]);
+          case triton::ast::BVULE_NODE:     return astCtxt->bvule(children[0], children[1]);
+          case triton::ast::BVULT_NODE:     return astCtxt->bvult(children[0], children[1]);
+          case triton::ast::BVUREM_NODE:    return astCtxt->bvurem(children[0], children[1]);
+          case triton::ast::BVXNOR_NODE:    return astCtxt->bvxnor(children[0], children[1]);
+          case triton::ast::BVXOR_NODE:     return astCtxt->bvxor(children);
+          case triton::ast::CONCAT_NODE:    return astCtxt->concat(children);
+          case triton::ast::DISTINCT_NODE:  return astCtxt->distinct(children[0], children[1]);
+          case triton::ast::EQUAL_NODE:     return astCtxt->equal(children[0], children[1]);
+          case triton::ast::EXTRACT_NODE:   return astCtxt->extract(op.imm1, op.imm2, children[0]);
+          case triton::ast::IFF_NODE:       return astCtxt->iff(children[0], children[1]);
+          case triton::ast::ITE_NODE:       return astCtxt->ite(children[0], children[1], children[2]);
+          case triton::ast::LAND_NODE:      return astCtxt->land(children);
+          case triton::ast::LNOT_NODE:      return astCtxt->lnot(children[0]);
+          case triton::ast::LOR_NODE:       return astCtxt->lor(children);
+          case triton::ast::LXOR_NODE:      return astCtxt->lxor(children);
+          case triton::ast::SX_NODE:        return astCtxt->sx(op.imm1, children[0]);
+          case triton::ast::ZX_NODE:        return astCtxt->zx(op.imm1, children[0]);
+          default:
+            throw triton::exceptions::SymbolicEngine("SemanticsCache::build(): Invalid type of node.");
+        }
+      }
+
+
+      bool SemanticsCache::replay(triton::arch::Instruction& inst, triton::arch::architecture_e arch, SymbolicEngine* engine, const triton::ast::SharedAstContext& astCtxt) const {
+        auto it = this->templates.find(inst.getAddress());
+        if (it == this->templates.end())
+          return false;
+
+        const Template& tpl = it->second;
+
+        /* The code must not have changed since it was recorded */
+        if (tpl.arch != arch || tpl.bytes.size() != inst.getSize() || std::memcmp(tpl.bytes.data(), inst.getOpcode(), inst.getSize()) != 0)
+          return false;
+
+        std::vector<triton::ast::SharedAbstractNode> built(tpl.ops.size());
+        std::vector<SharedSymbolicExpression> exprs(tpl.events.size());
+        triton::uint32 next = 0;
+
+        for (triton::uint32 index = 0; index < tpl.events.size(); index++) {
+          const Event& event = tpl.events[index];
+
+          /* The nodes of a write are built over the nodes read before it */
+          if (event.kind == WRITE_MEMORY || event.kind == WRITE_REGISTER || event.kind == WRITE_VOLATILE) {
+            for (; next <= event.node; next++) {
+              if (tpl.ops[next].type != triton::ast::INVALID_NODE)
+                built[next] = this->build(astCtxt, tpl.ops[next], built, exprs);
+            }
+          }
+
+          switch (event.kind) {
+            case READ_IMMEDIATE:
+              built[event.node] = engine->getImmediateAst(inst, event.imm);
+              break;
+
+            case READ_LEA:
+              built[event.node] = inst.operands[event.operand].getConstMemory().getLeaAst();
+              break;
+
+            case READ_MEMORY:
+              built[event.node] = engine->getMemoryAst(inst, inst.operands[event.operand].getConstMemory());
+              break;
+
+            case READ_REGISTER:
+              built[event.node] = engine->getRegisterAst(inst, event.reg);
+              break;
+
+            case WRITE_MEMORY:
+              exprs[index] = engine->createSymbolicMemoryExpression(inst, built[event.node], inst.operands[event.operand].getConstMemory(), event.comment);
+              break;
+
+            case WRITE_REGISTER:
+              exprs[index] = engine->createSymbolicRegisterExpression(inst, built[event.node], event.reg, event.comment);
+              break;
+
+            case WRITE_VOLATILE:
+              exprs[index] = engine->createSymbolicVolatileExpression(inst, built[event.node], event.comment);
+              break;
+          }
+        }
+
+        for (const auto& reg : tpl.undefined)
+          inst.setUndefinedRegister(reg);
+
+        return true;
+      }
+
+
+      void SemanticsCache::clear(void) {
+        this->abort();
+        this->templates.clear();
+      }
+
+
+      triton::usize SemanticsCache::size(void) const {
+        return this->templates.size();
+      }
+
+    }; /* symbolic namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
@@ -0,0 +1,597 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <unordered_map>
+#include <utility>
+
+#include <triton/astContext.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/simplificationPasses.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace symbolic {
+
+      /* Returns true if the node is the constant `value` of its size */
+      static bool isConstant(const triton::ast::SharedAbstractNode& node, const triton::uint512& value) {
+        return node->getType() == triton::ast::BV_NODE && node->evaluate() == (value & node->getBitvectorMask());
+      }
+
+
+      /* Returns true if the node is the constant -1 of its size */
+      static bool isAllOnes(const triton::ast::SharedAbstractNode& node) {
+        return node->getType() == triton::ast::BV_NODE && node->evaluate() == node->getBitvectorMask();
+      }
+
+
+      /* Returns true if `node` is (`type` `other`) */
+      static bool isUnaryOf(const triton::ast::SharedAbstractNode& node, triton::ast::ast_e type, const triton::ast::SharedAbstractNode& other) {
+        return node->getType() == type && node->getChildren()[0]->equalTo(other);
+      }
+
+
+      /* Returns true if `node` is a binary bitvector operation, n-ary ones (AST_NARY) are simplified when built */
+      static bool isBinary(const triton::ast::SharedAbstractNode& node) {
+        if (node->getChildren().size() != 2)
+          return false;
+
+        switch (node->getType()) {
+          case triton::ast::BVADD_NODE:
+          case triton::ast::BVAND_NODE:
+          case triton::ast::BVASHR_NODE:
+          case triton::ast::BVLSHR_NODE:
+          case triton::ast::BVMUL_NODE:
+          case triton::ast::BVOR_NODE:
+          case triton::ast::BVSHL_NODE:
+          case triton::ast::BVSUB_NODE:
+          case triton::ast::BVXOR_NODE:
+            return true;
+          default:
+            return false;
+        }
+      }
+
+
+      /* x + 0, x - 0, x * 1, x & -1, x | 0, x ^ 0 and the shifts by 0 -> x */
+      static triton::ast::SharedAbstractNode neutralPass(const triton::ast::SharedAbstractNode& node) {
+        if (!isBinary(node))
+          return node;
+
+        const auto& a = node->getChildren()[0];
+        const auto& b = node->getChildren()[1];
+        switch (node->getType()) {
+          case triton::ast::BVADD_NODE:
+          case triton::ast::BVOR_NODE:
+          case triton::ast::BVXOR_NODE:
+            if (isConstant(b, 0)) return a;
+            if (isConstant(a, 0)) return b;
+            break;
+
+          case triton::ast::BVASHR_NODE:
+          case triton::ast::BVLSHR_NODE:
+          case triton::ast::BVSHL_NODE:
+          case triton::ast::BVSUB_NODE:
+            if (isConstant(b, 0)) return a;
+            break;
+
+          case triton::ast::BVMUL_NODE:
+            if (isConstant(b, 1)) return a;
+            if (isConstant(a, 1)) return b;
+            break;
+
+          case triton::ast::BVAND_NODE:
+            if (isAllOnes(b)) return a;
+            if (isAllOnes(a)) return b;
+            break;
+
+          default:
+            break;
+        }
+
+        return node;
+      }
+
+
+      /* x * 0, x & 0 -> 0 and x | -1 -> -1 */
+      static triton::ast::SharedAbstractNode absorbingPass(const triton::ast::SharedAbstractNode& node) {
+        if (!isBinary(node))
+          return node;
+
+        const auto& a = node->getChildren()[0];
+        const auto& b = node->getChildren()[1];
+        switch (node->getType()) {
+          case triton::ast::BVAND_NODE:
+          case triton::ast::BVMUL_NODE:
+            if (isConstant(a, 0)) return a;
+            if (isConstant(b, 0)) return b;
+            break;
+
+          case triton::ast::BVOR_NODE:
+            if (isAllOnes(a)) return a;
+            if (isAllOnes(b)) return b;
+            break;
+
+          default:
+            break;
+        }
+
+        return node;
+      }
+
+
+      /* x & x, x | x -> x */
+      static triton::ast::SharedAbstractNode idempotencePass(const triton::ast::SharedAbstractNode& node) {
+        if (node->getType() != triton::ast::BVAND_NODE && node->getType() != triton::ast::BVOR_NODE)
+          return node;
+
+        if (node->getChildren().size() != 2)
+          return node;
+
+        const auto& a = node->getChildren()[0];
+        if (a->equalTo(node->getChildren()[1]))
+          return a;
+
+        return node;
+      }
+
+
+      /* x ^ x, x - x, x & ~x, x + -x -> 0 and x | ~x, x ^ ~x, x + ~x -> -1 */
+      static triton::ast::SharedAbstractNode complementPass(const triton::ast::SharedAbstractNode& node) {
+        if (!isBinary(node))
+          return node;
+
+        const auto& a = node->getChildren()[0];
+        const auto& b = node->getChildren()[1];
+        bool complement = isUnaryOf(a, triton::ast::BVNOT_NODE, b) || isUnaryOf(b, triton::ast::BVNOT_NODE, a);
+        auto ctxt = node->getContext();
+        auto size = node->getBitvectorSize();
+
+        switch (node->getType()) {
+          case triton::ast::BVSUB_NODE:
+          case triton::ast::BVXOR_NODE:
+            if (a->equalTo(b))
+              return ctxt->bv(0, size);
+            if (complement && node->getType() == triton::ast::BVXOR_NODE)
+              return ctxt->bv(node->getBitvectorMask(), size);
+            break;
+
+          case triton::ast::BVAND_NODE:
+            if (complement)
+              return ctxt->bv(0, size);
+            break;
+
+          case triton::ast::BVOR_NODE:
+            if (complement)
+              return ctxt->bv(node->getBitvectorMask(), size);
+            break;
+
+          case triton::ast::BVADD_NODE:
+            if (isUnaryOf(a, triton::ast::BVNEG_NODE, b) || isUnaryOf(b, triton::ast::BVNEG_NODE, a))
+              return ctxt->bv(0, size);
+            if (complement)
+              return ctxt->bv(node->getBitvectorMask(), size);
+            break;
+
+          default:
+            break;
+        }
+
+        return node;
+      }
+
+
+      /* ~~x, --x -> x, x ^ -1 -> ~x and x * -1 -> -x */
+      static triton::ast::SharedAbstractNode involutionPass(const triton::ast::SharedAbstractNode& node) {
+        switch (node->getType()) {
+          case triton::ast::BVNOT_NODE:
+          case triton::ast::BVNEG_NODE: {
+            const auto& child = node->getChildren()[0];
+            if (child->getType() == node->getType())
+              return child->getChildren()[0];
+            break;
+          }
+
+          case triton::ast::BVXOR_NODE:
+          case triton::ast::BVMUL_NODE: {
+            if (node->getChildren().size() != 2)
+              break;
+            const auto& a = node->getChildren()[0];
+            const auto& b = node->getChildren()[1];
+            auto ctxt = node->getContext();
+            if (isAllOnes(a) || isAllOnes(b)) {
+              const auto& other = isAllOnes(b) ? a : b;
+              return node->getType() == triton::ast::BVXOR_NODE ? ctxt->bvnot(other) : ctxt->bvneg(other);
+            }
+            break;
+          }
+
+          default:
+            break;
+        }
+
+        return node;
+      }
+
+
+      /* x & (x | y), x | (x & y) -> x */
+      static triton::ast::SharedAbstractNode absorptionPass(const triton::ast::SharedAbstractNode& node) {
+        triton::ast::ast_e inner;
+
+        switch (node->getType()) {
+          case triton::ast::BVAND_NODE: inner = triton::ast::BVOR_NODE;  break;
+          case triton::ast::BVOR_NODE:  inner = triton::ast::BVAND_NODE; break;
+          default:
+            return node;
+        }
+
+        if (node->getChildren().size() != 2)
+          return node;
+
+        for (triton::uint32 i = 0; i < 2; i++) {
+          const auto& x = node->getChildren()[i];
+          const auto& y = node->getChildren()[1 - i];
+          if (y->getType() == inner && (y->getChildren()[0]->equalTo(x) || y->getChildren()[1]->equalTo(x)))
+            return x;
+        }
+
+        return node;
+      }
+
+
+      /*! \class LinearMba
+       *  \brief Normalizes a linear mixed boolean-arithmetic expression.
+       *
+       * \description
+       * A linear MBA expression `E` is a sum of bitwise functions `f` of its operands multiplied by
+       * constants, a constant `c` being `-c` times the function -1. As each bit of `f` only depends on
+       * the same bit of the operands, `E(x) = sum(2^k * g(bits k of x))` where `g(b) = E(b) - 2 * E(0)`
+       * is its signature on the operands set to 0 or 1. The Möbius transform of `g` gives its coefficients
+       * on the conjunctions of the operands, the empty one being the function -1.
+       */
+      class LinearMba {
+        private:
+          //! The maximum number of nodes of an expression.
+          static constexpr triton::usize maxNodes = 64;
+
+          //! The maximum number of operands of an expression.
+          static constexpr triton::usize maxLeaves = 4;
+
+          //! The operands of the expression, structurally distinct.
+          std::vector<triton::ast::SharedAbstractNode> leaves;
+
+          //! The index of the operand of each node which is one.
+          std::unordered_map<const triton::ast::AbstractNode*, triton::uint32> indexes;
+
+          //! The number of nodes of the expression, each operand counting for one.
+          triton::usize nodes = 0;
+
+          //! The mask of the size of the expression.
+          triton::uint512 mask;
+
+          //! The size of the expression.
+          triton::uint32 size;
+
+          //! The AST context building the normal forms.
+          triton::ast::SharedAstContext ctxt;
+
+          //! Returns true if `type` is a bitwise operation.
+          static bool isBitwise(triton::ast::ast_e type) {
+            switch (type) {
+              case triton::ast::BVAND_NODE:
+              case triton::ast::BVNAND_NODE:
+              case triton::ast::BVNOR_NODE:
+              case triton::ast::BVNOT_NODE:
+              case triton::ast::BVOR_NODE:
+              case triton::ast::BVXNOR_NODE:
+              case triton::ast::BVXOR_NODE:
+                return true;
+              default:
+                return false;
+            }
+          }
+
+          //! Returns true if `node` is an operand, `bitwise` if it is under a bitwise operation.
+          static bool isLeaf(const triton::ast::SharedAbstractNode& node, bool bitwise) {
+            auto type = node->getType();
+
+            if (isBitwise(type))
+              return false;
+
+            if (bitwise)
+              return true;
+
+            switch (type) {
+              case triton::ast::BV_NODE:
+              case triton::ast::BVADD_NODE:
+              case triton::ast::BVNEG_NODE:
+              case triton::ast::BVSUB_NODE:
+                return false;
+              case triton::ast::BVMUL_NODE:
+                return node->getChildren()[0]->getType() != triton::ast::BV_NODE && node->getChildren()[1]->getType() != triton::ast::BV_NODE;
+              default:
+                return true;
+            }
+          }
+
+          //! Records the operands of `node`. Returns false if the expression is too large.
+          bool scan(const triton::ast::SharedAbstractNode& node, bool bitwise) {
+            if (++this->nodes > maxNodes)
+              return false;
+
+            if (isLeaf(node, bitwise)) {
+              if (this->indexes.find(node.get()) != this->indexes.end())
+                return true;
+              for (triton::uint32 i = 0; i < this->leaves.size(); i++) {
+                if (this->leaves[i]->equalTo(node)) {
+                  this->indexes[node.get()] = i;
+                  return true;
+                }
+              }
+              if (this->leaves.size() == maxLeaves)
+                return false;
+              this->indexes[node.get()] = static_cast<triton::uint32>(this->leaves.size());
+              this->leaves.push_back(node);
+              return true;
+            }
+
+            if (node->getType() == triton::ast::BV_NODE)
+              return true;
+
+            bitwise = isBitwise(node->getType());
+            for (const auto& child : node->getChildren()) {
+              if (!this->scan(child, bitwise))
+                return false;
+            }
+
+            return true;
+          }
+
+          //! Evaluates `node`, the operand `i` being the bit `i` of `values`.
+          triton::uint512 eval(const triton::ast::SharedAbstractNode& node, bool bitwise, triton::uint32 values) const {
+            if (isLeaf(node, bitwise))
+              return (values >> this->indexes.at(node.get())) & 1;
+
+            const auto& children = node->getChildren();
+            bitwise = isBitwise(node->getType());
+
+            switch (node->getType()) {
+              case triton::ast::BV_NODE:     return node->evaluate();
+              case triton::ast::BVNEG_NODE:  return (0 - this->eval(children[0], bitwise, values)) & this->mask;
+              case triton::ast::BVNOT_NODE:  return ~this->eval(children[0], bitwise, values) & this->mask;
+              default:
+                break;
+            }
+
+            /* The operands of n-ary nodes (AST_NARY) are folded from the left */
+            auto a = this->eval(children[0], bitwise, values);
+            for (triton::usize index = 1; index < children.size(); index++) {
+              auto b = this->eval(children[index], bitwise, values);
+              switch (node->getType()) {
+                case triton::ast::BVADD_NODE:  a = (a + b) & this->mask; break;
+                case triton::ast::BVAND_NODE:  a = a & b; break;
+                case triton::ast::BVMUL_NODE:  a = (a * b) & this->mask; break;
+                case triton::ast::BVNAND_NODE: a = ~(a & b) & this->mask; break;
+                case triton::ast::BVNOR_NODE:  a = ~(a | b) & this->mask; break;
+                case triton::ast::BVOR_NODE:   a = a | b; break;
+                case triton::ast::BVSUB_NODE:  a = (a - b) & this->mask; break;
+                case triton::ast::BVXNOR_NODE: a = ~(a ^ b) & this->mask; break;
+                case triton::ast::BVXOR_NODE:  a = a ^ b; break;
+                default:
+                  throw triton::exceptions::SymbolicSimplification("LinearMba::eval(): Invalid node.");
+              }
+            }
+            return a;
+          }
+
+          //! Returns the number of nodes of `node`, each operand counting for one.
+          triton::usize count(const triton::ast::SharedAbstractNode& node) const {
+            triton::usize n = 1;
+
+            if (node->getType() == triton::ast::BV_NODE || this->indexes.find(node.get()) != this->indexes.end())
+              return n;
+
+            for (const auto& child : node->getChildren())
+              n += this->count(child);
+
+            return n;
+          }
+
+          //! Returns `acc + coef * term`, `acc` being nullptr if the sum is empty.
+          triton::ast::SharedAbstractNode add(const triton::ast::SharedAbstractNode& acc, const triton::uint512& coef, const triton::ast::SharedAbstractNode& term) const {
+            /* A coefficient whose sign bit is set is subtracted */
+            bool negative = ((coef >> (this->size - 1)) & 1) != 0;
+            triton::uint512 value = negative ? ((0 - coef) & this->mask) : coef;
+            triton::ast::SharedAbstractNode product = nullptr;
+
+            if (coef == 0)
+              return acc;
+
+            if (term == nullptr)
+              product = this->ctxt->bv(value, this->size);
+            else if (value == 1)
+              product = term;
+            else
+              product = this->ctxt->bvmul(this->ctxt->bv(value, this->size), term);
+
+            if (acc == nullptr)
+              return negative ? (term == nullptr ? this->ctxt->bv(coef, this->size) : this->ctxt->bvneg(product)) : product;
+
+            return negative ? this->ctxt->bvsub(acc, product) : this->ctxt->bvadd(acc, product);
+          }
+
+          //! Returns the bitwise function of the first two operands whose truth table is `table`, the bit `x | y << 1`.
+          triton::ast::SharedAbstractNode function(triton::uint32 table) const {
+            const auto& x = this->leaves[0];
+            const auto& y = this->leaves.size() > 1 ? this->leaves[1] : this->leaves[0];
+
+            switch (table) {
+              case 0b1010: return x;
+              case 0b1100: return y;
+              case 0b0101: return this->ctxt->bvnot(x);
+              case 0b0011: return this->ctxt->bvnot(y);
+              case 0b1000: return this->ctxt->bvand(x, y);
+              case 0b1110: return this->ctxt->bvor(x, y);
+              case 0b0110: return this->ctxt->bvxor(x, y);
+              case 0b0111: return this->ctxt->bvnot(this->ctxt->bvand(x, y));
+              case 0b0001: return this->ctxt->bvnot(this->ctxt->bvor(x, y));
+              case 0b1001: return this->ctxt->bvnot(this->ctxt->bvxor(x, y));
+              case 0b0010: return this->ctxt->bvand(x, this->ctxt->bvnot(y));
+              case 0b0100: return this->ctxt->bvand(this->ctxt->bvnot(x), y);
+              case 0b1011: return this->ctxt->bvor(x, this->ctxt->bvnot(y));
+              case 0b1101: return this->ctxt->bvor(this->ctxt->bvnot(x), y);
+              default:
+                return nullptr;
+            }
+          }
+
+          //! Returns `scale * f - offset`, `f` being the bitwise function true where the signature is `value`.
+          triton::ast::SharedAbstractNode scaled(const std::vector<triton::uint512>& signature, const triton::uint512& base, const triton::uint512& value) const {
+            triton::uint32 table = 0;
+
+            for (triton::uint32 b = 0; b < signature.size(); b++) {
+              if (signature[b] == value)
+                table |= (1 << b);
+            }
+
+            /* An operand alone does not depend on the second one */
+            if (this->leaves.size() == 1)
+              table |= (table << 2);
+
+            auto f = this->function(table);
+            if (f == nullptr)
+              return nullptr;
+
+            auto acc = this->add(nullptr, (value - base) & this->mask, f);
+            auto res = this->add(acc, (0 - base) & this->mask, nullptr);
+            return res ? res : this->ctxt->bv(0, this->size);
+          }
+
+        public:
+          //! Returns the normal form of `node` if it is smaller, `node` otherwise.
+          triton::ast::SharedAbstractNode normalize(const triton::ast::SharedAbstractNode& node) {
+            if (node->getType() == triton::ast::BV_NODE || isLeaf(node, false) || !node->getBitvectorSize())
+              return node;
+
+            this->size = node->getBitvectorSize();
+            this->mask = node->getBitvectorMask();
+            this->ctxt = node->getContext();
+            if (!this->scan(node, false))
+              return node;
+
+            /* The signature of the expression */
+            triton::uint32 n = 1 << this->leaves.size();
+            std::vector<triton::uint512> signature(n);
+            triton::uint512 e0 = this->eval(node, false, 0);
+            for (triton::uint32 b = 0; b < n; b++)
+              signature[b] = (this->eval(node, false, b) - 2 * e0) & this->mask;
+
+            /* Its coefficients on the conjunctions of the operands */
+            std::vector<triton::uint512> coefs = signature;
+            for (triton::uint32 i = 0; i < this->leaves.size(); i++) {
+              for (triton::uint32 b = 0; b < n; b++) {
+                if (b & (1 << i))
+                  coefs[b] = (coefs[b] - coefs[b ^ (1 << i)]) & this->mask;
+              }
+            }
+
+            triton::ast::SharedAbstractNode best = nullptr;
+            for (triton::uint32 b = 1; b < n; b++) {
+              triton::ast::SharedAbstractNode term = nullptr;
+              for (triton::uint32 i = 0; i < this->leaves.size(); i++) {
+                if (b & (1 << i))
+                  term = term ? this->ctxt->bvand(term, this->leaves[i]) : this->leaves[i];
+              }
+              best = this->add(best, coefs[b], term);
+            }
+            best = this->add(best, (0 - coefs[0]) & this->mask, nullptr);
+            if (best == nullptr)
+              best = this->ctxt->bv(0, this->size);
+
+            /* A bitwise function scaled and offset if the signature has two values */
+            if (this->leaves.size() && this->leaves.size() <= 2) {
+              triton::uint512 base  = signature[0];
+              triton::uint512 other = base;
+              bool twoValues = true;
+              for (triton::uint32 b = 1; b < n; b++) {
+                if (signature[b] == base || signature[b] == other)
+                  continue;
+                if (other != base)
+                  twoValues = false;
+                other = signature[b];
+              }
+              if (twoValues && other != base) {
+                for (const auto& values : {std::make_pair(base, other), std::make_pair(other, base)}) {
+                  auto form = this->scaled(signature, values.first, values.second);
+                  if (form && this->count(form) < this->count(best))
+                    best = form;
+                }
+              }
+            }
+
+            if (this->count(best) < this->nodes)
+              return best;
+
+            return node;
+          }
+      };
+
+
+      /* Normalizes the linear mixed boolean-arithmetic expressions */
+      static triton::ast::SharedAbstractNode mbaLinearPass(const triton::ast::SharedAbstractNode& node) {
+        return LinearMba().normalize(node);
+      }
+
+
+      /* The passes, in their default order */
+      static const std::vector<std::pair<std::string, triton::engines::symbolic::SimplificationRule>>& getPasses(void) {
+        static const std::vector<std::pair<std::string, triton::engines::symbolic::SimplificationRule>> passes = {
+          {"neutral",     neutralPass},
+          {"absorbing",   absorbingPass},
+          {"idempotence", idempotencePass},
+          {"complement",  complementPass},
+          {"involution",  involutionPass},
+          {"absorption",  absorptionPass},
+          {"mba-linear",  mbaLinearPass},
+        };
+        return passes;
+      }
+
+
+      const std::vector<std::string>& SimplificationPasses::getNames(void) {
+        static const std::vector<std::string> names = [] {
+          std::vector<std::string> ret;
+          for (const auto& pass : getPasses())
+            ret.push_back(pass.first);
+          return ret;
+        }();
+        return names;
+      }
+
+
+      triton::engines::symbolic::SimplificationRule SimplificationPasses::getPass(const std::string& name) {
+        for (const auto& pass : getPasses()) {
+          if (pass.first == name)
+            return pass.second;
+        }
+        throw triton::exceptions::SymbolicSimplification("SimplificationPasses::getPass(): Unknown pass " + name + ".");
+      }
+
+
+      triton::sint32 SimplificationPasses::getOrder(const std::string& name) {
+        const auto& passes = getPasses();
+        for (triton::uint32 i = 0; i < passes.size(); i++) {
+          if (passes[i].first == name)
+            return static_cast<triton::sint32>(i);
+        }
+        throw triton::exceptions::SymbolicSimplification("SimplificationPasses::getOrder(): Unknown pass " + name + ".");
+      }
+
+    }; /* symbolic namespace */
+  }; /* engines namespace */
+}; /*triton namespace */
@@ -0,0 +1,66 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <cstdio>
+
+#include <triton/exceptions.hpp>
+#include <triton/spillFile.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace symbolic {
+
+      SpillFile::SpillFile(const std::string& path)
+        : path(path), stream(path, std::ios::binary | std::ios::trunc) {
+        if (!this->stream)
+          throw triton::exceptions::SymbolicEngine("SpillFile::SpillFile(): Cannot create the file.");
+        this->size = 0;
+      }
+
+
+      SpillFile::~SpillFile() {
+        this->stream.close();
+        std::remove(this->path.c_str());
+      }
+
+
+      const std::string& SpillFile::getPath(void) const {
+        return this->path;
+      }
+
+
+      triton::uint64 SpillFile::getSize(void) {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->size;
+      }
+
+
+      triton::uint64 SpillFile::append(const std::string& record) {
+        std::lock_guard<std::mutex> guard(this->lock);
+        triton::uint64 offset = this->size;
+
+        /* The record must be in the file before it is mapped */
+        this->stream.write(record.data(), record.size());
+        this->stream.flush();
+        if (!this->stream)
+          throw triton::exceptions::SymbolicEngine("SpillFile::append(): Cannot write the file.");
+
+        this->size += record.size();
+
+        return offset;
+      }
+
+
+      std::shared_ptr<const triton::arch::MappedFile> SpillFile::read(triton::uint64 offset, triton::usize size) const {
+        return std::make_shared<const triton::arch::MappedFile>(this->path, offset, size);
+      }
+
+    }; /* symbolic namespace */
+  }; /* engines namespace */
+}; /*triton namespace */
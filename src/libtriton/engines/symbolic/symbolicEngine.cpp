@@ -5,10 +5,12 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <algorithm>
 #include <cstring>
 #include <new>
 #include <set>
 
+#include <triton/astEvaluator.hpp>
 #include <triton/exceptions.hpp>
 #include <triton/coreUtils.hpp>
 #include <triton/symbolicEngine.hpp>
@@ -38,9 +40,20 @@ namespace triton {
         this->enableFlag        = true;
         this->numberOfRegisters = this->architecture->numberOfRegisters();
         this->uniqueSymExprId   = 0;
-        this->uniqueSymVarId    = 0;
-
-        this->symbolicReg.resize(this->numberOfRegisters);
+        this->uniqueSymVarId    = std::make_shared<triton::usize>(0);
+        this->maxNodes          = 0;
+        this->maxExpressions    = 0;
+        this->budgetPolicy      = CONCRETIZE_DEEPEST_EXPRESSIONS;
+        this->depthLimit        = 4096;
+        this->depthPolicy       = CONCRETIZE_DEEP_EXPRESSION;
+        this->nextEviction      = 0;
+        this->recorder          = nullptr;
+        this->concreteSemantics = false;
+        this->solver            = nullptr;
+        this->deferFlags        = false;
+        this->blockAddress      = 0;
+        this->inductionBlock    = false;
+        this->thread            = 0;
       }
 
 
@@ -52,13 +65,68 @@ namespace triton {
 
         this->alignedMemoryReference      = other.alignedMemoryReference;
         this->architecture                = other.architecture;
+        this->budgetPolicy                = other.budgetPolicy;
         this->callbacks                   = other.callbacks;
+        this->comments                    = other.comments;
+        this->concretization              = other.concretization;
+        this->depthLimit                  = other.depthLimit;
+        this->depthPolicy                 = other.depthPolicy;
+        this->blockAddress                = other.blockAddress;
+        this->blockRegisters              = other.blockRegisters;
+        this->deferFlags                  = other.deferFlags;
         this->enableFlag                  = other.enableFlag;
+        this->inductionBlock              = other.inductionBlock;
+        this->inductionVariables          = other.inductionVariables;
+        this->lazyRegisters               = other.lazyRegisters;
+        this->nextEviction                = other.nextEviction;
+        this->maxExpressions              = other.maxExpressions;
+        this->maxNodes                    = other.maxNodes;
+        this->memoryArray                 = other.memoryArray;
+        this->memoryArrayCells            = other.memoryArrayCells;
         this->memoryReference             = other.memoryReference;
         this->numberOfRegisters           = other.numberOfRegisters;
+        this->recorder                    = nullptr;
+        this->concreteSemantics           = false;
+        this->solver                      = other.solver;
+        this->symbolicExpressions         = other.symbolicExpressions;
+        this->taintedExpressions          = other.taintedExpressions;
+        this->symbolicReg                 = other.symbolicReg;
+        this->symbolicVariables           = other.symbolicVariables;
+        this->thread                      = other.thread;
+        this->threads                     = other.threads;
+        this->uniqueSymExprId             = other.uniqueSymExprId;
+        this->uniqueSymVarId              = other.uniqueSymVarId;
+      }
+
+
+      void SymbolicEngine::copyState(const SymbolicEngine& other) {
+        triton::engines::symbolic::PathManager::operator=(other);
+
+        this->alignedMemoryReference      = other.alignedMemoryReference;
+        this->budgetPolicy                = other.budgetPolicy;
+        this->concretization              = other.concretization;
+        this->depthLimit                  = other.depthLimit;
+        this->depthPolicy                 = other.depthPolicy;
+        this->blockAddress                = other.blockAddress;
+        this->blockRegisters              = other.blockRegisters;
+        this->deferFlags                  = other.deferFlags;
+        this->enableFlag                  = other.enableFlag;
+        this->inductionBlock              = other.inductionBlock;
+        this->inductionVariables          = other.inductionVariables;
+        this->lazyRegisters               = other.lazyRegisters;
+        this->nextEviction                = other.nextEviction;
+        this->maxExpressions              = other.maxExpressions;
+        this->maxNodes                    = other.maxNodes;
+        this->memoryArray                 = other.memoryArray;
+        this->memoryArrayCells            = other.memoryArrayCells;
+        this->memoryReference             = other.memoryReference;
         this->symbolicExpressions         = other.symbolicExpressions;
+        this->taintedExpressions          = other.taintedExpressions;
+        this->registerAsts.clear();
         this->symbolicReg                 = other.symbolicReg;
         this->symbolicVariables           = other.symbolicVariables;
+        this->thread                      = other.thread;
+        this->threads                     = other.threads;
         this->uniqueSymExprId             = other.uniqueSymExprId;
         this->uniqueSymVarId              = other.uniqueSymVarId;
       }
@@ -66,8 +134,42 @@ namespace triton {
 
       SymbolicEngine::~SymbolicEngine() {
         /* See #828: Release ownership before calling container destructor */
+        this->inductionVariables.clear();
+        this->lazyRegisters.clear();
+        this->memoryArray = nullptr;
+        this->memoryArrayCells.clear();
         this->memoryReference.clear();
+        this->registerAsts.clear();
         this->symbolicReg.clear();
+        this->threads.clear();
+      }
+
+
+      void SymbolicEngine::setThread(triton::uint32 tid) {
+        if (tid == this->thread)
+          return;
+
+        /* The deferred registers are built with the concrete registers of their thread */
+        this->buildLazyRegisters();
+
+        /* The persistent map is shared, not copied */
+        auto current = this->symbolicReg;
+
+        auto next = this->threads.find(tid);
+        if (next != this->threads.end()) {
+          this->symbolicReg = std::move(next->second);
+          this->threads.erase(next);
+        }
+
+        this->threads[this->thread] = std::move(current);
+        this->thread = tid;
+      }
+
+
+      void SymbolicEngine::removeThread(triton::uint32 tid) {
+        if (tid == this->thread)
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::removeThread(): Cannot remove the current thread.");
+        this->threads.erase(tid);
       }
 
 
@@ -78,14 +180,35 @@ namespace triton {
         this->alignedMemoryReference      = other.alignedMemoryReference;
         this->architecture                = other.architecture;
         this->astCtxt                     = other.astCtxt;
+        this->budgetPolicy                = other.budgetPolicy;
         this->callbacks                   = other.callbacks;
+        this->comments                    = other.comments;
+        this->concretization              = other.concretization;
+        this->depthLimit                  = other.depthLimit;
+        this->depthPolicy                 = other.depthPolicy;
+        this->blockAddress                = other.blockAddress;
+        this->blockRegisters              = other.blockRegisters;
+        this->deferFlags                  = other.deferFlags;
         this->enableFlag                  = other.enableFlag;
+        this->inductionBlock              = other.inductionBlock;
+        this->inductionVariables          = other.inductionVariables;
+        this->lazyRegisters               = other.lazyRegisters;
+        this->nextEviction                = other.nextEviction;
+        this->maxExpressions              = other.maxExpressions;
+        this->maxNodes                    = other.maxNodes;
+        this->memoryArray                 = other.memoryArray;
+        this->memoryArrayCells            = other.memoryArrayCells;
         this->memoryReference             = other.memoryReference;
         this->modes                       = other.modes;
         this->numberOfRegisters           = other.numberOfRegisters;
+        this->solver                      = other.solver;
         this->symbolicExpressions         = other.symbolicExpressions;
+        this->taintedExpressions          = other.taintedExpressions;
+        this->registerAsts.clear();
         this->symbolicReg                 = other.symbolicReg;
         this->symbolicVariables           = other.symbolicVariables;
+        this->thread                      = other.thread;
+        this->threads                     = other.threads;
         this->uniqueSymExprId             = other.uniqueSymExprId;
         this->uniqueSymVarId              = other.uniqueSymVarId;
 
@@ -101,17 +224,21 @@ namespace triton {
       void SymbolicEngine::concretizeRegister(const triton::arch::Register& reg) {
         triton::arch::register_e parentId = reg.getParent();
 
+        /* The concrete value of a deferred register is the one of its expression */
+        this->buildLazyRegisters(reg);
+
         if (this->architecture->isRegisterValid(parentId)) {
-          this->symbolicReg[parentId] = nullptr;
+          this->symbolicReg.erase(parentId);
+          this->registerAsts.erase(parentId);
         }
       }
 
 
-      /* Same as concretizeRegister but with all registers */
+      /* Same as concretizeRegister but with all registers, the stale entries are released lazily */
       void SymbolicEngine::concretizeAllRegister(void) {
-        for (triton::uint32 i = 0; i < this->numberOfRegisters; i++) {
-          this->symbolicReg[i] = nullptr;
-        }
+        this->buildLazyRegisters();
+        this->symbolicReg.discard();
+        this->registerAsts.clear();
       }
 
 
@@ -141,25 +268,114 @@ namespace triton {
       }
 
 
-      /* Same as concretizeMemory but with all address memory */
+      /* Same as concretizeMemory but with a whole area, page by page */
+      void SymbolicEngine::concretizeMemoryArea(triton::uint64 baseAddr, triton::usize size) {
+        this->memoryReference.erase(baseAddr, size);
+        this->alignedMemoryReference.erase(baseAddr, size);
+      }
+
+
+      /* Same as concretizeMemory but with all address memory, the stale pages are released lazily */
       void SymbolicEngine::concretizeAllMemory(void) {
-        this->memoryReference.clear();
+        this->memoryReference.discard();
         this->alignedMemoryReference.clear();
+        this->memoryArray = nullptr;
+        this->memoryArrayCells.discard();
+      }
+
+
+      /* Assigns the memory references of an area to another one. The aligned references of the destination are dropped. */
+      void SymbolicEngine::copySymbolicMemory(triton::uint64 dst, triton::uint64 src, triton::usize size) {
+        this->alignedMemoryReference.erase(dst, size);
+        this->memoryReference.copy(dst, src, size);
       }
 
 
       /* Gets an aligned entry. */
       const SharedSymbolicExpression& SymbolicEngine::getAlignedMemory(triton::uint64 address, triton::uint32 size) {
-        return this->alignedMemoryReference[std::make_pair(address, size)];
+        return this->alignedMemoryReference.get(address, size);
+      }
+
+
+      /* Extracts an unaligned access from the aligned entry covering it. */
+      triton::ast::SharedAbstractNode SymbolicEngine::getCoveringAlignedMemoryAst(triton::uint64 address, triton::uint32 size) {
+        triton::uint64 base = 0;
+
+        const SharedSymbolicExpression& expr = this->alignedMemoryReference.getCovering(address, size, base);
+        if (expr == nullptr)
+          return nullptr;
+
+        /* Memory is little-endian, the byte at base+n holds the bits [8n+7:8n] of the expression */
+        triton::uint32 low  = static_cast<triton::uint32>(address - base) * bitsize::byte;
+        triton::uint32 high = low + (size * bitsize::byte) - 1;
+
+        return this->astCtxt->extract(high, low, this->astCtxt->reference(expr));
+      }
+
+
+      /*
+       * Builds an access overlapping several aligned entries, e.g. a qword whose
+       * byte was overwritten. Each entry gives one extract and only the bytes
+       * outside the entries are read one by one, consecutive concrete bytes
+       * being merged into one constant.
+       */
+      triton::ast::SharedAbstractNode SymbolicEngine::getForwardedAlignedMemoryAst(triton::uint64 address, triton::uint32 size, const triton::uint8* concreteValue) {
+        std::vector<triton::ast::SharedAbstractNode> opVec;
+        SharedSymbolicExpression cells[triton::size::dqqword];
+
+        auto entries = this->alignedMemoryReference.getOverlapping(address, size);
+        if (entries.empty())
+          return nullptr;
+
+        this->memoryReference.get(address, size, cells);
+
+        /* From the most significant byte, the memory is little-endian */
+        auto it = entries.rbegin();
+        triton::uint32 index = size;
+        while (index) {
+          triton::uint32 end = (it != entries.rend()) ? static_cast<triton::uint32>(it->first - address) + it->second.size : 0;
+
+          if (it != entries.rend() && end == index) {
+            const AlignedMemory::Entry& entry = it->second;
+            triton::ast::SharedAbstractNode node = this->astCtxt->reference(entry.expr);
+            if (entry.offset != 0 || node->getBitvectorSize() != entry.size * bitsize::byte) {
+              triton::uint32 low = entry.offset * bitsize::byte;
+              node = this->astCtxt->extract(low + (entry.size * bitsize::byte) - 1, low, node);
+            }
+            opVec.push_back(node);
+            index -= entry.size;
+            it++;
+            continue;
+          }
+
+          /* The bytes between the entries */
+          while (index > end) {
+            const SharedSymbolicExpression& symMem = cells[index - 1];
+            if (symMem) {
+              opVec.push_back(this->astCtxt->reference(symMem));
+              index--;
+              continue;
+            }
+
+            /* Consecutive concrete bytes are merged into one constant */
+            triton::uint512 value = 0;
+            triton::uint32 run    = 0;
+            while (index > end && cells[index - 1] == nullptr) {
+              value = (value << bitsize::byte) | concreteValue[index - 1];
+              index--;
+              run++;
+            }
+            opVec.push_back(this->astCtxt->bv(value, run * bitsize::byte));
+          }
+        }
+
+        return this->astCtxt->concat(opVec);
       }
 
 
       /* Checks if the aligned memory is recored. */
       bool SymbolicEngine::isAlignedMemory(triton::uint64 address, triton::uint32 size) {
-        if (this->alignedMemoryReference.find(std::make_pair(address, size)) != this->alignedMemoryReference.end()) {
-          return true;
-        }
-        return false;
+        return this->alignedMemoryReference.contains(address, size);
       }
 
 
@@ -167,65 +383,31 @@ namespace triton {
       void SymbolicEngine::addAlignedMemory(triton::uint64 address, triton::uint32 size, const SharedSymbolicExpression& expr) {
         this->removeAlignedMemory(address, size);
         if (!(this->modes->isModeEnabled(triton::modes::ONLY_ON_SYMBOLIZED) && expr->getAst()->isSymbolized() == false)) {
-          this->alignedMemoryReference[std::make_pair(address, size)] = expr;
+          this->alignedMemoryReference.set(address, size, expr);
         }
       }
 
 
-      /* Removes an aligned memory */
+      /* Removes the aligned memories overlapping [address, address+size) */
       void SymbolicEngine::removeAlignedMemory(triton::uint64 address, triton::uint32 size) {
-        /*
-         * Avoid accessing the alignedMemoryReference array when empty. This usually happens when
-         * you initialize the symbolic engine and concretize whole sections of an executable using
-         * setConcreteMemoryValue. No symbolic memory has been created yet but this function will
-         * still try to rougly erase (size * 7) elements.
-         */
-        if (this->alignedMemoryReference.empty())
-          return;
-
-        /* Remove overloaded positive ranges */
-        for (triton::uint32 index = 0; index < size; index++) {
-          this->alignedMemoryReference.erase(std::make_pair(address+index, triton::size::byte));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, triton::size::word));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, triton::size::dword));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, triton::size::qword));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, triton::size::fword));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, triton::size::dqword));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, triton::size::qqword));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, triton::size::dqqword));
-        }
-
-        /* Remove overloaded negative ranges */
-        for (triton::uint32 index = 1; index < triton::size::dqqword; index++) {
-          if (index < triton::size::word)    this->alignedMemoryReference.erase(std::make_pair(address-index, triton::size::word));
-          if (index < triton::size::dword)   this->alignedMemoryReference.erase(std::make_pair(address-index, triton::size::dword));
-          if (index < triton::size::qword)   this->alignedMemoryReference.erase(std::make_pair(address-index, triton::size::qword));
-          if (index < triton::size::fword)   this->alignedMemoryReference.erase(std::make_pair(address-index, triton::size::fword));
-          if (index < triton::size::dqword)  this->alignedMemoryReference.erase(std::make_pair(address-index, triton::size::dqword));
-          if (index < triton::size::qqword)  this->alignedMemoryReference.erase(std::make_pair(address-index, triton::size::qqword));
-          if (index < triton::size::dqqword) this->alignedMemoryReference.erase(std::make_pair(address-index, triton::size::dqqword));
-        }
+        this->alignedMemoryReference.erase(address, size);
       }
 
 
       /* Returns the reference memory if it's referenced otherwise returns nullptr */
       SharedSymbolicExpression SymbolicEngine::getSymbolicMemory(triton::uint64 addr) const {
-        auto it = this->memoryReference.find(addr);
-        if (it != this->memoryReference.end()) {
-          return it->second;
-        }
-        return nullptr;
+        return this->memoryReference.get(addr);
       }
 
 
       /* Returns the symbolic variable otherwise raises an exception */
       SharedSymbolicVariable SymbolicEngine::getSymbolicVariable(triton::usize symVarId) const {
-        auto it = this->symbolicVariables.find(symVarId);
-        if (it == this->symbolicVariables.end()) {
+        const WeakSymbolicVariable* weak = this->symbolicVariables.find(symVarId);
+        if (weak == nullptr) {
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::getSymbolicVariable(): Unregistred symbolic variable.");
         }
 
-        if (auto node = it->second.lock()) {
+        if (auto node = weak->lock()) {
           return node;
         }
 
@@ -235,19 +417,36 @@ namespace triton {
 
       /* Returns the symbolic variable otherwise returns nullptr */
       SharedSymbolicVariable SymbolicEngine::getSymbolicVariable(const std::string& name) const {
+        /* A name is formatted from the id, which is looked up without going through the variables */
+        const triton::usize prefix = sizeof(TRITON_SYMVAR_NAME) - 1;
+        if (name.size() > prefix && name.compare(0, prefix, TRITON_SYMVAR_NAME) == 0) {
+          const std::string digits = name.substr(prefix);
+          if (digits.find_first_not_of("0123456789") == std::string::npos && digits.size() < 20 && (digits[0] != '0' || digits.size() == 1)) {
+            const WeakSymbolicVariable* weak = this->symbolicVariables.find(std::stoull(digits));
+            if (weak != nullptr) {
+              if (auto symVar = weak->lock())
+                return symVar;
+            }
+          }
+        }
+
         /*
-         * FIXME: 1) When there is a ton of symvar, this loop takes a while to go through.
-         *           What about adding two maps {id:symvar} and {string:symvar}? See #648.
-         *
-         *        2) If we are looking for alias, we return the first occurrence. It's not
-         *           ideal if we have multiple same aliases.
+         * FIXME: If we are looking for alias, we return the first occurrence. It's not
+         *        ideal if we have multiple same aliases.
          */
-        for (auto& sv: this->symbolicVariables) {
-          if (auto symVar = sv.second.lock()) {
-            if (symVar->getName() == name || symVar->getAlias() == name) {
-              return symVar;
+        SharedSymbolicVariable found = nullptr;
+        this->symbolicVariables.forEach([&](triton::usize, const WeakSymbolicVariable& weak) {
+          if (found != nullptr)
+            return;
+          if (auto symVar = weak.lock()) {
+            if (symVar->getAlias() == name) {
+              found = symVar;
             }
           }
+        });
+
+        if (found != nullptr) {
+          return found;
         }
         throw triton::exceptions::SymbolicEngine("SymbolicEngine::getSymbolicVariable(): Unregistred or dead symbolic variable.");
       }
@@ -259,13 +458,13 @@ namespace triton {
         std::unordered_map<triton::usize, SharedSymbolicVariable> ret;
         std::vector<triton::usize> toRemove;
 
-        for (auto& kv : this->symbolicVariables) {
-          if (auto sp = kv.second.lock()) {
-            ret[kv.first] = sp;
+        this->symbolicVariables.forEach([&](triton::usize id, const WeakSymbolicVariable& weak) {
+          if (auto sp = weak.lock()) {
+            ret[id] = sp;
           } else {
-            toRemove.push_back(kv.first);
+            toRemove.push_back(id);
           }
-        }
+        });
 
         for (triton::usize id : toRemove) {
           this->symbolicVariables.erase(id);
@@ -276,6 +475,10 @@ namespace triton {
 
 
       void SymbolicEngine::setImplicitReadRegisterFromEffectiveAddress(triton::arch::Instruction& inst, const triton::arch::MemoryAccess& mem) {
+        /* These reads are done again by the engine when a recorded semantics is replayed */
+        SemanticsCache* recorder = this->recorder;
+        this->recorder = nullptr;
+
         /* Set implicit read of the segment register (LEA) */
         if (this->architecture->isRegisterValid(mem.getConstSegmentRegister())) {
           (void)this->getRegisterAst(inst, mem.getConstSegmentRegister());
@@ -290,6 +493,8 @@ namespace triton {
         if (this->architecture->isRegisterValid(mem.getConstIndexRegister())) {
           (void)this->getRegisterAst(inst, mem.getConstIndexRegister());
         }
+
+        this->recorder = recorder;
       }
 
 
@@ -304,12 +509,33 @@ namespace triton {
       }
 
 
+      /*
+       * With ONLY_ON_SYMBOLIZED, a concrete expression is removed as soon as the
+       * instruction is built, and so are all the expressions of an instruction on
+       * the concrete path. Its destination is then concretized and synchronized
+       * directly, which avoids the byte references, the subregister insertion and
+       * the comment of a recorded expression.
+       */
+      bool SymbolicEngine::isConcreteFastPath(const triton::ast::SharedAbstractNode& node) const {
+        return this->concreteSemantics || (this->modes->isModeEnabled(triton::modes::ONLY_ON_SYMBOLIZED) && node->isSymbolized() == false);
+      }
+
+
+      const SharedSymbolicExpression& SymbolicEngine::addConcreteExpression(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, triton::engines::symbolic::expression_e type) {
+        const triton::ast::SharedAbstractNode& value = this->astCtxt->bv(node->evaluate(), node->getBitvectorSize());
+        return inst.addSymbolicExpression(std::make_shared<SymbolicExpression>(value, this->getUniqueSymExprId(), type));
+      }
+
+
       /* Returns the shared symbolic expression corresponding to the register */
       const SharedSymbolicExpression& SymbolicEngine::getSymbolicRegister(const triton::arch::Register& reg) const {
         triton::arch::register_e parentId = reg.getParent();
 
         if (this->architecture->isRegisterValid(parentId)) {
-          return this->symbolicReg.at(parentId);
+          static const SharedSymbolicExpression none = nullptr;
+
+          const SharedSymbolicExpression* expr = this->symbolicReg.find(parentId);
+          return expr ? *expr : none;
         }
 
         throw triton::exceptions::SymbolicEngine("SymbolicEngine::getSymbolicRegister(): Invalid Register");
@@ -361,12 +587,19 @@ namespace triton {
       /* Get an unique id.
        * Mainly used when a new symbolic variable is created */
       triton::usize SymbolicEngine::getUniqueSymVarId(void) {
-        return this->uniqueSymVarId++;
+        return (*this->uniqueSymVarId)++;
       }
 
 
       /* Creates a new symbolic expression with comment */
       SharedSymbolicExpression SymbolicEngine::newSymbolicExpression(const triton::ast::SharedAbstractNode& node, triton::engines::symbolic::expression_e type, const std::string& comment) {
+        if (comment.empty() || this->modes->isModeEnabled(triton::modes::NO_COMMENTS))
+          return this->newSymbolicExpression(node, type, std::shared_ptr<const std::string>());
+        return this->newSymbolicExpression(node, type, std::make_shared<const std::string>(comment));
+      }
+
+
+      SharedSymbolicExpression SymbolicEngine::newSymbolicExpression(const triton::ast::SharedAbstractNode& node, triton::engines::symbolic::expression_e type, const std::shared_ptr<const std::string>& comment) {
         if (this->modes->isModeEnabled(triton::modes::AST_OPTIMIZATIONS)) {
           /*
            * Create volatile expression for extended part to avoid long
@@ -376,7 +609,7 @@ namespace triton {
           if (node->getType() == triton::ast::ZX_NODE || node->getType() == triton::ast::SX_NODE) {
             auto n = node->getChildren()[1];
             if (n->getType() != triton::ast::REFERENCE_NODE && n->getType() != triton::ast::VARIABLE_NODE) {
-              auto e = this->newSymbolicExpression(n, VOLATILE_EXPRESSION, "Extended part - " + comment);
+              auto e = this->newSymbolicExpression(n, VOLATILE_EXPRESSION, comment ? "Extended part - " + *comment : "");
               node->setChild(1, this->astCtxt->reference(e));
             }
           }
@@ -385,24 +618,73 @@ namespace triton {
         /* Each symbolic expression must have an unique id */
         triton::usize id = this->getUniqueSymExprId();
 
-        /* Performes transformation if there are rules recorded */
-        const triton::ast::SharedAbstractNode& snode = this->simplify(node);
+        /* Performes transformation if there are rules recorded, then applies the budget */
+        const triton::ast::SharedAbstractNode& snode = this->applyBudget(this->simplify(node));
 
         /* Allocates the new shared symbolic expression */
-        SharedSymbolicExpression expr = std::make_shared<SymbolicExpression>(snode, id, type, comment);
+        SharedSymbolicExpression expr = std::make_shared<SymbolicExpression>(snode, id, type);
         if (expr == nullptr) {
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::newSymbolicExpression(): not enough memory");
         }
+        expr->setComment(comment);
 
         /* Save and returns the new shared symbolic expression */
-        this->symbolicExpressions[id] = expr;
+        this->symbolicExpressions.set(id, expr);
         return expr;
       }
 
 
+      /* Sets the taint of an expression and indexes it */
+      void SymbolicEngine::setTaintedExpression(const SharedSymbolicExpression& expr, bool flag) {
+        expr->isTainted = flag;
+        if (flag)
+          this->taintedExpressions.set(expr->getId(), expr);
+      }
+
+
+      /* Indexes the tainted expressions */
+      void SymbolicEngine::indexTaintedExpressions(const std::vector<SharedSymbolicExpression>& exprs) {
+        for (const auto& expr : exprs) {
+          if (expr->isTainted)
+            this->taintedExpressions.set(expr->getId(), expr);
+        }
+      }
+
+
+      /* Records an existing symbolic expression */
+      void SymbolicEngine::addSymbolicExpression(const SharedSymbolicExpression& expr) {
+        if (expr == nullptr)
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::addSymbolicExpression(): The expression cannot be null.");
+
+        this->symbolicExpressions.set(expr->getId(), expr);
+        if (expr->isTainted)
+          this->taintedExpressions.set(expr->getId(), expr);
+        this->uniqueSymExprId = std::max(this->uniqueSymExprId, expr->getId() + 1);
+      }
+
+
+      /* Records an existing symbolic variable */
+      void SymbolicEngine::addSymbolicVariable(const SharedSymbolicVariable& var) {
+        if (var == nullptr)
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::addSymbolicVariable(): The variable cannot be null.");
+
+        this->symbolicVariables.set(var->getId(), var);
+        *this->uniqueSymVarId = std::max(*this->uniqueSymVarId, var->getId() + 1);
+      }
+
+
+      /* Assigns the expression of a byte to a memory cell */
+      void SymbolicEngine::setSymbolicMemory(triton::uint64 addr, const SharedSymbolicExpression& expr) {
+        if (expr == nullptr || expr->getAst()->getBitvectorSize() != triton::bitsize::byte)
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::setSymbolicMemory(): The expression must be the one of a byte.");
+
+        this->addMemoryReference(addr, expr);
+      }
+
+
       /* Removes the symbolic expression corresponding to the id */
       void SymbolicEngine::removeSymbolicExpression(const SharedSymbolicExpression& expr) {
-        if (this->symbolicExpressions.find(expr->getId()) != this->symbolicExpressions.end()) {
+        if (this->symbolicExpressions.contains(expr->getId())) {
           /* Concretize memory */
           if (expr->getType() == MEMORY_EXPRESSION) {
             const auto& mem = expr->getOriginMemory();
@@ -423,12 +705,12 @@ namespace triton {
 
       /* Gets the shared symbolic expression from a symbolic id */
       SharedSymbolicExpression SymbolicEngine::getSymbolicExpression(triton::usize symExprId) const {
-        auto it = this->symbolicExpressions.find(symExprId);
-        if (it == this->symbolicExpressions.end()) {
+        const WeakSymbolicExpression* weak = this->symbolicExpressions.find(symExprId);
+        if (weak == nullptr) {
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::getSymbolicExpression(): symbolic expression id not found");
         }
 
-        if (auto sp = it->second.lock()) {
+        if (auto sp = weak->lock()) {
           return sp;
         }
 
@@ -443,13 +725,13 @@ namespace triton {
         std::unordered_map<triton::usize, SharedSymbolicExpression> ret;
         std::vector<triton::usize> toRemove;
 
-        for (auto& kv : this->symbolicExpressions) {
-          if (auto sp = kv.second.lock()) {
-            ret[kv.first] = sp;
+        this->symbolicExpressions.forEach([&](triton::usize id, const WeakSymbolicExpression& weak) {
+          if (auto sp = weak.lock()) {
+            ret[id] = sp;
           } else {
-            toRemove.push_back(kv.first);
+            toRemove.push_back(id);
           }
-        }
+        });
 
         for (auto id : toRemove)
           this->symbolicExpressions.erase(id);
@@ -460,24 +742,41 @@ namespace triton {
 
       /* Slices all expressions from a given one */
       std::unordered_map<triton::usize, SharedSymbolicExpression> SymbolicEngine::sliceExpressions(const SharedSymbolicExpression& expr) {
-        std::unordered_map<triton::usize, SharedSymbolicExpression> exprs;
-
         if (expr == nullptr) {
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::sliceExpressions(): expr cannot be null.");
         }
 
-        exprs[expr->getId()] = expr;
+        return this->sliceExpressionsMany({expr});
+      }
+
+
+      /* Slices all expressions from given ones, each expression of the union is visited once */
+      std::unordered_map<triton::usize, SharedSymbolicExpression> SymbolicEngine::sliceExpressionsMany(const std::vector<SharedSymbolicExpression>& exprs) {
+        std::unordered_map<triton::usize, SharedSymbolicExpression> slice;
+        std::vector<SharedSymbolicExpression> worklist;
+
+        for (const auto& expr : exprs) {
+          if (expr == nullptr) {
+            throw triton::exceptions::SymbolicEngine("SymbolicEngine::sliceExpressionsMany(): exprs cannot contain null.");
+          }
+          worklist.push_back(expr);
+        }
+
+        /* Walk the graph of references between expressions, cached in each expression */
+        while (!worklist.empty()) {
+          SharedSymbolicExpression expr = std::move(worklist.back());
+          worklist.pop_back();
+
+          if (!slice.emplace(expr->getId(), expr).second)
+            continue;
 
-        auto worklist = triton::ast::childrenExtraction(expr->getAst(), true /* unroll */, false /* revert */);
-        for (auto&& n : worklist) {
-          if (n->getType() == triton::ast::REFERENCE_NODE) {
-            auto expr  = reinterpret_cast<triton::ast::ReferenceNode*>(n.get())->getSymbolicExpression();
-            auto eid   = expr->getId();
-            exprs[eid] = expr;
+          for (auto& ref : expr->getReferences()) {
+            if (slice.find(ref->getId()) == slice.end())
+              worklist.push_back(std::move(ref));
           }
         }
 
-        return exprs;
+        return slice;
       }
 
 
@@ -486,18 +785,18 @@ namespace triton {
         std::vector<SharedSymbolicExpression> taintedExprs;
         std::vector<triton::usize> invalidSymExpr;
 
-        for (auto it = this->symbolicExpressions.begin(); it != this->symbolicExpressions.end(); it++) {
-          if (auto sp = it->second.lock()) {
-            if (sp->isTainted) {
-              taintedExprs.push_back(sp);
-            }
+        /* Only the index is visited, the expressions removed or untainted since are dropped from it */
+        this->taintedExpressions.forEach([&](triton::usize id, const WeakSymbolicExpression& weak) {
+          auto sp = weak.lock();
+          if (sp != nullptr && sp->isTainted && this->symbolicExpressions.contains(id)) {
+            taintedExprs.push_back(sp);
           } else {
-            invalidSymExpr.push_back(it->first);
+            invalidSymExpr.push_back(id);
           }
-        }
+        });
 
         for (auto id : invalidSymExpr) {
-          this->symbolicExpressions.erase(id);
+          this->taintedExpressions.erase(id);
         }
 
         return taintedExprs;
@@ -508,19 +807,31 @@ namespace triton {
       std::unordered_map<triton::arch::register_e, SharedSymbolicExpression> SymbolicEngine::getSymbolicRegisters(void) const {
         std::unordered_map<triton::arch::register_e, SharedSymbolicExpression> ret;
 
-        for (triton::uint32 it = 0; it < this->numberOfRegisters; it++) {
-          if (this->symbolicReg[it] != nullptr) {
-            ret[triton::arch::register_e(it)] = this->symbolicReg[it];
+        this->symbolicReg.forEach([&ret](triton::uint32 id, const SharedSymbolicExpression& expr) {
+          if (expr != nullptr) {
+            ret[triton::arch::register_e(id)] = expr;
           }
-        }
+        });
 
         return ret;
       }
 
 
+      const triton::utils::PersistentMap<triton::uint32, SharedSymbolicExpression, IdentityHash<triton::uint32>>& SymbolicEngine::getPersistentSymbolicRegisters(void) const {
+        return this->symbolicReg;
+      }
+
+
       /* Returns the map of symbolic memory defined */
-      const std::unordered_map<triton::uint64, SharedSymbolicExpression>& SymbolicEngine::getSymbolicMemory(void) const {
-        return this->memoryReference;
+      std::unordered_map<triton::uint64, SharedSymbolicExpression> SymbolicEngine::getSymbolicMemory(void) const {
+        std::unordered_map<triton::uint64, SharedSymbolicExpression> ret;
+
+        ret.reserve(this->memoryReference.size());
+        this->memoryReference.forEach([&ret](triton::uint64 addr, const SharedSymbolicExpression& expr) {
+          ret[addr] = expr;
+        });
+
+        return ret;
       }
 
 
@@ -588,7 +899,64 @@ namespace triton {
       }
 
 
+      /*
+       * Same as symbolizeMemory on each `granularity` bytes of the area, but the
+       * concrete area is read once and its values are not written back.
+       */
+      std::vector<SharedSymbolicVariable> SymbolicEngine::symbolizeMemoryArea(triton::uint64 baseAddr, triton::usize size, triton::uint32 granularity, const std::string& aliasPrefix) {
+        std::vector<SharedSymbolicVariable> symVars;
+
+        if (granularity == 0 || granularity > triton::size::dqqword || (granularity & (granularity - 1)) || (size % granularity)) {
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::symbolizeMemoryArea(): The granularity must be a power of two up to 64 bytes which divides the size.");
+        }
+
+        std::vector<triton::uint8> area = this->architecture->getConcreteMemoryAreaValue(baseAddr, size);
+        symVars.reserve(size / granularity);
+
+        for (triton::usize offset = 0; offset < size; offset += granularity) {
+          triton::uint64 memAddr = baseAddr + offset;
+          triton::uint512 cv     = 0;
+
+          /* Create the symbolic variable and its AST node */
+          std::string alias = aliasPrefix.empty() ? "" : aliasPrefix + "_" + std::to_string(offset / granularity);
+          const SharedSymbolicVariable& symVar = this->newSymbolicVariable(MEMORY_VARIABLE, memAddr, granularity * bitsize::byte, alias);
+          const triton::ast::SharedAbstractNode& symVarNode = this->astCtxt->variable(symVar);
+
+          /* Setup the concrete value (little endian) to the symbolic variable */
+          for (triton::uint32 index = granularity; index > 0; index--) {
+            cv = (cv << bitsize::byte) | area[offset + index - 1];
+          }
+          this->astCtxt->updateVariable(symVar->getId(), cv);
+
+          /* Record the aligned symbolic variable for a symbolic optimization */
+          if (this->modes->isModeEnabled(triton::modes::ALIGNED_MEMORY)) {
+            const SharedSymbolicExpression& se = this->newSymbolicExpression(symVarNode, MEMORY_EXPRESSION, "aligned Byte reference");
+            se->setOriginMemory(triton::arch::MemoryAccess(memAddr, granularity));
+            this->addAlignedMemory(memAddr, granularity, se);
+          }
+
+          /* Split expression in bytes, a variable of one byte is its own byte */
+          for (triton::sint32 index = granularity-1; index >= 0; index--) {
+            triton::uint32 high = ((bitsize::byte * (index + 1)) - 1);
+            triton::uint32 low  = ((bitsize::byte * (index + 1)) - bitsize::byte);
+
+            const triton::ast::SharedAbstractNode& tmp = (granularity == triton::size::byte) ? symVarNode : this->astCtxt->extract(high, low, symVarNode);
+
+            const SharedSymbolicExpression& se = this->newSymbolicExpression(tmp, MEMORY_EXPRESSION, "Byte reference");
+            se->setOriginMemory(triton::arch::MemoryAccess(memAddr+index, triton::size::byte));
+            this->addMemoryReference(memAddr+index, se);
+          }
+
+          symVars.push_back(symVar);
+        }
+
+        return symVars;
+      }
+
+
       SharedSymbolicVariable SymbolicEngine::symbolizeRegister(const triton::arch::Register& reg, const std::string& symVarAlias) {
+        this->buildLazyRegisters(reg);
+
         const triton::arch::Register& parent  = this->architecture->getRegister(reg.getParent());
         triton::uint32 symVarSize             = reg.getBitSize();
         triton::uint512 cv                    = this->architecture->getConcreteRegisterValue(reg);
@@ -620,6 +988,10 @@ namespace triton {
 
       /* Adds a new symbolic variable */
       SharedSymbolicVariable SymbolicEngine::newSymbolicVariable(triton::engines::symbolic::variable_e type, triton::uint64 origin, triton::uint32 size, const std::string& alias) {
+        if (this->budgetPolicy == REFUSE_NEW_SYMBOLS && this->isBudgetExceeded()) {
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::newSymbolicVariable(): The budget of the symbolic engine is exceeded.");
+        }
+
         triton::usize uniqueId = this->getUniqueSymVarId();
 
         SharedSymbolicVariable symVar = std::make_shared<SymbolicVariable>(type, origin, uniqueId, size, alias);
@@ -627,7 +999,7 @@ namespace triton {
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::newSymbolicVariable(): Cannot allocate a new symbolic variable");
         }
 
-        this->symbolicVariables[uniqueId] = symVar;
+        this->symbolicVariables.set(uniqueId, symVar);
         return symVar;
       }
 
@@ -801,12 +1173,248 @@ namespace triton {
       triton::ast::SharedAbstractNode SymbolicEngine::getImmediateAst(triton::arch::Instruction& inst, const triton::arch::Immediate& imm) {
         triton::ast::SharedAbstractNode node = this->getImmediateAst(imm);
         inst.setReadImmediate(imm, node);
+        if (this->recorder)
+          this->recorder->readImmediate(imm, node);
         return node;
       }
 
 
+      bool SymbolicEngine::isMemoryArrayAccess(const triton::arch::MemoryAccess& mem) const {
+        if (!this->modes->isModeEnabled(triton::modes::MEMORY_ARRAY))
+          return false;
+
+        const triton::ast::SharedAbstractNode& lea = mem.getLeaAst();
+        return lea != nullptr && lea->isSymbolized();
+      }
+
+
+      bool SymbolicEngine::isMemoryArrayAccess(const triton::arch::Instruction& inst, const triton::arch::MemoryAccess& mem) const {
+        const triton::ast::SharedAbstractNode& lea = mem.getLeaAst();
+        if (lea == nullptr || !lea->isSymbolized())
+          return false;
+
+        return this->modes->isModeEnabled(triton::modes::MEMORY_ARRAY) || this->concretization.getPolicy(inst.getAddress()) == SYMBOLIC_POINTER;
+      }
+
+
+      /*
+       * A dereference which is not kept symbolic reads or writes the cells at its concrete address. The other addresses
+       * the pointer may take are lost (CONCRETIZE_POINTER), excluded by a path constraint (CONSTRAIN_POINTER, and
+       * SYMBOLIC_POINTER when the address reaches too many cells), or kept as the branches not taken of a path
+       * constraint, to be flipped (FORK_POINTER).
+       */
+      void SymbolicEngine::concretizePointer(const triton::arch::Instruction& inst, const triton::arch::MemoryAccess& mem, bool symbolic) {
+        triton::engines::symbolic::pointer_policy_e policy = this->concretization.getPolicy(inst.getAddress());
+        ConcretizationPolicy::Statistics& statistics = this->concretization.record(inst.getAddress());
+        const triton::ast::SharedAbstractNode& lea = mem.getLeaAst();
+
+        if (symbolic) {
+          statistics.symbolic++;
+          return;
+        }
+
+        if (policy == SYMBOLIC_POINTER) {
+          statistics.fallbacks++;
+          policy = CONSTRAIN_POINTER;
+        }
+
+        if (policy == CONCRETIZE_POINTER) {
+          statistics.concretized++;
+          return;
+        }
+
+        if (policy == FORK_POINTER) statistics.forked++;
+        else                        statistics.constrained++;
+
+        /* The load and the store of an instruction dereference the same address, it is constrained once */
+        if (lea == this->lastPointer)
+          return;
+        this->lastPointer = lea;
+
+        /* As the branches, an address which can only be one value or deeper than the budget is not constrained */
+        if (this->modes->isModeEnabled(triton::modes::AST_ABSTRACT_DOMAIN) && lea->getDomain().isConstant())
+          return;
+
+        if (this->maxDepth && lea->getLevel() > this->maxDepth)
+          return;
+
+        std::vector<triton::uint64> values = {lea->evaluate().convert_to<triton::uint64>()};
+        if (policy == FORK_POINTER) {
+          values = this->getPointerValues(lea, this->concretization.getForkValues());
+          statistics.branches += values.size();
+        }
+
+        /* The branches do not reach an address, their destination is 0 */
+        triton::engines::symbolic::PathConstraint pco;
+        pco.setThreadId(inst.getThreadId());
+        pco.setComment("Pointer - " + inst.getDisassembly());
+        for (triton::usize index = 0; index < values.size(); index++) {
+          pco.addBranchConstraint(index == 0, inst.getAddress(), 0, this->astCtxt->equal(lea, this->astCtxt->bv(values[index], lea->getBitvectorSize())));
+        }
+
+        this->recordPathConstraint(pco);
+      }
+
+
+      std::vector<triton::uint64> SymbolicEngine::getPointerValues(const triton::ast::SharedAbstractNode& lea, triton::uint32 limit) const {
+        std::vector<triton::uint64> values = {lea->evaluate().convert_to<triton::uint64>()};
+
+        if (this->solver == nullptr || !this->solver->isValid())
+          return values;
+
+        triton::ast::AstEvaluator evaluator(lea);
+        std::vector<triton::uint512> inputs(evaluator.getVariables().size());
+        triton::ast::SharedAbstractNode predicate = this->getRelevantPathPredicate(lea);
+
+        /* Each model gives a new address, excluded from the next query */
+        while (values.size() < limit) {
+          predicate = this->astCtxt->land(predicate, this->astCtxt->distinct(lea, this->astCtxt->bv(values.back(), lea->getBitvectorSize())));
+
+          auto model = this->solver->getModel(predicate);
+          if (model.empty())
+            break;
+
+          for (triton::usize index = 0; index < inputs.size(); index++) {
+            const SharedSymbolicVariable& var = evaluator.getVariables()[index];
+            auto it = model.find(var->getId());
+            inputs[index] = (it != model.end()) ? it->second.getValue() : this->astCtxt->getVariableValue(var->getId());
+          }
+
+          values.push_back(evaluator.evaluate(inputs).convert_to<triton::uint64>());
+        }
+
+        return values;
+      }
+
+
+      /* The indexes of the memory array have the size of the addresses */
+      triton::ast::SharedAbstractNode SymbolicEngine::getMemoryArrayIndex(const triton::arch::MemoryAccess& mem) {
+        const triton::ast::SharedAbstractNode& lea = mem.getLeaAst();
+        triton::uint32 indexSize = this->architecture->gprBitSize();
+
+        if (lea->getBitvectorSize() < indexSize)
+          return this->astCtxt->zx(indexSize - lea->getBitvectorSize(), lea);
+
+        if (lea->getBitvectorSize() > indexSize)
+          return this->astCtxt->extract(indexSize - 1, 0, lea);
+
+        return lea;
+      }
+
+
+      /*
+       * The cells are stored into the memory array lazily: before an access at a symbolic address, the cells it may
+       * reach (bounded by the domain of its index, see AST_ABSTRACT_DOMAIN) are stored again if their expression or
+       * their concrete value changed since they were last stored. The accesses at a concrete address keep using the
+       * memory references only.
+       */
+      bool SymbolicEngine::syncMemoryArray(const triton::ast::SharedAbstractNode& index, triton::uint32 size) {
+        triton::uint32 indexSize  = index->getBitvectorSize();
+        triton::ast::NodeDomain d = index->getDomain();
+        triton::uint512 limit     = (triton::uint512(1) << indexSize);
+
+        if (d.getUpper() - d.getLower() >= this->concretization.getArrayCells() || d.getUpper() + size > limit)
+          return false;
+
+        triton::uint64 base   = d.getLower().convert_to<triton::uint64>();
+        triton::usize count   = (d.getUpper() - d.getLower()).convert_to<triton::usize>() + size;
+        std::vector<triton::uint8> values = this->architecture->getConcreteMemoryAreaValue(base, count);
+        triton::ast::SharedAbstractNode array = (this->memoryArray != nullptr) ? this->astCtxt->reference(this->memoryArray) : this->astCtxt->array(indexSize);
+        bool changed = (this->memoryArray == nullptr);
+
+        for (triton::usize offset = 0; offset < count; offset++) {
+          triton::uint64 address = base + offset;
+          const SharedSymbolicExpression& expr = this->memoryReference.get(address);
+          triton::uint8 value = (expr != nullptr) ? 0 : values[offset];
+
+          const ArrayCell* cell = this->memoryArrayCells.find(address);
+          if (cell != nullptr && cell->expr == expr && cell->value == value)
+            continue;
+
+          array = this->astCtxt->store(array, this->astCtxt->bv(address, indexSize), (expr != nullptr) ? this->astCtxt->reference(expr) : this->astCtxt->bv(value, bitsize::byte));
+          this->memoryArrayCells.set(address, {expr, value});
+          changed = true;
+        }
+
+        if (changed)
+          this->setMemoryArray(array, "Memory array");
+
+        return true;
+      }
+
+
+      /* The memory array is neither simplified nor subject to the budget, it is not a bitvector */
+      void SymbolicEngine::setMemoryArray(const triton::ast::SharedAbstractNode& node, const std::string& comment) {
+        triton::usize id = this->getUniqueSymExprId();
+
+        SharedSymbolicExpression expr = std::make_shared<SymbolicExpression>(node, id, VOLATILE_EXPRESSION, comment);
+        if (expr == nullptr) {
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::setMemoryArray(): not enough memory");
+        }
+
+        this->symbolicExpressions.set(id, expr);
+        this->memoryArray = expr;
+      }
+
+
+      /* Returns the AST of a load at a symbolic address, the concatenation of the selects of its bytes in little endian */
+      triton::ast::SharedAbstractNode SymbolicEngine::getMemoryArrayAst(const triton::arch::MemoryAccess& mem) {
+        triton::ast::SharedAbstractNode index = this->getMemoryArrayIndex(mem);
+        triton::uint32 size = mem.getSize();
+        std::vector<triton::ast::SharedAbstractNode> bytes;
+
+        if (!this->syncMemoryArray(index, size))
+          return nullptr;
+
+        triton::ast::SharedAbstractNode array = this->astCtxt->reference(this->memoryArray);
+        bytes.reserve(size);
+        while (size--) {
+          triton::ast::SharedAbstractNode address = size ? this->astCtxt->bvadd(index, this->astCtxt->bv(size, index->getBitvectorSize())) : index;
+          bytes.push_back(this->astCtxt->select(array, address));
+        }
+
+        if (bytes.size() == 1)
+          return bytes[0];
+
+        return this->astCtxt->concat(bytes);
+      }
+
+
+      /* Stores the bytes of a store at a symbolic address into the memory array, over the cells it may reach */
+      bool SymbolicEngine::storeMemoryArray(const triton::arch::MemoryAccess& mem, const triton::ast::SharedAbstractNode& node, const std::string& comment) {
+        triton::ast::SharedAbstractNode index = this->getMemoryArrayIndex(mem);
+        triton::uint32 size = mem.getSize();
+
+        if (!this->syncMemoryArray(index, size))
+          return false;
+
+        triton::ast::SharedAbstractNode array = this->astCtxt->reference(this->memoryArray);
+        for (triton::uint32 offset = 0; offset < size; offset++) {
+          triton::ast::SharedAbstractNode address = offset ? this->astCtxt->bvadd(index, this->astCtxt->bv(offset, index->getBitvectorSize())) : index;
+          triton::ast::SharedAbstractNode byte    = this->astCtxt->extract((offset * bitsize::byte) + (bitsize::byte - 1), offset * bitsize::byte, node);
+          array = this->astCtxt->store(array, address, byte);
+        }
+
+        this->setMemoryArray(array, "Memory array - " + comment);
+        return true;
+      }
+
+
       /* Returns the AST corresponding to the memory */
       triton::ast::SharedAbstractNode SymbolicEngine::getMemoryAst(const triton::arch::MemoryAccess& mem) {
+        /* A load at a symbolic address may read any cell of the memory array it reaches */
+        if (this->isMemoryArrayAccess(mem)) {
+          triton::ast::SharedAbstractNode node = this->getMemoryArrayAst(mem);
+          if (node != nullptr)
+            return node;
+        }
+
+        return this->getMemoryCellsAst(mem);
+      }
+
+
+      /* Returns the AST of the cells at the concrete address of the memory access */
+      triton::ast::SharedAbstractNode SymbolicEngine::getMemoryCellsAst(const triton::arch::MemoryAccess& mem) {
         std::vector<triton::ast::SharedAbstractNode> opVec;
 
         triton::ast::SharedAbstractNode tmp       = nullptr;
@@ -821,21 +1429,37 @@ namespace triton {
          * Symbolic optimization
          * If the memory access is aligned, don't split the memory.
          */
-        if (this->modes->isModeEnabled(triton::modes::ALIGNED_MEMORY) && this->isAlignedMemory(address, size)) {
-          return this->getAlignedMemory(address, size)->getAst();
+        if (this->modes->isModeEnabled(triton::modes::ALIGNED_MEMORY) && !this->alignedMemoryReference.empty()) {
+          if (this->isAlignedMemory(address, size))
+            return this->getAlignedMemory(address, size)->getAst();
+
+          /* An access inside a wider aligned store is extracted from it, an access over several ones concatenates them */
+          if (size > 1) {
+            triton::ast::SharedAbstractNode covering = this->getCoveringAlignedMemoryAst(address, size);
+            if (covering != nullptr)
+              return covering;
+
+            triton::ast::SharedAbstractNode forwarded = this->getForwardedAlignedMemoryAst(address, size, concreteValue);
+            if (forwarded != nullptr)
+              return forwarded;
+          }
         }
 
         /* If the memory access is 1 byte long, just return the appropriate 8-bit vector */
         if (size == 1) {
-          const SharedSymbolicExpression& symMem = this->getSymbolicMemory(address);
+          const SharedSymbolicExpression& symMem = this->memoryReference.get(address);
           if (symMem) return this->astCtxt->reference(symMem);
           else        return this->astCtxt->bv(concreteValue[size - 1], bitsize::byte);
         }
 
+        /* The expressions of all cells, with one lookup per page */
+        SharedSymbolicExpression cells[triton::size::dqqword];
+        this->memoryReference.get(address, size, cells);
+
         /* If the memory access is more than 1 byte long, concatenate each memory cell */
         opVec.reserve(size);
         while (size) {
-          const SharedSymbolicExpression& symMem = this->getSymbolicMemory(address + size - 1);
+          const SharedSymbolicExpression& symMem = cells[size - 1];
           if (symMem) opVec.push_back(this->astCtxt->reference(symMem));
           else        opVec.push_back(this->astCtxt->bv(concreteValue[size - 1], bitsize::byte));
           size--;
@@ -846,10 +1470,22 @@ namespace triton {
 
       /* Returns the AST corresponding to the memory and defines the memory as input of the instruction */
       triton::ast::SharedAbstractNode SymbolicEngine::getMemoryAst(triton::arch::Instruction& inst, const triton::arch::MemoryAccess& mem) {
-        triton::ast::SharedAbstractNode node = this->getMemoryAst(mem);
+        triton::ast::SharedAbstractNode node = nullptr;
+
+        /* A load at a symbolic address follows the concretization policy of the instruction */
+        if (mem.getLeaAst() != nullptr && mem.getLeaAst()->isSymbolized()) {
+          if (this->isMemoryArrayAccess(inst, mem))
+            node = this->getMemoryArrayAst(mem);
+          this->concretizePointer(inst, mem, node != nullptr);
+        }
+
+        if (node == nullptr)
+          node = this->getMemoryCellsAst(mem);
 
         /* Set load access */
         inst.setLoadAccess(mem, node);
+        if (this->recorder)
+          this->recorder->readMemory(mem, node);
 
         /* Set implicit read of the base and index registers from an effective address */
         this->setImplicitReadRegisterFromEffectiveAddress(inst, mem);
@@ -858,18 +1494,86 @@ namespace triton {
       }
 
 
-      /* Returns the AST corresponding to the register */
-      triton::ast::SharedAbstractNode SymbolicEngine::getRegisterAst(const triton::arch::Register& reg) {
-        triton::ast::SharedAbstractNode node = nullptr;
+      bool SymbolicEngine::isMemoryRangeAccess(void) const {
+        if (this->modes->isModeEnabled(triton::modes::ALIGNED_MEMORY))
+          return false;
+
+        if (this->callbacks != nullptr && this->callbacks->isDefined())
+          return false;
+
+        return this->recorder == nullptr;
+      }
+
+
+      /* Returns the ASTs of consecutive memory accesses at concrete addresses, like the registers of a load multiple */
+      std::vector<triton::ast::SharedAbstractNode> SymbolicEngine::getMemoryAsts(triton::arch::Instruction& inst, triton::uint64 addr, triton::uint32 size, triton::usize count) {
+        std::vector<triton::ast::SharedAbstractNode> nodes;
+        triton::usize total = size * count;
+
+        nodes.reserve(count);
+
+        if (!this->isMemoryRangeAccess() || size == 0 || size > triton::size::dqqword) {
+          for (triton::usize index = 0; index < count; index++)
+            nodes.push_back(this->getMemoryAst(inst, triton::arch::MemoryAccess(addr + index * size, size)));
+          return nodes;
+        }
+
+        /* The concrete bytes and the expressions of all cells, with one lookup per page */
+        std::vector<triton::uint8> concrete(total);
+        std::vector<SharedSymbolicExpression> cells(total);
+        this->architecture->getConcreteMemoryAreaValue(addr, concrete.data(), total);
+        this->memoryReference.get(addr, total, cells.data());
+
+        std::vector<triton::ast::SharedAbstractNode> opVec;
+        opVec.reserve(size);
+
+        for (triton::usize index = 0; index < count; index++) {
+          triton::usize offset = index * size;
+          triton::ast::SharedAbstractNode node = nullptr;
+
+          /* Little endian, the last byte is the most significant one */
+          opVec.clear();
+          for (triton::uint32 byte = size; byte > 0; byte--) {
+            const SharedSymbolicExpression& symMem = cells[offset + byte - 1];
+            if (symMem) opVec.push_back(this->astCtxt->reference(symMem));
+            else        opVec.push_back(this->astCtxt->bv(concrete[offset + byte - 1], bitsize::byte));
+          }
+          node = (size == 1) ? opVec.front() : this->astCtxt->concat(opVec);
+
+          inst.setLoadAccess(triton::arch::MemoryAccess(addr + offset, size), node);
+          nodes.push_back(node);
+        }
+
+        return nodes;
+      }
+
+
+      /* Returns the AST corresponding to the register */
+      triton::ast::SharedAbstractNode SymbolicEngine::getRegisterAst(const triton::arch::Register& reg) {
+        this->buildLazyRegisters(reg);
+
+        triton::ast::SharedAbstractNode node = nullptr;
         triton::uint32 bvSize                = reg.getBitSize();
         triton::uint32 high                  = reg.getHigh();
         triton::uint32 low                   = reg.getLow();
-        triton::uint512 value                = this->architecture->getConcreteRegisterValue(reg);
+        triton::uint512 value                = (bvSize <= triton::bitsize::qword) ? this->architecture->getConcreteRegisterValue64(reg) : this->architecture->getConcreteRegisterValue(reg);
 
         /* Check if the register is already symbolic */
         const SharedSymbolicExpression& symReg = this->getSymbolicRegister(reg);
-        if (symReg) node = this->astCtxt->extract(high, low, this->astCtxt->reference(symReg));
-        else        node = this->astCtxt->bv(value, bvSize);
+
+        /* The AST last returned for the register is reused while its parent keeps the same expression or concrete value */
+        std::vector<RegisterAst>& asts = this->registerAsts[reg.getParent()];
+        auto cached = std::find_if(asts.begin(), asts.end(), [&reg](const RegisterAst& ast) { return ast.id == reg.getId(); });
+        if (cached != asts.end() && cached->expr == symReg.get() && (symReg || cached->value == value)) {
+          node = cached->node;
+        }
+        else {
+          if (symReg) node = this->astCtxt->extract(high, low, this->astCtxt->reference(symReg));
+          else        node = this->astCtxt->bv(value, bvSize);
+
+          if (cached == asts.end()) asts.push_back(RegisterAst{reg.getId(), symReg.get(), value, node});
+          else                      *cached = RegisterAst{reg.getId(), symReg.get(), value, node};
+        }
 
         /* extend AST if it's a extend operand (mainly used for AArch64) */
         if (reg.getExtendType() != triton::arch::arm::ID_EXTEND_INVALID) {
@@ -889,10 +1593,58 @@ namespace triton {
       triton::ast::SharedAbstractNode SymbolicEngine::getRegisterAst(triton::arch::Instruction& inst, const triton::arch::Register& reg) {
         triton::ast::SharedAbstractNode node = this->getRegisterAst(reg);
         inst.setReadRegister(reg, node);
+        if (this->recorder)
+          this->recorder->readRegister(reg, node);
         return node;
       }
 
 
+      std::shared_ptr<const std::string> SymbolicEngine::getInstructionComment(const char* prefix, const std::string& comment, const triton::arch::Instruction& inst) {
+        if (this->modes->isModeEnabled(triton::modes::NO_COMMENTS))
+          return nullptr;
+
+        /* Formatting the instruction costs more than looking up its comment */
+        std::shared_ptr<const std::string>* shared = nullptr;
+        if (this->modes->isModeEnabled(triton::modes::INTERNED_COMMENTS)) {
+          shared = &this->comments[CommentKey{inst.getAddress(), inst.getType(), prefix, comment}];
+          if (*shared)
+            return *shared;
+        }
+
+        std::stringstream s;
+        s << prefix << comment << (comment.empty() ? "" : " - ") << inst;
+
+        std::shared_ptr<const std::string> formatted = std::make_shared<const std::string>(s.str());
+        if (shared)
+          *shared = formatted;
+
+        return formatted;
+      }
+
+
+      std::shared_ptr<const std::string> SymbolicEngine::getDeferredComment(const std::string& comment, triton::uint64 address) {
+        if (this->modes->isModeEnabled(triton::modes::NO_COMMENTS))
+          return nullptr;
+
+        /* Deferred comments have no prefix, nor the type of their instruction */
+        std::shared_ptr<const std::string>* shared = nullptr;
+        if (this->modes->isModeEnabled(triton::modes::INTERNED_COMMENTS)) {
+          shared = &this->comments[CommentKey{address, 0, nullptr, comment}];
+          if (*shared)
+            return *shared;
+        }
+
+        std::stringstream s;
+        s << comment << (comment.empty() ? "" : " - ") << "0x" << std::hex << address;
+
+        std::shared_ptr<const std::string> formatted = std::make_shared<const std::string>(s.str());
+        if (shared)
+          *shared = formatted;
+
+        return formatted;
+      }
+
+
       /* Returns the new symbolic abstract expression and links this expression to the instruction. */
       const SharedSymbolicExpression& SymbolicEngine::createSymbolicExpression(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, const triton::arch::OperandWrapper& dst, const std::string& comment) {
         switch (dst.getType()) {
@@ -913,12 +1665,36 @@ namespace triton {
         triton::uint32 writeSize            = mem.getSize();
         triton::usize id                    = this->uniqueSymExprId;
 
-        std::stringstream s;
-        s << comment << (comment.empty() ? "" : " - ") << inst;
+        if (this->recorder)
+          this->recorder->writeMemory(mem, node, comment);
+
+        /* A store at a symbolic address may write any cell of the memory array it reaches, the cells at its concrete address are selects of it */
+        bool stored = this->isMemoryArrayAccess(inst, mem) && this->storeMemoryArray(mem, node, inst.getDisassembly());
+        if (mem.getLeaAst() != nullptr && mem.getLeaAst()->isSymbolized())
+          this->concretizePointer(inst, mem, stored);
+        triton::ast::SharedAbstractNode array = stored ? this->astCtxt->reference(this->memoryArray) : nullptr;
+
+        /* Concrete fast path */
+        if (!stored && this->isConcreteFastPath(node)) {
+          this->concretizeMemory(mem);
+          this->architecture->setConcreteMemoryValue(mem, node->evaluate());
+          this->setImplicitReadRegisterFromEffectiveAddress(inst, mem);
+          inst.setStoreAccess(mem, node);
+
+          const SharedSymbolicExpression& expr = this->addConcreteExpression(inst, node, MEMORY_EXPRESSION);
+          expr->setOriginMemory(mem);
+          return expr;
+        }
+
+        /* The bytes of the store share their comment */
+        std::shared_ptr<const std::string> byteComment = this->getInstructionComment("Byte reference - ", comment, inst);
 
         /* Record the aligned memory for a symbolic optimization */
-        if (this->modes->isModeEnabled(triton::modes::ALIGNED_MEMORY)) {
-          const SharedSymbolicExpression& aligned = this->newSymbolicExpression(node, MEMORY_EXPRESSION, "Aligned Byte reference - " + s.str());
+        if (stored) {
+          this->removeAlignedMemory(address, writeSize);
+        }
+        else if (this->modes->isModeEnabled(triton::modes::ALIGNED_MEMORY)) {
+          const SharedSymbolicExpression& aligned = this->newSymbolicExpression(node, MEMORY_EXPRESSION, this->getInstructionComment("Aligned Byte reference - ", comment, inst));
           this->addAlignedMemory(address, writeSize, aligned);
         }
 
@@ -931,15 +1707,21 @@ namespace triton {
           triton::uint32 high = ((writeSize * bitsize::byte) - 1);
           triton::uint32 low  = ((writeSize * bitsize::byte) - bitsize::byte);
           /* Extract each byte of the memory */
-          tmp = this->astCtxt->extract(high, low, node);
+          if (stored)
+            tmp = this->astCtxt->select(array, this->astCtxt->bv((address + writeSize) - 1, triton::ast::getArrayIndexSize(array)));
+          else
+            tmp = this->astCtxt->extract(high, low, node);
           /* Assign each byte to a new symbolic expression */
-          se = this->newSymbolicExpression(tmp, MEMORY_EXPRESSION, "Byte reference - " + s.str());
+          se = this->newSymbolicExpression(tmp, MEMORY_EXPRESSION, byteComment);
           /* Set the origin of the symbolic expression */
           se->setOriginMemory(triton::arch::MemoryAccess(((address + writeSize) - 1), triton::size::byte));
           /* ret is the for the final expression */
           ret.push_back(tmp);
           /* Assign memory with little endian */
           this->addMemoryReference((address + writeSize) - 1, se);
+          /* The memory array already holds the cell */
+          if (stored)
+            this->memoryArrayCells.set((address + writeSize) - 1, {se, 0});
           /* continue */
           writeSize--;
         }
@@ -963,13 +1745,84 @@ namespace triton {
         /* Synchronize the concrete state */
         this->architecture->setConcreteMemoryValue(mem, tmp->evaluate());
 
-        se = this->newSymbolicExpression(tmp, MEMORY_EXPRESSION, "Temporary concatenation reference - " + s.str());
+        se = this->newSymbolicExpression(tmp, MEMORY_EXPRESSION, this->getInstructionComment("Temporary concatenation reference - ", comment, inst));
         se->setOriginMemory(triton::arch::MemoryAccess(address, mem.getSize()));
 
         return this->addSymbolicExpressions(inst, id);
       }
 
 
+      /* Returns the new symbolic memory expressions of consecutive stores at concrete addresses, like the registers of a store multiple */
+      std::vector<SharedSymbolicExpression> SymbolicEngine::createSymbolicMemoryExpressions(triton::arch::Instruction& inst, const std::vector<triton::ast::SharedAbstractNode>& nodes, triton::uint64 addr, const std::string& comment) {
+        std::vector<SharedSymbolicExpression> exprs;
+        triton::usize total = 0;
+        bool range          = this->isMemoryRangeAccess();
+
+        exprs.reserve(nodes.size());
+
+        for (const auto& node : nodes) {
+          range &= !this->isConcreteFastPath(node);
+          total += node->getBitvectorSize() / bitsize::byte;
+        }
+
+        /* Each store on its own */
+        if (!range) {
+          for (const auto& node : nodes) {
+            triton::arch::MemoryAccess mem(addr, node->getBitvectorSize() / bitsize::byte);
+            exprs.push_back(this->createSymbolicMemoryExpression(inst, node, mem, comment));
+            addr += mem.getSize();
+          }
+          return exprs;
+        }
+
+        std::shared_ptr<const std::string> byteComment   = this->getInstructionComment("Byte reference - ", comment, inst);
+        std::shared_ptr<const std::string> concatComment = this->getInstructionComment("Temporary concatenation reference - ", comment, inst);
+        std::vector<SharedSymbolicExpression> cells(total);
+        std::vector<triton::uint8> concrete(total);
+        std::vector<triton::ast::SharedAbstractNode> ret;
+        triton::usize id     = this->uniqueSymExprId;
+        triton::usize offset = 0;
+
+        for (const auto& node : nodes) {
+          triton::uint32 size     = node->getBitvectorSize() / bitsize::byte;
+          triton::uint512 value   = node->evaluate();
+          SharedSymbolicExpression se = nullptr;
+
+          ret.clear();
+          for (triton::uint32 byte = size; byte > 0; byte--) {
+            triton::ast::SharedAbstractNode tmp = this->astCtxt->extract((byte * bitsize::byte) - 1, (byte - 1) * bitsize::byte, node);
+            se = this->newSymbolicExpression(tmp, MEMORY_EXPRESSION, byteComment);
+            se->setOriginMemory(triton::arch::MemoryAccess(addr + offset + byte - 1, triton::size::byte));
+            cells[offset + byte - 1] = se;
+            ret.push_back(tmp);
+          }
+
+          for (triton::uint32 byte = 0; byte < size; byte++) {
+            concrete[offset + byte] = static_cast<triton::uint8>(value & 0xff);
+            value >>= 8;
+          }
+
+          triton::arch::MemoryAccess mem(addr + offset, size);
+          inst.setStoreAccess(mem, node);
+
+          /* The expression of the store is its byte or the concatenation of its bytes */
+          if (size > 1) {
+            se = this->newSymbolicExpression(this->astCtxt->concat(ret), MEMORY_EXPRESSION, concatComment);
+            se->setOriginMemory(mem);
+          }
+          exprs.push_back(se);
+          offset += size;
+        }
+
+        /* The references and the concrete values of the whole range at once */
+        this->memoryReference.set(addr, total, cells.data());
+        this->architecture->setConcreteMemoryAreaValue(addr, concrete.data(), total);
+        this->addSymbolicExpressions(inst, id);
+
+        return exprs;
+      }
+
+
       /* Returns the parent AST after inserting the subregister (node) in its AST. */
       triton::ast::SharedAbstractNode SymbolicEngine::insertSubRegisterInParent(const triton::arch::Register& reg, const triton::ast::SharedAbstractNode& node, bool zxForAssign) {
         const triton::arch::Register& parentReg = this->architecture->getParentRegister(reg);
@@ -1040,11 +1893,37 @@ namespace triton {
         triton::usize id = this->uniqueSymExprId;
         SharedSymbolicExpression se = nullptr;
 
-        std::stringstream s;
-        s << comment << (comment.empty() ? "" : " - ") << inst;
+        if (this->recorder)
+          this->recorder->writeRegister(reg, node, comment);
+
+        const triton::arch::Register& parentReg = this->architecture->getParentRegister(reg);
+        triton::ast::SharedAbstractNode parentNode = this->insertSubRegisterInParent(reg, node);
+
+        /* The register is overwritten, its deferred expression is dropped */
+        if (!this->lazyRegisters.empty())
+          this->lazyRegisters.erase(parentReg.getId());
+
+        /* Concrete fast path, the rest of the parent register may be symbolized */
+        if (this->isConcreteFastPath(parentNode)) {
+          if (parentReg.isMutable()) {
+            this->concretizeRegister(parentReg);
+            this->architecture->setConcreteRegisterValue(parentReg, parentNode->evaluate());
+          }
+          inst.setWrittenRegister(reg, node);
+
+          const SharedSymbolicExpression& expr = this->addConcreteExpression(inst, parentNode, REGISTER_EXPRESSION);
+          expr->setOriginRegister(parentReg);
+          return expr;
+        }
+
+        /* In a block, the expression of a flag is only recorded if the flag is read before being written again */
+        if (this->deferFlags && this->enableFlag && parentReg.isMutable() && this->architecture->isFlag(parentReg.getId())) {
+          inst.setWrittenRegister(reg, node);
+          return this->deferFlagExpression(inst, parentNode, parentReg, comment);
+        }
 
-        se = this->newSymbolicExpression(this->insertSubRegisterInParent(reg, node), REGISTER_EXPRESSION, s.str());
-        this->assignSymbolicExpressionToRegister(se, this->architecture->getParentRegister(reg));
+        se = this->newSymbolicExpression(parentNode, REGISTER_EXPRESSION, this->getInstructionComment("", comment, inst));
+        this->assignSymbolicExpressionToRegister(se, parentReg);
 
         inst.setWrittenRegister(reg, node);
         return this->addSymbolicExpressions(inst, id);
@@ -1055,17 +1934,22 @@ namespace triton {
       const SharedSymbolicExpression& SymbolicEngine::createSymbolicVolatileExpression(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, const std::string& comment) {
         triton::usize id = this->uniqueSymExprId;
 
-        std::stringstream s;
-        s << comment << (comment.empty() ? "" : " - ") << inst;
+        if (this->recorder)
+          this->recorder->writeVolatile(node, comment);
 
-        const SharedSymbolicExpression& se = this->newSymbolicExpression(node, VOLATILE_EXPRESSION, s.str());
+        /* Concrete fast path */
+        if (this->isConcreteFastPath(node)) {
+          return this->addConcreteExpression(inst, node, VOLATILE_EXPRESSION);
+        }
+
+        const SharedSymbolicExpression& se = this->newSymbolicExpression(node, VOLATILE_EXPRESSION, this->getInstructionComment("", comment, inst));
         return this->addSymbolicExpressions(inst, id);
       }
 
 
       /* Adds and assign a new memory reference */
       inline void SymbolicEngine::addMemoryReference(triton::uint64 mem, const SharedSymbolicExpression& expr) {
-        this->memoryReference[mem] = expr;
+        this->memoryReference.set(mem, expr);
       }
 
 
@@ -1087,15 +1971,221 @@ namespace triton {
         se->setType(REGISTER_EXPRESSION);
         se->setOriginRegister(reg);
 
+        if (!this->lazyRegisters.empty())
+          this->lazyRegisters.erase(id);
+
+        if (this->inductionBlock)
+          this->blockRegisters.push_back(id);
+
         if (reg.isMutable()) {
           /* Assign if this register is mutable */
-          this->symbolicReg[id] = se;
+          this->symbolicReg.set(id, se);
+          this->registerAsts.erase(id);
           /* Synchronize the concrete state */
           this->architecture->setConcreteRegisterValue(reg, node->evaluate());
         }
       }
 
 
+      void SymbolicEngine::deferSymbolicRegisterExpression(const triton::arch::Instruction& inst, const triton::arch::Register& reg, const std::function<triton::ast::SharedAbstractNode(void)>& node, const std::string& comment, bool tainted) {
+        if (reg.getId() != reg.getParent()) {
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::deferSymbolicRegisterExpression(): We can defer an expression only on parent registers.");
+        }
+
+        LazyRegister& lazy = this->lazyRegisters[reg.getId()];
+        lazy.node    = node;
+        lazy.comment = comment;
+        lazy.address = inst.getAddress();
+        lazy.tainted = tainted;
+      }
+
+
+      void SymbolicEngine::buildLazyRegister(triton::uint32 id) {
+        auto it = this->lazyRegisters.find(id);
+        if (it == this->lazyRegisters.end()) {
+          return;
+        }
+
+        /* Removed before being built, so that the assignment does not look for it again */
+        LazyRegister lazy = std::move(it->second);
+        this->lazyRegisters.erase(it);
+
+        const triton::arch::Register& reg = this->architecture->getRegister(triton::arch::register_e(id));
+
+        /* The expression of a flag deferred in a block is recorded as it was built */
+        if (lazy.detached) {
+          lazy.detached->setComment(this->getDeferredComment(lazy.comment, lazy.address));
+          lazy.detached->setAst(this->applyBudget(this->simplify(lazy.detached->getAst())));
+          this->symbolicExpressions.set(lazy.detached->getId(), lazy.detached);
+          this->assignSymbolicExpressionToRegister(lazy.detached, reg);
+          return;
+        }
+
+        triton::ast::SharedAbstractNode node = lazy.node();
+
+        /* Concrete fast path */
+        if (this->isConcreteFastPath(node)) {
+          this->concretizeRegister(reg);
+          this->architecture->setConcreteRegisterValue(reg, node->evaluate());
+          return;
+        }
+
+        SharedSymbolicExpression se = this->newSymbolicExpression(node, REGISTER_EXPRESSION, this->getDeferredComment(lazy.comment, lazy.address));
+        this->setTaintedExpression(se, lazy.tainted);
+        this->assignSymbolicExpressionToRegister(se, reg);
+      }
+
+
+      void SymbolicEngine::buildLazyRegisters(const triton::arch::Register& reg) {
+        if (this->lazyRegisters.empty()) {
+          return;
+        }
+
+        /* The flags register of x86 holds the concrete values of all flags */
+        if (reg.getId() == triton::arch::ID_REG_X86_EFLAGS) {
+          this->buildLazyRegisters();
+          return;
+        }
+
+        this->buildLazyRegister(reg.getParent());
+      }
+
+
+      void SymbolicEngine::buildLazyRegisters(void) {
+        while (!this->lazyRegisters.empty()) {
+          this->buildLazyRegister(this->lazyRegisters.begin()->first);
+        }
+      }
+
+
+      const SharedSymbolicExpression& SymbolicEngine::deferFlagExpression(const triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, const triton::arch::Register& flag, const std::string& comment) {
+        LazyRegister& lazy = this->lazyRegisters[flag.getId()];
+        lazy.node     = nullptr;
+        lazy.comment  = comment;
+        lazy.address  = inst.getAddress();
+        lazy.tainted  = false;
+        lazy.detached = std::make_shared<SymbolicExpression>(node, this->getUniqueSymExprId(), REGISTER_EXPRESSION);
+        lazy.detached->setOriginRegister(flag);
+
+        /* The concrete value is synchronized now, the next semantics of the block may read it */
+        this->architecture->setConcreteRegisterValue(flag, node->evaluate());
+
+        return lazy.detached;
+      }
+
+
+      void SymbolicEngine::beginBlock(triton::uint64 addr) {
+        /* The taint of the expressions is checked by the IR builder once the instruction is built */
+        this->deferFlags     = this->modes->isModeEnabled(triton::modes::DEAD_FLAGS_ELIMINATION) && !this->modes->isModeEnabled(triton::modes::ONLY_ON_TAINTED);
+        this->inductionBlock = this->modes->isModeEnabled(triton::modes::LOOP_INDUCTION_VARIABLES);
+        this->blockAddress   = addr;
+        this->blockRegisters.clear();
+      }
+
+
+      void SymbolicEngine::endBlock(void) {
+        std::vector<triton::uint32> live;
+
+        this->deferFlags = false;
+        for (const auto& it : this->lazyRegisters) {
+          if (it.second.detached)
+            live.push_back(it.first);
+        }
+
+        for (triton::uint32 id : live)
+          this->buildLazyRegister(id);
+
+        if (this->inductionBlock) {
+          this->inductionBlock = false;
+          this->collapseInductionVariables();
+          this->blockRegisters.clear();
+        }
+      }
+
+
+      /* Returns true if `node` is the reference of `last` plus a constant `step`, over the whole register or over its low `width` bits zero extended */
+      static bool getInductionStep(const triton::ast::SharedAbstractNode& node, const SymbolicExpression* last, triton::uint512& step, triton::uint32& width) {
+        triton::ast::SharedAbstractNode op = node;
+
+        if (op->getType() == triton::ast::ZX_NODE)
+          op = op->getChildren()[1];
+
+        if ((op->getType() != triton::ast::BVADD_NODE && op->getType() != triton::ast::BVSUB_NODE) || op->getChildren().size() != 2 || op->getChildren()[1]->getType() != triton::ast::BV_NODE)
+          return false;
+
+        triton::ast::SharedAbstractNode var = op->getChildren()[0];
+        width = op->getBitvectorSize();
+
+        /* The low part of the register, e.g. a 32-bit register of x86-64 */
+        if (width != node->getBitvectorSize()) {
+          if (var->getType() != triton::ast::EXTRACT_NODE || var->getChildren()[1]->evaluate() != 0)
+            return false;
+          var = var->getChildren()[2];
+        }
+
+        if (var->getType() != triton::ast::REFERENCE_NODE || reinterpret_cast<triton::ast::ReferenceNode*>(var.get())->getSymbolicExpression().get() != last)
+          return false;
+
+        step = op->getChildren()[1]->evaluate();
+        if (op->getType() == triton::ast::BVSUB_NODE)
+          step = (op->getBitvectorMask() + 1 - step) & op->getBitvectorMask();
+
+        return step != 0;
+      }
+
+
+      void SymbolicEngine::collapseInductionVariables(void) {
+        auto& registers = this->inductionVariables[this->blockAddress];
+
+        std::sort(this->blockRegisters.begin(), this->blockRegisters.end());
+        this->blockRegisters.erase(std::unique(this->blockRegisters.begin(), this->blockRegisters.end()), this->blockRegisters.end());
+
+        for (triton::uint32 id : this->blockRegisters) {
+          const SharedSymbolicExpression* current = this->symbolicReg.find(id);
+          if (current == nullptr || *current == nullptr)
+            continue;
+
+          SharedSymbolicExpression expr = *current;
+          auto it = registers.find(id);
+          if (it == registers.end()) {
+            registers[id] = InductionVariable{expr, nullptr, 0, 0};
+            continue;
+          }
+
+          /* The register is the one of the previous execution plus a step, otherwise it is not an induction variable (yet) */
+          InductionVariable& var = it->second;
+          triton::uint512 step   = 0;
+          triton::uint32 width   = 0;
+          if (!getInductionStep(expr->getAst(), var.last.get(), step, width)) {
+            var = InductionVariable{expr, nullptr, 0, 0};
+            continue;
+          }
+
+          /* The first step is kept, its expression is already the base plus the step */
+          if (var.base == nullptr || var.width != width) {
+            var = InductionVariable{expr, var.last, step, width};
+            continue;
+          }
+
+          /* The next ones are rewritten as the base plus the sum of the steps, the chain of the previous executions is not referenced anymore */
+          const triton::arch::Register& reg = this->architecture->getRegister(static_cast<triton::arch::register_e>(id));
+          var.offset = (var.offset + step) & ((triton::uint512(1) << width) - 1);
+
+          triton::ast::SharedAbstractNode base = this->astCtxt->reference(var.base);
+          triton::ast::SharedAbstractNode node = nullptr;
+          if (width == reg.getBitSize())
+            node = this->astCtxt->bvadd(base, this->astCtxt->bv(var.offset, width));
+          else
+            node = this->astCtxt->zx(reg.getBitSize() - width, this->astCtxt->bvadd(this->astCtxt->extract(width - 1, 0, base), this->astCtxt->bv(var.offset, width)));
+
+          const SharedSymbolicExpression& se = this->newSymbolicExpression(node, REGISTER_EXPRESSION, "Induction variable");
+          this->setTaintedExpression(se, expr->isTainted);
+          this->assignSymbolicExpressionToRegister(se, reg);
+          var.last = se;
+        }
+      }
+
+
       /* Assigns a symbolic expression to a memory */
       void SymbolicEngine::assignSymbolicExpressionToMemory(const SharedSymbolicExpression& se, const triton::arch::MemoryAccess& mem) {
         const triton::ast::SharedAbstractNode& node = se->getAst();
@@ -1144,10 +2234,10 @@ namespace triton {
 
       /* Returns true if the symbolic expression ID exists */
       bool SymbolicEngine::isSymbolicExpressionExists(triton::usize symExprId) const {
-        auto it = this->symbolicExpressions.find(symExprId);
+        const WeakSymbolicExpression* weak = this->symbolicExpressions.find(symExprId);
 
-        if (it != this->symbolicExpressions.end()) {
-          return (it->second.use_count() > 0);
+        if (weak != nullptr) {
+          return (weak->use_count() > 0);
         }
 
         return false;
@@ -1165,13 +2255,7 @@ namespace triton {
 
       /* Returns true if memory cell expressions contain symbolic variables. */
       bool SymbolicEngine::isMemorySymbolized(triton::uint64 addr, triton::uint32 size) const {
-        for (triton::uint32 i = 0; i < size; i++) {
-          const SharedSymbolicExpression& expr = this->getSymbolicMemory(addr + i);
-          if (expr && expr->isSymbolized()) {
-            return true;
-          }
-        }
-        return false;
+        return this->memoryReference.isSymbolized(addr, size);
       }
 
 
@@ -1191,6 +2275,208 @@ namespace triton {
       }
 
 
+      void SymbolicEngine::setSemanticsRecorder(SemanticsCache* recorder) {
+        this->recorder = recorder;
+      }
+
+
+      void SymbolicEngine::setConcreteSemantics(bool flag) {
+        this->concreteSemantics = flag;
+      }
+
+
+      void SymbolicEngine::setSolver(const triton::engines::solver::SolverEngine* solver) {
+        this->solver = solver;
+      }
+
+
+      triton::engines::symbolic::ConcretizationPolicy* SymbolicEngine::getConcretizationPolicy(void) {
+        return &this->concretization;
+      }
+
+
+      void SymbolicEngine::setBudget(triton::uint32 maxDepth, triton::usize maxNodes, triton::usize maxExpressions, triton::engines::symbolic::budget_policy_e policy) {
+        switch (policy) {
+          case CONCRETIZE_DEEPEST_EXPRESSIONS:
+          case CONCRETIZE_OLDEST_MEMORY:
+          case REFUSE_NEW_SYMBOLS:
+            break;
+          default:
+            throw triton::exceptions::SymbolicEngine("SymbolicEngine::setBudget(): Invalid budget policy.");
+        }
+
+        this->maxDepth       = maxDepth;
+        this->maxNodes       = maxNodes;
+        this->maxExpressions = maxExpressions;
+        this->budgetPolicy   = policy;
+      }
+
+
+      triton::uint32 SymbolicEngine::getMaximumDepth(void) const {
+        return this->maxDepth;
+      }
+
+
+      triton::usize SymbolicEngine::getMaximumNodes(void) const {
+        return this->maxNodes;
+      }
+
+
+      triton::usize SymbolicEngine::getMaximumExpressions(void) const {
+        return this->maxExpressions;
+      }
+
+
+      triton::engines::symbolic::budget_policy_e SymbolicEngine::getBudgetPolicy(void) const {
+        return this->budgetPolicy;
+      }
+
+
+      void SymbolicEngine::setDepthLimit(triton::uint32 depth, triton::engines::symbolic::depth_policy_e policy) {
+        switch (policy) {
+          case CONCRETIZE_DEEP_EXPRESSION:
+          case SYMBOLIZE_DEEP_EXPRESSION:
+            break;
+          default:
+            throw triton::exceptions::SymbolicEngine("SymbolicEngine::setDepthLimit(): Invalid depth policy.");
+        }
+
+        if (depth == 0)
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::setDepthLimit(): The depth limit must be at least one.");
+
+        this->depthLimit  = depth;
+        this->depthPolicy = policy;
+      }
+
+
+      triton::uint32 SymbolicEngine::getDepthLimit(void) const {
+        return this->depthLimit;
+      }
+
+
+      triton::engines::symbolic::depth_policy_e SymbolicEngine::getDepthPolicy(void) const {
+        return this->depthPolicy;
+      }
+
+
+      bool SymbolicEngine::isBudgetExceeded(void) const {
+        if (this->maxNodes) {
+          const triton::ast::SharedNodePool& pool = this->astCtxt->getNodePool();
+          if (pool->getAllocations() - pool->getDeallocations() > this->maxNodes)
+            return true;
+        }
+
+        /* Expired expressions are counted until the table compacts them */
+        if (this->maxExpressions && this->symbolicExpressions.size() > this->maxExpressions)
+          return true;
+
+        return false;
+      }
+
+
+      void SymbolicEngine::getMemoryUsage(triton::MemoryUsage& usage) const {
+        /* Expired expressions are counted until the table compacts them */
+        usage.symbolicExpressions.count = this->symbolicExpressions.size();
+        usage.symbolicExpressions.bytes = this->symbolicExpressions.size() * sizeof(SymbolicExpression);
+
+        usage.symbolicMemory.count      = this->memoryReference.size();
+        usage.symbolicMemory.bytes      = this->memoryReference.getBytes();
+        usage.alignedMemory.count       = this->alignedMemoryReference.size();
+        usage.alignedMemory.bytes       = this->alignedMemoryReference.getBytes();
+        usage.pathConstraints.count     = this->getSizeOfPathConstraints();
+        usage.pathConstraints.bytes     = this->getSizeOfPathConstraints() * sizeof(PathConstraint);
+      }
+
+
+      triton::ast::SharedAbstractNode SymbolicEngine::applyBudget(const triton::ast::SharedAbstractNode& node) {
+        /* Only symbolic bitvectors are concretized, the others are already as small as their value */
+        if (!node->isSymbolized() || node->isLogical())
+          return node;
+
+        /* A fresh variable cuts the AST as a constant does, but keeps the value free for the solver */
+        if (this->modes->isModeEnabled(triton::modes::AST_DEPTH_LIMIT) && node->getLevel() > this->depthLimit) {
+          bool refused = (this->budgetPolicy == REFUSE_NEW_SYMBOLS && this->isBudgetExceeded());
+          if (this->depthPolicy == SYMBOLIZE_DEEP_EXPRESSION && !refused) {
+            const SharedSymbolicVariable& symVar = this->newSymbolicVariable(UNDEFINED_VARIABLE, 0, node->getBitvectorSize());
+            this->setConcreteVariableValue(symVar, node->evaluate());
+            return this->astCtxt->variable(symVar);
+          }
+          return this->astCtxt->bv(node->evaluate(), node->getBitvectorSize());
+        }
+
+        bool concretize = (this->maxDepth && node->getLevel() > this->maxDepth);
+
+        if (!concretize && this->isBudgetExceeded()) {
+          if (this->budgetPolicy == REFUSE_NEW_SYMBOLS) {
+            concretize = true;
+          }
+          /* Concretizations are spaced out, the nodes they release are only freed once unreferenced */
+          else if (this->uniqueSymExprId >= this->nextEviction) {
+            this->nextEviction = this->uniqueSymExprId + evictionInterval;
+            if (this->budgetPolicy == CONCRETIZE_OLDEST_MEMORY)
+              this->concretizeOldestMemory();
+            else
+              this->concretizeDeepestExpressions();
+          }
+        }
+
+        if (concretize)
+          return this->astCtxt->bv(node->evaluate(), node->getBitvectorSize());
+
+        return node;
+      }
+
+
+      void SymbolicEngine::concretizeOldestMemory(void) {
+        std::vector<std::pair<triton::usize, triton::uint64>> cells;
+
+        cells.reserve(this->memoryReference.size());
+        this->memoryReference.forEach([&cells](triton::uint64 addr, const SharedSymbolicExpression& expr) {
+          cells.push_back({expr->getId(), addr});
+        });
+
+        /* Expression ids are increasing, the lowest ones are the oldest */
+        auto half = cells.begin() + (cells.size() + 1) / 2;
+        std::nth_element(cells.begin(), half, cells.end());
+        for (auto it = cells.begin(); it != half; ++it) {
+          this->concretizeMemory(it->second);
+        }
+      }
+
+
+      void SymbolicEngine::concretizeDeepestExpressions(void) {
+        std::vector<std::pair<triton::uint32, triton::uint64>> memory;
+        std::vector<std::pair<triton::uint32, triton::uint64>> registers;
+
+        this->memoryReference.forEach([&memory](triton::uint64 addr, const SharedSymbolicExpression& expr) {
+          memory.push_back({expr->getAst()->getLevel(), addr});
+        });
+
+        this->symbolicReg.forEach([&registers](triton::uint32 id, const SharedSymbolicExpression& expr) {
+          if (expr != nullptr)
+            registers.push_back({expr->getAst()->getLevel(), id});
+        });
+
+        /* The deepest half of each state */
+        auto deepest = [](const std::pair<triton::uint32, triton::uint64>& a, const std::pair<triton::uint32, triton::uint64>& b) {
+          return a.first > b.first;
+        };
+
+        auto mhalf = memory.begin() + (memory.size() + 1) / 2;
+        std::nth_element(memory.begin(), mhalf, memory.end(), deepest);
+        for (auto it = memory.begin(); it != mhalf; ++it) {
+          this->concretizeMemory(it->second);
+        }
+
+        auto rhalf = registers.begin() + (registers.size() + 1) / 2;
+        std::nth_element(registers.begin(), rhalf, registers.end(), deepest);
+        for (auto it = registers.begin(); it != rhalf; ++it) {
+          this->symbolicReg.erase(static_cast<triton::uint32>(it->second));
+          this->registerAsts.erase(static_cast<triton::uint32>(it->second));
+        }
+      }
+
+
       /* Initializes the memory access AST (LOAD and STORE) */
       void SymbolicEngine::initLeaAst(triton::arch::MemoryAccess& mem, bool force) {
         if (mem.getBitSize() >= bitsize::byte) {
@@ -1242,7 +2528,7 @@ namespace triton {
 
 
       triton::uint512 SymbolicEngine::getConcreteVariableValue(const SharedSymbolicVariable& symVar) const {
-        return this->astCtxt->getVariableValue(symVar->getName());
+        return this->astCtxt->getVariableValue(symVar->getId());
       }
 
 
@@ -1256,8 +2542,37 @@ namespace triton {
         }
 
         /* Update the symbolic variable value */
-        this->astCtxt->updateVariable(symVar->getName(), value);
+        this->astCtxt->updateVariable(symVar->getId(), value);
+
+        this->synchronizeConcreteVariable(symVar, value);
+      }
+
+
+      void SymbolicEngine::setConcreteVariableValues(const std::unordered_map<triton::usize, triton::engines::solver::SolverModel>& model) {
+        std::vector<std::pair<triton::usize, triton::uint512>> values;
+
+        /* Check all the values before updating one */
+        for (const auto& item : model) {
+          const SharedSymbolicVariable& symVar = item.second.getVariable();
+          triton::uint512 value = item.second.getValue();
+          triton::uint512 max = -1;
+
+          max = max >> (512 - symVar->getSize());
+          if (value > max) {
+            throw triton::exceptions::SymbolicEngine("SymbolicEngine::setConcreteVariableValues(): Can not set this value (too big) to this symbolic variable.");
+          }
+          values.push_back({symVar->getId(), value});
+        }
+
+        /* Update the symbolic variable values in one pass */
+        this->astCtxt->updateVariables(values);
+
+        for (const auto& item : model)
+          this->synchronizeConcreteVariable(item.second.getVariable(), item.second.getValue());
+      }
+
 
+      void SymbolicEngine::synchronizeConcreteVariable(const SharedSymbolicVariable& symVar, const triton::uint512& value) {
         /* Synchronize concrete state */
         if (symVar->getType() == REGISTER_VARIABLE) {
           const triton::arch::Register& reg = this->architecture->getRegister(static_cast<triton::arch::register_e>(symVar->getOrigin()));
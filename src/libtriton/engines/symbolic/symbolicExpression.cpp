@@ -8,6 +8,7 @@
 #include <iosfwd>
 #include <string>
 #include <sstream>
+#include <unordered_set>
 
 #include <triton/ast.hpp>
 #include <triton/astContext.hpp>
@@ -23,36 +24,53 @@ namespace triton {
   namespace engines {
     namespace symbolic {
 
+      /*
+       * A shared constant is frozen and does not track its parents. The AST of an
+       * expression gets its own constant, so that the references to the expression
+       * stay linked to it when the AST is replaced (e.g. symbolizeExpression()).
+       */
+      static triton::ast::SharedAbstractNode ownConstant(const triton::ast::SharedAbstractNode& node) {
+        if (node != nullptr && node->isFrozen() && node->getType() == triton::ast::BV_NODE)
+          return node->getContext()->bv(node->evaluate(), node->getBitvectorSize(), false);
+        return node;
+      }
+
+
       SymbolicExpression::SymbolicExpression(const triton::ast::SharedAbstractNode& node, triton::usize id, triton::engines::symbolic::expression_e type, const std::string& comment)
         : originMemory(),
           originRegister() {
-        this->ast           = node;
-        this->comment       = comment;
+        this->ast           = ownConstant(node);
         this->id            = id;
-        this->isTainted     = false;
-        this->type          = type;
+        this->isTainted        = false;
+        this->referencesCached = false;
+        this->type             = type;
+        this->setComment(comment);
       }
 
 
       SymbolicExpression::SymbolicExpression(const SymbolicExpression& other) {
-        this->ast            = other.ast;
-        this->comment        = other.comment;
-        this->id             = other.id;
-        this->isTainted      = other.isTainted;
-        this->originMemory   = other.originMemory;
-        this->originRegister = other.originRegister;
-        this->type           = other.type;
+        this->ast              = other.ast;
+        this->comment          = other.comment;
+        this->id               = other.id;
+        this->isTainted        = other.isTainted;
+        this->originMemory     = other.originMemory;
+        this->originRegister   = other.originRegister;
+        this->references       = other.references;
+        this->referencesCached = other.referencesCached;
+        this->type             = other.type;
       }
 
 
       SymbolicExpression& SymbolicExpression::operator=(const SymbolicExpression& other) {
-        this->ast            = other.ast;
-        this->comment        = other.comment;
-        this->id             = other.id;
-        this->isTainted      = other.isTainted;
-        this->originMemory   = other.originMemory;
-        this->originRegister = other.originRegister;
-        this->type           = other.type;
+        this->ast              = other.ast;
+        this->comment          = other.comment;
+        this->id               = other.id;
+        this->isTainted        = other.isTainted;
+        this->originMemory     = other.originMemory;
+        this->originRegister   = other.originRegister;
+        this->references       = other.references;
+        this->referencesCached = other.referencesCached;
+        this->type             = other.type;
         return *this;
       }
 
@@ -72,7 +90,48 @@ namespace triton {
 
 
       const std::string& SymbolicExpression::getComment(void) const {
-        return this->comment;
+        static const std::string none;
+        return this->comment ? *this->comment : none;
+      }
+
+
+      std::vector<SharedSymbolicExpression> SymbolicExpression::getReferences(void) const {
+        std::vector<SharedSymbolicExpression> ret;
+
+        if (!this->referencesCached) {
+          std::vector<triton::ast::AbstractNode*> worklist = {this->ast.get()};
+          std::unordered_set<const triton::ast::AbstractNode*> visited;
+          std::unordered_set<const SymbolicExpression*> found;
+
+          this->references.clear();
+          while (!worklist.empty()) {
+            triton::ast::AbstractNode* node = worklist.back();
+            worklist.pop_back();
+
+            if (!visited.insert(node).second)
+              continue;
+
+            /* References are not unrolled */
+            if (node->getType() == triton::ast::REFERENCE_NODE) {
+              const SharedSymbolicExpression& expr = reinterpret_cast<const triton::ast::ReferenceNode*>(node)->getSymbolicExpression();
+              if (found.insert(expr.get()).second)
+                this->references.push_back(expr);
+              continue;
+            }
+
+            for (const auto& child : node->getChildren())
+              worklist.push_back(child.get());
+          }
+          this->referencesCached = true;
+        }
+
+        ret.reserve(this->references.size());
+        for (const auto& weak : this->references) {
+          if (auto expr = weak.lock())
+            ret.push_back(expr);
+        }
+
+        return ret;
       }
 
 
@@ -116,26 +175,8 @@ namespace triton {
 
       std::string SymbolicExpression::getFormattedExpression(void) const {
         std::ostringstream stream;
-
-        if (this->ast == nullptr)
-          throw triton::exceptions::SymbolicExpression("SymbolicExpression::getFormattedExpression(): No AST defined.");
-
-        else if (ast->getContext()->getRepresentationMode() == triton::ast::representations::SMT_REPRESENTATION) {
-          stream << "(define-fun " << this->getFormattedId() << " () (_ BitVec " << std::dec << this->getAst()->getBitvectorSize() << ") " << this->getAst() << ")";
-          if (!this->getComment().empty())
-            stream << " " << this->getFormattedComment();
-          return stream.str();
-        }
-
-        else if (ast->getContext()->getRepresentationMode() == triton::ast::representations::PYTHON_REPRESENTATION) {
-          stream << this->getFormattedId() << " = " << this->getAst();
-          if (!this->getComment().empty())
-            stream << " " << this->getFormattedComment();
-          return stream.str();
-        }
-
-        else
-          throw triton::exceptions::SymbolicExpression("SymbolicExpression::getFormattedExpression(): Invalid AST representation mode.");
+        stream << *this;
+        return stream.str();
       }
 
 
@@ -154,8 +195,9 @@ namespace triton {
       }
 
 
-      void SymbolicExpression::setAst(const triton::ast::SharedAbstractNode& node) {
-        triton::ast::SharedAbstractNode old = this->ast;
+      void SymbolicExpression::setAst(const triton::ast::SharedAbstractNode& ast) {
+        triton::ast::SharedAbstractNode node = ownConstant(ast);
+        triton::ast::SharedAbstractNode old  = this->ast;
 
         /* If node is the same as the old one, just do not set the ast. */
         if (node == old)
@@ -170,15 +212,25 @@ namespace triton {
 
         /* Set the new ast */
         this->ast = node;
+        this->referencesCached = false;
+        this->references.clear();
+
+        /* References to this expression now unroll to another tree */
+        this->ast->getContext()->bumpChildrenVersion();
 
         /* Do not init parents if the new node has same properties that the old one */
-        if (!old || !old->canReplaceNodeWithoutUpdate(ast)) {
+        if (!old || !old->canReplaceNodeWithoutUpdate(node)) {
           this->ast->initParents();
         }
       }
 
 
       void SymbolicExpression::setComment(const std::string& comment) {
+        this->comment = comment.empty() ? nullptr : std::make_shared<const std::string>(comment);
+      }
+
+
+      void SymbolicExpression::setComment(const std::shared_ptr<const std::string>& comment) {
         this->comment = comment;
       }
 
@@ -216,7 +268,24 @@ namespace triton {
 
 
       std::ostream& operator<<(std::ostream& stream, const SymbolicExpression& symExpr) {
-        stream << symExpr.getFormattedExpression();
+        const auto& ast = symExpr.getAst();
+
+        if (ast == nullptr)
+          throw triton::exceptions::SymbolicExpression("SymbolicExpression::getFormattedExpression(): No AST defined.");
+
+        /* The AST is printed straight into the stream, it may be huge */
+        else if (ast->getContext()->getRepresentationMode() == triton::ast::representations::SMT_REPRESENTATION)
+          stream << "(define-fun " << symExpr.getFormattedId() << " () (_ BitVec " << std::dec << ast->getBitvectorSize() << ") " << ast << ")";
+
+        else if (ast->getContext()->getRepresentationMode() == triton::ast::representations::PYTHON_REPRESENTATION)
+          stream << symExpr.getFormattedId() << " = " << ast;
+
+        else
+          throw triton::exceptions::SymbolicExpression("SymbolicExpression::getFormattedExpression(): Invalid AST representation mode.");
+
+        if (!symExpr.getComment().empty())
+          stream << " " << symExpr.getFormattedComment();
+
         return stream;
       }
 
@@ -0,0 +1,255 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+
+#include <triton/symbolicMemory.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace symbolic {
+
+      SymbolicMemory::SymbolicMemory() {
+        this->count = 0;
+        this->pages.setStaleLimit(stalePages);
+      }
+
+
+      const SharedSymbolicExpression& SymbolicMemory::get(triton::uint64 addr) const {
+        static const SharedSymbolicExpression none = nullptr;
+
+        const std::shared_ptr<Page>* page = this->pages.find(addr >> pageBits);
+        if (page == nullptr)
+          return none;
+
+        return (*page)->slots[addr & (pageSize - 1)];
+      }
+
+
+      void SymbolicMemory::get(triton::uint64 addr, triton::usize size, SharedSymbolicExpression* exprs) const {
+        while (size) {
+          triton::uint32 offset = addr & (pageSize - 1);
+          triton::usize  length = std::min<triton::usize>(size, pageSize - offset);
+
+          /* One lookup per page crossed */
+          const std::shared_ptr<Page>* page = this->pages.find(addr >> pageBits);
+          for (triton::usize index = 0; index < length; index++) {
+            exprs[index] = page ? (*page)->slots[offset + index] : nullptr;
+          }
+
+          addr  += length;
+          exprs += length;
+          size  -= length;
+        }
+      }
+
+
+      void SymbolicMemory::set(triton::uint64 addr, const SharedSymbolicExpression& expr) {
+        if (expr == nullptr) {
+          this->erase(addr);
+          return;
+        }
+
+        triton::uint32 offset = addr & (pageSize - 1);
+        std::shared_ptr<Page>& page = this->pages.modify(addr >> pageBits);
+
+        if (page == nullptr) {
+          page = std::make_shared<Page>();
+        }
+        /* Copy on write */
+        else if (page.use_count() > 1) {
+          page = std::make_shared<Page>(*page);
+        }
+
+        if (page->slots[offset] == nullptr) {
+          page->count++;
+          this->count++;
+        }
+        page->slots[offset] = expr;
+      }
+
+
+      void SymbolicMemory::set(triton::uint64 addr, triton::usize size, const SharedSymbolicExpression* exprs) {
+        while (size) {
+          triton::uint32 offset = addr & (pageSize - 1);
+          triton::usize  length = std::min<triton::usize>(size, pageSize - offset);
+          triton::uint64 number = addr >> pageBits;
+          bool           empty  = true;
+
+          for (triton::usize index = 0; index < length && empty; index++) {
+            empty = (exprs[index] == nullptr);
+          }
+
+          /* A concrete chunk does not allocate its page */
+          if (empty) {
+            this->erase(addr, length);
+          }
+          else {
+            std::shared_ptr<Page>& page = this->pages.modify(number);
+            if (page == nullptr)
+              page = std::make_shared<Page>();
+            else if (page.use_count() > 1)
+              page = std::make_shared<Page>(*page);
+
+            for (triton::usize index = 0; index < length; index++) {
+              SharedSymbolicExpression& slot = page->slots[offset + index];
+              if (slot == nullptr && exprs[index] != nullptr) {
+                page->count++;
+                this->count++;
+              }
+              else if (slot != nullptr && exprs[index] == nullptr) {
+                page->count--;
+                this->count--;
+              }
+              slot = exprs[index];
+            }
+
+            if (page->count == 0)
+              this->pages.erase(number);
+          }
+
+          addr  += length;
+          exprs += length;
+          size  -= length;
+        }
+      }
+
+
+      void SymbolicMemory::copy(triton::uint64 dst, triton::uint64 src, triton::usize size) {
+        std::vector<SharedSymbolicExpression> exprs(std::min<triton::usize>(size, pageSize));
+        bool backward = (dst > src);
+
+        /*
+         * The area is copied by chunks of a page, each one is read before being written.
+         * If the destination is after the source, the chunks are copied from the end so
+         * that a chunk never overwrites the part of the source not yet copied.
+         */
+        while (size) {
+          triton::usize  length = std::min<triton::usize>(size, pageSize);
+          triton::uint64 from   = backward ? (src + size - length) : src;
+          triton::uint64 to     = backward ? (dst + size - length) : dst;
+
+          /* A concrete chunk releases the pages it covers */
+          this->get(from, length, exprs.data());
+          this->set(to, length, exprs.data());
+
+          if (!backward) {
+            src += length;
+            dst += length;
+          }
+          size -= length;
+        }
+      }
+
+
+      void SymbolicMemory::erase(triton::uint64 addr) {
+        triton::uint32 offset = addr & (pageSize - 1);
+
+        if (this->get(addr) == nullptr)
+          return;
+
+        std::shared_ptr<Page>& page = this->pages.modify(addr >> pageBits);
+        if (page.use_count() > 1)
+          page = std::make_shared<Page>(*page);
+
+        page->slots[offset] = nullptr;
+        page->count--;
+        this->count--;
+
+        if (page->count == 0)
+          this->pages.erase(addr >> pageBits);
+      }
+
+
+      void SymbolicMemory::erase(triton::uint64 addr, triton::usize size) {
+        while (size) {
+          triton::uint32 offset = addr & (pageSize - 1);
+          triton::usize  length = std::min<triton::usize>(size, pageSize - offset);
+          triton::uint64 number = addr >> pageBits;
+
+          const std::shared_ptr<Page>* found = this->pages.find(number);
+          if (found != nullptr) {
+            if (length == pageSize) {
+              this->count -= (*found)->count;
+              this->pages.erase(number);
+            }
+            else {
+              std::shared_ptr<Page>& page = this->pages.modify(number);
+              if (page.use_count() > 1)
+                page = std::make_shared<Page>(*page);
+
+              for (triton::usize index = 0; index < length; index++) {
+                if (page->slots[offset + index] != nullptr) {
+                  page->slots[offset + index] = nullptr;
+                  page->count--;
+                  this->count--;
+                }
+              }
+
+              if (page->count == 0)
+                this->pages.erase(number);
+            }
+          }
+
+          addr += length;
+          size -= length;
+        }
+      }
+
+
+      bool SymbolicMemory::isSymbolized(triton::uint64 addr, triton::usize size) const {
+        while (size) {
+          triton::uint32 offset = addr & (pageSize - 1);
+          triton::usize  length = std::min<triton::usize>(size, pageSize - offset);
+
+          const std::shared_ptr<Page>* page = this->pages.find(addr >> pageBits);
+          if (page != nullptr) {
+            for (triton::usize index = 0; index < length; index++) {
+              const SharedSymbolicExpression& expr = (*page)->slots[offset + index];
+              if (expr && expr->isSymbolized())
+                return true;
+            }
+          }
+
+          addr += length;
+          size -= length;
+        }
+        return false;
+      }
+
+
+      void SymbolicMemory::clear(void) {
+        this->pages.clear();
+        this->count = 0;
+      }
+
+
+      void SymbolicMemory::discard(void) {
+        this->pages.discard();
+        this->count = 0;
+      }
+
+
+      triton::usize SymbolicMemory::size(void) const {
+        return this->count;
+      }
+
+
+      triton::usize SymbolicMemory::getNumberOfPages(void) const {
+        return this->pages.size();
+      }
+
+
+      triton::usize SymbolicMemory::getBytes(void) const {
+        return this->pages.size() * sizeof(Page);
+      }
+
+    }; /* symbolic namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
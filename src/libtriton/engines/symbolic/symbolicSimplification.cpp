@@ -5,8 +5,11 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <algorithm>
 #include <list>
+#include <tuple>
 #include <triton/exceptions.hpp>
+#include <triton/simplificationPasses.hpp>
 #include <triton/symbolicSimplification.hpp>
 
 
@@ -104,6 +107,20 @@ if __name__ == "__main__":
     print 'Simp: ', c
 ~~~~~~~~~~~~~
 
+\subsection SMT_simplification_native Native simplification passes
+<hr>
+
+The common rules are shipped as native passes (see triton::engines::symbolic::SimplificationPasses), selected by name with
+triton::API::addSimplificationPass() and applied before the callbacks, much faster than the same rules written in Python.
+The `mba-linear` pass normalizes the linear mixed boolean-arithmetic expressions, e.g. \f$ (A \land B) + (A \lor B) \rightarrow A + B \f$.
+
+~~~~~~~~~~~~~{.py}
+>>> ctx.addSimplificationPass("complement")
+>>> ctx.addSimplificationPass("mba-linear")
+>>> print(ctx.simplify((x | y) - (x & y)))
+(bvxor x y)
+~~~~~~~~~~~~~
+
 \subsection SMT_simplification_z3 Simplification via Z3
 <hr>
 
@@ -158,7 +175,11 @@ namespace triton {
 
 
       SymbolicSimplification::SymbolicSimplification(triton::callbacks::Callbacks* callbacks) {
-        this->callbacks = callbacks;
+        this->callbacks     = callbacks;
+        this->passesVersion = 0;
+        this->maxIterations = 16;
+        this->memoLimit     = 4096;
+        this->memoHits      = 0;
       }
 
 
@@ -168,48 +189,244 @@ namespace triton {
 
 
       void SymbolicSimplification::copy(const SymbolicSimplification& other) {
-        this->callbacks = other.callbacks;
+        this->callbacks     = other.callbacks;
+        this->passes        = other.passes;
+        this->passesVersion = other.passesVersion;
+        this->maxIterations = other.maxIterations;
+        this->memoLimit     = 4096;
+        this->memoHits      = 0;
+        this->memo.clear();
+        this->passStatistics.clear();
+      }
+
+
+      triton::usize SymbolicSimplification::getVersion(void) const {
+        /* Both versions only grow, so does their sum on any change */
+        return this->passesVersion + (this->callbacks ? this->callbacks->getSimplificationVersion() : 0);
+      }
+
+
+      triton::ast::SharedAbstractNode SymbolicSimplification::findMemo(const triton::ast::SharedAbstractNode& node, triton::usize version) const {
+        auto it = this->memo.find(node.get());
+        if (it == this->memo.end())
+          return nullptr;
+
+        const Memo& entry = it->second;
+        if (entry.version != version || entry.node.lock() != node || entry.hash != node->getHash())
+          return nullptr;
+
+        /* The result must not have been changed in place since */
+        auto result = entry.result.lock();
+        if (result == nullptr || result->getHash() != entry.resultHash)
+          return nullptr;
+
+        this->memoHits++;
+        return result;
+      }
+
+
+      void SymbolicSimplification::addMemo(const triton::ast::SharedAbstractNode& node, const triton::ast::SharedAbstractNode& result, triton::usize version) const {
+        if (this->memo.size() >= this->memoLimit) {
+          for (auto it = this->memo.begin(); it != this->memo.end();) {
+            if (it->second.node.expired() || it->second.result.expired())
+              it = this->memo.erase(it);
+            else
+              ++it;
+          }
+          this->memoLimit = std::max<triton::usize>(4096, this->memo.size() * 2);
+        }
+
+        Memo& entry      = this->memo[node.get()];
+        entry.node       = node;
+        entry.result     = result;
+        entry.hash       = node->getHash();
+        entry.resultHash = result->getHash();
+        entry.version    = version;
+      }
+
+
+      triton::ast::SharedAbstractNode SymbolicSimplification::rewrite(const triton::ast::SharedAbstractNode& node) const {
+        bool cbs = this->callbacks && this->callbacks->isDefined(triton::callbacks::SYMBOLIC_SIMPLIFICATION);
+        triton::ast::SharedAbstractNode snode = node;
+
+        for (triton::uint32 i = 0; i < this->maxIterations; i++) {
+          auto previous = snode;
+          auto hash     = previous->getHash();
+
+          for (const auto& pass : this->passes) {
+            auto& stats = this->passStatistics[pass.name];
+            auto rnode  = pass.rule(snode);
+            stats.calls++;
+            if (rnode == nullptr)
+              throw triton::exceptions::SymbolicSimplification("SymbolicSimplification::rewrite(): The pass " + pass.name + " returned a null node.");
+            if (rnode != snode) {
+              stats.rewrites++;
+              snode = rnode;
+            }
+          }
+
+          if (cbs)
+            snode = this->callbacks->processCallbacks(triton::callbacks::SYMBOLIC_SIMPLIFICATION, snode);
+
+          /* Fixed point, the node is unchanged */
+          if (snode == previous || snode->getHash() == hash)
+            break;
+        }
+
+        return snode;
       }
 
 
       triton::ast::SharedAbstractNode SymbolicSimplification::simplify(const triton::ast::SharedAbstractNode& node) const {
+        /* The nodes rewritten, with the hash of their result before its children were simplified */
+        std::vector<std::tuple<triton::ast::SharedAbstractNode, triton::uint128, triton::ast::SharedAbstractNode, triton::uint128>> rewritten;
+        std::unordered_map<const triton::ast::AbstractNode*, triton::ast::SharedAbstractNode> visited;
         std::list<triton::ast::SharedAbstractNode> worklist;
         triton::ast::SharedAbstractNode snode = node;
 
         if (node == nullptr)
           throw triton::exceptions::SymbolicSimplification("SymbolicSimplification::simplify(): node cannot be null.");
 
-        if (this->callbacks && this->callbacks->isDefined(triton::callbacks::SYMBOLIC_SIMPLIFICATION)) {
-          snode = this->callbacks->processCallbacks(triton::callbacks::SYMBOLIC_SIMPLIFICATION, node);
-          /*
-           *  We use a worklist strategy to avoid recursive calls
-           *  and so stack overflow when going through a big AST.
-           */
-          worklist.push_back(snode);
-          while (worklist.size()) {
-            auto ast = worklist.front();
-            worklist.pop_front();
-            bool needs_update = false;
-            for (triton::uint32 index = 0; index < ast->getChildren().size(); index++) {
-              auto child = ast->getChildren()[index];
-              /* Don't apply simplification on nodes like String, Integer, etc. */
-              if (child->getBitvectorSize()) {
-                auto schild = this->callbacks->processCallbacks(triton::callbacks::SYMBOLIC_SIMPLIFICATION, child);
-                ast->setChild(index, schild);
-                needs_update |= !schild->canReplaceNodeWithoutUpdate(child);
-                worklist.push_back(schild);
-              }
+        if (this->passes.empty() && !(this->callbacks && this->callbacks->isDefined(triton::callbacks::SYMBOLIC_SIMPLIFICATION)))
+          return snode;
+
+        triton::usize version = this->getVersion();
+        if (auto memoized = this->findMemo(node, version))
+          return memoized;
+
+        triton::uint128 hash = node->getHash();
+        snode = this->rewrite(node);
+        rewritten.emplace_back(node, hash, snode, snode->getHash());
+
+        /*
+         *  We use a worklist strategy to avoid recursive calls
+         *  and so stack overflow when going through a big AST.
+         */
+        worklist.push_back(snode);
+        while (worklist.size()) {
+          auto ast = worklist.front();
+          worklist.pop_front();
+          bool needs_update = false;
+          for (triton::uint32 index = 0; index < ast->getChildren().size(); index++) {
+            auto child = ast->getChildren()[index];
+            /* Don't apply simplification on nodes like String, Integer, etc. */
+            if (child->getBitvectorSize() == 0)
+              continue;
+
+            /* A shared subtree is simplified once, an unchanged one memoized is not walked */
+            triton::ast::SharedAbstractNode schild = nullptr;
+            auto it = visited.find(child.get());
+            if (it != visited.end()) {
+              schild = it->second;
+            }
+            else if ((schild = this->findMemo(child, version)) == nullptr) {
+              hash   = child->getHash();
+              schild = this->rewrite(child);
+              rewritten.emplace_back(child, hash, schild, schild->getHash());
+              worklist.push_back(schild);
             }
-            if (needs_update) {
-              ast->init(true);
+            visited[child.get()] = schild;
+
+            if (schild != child) {
+              ast->setChild(index, schild);
+              needs_update |= !schild->canReplaceNodeWithoutUpdate(child);
             }
           }
+          if (needs_update) {
+            ast->init(true);
+          }
+        }
+
+        /*
+         *  Only the results whose subtree is unchanged by the walk are memoized,
+         *  the other ones may be rewritten further by a next simplification.
+         */
+        for (const auto& entry : rewritten) {
+          const auto& original = std::get<0>(entry);
+          const auto& result   = std::get<2>(entry);
+          if (result->getHash() != std::get<3>(entry))
+            continue;
+          if (original->getHash() == std::get<1>(entry))
+            this->addMemo(original, result, version);
+          if (result != original)
+            this->addMemo(result, result, version);
         }
 
         return snode;
       }
 
 
+      void SymbolicSimplification::addSimplificationPass(const std::string& name, const triton::engines::symbolic::SimplificationRule& rule, triton::sint32 order) {
+        if (!rule)
+          throw triton::exceptions::SymbolicSimplification("SymbolicSimplification::addSimplificationPass(): rule cannot be empty.");
+
+        this->removeSimplificationPass(name);
+
+        /* After the passes of the same order, so that their registration order is kept */
+        auto it = std::upper_bound(this->passes.begin(), this->passes.end(), order, [](triton::sint32 o, const Pass& pass) { return o < pass.order; });
+        this->passes.insert(it, Pass{name, order, rule});
+        this->passesVersion++;
+      }
+
+
+      void SymbolicSimplification::addSimplificationPass(const std::string& name) {
+        this->addSimplificationPass(name, triton::engines::symbolic::SimplificationPasses::getPass(name), triton::engines::symbolic::SimplificationPasses::getOrder(name));
+      }
+
+
+      void SymbolicSimplification::removeSimplificationPass(const std::string& name) {
+        auto it = std::find_if(this->passes.begin(), this->passes.end(), [&](const Pass& pass) { return pass.name == name; });
+        if (it != this->passes.end()) {
+          this->passes.erase(it);
+          this->passStatistics.erase(name);
+          this->passesVersion++;
+        }
+      }
+
+
+      std::vector<std::string> SymbolicSimplification::getSimplificationPasses(void) const {
+        std::vector<std::string> names;
+
+        names.reserve(this->passes.size());
+        for (const auto& pass : this->passes)
+          names.push_back(pass.name);
+
+        return names;
+      }
+
+
+      void SymbolicSimplification::setSimplificationIterations(triton::uint32 iterations) {
+        if (iterations == 0)
+          throw triton::exceptions::SymbolicSimplification("SymbolicSimplification::setSimplificationIterations(): iterations must be at least 1.");
+
+        this->maxIterations = iterations;
+        this->passesVersion++;
+      }
+
+
+      triton::uint32 SymbolicSimplification::getSimplificationIterations(void) const {
+        return this->maxIterations;
+      }
+
+
+      const std::map<std::string, triton::engines::symbolic::SimplificationPassStatistics>& SymbolicSimplification::getSimplificationPassStatistics(void) const {
+        return this->passStatistics;
+      }
+
+
+      triton::usize SymbolicSimplification::getSimplificationMemoHits(void) const {
+        return this->memoHits;
+      }
+
+
+      void SymbolicSimplification::clearSimplificationMemo(void) {
+        this->memo.clear();
+        this->memoLimit = 4096;
+        this->memoHits  = 0;
+        this->passStatistics.clear();
+      }
+
+
       SymbolicSimplification& SymbolicSimplification::operator=(const SymbolicSimplification& other) {
         this->copy(other);
         return *this;
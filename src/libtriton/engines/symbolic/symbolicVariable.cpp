@@ -23,7 +23,7 @@ namespace triton {
         this->alias   = alias;
         this->comment = "";
         this->id      = id;
-        this->name    = TRITON_SYMVAR_NAME + std::to_string(id);
+        this->name    = "";
         this->origin  = origin;
         this->size    = size;
         this->type    = type;
@@ -75,6 +75,9 @@ namespace triton {
 
 
       const std::string& SymbolicVariable::getName(void) const {
+        /* Variables are looked up by id, most of them never need their name */
+        if (this->name.empty())
+          this->name = TRITON_SYMVAR_NAME + std::to_string(this->id);
         return this->name;
       }
 
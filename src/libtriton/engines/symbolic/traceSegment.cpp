@@ -0,0 +1,207 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <triton/exceptions.hpp>
+#include <triton/traceSegment.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace symbolic {
+
+      SegmentStitcher::SegmentStitcher(const triton::ast::SharedAstContext& ctxt) : ctxt(ctxt) {
+        if (ctxt == nullptr)
+          throw triton::exceptions::SymbolicEngine("SegmentStitcher::SegmentStitcher(): The AST context must be defined.");
+        this->next = 0;
+      }
+
+
+      triton::ast::SharedAbstractNode SegmentStitcher::translate(const triton::ast::SharedAbstractNode& node,
+                                                                 const std::unordered_map<triton::usize, triton::ast::SharedAbstractNode>& liveIns,
+                                                                 std::unordered_map<triton::ast::AbstractNode*, triton::ast::SharedAbstractNode>& memo) const {
+        if (node == nullptr)
+          return nullptr;
+
+        /* A node of the stitcher context without live-in is kept as is */
+        if (liveIns.empty() && node->getContext() == this->ctxt)
+          return node;
+
+        for (const auto& n : triton::ast::childrenExtraction(node, true /* unroll */, true /* children first */)) {
+          triton::ast::AbstractNode* raw = n.get();
+          triton::ast::SharedAbstractNode result = nullptr;
+
+          if (memo.find(raw) != memo.end())
+            continue;
+
+          switch (raw->getType()) {
+            /* The expressions are unrolled, their nodes are rebuilt first */
+            case triton::ast::REFERENCE_NODE:
+              result = memo.at(triton::ast::dereference(n).get());
+              break;
+
+            case triton::ast::VARIABLE_NODE: {
+              const auto& var = reinterpret_cast<triton::ast::VariableNode*>(raw)->getSymbolicVariable();
+              auto it = liveIns.find(var->getId());
+              if (it != liveIns.end()) {
+                result = it->second;
+                break;
+              }
+              /* Only the variables of the stitcher context are kept, e.g. the inputs of the first segment */
+              auto known = this->ctxt->getVariableNode(var->getId());
+              if (known == nullptr || reinterpret_cast<triton::ast::VariableNode*>(known.get())->getSymbolicVariable() != var)
+                throw triton::exceptions::SymbolicEngine("SegmentStitcher::translate(): The variable " + var->getName() + " is not a live-in of the segment.");
+              result = this->ctxt->variable(var);
+              break;
+            }
+
+            case triton::ast::BV_NODE:
+              result = this->ctxt->bv(raw->evaluate(), raw->getBitvectorSize());
+              break;
+
+            case triton::ast::INTEGER_NODE:
+              result = this->ctxt->integer(reinterpret_cast<triton::ast::IntegerNode*>(raw)->getInteger());
+              break;
+
+            case triton::ast::STRING_NODE:
+              result = this->ctxt->string(reinterpret_cast<triton::ast::StringNode*>(raw)->getString());
+              break;
+
+            default: {
+              std::vector<triton::ast::SharedAbstractNode> children;
+              children.reserve(raw->getChildren().size());
+              for (const auto& child : raw->getChildren())
+                children.push_back(memo.at(child.get()));
+              result = triton::ast::rebuild(this->ctxt, raw, children);
+              break;
+            }
+          }
+
+          memo[raw] = result;
+        }
+
+        return memo.at(node.get());
+      }
+
+
+      void SegmentStitcher::append(const SegmentSummary& segment) {
+        std::unordered_map<triton::usize, triton::ast::SharedAbstractNode> liveIns;
+        std::unordered_map<triton::ast::AbstractNode*, triton::ast::SharedAbstractNode> memo;
+
+        if (segment.index != this->next)
+          throw triton::exceptions::SymbolicEngine("SegmentStitcher::append(): The segments must be appended in order.");
+
+        /* The live-ins take the symbolic state left by the previous segments, or their concrete value */
+        for (const auto& liveIn : segment.liveIns) {
+          triton::ast::SharedAbstractNode value = nullptr;
+
+          if (liveIn.reg != triton::arch::ID_REG_INVALID) {
+            auto it = this->registers.find(ThreadRegister(liveIn.thread, liveIn.reg));
+            if (it != this->registers.end())
+              value = it->second;
+          }
+          else {
+            auto it = this->memory.find(liveIn.address);
+            if (it != this->memory.end())
+              value = it->second;
+          }
+
+          if (value == nullptr)
+            value = this->ctxt->bv(liveIn.value, liveIn.variable->getSize());
+
+          liveIns[liveIn.variable->getId()] = value;
+        }
+
+        /* The path constraints made concrete by the substitution are dropped */
+        for (const auto& pc : segment.pathConstraints) {
+          std::vector<triton::ast::SharedAbstractNode> predicates;
+          bool symbolized = false;
+
+          for (const auto& predicate : pc.getPredicates()) {
+            predicates.push_back(this->translate(predicate, liveIns, memo));
+            symbolized |= (predicates.back() != nullptr && predicates.back()->isSymbolized());
+          }
+
+          if (!symbolized)
+            continue;
+
+          PathConstraint stitched(pc);
+          stitched.setPredicates(predicates);
+          this->pathConstraints.push_back(stitched);
+        }
+
+        /* The final state of the segment, translated before the state of the previous segments is replaced */
+        std::vector<std::pair<ThreadRegister, triton::ast::SharedAbstractNode>> registers;
+        for (const auto& reg : segment.registers)
+          registers.push_back({reg.first, this->translate(reg.second, liveIns, memo)});
+
+        std::vector<std::pair<triton::uint64, triton::ast::SharedAbstractNode>> memory;
+        for (const auto& cell : segment.memory)
+          memory.push_back({cell.first, this->translate(cell.second, liveIns, memo)});
+
+        for (const auto& reg : registers) {
+          if (reg.second == nullptr || !reg.second->isSymbolized())
+            this->registers.erase(reg.first);
+          else
+            this->registers[reg.first] = reg.second;
+        }
+
+        for (const auto& cell : memory) {
+          if (cell.second == nullptr || !cell.second->isSymbolized())
+            this->memory.erase(cell.first);
+          else
+            this->memory[cell.first] = cell.second;
+        }
+
+        this->next = segment.index + segment.count;
+      }
+
+
+      triton::usize SegmentStitcher::getNextIndex(void) const {
+        return this->next;
+      }
+
+
+      const std::vector<PathConstraint>& SegmentStitcher::getPathConstraints(void) const {
+        return this->pathConstraints;
+      }
+
+
+      triton::ast::SharedAbstractNode SegmentStitcher::getPathPredicate(void) const {
+        std::vector<triton::ast::SharedAbstractNode> predicates;
+
+        /* by default PC is T (top) */
+        predicates.push_back(this->ctxt->equal(this->ctxt->bvtrue(), this->ctxt->bvtrue()));
+
+        for (const auto& pc : this->pathConstraints)
+          predicates.push_back(pc.getTakenPredicate());
+
+        if (predicates.size() == 1)
+          return predicates.front();
+
+        return this->ctxt->land(predicates);
+      }
+
+
+      triton::ast::SharedAbstractNode SegmentStitcher::getRegisterAst(triton::uint32 thread, triton::arch::register_e reg) const {
+        auto it = this->registers.find(ThreadRegister(thread, reg));
+        if (it == this->registers.end())
+          return nullptr;
+        return it->second;
+      }
+
+
+      triton::ast::SharedAbstractNode SegmentStitcher::getMemoryAst(triton::uint64 addr) const {
+        auto it = this->memory.find(addr);
+        if (it == this->memory.end())
+          return nullptr;
+        return it->second;
+      }
+
+    }; /* symbolic namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
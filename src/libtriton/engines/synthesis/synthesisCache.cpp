@@ -0,0 +1,305 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <cstring>
+#include <memory>
+#include <stack>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <triton/astSerializer.hpp>
+#include <triton/cpuSize.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/symbolicVariable.hpp>
+#include <triton/synthesisCache.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace synthesis {
+
+      /*
+       * Layout of a saved cache. All integers are little-endian.
+       *
+       *  header      magic[8], version:u32, count:u32
+       *  entries     key:u128, output:u8, variables:u32, then for each variable: size:u32
+       *  outputs     the outputs of the entries whose output is 1, in the binary AST format
+       */
+      static const char magic[8] = {'T', 'R', 'T', 'N', 'S', 'Y', 'N', '\0'};
+
+
+      /* Appends a little-endian integer */
+      static void put(std::string& out, triton::uint64 value, triton::usize bytes) {
+        for (triton::usize index = 0; index < bytes; index++)
+          out.push_back(static_cast<char>((value >> (index * 8)) & 0xff));
+      }
+
+
+      /* Reads a little-endian integer */
+      static triton::uint64 get(std::istream& stream, triton::usize bytes) {
+        triton::uint64 value = 0;
+        for (triton::usize index = 0; index < bytes; index++) {
+          int c = stream.get();
+          if (c == std::char_traits<char>::eof())
+            throw triton::exceptions::SynthesizerEngine("SynthesisCache::load(): Truncated cache.");
+          value |= static_cast<triton::uint64>(c & 0xff) << (index * 8);
+        }
+        return value;
+      }
+
+
+      SynthesisCache::SynthesisCache(const triton::ast::SharedAstContext& ctxt) {
+        this->ctxt = ctxt;
+      }
+
+
+      triton::uint128 SynthesisCache::getKey(const triton::ast::SharedAbstractNode& node, triton::uint64 options, std::vector<triton::ast::SharedAbstractNode>& variables) {
+        std::unordered_map<const triton::ast::AbstractNode*, triton::ast::NodeHash> hashes;
+        std::unordered_map<std::string, triton::usize> indexes;
+
+        variables.clear();
+
+        /* Children come before their parents, and the expression of a reference before it */
+        for (const auto& n : triton::ast::childrenExtraction(node, true /* unroll */, true /* revert */)) {
+          triton::ast::NodeHash hash;
+
+          switch (n->getType()) {
+            case triton::ast::REFERENCE_NODE:
+              hash = hashes.at(reinterpret_cast<triton::ast::ReferenceNode*>(n.get())->getSymbolicExpression()->getAst().get());
+              break;
+
+            /* A variable is hashed by its index in the order the variables are met */
+            case triton::ast::VARIABLE_NODE: {
+              const auto& name = reinterpret_cast<triton::ast::VariableNode*>(n.get())->getSymbolicVariable()->getName();
+              auto it = indexes.find(name);
+              if (it == indexes.end()) {
+                it = indexes.insert({name, variables.size()}).first;
+                variables.push_back(n);
+              }
+              hash.mix(static_cast<triton::uint64>(triton::ast::VARIABLE_NODE));
+              hash.mix(static_cast<triton::uint64>(n->getBitvectorSize()));
+              hash.mix(static_cast<triton::uint64>(it->second));
+              break;
+            }
+
+            default:
+              if (n->getChildren().empty()) {
+                hash.mix(triton::uint512(n->getHash()));
+                break;
+              }
+              hash.mix(static_cast<triton::uint64>(n->getType()));
+              hash.mix(static_cast<triton::uint64>(n->getBitvectorSize()));
+              hash.mix(static_cast<triton::uint64>(n->getChildren().size()));
+              for (const auto& child : n->getChildren())
+                hash.mix(hashes.at(child.get()));
+              break;
+          }
+
+          hashes[n.get()] = hash;
+        }
+
+        triton::ast::NodeHash key = hashes.at(node.get());
+        key.mix(options);
+
+        return key.get();
+      }
+
+
+      triton::ast::SharedAbstractNode SynthesisCache::instantiate(const triton::ast::SharedAbstractNode& output, const std::map<std::string, triton::ast::SharedAbstractNode>& mapping) const {
+        std::stack<triton::ast::AbstractNode*> worklist;
+        std::unordered_set<const triton::ast::AbstractNode*> visited;
+
+        if (output->getType() == triton::ast::VARIABLE_NODE) {
+          auto it = mapping.find(reinterpret_cast<triton::ast::VariableNode*>(output.get())->getSymbolicVariable()->getName());
+          return (it != mapping.end()) ? it->second : output;
+        }
+
+        /* The copy is owned by the caller, the variables are replaced on the fly */
+        auto copy = triton::ast::newInstance(output.get());
+
+        worklist.push(copy.get());
+        while (!worklist.empty()) {
+          auto current = worklist.top();
+          worklist.pop();
+
+          if (!visited.insert(current).second)
+            continue;
+
+          triton::uint32 index = 0;
+          for (const auto& child : current->getChildren()) {
+            if (child->getType() == triton::ast::VARIABLE_NODE) {
+              auto it = mapping.find(reinterpret_cast<triton::ast::VariableNode*>(child.get())->getSymbolicVariable()->getName());
+              if (it != mapping.end())
+                current->setChild(index, it->second);
+            }
+            else {
+              worklist.push(child.get());
+            }
+            index++;
+          }
+        }
+
+        return copy;
+      }
+
+
+      triton::ast::SharedAbstractNode SynthesisCache::placeholder(triton::usize index, triton::uint32 size) const {
+        triton::usize id = PLACEHOLDER_ID | (index << 10) | size;
+        auto var = std::make_shared<triton::engines::symbolic::SymbolicVariable>(triton::engines::symbolic::UNDEFINED_VARIABLE, 0, id, size, "");
+        return this->ctxt->variable(var);
+      }
+
+
+      bool SynthesisCache::find(triton::uint128 key, const std::vector<triton::ast::SharedAbstractNode>& variables, triton::ast::SharedAbstractNode& output) const {
+        std::map<std::string, triton::ast::SharedAbstractNode> mapping;
+
+        auto it = this->entries.find(key);
+        if (it == this->entries.end() || it->second.names.size() != variables.size())
+          return false;
+
+        output = nullptr;
+        if (it->second.output == nullptr)
+          return true;
+
+        for (triton::usize index = 0; index < variables.size(); index++) {
+          if (variables[index]->getBitvectorSize() != it->second.sizes[index])
+            return false;
+          mapping[it->second.names[index]] = variables[index];
+        }
+
+        output = this->instantiate(it->second.output, mapping);
+        return true;
+      }
+
+
+      void SynthesisCache::insert(triton::uint128 key, const std::vector<triton::ast::SharedAbstractNode>& variables, const triton::ast::SharedAbstractNode& output) {
+        std::unordered_set<std::string> known;
+        Entry entry;
+
+        for (const auto& var : variables) {
+          const auto& name = reinterpret_cast<triton::ast::VariableNode*>(var.get())->getSymbolicVariable()->getName();
+          entry.names.push_back(name);
+          entry.sizes.push_back(var->getBitvectorSize());
+          known.insert(name);
+        }
+
+        if (output != nullptr) {
+          /* The output could not be rebuilt on other variables */
+          for (const auto& var : triton::ast::search(output, triton::ast::VARIABLE_NODE)) {
+            if (known.find(reinterpret_cast<triton::ast::VariableNode*>(var.get())->getSymbolicVariable()->getName()) == known.end())
+              return;
+          }
+          /* The output is copied, the caller may modify its nodes */
+          entry.output = triton::ast::newInstance(output.get());
+        }
+
+        this->entries[key] = entry;
+      }
+
+
+      void SynthesisCache::save(std::ostream& stream) const {
+        std::vector<triton::ast::SharedAbstractNode> outputs;
+        std::string header;
+
+        header.append(magic, sizeof(magic));
+        put(header, version, 4);
+        put(header, this->entries.size(), 4);
+
+        for (const auto& item : this->entries) {
+          const Entry& entry = item.second;
+
+          put(header, static_cast<triton::uint64>(item.first), 8);
+          put(header, static_cast<triton::uint64>(item.first >> 64), 8);
+          put(header, entry.output != nullptr, 1);
+          put(header, entry.sizes.size(), 4);
+          for (triton::uint32 size : entry.sizes)
+            put(header, size, 4);
+
+          if (entry.output == nullptr)
+            continue;
+
+          /* The variables of the output are saved as placeholders */
+          std::map<std::string, triton::ast::SharedAbstractNode> mapping;
+          for (triton::usize index = 0; index < entry.names.size(); index++)
+            mapping[entry.names[index]] = this->placeholder(index, entry.sizes[index]);
+          outputs.push_back(this->instantiate(entry.output, mapping));
+        }
+
+        stream.write(header.data(), header.size());
+        triton::ast::AstSerializer(this->ctxt).serialize(stream, outputs);
+      }
+
+
+      void SynthesisCache::load(std::istream& stream) {
+        std::vector<std::pair<triton::uint128, Entry>> loaded;
+        char buffer[sizeof(magic)];
+
+        if (!stream.read(buffer, sizeof(buffer)) || std::memcmp(buffer, magic, sizeof(magic)) != 0)
+          throw triton::exceptions::SynthesizerEngine("SynthesisCache::load(): Invalid magic.");
+
+        if (get(stream, 4) != version)
+          throw triton::exceptions::SynthesizerEngine("SynthesisCache::load(): Unsupported version.");
+
+        triton::usize count = static_cast<triton::usize>(get(stream, 4));
+        triton::usize withOutput = 0;
+
+        for (triton::usize index = 0; index < count; index++) {
+          triton::uint128 key = get(stream, 8);
+          key |= static_cast<triton::uint128>(get(stream, 8)) << 64;
+
+          Entry entry;
+          bool output = (get(stream, 1) != 0);
+          triton::usize size = static_cast<triton::usize>(get(stream, 4));
+          for (triton::usize i = 0; i < size; i++) {
+            triton::uint32 bits = static_cast<triton::uint32>(get(stream, 4));
+            if (bits == 0 || bits > triton::bitsize::max_supported)
+              throw triton::exceptions::SynthesizerEngine("SynthesisCache::load(): Invalid size of variable.");
+            entry.sizes.push_back(bits);
+            entry.names.push_back(TRITON_SYMVAR_NAME + std::to_string(PLACEHOLDER_ID | (i << 10) | bits));
+          }
+
+          /* Tells that an output is expected until the outputs are read */
+          if (output) {
+            entry.output = this->ctxt->bvfalse();
+            withOutput++;
+          }
+
+          loaded.push_back({key, entry});
+        }
+
+        auto outputs = triton::ast::AstSerializer(this->ctxt).deserialize(stream);
+        if (outputs.size() != withOutput)
+          throw triton::exceptions::SynthesizerEngine("SynthesisCache::load(): Invalid number of outputs.");
+
+        auto output = outputs.begin();
+        for (auto& item : loaded) {
+          if (item.second.output != nullptr)
+            item.second.output = *(output++);
+          this->entries[item.first] = item.second;
+        }
+      }
+
+
+      void SynthesisCache::clear(void) {
+        this->entries.clear();
+      }
+
+
+      triton::usize SynthesisCache::size(void) const {
+        return this->entries.size();
+      }
+
+
+      triton::usize SynthesisCache::getBytes(void) const {
+        /* A node of a map holds its value, three links and a color */
+        return this->entries.size() * (sizeof(std::map<triton::uint128, Entry>::value_type) + 4 * sizeof(void*));
+      }
+
+    }; /* synthesis namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
@@ -5,16 +5,24 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <exception>
+#include <mutex>
 #include <stack>
+#include <thread>
 #include <unordered_set>
 #include <vector>
 
 #include <triton/ast.hpp>
+#include <triton/astEvaluator.hpp>
 #include <triton/exceptions.hpp>
+#include <triton/executor.hpp>
 #include <triton/oracleEntry.hpp>
 #include <triton/symbolicVariable.hpp>
 #include <triton/synthesizer.hpp>
+#include <triton/termBank.hpp>
 
 
 
@@ -22,15 +30,55 @@ namespace triton {
   namespace engines {
     namespace synthesis {
 
-      Synthesizer::Synthesizer(triton::engines::symbolic::SymbolicEngine* symbolic)
-        : symbolic(symbolic) {
+      /* Returns the variables of a node, or an empty list if it has more than `limit` variables */
+      static std::deque<triton::ast::SharedAbstractNode> variablesOf(const triton::ast::SharedAbstractNode& node, triton::usize limit) {
+        std::stack<triton::ast::AbstractNode*>                worklist;
+        std::unordered_set<const triton::ast::AbstractNode*>  visited;
+        std::deque<triton::ast::SharedAbstractNode>           vars;
+
+        worklist.push(node.get());
+        while (!worklist.empty()) {
+          auto current = worklist.top();
+          worklist.pop();
+
+          if (!visited.insert(current).second || !current->isSymbolized())
+            continue;
+
+          if (current->getType() == triton::ast::VARIABLE_NODE) {
+            if (vars.size() == limit)
+              return {};
+            vars.push_front(current->shared_from_this());
+          }
+          else if (current->getType() == triton::ast::REFERENCE_NODE) {
+            worklist.push(reinterpret_cast<triton::ast::ReferenceNode*>(current)->getSymbolicExpression()->getAst().get());
+          }
+          else {
+            for (const auto& child : current->getChildren())
+              worklist.push(child.get());
+          }
+        }
+
+        return vars;
+      }
+
+
+      Synthesizer::Synthesizer(triton::engines::symbolic::SymbolicEngine* symbolic, triton::engines::synthesis::SynthesisCache* cache)
+        : symbolic(symbolic), cache(cache) {
         #ifdef TRITON_Z3_INTERFACE
         this->solver.setSolver(triton::engines::solver::SOLVER_Z3);
         #endif
       }
 
 
-      SynthesisResult Synthesizer::synthesize(const triton::ast::SharedAbstractNode& input, bool constant, bool subexpr, bool opaque) {
+      triton::uint64 Synthesizer::getCacheOptions(bool constant, bool opaque, bool subexpr, bool root) {
+        return (constant ? 1 : 0) | (opaque ? 2 : 0) | (subexpr ? 4 : 0) | (root ? 8 : 0);
+      }
+
+
+      SynthesisResult Synthesizer::synthesize(const triton::ast::SharedAbstractNode& input, bool constant, bool subexpr, bool opaque, bool parallel) {
+        triton::utils::TraceScope scope(input->getContext()->getTracer().get(), "synthesize", "synthesis");
+        std::vector<triton::ast::SharedAbstractNode> variables;
+        triton::uint128 key = 0;
         SynthesisResult result;
 
         // Save the input node
@@ -39,13 +87,28 @@ namespace triton {
         // Start to record the time of the synthesizing
         auto start = std::chrono::system_clock::now();
 
+        // A node already synthesized is a lookup
+        if (this->cache) {
+          triton::ast::SharedAbstractNode output = nullptr;
+          key = SynthesisCache::getKey(input, Synthesizer::getCacheOptions(constant, opaque, subexpr, true), variables);
+          if (this->cache->find(key, variables, output)) {
+            if (output) {
+              result.setOutput(output);
+              result.setSuccess(true);
+            }
+            auto end = std::chrono::system_clock::now();
+            result.setTime(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count());
+            return result;
+          }
+        }
+
         // Do not alter original input
         auto node = triton::ast::newInstance(input.get(), true);
 
         // Do the synthesize and if nothing has been synthesized, try on children expression
         if (this->do_synthesize(node, constant, opaque, result) == false) {
           if (subexpr == true) {
-            while (this->childrenSynthesis(node, constant, opaque, result));
+            while (this->childrenSynthesis(node, constant, opaque, parallel, result));
           }
         }
 
@@ -54,6 +117,10 @@ namespace triton {
           this->substituteSubExpression(result.getOutput());
         }
 
+        if (this->cache) {
+          this->cache->insert(key, variables, result.successful() ? result.getOutput() : nullptr);
+        }
+
         // Stop to record the time of the synthesizing
         auto end = std::chrono::system_clock::now();
 
@@ -70,6 +137,22 @@ namespace triton {
         // How many variables in the expression?
         auto vars = triton::ast::search(node, triton::ast::VARIABLE_NODE);
 
+        // A node which may be synthesized is looked up first
+        std::vector<triton::ast::SharedAbstractNode> variables;
+        triton::uint128 key = 0;
+        bool cached = (this->cache && vars.size() && node->getLevel() > 2 && (vars.size() <= TERM_VARIABLES || opaque));
+        if (cached) {
+          triton::ast::SharedAbstractNode output = nullptr;
+          key = SynthesisCache::getKey(node, Synthesizer::getCacheOptions(constant, opaque, false, false), variables);
+          if (this->cache->find(key, variables, output)) {
+            if (output) {
+              result.setOutput(output);
+              result.setSuccess(true);
+            }
+            return (output != nullptr);
+          }
+        }
+
         // If there is one symbolic variable, do unary operators synthesis
         if (vars.size() == 1 && node->getLevel() > 2) {
           ret = this->unaryOperatorSynthesis(vars, node, result);
@@ -90,6 +173,15 @@ namespace triton {
           ret = this->opaqueConstantSynthesis(vars, node, result);
         }
 
+        // If still nothing worked, do enumerative synthesis
+        if (vars.size() && vars.size() <= TERM_VARIABLES && ret == false && node->getLevel() > 2) {
+          ret = this->enumerativeSynthesis(vars, node, result);
+        }
+
+        if (cached) {
+          this->cache->insert(key, variables, ret ? result.getOutput() : nullptr);
+        }
+
         return ret;
       }
 
@@ -170,90 +262,79 @@ namespace triton {
       }
 
 
-      bool Synthesizer::unaryOperatorSynthesis(const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node, SynthesisResult& result) {
-        /* We start by saving orignal value of symbolic variable */
+      bool Synthesizer::unaryOperatorOracle(const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node, triton::ast::ast_e& op) {
         auto var_x = reinterpret_cast<triton::ast::VariableNode*>(vars[0].get())->getSymbolicVariable();
-        auto actx  = node->getContext();
 
-        triton::uint512 save_x = actx->getVariableValue(var_x->getName());
-        triton::uint32  bits   = var_x->getSize();
+        triton::uint32 bits = var_x->getSize();
 
         /* We suppose variables are 8, 16, 32 or 64-bit long */
         if (bits != 8 && bits != 16 && bits != 32 && bits != 64)
           return false;
 
-        /*
-         * NOTE: More the oracle table will grow more it will take time to looking
-         *       for a potential synthesis. Currently, the complexity is O(n) where
-         *       n is the number of entry in the table. At some point we have to
-         *       change this.
-         */
-        for (auto const& it : triton::engines::synthesis::oracles::unopTable) {
-          triton::ast::ast_e op = it.first;
-          std::array<UnaryEntry, 40> oracles = it.second;
+        /* The oracles of the size of the variable */
+        const UnaryOracleTable* oracles = nullptr;
+        for (auto const& table : triton::engines::synthesis::oracles::unopTable) {
+          if (table.bits == bits)
+            oracles = &table;
+        }
 
-          // Ignore bswap oracle for 8 bit value.
-          if (bits == 8 && op == triton::ast::BSWAP_NODE) {
-            continue;
-          }
+        if (oracles == nullptr)
+          return false;
 
-          bool found = true;
-          for (auto const& oracle : oracles) {
-            // Ignore oracle that is not on same size
-            if (oracle.bits != bits) {
-              continue;
-            }
+        /* The node is compiled and evaluated once on the inputs, its signature gives the operator */
+        triton::ast::AstEvaluator evaluator(node);
+        triton::usize nbInputs = evaluator.getVariables().size();
 
-            // Inject value
-            actx->updateVariable(var_x->getName(), oracle.x);
-            if (node->evaluate() != oracle.r) {
-              found = false;
-              break;
-            }
-          }
+        std::vector<std::vector<triton::uint512>> inputs;
+        for (triton::uint64 x : oracles->x) {
+          // Inject value
+          inputs.push_back(std::vector<triton::uint512>(nbInputs, x));
+        }
 
-          // If an oracle is found, we craft a synthesized node.
-          if (found) {
-            switch (op) {
-              case triton::ast::BSWAP_NODE: result.setOutput(actx->bswap(actx->variable(var_x))); break;
-              case triton::ast::BVNEG_NODE: result.setOutput(actx->bvneg(actx->variable(var_x))); break;
-              case triton::ast::BVNOT_NODE: result.setOutput(actx->bvnot(actx->variable(var_x))); break;
-              default:
-                throw triton::exceptions::SynthesizerEngine("Synthesizer::unaryOperatorSynthesis(): Invalid type of operator.");
-            }
+        return oracles->find(evaluator.evaluateBatch(inputs), op);
+      }
 
-            // Adjust the size of the destination
-            auto out     = result.getOutput();
-            auto in      = node;
-            auto outsize = out->getBitvectorSize();
-            auto insize  = in->getBitvectorSize();
-            if (insize > outsize) {
-              result.setOutput(actx->zx(insize - outsize, out));
-            }
 
-            // Stop iterating over oracles
-            result.setSuccess(true);
-            break;
+      bool Synthesizer::unaryOperatorSynthesis(const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node, SynthesisResult& result) {
+        auto var_x = reinterpret_cast<triton::ast::VariableNode*>(vars[0].get())->getSymbolicVariable();
+        auto actx  = node->getContext();
+
+        /* The oracle may have been looked up in parallel */
+        triton::ast::ast_e op = triton::ast::INVALID_NODE;
+        auto it = this->oracles.find(node.get());
+        bool found = (it != this->oracles.end() && !it->second.node.expired()) ? ((op = it->second.op) != triton::ast::INVALID_NODE) : Synthesizer::unaryOperatorOracle(vars, node, op);
+
+        // If an oracle is found, we craft a synthesized node.
+        if (found) {
+          switch (op) {
+            case triton::ast::BSWAP_NODE: result.setOutput(actx->bswap(actx->variable(var_x))); break;
+            case triton::ast::BVNEG_NODE: result.setOutput(actx->bvneg(actx->variable(var_x))); break;
+            case triton::ast::BVNOT_NODE: result.setOutput(actx->bvnot(actx->variable(var_x))); break;
+            default:
+              throw triton::exceptions::SynthesizerEngine("Synthesizer::unaryOperatorSynthesis(): Invalid type of operator.");
+          }
+
+          // Adjust the size of the destination
+          auto out     = result.getOutput();
+          auto in      = node;
+          auto outsize = out->getBitvectorSize();
+          auto insize  = in->getBitvectorSize();
+          if (insize > outsize) {
+            result.setOutput(actx->zx(insize - outsize, out));
           }
-          // If not found, continuing to iterate over oracles
-        }
 
-        // Whatever the result, we must restore orignal value of the symbolic variable
-        actx->updateVariable(var_x->getName(), save_x);
+          result.setSuccess(true);
+        }
 
         return result.successful();
       }
 
 
-      bool Synthesizer::binaryOperatorSynthesis(const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node, SynthesisResult& result) {
-        /* We start by saving orignal value of symbolic variables */
+      bool Synthesizer::binaryOperatorOracle(const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node, triton::ast::ast_e& op) {
         auto var_x = reinterpret_cast<triton::ast::VariableNode*>(vars[0].get())->getSymbolicVariable();
         auto var_y = reinterpret_cast<triton::ast::VariableNode*>(vars[1].get())->getSymbolicVariable();
-        auto actx  = node->getContext();
 
-        triton::uint512 save_x = actx->getVariableValue(var_x->getName());
-        triton::uint512 save_y = actx->getVariableValue(var_y->getName());
-        triton::uint32  bits   = var_x->getSize();
+        triton::uint32 bits = var_x->getSize();
 
         /* We suppose variables are on a same size */
         if (var_x->getSize() != var_y->getSize())
@@ -263,77 +344,297 @@ namespace triton {
         if (bits != 8 && bits != 16 && bits != 32 && bits != 64)
           return false;
 
-        for (auto const& it : triton::engines::synthesis::oracles::binopTable) {
-          triton::ast::ast_e op = it.first;
-          std::array<BinaryEntry, 40> oracles = it.second;
+        /* The oracles of the size of the variables */
+        const BinaryOracleTable* oracles = nullptr;
+        for (auto const& table : triton::engines::synthesis::oracles::binopTable) {
+          if (table.bits == bits)
+            oracles = &table;
+        }
 
-          bool found = true;
-          for (auto const& oracle : oracles) {
-            // Ignore oracle that is not on same size
-            if (oracle.bits != bits) {
-              continue;
-            }
+        if (oracles == nullptr)
+          return false;
+
+        /* The node is compiled and evaluated once on the inputs, its signature gives the operator */
+        triton::ast::AstEvaluator evaluator(node);
+        const auto& variables = evaluator.getVariables();
+
+        std::vector<std::vector<triton::uint512>> inputs;
+        for (triton::usize i = 0; i < ORACLE_INPUTS; i++) {
+          // Inject values
+          std::vector<triton::uint512> values;
+          for (const auto& var : variables)
+            values.push_back((var->getId() == var_y->getId()) ? oracles->y[i] : oracles->x[i]);
+          inputs.push_back(values);
+        }
+
+        return oracles->find(evaluator.evaluateBatch(inputs), op);
+      }
+
+
+      bool Synthesizer::binaryOperatorSynthesis(const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node, SynthesisResult& result) {
+        auto var_x = reinterpret_cast<triton::ast::VariableNode*>(vars[0].get())->getSymbolicVariable();
+        auto var_y = reinterpret_cast<triton::ast::VariableNode*>(vars[1].get())->getSymbolicVariable();
+        auto actx  = node->getContext();
+
+        /* The oracle may have been looked up in parallel */
+        triton::ast::ast_e op = triton::ast::INVALID_NODE;
+        auto it = this->oracles.find(node.get());
+        bool found = (it != this->oracles.end() && !it->second.node.expired()) ? ((op = it->second.op) != triton::ast::INVALID_NODE) : Synthesizer::binaryOperatorOracle(vars, node, op);
+
+        // If an oracle is found, we craft a synthesized node.
+        if (found) {
+          switch (op) {
+            case triton::ast::BVADD_NODE:   result.setOutput(actx->bvadd(actx->variable(var_x),  actx->variable(var_y))); break;
+            case triton::ast::BVAND_NODE:   result.setOutput(actx->bvand(actx->variable(var_x),  actx->variable(var_y))); break;
+            case triton::ast::BVMUL_NODE:   result.setOutput(actx->bvmul(actx->variable(var_x),  actx->variable(var_y))); break;
+            case triton::ast::BVNAND_NODE:  result.setOutput(actx->bvnand(actx->variable(var_x), actx->variable(var_y))); break;
+            case triton::ast::BVNOR_NODE:   result.setOutput(actx->bvnor(actx->variable(var_x),  actx->variable(var_y))); break;
+            case triton::ast::BVOR_NODE:    result.setOutput(actx->bvor(actx->variable(var_x),   actx->variable(var_y))); break;
+            case triton::ast::BVROL_NODE:   result.setOutput(actx->bvrol(actx->variable(var_x),  actx->variable(var_y))); break;
+            case triton::ast::BVROR_NODE:   result.setOutput(actx->bvror(actx->variable(var_x),  actx->variable(var_y))); break;
+            case triton::ast::BVSDIV_NODE:  result.setOutput(actx->bvsdiv(actx->variable(var_x), actx->variable(var_y))); break;
+            case triton::ast::BVSMOD_NODE:  result.setOutput(actx->bvsmod(actx->variable(var_x), actx->variable(var_y))); break;
+            case triton::ast::BVSREM_NODE:  result.setOutput(actx->bvsrem(actx->variable(var_x), actx->variable(var_y))); break;
+            case triton::ast::BVSUB_NODE:   result.setOutput(actx->bvsub(actx->variable(var_x),  actx->variable(var_y))); break;
+            case triton::ast::BVUDIV_NODE:  result.setOutput(actx->bvudiv(actx->variable(var_x), actx->variable(var_y))); break;
+            case triton::ast::BVUREM_NODE:  result.setOutput(actx->bvurem(actx->variable(var_x), actx->variable(var_y))); break;
+            case triton::ast::BVXNOR_NODE:  result.setOutput(actx->bvxnor(actx->variable(var_x), actx->variable(var_y))); break;
+            case triton::ast::BVXOR_NODE:   result.setOutput(actx->bvxor(actx->variable(var_x),  actx->variable(var_y))); break;
+            default:
+              throw triton::exceptions::SynthesizerEngine("Synthesizer::binaryOperatorSynthesis(): Invalid type of operator.");
+          }
+
+          // Adjust the size of the destination
+          auto out     = result.getOutput();
+          auto in      = node;
+          auto outsize = out->getBitvectorSize();
+          auto insize  = in->getBitvectorSize();
+          if (insize > outsize) {
+            result.setOutput(actx->zx(insize - outsize, out));
+          }
+
+          result.setSuccess(true);
+        }
+
+        return result.successful();
+      }
+
+
+      bool Synthesizer::enumerativeOracle(const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node, triton::usize& term) {
+        triton::uint32 bits = node->getBitvectorSize();
+
+        if (vars.empty() || vars.size() > TERM_VARIABLES)
+          return false;
+
+        /* We suppose variables are on the size of the node */
+        for (const auto& var : vars) {
+          if (var->getBitvectorSize() != bits)
+            return false;
+        }
+
+        /* We suppose variables are 8, 16, 32 or 64-bit long */
+        if (bits != 8 && bits != 16 && bits != 32 && bits != 64)
+          return false;
+
+        const TermBank& bank = TermBank::get(bits);
+
+        /* The node is compiled once, its inputs are sorted by id */
+        triton::ast::AstEvaluator evaluator(node);
+        std::vector<triton::usize> positions;
+        for (const auto& var : evaluator.getVariables()) {
+          triton::usize position = 0;
+          while (position < vars.size() && reinterpret_cast<triton::ast::VariableNode*>(vars[position].get())->getSymbolicVariable()->getId() != var->getId())
+            position++;
+          if (position == vars.size())
+            return false;
+          positions.push_back(position);
+        }
+
+        /* The node is evaluated on the inputs of the bank, then on the checks */
+        std::vector<std::vector<triton::uint512>> inputs;
+        for (triton::usize i = 0; i < TERM_INPUTS; i++) {
+          std::vector<triton::uint512> values;
+          for (triton::usize position : positions)
+            values.push_back(bank.inputs[position][i]);
+          inputs.push_back(values);
+        }
+        for (const auto& check : bank.checks) {
+          std::vector<triton::uint512> values;
+          for (triton::usize position : positions)
+            values.push_back(check[position]);
+          inputs.push_back(values);
+        }
+
+        auto results = evaluator.evaluateBatch(inputs);
+        std::vector<triton::uint512> signature(results.begin(), results.begin() + TERM_INPUTS);
+
+        /* A term which is not smaller than the node is useless */
+        if (!bank.find(signature, term) || bank.terms[term].level >= node->getLevel())
+          return false;
+
+        /* The term has the results of the node on its inputs, it must also have them on the checks */
+        for (triton::usize i = 0; i < bank.checks.size(); i++) {
+          if (results[TERM_INPUTS + i] != bank.evaluate(term, bank.checks[i]))
+            return false;
+        }
+
+        return true;
+      }
+
+
+      bool Synthesizer::enumerativeSynthesis(const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node, SynthesisResult& result) {
+        triton::usize term = 0;
 
-            // Inject values
-            actx->updateVariable(var_x->getName(), oracle.x);
-            actx->updateVariable(var_y->getName(), oracle.y);
-            if (node->evaluate() != oracle.r) {
-              found = false;
-              break;
+        /* The term may have been looked up in parallel */
+        auto it = this->oracles.find(node.get());
+        bool found = (it != this->oracles.end() && !it->second.node.expired()) ? ((term = it->second.term), it->second.enumerated) : Synthesizer::enumerativeOracle(vars, node, term);
+
+        // If a term is found, we craft a synthesized node.
+        if (found) {
+          result.setOutput(TermBank::get(node->getBitvectorSize()).build(node->getContext(), term, vars));
+          result.setSuccess(true);
+        }
+
+        return result.successful();
+      }
+
+
+      void Synthesizer::parallelOracles(const triton::ast::SharedAbstractNode& node) {
+        /* A queue of nodes to look up, the one of a thread is stolen by the others once they are idle */
+        struct Queue {
+          std::mutex lock;
+          std::deque<triton::ast::SharedAbstractNode> nodes;
+        };
+
+        auto& executor = triton::utils::Executor::getDefault();
+        triton::usize threads = executor.getThreads();
+        std::vector<Queue> queues(threads);
+        std::vector<std::vector<std::pair<triton::ast::SharedAbstractNode, Lookup>>> found(threads);
+        std::unordered_set<const triton::ast::AbstractNode*> visited;
+        std::mutex visitedLock;
+        std::atomic<triton::usize> pending(0);
+        std::exception_ptr error = nullptr;
+        std::mutex errorLock;
+
+        /* Queues the children of a node, as childrenSynthesis() visits them */
+        auto expand = [&](triton::ast::AbstractNode* current, Queue& queue) {
+          while (current->getType() == triton::ast::REFERENCE_NODE)
+            current = reinterpret_cast<triton::ast::ReferenceNode*>(current)->getSymbolicExpression()->getAst().get();
+
+          for (const auto& child : current->getChildren()) {
+            {
+              std::lock_guard<std::mutex> guard(visitedLock);
+              if (!visited.insert(child.get()).second)
+                continue;
             }
+            pending++;
+            std::lock_guard<std::mutex> guard(queue.lock);
+            queue.nodes.push_back(child);
           }
+        };
+
+        /*
+         * The nodes are only read by the threads: each one compiles its own evaluators and the
+         * synthesized nodes are built afterwards by childrenSynthesis(), in the AST context.
+         */
+        auto work = [&](triton::usize index) {
+          while (pending > 0) {
+            triton::ast::SharedAbstractNode current = nullptr;
+
+            /* Its own nodes are taken from the back, the stolen ones from the front */
+            for (triton::usize i = 0; i < threads && current == nullptr; i++) {
+              Queue& queue = queues[(index + i) % threads];
+              std::lock_guard<std::mutex> guard(queue.lock);
+              if (queue.nodes.empty())
+                continue;
+              if (i == 0) {
+                current = queue.nodes.back();
+                queue.nodes.pop_back();
+              }
+              else {
+                current = queue.nodes.front();
+                queue.nodes.pop_front();
+              }
+            }
 
-          // If an oracle is found, we craft a synthesized node.
-          if (found) {
-            switch (op) {
-              case triton::ast::BVADD_NODE:   result.setOutput(actx->bvadd(actx->variable(var_x),  actx->variable(var_y))); break;
-              case triton::ast::BVAND_NODE:   result.setOutput(actx->bvand(actx->variable(var_x),  actx->variable(var_y))); break;
-              case triton::ast::BVMUL_NODE:   result.setOutput(actx->bvmul(actx->variable(var_x),  actx->variable(var_y))); break;
-              case triton::ast::BVNAND_NODE:  result.setOutput(actx->bvnand(actx->variable(var_x), actx->variable(var_y))); break;
-              case triton::ast::BVNOR_NODE:   result.setOutput(actx->bvnor(actx->variable(var_x),  actx->variable(var_y))); break;
-              case triton::ast::BVOR_NODE:    result.setOutput(actx->bvor(actx->variable(var_x),   actx->variable(var_y))); break;
-              case triton::ast::BVROL_NODE:   result.setOutput(actx->bvrol(actx->variable(var_x),  actx->variable(var_y))); break;
-              case triton::ast::BVROR_NODE:   result.setOutput(actx->bvror(actx->variable(var_x),  actx->variable(var_y))); break;
-              case triton::ast::BVSDIV_NODE:  result.setOutput(actx->bvsdiv(actx->variable(var_x), actx->variable(var_y))); break;
-              case triton::ast::BVSMOD_NODE:  result.setOutput(actx->bvsmod(actx->variable(var_x), actx->variable(var_y))); break;
-              case triton::ast::BVSREM_NODE:  result.setOutput(actx->bvsrem(actx->variable(var_x), actx->variable(var_y))); break;
-              case triton::ast::BVSUB_NODE:   result.setOutput(actx->bvsub(actx->variable(var_x),  actx->variable(var_y))); break;
-              case triton::ast::BVUDIV_NODE:  result.setOutput(actx->bvudiv(actx->variable(var_x), actx->variable(var_y))); break;
-              case triton::ast::BVUREM_NODE:  result.setOutput(actx->bvurem(actx->variable(var_x), actx->variable(var_y))); break;
-              case triton::ast::BVXNOR_NODE:  result.setOutput(actx->bvxnor(actx->variable(var_x), actx->variable(var_y))); break;
-              case triton::ast::BVXOR_NODE:   result.setOutput(actx->bvxor(actx->variable(var_x),  actx->variable(var_y))); break;
-              default:
-                throw triton::exceptions::SynthesizerEngine("Synthesizer::binaryOperatorSynthesis(): Invalid type of operator.");
+            if (current == nullptr) {
+              std::this_thread::yield();
+              continue;
             }
 
-            // Adjust the size of the destination
-            auto out     = result.getOutput();
-            auto in      = node;
-            auto outsize = out->getBitvectorSize();
-            auto insize  = in->getBitvectorSize();
-            if (insize > outsize) {
-              result.setOutput(actx->zx(insize - outsize, out));
+            try {
+              Lookup lookup = {current, triton::ast::INVALID_NODE, false, 0};
+
+              /* A node without variable has no child to synthesize */
+              if (current->isSymbolized()) {
+                auto vars = (current->getLevel() > 2) ? variablesOf(current, TERM_VARIABLES) : std::deque<triton::ast::SharedAbstractNode>();
+                if (vars.size() == 1)
+                  Synthesizer::unaryOperatorOracle(vars, current, lookup.op);
+                else if (vars.size() == 2)
+                  Synthesizer::binaryOperatorOracle(vars, current, lookup.op);
+                if (vars.size() && lookup.op == triton::ast::INVALID_NODE)
+                  lookup.enumerated = Synthesizer::enumerativeOracle(vars, current, lookup.term);
+                if (vars.size())
+                  found[index].push_back({current, lookup});
+                if (lookup.op == triton::ast::INVALID_NODE && !lookup.enumerated)
+                  expand(current.get(), queues[index]);
+              }
+            }
+            catch (...) {
+              std::lock_guard<std::mutex> guard(errorLock);
+              if (error == nullptr)
+                error = std::current_exception();
             }
 
-            // Stop iterating over oracles
-            result.setSuccess(true);
-            break;
+            /* Done once its children are queued, so that the count only drops to zero at the end */
+            pending--;
           }
-          // If not found, continuing to iterate over oracles
-        }
+        };
 
-        // Whatever the result, we must restore orignal value of symbolic variables
-        actx->updateVariable(var_x->getName(), save_x);
-        actx->updateVariable(var_y->getName(), save_y);
+        expand(node.get(), queues[0]);
 
-        return result.successful();
+        /* A task alone looks up all the nodes, the ones not started while the others are busy find nothing to do */
+        std::vector<triton::utils::SharedExecutorTask> tasks;
+        for (triton::usize index = 0; index < threads; index++)
+          tasks.push_back(executor.submit([&work, index](const triton::utils::ExecutorTask&) { work(index); }, triton::utils::PRIORITY_HIGH));
+
+        for (const auto& task : tasks)
+          executor.wait(task);
+
+        if (error != nullptr)
+          std::rethrow_exception(error);
+
+        for (const auto& results : found) {
+          for (const auto& item : results)
+            this->oracles[item.first.get()] = item.second;
+        }
       }
 
 
-      bool Synthesizer::childrenSynthesis(const triton::ast::SharedAbstractNode& node, bool constant, bool opaque, SynthesisResult& result) {
+      bool Synthesizer::childrenSynthesis(const triton::ast::SharedAbstractNode& node, bool constant, bool opaque, bool parallel, SynthesisResult& result) {
         std::stack<triton::ast::AbstractNode*>                worklist;
         std::unordered_set<const triton::ast::AbstractNode*>  visited;
 
+        // The oracles are looked up first, the children are then synthesized as usual
+        if (parallel) {
+          this->parallelOracles(node);
+        }
+
+        // Once a node is modified, its oracle and the ones of its ancestors are outdated
+        std::unordered_set<const triton::ast::AbstractNode*> outdated;
+        auto outdate = [&](triton::ast::AbstractNode* modified) {
+          std::vector<triton::ast::SharedAbstractNode> nodes = {modified->shared_from_this()};
+          while (!nodes.empty()) {
+            auto n = nodes.back();
+            nodes.pop_back();
+            if (!outdated.insert(n.get()).second)
+              continue;
+            this->oracles.erase(n.get());
+            for (const auto& parent : n->getParents())
+              nodes.push_back(parent);
+          }
+        };
+
         bool ret = false;
         worklist.push(node.get());
         while (!worklist.empty()) {
@@ -360,6 +661,8 @@ namespace triton {
                 triton::ast::SharedAbstractNode subvar = this->symbolizeSubExpression(child, tmp);
                 /* Replace the child on the fly */
                 current->setChild(index++, subvar);
+                if (!this->oracles.empty())
+                  outdate(current);
                 /* Set true because we synthesized at least one child */
                 result.setSuccess(true);
                 ret = true;
@@ -371,6 +674,9 @@ namespace triton {
           }
         }
 
+        // The nodes may be modified by the next pass
+        this->oracles.clear();
+
         /*
          * If we synthesized at least one child, we set the output as 'node'
          * because it has been modified on the fly
@@ -0,0 +1,227 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+
+#include <triton/exceptions.hpp>
+#include <triton/termBank.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace synthesis {
+
+      /* The operators of the terms */
+      static const triton::ast::ast_e unaryOperators[] = {
+        triton::ast::BVNEG_NODE,
+        triton::ast::BVNOT_NODE,
+      };
+
+      static const triton::ast::ast_e binaryOperators[] = {
+        triton::ast::BVADD_NODE,
+        triton::ast::BVAND_NODE,
+        triton::ast::BVLSHR_NODE,
+        triton::ast::BVMUL_NODE,
+        triton::ast::BVOR_NODE,
+        triton::ast::BVSHL_NODE,
+        triton::ast::BVSUB_NODE,
+        triton::ast::BVXOR_NODE,
+      };
+
+
+      /* Returns the next value of a splitmix64 generator, the inputs do not change from a run to another */
+      static triton::uint64 nextValue(triton::uint64& state) {
+        triton::uint64 z = (state += 0x9e3779b97f4a7c15ULL);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+      }
+
+
+      /* Returns the mask of a size */
+      static triton::uint64 maskOf(triton::uint32 bits) {
+        return (bits >= 64) ? ~static_cast<triton::uint64>(0) : ((static_cast<triton::uint64>(1) << bits) - 1);
+      }
+
+
+      /* Applies an operator of the terms */
+      static triton::uint64 apply(triton::ast::ast_e type, triton::uint64 x, triton::uint64 y, triton::uint32 bits) {
+        triton::uint64 mask = maskOf(bits);
+
+        switch (type) {
+          case triton::ast::BVADD_NODE:  return (x + y) & mask;
+          case triton::ast::BVAND_NODE:  return x & y;
+          case triton::ast::BVLSHR_NODE: return (y >= bits) ? 0 : (x >> y);
+          case triton::ast::BVMUL_NODE:  return (x * y) & mask;
+          case triton::ast::BVNEG_NODE:  return (0 - x) & mask;
+          case triton::ast::BVNOT_NODE:  return ~x & mask;
+          case triton::ast::BVOR_NODE:   return x | y;
+          case triton::ast::BVSHL_NODE:  return (y >= bits) ? 0 : ((x << y) & mask);
+          case triton::ast::BVSUB_NODE:  return (x - y) & mask;
+          case triton::ast::BVXOR_NODE:  return x ^ y;
+          default:
+            throw triton::exceptions::SynthesizerEngine("TermBank::apply(): Invalid type of operator.");
+        }
+      }
+
+
+      TermBank::TermBank(triton::uint32 bits)
+        : bits(bits) {
+        std::vector<std::vector<triton::usize>> sizes(TERM_MAX_SIZE + 1);
+        std::vector<TermValues> results;
+        triton::uint64 mask  = maskOf(bits);
+        triton::uint64 state = bits;
+
+        /*
+         * The first inputs are the combinations of 0 and -1, then of 1 and the sign bit, the
+         * others are random.
+         */
+        for (triton::usize i = 0; i < TERM_INPUTS; i++) {
+          for (triton::usize v = 0; v < TERM_VARIABLES; v++) {
+            bool set = ((i >> v) & 1);
+            if (i < 8)
+              this->inputs[v][i] = set ? mask : 0;
+            else if (i < 16)
+              this->inputs[v][i] = set ? 1 : (static_cast<triton::uint64>(1) << (bits - 1));
+            else
+              this->inputs[v][i] = nextValue(state) & mask;
+          }
+        }
+
+        /* The checks are random */
+        this->checks.resize(TERM_CHECKS);
+        for (auto& check : this->checks) {
+          for (auto& value : check)
+            value = nextValue(state) & mask;
+        }
+
+        /* A term is kept if no smaller term has the same results */
+        auto add = [&](const Term& term, const TermValues& values) {
+          if (this->index.emplace(values, this->terms.size()).second) {
+            sizes[term.size].push_back(this->terms.size());
+            this->terms.push_back(term);
+            results.push_back(values);
+          }
+        };
+
+        for (triton::usize v = 0; v < TERM_VARIABLES; v++)
+          add({triton::ast::VARIABLE_NODE, 1, 1, v, 0}, this->inputs[v]);
+
+        TermValues one;
+        one.fill(1);
+        add({triton::ast::BV_NODE, 1, 2, 1, 0}, one);
+
+        for (triton::uint32 size = 2; size <= TERM_MAX_SIZE; size++) {
+          TermValues values;
+
+          for (triton::ast::ast_e type : unaryOperators) {
+            for (triton::usize x : sizes[size - 1]) {
+              for (triton::usize i = 0; i < TERM_INPUTS; i++)
+                values[i] = apply(type, results[x][i], 0, bits);
+              add({type, size, this->terms[x].level + 1, x, 0}, values);
+            }
+          }
+
+          for (triton::uint32 lsize = 1; lsize + 1 < size; lsize++) {
+            triton::uint32 rsize = size - 1 - lsize;
+            for (triton::ast::ast_e type : binaryOperators) {
+              bool commutative = (type == triton::ast::BVADD_NODE || type == triton::ast::BVAND_NODE || type == triton::ast::BVMUL_NODE || type == triton::ast::BVOR_NODE || type == triton::ast::BVXOR_NODE);
+              /* The operands of a commutative operator are enumerated once, the smallest on the left */
+              if (commutative && lsize > rsize)
+                continue;
+              for (triton::usize x : sizes[lsize]) {
+                for (triton::usize y : sizes[rsize]) {
+                  if (commutative && lsize == rsize && x > y)
+                    continue;
+                  for (triton::usize i = 0; i < TERM_INPUTS; i++)
+                    values[i] = apply(type, results[x][i], results[y][i], bits);
+                  add({type, size, std::max(this->terms[x].level, this->terms[y].level) + 1, x, y}, values);
+                }
+              }
+            }
+          }
+        }
+      }
+
+
+      const TermBank& TermBank::get(triton::uint32 bits) {
+        /* Built once, the initialization of static locals is thread-safe */
+        switch (bits) {
+          case 8:  { static const TermBank bank(8);  return bank; }
+          case 16: { static const TermBank bank(16); return bank; }
+          case 32: { static const TermBank bank(32); return bank; }
+          case 64: { static const TermBank bank(64); return bank; }
+          default:
+            throw triton::exceptions::SynthesizerEngine("TermBank::get(): Invalid size of terms.");
+        }
+      }
+
+
+      bool TermBank::find(const std::vector<triton::uint512>& signature, triton::usize& term) const {
+        TermValues values;
+
+        if (signature.size() != TERM_INPUTS)
+          return false;
+
+        /* An evaluation wider than the terms cannot be one of their results */
+        for (triton::usize i = 0; i < TERM_INPUTS; i++) {
+          if (signature[i] >> this->bits)
+            return false;
+          values[i] = static_cast<triton::uint64>(signature[i]);
+        }
+
+        auto it = this->index.find(values);
+        if (it == this->index.end())
+          return false;
+
+        term = it->second;
+        return true;
+      }
+
+
+      triton::uint64 TermBank::evaluate(triton::usize term, const std::array<triton::uint64, TERM_VARIABLES>& values) const {
+        const Term& t = this->terms.at(term);
+
+        switch (t.type) {
+          case triton::ast::VARIABLE_NODE:
+            return values[t.left] & maskOf(this->bits);
+          case triton::ast::BV_NODE:
+            return t.left;
+          case triton::ast::BVNEG_NODE:
+          case triton::ast::BVNOT_NODE:
+            return apply(t.type, this->evaluate(t.left, values), 0, this->bits);
+          default:
+            return apply(t.type, this->evaluate(t.left, values), this->evaluate(t.right, values), this->bits);
+        }
+      }
+
+
+      triton::ast::SharedAbstractNode TermBank::build(const triton::ast::SharedAstContext& actx, triton::usize term, const std::deque<triton::ast::SharedAbstractNode>& vars) const {
+        const Term& t = this->terms.at(term);
+
+        switch (t.type) {
+          case triton::ast::VARIABLE_NODE: return vars.at(t.left);
+          case triton::ast::BV_NODE:       return actx->bv(t.left, this->bits);
+          case triton::ast::BVNEG_NODE:    return actx->bvneg(this->build(actx, t.left, vars));
+          case triton::ast::BVNOT_NODE:    return actx->bvnot(this->build(actx, t.left, vars));
+          case triton::ast::BVADD_NODE:    return actx->bvadd(this->build(actx, t.left, vars), this->build(actx, t.right, vars));
+          case triton::ast::BVAND_NODE:    return actx->bvand(this->build(actx, t.left, vars), this->build(actx, t.right, vars));
+          case triton::ast::BVLSHR_NODE:   return actx->bvlshr(this->build(actx, t.left, vars), this->build(actx, t.right, vars));
+          case triton::ast::BVMUL_NODE:    return actx->bvmul(this->build(actx, t.left, vars), this->build(actx, t.right, vars));
+          case triton::ast::BVOR_NODE:     return actx->bvor(this->build(actx, t.left, vars), this->build(actx, t.right, vars));
+          case triton::ast::BVSHL_NODE:    return actx->bvshl(this->build(actx, t.left, vars), this->build(actx, t.right, vars));
+          case triton::ast::BVSUB_NODE:    return actx->bvsub(this->build(actx, t.left, vars), this->build(actx, t.right, vars));
+          case triton::ast::BVXOR_NODE:    return actx->bvxor(this->build(actx, t.left, vars), this->build(actx, t.right, vars));
+          default:
+            throw triton::exceptions::SynthesizerEngine("TermBank::build(): Invalid type of operator.");
+        }
+      }
+
+    }; /* synthesis namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
@@ -5,6 +5,8 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <algorithm>
+
 #include <triton/exceptions.hpp>
 #include <triton/taintEngine.hpp>
 
@@ -14,11 +16,19 @@ namespace triton {
   namespace engines {
     namespace taint {
 
+      /* Returns the mask of `size` bits, all of them from 64 bits */
+      static inline triton::uint64 bitMask(triton::uint32 size) {
+        return (size >= triton::bitsize::qword) ? ~static_cast<triton::uint64>(0) : ((static_cast<triton::uint64>(1) << size) - 1);
+      }
+
+
       TaintEngine::TaintEngine(const triton::modes::SharedModes& modes, triton::engines::symbolic::SymbolicEngine* symbolicEngine, triton::arch::CpuInterface& cpu)
         : modes(modes),
           symbolicEngine(symbolicEngine),
           cpu(cpu),
-          enableFlag(true) {
+          statistics(nullptr),
+          enableFlag(true),
+          thread(0) {
 
         if (this->symbolicEngine == nullptr)
           throw triton::exceptions::TaintEngine("TaintEngine::TaintEngine(): The symbolicEngine TaintEngine cannot be null.");
@@ -28,37 +38,237 @@ namespace triton {
       TaintEngine::TaintEngine(const TaintEngine& other)
         : modes(other.modes),
           cpu(other.cpu) {
-        this->enableFlag       = other.enableFlag;
-        this->symbolicEngine   = other.symbolicEngine;
-        this->taintedMemory    = other.taintedMemory;
-        this->taintedRegisters = other.taintedRegisters;
+        this->enableFlag            = other.enableFlag;
+        this->statistics            = other.statistics;
+        this->symbolicEngine        = other.symbolicEngine;
+        this->taintedMemory         = other.taintedMemory;
+        this->taintedRegisters      = other.taintedRegisters;
+        this->taintedRegisterLabels = other.taintedRegisterLabels;
+        this->taintedRegisterBits   = other.taintedRegisterBits;
+        this->thread                = other.thread;
+        this->threads               = other.threads;
       }
 
 
       TaintEngine& TaintEngine::operator=(const TaintEngine& other) {
-        this->cpu              = other.cpu;
-        this->enableFlag       = other.enableFlag;
-        this->modes            = other.modes;
-        this->symbolicEngine   = other.symbolicEngine;
-        this->taintedMemory    = other.taintedMemory;
-        this->taintedRegisters = other.taintedRegisters;
+        this->cpu                   = other.cpu;
+        this->enableFlag            = other.enableFlag;
+        this->modes                 = other.modes;
+        this->statistics            = other.statistics;
+        this->symbolicEngine        = other.symbolicEngine;
+        this->taintedMemory         = other.taintedMemory;
+        this->taintedRegisters      = other.taintedRegisters;
+        this->taintedRegisterLabels = other.taintedRegisterLabels;
+        this->taintedRegisterBits   = other.taintedRegisterBits;
+        this->thread                = other.thread;
+        this->threads               = other.threads;
         return *this;
       }
 
 
+      void TaintEngine::copyState(const TaintEngine& other) {
+        this->enableFlag            = other.enableFlag;
+        this->taintedMemory         = other.taintedMemory;
+        this->taintedRegisters      = other.taintedRegisters;
+        this->taintedRegisterLabels = other.taintedRegisterLabels;
+        this->taintedRegisterBits   = other.taintedRegisterBits;
+        this->thread                = other.thread;
+        this->threads               = other.threads;
+      }
+
+
+      void TaintEngine::setThread(triton::uint32 tid) {
+        if (tid == this->thread)
+          return;
+
+        /* The persistent maps are shared, not copied, and the register set is a few words */
+        ThreadRegisters current;
+        current.taintedRegisters      = this->taintedRegisters;
+        current.taintedRegisterLabels = this->taintedRegisterLabels;
+        current.taintedRegisterBits   = this->taintedRegisterBits;
+
+        auto next = this->threads.find(tid);
+        if (next != this->threads.end()) {
+          this->taintedRegisters      = std::move(next->second.taintedRegisters);
+          this->taintedRegisterLabels = std::move(next->second.taintedRegisterLabels);
+          this->taintedRegisterBits   = std::move(next->second.taintedRegisterBits);
+          this->threads.erase(next);
+        }
+
+        this->threads[this->thread] = std::move(current);
+        this->thread = tid;
+      }
+
+
+      void TaintEngine::removeThread(triton::uint32 tid) {
+        if (tid == this->thread)
+          throw triton::exceptions::TaintEngine("TaintEngine::removeThread(): Cannot remove the current thread.");
+        this->threads.erase(tid);
+      }
+
+
       bool TaintEngine::isEnabled(void) const {
         return this->enableFlag;
       }
 
 
+      bool TaintEngine::isEmpty(void) const {
+        return this->taintedMemory.size() == 0 && this->taintedRegisters.empty();
+      }
+
+
       void TaintEngine::enable(bool flag) {
         this->enableFlag = flag;
       }
 
 
+      void TaintEngine::setStatistics(triton::arch::ProcessingStatistics* statistics) {
+        this->statistics = statistics;
+      }
+
+
+      bool TaintEngine::isBitPrecise(const triton::arch::Register& reg) const {
+        if (!this->modes->isModeEnabled(triton::modes::TAINT_BIT_PRECISE))
+          return false;
+        return this->cpu.getRegister(reg.getParent()).getBitSize() <= triton::bitsize::qword;
+      }
+
+
+      triton::uint64 TaintEngine::getParentMask(const triton::arch::Register& reg) const {
+        return bitMask(this->cpu.getRegister(reg.getParent()).getBitSize());
+      }
+
+
+      triton::uint64 TaintEngine::getParentTaintBits(const triton::arch::Register& reg) const {
+        if (!this->taintedRegisters.contains(reg.getParent()))
+          return 0;
+
+        const triton::uint64* bits = this->taintedRegisterBits.find(reg.getParent());
+        return bits ? *bits : this->getParentMask(reg);
+      }
+
+
+      void TaintEngine::setParentTaintBits(const triton::arch::Register& reg, triton::uint64 bits) {
+        triton::arch::register_e parent = reg.getParent();
+        triton::uint64 mask = this->getParentMask(reg);
+
+        bits &= mask;
+        if (bits == 0) {
+          this->taintedRegisters.erase(parent);
+          this->taintedRegisterLabels.erase(parent);
+          this->taintedRegisterBits.erase(parent);
+          return;
+        }
+
+        this->taintedRegisters.insert(parent);
+        if (bits == mask)
+          this->taintedRegisterBits.erase(parent);
+        else
+          this->taintedRegisterBits.set(parent, bits);
+      }
+
+
+      triton::uint64 TaintEngine::getOperandTaintBits(const triton::arch::OperandWrapper& op) const {
+        switch (op.getType()) {
+          case triton::arch::OP_IMM:
+            return 0;
+
+          case triton::arch::OP_REG:
+            return this->getRegisterTaintBits(op.getConstRegister());
+
+          case triton::arch::OP_MEM: {
+            const triton::arch::MemoryAccess& mem = op.getConstMemory();
+            triton::uint64 mask = bitMask(mem.getBitSize());
+
+            /* Through a tainted pointer, all the bits are tainted */
+            if (this->isMemoryTainted(mem) && !this->isMemoryTainted(mem, false))
+              return mask;
+
+            triton::uint64 bits = 0;
+            triton::uint32 size = std::min(mem.getSize(), triton::size::qword);
+            for (triton::uint32 i = 0; i != size; i++) {
+              if (this->taintedMemory.isTainted(mem.getAddress() + i))
+                bits |= static_cast<triton::uint64>(0xff) << (i * triton::bitsize::byte);
+            }
+
+            return bits & mask;
+          }
+
+          default:
+            throw triton::exceptions::TaintEngine("TaintEngine::getOperandTaintBits(): Invalid operand.");
+        }
+      }
+
+
+      triton::uint64 TaintEngine::extendTaintBits(triton::uint64 bits, triton::uint32 srcSize, triton::uint32 dstSize) const {
+        if (srcSize == 0 || srcSize >= dstSize)
+          return bits & bitMask(dstSize);
+
+        /* The sign extensions spread the sign bit, the zero extensions are over-approximated the same way */
+        if ((bits >> (srcSize - 1)) & 1)
+          bits |= bitMask(dstSize) & ~bitMask(srcSize);
+
+        return bits & bitMask(dstSize);
+      }
+
+
+      bool TaintEngine::hasLabels(void) const {
+        return this->taintedMemory.hasLabels() || !this->taintedRegisterLabels.empty();
+      }
+
+
+      void TaintEngine::setRegisterLabels(const triton::arch::Register& reg, const TaintLabels& labels) {
+        if (labels.empty())
+          this->taintedRegisterLabels.erase(reg.getParent());
+        else
+          this->taintedRegisterLabels.set(reg.getParent(), labels);
+      }
+
+
+      void TaintEngine::addRegisterLabels(const triton::arch::Register& reg, const TaintLabels& labels) {
+        if (!labels.empty())
+          this->taintedRegisterLabels.modify(reg.getParent()) |= labels;
+      }
+
+
+      /* Returns the labels of the address:size */
+      TaintLabels TaintEngine::getMemoryTaintLabels(triton::uint64 addr, triton::uint32 size) const {
+        return this->taintedMemory.getLabels(addr, size);
+      }
+
+
+      /* Returns the labels of the memory */
+      TaintLabels TaintEngine::getMemoryTaintLabels(const triton::arch::MemoryAccess& mem, bool mode) const {
+        TaintLabels labels = this->taintedMemory.getLabels(mem.getAddress(), mem.getSize());
+
+        /* Spread the labels through pointers if the mode is enabled */
+        if (mode && this->modes->isModeEnabled(triton::modes::TAINT_THROUGH_POINTERS)) {
+          labels |= this->getRegisterTaintLabels(mem.getConstBaseRegister());
+          labels |= this->getRegisterTaintLabels(mem.getConstIndexRegister());
+          labels |= this->getRegisterTaintLabels(mem.getConstSegmentRegister());
+        }
+
+        return labels;
+      }
+
+
+      /* Returns the labels of the register */
+      TaintLabels TaintEngine::getRegisterTaintLabels(const triton::arch::Register& reg) const {
+        const TaintLabels* labels = this->taintedRegisterLabels.find(reg.getParent());
+        return labels ? *labels : TaintLabels();
+      }
+
+
       /* Returns the tainted addresses */
-      const std::unordered_set<triton::uint64>& TaintEngine::getTaintedMemory(void) const {
-        return this->taintedMemory;
+      std::unordered_set<triton::uint64> TaintEngine::getTaintedMemory(void) const {
+        std::unordered_set<triton::uint64> res;
+
+        res.reserve(this->taintedMemory.size());
+        this->taintedMemory.forEach([&res](triton::uint64 addr) {
+          res.insert(addr);
+        });
+
+        return res;
       }
 
 
@@ -66,22 +276,30 @@ namespace triton {
       std::unordered_set<const triton::arch::Register*> TaintEngine::getTaintedRegisters(void) const {
         std::unordered_set<const triton::arch::Register*> res;
 
-        for (auto id : this->taintedRegisters)
+        /* Scans the words of the set */
+        this->taintedRegisters.forEach([&](triton::arch::register_e id) {
           res.insert(&this->cpu.getRegister(id));
+        });
 
         return res;
       }
 
 
+      void TaintEngine::getMemoryUsage(triton::MemoryUsage& usage) const {
+        usage.taintedMemory.count    = this->taintedMemory.size();
+        usage.taintedMemory.bytes    = this->taintedMemory.getBytes();
+        usage.taintedRegisters.count = this->taintedRegisters.size();
+        usage.taintedRegisters.bytes = sizeof(TaintRegisters);
+      }
+
+
       /* Returns true of false if the memory address is currently tainted */
       bool TaintEngine::isMemoryTainted(const triton::arch::MemoryAccess& mem, bool mode) const {
         triton::uint64 addr = mem.getAddress();
         triton::uint32 size = mem.getSize();
 
-        for (triton::uint32 index = 0; index < size; index++) {
-          if (this->taintedMemory.find(addr+index) != this->taintedMemory.end())
-            return TAINTED;
-        }
+        if (this->taintedMemory.isTainted(addr, size))
+          return TAINTED;
 
         /* Spread the taint through pointers if the mode is enabled */
         if (mode && this->modes->isModeEnabled(triton::modes::TAINT_THROUGH_POINTERS)) {
@@ -99,10 +317,8 @@ namespace triton {
 
       /* Returns true of false if the address is currently tainted */
       bool TaintEngine::isMemoryTainted(triton::uint64 addr, triton::uint32 size) const {
-        for (triton::uint32 index = 0; index < size; index++) {
-          if (this->taintedMemory.find(addr+index) != this->taintedMemory.end())
-            return TAINTED;
-        }
+        if (this->taintedMemory.isTainted(addr, size))
+          return TAINTED;
 
         return !TAINTED;
       }
@@ -110,13 +326,27 @@ namespace triton {
 
       /* Returns true of false if the register is currently tainted */
       bool TaintEngine::isRegisterTainted(const triton::arch::Register& reg) const {
-        if (this->taintedRegisters.find(reg.getParent()) != this->taintedRegisters.end())
+        if (this->getRegisterTaintBits(reg) != 0)
           return TAINTED;
 
         return !TAINTED;
       }
 
 
+      /* Returns the tainted bits of the register */
+      triton::uint64 TaintEngine::getRegisterTaintBits(const triton::arch::Register& reg) const {
+        if (!this->taintedRegisters.contains(reg.getParent()))
+          return 0;
+
+        /* Only the partially tainted parents have their bits */
+        const triton::uint64* bits = this->taintedRegisterBits.find(reg.getParent());
+        if (bits == nullptr)
+          return bitMask(reg.getBitSize());
+
+        return (*bits >> reg.getLow()) & bitMask(reg.getBitSize());
+      }
+
+
       /* Abstract taint verification. */
       bool TaintEngine::isTainted(const triton::arch::OperandWrapper& op) const {
         switch (op.getType()) {
@@ -133,7 +363,26 @@ namespace triton {
       bool TaintEngine::taintRegister(const triton::arch::Register& reg) {
         if (!this->isEnabled())
           return this->isRegisterTainted(reg);
+
+        if (this->isBitPrecise(reg)) {
+          this->setParentTaintBits(reg, this->getParentTaintBits(reg) | (bitMask(reg.getBitSize()) << reg.getLow()));
+          return TAINTED;
+        }
+
         this->taintedRegisters.insert(reg.getParent());
+        if (!this->taintedRegisterBits.empty())
+          this->taintedRegisterBits.erase(reg.getParent());
+
+        return TAINTED;
+      }
+
+
+      /* Taint the register with a label */
+      bool TaintEngine::taintRegister(const triton::arch::Register& reg, triton::uint32 label) {
+        if (!this->isEnabled())
+          return this->isRegisterTainted(reg);
+        this->taintRegister(reg);
+        this->addRegisterLabels(reg, TaintLabels(label));
 
         return TAINTED;
       }
@@ -143,12 +392,38 @@ namespace triton {
       bool TaintEngine::untaintRegister(const triton::arch::Register& reg) {
         if (!this->isEnabled())
           return this->isRegisterTainted(reg);
+
+        if (this->isBitPrecise(reg)) {
+          this->setParentTaintBits(reg, this->getParentTaintBits(reg) & ~(bitMask(reg.getBitSize()) << reg.getLow()));
+          return !TAINTED;
+        }
+
         this->taintedRegisters.erase(reg.getParent());
+        this->taintedRegisterLabels.erase(reg.getParent());
+        if (!this->taintedRegisterBits.empty())
+          this->taintedRegisterBits.erase(reg.getParent());
 
         return !TAINTED;
       }
 
 
+      /* Sets the tainted bits of the register */
+      bool TaintEngine::setRegisterTaintBits(const triton::arch::Register& reg, triton::uint64 bits) {
+        if (!this->isEnabled())
+          return this->isRegisterTainted(reg);
+
+        triton::uint64 mask = bitMask(reg.getBitSize());
+
+        bits &= mask;
+        if (!this->isBitPrecise(reg))
+          return (bits != 0) ? this->taintRegister(reg) : this->untaintRegister(reg);
+
+        this->setParentTaintBits(reg, (this->getParentTaintBits(reg) & ~(mask << reg.getLow())) | (bits << reg.getLow()));
+
+        return (bits != 0);
+      }
+
+
       /* Sets the flag (taint or untaint) to an abstract operand (Register or Memory). */
       bool TaintEngine::setTaint(const triton::arch::OperandWrapper& op, bool flag) {
         switch (op.getType()) {
@@ -199,8 +474,7 @@ namespace triton {
         if (!this->isEnabled())
           return this->isMemoryTainted(mem);
 
-        for (triton::uint32 index = 0; index < size; index++)
-          this->taintedMemory.insert(addr+index);
+        this->taintedMemory.taint(addr, size);
 
         return TAINTED;
       }
@@ -210,7 +484,27 @@ namespace triton {
       bool TaintEngine::taintMemory(triton::uint64 addr) {
         if (!this->isEnabled())
           return this->isMemoryTainted(addr);
-        this->taintedMemory.insert(addr);
+        this->taintedMemory.taint(addr);
+        return TAINTED;
+      }
+
+
+      /* Taint the address with a label */
+      bool TaintEngine::taintMemory(triton::uint64 addr, triton::uint32 label) {
+        if (!this->isEnabled())
+          return this->isMemoryTainted(addr);
+        this->taintedMemory.taint(addr);
+        this->taintedMemory.addLabels(addr, 1, TaintLabels(label));
+        return TAINTED;
+      }
+
+
+      /* Taint the memory with a label */
+      bool TaintEngine::taintMemory(const triton::arch::MemoryAccess& mem, triton::uint32 label) {
+        if (!this->isEnabled())
+          return this->isMemoryTainted(mem);
+        this->taintedMemory.taint(mem.getAddress(), mem.getSize());
+        this->taintedMemory.addLabels(mem.getAddress(), mem.getSize(), TaintLabels(label));
         return TAINTED;
       }
 
@@ -223,8 +517,7 @@ namespace triton {
         if (!this->isEnabled())
           return this->isMemoryTainted(mem);
 
-        for (triton::uint32 index = 0; index < size; index++)
-          this->taintedMemory.erase(addr+index);
+        this->taintedMemory.untaint(addr, size);
 
         return !TAINTED;
       }
@@ -234,13 +527,15 @@ namespace triton {
       bool TaintEngine::untaintMemory(triton::uint64 addr) {
         if (!this->isEnabled())
           return this->isMemoryTainted(addr);
-        this->taintedMemory.erase(addr);
+        this->taintedMemory.untaint(addr);
         return !TAINTED;
       }
 
 
       /* Abstract union tainting */
       bool TaintEngine::taintUnion(const triton::arch::OperandWrapper& op1, const triton::arch::OperandWrapper& op2) {
+        triton::arch::PhaseTimer timer(this->statistics, triton::arch::PHASE_TAINT);
+
         triton::uint32 t1 = op1.getType();
         triton::uint32 t2 = op2.getType();
 
@@ -268,6 +563,8 @@ namespace triton {
 
       /* Abstract assignment tainting */
       bool TaintEngine::taintAssignment(const triton::arch::OperandWrapper& op1, const triton::arch::OperandWrapper& op2) {
+        triton::arch::PhaseTimer timer(this->statistics, triton::arch::PHASE_TAINT);
+
         triton::uint32 t1 = op1.getType();
         triton::uint32 t2 = op2.getType();
 
@@ -294,6 +591,8 @@ namespace triton {
 
 
       bool TaintEngine::taintUnion(const triton::arch::MemoryAccess& memDst, const triton::arch::Immediate& imm) {
+        triton::arch::PhaseTimer timer(this->statistics, triton::arch::PHASE_TAINT);
+
         bool flag = triton::engines::taint::UNTAINTED;
         triton::uint64 memAddrDst = memDst.getAddress();
         triton::uint32 writeSize  = memDst.getSize();
@@ -305,7 +604,7 @@ namespace triton {
           const triton::engines::symbolic::SharedSymbolicExpression& byte = this->symbolicEngine->getSymbolicMemory(memAddrDst + i);
           if (byte == nullptr)
             continue;
-          byte->isTainted = flag;
+          this->symbolicEngine->setTaintedExpression(byte, flag);
         }
 
         return flag;
@@ -313,6 +612,8 @@ namespace triton {
 
 
       bool TaintEngine::taintUnion(const triton::arch::MemoryAccess& memDst, const triton::arch::MemoryAccess& memSrc) {
+        triton::arch::PhaseTimer timer(this->statistics, triton::arch::PHASE_TAINT);
+
         bool flag = triton::engines::taint::UNTAINTED;
         triton::uint64 memAddrDst = memDst.getAddress();
         triton::uint64 memAddrSrc = memSrc.getAddress();
@@ -325,7 +626,7 @@ namespace triton {
           const triton::engines::symbolic::SharedSymbolicExpression& byte = this->symbolicEngine->getSymbolicMemory(memAddrDst + i);
           if (byte == nullptr)
             continue;
-          byte->isTainted = this->isMemoryTainted(memAddrDst + i) | this->isMemoryTainted(memAddrSrc + i);
+          this->symbolicEngine->setTaintedExpression(byte, this->isMemoryTainted(memAddrDst + i) | this->isMemoryTainted(memAddrSrc + i));
         }
 
         return flag;
@@ -333,6 +634,8 @@ namespace triton {
 
 
       bool TaintEngine::taintUnion(const triton::arch::MemoryAccess& memDst, const triton::arch::Register& regSrc) {
+        triton::arch::PhaseTimer timer(this->statistics, triton::arch::PHASE_TAINT);
+
         bool flag = triton::engines::taint::UNTAINTED;
         triton::uint64 memAddrDst = memDst.getAddress();
         triton::uint32 writeSize  = memDst.getSize();
@@ -344,7 +647,7 @@ namespace triton {
           const triton::engines::symbolic::SharedSymbolicExpression& byte = this->symbolicEngine->getSymbolicMemory(memAddrDst + i);
           if (byte == nullptr)
             continue;
-          byte->isTainted = flag;
+          this->symbolicEngine->setTaintedExpression(byte, flag);
         }
 
         return flag;
@@ -352,21 +655,29 @@ namespace triton {
 
 
       bool TaintEngine::taintUnion(const triton::arch::Register& regDst, const triton::arch::Immediate& imm) {
+        triton::arch::PhaseTimer timer(this->statistics, triton::arch::PHASE_TAINT);
+
         return this->unionRegisterImmediate(regDst);
       }
 
 
       bool TaintEngine::taintUnion(const triton::arch::Register& regDst, const triton::arch::MemoryAccess& memSrc) {
+        triton::arch::PhaseTimer timer(this->statistics, triton::arch::PHASE_TAINT);
+
         return this->unionRegisterMemory(regDst, memSrc);
       }
 
 
       bool TaintEngine::taintUnion(const triton::arch::Register& regDst, const triton::arch::Register& regSrc) {
+        triton::arch::PhaseTimer timer(this->statistics, triton::arch::PHASE_TAINT);
+
         return this->unionRegisterRegister(regDst, regSrc);
       }
 
 
       bool TaintEngine::taintAssignment(const triton::arch::MemoryAccess& memDst, const triton::arch::Immediate& imm) {
+        triton::arch::PhaseTimer timer(this->statistics, triton::arch::PHASE_TAINT);
+
         bool flag = triton::engines::taint::UNTAINTED;
         triton::uint64 memAddrDst = memDst.getAddress();
         triton::uint32 writeSize  = memDst.getSize();
@@ -378,7 +689,7 @@ namespace triton {
           const triton::engines::symbolic::SharedSymbolicExpression& byte = this->symbolicEngine->getSymbolicMemory(memAddrDst + i);
           if (byte == nullptr)
             continue;
-          byte->isTainted = flag;
+          this->symbolicEngine->setTaintedExpression(byte, flag);
         }
 
         return flag;
@@ -386,6 +697,8 @@ namespace triton {
 
 
       bool TaintEngine::taintAssignment(const triton::arch::MemoryAccess& memDst, const triton::arch::MemoryAccess& memSrc) {
+        triton::arch::PhaseTimer timer(this->statistics, triton::arch::PHASE_TAINT);
+
         bool flag = triton::engines::taint::UNTAINTED;
         triton::uint64 memAddrDst = memDst.getAddress();
         triton::uint64 memAddrSrc = memSrc.getAddress();
@@ -398,7 +711,7 @@ namespace triton {
           const triton::engines::symbolic::SharedSymbolicExpression& byte = this->symbolicEngine->getSymbolicMemory(memAddrDst + i);
           if (byte == nullptr)
             continue;
-          byte->isTainted = this->isMemoryTainted(memAddrSrc + i);
+          this->symbolicEngine->setTaintedExpression(byte, this->isMemoryTainted(memAddrSrc + i));
         }
 
         return flag;
@@ -406,6 +719,8 @@ namespace triton {
 
 
       bool TaintEngine::taintAssignment(const triton::arch::MemoryAccess& memDst, const triton::arch::Register& regSrc) {
+        triton::arch::PhaseTimer timer(this->statistics, triton::arch::PHASE_TAINT);
+
         bool flag = triton::engines::taint::UNTAINTED;
         triton::uint64 memAddrDst = memDst.getAddress();
         triton::uint32 writeSize  = memDst.getSize();
@@ -417,7 +732,7 @@ namespace triton {
           const triton::engines::symbolic::SharedSymbolicExpression& byte = this->symbolicEngine->getSymbolicMemory(memAddrDst + i);
           if (byte == nullptr)
             continue;
-          byte->isTainted = flag;
+          this->symbolicEngine->setTaintedExpression(byte, flag);
         }
 
         return flag;
@@ -425,27 +740,137 @@ namespace triton {
 
 
       bool TaintEngine::taintAssignment(const triton::arch::Register& regDst, const triton::arch::Immediate& imm) {
+        triton::arch::PhaseTimer timer(this->statistics, triton::arch::PHASE_TAINT);
+
         return this->assignmentRegisterImmediate(regDst);
       }
 
 
       bool TaintEngine::taintAssignment(const triton::arch::Register& regDst, const triton::arch::MemoryAccess& memSrc) {
+        triton::arch::PhaseTimer timer(this->statistics, triton::arch::PHASE_TAINT);
+
         return this->assignmentRegisterMemory(regDst, memSrc);
       }
 
 
       bool TaintEngine::taintAssignment(const triton::arch::Register& regDst, const triton::arch::Register& regSrc) {
+        triton::arch::PhaseTimer timer(this->statistics, triton::arch::PHASE_TAINT);
+
         return this->assignmentRegisterRegister(regDst, regSrc);
       }
 
 
+      bool TaintEngine::taintBitwise(triton::ast::ast_e op, const triton::arch::OperandWrapper& dst, const triton::arch::OperandWrapper& src, triton::uint64 dstValue, triton::uint64 srcValue) {
+        if (dst.getType() != triton::arch::OP_REG || !this->isBitPrecise(dst.getConstRegister()))
+          return this->taintUnion(dst, src);
+
+        triton::arch::PhaseTimer timer(this->statistics, triton::arch::PHASE_TAINT);
+
+        const triton::arch::Register& reg = dst.getConstRegister();
+        if (!this->isEnabled())
+          return this->isRegisterTainted(reg);
+
+        triton::uint64 d = this->getRegisterTaintBits(reg);
+        triton::uint64 s = this->getOperandTaintBits(src);
+        triton::uint64 bits = 0;
+
+        /* A bit of the result is tainted if a tainted bit of an operand is not absorbed by the untainted other one */
+        switch (op) {
+          case triton::ast::BVAND_NODE:
+            bits = (d & (s | srcValue)) | (s & (d | dstValue));
+            break;
+          case triton::ast::BVOR_NODE:
+            bits = (d & (s | ~srcValue)) | (s & (d | ~dstValue));
+            break;
+          default:
+            throw triton::exceptions::TaintEngine("TaintEngine::taintBitwise(): Invalid operation.");
+        }
+
+        bits &= bitMask(reg.getBitSize());
+        this->setRegisterTaintBits(reg, bits);
+
+        if (bits != 0 && s != 0 && this->hasLabels()) {
+          if (src.getType() == triton::arch::OP_REG)
+            this->addRegisterLabels(reg, this->getRegisterTaintLabels(src.getConstRegister()));
+          else
+            this->addRegisterLabels(reg, this->getMemoryTaintLabels(src.getConstMemory()));
+        }
+
+        return (bits != 0);
+      }
+
+
+      bool TaintEngine::taintShift(triton::ast::ast_e op, const triton::arch::OperandWrapper& dst, const triton::arch::OperandWrapper& src, triton::uint32 count) {
+        /* A tainted count reaches all the bits */
+        if (dst.getType() != triton::arch::OP_REG || !this->isBitPrecise(dst.getConstRegister()) || this->isTainted(src))
+          return this->taintUnion(dst, src);
+
+        triton::arch::PhaseTimer timer(this->statistics, triton::arch::PHASE_TAINT);
+
+        const triton::arch::Register& reg = dst.getConstRegister();
+        if (!this->isEnabled())
+          return this->isRegisterTainted(reg);
+
+        triton::uint32 size = reg.getBitSize();
+        triton::uint64 mask = bitMask(size);
+        triton::uint64 d    = this->getRegisterTaintBits(reg);
+        triton::uint64 bits = 0;
+
+        switch (op) {
+          case triton::ast::BVSHL_NODE:
+            bits = (count < size) ? (d << count) : 0;
+            break;
+          case triton::ast::BVLSHR_NODE:
+            bits = (count < size) ? (d >> count) : 0;
+            break;
+          case triton::ast::BVASHR_NODE:
+            bits = (count < size) ? (d >> count) : 0;
+            /* The bits shifted in take the taint of the sign bit */
+            if ((d >> (size - 1)) & 1)
+              bits |= (count < size) ? (mask & ~(mask >> count)) : mask;
+            break;
+          case triton::ast::BVROL_NODE:
+            count %= size;
+            bits = count ? ((d << count) | (d >> (size - count))) : d;
+            break;
+          case triton::ast::BVROR_NODE:
+            count %= size;
+            bits = count ? ((d >> count) | (d << (size - count))) : d;
+            break;
+          default:
+            throw triton::exceptions::TaintEngine("TaintEngine::taintShift(): Invalid operation.");
+        }
+
+        bits &= mask;
+        this->setRegisterTaintBits(reg, bits);
+
+        return (bits != 0);
+      }
+
+
       /* reg <- reg  */
       bool TaintEngine::assignmentRegisterRegister(const triton::arch::Register& regDst, const triton::arch::Register& regSrc) {
         if (!this->isEnabled())
           return this->isRegisterTainted(regDst);
 
+        /* Copy the tainted bits read */
+        if (this->isBitPrecise(regDst)) {
+          triton::uint64 bits = this->extendTaintBits(this->getRegisterTaintBits(regSrc), regSrc.getBitSize(), regDst.getBitSize());
+          bool others = (this->getParentTaintBits(regDst) & ~(bitMask(regDst.getBitSize()) << regDst.getLow())) != 0;
+          this->setRegisterTaintBits(regDst, bits);
+          if (bits != 0 && this->hasLabels()) {
+            if (others)
+              this->addRegisterLabels(regDst, this->getRegisterTaintLabels(regSrc));
+            else
+              this->setRegisterLabels(regDst, this->getRegisterTaintLabels(regSrc));
+          }
+          return (bits != 0);
+        }
+
         if (this->isRegisterTainted(regSrc)) {
           this->taintRegister(regDst);
+          if (this->hasLabels())
+            this->setRegisterLabels(regDst, this->getRegisterTaintLabels(regSrc));
           return TAINTED;
         }
 
@@ -468,8 +893,24 @@ namespace triton {
         if (!this->isEnabled())
           return this->isRegisterTainted(regDst);
 
+        /* Copy the tainted bytes read */
+        if (this->isBitPrecise(regDst)) {
+          triton::uint64 bits = this->extendTaintBits(this->getOperandTaintBits(memSrc), memSrc.getBitSize(), regDst.getBitSize());
+          bool others = (this->getParentTaintBits(regDst) & ~(bitMask(regDst.getBitSize()) << regDst.getLow())) != 0;
+          this->setRegisterTaintBits(regDst, bits);
+          if (bits != 0 && this->hasLabels()) {
+            if (others)
+              this->addRegisterLabels(regDst, this->getMemoryTaintLabels(memSrc));
+            else
+              this->setRegisterLabels(regDst, this->getMemoryTaintLabels(memSrc));
+          }
+          return (bits != 0);
+        }
+
         if (this->isMemoryTainted(memSrc)) {
           this->taintRegister(regDst);
+          if (this->hasLabels())
+            this->setRegisterLabels(regDst, this->getMemoryTaintLabels(memSrc));
           return TAINTED;
         }
 
@@ -484,6 +925,7 @@ namespace triton {
         triton::uint32 readSize = memSrc.getSize();
         triton::uint64 addrSrc  = memSrc.getAddress();
         triton::uint64 addrDst  = memDst.getAddress();
+        bool labeled            = this->hasLabels();
 
         if (!this->isEnabled())
           return this->isMemoryTainted(memDst);
@@ -491,6 +933,8 @@ namespace triton {
         for (triton::uint32 offset = 0; offset < readSize; offset++) {
           if (this->isMemoryTainted(addrSrc+offset)) {
             this->taintMemory(addrDst+offset);
+            if (labeled)
+              this->taintedMemory.setLabels(addrDst+offset, 1, this->taintedMemory.getLabels(addrSrc+offset));
             isTainted = TAINTED;
           }
           else
@@ -501,6 +945,8 @@ namespace triton {
         if (this->modes->isModeEnabled(triton::modes::TAINT_THROUGH_POINTERS)) {
           if (this->isMemoryTainted(memSrc)) {
             this->taintMemory(memDst);
+            if (labeled)
+              this->taintedMemory.addLabels(addrDst, memDst.getSize(), this->getMemoryTaintLabels(memSrc));
             isTainted = TAINTED;
           }
         }
@@ -523,9 +969,27 @@ namespace triton {
         if (!this->isEnabled())
           return this->isMemoryTainted(memDst);
 
+        /* Only the bytes of a partially tainted source with a tainted bit are tainted */
+        triton::uint64 bits = this->getRegisterTaintBits(regSrc);
+        if (bits != 0 && bits != bitMask(regSrc.getBitSize()) && memDst.getSize() <= triton::size::qword) {
+          bool labeled = this->hasLabels();
+          for (triton::uint32 i = 0; i != memDst.getSize(); i++) {
+            if ((bits >> (i * triton::bitsize::byte)) & 0xff) {
+              this->taintMemory(memDst.getAddress() + i);
+              if (labeled)
+                this->taintedMemory.setLabels(memDst.getAddress() + i, 1, this->getRegisterTaintLabels(regSrc));
+            }
+            else
+              this->untaintMemory(memDst.getAddress() + i);
+          }
+          return TAINTED;
+        }
+
         /* Check source */
-        if (this->isRegisterTainted(regSrc)) {
+        if (bits != 0) {
           this->taintMemory(memDst);
+          if (this->hasLabels())
+            this->taintedMemory.setLabels(memDst.getAddress(), memDst.getSize(), this->getRegisterTaintLabels(regSrc));
           return TAINTED;
         }
 
@@ -539,7 +1003,15 @@ namespace triton {
       bool TaintEngine::unionRegisterImmediate(const triton::arch::Register& regDst) {
         if (!this->isEnabled())
           return this->isRegisterTainted(regDst);
-        return this->isRegisterTainted(regDst);
+
+        /* The tainted bits of a partially tainted destination reach all its bits */
+        if (this->isRegisterTainted(regDst)) {
+          if (!this->taintedRegisterBits.empty())
+            this->taintRegister(regDst);
+          return TAINTED;
+        }
+
+        return !TAINTED;
       }
 
 
@@ -550,10 +1022,12 @@ namespace triton {
 
         if (this->isRegisterTainted(regSrc)) {
           this->taintRegister(regDst);
+          if (this->hasLabels())
+            this->addRegisterLabels(regDst, this->getRegisterTaintLabels(regSrc));
           return TAINTED;
         }
 
-        return this->isRegisterTainted(regDst);
+        return this->unionRegisterImmediate(regDst);
       }
 
 
@@ -563,6 +1037,7 @@ namespace triton {
         triton::uint32 writeSize = memDst.getSize();
         triton::uint64 addrDst   = memDst.getAddress();
         triton::uint64 addrSrc   = memSrc.getAddress();
+        bool labeled             = this->hasLabels();
 
         if (!this->isEnabled())
           return this->isMemoryTainted(memDst);
@@ -571,6 +1046,8 @@ namespace triton {
         for (triton::uint32 offset = 0; offset < writeSize; offset++) {
           if (this->isMemoryTainted(addrSrc+offset)) {
             this->taintMemory(addrDst+offset);
+            if (labeled)
+              this->taintedMemory.addLabels(addrDst+offset, 1, this->taintedMemory.getLabels(addrSrc+offset));
             isTainted = TAINTED;
           }
         }
@@ -579,6 +1056,8 @@ namespace triton {
         if (this->modes->isModeEnabled(triton::modes::TAINT_THROUGH_POINTERS)) {
           if (this->isMemoryTainted(memSrc)) {
             this->taintMemory(memDst);
+            if (labeled)
+              this->taintedMemory.addLabels(addrDst, writeSize, this->getMemoryTaintLabels(memSrc));
             isTainted = TAINTED;
           }
         }
@@ -599,10 +1078,12 @@ namespace triton {
 
         if (this->isMemoryTainted(memSrc)) {
           this->taintRegister(regDst);
+          if (this->hasLabels())
+            this->addRegisterLabels(regDst, this->getMemoryTaintLabels(memSrc));
           return TAINTED;
         }
 
-        return this->isRegisterTainted(regDst);
+        return this->unionRegisterImmediate(regDst);
       }
 
 
@@ -626,6 +1107,8 @@ namespace triton {
 
         if (this->isRegisterTainted(regSrc)) {
           this->taintMemory(memDst);
+          if (this->hasLabels())
+            this->taintedMemory.addLabels(memDst.getAddress(), memDst.getSize(), this->getRegisterTaintLabels(regSrc));
           return TAINTED;
         }
 
@@ -0,0 +1,118 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <iterator>
+
+#include <triton/taintLabels.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace taint {
+
+      TaintLabels::TaintLabels() {
+        this->mask = 0;
+      }
+
+
+      TaintLabels::TaintLabels(triton::uint32 label) {
+        this->mask = 0;
+
+        if (label < inlineLabels)
+          this->mask = static_cast<triton::uint64>(1) << label;
+        else
+          this->large = std::make_shared<const std::vector<triton::uint32>>(1, label);
+      }
+
+
+      bool TaintLabels::empty(void) const {
+        return this->mask == 0 && this->large == nullptr;
+      }
+
+
+      bool TaintLabels::contains(triton::uint32 label) const {
+        if (label < inlineLabels)
+          return (this->mask >> label) & 1;
+
+        return this->large && std::binary_search(this->large->begin(), this->large->end(), label);
+      }
+
+
+      triton::usize TaintLabels::size(void) const {
+        triton::usize count = this->large ? this->large->size() : 0;
+
+        for (triton::uint64 bits = this->mask; bits; bits &= bits - 1)
+          count++;
+
+        return count;
+      }
+
+
+      std::vector<triton::uint32> TaintLabels::getLabels(void) const {
+        std::vector<triton::uint32> labels;
+
+        for (triton::uint32 label = 0; label < inlineLabels; label++) {
+          if ((this->mask >> label) & 1)
+            labels.push_back(label);
+        }
+
+        if (this->large)
+          labels.insert(labels.end(), this->large->begin(), this->large->end());
+
+        return labels;
+      }
+
+
+      TaintLabels& TaintLabels::operator|=(const TaintLabels& other) {
+        this->mask |= other.mask;
+
+        if (other.large == nullptr || this->large == other.large)
+          return *this;
+
+        if (this->large == nullptr) {
+          this->large = other.large;
+          return *this;
+        }
+
+        /* Share an operand if it already holds the union */
+        if (std::includes(this->large->begin(), this->large->end(), other.large->begin(), other.large->end()))
+          return *this;
+
+        if (std::includes(other.large->begin(), other.large->end(), this->large->begin(), this->large->end())) {
+          this->large = other.large;
+          return *this;
+        }
+
+        std::vector<triton::uint32> merged;
+        merged.reserve(this->large->size() + other.large->size());
+        std::set_union(this->large->begin(), this->large->end(), other.large->begin(), other.large->end(), std::back_inserter(merged));
+        this->large = std::make_shared<const std::vector<triton::uint32>>(std::move(merged));
+
+        return *this;
+      }
+
+
+      bool TaintLabels::operator==(const TaintLabels& other) const {
+        if (this->mask != other.mask)
+          return false;
+
+        if (this->large == other.large)
+          return true;
+
+        return this->large && other.large && *this->large == *other.large;
+      }
+
+
+      bool TaintLabels::operator!=(const TaintLabels& other) const {
+        return !(*this == other);
+      }
+
+    }; /* taint namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
@@ -0,0 +1,286 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+
+#include <triton/taintMemory.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace taint {
+
+      TaintMemory::TaintMemory() {
+        this->count = 0;
+      }
+
+
+      TaintMemory::Page& TaintMemory::detach(triton::uint64 number) {
+        std::shared_ptr<Page>& page = this->pages.modify(number);
+
+        if (page == nullptr) {
+          page = std::make_shared<Page>();
+        }
+        /* Copy on write */
+        else if (page.use_count() > 1) {
+          page = std::make_shared<Page>(*page);
+        }
+
+        return *page;
+      }
+
+
+      TaintMemory::LabelPage& TaintMemory::detachLabels(triton::uint64 number) {
+        std::shared_ptr<LabelPage>& page = this->labelPages.modify(number);
+
+        if (page == nullptr) {
+          page = std::make_shared<LabelPage>();
+        }
+        /* Copy on write */
+        else if (page.use_count() > 1) {
+          page = std::make_shared<LabelPage>(*page);
+        }
+
+        return *page;
+      }
+
+
+      void TaintMemory::eraseLabels(triton::uint64 addr, triton::usize size) {
+        while (size && !this->labelPages.empty()) {
+          triton::uint32 offset = addr & (pageSize - 1);
+          triton::usize  length = std::min<triton::usize>(size, pageSize - offset);
+          triton::uint64 number = addr >> pageBits;
+
+          if (this->labelPages.contains(number)) {
+            if (length == pageSize) {
+              this->labelPages.erase(number);
+            }
+            else {
+              LabelPage& page = this->detachLabels(number);
+              for (triton::usize index = 0; index < length; index++) {
+                TaintLabels& slot = page.slots[offset + index];
+                if (!slot.empty()) {
+                  slot = TaintLabels();
+                  page.count--;
+                }
+              }
+              if (page.count == 0)
+                this->labelPages.erase(number);
+            }
+          }
+
+          addr += length;
+          size -= length;
+        }
+      }
+
+
+      triton::uint64 TaintMemory::mask(triton::uint32 first, triton::uint32 last) {
+        triton::uint64 high = (last == 63) ? ~static_cast<triton::uint64>(0) : ((static_cast<triton::uint64>(1) << (last + 1)) - 1);
+        return high & ~((static_cast<triton::uint64>(1) << first) - 1);
+      }
+
+
+      triton::uint32 TaintMemory::popcount(triton::uint64 word) {
+        word = word - ((word >> 1) & 0x5555555555555555ULL);
+        word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+        word = (word + (word >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+        return static_cast<triton::uint32>((word * 0x0101010101010101ULL) >> 56);
+      }
+
+
+      triton::uint32 TaintMemory::lowestBit(triton::uint64 word) {
+        /* The bits below the lowest set bit */
+        return popcount((word & (~word + 1)) - 1);
+      }
+
+
+      bool TaintMemory::isTainted(triton::uint64 addr, triton::usize size) const {
+        while (size) {
+          triton::uint32 offset = addr & (pageSize - 1);
+          triton::usize  length = std::min<triton::usize>(size, pageSize - offset);
+
+          const std::shared_ptr<Page>* page = this->pages.find(addr >> pageBits);
+          if (page != nullptr) {
+            triton::uint32 last = offset + static_cast<triton::uint32>(length) - 1;
+            for (triton::uint32 index = offset / 64; index <= last / 64; index++) {
+              triton::uint32 first = (index == offset / 64) ? offset % 64 : 0;
+              triton::uint32 end   = (index == last / 64) ? last % 64 : 63;
+              if ((*page)->words[index] & mask(first, end))
+                return true;
+            }
+          }
+
+          addr += length;
+          size -= length;
+        }
+        return false;
+      }
+
+
+      void TaintMemory::taint(triton::uint64 addr, triton::usize size) {
+        while (size) {
+          triton::uint32 offset = addr & (pageSize - 1);
+          triton::usize  length = std::min<triton::usize>(size, pageSize - offset);
+          triton::uint32 last   = offset + static_cast<triton::uint32>(length) - 1;
+          Page& page            = this->detach(addr >> pageBits);
+
+          for (triton::uint32 index = offset / 64; index <= last / 64; index++) {
+            triton::uint32 first = (index == offset / 64) ? offset % 64 : 0;
+            triton::uint32 end   = (index == last / 64) ? last % 64 : 63;
+            triton::uint64 bits  = mask(first, end) & ~page.words[index];
+
+            page.words[index] |= bits;
+            page.count        += popcount(bits);
+            this->count       += popcount(bits);
+          }
+
+          addr += length;
+          size -= length;
+        }
+      }
+
+
+      void TaintMemory::untaint(triton::uint64 addr, triton::usize size) {
+        triton::uint64 addr0 = addr;
+        triton::usize  size0 = size;
+
+        while (size) {
+          triton::uint32 offset = addr & (pageSize - 1);
+          triton::usize  length = std::min<triton::usize>(size, pageSize - offset);
+          triton::uint64 number = addr >> pageBits;
+
+          const std::shared_ptr<Page>* found = this->pages.find(number);
+          if (found != nullptr) {
+            if (length == pageSize) {
+              this->count -= (*found)->count;
+              this->pages.erase(number);
+            }
+            else if (this->isTainted(addr, length)) {
+              triton::uint32 last = offset + static_cast<triton::uint32>(length) - 1;
+              Page& page          = this->detach(number);
+
+              for (triton::uint32 index = offset / 64; index <= last / 64; index++) {
+                triton::uint32 first = (index == offset / 64) ? offset % 64 : 0;
+                triton::uint32 end   = (index == last / 64) ? last % 64 : 63;
+                triton::uint64 bits  = mask(first, end) & page.words[index];
+
+                page.words[index] &= ~bits;
+                page.count        -= popcount(bits);
+                this->count       -= popcount(bits);
+              }
+
+              if (page.count == 0)
+                this->pages.erase(number);
+            }
+          }
+
+          addr += length;
+          size -= length;
+        }
+
+        this->eraseLabels(addr0, size0);
+      }
+
+
+      TaintLabels TaintMemory::getLabels(triton::uint64 addr, triton::usize size) const {
+        TaintLabels labels;
+
+        while (size && !this->labelPages.empty()) {
+          triton::uint32 offset = addr & (pageSize - 1);
+          triton::usize  length = std::min<triton::usize>(size, pageSize - offset);
+
+          const std::shared_ptr<LabelPage>* page = this->labelPages.find(addr >> pageBits);
+          if (page != nullptr) {
+            for (triton::usize index = 0; index < length; index++)
+              labels |= (*page)->slots[offset + index];
+          }
+
+          addr += length;
+          size -= length;
+        }
+
+        return labels;
+      }
+
+
+      void TaintMemory::setLabels(triton::uint64 addr, triton::usize size, const TaintLabels& labels) {
+        if (labels.empty()) {
+          this->eraseLabels(addr, size);
+          return;
+        }
+
+        while (size) {
+          triton::uint32 offset = addr & (pageSize - 1);
+          triton::usize  length = std::min<triton::usize>(size, pageSize - offset);
+          LabelPage& page       = this->detachLabels(addr >> pageBits);
+
+          for (triton::usize index = 0; index < length; index++) {
+            TaintLabels& slot = page.slots[offset + index];
+            if (slot.empty())
+              page.count++;
+            slot = labels;
+          }
+
+          addr += length;
+          size -= length;
+        }
+      }
+
+
+      void TaintMemory::addLabels(triton::uint64 addr, triton::usize size, const TaintLabels& labels) {
+        if (labels.empty())
+          return;
+
+        while (size) {
+          triton::uint32 offset = addr & (pageSize - 1);
+          triton::usize  length = std::min<triton::usize>(size, pageSize - offset);
+          LabelPage& page       = this->detachLabels(addr >> pageBits);
+
+          for (triton::usize index = 0; index < length; index++) {
+            TaintLabels& slot = page.slots[offset + index];
+            if (slot.empty())
+              page.count++;
+            slot |= labels;
+          }
+
+          addr += length;
+          size -= length;
+        }
+      }
+
+
+      bool TaintMemory::hasLabels(void) const {
+        return !this->labelPages.empty();
+      }
+
+
+      void TaintMemory::clear(void) {
+        this->pages.clear();
+        this->labelPages.clear();
+        this->count = 0;
+      }
+
+
+      triton::usize TaintMemory::size(void) const {
+        return this->count;
+      }
+
+
+      triton::usize TaintMemory::getNumberOfPages(void) const {
+        return this->pages.size();
+      }
+
+
+      triton::usize TaintMemory::getBytes(void) const {
+        return this->pages.size() * sizeof(Page) + this->labelPages.size() * sizeof(LabelPage);
+      }
+
+    }; /* taint namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
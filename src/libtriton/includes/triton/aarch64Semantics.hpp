@@ -78,10 +78,11 @@ namespace triton {
             //! Control flow semantics. Used to represent PC.
             void controlFlow_s(triton::arch::Instruction& inst);
 
-            //! Creates a conditional node.
+            //! Creates a conditional node. If `fold` is true, a concrete condition returns the selected node.
             triton::ast::SharedAbstractNode getCodeConditionAst(triton::arch::Instruction& inst,
                                                                 triton::ast::SharedAbstractNode& thenNode,
-                                                                triton::ast::SharedAbstractNode& elseNode);
+                                                                triton::ast::SharedAbstractNode& elseNode,
+                                                                bool fold=true);
 
             //! Gets the taint state (based on flags) of a conditional instruction
             bool getCodeConditionTainteSate(const triton::arch::Instruction& inst);
@@ -8,6 +8,7 @@
 #ifndef TRITON_AARCH64SPECIFICATIONS_H
 #define TRITON_AARCH64SPECIFICATIONS_H
 
+#include <array>
 #include <unordered_map>
 #include <string>
 
@@ -52,10 +53,33 @@ namespace triton {
         //! \class AArch64Specifications
         /*! \brief The AArch64Specifications class defines specifications about the AArch64 CPU */
         class AArch64Specifications {
+          private:
+            //! The registers of an architecture, built once from the spec and shared by all its CPUs.
+            struct RegisterTable {
+              //! List of registers specification available for this architecture.
+              std::unordered_map<triton::arch::register_e, const triton::arch::Register> id2reg;
+              std::unordered_map<std::string, triton::arch::register_e> name2id;
+
+              //! The registers of `id2reg` indexed by id, nullptr if not available for this architecture.
+              std::array<const triton::arch::Register*, triton::arch::ID_REG_LAST_ITEM> regIndex;
+
+              //! Builds the registers of the architecture from the spec.
+              RegisterTable(triton::arch::architecture_e arch);
+
+              //! The table is never copied, `regIndex` points into `id2reg`.
+              RegisterTable(const RegisterTable&) = delete;
+            };
+
+            //! Returns the registers of the architecture, built on first use.
+            static const RegisterTable& getRegisterTable(triton::arch::architecture_e arch);
+
           protected:
-            //! List of registers specification available for this architecture.
-            std::unordered_map<triton::arch::register_e, const triton::arch::Register> id2reg;
-            std::unordered_map<std::string, triton::arch::register_e> name2id;
+            //! List of registers specification available for this architecture, shared by all its CPUs.
+            const std::unordered_map<triton::arch::register_e, const triton::arch::Register>& id2reg;
+            const std::unordered_map<std::string, triton::arch::register_e>& name2id;
+
+            //! The registers of `id2reg` indexed by id, nullptr if not available for this architecture.
+            const std::array<const triton::arch::Register*, triton::arch::ID_REG_LAST_ITEM>& regIndex;
 
           public:
             //! Constructor.
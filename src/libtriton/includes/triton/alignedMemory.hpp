@@ -0,0 +1,118 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_ALIGNEDMEMORY_H
+#define TRITON_ALIGNEDMEMORY_H
+
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <triton/dllexport.hpp>
+#include <triton/symbolicExpression.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      /*! \class AlignedMemory
+       *  \brief The symbolic expressions of whole memory accesses, used by the `ALIGNED_MEMORY` mode.
+       *
+       * \description
+       * An entry maps the range [addr, addr+size) to the expression stored there. Entries never
+       * overlap: setting a range first removes the parts of the entries it overlaps, an entry partially
+       * overwritten keeps the bytes it still holds, as fragments of its expression. They are kept sorted
+       * by address, so that the entries overlapping a range are found in O(log n + k). Copies share
+       * their entries until one of them is modified.
+       */
+      class AlignedMemory {
+        public:
+          //! An entry.
+          struct Entry {
+            //! The size of the range (in bytes).
+            triton::uint32 size;
+
+            //! The offset (in bytes) of the first byte of the range in the expression.
+            triton::uint32 offset;
+
+            //! The expression of the range.
+            SharedSymbolicExpression expr;
+          };
+
+        private:
+          //! Maps the first address of a range to its entry, nullptr if there is no entry.
+          std::shared_ptr<std::map<triton::uint64, Entry>> entries;
+
+          //! Returns the entries, copied first if they are shared.
+          std::map<triton::uint64, Entry>& detach(void);
+
+          //! Returns the first entry overlapping [addr, addr+size), or the end of the entries.
+          std::map<triton::uint64, Entry>::const_iterator firstOverlap(triton::uint64 addr, triton::usize size) const;
+
+        public:
+          //! Returns the expression of the range [addr, addr+size), nullptr if it is not an entry holding a whole expression.
+          TRITON_EXPORT const SharedSymbolicExpression& get(triton::uint64 addr, triton::uint32 size) const;
+
+          //! Returns the expression of the entry covering [addr, addr+size) and sets `base` to the address of the first byte of the expression, nullptr if no entry covers the range.
+          TRITON_EXPORT const SharedSymbolicExpression& getCovering(triton::uint64 addr, triton::uint32 size, triton::uint64& base) const;
+
+          //! Returns true if [addr, addr+size) is an entry holding a whole expression.
+          TRITON_EXPORT bool contains(triton::uint64 addr, triton::uint32 size) const;
+
+          //! Returns the entries overlapping [addr, addr+size) by address, clipped to the range.
+          TRITON_EXPORT std::vector<std::pair<triton::uint64, Entry>> getOverlapping(triton::uint64 addr, triton::uint32 size) const;
+
+          //! Sets the expression of [addr, addr+size), removing the range from the entries it overlaps.
+          TRITON_EXPORT void set(triton::uint64 addr, triton::uint32 size, const SharedSymbolicExpression& expr);
+
+          //! Removes [addr, addr+size) from the entries overlapping it.
+          TRITON_EXPORT void erase(triton::uint64 addr, triton::usize size);
+
+          //! Removes all entries.
+          TRITON_EXPORT void clear(void);
+
+          //! Returns true if there is no entry.
+          TRITON_EXPORT bool empty(void) const;
+
+          //! Returns the number of entries.
+          TRITON_EXPORT triton::usize size(void) const;
+
+          //! Returns an estimation of the number of bytes of the entries, a node of the map holding an entry, three links and a color.
+          TRITON_EXPORT triton::usize getBytes(void) const;
+      };
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_ALIGNEDMEMORY_H */
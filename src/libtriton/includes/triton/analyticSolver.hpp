@@ -0,0 +1,128 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_ANALYTICSOLVER_HPP
+#define TRITON_ANALYTICSOLVER_HPP
+
+#include <mutex>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      /*! \struct AnalyticQuery
+       *  \brief A query solved by the `AnalyticSolver`, and the residue left to the solver. */
+      struct AnalyticQuery {
+        //! The conjuncts which could not be solved analytically, null if there are none.
+        triton::ast::SharedAbstractNode residue;
+
+        //! SAT or UNSAT if the query is decided without solver, UNKNOWN otherwise.
+        triton::engines::solver::status_e decided = triton::engines::solver::UNKNOWN;
+
+        //! The values of the variables solved analytically. They share no conjunct with the residue.
+        std::vector<SolverModel> values;
+      };
+
+
+      //! \class AnalyticSolver
+      /*! \brief Solves the simple constraints of a query without the solver.
+       *
+       * \description
+       * The conjuncts of the query are split into the components of the variables they share. A component is solved
+       * analytically if its conjuncts are comparisons (`=`, `distinct`, unsigned and signed orderings, their negation and
+       * the `ite` of the flags compared to a constant) of a linear term of one variable to a constant, such as
+       * `zx(x) == 0x41`, `x - 5 <u 10` or `extract(7, 0, x) == 0x41`, or equalities chaining its variables such as
+       * `x == y + 1` or `x + y == c`. The linear terms are built of `bvadd`, `bvsub`, `bvneg`, `bvnot`, `bvmul` and
+       * `bvshl` by a constant, `zx` of a variable and `extract` of the low bits, up to 256 bits.
+       *
+       * The equalities express the variables of a component by one of them, whose values satisfying the comparisons are
+       * computed as intervals. The comparisons which are not intervals of the variable (e.g. its low bits or an even
+       * coefficient) are checked on the concrete value and on candidates taken from the intervals. The components whose
+       * intervals are empty decide the query UNSAT, and only the components which are not solved are left to the solver.
+       */
+      class AnalyticSolver {
+        private:
+          //! True if the queries are solved analytically.
+          bool enabled;
+
+          //! Protects the statistics, queries may be solved from several threads.
+          mutable std::mutex lock;
+
+          //! The number of queries analyzed.
+          mutable triton::usize queries;
+
+          //! The number of queries decided without solver.
+          mutable triton::usize decided;
+
+          //! The number of queries whose residue was left to the solver.
+          mutable triton::usize delegated;
+
+          //! The number of variables solved analytically.
+          mutable triton::usize variables;
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT AnalyticSolver();
+
+          //! Returns true if the queries are solved analytically.
+          TRITON_EXPORT bool isEnabled(void) const;
+
+          //! Enables or disables the analytic solving of the queries. By default, disabled.
+          TRITON_EXPORT void setEnabled(bool flag);
+
+          //! Solves the components of a logical `node` which are simple enough, and returns the residue left to the solver.
+          TRITON_EXPORT AnalyticQuery solve(const triton::ast::SharedAbstractNode& node) const;
+
+          //! Returns the number of queries analyzed.
+          TRITON_EXPORT triton::usize getQueries(void) const;
+
+          //! Returns the number of queries decided without solver.
+          TRITON_EXPORT triton::usize getDecided(void) const;
+
+          //! Returns the number of queries whose residue was left to the solver.
+          TRITON_EXPORT triton::usize getDelegated(void) const;
+
+          //! Returns the number of variables solved analytically.
+          TRITON_EXPORT triton::usize getVariables(void) const;
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_ANALYTICSOLVER_HPP */
@@ -13,21 +13,37 @@
 #include <triton/astContext.hpp>
 #include <triton/astRepresentation.hpp>
 #include <triton/callbacks.hpp>
+#include <triton/coverage.hpp>
 #include <triton/dllexport.hpp>
+#include <triton/emulation.hpp>
+#include <triton/eventTracer.hpp>
+#include <triton/executor.hpp>
+#include <triton/explorationEngine.hpp>
+#include <triton/fuzzerBridge.hpp>
 #include <triton/immediate.hpp>
 #include <triton/instruction.hpp>
 #include <triton/irBuilder.hpp>
 #include <triton/liftingEngine.hpp>
 #include <triton/memoryAccess.hpp>
+#include <triton/memoryPlacement.hpp>
+#include <triton/memoryUsage.hpp>
 #include <triton/modes.hpp>
+#include <triton/nativeBackend.hpp>
 #include <triton/operandWrapper.hpp>
+#include <triton/processingStatistics.hpp>
 #include <triton/register.hpp>
 #include <triton/shortcutRegister.hpp>
+#include <triton/simplificationCache.hpp>
 #include <triton/solverEngine.hpp>
 #include <triton/solverEnums.hpp>
+#include <triton/stateObserver.hpp>
 #include <triton/symbolicEngine.hpp>
 #include <triton/synthesizer.hpp>
+#include <triton/syscalls.hpp>
 #include <triton/taintEngine.hpp>
+#include <triton/tracePipeline.hpp>
+#include <triton/traceReader.hpp>
+#include <triton/traceSegment.hpp>
 #include <triton/tritonTypes.hpp>
 
 
@@ -61,6 +77,27 @@ namespace triton {
         //! Raises an exception if the lifting engine is not initialized.
         inline void checkLifting(void) const;
 
+        //! Returns the constraint to give to the solver. It is simplified by equality saturation if AST_EQUALITY_SATURATION is enabled.
+        triton::ast::SharedAbstractNode rewriteConstraint(const triton::ast::SharedAbstractNode& node) const;
+
+        //! Disassembles an instruction, timed as the disassembly phase of the processing.
+        void disassemble(triton::arch::Instruction& inst);
+
+        //! Builds the semantics of a decoded instruction, and publishes the state after a control flow instruction if the observer is enabled.
+        bool processDecoded(triton::arch::Instruction& inst);
+
+        //! Processes the records of a trace, their instructions being decoded by `decoders` threads. The live-ins and the memory touched are recorded in `segment` if defined.
+        triton::usize processTrace(triton::arch::TraceReader& reader, triton::arch::trace_e format, triton::usize decoders, triton::engines::symbolic::SegmentSummary* segment=nullptr);
+
+        //! Captures the boundaries of the segments of `length` records of a trace.
+        std::vector<triton::engines::symbolic::SegmentBoundary> scanTraceBoundaries(triton::arch::TraceReader& reader, triton::arch::trace_e format, triton::usize length);
+
+        //! Processes the segment of a trace starting at `boundary`.
+        triton::engines::symbolic::SegmentSummary processTraceSegment(triton::arch::TraceReader& reader, triton::arch::trace_e format, const triton::engines::symbolic::SegmentBoundary& boundary, triton::usize count, triton::usize decoders);
+
+        //! Processes a block in a scratch context with the registers and the memory it reads symbolized. Fills `outputs` with the ASTs of the registers and the memory it writes, and returns the context which owns them.
+        std::unique_ptr<API> symbolizeBlock(const std::vector<triton::arch::Instruction>& block, std::vector<std::pair<std::string, triton::ast::SharedAbstractNode>>& outputs);
+
 
       protected:
         //! The Callbacks interface.
@@ -84,12 +121,45 @@ namespace triton {
         //! The solver engine.
         triton::engines::solver::SolverEngine* solver = nullptr;
 
+        //! The cache of the synthesizer.
+        triton::engines::synthesis::SynthesisCache* synthesisCache = nullptr;
+
+        //! The cache of the solver and LLVM simplifications.
+        triton::ast::SimplificationCache* simplificationCache = nullptr;
+
         //! The AST Context interface.
         triton::ast::SharedAstContext astCtxt;
 
         //! The IR builder.
         triton::arch::IrBuilder* irBuilder = nullptr;
 
+        //! The statistics of the processing.
+        triton::arch::ProcessingStatistics statistics;
+
+        //! The tracer of the events, shared with the AST context and the forks.
+        triton::utils::SharedEventTracer tracer;
+
+        //! The coverage of the processing, shared with the forks.
+        triton::arch::SharedCoverage coverage;
+
+        //! The syscalls of the emulation.
+        triton::arch::Syscalls syscalls;
+
+        //! The state restored by `rollbackToMark()`, a fork of the context taken by `setMark()`. Null if there is no mark.
+        std::unique_ptr<API> mark;
+
+        //! The placement of the AST nodes and of the pages of the concrete memory.
+        triton::utils::MemoryPlacement placement;
+
+        //! The views of the state published to the observer threads.
+        triton::StateObserver observer;
+
+        //! The parent registers copied into the views, filled at the first publication.
+        std::vector<const triton::arch::Register*> observedRegisters;
+
+        //! The native backend of the emulation, built with Unicorn.
+        triton::arch::NativeBackend* native = nullptr;
+
 
       public:
         //! A shortcut to access to a Register class from a register name.
@@ -126,6 +196,24 @@ namespace triton {
         //! [**architecture api**] - Clears the architecture states (registers and memory).
         TRITON_EXPORT void clearArchitecture(void);
 
+        //! [**architecture api**] - Returns the cache of the decoded instructions. It may be given to other contexts of the same architecture, see `setDisassemblyCache()`.
+        TRITON_EXPORT const triton::arch::SharedDisassemblyCache& getDisassemblyCache(void) const;
+
+        //! [**architecture api**] - Replaces the cache of the decoded instructions by a cache of the same architecture, e.g. the one of another context analyzing the same binary. Setting the architecture again gives the context a new cache.
+        TRITON_EXPORT void setDisassemblyCache(const triton::arch::SharedDisassemblyCache& cache);
+
+        //! [**architecture api**] - Returns the id of the guest thread whose registers are the current ones. By default, 0.
+        TRITON_EXPORT triton::uint32 getThread(void) const;
+
+        //! [**architecture api**] - Returns the ids of the guest threads which have registers, the current one included.
+        TRITON_EXPORT std::vector<triton::uint32> getThreads(void) const;
+
+        //! [**architecture api**] - Switches the concrete, symbolic and taint registers to the ones of the guest thread `tid`, the memory is shared by all the threads. A new thread starts with a copy of the current registers. Only the registers of the current thread are saved by `saveSnapshot()`.
+        TRITON_EXPORT void setThread(triton::uint32 tid);
+
+        //! [**architecture api**] - Removes the registers of the guest thread `tid`, which must not be the current one.
+        TRITON_EXPORT void removeThread(triton::uint32 tid);
+
         //! [**architecture api**] - Returns true if the register id is a flag. \sa triton::arch::x86::register_e.
         TRITON_EXPORT bool isFlag(triton::arch::register_e regId) const;
 
@@ -186,6 +274,12 @@ namespace triton {
         //! [**architecture api**] - Returns the concrete value of a memory area.
         TRITON_EXPORT std::vector<triton::uint8> getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks=true) const;
 
+        //! [**architecture api**] - Copies the concrete value of a memory area into `area`, which must hold `size` bytes.
+        TRITON_EXPORT void getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::uint8* area, triton::usize size, bool execCallbacks=true) const;
+
+        //! [**architecture api**] - Returns the concrete memory, to read its pages without copying them. The callbacks are not called.
+        TRITON_EXPORT const triton::arch::ConcreteMemory& getConcreteMemory(void) const;
+
         //! [**architecture api**] - Returns the concrete value of a register.
         TRITON_EXPORT triton::uint512 getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks=true) const;
 
@@ -221,6 +315,30 @@ namespace triton {
          */
         TRITON_EXPORT void setConcreteMemoryAreaValue(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size);
 
+        /*!
+         * \brief [**architecture api**] - Sets the concrete value of a memory area to an external buffer, without copying it.
+         *
+         * \details The pages fully covered by the area are mapped to it and only copied when
+         * they are written, so the area must outlive the memory and all its copies, unless `owner`
+         * keeps it alive. Note that
+         * by setting a concrete value will probably imply a desynchronization with the symbolic
+         * state (if it exists). You should probably use the concretize functions after this.
+         */
+        TRITON_EXPORT void mapConcreteMemoryArea(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size, const std::shared_ptr<const void>& owner=nullptr);
+
+        /*!
+         * \brief [**architecture api**] - Sets the concrete value of a memory area to the `size` bytes of a file from `offset`, to the end of the file if `size` is 0. Returns the number of bytes mapped.
+         *
+         * \details The file is mapped read-only and its pages are only loaded once they are
+         * read, then copied when they are first written, so loading a large binary or a core dump
+         * costs what is actually used. The contexts mapping the same part of a file share its
+         * mapping (see `MappedFile::share()`) and the processes share its pages, so the text of a
+         * binary loaded by many workers is held once. Note that by setting a concrete value will
+         * probably imply a desynchronization with the symbolic state (if it exists). You should
+         * probably use the concretize functions after this.
+         */
+        TRITON_EXPORT triton::usize mapConcreteMemoryFile(triton::uint64 baseAddr, const std::string& path, triton::uint64 offset=0, triton::usize size=0);
+
         /*!
          * \brief [**architecture api**] - Sets the concrete value of a register.
          *
@@ -257,6 +375,83 @@ namespace triton {
         //! [**proccesing api**] - Processes an instruction and updates engines according to the instruction semantics. Returns true if the instruction is supported.
         TRITON_EXPORT bool processing(triton::arch::Instruction& inst);
 
+        //! [**proccesing api**] - Processes the instructions of a block in order. Returns true if all of them are supported.
+        TRITON_EXPORT bool processing(std::vector<triton::arch::Instruction>& block);
+
+        //! [**proccesing api**] - Decodes and processes the instructions from `addr` up to a control flow instruction, an unsupported instruction or undefined code, and returns them. `next` receives the address to resume from: the concrete program counter after the control flow instruction, otherwise the address where the block stopped.
+        TRITON_EXPORT std::vector<triton::arch::Instruction> processBlock(triton::uint64 addr, triton::uint64* next = nullptr);
+
+        //! [**proccesing api**] - Emulates from `start`: decodes the instructions from the concrete memory and processes them block by block until a stop condition of `options` holds, undefined code or an unsupported instruction.
+        /*!
+         * The hook of an address is called before its instruction, out of any block, with the program counter set to it.
+         * The emulation then resumes from the concrete program counter. With `syscalls`, a syscall instruction ends its
+         * block and its handler is executed, a syscall without handler stops the emulation after its instruction.
+         * With `native`, the blocks starting without symbolized or tainted register run on Unicorn until they
+         * touch a symbolized or tainted page, and the next block always runs in Triton.
+         * Returns the reason of the stop and the address to resume from.
+         */
+        TRITON_EXPORT triton::arch::EmulationResult emulate(triton::uint64 start, const triton::arch::EmulationOptions& options = triton::arch::EmulationOptions());
+
+        //! [**proccesing api**] - Binds `handler` to the syscall `number` of the emulation, instead of its built-in handler if it has one.
+        TRITON_EXPORT void setSyscallHandler(triton::uint64 number, const triton::arch::SyscallHandler& handler);
+
+        //! [**proccesing api**] - Removes the handler bound to the syscall `number` of the emulation.
+        TRITON_EXPORT void removeSyscallHandler(triton::uint64 number);
+
+        //! [**proccesing api**] - Defines the content of the file `path` of the emulated syscalls. If `symbolize` is true, the bytes read from it are symbolized.
+        TRITON_EXPORT void setSyscallFile(const std::string& path, const std::vector<triton::uint8>& content, bool symbolize=false);
+
+        //! [**proccesing api**] - Returns the content of the file `path` of the emulated syscalls, like `/dev/stdout`.
+        TRITON_EXPORT const std::vector<triton::uint8>& getSyscallFile(const std::string& path) const;
+
+        //! [**proccesing api**] - Defines the start of the heap and the address of the first mapping of the emulated syscalls.
+        TRITON_EXPORT void setSyscallLayout(triton::uint64 heap, triton::uint64 mmap);
+
+        //! [**proccesing api**] - Processes the instructions of a trace (see `TraceReader`) in order. The concrete registers and memory of a record are set before its instruction is processed. Returns the number of instructions processed.
+        /*!
+         * A `TRACE_COMPACT` trace replays the recorded state instead: only the registers and the memory read or written
+         * whose recorded values differ from the emulated ones are set (so the symbolic state the trace agrees with is kept),
+         * the writes after the instruction. Each thread has its own registers, see `setThread()`.
+         *
+         * With `decoders` threads, the instructions are decoded ahead of their processing (see `TracePipeline`), while the
+         * calling thread sets the state and builds the semantics. Their decoding is then not timed in the statistics. The
+         * Arm32 traces are always decoded sequentially.
+         */
+        TRITON_EXPORT triton::usize processTrace(std::istream& stream, triton::arch::trace_e format, triton::usize decoders=0);
+
+        //! [**proccesing api**] - Processes the instructions of the `size` bytes of a trace at `data`, see `processTrace(std::istream&, trace_e, usize)`.
+        TRITON_EXPORT triton::usize processTrace(const triton::uint8* data, triton::usize size, triton::arch::trace_e format, triton::usize decoders=0);
+
+        //! [**proccesing api**] - Processes the instructions of the trace file at `path`, which is mapped in memory, see `processTrace(std::istream&, trace_e, usize)`.
+        TRITON_EXPORT triton::usize processTrace(const std::string& path, triton::arch::trace_e format, triton::usize decoders=0);
+
+        //! [**proccesing api**] - Returns the concrete registers of every thread, as the boundary of a segment starting at the record `index`.
+        TRITON_EXPORT triton::engines::symbolic::SegmentBoundary captureSegmentBoundary(triton::usize index);
+
+        //! [**proccesing api**] - Splits the `size` bytes of a trace at `data` into segments of `length` records, and returns the concrete registers at their boundaries.
+        /*!
+         * The trace starts from the registers of the context. The records are not processed: their registers are
+         * applied to a scratch architecture, so the boundaries are exact when the records hold the registers
+         * changed by each instruction, as the `TRACE_COMPACT` traces do.
+         */
+        TRITON_EXPORT std::vector<triton::engines::symbolic::SegmentBoundary> scanTraceBoundaries(const triton::uint8* data, triton::usize size, triton::arch::trace_e format, triton::usize length);
+
+        //! [**proccesing api**] - Splits the trace file at `path` into segments, see `scanTraceBoundaries(const uint8*, usize, trace_e, usize)`.
+        TRITON_EXPORT std::vector<triton::engines::symbolic::SegmentBoundary> scanTraceBoundaries(const std::string& path, triton::arch::trace_e format, triton::usize length);
+
+        //! [**proccesing api**] - Processes the `count` records of the segment of the trace at `data` which starts at `boundary`, and returns its summary.
+        /*!
+         * The segments of a trace may be processed in parallel, each one by its own context, and stitched in order by a
+         * `SegmentStitcher`. Unless it is the first one of the trace, the segment starts from the concrete registers of
+         * `boundary`, whose parent registers are symbolized, as are the bytes of memory read by a `TRACE_COMPACT` record
+         * before the segment writes them: these variables are the live-ins of the segment. The context should be a new one.
+         * The first segment starts from the state of the context, its inputs being the symbolic variables of the context.
+         */
+        TRITON_EXPORT triton::engines::symbolic::SegmentSummary processTraceSegment(const triton::uint8* data, triton::usize size, triton::arch::trace_e format, const triton::engines::symbolic::SegmentBoundary& boundary, triton::usize count, triton::usize decoders=0);
+
+        //! [**proccesing api**] - Processes the segment of the trace file at `path`, see `processTraceSegment(const uint8*, usize, trace_e, const SegmentBoundary&, usize, usize)`.
+        TRITON_EXPORT triton::engines::symbolic::SegmentSummary processTraceSegment(const std::string& path, triton::arch::trace_e format, const triton::engines::symbolic::SegmentBoundary& boundary, triton::usize count, triton::usize decoders=0);
+
         //! [**proccesing api**] - Initializes everything.
         TRITON_EXPORT void initEngines(void);
 
@@ -266,6 +461,51 @@ namespace triton {
         //! [**proccesing api**] - Resets everything.
         TRITON_EXPORT void reset(void);
 
+        //! [**proccesing api**] - Returns a new context in the state of this one, owned by the caller. Memories, registers, symbolic and taint states are shared until written, the AST context and the modes are shared, callbacks are not copied.
+        TRITON_EXPORT API* fork(void) const;
+
+        //! [**proccesing api**] - Saves the state of the context into the file at `path`: the architecture, the modes, the concrete registers and memory, the symbolic expressions, variables and path constraints, and the taint. Callbacks and the solver are not saved.
+        TRITON_EXPORT void saveSnapshot(const std::string& path) const;
+
+        //! [**proccesing api**] - Replaces the state of the context by the one saved in the file at `path` by `saveSnapshot()`. The file is mapped in memory, and the pages of memory it holds are read in place until they are written.
+        TRITON_EXPORT void loadSnapshot(const std::string& path);
+
+        //! [**proccesing api**] - Marks the current state as the one restored by `rollbackToMark()`: the concrete, symbolic and taint registers and memory, the path constraints and the syscalls. The state is shared with the mark until written, so that only the pages and the entries written after the mark are copied.
+        TRITON_EXPORT void setMark(void);
+
+        //! [**proccesing api**] - Restores the state marked by `setMark()`. Only the pages and the entries written since the mark are released, the mark is kept for the next rollbacks. The modes, callbacks and coverage are not restored.
+        TRITON_EXPORT void rollbackToMark(void);
+
+        //! [**proccesing api**] - Removes the mark, if any. The pages shared with the mark are then owned by the context.
+        TRITON_EXPORT void removeMark(void);
+
+        //! [**proccesing api**] - Returns the statistics of the processing: the count and time of its phases, and the nodes and expressions built by opcode. Disabled by default, see `ProcessingStatistics::setEnabled()`.
+        TRITON_EXPORT triton::arch::ProcessingStatistics* getStatistics(void);
+
+        //! [**proccesing api**] - Returns the bytes and the objects used by each subsystem: the AST nodes by kind, the symbolic expressions and memory, the aligned memory, the taint, the concrete memory, the path constraints and the caches. See `MemoryUsage`.
+        TRITON_EXPORT triton::MemoryUsage getMemoryUsage(void) const;
+
+        //! [**proccesing api**] - Returns the tracer of the events of the processing, of the solver, of the garbage collections and of the synthesizer. Disabled by default, see `EventTracer::setEnabled()`.
+        TRITON_EXPORT triton::utils::EventTracer* getTracer(void);
+
+        //! [**proccesing api**] - Returns the coverage of the processing: the addresses processed, the edges and their bitmap, and the branches of the path constraints taken or not. Shared with the forks and disabled by default, see `Coverage::setEnabled()`.
+        TRITON_EXPORT triton::arch::Coverage* getCoverage(void);
+
+        //! [**proccesing api**] - Returns the executor running the asynchronous queries, the portfolio solver and the parallel synthesis. It is shared by the contexts of the process, see `Executor::getDefault()`.
+        TRITON_EXPORT triton::utils::Executor& getExecutor(void) const;
+
+        //! [**proccesing api**] - Sets the placement of the slabs of the AST nodes and of the pages of the concrete memory allocated from now on, e.g. on huge pages or on the NUMA node of the thread. The AST nodes are shared with the forks. See `MemoryPlacement`.
+        TRITON_EXPORT void setMemoryPlacement(const triton::utils::MemoryPlacement& placement);
+
+        //! [**proccesing api**] - Returns the placement of the slabs of the AST nodes and of the pages of the concrete memory.
+        TRITON_EXPORT const triton::utils::MemoryPlacement& getMemoryPlacement(void) const;
+
+        //! [**proccesing api**] - Returns the observer of the state, through which other threads read the views published while the processing goes on. Once enabled (see `StateObserver::setEnabled()`), a view is published at the end of each block processed.
+        TRITON_EXPORT triton::StateObserver& getStateObserver(void);
+
+        //! [**proccesing api**] - Publishes a view of the current state to the observer threads: the concrete registers and memory, the symbolic registers and the path constraints. See `StateView`.
+        TRITON_EXPORT void publishState(void);
+
 
 
         /* IR API ======================================================================================== */
@@ -276,6 +516,15 @@ namespace triton {
         //! [**IR builder api**] - Returns the AST context. Used as AST builder.
         TRITON_EXPORT triton::ast::SharedAstContext getAstContext(void);
 
+        //! [**IR builder api**] - Executes the built-in model of the libc function `symbol` (`memcpy`, `memmove`, `memset`, `strcmp`, `strlen` or `strncpy`) instead of the instructions at `addr`.
+        TRITON_EXPORT void setFunctionSummary(triton::uint64 addr, const std::string& symbol);
+
+        //! [**IR builder api**] - Removes the function summary bound to `addr`.
+        TRITON_EXPORT void removeFunctionSummary(triton::uint64 addr);
+
+        //! [**IR builder api**] - Returns the symbol of the function summary bound to each address.
+        TRITON_EXPORT std::map<triton::uint64, std::string> getFunctionSummaries(void);
+
 
 
         /* AST Representation API ======================================================================== */
@@ -295,6 +544,11 @@ namespace triton {
           this->callbacks.addCallback(kind, cb);
         }
 
+        //! [**callbacks api**] - Adds a GET_CONCRETE_MEMORY_VALUE or SET_CONCRETE_MEMORY_VALUE callback only called for the accesses overlapping `ranges`.
+        template <typename T> void addCallback(triton::callbacks::callback_e kind, T cb, const triton::callbacks::memoryRanges& ranges) {
+          this->callbacks.addCallback(kind, cb, ranges);
+        }
+
         //! [**callbacks api**] - Removes a callback.
         template <typename T> void removeCallback(triton::callbacks::callback_e kind, T cb) {
           this->callbacks.removeCallback(kind, cb);
@@ -410,6 +664,39 @@ namespace triton {
         //! [**symbolic api**] - Processes all recorded AST simplifications, uses solver's simplifications if `usingSolver` is true or LLVM is `usingLLVM` is true. Returns the simplified AST.
         TRITON_EXPORT triton::ast::SharedAbstractNode simplify(const triton::ast::SharedAbstractNode& node, bool usingSolver=false, bool usingLLVM=false) const;
 
+        //! [**symbolic api**] - Removes the results of the solver and LLVM simplifications cached.
+        TRITON_EXPORT void clearSimplificationCache(void);
+
+        //! [**symbolic api**] - Returns the number of results of the solver and LLVM simplifications cached.
+        TRITON_EXPORT triton::usize getSimplificationCacheSize(void) const;
+
+        //! [**symbolic api**] - Sets the maximum number of results of the solver and LLVM simplifications cached (4096 by default), 0 disables the cache.
+        TRITON_EXPORT void setSimplificationCacheCapacity(triton::usize capacity);
+
+        //! [**symbolic api**] - Adds the native simplification pass `name`, applied by `simplify()` before the passes of a greater `order` and the SYMBOLIC_SIMPLIFICATION callbacks.
+        TRITON_EXPORT void addSimplificationPass(const std::string& name, const triton::engines::symbolic::SimplificationRule& rule, triton::sint32 order=0);
+
+        //! [**symbolic api**] - Adds the native simplification pass `name` of the library of `SimplificationPasses`, e.g. `mba-linear`.
+        TRITON_EXPORT void addSimplificationPass(const std::string& name);
+
+        //! [**symbolic api**] - Removes the native simplification pass `name`.
+        TRITON_EXPORT void removeSimplificationPass(const std::string& name);
+
+        //! [**symbolic api**] - Returns the names of the native simplification passes, in their order.
+        TRITON_EXPORT std::vector<std::string> getSimplificationPasses(void) const;
+
+        //! [**symbolic api**] - Sets the maximum number of rewritings of a node by the simplification passes and callbacks (16 by default).
+        TRITON_EXPORT void setSimplificationIterations(triton::uint32 iterations);
+
+        //! [**symbolic api**] - Returns the statistics of the native simplification passes, by name.
+        TRITON_EXPORT const std::map<std::string, triton::engines::symbolic::SimplificationPassStatistics>& getSimplificationPassStatistics(void) const;
+
+        //! [**symbolic api**] - Returns the number of nodes whose simplification was memoized.
+        TRITON_EXPORT triton::usize getSimplificationMemoHits(void) const;
+
+        //! [**symbolic api**] - Removes the memoized simplifications of the passes and callbacks, and resets their statistics.
+        TRITON_EXPORT void clearSimplificationMemo(void);
+
         //! [**symbolic api**] - Returns the shared symbolic expression corresponding to an id.
         TRITON_EXPORT triton::engines::symbolic::SharedSymbolicExpression getSymbolicExpression(triton::usize symExprId) const;
 
@@ -431,12 +718,30 @@ namespace triton {
         //! [**symbolic api**] - Returns the current path predicate as an AST of logical conjunction of each taken branch.
         TRITON_EXPORT triton::ast::SharedAbstractNode getPathPredicate(void);
 
+        //! [**symbolic api**] - Returns the current path predicate as one N-ary logical conjunction of each taken branch.
+        TRITON_EXPORT triton::ast::SharedAbstractNode getFlatPathPredicate(void);
+
+        //! [**symbolic api**] - Returns the logical conjunction of the path constraints which share symbolic variables with `node`, directly or through other path constraints.
+        TRITON_EXPORT triton::ast::SharedAbstractNode getRelevantPathPredicate(const triton::ast::SharedAbstractNode& node);
+
         //! [**symbolic api**] - Returns path predicates which may reach the targeted address.
         TRITON_EXPORT std::vector<triton::ast::SharedAbstractNode> getPredicatesToReachAddress(triton::uint64 addr);
 
+        //! [**symbolic api**] - Returns the predicate which takes the loop iterations of the path constraint at `index` before `iteration`, and not `iteration`.
+        TRITON_EXPORT triton::ast::SharedAbstractNode getPredicateToFlipIteration(triton::usize index, triton::usize iteration);
+
+        //! [**symbolic api**] - Defines the number of the most recent iterations of a loop branch which are not summarized with PC_LOOP_SUMMARIZATION, at least one. By default, 1.
+        TRITON_EXPORT void setFlippableIterations(triton::usize count);
+
         //! [**symbolic api**] - Returns the size of the path constraints
         TRITON_EXPORT triton::usize getSizeOfPathConstraints(void) const;
 
+        //! [**symbolic api**] - Spills the cold path constraints into the file at `path`, keeping the `resident` most recent ones in memory, faulted back in when they are read. An empty path stops spilling. See `PathManager::setSpilling()`.
+        TRITON_EXPORT void setPathConstraintsSpilling(const std::string& path, triton::usize resident=1024);
+
+        //! [**symbolic api**] - Returns the number of path constraints whose predicates are spilled and not faulted in.
+        TRITON_EXPORT triton::usize getNumberOfSpilledPathConstraints(void) const;
+
         //! [**symbolic api**] - Pushes constraint created from node to the current path predicate.
         TRITON_EXPORT void pushPathConstraint(const triton::ast::SharedAbstractNode& node);
 
@@ -455,6 +760,24 @@ namespace triton {
         //! [**symbolic api**] - Returns true if the symbolic execution engine is enabled.
         TRITON_EXPORT bool isSymbolicEngineEnabled(void) const;
 
+        //! [**symbolic api**] - Defines the budget of the symbolic engine: the maximum depth of ASTs, of live AST nodes and of symbolic expressions (0 if unbounded), and the policy applied when nodes or expressions exceed it.
+        TRITON_EXPORT void setSymbolicBudget(triton::uint32 maxDepth, triton::usize maxNodes, triton::usize maxExpressions, triton::engines::symbolic::budget_policy_e policy=triton::engines::symbolic::CONCRETIZE_DEEPEST_EXPRESSIONS);
+
+        //! [**symbolic api**] - Returns true if the live AST nodes or the symbolic expressions exceed the budget of the symbolic engine.
+        TRITON_EXPORT bool isSymbolicBudgetExceeded(void) const;
+
+        //! [**symbolic api**] - Defines the maximum depth of the ASTs of new expressions with AST_DEPTH_LIMIT, at least one, and the policy applied to the deeper ones.
+        TRITON_EXPORT void setSymbolicDepthLimit(triton::uint32 depth, triton::engines::symbolic::depth_policy_e policy=triton::engines::symbolic::CONCRETIZE_DEEP_EXPRESSION);
+
+        //! [**symbolic api**] - Returns the maximum depth of the ASTs of new expressions with AST_DEPTH_LIMIT.
+        TRITON_EXPORT triton::uint32 getSymbolicDepthLimit(void) const;
+
+        //! [**symbolic api**] - Returns the policy applied to the ASTs of new expressions deeper than the depth limit.
+        TRITON_EXPORT triton::engines::symbolic::depth_policy_e getSymbolicDepthPolicy(void) const;
+
+        //! [**symbolic api**] - Returns the policies of the dereferences of symbolic addresses, and their statistics by instruction.
+        TRITON_EXPORT triton::engines::symbolic::ConcretizationPolicy* getConcretizationPolicy(void);
+
         //! [**symbolic api**] - Returns true if the symbolic expression ID exists.
         TRITON_EXPORT bool isSymbolicExpressionExists(triton::usize symExprId) const;
 
@@ -473,13 +796,16 @@ namespace triton {
         //! [**symbolic api**] - Converts a symbolic memory expression to a symbolic variable.
         TRITON_EXPORT triton::engines::symbolic::SharedSymbolicVariable symbolizeMemory(const triton::arch::MemoryAccess& mem, const std::string& symVarAlias="");
 
+        //! [**symbolic api**] - Converts the memory area [baseAddr, baseAddr+size) to symbolic variables of `granularity` bytes. Aliases are `aliasPrefix_index` if a prefix is given.
+        TRITON_EXPORT std::vector<triton::engines::symbolic::SharedSymbolicVariable> symbolizeMemoryArea(triton::uint64 baseAddr, triton::usize size, triton::uint32 granularity=triton::size::byte, const std::string& aliasPrefix="");
+
         //! [**symbolic api**] - Converts a symbolic register expression to a symbolic variable.
         TRITON_EXPORT triton::engines::symbolic::SharedSymbolicVariable symbolizeRegister(const triton::arch::Register& reg, const std::string& symVarAlias="");
 
-        //! [**symbolic api**] - Concretizes all symbolic memory references.
+        //! [**symbolic api**] - Concretizes all symbolic memory references in constant time, the stale pages are released lazily.
         TRITON_EXPORT void concretizeAllMemory(void);
 
-        //! [**symbolic api**] - Concretizes all symbolic register references.
+        //! [**symbolic api**] - Concretizes all symbolic register references in constant time, the stale entries are released lazily.
         TRITON_EXPORT void concretizeAllRegister(void);
 
         //! [**symbolic api**] - Concretizes a specific symbolic memory reference.
@@ -488,12 +814,18 @@ namespace triton {
         //! [**symbolic api**] - Concretizes a specific symbolic memory reference.
         TRITON_EXPORT void concretizeMemory(triton::uint64 addr);
 
+        //! [**symbolic api**] - Concretizes the symbolic memory references of [baseAddr, baseAddr+size).
+        TRITON_EXPORT void concretizeMemoryArea(triton::uint64 baseAddr, triton::usize size);
+
         //! [**symbolic api**] - Concretizes a specific symbolic register reference.
         TRITON_EXPORT void concretizeRegister(const triton::arch::Register& reg);
 
         //! [**symbolic api**] - Slices all expressions from a given one.
         TRITON_EXPORT std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicExpression> sliceExpressions(const triton::engines::symbolic::SharedSymbolicExpression& expr);
 
+        //! [**symbolic api**] - Slices all expressions from several ones, visiting their common expressions once.
+        TRITON_EXPORT std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicExpression> sliceExpressionsMany(const std::vector<triton::engines::symbolic::SharedSymbolicExpression>& exprs);
+
         //! [**symbolic api**] - Returns the list of the tainted symbolic expressions.
         TRITON_EXPORT std::vector<triton::engines::symbolic::SharedSymbolicExpression> getTaintedSymbolicExpressions(void) const;
 
@@ -509,6 +841,9 @@ namespace triton {
         //! [**symbolic api**] - Sets the concrete value of a symbolic variable.
         TRITON_EXPORT void setConcreteVariableValue(const triton::engines::symbolic::SharedSymbolicVariable& symVar, const triton::uint512& value);
 
+        //! [**symbolic api**] - Sets the concrete values of the variables of a model, e.g. to validate a solution. The ASTs are re-evaluated once for all the variables.
+        TRITON_EXPORT void applyModel(const std::unordered_map<triton::usize, triton::engines::solver::SolverModel>& model);
+
 
 
         /* Solver engine API ============================================================================= */
@@ -531,9 +866,36 @@ namespace triton {
          */
         TRITON_EXPORT std::vector<std::unordered_map<triton::usize, triton::engines::solver::SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
 
+        //! [**solver api**] - Computes at most `limit` models from a symbolic constraint and gives them to `callback` as they are found, projected onto `variables` if it is not empty. Returns the number of models given. State is returned in the `status` pointer as well as the solving time. A `timeout` can also be defined.
+        TRITON_EXPORT triton::usize enumerateModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, const triton::engines::solver::ModelCallback& callback, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& variables = {}, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
         //! Returns true if an expression is satisfiable.
         TRITON_EXPORT bool isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
 
+        //! [**solver api**] - Returns an UNSAT core of `conjuncts`, a subset of them whose conjunction is UNSAT, or an empty vector if their conjunction is not UNSAT. State is returned in the `status` pointer as well as the solving time. A `timeout` can also be defined.
+        TRITON_EXPORT std::vector<triton::ast::SharedAbstractNode> getUnsatCore(const std::vector<triton::ast::SharedAbstractNode>& conjuncts, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
+        //! [**solver api**] - Computes a model from a symbolic constraint on the threads of the solver and returns its future. A `timeout` can also be defined.
+        TRITON_EXPORT triton::engines::solver::SolverFuture getModelAsync(const triton::ast::SharedAbstractNode& node, triton::uint32 timeout = 0);
+
+        //! [**solver api**] - Checks the satisfiability of an expression on the threads of the solver and returns its future. A `timeout` can also be defined.
+        TRITON_EXPORT triton::engines::solver::SolverFuture isSatAsync(const triton::ast::SharedAbstractNode& node, triton::uint32 timeout = 0);
+
+        //! [**solver api**] - Solves the branches not taken by the path constraints, each one with the predicates taken before it, and returns them with their models.
+        TRITON_EXPORT std::vector<triton::engines::solver::BranchFlip> solveAllBranchFlips(const triton::engines::solver::BranchFlipOptions& options = triton::engines::solver::BranchFlipOptions());
+
+        //! [**solver api**] - Solves the branches not taken by `pathConstraints`, the trace of another context such as a fork, and returns them with their models.
+        TRITON_EXPORT std::vector<triton::engines::solver::BranchFlip> solveBranchFlips(const std::vector<triton::engines::symbolic::PathConstraint>& pathConstraints, const triton::engines::solver::BranchFlipOptions& options = triton::engines::solver::BranchFlipOptions());
+
+        //! [**solver api**] - Returns true if `node1` and `node2` are equivalent. The evaluation on corner and random inputs refutes them before the solver is queried (see `triton::engines::solver::EquivalenceOptions`).
+        TRITON_EXPORT bool isEquivalent(const triton::ast::SharedAbstractNode& node1, const triton::ast::SharedAbstractNode& node2, const triton::engines::solver::EquivalenceOptions& options = triton::engines::solver::EquivalenceOptions());
+
+        //! [**solver api**] - Checks the equivalence of each pair of nodes, their queries not refuted by the evaluation being sent to the solver together. UNSAT if a pair is equivalent, SAT with a counterexample if it is not.
+        TRITON_EXPORT std::vector<triton::engines::solver::Equivalence> checkEquivalences(const std::vector<std::pair<triton::ast::SharedAbstractNode, triton::ast::SharedAbstractNode>>& pairs, const triton::engines::solver::EquivalenceOptions& options = triton::engines::solver::EquivalenceOptions());
+
+        //! [**solver api**] - Returns true if the logical `node` is an opaque predicate, i.e. always true or always false.
+        TRITON_EXPORT bool isOpaquePredicate(const triton::ast::SharedAbstractNode& node, const triton::engines::solver::EquivalenceOptions& options = triton::engines::solver::EquivalenceOptions());
+
         //! Returns the kind of solver as triton::engines::solver::solver_e.
         TRITON_EXPORT triton::engines::solver::solver_e getSolver(void) const;
 
@@ -549,6 +911,38 @@ namespace triton {
         //! Returns true if the solver is valid.
         TRITON_EXPORT bool isSolverValid(void) const;
 
+        //! [**solver api**] - Returns the cache of the answers of the solver.
+        TRITON_EXPORT triton::engines::solver::SolverCache* getSolverCache(void);
+
+        //! [**solver api**] - Returns the external solver, which runs an SMT-LIB2 solver in subprocesses (see SOLVER_EXTERNAL).
+        TRITON_EXPORT triton::engines::solver::ExternalSolver* getSolverExternal(void);
+
+        //! [**solver api**] - Returns the remote solver, which sends the queries to solver servers (see SOLVER_REMOTE and SolverServer).
+        TRITON_EXPORT triton::engines::solver::RemoteSolver* getSolverRemote(void);
+
+        //! [**solver api**] - Returns the adaptive timeouts of the branch flips (see solveAllBranchFlips()).
+        TRITON_EXPORT triton::engines::solver::SolverBudget* getSolverBudget(void);
+
+        //! [**solver api**] - Returns the analytic solver of the simple constraints of the queries, leaving their residue to the solver.
+        TRITON_EXPORT triton::engines::solver::AnalyticSolver* getSolverAnalytic(void);
+
+        //! [**solver api**] - Returns the preprocessor simplifying the queries before they are sent to the solver.
+        TRITON_EXPORT triton::engines::solver::SolverPreprocessor* getSolverPreprocessor(void);
+
+        //! [**solver api**] - Returns the profiles solving the queries (tactics and engines), selected by the class of the queries or forced.
+        TRITON_EXPORT triton::engines::solver::SolverProfiles* getSolverProfiles(void);
+
+        //! [**solver api**] - Returns the statistics of the solver queries.
+        TRITON_EXPORT triton::engines::solver::SolverStatistics* getSolverStatistics(void);
+
+        //! [**solver api**] - Returns the local search solver (see SOLVER_LOCAL_SEARCH).
+        TRITON_EXPORT triton::engines::solver::LocalSearchSolver* getSolverLocalSearch(void);
+
+        #if defined(TRITON_Z3_INTERFACE) || defined(TRITON_BITWUZLA_INTERFACE)
+        //! [**solver api**] - Returns the portfolio solver, which races the solvers (see SOLVER_PORTFOLIO).
+        TRITON_EXPORT triton::engines::solver::PortfolioSolver* getSolverPortfolio(void);
+        #endif
+
         //! [**solver api**] - Evaluates a Triton's AST via the solver and returns a concrete value.
         TRITON_EXPORT triton::uint512 evaluateAstViaSolver(const triton::ast::SharedAbstractNode& node) const;
 
@@ -561,6 +955,33 @@ namespace triton {
         //! [**solver api**] - Defines a solver memory consumption limit (in megabytes).
         TRITON_EXPORT void setSolverMemoryLimit(triton::uint32 limit);
 
+        //! [**solver api**] - Returns the maximum number of asynchronous queries solved at once.
+        TRITON_EXPORT triton::usize getSolverThreads(void) const;
+
+        //! [**solver api**] - Defines the maximum number of asynchronous queries solved at once on the executor (see `getExecutor()`). By default, the number of hardware threads.
+        TRITON_EXPORT void setSolverThreads(triton::usize threads);
+
+        //! [**solver api**] - Asserts a constraint into the solver session. The nodes shared with the constraints already asserted are not converted again.
+        TRITON_EXPORT void pushSolverConstraint(const triton::ast::SharedAbstractNode& node);
+
+        //! [**solver api**] - Opens a new scope in the solver session.
+        TRITON_EXPORT void pushSolverScope(void);
+
+        //! [**solver api**] - Closes the `count` innermost scopes of the solver session and drops their constraints.
+        TRITON_EXPORT void popSolverScope(triton::uint32 count = 1);
+
+        /*!
+         * \brief [**solver api**] - Computes a model of the constraints of the solver session and of the `assumptions`, which are not kept once the check is done. State is returned in the `status` pointer as well as the solving time. A `timeout` can also be defined.
+         *
+         * \details
+         * **item1**: symbolic variable id<br>
+         * **item2**: model
+         */
+        TRITON_EXPORT std::unordered_map<triton::usize, triton::engines::solver::SolverModel> getModelWithAssumptions(const std::vector<triton::ast::SharedAbstractNode>& assumptions, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr);
+
+        //! [**solver api**] - Drops all the scopes and constraints of the solver session.
+        TRITON_EXPORT void resetSolverSession(void);
+
 
 
         /* Taint engine API ============================================================================== */
@@ -569,7 +990,7 @@ namespace triton {
         TRITON_EXPORT triton::engines::taint::TaintEngine* getTaintEngine(void);
 
         //! [**taint api**] - Returns the tainted addresses.
-        TRITON_EXPORT const std::unordered_set<triton::uint64>& getTaintedMemory(void) const;
+        TRITON_EXPORT std::unordered_set<triton::uint64> getTaintedMemory(void) const;
 
         //! [**taint api**] - Returns the tainted registers.
         TRITON_EXPORT std::unordered_set<const triton::arch::Register*> getTaintedRegisters(void) const;
@@ -580,6 +1001,15 @@ namespace triton {
         //! [**taint api**] - Returns true if the taint engine is enabled.
         TRITON_EXPORT bool isTaintEngineEnabled(void) const;
 
+        //! [**taint api**] - Returns the union of the taint labels of the address:size.
+        TRITON_EXPORT triton::engines::taint::TaintLabels getMemoryTaintLabels(triton::uint64 addr, triton::uint32 size=1) const;
+
+        //! [**taint api**] - Returns the union of the taint labels of the memory.
+        TRITON_EXPORT triton::engines::taint::TaintLabels getMemoryTaintLabels(const triton::arch::MemoryAccess& mem) const;
+
+        //! [**taint api**] - Returns the taint labels of the register.
+        TRITON_EXPORT triton::engines::taint::TaintLabels getRegisterTaintLabels(const triton::arch::Register& reg) const;
+
         //! [**taint api**] - Abstract taint verification. Returns true if the operand is tainted.
         TRITON_EXPORT bool isTainted(const triton::arch::OperandWrapper& op) const;
 
@@ -592,6 +1022,12 @@ namespace triton {
         //! [**taint api**] - Returns true if the register is tainted.
         TRITON_EXPORT bool isRegisterTainted(const triton::arch::Register& reg) const;
 
+        //! [**taint api**] - Returns the tainted bits of a register, from its lowest bit (see `TAINT_BIT_PRECISE`).
+        TRITON_EXPORT triton::uint64 getRegisterTaintBits(const triton::arch::Register& reg) const;
+
+        //! [**taint api**] - Sets the tainted bits of a register, from its lowest bit (see `TAINT_BIT_PRECISE`). Returns true if a bit is tainted.
+        TRITON_EXPORT bool setRegisterTaintBits(const triton::arch::Register& reg, triton::uint64 bits);
+
         //! [**taint api**] - Sets the flag (taint or untaint) to an abstract operand (Register or Memory).
         TRITON_EXPORT bool setTaint(const triton::arch::OperandWrapper& op, bool flag);
 
@@ -607,9 +1043,18 @@ namespace triton {
         //! [**taint api**] - Taints a memory. Returns TAINTED if the memory has been tainted correctly. Otherwise it returns the last defined state.
         TRITON_EXPORT bool taintMemory(const triton::arch::MemoryAccess& mem);
 
+        //! [**taint api**] - Taints an address with a label, added to its labels. Returns TAINTED if the address has been tainted correctly. Otherwise it returns the last defined state.
+        TRITON_EXPORT bool taintMemory(triton::uint64 addr, triton::uint32 label);
+
+        //! [**taint api**] - Taints a memory with a label, added to its labels. Returns TAINTED if the memory has been tainted correctly. Otherwise it returns the last defined state.
+        TRITON_EXPORT bool taintMemory(const triton::arch::MemoryAccess& mem, triton::uint32 label);
+
         //! [**taint api**] - Taints a register. Returns TAINTED if the register has been tainted correctly. Otherwise it returns the last defined state.
         TRITON_EXPORT bool taintRegister(const triton::arch::Register& reg);
 
+        //! [**taint api**] - Taints a register with a label, added to its labels. Returns TAINTED if the register has been tainted correctly. Otherwise it returns the last defined state.
+        TRITON_EXPORT bool taintRegister(const triton::arch::Register& reg, triton::uint32 label);
+
         //! [**taint api**] - Untaints an address. Returns !TAINTED if the address has been untainted correctly. Otherwise it returns the last defined state.
         TRITON_EXPORT bool untaintMemory(triton::uint64 addr);
 
@@ -665,8 +1110,30 @@ namespace triton {
 
         /* Synthesizer engine API ============================================================================== */
 
-        //! [**synthesizer api**] - Synthesizes a given node. If `constant` is true, performa a constant synthesis. If `opaque` is true, perform opaque constant synthesis. If `subexpr` is true, analyze children AST.
-        TRITON_EXPORT triton::engines::synthesis::SynthesisResult synthesize(const triton::ast::SharedAbstractNode& node, bool constant=true, bool subexpr=true, bool opaque=false);
+        //! [**synthesizer api**] - Removes the nodes cached by the synthesizer.
+        TRITON_EXPORT void clearSynthesisCache(void);
+
+        //! [**synthesizer api**] - Returns the number of nodes cached by the synthesizer.
+        TRITON_EXPORT triton::usize getSynthesisCacheSize(void) const;
+
+        //! [**synthesizer api**] - Adds the nodes of a cache saved by `saveSynthesisCache()` to the cache of the synthesizer.
+        TRITON_EXPORT void loadSynthesisCache(std::istream& stream);
+
+        //! [**synthesizer api**] - Saves the cache of the synthesizer into `stream`, the nodes synthesized in a run are lookups in the next ones.
+        TRITON_EXPORT void saveSynthesisCache(std::ostream& stream) const;
+
+        //! [**synthesizer api**] - Synthesizes a given node. If `constant` is true, performa a constant synthesis. If `opaque` is true, perform opaque constant synthesis. If `subexpr` is true, analyze children AST. If `parallel` is true, the oracles of the children are looked up on all cores.
+        TRITON_EXPORT triton::engines::synthesis::SynthesisResult synthesize(const triton::ast::SharedAbstractNode& node, bool constant=true, bool subexpr=true, bool opaque=false, bool parallel=false);
+
+
+
+        /* Exploration engine API ============================================================================== */
+
+        //! [**exploration api**] - Explores the paths from `entry` by running forks of the context on the inputs generated by flipping the branches of the previous runs. The symbolic variables are the inputs.
+        TRITON_EXPORT triton::engines::exploration::ExplorationResult explore(triton::uint64 entry, const triton::engines::exploration::ExplorationOptions& options = triton::engines::exploration::ExplorationOptions());
+
+        //! [**exploration api**] - Runs from `entry` the new testcases of a fuzzer such as AFL++ and writes back the inputs taking the branches it did not cover (see `FuzzerBridge`).
+        TRITON_EXPORT triton::engines::exploration::FuzzerBridgeResult syncFuzzer(triton::uint64 entry, const triton::engines::exploration::FuzzerBridgeOptions& options);
 
 
 
@@ -678,11 +1145,26 @@ namespace triton {
         //! [**lifting api**] - Lifts a symbolic expression and all its references to LLVM format. `fname` represents the name of the LLVM function.
         TRITON_EXPORT std::ostream& liftToLLVM(std::ostream& stream, const triton::engines::symbolic::SharedSymbolicExpression& expr, const char* fname="__triton", bool optimize=false);
 
-        //! [**lifting api**] - Lifts a symbolic expression and all its references to Python format.
-        TRITON_EXPORT std::ostream& liftToPython(std::ostream& stream, const triton::engines::symbolic::SharedSymbolicExpression& expr);
+        //! [**lifting api**] - Lifts several ASTs and all their references into one LLVM module, the optimizations are applied once on the module. The function of `nodes[i]` is named `fname_i`.
+        TRITON_EXPORT std::ostream& liftToLLVM(std::ostream& stream, const std::vector<triton::ast::SharedAbstractNode>& nodes, const char* fname="__triton", bool optimize=false);
+
+        //! [**lifting api**] - Lifts a basic block (or a trace segment) into one LLVM function. The block is executed from the current concrete state with the registers and the memory it reads as inputs, the registers and the memory it writes are the outputs. The context is not modified.
+        TRITON_EXPORT std::ostream& liftToLLVM(std::ostream& stream, const std::vector<triton::arch::Instruction>& block, const char* fname="__triton", bool optimize=false);
+
+        //! [**lifting api**] - Lifts an AST and all its references to a self-contained C function. `fname` represents the name of the C function.
+        TRITON_EXPORT std::ostream& liftToC(std::ostream& stream, const triton::ast::SharedAbstractNode& node, const char* fname="__triton");
+
+        //! [**lifting api**] - Lifts a symbolic expression and all its references to a self-contained C function. `fname` represents the name of the C function.
+        TRITON_EXPORT std::ostream& liftToC(std::ostream& stream, const triton::engines::symbolic::SharedSymbolicExpression& expr, const char* fname="__triton");
+
+        //! [**lifting api**] - Lifts a basic block (or a trace segment) into one self-contained C function, as `liftToLLVM()` does. The context is not modified.
+        TRITON_EXPORT std::ostream& liftToC(std::ostream& stream, const std::vector<triton::arch::Instruction>& block, const char* fname="__triton");
+
+        //! [**lifting api**] - Lifts a symbolic expression and all its references to Python format. If `shared` is true, shared nodes are assigned once.
+        TRITON_EXPORT std::ostream& liftToPython(std::ostream& stream, const triton::engines::symbolic::SharedSymbolicExpression& expr, bool shared=false);
 
-        //! [**lifting api**] - Lifts a symbolic expression and all its references to SMT format. If `assert_` is true, then (assert <expr>).
-        TRITON_EXPORT std::ostream& liftToSMT(std::ostream& stream, const triton::engines::symbolic::SharedSymbolicExpression& expr, bool assert_);
+        //! [**lifting api**] - Lifts a symbolic expression and all its references to SMT format. If `assert_` is true, then (assert <expr>). If `shared` is true, shared nodes are defined once.
+        TRITON_EXPORT std::ostream& liftToSMT(std::ostream& stream, const triton::engines::symbolic::SharedSymbolicExpression& expr, bool assert_, bool shared=false);
 
         //! [**lifting api**] - Lifts and simplify an AST using LLVM
         TRITON_EXPORT triton::ast::SharedAbstractNode simplifyAstViaLLVM(const triton::ast::SharedAbstractNode& node) const;
@@ -74,6 +74,32 @@ namespace triton {
       ID_REG_LAST_ITEM //!< must be the last item
     };
 
+    /*! Paths of the semantics of an instruction, decided by the IR builder from the interest of its operands */
+    enum semantics_path_e {
+      SEMANTICS_CONCRETE = 0, /*!< Nothing it reads can be kept: only the concrete state is updated, its expressions are concrete. */
+      SEMANTICS_FULL,         /*!< The semantics builds its expressions and spreads the taint. */
+      SEMANTICS_TAINT,        /*!< Only the taint is spread by the taint summary of the instruction. */
+    };
+
+    /*! Reasons an emulation stops (see `API::emulate()`) */
+    enum emulation_e {
+      EMULATION_ADDRESS = 0, /*!< The program counter reached a stop address. */
+      EMULATION_COUNT,       /*!< The maximum number of instructions is executed. */
+      EMULATION_EXIT,        /*!< A syscall ended the program. */
+      EMULATION_HOOK,        /*!< A hook asked to stop. */
+      EMULATION_SYMBOLIC_PC, /*!< A control flow instruction left a symbolized program counter. */
+      EMULATION_SYSCALL,     /*!< A syscall has no handler. */
+      EMULATION_UNDEFINED,   /*!< The program counter reached undefined code. */
+      EMULATION_UNSUPPORTED, /*!< The instruction at the program counter is not supported. */
+    };
+
+    /*! Formats of trace (see `TraceReader`) */
+    enum trace_e {
+      TRACE_BINARY = 0, /*!< Binary records. */
+      TRACE_TEXT,       /*!< Text lines.     */
+      TRACE_COMPACT,    /*!< Binary records of the tracers, with threads and register deltas. */
+    };
+
     //! The x86 namespace
     namespace x86 {
     /*!
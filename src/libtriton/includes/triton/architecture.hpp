@@ -11,11 +11,13 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <triton/archEnums.hpp>
 #include <triton/callbacks.hpp>
 #include <triton/cpuInterface.hpp>
+#include <triton/disassemblyCache.hpp>
 #include <triton/dllexport.hpp>
 #include <triton/instruction.hpp>
 #include <triton/memoryAccess.hpp>
@@ -46,6 +48,33 @@ namespace triton {
         //! Callbacks API
         triton::callbacks::Callbacks* callbacks;
 
+        //! The decoded instructions, by address and decoding state of the CPU, maybe shared with other contexts. It is filled by the const disassembly.
+        triton::arch::SharedDisassemblyCache decodings;
+
+        //! The concrete registers of a thread other than the current one.
+        struct ThreadRegisters {
+          //! A CPU holding the registers, its memory is unused.
+          std::unique_ptr<triton::arch::CpuInterface> cpu;
+
+          //! The decoding state of the CPU (see `CpuInterface::getDecodingState()`).
+          triton::uint32 decoding;
+
+          //! The exclusive memory access flag.
+          bool exclusive;
+        };
+
+        //! The registers of the threads other than the current one, by thread id.
+        std::unordered_map<triton::uint32, ThreadRegisters> threads;
+
+        //! A CPU of a removed thread, reused by the next one.
+        std::unique_ptr<triton::arch::CpuInterface> spare;
+
+        //! The id of the thread whose registers are the current ones.
+        triton::uint32 thread;
+
+        //! Returns a new CPU of the architecture `arch`, owned by the caller.
+        triton::arch::CpuInterface* newCpu(triton::arch::architecture_e arch, triton::callbacks::Callbacks* callbacks) const;
+
       protected:
         //! The kind of architecture used.
         triton::arch::architecture_e arch;
@@ -111,9 +140,30 @@ namespace triton {
         //! Initializes an architecture.
         TRITON_EXPORT void setArchitecture(triton::arch::architecture_e arch);
 
-        //! Clears the architecture states (registers and memory).
+        //! Clears the architecture states (registers and memory). The registers of all the threads are cleared.
         TRITON_EXPORT void clearArchitecture(void);
 
+        //! Copies the registers and the memory of another architecture of the same kind. The memory is shared until written.
+        TRITON_EXPORT void copyState(const triton::arch::Architecture& other);
+
+        //! Returns the id of the thread whose registers are the current ones. By default, 0.
+        TRITON_EXPORT triton::uint32 getThread(void) const;
+
+        //! Returns the ids of the threads which have registers, the current one included.
+        TRITON_EXPORT std::vector<triton::uint32> getThreads(void) const;
+
+        //! Switches the concrete registers to the ones of the thread `tid`, the memory is shared by all the threads. A new thread starts with a copy of the current registers.
+        TRITON_EXPORT void setThread(triton::uint32 tid);
+
+        //! Removes the registers of the thread `tid`, which must not be the current one.
+        TRITON_EXPORT void removeThread(triton::uint32 tid);
+
+        //! Returns the cache of the decoded instructions.
+        TRITON_EXPORT const triton::arch::SharedDisassemblyCache& getDisassemblyCache(void) const;
+
+        //! Replaces the cache of the decoded instructions, e.g. by the one of another context of the same architecture.
+        TRITON_EXPORT void setDisassemblyCache(const triton::arch::SharedDisassemblyCache& cache);
+
         //! Returns all registers.
         TRITON_EXPORT const std::unordered_map<triton::arch::register_e, const triton::arch::Register>& getAllRegisters(void) const;
 
@@ -159,9 +209,21 @@ namespace triton {
         //! Returns the concrete value of a memory area.
         TRITON_EXPORT std::vector<triton::uint8> getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks=true) const;
 
+        //! Copies the concrete value of a memory area into `area`, which must hold `size` bytes.
+        TRITON_EXPORT void getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::uint8* area, triton::usize size, bool execCallbacks=true) const;
+
+        //! Returns the concrete memory, to read its pages without copying them. The callbacks are not called.
+        TRITON_EXPORT const triton::arch::ConcreteMemory& getConcreteMemory(void) const;
+
         //! Returns the concrete value of a register.
         TRITON_EXPORT triton::uint512 getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks=true) const;
 
+        //! Returns the concrete value of memory cells of 64 bits or less, without multiprecision arithmetic.
+        TRITON_EXPORT triton::uint64 getConcreteMemoryValue64(const triton::arch::MemoryAccess& mem, bool execCallbacks=true) const;
+
+        //! Returns the concrete value of a register of 64 bits or less, without multiprecision arithmetic.
+        TRITON_EXPORT triton::uint64 getConcreteRegisterValue64(const triton::arch::Register& reg, bool execCallbacks=true) const;
+
         /*!
          * \brief [**architecture api**] - Sets the concrete value of a memory cell.
          *
@@ -194,6 +256,20 @@ namespace triton {
          */
         TRITON_EXPORT void setConcreteMemoryAreaValue(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size);
 
+        /*!
+         * \brief [**architecture api**] - Sets the concrete value of a memory area to an external buffer, without copying it.
+         *
+         * \details The pages fully covered by the area are mapped to it and only copied when
+         * they are written, so the area must outlive the memory and all its copies, unless `owner`
+         * keeps it alive. Note that
+         * by setting a concrete value will probably imply a desynchronization with the symbolic
+         * state (if it exists). You should probably use the concretize functions after this.
+         */
+        TRITON_EXPORT void mapConcreteMemoryArea(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size, const std::shared_ptr<const void>& owner=nullptr);
+
+        //! [**architecture api**] - Sets the placement of the next pages of the concrete memory.
+        TRITON_EXPORT void setConcreteMemoryPlacement(const triton::utils::MemoryPlacement& placement);
+
         /*!
          * \brief [**architecture api**] - Sets the concrete value of a register.
          *
@@ -8,6 +8,7 @@
 #ifndef TRITON_ARM32CPU_HPP
 #define TRITON_ARM32CPU_HPP
 
+#include <memory>
 #include <set>
 #include <string>
 #include <unordered_map>
@@ -15,6 +16,8 @@
 
 #include <triton/archEnums.hpp>
 #include <triton/callbacks.hpp>
+#include <triton/capstonePool.hpp>
+#include <triton/concreteMemory.hpp>
 #include <triton/cpuInterface.hpp>
 #include <triton/dllexport.hpp>
 #include <triton/externalLibs.hpp>
@@ -68,11 +71,11 @@ namespace triton {
             //! Callbacks API
             triton::callbacks::Callbacks* callbacks;
 
-            //! Capstone context for ARM mode.
-            triton::extlibs::capstone::csh handleArm;
+            //! Capstone contexts for ARM mode, shared by the copies of the CPU.
+            std::shared_ptr<triton::arch::CapstonePool> disassemblerArm;
 
-            //! Capstone context for Thumb mode.
-            triton::extlibs::capstone::csh handleThumb;
+            //! Capstone contexts for Thumb mode, shared by the copies of the CPU.
+            std::shared_ptr<triton::arch::CapstonePool> disassemblerThumb;
 
             //! State of the currently processed IT block.
             char itStateArray[5];
@@ -105,14 +108,8 @@ namespace triton {
             triton::arch::arm::condition_e invertCodeCondition(triton::arch::arm::condition_e cc) const;
 
           protected:
-            /*! \brief map of address -> concrete value
-             *
-             * \details
-             *
-             * **item1**: memory address<br>
-             * **item2**: concrete value
-             */
-            std::unordered_map<triton::uint64, triton::uint8, IdentityHash<triton::uint64>> memory;
+            //! The concrete memory. Its pages are shared with copies of the CPU.
+            triton::arch::ConcreteMemory memory;
 
             //! Concrete value of r0
             triton::uint8 r0[triton::size::dword];
@@ -174,6 +171,7 @@ namespace triton {
             TRITON_EXPORT bool isRegisterValid(triton::arch::register_e regId) const;
             TRITON_EXPORT bool isThumb(void) const;
             TRITON_EXPORT bool isMemoryExclusiveAccess(void) const;
+            TRITON_EXPORT const triton::arch::ConcreteMemory& getConcreteMemory(void) const;
             TRITON_EXPORT const std::unordered_map<triton::arch::register_e, const triton::arch::Register>& getAllRegisters(void) const;
             TRITON_EXPORT const triton::arch::Register& getParentRegister(const triton::arch::Register& reg) const;
             TRITON_EXPORT const triton::arch::Register& getParentRegister(triton::arch::register_e id) const;
@@ -186,17 +184,26 @@ namespace triton {
             TRITON_EXPORT triton::arch::endianness_e getEndianness(void) const;
             TRITON_EXPORT triton::uint32 gprBitSize(void) const;
             TRITON_EXPORT triton::uint32 gprSize(void) const;
+            TRITON_EXPORT triton::uint32 getDecodingState(void) const;
             TRITON_EXPORT triton::uint32 numberOfRegisters(void) const;
             TRITON_EXPORT triton::uint512 getConcreteMemoryValue(const triton::arch::MemoryAccess& mem, bool execCallbacks=true) const;
             TRITON_EXPORT triton::uint512 getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks=true) const;
+            TRITON_EXPORT triton::uint64 getConcreteMemoryValue64(const triton::arch::MemoryAccess& mem, bool execCallbacks=true) const;
+            TRITON_EXPORT triton::uint64 getConcreteRegisterValue64(const triton::arch::Register& reg, bool execCallbacks=true) const;
             TRITON_EXPORT triton::uint8 getConcreteMemoryValue(triton::uint64 addr, bool execCallbacks=true) const;
             TRITON_EXPORT void clear(void);
+            TRITON_EXPORT void copyRegisters(const triton::arch::CpuInterface& cpu);
+            TRITON_EXPORT void copyState(const triton::arch::CpuInterface& other);
             TRITON_EXPORT void disassembly(triton::arch::Instruction& inst);
+            TRITON_EXPORT void getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::uint8* area, triton::usize size, bool execCallbacks=true) const;
+            TRITON_EXPORT void mapConcreteMemoryArea(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size, const std::shared_ptr<const void>& owner=nullptr);
+            TRITON_EXPORT void setConcreteMemoryPlacement(const triton::utils::MemoryPlacement& placement);
             TRITON_EXPORT void setConcreteMemoryAreaValue(triton::uint64 baseAddr, const std::vector<triton::uint8>& values);
             TRITON_EXPORT void setConcreteMemoryAreaValue(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size);
             TRITON_EXPORT void setConcreteMemoryValue(const triton::arch::MemoryAccess& mem, const triton::uint512& value);
             TRITON_EXPORT void setConcreteMemoryValue(triton::uint64 addr, triton::uint8 value);
             TRITON_EXPORT void setConcreteRegisterValue(const triton::arch::Register& reg, const triton::uint512& value);
+            TRITON_EXPORT void setDecodingState(triton::uint32 state);
             TRITON_EXPORT void setThumb(bool state);
             TRITON_EXPORT void setMemoryExclusiveAccess(bool state);
             TRITON_EXPORT bool isConcreteMemoryValueDefined(const triton::arch::MemoryAccess& mem) const;
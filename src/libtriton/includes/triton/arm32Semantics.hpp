@@ -87,6 +87,9 @@ namespace triton {
             //! Builds the semantics of a conditional instruction.
             triton::ast::SharedAbstractNode buildConditionalSemantics(triton::arch::Instruction& inst, triton::arch::OperandWrapper& dst, const triton::ast::SharedAbstractNode& opNode);
 
+            //! Builds the semantics of a conditional store of `ops` to the contiguous slots of `size` bytes at `addr`.
+            std::vector<triton::ast::SharedAbstractNode> buildConditionalStores(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& cond, const std::vector<triton::ast::SharedAbstractNode>& ops, triton::uint64 addr, triton::uint32 size);
+
             //! Returns the AST corresponding to the adjustment of the LSB of the provided node.
             triton::ast::SharedAbstractNode adjustISSB(const triton::ast::SharedAbstractNode& node);
 
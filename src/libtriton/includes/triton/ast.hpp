@@ -9,6 +9,7 @@
 #define TRITON_AST_H
 
 #include <deque>
+#include <functional>
 #include <memory>
 #include <ostream>
 #include <stdexcept>
@@ -20,6 +21,7 @@
 #include <triton/astEnums.hpp>
 #include <triton/cpuSize.hpp>
 #include <triton/dllexport.hpp>
+#include <triton/persistentMap.hpp>
 #include <triton/tritonTypes.hpp>
 
 
@@ -62,6 +64,211 @@ namespace triton {
     //! Shared AST context
     using SharedAstContext = std::shared_ptr<triton::ast::AstContext>;
 
+    //! The concrete bytes of an array, by index. Copies of an array share their cells.
+    using ArrayMemory = triton::utils::PersistentMap<triton::uint64, triton::uint8>;
+
+    //! \class NodeValue
+    /*! \brief The concrete value of a node. Values fitting in 64 bits are kept natively, wider ones are boxed. */
+    class NodeValue {
+      private:
+        //! The value if it fits in 64 bits.
+        triton::uint64 narrow;
+
+        //! The value if it does not fit in 64 bits, nullptr otherwise.
+        std::unique_ptr<triton::uint512> wide;
+
+      public:
+        //! Constructor.
+        TRITON_EXPORT NodeValue();
+
+        //! Constructor by copy.
+        TRITON_EXPORT NodeValue(const NodeValue& other);
+
+        //! Copies a NodeValue.
+        TRITON_EXPORT NodeValue& operator=(const NodeValue& other);
+
+        //! Sets the value.
+        TRITON_EXPORT NodeValue& operator=(const triton::uint512& value);
+
+        //! Sets a value which fits in 64 bits.
+        TRITON_EXPORT void setNarrow(triton::uint64 value);
+
+        //! Returns the value.
+        TRITON_EXPORT triton::uint512 get(void) const;
+
+        //! Returns the lower 64 bits of the value.
+        TRITON_EXPORT triton::uint64 getNarrow(void) const;
+    };
+
+
+    //! \class NodeHash
+    /*! \brief The 128-bit structural hash of a node. Values are mixed in with an xxh3-like multiply-fold. */
+    class NodeHash {
+      private:
+        //! The lower 64 bits of the hash.
+        triton::uint64 low;
+
+        //! The upper 64 bits of the hash.
+        triton::uint64 high;
+
+      public:
+        //! Constructor.
+        TRITON_EXPORT NodeHash();
+
+        //! Mixes a 64-bit value into the hash.
+        TRITON_EXPORT void mix(triton::uint64 value);
+
+        //! Mixes a value of any size into the hash.
+        TRITON_EXPORT void mix(const triton::uint512& value);
+
+        //! Mixes a string into the hash.
+        TRITON_EXPORT void mix(const std::string& value);
+
+        //! Mixes another hash into the hash.
+        TRITON_EXPORT void mix(const NodeHash& other);
+
+        //! Returns the hash.
+        TRITON_EXPORT triton::uint128 get(void) const;
+
+        //! Returns true if both hashes are equal.
+        TRITON_EXPORT bool operator==(const NodeHash& other) const;
+
+        //! Returns true if both hashes are different.
+        TRITON_EXPORT bool operator!=(const NodeHash& other) const;
+
+        //! Total order of hashes, used to sort children of commutative operators.
+        TRITON_EXPORT bool operator<(const NodeHash& other) const;
+    };
+
+
+    //! \class NodeDomain
+    /*! \brief The abstract value of a node: bits known to be zero or one and an unsigned interval. All possible values of the node are in the domain. */
+    class NodeDomain {
+      private:
+        //! The size of the domain.
+        triton::uint32 size;
+
+        //! Bits known to be zero.
+        triton::uint512 zeros;
+
+        //! Bits known to be one.
+        triton::uint512 ones;
+
+        //! The unsigned lower bound.
+        triton::uint512 lower;
+
+        //! The unsigned upper bound.
+        triton::uint512 upper;
+
+        //! Tightens the known bits and the interval against each other.
+        void normalize(void);
+
+      public:
+        //! Constructor. Any value of `size` bits.
+        TRITON_EXPORT NodeDomain(triton::uint32 size=0);
+
+        //! Constructor. Only `value`.
+        TRITON_EXPORT NodeDomain(triton::uint32 size, const triton::uint512& value);
+
+        //! Constructor. Values which match the known bits and are in `[lower, upper]`.
+        TRITON_EXPORT NodeDomain(triton::uint32 size, const triton::uint512& zeros, const triton::uint512& ones, const triton::uint512& lower, const triton::uint512& upper);
+
+        //! Returns the size of the domain.
+        TRITON_EXPORT triton::uint32 getBitvectorSize(void) const;
+
+        //! Returns the mask of bits known to be zero.
+        TRITON_EXPORT const triton::uint512& getKnownZeros(void) const;
+
+        //! Returns the mask of bits known to be one.
+        TRITON_EXPORT const triton::uint512& getKnownOnes(void) const;
+
+        //! Returns the unsigned lower bound.
+        TRITON_EXPORT const triton::uint512& getLower(void) const;
+
+        //! Returns the unsigned upper bound.
+        TRITON_EXPORT const triton::uint512& getUpper(void) const;
+
+        //! Returns true if the domain holds a single value.
+        TRITON_EXPORT bool isConstant(void) const;
+
+        //! Returns true if `value` is in the domain.
+        TRITON_EXPORT bool contains(const triton::uint512& value) const;
+
+        //! Returns the smallest domain which contains both domains.
+        TRITON_EXPORT NodeDomain join(const NodeDomain& other) const;
+
+        //! Returns true if both domains are equal.
+        TRITON_EXPORT bool operator==(const NodeDomain& other) const;
+
+        //! Returns true if both domains are different.
+        TRITON_EXPORT bool operator!=(const NodeDomain& other) const;
+    };
+
+
+    //! \class NodeParents
+    /*! \brief The parents of a node, and the number of times each one uses it, e.g. twice for `xor rax, rax`.
+     *
+     * \description
+     * Most nodes have one or two parents, they are kept inline without allocation. A third one
+     * spills all of them into a vector sorted by parent, searched by bisection.
+     */
+    class NodeParents {
+      public:
+        //! A parent.
+        struct Entry {
+          //! The parent, also the key of the entry.
+          AbstractNode* node;
+
+          //! The number of uses of the node by the parent.
+          triton::uint32 count;
+
+          //! The parent, to return it while it is alive.
+          WeakAbstractNode weak;
+        };
+
+      private:
+        //! The number of inline entries.
+        static const triton::uint32 inlineSize = 2;
+
+        //! The inline entries, the first `used` ones are set when `spilled` is empty.
+        Entry inlined[inlineSize];
+
+        //! The number of inline entries set.
+        triton::uint32 used = 0;
+
+        //! The entries sorted by parent once more than `inlineSize` were set.
+        std::vector<Entry> spilled;
+
+      public:
+        //! Returns the entry of `node`, or nullptr.
+        TRITON_EXPORT Entry* find(AbstractNode* node);
+
+        //! Adds `node` used once. It must not be a parent yet.
+        TRITON_EXPORT void insert(AbstractNode* node, const WeakAbstractNode& weak);
+
+        //! Removes `node` if it is a parent.
+        TRITON_EXPORT void erase(AbstractNode* node);
+
+        //! Removes all parents.
+        TRITON_EXPORT void clear(void);
+
+        //! Returns the number of parents.
+        TRITON_EXPORT triton::usize size(void) const;
+
+        //! Calls `visitor(entry)` on each parent. The parents must not be modified meanwhile.
+        template <typename F>
+        void forEach(F visitor) {
+          if (!this->spilled.empty()) {
+            for (auto& entry : this->spilled)
+              visitor(entry);
+            return;
+          }
+          for (triton::uint32 index = 0; index < this->used; index++)
+            visitor(this->inlined[index]);
+        }
+    };
+
+
     //! Abstract node
     class AbstractNode : public std::enable_shared_from_this<AbstractNode> {
       private:
@@ -69,7 +276,7 @@ namespace triton {
         virtual void initHash(void) = 0;
 
       protected:
-        //! Deep level for computing hash
+        //! Deep level of the tree
         triton::uint32 level;
 
         //! The type of the node.
@@ -78,18 +285,23 @@ namespace triton {
         //! The children of the node.
         std::vector<SharedAbstractNode> children;
 
-        // This structure counter the number of use of a given parent as a node may have
-        // multiple time the same parent: eg. xor rax rax
-        std::unordered_map<AbstractNode*, std::pair<triton::uint32, WeakAbstractNode>> parents;
+        //! The parents of the node and their number of uses, as a node may have the same parent several times: e.g. xor rax, rax.
+        triton::ast::NodeParents parents;
 
         //! The size of the node.
         triton::uint32 size;
 
         //! The value of the tree from this root node.
-        triton::uint512 eval;
+        triton::ast::NodeValue eval;
 
         //! The hash of the tree
-        triton::uint512 hash;
+        triton::ast::NodeHash hash;
+
+        //! The abstract value of the tree if it is symbolized and AST_ABSTRACT_DOMAIN is enabled, nullptr otherwise. Copies of a node share it until it is refreshed.
+        std::shared_ptr<const triton::ast::NodeDomain> domain;
+
+        //! True if the hash must be computed before being read (AST_LAZY_HASH mode).
+        bool hashDirty;
 
         //! True if the tree contains a symbolic variable.
         bool symbolized;
@@ -97,13 +309,37 @@ namespace triton {
         //! True if it's a logical node.
         bool logical;
 
+        //! True if the tree is immutable (see `freeze()`). Copies of a node are not frozen.
+        bool frozen;
+
+        //! The simplifiers (see `simplifier_e`) which returned this tree. Cleared when the tree changes.
+        triton::uint8 simplified;
+
         //! Contect use to create this node
         SharedAstContext ctxt;
 
+        //! Computes the hash, or only marks it as dirty if AST_LAZY_HASH is enabled.
+        void refreshHash(void);
+
+        //! Computes the abstract value of the tree from the ones of its children if AST_ABSTRACT_DOMAIN is enabled.
+        void refreshDomain(void);
+
+        //! Computes the dirty hashes of the tree, children first.
+        void resolveHash(void);
+
+        //! Hashes the type, the size and the children of the node. Children of commutative operators are hashed in a canonical order.
+        void hashStructure(bool commutative);
+
+        //! Returns the hash of `node`, computed first if it is dirty.
+        static const triton::ast::NodeHash& hashOf(AbstractNode* node);
+
       public:
         //! Constructor.
         TRITON_EXPORT AbstractNode(triton::ast::ast_e type, const SharedAstContext& ctxt);
 
+        //! Constructor by copy. The copy is not frozen.
+        TRITON_EXPORT AbstractNode(const AbstractNode& other);
+
         //! Destructor.
         TRITON_EXPORT virtual ~AbstractNode();
 
@@ -128,24 +364,45 @@ namespace triton {
         //! Returns true if it's a logical node.
         TRITON_EXPORT bool isLogical(void) const;
 
+        //! Returns true if it's an array node (an array, a store or a reference to one of them).
+        TRITON_EXPORT bool isArray(void) const;
+
+        //! Returns true if the tree is frozen.
+        TRITON_EXPORT bool isFrozen(void) const;
+
+        //! Makes the tree immutable, so that it may be read by other threads and used as operand of nodes of other contexts. Hashes are computed, parent links are dropped and values are not updated anymore.
+        TRITON_EXPORT void freeze(void);
+
+        //! Returns true if the tree is the result of `simplifier`, simplifying it again returns it as is.
+        TRITON_EXPORT bool isSimplified(triton::ast::simplifier_e simplifier) const;
+
+        //! Marks the tree as a result of `simplifier`. Frozen trees are not marked, they may be read by other threads.
+        TRITON_EXPORT void setSimplified(triton::ast::simplifier_e simplifier);
+
         //! Returns true if the node's concrete value and value type match those of the second one.
         TRITON_EXPORT bool hasSameConcreteValueAndTypeAs(const SharedAbstractNode& other) const;
 
         //! Returns true if the node's value, value type and properties match those of the second one.
         TRITON_EXPORT bool canReplaceNodeWithoutUpdate(const SharedAbstractNode& other) const;
 
-        //! Returns true if the current tree is equal to the second one.
+        //! Returns true if the current tree is equal to the second one. Operands of commutative operators may be in any order. The cost is at most the size of the DAGs.
         TRITON_EXPORT bool equalTo(const SharedAbstractNode& other) const;
 
         //! Returns the deep level of the tree.
         TRITON_EXPORT triton::uint32 getLevel(void) const;
 
         //! Returns the hash of the tree.
-        TRITON_EXPORT triton::uint512 getHash(void) const;
+        TRITON_EXPORT triton::uint128 getHash(void) const;
 
         //! Evaluates the tree.
         TRITON_EXPORT triton::uint512 evaluate(void) const;
 
+        //! Returns the abstract value of the tree. The value of a tree which is not symbolized is exact, a symbolized one is unknown unless AST_ABSTRACT_DOMAIN is enabled.
+        TRITON_EXPORT triton::ast::NodeDomain getDomain(void) const;
+
+        //! Evaluates the tree and returns the lower 64 bits. Fast path for nodes of 64 bits or less.
+        TRITON_EXPORT triton::uint64 evaluateNarrow(void) const;
+
         //! Initializes parents.
         void initParents(void);
 
@@ -181,13 +438,30 @@ namespace triton {
     };
 
 
+    //! `(Array (_ BitVec indexSize) (_ BitVec 8))` node. The memory, an array of bytes indexed by `indexSize`-bit bitvectors. Its cells are unknown until stored.
+    class ArrayNode : public AbstractNode {
+      private:
+        TRITON_EXPORT void initHash(void);
+
+      protected:
+        //! The concrete cells of the array, empty for an array node.
+        ArrayMemory memory;
+
+      public:
+        TRITON_EXPORT ArrayNode(triton::uint32 indexSize, const SharedAstContext& ctxt);
+        TRITON_EXPORT void init(bool withParents=false);
+        TRITON_EXPORT triton::uint32 getIndexSize(void) const;
+        TRITON_EXPORT const ArrayMemory& getMemory(void) const;
+    };
+
+
     //! `(assert <expr>)` node
     class AssertNode : public AbstractNode {
       private:
         TRITON_EXPORT void initHash(void);
 
       public:
-        TRITON_EXPORT AssertNode(const SharedAbstractNode& expr);
+        TRITON_EXPORT AssertNode(const SharedAbstractNode& expr, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
@@ -198,29 +472,41 @@ namespace triton {
         TRITON_EXPORT void initHash(void);
 
       public:
-        TRITON_EXPORT BswapNode(const SharedAbstractNode& expr);
+        TRITON_EXPORT BswapNode(const SharedAbstractNode& expr, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
 
-    //! `(bvadd <expr1> <expr2>)` node
+    //! `(bvadd <expr1> <expr2> ...)` node
     class BvaddNode : public AbstractNode {
       private:
         TRITON_EXPORT void initHash(void);
 
       public:
-        TRITON_EXPORT BvaddNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
+        template <typename T> BvaddNode(const T& exprs, const SharedAstContext& ctxt)
+          : AbstractNode(BVADD_NODE, ctxt) {
+          for (auto expr : exprs)
+            this->addChild(expr);
+        }
+
+        TRITON_EXPORT BvaddNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
 
-    //! `(bvand <expr1> <expr2>)` node
+    //! `(bvand <expr1> <expr2> ...)` node
     class BvandNode : public AbstractNode {
       private:
         TRITON_EXPORT void initHash(void);
 
       public:
-        TRITON_EXPORT BvandNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
+        template <typename T> BvandNode(const T& exprs, const SharedAstContext& ctxt)
+          : AbstractNode(BVAND_NODE, ctxt) {
+          for (auto expr : exprs)
+            this->addChild(expr);
+        }
+
+        TRITON_EXPORT BvandNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
@@ -231,7 +517,62 @@ namespace triton {
         TRITON_EXPORT void initHash(void);
 
       public:
-        TRITON_EXPORT BvashrNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
+        TRITON_EXPORT BvashrNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt);
+        TRITON_EXPORT void init(bool withParents=false);
+    };
+
+
+    //! `((_ bvlaneadd lane) <expr1> <expr2>)` node. The addition of each `lane`-bit lane of `expr1` and `expr2`.
+    class BvlaneaddNode : public AbstractNode {
+      private:
+        TRITON_EXPORT void initHash(void);
+
+      public:
+        TRITON_EXPORT BvlaneaddNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, triton::uint32 lane, const SharedAstContext& ctxt);
+        TRITON_EXPORT void init(bool withParents=false);
+    };
+
+
+    //! `((_ bvlaneeq lane) <expr1> <expr2>)` node. Each `lane`-bit lane is all ones if the lanes of `expr1` and `expr2` are equal, zero otherwise.
+    class BvlaneeqNode : public AbstractNode {
+      private:
+        TRITON_EXPORT void initHash(void);
+
+      public:
+        TRITON_EXPORT BvlaneeqNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, triton::uint32 lane, const SharedAstContext& ctxt);
+        TRITON_EXPORT void init(bool withParents=false);
+    };
+
+
+    //! `((_ bvlaneselect lane) <mask> <expr1> <expr2>)` node. Each `lane`-bit lane of `expr1` if the most significant bit of the lane of `mask` is set, of `expr2` otherwise.
+    class BvlaneselectNode : public AbstractNode {
+      private:
+        TRITON_EXPORT void initHash(void);
+
+      public:
+        TRITON_EXPORT BvlaneselectNode(const SharedAbstractNode& mask, const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, triton::uint32 lane, const SharedAstContext& ctxt);
+        TRITON_EXPORT void init(bool withParents=false);
+    };
+
+
+    //! `((_ bvlanesgt lane) <expr1> <expr2>)` node. Each `lane`-bit lane is all ones if the lane of `expr1` is signed greater than the one of `expr2`, zero otherwise.
+    class BvlanesgtNode : public AbstractNode {
+      private:
+        TRITON_EXPORT void initHash(void);
+
+      public:
+        TRITON_EXPORT BvlanesgtNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, triton::uint32 lane, const SharedAstContext& ctxt);
+        TRITON_EXPORT void init(bool withParents=false);
+    };
+
+
+    //! `((_ bvlanesub lane) <expr1> <expr2>)` node. The subtraction of each `lane`-bit lane of `expr2` from the one of `expr1`.
+    class BvlanesubNode : public AbstractNode {
+      private:
+        TRITON_EXPORT void initHash(void);
+
+      public:
+        TRITON_EXPORT BvlanesubNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, triton::uint32 lane, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
@@ -242,7 +583,7 @@ namespace triton {
         TRITON_EXPORT void initHash(void);
 
       public:
-        TRITON_EXPORT BvlshrNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
+        TRITON_EXPORT BvlshrNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
@@ -253,7 +594,7 @@ namespace triton {
         TRITON_EXPORT void initHash(void);
 
       public:
-        TRITON_EXPORT BvmulNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
+        TRITON_EXPORT BvmulNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
@@ -264,7 +605,7 @@ namespace triton {
         TRITON_EXPORT void initHash(void);
 
       public:
-        TRITON_EXPORT BvnandNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
+        TRITON_EXPORT BvnandNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
@@ -275,7 +616,7 @@ namespace triton {
         TRITON_EXPORT void initHash(void);
 
       public:
-        TRITON_EXPORT BvnegNode(const SharedAbstractNode& expr);
+        TRITON_EXPORT BvnegNode(const SharedAbstractNode& expr, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
@@ -286,7 +627,7 @@ namespace triton {
         TRITON_EXPORT void initHash(void);
 
       public:
-        TRITON_EXPORT BvnorNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
+        TRITON_EXPORT BvnorNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
@@ -297,18 +638,46 @@ namespace triton {
         TRITON_EXPORT void initHash(void);
 
       public:
-        TRITON_EXPORT BvnotNode(const SharedAbstractNode& expr1);
+        TRITON_EXPORT BvnotNode(const SharedAbstractNode& expr1, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
 
-    //! `(bvor <expr1> <expr2>)` node
+    //! `(bvor <expr1> <expr2> ...)` node
     class BvorNode : public AbstractNode {
       private:
         TRITON_EXPORT void initHash(void);
 
       public:
-        TRITON_EXPORT BvorNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
+        template <typename T> BvorNode(const T& exprs, const SharedAstContext& ctxt)
+          : AbstractNode(BVOR_NODE, ctxt) {
+          for (auto expr : exprs)
+            this->addChild(expr);
+        }
+
+        TRITON_EXPORT BvorNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt);
+        TRITON_EXPORT void init(bool withParents=false);
+    };
+
+
+    //! `(bvparity <expr>)` node. 1-bit, set if the number of set bits of `expr` is odd.
+    class BvparityNode : public AbstractNode {
+      private:
+        TRITON_EXPORT void initHash(void);
+
+      public:
+        TRITON_EXPORT BvparityNode(const SharedAbstractNode& expr, const SharedAstContext& ctxt);
+        TRITON_EXPORT void init(bool withParents=false);
+    };
+
+
+    //! `(bvpopcount <expr>)` node. The number of set bits of `expr`, on its size.
+    class BvpopcountNode : public AbstractNode {
+      private:
+        TRITON_EXPORT void initHash(void);
+
+      public:
+        TRITON_EXPORT BvpopcountNode(const SharedAbstractNode& expr, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
@@ -319,8 +688,8 @@ namespace triton {
         TRITON_EXPORT void initHash(void);
 
       public:
-        TRITON_EXPORT BvrolNode(const SharedAbstractNode& expr, triton::uint32 rot);
-        TRITON_EXPORT BvrolNode(const SharedAbstractNode& expr, const SharedAbstractNode& rot);
+        TRITON_EXPORT BvrolNode(const SharedAbstractNode& expr, triton::uint32 rot, const SharedAstContext& ctxt);
+        TRITON_EXPORT BvrolNode(const SharedAbstractNode& expr, const SharedAbstractNode& rot, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
@@ -331,8 +700,8 @@ namespace triton {
         TRITON_EXPORT void initHash(void);
 
       public:
-        TRITON_EXPORT BvrorNode(const SharedAbstractNode& expr, triton::uint32 rot);
-        TRITON_EXPORT BvrorNode(const SharedAbstractNode& expr, const SharedAbstractNode& rot);
+        TRITON_EXPORT BvrorNode(const SharedAbstractNode& expr, triton::uint32 rot, const SharedAstContext& ctxt);
+        TRITON_EXPORT BvrorNode(const SharedAbstractNode& expr, const SharedAbstractNode& rot, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
@@ -343,7 +712,7 @@ namespace triton {
         TRITON_EXPORT void initHash(void);
 
       public:
-        TRITON_EXPORT BvsdivNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
+        TRITON_EXPORT BvsdivNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
@@ -354,7 +723,7 @@ namespace triton {
         TRITON_EXPORT void initHash(void);
 
       public:
-        TRITON_EXPORT BvsgeNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
+        TRITON_EXPORT BvsgeNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
@@ -365,7 +734,7 @@ namespace triton {
         TRITON_EXPORT void initHash(void);
 
       public:
-        TRITON_EXPORT BvsgtNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
+        TRITON_EXPORT BvsgtNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
@@ -376,7 +745,7 @@ namespace triton {
         TRITON_EXPORT void initHash(void);
 
       public:
-        TRITON_EXPORT BvshlNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
+        TRITON_EXPORT BvshlNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
@@ -387,7 +756,7 @@ namespace triton {
         TRITON_EXPORT void initHash(void);
 
       public:
-        TRITON_EXPORT BvsleNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
+        TRITON_EXPORT BvsleNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
@@ -398,7 +767,7 @@ namespace triton {
         TRITON_EXPORT void initHash(void);
 
       public:
-        TRITON_EXPORT BvsltNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
+        TRITON_EXPORT BvsltNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
@@ -409,7 +778,7 @@ namespace triton {
         TRITON_EXPORT void initHash(void);
 
       public:
-        TRITON_EXPORT BvsmodNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
+        TRITON_EXPORT BvsmodNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
@@ -420,7 +789,7 @@ namespace triton {
         TRITON_EXPORT void initHash(void);
 
       public:
-        TRITON_EXPORT BvsremNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
+        TRITON_EXPORT BvsremNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
@@ -431,7 +800,7 @@ namespace triton {
         TRITON_EXPORT void initHash(void);
 
       public:
-        TRITON_EXPORT BvsubNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
+        TRITON_EXPORT BvsubNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
@@ -442,7 +811,7 @@ namespace triton {
         TRITON_EXPORT void initHash(void);
 
       public:
-        TRITON_EXPORT BvudivNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
+        TRITON_EXPORT BvudivNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
@@ -453,7 +822,7 @@ namespace triton {
         TRITON_EXPORT void initHash(void);
 
       public:
-        TRITON_EXPORT BvugeNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
+        TRITON_EXPORT BvugeNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
@@ -464,7 +833,7 @@ namespace triton {
         TRITON_EXPORT void initHash(void);
 
       public:
-        TRITON_EXPORT BvugtNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
+        TRITON_EXPORT BvugtNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
@@ -475,7 +844,7 @@ namespace triton {
         TRITON_EXPORT void initHash(void);
 
       public:
-        TRITON_EXPORT BvuleNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
+        TRITON_EXPORT BvuleNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
@@ -486,7 +855,7 @@ namespace triton {
         TRITON_EXPORT void initHash(void);
 
       public:
-        TRITON_EXPORT BvultNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
+        TRITON_EXPORT BvultNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
@@ -497,7 +866,7 @@ namespace triton {
         TRITON_EXPORT void initHash(void);
 
       public:
-        TRITON_EXPORT BvuremNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
+        TRITON_EXPORT BvuremNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
@@ -508,18 +877,24 @@ namespace triton {
         TRITON_EXPORT void initHash(void);
 
       public:
-        TRITON_EXPORT BvxnorNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
+        TRITON_EXPORT BvxnorNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
 
-    //! `(bvxor <expr1> <expr2>)` node
+    //! `(bvxor <expr1> <expr2> ...)` node
     class BvxorNode : public AbstractNode {
       private:
         TRITON_EXPORT void initHash(void);
 
       public:
-        TRITON_EXPORT BvxorNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
+        template <typename T> BvxorNode(const T& exprs, const SharedAstContext& ctxt)
+          : AbstractNode(BVXOR_NODE, ctxt) {
+          for (auto expr : exprs)
+            this->addChild(expr);
+        }
+
+        TRITON_EXPORT BvxorNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
@@ -563,7 +938,7 @@ namespace triton {
             this->addChild(expr);
         }
 
-        TRITON_EXPORT ConcatNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
+        TRITON_EXPORT ConcatNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
@@ -574,7 +949,7 @@ namespace triton {
         TRITON_EXPORT void initHash(void);
 
       public:
-        TRITON_EXPORT DeclareNode(const SharedAbstractNode& var);
+        TRITON_EXPORT DeclareNode(const SharedAbstractNode& var, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
@@ -585,7 +960,7 @@ namespace triton {
         TRITON_EXPORT void initHash(void);
 
       public:
-        TRITON_EXPORT DistinctNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
+        TRITON_EXPORT DistinctNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
@@ -596,7 +971,7 @@ namespace triton {
         TRITON_EXPORT void initHash(void);
 
       public:
-        TRITON_EXPORT EqualNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
+        TRITON_EXPORT EqualNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
@@ -607,7 +982,7 @@ namespace triton {
         TRITON_EXPORT void initHash(void);
 
       public:
-        TRITON_EXPORT ExtractNode(triton::uint32 high, triton::uint32 low, const SharedAbstractNode& expr);
+        TRITON_EXPORT ExtractNode(triton::uint32 high, triton::uint32 low, const SharedAbstractNode& expr, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
@@ -618,8 +993,8 @@ namespace triton {
         TRITON_EXPORT void initHash(void);
 
       public:
-        template <typename T> ForallNode(const T& vars, const SharedAbstractNode& body)
-          : AbstractNode(FORALL_NODE, body->getContext()) {
+        template <typename T> ForallNode(const T& vars, const SharedAbstractNode& body, const SharedAstContext& ctxt)
+          : AbstractNode(FORALL_NODE, ctxt) {
           for (auto var : vars)
             this->addChild(var);
           this->addChild(body);
@@ -635,7 +1010,7 @@ namespace triton {
         TRITON_EXPORT void initHash(void);
 
       public:
-        TRITON_EXPORT IffNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
+        TRITON_EXPORT IffNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
@@ -661,7 +1036,7 @@ namespace triton {
         TRITON_EXPORT void initHash(void);
 
       public:
-        TRITON_EXPORT IteNode(const SharedAbstractNode& ifExpr, const SharedAbstractNode& thenExpr, const SharedAbstractNode& elseExpr);
+        TRITON_EXPORT IteNode(const SharedAbstractNode& ifExpr, const SharedAbstractNode& thenExpr, const SharedAbstractNode& elseExpr, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
@@ -678,7 +1053,7 @@ namespace triton {
             this->addChild(expr);
         }
 
-        TRITON_EXPORT LandNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
+        TRITON_EXPORT LandNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
@@ -689,7 +1064,7 @@ namespace triton {
         TRITON_EXPORT void initHash(void);
 
       public:
-        TRITON_EXPORT LetNode(std::string alias, const SharedAbstractNode& expr2, const SharedAbstractNode& expr3);
+        TRITON_EXPORT LetNode(std::string alias, const SharedAbstractNode& expr2, const SharedAbstractNode& expr3, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
@@ -700,7 +1075,7 @@ namespace triton {
         TRITON_EXPORT void initHash(void);
 
       public:
-        TRITON_EXPORT LnotNode(const SharedAbstractNode& expr);
+        TRITON_EXPORT LnotNode(const SharedAbstractNode& expr, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
@@ -717,7 +1092,7 @@ namespace triton {
             this->addChild(expr);
         }
 
-        TRITON_EXPORT LorNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
+        TRITON_EXPORT LorNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
@@ -734,7 +1109,7 @@ namespace triton {
             this->addChild(expr);
         }
 
-        TRITON_EXPORT LxorNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
+        TRITON_EXPORT LxorNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
@@ -748,12 +1123,40 @@ namespace triton {
         triton::engines::symbolic::SharedSymbolicExpression expr;
 
       public:
-        TRITON_EXPORT ReferenceNode(const triton::engines::symbolic::SharedSymbolicExpression& expr);
+        TRITON_EXPORT ReferenceNode(const triton::engines::symbolic::SharedSymbolicExpression& expr, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
         TRITON_EXPORT const triton::engines::symbolic::SharedSymbolicExpression& getSymbolicExpression(void) const;
     };
 
 
+    //! `(select <array> <index>)` node. The byte of `array` at `index`.
+    class SelectNode : public AbstractNode {
+      private:
+        TRITON_EXPORT void initHash(void);
+
+      public:
+        TRITON_EXPORT SelectNode(const SharedAbstractNode& array, const SharedAbstractNode& index, const SharedAstContext& ctxt);
+        TRITON_EXPORT void init(bool withParents=false);
+    };
+
+
+    //! `(store <array> <index> <value>)` node. The array `array` where the byte at `index` is `value`.
+    class StoreNode : public AbstractNode {
+      private:
+        TRITON_EXPORT void initHash(void);
+
+      protected:
+        //! The concrete cells of the array, the ones of `array` with the value stored.
+        ArrayMemory memory;
+
+      public:
+        TRITON_EXPORT StoreNode(const SharedAbstractNode& array, const SharedAbstractNode& index, const SharedAbstractNode& value, const SharedAstContext& ctxt);
+        TRITON_EXPORT void init(bool withParents=false);
+        TRITON_EXPORT triton::uint32 getIndexSize(void) const;
+        TRITON_EXPORT const ArrayMemory& getMemory(void) const;
+    };
+
+
     //! String node
     class StringNode : public AbstractNode {
       private:
@@ -775,7 +1178,7 @@ namespace triton {
         TRITON_EXPORT void initHash(void);
 
       public:
-        TRITON_EXPORT SxNode(triton::uint32 sizeExt, const SharedAbstractNode& expr);
+        TRITON_EXPORT SxNode(triton::uint32 sizeExt, const SharedAbstractNode& expr, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
@@ -802,19 +1205,16 @@ namespace triton {
 
       public:
         //! Create a zero extend of expr to sizeExt bits
-        TRITON_EXPORT ZxNode(triton::uint32 sizeExt, const SharedAbstractNode& expr);
+        TRITON_EXPORT ZxNode(triton::uint32 sizeExt, const SharedAbstractNode& expr, const SharedAstContext& ctxt);
         TRITON_EXPORT void init(bool withParents=false);
     };
 
-    //! Custom hash2n function for hash routine.
-    triton::uint512 hash2n(triton::uint512 hash, triton::uint32 n);
-
-    //! Custom rotate left function for hash routine.
-    triton::uint512 rotl(const triton::uint512& value, triton::uint32 shift);
-
     //! Custom modular sign extend for bitwise operation.
     triton::sint512 modularSignExtend(AbstractNode* node);
 
+    //! Custom modular sign extend of a `size`-bit value for bitwise operation.
+    triton::sint512 modularSignExtend(const triton::uint512& value, triton::uint32 size);
+
     //! Displays the node in ast representation.
     TRITON_EXPORT std::ostream& operator<<(std::ostream& stream, AbstractNode* node);
 
@@ -824,18 +1224,33 @@ namespace triton {
     //! AST C++ API - Unrolls the SSA form of a given AST.
     TRITON_EXPORT SharedAbstractNode unroll(const SharedAbstractNode& node);
 
+    //! AST C++ API - Returns a node of `ctxt` of the same kind as `node`, whose children are `children` (laid out as the children of `node`). The leaves (bit-vectors, integers, strings, variables, references, arrays) are not rebuilt.
+    TRITON_EXPORT SharedAbstractNode rebuild(const SharedAstContext& ctxt, const AbstractNode* node, const std::vector<SharedAbstractNode>& children);
+
     //! Returns node and all its children of an AST sorted topologically. If `unroll` is true, references are unrolled. If `revert` is true, children are on top of list.
     TRITON_EXPORT std::vector<SharedAbstractNode> childrenExtraction(const SharedAbstractNode& node, bool unroll, bool revert);
 
     //! Returns node and all its parents of an AST sorted topologically. If `revert` is true, oldest parents are on top of list.
     TRITON_EXPORT std::vector<SharedAbstractNode> parentsExtraction(const SharedAbstractNode& node, bool revert);
 
+    //! Returns the nodes and all their parents of an AST sorted topologically, each node once. If `revert` is true, oldest parents are on top of list.
+    TRITON_EXPORT std::vector<SharedAbstractNode> parentsExtraction(const std::vector<SharedAbstractNode>& nodes, bool revert);
+
+    //! Calls `visitor` on node and all its children of an AST, children first, without building a list. If `unroll` is true, references are unrolled.
+    TRITON_EXPORT void childrenTraversal(const SharedAbstractNode& node, bool unroll, const std::function<void(const SharedAbstractNode&)>& visitor);
+
     //! Returns a deque of collected matched nodes via a depth-first pre order traversal.
     TRITON_EXPORT std::deque<SharedAbstractNode> search(const SharedAbstractNode& node, triton::ast::ast_e match=ANY_NODE);
 
     //! Returns the first non referene node encountered.
     TRITON_EXPORT SharedAbstractNode dereference(const SharedAbstractNode& node);
 
+    //! Returns the concrete cells of an array node.
+    TRITON_EXPORT const ArrayMemory& getArrayMemory(const SharedAbstractNode& array);
+
+    //! Returns the size of the indexes of an array node.
+    TRITON_EXPORT triton::uint32 getArrayIndexSize(const SharedAbstractNode& array);
+
   /*! @} End of ast namespace */
   };
 /*! @} End of triton namespace */
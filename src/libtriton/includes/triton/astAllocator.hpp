@@ -0,0 +1,237 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_AST_ALLOCATOR_H
+#define TRITON_AST_ALLOCATOR_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <thread>
+#include <vector>
+
+#include <triton/dllexport.hpp>
+#include <triton/memoryPlacement.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    //! \class NodePool
+    /*! \brief Slab allocator with size-class free lists used to allocate AST nodes.
+     *
+     * \description
+     * A pool is used by one thread at a time, its owner. A chunk deallocated by another thread
+     * (e.g. the last reference to a frozen node is dropped by a worker) is pushed on a lock-free
+     * list which the owner drains when it allocates.
+     *
+     * Slabs are allocated with the placement of the pool (e.g. on huge pages or on a NUMA node), a
+     * slab then spans at least one huge page. A new placement only applies to the next slabs.
+     */
+    class NodePool {
+      private:
+        //! The granularity of size classes (in bytes).
+        static const triton::usize granularity = 16;
+
+        //! The number of size classes, up to the pages of the concrete memory. Bigger requests go to the global allocator.
+        static const triton::usize classes = 320;
+
+        //! The size of a slab (in bytes).
+        static const triton::usize slabSize = 64 * 1024;
+
+        //! A free chunk.
+        struct FreeChunk {
+          FreeChunk* next;
+        };
+
+        //! The free lists, one per size class.
+        FreeChunk* freeLists[classes];
+
+        //! A slab.
+        struct Slab {
+          //! The bytes of the slab.
+          char* data;
+
+          //! The size of the slab (in bytes).
+          triton::usize size;
+
+          //! The placement which allocated the slab.
+          triton::utils::MemoryPlacement placement;
+        };
+
+        //! The slabs reserved by the pool.
+        std::vector<Slab> slabs;
+
+        //! The placement of the next slabs.
+        triton::utils::MemoryPlacement placement;
+
+        //! The number of bytes reserved by slabs.
+        triton::usize bytesReserved;
+
+        //! The bump pointer in the current slab.
+        char* cursor;
+
+        //! The end of the current slab.
+        char* limit;
+
+        //! The number of allocations.
+        triton::usize allocations;
+
+        //! The number of deallocations.
+        triton::usize deallocations;
+
+        //! The number of allocations served from a free list.
+        triton::usize recycled;
+
+        //! The number of bytes currently in use.
+        triton::usize bytesInUse;
+
+        //! The number of bytes allocated since the creation of the pool.
+        triton::usize bytesAllocated;
+
+        //! The thread which allocates from the pool.
+        std::thread::id owner;
+
+        //! Chunks deallocated by other threads, one lock-free list per size class.
+        std::atomic<FreeChunk*> remoteLists[classes];
+
+        //! The number of deallocations done by other threads and not yet accounted.
+        std::atomic<triton::usize> remoteDeallocations;
+
+        //! The number of bytes deallocated by other threads and not yet accounted.
+        std::atomic<triton::usize> remoteBytes;
+
+        //! Releases all slabs.
+        void releaseSlabs(void);
+
+        //! Moves the chunks and counters of deallocations done by other threads to the owner's ones.
+        void drainRemote(void);
+
+      public:
+        //! Constructor.
+        TRITON_EXPORT NodePool();
+
+        //! Destructor.
+        TRITON_EXPORT ~NodePool();
+
+        NodePool(const NodePool& other) = delete;
+        NodePool& operator=(const NodePool& other) = delete;
+
+        //! Allocates `size` bytes.
+        TRITON_EXPORT void* allocate(triton::usize size);
+
+        //! Deallocates `size` bytes previously allocated.
+        TRITON_EXPORT void deallocate(void* p, triton::usize size);
+
+        //! Releases all slabs in bulk if no allocation is alive.
+        TRITON_EXPORT void trim(void);
+
+        //! Sets the placement of the next slabs.
+        TRITON_EXPORT void setPlacement(const triton::utils::MemoryPlacement& placement);
+
+        //! Returns the placement of the next slabs.
+        TRITON_EXPORT const triton::utils::MemoryPlacement& getPlacement(void) const;
+
+        //! Makes the calling thread the owner of the pool. The previous owner must not use the pool anymore.
+        TRITON_EXPORT void setOwner(void);
+
+        //! Returns the number of allocations.
+        TRITON_EXPORT triton::usize getAllocations(void) const;
+
+        //! Returns the number of deallocations.
+        TRITON_EXPORT triton::usize getDeallocations(void) const;
+
+        //! Returns the number of allocations served from a free list.
+        TRITON_EXPORT triton::usize getRecycled(void) const;
+
+        //! Returns the number of bytes currently in use.
+        TRITON_EXPORT triton::usize getBytesInUse(void) const;
+
+        //! Returns the number of bytes allocated since the creation of the pool.
+        TRITON_EXPORT triton::usize getBytesAllocated(void) const;
+
+        //! Returns the number of bytes reserved by slabs.
+        TRITON_EXPORT triton::usize getBytesReserved(void) const;
+    };
+
+    //! Shared NodePool.
+    using SharedNodePool = std::shared_ptr<triton::ast::NodePool>;
+
+
+    //! \class NodeAllocator
+    /*! \brief STL allocator backed by a NodePool. Used with `std::allocate_shared`. */
+    template <typename T>
+    class NodeAllocator {
+      template <typename U> friend class NodeAllocator;
+
+      private:
+        //! The pool. Allocators copied into control blocks keep it alive.
+        SharedNodePool pool;
+
+      public:
+        using value_type = T;
+
+        //! Constructor.
+        NodeAllocator(const SharedNodePool& pool) : pool(pool) {}
+
+        //! Constructor by rebinding.
+        template <typename U>
+        NodeAllocator(const NodeAllocator<U>& other) : pool(other.pool) {}
+
+        //! Allocates `n` objects.
+        T* allocate(std::size_t n) {
+          return static_cast<T*>(this->pool->allocate(n * sizeof(T)));
+        }
+
+        //! Deallocates `n` objects.
+        void deallocate(T* p, std::size_t n) {
+          this->pool->deallocate(p, n * sizeof(T));
+        }
+
+        //! Rebinding.
+        template <typename U>
+        struct rebind {
+          using other = NodeAllocator<U>;
+        };
+
+        //! Returns the pool.
+        const SharedNodePool& getPool(void) const {
+          return this->pool;
+        }
+
+        template <typename U>
+        bool operator==(const NodeAllocator<U>& other) const {
+          return this->pool == other.pool;
+        }
+
+        template <typename U>
+        bool operator!=(const NodeAllocator<U>& other) const {
+          return this->pool != other.pool;
+        }
+    };
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_AST_ALLOCATOR_H */
@@ -8,15 +8,21 @@
 #ifndef TRITON_AST_CONTEXT_H
 #define TRITON_AST_CONTEXT_H
 
+#include <atomic>
+#include <chrono>
 #include <deque>
 #include <list>
+#include <map>
 #include <memory>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
 #include <triton/ast.hpp>
+#include <triton/astAllocator.hpp>
 #include <triton/astRepresentation.hpp>
 #include <triton/dllexport.hpp>
+#include <triton/eventTracer.hpp>
 #include <triton/exceptions.hpp>
 #include <triton/modes.hpp>
 
@@ -48,25 +54,177 @@ namespace triton {
    *  @{
    */
 
+    /*! \struct GarbageStatistics
+     *  \brief The cost of the garbage collections of an AST context (see `AstContext::getGarbageStatistics()`). */
+    struct GarbageStatistics {
+      //! The number of full collections.
+      triton::usize fullCycles = 0;
+
+      //! The number of incremental collections.
+      triton::usize incrementalCycles = 0;
+
+      //! The number of collections triggered by the thresholds.
+      triton::usize triggered = 0;
+
+      //! The number of entries examined by the incremental collections.
+      triton::usize examined = 0;
+
+      //! The number of nodes released by the collections.
+      triton::usize released = 0;
+
+      //! The time spent in the collections (in nanoseconds).
+      triton::uint64 time = 0;
+    };
+
     //! \class AstContext
-    /*! \brief AST Context - Used as AST builder. */
+    /*! \brief AST Context - Used as AST builder.
+     *
+     * \description
+     * A context is not thread-safe: it must only be used by one thread, its owner (see `setOwnerThread()`).
+     * Sharing across threads goes through frozen DAGs (see `AbstractNode::freeze()`): a frozen node is
+     * immutable, so it may be read (evaluated, hashed, printed, traversed) by any thread and used as operand
+     * of nodes built in other contexts. A frozen node keeps the evaluation it had when it was frozen, updates
+     * of its variables are not propagated anymore, and the symbolic expressions it references must not be
+     * modified. Functions which build nodes in the context of their argument (e.g. `unroll()`) must not be
+     * called on frozen nodes of a context owned by another thread.
+     */
     class AstContext : public std::enable_shared_from_this<AstContext> {
       private:
         //! Modes API
         triton::modes::SharedModes modes;
 
+        //! The node pool. Every node built by this context is allocated from it.
+        triton::ast::SharedNodePool pool;
+
+        //! The allocator given to `std::allocate_shared`.
+        triton::ast::NodeAllocator<AbstractNode> allocator;
+
+        //! The bound of the types of node (see `ast_e`).
+        static const triton::usize nodeTypes = 512;
+
+        //! The number of live nodes of each type. Updated by the nodes, which may be destroyed by other threads.
+        std::atomic<triton::usize> liveNodes[nodeTypes];
+
+        //! The tracer of the garbage collections, may be null.
+        triton::utils::SharedEventTracer tracer;
+
+        //! The number of nodes allocated since the last collection which triggers one, 0 if none.
+        triton::usize garbageNodes;
+
+        //! The number of bytes allocated since the last collection which triggers one, 0 if none.
+        triton::usize garbageBytes;
+
+        //! The number of allocations of the pool at the end of the last collection.
+        triton::usize lastAllocations;
+
+        //! The number of bytes allocated by the pool at the end of the last collection.
+        triton::usize lastBytes;
+
+        //! The cost of the collections.
+        triton::ast::GarbageStatistics garbageStatistics;
+
+        //! Accounts a collection which started at `start` and released the nodes deallocated since `deallocations`.
+        void endGarbage(std::chrono::steady_clock::time_point start, triton::usize deallocations);
+
         //! String formater for ast
         triton::ast::representations::AstRepresentation astRepresentation;
 
-        //! Maps a concrete value and ast node for a variable name.
-        std::unordered_map<std::string, std::pair<triton::ast::WeakAbstractNode, triton::uint512>> valueMapping;
+        //! The node and the concrete value of a variable.
+        struct VariableValue {
+          //! The node of the variable, expired once the variable is dead.
+          triton::ast::WeakAbstractNode node;
+
+          //! The concrete value of the variable.
+          triton::uint512 value;
+
+          //! True once the variable is initialized.
+          bool initialized;
+        };
+
+        //! Maps a variable id to its node and concrete value. Ids are dense, thus a vector indexed by id.
+        std::vector<VariableValue> valueMapping;
+
+        //! The young generation: nodes kept since the last collection (see #753).
+        std::deque<SharedAbstractNode> youngNodes;
+
+        //! The old generation: nodes which survived a collection.
+        std::vector<SharedAbstractNode> oldNodes;
+
+        //! The next old node examined by an incremental collection.
+        triton::usize oldCursor;
+
+        //! The hash-consing table (AST_HASH_CONSING mode). Maps a key over kind, size, payload and children identity to nodes.
+        std::unordered_map<triton::uint64, std::vector<triton::ast::WeakAbstractNode>> consing;
+
+        //! The next bucket of the hash-consing table examined by an incremental collection.
+        triton::usize consingCursor;
 
-        //! The list of nodes
-        std::deque<SharedAbstractNode> nodes;
+        //! The number of insertions in the hash-consing table since the last collection.
+        triton::usize consingInsertions;
+
+        //! The number of shared constants of each common width (1, 8, 16, 32, 64, 128, 256 and 512 bits) kept from 0.
+        static const triton::uint32 smallConstants = 256;
+
+        //! The number of slots of the shared constants of other values and widths.
+        static const triton::usize constantSlots = 4096;
+
+        //! The shared constants. The small constants are indexed by width and value, the other ones by a hash of their value and width, a slot keeping the last constant built in it.
+        std::vector<triton::ast::WeakAbstractNode> constants;
+
+        //! The next slot of the shared constants examined by an incremental collection.
+        triton::usize constantsCursor;
+
+        //! Incremented each time a new parent link is created between two nodes.
+        triton::usize structureVersion;
+
+        //! Maps a variable id to its cone: its ancestors sorted topologically, valid for a structure version.
+        std::unordered_map<triton::usize, std::pair<triton::usize, std::vector<triton::ast::WeakAbstractNode>>> cones;
+
+        //! True while `reevaluate()` re-initializes nodes. The structure of nodes does not change meanwhile.
+        bool reevaluating;
+
+        //! Incremented each time the children of an existing node change.
+        triton::usize childrenVersion;
+
+        //! The maximum number of nodes kept by the traversal cache. The cache is flushed beyond.
+        static const triton::usize traversalCacheBudget = 1 << 20;
+
+        //! The number of nodes kept by the traversal cache.
+        triton::usize traversalsSize;
+
+        //! Topological sorts cached in AST_TRAVERSAL_CACHE mode, keyed by root and kind of traversal. Nodes are sorted children first.
+        std::map<std::pair<const AbstractNode*, triton::uint32>, std::pair<triton::usize, std::vector<triton::ast::WeakAbstractNode>>> traversals;
+
+        //! Returns the version a traversal of this kind depends on.
+        triton::usize getTraversalVersion(triton::uint32 kind) const;
+
+        //! Re-evaluates the cone of a variable, only where a dependency changed.
+        void reevaluate(triton::usize id, const SharedAbstractNode& node);
+
+        //! Re-initializes a node of a cone if it is a root or if one of its dependencies is in `changed`, and records it there if its value changed.
+        void reevaluateNode(const SharedAbstractNode& node, bool root, std::unordered_set<AbstractNode*>& changed);
+
+        //! Returns the entry of a variable id, nullptr if the variable is not initialized.
+        const VariableValue* findVariable(triton::usize id) const;
+
+        //! Returns true if both nodes have the same kind, size, payload and children identity.
+        bool isStructurallyIdentical(AbstractNode* node1, AbstractNode* node2) const;
+
+        //! Returns an already existing node structurally identical to `node` or records `node` as the canonical one.
+        SharedAbstractNode hashCons(const SharedAbstractNode& node);
+
+        //! Returns true if the node is not symbolized or if its domain holds a single value (AST_ABSTRACT_DOMAIN mode).
+        bool hasConstantValue(const SharedAbstractNode& node) const;
 
         //! Returns simplified concatenation.
         SharedAbstractNode simplify_concat(std::vector<SharedAbstractNode> exprs);
 
+        //! Returns a node of the associative and commutative operator `kind` (bvadd, bvand, bvor, bvxor, land or lor) over `exprs`. With AST_NARY, the nested nodes of the same operator are flattened, the constants merged and the operands sorted.
+        SharedAbstractNode associative(triton::ast::ast_e kind, const std::vector<SharedAbstractNode>& exprs);
+
+        //! Returns a new node of the associative and commutative operator `kind` over `exprs`, as they are.
+        SharedAbstractNode associativeNode(triton::ast::ast_e kind, const std::vector<SharedAbstractNode>& exprs);
+
         //! Returns simplified extraction.
         SharedAbstractNode simplify_extract(triton::uint32 high, triton::uint32 low, const SharedAbstractNode& expr);
 
@@ -80,33 +238,124 @@ namespace triton {
         //! Operator
         TRITON_EXPORT AstContext& operator=(const AstContext& other);
 
-        //! Collect new nodes
-        TRITON_EXPORT SharedAbstractNode collect(const SharedAbstractNode& node);
+        //! Collect new nodes. If `share` is true and AST_HASH_CONSING is enabled, a structurally identical node may be returned instead.
+        TRITON_EXPORT SharedAbstractNode collect(const SharedAbstractNode& node, bool share=true);
+
+        //! The amount of work done by an incremental collection called after each processed instruction.
+        static const triton::usize defaultGarbageBudget = 256;
 
         //! Garbage unused nodes.
         TRITON_EXPORT void garbage(void);
 
+        //! Releases the ownership of `nodes` iteratively. Called by node destructors, so that freeing a deep AST is a flat loop instead of a recursive cascade of destructors.
+        TRITON_EXPORT void release(std::vector<SharedAbstractNode>& nodes);
+
+        //! Garbage unused nodes incrementally. At most `budget` entries are examined. Young nodes first, then old nodes and the hash-consing table in round-robin.
+        TRITON_EXPORT void garbage(triton::usize budget);
+
+        /*!
+         * \brief Garbage unused nodes if the policy asks for it. Cheap enough to be called often, it is called after each processed instruction.
+         *
+         * \details Without thresholds (see `setGarbageThresholds()`), an incremental collection of `defaultGarbageBudget`
+         * entries runs at each call. Otherwise, an incremental collection runs once the nodes or the bytes allocated since
+         * the last collection reach a threshold, with a budget proportional to these allocations.
+         */
+        TRITON_EXPORT void garbageIfNeeded(void);
+
+        //! Sets the number of nodes and of bytes allocated since the last collection which trigger one in `garbageIfNeeded()`, 0 to disable a threshold.
+        TRITON_EXPORT void setGarbageThresholds(triton::usize nodes, triton::usize bytes);
+
+        //! Returns the number of nodes allocated since the last collection which triggers one, 0 if none.
+        TRITON_EXPORT triton::usize getGarbageNodesThreshold(void) const;
+
+        //! Returns the number of bytes allocated since the last collection which triggers one, 0 if none.
+        TRITON_EXPORT triton::usize getGarbageBytesThreshold(void) const;
+
+        //! Returns the cost of the collections.
+        TRITON_EXPORT const triton::ast::GarbageStatistics& getGarbageStatistics(void) const;
+
+        //! Returns true if the mode is enabled.
+        inline bool isModeEnabled(triton::modes::mode_e mode) const {
+          return this->modes->isModeEnabled(mode);
+        }
+
+        //! Returns the node pool used to allocate nodes.
+        TRITON_EXPORT const triton::ast::SharedNodePool& getNodePool(void) const;
+
+        //! Makes the calling thread the owner of the context, e.g. after the context has been handed over to a worker thread.
+        TRITON_EXPORT void setOwnerThread(void);
+
+        //! Returns the node allocator.
+        TRITON_EXPORT const triton::ast::NodeAllocator<AbstractNode>& getNodeAllocator(void) const;
+
+        //! Counts a node of type `type` built (`alive` is true) or destroyed. Called by the nodes.
+        inline void countNode(triton::ast::ast_e type, bool alive) {
+          if (static_cast<triton::usize>(type) < nodeTypes) {
+            if (alive)
+              this->liveNodes[type].fetch_add(1, std::memory_order_relaxed);
+            else
+              this->liveNodes[type].fetch_sub(1, std::memory_order_relaxed);
+          }
+        }
+
+        //! Returns the number of live nodes of each type built by this context, the types without live nodes are left out.
+        TRITON_EXPORT std::map<triton::ast::ast_e, triton::usize> getLiveNodes(void) const;
+
+        //! Returns the tracer of the garbage collections, null if there is none.
+        TRITON_EXPORT const triton::utils::SharedEventTracer& getTracer(void) const;
+
+        //! Records the garbage collections into `tracer`, which may be null.
+        TRITON_EXPORT void setTracer(const triton::utils::SharedEventTracer& tracer);
+
+        //! AST C++ API - array node builder. All arrays with the same size of indexes are the same array.
+        TRITON_EXPORT SharedAbstractNode array(triton::uint32 indexSize);
+
         //! AST C++ API - assert node builder
         TRITON_EXPORT SharedAbstractNode assert_(const SharedAbstractNode& expr);
 
         //! AST C++ API - bswap node builder
         TRITON_EXPORT SharedAbstractNode bswap(const SharedAbstractNode& expr);
 
-        //! AST C++ API - bv node builder
-        TRITON_EXPORT SharedAbstractNode bv(const triton::uint512& value, triton::uint32 size);
+        //! AST C++ API - bv node builder. If `share` is true, the node may be a shared constant, which is frozen (see `AbstractNode::freeze()`).
+        TRITON_EXPORT SharedAbstractNode bv(const triton::uint512& value, triton::uint32 size, bool share=true);
 
         //! AST C++ API - bvadd node builder
         TRITON_EXPORT SharedAbstractNode bvadd(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
 
+        //! AST C++ API - bvadd node builder
+        template <typename T> SharedAbstractNode bvadd(const T& exprs) {
+          return this->associative(BVADD_NODE, std::vector<SharedAbstractNode>(exprs.begin(), exprs.end()));
+        }
+
         //! AST C++ API - bvand node builder
         TRITON_EXPORT SharedAbstractNode bvand(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
 
+        //! AST C++ API - bvand node builder
+        template <typename T> SharedAbstractNode bvand(const T& exprs) {
+          return this->associative(BVAND_NODE, std::vector<SharedAbstractNode>(exprs.begin(), exprs.end()));
+        }
+
         //! AST C++ API - bvashr node builder
         TRITON_EXPORT SharedAbstractNode bvashr(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
 
         //! AST C++ API - bvfalse node builder
         TRITON_EXPORT SharedAbstractNode bvfalse(void);
 
+        //! AST C++ API - bvlaneadd node builder
+        TRITON_EXPORT SharedAbstractNode bvlaneadd(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, triton::uint32 lane);
+
+        //! AST C++ API - bvlaneeq node builder
+        TRITON_EXPORT SharedAbstractNode bvlaneeq(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, triton::uint32 lane);
+
+        //! AST C++ API - bvlaneselect node builder
+        TRITON_EXPORT SharedAbstractNode bvlaneselect(const SharedAbstractNode& mask, const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, triton::uint32 lane);
+
+        //! AST C++ API - bvlanesgt node builder
+        TRITON_EXPORT SharedAbstractNode bvlanesgt(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, triton::uint32 lane);
+
+        //! AST C++ API - bvlanesub node builder
+        TRITON_EXPORT SharedAbstractNode bvlanesub(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2, triton::uint32 lane);
+
         //! AST C++ API - bvlshr node builder
         TRITON_EXPORT SharedAbstractNode bvlshr(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
 
@@ -128,6 +377,17 @@ namespace triton {
         //! AST C++ API - bvor node builder
         TRITON_EXPORT SharedAbstractNode bvor(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
 
+        //! AST C++ API - bvor node builder
+        template <typename T> SharedAbstractNode bvor(const T& exprs) {
+          return this->associative(BVOR_NODE, std::vector<SharedAbstractNode>(exprs.begin(), exprs.end()));
+        }
+
+        //! AST C++ API - bvparity node builder
+        TRITON_EXPORT SharedAbstractNode bvparity(const SharedAbstractNode& expr);
+
+        //! AST C++ API - bvpopcount node builder
+        TRITON_EXPORT SharedAbstractNode bvpopcount(const SharedAbstractNode& expr);
+
         //! AST C++ API - bvrol node builder
         TRITON_EXPORT SharedAbstractNode bvrol(const SharedAbstractNode& expr, triton::uint32 rot);
 
@@ -194,9 +454,14 @@ namespace triton {
         //! AST C++ API - bvxor node builder
         TRITON_EXPORT SharedAbstractNode bvxor(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
 
+        //! AST C++ API - bvxor node builder
+        template <typename T> SharedAbstractNode bvxor(const T& exprs) {
+          return this->associative(BVXOR_NODE, std::vector<SharedAbstractNode>(exprs.begin(), exprs.end()));
+        }
+
         //! AST C++ API - compound node builder
         template <typename T> SharedAbstractNode compound(const T& exprs) {
-          SharedAbstractNode node = std::make_shared<CompoundNode>(exprs, this->shared_from_this());
+          SharedAbstractNode node = std::allocate_shared<CompoundNode>(this->allocator, exprs, this->shared_from_this());
           if (node == nullptr)
             throw triton::exceptions::Ast("Node builders - Not enough memory");
           node->init();
@@ -208,13 +473,13 @@ namespace triton {
 
         //! AST C++ API - concat node builder
         template <typename T> SharedAbstractNode concat(const T& exprs) {
-          SharedAbstractNode node = std::make_shared<ConcatNode>(exprs, this->shared_from_this());
+          SharedAbstractNode node = std::allocate_shared<ConcatNode>(this->allocator, exprs, this->shared_from_this());
           if (node == nullptr)
             throw triton::exceptions::Ast("Node builders - Not enough memory");
           node->init();
 
           if (this->modes->isModeEnabled(triton::modes::CONSTANT_FOLDING)) {
-            if (node->isSymbolized() == false) {
+            if (this->hasConstantValue(node)) {
               return this->bv(node->evaluate(), node->getBitvectorSize());
             }
           }
@@ -244,7 +509,7 @@ namespace triton {
 
         //! AST C++ API - forall node builder
         template <typename T> SharedAbstractNode forall(const T& vars, const SharedAbstractNode& body) {
-          SharedAbstractNode node = std::make_shared<ForallNode>(vars, body);
+          SharedAbstractNode node = std::allocate_shared<ForallNode>(this->allocator, vars, body, this->shared_from_this());
           if (node == nullptr)
             throw triton::exceptions::Ast("Node builders - Not enough memory");
           node->init();
@@ -260,12 +525,18 @@ namespace triton {
         //! AST C++ API - ite node builder
         TRITON_EXPORT SharedAbstractNode ite(const SharedAbstractNode& ifExpr, const SharedAbstractNode& thenExpr, const SharedAbstractNode& elseExpr);
 
+        //! AST C++ API - ite node builder of the predicated semantics, which returns the selected expression if `ifExpr` is not symbolized, whatever the modes.
+        TRITON_EXPORT SharedAbstractNode iteFold(const SharedAbstractNode& ifExpr, const SharedAbstractNode& thenExpr, const SharedAbstractNode& elseExpr);
+
         //! AST C++ API - land node builder
         TRITON_EXPORT SharedAbstractNode land(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
 
         //! AST C++ API - land node builder
         template <typename T> SharedAbstractNode land(const T& exprs) {
-          SharedAbstractNode node = std::make_shared<LandNode>(exprs, this->shared_from_this());
+          if (this->modes->isModeEnabled(triton::modes::AST_NARY))
+            return this->associative(LAND_NODE, std::vector<SharedAbstractNode>(exprs.begin(), exprs.end()));
+
+          SharedAbstractNode node = std::allocate_shared<LandNode>(this->allocator, exprs, this->shared_from_this());
           if (node == nullptr)
             throw triton::exceptions::Ast("Node builders - Not enough memory");
           node->init();
@@ -283,7 +554,10 @@ namespace triton {
 
         //! AST C++ API - lor node builder
         template <typename T> SharedAbstractNode lor(const T& exprs) {
-          SharedAbstractNode node = std::make_shared<LorNode>(exprs, this->shared_from_this());
+          if (this->modes->isModeEnabled(triton::modes::AST_NARY))
+            return this->associative(LOR_NODE, std::vector<SharedAbstractNode>(exprs.begin(), exprs.end()));
+
+          SharedAbstractNode node = std::allocate_shared<LorNode>(this->allocator, exprs, this->shared_from_this());
           if (node == nullptr)
             throw triton::exceptions::Ast("Node builders - Not enough memory");
           node->init();
@@ -295,16 +569,22 @@ namespace triton {
 
         //! AST C++ API - lxor node builder
         template <typename T> SharedAbstractNode lxor(const T& exprs) {
-          SharedAbstractNode node = std::make_shared<LxorNode>(exprs, this->shared_from_this());
+          SharedAbstractNode node = std::allocate_shared<LxorNode>(this->allocator, exprs, this->shared_from_this());
           if (node == nullptr)
             throw triton::exceptions::Ast("Node builders - Not enough memory");
           node->init();
           return this->collect(node);
         }
 
-        //! AST C++ API - reference node builder
+        //! AST C++ API - reference node builder. With AST_OPTIMIZATIONS, a reference, constant or variable AST of `expr` is returned as is.
         TRITON_EXPORT SharedAbstractNode reference(const triton::engines::symbolic::SharedSymbolicExpression& expr);
 
+        //! AST C++ API - select node builder
+        TRITON_EXPORT SharedAbstractNode select(const SharedAbstractNode& array, const SharedAbstractNode& index);
+
+        //! AST C++ API - store node builder
+        TRITON_EXPORT SharedAbstractNode store(const SharedAbstractNode& array, const SharedAbstractNode& index, const SharedAbstractNode& value);
+
         //! AST C++ API - string node builder
         TRITON_EXPORT SharedAbstractNode string(std::string value);
 
@@ -318,14 +598,47 @@ namespace triton {
         TRITON_EXPORT SharedAbstractNode zx(triton::uint32 sizeExt, const SharedAbstractNode& expr);
 
         //! Initializes a variable in the context
+        TRITON_EXPORT void initVariable(triton::usize id, const triton::uint512& value, const SharedAbstractNode& node);
+
+        //! Initializes a variable in the context from its name (see TRITON_SYMVAR_NAME).
         TRITON_EXPORT void initVariable(const std::string& name, const triton::uint512& value, const SharedAbstractNode& node);
 
-        //! Updates a variable value in this context
+        //! Updates a variable value in this context. Only nodes of its cone whose dependencies changed are re-evaluated.
+        TRITON_EXPORT void updateVariable(triton::usize id, const triton::uint512& value);
+
+        //! Updates a variable value in this context from its name (see TRITON_SYMVAR_NAME).
         TRITON_EXPORT void updateVariable(const std::string& name, const triton::uint512& value);
 
-        //! Gets a variable node from its name.
+        //! Updates several variable values in this context at once, e.g. a model. The union of their cones is sorted and re-evaluated in a single pass. No value is updated if a variable does not exist.
+        TRITON_EXPORT void updateVariables(const std::vector<std::pair<triton::usize, triton::uint512>>& values);
+
+        //! Records a structural change of the DAG (a new parent link). Invalidates cached cones.
+        TRITON_EXPORT void bumpStructureVersion(void);
+
+        //! Returns the structural version of the DAG.
+        TRITON_EXPORT triton::usize getStructureVersion(void) const;
+
+        //! Returns true while nodes are re-initialized because a variable value changed.
+        TRITON_EXPORT bool isReevaluating(void) const;
+
+        //! Records a change of the children of an existing node. Invalidates cached traversals of children.
+        TRITON_EXPORT void bumpChildrenVersion(void);
+
+        //! Gets a cached topological sort of `node` (children first). Returns false if there is no valid one.
+        TRITON_EXPORT bool getCachedTraversal(const AbstractNode* node, bool unroll, bool descend, std::vector<SharedAbstractNode>& nodes) const;
+
+        //! Caches a topological sort of `node` (children first) if the AST_TRAVERSAL_CACHE mode is enabled.
+        TRITON_EXPORT void setCachedTraversal(const AbstractNode* node, bool unroll, bool descend, const std::vector<SharedAbstractNode>& nodes);
+
+        //! Gets a variable node from its id, nullptr if the variable is not initialized.
+        SharedAbstractNode getVariableNode(triton::usize id);
+
+        //! Gets a variable node from its name, nullptr if the variable is not initialized.
         SharedAbstractNode getVariableNode(const std::string& name);
 
+        //! Gets a variable value from its id.
+        TRITON_EXPORT const triton::uint512& getVariableValue(triton::usize id) const;
+
         //! Gets a variable value from its name.
         TRITON_EXPORT const triton::uint512& getVariableValue(const std::string& name) const;
 
@@ -337,6 +650,15 @@ namespace triton {
 
         //! Prints the node according to the current representation mode.
         TRITON_EXPORT std::ostream& print(std::ostream& stream, AbstractNode* node);
+
+        //! Prints the node according to the current representation mode, each shared node being printed once.
+        TRITON_EXPORT std::ostream& printShared(std::ostream& stream, AbstractNode* node);
+
+        //! Prints the definitions of the shared nodes of `roots`. They are printed as their names until `clearBindings()`.
+        TRITON_EXPORT std::ostream& printBindings(std::ostream& stream, const std::vector<AbstractNode*>& roots);
+
+        //! Removes the bindings of `printBindings()`.
+        TRITON_EXPORT void clearBindings(void);
     };
 
     //! Shared AST context
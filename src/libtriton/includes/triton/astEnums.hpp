@@ -29,11 +29,17 @@ namespace triton {
     enum ast_e {
       INVALID_NODE = 0,               /*!< Invalid node */
       ANY_NODE = 0,                   /*!< Any node */
+      ARRAY_NODE = 293,               /*!< (Array (_ BitVec indexSize) (_ BitVec 8)) */
       ASSERT_NODE = 3,                /*!< (assert x) */
       BSWAP_NODE = 5,                 /*!< (bswap x) */
       BVADD_NODE = 7,                 /*!< (bvadd x y) */
       BVAND_NODE = 12,                /*!< (bvand x y) */
       BVASHR_NODE = 17,               /*!< (bvashr x y) */
+      BVLANEADD_NODE = 269,           /*!< ((_ bvlaneadd l) x y) */
+      BVLANEEQ_NODE = 271,            /*!< ((_ bvlaneeq l) x y) */
+      BVLANESELECT_NODE = 277,        /*!< ((_ bvlaneselect l) m x y) */
+      BVLANESGT_NODE = 281,           /*!< ((_ bvlanesgt l) x y) */
+      BVLANESUB_NODE = 283,           /*!< ((_ bvlanesub l) x y) */
       BVLSHR_NODE = 19,               /*!< (bvlshr x y) */
       BVMUL_NODE = 23,                /*!< (bvmul x y) */
       BVNAND_NODE = 29,               /*!< (bvnand x y) */
@@ -41,6 +47,8 @@ namespace triton {
       BVNOR_NODE = 37,                /*!< (bvnor x y) */
       BVNOT_NODE = 41,                /*!< (bvnot x) */
       BVOR_NODE = 43,                 /*!< (bvor x y) */
+      BVPARITY_NODE = 257,            /*!< (bvparity x) */
+      BVPOPCOUNT_NODE = 263,          /*!< (bvpopcount x) */
       BVROL_NODE = 47,                /*!< ((_ rotate_left x) y) */
       BVROR_NODE = 52,                /*!< ((_ rotate_right x) y) */
       BVSDIV_NODE = 59,               /*!< (bvsdiv x y) */
@@ -77,12 +85,20 @@ namespace triton {
       LOR_NODE = 223,                 /*!< (or x y) */
       LXOR_NODE = 227,                /*!< (xor x y) */
       REFERENCE_NODE = 229,           /*!< Reference node */
+      SELECT_NODE = 307,              /*!< (select array index) */
+      STORE_NODE = 311,               /*!< (store array index value) */
       STRING_NODE = 233,              /*!< String node */
       SX_NODE = 239,                  /*!< ((_ sign_extend x) y) */
       VARIABLE_NODE = 241,            /*!< Variable node */
       ZX_NODE = 251,                  /*!< ((_ zero_extend x) y) */
     };
 
+    //! The simplifiers whose results are cached (see `SimplificationCache`).
+    enum simplifier_e {
+      SIMPLIFIER_LLVM = (1 << 0),     /*!< Round-trip through the LLVM optimizer */
+      SIMPLIFIER_SOLVER = (1 << 1),   /*!< Simplification of the solver */
+    };
+
     //! The Representations namespace
     namespace representations {
     /*!
@@ -0,0 +1,157 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_AST_EVALUATOR_H
+#define TRITON_AST_EVALUATOR_H
+
+#include <utility>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/astEnums.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/symbolicVariable.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    //! \class AstEvaluator
+    /*! \brief Compiles an AST into a flat register-machine bytecode.
+     *
+     * \description
+     * The AST is compiled once in topological order. Sub-trees which are not symbolized are folded
+     * into constants and references are unrolled. The bytecode can then be evaluated for any values
+     * of the symbolic variables without updating the variables of the AST context nor touching the nodes.
+     */
+    class AstEvaluator {
+      private:
+        //! An instruction of the bytecode.
+        struct Instruction {
+          //! The operator.
+          triton::ast::ast_e type;
+
+          //! The size of the result.
+          triton::uint32 size;
+
+          //! The destination register.
+          triton::uint32 dst;
+
+          //! The index of the first operand in `operands`.
+          triton::uint32 first;
+
+          //! The number of operands.
+          triton::uint32 count;
+
+          //! Immediate operands (extraction bounds, extension size, rotation, input index, array index).
+          triton::uint32 imm1;
+          triton::uint32 imm2;
+
+          //! True if the result and all operands fit in 64 bits.
+          bool narrow;
+        };
+
+        //! The bytecode.
+        std::vector<Instruction> code;
+
+        //! The registers read by instructions.
+        std::vector<triton::uint32> operands;
+
+        //! The size of each register.
+        std::vector<triton::uint32> sizes;
+
+        //! The index of each register in its register file.
+        std::vector<triton::uint32> indexes;
+
+        //! The number of registers of at most 64 bits.
+        triton::uint32 narrowCount;
+
+        //! The number of registers of more than 64 bits.
+        triton::uint32 wideCount;
+
+        //! The cells of the arrays read by the selects.
+        std::vector<triton::ast::ArrayMemory> arrays;
+
+        //! The initial value of constant registers.
+        std::vector<std::pair<triton::uint32, triton::uint512>> constants;
+
+        //! The number of lanes the register files are laid out for.
+        triton::usize lanes;
+
+        //! Registers of at most 64 bits. Each register holds one value per lane.
+        std::vector<triton::uint64> narrowRegisters;
+
+        //! Registers of more than 64 bits. Each register holds one value per lane.
+        std::vector<triton::uint512> wideRegisters;
+
+        //! The inputs of the bytecode, sorted by id.
+        std::vector<triton::engines::symbolic::SharedSymbolicVariable> variables;
+
+        //! The register holding the result.
+        triton::uint32 root;
+
+        //! Allocates a register of `size` bits.
+        triton::uint32 allocate(triton::uint32 size);
+
+        //! Compiles the AST.
+        void compile(const SharedAbstractNode& node);
+
+        //! Reads a register on a lane.
+        triton::uint512 read(triton::uint32 reg, triton::usize lane) const;
+
+        //! Writes a register on a lane.
+        void write(triton::uint32 reg, triton::usize lane, const triton::uint512& value);
+
+        //! Executes an instruction on registers of at most 64 bits, for all lanes.
+        void executeNarrow(const Instruction& inst);
+
+        //! Executes an instruction on a lane.
+        void executeWide(const Instruction& inst, triton::usize lane);
+
+        //! Executes the bytecode on `lanes` input vectors.
+        void run(const std::vector<triton::uint512>* inputs, triton::usize lanes);
+
+      public:
+        //! Constructor. Compiles `node`.
+        TRITON_EXPORT AstEvaluator(const SharedAbstractNode& node);
+
+        //! Returns the symbolic variables of the AST. Values given to `evaluate()` follow this order.
+        TRITON_EXPORT const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& getVariables(void) const;
+
+        //! Returns the number of instructions of the bytecode.
+        TRITON_EXPORT triton::usize getNumberOfInstructions(void) const;
+
+        //! Returns the size of the result.
+        TRITON_EXPORT triton::uint32 getBitvectorSize(void) const;
+
+        //! Evaluates the bytecode. `values[i]` is the value of `getVariables()[i]`.
+        TRITON_EXPORT triton::uint512 evaluate(const std::vector<triton::uint512>& values);
+
+        //! Evaluates the bytecode on several input vectors at once. `outputs[i]` is the evaluation of `inputs[i]`.
+        TRITON_EXPORT std::vector<triton::uint512> evaluateBatch(const std::vector<std::vector<triton::uint512>>& inputs);
+    };
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_AST_EVALUATOR_H */
@@ -0,0 +1,90 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_AST_JIT_H
+#define TRITON_AST_JIT_H
+
+#include <memory>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/symbolicVariable.hpp>
+#include <triton/tritonTypes.hpp>
+
+#include <llvm/ExecutionEngine/Orc/LLJIT.h>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    //! \class AstJit
+    /*! \brief Compiles an AST into native code through LLVM ORC.
+     *
+     * \description
+     * The AST is lifted to LLVM IR (see `TritonToLLVM`) and wrapped into a loop which evaluates it on rows of
+     * input values, the whole module is optimized (-O2) and compiled once by an ORC JIT. The variables must be
+     * 8, 16, 32 or 64-bit long and the result at most 64-bit long. As `AstEvaluator`, the code can be evaluated
+     * for any values of the symbolic variables without updating the variables of the AST context nor touching
+     * the nodes. The compilation takes milliseconds, so the JIT is worth it when a node is evaluated many times.
+     */
+    class AstJit {
+      private:
+        //! The signature of the compiled code: `outputs[i]` is the evaluation of the row `inputs[i * variables]`.
+        using Function = void (*)(const triton::uint64* inputs, triton::uint64* outputs, triton::uint64 count);
+
+        //! The JIT, which owns the compiled code.
+        std::unique_ptr<llvm::orc::LLJIT> jit;
+
+        //! The compiled code.
+        Function function;
+
+        //! The inputs of the code, sorted by id.
+        std::vector<triton::engines::symbolic::SharedSymbolicVariable> variables;
+
+        //! The size of the result.
+        triton::uint32 size;
+
+      public:
+        //! Constructor. Compiles `node`.
+        TRITON_EXPORT AstJit(const SharedAbstractNode& node);
+
+        //! Returns the symbolic variables of the AST. Values given to `evaluate()` follow this order.
+        TRITON_EXPORT const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& getVariables(void) const;
+
+        //! Returns the size of the result.
+        TRITON_EXPORT triton::uint32 getBitvectorSize(void) const;
+
+        //! Evaluates the code. `values[i]` is the value of `getVariables()[i]`.
+        TRITON_EXPORT triton::uint64 evaluate(const std::vector<triton::uint64>& values) const;
+
+        //! Evaluates the code on several input vectors at once. `outputs[i]` is the evaluation of `inputs[i]`.
+        TRITON_EXPORT std::vector<triton::uint64> evaluateBatch(const std::vector<std::vector<triton::uint64>>& inputs) const;
+
+        //! Evaluates the code on `count` rows of `getVariables().size()` values laid out contiguously in `inputs`. The results are written into `outputs`.
+        TRITON_EXPORT void evaluateBatch(const triton::uint64* inputs, triton::uint64* outputs, triton::usize count) const;
+    };
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_AST_JIT_H */
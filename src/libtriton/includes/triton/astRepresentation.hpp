@@ -10,6 +10,8 @@
 
 #include <iostream>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 
 #include <triton/ast.hpp>
 #include <triton/astEnums.hpp>
@@ -17,6 +19,7 @@
 #include <triton/astRepresentationInterface.hpp>
 #include <triton/astSmtRepresentation.hpp>
 #include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
 
 
 
@@ -52,6 +55,21 @@ namespace triton {
           //! AstRepresentation interface.
           std::unique_ptr<triton::ast::representations::AstRepresentationInterface> representations[triton::ast::representations::LAST_REPRESENTATION];
 
+          //! Bound nodes and their names. A bound node is printed as its name.
+          std::unordered_map<AbstractNode*, triton::usize> bindings;
+
+          //! The name of the next bound node.
+          triton::usize nextBinding;
+
+          //! Binds the non-trivial nodes printed more than once from `roots`, and the deeply nested ones in Python, and returns them by level, a level only using names of lower levels.
+          std::vector<std::vector<AbstractNode*>> bind(const std::vector<AbstractNode*>& roots);
+
+          //! Prints the name of a bound node.
+          std::ostream& printName(std::ostream& stream, triton::usize name) const;
+
+          //! Removes the bindings of `groups`.
+          void clearBindings(const std::vector<std::vector<AbstractNode*>>& groups);
+
         public:
           //! Constructor.
           TRITON_EXPORT AstRepresentation();
@@ -70,6 +88,18 @@ namespace triton {
 
           //! Prints the node according to the current representation mode.
           TRITON_EXPORT std::ostream& print(std::ostream& stream, AbstractNode* node);
+
+          //! Prints the node with the representation printing on the calling thread, or with the one of its context if there is none.
+          TRITON_EXPORT static std::ostream& printOperand(std::ostream& stream, AbstractNode* node);
+
+          //! Prints the node so that each shared node is printed once, bound by a `let` (SMT) or an assignment expression (Python).
+          TRITON_EXPORT std::ostream& printShared(std::ostream& stream, AbstractNode* node);
+
+          //! Binds the shared nodes of `roots` and prints their definitions (`define-fun` in SMT). They are printed as their names until `clearBindings()`.
+          TRITON_EXPORT std::ostream& printBindings(std::ostream& stream, const std::vector<AbstractNode*>& roots);
+
+          //! Removes all bindings.
+          TRITON_EXPORT void clearBindings(void);
       };
 
     /*! @} End of representations namespace */
@@ -0,0 +1,254 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_AST_REWRITER_H
+#define TRITON_AST_REWRITER_H
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/astEnums.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    //! \class AstRewriter
+    /*! \brief Simplifies ASTs by equality saturation.
+     *
+     * \description
+     * The AST is loaded into an e-graph where each class holds equivalent nodes. Rewrite rules are
+     * applied to all classes until saturation or until a budget is exhausted, and the smallest
+     * equivalent AST is then extracted. Rules are s-expressions where `?x` is a pattern variable and
+     * integers are constants of the size of the node they match, e.g. `(bvadd (bvxor ?x ?y) (bvmul 2 (bvand ?x ?y)))`
+     * rewrites to `(bvadd ?x ?y)`. Classes of constants are folded.
+     */
+    class AstRewriter {
+      private:
+        //! Kinds of pattern terms.
+        enum pattern_e {
+          PATTERN_CONSTANT,
+          PATTERN_OPERATOR,
+          PATTERN_VARIABLE,
+        };
+
+        //! A term of a rewrite rule.
+        struct Pattern {
+          //! The kind of the term.
+          pattern_e kind;
+
+          //! The operator if the term is an operator.
+          triton::ast::ast_e type;
+
+          //! The index of the variable if the term is a variable.
+          triton::uint32 variable;
+
+          //! The value if the term is a constant.
+          triton::sint64 constant;
+
+          //! The operands if the term is an operator.
+          std::vector<Pattern> children;
+        };
+
+        //! A rewrite rule.
+        struct Rule {
+          //! The name of the rule.
+          std::string name;
+
+          //! The pattern to match.
+          Pattern lhs;
+
+          //! The pattern to build.
+          Pattern rhs;
+
+          //! The number of variables.
+          triton::uint32 variables;
+        };
+
+        //! A node of the e-graph. Its operands are classes.
+        struct ENode {
+          //! The operator.
+          triton::ast::ast_e type;
+
+          //! The size of the node.
+          triton::uint32 size;
+
+          //! Immediate operands (extraction bounds, extension size, rotation).
+          triton::uint32 imm1;
+          triton::uint32 imm2;
+
+          //! The index in `leaves` plus one if the node is a constant or an opaque node, 0 otherwise.
+          triton::uint32 leaf;
+
+          //! The classes of operands.
+          std::vector<triton::uint32> children;
+
+          //! Returns true if both nodes have the same operator, payload and operands.
+          bool operator==(const ENode& other) const;
+        };
+
+        //! Hashes nodes of the e-graph.
+        struct ENodeHash {
+          std::size_t operator()(const ENode& node) const;
+        };
+
+        //! A class of equivalent nodes.
+        struct EClass {
+          //! The nodes of the class.
+          std::vector<triton::uint32> nodes;
+
+          //! The size of the nodes.
+          triton::uint32 size;
+
+          //! True if nodes are logical.
+          bool logical;
+
+          //! True if the class holds a constant.
+          bool constant;
+
+          //! The value of the constant.
+          triton::uint512 value;
+        };
+
+        //! The AST context used to build nodes.
+        SharedAstContext ctxt;
+
+        //! The rewrite rules.
+        std::vector<Rule> rules;
+
+        //! The number of nodes saturation may add to the e-graph.
+        triton::usize nodeBudget;
+
+        //! The maximum number of saturation iterations.
+        triton::usize iterationLimit;
+
+        //! The maximum number of matches of a rule per iteration.
+        triton::usize matchLimit;
+
+        //! The number of iterations of the last saturation.
+        triton::usize iterations;
+
+        //! The nodes of the e-graph.
+        std::vector<ENode> enodes;
+
+        //! The class each node was created in.
+        std::vector<triton::uint32> owners;
+
+        //! The classes of the e-graph.
+        std::vector<EClass> classes;
+
+        //! Union-find of classes.
+        std::vector<triton::uint32> leaders;
+
+        //! Hash-consing of nodes.
+        std::unordered_map<ENode, triton::uint32, ENodeHash> memo;
+
+        //! Constants and opaque nodes of the e-graph.
+        std::vector<SharedAbstractNode> leaves;
+
+        //! Maps a size and a value to its constant in `leaves`.
+        std::map<std::pair<triton::uint32, triton::uint512>, triton::uint32> constantLeaves;
+
+        //! Maps an opaque node to its index in `leaves`.
+        std::unordered_map<AbstractNode*, triton::uint32> opaqueLeaves;
+
+        //! Parses a pattern. `variables` maps names of variables to their index.
+        Pattern parse(const std::vector<std::string>& tokens, triton::usize& index, std::map<std::string, triton::uint32>& variables, bool lhs) const;
+
+        //! Clears the e-graph.
+        void clear(void);
+
+        //! Returns the leader of a class.
+        triton::uint32 find(triton::uint32 cls);
+
+        //! Adds a node and returns its class.
+        triton::uint32 add(ENode node);
+
+        //! Adds a constant and returns its class.
+        triton::uint32 addConstant(const triton::uint512& value, triton::uint32 size);
+
+        //! Adds an opaque node and returns its class.
+        triton::uint32 addLeaf(const SharedAbstractNode& node);
+
+        //! Merges two classes. Returns false if they were already equivalent.
+        bool merge(triton::uint32 cls1, triton::uint32 cls2);
+
+        //! Folds a node whose operands are constants into its class. Returns true if classes were merged.
+        bool fold(triton::uint32 cls, const ENode& node);
+
+        //! Restores the invariants of the e-graph after merges.
+        void rebuild(void);
+
+        //! Loads an AST and returns its class.
+        triton::uint32 load(const SharedAbstractNode& node);
+
+        //! Matches goals (a pattern on a class) by backtracking and appends complete substitutions to `substitutions`.
+        void match(std::vector<std::pair<const Pattern*, triton::uint32>>& goals, std::vector<triton::uint32>& substitution, std::vector<std::vector<triton::uint32>>& substitutions);
+
+        //! Adds the nodes of `pattern` for a substitution and returns its class.
+        triton::uint32 instantiate(const Pattern& pattern, const std::vector<triton::uint32>& substitution, triton::uint32 size);
+
+        //! Applies all rules until saturation or until a budget is exhausted.
+        void saturate(void);
+
+        //! Builds the AST of a node from the ASTs of its operands.
+        SharedAbstractNode build(const ENode& node, const std::vector<SharedAbstractNode>& children) const;
+
+        //! Extracts the smallest AST of a class.
+        SharedAbstractNode extract(triton::uint32 cls);
+
+      public:
+        //! Constructor. Loads the default rules.
+        TRITON_EXPORT AstRewriter(const SharedAstContext& ctxt);
+
+        //! Adds a rewrite rule. `lhs` and `rhs` are s-expressions over bitvector operators of the same size.
+        TRITON_EXPORT void addRule(const std::string& name, const std::string& lhs, const std::string& rhs);
+
+        //! Returns the number of rewrite rules.
+        TRITON_EXPORT triton::usize getNumberOfRules(void) const;
+
+        //! Sets the number of nodes saturation may add to the e-graph.
+        TRITON_EXPORT void setNodeBudget(triton::usize budget);
+
+        //! Sets the maximum number of saturation iterations.
+        TRITON_EXPORT void setIterationLimit(triton::usize limit);
+
+        //! Returns the number of nodes of the e-graph of the last simplification.
+        TRITON_EXPORT triton::usize getNumberOfNodes(void) const;
+
+        //! Returns the number of iterations of the last simplification.
+        TRITON_EXPORT triton::usize getNumberOfIterations(void) const;
+
+        //! Returns the smallest AST equivalent to `node` found by equality saturation. References are unrolled.
+        TRITON_EXPORT SharedAbstractNode simplify(const SharedAbstractNode& node);
+    };
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_AST_REWRITER_H */
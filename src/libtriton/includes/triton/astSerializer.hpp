@@ -0,0 +1,91 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_AST_SERIALIZER_H
+#define TRITON_AST_SERIALIZER_H
+
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/symbolicExpression.hpp>
+#include <triton/symbolicVariable.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    //! \class AstSerializer
+    /*! \brief Serializes AST DAGs and the symbolic state they depend on into a binary format.
+     *
+     * \description
+     * Nodes are written once in topological order, so that sharing is kept. The format is
+     * little-endian and made of fixed-size records addressed by offsets: a header, a node table
+     * whose children are indexes in a child table, a constant table, a string table, a variable
+     * table, an expression table (for references), a root table and a blob holding the bytes of
+     * constants and strings. A buffer (e.g. a mapped file) is read in place, without parsing.
+     *
+     * Loaded variables are matched by name with the variables of the target AST context.
+     * Loaded expressions are not registered in any symbolic engine.
+     */
+    class AstSerializer {
+      private:
+        //! The AST context used to build nodes.
+        SharedAstContext ctxt;
+
+        //! The variables of the last deserialization.
+        std::vector<triton::engines::symbolic::SharedSymbolicVariable> variables;
+
+        //! The expressions of the last deserialization.
+        std::vector<triton::engines::symbolic::SharedSymbolicExpression> expressions;
+
+      public:
+        //! The version of the format.
+        static const triton::uint32 version = 1;
+
+        //! Constructor.
+        TRITON_EXPORT AstSerializer(const SharedAstContext& ctxt);
+
+        //! Writes the DAG of `roots` and of `exprs`, with the expressions and variables they depend on, into `stream`.
+        TRITON_EXPORT void serialize(std::ostream& stream, const std::vector<SharedAbstractNode>& roots, const std::vector<triton::engines::symbolic::SharedSymbolicExpression>& exprs={}) const;
+
+        //! Loads a serialized DAG from `size` bytes at `data` and returns its roots.
+        TRITON_EXPORT std::vector<SharedAbstractNode> deserialize(const void* data, triton::usize size);
+
+        //! Loads a serialized DAG from `stream` and returns its roots.
+        TRITON_EXPORT std::vector<SharedAbstractNode> deserialize(std::istream& stream);
+
+        //! Returns the variables of the last deserialization, in the order of the variable table.
+        TRITON_EXPORT const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& getVariables(void) const;
+
+        //! Returns the expressions of the last deserialization, in the order of the expression table.
+        TRITON_EXPORT const std::vector<triton::engines::symbolic::SharedSymbolicExpression>& getExpressions(void) const;
+    };
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_AST_SERIALIZER_H */
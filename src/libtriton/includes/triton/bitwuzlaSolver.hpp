@@ -8,6 +8,7 @@
 #ifndef TRITON_BITWUZLASOLVER_H
 #define TRITON_BITWUZLASOLVER_H
 
+#include <atomic>
 #include <chrono>
 #include <string>
 #include <unordered_map>
@@ -55,7 +56,7 @@ namespace triton {
 
           /*! Struct used to provide information for Bitwuzla termination callback */
           struct SolverParams {
-            SolverParams(int64_t timeout, size_t memory_limit): timeout(timeout), memory_limit(memory_limit) {
+            SolverParams(int64_t timeout, size_t memory_limit, const std::atomic<bool>* interrupted): timeout(timeout), memory_limit(memory_limit), interrupted(interrupted) {
             }
 
             std::chrono::time_point<std::chrono::system_clock> start = std::chrono::system_clock::now();    /*!< Solver starting time. */
@@ -63,6 +64,7 @@ namespace triton {
             int64_t timeout;                                                                                /*!< Timeout (ms) for solver instance running. */
             size_t  memory_limit;                                                                           /*!< Memory limit for the whole symbolic process. */
             int64_t last_mem_check = -1;                                                                    /*!< Time when the last memory usage check was performed. */
+            const std::atomic<bool>* interrupted;                                                           /*!< True once the solver is interrupted. */
           };
 
           //! The SMT solver timeout. By default, unlimited. This global timeout may be changed for a specific query (isSat/getModel/getModels) via argument `timeout`.
@@ -71,6 +73,9 @@ namespace triton {
           //! The SMT solver memory limit. By default, unlimited.
           triton::uint32 memoryLimit;
 
+          //! True once the solver is interrupted.
+          std::atomic<bool> interrupted;
+
         public:
           //! Constructor.
           TRITON_EXPORT BitwuzlaSolver();
@@ -93,9 +98,22 @@ namespace triton {
            */
           TRITON_EXPORT std::vector<std::unordered_map<triton::usize, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
 
+          /*!
+           * \brief Computes at most `limit` models from a symbolic constraint and gives them to `callback` as they are found. Returns the number of models given.
+           *
+           * \details
+           * The models are enumerated by one solver, each model found blocks its values for the next check. If `variables` is not
+           * empty, only these variables are reported and blocked. State is returned in the `status` pointer as well as the solving time.
+           * A `timeout` can also be defined.
+           */
+          TRITON_EXPORT triton::usize enumerateModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, const ModelCallback& callback, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& variables = {}, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
           //! Returns true if an expression is satisfiable.
           TRITON_EXPORT bool isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
 
+          //! Returns an UNSAT core of `conjuncts`, the ones assumed in the unsat assumptions of the solver, or an empty vector if their conjunction is not UNSAT.
+          TRITON_EXPORT std::vector<triton::ast::SharedAbstractNode> getUnsatCore(const std::vector<triton::ast::SharedAbstractNode>& conjuncts, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
           //! Evaluates a Triton's AST via Bitwuzla and returns a concrete value.
           TRITON_EXPORT triton::uint512 evaluate(const triton::ast::SharedAbstractNode& node) const;
 
@@ -108,6 +126,9 @@ namespace triton {
           //! Defines a solver memory consumption limit (in megabytes).
           TRITON_EXPORT void setMemoryLimit(triton::uint32 mem);
 
+          //! Interrupts the running queries, from any thread. They and the next ones return UNKNOWN.
+          TRITON_EXPORT void interrupt(void);
+
           //! Callback function that implements termination of Bitwuzla solver on timeout and memory limit.
           static int32_t terminateCallback(void* state);
 
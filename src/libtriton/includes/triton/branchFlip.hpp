@@ -0,0 +1,111 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_BRANCHFLIP_HPP
+#define TRITON_BRANCHFLIP_HPP
+
+#include <set>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      /*! \struct BranchFlipOptions
+       *  \brief The options of the solving of the branches not taken by a trace (see `SolverEngine::solveBranchFlips()`). */
+      struct BranchFlipOptions {
+        //! True if the queries are solved on the threads of the solver (see `SolverEngine::setThreads()`).
+        bool parallel = false;
+
+        //! True if a branch is skipped when its source and destination were taken by the trace or already flipped.
+        bool skipCovered = true;
+
+        //! The branches (source, destination) covered before the trace, skipped as well if `skipCovered` is true.
+        std::set<std::pair<triton::uint64, triton::uint64>> covered;
+
+        //! The index of the first path constraint whose branches are flipped, the ones before it are only taken.
+        triton::usize start = 0;
+
+        //! The max number of branches flipped, 0 for all of them.
+        triton::usize limit = 0;
+
+        //! The timeout of each query (in milliseconds), 0 for the solver's one.
+        triton::uint32 timeout = 0;
+
+        //! True if the UNSAT core of each UNSAT flip is computed, the next flips whose predicates contain a core being UNSAT without the solver.
+        bool unsatCores = false;
+
+        //! The UNSAT cores known before the trace, as the hashes of their predicates (see `AbstractNode::getHash()`), used if `unsatCores` is true.
+        std::vector<std::vector<triton::uint128>> cores;
+      };
+
+
+      /*! \struct BranchFlip
+       *  \brief A branch not taken by a trace and the answer to the query taking it. */
+      struct BranchFlip {
+        //! The index of the path constraint holding the branch.
+        triton::usize index = 0;
+
+        //! The address of the branch instruction.
+        triton::uint64 srcAddr = 0;
+
+        //! The destination of the branch.
+        triton::uint64 dstAddr = 0;
+
+        //! The predicate of the branch.
+        triton::ast::SharedAbstractNode predicate;
+
+        //! The status of the query.
+        triton::engines::solver::status_e status = triton::engines::solver::UNKNOWN;
+
+        //! True if the query is UNSAT because it contains the UNSAT core of a previous flip, the solver is not queried.
+        bool pruned = false;
+
+        //! The solving time (in milliseconds).
+        triton::uint32 solvingTime = 0;
+
+        //! The model of the query, the inputs taking the branch. Empty if it is not SAT.
+        std::unordered_map<triton::usize, SolverModel> model;
+
+        //! The UNSAT core of the query if `BranchFlipOptions::unsatCores` is true, a subset of its predicates. Empty if it is not UNSAT or if it is pruned.
+        std::vector<triton::ast::SharedAbstractNode> core;
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_BRANCHFLIP_HPP */
@@ -9,7 +9,8 @@
 #define TRITON_CALLBACKS_H
 
 #include <atomic>
-#include <list>
+#include <utility>
+#include <vector>
 
 #include <triton/ast.hpp>
 #include <triton/callbacksEnums.hpp>
@@ -38,6 +39,16 @@ namespace triton {
    *  @{
    */
 
+    /*! \brief The prototype of a GET_CONCRETE_MEMORY_AREA_VALUE or GET_UNDEFINED_MEMORY_PAGE callback.
+     *
+     * \details The callback takes an API context as first argument, a base address as second argument and a size at third.
+     * GET_CONCRETE_MEMORY_AREA_VALUE callbacks will be called once each time that the Triton library will need to LOAD
+     * a concrete memory area. GET_UNDEFINED_MEMORY_PAGE callbacks will be called with the address and the size of each
+     * page of a LOAD whose bytes are all undefined, before it is read. They may define the page, e.g. by fetching it
+     * from a debugger, it is then not reported again.
+     */
+    using getConcreteMemoryAreaValueCallback = ComparableFunctor<void(triton::API&, triton::uint64 baseAddr, triton::usize size)>;
+
     /*! \brief The prototype of a GET_CONCRETE_MEMORY_VALUE callback.
      *
      * \details The callback takes an API context as first argument and a memory access as second argument.
@@ -52,6 +63,13 @@ namespace triton {
      */
     using getConcreteRegisterValueCallback = ComparableFunctor<void(triton::API&, const triton::arch::Register&)>;
 
+    /*! \brief The prototype of a SET_CONCRETE_MEMORY_AREA_VALUE callback.
+     *
+     * \details The callback takes an API context as first argument, a base address as second argument and the values at third.
+     * Callbacks will be called once each time that the Triton library will need to STORE a concrete memory area.
+     */
+    using setConcreteMemoryAreaValueCallback = ComparableFunctor<void(triton::API&, triton::uint64 baseAddr, const std::vector<triton::uint8>& values)>;
+
     /*! \brief The prototype of a SET_CONCRETE_MEMORY_VALUE callback.
      *
      * \details The callback takes an API context as first argument, a memory access as second argument and the value at third.
@@ -74,6 +92,13 @@ namespace triton {
      */
     using symbolicSimplificationCallback = ComparableFunctor<triton::ast::SharedAbstractNode(triton::API&, const triton::ast::SharedAbstractNode&)>;
 
+    /*! \brief The address ranges of a GET_CONCRETE_MEMORY_VALUE or SET_CONCRETE_MEMORY_VALUE callback.
+     *
+     * \details Each range is a pair of [start, end) addresses. The callback is only called for the accesses
+     * overlapping one of the ranges, all accesses if there is no range.
+     */
+    using memoryRanges = std::vector<std::pair<triton::uint64, triton::uint64>>;
+
     //! \class Callbacks
     /*! \brief The callbacks class */
     class Callbacks {
@@ -84,6 +109,9 @@ namespace triton {
         //! Mutex for the getConcreteRegisterValue callback
         std::atomic<bool> mget;
 
+        //! Mutex for the getConcreteMemoryAreaValue callback
+        std::atomic<bool> mloadarea;
+
         //! Mutex for the getConcreteMemoryValue callback
         std::atomic<bool> mload;
 
@@ -93,44 +121,86 @@ namespace triton {
         //! Mutex for the setConcreteMemoryValue callback
         std::atomic<bool> mstore;
 
-        //! True if there is at least one callback defined.
-        std::atomic<bool> defined;
+        //! Mutex for the setConcreteMemoryAreaValue callback
+        std::atomic<bool> mstorearea;
+
+        //! Mutex for the getUndefinedMemoryPage callback
+        std::atomic<bool> mpage;
+
+        //! The kinds with at least one callback defined, one bit per kind.
+        std::atomic<triton::uint32> kinds;
+
+        //! The version of the SYMBOLIC_SIMPLIFICATION callbacks, bumped on each change.
+        triton::usize simplificationVersion;
 
       protected:
+        //! [c++] Callbacks for all concrete memory area needs (LOAD).
+        std::vector<triton::callbacks::getConcreteMemoryAreaValueCallback> getConcreteMemoryAreaValueCallbacks;
+
         //! [c++] Callbacks for all concrete memory needs (LOAD).
-        std::list<triton::callbacks::getConcreteMemoryValueCallback> getConcreteMemoryValueCallbacks;
+        std::vector<triton::callbacks::getConcreteMemoryValueCallback> getConcreteMemoryValueCallbacks;
 
         //! [c++] Callbacks for all concrete register needs (GET).
-        std::list<triton::callbacks::getConcreteRegisterValueCallback> getConcreteRegisterValueCallbacks;
+        std::vector<triton::callbacks::getConcreteRegisterValueCallback> getConcreteRegisterValueCallbacks;
+
+        //! [c++] Callbacks for all undefined memory pages (LOAD).
+        std::vector<triton::callbacks::getConcreteMemoryAreaValueCallback> getUndefinedMemoryPageCallbacks;
+
+        //! [c++] Callbacks for all concrete memory area needs (STORE).
+        std::vector<triton::callbacks::setConcreteMemoryAreaValueCallback> setConcreteMemoryAreaValueCallbacks;
 
         //! [c++] Callbacks for all concrete memory needs (STORE).
-        std::list<triton::callbacks::setConcreteMemoryValueCallback> setConcreteMemoryValueCallbacks;
+        std::vector<triton::callbacks::setConcreteMemoryValueCallback> setConcreteMemoryValueCallbacks;
 
         //! [c++] Callbacks for all concrete register needs (PUT).
-        std::list<triton::callbacks::setConcreteRegisterValueCallback> setConcreteRegisterValueCallbacks;
+        std::vector<triton::callbacks::setConcreteRegisterValueCallback> setConcreteRegisterValueCallbacks;
 
         //! [c++] Callbacks for all symbolic simplifications.
-        std::list<triton::callbacks::symbolicSimplificationCallback> symbolicSimplificationCallbacks;
+        std::vector<triton::callbacks::symbolicSimplificationCallback> symbolicSimplificationCallbacks;
+
+        //! The ranges of the GET_CONCRETE_MEMORY_VALUE callbacks, by index (sorted and merged).
+        std::vector<triton::callbacks::memoryRanges> getConcreteMemoryValueRanges;
+
+        //! The ranges of the SET_CONCRETE_MEMORY_VALUE callbacks, by index (sorted and merged).
+        std::vector<triton::callbacks::memoryRanges> setConcreteMemoryValueRanges;
+
+        //! Trys to find and remove the callback of `kind`, raises an exception if not able. Returns the index of the callback removed.
+        template <typename T> triton::usize removeSingleCallback(triton::callbacks::callback_e kind, std::vector<T>& container, T cb);
 
-        //! Returns the number of callbacks recorded.
-        triton::usize countCallbacks(void) const;
+        //! Returns the ranges sorted and merged, raises an exception if one is empty.
+        static triton::callbacks::memoryRanges normalizeRanges(const triton::callbacks::memoryRanges& ranges);
 
-        //! Trys to find and remove the callback, raises an exception if not able
-        template <typename T> void removeSingleCallback(std::list<T>& container, T cb);
+        //! Returns true if [addr, addr+size) overlaps one of the normalized `ranges`, or if there is no range.
+        static bool overlaps(const triton::callbacks::memoryRanges& ranges, triton::uint64 addr, triton::uint32 size);
+
+        //! Calls the GET_UNDEFINED_MEMORY_PAGE callbacks on each page of [baseAddr, baseAddr+size) without any defined byte.
+        void processUndefinedPages(triton::uint64 baseAddr, triton::usize size);
 
       public:
         //! Constructor.
         TRITON_EXPORT Callbacks(triton::API& api);
 
+        //! Adds a GET_CONCRETE_MEMORY_AREA_VALUE or GET_UNDEFINED_MEMORY_PAGE callback.
+        TRITON_EXPORT void addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, triton::uint64 baseAddr, triton::usize size)> cb);
+
         //! Adds a GET_CONCRETE_MEMORY_VALUE callback.
         TRITON_EXPORT void addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&)> cb);
 
+        //! Adds a GET_CONCRETE_MEMORY_VALUE callback only called for the accesses overlapping `ranges`.
+        TRITON_EXPORT void addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&)> cb, const triton::callbacks::memoryRanges& ranges);
+
         //! Adds a GET_CONCRETE_REGISTER_VALUE callback.
         TRITON_EXPORT void addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::Register&)> cb);
 
+        //! Adds a SET_CONCRETE_MEMORY_AREA_VALUE callback.
+        TRITON_EXPORT void addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, triton::uint64 baseAddr, const std::vector<triton::uint8>& values)> cb);
+
         //! Adds a SET_CONCRETE_MEMORY_VALUE callback.
         TRITON_EXPORT void addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&, const triton::uint512& value)> cb);
 
+        //! Adds a SET_CONCRETE_MEMORY_VALUE callback only called for the accesses overlapping `ranges`.
+        TRITON_EXPORT void addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&, const triton::uint512& value)> cb, const triton::callbacks::memoryRanges& ranges);
+
         //! Adds a SET_CONCRETE_REGISTER_VALUE callback.
         TRITON_EXPORT void addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::Register&, const triton::uint512& value)> cb);
 
@@ -140,12 +210,18 @@ namespace triton {
         //! Clears recorded callbacks.
         TRITON_EXPORT void clearCallbacks(void);
 
+        //! Deletes a GET_CONCRETE_MEMORY_AREA_VALUE or GET_UNDEFINED_MEMORY_PAGE callback.
+        TRITON_EXPORT void removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, triton::uint64 baseAddr, triton::usize size)> cb);
+
         //! Deletes a GET_CONCRETE_MEMORY_VALUE callback.
         TRITON_EXPORT void removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&)> cb);
 
         //! Deletes a GET_CONCRETE_REGISTER_VALUE callback.
         TRITON_EXPORT void removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::Register&)> cb);
 
+        //! Deletes a SET_CONCRETE_MEMORY_AREA_VALUE callback.
+        TRITON_EXPORT void removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, triton::uint64 baseAddr, const std::vector<triton::uint8>& values)> cb);
+
         //! Deletes a SET_CONCRETE_MEMORY_VALUE callback.
         TRITON_EXPORT void removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&, const triton::uint512& value)> cb);
 
@@ -167,14 +243,34 @@ namespace triton {
         //! Processes callbacks according to the kind and the C++ polymorphism.
         TRITON_EXPORT void processCallbacks(triton::callbacks::callback_e kind, const triton::arch::Register& reg);
 
+        //! Processes callbacks according to the kind and the C++ polymorphism.
+        TRITON_EXPORT void processCallbacks(triton::callbacks::callback_e kind, triton::uint64 baseAddr, triton::usize size);
+
+        //! Processes callbacks according to the kind and the C++ polymorphism.
+        TRITON_EXPORT void processCallbacks(triton::callbacks::callback_e kind, triton::uint64 baseAddr, const triton::uint8* area, triton::usize size);
+
         //! Processes callbacks according to the kind and the C++ polymorphism.
         TRITON_EXPORT void processCallbacks(triton::callbacks::callback_e kind, const triton::arch::Register& reg, const triton::uint512& value);
 
-        //! Returns true if the callback is defined.
-        TRITON_EXPORT bool isDefined(triton::callbacks::callback_e kind) const;
+        //! Returns true if the callback is defined. Inlined, as the CPUs check it on each access.
+        TRITON_EXPORT bool isDefined(triton::callbacks::callback_e kind) const {
+          return (this->kinds.load(std::memory_order_relaxed) >> kind) & 1;
+        }
 
         //! Returns true if at least one callback is defined.
-        TRITON_EXPORT bool isDefined(void) const;
+        TRITON_EXPORT bool isDefined(void) const {
+          return this->kinds.load(std::memory_order_relaxed) != 0;
+        }
+
+        //! Returns the version of the SYMBOLIC_SIMPLIFICATION callbacks, which changes each time one is added or removed.
+        TRITON_EXPORT triton::usize getSimplificationVersion(void) const {
+          return this->simplificationVersion;
+        }
+
+        //! Returns true if a LOAD of a concrete memory value has callbacks to process (GET_CONCRETE_MEMORY_VALUE or GET_UNDEFINED_MEMORY_PAGE).
+        TRITON_EXPORT bool isLoadDefined(void) const {
+          return (this->kinds.load(std::memory_order_relaxed) & ((1 << GET_CONCRETE_MEMORY_VALUE) | (1 << GET_UNDEFINED_MEMORY_PAGE))) != 0;
+        }
     };
 
   /*! @} End of callbacks namespace */
@@ -27,11 +27,14 @@ namespace triton {
 
     /*! Enumerates all kinds callbacks. */
     enum callback_e {
-      GET_CONCRETE_MEMORY_VALUE,    /*!< LOAD concrete memory value callback */
-      GET_CONCRETE_REGISTER_VALUE,  /*!< GET concrete register value callback */
-      SET_CONCRETE_MEMORY_VALUE,    /*!< STORE concrete memory value callback */
-      SET_CONCRETE_REGISTER_VALUE,  /*!< PUT concrete register value callback */
-      SYMBOLIC_SIMPLIFICATION,      /*!< Symbolic simplification callback */
+      GET_CONCRETE_MEMORY_AREA_VALUE, /*!< LOAD concrete memory area callback */
+      GET_CONCRETE_MEMORY_VALUE,      /*!< LOAD concrete memory value callback */
+      GET_CONCRETE_REGISTER_VALUE,    /*!< GET concrete register value callback */
+      GET_UNDEFINED_MEMORY_PAGE,      /*!< LOAD of an undefined memory page callback */
+      SET_CONCRETE_MEMORY_AREA_VALUE, /*!< STORE concrete memory area callback */
+      SET_CONCRETE_MEMORY_VALUE,      /*!< STORE concrete memory value callback */
+      SET_CONCRETE_REGISTER_VALUE,    /*!< PUT concrete register value callback */
+      SYMBOLIC_SIMPLIFICATION,        /*!< Symbolic simplification callback */
     };
 
   /*! @} End of callbacks namespace */
@@ -0,0 +1,110 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_CAPSTONEPOOL_HPP
+#define TRITON_CAPSTONEPOOL_HPP
+
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <triton/dllexport.hpp>
+#include <triton/externalLibs.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    /*! \class CapstonePool
+     *  \brief The Capstone handles of a CPU, each with its instruction buffer.
+     *
+     * \description
+     * A handle and its buffer are leased for one decoding and then given back, so that the
+     * buffer allocated with `cs_malloc` is reused by `cs_disasm_iter` instead of being
+     * allocated and freed by each `cs_disasm`. A handle is only used by one thread at a time,
+     * a new one is opened when all of them are leased: threads decode in parallel. The pools are
+     * shared by the CPUs of the process with the same configuration (see `get()`).
+     */
+    class CapstonePool {
+      private:
+        //! The architecture of the handles.
+        triton::extlibs::capstone::cs_arch arch;
+
+        //! The mode of the handles.
+        triton::extlibs::capstone::cs_mode mode;
+
+        //! The syntax of the handles, the default one if 0.
+        triton::usize syntax;
+
+        //! The handles not leased, with their buffer.
+        std::vector<std::pair<triton::extlibs::capstone::csh, triton::extlibs::capstone::cs_insn*>> idle;
+
+        //! Protects `idle`.
+        std::mutex lock;
+
+        //! Opens a handle with the details on, and allocates its buffer.
+        std::pair<triton::extlibs::capstone::csh, triton::extlibs::capstone::cs_insn*> open(void) const;
+
+      public:
+        /*! \class Lease
+         *  \brief A handle and its buffer, given back to the pool on destruction. */
+        class Lease {
+          private:
+            //! The pool of the handle.
+            CapstonePool& pool;
+
+          public:
+            //! The handle.
+            triton::extlibs::capstone::csh handle;
+
+            //! The instruction buffer of the handle.
+            triton::extlibs::capstone::cs_insn* insn;
+
+            //! Leases a handle of `pool`.
+            TRITON_EXPORT Lease(CapstonePool& pool);
+
+            //! Gives the handle back.
+            TRITON_EXPORT ~Lease();
+
+            Lease(const Lease&) = delete;
+            Lease& operator=(const Lease&) = delete;
+        };
+
+        //! Constructor. Opens a first handle, to fail early if Capstone cannot be opened.
+        TRITON_EXPORT CapstonePool(triton::extlibs::capstone::cs_arch arch, triton::extlibs::capstone::cs_mode mode, triton::usize syntax=0);
+
+        //! Destructor. Closes the handles, none must be leased.
+        TRITON_EXPORT ~CapstonePool();
+
+        //! Returns the pool of the process with this configuration, opened on first use and closed once no CPU uses it.
+        TRITON_EXPORT static std::shared_ptr<CapstonePool> get(triton::extlibs::capstone::cs_arch arch, triton::extlibs::capstone::cs_mode mode, triton::usize syntax=0);
+
+        CapstonePool(const CapstonePool&) = delete;
+        CapstonePool& operator=(const CapstonePool&) = delete;
+    };
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_CAPSTONEPOOL_HPP */
@@ -20,55 +20,68 @@ namespace triton {
  *  @{
  */
 
+  //! The wrapper of a callback of `Signature`.
+  template <class Signature>
+  struct ComparableFunctor;
+
   /*!
    * \class ComparableFunctor
    * \details This Helper class is a wrapper around a std::function adding a comparison operator
-   * to make it searchable in a list even with lambda function.
+   * to make it searchable in a list even with lambda function. It may also wrap a plain function
+   * receiving a user pointer as first argument, which is called directly, without std::function.
    */
-  template <class Signature>
-  struct ComparableFunctor {
+  template <class R, class... Args>
+  struct ComparableFunctor<R(Args...)> {
     private:
       //! The functor use when called
-      std::function<Signature> F_;
+      std::function<R(Args...)> F_;
+
+      //! The plain function called instead of the functor, if not null
+      R (*raw_)(void*, Args...);
+
+      //! The user pointer given to the plain function
+      void* data_;
 
       //! Id use for functor comparison
       void* ID_;
 
     public:
       //! Constructor
-      ComparableFunctor(std::function<Signature> F, void* ID)
-        : F_(std::move(F)), ID_(ID) {
+      ComparableFunctor(std::function<R(Args...)> F, void* ID)
+        : F_(std::move(F)), raw_(nullptr), data_(nullptr), ID_(ID) {
       }
 
       //! Constructor
-      ComparableFunctor(Signature* F)
-        : F_(F), ID_((void*)F) {
+      ComparableFunctor(R (*F)(Args...))
+        : F_(F), raw_(nullptr), data_(nullptr), ID_((void*)F) {
       }
 
-      //! Forward call to real functor
-      template <class apiType, class paramType>
-      auto operator()(apiType& api, paramType& param) const -> decltype(F_(api, param)) {
-        return F_(api, param);
+      //! Constructor of a plain function, called with `data` as first argument
+      ComparableFunctor(R (*F)(void*, Args...), void* data)
+        : raw_(F), data_(data), ID_((void*)F) {
       }
 
       //! Forward call to real functor
-      template <class apiType, class paramType1, class paramType2>
-      auto operator()(apiType& api, paramType1& param1, paramType2& param2) const -> decltype(F_(api, param1, param2)) {
-        /* We don't use C++ variadic templates to support VS2013... */
-        return F_(api, param1, param2);
+      template <class... Params>
+      R operator()(Params&&... params) const {
+        if (this->raw_ != nullptr)
+          return this->raw_(this->data_, std::forward<Params>(params)...);
+        return this->F_(std::forward<Params>(params)...);
       }
 
-      //! Comparison of functor based on id
+      //! Comparison of functor based on id (and user pointer)
       template <class T>
       bool operator==(const ComparableFunctor<T>& O) const {
-        return this->ID_ == O.ID_;
+        return this->ID_ == O.ID_ && this->data_ == O.data_;
       }
 
-      //! Comparison of functor based on id
+      //! Comparison of functor based on id (and user pointer)
       template <class T>
       bool operator!=(const ComparableFunctor<T>& O) const {
-        return !(this->ID_ == O.ID_);
+        return !(*this == O);
       }
+
+      template <class T> friend struct ComparableFunctor;
   };
 /*! @} End of triton namespace */
 }
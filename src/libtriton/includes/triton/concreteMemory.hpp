@@ -0,0 +1,218 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_CONCRETEMEMORY_HPP
+#define TRITON_CONCRETEMEMORY_HPP
+
+#include <algorithm>
+#include <bitset>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <triton/astAllocator.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/memoryPlacement.hpp>
+#include <triton/persistentMap.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Triton namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    /*! \class ConcreteMemory
+     *  \brief The concrete memory of a CPU, made of pages shared between copies.
+     *
+     * \description
+     * Bytes are stored in pages of 4 KB which remember which of their bytes are defined. Copying a
+     * memory shares all its pages, and writing to a shared page copies this page only. Range reads
+     * and writes copy whole runs of a page at once, one page lookup per 4 KB. An external buffer,
+     * such as a mapped file, can also back a range of pages: its bytes are read in place, and a
+     * page is only copied out of the buffer when it is first written. The pages read in place are
+     * thus shared with every memory mapping the same buffer, such as the contexts mapping the
+     * text of a binary (see `MappedFile::share()`), and only the pages written are owned.
+     *
+     * With a placement (see `setPlacement()`), the pages are allocated from slabs of this placement,
+     * e.g. on huge pages or on a NUMA node. A copy allocates its pages from its own slabs, with the
+     * same placement, so that copies may be written by different threads.
+     */
+    class ConcreteMemory {
+      public:
+        //! The number of bits of the offset in a page.
+        static const triton::uint32 pageBits = 12;
+
+        //! The size of a page (in bytes).
+        static const triton::uint32 pageSize = 1 << pageBits;
+
+      private:
+        //! A page of memory.
+        struct Page {
+          //! The bytes of the page.
+          triton::uint8 bytes[pageSize];
+
+          //! The defined bytes of the page.
+          std::bitset<pageSize> defined;
+        };
+
+        //! A range of pages backed by an external buffer.
+        struct Region {
+          //! The bytes of the first page, the pages follow each other.
+          const triton::uint8* data;
+
+          //! The number of pages.
+          triton::uint64 length;
+
+          //! Keeps the buffer alive, if it is owned.
+          std::shared_ptr<const void> owner;
+        };
+
+        //! Maps a page number to its page. A page backed by a region is allocated when it is first written, and then hides the region.
+        triton::utils::PersistentMap<triton::uint64, std::shared_ptr<Page>, IdentityHash<triton::uint64>> pages;
+
+        //! Maps the first page number of a region to the region, regions do not overlap.
+        std::map<triton::uint64, Region> regions;
+
+        //! The number of defined bytes.
+        triton::usize count;
+
+        //! The slabs of the pages, null if they come from the global allocator.
+        triton::ast::SharedNodePool pool;
+
+        //! Returns a new page, a copy of `other` if not null.
+        std::shared_ptr<Page> newPage(const Page* other) const;
+
+        //! Returns the page of `number`, allocated if missing and copied first if it is shared. A missing page backed by a region is copied from it.
+        Page& detach(triton::uint64 number);
+
+        //! Returns the bytes of the region backing the page `number`, null if none.
+        const triton::uint8* backing(triton::uint64 number) const;
+
+        //! Releases the page `number` if it has no defined byte. A page backed by a region is kept to hide it.
+        void release(triton::uint64 number);
+
+        //! Removes the pages in [first, last) from the regions.
+        void unback(triton::uint64 first, triton::uint64 last);
+
+        //! Returns the numbers of the allocated pages in [first, last).
+        std::vector<triton::uint64> getPages(triton::uint64 first, triton::uint64 last) const;
+
+        //! Returns true if a byte of the `length` bytes of `page` from `offset` is defined.
+        static bool isUsed(const Page& page, triton::uint32 offset, triton::usize length);
+
+      public:
+        //! Constructor.
+        TRITON_EXPORT ConcreteMemory();
+
+        //! Constructor by copy. The pages are shared.
+        TRITON_EXPORT ConcreteMemory(const ConcreteMemory& other);
+
+        //! Copies a memory. The pages are shared.
+        TRITON_EXPORT ConcreteMemory& operator=(const ConcreteMemory& other);
+
+        //! Sets the placement of the next pages allocated.
+        TRITON_EXPORT void setPlacement(const triton::utils::MemoryPlacement& placement);
+
+        //! Returns the placement of the next pages allocated.
+        TRITON_EXPORT triton::utils::MemoryPlacement getPlacement(void) const;
+
+        //! Returns true if the byte at `addr` is defined.
+        TRITON_EXPORT bool isDefined(triton::uint64 addr) const;
+
+        //! Returns the byte at `addr`, 0 if it is not defined.
+        TRITON_EXPORT triton::uint8 get(triton::uint64 addr) const;
+
+        //! Defines the byte at `addr`. The page is copied first if it is shared.
+        TRITON_EXPORT void set(triton::uint64 addr, triton::uint8 value);
+
+        //! Undefines the byte at `addr`.
+        TRITON_EXPORT void erase(triton::uint64 addr);
+
+        //! Returns true if all bytes in [addr, addr+size) are defined.
+        TRITON_EXPORT bool isDefined(triton::uint64 addr, triton::usize size) const;
+
+        //! Returns true if a byte of the page holding `addr` is defined.
+        TRITON_EXPORT bool isPageDefined(triton::uint64 addr) const;
+
+        //! Copies the `size` bytes from `addr` into `out`, undefined bytes are read as 0.
+        TRITON_EXPORT void read(triton::uint64 addr, triton::usize size, triton::uint8* out) const;
+
+        //! Defines the `size` bytes from `addr` with `values`. Pages are allocated if missing and copied first if they are shared.
+        TRITON_EXPORT void write(triton::uint64 addr, const triton::uint8* values, triton::usize size);
+
+        //! Undefines the `size` bytes from `addr`. Pages fully covered are released without being copied.
+        TRITON_EXPORT void erase(triton::uint64 addr, triton::usize size);
+
+        /*!
+         * \brief Defines the `size` bytes from `addr` with `area`, without copying the pages it fully covers.
+         *
+         * \details The pages fully covered by the area are backed by it, in constant time whatever
+         * their number, the bytes of the pages partially covered are copied. The area is only
+         * read, a page is copied out of it when one of its bytes is written or undefined. The
+         * area must outlive the memory and all its copies, unless `owner` keeps it alive.
+         */
+        TRITON_EXPORT void map(triton::uint64 addr, const triton::uint8* area, triton::usize size, const std::shared_ptr<const void>& owner=nullptr);
+
+        //! Undefines all bytes.
+        TRITON_EXPORT void clear(void);
+
+        //! Returns the number of defined bytes.
+        TRITON_EXPORT triton::usize size(void) const;
+
+        //! Returns the number of allocated pages, the pages backed by a region are not counted until they are written.
+        TRITON_EXPORT triton::usize getNumberOfPages(void) const;
+
+        //! Returns the number of bytes of the allocated pages. The areas mapped by `map()` are not counted.
+        TRITON_EXPORT triton::usize getBytes(void) const;
+
+        //! Returns the number of pages read in place from the mapped areas, those hidden by an allocated page excluded.
+        TRITON_EXPORT triton::usize getNumberOfMappedPages(void) const;
+
+        //! Returns the addresses of the pages holding a defined byte, those backed by a region included, by increasing address.
+        TRITON_EXPORT std::vector<triton::uint64> getDefinedPages(void) const;
+
+        /*!
+         * \brief Calls `visitor(addr, data, length)` on each run of [addr, addr+size) in a page, by increasing address.
+         *
+         * \details `data` points to the `length` bytes of the run in its page or its region,
+         * undefined bytes are read as 0, or is null if the run is in no page. It is only valid
+         * until the memory is modified.
+         */
+        template <typename F>
+        void forEachChunk(triton::uint64 addr, triton::usize size, F visitor) const {
+          while (size) {
+            triton::uint32 offset = addr & (pageSize - 1);
+            triton::usize  length = std::min<triton::usize>(size, pageSize - offset);
+
+            const std::shared_ptr<Page>* page = this->pages.find(addr >> pageBits);
+            const triton::uint8* data = (page != nullptr) ? (*page)->bytes : this->backing(addr >> pageBits);
+            visitor(addr, (data != nullptr) ? data + offset : nullptr, length);
+
+            addr += length;
+            size -= length;
+          }
+        }
+    };
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_CONCRETEMEMORY_HPP */
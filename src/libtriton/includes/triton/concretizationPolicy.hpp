@@ -0,0 +1,139 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_CONCRETIZATIONPOLICY_HPP
+#define TRITON_CONCRETIZATIONPOLICY_HPP
+
+#include <unordered_map>
+
+#include <triton/dllexport.hpp>
+#include <triton/symbolicEnums.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      //! \class ConcretizationPolicy
+      /*! \brief Decides how the dereferences of symbolic addresses are concretized, and counts them by instruction.
+       *
+       * \description
+       * A load or a store at a symbolic address follows the policy of its instruction, the default one unless the
+       * address of the instruction has its own. Each policy trades precision for speed: the concrete address alone
+       * loses the other addresses the pointer may take, the constraint on it keeps the path predicate sound, the fork
+       * asks the solver for at most `forkValues` other addresses to flip to, and the memory array keeps every address
+       * of a range of at most `arrayCells` cells.
+       */
+      class ConcretizationPolicy {
+        public:
+          //! The dereferences of symbolic addresses by an instruction.
+          struct Statistics {
+            //! The number of dereferences.
+            triton::usize dereferences;
+
+            //! The number of dereferences concretized without constraint.
+            triton::usize concretized;
+
+            //! The number of dereferences concretized with the constraint that the address is the concrete one.
+            triton::usize constrained;
+
+            //! The number of dereferences forked.
+            triton::usize forked;
+
+            //! The number of branches of the forks, the taken ones included.
+            triton::usize branches;
+
+            //! The number of dereferences kept symbolic as accesses of the memory array.
+            triton::usize symbolic;
+
+            //! The number of dereferences which could not be kept symbolic, their address reaching too many cells. They are constrained.
+            triton::usize fallbacks;
+          };
+
+        private:
+          //! The policy of the instructions without their own.
+          triton::engines::symbolic::pointer_policy_e policy;
+
+          //! The policies of instructions, by address.
+          std::unordered_map<triton::uint64, triton::engines::symbolic::pointer_policy_e> sites;
+
+          //! The maximum number of cells an access kept symbolic may reach.
+          triton::usize arrayCells;
+
+          //! The maximum number of branches of a fork, the taken one included.
+          triton::uint32 forkValues;
+
+          //! The statistics of the instructions, by address.
+          std::unordered_map<triton::uint64, Statistics> statistics;
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT ConcretizationPolicy();
+
+          //! Returns the policy of the instructions without their own.
+          TRITON_EXPORT triton::engines::symbolic::pointer_policy_e getPolicy(void) const;
+
+          //! Returns the policy of the instruction at `addr`.
+          TRITON_EXPORT triton::engines::symbolic::pointer_policy_e getPolicy(triton::uint64 addr) const;
+
+          //! Defines the policy of the instructions without their own. By default, CONCRETIZE_POINTER.
+          TRITON_EXPORT void setPolicy(triton::engines::symbolic::pointer_policy_e policy);
+
+          //! Defines the policy of the instruction at `addr`.
+          TRITON_EXPORT void setPolicy(triton::uint64 addr, triton::engines::symbolic::pointer_policy_e policy);
+
+          //! Removes the policy of the instruction at `addr`, which then follows the default one.
+          TRITON_EXPORT void removePolicy(triton::uint64 addr);
+
+          //! Returns the maximum number of cells an access kept symbolic may reach.
+          TRITON_EXPORT triton::usize getArrayCells(void) const;
+
+          //! Returns the maximum number of branches of a fork, the taken one included.
+          TRITON_EXPORT triton::uint32 getForkValues(void) const;
+
+          //! Defines the maximum number of cells an access kept symbolic may reach and the maximum number of branches of a fork, at least one each. By default, 1024 and 8.
+          TRITON_EXPORT void setLimits(triton::usize arrayCells, triton::uint32 forkValues);
+
+          //! Counts a dereference by the instruction at `addr` and returns its statistics, to be updated with its outcome.
+          TRITON_EXPORT Statistics& record(triton::uint64 addr);
+
+          //! Returns the statistics of the instructions which dereferenced a symbolic address, by address.
+          TRITON_EXPORT const std::unordered_map<triton::uint64, Statistics>& getStatistics(void) const;
+
+          //! Clears the statistics. The policies are kept.
+          TRITON_EXPORT void resetStatistics(void);
+      };
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_CONCRETIZATIONPOLICY_HPP */
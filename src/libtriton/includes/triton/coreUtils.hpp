@@ -53,6 +53,30 @@ namespace triton {
     template <> TRITON_EXPORT triton::uint256 fromBufferToUint(const triton::uint8* buffer);
     template <> TRITON_EXPORT triton::uint512 fromBufferToUint(const triton::uint8* buffer);
 
+    //! Returns the number of set bits of the value.
+    TRITON_EXPORT triton::uint32 popcount(triton::uint64 value);
+
+    //! Returns the number of set bits of the value.
+    TRITON_EXPORT triton::uint32 popcount(triton::uint512 value);
+
+    //! Returns the `size`-bit value whose bits set are the most significant bits of its `lane`-bit lanes.
+    TRITON_EXPORT triton::uint512 laneSigns(triton::uint32 size, triton::uint32 lane);
+
+    //! Returns the lane-wise addition of two `size`-bit values, on lanes of `lane` bits.
+    TRITON_EXPORT triton::uint512 laneAdd(const triton::uint512& value1, const triton::uint512& value2, triton::uint32 size, triton::uint32 lane);
+
+    //! Returns the lane-wise subtraction of two `size`-bit values, on lanes of `lane` bits.
+    TRITON_EXPORT triton::uint512 laneSub(const triton::uint512& value1, const triton::uint512& value2, triton::uint32 size, triton::uint32 lane);
+
+    //! Returns the lane-wise equality of two `size`-bit values, a lane is all ones if equal and zero otherwise.
+    TRITON_EXPORT triton::uint512 laneEq(const triton::uint512& value1, const triton::uint512& value2, triton::uint32 size, triton::uint32 lane);
+
+    //! Returns the lane-wise signed greater than of two `size`-bit values, a lane is all ones if greater and zero otherwise.
+    TRITON_EXPORT triton::uint512 laneSgt(const triton::uint512& value1, const triton::uint512& value2, triton::uint32 size, triton::uint32 lane);
+
+    //! Returns the lanes of `value1` whose lane of `mask` has its most significant bit set, and the lanes of `value2` otherwise.
+    TRITON_EXPORT triton::uint512 laneSelect(const triton::uint512& mask, const triton::uint512& value1, const triton::uint512& value2, triton::uint32 size, triton::uint32 lane);
+
   /*! @} End of triton namespace */
   };
 /*! @} End of triton namespace */
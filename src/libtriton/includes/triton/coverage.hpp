@@ -0,0 +1,169 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_COVERAGE_HPP
+#define TRITON_COVERAGE_HPP
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    //! The number of entries of the bitmap of the edges.
+    const triton::usize COVERAGE_BITMAP_SIZE = 65536;
+
+    /*! \struct BranchCoverage
+     *  \brief The times a branch of a path constraint was taken, and the times it was the one not taken. */
+    struct BranchCoverage {
+      //! The number of times the branch was taken.
+      triton::usize taken = 0;
+
+      //! The number of times another branch of its instruction was taken.
+      triton::usize notTaken = 0;
+    };
+
+    //! \class Coverage
+    /*! \brief The code coverage of the processing.
+     *
+     * \description
+     * Once enabled, the IR builder records each address processed and, after each instruction modifying the control flow,
+     * the edge from its address to the program counter it left, hashed into a bitmap of `COVERAGE_BITMAP_SIZE` entries
+     * saturated at 255 (see `getEdgeIndex()`). The path manager records the branches of its path constraints: the taken one
+     * and the ones not taken. A branch never taken is uncovered until an edge takes it, the uncovered branches are kept in
+     * a vector indexed in O(1), so that an exploration picks the next branch to flip without scanning the trace.
+     *
+     * The context and its forks share the coverage, it is protected by a lock.
+     */
+    class Coverage {
+      private:
+        //! Hashes an edge.
+        struct EdgeHash {
+          //! Returns the hash of `edge`.
+          triton::usize operator()(const std::pair<triton::uint64, triton::uint64>& edge) const;
+        };
+
+        //! A branch, and its position among the uncovered ones.
+        struct Branch {
+          //! The times it was taken and not taken.
+          BranchCoverage coverage;
+
+          //! Its index in `uncovered`, or -1 once covered.
+          triton::usize index;
+        };
+
+        //! True if the coverage is recorded.
+        bool enabled;
+
+        //! Protects the coverage, which the forks share.
+        mutable std::mutex lock;
+
+        //! The addresses processed.
+        std::unordered_set<triton::uint64> addresses;
+
+        //! The hits of each edge (address of the control flow instruction, destination).
+        std::unordered_map<std::pair<triton::uint64, triton::uint64>, triton::usize, EdgeHash> edges;
+
+        //! The hits of the edges by hash, saturated at 255.
+        std::vector<triton::uint8> bitmap;
+
+        //! The branches of the path constraints (address of the branch, destination).
+        std::unordered_map<std::pair<triton::uint64, triton::uint64>, Branch, EdgeHash> branches;
+
+        //! The branches never taken, in the order they were found.
+        std::vector<std::pair<triton::uint64, triton::uint64>> uncovered;
+
+        //! Removes a branch from the uncovered ones, it is taken. The lock must be held.
+        void cover(Branch& branch);
+
+      public:
+        //! Constructor.
+        TRITON_EXPORT Coverage();
+
+        //! Returns true if the coverage is recorded.
+        inline bool isEnabled(void) const {
+          return this->enabled;
+        }
+
+        //! Enables or disables the recording of the coverage. By default, disabled.
+        TRITON_EXPORT void setEnabled(bool flag);
+
+        //! Records an instruction processed at `address`. If it modifies the control flow, `next` is the destination of its edge.
+        TRITON_EXPORT void recordInstruction(triton::uint64 address, bool controlFlow, triton::uint64 next);
+
+        //! Records a branch of a path constraint from `src` to `dst`, which was `taken` or not.
+        TRITON_EXPORT void recordBranch(bool taken, triton::uint64 src, triton::uint64 dst);
+
+        //! Returns true if `address` was processed.
+        TRITON_EXPORT bool isExecuted(triton::uint64 address) const;
+
+        //! Returns true if the edge from `src` to `dst` was taken.
+        TRITON_EXPORT bool isCovered(triton::uint64 src, triton::uint64 dst) const;
+
+        //! Returns the number of times the branch from `src` to `dst` was taken and not taken, 0 if it was never recorded.
+        TRITON_EXPORT BranchCoverage getBranch(triton::uint64 src, triton::uint64 dst) const;
+
+        //! Returns the addresses processed.
+        TRITON_EXPORT std::set<triton::uint64> getAddresses(void) const;
+
+        //! Returns the hits of each edge (address of the control flow instruction, destination).
+        TRITON_EXPORT std::map<std::pair<triton::uint64, triton::uint64>, triton::usize> getEdges(void) const;
+
+        //! Returns the hits of the edges by hash, saturated at 255.
+        TRITON_EXPORT std::vector<triton::uint8> getBitmap(void) const;
+
+        //! Returns the times each branch of the path constraints was taken and not taken.
+        TRITON_EXPORT std::map<std::pair<triton::uint64, triton::uint64>, BranchCoverage> getBranches(void) const;
+
+        //! Returns the branches never taken, in the order they were found.
+        TRITON_EXPORT std::vector<std::pair<triton::uint64, triton::uint64>> getUncoveredBranches(void) const;
+
+        //! Returns the number of branches never taken.
+        TRITON_EXPORT triton::usize getNumberOfUncoveredBranches(void) const;
+
+        //! Returns in `branch` the last branch found which was never taken, in O(1). Returns false if there is none.
+        TRITON_EXPORT bool getNextUncoveredBranch(std::pair<triton::uint64, triton::uint64>& branch) const;
+
+        //! Clears the coverage.
+        TRITON_EXPORT void clear(void);
+
+        //! Returns the entry of the bitmap of the edge from `src` to `dst`.
+        TRITON_EXPORT static triton::usize getEdgeIndex(triton::uint64 src, triton::uint64 dst);
+    };
+
+    //! Shared Coverage.
+    using SharedCoverage = std::shared_ptr<triton::arch::Coverage>;
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_COVERAGE_HPP */
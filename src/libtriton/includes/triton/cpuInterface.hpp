@@ -8,15 +8,18 @@
 #ifndef TRITON_CPUINTERFACE_HPP
 #define TRITON_CPUINTERFACE_HPP
 
+#include <memory>
 #include <set>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 #include <triton/archEnums.hpp>
+#include <triton/concreteMemory.hpp>
 #include <triton/dllexport.hpp>
 #include <triton/instruction.hpp>
 #include <triton/memoryAccess.hpp>
+#include <triton/memoryPlacement.hpp>
 #include <triton/register.hpp>
 #include <triton/tritonTypes.hpp>
 
@@ -47,6 +50,12 @@ namespace triton {
         //! Clears the architecture states (registers and memory).
         TRITON_EXPORT virtual void clear(void) = 0;
 
+        //! Copies the registers and the memory of another CPU of the same architecture. The callbacks of the CPU are kept.
+        TRITON_EXPORT virtual void copyState(const triton::arch::CpuInterface& other) = 0;
+
+        //! Copies the concrete registers of another CPU of the same architecture. The memory is kept.
+        TRITON_EXPORT virtual void copyRegisters(const triton::arch::CpuInterface& other) = 0;
+
         //! Returns the kind of endianness as triton::arch::endianness_e.
         TRITON_EXPORT virtual triton::arch::endianness_e getEndianness(void) const = 0;
 
@@ -65,6 +74,12 @@ namespace triton {
         //! Sets CPU state to Thumb mode.
         TRITON_EXPORT virtual void setThumb(bool state) = 0;
 
+        //! Returns the execution state the decoding of the next instruction depends on (e.g. the Thumb mode and the IT block for Arm32).
+        TRITON_EXPORT virtual triton::uint32 getDecodingState(void) const = 0;
+
+        //! Restores an execution state returned by `getDecodingState()`.
+        TRITON_EXPORT virtual void setDecodingState(triton::uint32 state) = 0;
+
         //! Returns true if the exclusive memory access flag is set. Only valid for Arm32.
         TRITON_EXPORT virtual bool isMemoryExclusiveAccess(void) const = 0;
 
@@ -116,9 +131,21 @@ namespace triton {
         //! Returns the concrete value of a memory area.
         TRITON_EXPORT virtual std::vector<triton::uint8> getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks=true) const = 0;
 
+        //! Copies the concrete value of a memory area into `area`, which must hold `size` bytes.
+        TRITON_EXPORT virtual void getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::uint8* area, triton::usize size, bool execCallbacks=true) const = 0;
+
+        //! Returns the concrete memory, to read its pages without copying them. The callbacks are not called.
+        TRITON_EXPORT virtual const triton::arch::ConcreteMemory& getConcreteMemory(void) const = 0;
+
         //! Returns the concrete value of a register.
         TRITON_EXPORT virtual triton::uint512 getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks=true) const = 0;
 
+        //! Returns the concrete value of memory cells of 64 bits or less, without multiprecision arithmetic.
+        TRITON_EXPORT virtual triton::uint64 getConcreteMemoryValue64(const triton::arch::MemoryAccess& mem, bool execCallbacks=true) const = 0;
+
+        //! Returns the concrete value of a register of 64 bits or less, without multiprecision arithmetic.
+        TRITON_EXPORT virtual triton::uint64 getConcreteRegisterValue64(const triton::arch::Register& reg, bool execCallbacks=true) const = 0;
+
         /*!
          * \brief [**architecture api**] - Sets the concrete value of a memory cell.
          *
@@ -151,6 +178,20 @@ namespace triton {
          */
         TRITON_EXPORT virtual void setConcreteMemoryAreaValue(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size) = 0;
 
+        /*!
+         * \brief [**architecture api**] - Sets the concrete value of a memory area to an external buffer, without copying it.
+         *
+         * \details The pages fully covered by the area are mapped to it and only copied when
+         * they are written, so the area must outlive the memory and all its copies, unless `owner`
+         * keeps it alive. Note that
+         * by setting a concrete value will probably imply a desynchronization with the symbolic
+         * state (if it exists). You should probably use the concretize functions after this.
+         */
+        TRITON_EXPORT virtual void mapConcreteMemoryArea(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size, const std::shared_ptr<const void>& owner=nullptr) = 0;
+
+        //! [**architecture api**] - Sets the placement of the next pages of the concrete memory.
+        TRITON_EXPORT virtual void setConcreteMemoryPlacement(const triton::utils::MemoryPlacement& placement) = 0;
+
         /*!
          * \brief [**architecture api**] - Sets the concrete value of a register.
          *
@@ -0,0 +1,156 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_DISASSEMBLYCACHE_HPP
+#define TRITON_DISASSEMBLYCACHE_HPP
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <triton/archEnums.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/instruction.hpp>
+#include <triton/operandWrapper.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    /*! \class DisassemblyCache
+     *  \brief The decoded instructions of an architecture, by address.
+     *
+     * \description
+     * The decoding of an instruction only depends on its address, its bytes and the decoding
+     * state of the CPU (see `CpuInterface::getDecodingState()`, e.g. the Thumb mode and the IT
+     * block for Arm32). An entry also remembers the state the decoding left, restored on a hit
+     * so that the instructions of an IT block keep their conditions. An entry remembers the bytes the decoder consumed, so an instruction
+     * hits the cache only if it starts with these bytes: code modified since it was decoded
+     * misses the cache, and no write to the memory has to be tracked.
+     *
+     * For the same reason, the contexts of an architecture may share a cache (see `API::setDisassemblyCache()`),
+     * e.g. the workers analyzing the same binary, whatever code each one maps.
+     */
+    class DisassemblyCache {
+      public:
+        //! The maximum number of entries, the cache is emptied when it is reached.
+        static const triton::usize capacity = 1 << 16;
+
+      private:
+        //! A decoded instruction.
+        struct Entry {
+          //! The bytes consumed by the decoder.
+          triton::uint8 bytes[32];
+
+          //! The number of bytes consumed by the decoder.
+          triton::uint32 size;
+
+          //! The mnemonic.
+          std::string mnemonic;
+
+          //! The operands, as disassembled.
+          std::string operandsText;
+
+          //! The operands.
+          std::vector<triton::arch::OperandWrapper> operands;
+
+          //! The opcode.
+          triton::uint32 type;
+
+          //! The prefix (x86).
+          triton::arch::x86::prefix_e prefix;
+
+          //! The condition code (ARM).
+          triton::arch::arm::condition_e codeCondition;
+
+          //! The specialized semantics handler (x86).
+          triton::uint32 handler;
+
+          //! True if the instruction is a branch.
+          bool branch;
+
+          //! True if the instruction modifies the control flow.
+          bool controlFlow;
+
+          //! True if the instruction performs a write back (ARM).
+          bool writeBack;
+
+          //! True if the instruction updates the flags (ARM).
+          bool updateFlag;
+
+          //! True if the instruction was decoded in Thumb mode (ARM32).
+          bool thumb;
+
+          //! The decoding state of the CPU after the decoding.
+          triton::uint32 next;
+        };
+
+        //! An address and the decoding state of the CPU.
+        using Key = std::pair<triton::uint64, triton::uint32>;
+
+        //! Hashes a key.
+        struct KeyHash {
+          std::size_t operator()(const Key& key) const {
+            return std::hash<triton::uint64>()(key.first ^ (static_cast<triton::uint64>(key.second) << 32));
+          }
+        };
+
+        //! Maps an address and a decoding state to the instruction decoded there.
+        std::unordered_map<Key, Entry, KeyHash> entries;
+
+        //! Protects `entries`, the CPUs may disassemble from several threads.
+        mutable std::mutex lock;
+
+        //! The architecture of the decoded instructions.
+        triton::arch::architecture_e arch;
+
+      public:
+        //! Constructor.
+        TRITON_EXPORT DisassemblyCache(triton::arch::architecture_e arch);
+
+        //! Returns the architecture of the decoded instructions.
+        TRITON_EXPORT triton::arch::architecture_e getArchitecture(void) const;
+
+        //! Restores the decoding of `inst` and the decoding state it left in `next`, and returns true, if the same bytes were decoded at its address in the same `state`.
+        TRITON_EXPORT bool find(triton::arch::Instruction& inst, triton::uint32 state, triton::uint32& next) const;
+
+        //! Remembers the decoding of `inst`, decoded in the decoding `state` and leaving the `next` one.
+        TRITON_EXPORT void insert(const triton::arch::Instruction& inst, triton::uint32 state, triton::uint32 next);
+
+        //! Removes all entries.
+        TRITON_EXPORT void clear(void);
+
+        //! Returns the number of entries.
+        TRITON_EXPORT triton::usize size(void) const;
+    };
+
+    //! Shared Disassembly Cache.
+    using SharedDisassemblyCache = std::shared_ptr<triton::arch::DisassemblyCache>;
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_DISASSEMBLYCACHE_HPP */
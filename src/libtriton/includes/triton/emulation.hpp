@@ -0,0 +1,90 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_EMULATION_HPP
+#define TRITON_EMULATION_HPP
+
+#include <functional>
+#include <map>
+#include <set>
+
+#include <triton/archEnums.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  class API;
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    //! A hook called before the instruction at its address is executed. Returns false to stop the emulation, otherwise it resumes from the concrete program counter, which the hook may change.
+    using EmulationHook = std::function<bool(triton::API& api, triton::uint64 addr)>;
+
+    /*! \struct EmulationOptions
+     *  \brief The stop conditions and the hooks of an emulation (see `API::emulate()`). */
+    struct EmulationOptions {
+      //! The addresses where the emulation stops, before executing them. The start address does not stop it, so that it can be resumed.
+      std::set<triton::uint64> stops;
+
+      //! The max number of instructions executed, 0 for unbounded.
+      triton::usize maxInstructions = 0;
+
+      //! True if the emulation stops after a control flow instruction leaving a symbolized program counter.
+      bool stopOnSymbolicPc = false;
+
+      //! The hooks, by address.
+      std::map<triton::uint64, triton::arch::EmulationHook> hooks;
+
+      //! True if the syscalls are executed by their handlers (see `Syscalls`), otherwise a syscall instruction only has its semantics.
+      bool syscalls = false;
+
+      //! True if the concrete regions run on Unicorn (see `NativeBackend`). Triton must be built with UNICORN_INTERFACE.
+      bool native = false;
+    };
+
+
+    /*! \struct EmulationResult
+     *  \brief The outcome of an emulation. */
+    struct EmulationResult {
+      //! The reason the emulation stopped.
+      triton::arch::emulation_e reason = triton::arch::EMULATION_ADDRESS;
+
+      //! The address to resume from: the address of the instruction not executed, or the program counter after the last one.
+      triton::uint64 pc = 0;
+
+      //! The number of instructions executed.
+      triton::usize instructions = 0;
+
+      //! The number of blocks executed by Triton.
+      triton::usize blocks = 0;
+
+      //! The number of instructions executed on Unicorn, counted in `instructions`.
+      triton::usize native = 0;
+
+      //! The exit status of the program, with EMULATION_EXIT.
+      triton::uint64 status = 0;
+    };
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_EMULATION_HPP */
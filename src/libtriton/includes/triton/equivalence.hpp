@@ -0,0 +1,81 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_EQUIVALENCE_HPP
+#define TRITON_EQUIVALENCE_HPP
+
+#include <unordered_map>
+
+#include <triton/solverEnums.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      /*! \struct EquivalenceOptions
+       *  \brief The options of the equivalence checks (see `SolverEngine::checkEquivalences()`). */
+      struct EquivalenceOptions {
+        //! The number of random inputs evaluated before the solver, after the corner values (0, 1, -1 and the signed bounds).
+        triton::usize samples = 64;
+
+        //! The seed of the random inputs, the same seed giving the same inputs.
+        triton::uint64 seed = 0;
+
+        //! True if the queries not refuted by the evaluation are sent to the solver, otherwise they are UNKNOWN.
+        bool useSolver = true;
+
+        //! True if the queries are solved on the threads of the solver (see `SolverEngine::setThreads()`).
+        bool parallel = false;
+
+        //! The timeout of each query (in milliseconds), 0 for the solver's one.
+        triton::uint32 timeout = 0;
+      };
+
+      /*! \struct Equivalence
+       *  \brief The answer to an equivalence check. */
+      struct Equivalence {
+        //! UNSAT if the check is proved (no input tells both sides apart), SAT if it is refuted, otherwise the status of the solver.
+        triton::engines::solver::status_e status = triton::engines::solver::UNKNOWN;
+
+        //! True if the check was refuted by the evaluation, without the solver.
+        bool evaluated = false;
+
+        //! The inputs telling both sides apart if it is refuted.
+        std::unordered_map<triton::usize, SolverModel> counterexample;
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_EQUIVALENCE_HPP */
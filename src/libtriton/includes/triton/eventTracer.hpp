@@ -0,0 +1,183 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_EVENTTRACER_HPP
+#define TRITON_EVENTTRACER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Utils namespace
+  namespace utils {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup utils
+   *  @{
+   */
+
+    /*! \struct TraceEvent
+     *  \brief A scoped event of the trace. */
+    struct TraceEvent {
+      //! The name of the event, a string literal.
+      const char* name;
+
+      //! The category of the event, a string literal.
+      const char* category;
+
+      //! The start of the event (in nanoseconds since the creation of the tracer).
+      triton::uint64 start;
+
+      //! The duration of the event (in nanoseconds).
+      triton::uint64 duration;
+
+      //! The thread of the event, numbered from 1 in the order the threads recorded their first event.
+      triton::uint32 thread;
+
+      //! The argument of the event, e.g. the address of an instruction.
+      triton::uint64 value;
+    };
+
+    //! \class EventTracer
+    /*! \brief Records scoped events into a ring buffer and writes them as a Chrome trace.
+     *
+     * \description
+     * Once enabled, the IR builder, the solver engine, the garbage collections of the AST context and the
+     * synthesizer record their scoped events (see `TraceScope`). The buffer keeps the last `capacity` events.
+     * Disabled, a scope only checks a flag. Events may be recorded by several threads, e.g. by the threads
+     * solving the queries in the background.
+     *
+     * The trace is written in the JSON format of Chrome (`chrome://tracing`, Perfetto) as complete events.
+     */
+    class EventTracer {
+      private:
+        //! True if the events are recorded.
+        std::atomic<bool> enabled;
+
+        //! The start of the time of the events.
+        std::chrono::steady_clock::time_point epoch;
+
+        //! The ring buffer of the events.
+        std::vector<TraceEvent> events;
+
+        //! The maximum number of events kept.
+        triton::usize capacity;
+
+        //! The index of the next event written in the buffer.
+        triton::usize next;
+
+        //! The number of events recorded since the last clear.
+        triton::usize recorded;
+
+        //! The numbers of the threads.
+        std::unordered_map<std::thread::id, triton::uint32> threads;
+
+        //! Protects the buffer and the threads.
+        mutable std::mutex lock;
+
+      public:
+        //! Constructor. The last `capacity` events are kept.
+        TRITON_EXPORT EventTracer(triton::usize capacity=65536);
+
+        //! Returns true if the events are recorded.
+        inline bool isEnabled(void) const {
+          return this->enabled.load(std::memory_order_relaxed);
+        }
+
+        //! Enables or disables the recording of the events. By default, disabled.
+        TRITON_EXPORT void setEnabled(bool flag);
+
+        //! Returns the maximum number of events kept.
+        TRITON_EXPORT triton::usize getCapacity(void) const;
+
+        //! Sets the maximum number of events kept and clears the events. The capacity must not be 0.
+        TRITON_EXPORT void setCapacity(triton::usize capacity);
+
+        //! Returns the number of nanoseconds since the creation of the tracer.
+        TRITON_EXPORT triton::uint64 now(void) const;
+
+        //! Records an event of the calling thread. `name` and `category` must be string literals.
+        TRITON_EXPORT void record(const char* name, const char* category, triton::uint64 start, triton::uint64 duration, triton::uint64 value);
+
+        //! Returns the events kept, the oldest first.
+        TRITON_EXPORT std::vector<TraceEvent> getEvents(void) const;
+
+        //! Returns the number of events overwritten since the last clear.
+        TRITON_EXPORT triton::usize getDropped(void) const;
+
+        //! Removes the events.
+        TRITON_EXPORT void clear(void);
+
+        //! Writes the events kept as a Chrome trace.
+        TRITON_EXPORT void writeChromeTrace(std::ostream& stream) const;
+    };
+
+    //! Shared Event Tracer.
+    using SharedEventTracer = std::shared_ptr<triton::utils::EventTracer>;
+
+    //! \class TraceScope
+    /*! \brief Records an event from its construction to its destruction, if the tracer is enabled. */
+    class TraceScope {
+      private:
+        //! The tracer, null if it is disabled.
+        triton::utils::EventTracer* tracer;
+
+        //! The name of the event.
+        const char* name;
+
+        //! The category of the event.
+        const char* category;
+
+        //! The argument of the event.
+        triton::uint64 value;
+
+        //! The start of the event.
+        triton::uint64 start;
+
+      public:
+        //! Constructor. `tracer` may be null, `name` and `category` must be string literals.
+        inline TraceScope(triton::utils::EventTracer* tracer, const char* name, const char* category, triton::uint64 value=0)
+          : tracer((tracer != nullptr && tracer->isEnabled()) ? tracer : nullptr), name(name), category(category), value(value), start(0) {
+          if (this->tracer != nullptr)
+            this->start = this->tracer->now();
+        }
+
+        //! Destructor.
+        inline ~TraceScope() {
+          if (this->tracer != nullptr)
+            this->tracer->record(this->name, this->category, this->start, this->tracer->now() - this->start, this->value);
+        }
+
+        //! Sets the argument of the event, e.g. once it is known.
+        inline void setValue(triton::uint64 value) {
+          this->value = value;
+        }
+    };
+
+  /*! @} End of utils namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_EVENTTRACER_HPP */
@@ -168,6 +168,18 @@ namespace triton {
     };
 
 
+    /*! \class ExplorationEngine
+     *  \brief The exception class used by the exploration engine. */
+    class ExplorationEngine : public triton::exceptions::Engines {
+      public:
+        //! Constructor.
+        TRITON_EXPORT ExplorationEngine(const char* message) : triton::exceptions::Engines(message) {};
+
+        //! Constructor.
+        TRITON_EXPORT ExplorationEngine(const std::string& message) : triton::exceptions::Engines(message) {};
+    };
+
+
     /*! \class LiftingEngine
      *  \brief The exception class used by the lifting engine. */
     class LiftingEngine : public triton::exceptions::Engines {
@@ -348,6 +360,42 @@ namespace triton {
     };
 
 
+    /*! \class FunctionSummaries
+     *  \brief The exception class used by the function summaries. */
+    class FunctionSummaries : public triton::exceptions::Architecture {
+      public:
+        //! Constructor.
+        TRITON_EXPORT FunctionSummaries(const char* message) : triton::exceptions::Architecture(message) {};
+
+        //! Constructor.
+        TRITON_EXPORT FunctionSummaries(const std::string& message) : triton::exceptions::Architecture(message) {};
+    };
+
+
+    /*! \class NativeBackend
+     *  \brief The exception class used by the native backend. */
+    class NativeBackend : public triton::exceptions::Architecture {
+      public:
+        //! Constructor.
+        TRITON_EXPORT NativeBackend(const char* message) : triton::exceptions::Architecture(message) {};
+
+        //! Constructor.
+        TRITON_EXPORT NativeBackend(const std::string& message) : triton::exceptions::Architecture(message) {};
+    };
+
+
+    /*! \class Syscalls
+     *  \brief The exception class used by the syscalls. */
+    class Syscalls : public triton::exceptions::Architecture {
+      public:
+        //! Constructor.
+        TRITON_EXPORT Syscalls(const char* message) : triton::exceptions::Architecture(message) {};
+
+        //! Constructor.
+        TRITON_EXPORT Syscalls(const std::string& message) : triton::exceptions::Architecture(message) {};
+    };
+
+
     /*! \class Disassembly
      *  \brief The exception class used by the disassembler. */
     class Disassembly : public triton::exceptions::Cpu {
@@ -0,0 +1,192 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_EXECUTOR_HPP
+#define TRITON_EXECUTOR_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Utils namespace
+  namespace utils {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup utils
+   *  @{
+   */
+
+    /*! The priorities of the tasks of an executor */
+    enum priority_e {
+      PRIORITY_HIGH = 0,  /*!< a caller waits for the task, e.g. a branch of a portfolio race */
+      PRIORITY_NORMAL,    /*!< a task solved in the background, e.g. an asynchronous query */
+      PRIORITY_LOW,       /*!< a task nobody waits for soon */
+      PRIORITY_LAST,      /*!< must be the last item */
+    };
+
+    class Executor;
+
+    //! \class ExecutorTask
+    /*! \brief A task of an executor, with its cooperative cancellation. */
+    class ExecutorTask {
+      friend class Executor;
+
+      private:
+        //! The function of the task, given the task to check its cancellation.
+        std::function<void(const ExecutorTask&)> function;
+
+        //! The priority of the task.
+        triton::utils::priority_e priority;
+
+        //! True once the task is cancelled.
+        std::atomic<bool> cancelled;
+
+        //! True once the task is done, cancelled or not.
+        bool done;
+
+        //! The exception thrown by the function, if any.
+        std::exception_ptr error;
+
+        //! Protects `done` and `error`.
+        mutable std::mutex lock;
+
+        //! Signaled when the task is done.
+        std::condition_variable finished;
+
+      public:
+        //! Constructor.
+        TRITON_EXPORT ExecutorTask(const std::function<void(const ExecutorTask&)>& function, triton::utils::priority_e priority);
+
+        //! Cancels the task. A task not started yet is skipped, a running one should check `isCancelled()`.
+        TRITON_EXPORT void cancel(void);
+
+        //! Returns true if the task is cancelled.
+        TRITON_EXPORT bool isCancelled(void) const;
+
+        //! Returns true if the task is done.
+        TRITON_EXPORT bool isDone(void) const;
+
+        //! Returns the priority of the task.
+        TRITON_EXPORT triton::utils::priority_e getPriority(void) const;
+    };
+
+    //! Shared Executor Task.
+    using SharedExecutorTask = std::shared_ptr<triton::utils::ExecutorTask>;
+
+    //! \class Executor
+    /*! \brief The threads running the tasks of the subsystems.
+     *
+     * \description
+     * The asynchronous queries, the portfolio solver and the parallel synthesis run their tasks on one
+     * executor shared by the process (see `getDefault()`), so that the contexts of a process do not each
+     * start their own threads. A task submitted by a worker goes to the queue of this worker, which takes
+     * its last task first; the other workers steal the first ones once they are idle. The tasks of a higher
+     * priority are always taken first.
+     *
+     * A thread waiting for a task (see `wait()`) runs the queued tasks of the same or a higher priority
+     * meanwhile, so that a task may wait for the tasks it submitted even when all the workers are busy.
+     */
+    class Executor {
+      private:
+        //! The queues of a worker.
+        struct Queues {
+          //! The tasks by priority.
+          std::deque<SharedExecutorTask> tasks[PRIORITY_LAST];
+
+          //! Protects the tasks.
+          std::mutex lock;
+        };
+
+        //! The queues of each worker.
+        std::vector<std::unique_ptr<Queues>> local;
+
+        //! The queues of the tasks submitted by the other threads.
+        Queues global;
+
+        //! The threads.
+        std::vector<std::thread> workers;
+
+        //! The number of tasks queued.
+        triton::usize queued;
+
+        //! True while the workers are stopped.
+        bool stopping;
+
+        //! Protects `queued`, `stopping` and the workers.
+        mutable std::mutex lock;
+
+        //! Serializes the changes of the number of threads.
+        std::mutex resizing;
+
+        //! Signaled when a task is queued or the workers are stopped.
+        std::condition_variable available;
+
+        //! Returns the index of the calling thread if it is a worker of this executor, -1 otherwise.
+        triton::sint32 getWorker(void) const;
+
+        //! Takes a task of a priority up to `priority`, the queues of `worker` first. Returns null if there is none.
+        SharedExecutorTask take(triton::sint32 worker, triton::utils::priority_e priority);
+
+        //! Runs a task, unless it is cancelled.
+        static void run(ExecutorTask& task);
+
+        //! Starts `threads` workers.
+        void start(triton::usize threads);
+
+        //! Stops the workers once their task is done. The queued tasks stay queued.
+        void stop(void);
+
+        //! The loop of a worker.
+        void work(triton::usize index);
+
+      public:
+        //! Constructor. At least one thread is started.
+        TRITON_EXPORT Executor(triton::usize threads);
+
+        //! Destructor. The queued tasks are cancelled, the running ones are waited for.
+        TRITON_EXPORT ~Executor();
+
+        //! Returns the executor of the process, with a thread per core.
+        TRITON_EXPORT static Executor& getDefault(void);
+
+        //! Submits a task and returns it.
+        TRITON_EXPORT SharedExecutorTask submit(const std::function<void(const ExecutorTask&)>& function, triton::utils::priority_e priority=PRIORITY_NORMAL);
+
+        //! Waits for a task, running the queued tasks of the same or a higher priority meanwhile. Rethrows the exception of the task, if any.
+        TRITON_EXPORT void wait(const SharedExecutorTask& task);
+
+        //! Returns the number of threads.
+        TRITON_EXPORT triton::usize getThreads(void) const;
+
+        //! Defines the number of threads, at least one. Waits for the running tasks, the queued ones are kept. Cannot be called by a task.
+        TRITON_EXPORT void setThreads(triton::usize threads);
+    };
+
+  /*! @} End of utils namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_EXECUTOR_HPP */
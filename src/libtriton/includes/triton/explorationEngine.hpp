@@ -0,0 +1,155 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_EXPLORATIONENGINE_HPP
+#define TRITON_EXPLORATIONENGINE_HPP
+
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include <triton/coverage.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/explorationEnums.hpp>
+#include <triton/explorationStrategy.hpp>
+#include <triton/pathConstraint.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  class API;
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Exploration namespace
+    namespace exploration {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup exploration
+     *  @{
+     */
+
+      //! The number of entries of the coverage bitmap, the one of `Coverage`.
+      const triton::usize BITMAP_SIZE = triton::arch::COVERAGE_BITMAP_SIZE;
+
+      /*! \struct ExplorationOptions
+       *  \brief The options of an exploration (see `ExplorationEngine::explore()`). */
+      struct ExplorationOptions {
+        //! The strategy picking the seeds whose branches are flipped.
+        triton::engines::exploration::strategy_e strategy = triton::engines::exploration::GENERATIONAL;
+
+        //! A strategy used instead of `strategy` if it is not null. It is not owned by the engine.
+        triton::engines::exploration::ExplorationStrategy* customStrategy = nullptr;
+
+        //! The addresses where a run stops.
+        std::set<triton::uint64> exits;
+
+        //! The max number of runs, 0 for unbounded.
+        triton::usize maxRuns = 0;
+
+        //! The max number of instructions executed by a run.
+        triton::usize maxInstructions = 100000;
+
+        //! The max generation of the seeds whose branches are flipped, 0 for unbounded.
+        triton::usize maxGenerations = 0;
+
+        //! The time limit of the exploration (in milliseconds), checked between runs, 0 for unbounded.
+        triton::uint64 timeLimit = 0;
+
+        //! True if the branch flips of a run are solved on the threads of the solver (see `SolverEngine::setThreads()`).
+        bool parallel = false;
+
+        //! The timeout of each query (in milliseconds), 0 for the solver's one.
+        triton::uint32 timeout = 0;
+
+        //! True if the UNSAT cores of the branch flips are computed, the flips of the next runs containing one being UNSAT without the solver (see `BranchFlipOptions::unsatCores`).
+        bool unsatCores = false;
+      };
+
+
+      /*! \struct ExplorationResult
+       *  \brief The coverage and the inputs of an exploration. */
+      struct ExplorationResult {
+        //! The number of runs.
+        triton::usize runs = 0;
+
+        //! The number of instructions executed by the runs.
+        triton::usize instructions = 0;
+
+        //! The number of branches flipped.
+        triton::usize flips = 0;
+
+        //! The number of branches flipped whose query is SAT.
+        triton::usize solved = 0;
+
+        //! The number of branches flipped whose query contains an UNSAT core, UNSAT without the solver.
+        triton::usize pruned = 0;
+
+        //! The first seed and the seeds whose run covered new edges, in the order they were executed.
+        std::vector<triton::engines::exploration::Seed> corpus;
+
+        //! The edges (address of the branch, destination) covered by the runs.
+        std::set<std::pair<triton::uint64, triton::uint64>> edges;
+
+        //! The hits of the edges, hashed into `BITMAP_SIZE` entries saturated at 255.
+        std::vector<triton::uint8> bitmap;
+      };
+
+
+      /*! \class ExplorationEngine
+       *  \brief The exploration engine class, which runs the inputs generated by flipping the branches of the previous runs.
+       *
+       * \details
+       * Each run forks the context, sets the input into the symbolic variables of the fork and processes the blocks from the entry
+       * until an exit, an undefined or unsupported instruction, or `maxInstructions`. The branch flips of a run are solved by the
+       * solver of the context, its cache and adaptive timeouts are shared by the runs. The forks share the AST context of the
+       * context, the runs are sequential and `parallel` solves the queries of a run on the threads of the solver.
+       */
+      class ExplorationEngine {
+        private:
+          //! The context forked by the runs.
+          triton::API* ctx;
+
+          //! The options of the exploration.
+          triton::engines::exploration::ExplorationOptions options;
+
+          //! Records the edge from `src` to `dst` and returns true if it is new.
+          static bool cover(triton::uint64 src, triton::uint64 dst, ExplorationResult& result);
+
+          //! Runs `seed` from `entry`, records its coverage and returns its path constraints. The number of new edges is returned in `score`.
+          std::vector<triton::engines::symbolic::PathConstraint> execute(const Seed& seed, triton::uint64 entry, ExplorationResult& result, triton::usize& score);
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT ExplorationEngine(triton::API* ctx, const ExplorationOptions& options = ExplorationOptions());
+
+          //! Explores the paths from `entry`, the first seed is the current values of the symbolic variables. They are restored once done.
+          TRITON_EXPORT ExplorationResult explore(triton::uint64 entry);
+      };
+
+    /*! @} End of exploration namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_EXPLORATIONENGINE_HPP */
@@ -0,0 +1,52 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_EXPLORATIONENUMS_HPP
+#define TRITON_EXPLORATIONENUMS_HPP
+
+#include <triton/config.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Exploration namespace
+    namespace exploration {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup exploration
+     *  @{
+     */
+
+      /*! The different kind of exploration strategies */
+      enum strategy_e {
+        COVERAGE_GUIDED = 0, /*!< the seeds covering the most new edges first, the branches covered by previous runs are not flipped. */
+        DEPTH_FIRST,         /*!< the last seed generated first. */
+        GENERATIONAL,        /*!< the seeds covering the most new edges first, each one flipping the branches after the one of its parent. */
+      };
+
+    /*! @} End of exploration namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_EXPLORATIONENUMS_HPP */
@@ -0,0 +1,175 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_EXPLORATIONSTRATEGY_HPP
+#define TRITON_EXPLORATIONSTRATEGY_HPP
+
+#include <map>
+#include <vector>
+
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Exploration namespace
+    namespace exploration {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup exploration
+     *  @{
+     */
+
+      /*! \struct Seed
+       *  \brief An input of the exploration and the branch flipped to generate it. */
+      struct Seed {
+        //! The concrete values of the symbolic variables, by id.
+        std::map<triton::usize, triton::uint512> input;
+
+        //! The index of the first path constraint of the run whose branches are flipped. The ones before it were flipped by the parents.
+        triton::usize bound = 0;
+
+        //! The number of branches flipped from the first seed.
+        triton::usize generation = 0;
+
+        //! The number of edges the run of the seed covered first.
+        triton::usize score = 0;
+
+        //! The address of the branch flipped to generate the seed, 0 for the first one.
+        triton::uint64 srcAddr = 0;
+
+        //! The destination of the branch flipped to generate the seed, 0 for the first one.
+        triton::uint64 dstAddr = 0;
+      };
+
+
+      /*! \interface ExplorationStrategy
+       *  \brief The worklist of an exploration, which picks the seeds whose branches are flipped. */
+      class ExplorationStrategy {
+        public:
+          //! Destructor.
+          TRITON_EXPORT virtual ~ExplorationStrategy() {};
+
+          //! Adds a seed to the worklist, once it is executed and scored.
+          TRITON_EXPORT virtual void push(const Seed& seed) = 0;
+
+          //! Removes the next seed whose branches are flipped and returns it. The worklist must not be empty.
+          TRITON_EXPORT virtual Seed pop(void) = 0;
+
+          //! Returns true if the worklist is empty.
+          TRITON_EXPORT virtual bool empty(void) const = 0;
+
+          //! Returns the bound of the seed generated from `parent` by flipping a branch of the path constraint at `index`.
+          TRITON_EXPORT virtual triton::usize getBound(const Seed& parent, triton::usize index) const = 0;
+
+          //! Returns true if the branches covered by previous runs are not flipped.
+          TRITON_EXPORT virtual bool isCoverageGuided(void) const = 0;
+      };
+
+
+      /*! \class GenerationalStrategy
+       *  \brief The generational search: the seeds covering the most new edges first, each one flipping the branches after the one of its parent. */
+      class GenerationalStrategy : public ExplorationStrategy {
+        protected:
+          //! A seed of the worklist and the order it was pushed in.
+          struct Entry {
+            //! The seed.
+            Seed seed;
+
+            //! The number of seeds pushed before it.
+            triton::usize order;
+          };
+
+          //! The worklist, as a heap of the best seed.
+          std::vector<Entry> heap;
+
+          //! The number of seeds pushed.
+          triton::usize pushed;
+
+          //! Returns true if `a` is picked after `b`: it scored less, or as much and was pushed later.
+          static bool isWorse(const Entry& a, const Entry& b);
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT GenerationalStrategy();
+
+          //! Adds a seed to the worklist.
+          TRITON_EXPORT void push(const Seed& seed);
+
+          //! Removes the seed which scored the most and returns it, the oldest one on ties.
+          TRITON_EXPORT Seed pop(void);
+
+          //! Returns true if the worklist is empty.
+          TRITON_EXPORT bool empty(void) const;
+
+          //! Returns `index + 1`, the branches before the one flipped are kept.
+          TRITON_EXPORT triton::usize getBound(const Seed& parent, triton::usize index) const;
+
+          //! Returns false.
+          TRITON_EXPORT bool isCoverageGuided(void) const;
+      };
+
+
+      /*! \class CoverageGuidedStrategy
+       *  \brief The seeds covering the most new edges first, each one flipping all its branches which were not covered by a previous run. */
+      class CoverageGuidedStrategy : public GenerationalStrategy {
+        public:
+          //! Returns 0, all the branches of the seed can be flipped.
+          TRITON_EXPORT triton::usize getBound(const Seed& parent, triton::usize index) const;
+
+          //! Returns true.
+          TRITON_EXPORT bool isCoverageGuided(void) const;
+      };
+
+
+      /*! \class DepthFirstStrategy
+       *  \brief The last seed generated first, each one flipping the branches after the one of its parent. */
+      class DepthFirstStrategy : public ExplorationStrategy {
+        protected:
+          //! The worklist, as a stack.
+          std::vector<Seed> stack;
+
+        public:
+          //! Adds a seed to the worklist.
+          TRITON_EXPORT void push(const Seed& seed);
+
+          //! Removes the last seed pushed and returns it.
+          TRITON_EXPORT Seed pop(void);
+
+          //! Returns true if the worklist is empty.
+          TRITON_EXPORT bool empty(void) const;
+
+          //! Returns `index + 1`, the branches before the one flipped are kept.
+          TRITON_EXPORT triton::usize getBound(const Seed& parent, triton::usize index) const;
+
+          //! Returns false.
+          TRITON_EXPORT bool isCoverageGuided(void) const;
+      };
+
+    /*! @} End of exploration namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_EXPLORATIONSTRATEGY_HPP */
@@ -0,0 +1,193 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_EXTERNALSOLVER_H
+#define TRITON_EXTERNALSOLVER_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/smt2Process.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/solverInterface.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/tritonToSmt2.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      //! \class ExternalSolver
+      /*! \brief Solver engine running an SMT-LIB2 solver in subprocesses.
+       *
+       * \description
+       * The queries are printed in SMT-LIB2 (see `TritonToSmt2`) and sent to a solver started with
+       * `setCommand()`, e.g. `["cvc5", "--lang=smt2", "--incremental"]` or `["z3", "-in"]`, reading its
+       * commands on its standard input. The solver processes are kept in a pool (see `Smt2ProcessPool`)
+       * and reused from one query to the next, each query being scoped between a `push` and a `pop`.
+       * A process exceeding the timeout of its query is killed, and so is the crash or the memory
+       * blowup of a solver isolated from Triton.
+       */
+      class ExternalSolver : public SolverInterface {
+        private:
+          //! The pool of solver processes, shared by the copies of the solver.
+          std::shared_ptr<Smt2ProcessPool> pool;
+
+          //! The max number of idle processes kept by the pool.
+          triton::usize poolSize;
+
+          //! The SMT solver timeout. By default, unlimited. This global timeout may be changed for a specific query (isSat/getModel/getModels) via argument `timeout`.
+          triton::uint32 timeout;
+
+          //! The SMT solver memory limit (in megabytes). By default, unlimited.
+          triton::uint32 memoryLimit;
+
+          //! Protects the processes of the running queries.
+          mutable std::mutex runningLock;
+
+          //! The processes of the running queries, killed by `interrupt()`.
+          mutable std::unordered_set<Smt2Process*> running;
+
+          //! True once the solver is interrupted.
+          std::atomic<bool> interrupted;
+
+          //! The process of the solver session.
+          std::unique_ptr<Smt2Process> session;
+
+          //! The converter of the solver session, its scopes follow the scopes of the session.
+          triton::ast::TritonToSmt2 sessionAst;
+
+          //! The commands sent in each scope of the solver session, replayed if its process is killed.
+          std::vector<std::string> sessionLog;
+
+          //! Returns a process of the pool, registered as running.
+          std::unique_ptr<Smt2Process> acquire(void) const;
+
+          //! Unregisters a process, given back to the pool if `reuse` is true.
+          void release(std::unique_ptr<Smt2Process> process, bool reuse) const;
+
+          //! Returns the process of the solver session, started and replayed if there is none.
+          Smt2Process& getSession(void);
+
+          //! Sends `commands` and a `check-sat`, and returns the answer. `healthy` is false once the process cannot be reused.
+          triton::engines::solver::status_e check(Smt2Process& process, const std::string& commands, triton::uint32 timeout, bool& healthy) const;
+
+          //! Asks for the values of `variables` into `model`. Returns false if the process does not answer.
+          bool getValues(Smt2Process& process, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& variables, triton::uint32 timeout, std::unordered_map<triton::usize, SolverModel>& model) const;
+
+          //! Returns the timeout of a query given its `timeout`.
+          triton::uint32 getQueryTimeout(triton::uint32 timeout) const;
+
+          //! Returns the logical node of a query, without its `assert`.
+          triton::ast::SharedAbstractNode getQueryNode(const triton::ast::SharedAbstractNode& node, const char* where) const;
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT ExternalSolver();
+
+          //! Constructor. The copy shares the pool of solver processes and has no solver session.
+          TRITON_EXPORT ExternalSolver(const ExternalSolver& other);
+
+          //! Computes and returns a model from a symbolic constraint. State is returned in the `status` pointer as well as the solving time. A `timeout` can also be defined.
+          /*! \brief map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT std::unordered_map<triton::usize, SolverModel> getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
+          //! Computes and returns several models from a symbolic constraint. The `limit` is the number of models returned. State is returned in the `status` pointer as well as the solving time. A `timeout` can also be defined.
+          /*! \brief vector of map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT std::vector<std::unordered_map<triton::usize, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
+          //! Computes at most `limit` models from a symbolic constraint, projected onto `variables` if not empty, and gives them to `callback` as they are found. Returns the number of models given.
+          TRITON_EXPORT triton::usize enumerateModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, const ModelCallback& callback, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& variables = {}, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
+          //! Returns true if an expression is satisfiable.
+          TRITON_EXPORT bool isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
+          //! Returns the name of this solver.
+          TRITON_EXPORT std::string getName(void) const;
+
+          //! Defines a solver timeout (in milliseconds). The process of a query exceeding it is killed.
+          TRITON_EXPORT void setTimeout(triton::uint32 ms);
+
+          //! Defines a solver memory consumption limit (in megabytes), enforced on the address space of the processes.
+          TRITON_EXPORT void setMemoryLimit(triton::uint32 mem);
+
+          //! Interrupts the running queries by killing their processes, from any thread. They and the next ones return UNKNOWN.
+          TRITON_EXPORT void interrupt(void);
+
+          //! Asserts a constraint into the solver session. The terms shared with the previous constraints are not printed again.
+          TRITON_EXPORT void pushConstraint(const triton::ast::SharedAbstractNode& node);
+
+          //! Opens a new scope in the solver session.
+          TRITON_EXPORT void push(void);
+
+          //! Closes the `count` innermost scopes of the solver session and drops their constraints.
+          TRITON_EXPORT void pop(triton::uint32 count = 1);
+
+          //! Computes a model of the constraints of the solver session and of the `assumptions`, which are not kept once the check is done.
+          TRITON_EXPORT std::unordered_map<triton::usize, SolverModel> checkWithAssumptions(const std::vector<triton::ast::SharedAbstractNode>& assumptions, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr);
+
+          //! Drops all the scopes and constraints of the solver session, and its process.
+          TRITON_EXPORT void resetSession(void);
+
+          //! Returns the command running the solver, empty if none.
+          TRITON_EXPORT std::vector<std::string> getCommand(void) const;
+
+          //! Defines the command running the solver. Its standard input and output are the SMT-LIB2 commands and answers.
+          TRITON_EXPORT void setCommand(const std::vector<std::string>& command);
+
+          //! Returns the max number of idle solver processes kept.
+          TRITON_EXPORT triton::usize getPoolSize(void) const;
+
+          //! Defines the max number of idle solver processes kept. By default, 4.
+          TRITON_EXPORT void setPoolSize(triton::usize size);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_EXTERNALSOLVER_H */
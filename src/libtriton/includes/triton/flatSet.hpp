@@ -0,0 +1,147 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_FLATSET_H
+#define TRITON_FLATSET_H
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Utils namespace
+  namespace utils {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup utils
+   *  @{
+   */
+
+    //! \class FlatSet
+    /*! \brief Ordered set of unique items, stored in a sorted vector.
+     *
+     * \description
+     * The set has the interface and the order of `std::set` for the few items an instruction reads
+     * or writes: an insertion searches its position and shifts the items after it, instead of
+     * allocating a node. Clearing the set keeps its capacity, so a set reused from an instruction
+     * to the next one does not allocate once it is large enough. Like the iterators of `std::set`,
+     * the iterators only give constant access to the items, which must stay sorted.
+     */
+    template <typename T>
+    class FlatSet {
+      public:
+        //! The type of items.
+        using value_type = T;
+
+        //! The type of sizes.
+        using size_type = typename std::vector<T>::size_type;
+
+        //! A constant iterator over the items, in increasing order.
+        using const_iterator = typename std::vector<T>::const_iterator;
+
+        //! The iterators of the set are constant.
+        using iterator = const_iterator;
+
+      private:
+        //! The capacity reserved by the first insertion.
+        static const triton::usize initialCapacity = 4;
+
+        //! The items, sorted by `operator<`.
+        std::vector<T> items;
+
+      public:
+        //! Returns an iterator on the first item.
+        const_iterator begin(void) const {
+          return this->items.cbegin();
+        }
+
+        //! Returns an iterator past the last item.
+        const_iterator end(void) const {
+          return this->items.cend();
+        }
+
+        //! Returns an iterator on the first item.
+        const_iterator cbegin(void) const {
+          return this->items.cbegin();
+        }
+
+        //! Returns an iterator past the last item.
+        const_iterator cend(void) const {
+          return this->items.cend();
+        }
+
+        //! Returns the number of items.
+        size_type size(void) const {
+          return this->items.size();
+        }
+
+        //! Returns true if the set is empty.
+        bool empty(void) const {
+          return this->items.empty();
+        }
+
+        //! Removes all items, the capacity is kept.
+        void clear(void) {
+          this->items.clear();
+        }
+
+        //! Returns an iterator on the item equivalent to `value`, or end().
+        const_iterator find(const T& value) const {
+          auto it = std::lower_bound(this->items.cbegin(), this->items.cend(), value);
+          if (it != this->items.cend() && !(value < *it))
+            return it;
+          return this->items.cend();
+        }
+
+        //! Returns 1 if an item is equivalent to `value`, 0 otherwise.
+        size_type count(const T& value) const {
+          return (this->find(value) != this->items.cend()) ? 1 : 0;
+        }
+
+        //! Inserts `value` if no item is equivalent to it. Returns an iterator on the item, and true if it was inserted.
+        std::pair<const_iterator, bool> insert(const T& value) {
+          if (this->items.capacity() == 0)
+            this->items.reserve(initialCapacity);
+
+          auto it = std::lower_bound(this->items.begin(), this->items.end(), value);
+          if (it != this->items.end() && !(value < *it))
+            return std::make_pair(const_iterator(it), false);
+
+          return std::make_pair(const_iterator(this->items.insert(it, value)), true);
+        }
+
+        //! Removes the item at `position`. Returns an iterator on the next item.
+        const_iterator erase(const_iterator position) {
+          return this->items.erase(position);
+        }
+
+        //! Removes the item equivalent to `value`. Returns the number of removed items.
+        size_type erase(const T& value) {
+          auto it = this->find(value);
+          if (it == this->items.cend())
+            return 0;
+          this->items.erase(it);
+          return 1;
+        }
+    };
+
+  /*! @} End of utils namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_FLATSET_H */
@@ -0,0 +1,157 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_FUNCTIONSUMMARIES_H
+#define TRITON_FUNCTIONSUMMARIES_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <triton/architecture.hpp>
+#include <triton/astContext.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/instruction.hpp>
+#include <triton/operandWrapper.hpp>
+#include <triton/symbolicEngine.hpp>
+#include <triton/taintEngine.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    /*! \class FunctionSummaries
+     *  \brief The built-in models of libc functions, executed instead of their instructions.
+     *
+     * \description
+     * A model is bound to the address of a function by the symbol of the function. When the instruction
+     * at this address is processed, the model reads the arguments from the calling convention of
+     * the architecture (System V for x86-64, cdecl for x86, AAPCS for AArch64 and ARM32), updates the
+     * concrete and symbolic memories directly, sets the return value and returns to the caller. The
+     * expressions of copied memory cells are shared with their destination instead of being rebuilt.
+     * The loop of a function over the bytes of a string is summarized by a single path constraint
+     * on the symbolic bytes it read, instead of one branch per byte. A symbolized pointer or size is
+     * concretized, and a path constraint keeps its value.
+     */
+    class FunctionSummaries {
+      private:
+        //! The built-in models.
+        enum model_e {
+          MODEL_MEMCPY,   //!< void* memcpy(void* dst, const void* src, size_t n)
+          MODEL_MEMMOVE,  //!< void* memmove(void* dst, const void* src, size_t n)
+          MODEL_MEMSET,   //!< void* memset(void* dst, int c, size_t n)
+          MODEL_STRCMP,   //!< int strcmp(const char* s1, const char* s2)
+          MODEL_STRLEN,   //!< size_t strlen(const char* s)
+          MODEL_STRNCPY,  //!< char* strncpy(char* dst, const char* src, size_t n)
+        };
+
+        //! Architecture API
+        triton::arch::Architecture* architecture;
+
+        //! Symbolic Engine API
+        triton::engines::symbolic::SymbolicEngine* symbolicEngine;
+
+        //! Taint Engine API
+        triton::engines::taint::TaintEngine* taintEngine;
+
+        //! The AST Context API
+        triton::ast::SharedAstContext astCtxt;
+
+        //! Maps the address of a function to its model.
+        std::map<triton::uint64, model_e> summaries;
+
+        //! Maps the symbol of a function to its model.
+        static const std::map<std::string, model_e>& getModels(void);
+
+        //! Returns the argument `index` of the function, in the calling convention of the architecture.
+        triton::arch::OperandWrapper getArgument(triton::uint32 index) const;
+
+        //! Returns the AST of the argument `index`, read by `inst`.
+        triton::ast::SharedAbstractNode getArgumentAst(triton::arch::Instruction& inst, triton::uint32 index);
+
+        //! Returns the concrete value of `node`. A symbolized node is concretized under a path constraint.
+        triton::uint64 concretize(const triton::ast::SharedAbstractNode& node);
+
+        //! Returns the AST of the byte at `addr`, and adds the taint of the byte to `tainted`.
+        triton::ast::SharedAbstractNode getByteAst(triton::uint64 addr, bool& tainted) const;
+
+        //! Adds `constraint` to `constraints` if it is symbolized.
+        void addConstraint(std::vector<triton::ast::SharedAbstractNode>& constraints, const triton::ast::SharedAbstractNode& constraint) const;
+
+        //! Pushes the conjunction of `constraints` as a path constraint.
+        void pushConstraints(const std::vector<triton::ast::SharedAbstractNode>& constraints);
+
+        //! Moves the concrete values and the expressions of [src, src+size) to [dst, dst+size), as memmove does.
+        void moveMemory(triton::uint64 dst, triton::uint64 src, triton::usize size);
+
+        //! Sets the concrete values of [dst, dst+size) to `value` and concretizes them.
+        void fillMemory(triton::uint64 dst, triton::uint8 value, triton::usize size);
+
+        //! Sets the return value of the function, the node is zero extended to the size of the return register.
+        void setReturnValue(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, bool tainted);
+
+        //! Returns to the caller of the function.
+        void returnToCaller(triton::arch::Instruction& inst);
+
+        //! The memcpy and memmove models.
+        void memcpyModel(triton::arch::Instruction& inst);
+
+        //! The memset model.
+        void memsetModel(triton::arch::Instruction& inst);
+
+        //! The strcmp model.
+        void strcmpModel(triton::arch::Instruction& inst);
+
+        //! The strlen model.
+        void strlenModel(triton::arch::Instruction& inst);
+
+        //! The strncpy model.
+        void strncpyModel(triton::arch::Instruction& inst);
+
+      public:
+        //! Constructor.
+        TRITON_EXPORT FunctionSummaries(triton::arch::Architecture* architecture,
+                                        triton::engines::symbolic::SymbolicEngine* symbolicEngine,
+                                        triton::engines::taint::TaintEngine* taintEngine,
+                                        const triton::ast::SharedAstContext& astCtxt);
+
+        //! Binds the model of the function `symbol` to `addr`.
+        TRITON_EXPORT void setSummary(triton::uint64 addr, const std::string& symbol);
+
+        //! Removes the model bound to `addr`.
+        TRITON_EXPORT void removeSummary(triton::uint64 addr);
+
+        //! Returns true if a model is bound to `addr`.
+        TRITON_EXPORT bool isSummarized(triton::uint64 addr) const;
+
+        //! Returns the symbol of the model bound to each address.
+        TRITON_EXPORT std::map<triton::uint64, std::string> getSummaries(void) const;
+
+        //! Executes the model bound to the address of `inst` instead of its semantics. Returns false, and changes nothing, if no model is bound to it.
+        TRITON_EXPORT bool execute(triton::arch::Instruction& inst);
+    };
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_FUNCTIONSUMMARIES_H */
@@ -0,0 +1,183 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_FUZZERBRIDGE_HPP
+#define TRITON_FUZZERBRIDGE_HPP
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <triton/dllexport.hpp>
+#include <triton/explorationEngine.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  class API;
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Exploration namespace
+    namespace exploration {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup exploration
+     *  @{
+     */
+
+      /*! \struct FuzzerBridgeOptions
+       *  \brief The options of a synchronization with a fuzzer (see `FuzzerBridge::sync()`). */
+      struct FuzzerBridgeOptions {
+        //! The directory of the fuzzer instance, holding its `queue` and its `fuzz_bitmap` (e.g. `out/default`).
+        std::string fuzzer;
+
+        //! The directory of the bridge, in the sync directory of the fuzzer (e.g. `out/triton`). Its `queue` holds the inputs solved.
+        std::string output;
+
+        //! The ids of the symbolic variables of the input, one byte each: the byte `i` of a testcase is the value of the variable `input[i]`.
+        std::vector<triton::usize> input;
+
+        //! The addresses where a run stops.
+        std::set<triton::uint64> exits;
+
+        //! The max number of instructions executed by a run.
+        triton::usize maxInstructions = 100000;
+
+        //! True if only the testcases the fuzzer tagged with `+cov` (new edges) and its seeds are run, otherwise all of them.
+        bool newEdgesOnly = true;
+
+        //! True if the branch flips of a run are solved on the threads of the solver (see `SolverEngine::setThreads()`).
+        bool parallel = false;
+
+        //! The timeout of each query (in milliseconds), 0 for the solver's one.
+        triton::uint32 timeout = 0;
+
+        //! True if the UNSAT cores of the branch flips are computed, the flips of the next runs containing one being UNSAT without the solver.
+        bool unsatCores = false;
+
+        //! The time `watch()` synchronizes for (in milliseconds), 0 for a single synchronization.
+        triton::uint64 timeLimit = 0;
+
+        //! The delay between two synchronizations of `watch()` (in milliseconds).
+        triton::uint32 interval = 1000;
+      };
+
+
+      /*! \struct FuzzerBridgeResult
+       *  \brief The work of the synchronizations with a fuzzer. */
+      struct FuzzerBridgeResult {
+        //! The number of new testcases of the fuzzer.
+        triton::usize entries = 0;
+
+        //! The number of new testcases not run: synchronized from the bridge, or without new edges with `newEdgesOnly`.
+        triton::usize skipped = 0;
+
+        //! The number of runs.
+        triton::usize runs = 0;
+
+        //! The number of instructions executed by the runs.
+        triton::usize instructions = 0;
+
+        //! The number of branches flipped, the ones whose edge was covered by the fuzzer or a previous run excluded.
+        triton::usize flips = 0;
+
+        //! The number of branches flipped whose query is SAT.
+        triton::usize solved = 0;
+
+        //! The number of branches flipped whose query contains an UNSAT core, UNSAT without the solver.
+        triton::usize pruned = 0;
+
+        //! The number of testcases written to the queue of the bridge.
+        triton::usize written = 0;
+      };
+
+
+      /*! \class FuzzerBridge
+       *  \brief Runs the testcases of a fuzzer such as AFL++ and writes back the inputs taking the branches it did not cover.
+       *
+       * \details
+       * The bridge follows the synchronization protocol of AFL: it reads the testcases `id:NNNNNN,...` of the queue of the fuzzer
+       * from the last one it synchronized, recorded in `output/.synced/`, and writes its inputs into `output/queue`, from which the
+       * fuzzer imports them when the bridge directory is in its sync directory (`-o`). Each testcase runs in a fork of the context,
+       * its bytes set into the variables of `input` (0 beyond its size), until an exit, an undefined or unsupported instruction, or
+       * `maxInstructions`. The branches of its path constraints whose edge is not covered yet are flipped in one batch.
+       *
+       * The coverage is a map of `BITMAP_SIZE` bytes in the layout of the QEMU mode of AFL: the edge into the block at `addr`
+       * from the previous block is the entry `((addr >> 4) ^ (addr << 8)) % BITMAP_SIZE ^ (previous >> 1)`, `previous` being the
+       * same hash for the block left. It holds the virgin bits as AFL does, a byte being 0xff until an edge hits it. The
+       * `fuzz_bitmap` of the fuzzer is merged before each synchronization and the map of the bridge is saved in `output/fuzz_bitmap`.
+       * The values of the variables of the context are restored once done.
+       */
+      class FuzzerBridge {
+        private:
+          //! The context forked by the runs.
+          triton::API* ctx;
+
+          //! The options of the synchronizations.
+          triton::engines::exploration::FuzzerBridgeOptions options;
+
+          //! The virgin bits of the edges covered by the fuzzer and the runs.
+          std::vector<triton::uint8> virgin;
+
+          //! The UNSAT cores of the branch flips, as the hashes of their predicates.
+          std::vector<std::vector<triton::uint128>> cores;
+
+          //! The id of the next testcase of the bridge.
+          triton::uint32 nextId;
+
+          //! Returns the entry of the coverage map of the edge from the block at `src` to the one at `dst`.
+          static triton::usize getEdge(triton::uint64 src, triton::uint64 dst);
+
+          //! Runs `data` from `entry`, merges its coverage and returns its path constraints. The blocks holding each branch are returned in `blocks`.
+          std::vector<triton::engines::symbolic::PathConstraint> execute(const std::vector<triton::uint8>& data, triton::uint64 entry, std::map<triton::uint64, triton::uint64>& blocks, FuzzerBridgeResult& result);
+
+          //! Flips the branches of a run not covered yet and writes the inputs solved. `data` is the testcase of the run and `src` its id.
+          void flip(const std::vector<triton::uint8>& data, triton::uint32 src, const std::vector<triton::engines::symbolic::PathConstraint>& trace, const std::map<triton::uint64, triton::uint64>& blocks, FuzzerBridgeResult& result);
+
+          //! Synchronizes once, without restoring the values of the variables.
+          void step(triton::uint64 entry, FuzzerBridgeResult& result);
+
+        public:
+          //! Constructor. The directories of the bridge are created and its map is loaded.
+          TRITON_EXPORT FuzzerBridge(triton::API* ctx, const FuzzerBridgeOptions& options);
+
+          //! Runs the new testcases of the fuzzer from `entry` and writes the inputs flipping their branches.
+          TRITON_EXPORT FuzzerBridgeResult sync(triton::uint64 entry);
+
+          //! Synchronizes every `interval` milliseconds for `timeLimit` milliseconds, once if it is 0.
+          TRITON_EXPORT FuzzerBridgeResult watch(triton::uint64 entry);
+
+          //! Returns the virgin bits of the edges covered by the fuzzer and the runs, in the layout of AFL.
+          TRITON_EXPORT const std::vector<triton::uint8>& getBitmap(void) const;
+
+          //! Classifies the hits of a trace into the buckets of AFL and clears them from `virgin`. Returns true if a bucket was new.
+          TRITON_EXPORT static bool mergeTrace(std::vector<triton::uint8>& virgin, const std::vector<triton::uint8>& trace);
+      };
+
+    /*! @} End of exploration namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_FUZZERBRIDGE_HPP */
@@ -13,12 +13,14 @@
 #include <ostream>
 #include <set>
 #include <sstream>
+#include <string>
 #include <utility>
 #include <vector>
 
 #include <triton/archEnums.hpp>
 #include <triton/ast.hpp>
 #include <triton/dllexport.hpp>
+#include <triton/flatSet.hpp>
 #include <triton/memoryAccess.hpp>
 #include <triton/operandWrapper.hpp>
 #include <triton/register.hpp>
@@ -53,8 +55,11 @@ namespace triton {
         //! The address of the instruction.
         triton::uint64 address;
 
-        //! The disassembly of the instruction. This field is set at the disassembly level.
-        std::stringstream disassembly;
+        //! The mnemonic of the instruction. This field is set at the disassembly level.
+        std::string mnemonic;
+
+        //! The operands of the instruction, as disassembled. This field is set at the disassembly level.
+        std::string operandsText;
 
         //! The opcode of the instruction.
         triton::uint8 opcode[32];
@@ -71,23 +76,26 @@ namespace triton {
         //! The code condition of the instruction. This field is set at the disassembly level. Mainly used for AArch64.
         triton::arch::arm::condition_e codeCondition;
 
+        //! The specialized semantics handler of the instruction, 0 if none. This field is set at the disassembly level. Mainly used for X86.
+        triton::uint32 handler;
+
         //! Implicit and explicit load access (read). This field is set at the semantics level.
-        std::set<std::pair<triton::arch::MemoryAccess, triton::ast::SharedAbstractNode>> loadAccess;
+        triton::utils::FlatSet<std::pair<triton::arch::MemoryAccess, triton::ast::SharedAbstractNode>> loadAccess;
 
         //! Implicit and explicit store access (write). This field is set at the semantics level.
-        std::set<std::pair<triton::arch::MemoryAccess, triton::ast::SharedAbstractNode>> storeAccess;
+        triton::utils::FlatSet<std::pair<triton::arch::MemoryAccess, triton::ast::SharedAbstractNode>> storeAccess;
 
         //! Implicit and explicit register inputs (read). This field is set at the semantics level.
-        std::set<std::pair<triton::arch::Register, triton::ast::SharedAbstractNode>> readRegisters;
+        triton::utils::FlatSet<std::pair<triton::arch::Register, triton::ast::SharedAbstractNode>> readRegisters;
 
         //! Implicit and explicit register outputs (write). This field is set at the semantics level.
-        std::set<std::pair<triton::arch::Register, triton::ast::SharedAbstractNode>> writtenRegisters;
+        triton::utils::FlatSet<std::pair<triton::arch::Register, triton::ast::SharedAbstractNode>> writtenRegisters;
 
         //! Implicit and explicit immediate inputs (read). This field is set at the semantics level.
-        std::set<std::pair<triton::arch::Immediate, triton::ast::SharedAbstractNode>> readImmediates;
+        triton::utils::FlatSet<std::pair<triton::arch::Immediate, triton::ast::SharedAbstractNode>> readImmediates;
 
         //! Implicit and explicit undefined registers. This field is set at the semantics level.
-        std::set<triton::arch::Register> undefinedRegisters;
+        triton::utils::FlatSet<triton::arch::Register> undefinedRegisters;
 
         //! True if this instruction is a branch. This field is set at the disassembly level.
         bool branch;
@@ -154,9 +162,15 @@ namespace triton {
         //! Sets the address of the instruction.
         TRITON_EXPORT void setAddress(triton::uint64 addr);
 
-        //! Returns the disassembly of the instruction.
+        //! Returns the disassembly of the instruction. The string is built from the mnemonic and the operands on each call.
         TRITON_EXPORT std::string getDisassembly(void) const;
 
+        //! Returns the mnemonic of the instruction.
+        TRITON_EXPORT const std::string& getMnemonic(void) const;
+
+        //! Returns the operands of the instruction, as disassembled.
+        TRITON_EXPORT const std::string& getOperandsText(void) const;
+
         //! Returns the opcode of the instruction.
         TRITON_EXPORT const triton::uint8* getOpcode(void) const;
 
@@ -169,23 +183,26 @@ namespace triton {
         //! Returns the code codition of the instruction (mainly for AArch64).
         TRITON_EXPORT triton::arch::arm::condition_e getCodeCondition(void) const;
 
+        //! Returns the specialized semantics handler selected when the instruction was decoded, 0 if none (mainly for X86).
+        TRITON_EXPORT triton::uint32 getSemanticsHandler(void) const;
+
         //! Returns the list of all implicit and explicit load access
-        TRITON_EXPORT std::set<std::pair<triton::arch::MemoryAccess, triton::ast::SharedAbstractNode>>& getLoadAccess(void);
+        TRITON_EXPORT triton::utils::FlatSet<std::pair<triton::arch::MemoryAccess, triton::ast::SharedAbstractNode>>& getLoadAccess(void);
 
         //! Returns the list of all implicit and explicit store access
-        TRITON_EXPORT std::set<std::pair<triton::arch::MemoryAccess, triton::ast::SharedAbstractNode>>& getStoreAccess(void);
+        TRITON_EXPORT triton::utils::FlatSet<std::pair<triton::arch::MemoryAccess, triton::ast::SharedAbstractNode>>& getStoreAccess(void);
 
         //! Returns the list of all implicit and explicit register (flags includes) inputs (read)
-        TRITON_EXPORT std::set<std::pair<triton::arch::Register, triton::ast::SharedAbstractNode>>& getReadRegisters(void);
+        TRITON_EXPORT triton::utils::FlatSet<std::pair<triton::arch::Register, triton::ast::SharedAbstractNode>>& getReadRegisters(void);
 
         //! Returns the list of all implicit and explicit register (flags includes) outputs (write)
-        TRITON_EXPORT std::set<std::pair<triton::arch::Register, triton::ast::SharedAbstractNode>>& getWrittenRegisters(void);
+        TRITON_EXPORT triton::utils::FlatSet<std::pair<triton::arch::Register, triton::ast::SharedAbstractNode>>& getWrittenRegisters(void);
 
         //! Returns the list of all implicit and explicit immediate inputs (read)
-        TRITON_EXPORT std::set<std::pair<triton::arch::Immediate, triton::ast::SharedAbstractNode>>& getReadImmediates(void);
+        TRITON_EXPORT triton::utils::FlatSet<std::pair<triton::arch::Immediate, triton::ast::SharedAbstractNode>>& getReadImmediates(void);
 
         //! Returns the list of all implicit and explicit undefined registers.
-        TRITON_EXPORT std::set<triton::arch::Register>& getUndefinedRegisters(void);
+        TRITON_EXPORT triton::utils::FlatSet<triton::arch::Register>& getUndefinedRegisters(void);
 
         //! Sets the opcode of the instruction.
         TRITON_EXPORT void setOpcode(const triton::uint8* opcode, triton::uint32 size);
@@ -241,9 +258,15 @@ namespace triton {
         //! Sets the code condition of the instruction (mainly for AArch64).
         TRITON_EXPORT void setCodeCondition(triton::arch::arm::condition_e codeCondition);
 
+        //! Sets the specialized semantics handler of the instruction (mainly for X86).
+        TRITON_EXPORT void setSemanticsHandler(triton::uint32 handler);
+
         //! Sets the disassembly of the instruction.
         TRITON_EXPORT void setDisassembly(const std::string& str);
 
+        //! Sets the disassembly of the instruction from its mnemonic and its operands.
+        TRITON_EXPORT void setDisassembly(const char* mnemonic, const char* operands);
+
         //! Sets the taint of the instruction.
         TRITON_EXPORT void setTaint(bool state);
 
@@ -310,8 +333,11 @@ namespace triton {
         //! Sets flag to define if the condition is taken or not.
         TRITON_EXPORT void setConditionTaken(bool flag);
 
-        //! Clears all instruction information.
+        //! Clears all instruction information. The containers keep their capacity.
         TRITON_EXPORT void clear(void);
+
+        //! Clears the instruction and sets its address and opcode, so that a processing loop reuses one instance without allocating.
+        TRITON_EXPORT void reset(triton::uint64 addr, const triton::uint8* opcode, triton::uint32 opSize);
     };
 
     //! Displays an Instruction.
@@ -8,13 +8,20 @@
 #ifndef TRITON_IRBUILDER_H
 #define TRITON_IRBUILDER_H
 
+#include <unordered_map>
+
 #include <triton/architecture.hpp>
+#include <triton/coverage.hpp>
 #include <triton/dllexport.hpp>
+#include <triton/functionSummaries.hpp>
 #include <triton/instruction.hpp>
 #include <triton/modes.hpp>
+#include <triton/processingStatistics.hpp>
+#include <triton/semanticsCache.hpp>
 #include <triton/semanticsInterface.hpp>
 #include <triton/symbolicEngine.hpp>
 #include <triton/taintEngine.hpp>
+#include <triton/x86TaintSummaries.hpp>
 
 
 
@@ -55,6 +62,15 @@ namespace triton {
         //! Taint engine API
         triton::engines::taint::TaintEngine* taintEngine;
 
+        //! The statistics of the processing.
+        triton::arch::ProcessingStatistics* statistics;
+
+        //! The coverage of the processing.
+        triton::arch::Coverage* coverage;
+
+        //! The last definition of each parent register, used to find dead definitions.
+        std::unordered_map<triton::arch::register_e, triton::engines::symbolic::WeakSymbolicExpression> definitions;
+
         //! Removes all symbolic expressions of an instruction.
         void removeSymbolicExpressions(triton::arch::Instruction& inst);
 
@@ -70,6 +86,27 @@ namespace triton {
         //! Collects unsymbolized nodes from operands.
         void collectUnsymbolizedNodes(std::vector<triton::arch::OperandWrapper>& operands) const;
 
+        //! Releases the AST of register definitions overwritten by the instruction before being read.
+        void pruneDeadDefinitions(const triton::arch::Instruction& inst);
+
+        //! Records the address of the instruction and, if it modifies the control flow, its edge into the coverage.
+        void recordCoverage(const triton::arch::Instruction& inst);
+
+        //! The recorded semantics of x86 instructions, used by the `SEMANTICS_CACHE` mode.
+        triton::engines::symbolic::SemanticsCache semanticsCache;
+
+        //! Returns the semantics of the architecture.
+        triton::arch::SemanticsInterface* getSemantics(triton::arch::architecture_e arch) const;
+
+        //! Returns the path of the semantics of the instruction, from the modes and the interest of what it may read.
+        triton::arch::semantics_path_e getSemanticsPath(const triton::arch::Instruction& inst) const;
+
+        //! Returns true if the semantics of the x86 instruction only depends on its decoding, and may be recorded and replayed.
+        bool isSemanticsCacheable(const triton::arch::Instruction& inst) const;
+
+        //! Builds the semantics of the x86 instruction from the semantics cache, or records it. Returns true if the instruction is supported.
+        bool buildCachedSemantics(triton::arch::Instruction& inst);
+
       protected:
         //! AArch64 ISA builder.
         triton::arch::SemanticsInterface* aarch64Isa;
@@ -80,13 +117,21 @@ namespace triton {
         //! x86 ISA builder.
         triton::arch::SemanticsInterface* x86Isa;
 
+        //! x86 taint summaries, used by the `TAINT_SUMMARIES` mode.
+        triton::arch::x86::x86TaintSummaries* x86TaintSummaries;
+
+        //! The models of libc functions, executed instead of the instructions of the functions.
+        triton::arch::FunctionSummaries* functionSummaries;
+
       public:
         //! Constructor.
         TRITON_EXPORT IrBuilder(triton::arch::Architecture* architecture,
                                 const triton::modes::SharedModes& modes,
                                 const triton::ast::SharedAstContext& astCtxt,
                                 triton::engines::symbolic::SymbolicEngine* symbolicEngine,
-                                triton::engines::taint::TaintEngine* taintEngine);
+                                triton::engines::taint::TaintEngine* taintEngine,
+                                triton::arch::ProcessingStatistics* statistics,
+                                triton::arch::Coverage* coverage);
 
         //! Destructor.
         TRITON_EXPORT virtual ~IrBuilder();
@@ -94,6 +139,9 @@ namespace triton {
         //! Builds the semantics of the instruction. Returns true if the instruction is supported.
         TRITON_EXPORT bool buildSemantics(triton::arch::Instruction& inst);
 
+        //! Returns the models of libc functions bound to addresses.
+        TRITON_EXPORT triton::arch::FunctionSummaries& getFunctionSummaries(void);
+
         //! Everything which must be done before buiding the semantics
         TRITON_EXPORT void preIrInit(triton::arch::Instruction& inst);
 
@@ -11,6 +11,7 @@
 #include <triton/astContext.hpp>
 #include <triton/config.hpp>
 #include <triton/dllexport.hpp>
+#include <triton/liftingToC.hpp>
 #include <triton/liftingToPython.hpp>
 #include <triton/liftingToSMT.hpp>
 #include <triton/symbolicEngine.hpp>
@@ -52,6 +53,7 @@ namespace triton {
           #ifdef TRITON_LLVM_INTERFACE
           public LiftingToLLVM,
           #endif
+          public LiftingToC,
           public LiftingToPython {
 
         public:
@@ -61,6 +63,7 @@ namespace triton {
               #ifdef TRITON_LLVM_INTERFACE
               LiftingToLLVM(),
               #endif
+              LiftingToC(),
               LiftingToPython(astCtxt, symbolic) {
           };
       };
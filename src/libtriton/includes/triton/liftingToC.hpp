@@ -0,0 +1,89 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_LIFTINGTOC_HPP
+#define TRITON_LIFTINGTOC_HPP
+
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/symbolicExpression.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Lifters namespace
+    namespace lifters {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup lifters
+     *  @{
+     */
+
+      //! \class LiftingToC
+      /*! \brief The lifting to C class.
+       *
+       * \description
+       * Lifts ASTs into self-contained C functions (C99), which any C compiler builds without Triton or
+       * LLVM. The bitvectors of 64 bits or less are `uint64_t`, the ones of 128 bits or less are
+       * `unsigned __int128` (GCC and Clang), wider ones are not supported. Each node used by the
+       * AST is computed once into a local, in topological order, and the symbolic variables are the
+       * arguments of the function, ordered by id.
+       */
+      class LiftingToC {
+        private:
+          //! Prints the helpers of the bitvectors held in `bits` bits, once per translation unit.
+          void requiredFunctions(std::ostream& stream, triton::uint32 bits);
+
+          //! Prints the locals computing the nodes of `roots` and returns the C expression of each node. The variables read are added to `arguments` (name and size), `wide` is set if a node needs 128 bits.
+          std::unordered_map<triton::ast::AbstractNode*, std::string> body(std::ostream& stream, const std::vector<triton::ast::SharedAbstractNode>& roots, std::vector<std::pair<std::string, triton::uint32>>& arguments, bool& wide) const;
+
+          //! Prints a function computing `outputs`. If `returned` is true, the function returns the single output, otherwise it writes each one through a pointer argument.
+          std::ostream& function(std::ostream& stream, const std::vector<std::pair<std::string, triton::ast::SharedAbstractNode>>& outputs, const char* fname, bool returned);
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT LiftingToC();
+
+          //! Lifts a symbolic expression and all its references to a C function returning its value. `fname` represents the name of the C function.
+          TRITON_EXPORT std::ostream& liftToC(std::ostream& stream, const triton::engines::symbolic::SharedSymbolicExpression& expr, const char* fname="__triton");
+
+          //! Lifts an abstract node and all its references to a C function returning its value. `fname` represents the name of the C function.
+          TRITON_EXPORT std::ostream& liftToC(std::ostream& stream, const triton::ast::SharedAbstractNode& node, const char* fname="__triton");
+
+          //! Lifts several abstract nodes into one C function which writes them through pointer arguments named by `outputs[i].first`. `fname` represents the name of the C function.
+          TRITON_EXPORT std::ostream& liftToC(std::ostream& stream, const std::vector<std::pair<std::string, triton::ast::SharedAbstractNode>>& outputs, const char* fname="__triton");
+      };
+
+    /*! @} End of lifters namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_LIFTINGTOC_HPP */
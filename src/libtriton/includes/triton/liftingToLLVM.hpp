@@ -11,6 +11,9 @@
 #include <map>
 #include <memory>
 #include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include <triton/ast.hpp>
 #include <triton/dllexport.hpp>
@@ -54,6 +57,12 @@ namespace triton {
           //! Lifts a abstract node and all its references to LLVM format. `fname` represents the name of the LLVM function.
           TRITON_EXPORT std::ostream& liftToLLVM(std::ostream& stream, const triton::ast::SharedAbstractNode& node, const char* fname="__triton", bool optimize=false);
 
+          //! Lifts several abstract nodes and all their references into one LLVM module. The function of `nodes[i]` is named `fname_i`.
+          TRITON_EXPORT std::ostream& liftToLLVM(std::ostream& stream, const std::vector<triton::ast::SharedAbstractNode>& nodes, const char* fname="__triton", bool optimize=false);
+
+          //! Lifts several abstract nodes into one LLVM function which writes them through pointer arguments named by `outputs[i].first`. `fname` represents the name of the LLVM function.
+          TRITON_EXPORT std::ostream& liftToLLVM(std::ostream& stream, const std::vector<std::pair<std::string, triton::ast::SharedAbstractNode>>& outputs, const char* fname="__triton", bool optimize=false);
+
           //! Lifts and simplify an AST using LLVM
           TRITON_EXPORT triton::ast::SharedAbstractNode simplifyAstViaLLVM(const triton::ast::SharedAbstractNode& node) const;
       };
@@ -53,12 +53,15 @@ namespace triton {
           //! Define required functions like ror, rol, sx and forall
           void requiredFunctions(std::ostream& stream);
 
+          //! Define the lane-wise functions, using numpy vectors when available
+          void laneFunctions(std::ostream& stream);
+
         public:
           //! Constructor.
           TRITON_EXPORT LiftingToPython(const triton::ast::SharedAstContext& astCtxt, triton::engines::symbolic::SymbolicEngine* symbolic);
 
-          //! Lifts a symbolic expression and all its references to Python format.
-          TRITON_EXPORT std::ostream& liftToPython(std::ostream& stream, const triton::engines::symbolic::SharedSymbolicExpression& expr);
+          //! Lifts a symbolic expression and all its references to Python format. If `shared` is true, shared nodes are assigned once.
+          TRITON_EXPORT std::ostream& liftToPython(std::ostream& stream, const triton::engines::symbolic::SharedSymbolicExpression& expr, bool shared=false);
       };
 
     /*! @} End of lifters namespace */
@@ -57,8 +57,8 @@ namespace triton {
           //! Constructor.
           TRITON_EXPORT LiftingToSMT(const triton::ast::SharedAstContext& astCtxt, triton::engines::symbolic::SymbolicEngine* symbolic);
 
-          //! Lifts a symbolic expression and all its references to SMT format. If `assert_` is true, then (assert <expr>).
-          TRITON_EXPORT std::ostream& liftToSMT(std::ostream& stream, const triton::engines::symbolic::SharedSymbolicExpression& expr, bool assert_);
+          //! Lifts a symbolic expression and all its references to SMT format. If `assert_` is true, then (assert <expr>). If `shared` is true, shared nodes are defined once.
+          TRITON_EXPORT std::ostream& liftToSMT(std::ostream& stream, const triton::engines::symbolic::SharedSymbolicExpression& expr, bool assert_, bool shared=false);
       };
 
     /*! @} End of lifters namespace */
@@ -12,6 +12,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 
 #include <triton/ast.hpp>
 #include <triton/astContext.hpp>
@@ -49,9 +50,18 @@ namespace triton {
         //! Map of triton symbolic variables
         std::map<std::string, SharedAbstractNode> symvars;
 
-        //! Converts nodes
+        //! The nodes converted by the current `convert()`, by LLVM value.
+        std::unordered_map<llvm::Value*, SharedAbstractNode> values;
+
+        //! Returns the converted operand `index` of `instruction`.
+        const SharedAbstractNode& operand(llvm::Instruction* instruction, triton::uint32 index) const;
+
+        //! Converts a value whose operands are converted.
         triton::ast::SharedAbstractNode do_convert(llvm::Value* llvmnode);
 
+        //! Converts the DAG of a value.
+        triton::ast::SharedAbstractNode convert(llvm::Value* root);
+
       public:
         //! Constructor.
         TRITON_EXPORT LLVMToTriton(const triton::ast::SharedAstContext& ctxt);
@@ -0,0 +1,170 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_LOCALSEARCHSOLVER_H
+#define TRITON_LOCALSEARCHSOLVER_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/solverInterface.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      //! \class LocalSearchSolver
+      /*! \brief Solver engine searching a model by stochastic local search.
+       *
+       * \description
+       * The query is split into its conjuncts, which are compiled by the AST evaluator (see `AstEvaluator`).
+       * Starting from the concrete values of the variables, the variables of an unsatisfied conjunct are
+       * mutated (bit flips, steps of the distance between the operands of a comparison, random values)
+       * and the mutation decreasing the most the distance of the query to a model is kept. Checksums
+       * and comparisons of inputs are usually solved in a few steps.
+       *
+       * The search cannot prove that a query is UNSAT. Once its time budget is spent, the query is
+       * handed off to the fallback solver (see `setFallback()`), by default the SMT solver Triton is built with.
+       */
+      class LocalSearchSolver : public SolverInterface {
+        private:
+          //! The kind of the solver the queries are handed off to, SOLVER_INVALID if none.
+          triton::engines::solver::solver_e fallbackKind;
+
+          //! The solver the queries are handed off to, null if none.
+          std::unique_ptr<SolverInterface> fallback;
+
+          //! The time budget of the search of each query (in milliseconds).
+          triton::uint32 budget;
+
+          //! The seed of the random mutations, each query starts from it.
+          triton::uint64 seed;
+
+          //! The SMT solver timeout. By default, unlimited. This global timeout may be changed for a specific query (isSat/getModel/getModels) via argument `timeout`.
+          triton::uint32 timeout;
+
+          //! The SMT solver memory limit of the fallback solver. By default, unlimited.
+          triton::uint32 memoryLimit;
+
+          //! True once the solver is interrupted.
+          std::atomic<bool> interrupted;
+
+          //! Protects the statistics, the solver may be queried from several threads.
+          mutable std::mutex lock;
+
+          //! The number of queries answered by the search.
+          mutable triton::usize hits;
+
+          //! The number of queries handed off to the fallback solver.
+          mutable triton::usize handoffs;
+
+          //! Searches a model of `node` for at most `ms` milliseconds. Returns true if one is found.
+          bool search(const triton::ast::SharedAbstractNode& node, triton::uint32 ms, std::unordered_map<triton::usize, SolverModel>& model) const;
+
+          //! Returns the time budget of a query given its `timeout`.
+          triton::uint32 getQueryBudget(triton::uint32 timeout) const;
+
+          //! Records an answer of the search or of the fallback solver.
+          void record(bool hit) const;
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT LocalSearchSolver();
+
+          //! Computes and returns a model from a symbolic constraint. State is returned in the `status` pointer as well as the solving time. A `timeout` can also be defined.
+          /*! \brief map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT std::unordered_map<triton::usize, SolverModel> getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
+          //! Computes and returns several models from a symbolic constraint. The `limit` is the number of models returned. State is returned in the `status` pointer as well as the solving time. A `timeout` can also be defined.
+          /*! \brief vector of map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           *
+           * The search finds one model, several models are enumerated by the fallback solver.
+           */
+          TRITON_EXPORT std::vector<std::unordered_map<triton::usize, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
+          //! Returns true if an expression is satisfiable.
+          TRITON_EXPORT bool isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
+          //! Returns the name of this solver.
+          TRITON_EXPORT std::string getName(void) const;
+
+          //! Defines a solver timeout (in milliseconds).
+          TRITON_EXPORT void setTimeout(triton::uint32 ms);
+
+          //! Defines a solver memory consumption limit (in megabytes).
+          TRITON_EXPORT void setMemoryLimit(triton::uint32 mem);
+
+          //! Interrupts the running queries, from any thread. They and the next ones return UNKNOWN.
+          TRITON_EXPORT void interrupt(void);
+
+          //! Returns the time budget of the search of each query (in milliseconds).
+          TRITON_EXPORT triton::uint32 getBudget(void) const;
+
+          //! Defines the time budget of the search of each query (in milliseconds). By default, 100 ms. The `timeout` of a query bounds it too.
+          TRITON_EXPORT void setBudget(triton::uint32 ms);
+
+          //! Returns the kind of the solver the queries are handed off to, SOLVER_INVALID if none.
+          TRITON_EXPORT triton::engines::solver::solver_e getFallback(void) const;
+
+          //! Defines the kind of the solver the queries are handed off to once the budget is spent. SOLVER_INVALID returns UNKNOWN instead.
+          TRITON_EXPORT void setFallback(triton::engines::solver::solver_e kind);
+
+          //! Defines the seed of the random mutations.
+          TRITON_EXPORT void setSeed(triton::uint64 seed);
+
+          //! Returns the number of queries answered by the search.
+          TRITON_EXPORT triton::usize getHits(void) const;
+
+          //! Returns the number of queries handed off to the fallback solver.
+          TRITON_EXPORT triton::usize getHandoffs(void) const;
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_LOCALSEARCHSOLVER_H */
@@ -0,0 +1,89 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_MAPPEDFILE_HPP
+#define TRITON_MAPPEDFILE_HPP
+
+#include <memory>
+#include <string>
+
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    /*! \class MappedFile
+     *  \brief A read-only view of a part of a file, mapped in the address space of the process.
+     *
+     * \description
+     * The operating system loads the pages of the file when they are first read, so mapping
+     * a large file costs nothing until its bytes are used. The file is unmapped on destruction.
+     * The mapping is private and read-only, so the processes mapping the same file share its
+     * pages in the cache of the operating system, and `share()` lets the contexts of a process
+     * share a single mapping.
+     */
+    class MappedFile {
+      private:
+        //! The start of the mapping, aligned as required by the operating system.
+        void* base;
+
+        //! The size of the mapping.
+        triton::usize length;
+
+        //! The mapped bytes.
+        const triton::uint8* data;
+
+        //! The number of mapped bytes.
+        triton::usize size;
+
+      public:
+        //! Maps the `size` bytes of the file at `path` from `offset`, to the end of the file if `size` is 0.
+        TRITON_EXPORT MappedFile(const std::string& path, triton::uint64 offset=0, triton::usize size=0);
+
+        //! Unmaps the file.
+        TRITON_EXPORT ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        //! Returns the mapped bytes.
+        TRITON_EXPORT const triton::uint8* getData(void) const;
+
+        //! Returns the number of mapped bytes.
+        TRITON_EXPORT triton::usize getSize(void) const;
+
+        /*!
+         * \brief Returns the mapping of the `size` bytes of the file at `path` from `offset`, shared by the callers while one keeps it.
+         *
+         * \details The mappings are looked up by path, offset and size in a cache of the process,
+         * which does not keep them alive. A file replaced while it is mapped is still seen as the
+         * mapped one until all its users release it.
+         */
+        TRITON_EXPORT static std::shared_ptr<const MappedFile> share(const std::string& path, triton::uint64 offset=0, triton::usize size=0);
+    };
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_MAPPEDFILE_HPP */
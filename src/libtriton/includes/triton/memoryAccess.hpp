@@ -77,6 +77,9 @@ namespace triton {
         //! Constructor by copy.
         TRITON_EXPORT MemoryAccess(const MemoryAccess& other);
 
+        //! Constructor by move. The LEA AST is moved, without touching its reference count.
+        TRITON_EXPORT MemoryAccess(MemoryAccess&& other) noexcept;
+
         //! Returns the AST of the memory access (LEA).
         TRITON_EXPORT triton::ast::SharedAbstractNode getLeaAst(void) const;
 
@@ -154,6 +157,9 @@ namespace triton {
 
         //! Copies a MemoryAccess.
         TRITON_EXPORT MemoryAccess& operator=(const MemoryAccess& other);
+
+        //! Moves a MemoryAccess.
+        TRITON_EXPORT MemoryAccess& operator=(MemoryAccess&& other) noexcept;
     };
 
     //! Displays an MemoryAccess.
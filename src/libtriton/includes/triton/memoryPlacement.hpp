@@ -0,0 +1,123 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_MEMORYPLACEMENT_HPP
+#define TRITON_MEMORYPLACEMENT_HPP
+
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Utils namespace
+  namespace utils {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup utils
+   *  @{
+   */
+
+    //! The kinds of huge pages backing an allocation.
+    enum huge_pages_e {
+      HUGE_PAGES_NONE = 0,    /*!< Regular pages. */
+      HUGE_PAGES_TRANSPARENT, /*!< Transparent huge pages, the kernel is advised to back the blocks with them. */
+      HUGE_PAGES_EXPLICIT,    /*!< Explicit huge pages (`MAP_HUGETLB`), transparent ones if none is reserved. */
+    };
+
+    //! \class MemoryPlacement
+    /*! \brief The placement of the blocks backing the AST arenas and the pages of the concrete memory.
+     *
+     * \description
+     * By default, the blocks come from the global allocator. A placement may ask for huge pages, to
+     * reduce the TLB misses on big heaps, and for the memory of a NUMA node, to keep the memory of a
+     * context pinned on a socket local to it. Both are requests: on a system which does not support
+     * them (or without huge pages reserved) the blocks are regular ones. Hooks may also replace the
+     * allocation of the blocks, e.g. to take them from an allocator of the caller.
+     *
+     * A block is released with the placement which allocated it.
+     */
+    class MemoryPlacement {
+      public:
+        //! A hook allocating `size` bytes, returns null on failure.
+        using AllocateHook = void* (*)(triton::usize size, void* data);
+
+        //! A hook releasing `size` bytes allocated by the `AllocateHook`.
+        using ReleaseHook = void (*)(void* p, triton::usize size, void* data);
+
+        //! The size of a huge page (in bytes).
+        static const triton::usize hugePageSize = 2 * 1024 * 1024;
+
+      private:
+        //! The kind of huge pages.
+        triton::utils::huge_pages_e hugePages;
+
+        //! The NUMA node, -1 for any.
+        triton::sint32 numaNode;
+
+        //! The allocation hook, null if none.
+        AllocateHook allocateHook;
+
+        //! The release hook, null if none.
+        ReleaseHook releaseHook;
+
+        //! The data given to the hooks.
+        void* hookData;
+
+        //! Returns the size of the block actually reserved for `size` bytes.
+        triton::usize reserved(triton::usize size) const;
+
+      public:
+        //! Constructor.
+        TRITON_EXPORT MemoryPlacement();
+
+        //! Sets the kind of huge pages.
+        TRITON_EXPORT void setHugePages(triton::utils::huge_pages_e kind);
+
+        //! Returns the kind of huge pages.
+        TRITON_EXPORT triton::utils::huge_pages_e getHugePages(void) const;
+
+        //! Sets the NUMA node of the blocks, -1 for any.
+        TRITON_EXPORT void setNumaNode(triton::sint32 node);
+
+        //! Returns the NUMA node of the blocks, -1 for any.
+        TRITON_EXPORT triton::sint32 getNumaNode(void) const;
+
+        //! Sets the hooks allocating and releasing the blocks, both or none. They take precedence over huge pages and NUMA nodes.
+        TRITON_EXPORT void setHooks(AllocateHook allocate, ReleaseHook release, void* data=nullptr);
+
+        //! Returns true if the blocks come from the global allocator.
+        TRITON_EXPORT bool isDefault(void) const;
+
+        //! Returns the size blocks should be a multiple of to fill their pages, 0 if any.
+        TRITON_EXPORT triton::usize getGranularity(void) const;
+
+        //! Allocates a block of `size` bytes. Throws `std::bad_alloc` on failure.
+        TRITON_EXPORT void* allocate(triton::usize size) const;
+
+        //! Releases a block of `size` bytes previously allocated.
+        TRITON_EXPORT void release(void* p, triton::usize size) const;
+
+        //! Returns true if both placements allocate the same way.
+        TRITON_EXPORT bool operator==(const MemoryPlacement& other) const;
+
+        //! Returns true if both placements allocate differently.
+        TRITON_EXPORT bool operator!=(const MemoryPlacement& other) const;
+    };
+
+  /*! @} End of utils namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_MEMORYPLACEMENT_HPP */
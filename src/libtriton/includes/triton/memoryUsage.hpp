@@ -0,0 +1,91 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_MEMORYUSAGE_HPP
+#define TRITON_MEMORYUSAGE_HPP
+
+#include <map>
+
+#include <triton/astEnums.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  /*! \struct MemoryUsageEntry
+   *  \brief The objects of a subsystem and the bytes they use. */
+  struct MemoryUsageEntry {
+    //! The number of objects.
+    triton::usize count = 0;
+
+    //! The number of bytes.
+    triton::usize bytes = 0;
+  };
+
+  /*! \struct MemoryUsage
+   *  \brief The memory used by each subsystem of a context (see `API::getMemoryUsage()`).
+   *
+   * \description
+   * The counts are maintained incrementally by the subsystems. Except for the AST nodes, whose bytes are
+   * the ones in use by the node pool, the bytes are estimated from the counts and the size of the objects
+   * of the subsystem. They do not include the AST nodes and the symbolic expressions the objects keep alive,
+   * and the pages shared with a fork or a snapshot are counted by each context which holds them.
+   */
+  struct MemoryUsage {
+    //! The live AST nodes and the bytes in use by the node pool.
+    MemoryUsageEntry astNodes;
+
+    //! The live AST nodes by kind.
+    std::map<triton::ast::ast_e, triton::usize> astNodesByKind;
+
+    //! The bytes reserved by the node pool.
+    triton::usize astReservedBytes = 0;
+
+    //! The live symbolic expressions.
+    MemoryUsageEntry symbolicExpressions;
+
+    //! The bytes of memory with a symbolic expression (`memoryReference`) and the pages holding them.
+    MemoryUsageEntry symbolicMemory;
+
+    //! The entries of the aligned memory.
+    MemoryUsageEntry alignedMemory;
+
+    //! The tainted bytes of memory and the pages holding them and their labels.
+    MemoryUsageEntry taintedMemory;
+
+    //! The tainted registers.
+    MemoryUsageEntry taintedRegisters;
+
+    //! The defined bytes of the concrete memory and the pages holding them. The mapped areas are not counted.
+    MemoryUsageEntry concreteMemory;
+
+    //! The pages of the concrete memory read in place from the mapped areas, shared with the contexts and processes which map them.
+    MemoryUsageEntry mappedMemory;
+
+    //! The path constraints.
+    MemoryUsageEntry pathConstraints;
+
+    //! The answers of the solver cache.
+    MemoryUsageEntry solverCache;
+
+    //! The results of the simplification cache.
+    MemoryUsageEntry simplificationCache;
+
+    //! The nodes of the synthesis cache.
+    MemoryUsageEntry synthesisCache;
+  };
+
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_MEMORYUSAGE_HPP */
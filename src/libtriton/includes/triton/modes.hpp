@@ -9,10 +9,10 @@
 #define TRITON_MODES_H
 
 #include <memory>
-#include <unordered_set>
 
 #include <triton/dllexport.hpp>
 #include <triton/modesEnums.hpp>
+#include <triton/tritonTypes.hpp>
 
 
 
@@ -31,6 +31,13 @@ namespace triton {
    *  @{
    */
 
+    //! Returns the bit of a mode in a set of modes.
+    constexpr triton::uint64 modeMask(triton::modes::mode_e mode) {
+      return (static_cast<triton::uint64>(1) << mode);
+    }
+
+    static_assert(triton::modes::TAINT_THROUGH_POINTERS < 64, "The modes must fit into a 64-bit mask");
+
     //! \class Modes
     /*! \brief The modes class */
     class Modes {
@@ -39,8 +46,8 @@ namespace triton {
         void copy(const Modes& other);
 
       protected:
-        //! The set of enabled modes
-        std::unordered_set<triton::modes::mode_e> enabledModes;
+        //! The set of enabled modes, one bit per mode (see modeMask()).
+        triton::uint64 enabledModes;
 
       public:
         //! Constructor.
@@ -53,7 +60,24 @@ namespace triton {
         TRITON_EXPORT Modes& operator=(const Modes& other);
 
         //! Returns true if the mode is enabled.
-        TRITON_EXPORT bool isModeEnabled(triton::modes::mode_e mode) const;
+        inline bool isModeEnabled(triton::modes::mode_e mode) const {
+          return (this->enabledModes & triton::modes::modeMask(mode)) != 0;
+        }
+
+        //! Returns true if all the modes of the mask are enabled.
+        inline bool areModesEnabled(triton::uint64 mask) const {
+          return (this->enabledModes & mask) == mask;
+        }
+
+        //! Returns true if one of the modes of the mask is enabled.
+        inline bool isAnyModeEnabled(triton::uint64 mask) const {
+          return (this->enabledModes & mask) != 0;
+        }
+
+        //! Returns the set of enabled modes, one bit per mode (see modeMask()).
+        inline triton::uint64 getEnabledModes(void) const {
+          return this->enabledModes;
+        }
 
         //! Enables or disables a specific mode.
         TRITON_EXPORT void setMode(triton::modes::mode_e mode, bool flag);
@@ -28,13 +28,33 @@ namespace triton {
     //! Enumerates all kinds of mode.
     enum mode_e {
       ALIGNED_MEMORY,                 //!< [symbolic] Keep a map of aligned memory.
+      AST_ABSTRACT_DOMAIN,            //!< [AST] Track known bits and unsigned bounds of symbolized nodes to decide constraints without the solver.
+      AST_DEPTH_LIMIT,                //!< [AST] Replace the ASTs of new expressions deeper than a limit by a constant or a fresh variable.
+      AST_EQUALITY_SATURATION,        //!< [AST] Simplify constraints by equality saturation before solving them.
+      AST_HASH_CONSING,               //!< [AST] Share structurally identical nodes instead of allocating new ones.
+      AST_LAZY_HASH,                  //!< [AST] Compute the hash of nodes on first use instead of at creation.
+      AST_NARY,                       //!< [AST] Flatten the nested bvadd, bvand, bvor, bvxor, land and lor nodes into n-ary ones with sorted operands and merged constants.
       AST_OPTIMIZATIONS,              //!< [AST] Classical arithmetic optimisations to reduce the depth of the trees.
+      AST_TRAVERSAL_CACHE,            //!< [AST] Cache topological sorts of nodes until the structure of the DAG changes.
+      BULK_STRING_OPERATIONS,         //!< [symbolic] Execute the iterations of the x86 REP string instructions with a concrete counter at once.
       CONCRETIZE_UNDEFINED_REGISTERS, //!< [symbolic] Concretize every registers tagged as undefined (see #750).
       CONSTANT_FOLDING,               //!< [symbolic] Perform a constant folding optimization of sub ASTs which do not contain symbolic variables.
+      DEAD_FLAGS_ELIMINATION,         //!< [symbolic] Record the expressions of the flags written in a processed block only if they are read.
+      INTERNED_COMMENTS,              //!< [symbolic] Share the comments of the expressions built by an instruction between its executions instead of formatting them each time.
+      LAZY_FLAGS,                     //!< [symbolic] Build the expressions of the x86 arithmetic flags only when the flags are read.
+      LOOP_INDUCTION_VARIABLES,       //!< [symbolic] On the block API, collapse the update chains of the registers a loop steps by a constant, and summarize the iterations of a branch comparing one of them in closed form.
+      MEMORY_ARRAY,                   //!< [symbolic] Model the memory as an array of bytes: the loads and stores at a symbolic address in a bounded range are selects and stores instead of accesses at their concrete address.
+      NO_COMMENTS,                    //!< [symbolic] Do not comment the symbolic expressions.
       ONLY_ON_SYMBOLIZED,             //!< [symbolic] Perform symbolic execution only on symbolized expressions.
       ONLY_ON_TAINTED,                //!< [symbolic] Perform symbolic execution only on tainted instructions.
+      PC_DEDUPLICATION,               //!< [symbolic] Count the path constraints identical to one already recorded instead of recording them.
+      PC_LOOP_SUMMARIZATION,          //!< [symbolic] Summarize the consecutive iterations of a loop branch into one path constraint, the most recent ones excepted.
       PC_TRACKING_SYMBOLIC,           //!< [symbolic] Track path constraints only if they are symbolized.
+      PRUNE_DEAD_EXPRESSIONS,         //!< [symbolic] Release the AST of register definitions overwritten before being read.
+      SEMANTICS_CACHE,                //!< [symbolic] Record the expressions built by the semantics of an x86 instruction once, and rebuild them over the new operands when it is executed again.
       SYMBOLIZE_INDEX_ROTATION,       //!< [symbolic] Symbolize index rotation for bvrol and bvror (see #751). This mode increases the complexity of solving.
+      TAINT_BIT_PRECISE,              //!< [taint] Track the taint of the registers of 64 bits or less bit by bit, and spread it precisely through the bitwise operations and the shifts.
+      TAINT_SUMMARIES,                //!< [taint] If the symbolic engine is disabled, only spread the taint of the instructions with a taint summary, without building their semantics.
       TAINT_THROUGH_POINTERS,         //!< [taint] Spread the taint if an index pointer is already tainted (see #725).
     };
 
@@ -0,0 +1,149 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_NATIVEBACKEND_HPP
+#define TRITON_NATIVEBACKEND_HPP
+
+#include <exception>
+#include <unordered_set>
+
+#include <triton/architecture.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/emulation.hpp>
+#include <triton/symbolicEngine.hpp>
+#include <triton/taintEngine.hpp>
+#include <triton/tritonTypes.hpp>
+
+//! The engine of Unicorn.
+struct uc_struct;
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    /*! \class NativeBackend
+     *  \brief Runs the concrete regions of an emulation on Unicorn (see `EmulationOptions::native`).
+     *
+     * \description
+     * A run starts when no register is symbolized or tainted: the registers are copied into Unicorn,
+     * and the pages of memory are mapped from the concrete memory on their first access, read only
+     * so that their first write marks them dirty. A page holding a symbolized or tainted byte is
+     * never mapped, an access to it stops the run before its instruction, as do a syscall or an
+     * interrupt, a stop address or a hook, undefined code and the errors of Unicorn. The registers
+     * and the dirty pages are then copied back, their expressions concretized, and all pages are
+     * unmapped so that the next run sees the changes of Triton. Only x86-64 and AArch64 are
+     * supported, and the memory callbacks are not called.
+     */
+    class NativeBackend {
+      private:
+        //! Architecture API
+        triton::arch::Architecture* architecture;
+
+        //! Symbolic Engine API
+        triton::engines::symbolic::SymbolicEngine* symbolicEngine;
+
+        //! Taint Engine API
+        triton::engines::taint::TaintEngine* taintEngine;
+
+        //! The Unicorn engine, opened on the first run.
+        struct uc_struct* engine;
+
+        //! The architecture of the Unicorn engine.
+        triton::arch::architecture_e engineArch;
+
+        //! The pages mapped during the run, by number.
+        std::unordered_set<triton::uint64> mapped;
+
+        //! The pages written during the run, by number.
+        std::unordered_set<triton::uint64> dirty;
+
+        //! The options of the run.
+        const triton::arch::EmulationOptions* options;
+
+        //! The address where the run started, which does not stop it.
+        triton::uint64 first;
+
+        //! The address of the last instruction started.
+        triton::uint64 last;
+
+        //! The number of instructions started.
+        triton::usize count;
+
+        //! True if the run stopped on a syscall or an interrupt.
+        bool interrupted;
+
+        //! The exception raised in a hook of Unicorn, thrown once the run stopped.
+        std::exception_ptr error;
+
+        //! Opens the Unicorn engine of the architecture and installs its hooks.
+        void open(void);
+
+        //! Closes the Unicorn engine.
+        void close(void);
+
+        //! Copies the registers into Unicorn.
+        void loadRegisters(void);
+
+        //! Copies the registers back from Unicorn.
+        void storeRegisters(void);
+
+        //! Copies the dirty pages back from Unicorn and unmaps all pages.
+        void storeMemory(void);
+
+        //! Maps the page `number`. Returns false if it holds a symbolized or tainted byte.
+        bool mapPage(triton::uint64 number);
+
+        //! The hook of each instruction.
+        static void onCode(struct uc_struct* uc, triton::uint64 addr, triton::uint32 size, void* user);
+
+        //! The hook of the accesses to unmapped memory.
+        static bool onUnmapped(struct uc_struct* uc, int type, triton::uint64 addr, int size, triton::sint64 value, void* user);
+
+        //! The hook of the first write of a page.
+        static bool onWrite(struct uc_struct* uc, int type, triton::uint64 addr, int size, triton::sint64 value, void* user);
+
+        //! The hook of the x86-64 syscall instruction.
+        static void onSyscall(struct uc_struct* uc, void* user);
+
+        //! The hook of the interrupts.
+        static void onInterrupt(struct uc_struct* uc, triton::uint32 intno, void* user);
+
+      public:
+        //! Constructor.
+        TRITON_EXPORT NativeBackend(triton::arch::Architecture* architecture,
+                                    triton::engines::symbolic::SymbolicEngine* symbolicEngine,
+                                    triton::engines::taint::TaintEngine* taintEngine);
+
+        //! Destructor.
+        TRITON_EXPORT ~NativeBackend();
+
+        //! Returns true if the architecture is supported and no register is symbolized or tainted.
+        TRITON_EXPORT bool isConcrete(void) const;
+
+        //! Runs from `pc` up to `limit` instructions (0 for unbounded) and returns the number executed. `pc` receives the address to resume from in Triton.
+        TRITON_EXPORT triton::usize run(triton::uint64& pc, const triton::arch::EmulationOptions& options, triton::usize limit);
+    };
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_NATIVEBACKEND_HPP */
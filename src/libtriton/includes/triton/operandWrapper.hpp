@@ -56,12 +56,18 @@ namespace triton {
         //! Memory constructor.
         TRITON_EXPORT OperandWrapper(const triton::arch::MemoryAccess& mem);
 
+        //! Constructor, moving the memory operand.
+        TRITON_EXPORT OperandWrapper(triton::arch::MemoryAccess&& mem) noexcept;
+
         //! Register constructor.
         TRITON_EXPORT OperandWrapper(const triton::arch::Register& reg);
 
         //! Constructor by copy.
         TRITON_EXPORT OperandWrapper(const OperandWrapper& other);
 
+        //! Constructor by move.
+        TRITON_EXPORT OperandWrapper(OperandWrapper&& other) noexcept;
+
         //! Returns the abstract type of the operand.
         TRITON_EXPORT triton::arch::operand_e getType(void) const;
 
@@ -107,6 +113,9 @@ namespace triton {
         //! Copies a OperandWrapper.
         TRITON_EXPORT OperandWrapper& operator=(const OperandWrapper& other);
 
+        //! Moves a OperandWrapper.
+        TRITON_EXPORT OperandWrapper& operator=(OperandWrapper&& other) noexcept;
+
         //! Tests two OperandWrappers for equality.
         TRITON_EXPORT bool operator==(const OperandWrapper& other) const;
 
@@ -8,6 +8,11 @@
 #ifndef TRITON_ORACLEENTRY_HPP
 #define TRITON_ORACLEENTRY_HPP
 
+#include <array>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 #include <triton/ast.hpp>
 #include <triton/dllexport.hpp>
 #include <triton/tritonTypes.hpp>
@@ -58,44 +63,108 @@ namespace triton {
           };
       };
 
-      //! \class UnaryEntry
-      /*! \brief Entry of the oracle table for unary operators synthesis. */
-      class UnaryEntry {
+      //! The number of inputs of the oracles of a bit width.
+      const triton::usize ORACLE_INPUTS = 16;
+
+      //! The values of the oracles of a bit width, one for each input.
+      using OracleValues = std::array<triton::uint64, ORACLE_INPUTS>;
+
+      //! \struct OracleValuesHash
+      /*! \brief Hash of the values of the oracles, used to index the operators by their results. */
+      struct OracleValuesHash {
+        //! Returns the hash of `values`.
+        std::size_t operator()(const OracleValues& values) const {
+          triton::uint64 hash = 0xcbf29ce484222325;
+
+          for (triton::uint64 value : values)
+            hash = (hash ^ value) * 0x100000001b3;
+
+          return static_cast<std::size_t>(hash ^ (hash >> 32));
+        }
+      };
+
+      //! \class OracleTable
+      /*! \brief The results of the operators on the inputs of the oracles of a bit width.
+       *
+       * \details
+       * The operators are evaluated on the same inputs, which are contiguous arrays as the results of each operator
+       * (x[i], y[i] and results[op][i] are an oracle). The operators are indexed by their results, the evaluation of
+       * a node on the inputs (its signature) finds the operator it is equivalent to in O(1). The generator of the
+       * tables (src/scripts/gen_oracle_table.py) ensures that the results of the operators differ.
+       */
+      class OracleTable {
         public:
-          //! Size of the oracle
+          //! Size of the oracles
           triton::uint32 bits;
 
-          //! Value of x
-          triton::uint64 x;
+          //! The operators, in the order of `results`.
+          std::vector<triton::ast::ast_e> ops;
 
-          //! Result of <op>(x)
-          triton::uint64 r;
+          //! The results of each operator on the inputs.
+          std::vector<OracleValues> results;
+
+          //! The operators by their results.
+          std::unordered_map<OracleValues, triton::ast::ast_e, OracleValuesHash> index;
 
           //! Constructor
-          TRITON_EXPORT UnaryEntry(triton::uint8 bits, triton::uint64 x, triton::uint64 r)
-            : bits(bits), x(x), r(r) {
+          TRITON_EXPORT OracleTable(triton::uint32 bits, const std::vector<std::pair<triton::ast::ast_e, OracleValues>>& results)
+            : bits(bits) {
+            for (const auto& item : results) {
+              this->ops.push_back(item.first);
+              this->results.push_back(item.second);
+              this->index.emplace(item.second, item.first);
+            }
+          };
+
+          //! Returns true and sets `op` if `signature` (an evaluation for each input) are the results of an operator.
+          TRITON_EXPORT bool find(const std::vector<triton::uint512>& signature, triton::ast::ast_e& op) const {
+            OracleValues values;
+
+            if (signature.size() != ORACLE_INPUTS)
+              return false;
+
+            /* An evaluation wider than the oracles cannot be one of their results */
+            for (triton::usize i = 0; i < ORACLE_INPUTS; i++) {
+              if (signature[i] >> this->bits)
+                return false;
+              values[i] = static_cast<triton::uint64>(signature[i]);
+            }
+
+            auto it = this->index.find(values);
+            if (it == this->index.end())
+              return false;
+
+            op = it->second;
+            return true;
           };
       };
 
-      //! \class BinaryEntry
-      /*! \brief Entry of the oracle table for binary operators synthesis. */
-      class BinaryEntry {
+      //! \class UnaryOracleTable
+      /*! \brief Oracle table for unary operators synthesis, the results are <op>(x). */
+      class UnaryOracleTable : public OracleTable {
         public:
-          //! Size of the oracle
-          triton::uint32 bits;
+          //! Values of x
+          OracleValues x;
 
-          //! Value of x
-          triton::uint64 x;
+          //! Constructor
+          TRITON_EXPORT UnaryOracleTable(triton::uint32 bits, const OracleValues& x, const std::vector<std::pair<triton::ast::ast_e, OracleValues>>& results)
+            : OracleTable(bits, results), x(x) {
+          };
+      };
 
-          //! Value of y
-          triton::uint64 y;
+      //! \class BinaryOracleTable
+      /*! \brief Oracle table for binary operators synthesis, the results are x <op> y. */
+      class BinaryOracleTable : public OracleTable {
+        public:
+          //! Values of x
+          OracleValues x;
 
-          //! Result of x <op> y
-          triton::uint64 r;
+          //! Values of y
+          OracleValues y;
 
           //! Constructor
-          TRITON_EXPORT BinaryEntry(triton::uint8 bits, triton::uint64 x, triton::uint64 y, triton::uint64 r)
-            : bits(bits), x(x), y(y), r(r) {
+          TRITON_EXPORT BinaryOracleTable(triton::uint32 bits, const OracleValues& x, const OracleValues& y, const std::vector<std::pair<triton::ast::ast_e, OracleValues>>& results)
+            : OracleTable(bits, results), x(x), y(y) {
           };
       };
 
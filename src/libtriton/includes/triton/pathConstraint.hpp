@@ -8,6 +8,7 @@
 #ifndef TRITON_PATHCONSTRAINT_H
 #define TRITON_PATHCONSTRAINT_H
 
+#include <memory>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -51,9 +52,12 @@ namespace triton {
            * execution. The source address is the location of the branch instruction and the destination address is the destination of the jump.
            * E.g: `"0x11223344: jne 0x55667788"`, 0x11223344 is the source address and 0x55667788 is the destination if and only if the
            * branch is taken, otherwise the destination is the next instruction address. The SharedAbstractNode is the expression which need to be
-           * true to take the branch.
+           * true to take the branch. The vector is shared by the copies of the path constraint until one of them adds or updates a branch.
            */
-          std::vector<std::tuple<bool, triton::uint64, triton::uint64, triton::ast::SharedAbstractNode>> branches;
+          std::shared_ptr<std::vector<std::tuple<bool, triton::uint64, triton::uint64, triton::ast::SharedAbstractNode>>> branches;
+
+          //! Returns the branches, copied first if they are shared with another path constraint.
+          std::vector<std::tuple<bool, triton::uint64, triton::uint64, triton::ast::SharedAbstractNode>>& detachBranches(void);
 
           //! The thread id of the constraint. -1 if it's undefined.
           triton::uint32 tid;
@@ -61,6 +65,12 @@ namespace triton {
           //! The comment of the path constraint.
           std::string comment;
 
+          //! The number of times the branch was taken, the loop iterations it summarizes and its duplicates included.
+          triton::usize count;
+
+          //! The taken predicates of the loop iterations summarized, oldest first. Empty if it does not summarize iterations.
+          std::vector<triton::ast::SharedAbstractNode> iterations;
+
         public:
           //! Constructor.
           TRITON_EXPORT PathConstraint();
@@ -100,6 +110,27 @@ namespace triton {
 
           //! Sets a comment to the path constraint.
           TRITON_EXPORT void setComment(const std::string& comment);
+
+          //! Returns the number of times the branch was taken, the loop iterations it summarizes and its duplicates included.
+          TRITON_EXPORT triton::usize getCount(void) const;
+
+          //! Sets the number of times the branch was taken.
+          TRITON_EXPORT void setCount(triton::usize count);
+
+          //! Returns the taken predicates of the loop iterations summarized, oldest first. Empty if it does not summarize iterations.
+          TRITON_EXPORT const std::vector<triton::ast::SharedAbstractNode>& getIterations(void) const;
+
+          //! Sets the taken predicates of the loop iterations summarized, oldest first, such as the ones of a saved path constraint.
+          TRITON_EXPORT void setIterations(const std::vector<triton::ast::SharedAbstractNode>& iterations);
+
+          //! Returns the predicates of the branches, then the ones of the iterations summarized.
+          TRITON_EXPORT std::vector<triton::ast::SharedAbstractNode> getPredicates(void) const;
+
+          //! Replaces the predicates of the branches, then the ones of the iterations summarized, in the order of `getPredicates()`. They are null while the path constraint is spilled (see `PathManager::setSpilling()`).
+          TRITON_EXPORT void setPredicates(const std::vector<triton::ast::SharedAbstractNode>& predicates);
+
+          //! Summarizes one more loop iteration of a branch with two targets, whose taken predicate is `predicate`, taken `count` times. `taken` is the conjunction of the taken predicates of all the iterations and `notTaken` its negation.
+          TRITON_EXPORT void addIteration(const triton::ast::SharedAbstractNode& predicate, triton::usize count, const triton::ast::SharedAbstractNode& taken, const triton::ast::SharedAbstractNode& notTaken);
       };
 
     /*! @} End of symbolic namespace */
@@ -8,12 +8,20 @@
 #ifndef TRITON_PATHMANAGER_H
 #define TRITON_PATHMANAGER_H
 
+#include <string>
+#include <tuple>
+#include <unordered_map>
 #include <vector>
 
+#include <triton/coverage.hpp>
 #include <triton/dllexport.hpp>
 #include <triton/instruction.hpp>
 #include <triton/modes.hpp>
 #include <triton/pathConstraint.hpp>
+#include <triton/persistentMap.hpp>
+#include <triton/persistentVector.hpp>
+#include <triton/processingStatistics.hpp>
+#include <triton/spillFile.hpp>
 #include <triton/symbolicExpression.hpp>
 #include <triton/tritonTypes.hpp>
 
@@ -52,38 +60,179 @@ namespace triton {
           //! AstContext API
           triton::ast::SharedAstContext astCtxt;
 
+          //! The statistics of the processing, null if none. Kept by the copies by assignment.
+          triton::arch::ProcessingStatistics* statistics;
+
+          //! The coverage of the branches, null if none. Kept by the copies by assignment.
+          triton::arch::Coverage* coverage;
+
         protected:
-          //! \brief The logical conjunction vector of path constraints.
-          std::vector<triton::engines::symbolic::PathConstraint> pathConstraints;
+          //! \brief The logical conjunction vector of path constraints, shared with the copies of the path manager up to where they diverge. The spilled ones are faulted in by the accessors.
+          mutable triton::utils::PersistentVector<triton::engines::symbolic::PathConstraint> pathConstraints;
+
+          //! The path constraints as a vector, filled when they are asked and cut where they change. It is not copied.
+          mutable std::vector<triton::engines::symbolic::PathConstraint> snapshot;
+
+          //! The maximum depth of ASTs, 0 if unbounded. Branches deeper than it are not recorded.
+          triton::uint32 maxDepth;
+
+          //! The ids of the symbolic variables of the taken predicate of each path constraint, computed when the path predicate is sliced.
+          mutable triton::utils::PersistentVector<std::vector<triton::usize>> constraintVariables;
+
+          //! The union-find forest of the symbolic variables which are in a same path constraint. Maps a variable id to its parent. It is not copied, but rebuilt when asked.
+          mutable std::unordered_map<triton::usize, triton::usize> components;
+
+          //! A branch constraint which may reach an address, as the index of its path constraint and its index in it.
+          struct Target {
+            //! The index of the path constraint.
+            triton::usize constraint;
+
+            //! The index of the branch constraint in the path constraint.
+            triton::usize branch;
+
+            //! What the branch reaches: 0 for its source, 1 for its destination, 2 for any address (a direct branch).
+            triton::uint8 kind;
+          };
+
+          //! The hash of the key of a path constraint deduplicated with PC_DEDUPLICATION.
+          struct FingerprintHash {
+            //! Returns the hash of `key`.
+            triton::usize operator()(const std::tuple<triton::uint64, triton::uint64, triton::uint128>& key) const;
+          };
+
+          //! The branch constraints by the address of their source and of their destination, in the order they were pushed.
+          triton::utils::PersistentMap<triton::uint64, triton::utils::PersistentVector<Target>> targets;
+
+          //! The direct branches (call reg, jmp reg), which may reach any address, in the order they were pushed.
+          triton::utils::PersistentVector<Target> directs;
+
+          //! The conjunction of the taken predicates before each path constraint, continued when the path predicate or the predicates to reach an address are asked and cut when constraints are popped.
+          mutable triton::utils::PersistentVector<triton::ast::SharedAbstractNode> prefixes;
+
+          //! The path constraints recorded while PC_DEDUPLICATION is enabled, by source, taken address and hash of their taken predicate.
+          triton::utils::PersistentMap<std::tuple<triton::uint64, triton::uint64, triton::uint128>, triton::usize, FingerprintHash> fingerprints;
+
+          //! The number of the most recent iterations of a loop branch which are not summarized with PC_LOOP_SUMMARIZATION.
+          triton::usize flippableIterations;
+
+          //! A run of path constraints whose predicates were written into the spill file.
+          struct SpilledChunk {
+            //! The index of its first path constraint.
+            triton::usize first;
+
+            //! The number of its path constraints.
+            triton::usize count;
+
+            //! The offset of its record in the spill file.
+            triton::uint64 offset;
+
+            //! The size of its record.
+            triton::usize size;
+
+            //! True if its predicates were faulted in since it was spilled.
+            bool resident;
+          };
+
+          //! The file the cold path constraints are spilled into, null if they are not spilled. Shared with the copies.
+          triton::engines::symbolic::SharedSpillFile spill;
+
+          //! The number of the most recent path constraints which are not spilled.
+          triton::usize residentConstraints;
+
+          //! The chunks spilled, by increasing index. The predicates of their path constraints are null while they are not resident.
+          mutable std::vector<SpilledChunk> chunks;
+
+          //! Returns the index following the last path constraint spilled.
+          triton::usize getSpilledEnd(void) const;
+
+          //! Spills the oldest path constraints not spilled yet once twice the resident ones are in memory, and drops the chunks faulted in since the last spill.
+          void spillColdConstraints(void);
+
+          //! Drops the predicates of the path constraints of `chunk`, with what was computed from them. They stay in the spill file.
+          void evict(SpilledChunk& chunk) const;
+
+          //! Reads the predicates of the path constraints of `chunk` back from the spill file.
+          void fault(SpilledChunk& chunk) const;
+
+          //! Faults in all the chunks spilled. Called by the accessors which read the predicates.
+          void restore(void) const;
+
+          //! Returns the representative of the component of a symbolic variable.
+          triton::usize findComponent(triton::usize id) const;
+
+          //! Records the variables of the path constraints pushed since the last slicing, and rebuilds the components if some were popped.
+          void updateComponents(void) const;
+
+          //! Returns the conjunction of the taken predicates of the path constraints before `index`.
+          triton::ast::SharedAbstractNode getPrefixPredicate(triton::usize index) const;
+
+          //! Returns a writable reference to the path constraint at `index`, cutting the snapshot there.
+          triton::engines::symbolic::PathConstraint& modifyPathConstraint(triton::usize index);
+
+          //! Indexes the branch constraints of the last path constraint pushed.
+          void indexLastPathConstraint(void);
+
+          //! Pushes a path constraint of the execution, counted if it is a duplicate and summarized if it is a loop iteration, according to the modes.
+          void recordPathConstraint(const triton::engines::symbolic::PathConstraint& pco);
+
+          //! Summarizes the oldest of the most recent iterations of the loop branch `pco`, and pushes `pco`. Returns false if `pco` does not continue a loop.
+          bool summarizeIteration(const triton::engines::symbolic::PathConstraint& pco);
+
+          //! Returns the taken predicate of the iterations summarized by `pc` and of the next one, whose taken predicate is `next`, in closed form if they compare an induction variable to a loop invariant (LOOP_INDUCTION_VARIABLES), nullptr otherwise.
+          triton::ast::SharedAbstractNode summarizeInduction(const triton::engines::symbolic::PathConstraint& pc, const triton::ast::SharedAbstractNode& next) const;
 
         public:
           //! Constructor.
           TRITON_EXPORT PathManager(const triton::modes::SharedModes& modes, const triton::ast::SharedAstContext& astCtxt);
 
-          //! Constructor by copy.
+          //! Constructor by copy. The path constraints are shared until the copies diverge, the copy is in O(1).
           TRITON_EXPORT PathManager(const PathManager& other);
 
-          //! Copies a PathManager.
+          //! Copies a PathManager, in O(1) as the constructor by copy.
           TRITON_EXPORT PathManager& operator=(const PathManager& other);
 
+          //! Times the push of the path constraints into `statistics`, which may be null.
+          TRITON_EXPORT void setStatistics(triton::arch::ProcessingStatistics* statistics);
+
+          //! Records the branches of the path constraints pushed by the instructions into `coverage`, which may be null.
+          TRITON_EXPORT void setCoverage(triton::arch::Coverage* coverage);
+
           //! Returns the size of the path constraints
           TRITON_EXPORT triton::usize getSizeOfPathConstraints(void) const;
 
-          //! Returns the logical conjunction vector of path constraints.
+          //! Returns the logical conjunction vector of path constraints. The vector is built from the path constraints pushed since the last call.
           TRITON_EXPORT const std::vector<triton::engines::symbolic::PathConstraint>& getPathConstraints(void) const;
 
+          //! Returns the path constraints as they are stored, shared with the copies of the path manager. The predicates of the spilled ones are not faulted in.
+          TRITON_EXPORT const triton::utils::PersistentVector<triton::engines::symbolic::PathConstraint>& getPersistentPathConstraints(void) const;
+
           //! Returns the logical conjunction vector of path constraints from a given range.
           TRITON_EXPORT std::vector<triton::engines::symbolic::PathConstraint> getPathConstraints(triton::usize start, triton::usize end) const;
 
           //! Returns the logical conjunction vector of path constraint of a given thread.
           TRITON_EXPORT std::vector<triton::engines::symbolic::PathConstraint> getPathConstraintsOfThread(triton::uint32 threadId) const;
 
-          //! Returns the current path predicate as an AST of logical conjunction of each taken branch.
+          //! Returns the current path predicate as an AST of logical conjunction of each taken branch. The conjunction is built once per path constraint pushed.
           TRITON_EXPORT triton::ast::SharedAbstractNode getPathPredicate(void) const;
 
-          //! Returns path predicates which may reach the targeted address.
+          //! Returns the current path predicate as one N-ary logical conjunction of each taken branch, instead of a chain of binary ones as deep as the path.
+          TRITON_EXPORT triton::ast::SharedAbstractNode getFlatPathPredicate(void) const;
+
+          //! Returns the logical conjunction of the path constraints which share symbolic variables with `node`, directly or through other path constraints. The other constraints are independent of `node`.
+          TRITON_EXPORT triton::ast::SharedAbstractNode getRelevantPathPredicate(const triton::ast::SharedAbstractNode& node) const;
+
+          //! Returns path predicates which may reach the targeted address. The branch constraints are indexed by address, the cost is the number of predicates returned.
           TRITON_EXPORT std::vector<triton::ast::SharedAbstractNode> getPredicatesToReachAddress(triton::uint64 addr) const;
 
+          //! Returns the number of the most recent iterations of a loop branch which are not summarized with PC_LOOP_SUMMARIZATION.
+          TRITON_EXPORT triton::usize getFlippableIterations(void) const;
+
+          //! Defines the number of the most recent iterations of a loop branch which are not summarized with PC_LOOP_SUMMARIZATION, at least one. By default, 1.
+          TRITON_EXPORT void setFlippableIterations(triton::usize count);
+
+          //! Returns the predicate which takes the iterations of the path constraint at `index` before `iteration`, and not `iteration`. A path constraint which does not summarize iterations has one.
+          TRITON_EXPORT triton::ast::SharedAbstractNode getPredicateToFlipIteration(triton::usize index, triton::usize iteration) const;
+
           //! Pushs constraints of a branch instruction to the path predicate.
           TRITON_EXPORT void pushPathConstraint(const triton::arch::Instruction& inst, const triton::engines::symbolic::SharedSymbolicExpression& expr);
 
@@ -93,11 +242,26 @@ namespace triton {
           //! Pushes constraint to the current path predicate.
           TRITON_EXPORT void pushPathConstraint(const triton::engines::symbolic::PathConstraint& pco);
 
-          //! Pops the last constraints added to the path predicate.
+          //! Pops the last constraints added to the path predicate. The constraints before it are left shared.
           TRITON_EXPORT void popPathConstraint(void);
 
           //! Clears the current path predicate.
           TRITON_EXPORT void clearPathConstraints(void);
+
+          /*!
+           * \brief Spills the cold path constraints into the file at `path`, keeping the `resident` most recent ones in memory. An empty path stops spilling.
+           *
+           * \details Once twice `resident` path constraints are in memory, the predicates of the oldest `resident` ones
+           * are serialized with the AST slice they depend on (see `AstSerializer`) and appended to the file, and are
+           * released, as the AST nodes and the symbolic expressions only they kept alive. The accessors which read
+           * the predicates, such as `getPathConstraints()` or `getPathPredicate()`, fault them back in from the file
+           * mapped, and they are released again at the next spill. The copies of the path manager share the file,
+           * which is truncated when it is set and removed when none uses it.
+           */
+          TRITON_EXPORT void setSpilling(const std::string& path, triton::usize resident=1024);
+
+          //! Returns the number of path constraints whose predicates are spilled and not faulted in.
+          TRITON_EXPORT triton::usize getNumberOfSpilledPathConstraints(void) const;
       };
 
     /*! @} End of symbolic namespace */
@@ -0,0 +1,452 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_PERSISTENTMAP_H
+#define TRITON_PERSISTENTMAP_H
+
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Utils namespace
+  namespace utils {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup utils
+   *  @{
+   */
+
+    //! \class PersistentMap
+    /*! \brief Hash map with structural sharing between copies.
+     *
+     * \description
+     * The map is a hash array mapped trie: each node consumes 5 bits of the hash of keys and holds a
+     * bitmap of its non-empty slots. Copying a map only copies its root pointer. A write copies the
+     * nodes of its path which are shared with other maps (their use count is greater than one), nodes
+     * owned by a single map are modified in place. Reads and writes are in O(log32(n)).
+     *
+     * The entries are stamped with the epoch of the map they were written in. `discard()` removes all
+     * entries in O(1) by starting a new epoch: the stale entries are ignored by reads and their values
+     * are released when a write reaches their slot, or all at once when they exceed the stale limit.
+     */
+    template <typename Key, typename T, typename Hash = std::hash<Key>>
+    class PersistentMap {
+      private:
+        //! The number of bits of the hash consumed by a level.
+        static const triton::uint32 bits = 5;
+
+        //! The number of bits of a hash.
+        static const triton::uint32 hashBits = 64;
+
+        struct Node;
+
+        //! A slot of a node. It holds an entry if `child` is nullptr.
+        struct Slot {
+          //! The sub-trie of the slot.
+          std::shared_ptr<Node> child;
+
+          //! The hash of the key.
+          triton::uint64 hash;
+
+          //! The key of the entry.
+          Key key;
+
+          //! The value of the entry.
+          T value;
+
+          //! The epoch the entry was written in, the entry is stale if it is not the one of the map.
+          triton::uint64 epoch;
+        };
+
+        //! A node of the trie. Once all hash bits are consumed, a node holds colliding entries without bitmap.
+        struct Node {
+          //! The non-empty slots of the node.
+          triton::uint32 bitmap = 0;
+
+          //! The slots, in the order of the bitmap.
+          std::vector<Slot> slots;
+        };
+
+        //! The root of the trie, nullptr if the map is empty.
+        std::shared_ptr<Node> root;
+
+        //! The number of entries.
+        triton::usize count = 0;
+
+        //! The current epoch.
+        triton::uint64 epoch = 0;
+
+        //! The number of stale entries still held by the trie.
+        triton::usize stale = 0;
+
+        //! The number of stale entries above which `discard()` releases the trie.
+        triton::usize staleLimit = 4096;
+
+        //! Returns the index of the slot of `hash` in a node of `shift`.
+        static triton::uint32 indexOf(triton::uint64 hash, triton::uint32 shift) {
+          return static_cast<triton::uint32>((hash >> shift) & ((1 << bits) - 1));
+        }
+
+        //! Returns the position of the slot of `bit` in the slots of a node.
+        static triton::uint32 positionOf(triton::uint32 bitmap, triton::uint32 bit) {
+          triton::uint32 x = bitmap & (bit - 1);
+          x = x - ((x >> 1) & 0x55555555);
+          x = (x & 0x33333333) + ((x >> 2) & 0x33333333);
+          x = (x + (x >> 4)) & 0x0f0f0f0f;
+          return (x * 0x01010101) >> 24;
+        }
+
+        //! Copies `node` if it is shared with another map.
+        static void detach(std::shared_ptr<Node>& node) {
+          if (node.use_count() > 1)
+            node = std::make_shared<Node>(*node);
+        }
+
+        //! Makes a stale entry of `slot` live again, with a default-constructed value.
+        void revive(Slot& slot) {
+          if (slot.epoch != this->epoch) {
+            slot.value = T();
+            slot.epoch = this->epoch;
+            this->stale--;
+            this->count++;
+          }
+        }
+
+        //! Returns the slot holding `key`, or nullptr.
+        const Slot* lookup(const Key& key) const {
+          triton::uint64 hash = static_cast<triton::uint64>(Hash()(key));
+          const Node* node = this->root.get();
+          triton::uint32 shift = 0;
+
+          while (node != nullptr) {
+            if (shift >= hashBits) {
+              for (const auto& slot : node->slots) {
+                if (slot.key == key)
+                  return (slot.epoch == this->epoch) ? &slot : nullptr;
+              }
+              return nullptr;
+            }
+
+            triton::uint32 bit = 1 << indexOf(hash, shift);
+            if ((node->bitmap & bit) == 0)
+              return nullptr;
+
+            const Slot& slot = node->slots[positionOf(node->bitmap, bit)];
+            if (slot.child == nullptr)
+              return (slot.hash == hash && slot.key == key && slot.epoch == this->epoch) ? &slot : nullptr;
+
+            node = slot.child.get();
+            shift += bits;
+          }
+
+          return nullptr;
+        }
+
+        //! Returns a node holding two entries whose hashes are equal below `shift`.
+        static std::shared_ptr<Node> branch(Slot&& first, Slot&& second, triton::uint32 shift) {
+          auto node = std::make_shared<Node>();
+
+          if (shift >= hashBits) {
+            node->slots.push_back(std::move(first));
+            node->slots.push_back(std::move(second));
+            return node;
+          }
+
+          triton::uint32 i1 = indexOf(first.hash, shift);
+          triton::uint32 i2 = indexOf(second.hash, shift);
+
+          if (i1 == i2) {
+            Slot slot;
+            slot.hash  = 0;
+            slot.key   = Key();
+            slot.value = T();
+            slot.epoch = 0;
+            slot.child = branch(std::move(first), std::move(second), shift + bits);
+            node->bitmap = 1 << i1;
+            node->slots.push_back(std::move(slot));
+            return node;
+          }
+
+          node->bitmap = (1 << i1) | (1 << i2);
+          if (i1 < i2) {
+            node->slots.push_back(std::move(first));
+            node->slots.push_back(std::move(second));
+          }
+          else {
+            node->slots.push_back(std::move(second));
+            node->slots.push_back(std::move(first));
+          }
+          return node;
+        }
+
+        //! Returns the value of `key` in the trie of `node`, inserted if missing. Shared nodes of the path are copied.
+        T& reach(std::shared_ptr<Node>& node, triton::uint64 hash, const Key& key, triton::uint32 shift) {
+          detach(node);
+
+          if (shift >= hashBits) {
+            for (auto& slot : node->slots) {
+              if (slot.key == key) {
+                this->revive(slot);
+                return slot.value;
+              }
+            }
+            Slot slot;
+            slot.hash  = hash;
+            slot.key   = key;
+            slot.value = T();
+            slot.epoch = this->epoch;
+            node->slots.push_back(std::move(slot));
+            this->count++;
+            return node->slots.back().value;
+          }
+
+          triton::uint32 bit = 1 << indexOf(hash, shift);
+          triton::uint32 position = positionOf(node->bitmap, bit);
+
+          if ((node->bitmap & bit) == 0) {
+            Slot slot;
+            slot.hash  = hash;
+            slot.key   = key;
+            slot.value = T();
+            slot.epoch = this->epoch;
+            node->bitmap |= bit;
+            node->slots.insert(node->slots.begin() + position, std::move(slot));
+            this->count++;
+            return node->slots[position].value;
+          }
+
+          Slot& slot = node->slots[position];
+          if (slot.child != nullptr)
+            return this->reach(slot.child, hash, key, shift + bits);
+
+          if (slot.hash == hash && slot.key == key) {
+            this->revive(slot);
+            return slot.value;
+          }
+
+          /* A stale entry gives its slot to the key */
+          if (slot.epoch != this->epoch) {
+            slot.hash  = hash;
+            slot.key   = key;
+            this->revive(slot);
+            return slot.value;
+          }
+
+          /* Two keys share the slot, they are pushed one level down */
+          Slot entry;
+          entry.hash  = hash;
+          entry.key   = key;
+          entry.value = T();
+          entry.epoch = this->epoch;
+
+          Slot previous = std::move(slot);
+          slot.child = branch(std::move(previous), std::move(entry), shift + bits);
+          slot.hash  = 0;
+          slot.key   = Key();
+          slot.value = T();
+          slot.epoch = 0;
+          this->count++;
+          return this->reach(slot.child, hash, key, shift + bits);
+        }
+
+        //! Removes `key` from the trie of `node`, which holds it. Shared nodes of the path are copied.
+        void remove(std::shared_ptr<Node>& node, triton::uint64 hash, const Key& key, triton::uint32 shift) {
+          detach(node);
+
+          if (shift >= hashBits) {
+            for (auto it = node->slots.begin(); it != node->slots.end(); ++it) {
+              if (it->key == key) {
+                node->slots.erase(it);
+                break;
+              }
+            }
+            return;
+          }
+
+          triton::uint32 bit = 1 << indexOf(hash, shift);
+          triton::uint32 position = positionOf(node->bitmap, bit);
+          Slot& slot = node->slots[position];
+
+          if (slot.child == nullptr) {
+            node->bitmap &= ~bit;
+            node->slots.erase(node->slots.begin() + position);
+            return;
+          }
+
+          this->remove(slot.child, hash, key, shift + bits);
+
+          /* A sub-trie left with a single entry is pulled up */
+          const auto& child = slot.child;
+          if (child->slots.size() == 1 && child->slots[0].child == nullptr) {
+            Slot entry = std::move(child->slots[0]);
+            slot = std::move(entry);
+          }
+          else if (child->slots.empty()) {
+            node->bitmap &= ~bit;
+            node->slots.erase(node->slots.begin() + position);
+          }
+        }
+
+        //! Calls `visitor` on the entries of `epoch` in the trie of `node`.
+        template <typename F>
+        static void visit(const Node* node, triton::uint64 epoch, F& visitor) {
+          std::vector<const Node*> worklist = {node};
+
+          while (!worklist.empty()) {
+            const Node* current = worklist.back();
+            worklist.pop_back();
+            for (const auto& slot : current->slots) {
+              if (slot.child != nullptr)
+                worklist.push_back(slot.child.get());
+              else if (slot.epoch == epoch)
+                visitor(slot.key, slot.value);
+            }
+          }
+        }
+
+      public:
+        //! Returns the value of `key`, or nullptr if the map does not hold it.
+        const T* find(const Key& key) const {
+          const Slot* slot = this->lookup(key);
+          return slot ? &slot->value : nullptr;
+        }
+
+        //! Returns true if the map holds `key`.
+        bool contains(const Key& key) const {
+          return this->lookup(key) != nullptr;
+        }
+
+        //! Returns a writable reference to the value of `key`, default-constructed if missing. The reference is valid until the next write.
+        T& modify(const Key& key) {
+          if (this->root == nullptr)
+            this->root = std::make_shared<Node>();
+          return this->reach(this->root, static_cast<triton::uint64>(Hash()(key)), key, 0);
+        }
+
+        //! Sets the value of `key`.
+        void set(const Key& key, const T& value) {
+          this->modify(key) = value;
+        }
+
+        //! Removes `key`. Returns false if the map does not hold it.
+        bool erase(const Key& key) {
+          if (this->lookup(key) == nullptr)
+            return false;
+
+          this->remove(this->root, static_cast<triton::uint64>(Hash()(key)), key, 0);
+          this->count--;
+          if (this->count == 0 && this->stale == 0)
+            this->root = nullptr;
+          return true;
+        }
+
+        //! Removes all entries, their values are released.
+        void clear(void) {
+          this->root  = nullptr;
+          this->count = 0;
+          this->stale = 0;
+        }
+
+        //! Removes all entries in O(1), their values are released lazily. \sa setStaleLimit()
+        void discard(void) {
+          this->stale += this->count;
+          this->count  = 0;
+          this->epoch++;
+
+          /* Bounds the values kept alive by the stale entries */
+          if (this->stale > this->staleLimit)
+            this->clear();
+        }
+
+        //! Sets the number of stale entries above which `discard()` releases them all at once.
+        void setStaleLimit(triton::usize limit) {
+          this->staleLimit = limit;
+        }
+
+        //! Returns the number of entries.
+        triton::usize size(void) const {
+          return this->count;
+        }
+
+        //! Returns true if the map is empty.
+        bool empty(void) const {
+          return this->count == 0;
+        }
+
+        //! Calls `visitor(key, value)` on each entry, in no particular order. The map must not be modified meanwhile.
+        template <typename F>
+        void forEach(F visitor) const {
+          if (this->root != nullptr)
+            visit(this->root.get(), this->epoch, visitor);
+        }
+    };
+
+
+    //! \class PersistentSet
+    /*! \brief Hash set with structural sharing between copies. \sa PersistentMap */
+    template <typename Key, typename Hash = std::hash<Key>>
+    class PersistentSet {
+      private:
+        //! The keys of the set.
+        PersistentMap<Key, bool, Hash> keys;
+
+      public:
+        //! Returns true if the set holds `key`.
+        bool contains(const Key& key) const {
+          return this->keys.contains(key);
+        }
+
+        //! Inserts `key`.
+        void insert(const Key& key) {
+          this->keys.modify(key) = true;
+        }
+
+        //! Removes `key`. Returns false if the set does not hold it.
+        bool erase(const Key& key) {
+          return this->keys.erase(key);
+        }
+
+        //! Removes all keys.
+        void clear(void) {
+          this->keys.clear();
+        }
+
+        //! Returns the number of keys.
+        triton::usize size(void) const {
+          return this->keys.size();
+        }
+
+        //! Returns true if the set is empty.
+        bool empty(void) const {
+          return this->keys.empty();
+        }
+
+        //! Calls `visitor(key)` on each key, in no particular order. The set must not be modified meanwhile.
+        template <typename F>
+        void forEach(F visitor) const {
+          this->keys.forEach([&visitor](const Key& key, bool) { visitor(key); });
+        }
+    };
+
+  /*! @} End of utils namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_PERSISTENTMAP_H */
@@ -0,0 +1,266 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_PERSISTENTVECTOR_H
+#define TRITON_PERSISTENTVECTOR_H
+
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Utils namespace
+  namespace utils {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup utils
+   *  @{
+   */
+
+    //! \class PersistentVector
+    /*! \brief Vector with structural sharing between copies.
+     *
+     * \description
+     * The vector is a trie of 32 children per node whose leaves hold 32 values, indexed by 5 bits of the
+     * index per level. Copying a vector only copies its root pointer. A write copies the nodes of its path
+     * which are shared with other vectors (their use count is greater than one), nodes owned by a single
+     * vector are modified in place. Reads, writes, pushes and pops are in O(log32(n)).
+     */
+    template <typename T>
+    class PersistentVector {
+      private:
+        //! The number of bits of the index consumed by a level.
+        static const triton::uint32 bits = 5;
+
+        //! The number of children of a node and of values of a leaf.
+        static const triton::usize width = 1 << bits;
+
+        //! A node of the trie. Leaves hold values, the other nodes hold children.
+        struct Node {
+          //! The sub-tries of the node.
+          std::vector<std::shared_ptr<Node>> children;
+
+          //! The values of the leaf.
+          std::vector<T> values;
+        };
+
+        //! The root of the trie, nullptr if the vector is empty.
+        std::shared_ptr<Node> root;
+
+        //! The shift of the index at the root, 0 if it is a leaf.
+        triton::uint32 shift = 0;
+
+        //! The number of values.
+        triton::usize count = 0;
+
+        //! Copies `node` if it is shared with another vector.
+        static void detach(std::shared_ptr<Node>& node) {
+          if (node.use_count() > 1)
+            node = std::make_shared<Node>(*node);
+        }
+
+        //! Returns the leaf holding `index`.
+        const Node* leafOf(triton::usize index) const {
+          const Node* node = this->root.get();
+
+          for (triton::uint32 s = this->shift; s > 0; s -= bits)
+            node = node->children[(index >> s) & (width - 1)].get();
+
+          return node;
+        }
+
+        //! Removes the last value of the trie of `node`. Shared nodes of the path are copied.
+        static void remove(std::shared_ptr<Node>& node, triton::uint32 shift) {
+          detach(node);
+
+          if (shift == 0) {
+            node->values.pop_back();
+            return;
+          }
+
+          auto& child = node->children.back();
+          remove(child, shift - bits);
+          if (child->values.empty() && child->children.empty())
+            node->children.pop_back();
+        }
+
+      public:
+        /*! \class const_iterator
+         *  \brief An iterator on the values of a vector, in order. */
+        class const_iterator {
+          private:
+            //! The vector iterated.
+            const PersistentVector* vector;
+
+            //! The index of the value.
+            triton::usize index;
+
+          public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = T;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = const T*;
+            using reference         = const T&;
+
+            //! Constructor.
+            const_iterator(const PersistentVector* vector, triton::usize index) : vector(vector), index(index) {}
+
+            //! Returns the value.
+            const T& operator*() const { return (*this->vector)[this->index]; }
+
+            //! Returns a pointer to the value.
+            const T* operator->() const { return &(*this->vector)[this->index]; }
+
+            //! Moves to the next value.
+            const_iterator& operator++() { this->index++; return *this; }
+
+            //! Returns true if both iterators are at the same value.
+            bool operator==(const const_iterator& other) const { return this->index == other.index; }
+
+            //! Returns true if the iterators are at different values.
+            bool operator!=(const const_iterator& other) const { return this->index != other.index; }
+        };
+
+        //! Returns the value at `index`, which must be lower than the size. The reference is valid until the next write.
+        const T& operator[](triton::usize index) const {
+          return this->leafOf(index)->values[index & (width - 1)];
+        }
+
+        //! Returns the first value. The vector must not be empty.
+        const T& front(void) const {
+          return (*this)[0];
+        }
+
+        //! Returns the last value. The vector must not be empty.
+        const T& back(void) const {
+          return (*this)[this->count - 1];
+        }
+
+        //! Returns a writable reference to the value at `index`, which must be lower than the size. The reference is valid until the next write.
+        T& modify(triton::usize index) {
+          std::shared_ptr<Node>* node = &this->root;
+
+          for (triton::uint32 s = this->shift; s > 0; s -= bits) {
+            detach(*node);
+            node = &(*node)->children[(index >> s) & (width - 1)];
+          }
+
+          detach(*node);
+          return (*node)->values[index & (width - 1)];
+        }
+
+        //! Sets the value at `index`, which must be lower than the size.
+        void set(triton::usize index, const T& value) {
+          this->modify(index) = value;
+        }
+
+        //! Appends `value`.
+        void push_back(const T& value) {
+          if (this->root == nullptr)
+            this->root = std::make_shared<Node>();
+
+          /* The trie is full, it becomes the first child of a new root */
+          else if (this->count == (width << this->shift)) {
+            auto top = std::make_shared<Node>();
+            top->children.push_back(std::move(this->root));
+            this->root = std::move(top);
+            this->shift += bits;
+          }
+
+          std::shared_ptr<Node>* node = &this->root;
+          for (triton::uint32 s = this->shift; s > 0; s -= bits) {
+            detach(*node);
+            auto& children = (*node)->children;
+            triton::usize i = (this->count >> s) & (width - 1);
+            if (i == children.size())
+              children.push_back(std::make_shared<Node>());
+            node = &children[i];
+          }
+
+          detach(*node);
+          (*node)->values.push_back(value);
+          this->count++;
+        }
+
+        //! Removes the last value, if any.
+        void pop_back(void) {
+          if (this->count == 0)
+            return;
+
+          remove(this->root, this->shift);
+          this->count--;
+
+          if (this->count == 0) {
+            this->root  = nullptr;
+            this->shift = 0;
+            return;
+          }
+
+          /* A root with a single child is dropped */
+          while (this->shift > 0 && this->root->children.size() == 1) {
+            std::shared_ptr<Node> child = this->root->children.front();
+            this->root = std::move(child);
+            this->shift -= bits;
+          }
+        }
+
+        //! Removes the values from `size` to the end.
+        void truncate(triton::usize size) {
+          if (size == 0) {
+            this->clear();
+            return;
+          }
+
+          while (this->count > size)
+            this->pop_back();
+        }
+
+        //! Removes all values.
+        void clear(void) {
+          this->root  = nullptr;
+          this->shift = 0;
+          this->count = 0;
+        }
+
+        //! Returns the number of values.
+        triton::usize size(void) const {
+          return this->count;
+        }
+
+        //! Returns true if the vector is empty.
+        bool empty(void) const {
+          return this->count == 0;
+        }
+
+        //! Returns an iterator on the first value.
+        const_iterator begin(void) const {
+          return const_iterator(this, 0);
+        }
+
+        //! Returns an iterator past the last value.
+        const_iterator end(void) const {
+          return const_iterator(this, this->count);
+        }
+    };
+
+  /*! @} End of utils namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_PERSISTENTVECTOR_H */
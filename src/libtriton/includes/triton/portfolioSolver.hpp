@@ -0,0 +1,137 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_PORTFOLIOSOLVER_H
+#define TRITON_PORTFOLIOSOLVER_H
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/solverInterface.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      //! \class PortfolioSolver
+      /*! \brief Solver engine racing several solvers.
+       *
+       * \description
+       * Every query is given to each solver of the portfolio, on its own thread. The first SAT or UNSAT
+       * answer is returned and the other solvers are interrupted. The solver which answered first is
+       * recorded (see `getWins()`), e.g. to choose the solver of the next queries. If no solver answers,
+       * the status of the first one is returned.
+       */
+      class PortfolioSolver : public SolverInterface {
+        private:
+          //! The kinds of the solvers raced on every query.
+          std::vector<triton::engines::solver::solver_e> backends;
+
+          //! The SMT solver timeout. By default, unlimited. This global timeout may be changed for a specific query (isSat/getModel/getModels) via argument `timeout`.
+          triton::uint32 timeout;
+
+          //! The SMT solver memory limit of each solver. By default, unlimited.
+          triton::uint32 memoryLimit;
+
+          //! Protects the statistics, the solver may be queried from several threads.
+          mutable std::mutex lock;
+
+          //! The number of queries answered first, by solver kind.
+          mutable std::map<triton::engines::solver::solver_e, triton::usize> wins;
+
+          //! The solver which answered the last query first, SOLVER_INVALID if none answered.
+          mutable triton::engines::solver::solver_e lastWinner;
+
+          //! Returns a new solver of the portfolio.
+          std::unique_ptr<SolverInterface> newBackend(triton::engines::solver::solver_e kind) const;
+
+          //! Races the solvers on `node` and returns the models of the first one answering.
+          std::vector<std::unordered_map<triton::usize, SolverModel>> race(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime, const char* where) const;
+
+        public:
+          //! Constructor. The portfolio holds all the solvers Triton is built with.
+          TRITON_EXPORT PortfolioSolver();
+
+          //! Computes and returns a model from a symbolic constraint. State is returned in the `status` pointer as well as the solving time. A `timeout` can also be defined.
+          /*! \brief map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT std::unordered_map<triton::usize, SolverModel> getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
+          //! Computes and returns several models from a symbolic constraint. The `limit` is the number of models returned. State is returned in the `status` pointer as well as the solving time. A `timeout` can also be defined.
+          /*! \brief vector of map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT std::vector<std::unordered_map<triton::usize, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
+          //! Returns true if an expression is satisfiable.
+          TRITON_EXPORT bool isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
+          //! Returns the name of this solver.
+          TRITON_EXPORT std::string getName(void) const;
+
+          //! Defines a solver timeout (in milliseconds).
+          TRITON_EXPORT void setTimeout(triton::uint32 ms);
+
+          //! Defines a solver memory consumption limit (in megabytes).
+          TRITON_EXPORT void setMemoryLimit(triton::uint32 mem);
+
+          //! Returns the kinds of the solvers raced on every query.
+          TRITON_EXPORT const std::vector<triton::engines::solver::solver_e>& getBackends(void) const;
+
+          //! Defines the kinds of the solvers raced on every query.
+          TRITON_EXPORT void setBackends(const std::vector<triton::engines::solver::solver_e>& kinds);
+
+          //! Returns the solver which answered the last query first, SOLVER_INVALID if none answered.
+          TRITON_EXPORT triton::engines::solver::solver_e getLastWinner(void) const;
+
+          //! Returns the number of queries answered first, by solver kind.
+          TRITON_EXPORT std::map<triton::engines::solver::solver_e, triton::usize> getWins(void) const;
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_PORTFOLIOSOLVER_H */
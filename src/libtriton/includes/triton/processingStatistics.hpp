@@ -0,0 +1,240 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_PROCESSINGSTATISTICS_HPP
+#define TRITON_PROCESSINGSTATISTICS_HPP
+
+#include <chrono>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    /*! The phases of the processing of an instruction */
+    enum phase_e {
+      PHASE_DISASSEMBLY = 0,    /*!< `Architecture::disassembly()` */
+      PHASE_PRE_IR_INIT,        /*!< `IrBuilder::preIrInit()` and the addresses of the memory operands */
+      PHASE_SEMANTICS,          /*!< the semantics of the instruction */
+      PHASE_POST_IR_INIT,       /*!< `IrBuilder::postIrInit()` */
+      PHASE_TAINT,              /*!< the spread of the taint */
+      PHASE_PATH_CONSTRAINT,    /*!< the push of the path constraints */
+      PHASE_CALLBACKS,          /*!< the callbacks */
+      PHASE_LAST,               /*!< must be the last item */
+    };
+
+    /*! \struct PhaseStatistics
+     *  \brief The number of times a phase ran and its total time. */
+    struct PhaseStatistics {
+      //! The number of times the phase ran.
+      triton::usize count = 0;
+
+      //! The total time of the phase (in nanoseconds).
+      triton::uint64 time = 0;
+    };
+
+    /*! \struct OpcodeStatistics
+     *  \brief The instructions processed for an opcode (or at an address) and what they built. */
+    struct OpcodeStatistics {
+      //! The number of instructions processed.
+      triton::usize instructions = 0;
+
+      //! The number of AST nodes allocated by the instructions.
+      triton::usize nodes = 0;
+
+      //! The number of symbolic expressions kept by the instructions.
+      triton::usize expressions = 0;
+    };
+
+    /*! \struct BlockStatistics
+     *  \brief The executions of a basic block and what its instructions built. */
+    struct BlockStatistics {
+      //! The number of times the block was entered.
+      triton::usize executions = 0;
+
+      //! The number of instructions processed in the block.
+      triton::usize instructions = 0;
+
+      //! The number of AST nodes allocated by the instructions of the block.
+      triton::usize nodes = 0;
+    };
+
+    //! \class ProcessingStatistics
+    /*! \brief The statistics of the processing of the instructions.
+     *
+     * \description
+     * Once enabled, each phase of `API::processing()` is counted and timed (see `phase_e`), and each instruction
+     * adds the AST nodes it allocated and the symbolic expressions it kept to its opcode, to its address and
+     * to its basic block. A basic block starts at the first instruction processed and after each instruction
+     * which modifies the control flow, so the blocks follow the executed path. Disabled, a phase only checks a
+     * flag. The top-N getters tell the semantic handlers worth optimizing and the hot addresses and blocks.
+     *
+     * The phases nest: the semantics include the taint, the path constraints and the callbacks they trigger, and
+     * the callbacks may process instructions. A phase entered again while it runs is only timed once.
+     */
+    class ProcessingStatistics {
+      private:
+        //! True if the phases are recorded.
+        bool enabled;
+
+        //! The statistics of each phase.
+        PhaseStatistics phases[PHASE_LAST];
+
+        //! The number of times each phase is running.
+        triton::uint32 depths[PHASE_LAST];
+
+        //! The number of instructions processed.
+        triton::usize instructions;
+
+        //! The number of AST nodes allocated by the instructions.
+        triton::usize nodes;
+
+        //! The number of symbolic expressions kept by the instructions.
+        triton::usize expressions;
+
+        //! The statistics of each opcode, by type of instruction.
+        std::unordered_map<triton::uint32, OpcodeStatistics> opcodes;
+
+        //! The statistics of each instruction, by address.
+        std::unordered_map<triton::uint64, OpcodeStatistics> addresses;
+
+        //! The statistics of each basic block, by address of its first instruction.
+        std::unordered_map<triton::uint64, BlockStatistics> blocks;
+
+        //! The address of the current basic block.
+        triton::uint64 block;
+
+        //! True if the next instruction starts a basic block.
+        bool leader;
+
+      public:
+        //! Constructor.
+        TRITON_EXPORT ProcessingStatistics();
+
+        //! Returns true if the phases are recorded.
+        inline bool isEnabled(void) const {
+          return this->enabled;
+        }
+
+        //! Enables or disables the recording of the phases. By default, disabled.
+        TRITON_EXPORT void setEnabled(bool flag);
+
+        //! Enters a phase. Returns true if it is not already running, its time is then recorded on `leave()`.
+        inline bool enter(triton::arch::phase_e phase) {
+          return this->depths[phase]++ == 0;
+        }
+
+        //! Leaves a phase, and records `time` nanoseconds if it was not already running.
+        inline void leave(triton::arch::phase_e phase, bool outermost, triton::uint64 time) {
+          this->depths[phase]--;
+          if (outermost) {
+            this->phases[phase].count++;
+            this->phases[phase].time += time;
+          }
+        }
+
+        //! Records an instruction of type `type` at `address`, which allocated `nodes` AST nodes and kept `expressions` symbolic expressions. `controlFlow` ends its basic block.
+        TRITON_EXPORT void recordInstruction(triton::uint32 type, triton::uint64 address, bool controlFlow, triton::usize nodes, triton::usize expressions);
+
+        //! Returns the statistics of a phase.
+        TRITON_EXPORT const PhaseStatistics& getPhase(triton::arch::phase_e phase) const;
+
+        //! Returns the name of a phase, e.g. `semantics`.
+        TRITON_EXPORT static const char* getPhaseName(triton::arch::phase_e phase);
+
+        //! Returns the number of instructions processed.
+        TRITON_EXPORT triton::usize getInstructions(void) const;
+
+        //! Returns the number of AST nodes allocated by the instructions.
+        TRITON_EXPORT triton::usize getNodes(void) const;
+
+        //! Returns the number of symbolic expressions kept by the instructions.
+        TRITON_EXPORT triton::usize getExpressions(void) const;
+
+        //! Returns the statistics of each opcode, by type of instruction.
+        TRITON_EXPORT const std::unordered_map<triton::uint32, OpcodeStatistics>& getOpcodes(void) const;
+
+        //! Returns the statistics of each instruction, by address.
+        TRITON_EXPORT const std::unordered_map<triton::uint64, OpcodeStatistics>& getAddresses(void) const;
+
+        //! Returns the statistics of each basic block, by address of its first instruction.
+        TRITON_EXPORT const std::unordered_map<triton::uint64, BlockStatistics>& getBlocks(void) const;
+
+        //! Returns the `n` opcodes which allocated the most AST nodes, the costliest first.
+        TRITON_EXPORT std::vector<std::pair<triton::uint32, OpcodeStatistics>> getTopOpcodes(triton::usize n) const;
+
+        //! Returns the `n` addresses processed the most, the hottest first.
+        TRITON_EXPORT std::vector<std::pair<triton::uint64, OpcodeStatistics>> getTopAddresses(triton::usize n) const;
+
+        //! Returns the `n` basic blocks entered the most, the hottest first.
+        TRITON_EXPORT std::vector<std::pair<triton::uint64, BlockStatistics>> getTopBlocks(triton::usize n) const;
+
+        //! Clears the statistics. The running phases are still timed once left.
+        TRITON_EXPORT void clear(void);
+    };
+
+    //! \class PhaseTimer
+    /*! \brief Times a phase from its construction to its destruction, if the statistics are enabled. */
+    class PhaseTimer {
+      private:
+        //! The statistics, null if they are disabled.
+        triton::arch::ProcessingStatistics* statistics;
+
+        //! The phase timed.
+        triton::arch::phase_e phase;
+
+        //! True if the phase was not already running.
+        bool outermost;
+
+        //! The start of the phase.
+        std::chrono::steady_clock::time_point start;
+
+      public:
+        //! Constructor. `statistics` may be null.
+        inline PhaseTimer(triton::arch::ProcessingStatistics* statistics, triton::arch::phase_e phase)
+          : statistics((statistics != nullptr && statistics->isEnabled()) ? statistics : nullptr), phase(phase), outermost(false) {
+          if (this->statistics != nullptr && this->statistics->enter(phase)) {
+            this->outermost = true;
+            this->start     = std::chrono::steady_clock::now();
+          }
+        }
+
+        //! Destructor.
+        inline ~PhaseTimer() {
+          if (this->statistics != nullptr) {
+            triton::uint64 time = 0;
+            if (this->outermost)
+              time = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - this->start).count();
+            this->statistics->leave(this->phase, this->outermost, time);
+          }
+        }
+    };
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_PROCESSINGSTATISTICS_HPP */
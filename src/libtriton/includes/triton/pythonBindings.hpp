@@ -69,6 +69,12 @@ namespace triton {
       //! Initializes the CPUSIZE python namespace.
       void initCpuSizeNamespace(PyObject* cpuSizeDict);
 
+      //! Initializes the EMULATION python namespace.
+      void initEmulationNamespace(PyObject* emulationDict);
+
+      //! Initializes the EXPLORATION python namespace.
+      void initExplorationNamespace(PyObject* explorationDict);
+
       //! Initializes the OPCODE python namespace.
       void initOpcodesNamespace(PyObject* opcodeDict);
 
@@ -99,6 +105,9 @@ namespace triton {
       //! Initializes the SYMBOLIC python namespace.
       void initSymbolicNamespace(PyObject* symbolicDict);
 
+      //! Initializes the TRACE python namespace.
+      void initTraceNamespace(PyObject* traceDict);
+
       //! Initializes the VERSION python namespace.
       void initVersionNamespace(PyObject* versionDict);
 
@@ -19,10 +19,15 @@
 #include <triton/memoryAccess.hpp>
 #include <triton/pathConstraint.hpp>
 #include <triton/register.hpp>
+#include <triton/solverFuture.hpp>
 #include <triton/solverModel.hpp>
 #include <triton/symbolicExpression.hpp>
 #include <triton/symbolicVariable.hpp>
 
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
 
 
 //! The Triton namespace
@@ -71,9 +76,30 @@ namespace triton {
       //! Creates the Instruction python class.
       PyObject* PyInstruction(triton::uint64 addr, const triton::uint8* opcodes, triton::uint32 opSize);
 
+      //! Creates the ListView python class over path constraints.
+      PyObject* PyListView(const std::vector<triton::engines::symbolic::PathConstraint>& items);
+
+      //! Creates the ListView python class over addresses, which are sorted.
+      PyObject* PyListView(const std::unordered_set<triton::uint64>& items);
+
+      //! Creates the MapView python class over symbolic expressions by id.
+      PyObject* PyMapView(const std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicExpression>& items);
+
+      //! Creates the MapView python class over symbolic variables by id.
+      PyObject* PyMapView(const std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicVariable>& items);
+
       //! Creates the Memory python class.
       PyObject* PyMemoryAccess(const triton::arch::MemoryAccess& mem);
 
+      //! Creates a Namespace python class whose attributes are set by `fill` on first access.
+      PyObject* PyNamespace(const char* name, void (*fill)(PyObject* dict));
+
+      //! Creates the Namespace python class of the registers of `api`, which are created on access.
+      PyObject* PyNamespace(triton::API* api);
+
+      //! Detaches a Namespace of registers from its context, only the registers already accessed remain.
+      void PyNamespace_Detach(PyObject* self);
+
       //! Creates the PathConstraint python class.
       PyObject* PyPathConstraint(const triton::engines::symbolic::PathConstraint& pc);
 
@@ -83,6 +109,9 @@ namespace triton {
       //! Creates the new TritonContext python class.
       PyObject* PyTritonContext(triton::arch::architecture_e arch);
 
+      //! Creates the new TritonContext python class which owns `api`.
+      PyObject* PyTritonContext(triton::API* api);
+
       //! Creates a TritonContext python class which is a reference to another Context.
       PyObject* PyTritonContextRef(triton::API& api);
 
@@ -92,6 +121,9 @@ namespace triton {
       //! Creates the Register python class.
       PyObject* PyRegister(const triton::arch::Register& reg);
 
+      //! Creates the SolverFuture python class.
+      PyObject* PySolverFuture(const triton::engines::solver::SolverFuture& future);
+
       //! Creates the SolverModel python class.
       PyObject* PySolverModel(const triton::engines::solver::SolverModel& model);
 
@@ -156,6 +188,20 @@ namespace triton {
       //! pyMemory type.
       extern PyTypeObject MemoryAccess_Type;
 
+      /* Namespace ====================================================== */
+
+      //! pyNamespace object.
+      typedef struct {
+        PyObject_HEAD
+        PyObject* name;                 //! The name of the namespace
+        PyObject* dict;                 //! The attributes created so far
+        void (*fill)(PyObject* dict);   //! Sets all the attributes, null once called or for registers
+        triton::API* api;               //! The context of the registers, null for the other namespaces
+      } Namespace_Object;
+
+      //! pyNamespace type.
+      extern PyTypeObject Namespace_Type;
+
       /* PathConstraint ================================================= */
 
       //! pyPathConstraint object.
@@ -189,7 +235,7 @@ namespace triton {
       } TritonContext_Object;
 
       //! pyRegister type.
-      extern PyTypeObject TritonContextObject_Type;
+      extern PyTypeObject TritonContext_Type;
 
       /* AstContext ======================================================= */
 
@@ -202,6 +248,17 @@ namespace triton {
       //! pyRegister type.
       extern PyTypeObject AstContextObject_Type;
 
+      /* SolverFuture =================================================== */
+
+      //! pySolverFuture object.
+      typedef struct {
+        PyObject_HEAD
+        triton::engines::solver::SolverFuture* future; //! Pointer to the cpp solver future
+      } SolverFuture_Object;
+
+      //! pySolverFuture type.
+      extern PyTypeObject SolverFuture_Type;
+
       /* SolverModel ==================================================== */
 
       //! pySolverModel object.
@@ -235,6 +292,51 @@ namespace triton {
       //! pySymbolicVariable type.
       extern PyTypeObject SymbolicVariable_Type;
 
+      /* View =========================================================== */
+
+      //! \class View
+      /*! \brief The items of a C++ container, converted to Python objects on access. */
+      class View {
+        public:
+          //! Destructor.
+          virtual ~View() {}
+
+          //! Returns the number of items.
+          virtual triton::usize size(void) const = 0;
+
+          //! Returns the key of the item at `index`, its index for a list.
+          virtual PyObject* key(triton::usize index) const = 0;
+
+          //! Returns the value of the item at `index`.
+          virtual PyObject* value(triton::usize index) const = 0;
+
+          //! Sets `index` to the index of the item of `key`. Returns false if there is none.
+          virtual bool find(PyObject* key, triton::usize& index) const = 0;
+      };
+
+      //! pyView object, for the MapView and ListView types.
+      typedef struct {
+        PyObject_HEAD
+        triton::bindings::python::View* view; //! Pointer to the cpp view
+      } View_Object;
+
+      //! pyListView type.
+      extern PyTypeObject ListView_Type;
+
+      //! pyMapView type.
+      extern PyTypeObject MapView_Type;
+
+      //! pyViewIterator object.
+      typedef struct {
+        PyObject_HEAD
+        PyObject* view;       //! The view iterated
+        triton::usize index;  //! The index of the next item
+        triton::uint32 kind;  //! 0 for the keys, 1 for the values, 2 for the items
+      } ViewIterator_Object;
+
+      //! pyViewIterator type.
+      extern PyTypeObject ViewIterator_Type;
+
     /*! @} End of python namespace */
     };
   /*! @} End of bindings namespace */
@@ -270,6 +372,18 @@ namespace triton {
 /*! Returns the triton::arch::MemoryAccess. */
 #define PyMemoryAccess_AsMemoryAccess(v) (((triton::bindings::python::MemoryAccess_Object*)(v))->mem)
 
+/*! Checks if the pyObject is a ListView. */
+#define PyListView_Check(v) ((v)->ob_type == &triton::bindings::python::ListView_Type)
+
+/*! Checks if the pyObject is a MapView. */
+#define PyMapView_Check(v) ((v)->ob_type == &triton::bindings::python::MapView_Type)
+
+/*! Returns the triton::bindings::python::View of a ListView or a MapView. */
+#define PyView_AsView(v) (((triton::bindings::python::View_Object*)(v))->view)
+
+/*! Checks if the pyObject is a Namespace. */
+#define PyNamespace_Check(v) ((v)->ob_type == &triton::bindings::python::Namespace_Type)
+
 /*! Checks if the pyObject is a triton::engines::symbolic::PathConstraint. */
 #define PyPathConstraint_Check(v) ((v)->ob_type == &triton::bindings::python::PathConstraint_Type)
 
@@ -294,6 +408,12 @@ namespace triton {
 /*! Returns the triton::arch::Register. */
 #define PyRegister_AsRegister(v) (((triton::bindings::python::Register_Object*)(v))->reg)
 
+/*! Checks if the pyObject is a triton::engines::solver::SolverFuture. */
+#define PySolverFuture_Check(v) ((v)->ob_type == &triton::bindings::python::SolverFuture_Type)
+
+/*! Returns the triton::engines::solver::SolverFuture. */
+#define PySolverFuture_AsSolverFuture(v) (((triton::bindings::python::SolverFuture_Object*)(v))->future)
+
 /*! Checks if the pyObject is a triton::engines::solver::SolverModel. */
 #define PySolverModel_Check(v) ((v)->ob_type == &triton::bindings::python::SolverModel_Type)
 
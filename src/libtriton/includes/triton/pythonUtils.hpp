@@ -8,6 +8,8 @@
 #ifndef TRITON_PYTHONUTILS_H
 #define TRITON PYTHONUTILS_H
 
+#include <exception>
+
 #include <triton/pythonBindings.hpp>
 #include <triton/tritonTypes.hpp>
 
@@ -81,6 +83,47 @@ namespace triton {
       //! Returns a pyObject from a triton::uint512.
       PyObject* PyLong_FromUint512(triton::uint512 value);
 
+      /*! \class PyGilGuard
+       *  \brief Holds the GIL during its lifetime.
+       *
+       * \description
+       * The Python callbacks take the GIL through a guard, as the engines may call them from a
+       * binding which has released it (see `TritonContext::processTrace()`).
+       */
+      class PyGilGuard {
+        private:
+          //! The state of the GIL before the guard.
+          PyGILState_STATE state;
+
+        public:
+          //! Constructor. Takes the GIL.
+          PyGilGuard() : state(PyGILState_Ensure()) {}
+
+          //! Destructor. Restores the GIL as it was.
+          ~PyGilGuard() { PyGILState_Release(this->state); }
+
+          PyGilGuard(const PyGilGuard&) = delete;
+          PyGilGuard& operator=(const PyGilGuard&) = delete;
+      };
+
+      //! Runs `function` with the GIL released. Its exceptions are rethrown once the GIL is held again.
+      template <typename F>
+      void PyAllowThreads(const F& function) {
+        std::exception_ptr error;
+
+        Py_BEGIN_ALLOW_THREADS
+        try {
+          function();
+        }
+        catch (...) {
+          error = std::current_exception();
+        }
+        Py_END_ALLOW_THREADS
+
+        if (error)
+          std::rethrow_exception(error);
+      }
+
     /*! @} End of python namespace */
     };
   /*! @} End of bindings namespace */
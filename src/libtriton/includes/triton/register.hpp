@@ -43,8 +43,8 @@ namespace triton {
      */
     class Register : public BitsVector, public arm::ArmOperandProperties {
       protected:
-        //! The name of the register.
-        std::string name;
+        //! The name of the register, a string of the specifications which outlives the register. Copying a register never allocates.
+        const char* name;
 
         //! The id of the register.
         triton::arch::register_e id;
@@ -55,16 +55,12 @@ namespace triton {
         //! True if the register is mutable. For example XZR in AArch64 is immutable.
         bool vmutable;
 
-      private:
-        //! Copy a Register.
-        void copy(const Register& other);
-
       public:
         //! Constructor.
         TRITON_EXPORT Register();
 
         //! Constructor.
-        TRITON_EXPORT Register(triton::arch::register_e regId, std::string name, triton::arch::register_e parent, triton::uint32 high, triton::uint32 low, bool vmutable);
+        TRITON_EXPORT Register(triton::arch::register_e regId, const char* name, triton::arch::register_e parent, triton::uint32 high, triton::uint32 low, bool vmutable);
 
         //! Constructor.
         TRITON_EXPORT Register(const triton::arch::CpuInterface&, triton::arch::register_e regId);
@@ -0,0 +1,155 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_REMOTESOLVER_H
+#define TRITON_REMOTESOLVER_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/solverInterface.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/solverSocket.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      //! \class RemoteSolver
+      /*! \brief Solver engine sending the queries to solver servers (see `SolverServer`).
+       *
+       * \description
+       * The queries are sent in the binary format of `AstSerializer` to one of the servers given by
+       * `setEndpoints()`, e.g. `["solver1:7000", "solver2:7000"]`. A query always goes to the same server,
+       * picked by the hash of its bytes, so that the identical queries of several tracers are solved once by
+       * the cache of this server. The next servers are tried if it cannot be reached, the query is UNKNOWN
+       * if none can. The connections are kept open and reused from one query to the next.
+       */
+      class RemoteSolver : public SolverInterface {
+        private:
+          //! The servers and their idle connections, shared by the copies of the solver.
+          struct Servers {
+            //! Protects the idle connections.
+            std::mutex lock;
+
+            //! The endpoints of the servers.
+            std::vector<std::string> endpoints;
+
+            //! The idle connections to each server.
+            std::vector<std::vector<std::unique_ptr<SolverSocket>>> idle;
+          };
+
+          //! The servers, null if none.
+          std::shared_ptr<Servers> servers;
+
+          //! The SMT solver timeout. By default, unlimited. This global timeout may be changed for a specific query (isSat/getModel/getModels) via argument `timeout`.
+          triton::uint32 timeout;
+
+          //! The SMT solver memory limit (in megabytes), enforced by the servers. By default, unlimited.
+          triton::uint32 memoryLimit;
+
+          //! Protects the connections of the running queries.
+          mutable std::mutex runningLock;
+
+          //! The connections of the running queries, shut down by `interrupt()`.
+          mutable std::unordered_set<SolverSocket*> running;
+
+          //! True once the solver is interrupted.
+          std::atomic<bool> interrupted;
+
+          //! Returns a connection to the server `index`, registered as running. Returns null if it cannot be reached.
+          std::unique_ptr<SolverSocket> acquire(triton::usize index) const;
+
+          //! Unregisters a connection, kept for the next queries if `reuse` is true.
+          void release(triton::usize index, std::unique_ptr<SolverSocket> socket, bool reuse) const;
+
+          //! Sends a query to its server and returns its answer. Rethrows the error of the server, if any.
+          RemoteAnswer query(const triton::ast::SharedAbstractNode& node, triton::engines::solver::remote_e kind, triton::uint32 limit, triton::uint32 timeout, const char* where) const;
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT RemoteSolver();
+
+          //! Constructor. The copy shares the servers and their connections.
+          TRITON_EXPORT RemoteSolver(const RemoteSolver& other);
+
+          //! Computes and returns a model from a symbolic constraint. State is returned in the `status` pointer as well as the solving time. A `timeout` can also be defined.
+          /*! \brief map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT std::unordered_map<triton::usize, SolverModel> getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
+          //! Computes and returns several models from a symbolic constraint. The `limit` is the number of models returned. State is returned in the `status` pointer as well as the solving time. A `timeout` can also be defined.
+          /*! \brief vector of map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT std::vector<std::unordered_map<triton::usize, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
+          //! Returns true if an expression is satisfiable.
+          TRITON_EXPORT bool isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
+          //! Returns the name of this solver.
+          TRITON_EXPORT std::string getName(void) const;
+
+          //! Defines a solver timeout (in milliseconds), sent with each query.
+          TRITON_EXPORT void setTimeout(triton::uint32 ms);
+
+          //! Defines a solver memory consumption limit (in megabytes), sent with each query.
+          TRITON_EXPORT void setMemoryLimit(triton::uint32 mem);
+
+          //! Interrupts the running queries by closing their connections, from any thread. They and the next ones return UNKNOWN.
+          TRITON_EXPORT void interrupt(void);
+
+          //! Returns the endpoints of the servers, empty if none.
+          TRITON_EXPORT std::vector<std::string> getEndpoints(void) const;
+
+          //! Defines the endpoints ("host:port") of the servers. The connections to the previous ones are closed.
+          TRITON_EXPORT void setEndpoints(const std::vector<std::string>& endpoints);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_REMOTESOLVER_H */
@@ -0,0 +1,234 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_SEMANTICSCACHE_HPP
+#define TRITON_SEMANTICSCACHE_HPP
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <triton/archEnums.hpp>
+#include <triton/ast.hpp>
+#include <triton/astContext.hpp>
+#include <triton/astEnums.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/immediate.hpp>
+#include <triton/instruction.hpp>
+#include <triton/memoryAccess.hpp>
+#include <triton/register.hpp>
+#include <triton/symbolicExpression.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      class SymbolicEngine;
+
+      /*! \class SemanticsCache
+       *  \brief The expressions built by the semantics of instructions, by address.
+       *
+       * \description
+       * While the semantics of an instruction is built, the symbolic engine reports to the cache
+       * the ASTs of the operands it reads and the expressions it creates. The cache compiles them
+       * into a template: the nodes built by the semantics over the operands, in the order they were
+       * built. Replaying a template reads the operands of the instruction again and rebuilds the nodes
+       * over their new ASTs, then creates the same expressions. Like the disassembly cache, a template
+       * is only replayed on the bytes it was recorded from. The semantics must therefore only depend
+       * on the decoding of the instruction, not on the concrete state, which the caller guarantees.
+       */
+      class SemanticsCache {
+        public:
+          //! The maximum number of templates, the cache is emptied when it is reached.
+          static const triton::usize capacity = 1 << 16;
+
+        private:
+          //! The kinds of calls to the symbolic engine.
+          enum event_e {
+            READ_IMMEDIATE,  //!< getImmediateAst(inst, imm)
+            READ_LEA,        //!< operands[operand].getLeaAst()
+            READ_MEMORY,     //!< getMemoryAst(inst, operands[operand])
+            READ_REGISTER,   //!< getRegisterAst(inst, reg)
+            WRITE_MEMORY,    //!< createSymbolicMemoryExpression(inst, node, operands[operand], comment)
+            WRITE_REGISTER,  //!< createSymbolicRegisterExpression(inst, node, reg, comment)
+            WRITE_VOLATILE,  //!< createSymbolicVolatileExpression(inst, node, comment)
+          };
+
+          //! A call of the semantics to the symbolic engine.
+          struct Event {
+            //! The kind of call.
+            event_e kind;
+
+            //! The register read or written.
+            triton::arch::Register reg;
+
+            //! The immediate read.
+            triton::arch::Immediate imm;
+
+            //! The index of the memory operand read or written.
+            triton::uint32 operand;
+
+            //! The node read or written.
+            triton::uint32 node;
+
+            //! The comment of the expression written.
+            std::string comment;
+          };
+
+          //! A node of a template.
+          struct Op {
+            //! The kind of node. INVALID_NODE for the node read by `event`, REFERENCE_NODE for a reference to the expression written by `event`.
+            triton::ast::ast_e type;
+
+            //! The immediates of EXTRACT, SX, ZX, BVROL and BVROR nodes.
+            triton::uint32 imm1;
+            triton::uint32 imm2;
+
+            //! The size of a BV node.
+            triton::uint32 size;
+
+            //! The value of a BV node.
+            triton::uint512 value;
+
+            //! The event reading the node or writing the referenced expression.
+            triton::uint32 event;
+
+            //! The children, indexes of previous nodes.
+            std::vector<triton::uint32> children;
+          };
+
+          //! The semantics of an instruction.
+          struct Template {
+            //! The architecture the instruction was decoded in.
+            triton::arch::architecture_e arch;
+
+            //! The bytes of the instruction.
+            std::vector<triton::uint8> bytes;
+
+            //! The calls to the symbolic engine, in order.
+            std::vector<Event> events;
+
+            //! The nodes, operands first.
+            std::vector<Op> ops;
+
+            //! The registers set as undefined.
+            std::vector<triton::arch::Register> undefined;
+          };
+
+          //! Maps an address to the template recorded there.
+          std::unordered_map<triton::uint64, Template> templates;
+
+          //! The template being recorded.
+          Template current;
+
+          //! The instruction being recorded, nullptr if none.
+          const triton::arch::Instruction* inst;
+
+          //! True if the semantics being recorded cannot be a template.
+          bool failed;
+
+          //! The write event whose expression is not yet known, or -1.
+          triton::sint64 pending;
+
+          //! Maps the nodes read or built by the semantics being recorded to their index. The nodes are kept alive, so that their address is not reused meanwhile.
+          std::unordered_map<triton::ast::SharedAbstractNode, triton::uint32> nodes;
+
+          //! Maps the expressions created by the semantics being recorded to their write event.
+          std::unordered_map<const SymbolicExpression*, triton::uint32> expressions;
+
+          //! Adds an event reading `node` to the current template.
+          void addRead(Event& event, const triton::ast::SharedAbstractNode& node);
+
+          //! Compiles `node` into the current template and adds an event writing it.
+          void addWrite(Event& event, const triton::ast::SharedAbstractNode& node);
+
+          //! Returns the index of the node in the current template, compiling the nodes not yet known.
+          triton::uint32 compile(const triton::ast::SharedAbstractNode& node);
+
+          //! Returns the index of the memory operand of the recorded instruction, or fails the template.
+          triton::uint32 findOperand(const triton::arch::MemoryAccess& mem);
+
+          //! Links the expression of the pending write event to it.
+          void resolve(void);
+
+          //! Rebuilds a node over its rebuilt children.
+          triton::ast::SharedAbstractNode build(const triton::ast::SharedAstContext& astCtxt, const Op& op, const std::vector<triton::ast::SharedAbstractNode>& built, const std::vector<SharedSymbolicExpression>& exprs) const;
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT SemanticsCache();
+
+          //! Starts recording the semantics of `inst`, decoded in the `arch` architecture.
+          TRITON_EXPORT void record(const triton::arch::Instruction& inst, triton::arch::architecture_e arch);
+
+          //! Stops recording and keeps the template of `inst`, unless it failed.
+          TRITON_EXPORT void commit(triton::arch::Instruction& inst);
+
+          //! Stops recording and drops the template.
+          TRITON_EXPORT void abort(void);
+
+          //! Returns true if a semantics is being recorded.
+          TRITON_EXPORT bool isRecording(void) const;
+
+          //! Records `getImmediateAst(inst, imm)`.
+          TRITON_EXPORT void readImmediate(const triton::arch::Immediate& imm, const triton::ast::SharedAbstractNode& node);
+
+          //! Records `getMemoryAst(inst, mem)`.
+          TRITON_EXPORT void readMemory(const triton::arch::MemoryAccess& mem, const triton::ast::SharedAbstractNode& node);
+
+          //! Records `getRegisterAst(inst, reg)`.
+          TRITON_EXPORT void readRegister(const triton::arch::Register& reg, const triton::ast::SharedAbstractNode& node);
+
+          //! Records `createSymbolicMemoryExpression(inst, node, mem, comment)`, before its expression is created.
+          TRITON_EXPORT void writeMemory(const triton::arch::MemoryAccess& mem, const triton::ast::SharedAbstractNode& node, const std::string& comment);
+
+          //! Records `createSymbolicRegisterExpression(inst, node, reg, comment)`, before its expression is created.
+          TRITON_EXPORT void writeRegister(const triton::arch::Register& reg, const triton::ast::SharedAbstractNode& node, const std::string& comment);
+
+          //! Records `createSymbolicVolatileExpression(inst, node, comment)`, before its expression is created.
+          TRITON_EXPORT void writeVolatile(const triton::ast::SharedAbstractNode& node, const std::string& comment);
+
+          //! Builds the semantics of `inst` from its template and returns true, if its bytes were recorded at its address in the `arch` architecture.
+          TRITON_EXPORT bool replay(triton::arch::Instruction& inst, triton::arch::architecture_e arch, SymbolicEngine* engine, const triton::ast::SharedAstContext& astCtxt) const;
+
+          //! Removes all templates.
+          TRITON_EXPORT void clear(void);
+
+          //! Returns the number of templates.
+          TRITON_EXPORT triton::usize size(void) const;
+      };
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SEMANTICSCACHE_HPP */
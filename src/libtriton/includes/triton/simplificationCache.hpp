@@ -0,0 +1,104 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_SIMPLIFICATIONCACHE_HPP
+#define TRITON_SIMPLIFICATIONCACHE_HPP
+
+#include <functional>
+#include <list>
+#include <map>
+#include <utility>
+
+#include <triton/ast.hpp>
+#include <triton/astEnums.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    /*! \class SimplificationCache
+     *  \brief The results of the expensive simplifiers (see `simplifier_e`), kept from one call to the next.
+     *
+     * \description
+     * The entries are keyed by the simplifier and the hash of the simplified tree, so that the same subtree built
+     * again by another instruction is a hit. The least recently used entries are dropped beyond the capacity. The
+     * results are marked as simplified (see `AbstractNode::setSimplified()`) and returned as is when simplified
+     * again. An entry is ignored once its result is updated, its hash then differs.
+     */
+    class SimplificationCache {
+      private:
+        //! The simplifier and the hash of a simplified tree.
+        using Key = std::pair<triton::uint8, triton::uint128>;
+
+        //! An entry of the cache.
+        struct Entry {
+          //! The result of the simplifier.
+          SharedAbstractNode output;
+
+          //! The hash of the result when it was cached.
+          triton::uint128 hash;
+
+          //! The position of the entry in `recent`.
+          std::list<Key>::iterator position;
+        };
+
+        //! The entries, by key.
+        std::map<Key, Entry> entries;
+
+        //! The keys of the entries, the most recently used first.
+        std::list<Key> recent;
+
+        //! The maximum number of entries, 0 disables the cache.
+        triton::usize capacity;
+
+        //! Drops the least recently used entries beyond the capacity.
+        void evict(void);
+
+      public:
+        //! Constructor.
+        TRITON_EXPORT SimplificationCache(triton::usize capacity=4096);
+
+        //! Returns the result of `simplifier` on `node`, calls `simplify` if it is not cached.
+        TRITON_EXPORT SharedAbstractNode simplify(triton::ast::simplifier_e simplifier, const SharedAbstractNode& node, const std::function<SharedAbstractNode(const SharedAbstractNode&)>& simplify);
+
+        //! Drops all the entries.
+        TRITON_EXPORT void clear(void);
+
+        //! Returns the number of entries.
+        TRITON_EXPORT triton::usize size(void) const;
+
+        //! Returns an estimation of the number of bytes of the entries. The results they keep alive are not counted.
+        TRITON_EXPORT triton::usize getBytes(void) const;
+
+        //! Returns the maximum number of entries.
+        TRITON_EXPORT triton::usize getCapacity(void) const;
+
+        //! Sets the maximum number of entries, 0 disables the cache.
+        TRITON_EXPORT void setCapacity(triton::usize capacity);
+    };
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SIMPLIFICATIONCACHE_HPP */
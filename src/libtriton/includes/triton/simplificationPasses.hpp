@@ -0,0 +1,82 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_SIMPLIFICATIONPASSES_H
+#define TRITON_SIMPLIFICATIONPASSES_H
+
+#include <string>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/symbolicSimplification.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      //! \class SimplificationPasses
+      /*! \brief The library of the native simplification passes.
+       *
+       * \description
+       * Each pass rewrites the node it is given, the pass manager of `SymbolicSimplification` walking
+       * the AST and iterating up to a fixed point:
+       *
+       * - `neutral`: `x + 0`, `x - 0`, `x * 1`, `x & -1`, `x | 0`, `x ^ 0` and the shifts by 0 to `x`.
+       * - `absorbing`: `x * 0`, `x & 0` to 0 and `x | -1` to -1.
+       * - `idempotence`: `x & x` and `x | x` to `x`.
+       * - `complement`: `x ^ x`, `x - x`, `x & ~x` and `x + -x` to 0, `x | ~x`, `x ^ ~x` and `x + ~x` to -1.
+       * - `involution`: `~~x` and `--x` to `x`, `x ^ -1` to `~x` and `x * -1` to `-x`.
+       * - `absorption`: `x & (x | y)` and `x | (x & y)` to `x`.
+       * - `mba-linear`: normalizes the linear mixed boolean-arithmetic expressions of up to 4 operands, a sum of
+       *   bitwise functions of the operands multiplied by constants, e.g. `(x & y) + (x | y)` to `x + y` or
+       *   `(x | y) - (x & y)` to `x ^ y`. The expression is evaluated on the operands set to 0 and 1, its
+       *   signature giving its combination of conjunctions, and a bitwise function scaled and offset if it has
+       *   at most 2 operands. The smallest form is kept if it is smaller than the expression.
+       */
+      class SimplificationPasses {
+        public:
+          //! Returns the names of the passes, in their default order.
+          TRITON_EXPORT static const std::vector<std::string>& getNames(void);
+
+          //! Returns the rule of the pass `name`.
+          TRITON_EXPORT static triton::engines::symbolic::SimplificationRule getPass(const std::string& name);
+
+          //! Returns the default order of the pass `name`, the order of its name in `getNames()`.
+          TRITON_EXPORT static triton::sint32 getOrder(const std::string& name);
+      };
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SIMPLIFICATIONPASSES_H */
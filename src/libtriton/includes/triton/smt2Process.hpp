@@ -0,0 +1,142 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_SMT2PROCESS_H
+#define TRITON_SMT2PROCESS_H
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      //! \class Smt2Process
+      /*! \brief A solver subprocess reading SMT-LIB2 commands on its standard input.
+       *
+       * \description
+       * The process is spawned with a memory limit (`RLIMIT_AS`). It may crash or be killed at any time,
+       * the commands sent and the answers waited for then fail and the process is dead.
+       */
+      class Smt2Process {
+        private:
+          //! The process id, -1 once it is waited for.
+          triton::sint64 pid;
+
+          //! The end of the standard input of the process.
+          int input;
+
+          //! The end of the standard output of the process.
+          int output;
+
+          //! The output read and not parsed yet.
+          std::string buffer;
+
+          //! True once the process is dead.
+          bool dead;
+
+          //! Extracts an answer from the buffer. Returns false if it is not complete yet.
+          bool extract(std::string& answer);
+
+        public:
+          //! Constructor. Spawns `command` with a memory limit (in megabytes, 0 for none).
+          TRITON_EXPORT Smt2Process(const std::vector<std::string>& command, triton::uint32 memoryLimit);
+
+          //! Destructor. Kills the process.
+          TRITON_EXPORT ~Smt2Process();
+
+          //! Returns true while the process runs.
+          TRITON_EXPORT bool isAlive(void);
+
+          //! Sends commands. Returns false if the process is dead.
+          TRITON_EXPORT bool send(const std::string& commands);
+
+          //! Waits for an answer (e.g. `sat` or a s-expression) for at most `timeout` milliseconds (0 for no limit). Returns false on timeout or if the process is dead.
+          TRITON_EXPORT bool receive(std::string& answer, triton::uint32 timeout);
+
+          //! Kills the process, from any thread.
+          TRITON_EXPORT void kill(void);
+      };
+
+
+      //! \class Smt2ProcessPool
+      /*! \brief The idle solver subprocesses of a command, reused from one query to the next. */
+      class Smt2ProcessPool {
+        private:
+          //! Protects the pool, it may be used from several threads.
+          std::mutex lock;
+
+          //! The command spawning the processes.
+          std::vector<std::string> command;
+
+          //! The memory limit of the processes (in megabytes), 0 for none.
+          triton::uint32 memoryLimit;
+
+          //! The max number of idle processes kept.
+          triton::usize size;
+
+          //! The idle processes.
+          std::vector<std::unique_ptr<Smt2Process>> idle;
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT Smt2ProcessPool(const std::vector<std::string>& command, triton::usize size);
+
+          //! Returns an idle process, spawned (and set up to produce models) if there is none.
+          TRITON_EXPORT std::unique_ptr<Smt2Process> acquire(void);
+
+          //! Gives back a process, kept if it is alive and the pool is not full.
+          TRITON_EXPORT void release(std::unique_ptr<Smt2Process> process);
+
+          //! Returns the command spawning the processes.
+          TRITON_EXPORT const std::vector<std::string>& getCommand(void) const;
+
+          //! Returns the max number of idle processes kept.
+          TRITON_EXPORT triton::usize getSize(void);
+
+          //! Defines the max number of idle processes kept.
+          TRITON_EXPORT void setSize(triton::usize size);
+
+          //! Returns the memory limit of the processes (in megabytes).
+          TRITON_EXPORT triton::uint32 getMemoryLimit(void);
+
+          //! Defines the memory limit of the processes (in megabytes). The idle processes are dropped.
+          TRITON_EXPORT void setMemoryLimit(triton::uint32 limit);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SMT2PROCESS_H */
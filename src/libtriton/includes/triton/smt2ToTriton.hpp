@@ -0,0 +1,205 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_SMT2TOTRITON_H
+#define TRITON_SMT2TOTRITON_H
+
+#include <functional>
+#include <istream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/symbolicVariable.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    //! \class Smt2ToTriton
+    /*! \brief Parses an SMT-LIB2 script (QF_BV, and the arrays of bytes of `TritonToSmt2`) into Triton's ASTs.
+     *
+     * \description
+     * The script is read from a stream as it is parsed, and its terms are built directly in the AST context, without
+     * recursion so that deep terms do not overflow the stack. The symbols bound by a `let` are the nodes of their
+     * terms, shared by all their uses. The functions defined with arguments are macros, expanded where they are
+     * applied. A declared bit-vector constant is the symbolic variable mapped onto its name by `setVariable()`, else
+     * the one returned by the declaration handler, else the variable of the context with its name (e.g. `SymVar_3`).
+     * A Boolean constant is a variable of 1 bit equal to 1. The declarations, definitions and assertions are kept
+     * between the scripts parsed, as the ones of a solver, and scoped by `push` and `pop`.
+     */
+    class Smt2ToTriton {
+      public:
+        //! Returns the variable of the bit-vector constant `name` of `size` bits declared without mapping, null for the variable of the context with its name.
+        using DeclarationHandler = std::function<triton::engines::symbolic::SharedSymbolicVariable(const std::string& name, triton::uint32 size)>;
+
+      private:
+        //! The kind of a token.
+        enum token_e {
+          TOKEN_EOF,     //!< The end of the script.
+          TOKEN_LPAREN,  //!< `(`
+          TOKEN_RPAREN,  //!< `)`
+          TOKEN_SYMBOL,  //!< A symbol, a keyword or a literal.
+          TOKEN_STRING,  //!< A string literal.
+        };
+
+        //! A token.
+        struct Token {
+          //! The kind of the token.
+          token_e kind;
+
+          //! The text of a symbol or of a string, without its quotes.
+          std::string text;
+        };
+
+        //! A function defined with arguments, expanded where it is applied.
+        struct Macro {
+          //! The names of the arguments.
+          std::vector<std::string> arguments;
+
+          //! The tokens of the body.
+          std::vector<Token> body;
+        };
+
+        //! A symbol bound to a node, by the script or by a let (or a macro) of `level`, 0 for the script.
+        struct Binding {
+          //! The node.
+          SharedAbstractNode node;
+
+          //! The level of the let bindings.
+          triton::usize level;
+        };
+
+        //! A source of tokens: the stream, or the body of a macro.
+        struct Source;
+
+        //! The AST context the nodes are built in.
+        triton::ast::SharedAstContext astCtxt;
+
+        //! Returns the variables of the constants declared without mapping, null to only look them up in the context.
+        DeclarationHandler handler;
+
+        //! The variables mapped onto constants, by name.
+        std::unordered_map<std::string, triton::engines::symbolic::SharedSymbolicVariable> mapping;
+
+        //! The bound symbols, by name, the innermost binding last.
+        std::unordered_map<std::string, std::vector<Binding>> symbols;
+
+        //! The macros, by name.
+        std::unordered_map<std::string, Macro> macros;
+
+        //! The assertions.
+        std::vector<SharedAbstractNode> assertions;
+
+        //! The names declared or defined in each scope, the first one being the one of the script.
+        std::vector<std::vector<std::string>> declared;
+
+        //! The number of assertions before each scope.
+        std::vector<triton::usize> asserted;
+
+        //! The level of the let bindings visible, a macro body only seeing its own ones.
+        triton::usize level;
+
+        //! The number of levels opened, numbering the next one.
+        triton::usize levels;
+
+        //! The line of the stream being parsed, for the errors.
+        triton::usize line;
+
+        //! Reads the next token of `source` into `token`.
+        void next(Source& source, Token& token);
+
+        //! Reads the next token of `source`, which must be of `kind`.
+        void expect(Source& source, Token& token, token_e kind);
+
+        //! Skips the tokens until the parenthesis closing the current one.
+        void skip(Source& source, Token& token);
+
+        //! Throws a parsing error.
+        [[noreturn]] void error(const std::string& message) const;
+
+        //! Returns the value of a numeral.
+        triton::uint32 numeral(const Token& token) const;
+
+        //! Parses a sort. Returns the size of a bit-vector, 0 for a Boolean, and sets `array` to the size of the indexes of an array.
+        triton::uint32 parseSort(Source& source, Token& token, triton::uint32& array);
+
+        //! Parses a term.
+        SharedAbstractNode parseTerm(Source& source, Token& token);
+
+        //! Parses a command, its opening parenthesis being read. Returns false on `exit`.
+        bool parseCommand(Source& source, Token& token);
+
+        //! Returns the node of an atom.
+        SharedAbstractNode atom(const Token& token);
+
+        //! Returns the node of the application of `op`, indexed by `indexes`, to `args`.
+        SharedAbstractNode apply(const std::string& op, const std::vector<triton::uint32>& indexes, std::vector<SharedAbstractNode>& args);
+
+        //! Returns the node of a declared constant.
+        SharedAbstractNode constant(const std::string& name, triton::uint32 size, triton::uint32 array);
+
+        //! Binds `name` to `node` at `level`.
+        void bind(const std::string& name, const SharedAbstractNode& node, triton::usize level);
+
+        //! Removes the innermost binding of `name`.
+        void unbind(const std::string& name);
+
+        //! Records the declaration of a name in the current scope.
+        void declare(const std::string& name);
+
+        //! Forgets a declared or defined name.
+        void forget(const std::string& name);
+
+        //! Removes the let bindings left by a parsing error.
+        void purge(void);
+
+      public:
+        //! Constructor. The constants declared without mapping are given to `handler` before being looked up in the context.
+        TRITON_EXPORT Smt2ToTriton(const triton::ast::SharedAstContext& ctxt, const DeclarationHandler& handler = nullptr);
+
+        //! Maps the constant `name`, declared by the next scripts, onto the symbolic variable `var`.
+        TRITON_EXPORT void setVariable(const std::string& name, const triton::engines::symbolic::SharedSymbolicVariable& var);
+
+        //! Parses the script of `stream`, and returns the assertions in scope at its end.
+        TRITON_EXPORT const std::vector<SharedAbstractNode>& parse(std::istream& stream);
+
+        //! Parses the script `script`, and returns the assertions in scope at its end.
+        TRITON_EXPORT const std::vector<SharedAbstractNode>& parse(const std::string& script);
+
+        //! Parses a single term, over the constants and functions declared so far.
+        TRITON_EXPORT SharedAbstractNode parseTerm(const std::string& term);
+
+        //! Returns the assertions in scope.
+        TRITON_EXPORT const std::vector<SharedAbstractNode>& getAssertions(void) const;
+
+        //! Forgets the declarations, the definitions and the assertions. The variables mapped are kept.
+        TRITON_EXPORT void reset(void);
+    };
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SMT2TOTRITON_H */
@@ -0,0 +1,137 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_SOLVERBUDGET_HPP
+#define TRITON_SOLVERBUDGET_HPP
+
+#include <unordered_map>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      //! \class SolverBudget
+      /*! \brief Derives the timeouts of the queries of the branches from their size, their history and a budget.
+       *
+       * \description
+       * The timeout of a query is the base timeout scaled by its size, `1 + floor(log2(1 + nodes)) / 4 + variables / 32`.
+       * A branch which was answered before gets at most 4 times the time it took (but not less than a tenth of the base
+       * timeout), and a branch whose query timed out gets 4 times its previous timeout, so that the expensive branches
+       * are retried at higher timeouts once the cheaper ones are done. The timeouts never exceed the max timeout nor
+       * what is left of the budget of the exploration.
+       */
+      class SolverBudget {
+        private:
+          //! What is known of the queries of a branch.
+          struct History {
+            //! The status of the last query.
+            triton::engines::solver::status_e status;
+
+            //! The timeout of the last query (in milliseconds).
+            triton::uint32 timeout;
+
+            //! The solving time of the last query (in milliseconds).
+            triton::uint32 time;
+          };
+
+          //! True if the timeouts are adaptive.
+          bool enabled;
+
+          //! The timeout of a query of one node without history (in milliseconds).
+          triton::uint32 baseTimeout;
+
+          //! The max timeout of a query (in milliseconds).
+          triton::uint32 maxTimeout;
+
+          //! The solving time of the exploration (in milliseconds), 0 for unlimited.
+          triton::uint64 budget;
+
+          //! The solving time spent (in milliseconds).
+          triton::uint64 spent;
+
+          //! The number of queries retried after a timeout.
+          triton::usize retries;
+
+          //! The history of the branches, by address.
+          std::unordered_map<triton::uint64, History> branches;
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT SolverBudget();
+
+          //! Returns true if the timeouts are adaptive.
+          TRITON_EXPORT bool isEnabled(void) const;
+
+          //! Enables or disables the adaptive timeouts. By default, disabled.
+          TRITON_EXPORT void setEnabled(bool flag);
+
+          //! Returns the timeout of the query `node` of the branch at `address`.
+          TRITON_EXPORT triton::uint32 getTimeout(const triton::ast::SharedAbstractNode& node, triton::uint64 address) const;
+
+          //! Records the answer of a query of the branch at `address`, solved in `time` milliseconds with `timeout`.
+          TRITON_EXPORT void record(triton::uint64 address, triton::engines::solver::status_e status, triton::uint32 timeout, triton::uint32 time);
+
+          //! Returns true if the last query of the branch at `address` timed out below the max timeout.
+          TRITON_EXPORT bool isRetryable(triton::uint64 address) const;
+
+          //! Returns true if the budget is spent.
+          TRITON_EXPORT bool isExhausted(void) const;
+
+          //! Returns the timeout of a query of one node without history (in milliseconds).
+          TRITON_EXPORT triton::uint32 getBaseTimeout(void) const;
+
+          //! Returns the max timeout of a query (in milliseconds).
+          TRITON_EXPORT triton::uint32 getMaxTimeout(void) const;
+
+          //! Returns the solving time of the exploration (in milliseconds), 0 for unlimited.
+          TRITON_EXPORT triton::uint64 getBudget(void) const;
+
+          //! Returns the solving time spent (in milliseconds).
+          TRITON_EXPORT triton::uint64 getSpent(void) const;
+
+          //! Returns the number of queries retried after a timeout.
+          TRITON_EXPORT triton::usize getRetries(void) const;
+
+          //! Defines the solving time of the exploration (0 for unlimited) and the base and max timeouts, in milliseconds. The time spent is reset. By default, unlimited, 1000 and 60000 ms.
+          TRITON_EXPORT void setBudget(triton::uint64 budget, triton::uint32 baseTimeout = 1000, triton::uint32 maxTimeout = 60000);
+
+          //! Forgets the history of the branches and the time spent, for a new exploration.
+          TRITON_EXPORT void reset(void);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SOLVERBUDGET_HPP */
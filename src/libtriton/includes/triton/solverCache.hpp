@@ -0,0 +1,200 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_SOLVERCACHE_HPP
+#define TRITON_SOLVERCACHE_HPP
+
+#include <deque>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      /*! \class SolverCache
+       *  \brief The answers of the solver, by query.
+       *
+       * \description
+       * A query is identified by the structural hash of its node (see `AbstractNode::getHash()`), in which
+       * references are unrolled and the children of commutative operators are ordered. Equivalent queries
+       * built again over the same variables, e.g. the same branch negated on every iteration of a loop, hit
+       * the cache. Only SAT and UNSAT answers are recorded, with the values of the model by variable id. The
+       * least recently used entry is evicted once the capacity is reached. Entries may be appended to a
+       * backing file, loaded again by another context or another run.
+       *
+       * Queries missing the cache may still be answered as a counterexample cache does. The concrete values
+       * of the variables and the recent models are evaluated on the query (see `AstEvaluator`), one of them
+       * satisfying it is its model. A query whose conjuncts contain all the conjuncts of a recent UNSAT query
+       * or of a recent UNSAT core is UNSAT too.
+       */
+      class SolverCache {
+        public:
+          //! The number of recent models evaluated on the queries missing the cache.
+          static const triton::usize modelsCapacity = 16;
+
+          //! The number of recent UNSAT queries whose conjuncts are looked for in the queries missing the cache.
+          static const triton::usize unsatCapacity = 64;
+
+        private:
+          //! The hash of a query.
+          using Key = std::pair<triton::uint64, triton::uint64>;
+
+          //! Hashes a key.
+          struct KeyHash {
+            std::size_t operator()(const Key& key) const {
+              return std::hash<triton::uint64>()(key.first ^ (key.second * 0x9e3779b97f4a7c15));
+            }
+          };
+
+          //! An answer of the solver.
+          struct Entry {
+            //! The status of the query.
+            triton::engines::solver::status_e status;
+
+            //! True if the model was computed. An isSat() query does not compute it.
+            bool hasModel;
+
+            //! The values of the model, by variable id.
+            std::unordered_map<triton::usize, triton::uint512> values;
+
+            //! The position of the entry in the order of use.
+            std::list<Key>::iterator use;
+          };
+
+          //! The entries, by query.
+          std::unordered_map<Key, Entry, KeyHash> entries;
+
+          //! The keys of the entries, the most recently used first.
+          std::list<Key> uses;
+
+          //! The maximum number of entries. The cache is disabled if 0.
+          triton::usize capacity;
+
+          //! The number of values of the models of the entries.
+          triton::usize values;
+
+          //! The number of queries answered by the cache.
+          triton::usize hits;
+
+          //! The number of queries not answered by the cache.
+          triton::usize misses;
+
+          //! The number of queries answered by a recent model, the concrete values or a recent UNSAT query.
+          triton::usize counterexamples;
+
+          //! The recent models, by variable id. The most recent first.
+          std::deque<std::unordered_map<triton::usize, triton::uint512>> models;
+
+          //! The sorted keys of the conjuncts of the recent UNSAT queries and cores. The most recent first.
+          std::deque<std::vector<Key>> unsatConjuncts;
+
+          //! The backing file, empty if there is none.
+          std::string path;
+
+          //! Protects the cache, the solver may be queried from several threads.
+          mutable std::mutex lock;
+
+          //! Returns the key of a query.
+          static Key keyOf(const triton::ast::SharedAbstractNode& node);
+
+          //! Records an entry, moved into the cache, and evicts the least recently used ones beyond the capacity.
+          void record(const Key& key, Entry& entry);
+
+          //! Evicts the least recently used entries beyond the capacity.
+          void evict(void);
+
+          //! Appends an entry to the backing file.
+          void store(const Key& key, const Entry& entry) const;
+
+          //! Returns the sorted keys of the conjuncts of a query. The conjuncts which are not symbolized and hold are left out.
+          static std::vector<Key> conjunctsOf(const triton::ast::SharedAbstractNode& node);
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT SolverCache();
+
+          //! Returns the status of `node` in `status` and true if it is in the cache. The model is returned in `model` if it is not null, a SAT entry has to hold one then.
+          TRITON_EXPORT bool find(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e& status, std::unordered_map<triton::usize, SolverModel>* model);
+
+          //! Returns the status of `node` in `status` and true if it is satisfied by a recent model or by the concrete values of its variables, or if it contains the conjuncts of a recent UNSAT query. The satisfying values are returned in `model` if it is not null.
+          TRITON_EXPORT bool findCounterexample(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e& status, std::unordered_map<triton::usize, SolverModel>* model);
+
+          //! Records the answer of the solver to `node`. The `model` is null for an isSat() query. Answers other than SAT and UNSAT are not recorded.
+          TRITON_EXPORT void insert(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e status, const std::unordered_map<triton::usize, SolverModel>* model);
+
+          //! Records an UNSAT core (see `SolverInterface::getUnsatCore()`), the queries whose conjuncts contain all the conjuncts of the core being UNSAT.
+          TRITON_EXPORT void insertUnsatCore(const std::vector<triton::ast::SharedAbstractNode>& core);
+
+          //! Returns true if the cache is enabled.
+          TRITON_EXPORT bool isEnabled(void) const;
+
+          //! Returns the maximum number of entries.
+          TRITON_EXPORT triton::usize getCapacity(void) const;
+
+          //! Defines the maximum number of entries, 0 disables the cache.
+          TRITON_EXPORT void setCapacity(triton::usize capacity);
+
+          //! Defines the backing file. Its entries are loaded and the new ones are appended to it. An empty path detaches the file.
+          TRITON_EXPORT void setBackingFile(const std::string& path);
+
+          //! Returns the number of queries answered by the cache.
+          TRITON_EXPORT triton::usize getHits(void) const;
+
+          //! Returns the number of queries not answered by the cache.
+          TRITON_EXPORT triton::usize getMisses(void) const;
+
+          //! Returns the number of queries answered by a recent model, the concrete values or a recent UNSAT query.
+          TRITON_EXPORT triton::usize getCounterexampleHits(void) const;
+
+          //! Returns the number of entries.
+          TRITON_EXPORT triton::usize size(void) const;
+
+          //! Returns an estimation of the number of bytes of the entries and of their models.
+          TRITON_EXPORT triton::usize getBytes(void) const;
+
+          //! Removes all entries, models and UNSAT queries and resets the statistics. The backing file is kept.
+          TRITON_EXPORT void clear(void);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SOLVERCACHE_HPP */
@@ -11,14 +11,29 @@
 #include <iostream>
 #include <memory>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <triton/ast.hpp>
+#include <triton/branchFlip.hpp>
 #include <triton/config.hpp>
+#include <triton/analyticSolver.hpp>
 #include <triton/dllexport.hpp>
+#include <triton/equivalence.hpp>
+#include <triton/externalSolver.hpp>
+#include <triton/localSearchSolver.hpp>
+#include <triton/pathConstraint.hpp>
+#include <triton/remoteSolver.hpp>
+#include <triton/solverBudget.hpp>
+#include <triton/solverCache.hpp>
 #include <triton/solverEnums.hpp>
+#include <triton/solverFuture.hpp>
 #include <triton/solverInterface.hpp>
 #include <triton/solverModel.hpp>
+#include <triton/solverPool.hpp>
+#include <triton/solverPreprocessor.hpp>
+#include <triton/solverProfiles.hpp>
+#include <triton/solverStatistics.hpp>
 #include <triton/tritonTypes.hpp>
 #ifdef TRITON_Z3_INTERFACE
   #include <triton/z3Solver.hpp>
@@ -26,6 +41,9 @@
 #ifdef TRITON_BITWUZLA_INTERFACE
   #include <triton/bitwuzlaSolver.hpp>
 #endif
+#if defined(TRITON_Z3_INTERFACE) || defined(TRITON_BITWUZLA_INTERFACE)
+  #include <triton/portfolioSolver.hpp>
+#endif
 
 
 
@@ -60,6 +78,60 @@ namespace triton {
           //! Instance to the real solver class.
           std::unique_ptr<triton::engines::solver::SolverInterface> solver;
 
+          //! The answers of the solver, by query.
+          mutable triton::engines::solver::SolverCache cache;
+
+          //! Simplifies the queries before they are sent to the solver, if enabled.
+          triton::engines::solver::SolverPreprocessor preprocessor;
+
+          //! Solves the simple constraints of the queries without the solver, if enabled.
+          triton::engines::solver::AnalyticSolver analytic;
+
+          //! The profiles solving the queries.
+          triton::engines::solver::SolverProfiles profiles;
+
+          //! The adaptive timeouts of the branch flips, if enabled.
+          triton::engines::solver::SolverBudget budget;
+
+          //! The statistics of the queries, if enabled.
+          triton::engines::solver::SolverStatistics statistics;
+
+          //! The timeout given to the solver (in milliseconds).
+          triton::uint32 timeout;
+
+          //! The memory limit given to the solver (in megabytes).
+          triton::uint32 memoryLimit;
+
+          //! The tasks submitted to the pool. Their queries are released by the thread owning their context.
+          std::vector<std::shared_ptr<triton::engines::solver::SolverTask>> tasks;
+
+          //! The number of threads solving the queries in the background.
+          triton::usize threads;
+
+          //! The threads solving the queries in the background, started by the first one. Destroyed first, they may still use the cache.
+          std::unique_ptr<triton::engines::solver::SolverPool> pool;
+
+          //! Returns a new solver of the given kind.
+          std::unique_ptr<triton::engines::solver::SolverInterface> newSolver(triton::engines::solver::solver_e kind, const char* where) const;
+
+          //! Returns true and the answer to `node` if the cache holds it or if a counterexample satisfies it.
+          bool lookup(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e& status, std::unordered_map<triton::usize, SolverModel>* model) const;
+
+          //! Returns the timeout of a query given its `timeout`, 0 for the solver's one.
+          triton::uint32 getQueryTimeout(triton::uint32 timeout) const;
+
+          //! Preprocesses `node` if enabled and solves it. The model is returned in `model` if it is not null.
+          triton::engines::solver::status_e query(const triton::ast::SharedAbstractNode& node, std::unordered_map<triton::usize, SolverModel>* model, triton::uint32 timeout, triton::uint32* solvingTime) const;
+
+          //! Submits a query to the pool.
+          SolverFuture submit(const triton::ast::SharedAbstractNode& node, bool needModel, triton::uint32 timeout, const char* where);
+
+          //! Evaluates `node` on the corner values and random inputs of `options`. Returns false if it cannot be evaluated.
+          bool sample(const triton::ast::SharedAbstractNode& node, const EquivalenceOptions& options, std::vector<triton::engines::symbolic::SharedSymbolicVariable>& variables, std::vector<std::vector<triton::uint512>>& inputs, std::vector<triton::uint512>& outputs) const;
+
+          //! Solves the queries of the checks not refuted by the evaluation, `queries` giving their index in `results`.
+          void solveEquivalences(const std::vector<std::pair<triton::usize, triton::ast::SharedAbstractNode>>& queries, const EquivalenceOptions& options, std::vector<Equivalence>& results);
+
         public:
           //! Constructor.
           TRITON_EXPORT SolverEngine();
@@ -79,6 +151,38 @@ namespace triton {
           //! Returns true if the solver is valid.
           TRITON_EXPORT bool isValid(void) const;
 
+          //! Returns the analytic solver of the simple constraints of the queries.
+          TRITON_EXPORT triton::engines::solver::AnalyticSolver* getAnalytic(void);
+
+          //! Returns the adaptive timeouts of the branch flips (see `solveBranchFlips()`).
+          TRITON_EXPORT triton::engines::solver::SolverBudget* getBudget(void);
+
+          //! Returns the cache of the answers of the solver.
+          TRITON_EXPORT triton::engines::solver::SolverCache* getCache(void);
+
+          //! Returns the external solver. The solver must be a SOLVER_EXTERNAL.
+          TRITON_EXPORT triton::engines::solver::ExternalSolver* getExternal(void);
+
+          //! Returns the preprocessor of the queries.
+          TRITON_EXPORT triton::engines::solver::SolverPreprocessor* getPreprocessor(void);
+
+          //! Returns the profiles solving the queries.
+          TRITON_EXPORT triton::engines::solver::SolverProfiles* getProfiles(void);
+
+          //! Returns the remote solver. The solver must be a SOLVER_REMOTE.
+          TRITON_EXPORT triton::engines::solver::RemoteSolver* getRemote(void);
+
+          //! Returns the statistics of the queries.
+          TRITON_EXPORT triton::engines::solver::SolverStatistics* getStatistics(void);
+
+          //! Returns the local search solver. The solver must be a SOLVER_LOCAL_SEARCH.
+          TRITON_EXPORT triton::engines::solver::LocalSearchSolver* getLocalSearch(void);
+
+          #if defined(TRITON_Z3_INTERFACE) || defined(TRITON_BITWUZLA_INTERFACE)
+          //! Returns the portfolio solver. The solver must be a SOLVER_PORTFOLIO.
+          TRITON_EXPORT triton::engines::solver::PortfolioSolver* getPortfolio(void);
+          #endif
+
           //! Computes and returns a model from a symbolic constraint. State is returned in the `status` pointer as well as the solving time. A `timeout` can also be defined.
           /*! \brief map of symbolic variable id -> model
            *
@@ -97,9 +201,55 @@ namespace triton {
            */
           TRITON_EXPORT std::vector<std::unordered_map<triton::usize, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
 
+          //! Computes at most `limit` models from a symbolic constraint and gives them to `callback` as they are found, projected onto `variables` if it is not empty. Returns the number of models given. State is returned in the `status` pointer as well as the solving time. A `timeout` can also be defined.
+          TRITON_EXPORT triton::usize enumerateModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, const ModelCallback& callback, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& variables = {}, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
           //! Returns true if an expression is satisfiable.
           TRITON_EXPORT bool isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
 
+          //! Returns an UNSAT core of `conjuncts`, a subset of them whose conjunction is UNSAT, or an empty vector if their conjunction is not UNSAT. The core is recorded into the cache, a query containing it being UNSAT. State is returned in the `status` pointer as well as the solving time. A `timeout` can also be defined.
+          TRITON_EXPORT std::vector<triton::ast::SharedAbstractNode> getUnsatCore(const std::vector<triton::ast::SharedAbstractNode>& conjuncts, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
+          //! Computes a model from a symbolic constraint in the background and returns its future. A `timeout` can also be defined. The constraint is copied, it may be updated while it is solved.
+          TRITON_EXPORT SolverFuture getModelAsync(const triton::ast::SharedAbstractNode& node, triton::uint32 timeout = 0);
+
+          //! Checks the satisfiability of a symbolic constraint in the background and returns its future. A `timeout` can also be defined. The constraint is copied, it may be updated while it is solved.
+          TRITON_EXPORT SolverFuture isSatAsync(const triton::ast::SharedAbstractNode& node, triton::uint32 timeout = 0);
+
+          /*!
+           * \brief Solves the branches not taken by `pathConstraints`, each one with the predicates taken before it, and returns them with their models.
+           *
+           * \details
+           * The predicates taken are asserted once into a solver session whose queries assume the branch flipped, or the queries
+           * are solved on the threads of the solver if `options.parallel` is true. The answers go through the cache.
+           *
+           * If the adaptive timeouts are enabled (see `getBudget()`), they replace `options.timeout`: the flips which time out
+           * are retried at a higher timeout once the other ones are done, and the flips left once the budget is spent are UNKNOWN.
+           *
+           * If `options.unsatCores` is true, the UNSAT core of each UNSAT flip is computed (see `getUnsatCore()`), and the
+           * next flips whose predicates contain a core, or one of `options.cores`, are UNSAT without querying the solver.
+           */
+          TRITON_EXPORT std::vector<BranchFlip> solveBranchFlips(const std::vector<triton::engines::symbolic::PathConstraint>& pathConstraints, const BranchFlipOptions& options = BranchFlipOptions());
+
+          /*!
+           * \brief Checks whether each pair of nodes is equivalent, i.e. no input tells them apart.
+           *
+           * \details
+           * Both sides are evaluated on the corner values and the random inputs of `options` first, most of the pairs which are not
+           * equivalent being refuted this way at once. The other ones are sent to the solver, whose cache tries the concrete values
+           * and its recent models before solving, or on the threads of the solver if `options.parallel` is true.
+           */
+          TRITON_EXPORT std::vector<Equivalence> checkEquivalences(const std::vector<std::pair<triton::ast::SharedAbstractNode, triton::ast::SharedAbstractNode>>& pairs, const EquivalenceOptions& options = EquivalenceOptions());
+
+          //! Checks whether the logical `node` is an opaque predicate, i.e. always true or always false, like `checkEquivalences()`. UNSAT if it is.
+          TRITON_EXPORT Equivalence checkOpaquePredicate(const triton::ast::SharedAbstractNode& node, const EquivalenceOptions& options = EquivalenceOptions());
+
+          //! Returns the maximum number of queries solved at once in the background.
+          TRITON_EXPORT triton::usize getThreads(void) const;
+
+          //! Defines the maximum number of queries solved at once in the background, at least one. By default, the number of hardware threads.
+          TRITON_EXPORT void setThreads(triton::usize threads);
+
           //! Returns the name of the solver.
           TRITON_EXPORT std::string getName(void) const;
 
@@ -108,6 +258,27 @@ namespace triton {
 
           //! Defines a solver memory consumption limit (in megabytes).
           TRITON_EXPORT void setMemoryLimit(triton::uint32 mem);
+
+          //! Asserts a constraint into the solver session. The constraint holds until the scope it was asserted in is popped.
+          TRITON_EXPORT void pushConstraint(const triton::ast::SharedAbstractNode& node);
+
+          //! Opens a new scope in the solver session.
+          TRITON_EXPORT void push(void);
+
+          //! Closes the `count` innermost scopes of the solver session and drops their constraints.
+          TRITON_EXPORT void pop(triton::uint32 count = 1);
+
+          //! Computes a model of the constraints of the solver session and of the `assumptions`, which are not kept once the check is done. State is returned in the `status` pointer as well as the solving time. A `timeout` can also be defined.
+          /*! \brief map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT std::unordered_map<triton::usize, SolverModel> checkWithAssumptions(const std::vector<triton::ast::SharedAbstractNode>& assumptions, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr);
+
+          //! Drops all the scopes and constraints of the solver session.
+          TRITON_EXPORT void resetSession(void);
       };
 
     /*! @} End of solver namespace */
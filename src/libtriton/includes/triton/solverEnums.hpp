@@ -45,6 +45,12 @@ namespace triton {
         #ifdef TRITON_BITWUZLA_INTERFACE
         SOLVER_BITWUZLA,    /*!< bitwuzla solver. */
         #endif
+        #if defined(TRITON_Z3_INTERFACE) || defined(TRITON_BITWUZLA_INTERFACE)
+        SOLVER_PORTFOLIO,   /*!< all the solvers above, raced. */
+        #endif
+        SOLVER_LOCAL_SEARCH, /*!< stochastic local search, handing off to an SMT solver. */
+        SOLVER_EXTERNAL,     /*!< SMT-LIB2 solver run in subprocesses. */
+        SOLVER_REMOTE,       /*!< solver servers reached over TCP. */
       };
 
       /*! The different kind of status */
@@ -0,0 +1,169 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_SOLVERFUTURE_HPP
+#define TRITON_SOLVERFUTURE_HPP
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/solverCache.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/solverInterface.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/solverProfiles.hpp>
+#include <triton/solverStatistics.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      /*! \struct SolverTask
+       *  \brief A query solved in the background, shared by its future and the thread solving it. */
+      struct SolverTask {
+        //! Protects the task.
+        std::mutex lock;
+
+        //! Signaled once the task is done.
+        std::condition_variable finished;
+
+        //! The query. It is a frozen copy of the constraint (see `AbstractNode::freeze()`), the caller may keep updating its DAG.
+        triton::ast::SharedAbstractNode node;
+
+        //! The solver of the query, owned by the task so that it may be interrupted alone.
+        std::unique_ptr<triton::engines::solver::SolverInterface> solver;
+
+        //! The cache recording the answer, null if there is none.
+        triton::engines::solver::SolverCache* cache = nullptr;
+
+        //! The statistics recording the query, null if they are disabled.
+        triton::engines::solver::SolverStatistics* statistics = nullptr;
+
+        //! The profile solving the query, null for the default solver.
+        std::shared_ptr<const triton::engines::solver::SolverProfile> profile;
+
+        //! True if a model is computed, false for an isSat() query.
+        bool needModel = false;
+
+        //! The timeout of the query (in milliseconds), 0 for the solver's one.
+        triton::uint32 timeout = 0;
+
+        //! True once the task is done, answered, failed or cancelled.
+        bool done = false;
+
+        //! True if the task is cancelled.
+        bool cancelled = false;
+
+        //! The status of the query.
+        triton::engines::solver::status_e status = triton::engines::solver::UNKNOWN;
+
+        //! The model of the query.
+        std::unordered_map<triton::usize, SolverModel> model;
+
+        //! The solving time (in milliseconds).
+        triton::uint32 solvingTime = 0;
+
+        //! The message of the exception thrown by the solver, empty if none was thrown.
+        std::string error;
+      };
+
+
+      /*! \class SolverFuture
+       *  \brief The handle of a query solved in the background.
+       *
+       * \description
+       * The accessors of the answer (e.g. `getModel()`) wait for the query to be done. A cancelled query is
+       * interrupted if it is running and its status is UNKNOWN. Copies of a future share the same query.
+       */
+      class SolverFuture {
+        private:
+          //! The query.
+          std::shared_ptr<SolverTask> task;
+
+          //! Returns the task, once done. Throws if the solver failed.
+          const SolverTask& result(void) const;
+
+        public:
+          //! Constructor of an invalid future.
+          TRITON_EXPORT SolverFuture();
+
+          //! Constructor of the future of a task.
+          TRITON_EXPORT SolverFuture(const std::shared_ptr<SolverTask>& task);
+
+          //! Constructor of the future of a query already answered.
+          TRITON_EXPORT SolverFuture(triton::engines::solver::status_e status, const std::unordered_map<triton::usize, SolverModel>& model);
+
+          //! Returns true if the future refers to a query.
+          TRITON_EXPORT bool isValid(void) const;
+
+          //! Returns true if the query is done.
+          TRITON_EXPORT bool isDone(void) const;
+
+          //! Waits for the query to be done.
+          TRITON_EXPORT void wait(void) const;
+
+          //! Waits at most `ms` milliseconds for the query to be done and returns true if it is.
+          TRITON_EXPORT bool waitFor(triton::uint32 ms) const;
+
+          //! Cancels the query. It is interrupted if it is running.
+          TRITON_EXPORT void cancel(void);
+
+          //! Returns true if the query is cancelled.
+          TRITON_EXPORT bool isCancelled(void) const;
+
+          //! Returns the status of the query, once done.
+          TRITON_EXPORT triton::engines::solver::status_e getStatus(void) const;
+
+          //! Returns true if the query is satisfiable, once done.
+          TRITON_EXPORT bool isSat(void) const;
+
+          //! Returns the model of the query, once done. It is empty for an isSat() query.
+          /*! \brief map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT const std::unordered_map<triton::usize, SolverModel>& getModel(void) const;
+
+          //! Returns the solving time (in milliseconds), once done.
+          TRITON_EXPORT triton::uint32 getSolvingTime(void) const;
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SOLVERFUTURE_HPP */
@@ -8,13 +8,20 @@
 #ifndef TRITON_SOLVERINTERFACE_HPP
 #define TRITON_SOLVERINTERFACE_HPP
 
+#include <functional>
+#include <set>
 #include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include <triton/ast.hpp>
+#include <triton/astContext.hpp>
 #include <triton/dllexport.hpp>
+#include <triton/exceptions.hpp>
 #include <triton/solverEnums.hpp>
 #include <triton/solverModel.hpp>
+#include <triton/symbolicVariable.hpp>
 #include <triton/tritonTypes.hpp>
 
 
@@ -40,6 +47,9 @@ namespace triton {
      *  @{
      */
 
+      //! The callback receiving the models of `enumerateModels()` as they are found. It returns false to stop the enumeration.
+      using ModelCallback = std::function<bool(const std::unordered_map<triton::usize, SolverModel>&)>;
+
       /*! \interface SolverInterface
           \brief This interface is used to interface with solvers */
       class SolverInterface {
@@ -65,9 +75,75 @@ namespace triton {
            */
           TRITON_EXPORT virtual std::vector<std::unordered_map<triton::usize, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const = 0;
 
+          /*!
+           * \brief Computes at most `limit` models from a symbolic constraint and gives them to `callback` as they are found. Returns the number of models given.
+           *
+           * \details
+           * If `variables` is not empty, the models are projected onto them: they only hold these variables and two models differ by
+           * one of them at least, the other variables are not enumerated. State is returned in the `status` pointer as well as the
+           * solving time. A `timeout` can also be defined. The solvers which do not enumerate models incrementally filter the models
+           * of `getModels()`.
+           */
+          TRITON_EXPORT virtual triton::usize enumerateModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, const ModelCallback& callback, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& variables = {}, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const {
+            std::unordered_set<triton::usize> projection;
+            std::set<std::vector<std::pair<triton::usize, triton::uint512>>> seen;
+            triton::usize count = 0;
+
+            for (const auto& var : variables)
+              projection.insert(var->getId());
+
+            for (const auto& model : this->getModels(node, limit, status, timeout, solvingTime)) {
+              std::unordered_map<triton::usize, SolverModel> projected;
+              std::vector<std::pair<triton::usize, triton::uint512>> values;
+
+              for (const auto& var : variables) {
+                auto it = model.find(var->getId());
+                if (it != model.end()) {
+                  projected[it->first] = it->second;
+                  values.push_back({it->first, it->second.getValue()});
+                }
+              }
+
+              /* Models differing by unprojected variables only are given once */
+              if (!projection.empty() && !seen.insert(values).second)
+                continue;
+
+              count++;
+              if (!callback(projection.empty() ? model : projected))
+                break;
+            }
+
+            return count;
+          }
+
           //! Returns true if an expression is satisfiable.
           TRITON_EXPORT virtual bool isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const = 0;
 
+          /*!
+           * \brief Returns an UNSAT core of `conjuncts`, the ones whose conjunction is UNSAT on their own, or an empty vector if their conjunction is not UNSAT.
+           *
+           * \details
+           * State is returned in the `status` pointer as well as the solving time. A `timeout` can also be defined. The core
+           * is not minimal. Solvers which do not compute cores only check the conjunction and return all the conjuncts.
+           */
+          TRITON_EXPORT virtual std::vector<triton::ast::SharedAbstractNode> getUnsatCore(const std::vector<triton::ast::SharedAbstractNode>& conjuncts, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const {
+            triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+
+            if (conjuncts.empty())
+              throw triton::exceptions::SolverEngine("SolverInterface::getUnsatCore(): Expects at least one conjunct.");
+
+            auto node = (conjuncts.size() == 1) ? conjuncts.front() : conjuncts.front()->getContext()->land(conjuncts);
+            this->isSat(node, &st, timeout, solvingTime);
+
+            if (status)
+              *status = st;
+
+            if (st != triton::engines::solver::UNSAT)
+              return {};
+
+            return conjuncts;
+          }
+
           //! Returns the name of the solver.
           TRITON_EXPORT virtual std::string getName(void) const = 0;
 
@@ -76,6 +152,40 @@ namespace triton {
 
           //! Defines a solver memory consumption limit (in megabytes).
           TRITON_EXPORT virtual void setMemoryLimit(triton::uint32 mem) = 0;
+
+          //! Asserts a constraint into the solver session. The constraint holds until the scope it was asserted in is popped.
+          TRITON_EXPORT virtual void pushConstraint(const triton::ast::SharedAbstractNode& /*node*/) {
+            throw triton::exceptions::SolverEngine("SolverInterface::pushConstraint(): Solver sessions are not supported by " + this->getName() + ".");
+          }
+
+          //! Opens a new scope in the solver session.
+          TRITON_EXPORT virtual void push(void) {
+            throw triton::exceptions::SolverEngine("SolverInterface::push(): Solver sessions are not supported by " + this->getName() + ".");
+          }
+
+          //! Closes the `count` innermost scopes of the solver session and drops their constraints.
+          TRITON_EXPORT virtual void pop(triton::uint32 /*count*/ = 1) {
+            throw triton::exceptions::SolverEngine("SolverInterface::pop(): Solver sessions are not supported by " + this->getName() + ".");
+          }
+
+          //! Computes a model of the constraints of the solver session and of the `assumptions`, which are not kept once the check is done. State is returned in the `status` pointer as well as the solving time. A `timeout` can also be defined.
+          /*! \brief map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT virtual std::unordered_map<triton::usize, SolverModel> checkWithAssumptions(const std::vector<triton::ast::SharedAbstractNode>& /*assumptions*/, triton::engines::solver::status_e* /*status*/ = nullptr, triton::uint32 /*timeout*/ = 0, triton::uint32* /*solvingTime*/ = nullptr) {
+            throw triton::exceptions::SolverEngine("SolverInterface::checkWithAssumptions(): Solver sessions are not supported by " + this->getName() + ".");
+          }
+
+          //! Drops all the scopes and constraints of the solver session.
+          TRITON_EXPORT virtual void resetSession(void) {
+          }
+
+          //! Interrupts the running queries, from any thread. They and the next ones return UNKNOWN. Solvers which cannot be interrupted do nothing.
+          TRITON_EXPORT virtual void interrupt(void) {
+          }
       };
 
     /*! @} End of solver namespace */
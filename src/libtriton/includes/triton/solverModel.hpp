@@ -9,7 +9,10 @@
 #define TRITON_SOLVERMODEL_H
 
 #include <string>
+#include <unordered_map>
+#include <vector>
 
+#include <triton/ast.hpp>
 #include <triton/dllexport.hpp>
 #include <triton/symbolicVariable.hpp>
 #include <triton/tritonTypes.hpp>
@@ -38,14 +41,14 @@ namespace triton {
      */
 
       //! \class SolverModel
-      /*! \brief This class is used to represent a constraint model solved. */
+      /*! \brief This class is used to represent a constraint model solved. Values fitting in 64 bits are kept natively. */
       class SolverModel {
         protected:
           //! The symbolic variable.
           triton::engines::symbolic::SharedSymbolicVariable variable;
 
           //! The value of the model.
-          triton::uint512 value;
+          triton::ast::NodeValue value;
 
         private:
           //! Copies a SolverModel
@@ -58,6 +61,9 @@ namespace triton {
           //! Constructor.
           TRITON_EXPORT SolverModel(const triton::engines::symbolic::SharedSymbolicVariable& variable, triton::uint512 value);
 
+          //! Constructor. A value which fits in 64 bits.
+          TRITON_EXPORT SolverModel(const triton::engines::symbolic::SharedSymbolicVariable& variable, triton::uint64 value);
+
           //! Constructor by copy.
           TRITON_EXPORT SolverModel(const SolverModel& other);
 
@@ -70,6 +76,9 @@ namespace triton {
           //! Returns the value of the model.
           TRITON_EXPORT triton::uint512 getValue(void) const;
 
+          //! Returns the lower 64 bits of the value of the model, without building a 512-bit integer.
+          TRITON_EXPORT triton::uint64 getNarrowValue(void) const;
+
           //! Returns the size (in bits) of the symbolic variable.
           TRITON_EXPORT triton::uint32 getSize(void) const;
 
@@ -77,6 +86,57 @@ namespace triton {
           TRITON_EXPORT const triton::engines::symbolic::SharedSymbolicVariable& getVariable(void) const;
       };
 
+      //! \class DenseModel
+      /*! \brief A model as a vector indexed by variable id.
+       *
+       * \description
+       * The ids of the symbolic variables are allocated in sequence, so that a model over many
+       * input bytes is a vector and a lookup is an index instead of a hash. A slot without a
+       * variable is not part of the model.
+       */
+      class DenseModel {
+        private:
+          //! The models, indexed by variable id.
+          std::vector<SolverModel> models;
+
+          //! The number of variables of the model.
+          triton::usize count;
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT DenseModel();
+
+          //! Constructor. Converts the model of `getModel()`.
+          TRITON_EXPORT DenseModel(const std::unordered_map<triton::usize, SolverModel>& model);
+
+          //! Sets the model of a variable.
+          TRITON_EXPORT void set(const SolverModel& model);
+
+          //! Returns true if the variable `id` is part of the model.
+          TRITON_EXPORT bool contains(triton::usize id) const;
+
+          //! Returns the model of the variable `id`, or nullptr.
+          TRITON_EXPORT const SolverModel* find(triton::usize id) const;
+
+          //! Returns the value of the variable `id`, which must be part of the model.
+          TRITON_EXPORT triton::uint512 getValue(triton::usize id) const;
+
+          //! Returns the number of variables of the model.
+          TRITON_EXPORT triton::usize size(void) const;
+
+          //! Returns true if the model is empty.
+          TRITON_EXPORT bool empty(void) const;
+
+          //! Calls `visitor(model)` on the model of each variable, by increasing id.
+          template <typename F>
+          void forEach(F visitor) const {
+            for (const auto& model : this->models) {
+              if (model.getVariable() != nullptr)
+                visitor(model);
+            }
+          }
+      };
+
     //! Display a solver model.
     TRITON_EXPORT std::ostream& operator<<(std::ostream& stream, const SolverModel& model);
 
@@ -0,0 +1,103 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_SOLVERPOOL_HPP
+#define TRITON_SOLVERPOOL_HPP
+
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include <triton/dllexport.hpp>
+#include <triton/executor.hpp>
+#include <triton/solverFuture.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      /*! \class SolverPool
+       *  \brief The queries solved in the background.
+       *
+       * \description
+       * The queries run on the executor of the process (see `triton::utils::Executor::getDefault()`), at most
+       * `threads` of them at once so that the queries of a context do not take all the workers. Tasks are
+       * started in the order they are submitted. Destroying the pool cancels the tasks which are not done and
+       * waits for the running ones.
+       */
+      class SolverPool {
+        private:
+          //! The executor running the tasks.
+          triton::utils::Executor& executor;
+
+          //! The tasks not started yet.
+          std::deque<std::shared_ptr<SolverTask>> pending;
+
+          //! The tasks submitted to the executor, and their tasks on it.
+          std::unordered_map<SolverTask*, triton::utils::SharedExecutorTask> running;
+
+          //! Protects the queue.
+          mutable std::mutex lock;
+
+          //! True once the pool is stopped.
+          bool stopping;
+
+          //! The maximum number of tasks running at once.
+          triton::usize target;
+
+          //! Submits the pending tasks to the executor, up to the target. The lock must be held.
+          void dispatch(void);
+
+          //! Solves a task.
+          static void solve(SolverTask& task);
+
+        public:
+          //! Constructor. At least one task runs at once.
+          TRITON_EXPORT SolverPool(triton::usize threads);
+
+          //! Destructor. The tasks which are not done are cancelled.
+          TRITON_EXPORT ~SolverPool();
+
+          //! Submits a task.
+          TRITON_EXPORT void submit(const std::shared_ptr<SolverTask>& task);
+
+          //! Returns the maximum number of tasks running at once.
+          TRITON_EXPORT triton::usize getThreads(void) const;
+
+          //! Defines the maximum number of tasks running at once, at least one. Extra running tasks are not stopped.
+          TRITON_EXPORT void setThreads(triton::usize threads);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SOLVERPOOL_HPP */
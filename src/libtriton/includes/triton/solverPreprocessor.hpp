@@ -0,0 +1,146 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_SOLVERPREPROCESSOR_HPP
+#define TRITON_SOLVERPREPROCESSOR_HPP
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/astEvaluator.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/symbolicVariable.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      /*! \struct PreprocessedQuery
+       *  \brief A query simplified by the `SolverPreprocessor`, and how the models of the original query are rebuilt from its models. */
+      struct PreprocessedQuery {
+        //! The simplified query, null if it is decided without solver.
+        triton::ast::SharedAbstractNode node;
+
+        //! SAT or UNSAT if the query is decided without solver, UNKNOWN otherwise.
+        triton::engines::solver::status_e decided = triton::engines::solver::UNKNOWN;
+
+        //! The variables fixed by an equality to a constant, and their value.
+        std::vector<SolverModel> fixed;
+
+        //! The variables eliminated with their defining equality, in order, and the term computing their value.
+        std::vector<std::pair<triton::engines::symbolic::SharedSymbolicVariable, std::shared_ptr<triton::ast::AstEvaluator>>> eliminated;
+      };
+
+
+      //! \class SolverPreprocessor
+      /*! \brief Simplifies the conjunction of a query before it is sent to the solver.
+       *
+       * \description
+       * The conjuncts of the query are rewritten until a fixpoint: the variables fixed by `x == const` are substituted
+       * by their value, the conjuncts which became constant are dropped (or decide the query UNSAT), a variable defined
+       * by `x == t` and used nowhere else is eliminated with its equality, and the comparisons and extractions of the
+       * zero extensions (`zx`, or a `concat` of zeros, as the lifted instructions build them) are narrowed to their
+       * operand. The nodes of the query are not modified, the rewritten ones are new nodes.
+       *
+       * The models of the simplified query are completed (see `reconstruct()`) with the values of the fixed variables
+       * and of the eliminated ones, computed from the models by the AST evaluator.
+       */
+      class SolverPreprocessor {
+        private:
+          //! True if the queries are preprocessed.
+          bool enabled;
+
+          //! Protects the statistics, queries may be preprocessed from several threads.
+          mutable std::mutex lock;
+
+          //! The number of queries preprocessed.
+          mutable triton::usize queries;
+
+          //! The number of queries decided without solver.
+          mutable triton::usize decided;
+
+          //! The number of variables fixed by an equality to a constant.
+          mutable triton::usize fixedVariables;
+
+          //! The number of variables eliminated with their defining equality.
+          mutable triton::usize eliminatedVariables;
+
+          //! The number of conjuncts dropped.
+          mutable triton::usize droppedConjuncts;
+
+          //! The number of comparisons and extractions narrowed to the operand of a zero extension.
+          mutable triton::usize narrowedNodes;
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT SolverPreprocessor();
+
+          //! Returns true if the queries are preprocessed.
+          TRITON_EXPORT bool isEnabled(void) const;
+
+          //! Enables or disables the preprocessing of the queries. By default, disabled.
+          TRITON_EXPORT void setEnabled(bool flag);
+
+          //! Simplifies a logical `node`. The query is returned as is if it holds a node which cannot be rewritten.
+          TRITON_EXPORT PreprocessedQuery preprocess(const triton::ast::SharedAbstractNode& node) const;
+
+          //! Completes a `model` of the simplified query into a model of the original one.
+          TRITON_EXPORT void reconstruct(const PreprocessedQuery& query, std::unordered_map<triton::usize, SolverModel>& model) const;
+
+          //! Returns the number of queries preprocessed.
+          TRITON_EXPORT triton::usize getQueries(void) const;
+
+          //! Returns the number of queries decided without solver.
+          TRITON_EXPORT triton::usize getDecided(void) const;
+
+          //! Returns the number of variables fixed by an equality to a constant.
+          TRITON_EXPORT triton::usize getFixedVariables(void) const;
+
+          //! Returns the number of variables eliminated with their defining equality.
+          TRITON_EXPORT triton::usize getEliminatedVariables(void) const;
+
+          //! Returns the number of conjuncts dropped.
+          TRITON_EXPORT triton::usize getDroppedConjuncts(void) const;
+
+          //! Returns the number of comparisons and extractions narrowed to the operand of a zero extension.
+          TRITON_EXPORT triton::usize getNarrowedNodes(void) const;
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SOLVERPREPROCESSOR_HPP */
@@ -0,0 +1,194 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_SOLVERPROFILES_HPP
+#define TRITON_SOLVERPROFILES_HPP
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      /*! The classes of queries, each one solved with its own profile (see `SolverProfiles`). */
+      enum query_class_e {
+        QUERY_BITVECTOR = 0, /*!< Mostly bitwise and additive, bit-blasted cheaply */
+        QUERY_ARITHMETIC,    /*!< Heavy in multiplications, divisions and remainders */
+      };
+
+      /*! \struct SolverProfile
+       *  \brief How a query is solved: the tactics of z3 and the engine of Bitwuzla. */
+      struct SolverProfile {
+        //! The name of the profile.
+        std::string name;
+
+        //! The z3 tactics applied in sequence, the last one deciding the query (e.g. `simplify`, `solve-eqs`, `bit-blast`, `sat`). Empty for the default solver of z3.
+        std::vector<std::string> tactics;
+
+        //! The engine of Bitwuzla (e.g. `fun` or `prop`, its propagation-based local search). Empty for its default engine.
+        std::string engine;
+      };
+
+      /*! \struct QueryFeatures
+       *  \brief The features of a query classifying it (see `SolverProfiles::classify()`). */
+      struct QueryFeatures {
+        //! The number of nodes, the references excluded.
+        triton::usize nodes = 0;
+
+        //! The number of multiplications, divisions and remainders.
+        triton::usize arithmetic = 0;
+
+        //! The number of distinct variables.
+        triton::usize variables = 0;
+
+        //! The width of the widest bitvector.
+        triton::uint32 width = 0;
+      };
+
+
+      //! \class SolverProfiles
+      /*! \brief Selects the profile solving each query.
+       *
+       * \description
+       * A profile is forced for all the queries (see `setForced()`), or, if the automatic selection is enabled, picked by
+       * the class of the query: a query whose multiplications, divisions and remainders are at least one of its sixteen
+       * nodes is `QUERY_ARITHMETIC`, the others are `QUERY_BITVECTOR`. Otherwise the queries keep the default solver.
+       *
+       * The `default` profile is the default solver of z3 and Bitwuzla, `qfbv` the z3 pipeline `simplify`, `solve-eqs`,
+       * `bit-blast` and `sat` (the class `QUERY_BITVECTOR`), and `arithmetic` the propagation-based local search of
+       * Bitwuzla (the class `QUERY_ARITHMETIC`). The profile selected applies to the queries of `getModel()`, `isSat()`,
+       * `getModels()` and `enumerateModels()` and to their background tasks, the solver session keeping its own solver.
+       */
+      class SolverProfiles {
+        private:
+          //! True if the profiles are selected by the class of the queries.
+          bool enabled;
+
+          //! Protects the profiles and the selections, queries may be solved from several threads.
+          mutable std::mutex lock;
+
+          //! The profiles, by name.
+          std::map<std::string, std::shared_ptr<const SolverProfile>> profiles;
+
+          //! The profile of each class of queries.
+          std::vector<std::string> classes;
+
+          //! The profile of all the queries, empty if they are selected by class.
+          std::string forced;
+
+          //! The number of queries solved with each profile.
+          mutable std::map<std::string, triton::usize> selections;
+
+          //! Returns the profile `name`. The lock must be held.
+          std::shared_ptr<const SolverProfile> find(const std::string& name, const char* where) const;
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT SolverProfiles();
+
+          //! Returns true if the profiles are selected by the class of the queries.
+          TRITON_EXPORT bool isEnabled(void) const;
+
+          //! Enables or disables the selection of the profiles by the class of the queries. By default, disabled.
+          TRITON_EXPORT void setEnabled(bool flag);
+
+          //! Adds a profile, or replaces the one of the same name.
+          TRITON_EXPORT void setProfile(const SolverProfile& profile);
+
+          //! Returns the profile `name`.
+          TRITON_EXPORT SolverProfile getProfile(const std::string& name) const;
+
+          //! Returns the names of the profiles.
+          TRITON_EXPORT std::vector<std::string> getNames(void) const;
+
+          //! Defines the profile of a class of queries.
+          TRITON_EXPORT void setClassProfile(triton::engines::solver::query_class_e cls, const std::string& name);
+
+          //! Returns the profile of a class of queries.
+          TRITON_EXPORT std::string getClassProfile(triton::engines::solver::query_class_e cls) const;
+
+          //! Forces the profile `name` for all the queries, an empty name going back to the selection by class.
+          TRITON_EXPORT void setForced(const std::string& name);
+
+          //! Returns the profile forced for all the queries, empty if there is none.
+          TRITON_EXPORT std::string getForced(void) const;
+
+          //! Returns the profile of the query `node`, null if it keeps the default solver.
+          TRITON_EXPORT std::shared_ptr<const SolverProfile> select(const triton::ast::SharedAbstractNode& node) const;
+
+          //! Returns the number of queries solved with each profile.
+          TRITON_EXPORT std::map<std::string, triton::usize> getSelections(void) const;
+
+          //! Returns the features of the query `node`.
+          TRITON_EXPORT static QueryFeatures getFeatures(const triton::ast::SharedAbstractNode& node);
+
+          //! Returns the class of a query from its features.
+          TRITON_EXPORT static triton::engines::solver::query_class_e classify(const QueryFeatures& features);
+      };
+
+
+      //! \class SolverProfileScope
+      /*! \brief Applies a profile to the queries of the calling thread while it lives. The solvers read it with `current()`. */
+      class SolverProfileScope {
+        private:
+          //! The profile applied, kept alive by the scope.
+          std::shared_ptr<const SolverProfile> profile;
+
+          //! The profile applied before the scope.
+          const SolverProfile* previous;
+
+        public:
+          //! Constructor. A null profile keeps the default solvers.
+          TRITON_EXPORT SolverProfileScope(const std::shared_ptr<const SolverProfile>& profile);
+
+          //! Constructor, the profile outliving the scope (e.g. the profile of the caller, applied to the threads it waits for).
+          TRITON_EXPORT SolverProfileScope(const SolverProfile* profile);
+
+          //! Destructor, restores the previous profile.
+          TRITON_EXPORT ~SolverProfileScope();
+
+          //! Returns the profile applied to the queries of the calling thread, null if there is none.
+          TRITON_EXPORT static const SolverProfile* current(void);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SOLVERPROFILES_HPP */
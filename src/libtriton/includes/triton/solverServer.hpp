@@ -0,0 +1,193 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_SOLVERSERVER_H
+#define TRITON_SOLVERSERVER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+#include <triton/dllexport.hpp>
+#include <triton/solverEngine.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/solverSocket.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      //! \class SolverServer
+      /*! \brief Serves the queries of remote solvers (see `RemoteSolver`) over TCP.
+       *
+       * \description
+       * Each connection is served by its own thread, and at most `getWorkers()` queries are solved at once
+       * by the solver given to the constructor. The answers are kept in a cache shared by all the connections
+       * and keyed by the bytes of the queries: a query already answered is not solved again, and a query
+       * received while the same one is being solved waits for its answer. Only the SAT and UNSAT answers are
+       * cached, the other ones depend on the limits of the query.
+       *
+       * Several servers form a pool, the remote solvers spread their queries over them (see `RemoteSolver::setEndpoints()`).
+       */
+      class SolverServer {
+        private:
+          //! The answer of a query, cached or being solved.
+          struct Result {
+            //! True once the query is answered.
+            bool done;
+
+            //! True if the answer is cached.
+            bool cached;
+
+            //! The answer.
+            RemoteAnswer answer;
+          };
+
+          //! A connection and its thread.
+          struct Client {
+            //! The connection.
+            std::unique_ptr<SolverSocket> socket;
+
+            //! The thread serving the connection.
+            std::thread thread;
+
+            //! True once the thread is done.
+            std::atomic<bool> finished;
+          };
+
+          //! The kind of solver of the queries.
+          triton::engines::solver::solver_e kind;
+
+          //! The listener, null while the server is stopped.
+          std::unique_ptr<SolverListener> listener;
+
+          //! The thread accepting the connections.
+          std::thread acceptor;
+
+          //! True while the server runs.
+          std::atomic<bool> running;
+
+          //! The connections.
+          std::list<std::unique_ptr<Client>> clients;
+
+          //! Protects the connections.
+          std::mutex clientsLock;
+
+          //! The max number of queries solved at once.
+          triton::usize workers;
+
+          //! The number of queries being solved.
+          triton::usize busy;
+
+          //! Protects `workers` and `busy`.
+          std::mutex workersLock;
+
+          //! Signaled when a query is solved.
+          std::condition_variable workerFree;
+
+          //! The answers, by key (see `RemoteQuery::getKey()`).
+          std::unordered_map<std::string, std::shared_ptr<Result>> results;
+
+          //! The keys of the cached answers, the oldest first.
+          std::deque<std::string> order;
+
+          //! The max number of cached answers.
+          triton::usize capacity;
+
+          //! Protects the answers.
+          std::mutex resultsLock;
+
+          //! Signaled when a query is answered.
+          std::condition_variable resultDone;
+
+          //! The number of queries received.
+          std::atomic<triton::usize> queries;
+
+          //! The number of queries answered by the cache or by the same query being solved.
+          std::atomic<triton::usize> hits;
+
+          //! The loop accepting the connections.
+          void accept(void);
+
+          //! The loop serving a connection.
+          void serve(Client& client);
+
+          //! Answers a query, from the cache if possible.
+          RemoteAnswer answer(const RemoteQuery& query, triton::engines::solver::SolverEngine& engine);
+
+          //! Solves a query with `engine`, once a worker is free.
+          RemoteAnswer solve(const RemoteQuery& query, triton::engines::solver::SolverEngine& engine);
+
+        public:
+          //! Constructor. The queries are solved by solvers of `kind`.
+          TRITON_EXPORT SolverServer(triton::engines::solver::solver_e kind);
+
+          //! Destructor. Stops the server.
+          TRITON_EXPORT ~SolverServer();
+
+          //! Starts to serve `endpoint` ("host:port", the port may be 0 for any) and returns the port listened to.
+          TRITON_EXPORT triton::uint16 start(const std::string& endpoint);
+
+          //! Stops the server and closes its connections, once their queries are solved.
+          TRITON_EXPORT void stop(void);
+
+          //! Returns true while the server runs.
+          TRITON_EXPORT bool isRunning(void) const;
+
+          //! Returns the max number of queries solved at once.
+          TRITON_EXPORT triton::usize getWorkers(void);
+
+          //! Defines the max number of queries solved at once, at least one. By default, one per core.
+          TRITON_EXPORT void setWorkers(triton::usize workers);
+
+          //! Returns the max number of cached answers.
+          TRITON_EXPORT triton::usize getCacheCapacity(void);
+
+          //! Defines the max number of cached answers, the oldest ones are dropped. By default, 65536.
+          TRITON_EXPORT void setCacheCapacity(triton::usize capacity);
+
+          //! Returns the number of queries received.
+          TRITON_EXPORT triton::usize getQueries(void) const;
+
+          //! Returns the number of queries answered without being solved again.
+          TRITON_EXPORT triton::usize getHits(void) const;
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SOLVERSERVER_H */
@@ -0,0 +1,189 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_SOLVERSOCKET_H
+#define TRITON_SOLVERSOCKET_H
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <triton/dllexport.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      /*! The kinds of the queries sent to a solver server */
+      enum remote_e {
+        REMOTE_IS_SAT = 0,  /*!< is the query satisfiable. */
+        REMOTE_GET_MODELS,  /*!< the models of the query, up to a limit. */
+      };
+
+      /*! \struct RemoteQuery
+       *  \brief A query sent to a solver server (see `SolverServer`). */
+      struct RemoteQuery {
+        //! The kind of the query (see `remote_e`).
+        triton::uint32 kind;
+
+        //! The max number of models returned.
+        triton::uint32 limit;
+
+        //! The timeout of the query (in milliseconds), 0 for the one of the server.
+        triton::uint32 timeout;
+
+        //! The memory limit of the solver (in megabytes), 0 for none.
+        triton::uint32 memoryLimit;
+
+        //! The query, one logical node in the binary format of `AstSerializer`.
+        std::string ast;
+
+        //! Returns the message of the query.
+        TRITON_EXPORT std::string encode(void) const;
+
+        //! Loads the query from a message. Returns false if it is malformed.
+        TRITON_EXPORT bool decode(const std::string& message);
+
+        //! Returns the key of the answer of the query in a cache: its kind, its limit and its AST.
+        TRITON_EXPORT std::string getKey(void) const;
+      };
+
+      /*! \struct RemoteAnswer
+       *  \brief The answer of a solver server to a `RemoteQuery`. */
+      struct RemoteAnswer {
+        //! The status of the query.
+        triton::engines::solver::status_e status;
+
+        //! The solving time (in milliseconds), the one of the first query if it comes from a cache.
+        triton::uint32 solvingTime;
+
+        //! True if the answer comes from the cache of the server.
+        bool cached;
+
+        //! The models, as pairs of symbolic variable id and value.
+        std::vector<std::vector<std::pair<triton::usize, triton::uint512>>> models;
+
+        //! The error of the server, empty if none.
+        std::string error;
+
+        //! Constructor. The status is UNKNOWN.
+        TRITON_EXPORT RemoteAnswer();
+
+        //! Returns the message of the answer.
+        TRITON_EXPORT std::string encode(void) const;
+
+        //! Loads the answer from a message. Returns false if it is malformed.
+        TRITON_EXPORT bool decode(const std::string& message);
+      };
+
+
+      //! \class SolverSocket
+      /*! \brief A TCP connection between a remote solver and a solver server.
+       *
+       * \description
+       * The messages are framed by their size (u32, little-endian). The connection may be closed by
+       * the peer at any time, the messages sent and waited for then fail and the connection is dead.
+       */
+      class SolverSocket {
+        private:
+          //! The socket.
+          int fd;
+
+          //! True once the connection is dead.
+          std::atomic<bool> dead;
+
+          //! The bytes read and not consumed yet.
+          std::string buffer;
+
+          //! Reads until the buffer holds `size` bytes, waiting until `deadline` (steady clock, in milliseconds) if not 0. Returns false on timeout or if the connection is dead.
+          bool fill(triton::usize size, triton::uint64 deadline);
+
+        public:
+          //! Constructor. Takes the ownership of a connected socket.
+          TRITON_EXPORT SolverSocket(int fd);
+
+          //! Destructor. Closes the connection.
+          TRITON_EXPORT ~SolverSocket();
+
+          //! Connects to `endpoint` ("host:port") within `timeout` milliseconds (0 for no limit). Returns null if the server cannot be reached.
+          TRITON_EXPORT static std::unique_ptr<SolverSocket> connect(const std::string& endpoint, triton::uint32 timeout);
+
+          //! Returns true while the connection is open and the peer did not close it.
+          TRITON_EXPORT bool isAlive(void);
+
+          //! Sends a message. Returns false if the connection is dead.
+          TRITON_EXPORT bool send(const std::string& message);
+
+          //! Waits for a message for at most `timeout` milliseconds (0 for no limit). Returns false on timeout or if the connection is dead.
+          TRITON_EXPORT bool receive(std::string& message, triton::uint32 timeout);
+
+          //! Shuts the connection down, from any thread. The pending and next calls fail.
+          TRITON_EXPORT void kill(void);
+      };
+
+
+      //! \class SolverListener
+      /*! \brief A TCP socket accepting the connections of remote solvers. */
+      class SolverListener {
+        private:
+          //! The socket.
+          int fd;
+
+          //! The port listened to.
+          triton::uint16 port;
+
+          //! True once the listener is closed.
+          std::atomic<bool> closed;
+
+        public:
+          //! Constructor. Listens to `endpoint` ("host:port", the port may be 0 for any).
+          TRITON_EXPORT SolverListener(const std::string& endpoint);
+
+          //! Destructor.
+          TRITON_EXPORT ~SolverListener();
+
+          //! Returns the port listened to.
+          TRITON_EXPORT triton::uint16 getPort(void) const;
+
+          //! Waits for a connection for at most `timeout` milliseconds. Returns null on timeout or once the listener is closed.
+          TRITON_EXPORT std::unique_ptr<SolverSocket> accept(triton::uint32 timeout);
+
+          //! Closes the listener, from any thread.
+          TRITON_EXPORT void close(void);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SOLVERSOCKET_H */
@@ -0,0 +1,161 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_SOLVERSTATISTICS_HPP
+#define TRITON_SOLVERSTATISTICS_HPP
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      //! \class SolverStatistics
+      /*! \brief The statistics of the queries of the solver engine.
+       *
+       * \description
+       * Once enabled, each query answered is counted by status, and each one sent to the solver adds its solving
+       * time to a histogram of decades of milliseconds (`[0, 1)`, `[1, 10)`, ..., `[100000, inf)`) and the number
+       * of its distinct nodes to the nodes translated. The peak memory is the max resident set of Triton and of
+       * its solver processes, sampled after each query.
+       *
+       * If a directory is defined (see `setSlowQueryDump()`), the queries solved in more than a threshold are written
+       * into it as SMT-LIB2 scripts, named by the hash of the query and headed by comments holding the solver, the
+       * status, the time, the timeout and the size of the query.
+       */
+      class SolverStatistics {
+        private:
+          //! True if the queries are recorded.
+          bool enabled;
+
+          //! Protects the statistics, queries may be answered from several threads.
+          mutable std::mutex lock;
+
+          //! The number of queries answered, by status.
+          mutable std::map<triton::engines::solver::status_e, triton::usize> queries;
+
+          //! The number of queries answered by the cache.
+          mutable triton::usize cacheHits;
+
+          //! The number of queries sent to the solver, by decade of their solving time.
+          mutable std::vector<triton::usize> histogram;
+
+          //! The total solving time (in milliseconds).
+          mutable triton::uint64 totalTime;
+
+          //! The number of nodes translated for the solver.
+          mutable triton::usize nodes;
+
+          //! The number of nodes of the largest query.
+          mutable triton::usize largest;
+
+          //! The peak memory (in megabytes).
+          mutable triton::usize peakMemory;
+
+          //! The number of queries written into the slow query directory.
+          mutable triton::usize slowQueries;
+
+          //! The directory the slow queries are written into, empty if none.
+          std::string slowQueryDirectory;
+
+          //! The solving time (in milliseconds) above which a query is written.
+          triton::uint32 slowQueryThreshold;
+
+          //! Writes a slow query. Returns false if it cannot be printed in SMT-LIB2.
+          bool dump(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e status, triton::uint32 time, triton::uint32 timeout, triton::usize count, const std::string& solver) const;
+
+        public:
+          //! The number of buckets of the histogram of the solving times.
+          static const triton::usize buckets = 7;
+
+          //! Constructor.
+          TRITON_EXPORT SolverStatistics();
+
+          //! Returns true if the queries are recorded.
+          TRITON_EXPORT bool isEnabled(void) const;
+
+          //! Enables or disables the recording of the queries. By default, disabled.
+          TRITON_EXPORT void setEnabled(bool flag);
+
+          //! Records a query answered by the cache.
+          TRITON_EXPORT void recordHit(triton::engines::solver::status_e status) const;
+
+          //! Records a query sent to the `solver`. The `node` may be null if the query has none, e.g. a check of the solver session.
+          TRITON_EXPORT void record(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e status, triton::uint32 time, triton::uint32 timeout, const std::string& solver) const;
+
+          //! Returns the number of queries answered with `status`.
+          TRITON_EXPORT triton::usize getQueries(triton::engines::solver::status_e status) const;
+
+          //! Returns the number of queries answered by the cache.
+          TRITON_EXPORT triton::usize getCacheHits(void) const;
+
+          //! Returns the number of queries sent to the solver by decade of their solving time, the bucket `i` holding the times in `[10^(i-1), 10^i)` milliseconds.
+          TRITON_EXPORT std::vector<triton::usize> getHistogram(void) const;
+
+          //! Returns the total solving time (in milliseconds).
+          TRITON_EXPORT triton::uint64 getTotalTime(void) const;
+
+          //! Returns the number of nodes translated for the solver.
+          TRITON_EXPORT triton::usize getNodes(void) const;
+
+          //! Returns the number of nodes of the largest query.
+          TRITON_EXPORT triton::usize getLargestQuery(void) const;
+
+          //! Returns the peak memory (in megabytes) of Triton and of its solver processes, 0 if the platform does not tell.
+          TRITON_EXPORT triton::usize getPeakMemory(void) const;
+
+          //! Returns the number of slow queries written.
+          TRITON_EXPORT triton::usize getSlowQueries(void) const;
+
+          //! Returns the directory the slow queries are written into, empty if none.
+          TRITON_EXPORT const std::string& getSlowQueryDirectory(void) const;
+
+          //! Returns the solving time (in milliseconds) above which a query is written.
+          TRITON_EXPORT triton::uint32 getSlowQueryThreshold(void) const;
+
+          //! Writes the queries solved in more than `threshold` milliseconds into `directory`. An empty `directory` writes none.
+          TRITON_EXPORT void setSlowQueryDump(const std::string& directory, triton::uint32 threshold);
+
+          //! Clears the statistics.
+          TRITON_EXPORT void clear(void);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SOLVERSTATISTICS_HPP */
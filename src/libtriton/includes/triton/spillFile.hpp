@@ -0,0 +1,100 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_SPILLFILE_H
+#define TRITON_SPILLFILE_H
+
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <triton/dllexport.hpp>
+#include <triton/mappedFile.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      /*! \class SpillFile
+       *  \brief A file holding the state spilled out of memory, such as the cold path constraints.
+       *
+       * \description
+       * Records are appended and never rewritten, so that their offsets stay valid for all the
+       * users of the file, e.g. the forks of a context. They are read back by mapping them. The
+       * file is truncated when opened and removed when the last user releases it.
+       */
+      class SpillFile {
+        private:
+          //! The path of the file.
+          std::string path;
+
+          //! The stream appending the records.
+          std::ofstream stream;
+
+          //! The size of the file.
+          triton::uint64 size;
+
+          //! Protects the stream, the users may be on several threads.
+          std::mutex lock;
+
+        public:
+          //! Constructor. Creates the file at `path`, truncated if it exists.
+          TRITON_EXPORT SpillFile(const std::string& path);
+
+          //! Destructor. Removes the file.
+          TRITON_EXPORT ~SpillFile();
+
+          SpillFile(const SpillFile&) = delete;
+          SpillFile& operator=(const SpillFile&) = delete;
+
+          //! Returns the path of the file.
+          TRITON_EXPORT const std::string& getPath(void) const;
+
+          //! Returns the size of the file.
+          TRITON_EXPORT triton::uint64 getSize(void);
+
+          //! Appends `record` and returns its offset. It can be read once this returns.
+          TRITON_EXPORT triton::uint64 append(const std::string& record);
+
+          //! Maps the `size` bytes of the record at `offset`.
+          TRITON_EXPORT std::shared_ptr<const triton::arch::MappedFile> read(triton::uint64 offset, triton::usize size) const;
+      };
+
+      //! Shared Spill File.
+      using SharedSpillFile = std::shared_ptr<triton::engines::symbolic::SpillFile>;
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SPILLFILE_H */
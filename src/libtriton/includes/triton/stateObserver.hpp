@@ -0,0 +1,192 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_STATEOBSERVER_HPP
+#define TRITON_STATEOBSERVER_HPP
+
+#include <atomic>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <triton/concreteMemory.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/pathConstraint.hpp>
+#include <triton/persistentMap.hpp>
+#include <triton/persistentVector.hpp>
+#include <triton/register.hpp>
+#include <triton/symbolicExpression.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  class API;
+  class StateObserver;
+
+  /*! \class StateView
+   *  \brief An immutable version of the state of a context, published by `API::publishState()`.
+   *
+   * \description
+   * A view holds the concrete registers, the concrete memory, the symbolic registers and the path
+   * constraints of the context when it was published. The memory, the symbolic registers and the path
+   * constraints are persistent structures shared with the context, so publishing a view only copies
+   * the concrete registers. The context copies what it writes afterwards, the view is never modified.
+   *
+   * The AST nodes referenced by the symbolic expressions and the path constraints still belong to the
+   * processing thread: an observer may read their ids and addresses, but not their ASTs.
+   */
+  class StateView {
+    friend class triton::API;
+    friend class triton::StateObserver;
+
+    private:
+      //! The epoch of the view.
+      triton::uint64 epoch;
+
+      //! The concrete values of the parent registers.
+      std::unordered_map<triton::uint32, triton::uint512> registers;
+
+      //! The concrete memory.
+      triton::arch::ConcreteMemory memory;
+
+      //! The symbolic registers, by parent register. The deferred ones have their previous expression.
+      triton::utils::PersistentMap<triton::uint32, triton::engines::symbolic::SharedSymbolicExpression, triton::IdentityHash<triton::uint32>> symbolicRegisters;
+
+      //! The path constraints. The predicates of the spilled ones are not faulted in.
+      triton::utils::PersistentVector<triton::engines::symbolic::PathConstraint> pathConstraints;
+
+    public:
+      //! Constructor.
+      TRITON_EXPORT StateView();
+
+      //! Returns the epoch of the view, increasing with each view published.
+      TRITON_EXPORT triton::uint64 getEpoch(void) const;
+
+      //! Returns the concrete value of a register.
+      TRITON_EXPORT triton::uint512 getConcreteRegisterValue(const triton::arch::Register& reg) const;
+
+      //! Returns the concrete memory.
+      TRITON_EXPORT const triton::arch::ConcreteMemory& getConcreteMemory(void) const;
+
+      //! Returns true if a register has a symbolic expression.
+      TRITON_EXPORT bool isRegisterSymbolized(const triton::arch::Register& reg) const;
+
+      //! Returns the id of the symbolic expression of a register.
+      TRITON_EXPORT triton::usize getSymbolicRegisterId(const triton::arch::Register& reg) const;
+
+      //! Returns the number of path constraints.
+      TRITON_EXPORT triton::usize getSizeOfPathConstraints(void) const;
+
+      //! Returns a path constraint. Only its addresses and whether its branches are taken may be read, its ASTs belong to the processing thread.
+      TRITON_EXPORT const triton::engines::symbolic::PathConstraint& getPathConstraint(triton::usize index) const;
+  };
+
+
+  /*! \class StateObserver
+   *  \brief Publishes the views of the state of a context to observer threads.
+   *
+   * \description
+   * The processing thread publishes the views (see `API::publishState()`), the observer threads read
+   * the last one without locks. A reader pins the epoch it starts at; a view replaced at epoch `e` is
+   * released by the processing thread, at a next publication, once no reader is pinned before `e`. So
+   * the views, and the objects they are the last to reference, are always released by the processing
+   * thread, and a reader never waits for it.
+   */
+  class StateObserver {
+    public:
+      //! The maximum number of readers at the same time.
+      static const triton::usize maxReaders = 64;
+
+      /*! \class Reader
+       *  \brief Pins the current view while it lives. It must not outlive the observer. */
+      class Reader {
+        private:
+          //! The observer.
+          const StateObserver* observer;
+
+          //! The slot of the reader.
+          triton::usize slot;
+
+          //! The view, null if none was published.
+          const StateView* view;
+
+        public:
+          //! Constructor. Pins the current view.
+          TRITON_EXPORT Reader(const StateObserver& observer);
+
+          //! Destructor. Unpins the view.
+          TRITON_EXPORT ~Reader();
+
+          Reader(const Reader& other) = delete;
+          Reader& operator=(const Reader& other) = delete;
+
+          //! Returns the view, null if none was published.
+          TRITON_EXPORT const StateView* get(void) const;
+
+          //! Returns the view.
+          TRITON_EXPORT const StateView* operator->(void) const;
+      };
+
+    private:
+      //! True if the processing publishes a view at the end of each block.
+      std::atomic<bool> enabled;
+
+      //! The current view, null if none was published.
+      std::atomic<StateView*> current;
+
+      //! The current epoch, from 1.
+      std::atomic<triton::uint64> epoch;
+
+      //! The epochs pinned by the readers, 0 if a slot is free.
+      mutable std::atomic<triton::uint64> pins[maxReaders];
+
+      //! The views replaced and not released yet, with the epoch they were replaced at. Only used by the processing thread.
+      std::vector<std::pair<triton::uint64, StateView*>> retired;
+
+      //! Releases the views no reader may hold.
+      void reclaim(void);
+
+    public:
+      //! Constructor.
+      TRITON_EXPORT StateObserver();
+
+      //! Destructor. No reader must be alive.
+      TRITON_EXPORT ~StateObserver();
+
+      StateObserver(const StateObserver& other) = delete;
+      StateObserver& operator=(const StateObserver& other) = delete;
+
+      //! Enables or disables the publication of a view at the end of each block processed.
+      TRITON_EXPORT void setEnabled(bool flag);
+
+      //! Returns true if a view is published at the end of each block processed.
+      TRITON_EXPORT bool isEnabled(void) const;
+
+      //! Publishes a view, which replaces the current one. Only called by the processing thread.
+      TRITON_EXPORT void publish(StateView* view);
+
+      //! Returns the epoch of the last view published, 0 if none.
+      TRITON_EXPORT triton::uint64 getEpoch(void) const;
+
+      //! Returns the number of views replaced and not released yet.
+      TRITON_EXPORT triton::usize getRetired(void) const;
+
+      //! Releases all views. Only called by the processing thread, no reader must be alive.
+      TRITON_EXPORT void clear(void);
+  };
+
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_STATEOBSERVER_HPP */
@@ -8,27 +8,37 @@
 #ifndef TRITON_SYMBOLICENGINE_H
 #define TRITON_SYMBOLICENGINE_H
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <vector>
 
+#include <triton/alignedMemory.hpp>
 #include <triton/architecture.hpp>
 #include <triton/armOperandProperties.hpp>
 #include <triton/ast.hpp>
 #include <triton/astContext.hpp>
 #include <triton/callbacks.hpp>
+#include <triton/concretizationPolicy.hpp>
 #include <triton/dllexport.hpp>
 #include <triton/memoryAccess.hpp>
+#include <triton/memoryUsage.hpp>
 #include <triton/modes.hpp>
 #include <triton/pathManager.hpp>
+#include <triton/persistentMap.hpp>
 #include <triton/register.hpp>
+#include <triton/semanticsCache.hpp>
+#include <triton/solverEngine.hpp>
 #include <triton/symbolicEnums.hpp>
 #include <triton/symbolicExpression.hpp>
+#include <triton/symbolicMemory.hpp>
 #include <triton/symbolicSimplification.hpp>
 #include <triton/symbolicVariable.hpp>
 #include <triton/tritonTypes.hpp>
+#include <triton/weakIdTable.hpp>
 
 
 
@@ -71,43 +81,155 @@ namespace triton {
           //! Symbolic expressions id.
           triton::usize uniqueSymExprId;
 
-          //! Symbolic variables id.
-          triton::usize uniqueSymVarId;
-
-          /*! \brief The map of symbolic variables
-           *
-           * \details
-           * **item1**: variable id<br>
-           * **item2**: symbolic variable
-           */
-          mutable std::unordered_map<triton::usize, WeakSymbolicVariable> symbolicVariables;
-
-          /*! \brief The map of symbolic expressions
-           *
-           * \details
-           * **item1**: symbolic reference id<br>
-           * **item2**: symbolic expression
-           */
-          mutable std::unordered_map<triton::usize, WeakSymbolicExpression> symbolicExpressions;
-
-          /*! \brief map of <address:size> -> symbolic expression.
-           *
-           * \details
-           * **item1**: <addr:size><br>
-           * **item2**: shared symbolic expression
-           */
-          std::map<std::pair<triton::uint64, triton::uint32>, SharedSymbolicExpression> alignedMemoryReference;
-
-          /*! \brief map of address -> symbolic expression
-           *
-           * \details
-           * **item1**: memory address<br>
-           * **item2**: shared symbolic expression
-           */
-          std::unordered_map<triton::uint64, SharedSymbolicExpression> memoryReference;
-
-          //! Symbolic register state.
-          std::vector<SharedSymbolicExpression> symbolicReg;
+          //! Symbolic variables id. Shared with copies of the engine, as they name variables in the same AST context.
+          std::shared_ptr<triton::usize> uniqueSymVarId;
+
+          //! The table of symbolic variables, indexed by id.
+          mutable triton::utils::WeakIdTable<SymbolicVariable> symbolicVariables;
+
+          //! The table of symbolic expressions, indexed by id.
+          mutable triton::utils::WeakIdTable<SymbolicExpression> symbolicExpressions;
+
+          //! The index of the tainted symbolic expressions. It may hold ones removed or untainted since, which are dropped when queried.
+          mutable triton::utils::WeakIdTable<SymbolicExpression> taintedExpressions;
+
+          //! Aligned memory state. Maps non-overlapping <address:size> ranges to the symbolic expression stored there.
+          triton::engines::symbolic::AlignedMemory alignedMemoryReference;
+
+          //! Symbolic memory state. Maps each byte of memory to its symbolic expression, by pages of 4 KB.
+          triton::engines::symbolic::SymbolicMemory memoryReference;
+
+          //! The content of a memory cell when it was last stored into the memory array.
+          struct ArrayCell {
+            //! The symbolic expression of the cell, nullptr if it was concrete.
+            SharedSymbolicExpression expr;
+
+            //! The concrete value of the cell if it was concrete.
+            triton::uint8 value;
+          };
+
+          //! The memory as an array of bytes (MEMORY_ARRAY mode), nullptr until an access at a symbolic address.
+          SharedSymbolicExpression memoryArray;
+
+          //! The cells stored into the memory array, by address. A cell whose content changed since is stored again by the next access at a symbolic address reaching it.
+          triton::utils::PersistentMap<triton::uint64, ArrayCell> memoryArrayCells;
+
+          //! Symbolic register state. Maps a parent register to its symbolic expression.
+          triton::utils::PersistentMap<triton::uint32, SharedSymbolicExpression, IdentityHash<triton::uint32>> symbolicReg;
+
+          //! The symbolic register states of the threads other than the current one, by thread id.
+          std::unordered_map<triton::uint32, triton::utils::PersistentMap<triton::uint32, SharedSymbolicExpression, IdentityHash<triton::uint32>>> threads;
+
+          //! The id of the thread whose symbolic registers are the current ones.
+          triton::uint32 thread;
+
+          //! The maximum number of live AST nodes, 0 if unbounded.
+          triton::usize maxNodes;
+
+          //! The maximum number of symbolic expressions, 0 if unbounded.
+          triton::usize maxExpressions;
+
+          //! The policy applied when the node or expression budget is exceeded.
+          triton::engines::symbolic::budget_policy_e budgetPolicy;
+
+          //! The maximum depth of the ASTs of new expressions with AST_DEPTH_LIMIT.
+          triton::uint32 depthLimit;
+
+          //! The policy applied to the ASTs of new expressions deeper than `depthLimit`.
+          triton::engines::symbolic::depth_policy_e depthPolicy;
+
+          //! The id of the expression from which the budget may concretize the state again.
+          triton::usize nextEviction;
+
+          //! The policies of the dereferences of symbolic addresses, and their statistics.
+          triton::engines::symbolic::ConcretizationPolicy concretization;
+
+          //! The address of the last dereference constrained, so that the load and the store of an instruction constrain it once. It is not copied.
+          triton::ast::SharedAbstractNode lastPointer;
+
+          //! Identifies a comment of the expressions of an instruction: its address, its type, the prefix and the comment given by the semantics.
+          using CommentKey = std::tuple<triton::uint64, triton::uint32, const char*, std::string>;
+
+          //! Hashes a key of comment. The prefixes are literals, thus compared by address.
+          struct CommentKeyHash {
+            std::size_t operator()(const CommentKey& key) const {
+              return std::hash<std::string>()(std::get<3>(key))
+                ^ std::hash<triton::uint64>()(std::get<0>(key) ^ (static_cast<triton::uint64>(std::get<1>(key)) << 48))
+                ^ std::hash<const char*>()(std::get<2>(key));
+            }
+          };
+
+          //! The comments shared with INTERNED_COMMENTS. The expressions of an instruction executed again share the ones of its first execution.
+          std::unordered_map<CommentKey, std::shared_ptr<const std::string>, CommentKeyHash> comments;
+
+          //! A register expression deferred until the register is read.
+          struct LazyRegister {
+            //! Builds the AST of the expression.
+            std::function<triton::ast::SharedAbstractNode(void)> node;
+
+            //! The comment of the expression.
+            std::string comment;
+
+            //! The address of the instruction which defined the expression.
+            triton::uint64 address;
+
+            //! The taint of the expression.
+            bool tainted;
+
+            //! The expression of a flag deferred in a block, already built but not yet recorded. `node` and `tainted` are then unused.
+            SharedSymbolicExpression detached;
+          };
+
+          //! The deferred register expressions. Maps a parent register to the expression it will be assigned when it is read.
+          std::unordered_map<triton::uint32, LazyRegister, IdentityHash<triton::uint32>> lazyRegisters;
+
+          //! The last AST returned for a register by `getRegisterAst()`.
+          struct RegisterAst {
+            //! The register.
+            triton::uint32 id;
+
+            //! The expression of the parent register when the AST was built, nullptr if the register was concrete.
+            const SymbolicExpression* expr;
+
+            //! The concrete value of the register when the AST was built.
+            triton::uint512 value;
+
+            //! The AST.
+            triton::ast::SharedAbstractNode node;
+          };
+
+          //! The last ASTs returned for the registers. Maps a parent register to the ASTs of the registers it holds.
+          std::unordered_map<triton::uint32, std::vector<RegisterAst>, IdentityHash<triton::uint32>> registerAsts;
+
+          //! True while a block is processed with `DEAD_FLAGS_ELIMINATION`: the expressions of the flags are recorded when the flags are read.
+          bool deferFlags;
+
+          //! A register written by a block, stepped by a constant if the block is a loop (LOOP_INDUCTION_VARIABLES).
+          struct InductionVariable {
+            //! The expression of the register at the end of the last execution of the block.
+            SharedSymbolicExpression last;
+
+            //! The expression of the register before its first step, nullptr until it stepped.
+            SharedSymbolicExpression base;
+
+            //! The sum of the steps since the base, modulo 2^width.
+            triton::uint512 offset;
+
+            //! The size of the steps: the one of the register, or of its low part written with a zero extension.
+            triton::uint32 width;
+          };
+
+          //! The registers written by the blocks processed with `LOOP_INDUCTION_VARIABLES`, by address of the block and parent register.
+          std::unordered_map<triton::uint64, std::unordered_map<triton::uint32, InductionVariable, IdentityHash<triton::uint32>>> inductionVariables;
+
+          //! The parent registers written by the block being processed with `LOOP_INDUCTION_VARIABLES`.
+          std::vector<triton::uint32> blockRegisters;
+
+          //! The address of the block being processed.
+          triton::uint64 blockAddress;
+
+          //! True while a block is processed with `LOOP_INDUCTION_VARIABLES`.
+          bool inductionBlock;
 
         private:
           //! Reference to the context managing ast nodes.
@@ -122,6 +244,15 @@ namespace triton {
           //! Modes API.
           triton::modes::SharedModes modes;
 
+          //! The solver of the forks of FORK_POINTER, nullptr if none.
+          const triton::engines::solver::SolverEngine* solver;
+
+          //! The cache recording the calls of the semantics being built, nullptr if none. Not copied.
+          triton::engines::symbolic::SemanticsCache* recorder;
+
+          //! True while the semantics of an instruction is built on the concrete path, all its expressions being concrete. Not copied.
+          bool concreteSemantics;
+
           //! Returns an unique symbolic expression id.
           triton::usize getUniqueSymExprId(void);
 
@@ -131,6 +262,12 @@ namespace triton {
           //! Gets an aligned entry.
           const SharedSymbolicExpression& getAlignedMemory(triton::uint64 address, triton::uint32 size);
 
+          //! Returns the AST of [address, address+size) extracted from the aligned entry covering it, nullptr if no entry covers it.
+          triton::ast::SharedAbstractNode getCoveringAlignedMemoryAst(triton::uint64 address, triton::uint32 size);
+
+          //! Returns the AST of [address, address+size) as the concatenation of the aligned entries overlapping it and of the bytes between them, nullptr if no entry overlaps it.
+          triton::ast::SharedAbstractNode getForwardedAlignedMemoryAst(triton::uint64 address, triton::uint32 size, const triton::uint8* concreteValue);
+
           //! Adds an aligned entry.
           void addAlignedMemory(triton::uint64 address, triton::uint32 size, const SharedSymbolicExpression& expr);
 
@@ -143,6 +280,42 @@ namespace triton {
           //! Adds a symbolic memory reference.
           inline void addMemoryReference(triton::uint64 mem, const SharedSymbolicExpression& expr);
 
+          //! Sets the concrete register or memory of a variable to its new value.
+          void synchronizeConcreteVariable(const SharedSymbolicVariable& symVar, const triton::uint512& value);
+
+          //! Returns true if the memory access is at a symbolic address and MEMORY_ARRAY is enabled.
+          bool isMemoryArrayAccess(const triton::arch::MemoryAccess& mem) const;
+
+          //! Returns true if the memory access is at a symbolic address and kept symbolic by MEMORY_ARRAY or by the policy of the instruction.
+          bool isMemoryArrayAccess(const triton::arch::Instruction& inst, const triton::arch::MemoryAccess& mem) const;
+
+          //! Returns the address of the memory access as an index of the memory array.
+          triton::ast::SharedAbstractNode getMemoryArrayIndex(const triton::arch::MemoryAccess& mem);
+
+          //! Stores into the memory array the cells reachable by `size` bytes at `index` whose content changed. Returns false if they are too many.
+          bool syncMemoryArray(const triton::ast::SharedAbstractNode& index, triton::uint32 size);
+
+          //! Replaces the memory array by `node`.
+          void setMemoryArray(const triton::ast::SharedAbstractNode& node, const std::string& comment);
+
+          //! Returns the AST of the memory access as selects of the memory array, nullptr if its address reaches too many cells.
+          triton::ast::SharedAbstractNode getMemoryArrayAst(const triton::arch::MemoryAccess& mem);
+
+          //! Stores `node` into the memory array at the address of the memory access. Returns false if its address reaches too many cells.
+          bool storeMemoryArray(const triton::arch::MemoryAccess& mem, const triton::ast::SharedAbstractNode& node, const std::string& comment);
+
+          //! Applies the policy of the instruction to a dereference of the symbolic address of `mem`, kept symbolic if `symbolic`, and counts it.
+          void concretizePointer(const triton::arch::Instruction& inst, const triton::arch::MemoryAccess& mem, bool symbolic);
+
+          //! Returns the concrete value of `lea` and at most `limit - 1` other values the solver finds it may take with the path predicate.
+          std::vector<triton::uint64> getPointerValues(const triton::ast::SharedAbstractNode& lea, triton::uint32 limit) const;
+
+          //! Returns the AST of the memory cells of the memory access, at its concrete address.
+          triton::ast::SharedAbstractNode getMemoryCellsAst(const triton::arch::MemoryAccess& mem);
+
+          //! Returns true if the accesses of a range can be done at once, without the aligned references, the callbacks and the cache of the semantics seeing each one.
+          bool isMemoryRangeAccess(void) const;
+
           //! Returns the AST corresponding to the extend operation. Mainly used for AArch64 operands.
           triton::ast::SharedAbstractNode getExtendAst(const triton::arch::arm::ArmOperandProperties& extend, const triton::ast::SharedAbstractNode& node);
 
@@ -152,9 +325,45 @@ namespace triton {
           //! Sets implicit read registers (base and index) from an effective address.
           void setImplicitReadRegisterFromEffectiveAddress(triton::arch::Instruction& inst, const triton::arch::MemoryAccess& mem);
 
+          //! The number of expressions created between two concretizations of the budget.
+          static const triton::usize evictionInterval = 1024;
+
+          //! Returns the comment `prefix comment - inst` of an expression built by `inst`: nullptr with NO_COMMENTS, shared by the executions of the instruction with INTERNED_COMMENTS.
+          std::shared_ptr<const std::string> getInstructionComment(const char* prefix, const std::string& comment, const triton::arch::Instruction& inst);
+
+          //! Returns the comment `comment - 0xaddress` of an expression deferred by the instruction at `address`, according to the same modes.
+          std::shared_ptr<const std::string> getDeferredComment(const std::string& comment, triton::uint64 address);
+
+          //! Creates a new symbolic expression whose comment may be shared with other expressions.
+          SharedSymbolicExpression newSymbolicExpression(const triton::ast::SharedAbstractNode& node, triton::engines::symbolic::expression_e type, const std::shared_ptr<const std::string>& comment);
+
+          //! Returns the AST of a new expression with the budget applied: a concrete AST if it must not be symbolic.
+          triton::ast::SharedAbstractNode applyBudget(const triton::ast::SharedAbstractNode& node);
+
+          //! Concretizes the older half of the symbolic memory cells.
+          void concretizeOldestMemory(void);
+
+          //! Concretizes the half of the symbolic registers and memory cells holding the deepest ASTs.
+          void concretizeDeepestExpressions(void);
+
           //! Adds new symbolic expressions to the instruction starting with given symbolic expression id. Returns last added expression.
           const SharedSymbolicExpression& addSymbolicExpressions(triton::arch::Instruction& inst, triton::usize id) const;
 
+          //! Returns true if the expressions of `node` may take the concrete fast path: on the concrete path of the instruction, or with `ONLY_ON_SYMBOLIZED` if it is not symbolized.
+          bool isConcreteFastPath(const triton::ast::SharedAbstractNode& node) const;
+
+          //! Adds to the instruction an expression holding the concrete value of `node`, which is neither recorded nor commented. Returns this expression.
+          const SharedSymbolicExpression& addConcreteExpression(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, triton::engines::symbolic::expression_e type);
+
+          //! Builds the deferred expression of the parent register `id`, if any, and assigns it.
+          void buildLazyRegister(triton::uint32 id);
+
+          //! Rewrites the registers the block stepped by the same constant as at its previous execution as their value before the loop plus the sum of the steps.
+          void collapseInductionVariables(void);
+
+          //! Returns the expression of the flag `flag` written by `inst`, detached until the flag is read.
+          const SharedSymbolicExpression& deferFlagExpression(const triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, const triton::arch::Register& flag, const std::string& comment);
+
         public:
           //! Constructor.
           TRITON_EXPORT SymbolicEngine(triton::arch::Architecture* architecture,
@@ -171,12 +380,36 @@ namespace triton {
           //! Copies a SymbolicEngine.
           TRITON_EXPORT SymbolicEngine& operator=(const SymbolicEngine& other);
 
+          //! Copies the symbolic state (expressions, variables, registers, memory and path constraints) of another engine. The state is shared until written. The architecture and the callbacks of the engine are kept.
+          TRITON_EXPORT void copyState(const SymbolicEngine& other);
+
+          //! Switches the symbolic registers to the ones of the thread `tid`, the symbolic memory is shared by all the threads. A new thread starts with a copy of the current ones. The deferred registers of the current thread are built first.
+          TRITON_EXPORT void setThread(triton::uint32 tid);
+
+          //! Removes the symbolic registers of the thread `tid`, which must not be the current one.
+          TRITON_EXPORT void removeThread(triton::uint32 tid);
+
           //! Creates a new shared symbolic expression.
           TRITON_EXPORT SharedSymbolicExpression newSymbolicExpression(const triton::ast::SharedAbstractNode& node, triton::engines::symbolic::expression_e type, const std::string& comment="");
 
           //! Removes the symbolic expression corresponding to the id.
           TRITON_EXPORT void removeSymbolicExpression(const SharedSymbolicExpression& expr);
 
+          //! Sets the taint of `expr` and indexes it if tainted. The taint of an expression should be set through it, or the expression indexed right after by `indexTaintedExpressions()`.
+          TRITON_EXPORT void setTaintedExpression(const SharedSymbolicExpression& expr, bool flag);
+
+          //! Indexes the tainted ones of `exprs`, e.g. the expressions of an instruction once its semantics have spread the taint.
+          TRITON_EXPORT void indexTaintedExpressions(const std::vector<SharedSymbolicExpression>& exprs);
+
+          //! Records an existing symbolic expression, such as one loaded from a snapshot, under its id. The ids of the new expressions come after it.
+          TRITON_EXPORT void addSymbolicExpression(const SharedSymbolicExpression& expr);
+
+          //! Records an existing symbolic variable, such as one loaded from a snapshot, under its id. The ids of the new variables come after it.
+          TRITON_EXPORT void addSymbolicVariable(const SharedSymbolicVariable& var);
+
+          //! Assigns the expression of a byte to the memory cell `addr`, without synchronizing the concrete state.
+          TRITON_EXPORT void setSymbolicMemory(triton::uint64 addr, const SharedSymbolicExpression& expr);
+
           //! Adds a symbolic variable.
           TRITON_EXPORT SharedSymbolicVariable newSymbolicVariable(triton::engines::symbolic::variable_e type, triton::uint64 source, triton::uint32 size, const std::string& alias="");
 
@@ -193,7 +426,7 @@ namespace triton {
           TRITON_EXPORT SharedSymbolicExpression getSymbolicMemory(triton::uint64 addr) const;
 
           //! Returns the map (addr:expr) of all symbolic memory defined.
-          TRITON_EXPORT const std::unordered_map<triton::uint64, SharedSymbolicExpression>& getSymbolicMemory(void) const;
+          TRITON_EXPORT std::unordered_map<triton::uint64, SharedSymbolicExpression> getSymbolicMemory(void) const;
 
           //! Returns the shared symbolic expression corresponding to the parent register.
           TRITON_EXPORT const SharedSymbolicExpression& getSymbolicRegister(const triton::arch::Register& reg) const;
@@ -201,6 +434,9 @@ namespace triton {
           //! Returns the map of symbolic registers defined.
           TRITON_EXPORT std::unordered_map<triton::arch::register_e, SharedSymbolicExpression> getSymbolicRegisters(void) const;
 
+          //! Returns the symbolic registers of the current thread as they are stored, shared with the copies of the engine. The deferred ones are not built.
+          TRITON_EXPORT const triton::utils::PersistentMap<triton::uint32, SharedSymbolicExpression, IdentityHash<triton::uint32>>& getPersistentSymbolicRegisters(void) const;
+
           //! Returns the symbolic memory value.
           TRITON_EXPORT triton::uint8 getSymbolicMemoryValue(triton::uint64 address);
 
@@ -231,6 +467,9 @@ namespace triton {
           //! Returns the AST corresponding to the memory and defines the memory as input of the instruction.
           TRITON_EXPORT triton::ast::SharedAbstractNode getMemoryAst(triton::arch::Instruction& inst, const triton::arch::MemoryAccess& mem);
 
+          //! Returns the ASTs of the `count` consecutive memory accesses of `size` bytes from `addr` and defines them as inputs of the instruction. The cells of the range are looked up at once.
+          TRITON_EXPORT std::vector<triton::ast::SharedAbstractNode> getMemoryAsts(triton::arch::Instruction& inst, triton::uint64 addr, triton::uint32 size, triton::usize count);
+
           //! Returns the AST corresponding to the register.
           TRITON_EXPORT triton::ast::SharedAbstractNode getRegisterAst(const triton::arch::Register& reg);
 
@@ -246,6 +485,9 @@ namespace triton {
           //! Returns the new shared symbolic memory expression expression and links this expression to the instruction.
           TRITON_EXPORT const SharedSymbolicExpression& createSymbolicMemoryExpression(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, const triton::arch::MemoryAccess& mem, const std::string& comment="");
 
+          //! Returns the new shared symbolic memory expressions of `nodes`, stored one after the other from `addr`, and links them to the instruction. The concrete memory and the byte references of the range are updated at once.
+          TRITON_EXPORT std::vector<SharedSymbolicExpression> createSymbolicMemoryExpressions(triton::arch::Instruction& inst, const std::vector<triton::ast::SharedAbstractNode>& nodes, triton::uint64 addr, const std::string& comment="");
+
           //! Returns the new shared symbolic register expression expression and links this expression to the instruction.
           TRITON_EXPORT const SharedSymbolicExpression& createSymbolicRegisterExpression(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, const triton::arch::Register& reg, const std::string& comment="");
 
@@ -255,13 +497,31 @@ namespace triton {
           //! Assigns a symbolic expression to a register.
           TRITON_EXPORT void assignSymbolicExpressionToRegister(const SharedSymbolicExpression& se, const triton::arch::Register& reg);
 
+          //! Defers the expression of the parent register `reg` written by `inst`: `node` is only called, and its expression assigned, when the register is read. A write of the register drops it.
+          TRITON_EXPORT void deferSymbolicRegisterExpression(const triton::arch::Instruction& inst, const triton::arch::Register& reg, const std::function<triton::ast::SharedAbstractNode(void)>& node, const std::string& comment, bool tainted);
+
+          //! Builds the deferred expression of the parent register of `reg`, or all of them if `reg` holds all flags (x86 EFLAGS).
+          TRITON_EXPORT void buildLazyRegisters(const triton::arch::Register& reg);
+
+          //! Builds all deferred register expressions.
+          TRITON_EXPORT void buildLazyRegisters(void);
+
+          //! Starts the processing of the block at `addr`. With `DEAD_FLAGS_ELIMINATION`, the expressions of the flags written until endBlock() are only recorded if the flags are read.
+          TRITON_EXPORT void beginBlock(triton::uint64 addr);
+
+          //! Ends the processing of a block and records the expressions of the flags still deferred, which are live at its exit. With `LOOP_INDUCTION_VARIABLES`, collapses the update chains of the registers the block steps by a constant.
+          TRITON_EXPORT void endBlock(void);
+
           //! Assigns a symbolic expression to a memory.
           TRITON_EXPORT void assignSymbolicExpressionToMemory(const SharedSymbolicExpression& se, const triton::arch::MemoryAccess& mem);
 
           //! Slices all expressions from a given one.
           TRITON_EXPORT std::unordered_map<triton::usize, SharedSymbolicExpression> sliceExpressions(const SharedSymbolicExpression& expr);
 
-          //! Returns the vector of the tainted symbolic expressions.
+          //! Slices all expressions from several ones. The slices share the expressions they have in common, which are visited once.
+          TRITON_EXPORT std::unordered_map<triton::usize, SharedSymbolicExpression> sliceExpressionsMany(const std::vector<SharedSymbolicExpression>& exprs);
+
+          //! Returns the vector of the tainted symbolic expressions, by increasing id. Its cost is the one of the tainted expressions, not of all of them.
           TRITON_EXPORT std::vector<SharedSymbolicExpression> getTaintedSymbolicExpressions(void) const;
 
           //! Returns all symbolic expressions.
@@ -276,13 +536,16 @@ namespace triton {
           //! Converts a symbolic memory expression to a symbolic variable.
           TRITON_EXPORT SharedSymbolicVariable symbolizeMemory(const triton::arch::MemoryAccess& mem, const std::string& symVarAlias="");
 
+          //! Converts the memory area [baseAddr, baseAddr+size) to symbolic variables of `granularity` bytes. Aliases are `aliasPrefix_index` if a prefix is given.
+          TRITON_EXPORT std::vector<SharedSymbolicVariable> symbolizeMemoryArea(triton::uint64 baseAddr, triton::usize size, triton::uint32 granularity=triton::size::byte, const std::string& aliasPrefix="");
+
           //! Converts a symbolic register expression to a symbolic variable.
           TRITON_EXPORT SharedSymbolicVariable symbolizeRegister(const triton::arch::Register& reg, const std::string& symVarAlias="");
 
-          //! Concretizes all symbolic memory references.
+          //! Concretizes all symbolic memory references in constant time, the stale pages are released lazily.
           TRITON_EXPORT void concretizeAllMemory(void);
 
-          //! Concretizes all symbolic register references.
+          //! Concretizes all symbolic register references in constant time, the stale entries are released lazily.
           TRITON_EXPORT void concretizeAllRegister(void);
 
           //! Concretizes a specific symbolic memory reference.
@@ -291,12 +554,60 @@ namespace triton {
           //! Concretizes a specific symbolic memory reference.
           TRITON_EXPORT void concretizeMemory(triton::uint64 addr);
 
+          //! Concretizes the symbolic memory references of [baseAddr, baseAddr+size).
+          TRITON_EXPORT void concretizeMemoryArea(triton::uint64 baseAddr, triton::usize size);
+
           //! Concretizes a specific symbolic register reference.
           TRITON_EXPORT void concretizeRegister(const triton::arch::Register& reg);
 
+          //! Assigns the symbolic memory references of [src, src+size) to [dst, dst+size), as memmove does, without creating new expressions.
+          TRITON_EXPORT void copySymbolicMemory(triton::uint64 dst, triton::uint64 src, triton::usize size);
+
           //! Enables or disables the symbolic execution engine.
           TRITON_EXPORT void enable(bool flag);
 
+          //! Defines the solver of the forks of FORK_POINTER, which may be null.
+          TRITON_EXPORT void setSolver(const triton::engines::solver::SolverEngine* solver);
+
+          //! Returns the policies of the dereferences of symbolic addresses, and their statistics.
+          TRITON_EXPORT triton::engines::symbolic::ConcretizationPolicy* getConcretizationPolicy(void);
+
+          //! Reports the calls of the semantics to `recorder`, until it is set to nullptr.
+          TRITON_EXPORT void setSemanticsRecorder(triton::engines::symbolic::SemanticsCache* recorder);
+
+          //! Builds the next expressions as concrete ones, whatever their AST, until it is set to false. Used by the IR builder on the concrete path of an instruction.
+          TRITON_EXPORT void setConcreteSemantics(bool flag);
+
+          //! Defines the budget of the engine: the maximum depth of ASTs, of live AST nodes and of symbolic expressions (0 if unbounded), and the policy applied when nodes or expressions exceed it.
+          TRITON_EXPORT void setBudget(triton::uint32 maxDepth, triton::usize maxNodes, triton::usize maxExpressions, triton::engines::symbolic::budget_policy_e policy);
+
+          //! Returns the maximum depth of ASTs, 0 if unbounded.
+          TRITON_EXPORT triton::uint32 getMaximumDepth(void) const;
+
+          //! Returns the maximum number of live AST nodes, 0 if unbounded.
+          TRITON_EXPORT triton::usize getMaximumNodes(void) const;
+
+          //! Returns the maximum number of symbolic expressions, 0 if unbounded.
+          TRITON_EXPORT triton::usize getMaximumExpressions(void) const;
+
+          //! Returns the policy applied when the budget is exceeded.
+          TRITON_EXPORT triton::engines::symbolic::budget_policy_e getBudgetPolicy(void) const;
+
+          //! Defines the maximum depth of the ASTs of new expressions with AST_DEPTH_LIMIT, at least one, and the policy applied to the deeper ones. By default, 4096 and CONCRETIZE_DEEP_EXPRESSION.
+          TRITON_EXPORT void setDepthLimit(triton::uint32 depth, triton::engines::symbolic::depth_policy_e policy);
+
+          //! Returns the maximum depth of the ASTs of new expressions with AST_DEPTH_LIMIT.
+          TRITON_EXPORT triton::uint32 getDepthLimit(void) const;
+
+          //! Returns the policy applied to the ASTs of new expressions deeper than the depth limit.
+          TRITON_EXPORT triton::engines::symbolic::depth_policy_e getDepthPolicy(void) const;
+
+          //! Returns true if the live AST nodes or the symbolic expressions exceed the budget.
+          TRITON_EXPORT bool isBudgetExceeded(void) const;
+
+          //! Sets the symbolic expressions, the symbolic memory, the aligned memory and the path constraints of `usage`.
+          TRITON_EXPORT void getMemoryUsage(triton::MemoryUsage& usage) const;
+
           //! Returns true if the symbolic execution engine is enabled.
           TRITON_EXPORT bool isEnabled(void) const;
 
@@ -320,6 +631,9 @@ namespace triton {
 
           //! Sets the concrete value of a symbolic variable.
           TRITON_EXPORT void setConcreteVariableValue(const SharedSymbolicVariable& symVar, const triton::uint512& value);
+
+          //! Sets the concrete values of the variables of a model at once. The ASTs are re-evaluated in a single pass over the union of their cones.
+          TRITON_EXPORT void setConcreteVariableValues(const std::unordered_map<triton::usize, triton::engines::solver::SolverModel>& model);
       };
 
     /*! @} End of symbolic namespace */
@@ -50,6 +50,27 @@ namespace triton {
         UNDEFINED_VARIABLE,    //!< Undefined assignment.
       };
 
+      //! Policy applied when the node or expression budget of the symbolic engine is exceeded.
+      enum budget_policy_e {
+        CONCRETIZE_DEEPEST_EXPRESSIONS, //!< Concretize the registers and memory cells holding the deepest ASTs.
+        CONCRETIZE_OLDEST_MEMORY,       //!< Concretize the memory cells holding the oldest expressions.
+        REFUSE_NEW_SYMBOLS,             //!< Refuse new symbolic variables and concretize new expressions.
+      };
+
+      //! Policy applied to the ASTs of new expressions deeper than the depth limit of the symbolic engine.
+      enum depth_policy_e {
+        CONCRETIZE_DEEP_EXPRESSION, //!< Replace the AST by its concrete value.
+        SYMBOLIZE_DEEP_EXPRESSION,  //!< Replace the AST by a fresh symbolic variable whose concrete value is the one of the AST.
+      };
+
+      //! Policy applied when an instruction dereferences a symbolic address.
+      enum pointer_policy_e {
+        CONCRETIZE_POINTER, //!< Use the concrete address, without constraint.
+        CONSTRAIN_POINTER,  //!< Use the concrete address and push the path constraint that the address is the concrete one.
+        FORK_POINTER,       //!< Use the concrete address and push a path constraint with a branch per address the solver finds the pointer may take.
+        SYMBOLIC_POINTER,   //!< Keep the access symbolic as selects and stores of the memory array if its address reaches few enough cells, otherwise constrain it.
+      };
+
     /*! @} End of symbolic namespace */
     };
   /*! @} End of engines namespace */
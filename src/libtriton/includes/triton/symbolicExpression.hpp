@@ -10,6 +10,7 @@
 
 #include <string>
 #include <memory>
+#include <vector>
 
 #include <triton/ast.hpp>
 #include <triton/dllexport.hpp>
@@ -54,8 +55,8 @@ namespace triton {
           //! The root node (AST) of the symbolic expression.
           triton::ast::SharedAbstractNode ast;
 
-          //! The comment of the symbolic expression.
-          std::string comment;
+          //! The comment of the symbolic expression, nullptr if empty. It may be shared by several expressions (see INTERNED_COMMENTS).
+          std::shared_ptr<const std::string> comment;
 
           //! The symbolic expression id. This id is unique.
           triton::usize id;
@@ -66,6 +67,12 @@ namespace triton {
           //! The origin register if `kind` is equal to `triton::engines::symbolic::REG`, `REG_INVALID` otherwise.
           triton::arch::Register originRegister;
 
+          //! The expressions directly referenced by the AST, cached by getReferences().
+          mutable std::vector<std::weak_ptr<SymbolicExpression>> references;
+
+          //! True if `references` is computed for the current AST.
+          mutable bool referencesCached;
+
         public:
           //! True if the symbolic expression is tainted.
           bool isTainted;
@@ -106,6 +113,9 @@ namespace triton {
           //! Returns the comment of the symbolic expression.
           TRITON_EXPORT const std::string& getComment(void) const;
 
+          //! Returns the expressions directly referenced by the AST, without unrolling them. They are computed once and again after setAst().
+          TRITON_EXPORT std::vector<std::shared_ptr<SymbolicExpression>> getReferences(void) const;
+
           //! Returns the id as string of the symbolic expression according the mode of the AST representation.
           TRITON_EXPORT std::string getFormattedId(void) const;
 
@@ -127,6 +137,9 @@ namespace triton {
           //! Sets a comment to the symbolic expression.
           TRITON_EXPORT void setComment(const std::string& comment);
 
+          //! Sets a comment shared with other expressions to the symbolic expression, nullptr if none.
+          TRITON_EXPORT void setComment(const std::shared_ptr<const std::string>& comment);
+
           //! Sets the kind of the symbolic expression.
           TRITON_EXPORT void setType(triton::engines::symbolic::expression_e type);
 
@@ -0,0 +1,142 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_SYMBOLICMEMORY_H
+#define TRITON_SYMBOLICMEMORY_H
+
+#include <memory>
+#include <vector>
+
+#include <triton/dllexport.hpp>
+#include <triton/persistentMap.hpp>
+#include <triton/symbolicExpression.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      /*! \class SymbolicMemory
+       *  \brief The symbolic expressions of memory cells, made of pages shared between copies.
+       *
+       * \description
+       * Each byte of memory has a slot in a page of 4 KB. Pages are allocated when one of their
+       * bytes is assigned and released when all their slots are empty, so that range queries only
+       * look up one page per 4 KB. Copying a memory shares all its pages, and writing to a shared
+       * page copies this page only.
+       */
+      class SymbolicMemory {
+        public:
+          //! The number of stale pages kept by `discard()` before they are released.
+          static const triton::usize stalePages = 64;
+
+          //! The number of bits of the offset in a page.
+          static const triton::uint32 pageBits = 12;
+
+          //! The size of a page (in bytes).
+          static const triton::uint32 pageSize = 1 << pageBits;
+
+        private:
+          //! A page of memory.
+          struct Page {
+            //! The expressions of the bytes of the page.
+            SharedSymbolicExpression slots[pageSize];
+
+            //! The number of non-empty slots.
+            triton::uint32 count = 0;
+          };
+
+          //! Maps a page number to its page.
+          triton::utils::PersistentMap<triton::uint64, std::shared_ptr<Page>, IdentityHash<triton::uint64>> pages;
+
+          //! The number of non-empty slots.
+          triton::usize count;
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT SymbolicMemory();
+
+          //! Returns the expression of the byte at `addr`, nullptr if the byte is concrete.
+          TRITON_EXPORT const SharedSymbolicExpression& get(triton::uint64 addr) const;
+
+          //! Copies the expressions of the `size` bytes from `addr` into `exprs`.
+          TRITON_EXPORT void get(triton::uint64 addr, triton::usize size, SharedSymbolicExpression* exprs) const;
+
+          //! Assigns an expression to the byte at `addr`. The page is copied first if it is shared.
+          TRITON_EXPORT void set(triton::uint64 addr, const SharedSymbolicExpression& expr);
+
+          //! Assigns the `size` expressions of `exprs` to the bytes from `addr`, with one lookup per page crossed. A nullptr makes its byte concrete.
+          TRITON_EXPORT void set(triton::uint64 addr, triton::usize size, const SharedSymbolicExpression* exprs);
+
+          //! Assigns the expressions of the `size` bytes from `src` to the `size` bytes from `dst`, as memmove does. The expressions are shared, not copied.
+          TRITON_EXPORT void copy(triton::uint64 dst, triton::uint64 src, triton::usize size);
+
+          //! Makes the byte at `addr` concrete.
+          TRITON_EXPORT void erase(triton::uint64 addr);
+
+          //! Makes the `size` bytes from `addr` concrete. Pages fully covered are released without being copied.
+          TRITON_EXPORT void erase(triton::uint64 addr, triton::usize size);
+
+          //! Returns true if the expression of a byte in [addr, addr+size) contains symbolic variables.
+          TRITON_EXPORT bool isSymbolized(triton::uint64 addr, triton::usize size) const;
+
+          //! Makes all bytes concrete.
+          TRITON_EXPORT void clear(void);
+
+          //! Makes all bytes concrete in O(1). The pages are released when their page number is written again, or once too many of them are stale.
+          TRITON_EXPORT void discard(void);
+
+          //! Returns the number of bytes with an expression.
+          TRITON_EXPORT triton::usize size(void) const;
+
+          //! Returns the number of pages.
+          TRITON_EXPORT triton::usize getNumberOfPages(void) const;
+
+          //! Returns the number of bytes of the pages.
+          TRITON_EXPORT triton::usize getBytes(void) const;
+
+          //! Calls `visitor(addr, expr)` on each byte with an expression, in no particular order.
+          template <typename F>
+          void forEach(F visitor) const {
+            this->pages.forEach([&visitor](triton::uint64 number, const std::shared_ptr<Page>& page) {
+              for (triton::uint32 offset = 0; offset < pageSize; offset++) {
+                if (page->slots[offset])
+                  visitor((number << pageBits) | offset, page->slots[offset]);
+              }
+            });
+          }
+      };
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SYMBOLICMEMORY_H */
@@ -8,9 +8,17 @@
 #ifndef TRITON_SYMBOLICSIMPLIFICATION_H
 #define TRITON_SYMBOLICSIMPLIFICATION_H
 
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include <triton/ast.hpp>
 #include <triton/callbacks.hpp>
 #include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
 
 
 
@@ -37,16 +45,99 @@ namespace triton {
      *  @{
      */
 
+      //! A native rule of simplification. Returns the rewritten node, or `node` itself if it does not apply.
+      using SimplificationRule = std::function<triton::ast::SharedAbstractNode(const triton::ast::SharedAbstractNode& node)>;
+
+      /*! \struct SimplificationPassStatistics
+       *  \brief The statistics of a simplification pass. */
+      struct SimplificationPassStatistics {
+        //! The number of nodes given to the pass.
+        triton::usize calls = 0;
+
+        //! The number of nodes rewritten by the pass.
+        triton::usize rewrites = 0;
+      };
+
       //! \class SymbolicSimplification
-      /*! \brief The symbolic simplification class */
+      /*! \brief The symbolic simplification class
+       *
+       * \description
+       * Each node is rewritten by the native passes, in their order, then by the SYMBOLIC_SIMPLIFICATION
+       * callbacks, until its hash stops changing or the bound of iterations is reached. The results are
+       * memoized by node with their hash and the version of the passes and callbacks, so that a subtree
+       * already simplified and unchanged since is neither rewritten again nor walked.
+       */
       class SymbolicSimplification {
         private:
+          //! A native simplification pass.
+          struct Pass {
+            //! The name of the pass.
+            std::string name;
+
+            //! The order of the pass, the lowest first.
+            triton::sint32 order;
+
+            //! The rule of the pass.
+            triton::engines::symbolic::SimplificationRule rule;
+          };
+
+          //! A memoized simplification, keyed by its original node.
+          struct Memo {
+            //! The original node, to detect a new node at the same address.
+            std::weak_ptr<triton::ast::AbstractNode> node;
+
+            //! The simplified node.
+            std::weak_ptr<triton::ast::AbstractNode> result;
+
+            //! The hash of the original node.
+            triton::uint128 hash;
+
+            //! The hash of the simplified node when it was memoized.
+            triton::uint128 resultHash;
+
+            //! The version of the passes and callbacks.
+            triton::usize version;
+          };
+
           //! Callbacks API
           triton::callbacks::Callbacks* callbacks;
 
+          //! The native passes, sorted by order then by registration.
+          std::vector<Pass> passes;
+
+          //! The version of the passes, bumped on each change.
+          triton::usize passesVersion;
+
+          //! The maximum number of rewritings of a node.
+          triton::uint32 maxIterations;
+
+          //! The memoized simplifications.
+          mutable std::unordered_map<const triton::ast::AbstractNode*, Memo> memo;
+
+          //! The size of the memo from which its expired entries are removed.
+          mutable triton::usize memoLimit;
+
+          //! The statistics of the passes, by name.
+          mutable std::map<std::string, triton::engines::symbolic::SimplificationPassStatistics> passStatistics;
+
+          //! The number of nodes found in the memo.
+          mutable triton::usize memoHits;
+
           //! Copies a SymbolicSimplification.
           void copy(const SymbolicSimplification& other);
 
+          //! Returns the version of the passes and callbacks, which the memo must match.
+          triton::usize getVersion(void) const;
+
+          //! Returns the memoized simplification of `node`, nullptr if there is none.
+          triton::ast::SharedAbstractNode findMemo(const triton::ast::SharedAbstractNode& node, triton::usize version) const;
+
+          //! Memoizes `result` as the simplification of `node`.
+          void addMemo(const triton::ast::SharedAbstractNode& node, const triton::ast::SharedAbstractNode& result, triton::usize version) const;
+
+          //! Rewrites `node` with the passes and the callbacks up to a fixed point.
+          triton::ast::SharedAbstractNode rewrite(const triton::ast::SharedAbstractNode& node) const;
+
         public:
           //! Constructor.
           TRITON_EXPORT SymbolicSimplification(triton::callbacks::Callbacks* callbacks=nullptr);
@@ -57,6 +148,33 @@ namespace triton {
           //! Processes all recorded simplifications. Returns the simplified node.
           TRITON_EXPORT triton::ast::SharedAbstractNode simplify(const triton::ast::SharedAbstractNode& node) const;
 
+          //! Adds the native pass `name`, applied before the passes of a greater `order` and the callbacks. Replaces the pass of the same name.
+          TRITON_EXPORT void addSimplificationPass(const std::string& name, const triton::engines::symbolic::SimplificationRule& rule, triton::sint32 order=0);
+
+          //! Adds the pass `name` of the library of `SimplificationPasses`, at its default order.
+          TRITON_EXPORT void addSimplificationPass(const std::string& name);
+
+          //! Removes the native pass `name`.
+          TRITON_EXPORT void removeSimplificationPass(const std::string& name);
+
+          //! Returns the names of the native passes, in their order.
+          TRITON_EXPORT std::vector<std::string> getSimplificationPasses(void) const;
+
+          //! Sets the maximum number of rewritings of a node (16 by default), at least 1.
+          TRITON_EXPORT void setSimplificationIterations(triton::uint32 iterations);
+
+          //! Returns the maximum number of rewritings of a node.
+          TRITON_EXPORT triton::uint32 getSimplificationIterations(void) const;
+
+          //! Returns the statistics of the native passes, by name.
+          TRITON_EXPORT const std::map<std::string, triton::engines::symbolic::SimplificationPassStatistics>& getSimplificationPassStatistics(void) const;
+
+          //! Returns the number of nodes whose simplification was found in the memo.
+          TRITON_EXPORT triton::usize getSimplificationMemoHits(void) const;
+
+          //! Removes the memoized simplifications and resets the statistics.
+          TRITON_EXPORT void clearSimplificationMemo(void);
+
           //! Copies a SymbolicSimplification.
           TRITON_EXPORT SymbolicSimplification& operator=(const SymbolicSimplification& other);
       };
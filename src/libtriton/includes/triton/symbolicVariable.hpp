@@ -61,8 +61,8 @@ namespace triton {
           //! The comment of the symbolic variable.
           std::string comment;
 
-          //! The name of the symbolic variable. Names are always something like this: SymVar_X. \sa TRITON_SYMVAR_NAME
-          std::string name;
+          //! The name of the symbolic variable. Names are always something like this: SymVar_X. \sa TRITON_SYMVAR_NAME. Formatted from the id on first use.
+          mutable std::string name;
 
           //! The id of the symbolic variable. This id is unique.
           triton::usize id;
@@ -0,0 +1,130 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_SYNTHESISCACHE_H
+#define TRITON_SYNTHESISCACHE_H
+
+#include <istream>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/astContext.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Synthesis namespace
+    namespace synthesis {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup synthesis
+     *  @{
+     */
+
+      //! \class SynthesisCache
+      /*! \brief The cache of the synthesized nodes, which may be saved and loaded across runs.
+       *
+       * \description
+       * A node is keyed by a structural hash in which its variables are renamed in the order they are met (the
+       * canonical variables), so that a node synthesized once is looked up whatever its variables are. The cache
+       * also records the nodes which cannot be synthesized. A hit returns a copy of the output whose variables are
+       * the ones of the node looked up.
+       *
+       * The cache is saved as an index (the keys and the sizes of the canonical variables) followed by the outputs
+       * in the binary AST format (see `triton::ast::AstSerializer`). The variables of the outputs are saved as
+       * placeholder variables, whose identifiers are above `PLACEHOLDER_ID`, so that they do not clash with the
+       * variables of the context where the cache is loaded.
+       */
+      class SynthesisCache {
+        private:
+          //! \struct Entry
+          /*! \brief A synthesized node. */
+          struct Entry {
+            //! The output, nullptr if the node cannot be synthesized.
+            triton::ast::SharedAbstractNode output;
+
+            //! The names of the canonical variables in the output.
+            std::vector<std::string> names;
+
+            //! The sizes of the canonical variables.
+            std::vector<triton::uint32> sizes;
+          };
+
+          //! The AST context of the outputs.
+          triton::ast::SharedAstContext ctxt;
+
+          //! The entries by key.
+          std::map<triton::uint128, Entry> entries;
+
+          //! Returns a copy of `output` whose variables named in `mapping` are replaced.
+          triton::ast::SharedAbstractNode instantiate(const triton::ast::SharedAbstractNode& output, const std::map<std::string, triton::ast::SharedAbstractNode>& mapping) const;
+
+          //! Returns the placeholder of the canonical variable `index` of `size` bits.
+          triton::ast::SharedAbstractNode placeholder(triton::usize index, triton::uint32 size) const;
+
+        public:
+          //! The identifier of the first placeholder variable, the identifier of a placeholder also holds its index and its size.
+          static const triton::usize PLACEHOLDER_ID = static_cast<triton::usize>(1) << (sizeof(triton::usize) * 8 - 1);
+
+          //! The version of the format.
+          static const triton::uint32 version = 2;
+
+          //! Constructor.
+          TRITON_EXPORT SynthesisCache(const triton::ast::SharedAstContext& ctxt);
+
+          //! Returns the key of `node` for the synthesis `options`. The canonical variables of `node` are returned in `variables`.
+          TRITON_EXPORT static triton::uint128 getKey(const triton::ast::SharedAbstractNode& node, triton::uint64 options, std::vector<triton::ast::SharedAbstractNode>& variables);
+
+          //! Returns true if `key` is cached. `output` is the output on the canonical `variables`, nullptr if the node cannot be synthesized.
+          TRITON_EXPORT bool find(triton::uint128 key, const std::vector<triton::ast::SharedAbstractNode>& variables, triton::ast::SharedAbstractNode& output) const;
+
+          //! Caches the `output` of the node of `key`, nullptr if it cannot be synthesized. An output with variables which are not in `variables` is not cached.
+          TRITON_EXPORT void insert(triton::uint128 key, const std::vector<triton::ast::SharedAbstractNode>& variables, const triton::ast::SharedAbstractNode& output);
+
+          //! Writes the cache into `stream`.
+          TRITON_EXPORT void save(std::ostream& stream) const;
+
+          //! Reads a cache written by `save()` from `stream`, its entries are added to the cache.
+          TRITON_EXPORT void load(std::istream& stream);
+
+          //! Removes all entries.
+          TRITON_EXPORT void clear(void);
+
+          //! Returns the number of entries.
+          TRITON_EXPORT triton::usize size(void) const;
+
+          //! Returns an estimation of the number of bytes of the entries. The outputs they keep alive and the names of their variables are not counted.
+          TRITON_EXPORT triton::usize getBytes(void) const;
+      };
+
+    /*! @} End of synthesis namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SYNTHESISCACHE_H */
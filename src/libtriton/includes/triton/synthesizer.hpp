@@ -11,13 +11,16 @@
 #include <array>
 #include <deque>
 #include <map>
+#include <unordered_map>
 
 #include <triton/astContext.hpp>
 #include <triton/dllexport.hpp>
 #include <triton/oracleEntry.hpp>
 #include <triton/solverEngine.hpp>
 #include <triton/symbolicEngine.hpp>
+#include <triton/synthesisCache.hpp>
 #include <triton/synthesisResult.hpp>
+#include <triton/termBank.hpp>
 #include <triton/tritonTypes.hpp>
 
 
@@ -53,11 +56,11 @@ namespace triton {
        *  @{
        */
 
-        //! The oracle table for unary operators. Each entry is a UnaryEntry object.
-        extern std::map<triton::ast::ast_e, std::array<UnaryEntry, 40>> unopTable;
+        //! The oracle tables for unary operators, by bit width. Each table is an UnaryOracleTable object.
+        extern const std::array<UnaryOracleTable, 4> unopTable;
 
-        //! The oracle table for binary operators. Each entry is a BinaryEntry object.
-        extern std::map<triton::ast::ast_e, std::array<BinaryEntry, 40>> binopTable;
+        //! The oracle tables for binary operators, by bit width. Each table is a BinaryOracleTable object.
+        extern const std::array<BinaryOracleTable, 4> binopTable;
 
       /*! @} End of oracle namespace */
       };
@@ -66,8 +69,24 @@ namespace triton {
       /*! \brief The Synthesizer engine class. */
       class Synthesizer {
         private:
+          //! \struct Lookup
+          /*! \brief The oracles of a node looked up in parallel (see `parallelOracles()`). */
+          struct Lookup {
+            //! The node, which is not kept alive.
+            triton::ast::WeakAbstractNode node;
+
+            //! The operator of the unary or binary oracle, INVALID_NODE if there is none.
+            triton::ast::ast_e op;
+
+            //! True if a term of the bank is equivalent to the node.
+            bool enumerated;
+
+            //! The term of the bank.
+            triton::usize term;
+          };
+
           //! Map of subexpr hash to their new symbolic variable
-          std::map<triton::uint512, triton::ast::SharedAbstractNode> hash2var;
+          std::map<triton::uint128, triton::ast::SharedAbstractNode> hash2var;
 
           //! Map of symbolic variables to their synthesized node
           std::map<triton::ast::SharedAbstractNode, triton::ast::SharedAbstractNode> var2expr;
@@ -78,20 +97,44 @@ namespace triton {
           //! An instance of a symbolic engine to create symbolic variable
           triton::engines::symbolic::SymbolicEngine* symbolic;
 
+          //! The cache of the synthesized nodes, consulted before the oracles if not null
+          triton::engines::synthesis::SynthesisCache* cache;
+
+          //! The oracles looked up in parallel by node (see `parallelOracles()`).
+          std::unordered_map<const triton::ast::AbstractNode*, Lookup> oracles;
+
+          //! Returns the options of the synthesis which are part of the key of a node in the cache
+          static triton::uint64 getCacheOptions(bool constant, bool opaque, bool subexpr, bool root);
+
           //! Synthesize a given node that contains one variable (constant synthesizing)
           bool constantSynthesis(const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node, SynthesisResult& result);
 
           //! Synthesize a given node that two variables (opaque constant synthesizing)
           bool opaqueConstantSynthesis(const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node, SynthesisResult& result);
 
+          //! Looks up the operator of a given node that contains one variable in the oracles. Only reads the node.
+          static bool unaryOperatorOracle(const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node, triton::ast::ast_e& op);
+
+          //! Looks up the operator of a given node that contains two variables in the oracles. Only reads the node.
+          static bool binaryOperatorOracle(const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node, triton::ast::ast_e& op);
+
+          //! Looks up a term equivalent to a given node that contains up to three variables in the term bank. Only reads the node.
+          static bool enumerativeOracle(const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node, triton::usize& term);
+
+          //! Looks up the oracles of the children of a given node on a pool of threads, the results are kept in `oracles`
+          void parallelOracles(const triton::ast::SharedAbstractNode& node);
+
           //! Synthesize a given node that contains one variable with one operator
           bool unaryOperatorSynthesis(const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node, SynthesisResult& result);
 
           //! Synthesize a given node that contains two variables with one operator
           bool binaryOperatorSynthesis(const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node, SynthesisResult& result);
 
+          //! Synthesize a given node that contains up to three variables with the smallest term equivalent to it
+          bool enumerativeSynthesis(const std::deque<triton::ast::SharedAbstractNode>& vars, const triton::ast::SharedAbstractNode& node, SynthesisResult& result);
+
           //! Synthesize children expression
-          bool childrenSynthesis(const triton::ast::SharedAbstractNode& node, bool constant, bool opaque, SynthesisResult& result);
+          bool childrenSynthesis(const triton::ast::SharedAbstractNode& node, bool constant, bool opaque, bool parallel, SynthesisResult& result);
 
           //! Do the synthesis
           bool do_synthesize(const triton::ast::SharedAbstractNode& node, bool constant, bool opaque, SynthesisResult& result);
@@ -104,10 +147,10 @@ namespace triton {
 
         public:
           //! Constructor.
-          TRITON_EXPORT Synthesizer(triton::engines::symbolic::SymbolicEngine* symbolic);
+          TRITON_EXPORT Synthesizer(triton::engines::symbolic::SymbolicEngine* symbolic, triton::engines::synthesis::SynthesisCache* cache=nullptr);
 
-          //! Synthesizes a given node. If `constant` is true, perform a constant synthesis. If `opaque` is true, perform opaque constant synthesis. If `subexpr` is true, analyze children AST.
-          TRITON_EXPORT SynthesisResult synthesize(const triton::ast::SharedAbstractNode& node, bool constant=true, bool subexpr=true, bool opaque=false);
+          //! Synthesizes a given node. If `constant` is true, perform a constant synthesis. If `opaque` is true, perform opaque constant synthesis. If `subexpr` is true, analyze children AST. If `parallel` is true, the oracles of the children are looked up on all cores.
+          TRITON_EXPORT SynthesisResult synthesize(const triton::ast::SharedAbstractNode& node, bool constant=true, bool subexpr=true, bool opaque=false, bool parallel=false);
       };
 
     /*! @} End of synthesis namespace */
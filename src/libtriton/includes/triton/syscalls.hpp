@@ -0,0 +1,191 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_SYSCALLS_HPP
+#define TRITON_SYSCALLS_HPP
+
+#include <array>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <triton/archEnums.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/instruction.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  class API;
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    /*! \struct Syscall
+     *  \brief A syscall, read from the registers of the calling convention of Linux. */
+    struct Syscall {
+      //! The number of the syscall.
+      triton::uint64 number = 0;
+
+      //! The arguments of the syscall.
+      std::array<triton::uint64, 6> args = {};
+
+      //! The return value, set by the handler (a negative errno on failure).
+      triton::uint64 ret = 0;
+
+      //! Set by the handler to end the program. The return value is then its exit status, and no register is written.
+      bool exit = false;
+    };
+
+    //! A handler of a syscall. It reads the arguments of `call`, updates the memory through `api` and sets the return value of `call`.
+    using SyscallHandler = std::function<void(triton::API& api, triton::arch::Syscall& call)>;
+
+
+    /*! \class Syscalls
+     *  \brief The built-in Linux syscalls of the emulation, executed instead of returning to the caller of `API::emulate()`.
+     *
+     * \description
+     * A syscall instruction (`syscall` on x86-64, `svc` on AArch64) is executed by the handler bound to
+     * its number, a handler given by the user first, otherwise a built-in one: `read`, `write`, `open`,
+     * `openat`, `close`, `fstat`, `mmap`, `brk`, `exit` and `exit_group`. The files are kept in memory
+     * by path, the descriptors 0, 1 and 2 are opened on `/dev/stdin`, `/dev/stdout` and `/dev/stderr`.
+     * The bytes read from a file defined with `symbolize` are symbolized at once, the other ones are
+     * concretized. The program break and the mappings grow from the addresses of `setLayout()`, the
+     * mappings are never reused.
+     */
+    class Syscalls {
+      private:
+        //! The built-in syscalls.
+        enum syscall_e {
+          SYSCALL_BRK,        //!< void* brk(void* addr)
+          SYSCALL_CLOSE,      //!< int close(int fd)
+          SYSCALL_EXIT,       //!< void exit(int status), and exit_group
+          SYSCALL_FSTAT,      //!< int fstat(int fd, struct stat* buf)
+          SYSCALL_MMAP,       //!< void* mmap(void* addr, size_t length, int prot, int flags, int fd, off_t offset)
+          SYSCALL_OPEN,       //!< int open(const char* path, int flags, mode_t mode)
+          SYSCALL_OPENAT,     //!< int openat(int dirfd, const char* path, int flags, mode_t mode)
+          SYSCALL_READ,       //!< ssize_t read(int fd, void* buf, size_t count)
+          SYSCALL_WRITE,      //!< ssize_t write(int fd, const void* buf, size_t count)
+        };
+
+        //! A file kept in memory.
+        struct File {
+          //! The content of the file.
+          std::vector<triton::uint8> content;
+
+          //! True if the bytes read from the file are symbolized.
+          bool symbolize;
+        };
+
+        //! An opened file.
+        struct Descriptor {
+          //! The path of the file.
+          std::string path;
+
+          //! The offset of the next read or write.
+          triton::uint64 offset;
+
+          //! True if the writes append to the file.
+          bool append;
+        };
+
+        //! The handlers given by the user, by number.
+        std::map<triton::uint64, triton::arch::SyscallHandler> handlers;
+
+        //! The files, by path.
+        std::map<std::string, File> files;
+
+        //! The opened files, by descriptor.
+        std::map<triton::uint64, Descriptor> descriptors;
+
+        //! The start of the heap.
+        triton::uint64 heap;
+
+        //! The program break.
+        triton::uint64 programBreak;
+
+        //! The address of the next mapping.
+        triton::uint64 nextMapping;
+
+        //! Returns the built-in syscalls of `arch`, by number.
+        static const std::map<triton::uint64, syscall_e>& getBuiltins(triton::arch::architecture_e arch);
+
+        //! Returns the descriptor of `fd`, nullptr if it is not opened.
+        Descriptor* getDescriptor(triton::uint64 fd);
+
+        //! Returns the C string at `addr`.
+        std::string getString(triton::API& api, triton::uint64 addr) const;
+
+        //! Writes `content` at `addr`, symbolized or concretized.
+        void load(triton::API& api, triton::uint64 addr, const triton::uint8* content, triton::usize size, bool symbolize) const;
+
+        //! The brk syscall.
+        triton::uint64 brkSyscall(triton::API& api, triton::arch::Syscall& call);
+
+        //! The close syscall.
+        triton::uint64 closeSyscall(triton::API& api, triton::arch::Syscall& call);
+
+        //! The fstat syscall.
+        triton::uint64 fstatSyscall(triton::API& api, triton::arch::Syscall& call);
+
+        //! The mmap syscall.
+        triton::uint64 mmapSyscall(triton::API& api, triton::arch::Syscall& call);
+
+        //! The open and openat syscalls, `path` being the index of the argument of the path.
+        triton::uint64 openSyscall(triton::API& api, triton::arch::Syscall& call, triton::uint32 path);
+
+        //! The read syscall.
+        triton::uint64 readSyscall(triton::API& api, triton::arch::Syscall& call);
+
+        //! The write syscall.
+        triton::uint64 writeSyscall(triton::API& api, triton::arch::Syscall& call);
+
+      public:
+        //! Constructor.
+        TRITON_EXPORT Syscalls();
+
+        //! Returns true if `inst` is a syscall instruction of `arch`.
+        TRITON_EXPORT static bool isSyscall(const triton::arch::Instruction& inst, triton::arch::architecture_e arch);
+
+        //! Binds `handler` to the syscall `number`, instead of its built-in handler if it has one.
+        TRITON_EXPORT void setHandler(triton::uint64 number, const triton::arch::SyscallHandler& handler);
+
+        //! Removes the handler bound to the syscall `number`.
+        TRITON_EXPORT void removeHandler(triton::uint64 number);
+
+        //! Defines the content of the file `path`. If `symbolize` is true, the bytes read from it are symbolized.
+        TRITON_EXPORT void setFile(const std::string& path, const std::vector<triton::uint8>& content, bool symbolize=false);
+
+        //! Returns the content of the file `path`.
+        TRITON_EXPORT const std::vector<triton::uint8>& getFile(const std::string& path) const;
+
+        //! Defines the start of the heap and the address of the first mapping. By default, 0x10000000 and 0x7f0000000000.
+        TRITON_EXPORT void setLayout(triton::uint64 heap, triton::uint64 mmap);
+
+        //! Executes the syscall whose instruction was just processed. Returns false, and changes nothing, if it has no handler.
+        TRITON_EXPORT bool execute(triton::API& api, triton::arch::Syscall& call);
+    };
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SYSCALLS_HPP */
@@ -8,13 +8,21 @@
 #ifndef TRITON_TAINTENGINE_H
 #define TRITON_TAINTENGINE_H
 
+#include <unordered_map>
 #include <unordered_set>
 
+#include <triton/astEnums.hpp>
 #include <triton/dllexport.hpp>
 #include <triton/memoryAccess.hpp>
+#include <triton/memoryUsage.hpp>
 #include <triton/modes.hpp>
+#include <triton/persistentMap.hpp>
+#include <triton/processingStatistics.hpp>
 #include <triton/register.hpp>
 #include <triton/symbolicEngine.hpp>
+#include <triton/taintLabels.hpp>
+#include <triton/taintMemory.hpp>
+#include <triton/taintRegisters.hpp>
 #include <triton/tritonTypes.hpp>
 
 
@@ -61,15 +69,42 @@ namespace triton {
           //! Cpu API
           triton::arch::CpuInterface& cpu;
 
+          //! The statistics of the processing, null if none.
+          triton::arch::ProcessingStatistics* statistics;
+
         protected:
           //! Defines if the taint engine is enabled or disabled.
           bool enableFlag;
 
-          //! The set of tainted addresses.
-          std::unordered_set<triton::uint64> taintedMemory;
+          //! The tainted addresses.
+          triton::engines::taint::TaintMemory taintedMemory;
+
+          //! The set of tainted parent registers. Currently it is an over approximation of the taint.
+          triton::engines::taint::TaintRegisters taintedRegisters;
+
+          //! The labels of the tainted registers which have some.
+          triton::utils::PersistentMap<triton::arch::register_e, TaintLabels, IdentityHash<triton::arch::register_e>> taintedRegisterLabels;
+
+          //! The tainted bits of the tainted parent registers of 64 bits or less which are partially tainted (`TAINT_BIT_PRECISE`). A tainted parent without an entry is fully tainted.
+          triton::utils::PersistentMap<triton::arch::register_e, triton::uint64, IdentityHash<triton::arch::register_e>> taintedRegisterBits;
+
+          //! The tainted registers of a thread other than the current one.
+          struct ThreadRegisters {
+            //! The tainted registers.
+            triton::engines::taint::TaintRegisters taintedRegisters;
 
-          //! The set of tainted registers. Currently it is an over approximation of the taint.
-          std::unordered_set<triton::arch::register_e> taintedRegisters;
+            //! The labels of the tainted registers.
+            triton::utils::PersistentMap<triton::arch::register_e, TaintLabels, IdentityHash<triton::arch::register_e>> taintedRegisterLabels;
+
+            //! The tainted bits of the partially tainted registers.
+            triton::utils::PersistentMap<triton::arch::register_e, triton::uint64, IdentityHash<triton::arch::register_e>> taintedRegisterBits;
+          };
+
+          //! The tainted registers of the threads other than the current one, by thread id.
+          std::unordered_map<triton::uint32, ThreadRegisters> threads;
+
+          //! The id of the thread whose tainted registers are the current ones.
+          triton::uint32 thread;
 
         public:
           //! Constructor.
@@ -81,18 +116,51 @@ namespace triton {
           //! Copies a TaintEngine.
           TRITON_EXPORT TaintEngine& operator=(const TaintEngine& other);
 
+          //! Copies the taint state of another engine. The state is shared until written. The CPU and the symbolic engine of the engine are kept.
+          TRITON_EXPORT void copyState(const TaintEngine& other);
+
+          //! Switches the tainted registers to the ones of the thread `tid`, the tainted memory is shared by all the threads. A new thread starts with a copy of the current ones.
+          TRITON_EXPORT void setThread(triton::uint32 tid);
+
+          //! Removes the tainted registers of the thread `tid`, which must not be the current one.
+          TRITON_EXPORT void removeThread(triton::uint32 tid);
+
           //! Enables or disables the taint engine.
           TRITON_EXPORT void enable(bool flag);
 
+          //! Times the spread of the taint into `statistics`, which may be null.
+          TRITON_EXPORT void setStatistics(triton::arch::ProcessingStatistics* statistics);
+
           //! Returns the tainted addresses.
-          TRITON_EXPORT const std::unordered_set<triton::uint64>& getTaintedMemory(void) const;
+          TRITON_EXPORT std::unordered_set<triton::uint64> getTaintedMemory(void) const;
+
+          //! Calls `visitor(addr)` on each tainted address, without building a set. The taint engine must not be modified meanwhile.
+          template <typename F>
+          void forEachTaintedMemory(F visitor) const {
+            this->taintedMemory.forEach(visitor);
+          }
 
           //! Returns the tainted registers.
           TRITON_EXPORT std::unordered_set<const triton::arch::Register*> getTaintedRegisters(void) const;
 
+          //! Sets the tainted memory and the tainted registers of `usage`.
+          TRITON_EXPORT void getMemoryUsage(triton::MemoryUsage& usage) const;
+
           //! Returns true if the taint engine is enabled.
           TRITON_EXPORT bool isEnabled(void) const;
 
+          //! Returns true if neither memory nor registers are tainted.
+          TRITON_EXPORT bool isEmpty(void) const;
+
+          //! Returns the union of the labels of the address:size.
+          TRITON_EXPORT TaintLabels getMemoryTaintLabels(triton::uint64 addr, triton::uint32 size=1) const;
+
+          //! Returns the union of the labels of the memory, and of its pointer registers if `mode` is true and `TAINT_THROUGH_POINTERS` is enabled.
+          TRITON_EXPORT TaintLabels getMemoryTaintLabels(const triton::arch::MemoryAccess& mem, bool mode=true) const;
+
+          //! Returns the labels of the register.
+          TRITON_EXPORT TaintLabels getRegisterTaintLabels(const triton::arch::Register& reg) const;
+
           //! Returns true if the addr is tainted.
           TRITON_EXPORT bool isMemoryTainted(triton::uint64 addr, triton::uint32 size=1) const;
 
@@ -102,6 +170,9 @@ namespace triton {
           //! Returns true if the register is tainted.
           TRITON_EXPORT bool isRegisterTainted(const triton::arch::Register& reg) const;
 
+          //! Returns the tainted bits of a register, from its lowest bit. All the bits of a tainted register are tainted without `TAINT_BIT_PRECISE` or if its parent has more than 64 bits.
+          TRITON_EXPORT triton::uint64 getRegisterTaintBits(const triton::arch::Register& reg) const;
+
           //! Abstract taint verification. Returns true if the operand is tainted.
           TRITON_EXPORT bool isTainted(const triton::arch::OperandWrapper& op) const;
 
@@ -120,9 +191,21 @@ namespace triton {
           //! Taints a memory. Returns TAINTED if the memory has been tainted correctly. Otherwise it returns the last defined state.
           TRITON_EXPORT bool taintMemory(const triton::arch::MemoryAccess& mem);
 
+          //! Taints an address with a label, added to its labels. Returns TAINTED if the address has been tainted correctly. Otherwise it returns the last defined state.
+          TRITON_EXPORT bool taintMemory(triton::uint64 addr, triton::uint32 label);
+
+          //! Taints a memory with a label, added to its labels. Returns TAINTED if the memory has been tainted correctly. Otherwise it returns the last defined state.
+          TRITON_EXPORT bool taintMemory(const triton::arch::MemoryAccess& mem, triton::uint32 label);
+
           //! Taints a register. Returns TAINTED if the register has been tainted correctly. Otherwise it returns the last defined state.
           TRITON_EXPORT bool taintRegister(const triton::arch::Register& reg);
 
+          //! Taints a register with a label, added to its labels. Returns TAINTED if the register has been tainted correctly. Otherwise it returns the last defined state.
+          TRITON_EXPORT bool taintRegister(const triton::arch::Register& reg, triton::uint32 label);
+
+          //! Sets the tainted bits of a register, from its lowest bit, the other bits of its parent are kept. Without `TAINT_BIT_PRECISE` or if its parent has more than 64 bits, the register is tainted if a bit is. Returns true if a bit is tainted.
+          TRITON_EXPORT bool setRegisterTaintBits(const triton::arch::Register& reg, triton::uint64 bits);
+
           //! Untaints an address. Returns !TAINTED if the address has been untainted correctly. Otherwise it returns the last defined state.
           TRITON_EXPORT bool untaintMemory(triton::uint64 addr);
 
@@ -174,7 +257,40 @@ namespace triton {
           //! Taints RegisterRegister with assignment. Returns true if the regDst is tainted.
           TRITON_EXPORT bool taintAssignment(const triton::arch::Register& regDst, const triton::arch::Register& regSrc);
 
+          //! Spreads the taint of `dst = dst & src` (`op` is `BVAND_NODE`) or `dst = dst | src` (`op` is `BVOR_NODE`) bit by bit, `dstValue` and `srcValue` being the concrete values of the operands: a bit cleared by an untainted `and` operand or set by an untainted `or` operand is untainted. Same as `taintUnion()` without `TAINT_BIT_PRECISE` or if `dst` is not a register of 64 bits or less. Returns true if `dst` is tainted.
+          TRITON_EXPORT bool taintBitwise(triton::ast::ast_e op, const triton::arch::OperandWrapper& dst, const triton::arch::OperandWrapper& src, triton::uint64 dstValue, triton::uint64 srcValue);
+
+          //! Spreads the taint of a shift or a rotation of `dst` by `count` bits (`op` is `BVSHL_NODE`, `BVLSHR_NODE`, `BVASHR_NODE`, `BVROL_NODE` or `BVROR_NODE`), `count` being the concrete value of `src` masked by the instruction. A tainted `src` taints the whole `dst`. Same as `taintUnion()` without `TAINT_BIT_PRECISE` or if `dst` is not a register of 64 bits or less. Returns true if `dst` is tainted.
+          TRITON_EXPORT bool taintShift(triton::ast::ast_e op, const triton::arch::OperandWrapper& dst, const triton::arch::OperandWrapper& src, triton::uint32 count);
+
         private:
+          //! Returns true if the taint of the register is tracked bit by bit.
+          bool isBitPrecise(const triton::arch::Register& reg) const;
+
+          //! Returns the mask of the bits of the parent of a register.
+          triton::uint64 getParentMask(const triton::arch::Register& reg) const;
+
+          //! Returns the tainted bits of the parent of a register.
+          triton::uint64 getParentTaintBits(const triton::arch::Register& reg) const;
+
+          //! Replaces the tainted bits of the parent of a register, its labels are removed if none is left.
+          void setParentTaintBits(const triton::arch::Register& reg, triton::uint64 bits);
+
+          //! Returns the tainted bits of the first 64 bits of an operand, all of them if it is a tainted register of more than 64 bits or a memory through a tainted pointer.
+          triton::uint64 getOperandTaintBits(const triton::arch::OperandWrapper& op) const;
+
+          //! Extends the tainted bits of a `srcSize` bits value read into `dstSize` bits: the upper bits take the taint of its sign bit.
+          triton::uint64 extendTaintBits(triton::uint64 bits, triton::uint32 srcSize, triton::uint32 dstSize) const;
+
+          //! Returns true if an item has a label.
+          bool hasLabels(void) const;
+
+          //! Replaces the labels of a tainted register.
+          void setRegisterLabels(const triton::arch::Register& reg, const TaintLabels& labels);
+
+          //! Adds labels to a tainted register.
+          void addRegisterLabels(const triton::arch::Register& reg, const TaintLabels& labels);
+
           //! Spreads MemoryImmediate with union.
           bool unionMemoryImmediate(const triton::arch::MemoryAccess& memDst);
 
@@ -0,0 +1,99 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_TAINTLABELS_H
+#define TRITON_TAINTLABELS_H
+
+#include <memory>
+#include <vector>
+
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Taint namespace
+    namespace taint {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup taint
+     *  @{
+     */
+
+      /*! \class TaintLabels
+       *  \brief A set of taint labels, which tells from which sources a tainted item comes.
+       *
+       * \description
+       * The labels below 64 are the bits of an inline mask, so that most sets are a word. The
+       * other labels are kept in a sorted vector which is never modified once built: copies and
+       * merges share it, and a merge only builds a new vector if none of its operands holds the
+       * result.
+       */
+      class TaintLabels {
+        public:
+          //! The number of labels held by the inline mask.
+          static const triton::uint32 inlineLabels = 64;
+
+        private:
+          //! The labels below `inlineLabels`.
+          triton::uint64 mask;
+
+          //! The sorted labels from `inlineLabels`, nullptr if there is none.
+          std::shared_ptr<const std::vector<triton::uint32>> large;
+
+        public:
+          //! Constructor of an empty set.
+          TRITON_EXPORT TaintLabels();
+
+          //! Constructor of the set of one label.
+          TRITON_EXPORT explicit TaintLabels(triton::uint32 label);
+
+          //! Returns true if the set has no label.
+          TRITON_EXPORT bool empty(void) const;
+
+          //! Returns true if the set holds `label`.
+          TRITON_EXPORT bool contains(triton::uint32 label) const;
+
+          //! Returns the number of labels.
+          TRITON_EXPORT triton::usize size(void) const;
+
+          //! Returns the labels, sorted.
+          TRITON_EXPORT std::vector<triton::uint32> getLabels(void) const;
+
+          //! Adds the labels of `other`.
+          TRITON_EXPORT TaintLabels& operator|=(const TaintLabels& other);
+
+          //! Returns true if both sets hold the same labels.
+          TRITON_EXPORT bool operator==(const TaintLabels& other) const;
+
+          //! Returns true if the sets differ.
+          TRITON_EXPORT bool operator!=(const TaintLabels& other) const;
+      };
+
+    /*! @} End of taint namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TAINTLABELS_H */
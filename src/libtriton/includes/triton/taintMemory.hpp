@@ -0,0 +1,167 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_TAINTMEMORY_H
+#define TRITON_TAINTMEMORY_H
+
+#include <memory>
+
+#include <triton/dllexport.hpp>
+#include <triton/persistentMap.hpp>
+#include <triton/taintLabels.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Taint namespace
+    namespace taint {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup taint
+     *  @{
+     */
+
+      /*! \class TaintMemory
+       *  \brief The tainted bytes of memory, as a shadow memory of bit pages shared between copies.
+       *
+       * \description
+       * Each byte of memory has a bit in a page of 4 KB. Pages are allocated when one of their
+       * bytes is tainted and released when none is, so that untouched memory costs nothing. Range
+       * queries and updates work on 64 bits words, one page lookup per 4 KB. Copying a memory
+       * shares all its pages, and writing to a shared page copies this page only. The labels of
+       * the tainted bytes are kept in pages of their own, only allocated once a label is set.
+       */
+      class TaintMemory {
+        public:
+          //! The number of bits of the offset in a page.
+          static const triton::uint32 pageBits = 12;
+
+          //! The size of a page (in bytes).
+          static const triton::uint32 pageSize = 1 << pageBits;
+
+          //! The number of words of a page.
+          static const triton::uint32 pageWords = pageSize / 64;
+
+        private:
+          //! A page of memory.
+          struct Page {
+            //! The taint bits of the bytes of the page, the byte at offset `o` is the bit `o % 64` of the word `o / 64`.
+            triton::uint64 words[pageWords] = {};
+
+            //! The number of tainted bytes.
+            triton::uint32 count = 0;
+          };
+
+          //! A page of labels.
+          struct LabelPage {
+            //! The labels of the bytes of the page.
+            TaintLabels slots[pageSize];
+
+            //! The number of non-empty slots.
+            triton::uint32 count = 0;
+          };
+
+          //! Maps a page number to its page.
+          triton::utils::PersistentMap<triton::uint64, std::shared_ptr<Page>, IdentityHash<triton::uint64>> pages;
+
+          //! Maps a page number to its page of labels.
+          triton::utils::PersistentMap<triton::uint64, std::shared_ptr<LabelPage>, IdentityHash<triton::uint64>> labelPages;
+
+          //! The number of tainted bytes.
+          triton::usize count;
+
+          //! Returns the page of `number`, allocated if missing and copied first if it is shared.
+          Page& detach(triton::uint64 number);
+
+          //! Returns the page of labels of `number`, allocated if missing and copied first if it is shared.
+          LabelPage& detachLabels(triton::uint64 number);
+
+          //! Removes the labels of the `size` bytes from `addr`.
+          void eraseLabels(triton::uint64 addr, triton::usize size);
+
+          //! Returns the bits [first, last] of a word.
+          static triton::uint64 mask(triton::uint32 first, triton::uint32 last);
+
+          //! Returns the number of set bits of a word.
+          static triton::uint32 popcount(triton::uint64 word);
+
+          //! Returns the index of the lowest set bit of a non-zero word.
+          static triton::uint32 lowestBit(triton::uint64 word);
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT TaintMemory();
+
+          //! Returns true if a byte in [addr, addr+size) is tainted.
+          TRITON_EXPORT bool isTainted(triton::uint64 addr, triton::usize size=1) const;
+
+          //! Taints the `size` bytes from `addr`.
+          TRITON_EXPORT void taint(triton::uint64 addr, triton::usize size=1);
+
+          //! Untaints the `size` bytes from `addr` and removes their labels. Pages fully covered are released without being copied.
+          TRITON_EXPORT void untaint(triton::uint64 addr, triton::usize size=1);
+
+          //! Returns the union of the labels of the bytes in [addr, addr+size).
+          TRITON_EXPORT TaintLabels getLabels(triton::uint64 addr, triton::usize size=1) const;
+
+          //! Replaces the labels of the `size` bytes from `addr`. The bytes must be tainted.
+          TRITON_EXPORT void setLabels(triton::uint64 addr, triton::usize size, const TaintLabels& labels);
+
+          //! Adds labels to the `size` bytes from `addr`. The bytes must be tainted.
+          TRITON_EXPORT void addLabels(triton::uint64 addr, triton::usize size, const TaintLabels& labels);
+
+          //! Returns true if a byte has a label.
+          TRITON_EXPORT bool hasLabels(void) const;
+
+          //! Untaints all bytes and removes all labels.
+          TRITON_EXPORT void clear(void);
+
+          //! Returns the number of tainted bytes.
+          TRITON_EXPORT triton::usize size(void) const;
+
+          //! Returns the number of pages.
+          TRITON_EXPORT triton::usize getNumberOfPages(void) const;
+
+          //! Returns the number of bytes of the pages and of the pages of labels.
+          TRITON_EXPORT triton::usize getBytes(void) const;
+
+          //! Calls `visitor(addr)` on each tainted byte, by increasing address in a page but pages in no particular order.
+          template <typename F>
+          void forEach(F visitor) const {
+            this->pages.forEach([&visitor](triton::uint64 number, const std::shared_ptr<Page>& page) {
+              for (triton::uint32 index = 0; index < pageWords; index++) {
+                /* Only the set bits of a word are visited */
+                for (triton::uint64 word = page->words[index]; word; word &= word - 1)
+                  visitor((number << pageBits) | (index * 64 + lowestBit(word)));
+              }
+            });
+          }
+      };
+
+    /*! @} End of taint namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TAINTMEMORY_H */
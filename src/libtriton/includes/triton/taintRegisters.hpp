@@ -0,0 +1,113 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_TAINTREGISTERS_H
+#define TRITON_TAINTREGISTERS_H
+
+#include <triton/archEnums.hpp>
+#include <triton/coreUtils.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Taint namespace
+    namespace taint {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup taint
+     *  @{
+     */
+
+      /*! \class TaintRegisters
+       *  \brief The tainted parent registers, as a fixed bitset over the register ids.
+       *
+       * \description
+       * The register ids are a small dense enum, the register `r` is the bit `r % 64` of the word
+       * `r / 64`. A lookup is a shift and a mask, without hashing nor allocation, and the registers
+       * are visited by scanning the words. Copying the set copies a few words.
+       */
+      class TaintRegisters {
+        public:
+          //! The number of words of the set.
+          static const triton::uint32 words = (triton::arch::ID_REG_LAST_ITEM + 63) / 64;
+
+        private:
+          //! The taint bits of the registers.
+          triton::uint64 bits[words] = {};
+
+          //! Returns the index of the lowest set bit of a non-zero word.
+          static triton::uint32 lowestBit(triton::uint64 word) {
+            /* The bits below the lowest set bit */
+            return triton::utils::popcount((word & (~word + 1)) - 1);
+          }
+
+        public:
+          //! Returns true if `reg` is tainted.
+          bool contains(triton::arch::register_e reg) const {
+            return (this->bits[reg / 64] >> (reg % 64)) & 1;
+          }
+
+          //! Taints `reg`.
+          void insert(triton::arch::register_e reg) {
+            this->bits[reg / 64] |= static_cast<triton::uint64>(1) << (reg % 64);
+          }
+
+          //! Untaints `reg`.
+          void erase(triton::arch::register_e reg) {
+            this->bits[reg / 64] &= ~(static_cast<triton::uint64>(1) << (reg % 64));
+          }
+
+          //! Returns true if no register is tainted.
+          bool empty(void) const {
+            for (triton::uint32 index = 0; index < words; index++) {
+              if (this->bits[index])
+                return false;
+            }
+            return true;
+          }
+
+          //! Returns the number of tainted registers.
+          triton::usize size(void) const {
+            triton::usize count = 0;
+            for (triton::uint32 index = 0; index < words; index++)
+              count += triton::utils::popcount(this->bits[index]);
+            return count;
+          }
+
+          //! Calls `visitor(reg)` on each tainted register, by increasing id.
+          template <typename F>
+          void forEach(F visitor) const {
+            for (triton::uint32 index = 0; index < words; index++) {
+              for (triton::uint64 word = this->bits[index]; word; word &= word - 1)
+                visitor(static_cast<triton::arch::register_e>(index * 64 + lowestBit(word)));
+            }
+          }
+      };
+
+    /*! @} End of taint namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TAINTREGISTERS_H */
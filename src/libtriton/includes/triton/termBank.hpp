@@ -0,0 +1,145 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_TERMBANK_HPP
+#define TRITON_TERMBANK_HPP
+
+#include <array>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/astContext.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Synthesis namespace
+    namespace synthesis {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup synthesis
+     *  @{
+     */
+
+      //! The number of inputs on which the terms of a bank are evaluated.
+      const triton::usize TERM_INPUTS = 32;
+
+      //! The number of other inputs on which a term found is checked.
+      const triton::usize TERM_CHECKS = 64;
+
+      //! The number of variables of the terms.
+      const triton::usize TERM_VARIABLES = 3;
+
+      //! The size (number of operators, variables and constants) of the biggest terms.
+      const triton::uint32 TERM_MAX_SIZE = 5;
+
+      //! The values of a term, one for each input.
+      using TermValues = std::array<triton::uint64, TERM_INPUTS>;
+
+      //! \struct TermValuesHash
+      /*! \brief Hash of the values of a term, used to index the terms by their results. */
+      struct TermValuesHash {
+        //! Returns the hash of `values`.
+        std::size_t operator()(const TermValues& values) const {
+          triton::uint64 hash = 0xcbf29ce484222325;
+
+          for (triton::uint64 value : values)
+            hash = (hash ^ value) * 0x100000001b3;
+
+          return static_cast<std::size_t>(hash ^ (hash >> 32));
+        }
+      };
+
+      //! \class TermBank
+      /*! \brief The terms of up to `TERM_MAX_SIZE` over up to `TERM_VARIABLES` variables of a bit width.
+       *
+       * \details
+       * The terms are enumerated bottom-up, by size, from the variables and the constant 1 with the unary
+       * (`~`, `-`) and the binary (`+`, `-`, `*`, `&`, `|`, `^`, `<<`, `>>`) operators. The operands of a
+       * term are smaller terms of the bank. Only the first term of each signature (the results on the inputs)
+       * is kept, so a term stands for all the terms observationally equivalent to it. The evaluation of a node
+       * on the inputs finds the smallest term it may be equivalent to in O(1), which is then checked on other
+       * inputs (see `checks`).
+       */
+      class TermBank {
+        public:
+          //! \struct Term
+          /*! \brief A term of the bank. */
+          struct Term {
+            //! The operator, VARIABLE_NODE or BV_NODE for the leaves.
+            triton::ast::ast_e type;
+
+            //! The size of the term.
+            triton::uint32 size;
+
+            //! The level of the node of the term (see `AbstractNode::getLevel()`).
+            triton::uint32 level;
+
+            //! The index of the left operand, of the variable or the value of the constant for the leaves.
+            triton::usize left;
+
+            //! The index of the right operand.
+            triton::usize right;
+          };
+
+          //! Size of the terms
+          triton::uint32 bits;
+
+          //! The values of each variable on the inputs.
+          std::array<TermValues, TERM_VARIABLES> inputs;
+
+          //! The values of the variables on the inputs on which a term found is checked.
+          std::vector<std::array<triton::uint64, TERM_VARIABLES>> checks;
+
+          //! The terms, by size.
+          std::vector<Term> terms;
+
+          //! The terms by their results.
+          std::unordered_map<TermValues, triton::usize, TermValuesHash> index;
+
+          //! Constructor. Enumerates the terms of `bits` bits.
+          TRITON_EXPORT TermBank(triton::uint32 bits);
+
+          //! Returns the bank of `bits` (8, 16, 32 or 64) bits, which is built on first use.
+          TRITON_EXPORT static const TermBank& get(triton::uint32 bits);
+
+          //! Returns true and sets `term` if `signature` (an evaluation for each input) are the results of a term.
+          TRITON_EXPORT bool find(const std::vector<triton::uint512>& signature, triton::usize& term) const;
+
+          //! Returns the result of `term` on the values of the variables.
+          TRITON_EXPORT triton::uint64 evaluate(triton::usize term, const std::array<triton::uint64, TERM_VARIABLES>& values) const;
+
+          //! Builds the node of `term` in `actx` on `vars`, its variables by index.
+          TRITON_EXPORT triton::ast::SharedAbstractNode build(const triton::ast::SharedAstContext& actx, triton::usize term, const std::deque<triton::ast::SharedAbstractNode>& vars) const;
+      };
+
+    /*! @} End of synthesis namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TERMBANK_HPP */
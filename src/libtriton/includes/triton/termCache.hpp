@@ -0,0 +1,113 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_TERMCACHE_HPP
+#define TRITON_TERMCACHE_HPP
+
+#include <algorithm>
+#include <unordered_map>
+
+#include <triton/ast.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    /*! \class TermCache
+     *  \brief The terms of a solver translated from Triton's nodes, kept from one query to the next.
+     *
+     * \description
+     * The nodes are weak keys: the cache does not keep them alive, and the entries of the dead nodes are dropped
+     * as the cache grows. An entry is also ignored once the node is updated, its hash then differs.
+     */
+    template <typename Term>
+    class TermCache {
+      private:
+        //! An entry of the cache.
+        struct Entry {
+          //! The node, weak so that it may die.
+          WeakAbstractNode node;
+
+          //! The hash of the node when it was translated.
+          triton::uint128 hash;
+
+          //! The term of the node.
+          Term term;
+
+          //! Constructor.
+          Entry(const SharedAbstractNode& node, const Term& term) : node(node), hash(node->getHash()), term(term) {}
+        };
+
+        //! The entries, by node.
+        std::unordered_map<const AbstractNode*, Entry> entries;
+
+        //! The size triggering the next sweep of the dead nodes.
+        triton::usize sweepAt = 1024;
+
+      public:
+        //! Returns the term of a node, null if it is not translated yet.
+        const Term* find(const SharedAbstractNode& node) const {
+          auto it = this->entries.find(node.get());
+          if (it == this->entries.end() || it->second.node.expired() || it->second.hash != node->getHash())
+            return nullptr;
+          return &it->second.term;
+        }
+
+        //! Records the term of a node.
+        void insert(const SharedAbstractNode& node, const Term& term) {
+          if (this->entries.size() >= this->sweepAt)
+            this->sweep();
+
+          auto it = this->entries.find(node.get());
+          if (it != this->entries.end())
+            this->entries.erase(it);
+
+          this->entries.emplace(node.get(), Entry(node, term));
+        }
+
+        //! Drops the entries of the dead nodes.
+        void sweep(void) {
+          for (auto it = this->entries.begin(); it != this->entries.end();) {
+            if (it->second.node.expired())
+              it = this->entries.erase(it);
+            else
+              it++;
+          }
+          this->sweepAt = std::max<triton::usize>(1024, 2 * this->entries.size());
+        }
+
+        //! Drops all the entries.
+        void clear(void) {
+          this->entries.clear();
+          this->sweepAt = 1024;
+        }
+
+        //! Returns the number of entries, the dead nodes not swept yet included.
+        triton::usize size(void) const {
+          return this->entries.size();
+        }
+    };
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TERMCACHE_HPP */
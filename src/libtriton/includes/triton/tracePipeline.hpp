@@ -0,0 +1,137 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_TRACEPIPELINE_HPP
+#define TRITON_TRACEPIPELINE_HPP
+
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <memory>
+
+#include <triton/dllexport.hpp>
+#include <triton/instruction.hpp>
+#include <triton/traceReader.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    /*! \class TracePipeline
+     *  \brief Decodes the instructions of a trace ahead of their processing.
+     *
+     * \description
+     * A reader thread reads the records of the trace into a ring of `capacity` slots, the decoder
+     * threads decode their instructions (decoder `k` decodes the records `k`, `k + n`, `k + 2n`...), and
+     * the thread running the pipeline consumes them in order. Each slot holds the sequence numbers of
+     * the record it was last read, decoded and consumed for, so the stages never lock: a stage waits
+     * (yielding) for the previous one to publish the record, the reader for the consumer to free the slot.
+     *
+     * The errors are raised by the consumer, at the record they occurred at: the records before it are
+     * processed, as if the trace was processed sequentially. Without decoder, the pipeline reads, decodes
+     * and consumes each record on the calling thread.
+     */
+    class TracePipeline {
+      public:
+        //! The number of slots of the ring.
+        static const triton::usize capacity = 256;
+
+        //! Decodes an instruction on a decoder thread. Returns false if the consumer must decode it instead.
+        using Decoder = std::function<bool(triton::arch::Instruction&)>;
+
+        //! Processes a record and its instruction, in order. `decoded` is false if the instruction is not decoded yet.
+        using Consumer = std::function<void(triton::arch::TraceRecord&, triton::arch::Instruction&, bool decoded)>;
+
+      private:
+        //! A slot of the ring.
+        struct Slot {
+          //! The record.
+          triton::arch::TraceRecord record;
+
+          //! The instruction of the record.
+          triton::arch::Instruction inst;
+
+          //! True if the decoder decoded the instruction.
+          bool decoded;
+
+          //! The error of the decoding, if any.
+          std::exception_ptr error;
+
+          //! The sequence number + 1 of the record last read in the slot.
+          std::atomic<triton::uint64> readSeq;
+
+          //! The sequence number + 1 of the record last decoded in the slot.
+          std::atomic<triton::uint64> decodedSeq;
+
+          //! The sequence number + 1 of the record last consumed in the slot.
+          std::atomic<triton::uint64> consumedSeq;
+        };
+
+        //! The reader of the trace.
+        triton::arch::TraceReader& reader;
+
+        //! The decoding of the instructions.
+        Decoder decoder;
+
+        //! The number of decoder threads.
+        triton::usize decoders;
+
+        //! The slots of the ring.
+        std::unique_ptr<Slot[]> slots;
+
+        //! The number of records of the trace, known once the reader reached its end (or an error).
+        std::atomic<triton::uint64> total;
+
+        //! Set to stop the threads, once the consumer is done or failed.
+        std::atomic<bool> stopped;
+
+        //! The error of the reader, if any, raised after the records read before it are consumed.
+        std::exception_ptr readError;
+
+        //! Waits for `seq` to be published in `value`. Returns false if the trace ends before `seq` or if the pipeline is stopped.
+        bool wait(const std::atomic<triton::uint64>& value, triton::uint64 seq) const;
+
+        //! The reader thread.
+        void readStage(void);
+
+        //! The decoder thread decoding the records `first`, `first + decoders`...
+        void decodeStage(triton::usize first);
+
+        //! Reads, decodes and consumes the records on the calling thread.
+        triton::usize runSequential(const Consumer& consumer);
+
+      public:
+        //! Constructor. The records of `reader` are decoded by `decoders` threads, none for a sequential processing.
+        TRITON_EXPORT TracePipeline(triton::arch::TraceReader& reader, const Decoder& decoder, triton::usize decoders);
+
+        //! Consumes the records of the trace in order and returns their number. Only called once.
+        TRITON_EXPORT triton::usize run(const Consumer& consumer);
+
+        TracePipeline(const TracePipeline&) = delete;
+        TracePipeline& operator=(const TracePipeline&) = delete;
+    };
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TRACEPIPELINE_HPP */
@@ -0,0 +1,166 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_TRACEREADER_HPP
+#define TRITON_TRACEREADER_HPP
+
+#include <istream>
+#include <memory>
+#include <streambuf>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <triton/archEnums.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    //! \struct TraceRecord
+    /*! \brief An instruction of a trace and the concrete state to apply before processing it. */
+    struct TraceRecord {
+      //! The address of the instruction.
+      triton::uint64 address;
+
+      //! The opcode of the instruction.
+      std::vector<triton::uint8> opcode;
+
+      //! The thread of the instruction, 0 if the trace has no threads.
+      triton::uint32 thread;
+
+      //! The concrete values of registers, by name.
+      std::vector<std::pair<std::string, triton::uint512>> registers;
+
+      //! The concrete values of registers, by id.
+      std::vector<std::pair<triton::arch::register_e, triton::uint512>> registerIds;
+
+      //! The concrete values of memory areas (read by the instruction), set before processing it.
+      std::vector<std::pair<triton::uint64, std::vector<triton::uint8>>> memory;
+
+      //! The concrete values of the memory areas written by the instruction, set after processing it.
+      std::vector<std::pair<triton::uint64, std::vector<triton::uint8>>> writes;
+    };
+
+    /*! \class TraceReader
+     *  \brief Reads the records of an execution trace from a stream.
+     *
+     * \description
+     * A `TRACE_TEXT` trace holds an instruction per line: its address and opcode, followed by the registers
+     * and memory cells to set, all in hexadecimal. Empty lines and lines starting with `#` are ignored.
+     *
+     * ~~~~~~~~~~~~~
+     * 0x400000 4889d8 rbx=0x1234 [0x1000]=deadbeef
+     * ~~~~~~~~~~~~~
+     *
+     * A `TRACE_BINARY` trace is a sequence of records whose integers are little-endian:
+     *
+     * ~~~~~~~~~~~~~
+     * address:u64, size:u8, opcode[size]
+     * registers:u8, then for each register: name size:u8, name, value size:u8, value
+     * memory:u8, then for each area: address:u64, size:u16, bytes[size]
+     * ~~~~~~~~~~~~~
+     *
+     * A `TRACE_COMPACT` trace is made for the tracers (Pin, DynamoRIO, QEMU...). It starts with the `TTRC` magic
+     * and a version (1:u8), followed by records whose registers are deltas: the registers of the thread whose
+     * values changed since its previous record (all of them for its first record). The memory areas are the ones
+     * read and written by the instruction.
+     *
+     * ~~~~~~~~~~~~~
+     * address:u64, thread:u32, size:u8, opcode[size]
+     * registers:u8, then for each register: id:u16 (register_e), value size:u8, value
+     * reads:u8, then for each area: address:u64, size:u8, bytes[size]
+     * writes:u8, then for each area: address:u64, size:u8, bytes[size]
+     * ~~~~~~~~~~~~~
+     *
+     * A trace in memory, e.g. a `MappedFile`, is read in place.
+     */
+    class TraceReader {
+      private:
+        //! The stream of the trace.
+        std::istream* stream;
+
+        //! The bytes of a trace in memory, null for a stream.
+        const triton::uint8* data;
+
+        //! The number of bytes of a trace in memory.
+        triton::usize size;
+
+        //! The offset of the next byte of a trace in memory.
+        triton::usize offset;
+
+        //! The bytes read from a stream by `take()`.
+        std::vector<triton::uint8> scratch;
+
+        //! The streambuf over a trace in memory, for the text and binary formats.
+        std::unique_ptr<std::streambuf> buffer;
+
+        //! The stream over `buffer`.
+        std::unique_ptr<std::istream> owned;
+
+        //! The format of the trace.
+        triton::arch::trace_e format;
+
+        //! The number of records or lines read, for the errors.
+        triton::usize position;
+
+        //! The number of records left to read before the limit, see `setLimit()`.
+        triton::usize remaining;
+
+        //! Returns the next `bytes` bytes of the trace, or null if they are not all there.
+        const triton::uint8* take(triton::usize bytes);
+
+        //! Reads the header of a compact trace.
+        void readHeader(void);
+
+        //! Reads a record of a binary trace.
+        bool nextBinary(TraceRecord& record);
+
+        //! Reads a record of a compact trace.
+        bool nextCompact(TraceRecord& record);
+
+        //! Reads a record of a text trace.
+        bool nextText(TraceRecord& record);
+
+      public:
+        //! Constructor.
+        TRITON_EXPORT TraceReader(std::istream& stream, triton::arch::trace_e format);
+
+        //! Constructor. Reads the `size` bytes at `data`, which must outlive the reader.
+        TRITON_EXPORT TraceReader(const triton::uint8* data, triton::usize size, triton::arch::trace_e format);
+
+        //! Reads the next record. Returns false at the end of the trace.
+        TRITON_EXPORT bool next(TraceRecord& record);
+
+        //! Reads and drops the next `count` records. Returns the number of records skipped.
+        TRITON_EXPORT triton::usize skip(triton::usize count);
+
+        //! Ends the trace after the next `count` records.
+        TRITON_EXPORT void setLimit(triton::usize count);
+    };
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TRACEREADER_HPP */
@@ -0,0 +1,172 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_TRACESEGMENT_H
+#define TRITON_TRACESEGMENT_H
+
+#include <map>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <triton/archEnums.hpp>
+#include <triton/ast.hpp>
+#include <triton/astContext.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/pathConstraint.hpp>
+#include <triton/symbolicVariable.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      //! The registers of a thread, a key of the register states of the segments.
+      using ThreadRegister = std::pair<triton::uint32, triton::arch::register_e>;
+
+      //! \struct SegmentBoundary
+      /*! \brief The concrete state of a trace before the first record of a segment. */
+      struct SegmentBoundary {
+        //! The index of the first record of the segment.
+        triton::usize index;
+
+        //! The current thread.
+        triton::uint32 thread;
+
+        //! The concrete values of the parent registers, by thread.
+        std::map<triton::uint32, std::vector<std::pair<triton::arch::register_e, triton::uint512>>> registers;
+      };
+
+      //! \struct SegmentLiveIn
+      /*! \brief A value read by a segment before it is written, represented by a symbolic variable. */
+      struct SegmentLiveIn {
+        //! The variable of the value.
+        SharedSymbolicVariable variable;
+
+        //! The thread of a register.
+        triton::uint32 thread;
+
+        //! The register, `ID_REG_INVALID` for a byte of memory.
+        triton::arch::register_e reg;
+
+        //! The address of a byte of memory.
+        triton::uint64 address;
+
+        //! The concrete value at the boundary.
+        triton::uint512 value;
+      };
+
+      //! \struct SegmentSummary
+      /*! \brief The symbolic summary of a segment of a trace, over its live-ins.
+       *
+       * \details The nodes are the ones of the context which processed the segment.
+       */
+      struct SegmentSummary {
+        //! The index of the first record of the segment.
+        triton::usize index;
+
+        //! The number of records processed.
+        triton::usize count;
+
+        //! The live-ins, none for the first segment of a trace.
+        std::vector<SegmentLiveIn> liveIns;
+
+        //! The path constraints of the segment.
+        std::vector<PathConstraint> pathConstraints;
+
+        //! The final ASTs of the parent registers of each thread, null if concrete.
+        std::map<ThreadRegister, triton::ast::SharedAbstractNode> registers;
+
+        //! The final ASTs of the bytes of memory read or written by the segment, null if concrete.
+        std::unordered_map<triton::uint64, triton::ast::SharedAbstractNode> memory;
+      };
+
+      /*! \class SegmentStitcher
+       *  \brief Stitches the summaries of the consecutive segments of a trace.
+       *
+       * \description
+       * The segments of a trace may be processed in parallel by independent contexts, each one seeded
+       * with the concrete state at its boundary (see `API::scanTraceBoundaries()` and `API::processTraceSegment()`).
+       * The stitcher appends their summaries in order: it rebuilds the nodes of a segment in its own AST
+       * context, substituting each live-in by the symbolic state left by the previous segments, or by its
+       * concrete value if that state is concrete. The path constraints which become concrete are dropped,
+       * as the segment only made them symbolic through its live-ins.
+       */
+      class SegmentStitcher {
+        private:
+          //! The AST context of the stitched nodes.
+          triton::ast::SharedAstContext ctxt;
+
+          //! The index of the record following the stitched segments.
+          triton::usize next;
+
+          //! The stitched path constraints.
+          std::vector<PathConstraint> pathConstraints;
+
+          //! The symbolic registers after the stitched segments.
+          std::map<ThreadRegister, triton::ast::SharedAbstractNode> registers;
+
+          //! The symbolic bytes of memory after the stitched segments.
+          std::unordered_map<triton::uint64, triton::ast::SharedAbstractNode> memory;
+
+          //! Rebuilds a node of `segment` in the context of the stitcher, `memo` holding the nodes already rebuilt.
+          triton::ast::SharedAbstractNode translate(const triton::ast::SharedAbstractNode& node,
+                                                    const std::unordered_map<triton::usize, triton::ast::SharedAbstractNode>& liveIns,
+                                                    std::unordered_map<triton::ast::AbstractNode*, triton::ast::SharedAbstractNode>& memo) const;
+
+        public:
+          //! Constructor. The nodes are stitched in `ctxt`, usually the one of the context which processed the first segment.
+          TRITON_EXPORT SegmentStitcher(const triton::ast::SharedAstContext& ctxt);
+
+          //! Appends the summary of the segment following the stitched ones.
+          TRITON_EXPORT void append(const SegmentSummary& segment);
+
+          //! Returns the index of the record following the stitched segments.
+          TRITON_EXPORT triton::usize getNextIndex(void) const;
+
+          //! Returns the stitched path constraints.
+          TRITON_EXPORT const std::vector<PathConstraint>& getPathConstraints(void) const;
+
+          //! Returns the conjunction of the taken predicates of the stitched path constraints.
+          TRITON_EXPORT triton::ast::SharedAbstractNode getPathPredicate(void) const;
+
+          //! Returns the AST of a parent register of a thread after the stitched segments, null if concrete.
+          TRITON_EXPORT triton::ast::SharedAbstractNode getRegisterAst(triton::uint32 thread, triton::arch::register_e reg) const;
+
+          //! Returns the AST of a byte of memory after the stitched segments, null if concrete.
+          TRITON_EXPORT triton::ast::SharedAbstractNode getMemoryAst(triton::uint64 addr) const;
+      };
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TRACESEGMENT_H */
@@ -0,0 +1,166 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_TRITONC_H
+#define TRITON_TRITONC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <triton/dllexport.hpp>
+
+
+
+/*!
+ * \file
+ * \brief The C interface of Triton, for the frontends written in other languages (e.g. Rust, Go).
+ *
+ * \description
+ * A context is an opaque handle on a `triton::API`. The functions work on arrays given by the caller:
+ * a call processes a list of instructions, sets or reads a range of memory or registers, or solves a
+ * list of queries, so that a frontend pays the cost of crossing the language boundary once per batch.
+ * No memory is allocated on behalf of the caller, the results are written into the buffers it gives.
+ *
+ * The functions returning a `triton_status_t` return `TRITON_OK` on success. On failure, the message
+ * of the error is kept by the context until the next failure (see `triton_last_error()`). A context
+ * must not be used by several threads at the same time.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! The opaque handle of a context. */
+typedef struct triton_context triton_context_t;
+
+/*! The status returned by the functions. */
+typedef int32_t triton_status_t;
+
+/*! Success. */
+#define TRITON_OK     0
+
+/*! Failure, see `triton_last_error()`. */
+#define TRITON_ERROR -1
+
+/*! The architectures of a context, as `triton::arch::architecture_e`. */
+#define TRITON_ARCH_AARCH64 1
+#define TRITON_ARCH_ARM32   2
+#define TRITON_ARCH_X86     3
+#define TRITON_ARCH_X86_64  4
+
+/*! The answers of the solver, as `triton::engines::solver::status_e`. */
+#define TRITON_UNSAT    0
+#define TRITON_SAT      1
+#define TRITON_TIMEOUT  2
+#define TRITON_OUTOFMEM 3
+#define TRITON_UNKNOWN  4
+
+/*! A query holds if the AST of the symbolic expression `operand` holds (or is not zero for a bitvector). */
+#define TRITON_QUERY_EXPRESSION 0
+
+/*! A query holds if the first branch not taken by the path constraint at index `operand` is taken, the previous ones being taken. */
+#define TRITON_QUERY_FLIP       1
+
+/*! An instruction to process. */
+typedef struct triton_instruction {
+  uint64_t       address; /*!< The address of the instruction. */
+  const uint8_t* opcode;  /*!< The bytes of the instruction. */
+  uint32_t       size;    /*!< The number of bytes of the opcode. */
+} triton_instruction_t;
+
+/*! The result of a processed instruction. */
+typedef struct triton_instruction_result {
+  uint64_t next;       /*!< The value of the program counter after the instruction. */
+  uint32_t type;       /*!< The type of the instruction (e.g. `triton::arch::x86::ID_INS_ADD`). */
+  uint32_t size;       /*!< The size of the decoded instruction. */
+  uint8_t  branch;     /*!< Non-zero if the instruction is a branch. */
+  uint8_t  taken;      /*!< Non-zero if the condition of the branch is taken. */
+  uint8_t  symbolized; /*!< Non-zero if the instruction has symbolized expressions. */
+  uint8_t  tainted;    /*!< Non-zero if the instruction is tainted. */
+} triton_instruction_result_t;
+
+/*! A query to solve. */
+typedef struct triton_query {
+  uint32_t kind;       /*!< `TRITON_QUERY_EXPRESSION` or `TRITON_QUERY_FLIP`. */
+  uint32_t timeout;    /*!< The timeout of the query in milliseconds, 0 for the solver's one. */
+  uint64_t operand;    /*!< The id of the symbolic expression or the index of the path constraint. */
+  uint8_t  with_path;  /*!< Non-zero if the current path predicate must hold too (`TRITON_QUERY_EXPRESSION` only). */
+} triton_query_t;
+
+/*! A value of a model. */
+typedef struct triton_model_entry {
+  uint64_t variable;   /*!< The id of the symbolic variable. */
+  uint64_t value;      /*!< The value of the variable, its lower 64 bits. */
+} triton_model_entry_t;
+
+/*! The answer to a query. */
+typedef struct triton_answer {
+  uint32_t status;     /*!< `TRITON_SAT`, `TRITON_UNSAT`, ... */
+  uint32_t truncated;  /*!< Non-zero if the model did not fit into the entries left, `count` is then 0. */
+  size_t   offset;     /*!< The index of the first entry of the model. */
+  size_t   count;      /*!< The number of entries of the model. */
+} triton_answer_t;
+
+/*! Returns a new context of the architecture `arch`, NULL if it cannot be created. */
+TRITON_EXPORT triton_context_t* triton_create(uint32_t arch);
+
+/*! Releases a context. */
+TRITON_EXPORT void triton_destroy(triton_context_t* ctx);
+
+/*! Returns the message of the last error of a context, an empty string if there was none. It is valid until the next call on the context. */
+TRITON_EXPORT const char* triton_last_error(const triton_context_t* ctx);
+
+/*! Enables or disables a mode (`triton::modes::mode_e`). */
+TRITON_EXPORT triton_status_t triton_set_mode(triton_context_t* ctx, uint32_t mode, int32_t enabled);
+
+/*! Resets the symbolic, taint and concrete states of a context. */
+TRITON_EXPORT triton_status_t triton_reset(triton_context_t* ctx);
+
+/*!
+ * Processes `count` instructions in order and writes their results into `results` (which may be NULL).
+ * Returns the number of instructions processed, less than `count` if one of them failed (see `triton_last_error()`).
+ */
+TRITON_EXPORT size_t triton_process(triton_context_t* ctx, const triton_instruction_t* instructions, size_t count, triton_instruction_result_t* results);
+
+/*! Sets the concrete value of the `size` bytes of memory at `address`. */
+TRITON_EXPORT triton_status_t triton_set_memory(triton_context_t* ctx, uint64_t address, const uint8_t* values, size_t size);
+
+/*! Reads the concrete value of the `size` bytes of memory at `address` into `values`. */
+TRITON_EXPORT triton_status_t triton_get_memory(triton_context_t* ctx, uint64_t address, uint8_t* values, size_t size);
+
+/*! Symbolizes the `size` bytes of memory at `address`, one variable per byte whose ids are written into `variables` (which may be NULL). */
+TRITON_EXPORT triton_status_t triton_symbolize_memory(triton_context_t* ctx, uint64_t address, size_t size, uint64_t* variables);
+
+/*! Writes the id of the register named `name` (e.g. "rax") into `id`. */
+TRITON_EXPORT triton_status_t triton_get_register_id(triton_context_t* ctx, const char* name, uint32_t* id);
+
+/*! Sets the concrete values of `count` registers of at most 64 bits given by their ids. */
+TRITON_EXPORT triton_status_t triton_set_registers(triton_context_t* ctx, const uint32_t* ids, const uint64_t* values, size_t count);
+
+/*! Reads the concrete values of `count` registers given by their ids into `values`, the lower 64 bits of wider ones. */
+TRITON_EXPORT triton_status_t triton_get_registers(triton_context_t* ctx, const uint32_t* ids, uint64_t* values, size_t count);
+
+/*! Symbolizes `count` registers given by their ids, the ids of their variables are written into `variables` (which may be NULL). */
+TRITON_EXPORT triton_status_t triton_symbolize_registers(triton_context_t* ctx, const uint32_t* ids, size_t count, uint64_t* variables);
+
+/*! Writes the id of the symbolic expression of the register `id` into `expression`, or fails if the register has none. */
+TRITON_EXPORT triton_status_t triton_get_register_expression(triton_context_t* ctx, uint32_t id, uint64_t* expression);
+
+/*! Returns the number of path constraints. */
+TRITON_EXPORT size_t triton_get_path_constraints_size(triton_context_t* ctx);
+
+/*!
+ * Solves `count` queries in order. The answer of each query is written into `answers`, its model into the
+ * `capacity` entries of `models`, after the models of the previous queries.
+ */
+TRITON_EXPORT triton_status_t triton_solve(triton_context_t* ctx, const triton_query_t* queries, size_t count, triton_answer_t* answers, triton_model_entry_t* models, size_t capacity);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRITON_TRITONC_H */
@@ -63,6 +63,9 @@ namespace triton {
         //! The map of symbols. E.g: (let (symbols expr1) expr2)
         std::unordered_map<std::string, triton::ast::SharedAbstractNode> symbols;
 
+        //! The memory of each size of indexes, all the arrays with the same size of indexes are the same array.
+        std::map<triton::uint32, const BitwuzlaTerm*> arrays;
+
         //! All bitvector sorts that used in the expression.
         std::map<size_t, const BitwuzlaSort*> bvSorts;
 
@@ -13,6 +13,7 @@
 #include <ostream>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <triton/ast.hpp>
 #include <triton/dllexport.hpp>
@@ -53,12 +54,21 @@ namespace triton {
         //! The LLVM IR builder.
         llvm::IRBuilder<> llvmIR;
 
-        //! Map Triton variables to LLVM ones.
+        //! Map Triton variables to LLVM ones, the arguments of the function being lifted.
         std::map<triton::ast::SharedAbstractNode, llvm::Value*> llvmVars;
 
         //! Create a LLVM function. `fname` represents the name of the LLVM function.
         void createFunction(const triton::ast::SharedAbstractNode& node, const char* fname);
 
+        //! Create a LLVM function which writes `outputs` through pointer arguments. The output pointers are returned in `pointers`.
+        void createFunction(const std::vector<std::pair<std::string, triton::ast::SharedAbstractNode>>& outputs, const char* fname, std::vector<llvm::Value*>& pointers);
+
+        //! Lifts a Triton AST and all its references into a new LLVM function of the module. `fname` represents the name of the LLVM function.
+        void lift(const triton::ast::SharedAbstractNode& node, const char* fname);
+
+        //! Applies the LLVM optimizations (-O3 -Oz) on the module.
+        void optimize(void);
+
         //! Converts Triton AST to LLVM IR.
         llvm::Value* do_convert(const triton::ast::SharedAbstractNode& node, std::unordered_map<triton::ast::SharedAbstractNode, llvm::Value*>* results);
 
@@ -68,6 +78,12 @@ namespace triton {
 
         //! Lifts a symbolic expression and all its references to LLVM format. `fname` represents the name of the LLVM function.
         TRITON_EXPORT std::shared_ptr<llvm::Module> convert(const triton::ast::SharedAbstractNode& node, const char* fname="__triton", bool optimize=false);
+
+        //! Lifts several symbolic expressions and all their references into one LLVM module, one function per node. `fnames[i]` represents the name of the LLVM function of `nodes[i]`. The optimizations are applied once on the module.
+        TRITON_EXPORT std::shared_ptr<llvm::Module> convert(const std::vector<triton::ast::SharedAbstractNode>& nodes, const std::vector<std::string>& fnames, bool optimize=false);
+
+        //! Lifts several symbolic expressions into one LLVM function with an input argument per variable and an output pointer argument per expression, named by `outputs[i].first`. The shared sub-expressions are converted once.
+        TRITON_EXPORT std::shared_ptr<llvm::Module> convert(const std::vector<std::pair<std::string, triton::ast::SharedAbstractNode>>& outputs, const char* fname="__triton", bool optimize=false);
     };
 
   /*! @} End of ast namespace */
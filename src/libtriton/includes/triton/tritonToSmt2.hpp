@@ -0,0 +1,104 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_TRITONTOSMT2_H
+#define TRITON_TRITONTOSMT2_H
+
+#include <map>
+#include <ostream>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/symbolicVariable.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    //! \class TritonToSmt2
+    /*! \brief Converts a Triton's AST to an SMT-LIB2 script sharing its sub-terms.
+     *
+     * \description
+     * Unlike the SMT representation of the nodes (see `AstSmtRepresentation`), which prints a node used several
+     * times as many times, each sub-term used more than once is defined once with `define-fun` and then referred
+     * to by its name. Only standard SMT-LIB2 operators are printed. The variables are declared the first time
+     * they are used. The declarations and definitions may be scoped, as the `push`/`pop` of the solver they are
+     * sent to, so that the terms of the previous conversions are reused while they are defined.
+     */
+    class TritonToSmt2 {
+      private:
+        //! A name, and the scope it was declared in.
+        struct Symbol {
+          std::string name;
+          triton::usize scope;
+        };
+
+        //! The named terms, by node.
+        std::unordered_map<const AbstractNode*, Symbol> terms;
+
+        //! The nodes named in each scope, kept alive while they are named.
+        std::vector<std::vector<SharedAbstractNode>> scopes;
+
+        //! The memories declared, by name.
+        std::set<std::string> memories;
+
+        //! The variables and the memories declared in each scope.
+        std::vector<std::vector<std::string>> declared;
+
+        //! The number of terms named so far, numbering the next one.
+        triton::usize counter;
+
+        //! Returns the SMT-LIB2 term of a node given the terms of its operands.
+        std::string print(AbstractNode* node, const std::vector<std::string>& ops) const;
+
+        //! Returns the SMT-LIB2 sort of a node.
+        std::string sort(AbstractNode* node) const;
+
+      public:
+        //! The symbolic variables declared, by name.
+        std::map<std::string, triton::engines::symbolic::SharedSymbolicVariable> variables;
+
+        //! Constructor.
+        TRITON_EXPORT TritonToSmt2();
+
+        //! Writes the declarations and definitions the term of `node` needs into `stream`, and returns the term.
+        TRITON_EXPORT std::string convert(const SharedAbstractNode& node, std::ostream& stream);
+
+        //! Opens a scope.
+        TRITON_EXPORT void push(void);
+
+        //! Closes the `count` innermost scopes and forgets their declarations and definitions.
+        TRITON_EXPORT void pop(triton::usize count = 1);
+
+        //! Forgets all the declarations and definitions.
+        TRITON_EXPORT void reset(void);
+    };
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TRITONTOSMT2_H */
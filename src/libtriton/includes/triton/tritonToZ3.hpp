@@ -9,10 +9,12 @@
 #define TRITON_TRITONTOZ3_H
 
 #include <unordered_map>
+#include <vector>
 #include <z3++.h>
 
 #include <triton/ast.hpp>
 #include <triton/dllexport.hpp>
+#include <triton/termCache.hpp>
 #include <triton/tritonTypes.hpp>
 
 
@@ -33,7 +35,13 @@ namespace triton {
    */
 
     //! \class TritonToZ3
-    /*! \brief Converts a Triton's AST to Z3's AST. */
+    /*! \brief Converts a Triton's AST to Z3's AST.
+     *
+     * \description
+     * The branches of a large node (more than 100000 nodes to convert) which share few nodes are converted
+     * in parallel on the shared executor, each group of branches into its own z3's context, and their terms
+     * are then translated into the context of the converter.
+     */
     class TritonToZ3 {
       private:
         //! This flag define if the conversion is used to evaluated a node or not.
@@ -42,9 +50,20 @@ namespace triton {
         //! Returns the integer of the z3 expression as a string.
         std::string getStringValue(const z3::expr& expr);
 
+        //! Returns a balanced tree of the binary z3's operator `mk` over the operands of `ops` in [begin, end) (n-ary nodes, see AST_NARY).
+        z3::expr balanced(Z3_ast (*mk)(Z3_context, Z3_ast, Z3_ast), const std::vector<z3::expr>& ops, triton::usize begin, triton::usize end);
+
         //! The convert internal process
         z3::expr do_convert(const triton::ast::SharedAbstractNode& node, std::unordered_map<triton::ast::SharedAbstractNode, z3::expr>* output);
 
+        //! Converts a node in post-order into `results`, not descending into the nodes already converted or cached. The nodes converted are appended to `converted`, `bound` is set if one of them is a let or a symbol.
+        void walk(const triton::ast::SharedAbstractNode& node, std::unordered_map<triton::ast::SharedAbstractNode, z3::expr>& results,
+                  const triton::ast::TermCache<z3::expr>* cache, std::vector<triton::ast::SharedAbstractNode>& converted, bool& bound);
+
+        //! Converts the branches of a large node in parallel into `results`, the nodes above them are left to `walk()`. Returns false if the node is not split.
+        bool split(const triton::ast::SharedAbstractNode& node, std::unordered_map<triton::ast::SharedAbstractNode, z3::expr>& results,
+                   const triton::ast::TermCache<z3::expr>* cache, std::vector<triton::ast::SharedAbstractNode>& converted);
+
       protected:
         //! The z3's context.
         z3::context context;
@@ -64,6 +83,12 @@ namespace triton {
 
         //! Converts to Z3's AST
         TRITON_EXPORT z3::expr convert(const triton::ast::SharedAbstractNode& node);
+
+        //! Converts to Z3's AST, reusing the nodes already converted into `cache` and recording the new ones. The cache must be used with this converter only.
+        TRITON_EXPORT z3::expr convert(const triton::ast::SharedAbstractNode& node, triton::ast::TermCache<z3::expr>& cache);
+
+        //! Returns the z3's context.
+        TRITON_EXPORT z3::context& getContext(void);
     };
 
   /*! @} End of ast namespace */
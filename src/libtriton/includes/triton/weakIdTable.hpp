@@ -0,0 +1,221 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_WEAKIDTABLE_H
+#define TRITON_WEAKIDTABLE_H
+
+#include <bitset>
+#include <memory>
+#include <vector>
+
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Utils namespace
+  namespace utils {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup utils
+   *  @{
+   */
+
+    //! \class WeakIdTable
+    /*! \brief Dense table of weak pointers indexed by monotonic ids.
+     *
+     * \description
+     * Ids are split into chunks of 4096 slots, allocated when one of their slots is set and released
+     * once empty, so that a lookup is an array index. Expired pointers are removed once as many slots
+     * as the allocated chunks hold have been set since the last compaction, which also releases the
+     * control blocks they keep alive. Copying a table shares its chunks, and writing to a shared chunk
+     * copies this chunk only.
+     */
+    template <typename T>
+    class WeakIdTable {
+      public:
+        //! The number of bits of the index in a chunk.
+        static const triton::uint32 chunkBits = 12;
+
+        //! The number of slots of a chunk.
+        static const triton::uint32 chunkSize = 1 << chunkBits;
+
+      private:
+        //! A chunk of slots.
+        struct Chunk {
+          //! The slots of the chunk.
+          std::weak_ptr<T> slots[chunkSize];
+
+          //! The set slots of the chunk, expired or not.
+          std::bitset<chunkSize> used;
+        };
+
+        //! The chunks, nullptr if empty.
+        std::vector<std::shared_ptr<Chunk>> chunks;
+
+        //! The number of allocated chunks.
+        triton::usize allocated = 0;
+
+        //! The number of set slots, expired or not.
+        triton::usize count = 0;
+
+        //! The number of slots set since the last compaction.
+        triton::usize inserts = 0;
+
+        //! Returns the chunk of `index`, copied first if it is shared.
+        Chunk& detach(triton::usize index) {
+          std::shared_ptr<Chunk>& chunk = this->chunks[index];
+
+          if (chunk == nullptr) {
+            chunk = std::make_shared<Chunk>();
+            this->allocated++;
+          }
+          /* Copy on write */
+          else if (chunk.use_count() > 1) {
+            chunk = std::make_shared<Chunk>(*chunk);
+          }
+
+          return *chunk;
+        }
+
+        //! Releases the chunk of `index` if it is empty.
+        void release(triton::usize index) {
+          if (this->chunks[index]->used.none()) {
+            this->chunks[index] = nullptr;
+            this->allocated--;
+          }
+          while (!this->chunks.empty() && this->chunks.back() == nullptr)
+            this->chunks.pop_back();
+        }
+
+        //! Returns true if a set slot of `chunk` has expired.
+        static bool hasExpired(const Chunk& chunk) {
+          for (triton::uint32 offset = 0; offset < chunkSize; offset++) {
+            if (chunk.used[offset] && chunk.slots[offset].expired())
+              return true;
+          }
+          return false;
+        }
+
+        //! Removes expired pointers. Shared chunks are only copied if they hold one.
+        void compact(void) {
+          for (triton::usize index = 0; index < this->chunks.size(); index++) {
+            if (this->chunks[index] == nullptr || !hasExpired(*this->chunks[index]))
+              continue;
+
+            Chunk& chunk = this->detach(index);
+            for (triton::uint32 offset = 0; offset < chunkSize; offset++) {
+              if (chunk.used[offset] && chunk.slots[offset].expired()) {
+                chunk.slots[offset].reset();
+                chunk.used[offset] = false;
+                this->count--;
+              }
+            }
+
+            if (chunk.used.none()) {
+              this->chunks[index] = nullptr;
+              this->allocated--;
+            }
+          }
+
+          while (!this->chunks.empty() && this->chunks.back() == nullptr)
+            this->chunks.pop_back();
+
+          this->inserts = 0;
+        }
+
+      public:
+        //! Returns the pointer of `id`, or nullptr if the table does not hold it.
+        const std::weak_ptr<T>* find(triton::usize id) const {
+          if ((id >> chunkBits) >= this->chunks.size())
+            return nullptr;
+
+          const std::shared_ptr<Chunk>& chunk = this->chunks[id >> chunkBits];
+          if (chunk == nullptr || !chunk->used[id & (chunkSize - 1)])
+            return nullptr;
+
+          return &chunk->slots[id & (chunkSize - 1)];
+        }
+
+        //! Returns true if the table holds `id`.
+        bool contains(triton::usize id) const {
+          return this->find(id) != nullptr;
+        }
+
+        //! Sets the pointer of `id`.
+        void set(triton::usize id, const std::shared_ptr<T>& value) {
+          if ((id >> chunkBits) >= this->chunks.size())
+            this->chunks.resize((id >> chunkBits) + 1);
+
+          Chunk& chunk = this->detach(id >> chunkBits);
+          triton::uint32 offset = id & (chunkSize - 1);
+
+          if (!chunk.used[offset]) {
+            chunk.used[offset] = true;
+            this->count++;
+          }
+          chunk.slots[offset] = value;
+
+          /* A compaction scans the allocated chunks, it runs once as many slots have been set */
+          if (++this->inserts >= this->allocated * chunkSize)
+            this->compact();
+        }
+
+        //! Removes `id`. Returns false if the table does not hold it.
+        bool erase(triton::usize id) {
+          if (!this->contains(id))
+            return false;
+
+          Chunk& chunk = this->detach(id >> chunkBits);
+          chunk.slots[id & (chunkSize - 1)].reset();
+          chunk.used[id & (chunkSize - 1)] = false;
+          this->count--;
+          this->release(id >> chunkBits);
+
+          return true;
+        }
+
+        //! Removes all pointers.
+        void clear(void) {
+          this->chunks.clear();
+          this->allocated = 0;
+          this->count     = 0;
+          this->inserts   = 0;
+        }
+
+        //! Returns the number of set pointers, expired or not.
+        triton::usize size(void) const {
+          return this->count;
+        }
+
+        //! Calls `visitor(id, pointer)` on each set pointer, by increasing id. The table must not be modified meanwhile.
+        template <typename F>
+        void forEach(F visitor) const {
+          for (triton::usize index = 0; index < this->chunks.size(); index++) {
+            const std::shared_ptr<Chunk>& chunk = this->chunks[index];
+            if (chunk == nullptr)
+              continue;
+            for (triton::uint32 offset = 0; offset < chunkSize; offset++) {
+              if (chunk->used[offset])
+                visitor((index << chunkBits) | offset, chunk->slots[offset]);
+            }
+          }
+        }
+    };
+
+  /*! @} End of utils namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_WEAKIDTABLE_H */
@@ -8,6 +8,9 @@
 #ifndef TRITON_X86SEMANTICS_H
 #define TRITON_X86SEMANTICS_H
 
+#include <functional>
+#include <string>
+
 #include <triton/architecture.hpp>
 #include <triton/dllexport.hpp>
 #include <triton/instruction.hpp>
@@ -72,6 +75,36 @@ namespace triton {
           TRITON_EXPORT bool buildSemantics(triton::arch::Instruction& inst);
 
         private:
+          //! A semantics handler.
+          using handler_t = void (x86Semantics::*)(triton::arch::Instruction&);
+
+          //! The specialized semantics handlers, indexed by `handler_e` (see `x86Specifications::selectSemanticsHandler()`).
+          static const handler_t handlers[];
+
+          //! ADD semantics for a `D` destination and a `S` source.
+          template <triton::arch::operand_e D, triton::arch::operand_e S> void addFast_s(triton::arch::Instruction& inst);
+
+          //! CMP semantics for a `D` destination and a `S` source.
+          template <triton::arch::operand_e D, triton::arch::operand_e S> void cmpFast_s(triton::arch::Instruction& inst);
+
+          //! Jcc semantics for a jump taken when `flag` equals `value`.
+          template <triton::arch::register_e flag, bool value> void jccFast_s(triton::arch::Instruction& inst);
+
+          //! MOV semantics for a `D` destination and a `S` source.
+          template <triton::arch::operand_e D, triton::arch::operand_e S> void movFast_s(triton::arch::Instruction& inst);
+
+          //! POP semantics for a register destination.
+          void popRegFast_s(triton::arch::Instruction& inst);
+
+          //! PUSH semantics for a `S` source.
+          template <triton::arch::operand_e S> void pushFast_s(triton::arch::Instruction& inst);
+
+          //! SUB semantics for a `D` destination and a `S` source.
+          template <triton::arch::operand_e D, triton::arch::operand_e S> void subFast_s(triton::arch::Instruction& inst);
+
+          //! TEST semantics for a `D` first and a `S` second source.
+          template <triton::arch::operand_e D, triton::arch::operand_e S> void testFast_s(triton::arch::Instruction& inst);
+
           //! Aligns the stack (add). Returns the new stack value.
           triton::uint64 alignAddStack_s(triton::arch::Instruction& inst, triton::uint32 delta);
 
@@ -87,9 +120,25 @@ namespace triton {
           //! Sets a register as undefined.
           void undefined_s(triton::arch::Instruction& inst, const triton::arch::Register& reg);
 
+          //! Creates the expression of a flag computed by `node` from the result `parent`. With LAZY_FLAGS, the expression is built when the flag is read.
+          void flag_s(triton::arch::Instruction& inst,
+                      const triton::engines::symbolic::SharedSymbolicExpression& parent,
+                      const triton::arch::Register& flag,
+                      const std::function<triton::ast::SharedAbstractNode(void)>& node,
+                      const std::string& comment);
+
           //! Control flow semantics. Used to represent IP.
           void controlFlow_s(triton::arch::Instruction& inst);
 
+          //! Moves the concrete values and the expressions of [src, src+size) to [dst, dst+size), as memmove does.
+          void moveMemory_s(triton::uint64 dst, triton::uint64 src, triton::usize size);
+
+          //! With BULK_STRING_OPERATIONS, executes all the iterations of a REP MOVS (`src` is a memory) or REP STOS at once. Returns false if they must be executed one at a time.
+          bool repString_s(triton::arch::Instruction& inst, triton::arch::OperandWrapper& dst, triton::arch::OperandWrapper& src, const std::string& comment);
+
+          //! With BULK_STRING_OPERATIONS, skips the leading iterations of a REPE or REPNE CMPS (`dst` is a memory) or SCAS comparing concrete memory cells without stopping the repetition.
+          void repCompare_s(triton::arch::Instruction& inst, triton::arch::OperandWrapper& dst, triton::arch::OperandWrapper& src);
+
           //! Update the FPU x87 Tag Word (whenever an MMX register changes)
           void updateFTW(triton::arch::Instruction& inst, const triton::engines::symbolic::SharedSymbolicExpression& parent);
 
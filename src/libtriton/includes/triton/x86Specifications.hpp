@@ -8,6 +8,7 @@
 #ifndef TRITON_X86SPECIFICATIONS_H
 #define TRITON_X86SPECIFICATIONS_H
 
+#include <array>
 #include <unordered_map>
 #include <string>
 
@@ -44,10 +45,33 @@ namespace triton {
       //! \class x86Specifications
       /*! \brief The x86Specifications class defines specifications about the x86 and x86_64 CPU */
       class x86Specifications {
+        private:
+          //! The registers of an architecture, built once from the spec and shared by all its CPUs.
+          struct RegisterTable {
+            //! List of registers specification available for this architecture.
+            std::unordered_map<triton::arch::register_e, const triton::arch::Register> id2reg;
+            std::unordered_map<std::string, triton::arch::register_e> name2id;
+
+            //! The registers of `id2reg` indexed by id, nullptr if not available for this architecture.
+            std::array<const triton::arch::Register*, triton::arch::ID_REG_LAST_ITEM> regIndex;
+
+            //! Builds the registers of the architecture from the spec.
+            RegisterTable(triton::arch::architecture_e arch);
+
+            //! The table is never copied, `regIndex` points into `id2reg`.
+            RegisterTable(const RegisterTable&) = delete;
+          };
+
+          //! Returns the registers of the architecture, built on first use.
+          static const RegisterTable& getRegisterTable(triton::arch::architecture_e arch);
+
         protected:
-          //! List of registers specification available for this architecture.
-          std::unordered_map<triton::arch::register_e, const triton::arch::Register> id2reg;
-          std::unordered_map<std::string, triton::arch::register_e> name2id;
+          //! List of registers specification available for this architecture, shared by all its CPUs.
+          const std::unordered_map<triton::arch::register_e, const triton::arch::Register>& id2reg;
+          const std::unordered_map<std::string, triton::arch::register_e>& name2id;
+
+          //! The registers of `id2reg` indexed by id, nullptr if not available for this architecture.
+          const std::array<const triton::arch::Register*, triton::arch::ID_REG_LAST_ITEM>& regIndex;
 
         public:
           //! Constructor.
@@ -61,6 +85,9 @@ namespace triton {
 
           //! Converts a capstone's prefix id to a triton's prefix id.
           TRITON_EXPORT triton::arch::x86::prefix_e capstonePrefixToTritonPrefix(triton::uint32 id) const;
+
+          //! Returns the specialized semantics handler (handler_e) of a decoded instruction, ID_HANDLER_INVALID if it has none.
+          TRITON_EXPORT triton::uint32 selectSemanticsHandler(const triton::arch::Instruction& inst) const;
       };
 
       //! The list of opcodes.
@@ -1368,6 +1395,57 @@ namespace triton {
         ID_INS_LAST_ITEM //!< must be the last item
       };
 
+      /*! \brief The specialized semantics handlers.
+       *
+       * \details The hottest instructions have a semantics handler per kind of operands, which reads and writes
+       * them without dispatching on their type. The handler is selected when the instruction is decoded (see
+       * `x86Specifications::selectSemanticsHandler()`), kept by the disassembly cache, and called directly.
+       */
+      enum handler_e {
+        ID_HANDLER_INVALID = 0, //!< no specialized handler
+
+        ID_HANDLER_ADD_MEM_IMM, //!< ADD mem, imm
+        ID_HANDLER_ADD_MEM_REG, //!< ADD mem, reg
+        ID_HANDLER_ADD_REG_IMM, //!< ADD reg, imm
+        ID_HANDLER_ADD_REG_MEM, //!< ADD reg, mem
+        ID_HANDLER_ADD_REG_REG, //!< ADD reg, reg
+        ID_HANDLER_CMP_MEM_IMM, //!< CMP mem, imm
+        ID_HANDLER_CMP_MEM_REG, //!< CMP mem, reg
+        ID_HANDLER_CMP_REG_IMM, //!< CMP reg, imm
+        ID_HANDLER_CMP_REG_MEM, //!< CMP reg, mem
+        ID_HANDLER_CMP_REG_REG, //!< CMP reg, reg
+        ID_HANDLER_JAE,         //!< JAE imm
+        ID_HANDLER_JB,          //!< JB imm
+        ID_HANDLER_JE,          //!< JE imm
+        ID_HANDLER_JNE,         //!< JNE imm
+        ID_HANDLER_JNO,         //!< JNO imm
+        ID_HANDLER_JNP,         //!< JNP imm
+        ID_HANDLER_JNS,         //!< JNS imm
+        ID_HANDLER_JO,          //!< JO imm
+        ID_HANDLER_JP,          //!< JP imm
+        ID_HANDLER_JS,          //!< JS imm
+        ID_HANDLER_LEA_REG_MEM, //!< LEA reg, mem
+        ID_HANDLER_MOV_MEM_IMM, //!< MOV mem, imm
+        ID_HANDLER_MOV_MEM_REG, //!< MOV mem, reg
+        ID_HANDLER_MOV_REG_IMM, //!< MOV reg, imm
+        ID_HANDLER_MOV_REG_MEM, //!< MOV reg, mem
+        ID_HANDLER_MOV_REG_REG, //!< MOV reg, reg
+        ID_HANDLER_POP_REG,     //!< POP reg
+        ID_HANDLER_PUSH_IMM,    //!< PUSH imm
+        ID_HANDLER_PUSH_REG,    //!< PUSH reg
+        ID_HANDLER_SUB_MEM_IMM, //!< SUB mem, imm
+        ID_HANDLER_SUB_MEM_REG, //!< SUB mem, reg
+        ID_HANDLER_SUB_REG_IMM, //!< SUB reg, imm
+        ID_HANDLER_SUB_REG_MEM, //!< SUB reg, mem
+        ID_HANDLER_SUB_REG_REG, //!< SUB reg, reg
+        ID_HANDLER_TEST_MEM_IMM, //!< TEST mem, imm
+        ID_HANDLER_TEST_MEM_REG, //!< TEST mem, reg
+        ID_HANDLER_TEST_REG_IMM, //!< TEST reg, imm
+        ID_HANDLER_TEST_REG_REG, //!< TEST reg, reg
+
+        ID_HANDLER_LAST_ITEM //!< must be the last item
+      };
+
     /*! @} End of x86 namespace */
     };
   /*! @} End of arch namespace */
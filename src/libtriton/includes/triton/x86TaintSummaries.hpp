@@ -0,0 +1,129 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_X86TAINTSUMMARIES_H
+#define TRITON_X86TAINTSUMMARIES_H
+
+#include <vector>
+
+#include <triton/architecture.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/instruction.hpp>
+#include <triton/memoryAccess.hpp>
+#include <triton/taintEngine.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    //! The x86 namespace
+    namespace x86 {
+    /*!
+     *  \ingroup arch
+     *  \addtogroup x86
+     *  @{
+     */
+
+      /*! \class x86TaintSummaries
+       *  \brief The taint propagation of x86 instructions, without their semantics.
+       *
+       * \description
+       * A summary tells how an opcode spreads the taint from its operands, as its handler in
+       * x86Semantics does: the destination is assigned or merged with the sources, and the flags
+       * take the taint of the result or are cleared. Spreading the taint of an instruction only
+       * looks up its summary and calls the taint engine on its decoded operands, no AST is built.
+       * The concrete state is not updated either, it is expected to be synchronized by the caller,
+       * as a tracer does.
+       */
+      class x86TaintSummaries {
+        private:
+          //! The ways an opcode spreads the taint.
+          enum kind_e {
+            KIND_NONE = 0,  //!< No summary, the semantics must be built.
+            KIND_ASSIGN,    //!< operands[0] <- operands[1]
+            KIND_UNION,     //!< operands[0] <- operands[0] U operands[1]
+            KIND_UNION_CF,  //!< operands[0] <- operands[0] U operands[1] U cf
+            KIND_COMPARE,   //!< operands[0] U operands[1], without write
+            KIND_UNARY,     //!< operands[0] <- operands[0]
+            KIND_LEA,       //!< operands[0] <- base U index
+            KIND_PUSH,      //!< [sp - size] <- operands[0]
+            KIND_POP,       //!< operands[0] <- [sp]
+          };
+
+          //! The flags taken into account by the summaries.
+          enum flag_e {
+            FLAG_AF = (1 << 0), //!< af
+            FLAG_CF = (1 << 1), //!< cf
+            FLAG_OF = (1 << 2), //!< of
+            FLAG_PF = (1 << 3), //!< pf
+            FLAG_SF = (1 << 4), //!< sf
+            FLAG_ZF = (1 << 5), //!< zf
+          };
+
+          //! The summary of an opcode.
+          struct Summary {
+            //! How the operands are spread.
+            kind_e kind;
+
+            //! The flags which take the taint of the result.
+            triton::uint8 spreadFlags;
+
+            //! The flags which are untainted.
+            triton::uint8 clearFlags;
+          };
+
+          //! Architecture API
+          triton::arch::Architecture* architecture;
+
+          //! Taint Engine API
+          triton::engines::taint::TaintEngine* taintEngine;
+
+          //! The summaries, indexed by opcode.
+          std::vector<Summary> summaries;
+
+          //! Returns true if the summary of the instruction covers all its effects on the taint.
+          bool isSupported(const triton::arch::Instruction& inst, const Summary& summary) const;
+
+          //! Initializes the address of a memory access from the concrete values of its registers, if it is not already defined.
+          void initAddress(triton::arch::MemoryAccess& mem) const;
+
+          //! Sets the taint of the flags of `mask` to `flag`.
+          void setFlags(triton::uint8 mask, bool flag);
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT x86TaintSummaries(triton::arch::Architecture* architecture, triton::engines::taint::TaintEngine* taintEngine);
+
+          //! Returns true if the instruction has a summary.
+          TRITON_EXPORT bool hasSummary(const triton::arch::Instruction& inst) const;
+
+          //! Spreads the taint of the instruction from its summary. Returns false, and changes nothing, if the instruction has no summary.
+          TRITON_EXPORT bool spread(triton::arch::Instruction& inst);
+      };
+
+    /*! @} End of x86 namespace */
+    };
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_X86TAINTSUMMARIES_H */
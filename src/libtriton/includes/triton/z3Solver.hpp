@@ -8,8 +8,11 @@
 #ifndef TRITON_Z3SOLVER_H
 #define TRITON_Z3SOLVER_H
 
+#include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <z3++.h>
 #include <z3_api.h>
@@ -19,6 +22,8 @@
 #include <triton/solverEnums.hpp>
 #include <triton/solverInterface.hpp>
 #include <triton/solverModel.hpp>
+#include <triton/termCache.hpp>
+#include <triton/tritonToZ3.hpp>
 #include <triton/tritonTypes.hpp>
 
 
@@ -57,9 +62,51 @@ namespace triton {
           //! The SMT solver memory limit. By default, unlimited.
           triton::uint32 memoryLimit;
 
+          //! The converter of the queries, kept from one query to the next. It owns the z3's context of the queries.
+          mutable std::unique_ptr<triton::ast::TritonToZ3> queryAst;
+
+          //! The nodes of the queries already converted, so that a query converts only the nodes the previous ones did not hold.
+          mutable triton::ast::TermCache<z3::expr> queryTerms;
+
+          //! The converter of the solver session. It owns the z3's context of the session.
+          std::unique_ptr<triton::ast::TritonToZ3> sessionAst;
+
+          //! The nodes of the solver session already converted.
+          triton::ast::TermCache<z3::expr> sessionTerms;
+
+          //! The solver of the solver session.
+          std::unique_ptr<z3::solver> session;
+
+          //! The number of scopes opened in the solver session.
+          triton::uint32 sessionScopes;
+
+          //! Protects the contexts of the running queries.
+          mutable std::mutex runningLock;
+
+          //! The contexts of the running queries, interrupted by `interrupt()`.
+          mutable std::unordered_set<z3::context*> running;
+
+          //! True once the solver is interrupted.
+          bool interrupted;
+
+          //! Checks the assertions of `solver` under the `assumptions` if they are not null, unless the solver is interrupted. The check may be interrupted by another thread.
+          z3::check_result check(z3::solver& solver, const z3::expr_vector* assumptions = nullptr) const;
+
+          //! Returns a solver of the z3's context `ctx`, built from the tactics of the profile of the query if it has some (see `SolverProfileScope`).
+          z3::solver newSolver(z3::context& ctx) const;
+
           //! Writes back the status code of the solver into the pointer pointed by status.
           void writeBackStatus(z3::solver& solver, z3::check_result res, triton::engines::solver::status_e* status) const;
 
+          //! Converts a query, reusing the nodes converted by the previous ones.
+          z3::expr convertQuery(const triton::ast::SharedAbstractNode& node) const;
+
+          //! Creates the solver session if there is none.
+          void initSession(void);
+
+          //! Converts a logical node of the solver session.
+          z3::expr convertSessionNode(const triton::ast::SharedAbstractNode& node, const char* where);
+
         public:
           //! Constructor.
           TRITON_EXPORT Z3Solver();
@@ -82,9 +129,22 @@ namespace triton {
            */
           TRITON_EXPORT std::vector<std::unordered_map<triton::usize, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
 
+          /*!
+           * \brief Computes at most `limit` models from a symbolic constraint and gives them to `callback` as they are found. Returns the number of models given.
+           *
+           * \details
+           * The models are enumerated by one solver, each model found blocks its values for the next check. If `variables` is not
+           * empty, only these variables are reported and blocked. State is returned in the `status` pointer as well as the solving time.
+           * A `timeout` can also be defined.
+           */
+          TRITON_EXPORT triton::usize enumerateModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, const ModelCallback& callback, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& variables = {}, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
           //! Returns true if an expression is satisfiable.
           TRITON_EXPORT bool isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
 
+          //! Returns an UNSAT core of `conjuncts`, the ones whose tracking literal is in the core of the solver, or an empty vector if their conjunction is not UNSAT.
+          TRITON_EXPORT std::vector<triton::ast::SharedAbstractNode> getUnsatCore(const std::vector<triton::ast::SharedAbstractNode>& conjuncts, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
           //! Converts a Triton's AST to a Z3's AST, perform a Z3 simplification and returns a Triton's AST.
           TRITON_EXPORT triton::ast::SharedAbstractNode simplify(const triton::ast::SharedAbstractNode& node) const;
 
@@ -99,6 +159,30 @@ namespace triton {
 
           //! Defines a solver memory consumption limit (in megabytes).
           TRITON_EXPORT void setMemoryLimit(triton::uint32 mem);
+
+          //! Asserts a constraint into the solver session. The nodes shared with the previous constraints are not converted again.
+          TRITON_EXPORT void pushConstraint(const triton::ast::SharedAbstractNode& node);
+
+          //! Opens a new scope in the solver session.
+          TRITON_EXPORT void push(void);
+
+          //! Closes the `count` innermost scopes of the solver session and drops their constraints.
+          TRITON_EXPORT void pop(triton::uint32 count = 1);
+
+          //! Computes a model of the constraints of the solver session and of the `assumptions`, which are not kept once the check is done.
+          /*! \brief map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT std::unordered_map<triton::usize, SolverModel> checkWithAssumptions(const std::vector<triton::ast::SharedAbstractNode>& assumptions, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr);
+
+          //! Drops all the scopes and constraints of the solver session.
+          TRITON_EXPORT void resetSession(void);
+
+          //! Interrupts the running queries, from any thread. They and the next ones return UNKNOWN.
+          TRITON_EXPORT void interrupt(void);
       };
 
     /*! @} End of solver namespace */
@@ -8,6 +8,8 @@
 #ifndef TRITON_Z3TOTRITONAST_H
 #define TRITON_Z3TOTRITONAST_H
 
+#include <unordered_map>
+
 #include <z3++.h>
 
 #include <triton/ast.hpp>
@@ -38,6 +40,15 @@ namespace triton {
         //! The Triton's AST context
         triton::ast::SharedAstContext astCtxt;
 
+        //! The nodes converted by the current `convert()`, by Z3 AST id.
+        std::unordered_map<unsigned, SharedAbstractNode> nodes;
+
+        //! Returns the converted argument `index` of `expr`.
+        const SharedAbstractNode& child(const z3::expr& expr, triton::uint32 index) const;
+
+        //! Converts an application whose arguments are converted.
+        SharedAbstractNode visit(const z3::expr& expr);
+
       public:
         //! Constructor.
         TRITON_EXPORT Z3ToTriton(const triton::ast::SharedAstContext& ctxt);
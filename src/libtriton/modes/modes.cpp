@@ -14,6 +14,7 @@ namespace triton {
   namespace modes {
 
     Modes::Modes() {
+      this->enabledModes = 0;
       this->setMode(triton::modes::PC_TRACKING_SYMBOLIC, true); /* This mode is enabled by default */
     }
 
@@ -34,23 +35,16 @@ namespace triton {
     }
 
 
-    bool Modes::isModeEnabled(triton::modes::mode_e mode) const {
-      if (this->enabledModes.find(mode) != this->enabledModes.end())
-        return true;
-      return false;
-    }
-
-
     void Modes::setMode(triton::modes::mode_e mode, bool flag) {
       if (flag == true)
-        this->enabledModes.insert(mode);
+        this->enabledModes |= triton::modes::modeMask(mode);
       else
-        this->enabledModes.erase(mode);
+        this->enabledModes &= ~triton::modes::modeMask(mode);
     }
 
 
     void Modes::clearModes(void) {
-      this->enabledModes.clear();
+      this->enabledModes = 0;
     }
 
   }; /* modes namespace */
@@ -8,6 +8,10 @@
 #include <triton/coreUtils.hpp>
 #include <triton/cpuSize.hpp>
 
+#if defined(_MSC_VER)
+  #include <intrin.h>
+#endif
+
 
 
 /*
@@ -80,5 +84,96 @@ namespace triton {
       return value;
     }
 
+
+    triton::uint32 popcount(triton::uint64 value) {
+      #if defined(__GNUC__) || defined(__clang__)
+        return static_cast<triton::uint32>(__builtin_popcountll(value));
+      #elif defined(_MSC_VER) && defined(_M_X64)
+        return static_cast<triton::uint32>(__popcnt64(value));
+      #else
+        value = value - ((value >> 1) & 0x5555555555555555ULL);
+        value = (value & 0x3333333333333333ULL) + ((value >> 2) & 0x3333333333333333ULL);
+        value = (value + (value >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+        return static_cast<triton::uint32>((value * 0x0101010101010101ULL) >> 56);
+      #endif
+    }
+
+
+    triton::uint32 popcount(triton::uint512 value) {
+      triton::uint32 count = 0;
+      while (value != 0) {
+        count += popcount((value & 0xffffffffffffffffULL).convert_to<triton::uint64>());
+        value >>= triton::bitsize::qword;
+      }
+      return count;
+    }
+
+
+    /* Returns the mask of a `size`-bit value */
+    static triton::uint512 sizeMask(triton::uint32 size) {
+      triton::uint512 mask = -1;
+      return mask >> (512 - size);
+    }
+
+
+    /* Spreads the most significant bit of each lane over its lane */
+    static triton::uint512 spreadSigns(const triton::uint512& signs, triton::uint32 size, triton::uint32 lane) {
+      triton::uint512 low = signs >> (lane - 1);
+      return ((low << lane) - low) & sizeMask(size);
+    }
+
+
+    triton::uint512 laneSigns(triton::uint32 size, triton::uint32 lane) {
+      triton::uint512 signs = 0;
+      for (triton::uint32 index = lane - 1; index < size; index += lane)
+        signs |= triton::uint512(1) << index;
+      return signs;
+    }
+
+
+    /*
+     * The lane-wise operations work on all the lanes at once (SWAR): the most significant
+     * bit of each lane is handled apart so that no carry nor borrow crosses a lane.
+     */
+    triton::uint512 laneAdd(const triton::uint512& value1, const triton::uint512& value2, triton::uint32 size, triton::uint32 lane) {
+      triton::uint512 signs = laneSigns(size, lane);
+      triton::uint512 low   = sizeMask(size) & ~signs;
+      return (((value1 & low) + (value2 & low)) ^ ((value1 ^ value2) & signs)) & sizeMask(size);
+    }
+
+
+    triton::uint512 laneSub(const triton::uint512& value1, const triton::uint512& value2, triton::uint32 size, triton::uint32 lane) {
+      triton::uint512 signs = laneSigns(size, lane);
+      triton::uint512 low   = sizeMask(size) & ~signs;
+      return (((value1 | signs) - (value2 & low)) ^ ((value1 ^ ~value2) & signs)) & sizeMask(size);
+    }
+
+
+    triton::uint512 laneEq(const triton::uint512& value1, const triton::uint512& value2, triton::uint32 size, triton::uint32 lane) {
+      triton::uint512 signs = laneSigns(size, lane);
+      triton::uint512 low   = sizeMask(size) & ~signs;
+      triton::uint512 diff  = (value1 ^ value2) & sizeMask(size);
+      /* The most significant bit of a lane is set if one of its bits is set */
+      triton::uint512 nonzero = (((diff & low) + low) | diff) & signs;
+      return spreadSigns(signs & ~nonzero, size, lane);
+    }
+
+
+    triton::uint512 laneSgt(const triton::uint512& value1, const triton::uint512& value2, triton::uint32 size, triton::uint32 lane) {
+      triton::uint512 signs = laneSigns(size, lane);
+      /* The signed comparison is the unsigned one with flipped signs, x > y if y - x borrows */
+      triton::uint512 x = (value1 ^ signs) & sizeMask(size);
+      triton::uint512 y = (value2 ^ signs) & sizeMask(size);
+      triton::uint512 diff = laneSub(y, x, size, lane);
+      triton::uint512 borrows = ((~y & x) | (~(y ^ x) & diff)) & signs;
+      return spreadSigns(borrows, size, lane);
+    }
+
+
+    triton::uint512 laneSelect(const triton::uint512& mask, const triton::uint512& value1, const triton::uint512& value2, triton::uint32 size, triton::uint32 lane) {
+      triton::uint512 selected = spreadSigns(mask & laneSigns(size, lane), size, lane);
+      return ((value1 & selected) | (value2 & ~selected)) & sizeMask(size);
+    }
+
   }; /* utils namespace */
 }; /* triton namespace */
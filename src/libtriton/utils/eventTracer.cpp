@@ -0,0 +1,130 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <iomanip>
+
+#include <triton/eventTracer.hpp>
+#include <triton/exceptions.hpp>
+
+
+
+namespace triton {
+  namespace utils {
+
+    EventTracer::EventTracer(triton::usize capacity) {
+      if (capacity == 0)
+        throw triton::exceptions::API("EventTracer::EventTracer(): The capacity must not be 0.");
+
+      this->enabled.store(false, std::memory_order_relaxed);
+      this->epoch    = std::chrono::steady_clock::now();
+      this->capacity = capacity;
+      this->next     = 0;
+      this->recorded = 0;
+    }
+
+
+    void EventTracer::setEnabled(bool flag) {
+      this->enabled.store(flag, std::memory_order_relaxed);
+    }
+
+
+    triton::usize EventTracer::getCapacity(void) const {
+      std::lock_guard<std::mutex> guard(this->lock);
+      return this->capacity;
+    }
+
+
+    void EventTracer::setCapacity(triton::usize capacity) {
+      if (capacity == 0)
+        throw triton::exceptions::API("EventTracer::setCapacity(): The capacity must not be 0.");
+
+      std::lock_guard<std::mutex> guard(this->lock);
+      this->capacity = capacity;
+      this->events.clear();
+      this->events.shrink_to_fit();
+      this->next     = 0;
+      this->recorded = 0;
+    }
+
+
+    triton::uint64 EventTracer::now(void) const {
+      return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - this->epoch).count();
+    }
+
+
+    void EventTracer::record(const char* name, const char* category, triton::uint64 start, triton::uint64 duration, triton::uint64 value) {
+      std::lock_guard<std::mutex> guard(this->lock);
+
+      auto it = this->threads.find(std::this_thread::get_id());
+      if (it == this->threads.end())
+        it = this->threads.insert({std::this_thread::get_id(), static_cast<triton::uint32>(this->threads.size() + 1)}).first;
+
+      TraceEvent event = {name, category, start, duration, it->second, value};
+
+      /* The buffer grows up to its capacity, then the oldest events are overwritten */
+      if (this->events.size() < this->capacity)
+        this->events.push_back(event);
+      else
+        this->events[this->next] = event;
+
+      this->next = (this->next + 1) % this->capacity;
+      this->recorded++;
+    }
+
+
+    std::vector<TraceEvent> EventTracer::getEvents(void) const {
+      std::lock_guard<std::mutex> guard(this->lock);
+
+      if (this->events.size() < this->capacity)
+        return this->events;
+
+      std::vector<TraceEvent> events;
+      events.reserve(this->events.size());
+      events.insert(events.end(), this->events.begin() + this->next, this->events.end());
+      events.insert(events.end(), this->events.begin(), this->events.begin() + this->next);
+      return events;
+    }
+
+
+    triton::usize EventTracer::getDropped(void) const {
+      std::lock_guard<std::mutex> guard(this->lock);
+      return this->recorded - this->events.size();
+    }
+
+
+    void EventTracer::clear(void) {
+      std::lock_guard<std::mutex> guard(this->lock);
+      this->events.clear();
+      this->next     = 0;
+      this->recorded = 0;
+    }
+
+
+    /* Writes nanoseconds as microseconds, the unit of the Chrome traces */
+    static void writeMicroseconds(std::ostream& stream, triton::uint64 ns) {
+      stream << (ns / 1000) << "." << std::setw(3) << std::setfill('0') << (ns % 1000) << std::setfill(' ');
+    }
+
+
+    void EventTracer::writeChromeTrace(std::ostream& stream) const {
+      std::vector<TraceEvent> events = this->getEvents();
+
+      stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+      for (triton::usize index = 0; index < events.size(); index++) {
+        const TraceEvent& event = events[index];
+        stream << (index ? ",\n" : "\n");
+        stream << "{\"name\":\"" << event.name << "\",\"cat\":\"" << event.category << "\",\"ph\":\"X\",\"ts\":";
+        writeMicroseconds(stream, event.start);
+        stream << ",\"dur\":";
+        writeMicroseconds(stream, event.duration);
+        stream << ",\"pid\":1,\"tid\":" << event.thread << ",\"args\":{\"value\":" << event.value << "}}";
+      }
+      stream << "\n]}\n";
+    }
+
+  }; /* utils namespace */
+}; /* triton namespace */
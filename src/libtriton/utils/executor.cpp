@@ -0,0 +1,274 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <chrono>
+
+#include <triton/exceptions.hpp>
+#include <triton/executor.hpp>
+
+
+
+namespace triton {
+  namespace utils {
+
+    /* The executor and the index of the calling thread, if it is a worker */
+    static thread_local const Executor* currentExecutor = nullptr;
+    static thread_local triton::sint32 currentWorker = -1;
+
+
+    ExecutorTask::ExecutorTask(const std::function<void(const ExecutorTask&)>& function, triton::utils::priority_e priority) {
+      if (priority >= PRIORITY_LAST)
+        throw triton::exceptions::API("ExecutorTask::ExecutorTask(): Invalid priority.");
+
+      this->cancelled.store(false);
+      this->done     = false;
+      this->error    = nullptr;
+      this->function = function;
+      this->priority = priority;
+    }
+
+
+    void ExecutorTask::cancel(void) {
+      this->cancelled.store(true);
+    }
+
+
+    bool ExecutorTask::isCancelled(void) const {
+      return this->cancelled.load();
+    }
+
+
+    bool ExecutorTask::isDone(void) const {
+      std::lock_guard<std::mutex> guard(this->lock);
+      return this->done;
+    }
+
+
+    triton::utils::priority_e ExecutorTask::getPriority(void) const {
+      return this->priority;
+    }
+
+
+    Executor::Executor(triton::usize threads) {
+      this->queued   = 0;
+      this->stopping = false;
+      this->start(std::max<triton::usize>(1, threads));
+    }
+
+
+    Executor::~Executor() {
+      std::lock_guard<std::mutex> guard(this->resizing);
+      this->stop();
+
+      /* The queued tasks are done, cancelled */
+      for (auto& queue : this->global.tasks) {
+        for (const auto& task : queue) {
+          task->cancel();
+          Executor::run(*task);
+        }
+        queue.clear();
+      }
+    }
+
+
+    Executor& Executor::getDefault(void) {
+      /* Never destroyed, so that the contexts destroyed at exit may still wait for their tasks */
+      static Executor* executor = new Executor(std::thread::hardware_concurrency());
+      return *executor;
+    }
+
+
+    triton::sint32 Executor::getWorker(void) const {
+      return (currentExecutor == this) ? currentWorker : -1;
+    }
+
+
+    SharedExecutorTask Executor::submit(const std::function<void(const ExecutorTask&)>& function, triton::utils::priority_e priority) {
+      SharedExecutorTask task = std::make_shared<ExecutorTask>(function, priority);
+      triton::sint32 worker = this->getWorker();
+
+      /* Counted first, so that a worker never takes a task which is not counted yet */
+      {
+        std::lock_guard<std::mutex> guard(this->lock);
+        this->queued++;
+      }
+
+      Queues& queues = (worker >= 0) ? *this->local[worker] : this->global;
+      {
+        std::lock_guard<std::mutex> guard(queues.lock);
+        queues.tasks[priority].push_back(task);
+      }
+
+      this->available.notify_one();
+      return task;
+    }
+
+
+    SharedExecutorTask Executor::take(triton::sint32 worker, triton::utils::priority_e priority) {
+      SharedExecutorTask task = nullptr;
+
+      for (triton::usize level = 0; level <= static_cast<triton::usize>(priority) && task == nullptr; level++) {
+        /* Its own queue, the last task first */
+        if (worker >= 0) {
+          Queues& queues = *this->local[worker];
+          std::lock_guard<std::mutex> guard(queues.lock);
+          if (!queues.tasks[level].empty()) {
+            task = queues.tasks[level].back();
+            queues.tasks[level].pop_back();
+          }
+        }
+
+        /* Then the tasks submitted by the other threads */
+        if (task == nullptr) {
+          std::lock_guard<std::mutex> guard(this->global.lock);
+          if (!this->global.tasks[level].empty()) {
+            task = this->global.tasks[level].front();
+            this->global.tasks[level].pop_front();
+          }
+        }
+
+        /* Then the workers steal the first tasks of the other ones */
+        for (triton::usize index = 1; worker >= 0 && index < this->local.size() && task == nullptr; index++) {
+          Queues& queues = *this->local[(worker + index) % this->local.size()];
+          std::lock_guard<std::mutex> guard(queues.lock);
+          if (!queues.tasks[level].empty()) {
+            task = queues.tasks[level].front();
+            queues.tasks[level].pop_front();
+          }
+        }
+      }
+
+      if (task != nullptr) {
+        std::lock_guard<std::mutex> guard(this->lock);
+        this->queued--;
+      }
+
+      return task;
+    }
+
+
+    void Executor::run(ExecutorTask& task) {
+      std::exception_ptr error = nullptr;
+
+      if (!task.isCancelled()) {
+        try {
+          task.function(task);
+        }
+        catch (...) {
+          error = std::current_exception();
+        }
+      }
+
+      /* Releases what the function captured before the waiters wake up */
+      task.function = nullptr;
+
+      std::lock_guard<std::mutex> guard(task.lock);
+      task.error = error;
+      task.done  = true;
+      task.finished.notify_all();
+    }
+
+
+    void Executor::wait(const SharedExecutorTask& task) {
+      if (task == nullptr)
+        throw triton::exceptions::API("Executor::wait(): The task must be defined.");
+
+      triton::sint32 worker = this->getWorker();
+
+      while (!task->isDone()) {
+        /*
+         * The other threads only take the tasks submitted by the other threads, the queues of the workers
+         * may be rebuilt by setThreads() meanwhile. The tasks submitted by a worker are its own business.
+         */
+        SharedExecutorTask other = this->take(worker, task->getPriority());
+        if (other != nullptr) {
+          Executor::run(*other);
+          continue;
+        }
+
+        /* Nothing to run, the task is running or taken by another thread */
+        std::unique_lock<std::mutex> guard(task->lock);
+        task->finished.wait_for(guard, std::chrono::milliseconds(1), [&]() { return task->done; });
+      }
+
+      std::lock_guard<std::mutex> guard(task->lock);
+      if (task->error != nullptr)
+        std::rethrow_exception(task->error);
+    }
+
+
+    triton::usize Executor::getThreads(void) const {
+      std::lock_guard<std::mutex> guard(this->lock);
+      return this->workers.size();
+    }
+
+
+    void Executor::setThreads(triton::usize threads) {
+      if (this->getWorker() >= 0)
+        throw triton::exceptions::API("Executor::setThreads(): Cannot be called by a task of the executor.");
+
+      std::lock_guard<std::mutex> guard(this->resizing);
+      this->stop();
+      this->start(std::max<triton::usize>(1, threads));
+    }
+
+
+    void Executor::start(triton::usize threads) {
+      std::lock_guard<std::mutex> guard(this->lock);
+
+      this->stopping = false;
+      for (triton::usize index = 0; index < threads; index++)
+        this->local.emplace_back(new Queues());
+      for (triton::usize index = 0; index < threads; index++)
+        this->workers.emplace_back(&Executor::work, this, index);
+    }
+
+
+    void Executor::stop(void) {
+      {
+        std::lock_guard<std::mutex> guard(this->lock);
+        this->stopping = true;
+      }
+
+      this->available.notify_all();
+      for (auto& worker : this->workers)
+        worker.join();
+
+      /* The tasks left in the queues of the workers are moved to the global ones */
+      std::lock_guard<std::mutex> guard(this->lock);
+      std::lock_guard<std::mutex> globalGuard(this->global.lock);
+      for (auto& queues : this->local) {
+        for (triton::usize level = 0; level < PRIORITY_LAST; level++)
+          this->global.tasks[level].insert(this->global.tasks[level].end(), queues->tasks[level].begin(), queues->tasks[level].end());
+      }
+      this->local.clear();
+      this->workers.clear();
+    }
+
+
+    void Executor::work(triton::usize index) {
+      currentExecutor = this;
+      currentWorker   = static_cast<triton::sint32>(index);
+
+      while (true) {
+        /* A stopped worker leaves its queued tasks to the next ones */
+        {
+          std::unique_lock<std::mutex> guard(this->lock);
+          this->available.wait(guard, [this]() { return this->stopping || this->queued > 0; });
+          if (this->stopping)
+            return;
+        }
+
+        SharedExecutorTask task = this->take(currentWorker, PRIORITY_LOW);
+        if (task != nullptr)
+          Executor::run(*task);
+      }
+    }
+
+  }; /* utils namespace */
+}; /* triton namespace */
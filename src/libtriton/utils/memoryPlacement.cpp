@@ -0,0 +1,210 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <new>
+#include <vector>
+
+#include <triton/exceptions.hpp>
+#include <triton/memoryPlacement.hpp>
+
+#if defined(_WIN32)
+  #include <windows.h>
+#elif defined(__linux__)
+  #include <sys/mman.h>
+  #include <sys/syscall.h>
+  #include <unistd.h>
+#endif
+
+
+
+namespace triton {
+  namespace utils {
+
+    MemoryPlacement::MemoryPlacement() {
+      this->hugePages    = HUGE_PAGES_NONE;
+      this->numaNode     = -1;
+      this->allocateHook = nullptr;
+      this->releaseHook  = nullptr;
+      this->hookData     = nullptr;
+    }
+
+
+    void MemoryPlacement::setHugePages(triton::utils::huge_pages_e kind) {
+      switch (kind) {
+        case HUGE_PAGES_NONE:
+        case HUGE_PAGES_TRANSPARENT:
+        case HUGE_PAGES_EXPLICIT:
+          this->hugePages = kind;
+          break;
+        default:
+          throw triton::exceptions::API("MemoryPlacement::setHugePages(): Invalid kind of huge pages.");
+      }
+    }
+
+
+    triton::utils::huge_pages_e MemoryPlacement::getHugePages(void) const {
+      return this->hugePages;
+    }
+
+
+    void MemoryPlacement::setNumaNode(triton::sint32 node) {
+      if (node < -1)
+        throw triton::exceptions::API("MemoryPlacement::setNumaNode(): Invalid NUMA node.");
+      this->numaNode = node;
+    }
+
+
+    triton::sint32 MemoryPlacement::getNumaNode(void) const {
+      return this->numaNode;
+    }
+
+
+    void MemoryPlacement::setHooks(AllocateHook allocate, ReleaseHook release, void* data) {
+      if ((allocate == nullptr) != (release == nullptr))
+        throw triton::exceptions::API("MemoryPlacement::setHooks(): Both hooks must be defined, or none.");
+
+      this->allocateHook = allocate;
+      this->releaseHook  = release;
+      this->hookData     = data;
+    }
+
+
+    bool MemoryPlacement::isDefault(void) const {
+      return this->allocateHook == nullptr && this->hugePages == HUGE_PAGES_NONE && this->numaNode == -1;
+    }
+
+
+    triton::usize MemoryPlacement::getGranularity(void) const {
+      if (this->allocateHook == nullptr && this->hugePages != HUGE_PAGES_NONE)
+        return this->hugePageSize;
+      return 0;
+    }
+
+
+    triton::usize MemoryPlacement::reserved(triton::usize size) const {
+      triton::usize granularity = this->getGranularity();
+      if (granularity == 0)
+        return size;
+      return (size + granularity - 1) / granularity * granularity;
+    }
+
+
+    void* MemoryPlacement::allocate(triton::usize size) const {
+      if (this->allocateHook != nullptr) {
+        void* p = this->allocateHook(size, this->hookData);
+        if (p == nullptr)
+          throw std::bad_alloc();
+        return p;
+      }
+
+      if (this->isDefault())
+        return ::operator new(size);
+
+      triton::usize length = this->reserved(size);
+
+      #if defined(_WIN32)
+        DWORD node = (this->numaNode == -1) ? NUMA_NO_PREFERRED_NODE : static_cast<DWORD>(this->numaNode);
+        void* p = nullptr;
+
+        /* Large pages need the SeLockMemoryPrivilege, regular ones are used without it */
+        if (this->hugePages == HUGE_PAGES_EXPLICIT)
+          p = VirtualAllocExNuma(GetCurrentProcess(), nullptr, length, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE, node);
+        if (p == nullptr)
+          p = VirtualAllocExNuma(GetCurrentProcess(), nullptr, length, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE, node);
+        if (p == nullptr)
+          throw std::bad_alloc();
+
+        return p;
+
+      #elif defined(__linux__)
+        char* p = nullptr;
+
+        /* Explicit huge pages are only available if some are reserved (vm.nr_hugepages) */
+        if (this->hugePages == HUGE_PAGES_EXPLICIT) {
+          void* block = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+          if (block != MAP_FAILED)
+            p = static_cast<char*>(block);
+        }
+
+        if (p == nullptr) {
+          /* Transparent huge pages need a block aligned on them, the extra is unmapped */
+          triton::usize extra = (this->hugePages != HUGE_PAGES_NONE) ? this->hugePageSize : 0;
+          void* block = mmap(nullptr, length + extra, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+          if (block == MAP_FAILED)
+            throw std::bad_alloc();
+
+          p = static_cast<char*>(block);
+          if (extra) {
+            triton::usize head = (this->hugePageSize - (reinterpret_cast<triton::usize>(p) & (this->hugePageSize - 1))) & (this->hugePageSize - 1);
+            if (head)
+              munmap(p, head);
+            if (extra - head)
+              munmap(p + head + length, extra - head);
+            p += head;
+            #if defined(MADV_HUGEPAGE)
+              madvise(p, length, MADV_HUGEPAGE);
+            #endif
+          }
+        }
+
+        /* The node is preferred, not required: the pages come from another node if it is full. Must be done before they are touched */
+        #if defined(SYS_mbind)
+          if (this->numaNode != -1) {
+            const triton::usize bits = sizeof(unsigned long) * 8;
+            std::vector<unsigned long> mask(this->numaNode / bits + 1, 0);
+            mask[this->numaNode / bits] |= 1UL << (this->numaNode % bits);
+            syscall(SYS_mbind, p, length, 1 /* MPOL_PREFERRED */, mask.data(), mask.size() * bits + 1, 0);
+          }
+        #endif
+
+        return p;
+
+      #else
+        return ::operator new(size);
+      #endif
+    }
+
+
+    void MemoryPlacement::release(void* p, triton::usize size) const {
+      if (p == nullptr)
+        return;
+
+      if (this->releaseHook != nullptr) {
+        this->releaseHook(p, size, this->hookData);
+        return;
+      }
+
+      if (this->isDefault()) {
+        ::operator delete(p);
+        return;
+      }
+
+      #if defined(_WIN32)
+        VirtualFree(p, 0, MEM_RELEASE);
+      #elif defined(__linux__)
+        munmap(p, this->reserved(size));
+      #else
+        ::operator delete(p);
+      #endif
+    }
+
+
+    bool MemoryPlacement::operator==(const MemoryPlacement& other) const {
+      return this->hugePages    == other.hugePages    &&
+             this->numaNode     == other.numaNode     &&
+             this->allocateHook == other.allocateHook &&
+             this->releaseHook  == other.releaseHook  &&
+             this->hookData     == other.hookData;
+    }
+
+
+    bool MemoryPlacement::operator!=(const MemoryPlacement& other) const {
+      return !(*this == other);
+    }
+
+  }; /* utils namespace */
+}; /* triton namespace */
@@ -14,7 +14,7 @@ import operator
 from triton import *
 from random import randrange
 
-HOW_BIG_IS_THE_TABLE = 10
+HOW_BIG_IS_THE_TABLE = 16 # ORACLE_INPUTS in oracleEntry.hpp
 
 ctx = TritonContext(ARCH.X86_64) # does not matter of the architecture, we just need an AstContext
 ast = ctx.getAstContext()
@@ -47,111 +47,67 @@ binary_operators = [
 ]
 
 
+WIDTHS = [8, 16, 32, 64]
+
+
+def gen_input(bits, i, small=False):
+    if small:
+        # Special case for div, we need small number
+        return 1 << (i % (bits // 2))
+    # The upper half of the value is not null, the oracles use the whole width
+    return randrange(1 << (bits // 2), 1 << bits)
+
+
+def gen_values(values, bits):
+    width = bits // 4
+    return ', '.join(['0x%0*x' % (width, v) for v in values])
+
+
+def gen_results(operators, bits, evaluate):
+    # The results of the operators must differ, they index the table
+    results = [[evaluate(op, i) for i in range(HOW_BIG_IS_THE_TABLE)] for op, name, enum in operators]
+    if len(set(map(tuple, results))) != len(results):
+        return None
+    return results
+
+
 def gen_unary_operator():
-    for op, name, enum in unary_operators:
-        print('          /* %s synthesis */' %(name))
-        print('          {')
-        print('            %s, {' %(enum))
-        for i in range(HOW_BIG_IS_THE_TABLE):
-            stop = False
-            while not stop:
-                s1 = ast.bv(randrange(1, 0x100), 8)
-                r1 = op(s1)
-                if r1.evaluate() != 0:
-                    stop = True
-
-            stop = False
-            while not stop:
-                s2 = ast.bv(randrange(0x100, 0x10000), 16)
-                r2 = op(s2)
-                if r2.evaluate() != 0:
-                    stop = True
-
-            stop = False
-            while not stop:
-                s3 = ast.bv(randrange(0x10000, 0x100000000), 32)
-                r3 = op(s3)
-                if r3.evaluate() != 0:
-                    stop = True
-
-            stop = False
-            while not stop:
-                s4 = ast.bv(randrange(0x100000000, 0x10000000000000000), 64)
-                r4 = op(s4)
-                if r4.evaluate() != 0:
-                    stop = True
-
-            print('              UnaryEntry(8, 0x%02x, 0x%02x), UnaryEntry(16, 0x%04x, 0x%04x), UnaryEntry(32, 0x%08x, 0x%08x), UnaryEntry(64, 0x%016x, 0x%016x),'
-                % (s1.evaluate(), r1.evaluate(), s2.evaluate(), r2.evaluate(), s3.evaluate(), r3.evaluate(), s4.evaluate(), r4.evaluate())
-            )
+    for bits in WIDTHS:
+        # Ignore bswap oracle for 8 bit value, it is the identity
+        operators = [o for o in unary_operators if not (bits == 8 and o[1] == 'bswap')]
+        results = None
+        while results is None:
+            x = [gen_input(bits, i) for i in range(HOW_BIG_IS_THE_TABLE)]
+            results = gen_results(operators, bits, lambda op, i: op(ast.bv(x[i], bits)).evaluate())
+        print('          /* %d-bit oracles */' %(bits))
+        print('          UnaryOracleTable(%d,' %(bits))
+        print('            /* x */ {%s},' %(gen_values(x, bits)))
+        print('            {')
+        for (op, name, enum), r in zip(operators, results):
+            print('              /* %s synthesis */' %(name))
+            print('              {%s, {%s}},' %(enum, gen_values(r, bits)))
         print('            }')
-        print('          },')
+        print('          ),')
     return
 
 
 def gen_binary_operator():
-    for op, name, enum in binary_operators:
-        print('          /* %s synthesis */' %(name))
-        print('          {')
-        print('            %s, {' %(enum))
-        for i in range(HOW_BIG_IS_THE_TABLE):
-            stop = False
-            while not stop:
-                s1 = ast.bv(randrange(1, 0x100), 8)
-                s2 = ast.bv(randrange(1, 0x100), 8)
-
-                # Special case for div, we need small number
-                if name in ['bvsdiv', 'bvudiv']:
-                    s2 = ast.bv(1 << i % 7, 8)
-
-                r1 = op(s1, s2)
-                if r1.evaluate() != 0:
-                    stop = True
-
-            stop = False
-            while not stop:
-                s3 = ast.bv(randrange(0x100, 0x10000), 16)
-                s4 = ast.bv(randrange(0x100, 0x10000), 16)
-
-                # Special case for div, we need small number
-                if name in ['bvsdiv', 'bvudiv']:
-                    s4 = ast.bv(1 << i, 16)
-
-                r2 = op(s3, s4)
-                if r2.evaluate() != 0:
-                    stop = True
-
-            stop = False
-            while not stop:
-                s5 = ast.bv(randrange(0x10000, 0x100000000), 32)
-                s6 = ast.bv(randrange(0x10000, 0x100000000), 32)
-
-                # Special case for div, we need small number
-                if name in ['bvsdiv', 'bvudiv']:
-                    s6 = ast.bv(1 << i, 32)
-
-                r3 = op(s5, s6)
-                if r3.evaluate() != 0:
-                    stop = True
-
-            stop = False
-            while not stop:
-                s7 = ast.bv(randrange(0x100000000, 0x10000000000000000), 64)
-                s8 = ast.bv(randrange(0x100000000, 0x10000000000000000), 64)
-
-                # Special case for div, we need small number
-                if name in ['bvsdiv', 'bvudiv']:
-                    s8 = ast.bv(1 << i, 64)
-
-                r4 = op(s7, s8)
-                if r4.evaluate() != 0:
-                    stop = True
-
-            print('              BinaryEntry(8, 0x%02x, 0x%02x, 0x%02x), BinaryEntry(16, 0x%04x, 0x%04x, 0x%04x), BinaryEntry(32, 0x%08x, 0x%08x, 0x%08x), BinaryEntry(64, 0x%016x, 0x%016x, 0x%016x),'
-                % (s1.evaluate(), s2.evaluate(), r1.evaluate(), s3.evaluate(), s4.evaluate(), r2.evaluate(), s5.evaluate(), s6.evaluate(), r3.evaluate(), s7.evaluate(), s8.evaluate(), r4.evaluate())
-            )
+    for bits in WIDTHS:
+        results = None
+        while results is None:
+            x = [gen_input(bits, i) for i in range(HOW_BIG_IS_THE_TABLE)]
+            y = [gen_input(bits, i, i % 2 == 1) for i in range(HOW_BIG_IS_THE_TABLE)]
+            results = gen_results(binary_operators, bits, lambda op, i: op(ast.bv(x[i], bits), ast.bv(y[i], bits)).evaluate())
+        print('          /* %d-bit oracles */' %(bits))
+        print('          BinaryOracleTable(%d,' %(bits))
+        print('            /* x */ {%s},' %(gen_values(x, bits)))
+        print('            /* y */ {%s},' %(gen_values(y, bits)))
+        print('            {')
+        for (op, name, enum), r in zip(binary_operators, results):
+            print('              /* %s synthesis */' %(name))
+            print('              {%s, {%s}},' %(enum, gen_values(r, bits)))
         print('            }')
-        print('          },')
+        print('          ),')
     return
 
 
@@ -238,11 +194,10 @@ def main():
     print('*/')
     print('')
     print('#include <array>')
-    print('#include <deque>')
-    print('#include <map>')
     print('')
     print('#include <triton/astEnums.hpp>')
     print('#include <triton/oracleEntry.hpp>')
+    print('#include <triton/synthesizer.hpp>')
     print('')
     print('')
     print('')
@@ -251,16 +206,16 @@ def main():
     print('    namespace synthesis {')
     print('      namespace oracles {')
     print('')
-    print('        //! The oracle table for unary operators. Each entry is a UnaryEntry object.')
-    print('        /*! \\brief Entry: <bits> <x value> <result> <operator> */')
-    print('        std::map<triton::ast::ast_e, std::array<UnaryEntry, 40>> unopTable = {')
+    print('        //! The oracle tables for unary operators, by bit width. Each table is an UnaryOracleTable object.')
+    print('        /*! \\brief Table: <bits> <x values> {<operator> <results>} */')
+    print('        const std::array<UnaryOracleTable, 4> unopTable = {')
     gen_unary_operator()
     print('        };')
     print('')
     print('')
-    print('        //! The oracle table for binary operators. Each entry is a BinaryEntry object.')
-    print('        /*! \\brief Entry: <bits> <x value> <y value> <result> <operator> */')
-    print('        std::map<triton::ast::ast_e, std::array<BinaryEntry, 40>> binopTable = {')
+    print('        //! The oracle tables for binary operators, by bit width. Each table is a BinaryOracleTable object.')
+    print('        /*! \\brief Table: <bits> <x values> <y values> {<operator> <results>} */')
+    print('        const std::array<BinaryOracleTable, 4> binopTable = {')
     gen_binary_operator()
     print('        };')
     print('')
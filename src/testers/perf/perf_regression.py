@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+## -*- coding: utf-8 -*-
+##
+## Performance regression gate of the instruction semantics.
+##
+## Emulates pinned workloads (the samples of the unit tests) and measures the
+## instructions processed per second and the AST nodes allocated per instruction.
+## The results are compared against a baseline (JSON) and the script fails if a
+## workload is slower than `--tolerance` times its baseline throughput or builds
+## more than `--nodes-tolerance` extra nodes per instruction.
+##
+## If the baseline does not exist, it is recorded and the run passes. Record it
+## before a change of the semantics and run the gate again afterwards:
+##
+##   $ python3 perf_regression.py --baseline baseline.json --update
+##   ... change and rebuild ...
+##   $ python3 perf_regression.py --baseline baseline.json
+##
+## The throughput depends on the machine, a baseline is only meaningful on the
+## machine which recorded it. The nodes per instruction are deterministic.
+
+from __future__ import print_function
+from triton     import *
+
+import argparse
+import json
+import os
+import sys
+import time
+
+
+UNITTESTS = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'unittests')
+IR_SUITE  = os.path.join(UNITTESTS, 'misc', 'ir-test-suite.bin')
+IR_ENTRY  = 0x40065c
+
+
+def load_binary(ctx, filename):
+    import lief
+    binary = lief.parse(filename)
+    for phdr in binary.segments:
+        ctx.setConcreteMemoryAreaValue(phdr.virtual_address, phdr.content)
+
+
+def emulate_x86_64(ctx, pc):
+    while pc:
+        instruction = Instruction(pc, ctx.getConcreteMemoryAreaValue(pc, 16))
+        if not ctx.processing(instruction):
+            raise RuntimeError('Instruction not supported: %s' % instruction)
+        pc = ctx.getConcreteRegisterValue(ctx.registers.rip)
+
+
+def ir_suite(modes):
+    """Returns a workload emulating the ir test suite with `modes` enabled."""
+    def setup():
+        ctx = TritonContext(ARCH.X86_64)
+        for mode in modes:
+            ctx.setMode(mode, True)
+        load_binary(ctx, IR_SUITE)
+        ctx.setConcreteRegisterValue(ctx.registers.rbp, 0x7fffffff)
+        ctx.setConcreteRegisterValue(ctx.registers.rsp, 0x6fffffff)
+        return ctx
+    def run(ctx):
+        emulate_x86_64(ctx, IR_ENTRY)
+    return setup, run
+
+
+# The pinned workloads, by name
+WORKLOADS = [
+    ('ir-suite',                ir_suite([])),
+    ('ir-suite/hash-consing',   ir_suite([MODE.AST_HASH_CONSING])),
+    ('ir-suite/optimizations',  ir_suite([MODE.SYMBOLIZE_INDEX_ROTATION, MODE.AST_OPTIMIZATIONS])),
+    ('ir-suite/concrete',       ir_suite([MODE.ONLY_ON_SYMBOLIZED])),
+]
+
+
+def measure(setup, run, repeat):
+    """Returns the best throughput of `repeat` runs and the nodes per instruction."""
+    best  = None
+    nodes = 0.0
+    for _ in range(repeat):
+        ctx = setup()
+        ctx.setStatistics(True)
+        start = time.perf_counter()
+        run(ctx)
+        elapsed = time.perf_counter() - start
+        stats = ctx.getStatistics()
+        count = max(stats['instructions'], 1)
+        ips   = stats['instructions'] / elapsed if elapsed > 0 else 0.0
+        best  = ips if best is None else max(best, ips)
+        nodes = stats['nodes'] / count
+    return {'instructions_per_second': best, 'nodes_per_instruction': nodes, 'instructions': count}
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Performance regression gate of the instruction semantics.')
+    parser.add_argument('--baseline', default='perf-baseline.json', help='the baseline file (default: %(default)s)')
+    parser.add_argument('--update', action='store_true', help='record the baseline instead of comparing against it')
+    parser.add_argument('--repeat', type=int, default=3, help='the runs of each workload, the best one is kept (default: %(default)s)')
+    parser.add_argument('--tolerance', type=float, default=0.5,
+                        help='fails below this fraction of the baseline throughput (default: %(default)s)')
+    parser.add_argument('--nodes-tolerance', type=float, default=0.1,
+                        help='fails above this extra fraction of the baseline nodes per instruction (default: %(default)s)')
+    parser.add_argument('--filter', default='', help='only runs the workloads whose name contains this string')
+    args = parser.parse_args()
+
+    results = {}
+    for name, (setup, run) in WORKLOADS:
+        if args.filter in name:
+            results[name] = measure(setup, run, max(args.repeat, 1))
+
+    if args.update or not os.path.exists(args.baseline):
+        with open(args.baseline, 'w') as f:
+            json.dump(results, f, indent=2, sort_keys=True)
+        for name, result in sorted(results.items()):
+            print('%-26s %12.0f inst/s %8.2f nodes/inst' % (name, result['instructions_per_second'], result['nodes_per_instruction']))
+        print('[+] Baseline recorded in %s' % args.baseline)
+        return 0
+
+    with open(args.baseline) as f:
+        baseline = json.load(f)
+
+    failures = 0
+    for name, result in sorted(results.items()):
+        if name not in baseline:
+            print('%-26s %12.0f inst/s %8.2f nodes/inst (no baseline)' % (name, result['instructions_per_second'], result['nodes_per_instruction']))
+            continue
+
+        base   = baseline[name]
+        speed  = result['instructions_per_second'] / base['instructions_per_second'] if base['instructions_per_second'] else 1.0
+        growth = result['nodes_per_instruction'] / base['nodes_per_instruction'] - 1.0 if base['nodes_per_instruction'] else 0.0
+        status = 'ok'
+
+        if speed < args.tolerance:
+            status = 'SLOWER'
+        if growth > args.nodes_tolerance:
+            status = 'MORE NODES' if status == 'ok' else status + ', MORE NODES'
+        if status != 'ok':
+            failures += 1
+
+        print('%-26s %12.0f inst/s (x%.2f) %8.2f nodes/inst (%+.1f%%) %s' % (
+            name, result['instructions_per_second'], speed, result['nodes_per_instruction'], growth * 100.0, status))
+
+    if failures:
+        print('[-] %d workload(s) regressed against %s' % (failures, args.baseline))
+        return 1
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
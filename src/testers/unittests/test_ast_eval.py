@@ -247,6 +247,69 @@ class TestAstEval(unittest.TestCase):
         ]
         self.check_ast(tests)
 
+    def test_parity(self):
+        """Check parity operations."""
+        tests = [
+            self.astCtxt.bvparity(self.astCtxt.bv(0, 8)),
+            self.astCtxt.bvparity(self.astCtxt.bv(1, 8)),
+            self.astCtxt.bvparity(self.astCtxt.bv(0x81, 8)),
+            self.astCtxt.bvparity(self.astCtxt.bv(0xff, 8)),
+            self.astCtxt.bvparity(self.astCtxt.bv(0x7f, 8)),
+            self.astCtxt.bvparity(self.astCtxt.bv(0x12345678, 32)),
+            self.astCtxt.bvparity(self.astCtxt.bv(0x12345679, 32)),
+            self.astCtxt.bvparity(self.astCtxt.bv(0xffffffffffffffff, 64)),
+            self.astCtxt.bvparity(self.astCtxt.bv(0x1ffffffffffffffff, 72)),
+            self.astCtxt.bvparity(self.astCtxt.bv(1, 1)),
+        ]
+        self.check_ast(tests)
+
+    def test_popcount(self):
+        """Check popcount operations."""
+        tests = [
+            self.astCtxt.bvpopcount(self.astCtxt.bv(0, 8)),
+            self.astCtxt.bvpopcount(self.astCtxt.bv(0x81, 8)),
+            self.astCtxt.bvpopcount(self.astCtxt.bv(0xff, 8)),
+            self.astCtxt.bvpopcount(self.astCtxt.bv(0x1234, 16)),
+            self.astCtxt.bvpopcount(self.astCtxt.bv(0x12345678, 32)),
+            self.astCtxt.bvpopcount(self.astCtxt.bv(0xffffffffffffffff, 64)),
+            self.astCtxt.bvpopcount(self.astCtxt.bv(0x1ffffffffffffffff, 72)),
+            self.astCtxt.bvpopcount(self.astCtxt.bv(1, 1)),
+        ]
+        self.check_ast(tests)
+        self.assertEqual(self.astCtxt.bvpopcount(self.astCtxt.bv(0x12345678, 32)).evaluate(), 13)
+        self.assertEqual(self.astCtxt.bvparity(self.astCtxt.bv(0x12345678, 32)).evaluate(), 1)
+
+    def test_lanes(self):
+        """Check lane-wise operations."""
+        a = self.astCtxt.bv(0x7f80ff0012345678deadbeef01020304, 128)
+        b = self.astCtxt.bv(0x7f7f01ff12345679deadbeef81020304, 128)
+        tests = list()
+        for lane in [8, 16, 32, 64, 128]:
+            tests.append(self.astCtxt.bvlaneadd(a, b, lane))
+            tests.append(self.astCtxt.bvlanesub(a, b, lane))
+            tests.append(self.astCtxt.bvlaneeq(a, b, lane))
+            tests.append(self.astCtxt.bvlanesgt(a, b, lane))
+            tests.append(self.astCtxt.bvlaneselect(a, a, b, lane))
+        self.check_ast(tests)
+        self.assertEqual(self.astCtxt.bvlaneadd(a, b, 8).evaluate(), 0xfeff00ff2468acf1bc5a7cde82040608)
+        self.assertEqual(self.astCtxt.bvlaneeq(a, b, 32).evaluate(), 0xffffffff00000000)
+        self.assertEqual(self.astCtxt.bvlanesgt(a, b, 8).evaluate(), 0xff0000000000000000ff000000)
+
+    def test_array(self):
+        """Check select and store operations."""
+        memory = self.astCtxt.array(64)
+        index = self.astCtxt.bv(0x1000, 64)
+        array = self.astCtxt.store(self.astCtxt.store(memory, index, self.astCtxt.bv(0x41, 8)), self.astCtxt.bv(0x1001, 64), self.astCtxt.bv(0x42, 8))
+        tests = [
+            self.astCtxt.select(array, index),
+            self.astCtxt.select(array, self.astCtxt.bv(0x1001, 64)),
+            self.astCtxt.select(self.astCtxt.store(array, index, self.astCtxt.bv(0x43, 8)), index),
+            self.astCtxt.concat([self.astCtxt.select(array, self.astCtxt.bv(0x1001, 64)), self.astCtxt.select(array, index)]),
+        ]
+        self.check_ast(tests)
+        self.assertEqual(tests[3].evaluate(), 0x4241)
+        self.assertEqual(self.astCtxt.select(array, self.astCtxt.bv(0x1002, 64)).evaluate(), 0)
+
     def test_neg(self):
         """Check neg operations."""
         tests = [
@@ -618,6 +681,32 @@ class TestAstEval(unittest.TestCase):
         ]
         self.check_ast(tests)
 
+    def test_shift_overflow(self):
+        """Check shifts by an amount which does not fit on 32 bits."""
+        pos = self.astCtxt.bv(0x7234567812345678deadbeefcafebabe, 128)
+        neg = self.astCtxt.bv(0xf234567812345678deadbeefcafebabe, 128)
+        tests = list()
+        for amount in [1 << 32, (1 << 32) + 1, (1 << 64) + 1, (1 << 127)]:
+            shift = self.astCtxt.bv(amount, 128)
+            for value in [pos, neg]:
+                tests.append(self.astCtxt.bvshl(value, shift))
+                tests.append(self.astCtxt.bvlshr(value, shift))
+                tests.append(self.astCtxt.bvashr(value, shift))
+            self.assertEqual(self.astCtxt.bvshl(neg, shift).evaluate(), 0)
+            self.assertEqual(self.astCtxt.bvlshr(neg, shift).evaluate(), 0)
+            self.assertEqual(self.astCtxt.bvashr(pos, shift).evaluate(), 0)
+            self.assertEqual(self.astCtxt.bvashr(neg, shift).evaluate(), (1 << 128) - 1)
+        for amount in [1 << 32, (1 << 32) + 1]:
+            shift = self.astCtxt.bv(amount, 64)
+            value = self.astCtxt.bv(0xfedcba9876543210, 64)
+            tests.append(self.astCtxt.bvshl(value, shift))
+            tests.append(self.astCtxt.bvlshr(value, shift))
+            tests.append(self.astCtxt.bvashr(value, shift))
+            self.assertEqual(self.astCtxt.bvshl(value, shift).evaluate(), 0)
+            self.assertEqual(self.astCtxt.bvlshr(value, shift).evaluate(), 0)
+            self.assertEqual(self.astCtxt.bvashr(value, shift).evaluate(), 0xffffffffffffffff)
+        self.check_ast(tests)
+
     def test_rol(self):
         """Check rol operations."""
         tests = [
@@ -2,9 +2,14 @@
 # coding: utf-8
 """Test AST representation."""
 
+import os
+import re
+import shutil
+import subprocess
+import tempfile
 import unittest
 
-from triton import TritonContext, ARCH, AST_REPRESENTATION, VERSION
+from triton import TritonContext, ARCH, AST_REPRESENTATION, CPUSIZE, Instruction, MemoryAccess, VERSION
 
 
 smtlifting = """(define-fun bswap8 ((value (_ BitVec 8))) (_ BitVec 8)
@@ -163,8 +168,14 @@ class TestAstRepresentation(unittest.TestCase):
             (self.ast.bv(2, 8),                              "(_ bv2 8)",                                                    "0x2"),
             (self.ast.bvashr(self.v1, self.v2),              "(bvashr SymVar_0 SymVar_1)",                                   "(SymVar_0 >> SymVar_1)"),
             (self.ast.bvfalse(),                             "(_ bv0 1)",                                                    "0x0"),
+            (self.ast.bvlaneadd(self.v1, self.v2, 4),        "(let ((value1 SymVar_0) (value2 SymVar_1)) (concat%s))" % "".join(" (bvadd ((_ extract %d %d) value1) ((_ extract %d %d) value2))" % (h, h - 3, h, h - 3) for h in [7, 3]),
+                                                                                                                             "laneadd(SymVar_0, SymVar_1, 8, 4)"),
             (self.ast.bvnand(self.v1, self.v2),              "(bvnand SymVar_0 SymVar_1)",                                   "(~(SymVar_0 & SymVar_1) & 0xFF)"),
             (self.ast.bvnor(self.v1, self.v2),               "(bvnor SymVar_0 SymVar_1)",                                    "(~(SymVar_0 | SymVar_1) & 0xFF)"),
+            (self.ast.bvparity(self.v1),                     "(let ((value SymVar_0)) (bvxor%s))" % "".join(" ((_ extract %d %d) value)" % (i, i) for i in range(8)),
+                                                                                                                             "(bin(SymVar_0).count('1') & 0x1)"),
+            (self.ast.bvpopcount(self.v1),                   "(let ((value SymVar_0)) (bvadd%s))" % "".join(" ((_ zero_extend 7) ((_ extract %d %d) value))" % (i, i) for i in range(8)),
+                                                                                                                             "bin(SymVar_0).count('1')"),
             (self.ast.bvrol(self.v1, self.ast.bv(3, 8)),     "((_ rotate_left 3) SymVar_0)",                                 "rol(SymVar_0, 0x3, 8)"),
             (self.ast.bvror(self.v2, self.ast.bv(2, 8)),     "((_ rotate_right 2) SymVar_1)",                                "ror(SymVar_1, 0x2, 8)"),
             (self.ast.bvsdiv(self.v1, self.v2),              "(bvsdiv SymVar_0 SymVar_1)",                                   "(SymVar_0 / SymVar_1)"),
@@ -193,6 +204,8 @@ class TestAstRepresentation(unittest.TestCase):
             (self.ast.lor([self.v1 >= 0, self.v2 <= 10]),    "(or (bvuge SymVar_0 (_ bv0 8)) (bvule SymVar_1 (_ bv10 8)))",  "((SymVar_0 >= 0x0) or (SymVar_1 <= 0xA))"),
             (self.ast.lxor([self.v1 >= 0, self.v2 <= 10]),   "(xor (bvuge SymVar_0 (_ bv0 8)) (bvule SymVar_1 (_ bv10 8)))", "(bool((SymVar_0 >= 0x0)) != bool((SymVar_1 <= 0xA)))"),
             (self.ast.reference(self.ref),                   "ref!0",                                                        "ref_0"),
+            (self.ast.select(self.ast.array(8), self.v1),    "(select memory_8 SymVar_0)",                                   "memory_8[SymVar_0]"),
+            (self.ast.store(self.ast.array(8), self.v1, self.v2), "(store memory_8 SymVar_0 SymVar_1)",                      "store(memory_8, SymVar_0, SymVar_1)"),
             (self.ast.string("test"),                        "test",                                                         "test"),
             (self.ast.sx(8, self.v1),                        "((_ sign_extend 8) SymVar_0)",                                 "sx(0x8, SymVar_0)"),
             (self.ast.zx(8, self.v1),                        "((_ zero_extend 8) SymVar_0)",                                 "SymVar_0"),
@@ -212,6 +225,54 @@ class TestAstRepresentation(unittest.TestCase):
             # Note: lower() in order to handle boost-1.55 (from travis) and boost-1.71 (from an up-to-date machine)
             self.assertEqual(str(n[0]).lower(), n[2].lower())
 
+    def test_shared_lifting(self):
+        # The tree doubles at each step, the DAG does not
+        node = self.v1 + self.v2
+        for _ in range(64):
+            node = node ^ (node + self.v1)
+        ref = self.ctx.newSymbolicExpression(node, "shared test")
+
+        smt = self.ctx.liftToSMT(ref, False, True)
+        self.assertIn("(define-fun node!0 () (_ BitVec 8) (bvadd SymVar_0 SymVar_1))\n", smt)
+        self.assertIn("(define-fun ref!1 () (_ BitVec 8) (bvxor node!63 (bvadd node!63 SymVar_0))) ; shared test\n", smt)
+        self.assertLess(len(smt), len(smtlifting) + 8192)
+
+        python = self.ctx.liftToPython(ref, True)
+        self.assertIn("node_0 = ((symvar_0 + symvar_1) & 0xff)\n", python.lower())
+        self.assertIn("ref_1 = (node_63 ^ ((node_63 + symvar_0) & 0xff)) # shared test\n", python.lower())
+
+    def test_deep_lifting(self):
+        # A deep chain of nodes used once is split into assignments
+        node = self.v1
+        for i in range(300):
+            node = (node + i) ^ self.v2
+        ref = self.ctx.newSymbolicExpression(node, "deep test")
+
+        python = self.ctx.liftToPython(ref, True)
+        self.assertIn("node_0 = ", python)
+        compile(python, "<lifting>", "exec")
+
+    def test_lane_lifting(self):
+        # The lane-wise functions are only defined if the slice has lane-wise nodes
+        self.assertNotIn("def laneadd", self.ctx.liftToPython(self.ref))
+
+        a = self.ctx.newSymbolicVariable(64)
+        b = self.ctx.newSymbolicVariable(64)
+        self.ctx.setConcreteVariableValue(a, 0x80ff00127fff0001)
+        self.ctx.setConcreteVariableValue(b, 0x7f0100127fff8000)
+        x = self.ast.variable(a)
+        y = self.ast.variable(b)
+        node = self.ast.bvlaneselect(self.ast.bvlanesgt(x, y, 8), self.ast.bvlaneadd(x, y, 8), self.ast.bvlanesub(x, y, 16), 8)
+        node = node ^ self.ast.bvlaneeq(x, y, 4) ^ self.ast.bvlaneadd(x, y, 32)
+        ref = self.ctx.newSymbolicExpression(node, "lane test")
+
+        # The lifted code gives the value of the node, with or without numpy
+        python = self.ctx.liftToPython(ref, True)
+        values = iter([0x80ff00127fff0001, 0x7f0100127fff8000])
+        scope = {"input": lambda: next(values)}
+        exec(python, scope)
+        self.assertEqual(scope["ref_%d" % ref.getId()], node.evaluate())
+
     def test_lifting(self):
         self.assertEqual(self.ctx.liftToSMT(self.ref), smtlifting)
         self.assertEqual(self.ctx.liftToPython(self.ref), pythonlifting)
@@ -239,8 +300,11 @@ class TestAstRepresentation(unittest.TestCase):
                 self.ast.bswap(self.v1),
                 self.ast.bv(2, 8),
                 self.ast.bvashr(self.v1, self.v2),
+                self.ast.bvlaneadd(self.v1, self.v2, 4),
                 self.ast.bvnand(self.v1, self.v2),
                 self.ast.bvnor(self.v1, self.v2),
+                self.ast.bvparity(self.v1),
+                self.ast.bvpopcount(self.v1),
                 self.ast.bvrol(self.v1, self.ast.bv(3, 8)),
                 self.ast.bvror(self.v2, self.ast.bv(2, 8)),
                 self.ast.bvsdiv(self.v1, self.v2),
@@ -270,3 +334,136 @@ class TestAstRepresentation(unittest.TestCase):
 
             for n in nodes:
                 self.assertNotEqual(len(self.ctx.liftToLLVM(n, fname="test", optimize=True)), 0)
+
+            # All the nodes into one module, one function per node
+            module = self.ctx.liftToLLVM(nodes, fname="test", optimize=True)
+            for i in range(len(nodes)):
+                self.assertIn("@test_%d(" % i, module)
+
+    def c_nodes(self):
+        return [
+            (self.v1 & self.v2),
+            (self.v1 + self.v2),
+            (self.v1 - self.v2),
+            (self.v1 * self.v2),
+            (self.v1 / self.v2),
+            (self.v1 % self.v2),
+            (self.v1 << self.v2),
+            (self.v1 >> self.v2),
+            (~self.v1),
+            (-self.v1),
+            (self.v1 == self.v2),
+            (self.v1 <= self.v2),
+            (self.v1 > self.v2),
+            self.ast.bswap(self.ast.concat([self.v1, self.v2])),
+            self.ast.bvashr(self.v1, self.v2),
+            self.ast.bvlaneadd(self.v1, self.v2, 4),
+            self.ast.bvlanesgt(self.v1, self.v2, 2),
+            self.ast.bvnand(self.v1, self.v2),
+            self.ast.bvparity(self.v1),
+            self.ast.bvpopcount(self.v1),
+            self.ast.bvrol(self.v1, self.ast.bv(3, 8)),
+            self.ast.bvror(self.v2, self.ast.bv(2, 8)),
+            self.ast.bvsdiv(self.v1, self.v2),
+            self.ast.bvsge(self.v1, self.v2),
+            self.ast.bvslt(self.v1, self.v2),
+            self.ast.bvsmod(self.v1, self.v2),
+            self.ast.bvsrem(self.v1, self.v2),
+            self.ast.bvxnor(self.v1, self.v2),
+            self.ast.extract(4, 2, self.v1),
+            self.ast.ite(self.v1 == 1, self.v1, self.v2),
+            self.ast.land([self.v1 == 1, self.v2 == 2]),
+            self.ast.lnot(self.v1 == 0),
+            self.ast.lxor([self.v1 >= 0x80, self.v2 <= 10]),
+            self.ast.sx(56, self.v1),
+            self.ast.zx(8, self.v1),
+            # Held in 128 bits
+            self.ast.sx(120, self.v1) * self.ast.zx(120, self.v2),
+            self.ast.extract(127, 60, self.ast.concat([self.v2, self.ast.sx(112, self.v1), self.v2])),
+            self.ast.bvudiv(self.ast.sx(88, self.v1), self.ast.zx(88, self.v2)),
+            self.ast.bvsdiv(self.ast.sx(120, self.v1), self.ast.sx(120, self.v2)),
+            self.ast.bvlshr(self.ast.sx(120, self.v1), self.ast.zx(120, self.v2)),
+        ]
+
+    def test_c_lifting(self):
+        code = self.ctx.liftToC(self.ref, fname="test")
+        self.assertIn("uint64_t test(uint64_t SymVar_0, uint64_t SymVar_1) {", code)
+        self.assertIn("const uint64_t ref_0 = ((SymVar_0 + SymVar_1) & UINT64_C(0xff));", code)
+        self.assertIn("return ref_0;", code)
+
+        # Shared nodes are computed once
+        node = self.v1 + self.v2
+        for _ in range(64):
+            node = node ^ (node + self.v1)
+        self.assertLess(len(self.ctx.liftToC(node)), 16384)
+
+        with self.assertRaises(TypeError):
+            self.ctx.liftToC(self.ast.zx(248, self.v1))
+
+        if shutil.which("cc") is None:
+            return
+
+        # The functions compiled compute the values of the nodes
+        names = [self.v1.getSymbolicVariable().getName(), self.v2.getSymbolicVariable().getName()]
+        source, calls, expected = [], [], []
+        for cv1, cv2 in [(0x8d, 0x03), (0x7f, 0x00), (0x80, 0xff), (0x12, 0x9c), (0xff, 0x07)]:
+            self.ctx.setConcreteVariableValue(self.v1.getSymbolicVariable(), cv1)
+            self.ctx.setConcreteVariableValue(self.v2.getSymbolicVariable(), cv2)
+            for n in self.c_nodes():
+                fname = "f_%d" % len(calls)
+                source.append(self.ctx.liftToC(n, fname=fname))
+                params = re.search(r"%s\((.*)\) \{" % fname, source[-1]).group(1)
+                args = [str(cv1 if p.split()[-1] == names[0] else cv2) for p in params.split(", ") if p != "void"]
+                calls.append("  print((triton_uint128)%s(%s));" % (fname, ", ".join(args)))
+                expected.append(n.evaluate())
+
+        source.append("#include <stdio.h>")
+        source.append("static void print(triton_uint128 v) { printf(\"%016llx%016llx\\n\", (unsigned long long)(v >> 64), (unsigned long long)v); }")
+        source.append("int main(void) {\n%s\n  return 0;\n}" % "\n".join(calls))
+
+        with tempfile.TemporaryDirectory() as directory:
+            path = os.path.join(directory, "lifting.c")
+            with open(path, "w") as f:
+                f.write("\n".join(source))
+            subprocess.check_call(["cc", "-O1", "-o", os.path.join(directory, "lifting"), path])
+            output = subprocess.check_output([os.path.join(directory, "lifting")]).decode()
+
+        self.assertEqual([int(v, 16) for v in output.split()], expected)
+
+    def test_c_block_lifting(self):
+        ctx = TritonContext(ARCH.X86_64)
+        ctx.setConcreteRegisterValue(ctx.registers.rdi, 0x2000)
+        block = [
+            Instruction(0x1000, b"\x48\x01\xd8"),  # add rax, rbx
+            Instruction(0x1003, b"\x48\x89\x07"),  # mov [rdi], rax
+        ]
+
+        # The registers and the memory read are inputs, the ones written are outputs
+        code = ctx.liftToC(block, fname="block")
+        self.assertIn("void block(", code)
+        for name in ("uint64_t rax", "uint64_t rbx", "uint64_t* rax_out", "uint64_t* cf_out", "uint64_t* mem_0x2000_out"):
+            self.assertIn(name, code)
+
+        # The context is not modified
+        self.assertEqual(len(ctx.getSymbolicVariables()), 0)
+
+    def test_block_lifting(self):
+        if VERSION.LLVM_INTERFACE is not True:
+            return
+
+        ctx = TritonContext(ARCH.X86_64)
+        ctx.setConcreteRegisterValue(ctx.registers.rdi, 0x2000)
+        block = [
+            Instruction(0x1000, b"\x48\x01\xd8"),  # add rax, rbx
+            Instruction(0x1003, b"\x48\x89\x07"),  # mov [rdi], rax
+        ]
+
+        # The registers and the memory read are inputs, the ones written are outputs
+        module = ctx.liftToLLVM(block, fname="block", optimize=True)
+        self.assertIn("@block(", module)
+        for name in ("%rax", "%rbx", "%rax_out", "%cf_out", "%mem_0x2000_out"):
+            self.assertIn(name, module)
+
+        # The context is not modified
+        self.assertEqual(len(ctx.getSymbolicVariables()), 0)
+        self.assertEqual(ctx.getConcreteMemoryValue(MemoryAccess(0x2000, CPUSIZE.QWORD)), 0)
@@ -726,6 +726,93 @@ class TestAstSimplification5(unittest.TestCase):
              "(define-fun ref!15 () (_ BitVec 64) (_ bv3 64)) ; Program Counter - 0x0: sub qword ptr [rdx], rcx"))
 
 
+class TestAstSimplificationMemo(unittest.TestCase):
+
+    """Testing the memoized fixed point of the simplification callbacks."""
+
+    def setUp(self):
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ast = self.ctx.getAstContext()
+        self.calls = 0
+        self.ctx.addCallback(CALLBACK.SYMBOLIC_SIMPLIFICATION, self.not_not)
+
+    # ~~a -> a
+    def not_not(self, api, node):
+        self.calls += 1
+        if node.getType() == AST_NODE.BVNOT and node.getChildren()[0].getType() == AST_NODE.BVNOT:
+            return node.getChildren()[0].getChildren()[0]
+        return node
+
+    def test_fixed_point(self):
+        x = self.ast.variable(self.ctx.newSymbolicVariable(8, 'x'))
+        self.assertEqual(str(self.ctx.simplify(~~~~x)), "x")
+        self.ctx.setSimplificationIterations(1)
+        self.assertEqual(str(self.ctx.simplify(~~~~x)), "(bvnot (bvnot x))")
+
+    def test_memo(self):
+        x = self.ast.variable(self.ctx.newSymbolicVariable(8, 'x'))
+        n = (x + 1) * (x + 2)
+        self.assertTrue(self.ctx.simplify(n).equalTo(n))
+        self.assertEqual(self.ctx.getSimplificationStatistics()["memoHits"], 0)
+        # An unchanged tree is neither rewritten nor walked again
+        calls = self.calls
+        self.assertTrue(self.ctx.simplify(n).equalTo(n))
+        self.assertEqual(self.calls, calls)
+        self.assertEqual(self.ctx.getSimplificationStatistics()["memoHits"], 1)
+        # A new callback invalidates the memo
+        self.ctx.addCallback(CALLBACK.SYMBOLIC_SIMPLIFICATION, self.not_not)
+        self.ctx.simplify(n)
+        self.assertGreater(self.calls, calls)
+        self.ctx.clearSimplificationMemo()
+        self.assertEqual(self.ctx.getSimplificationStatistics(), {"memoHits": 0, "passes": {}})
+
+
+class TestAstSimplificationPasses(unittest.TestCase):
+
+    """Testing the native simplification passes."""
+
+    def setUp(self):
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ast = self.ctx.getAstContext()
+        self.vx = self.ctx.newSymbolicVariable(8, 'x')
+        self.vy = self.ctx.newSymbolicVariable(8, 'y')
+        self.x = self.ast.variable(self.vx)
+        self.y = self.ast.variable(self.vy)
+
+    def evaluate(self, node):
+        values = []
+        for a, b in [(0, 0), (1, 2), (0x7f, 0x80), (0xff, 0x3c)]:
+            self.ctx.setConcreteVariableValue(self.vx, a)
+            self.ctx.setConcreteVariableValue(self.vy, b)
+            values.append(node.evaluate())
+        return values
+
+    def test_passes(self):
+        x, y = self.x, self.y
+        self.ctx.addSimplificationPass("mba-linear")
+        self.ctx.addSimplificationPass("complement")
+        self.assertEqual(self.ctx.getSimplificationPasses(), ["complement", "mba-linear"])
+        self.assertEqual(str(self.ctx.simplify(x ^ ~x)), "(_ bv255 8)")
+        self.assertEqual(str(self.ctx.simplify((x & y) + (x | y))), "(bvadd x y)")
+        self.assertEqual(str(self.ctx.simplify((x | y) - (x & y))), "(bvxor x y)")
+        self.assertEqual(str(self.ctx.simplify(((x ^ y) + 2 * (x & y)) * y)), "(bvmul (bvadd x y) y)")
+        stats = self.ctx.getSimplificationStatistics()["passes"]
+        self.assertEqual(stats["complement"]["rewrites"], 1)
+        self.assertEqual(stats["mba-linear"]["rewrites"], 3)
+        self.ctx.removeSimplificationPass("mba-linear")
+        self.assertEqual(str(self.ctx.simplify((x & y) + (x | y))), "(bvadd (bvand x y) (bvor x y))")
+        self.assertRaises(TypeError, self.ctx.addSimplificationPass, "unknown")
+
+    def test_mba_linear(self):
+        x, y = self.x, self.y
+        self.ctx.addSimplificationPass("mba-linear")
+        for n in [(x | y) - y + (x & y), ~(x & y) - 3 * (x ^ y), 3 * ((x ^ y) - (x | y)), (x & 0x0f) + (x | 0x0f)]:
+            values = self.evaluate(n)
+            s = self.ctx.simplify(n)
+            self.assertEqual(self.evaluate(s), values)
+        self.assertEqual(str(self.ctx.simplify((x | y) - y + (x & y))), "x")
+
+
 class TestAstSimplificationLLVM(unittest.TestCase):
     def setUp(self):
         self.ctx = TritonContext(ARCH.X86_64)
@@ -740,3 +827,21 @@ class TestAstSimplificationLLVM(unittest.TestCase):
             r = str(o) == "(bvxor y x)" or str(o) == "(bvxor x y)"
             self.assertTrue(r)
         return
+
+    def test_cache(self):
+        if VERSION.LLVM_INTERFACE is True:
+            x = self.ast.variable(self.ctx.newSymbolicVariable(8, 'x'))
+            y = self.ast.variable(self.ctx.newSymbolicVariable(8, 'y'))
+            o1 = self.ctx.simplify((x & ~y) | (~x & y), llvm=True)
+            self.assertEqual(self.ctx.getSimplificationCacheSize(), 1)
+            # The same tree built again and a result are not simplified again
+            o2 = self.ctx.simplify((x & ~y) | (~x & y), llvm=True)
+            o3 = self.ctx.simplify(o1, llvm=True)
+            self.assertEqual(self.ctx.getSimplificationCacheSize(), 1)
+            self.assertEqual(str(o1), str(o2))
+            self.assertEqual(str(o1), str(o3))
+            self.ctx.setSimplificationCacheCapacity(0)
+            self.assertEqual(self.ctx.getSimplificationCacheSize(), 0)
+            self.assertEqual(str(self.ctx.simplify((x & ~y) | (~x & y), llvm=True)), str(o1))
+            self.assertEqual(self.ctx.getSimplificationCacheSize(), 0)
+        return
@@ -49,9 +49,161 @@ class TestAstUtils(unittest.TestCase):
         l = self.astCtxt.search(n, AST_NODE.BV)
         self.assertEqual(len(l), 2)
 
+    def test_visit(self):
+        n = (((self.v1 + self.v2 * 3) + self.v2) - 1)
+
+        # Children first, each node once
+        kinds = []
+        record = lambda x: kinds.append(x.getType())
+        self.astCtxt.visit(n, {AST_NODE.BVADD: record, AST_NODE.VARIABLE: record})
+        self.assertEqual(kinds, [AST_NODE.VARIABLE, AST_NODE.VARIABLE, AST_NODE.BVADD, AST_NODE.BVADD])
+
+        kinds = []
+        self.astCtxt.visit(n, {AST_NODE.BVADD: record, AST_NODE.VARIABLE: record}, False, False)
+        self.assertEqual(kinds, [AST_NODE.BVADD, AST_NODE.BVADD, AST_NODE.VARIABLE, AST_NODE.VARIABLE])
+
+        # The other nodes go to ANY
+        kinds = []
+        self.astCtxt.visit(n, {AST_NODE.BVMUL: lambda x: None, AST_NODE.ANY: record})
+        self.assertEqual(len(kinds), 11)
+        self.assertEqual(kinds[-1], AST_NODE.BVSUB)
+
+        # The exceptions of the callbacks are raised
+        with self.assertRaises(ZeroDivisionError):
+            self.astCtxt.visit(n, {AST_NODE.ANY: lambda x: 1 // 0})
+
+    def test_node_arrays(self):
+        n = (((self.v1 + self.v2 * 3) + self.v2) - 1)
+
+        arrays = self.astCtxt.getNodeArrays(n)
+        kinds = memoryview(arrays["kinds"]).cast("I")
+        sizes = memoryview(arrays["sizes"]).cast("I")
+        offsets = memoryview(arrays["offsets"]).cast("I")
+        children = memoryview(arrays["children"]).cast("I")
+
+        self.assertEqual(len(kinds), 12)
+        self.assertEqual(len(offsets), 13)
+        self.assertEqual(kinds.tolist().count(AST_NODE.VARIABLE), 2)
+        self.assertEqual(kinds[-1], AST_NODE.BVSUB)
+        self.assertEqual(sizes[-1], 8)
+
+        # The children of the root, numbered before it
+        root = children[offsets[11]:offsets[12]].tolist()
+        self.assertEqual([kinds[i] for i in root], [AST_NODE.BVADD, AST_NODE.BV])
+        self.assertTrue(all(i < 11 for i in root))
+
+        # References are leaves unless unrolled
+        r = self.astCtxt.reference(self.ctx.newSymbolicExpression(self.v1 + 1, "r"))
+        self.assertEqual(len(memoryview(self.astCtxt.getNodeArrays(r)["kinds"]).cast("I")), 1)
+
+        arrays = self.astCtxt.getNodeArrays(r, True)
+        kinds = memoryview(arrays["kinds"]).cast("I")
+        children = memoryview(arrays["children"]).cast("I")
+        self.assertEqual(kinds[-1], AST_NODE.REFERENCE)
+        self.assertEqual(kinds[children[-1]], AST_NODE.BVADD)
+
     def test_dereference(self):
         r1 = self.astCtxt.reference(self.ctx.newSymbolicExpression(self.v1, "r1"))
         r2 = self.astCtxt.reference(self.ctx.newSymbolicExpression(r1, "r2"))
         self.assertEqual(str(self.astCtxt.dereference(r2)), "SymVar_0")
         self.assertEqual(str(self.astCtxt.dereference(r1)), "SymVar_0")
         self.assertEqual(str(self.astCtxt.dereference(self.v1)), "SymVar_0")
+
+    def test_node_pool_stats(self):
+        before = self.astCtxt.getNodePoolStats()
+        n = self.astCtxt.bvadd(self.v1, self.astCtxt.bv(1, 8))
+        after = self.astCtxt.getNodePoolStats()
+        self.assertGreater(after["allocations"], before["allocations"])
+        self.assertGreater(after["bytesInUse"], 0)
+        self.assertGreaterEqual(after["bytesReserved"], after["bytesInUse"])
+
+    def test_garbage_thresholds(self):
+        self.ctx.symbolizeRegister(self.ctx.registers.rax)
+        self.astCtxt.setGarbageThresholds(64, 0)
+        before = self.astCtxt.getGarbageStats()
+
+        # add rax, 1 builds a few nodes per instruction, a collection runs every few instructions
+        for i in range(100):
+            self.ctx.processing(Instruction(b"\x48\x83\xc0\x01"))
+
+        after = self.astCtxt.getGarbageStats()
+        self.assertGreater(after["triggered"], before["triggered"])
+        self.assertLess(after["incrementalCycles"] - before["incrementalCycles"], 100)
+        self.assertEqual(after["triggered"] - before["triggered"], after["incrementalCycles"] - before["incrementalCycles"])
+
+    def test_incremental_update(self):
+        # (v1 & 0) does not change when v1 changes, but n still does through v1
+        a = self.v1 & self.astCtxt.bv(0, 8)
+        n = a + self.v1
+        r = self.astCtxt.reference(self.ctx.newSymbolicExpression(n, "r"))
+        m = r + self.v2
+
+        self.ctx.setConcreteVariableValue(self.sv1, 5)
+        self.ctx.setConcreteVariableValue(self.sv2, 1)
+        self.assertEqual(a.evaluate(), 0)
+        self.assertEqual(n.evaluate(), 5)
+        self.assertEqual(m.evaluate(), 6)
+
+        # A node created after the first update must be updated too
+        k = m * 2
+        self.ctx.setConcreteVariableValue(self.sv1, 7)
+        self.assertEqual(n.evaluate(), 7)
+        self.assertEqual(m.evaluate(), 8)
+        self.assertEqual(k.evaluate(), 16)
+
+    def test_hash(self):
+        # Operands of commutative operators are hashed in a canonical order
+        self.assertEqual((self.v1 + self.v2).getHash(), (self.v2 + self.v1).getHash())
+        self.assertEqual((self.v1 ^ self.v2).getHash(), (self.v2 ^ self.v1).getHash())
+        self.assertNotEqual((self.v1 - self.v2).getHash(), (self.v2 - self.v1).getHash())
+        self.assertNotEqual((self.v1 * self.astCtxt.bv(0, 8)).getHash(), (self.v2 * self.astCtxt.bv(0, 8)).getHash())
+        self.assertLess((self.v1 + self.v2).getHash(), 1 << 128)
+
+    def test_traversal_cache(self):
+        self.ctx.setMode(MODE.AST_TRAVERSAL_CACHE, True)
+        e = self.ctx.newSymbolicExpression(self.v1 + self.v2, "e")
+        n = self.astCtxt.reference(e) * self.astCtxt.bv(2, 8)
+        self.assertEqual(str(self.astCtxt.unroll(n)), "(bvmul (bvadd SymVar_0 SymVar_1) (_ bv2 8))")
+        self.assertEqual(str(self.astCtxt.unroll(n)), "(bvmul (bvadd SymVar_0 SymVar_1) (_ bv2 8))")
+
+        # Cached sorts must not survive a change of children
+        e.setAst(self.v1 ^ self.v2)
+        self.assertEqual(str(self.astCtxt.unroll(n)), "(bvmul (bvxor SymVar_0 SymVar_1) (_ bv2 8))")
+        n.setChild(1, self.v2)
+        self.assertEqual(str(self.astCtxt.unroll(n)), "(bvmul (bvxor SymVar_0 SymVar_1) SymVar_1)")
+
+    def test_equality_saturation(self):
+        self.ctx.setMode(MODE.AST_EQUALITY_SATURATION, True)
+        mba = (self.v1 ^ self.v2) + (self.astCtxt.bv(2, 8) * (self.v1 & self.v2))
+        self.assertFalse(self.ctx.isSat(mba != self.v1 + self.v2))
+        self.assertTrue(self.ctx.isSat(mba == self.astCtxt.bv(3, 8)))
+
+    def test_abstract_domain(self):
+        self.ctx.setMode(MODE.AST_ABSTRACT_DOMAIN, True)
+        x = self.astCtxt.zx(8, self.v1)
+
+        # Constraints decided by known bits and bounds are answered without the solver
+        self.assertTrue(self.ctx.isSat(x < self.astCtxt.bv(0x1000, 16)))
+        self.assertFalse(self.ctx.isSat(x > self.astCtxt.bv(0xff, 16)))
+
+        # With constant folding, symbolized nodes holding a single value are folded
+        self.ctx.setMode(MODE.CONSTANT_FOLDING, True)
+        self.assertEqual(str(x >> self.astCtxt.bv(8, 16)), "(_ bv0 16)")
+        self.assertEqual(str(self.astCtxt.bvult(x, self.astCtxt.bv(0x1000, 16))), "(= (_ bv1 1) (_ bv1 1))")
+        self.assertEqual(str(self.astCtxt.bvult(x, self.astCtxt.bv(0x10, 16))), "(bvult ((_ zero_extend 8) SymVar_0) (_ bv16 16))")
+
+    def test_freeze(self):
+        n = self.v1 + self.v2
+        self.ctx.setConcreteVariableValue(self.sv1, 5)
+        n.freeze()
+        self.assertTrue(n.isFrozen())
+        self.assertTrue(self.v1.isFrozen())
+
+        # A frozen tree keeps its value, new nodes use the new one
+        self.ctx.setConcreteVariableValue(self.sv1, 7)
+        self.assertEqual(n.evaluate(), 5)
+        self.assertEqual((self.astCtxt.variable(self.sv1) + self.v2).evaluate(), 7)
+        self.assertFalse(self.astCtxt.variable(self.sv1).isFrozen())
+
+        with self.assertRaises(TypeError):
+            n.setChild(0, self.v2)
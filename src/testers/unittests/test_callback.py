@@ -4,7 +4,7 @@
 
 import unittest
 
-from triton import (TritonContext, ARCH, CALLBACK, Instruction)
+from triton import (TritonContext, ARCH, CALLBACK, Instruction, MemoryAccess)
 
 
 class TestCallback(unittest.TestCase):
@@ -54,6 +54,69 @@ class TestCallback(unittest.TestCase):
         self.Triton.processing(Instruction(b"\x48\x89\xd8"))  # mov rax, rbx
         self.assertFalse(flag)
 
+    def test_memory_area_callbacks(self):
+        self.Triton = TritonContext()
+        self.Triton.setArchitecture(ARCH.X86_64)
+
+        loads = list()
+        stores = list()
+        self.Triton.addCallback(CALLBACK.GET_CONCRETE_MEMORY_AREA_VALUE, lambda api, addr, size: loads.append((addr, size)))
+        self.Triton.addCallback(CALLBACK.SET_CONCRETE_MEMORY_AREA_VALUE, lambda api, addr, values: stores.append((addr, values)))
+
+        # One call per area, whatever its size
+        self.Triton.setConcreteMemoryAreaValue(0x1000, b"\x11" * 0x100)
+        self.Triton.getConcreteMemoryAreaValue(0x1000, 0x100)
+        self.assertEqual(stores, [(0x1000, b"\x11" * 0x100)])
+        self.assertEqual(loads, [(0x1000, 0x100)])
+
+    def test_undefined_memory_page(self):
+        self.Triton = TritonContext()
+        self.Triton.setArchitecture(ARCH.X86_64)
+
+        # Fetches a whole page, as a remote memory backend would
+        pages = list()
+        def fetch(api, addr, size):
+            pages.append(addr)
+            api.setConcreteMemoryAreaValue(addr, bytes([addr >> 12]) * size)
+
+        self.Triton.addCallback(CALLBACK.GET_UNDEFINED_MEMORY_PAGE, fetch)
+        self.Triton.setConcreteMemoryAreaValue(0x3000, b"\xff")
+        self.assertEqual(self.Triton.getConcreteMemoryAreaValue(0x1ffe, 4), b"\x01\x01\x02\x02")
+
+        # Defined pages are not reported again, nor pages with a defined byte
+        self.assertEqual(self.Triton.getConcreteMemoryAreaValue(0x1000, 2), b"\x01\x01")
+        self.assertEqual(self.Triton.getConcreteMemoryAreaValue(0x3000, 2), b"\xff\x00")
+        self.assertEqual(pages, [0x1000, 0x2000])
+
+        # movabs rax, qword ptr [0x5000]
+        self.Triton.processing(Instruction(b"\x48\xa1\x00\x50\x00\x00\x00\x00\x00\x00"))
+        self.assertEqual(self.Triton.getConcreteRegisterValue(self.Triton.registers.rax), 0x0505050505050505)
+        self.assertEqual(pages, [0x1000, 0x2000, 0x5000])
+
+    def test_memory_ranges(self):
+        self.Triton = TritonContext()
+        self.Triton.setArchitecture(ARCH.X86_64)
+
+        loads = list()
+        stores = list()
+        self.Triton.addCallback(CALLBACK.GET_CONCRETE_MEMORY_VALUE, lambda api, mem: loads.append(mem.getAddress()), [(0x1000, 0x1010), 0x8123])
+        self.Triton.addCallback(CALLBACK.SET_CONCRETE_MEMORY_VALUE, lambda api, mem, value: stores.append(mem.getAddress()), [(0x2000, 0x2001)])
+
+        # Only the accesses overlapping a range (or the page of 0x8123) call Python
+        for addr in [0x0ff8, 0x0ff9, 0x1008, 0x1010, 0x7fff, 0x8ff0, 0x9000]:
+            self.Triton.getConcreteMemoryValue(MemoryAccess(addr, 8))
+        self.assertEqual(loads, [0x0ff9, 0x1008, 0x8ff0])
+
+        for addr in [0x1ff8, 0x1ffa, 0x2001]:
+            self.Triton.setConcreteMemoryValue(MemoryAccess(addr, 8), 0)
+        self.assertEqual(stores, [0x1ffa])
+
+        # Only the memory value callbacks take ranges, and a range cannot be empty
+        with self.assertRaises(TypeError):
+            self.Triton.addCallback(CALLBACK.GET_CONCRETE_REGISTER_VALUE, self.cb_flag, [0x1000])
+        with self.assertRaises(TypeError):
+            self.Triton.addCallback(CALLBACK.GET_CONCRETE_MEMORY_VALUE, self.cb_flag, [(0x2000, 0x1000)])
+
     @staticmethod
     def cb_flag(api, x):
         global flag
@@ -2,9 +2,12 @@
 # coding: utf-8
 """Test architectures."""
 
+import array
+import os
+import tempfile
 import unittest
 
-from triton import ARCH, TritonContext
+from triton import ARCH, CPUSIZE, MemoryAccess, TritonContext
 from random import randrange
 
 
@@ -207,3 +210,80 @@ class TestX8664ConcreteMemoryValue(unittest.TestCase):
         self.Triton.setConcreteMemoryAreaValue(0x1000, b"\x11\x22\x33\x44\x55\x66")
         self.Triton.setConcreteMemoryAreaValue(0x1006, [0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc])
         self.assertEqual(self.Triton.getConcreteMemoryAreaValue(0x1000, 12), b"\x11\x22\x33\x44\x55\x66\x77\x88\x99\xaa\xbb\xcc")
+
+    def test_area_across_pages(self):
+        base = 0x3ffa
+        area = bytes(range(256)) * 40
+
+        self.Triton.setConcreteMemoryAreaValue(base, area)
+        self.assertTrue(self.Triton.isConcreteMemoryValueDefined(base, len(area)))
+        self.assertFalse(self.Triton.isConcreteMemoryValueDefined(base - 1, 2))
+        self.assertEqual(self.Triton.getConcreteMemoryAreaValue(base, len(area)), area)
+        self.assertEqual(self.Triton.getConcreteMemoryValue(MemoryAccess(0x3ffe, CPUSIZE.QWORD)), 0x0b0a090807060504)
+
+        self.Triton.setConcreteMemoryValue(MemoryAccess(0x4ffc, CPUSIZE.QWORD), 0x1122334455667788)
+        self.assertEqual(self.Triton.getConcreteMemoryAreaValue(0x4ffc, 8), b"\x88\x77\x66\x55\x44\x33\x22\x11")
+
+        self.Triton.clearConcreteMemoryValue(0x4000, 0x1000)
+        self.assertFalse(self.Triton.isConcreteMemoryValueDefined(0x4000, 1))
+        self.assertEqual(self.Triton.getConcreteMemoryAreaValue(0x3ffe, 4), b"\x04\x05\x00\x00")
+        self.assertTrue(self.Triton.isConcreteMemoryValueDefined(0x5000, 1))
+
+    def test_buffer_area(self):
+        area = bytes(range(256)) * 20
+
+        self.Triton.setConcreteMemoryAreaValue(0x3000, memoryview(area)[0x10:0x1010])
+        self.Triton.setConcreteMemoryAreaValue(0x6000, array.array("B", area))
+        buf = bytearray(0x1000)
+        self.assertIsNone(self.Triton.getConcreteMemoryAreaValue(0x3000, buf))
+        self.assertEqual(bytes(buf), area[0x10:0x1010])
+        self.assertEqual(self.Triton.getConcreteMemoryAreaValue(0x6000, len(area)), area)
+
+        # The mapped buffer is kept alive and is not written
+        mapped = bytearray(area)
+        self.Triton.mapConcreteMemoryArea(0x10000, mapped)
+        self.Triton.setConcreteMemoryAreaValue(0x10001, b"\xff")
+        self.assertEqual(self.Triton.getConcreteMemoryAreaValue(0x10000, 4), b"\x00\xff\x02\x03")
+        self.assertEqual(self.Triton.getConcreteMemoryAreaValue(0x11000, 4), area[0x1000:0x1004])
+        self.assertEqual(mapped, area)
+
+    def test_map_file(self):
+        content = bytes(range(256)) * 64
+        with tempfile.NamedTemporaryFile(delete=False) as f:
+            f.write(content)
+        try:
+            self.assertEqual(self.Triton.mapConcreteMemoryFile(0x10000, f.name, 0x100), len(content) - 0x100)
+            self.assertTrue(self.Triton.isConcreteMemoryValueDefined(0x10000, len(content) - 0x100))
+            self.assertEqual(self.Triton.getConcreteMemoryAreaValue(0x10ffe, 4), content[0x10fe:0x1102])
+
+            # Writes do not reach the file
+            self.Triton.setConcreteMemoryAreaValue(0x11000, b"\xff\xff")
+            self.assertEqual(self.Triton.getConcreteMemoryAreaValue(0x10fff, 4), content[0x10ff:0x1100] + b"\xff\xff" + content[0x1102:0x1103])
+            with open(f.name, "rb") as g:
+                self.assertEqual(g.read(), content)
+
+            self.assertEqual(self.Triton.mapConcreteMemoryFile(0x20000, f.name, 0x10, 0x20), 0x20)
+            self.assertEqual(self.Triton.getConcreteMemoryAreaValue(0x20000, 0x20), content[0x10:0x30])
+            self.assertFalse(self.Triton.isConcreteMemoryValueDefined(0x20020, 1))
+        finally:
+            os.remove(f.name)
+
+    def test_share_file(self):
+        content = bytes(range(256)) * 64
+        with tempfile.NamedTemporaryFile(delete=False) as f:
+            f.write(content)
+        other = TritonContext(ARCH.X86_64)
+        try:
+            self.Triton.mapConcreteMemoryFile(0x10000, f.name)
+            other.mapConcreteMemoryFile(0x10000, f.name)
+            self.assertEqual(self.Triton.getMemoryUsage()["mappedMemory"]["count"], 4)
+            self.assertEqual(other.getMemoryUsage()["mappedMemory"]["count"], 4)
+
+            # A write copies the page in its context only
+            self.Triton.setConcreteMemoryAreaValue(0x11000, b"\xff")
+            self.assertEqual(self.Triton.getMemoryUsage()["mappedMemory"]["count"], 3)
+            self.assertEqual(self.Triton.getConcreteMemoryAreaValue(0x11000, 2), b"\xff" + content[0x1001:0x1002])
+            self.assertEqual(other.getConcreteMemoryAreaValue(0x11000, 2), content[0x1000:0x1002])
+            self.assertEqual(other.getMemoryUsage()["mappedMemory"]["count"], 4)
+        finally:
+            os.remove(f.name)
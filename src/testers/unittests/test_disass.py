@@ -345,3 +345,19 @@ class TestX64Disass(unittest.TestCase):
         raw = b"".join(code)
         self.ctx.setConcreteMemoryAreaValue(0x1000, raw)
         self.assertRaises(Exception, self.ctx.disassembly, 0x1000)
+
+    def test_shared_cache(self):
+        raw = b"\x48\xff\xc1\x48\x89\xc8" # inc rcx; mov rax, rcx
+        other = TritonContext(ARCH.X86_64)
+        other.shareDisassemblyCache(self.ctx)
+        for ctx in [self.ctx, other]:
+            ctx.setConcreteMemoryAreaValue(0x1000, raw)
+            self.assertEqual(str(ctx.disassembly(0x1000, 2)), '[0x1000: inc rcx, 0x1003: mov rax, rcx]')
+
+        # The bytes are checked, the same address may hold other instructions in another context
+        other.setConcreteMemoryAreaValue(0x1000, b"\xc3")
+        self.assertEqual(str(other.disassembly(0x1000, 1)), '[0x1000: ret]')
+        self.assertEqual(str(self.ctx.disassembly(0x1000, 1)), '[0x1000: inc rcx]')
+
+        self.assertRaises(TypeError, TritonContext(ARCH.AARCH64).shareDisassemblyCache, self.ctx)
+        self.assertRaises(TypeError, other.shareDisassemblyCache, 0)
@@ -0,0 +1,263 @@
+#!/usr/bin/env python3
+# coding: utf-8
+"""Test emulation."""
+
+import unittest
+
+from triton import *
+
+
+class TestEmulation(unittest.TestCase):
+
+    """Testing the native emulation loop."""
+
+    def setUp(self):
+        """Define a counted loop followed by a comparison."""
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ctx.setConcreteMemoryAreaValue(0x1000, [
+            0xb9, 0x03, 0x00, 0x00, 0x00,   # mov ecx, 3
+            0xff, 0xc9,                     # dec ecx
+            0x75, 0xfc,                     # jne 0x1005
+            0x3c, 0x41,                     # cmp al, 0x41
+            0x74, 0x01,                     # je 0x100e
+            0x90,                           # nop
+            0xf4,                           # hlt
+        ])
+
+    def test_stops(self):
+        result = self.ctx.emulate(0x1000, stops=[0x100e])
+        self.assertEqual(result['reason'], EMULATION.ADDRESS)
+        self.assertEqual(result['pc'], 0x100e)
+        self.assertEqual(result['instructions'], 10)
+        self.assertEqual(result['blocks'], 5)
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.ecx), 0)
+
+    def test_resume(self):
+        result = self.ctx.emulate(0x1000, stops=[0x1005])
+        self.assertEqual(result['pc'], 0x1005)
+        self.assertEqual(result['instructions'], 1)
+
+        # The start address does not stop the emulation
+        result = self.ctx.emulate(result['pc'], stops=[0x1005, 0x100e])
+        self.assertEqual(result['pc'], 0x1005)
+        self.assertEqual(result['instructions'], 2)
+
+    def test_max_instructions(self):
+        result = self.ctx.emulate(0x1000, maxInstructions=4)
+        self.assertEqual(result['reason'], EMULATION.COUNT)
+        self.assertEqual(result['pc'], 0x1007)
+        self.assertEqual(result['instructions'], 4)
+
+    def test_unsupported(self):
+        result = self.ctx.emulate(0x1000)
+        self.assertEqual(result['reason'], EMULATION.UNSUPPORTED)
+        self.assertEqual(result['pc'], 0x100e)
+        self.assertEqual(result['instructions'], 10)
+
+    def test_undefined(self):
+        result = self.ctx.emulate(0x2000)
+        self.assertEqual(result['reason'], EMULATION.UNDEFINED)
+        self.assertEqual(result['pc'], 0x2000)
+        self.assertEqual(result['instructions'], 0)
+
+    def test_hooks(self):
+        calls = []
+
+        def count(ctx, addr):
+            calls.append(addr)
+            self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.rip), addr)
+
+        result = self.ctx.emulate(0x1000, stops=[0x100e], hooks={0x1005: count})
+        self.assertEqual(calls, [0x1005] * 3)
+        self.assertEqual(result['instructions'], 10)
+
+        def halt(ctx, addr):
+            return False
+
+        result = self.ctx.emulate(0x1000, hooks={0x1005: halt})
+        self.assertEqual(result['reason'], EMULATION.HOOK)
+        self.assertEqual(result['pc'], 0x1005)
+        self.assertEqual(result['instructions'], 1)
+
+    def test_hook_redirect(self):
+        def skip(ctx, addr):
+            ctx.setConcreteRegisterValue(ctx.registers.rip, 0x1009)
+
+        result = self.ctx.emulate(0x1000, stops=[0x100e], hooks={0x1005: skip})
+        self.assertEqual(result['instructions'], 4)
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.ecx), 3)
+
+    def test_symbolic_pc(self):
+        self.ctx.symbolizeRegister(self.ctx.registers.al)
+        result = self.ctx.emulate(0x1000, stopOnSymbolicPc=True)
+        self.assertEqual(result['reason'], EMULATION.SYMBOLIC_PC)
+        self.assertEqual(result['pc'], 0x100d)
+        self.assertEqual(result['instructions'], 9)
+
+    def test_hook_exception(self):
+        def fail(ctx, addr):
+            raise ValueError()
+
+        with self.assertRaises(ValueError):
+            self.ctx.emulate(0x1000, hooks={0x1005: fail})
+
+
+class TestEmulationSyscalls(unittest.TestCase):
+
+    """Testing the native syscalls of the emulation."""
+
+    def setUp(self):
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ctx.setConcreteMemoryAreaValue(0x1000, [0x0f, 0x05])   # syscall
+
+    def syscall(self, number, *args):
+        """Executes one syscall and returns its return value."""
+        regs = [self.ctx.registers.rdi, self.ctx.registers.rsi, self.ctx.registers.rdx,
+                self.ctx.registers.r10, self.ctx.registers.r8, self.ctx.registers.r9]
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rax, number)
+        for reg, arg in zip(regs, args):
+            self.ctx.setConcreteRegisterValue(reg, arg & 0xffffffffffffffff)
+        result = self.ctx.emulate(0x1000, stops=[0x1002], syscalls=True)
+        self.assertEqual(result['reason'], EMULATION.ADDRESS)
+        return self.ctx.getConcreteRegisterValue(self.ctx.registers.rax)
+
+    def test_program(self):
+        self.ctx.setConcreteMemoryAreaValue(0x1000, [
+            0xb8, 0x00, 0x00, 0x00, 0x00,   # mov eax, 0 (read)
+            0xbf, 0x00, 0x00, 0x00, 0x00,   # mov edi, 0
+            0xbe, 0x00, 0x20, 0x00, 0x00,   # mov esi, 0x2000
+            0xba, 0x08, 0x00, 0x00, 0x00,   # mov edx, 8
+            0x0f, 0x05,                     # syscall
+            0x89, 0xc2,                     # mov edx, eax
+            0xb8, 0x01, 0x00, 0x00, 0x00,   # mov eax, 1 (write)
+            0xbf, 0x01, 0x00, 0x00, 0x00,   # mov edi, 1
+            0x0f, 0x05,                     # syscall
+            0xb8, 0x3c, 0x00, 0x00, 0x00,   # mov eax, 60 (exit)
+            0xbf, 0x07, 0x00, 0x00, 0x00,   # mov edi, 7
+            0x0f, 0x05,                     # syscall
+        ])
+        self.ctx.setSyscallFile('/dev/stdin', b'abcd', True)
+
+        result = self.ctx.emulate(0x1000, syscalls=True)
+        self.assertEqual(result['reason'], EMULATION.EXIT)
+        self.assertEqual(result['status'], 7)
+        self.assertEqual(result['pc'], 0x1030)
+        self.assertEqual(result['instructions'], 12)
+        self.assertEqual(result['blocks'], 3)
+
+        # The input is symbolized at once and echoed
+        self.assertEqual(self.ctx.getSyscallFile('/dev/stdout'), b'abcd')
+        for index in range(4):
+            self.assertTrue(self.ctx.isMemorySymbolized(MemoryAccess(0x2000 + index, CPUSIZE.BYTE)))
+        self.assertFalse(self.ctx.isMemorySymbolized(MemoryAccess(0x2004, CPUSIZE.BYTE)))
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rdx), 4)
+
+    def test_without_syscalls(self):
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rax, 60)
+        result = self.ctx.emulate(0x1000, stops=[0x1002])
+        self.assertEqual(result['reason'], EMULATION.ADDRESS)
+
+    def test_no_handler(self):
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rax, 39)   # getpid
+        result = self.ctx.emulate(0x1000, syscalls=True)
+        self.assertEqual(result['reason'], EMULATION.SYSCALL)
+        self.assertEqual(result['pc'], 0x1002)
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rax), 39)
+
+    def test_files(self):
+        self.ctx.setSyscallFile('/etc/flag', b'flag{}')
+        self.ctx.setConcreteMemoryAreaValue(0x3000, b'/etc/flag\x00')
+        self.ctx.setConcreteMemoryAreaValue(0x3100, b'/etc/none\x00')
+
+        # openat(AT_FDCWD, path, O_RDONLY)
+        fd = self.syscall(257, -100, 0x3000, 0)
+        self.assertEqual(fd, 3)
+        self.assertEqual(self.syscall(257, -100, 0x3100, 0), (-2) & 0xffffffffffffffff)
+
+        self.assertEqual(self.syscall(5, fd, 0x4000), 0)
+        self.assertEqual(self.ctx.getConcreteMemoryValue(MemoryAccess(0x4000 + 48, CPUSIZE.QWORD)), 6)
+
+        self.assertEqual(self.syscall(0, fd, 0x5000, 4), 4)
+        self.assertEqual(self.syscall(0, fd, 0x5004, 4), 2)
+        self.assertEqual(self.ctx.getConcreteMemoryAreaValue(0x5000, 6), b'flag{}')
+        self.assertFalse(self.ctx.isMemorySymbolized(MemoryAccess(0x5000, CPUSIZE.BYTE)))
+
+        self.assertEqual(self.syscall(3, fd), 0)
+        self.assertEqual(self.syscall(3, fd), (-9) & 0xffffffffffffffff)
+
+        # open(path, O_WRONLY | O_CREAT), write
+        self.ctx.setConcreteMemoryAreaValue(0x3200, b'/tmp/out\x00')
+        fd = self.syscall(2, 0x3200, 0x41)
+        self.assertEqual(self.syscall(1, fd, 0x5000, 4), 4)
+        self.assertEqual(self.ctx.getSyscallFile('/tmp/out'), b'flag')
+
+    def test_memory(self):
+        self.ctx.setSyscallLayout(0x20000000, 0x30000000)
+
+        self.assertEqual(self.syscall(12, 0), 0x20000000)
+        self.assertEqual(self.syscall(12, 0x20001000), 0x20001000)
+        self.assertEqual(self.syscall(12, 0), 0x20001000)
+
+        # mmap(NULL, 0x1800, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)
+        self.assertEqual(self.syscall(9, 0, 0x1800, 3, 0x22, -1, 0), 0x30000000)
+        self.assertEqual(self.syscall(9, 0, 0x1000, 3, 0x22, -1, 0), 0x30002000)
+        self.assertEqual(self.syscall(9, 0, 0, 3, 0x22, -1, 0), (-22) & 0xffffffffffffffff)
+
+
+class TestEmulationNative(unittest.TestCase):
+
+    """Testing the Unicorn backend of the emulation."""
+
+    def setUp(self):
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ctx.setConcreteMemoryAreaValue(0x1000, [
+            0xb9, 0x03, 0x00, 0x00, 0x00,   # mov ecx, 3
+            0xff, 0xc9,                     # dec ecx
+            0x75, 0xfc,                     # jne 0x1005
+            0x3c, 0x41,                     # cmp al, 0x41
+            0x74, 0x01,                     # je 0x100e
+            0x90,                           # nop
+            0xf4,                           # hlt
+        ])
+
+    def test_not_built(self):
+        if VERSION.UNICORN_INTERFACE is True:
+            self.skipTest("Triton built with Unicorn")
+        with self.assertRaises(TypeError):
+            self.ctx.emulate(0x1000, native=True)
+
+    def test_concrete(self):
+        if VERSION.UNICORN_INTERFACE is False:
+            self.skipTest("Triton not built with Unicorn")
+        result = self.ctx.emulate(0x1000, stops=[0x100e], native=True)
+        self.assertEqual(result['reason'], EMULATION.ADDRESS)
+        self.assertEqual(result['pc'], 0x100e)
+        self.assertEqual(result['instructions'], 10)
+        self.assertEqual(result['native'], 10)
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.ecx), 0)
+
+    def test_symbolic_register(self):
+        if VERSION.UNICORN_INTERFACE is False:
+            self.skipTest("Triton not built with Unicorn")
+        # The first block runs in Triton, until mov ecx concretizes rcx
+        self.ctx.symbolizeRegister(self.ctx.registers.rcx)
+        result = self.ctx.emulate(0x1000, stops=[0x100e], native=True)
+        self.assertEqual(result['instructions'], 10)
+        self.assertEqual(result['native'], 7)
+
+    def test_symbolic_memory(self):
+        if VERSION.UNICORN_INTERFACE is False:
+            self.skipTest("Triton not built with Unicorn")
+        self.ctx.setConcreteMemoryAreaValue(0x1000, [
+            0xc7, 0x04, 0x25, 0x00, 0x40, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00,  # mov dword ptr [0x4000], 0x41
+            0x8b, 0x04, 0x25, 0x00, 0x50, 0x00, 0x00,                          # mov eax, dword ptr [0x5000]
+            0x90,                                                              # nop
+        ])
+        self.ctx.symbolizeMemory(MemoryAccess(0x5000, CPUSIZE.DWORD))
+
+        # The read of the symbolized page runs in Triton
+        result = self.ctx.emulate(0x1000, stops=[0x1013], native=True)
+        self.assertEqual(result['instructions'], 3)
+        self.assertEqual(result['native'], 1)
+        self.assertEqual(self.ctx.getConcreteMemoryValue(MemoryAccess(0x4000, CPUSIZE.DWORD)), 0x41)
+        self.assertTrue(self.ctx.isRegisterSymbolized(self.ctx.registers.eax))
@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+# coding: utf-8
+"""Test exploration."""
+
+import os
+import tempfile
+import unittest
+
+from triton import *
+
+
+class TestExploration(unittest.TestCase):
+
+    """Testing the exploration engine."""
+
+    def setUp(self):
+        """Define a code guarded by two comparisons."""
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ctx.setConcreteMemoryAreaValue(0x1000, [
+            0x3c, 0x41,                 # cmp al, 0x41
+            0x75, 0x06,                 # jne 0x100a
+            0x80, 0xfb, 0x42,           # cmp bl, 0x42
+            0x75, 0x01,                 # jne 0x100a
+            0x90,                       # nop
+            0xf4,                       # hlt
+        ])
+        self.al = self.ctx.symbolizeRegister(self.ctx.registers.al)
+        self.bl = self.ctx.symbolizeRegister(self.ctx.registers.bl)
+
+    def test_generational(self):
+        result = self.ctx.explore(0x1000, exits=[0x1009, 0x100a])
+        self.assertIn((0x1007, 0x1009), result['edges'])
+        self.assertEqual(len(result['edges']), 4)
+        self.assertEqual(len(result['bitmap']), 65536)
+
+        seed = result['corpus'][-1]
+        self.assertEqual((seed['srcAddr'], seed['dstAddr']), (0x1007, 0x1009))
+        self.assertEqual(seed['generation'], 2)
+        self.assertEqual(seed['input'][self.al.getId()], 0x41)
+        self.assertEqual(seed['input'][self.bl.getId()], 0x42)
+
+        # The values of the context are left as is
+        self.assertEqual(self.ctx.getConcreteVariableValue(self.al), 0)
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rip), 0)
+
+    def test_strategies(self):
+        for strategy in (EXPLORATION.COVERAGE_GUIDED, EXPLORATION.DEPTH_FIRST):
+            result = self.ctx.explore(0x1000, strategy=strategy, exits=[0x1009, 0x100a])
+            self.assertIn((0x1007, 0x1009), result['edges'])
+
+    def test_budgets(self):
+        result = self.ctx.explore(0x1000, exits=[0x1009, 0x100a], maxRuns=1)
+        self.assertEqual(result['runs'], 1)
+        self.assertEqual(len(result['corpus']), 1)
+
+        result = self.ctx.explore(0x1000, exits=[0x1009, 0x100a], maxGenerations=1)
+        self.assertNotIn((0x1007, 0x1009), result['edges'])
+
+        with self.assertRaises(TypeError):
+            self.ctx.explore(0x1000, maxInstructions=0)
+
+    def test_fuzzer_bridge(self):
+        with tempfile.TemporaryDirectory() as sync:
+            fuzzer = os.path.join(sync, 'default')
+            output = os.path.join(sync, 'triton')
+            os.makedirs(os.path.join(fuzzer, 'queue'))
+
+            def add(name, data):
+                with open(os.path.join(fuzzer, 'queue', name), 'wb') as f:
+                    f.write(data)
+
+            def read(name):
+                with open(os.path.join(output, 'queue', name), 'rb') as f:
+                    return f.read()
+
+            def bridge():
+                return self.ctx.syncFuzzer(0x1000, fuzzer, output, [self.al, self.bl], exits=[0x1009, 0x100a])
+
+            add('id:000000,time:0,execs:0,orig:seed', b'\x00\x00')
+            result = bridge()
+            self.assertEqual((result['entries'], result['runs'], result['written']), (1, 1, 1))
+            self.assertEqual(read('id:000000,src:000000'), b'\x41\x00')
+            self.assertEqual(os.path.getsize(os.path.join(output, 'fuzz_bitmap')), 65536)
+
+            # The fuzzer imports the testcase of the bridge, then finds one with new edges and one without
+            add('id:000001,sync:triton,src:000000', b'\x41\x00')
+            add('id:000002,src:000001,time:10,op:havoc,rep:2,+cov', b'\x41\x00')
+            add('id:000003,src:000002,time:20,op:havoc,rep:4', b'\x41\x07')
+            result = bridge()
+            self.assertEqual((result['entries'], result['skipped'], result['runs'], result['written']), (3, 2, 1, 1))
+            self.assertEqual(read('id:000001,src:000002'), b'\x41\x42')
+
+            # The testcases already synchronized are not run again
+            result = bridge()
+            self.assertEqual((result['entries'], result['runs']), (0, 0))
+
+        self.assertEqual(self.ctx.getConcreteVariableValue(self.al), 0)
+
+        with self.assertRaises(TypeError):
+            self.ctx.syncFuzzer(0x1000, 'default', 'triton', [self.ctx.newSymbolicVariable(32)])
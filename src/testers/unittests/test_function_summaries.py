@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+# coding: utf-8
+"""Test Function Summaries."""
+
+import unittest
+from triton import *
+
+
+class TestFunctionSummaries(unittest.TestCase):
+
+    """Testing the built-in models of libc functions."""
+
+    def setUp(self):
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rsp, 0x7fff0000)
+        self.ctx.setConcreteMemoryValue(MemoryAccess(0x7fff0000, CPUSIZE.QWORD), 0x400123)
+
+    def call(self, symbol, *args):
+        self.ctx.setFunctionSummary(0x1000, symbol)
+        for reg, value in zip([self.ctx.registers.rdi, self.ctx.registers.rsi, self.ctx.registers.rdx], args):
+            self.ctx.setConcreteRegisterValue(reg, value)
+        self.assertTrue(self.ctx.processing(Instruction(0x1000, b"\xc3")))
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rip), 0x400123)
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rsp), 0x7fff0008)
+        return self.ctx.getConcreteRegisterValue(self.ctx.registers.rax)
+
+    def test_summaries(self):
+        self.ctx.setFunctionSummary(0x1000, "strlen")
+        self.ctx.setFunctionSummary(0x2000, "memcpy")
+        self.assertEqual(self.ctx.getFunctionSummaries(), {0x1000: "strlen", 0x2000: "memcpy"})
+        self.ctx.removeFunctionSummary(0x1000)
+        self.assertEqual(self.ctx.getFunctionSummaries(), {0x2000: "memcpy"})
+        with self.assertRaises(TypeError):
+            self.ctx.setFunctionSummary(0x1000, "printf")
+
+    def test_strlen(self):
+        self.ctx.setConcreteMemoryAreaValue(0x5000, b"hello\x00")
+        self.assertEqual(self.call("strlen", 0x5000), 5)
+        self.assertEqual(len(self.ctx.getPathConstraints()), 0)
+
+    def test_strlen_symbolic(self):
+        self.ctx.setConcreteMemoryAreaValue(0x5000, b"hello\x00")
+        for index in range(6):
+            self.ctx.symbolizeMemory(MemoryAccess(0x5000 + index, CPUSIZE.BYTE))
+        self.assertEqual(self.call("strlen", 0x5000), 5)
+
+        # The whole loop is a single path constraint
+        self.assertEqual(len(self.ctx.getPathConstraints()), 1)
+        self.assertTrue(self.ctx.isSat(self.ctx.getPathPredicate()))
+
+    def test_memcpy(self):
+        symvar = self.ctx.symbolizeMemory(MemoryAccess(0x5000, CPUSIZE.BYTE))
+        self.ctx.setConcreteMemoryAreaValue(0x5001, b"bcd")
+        self.assertEqual(self.call("memcpy", 0x6000, 0x5000, 4), 0x6000)
+        self.assertEqual(self.ctx.getConcreteMemoryAreaValue(0x6001, 3), b"bcd")
+
+        # The expression of the symbolic byte is shared with its copy
+        self.assertEqual(self.ctx.getSymbolicMemory(0x6000).getId(), self.ctx.getSymbolicMemory(0x5000).getId())
+        self.assertTrue(self.ctx.isMemorySymbolized(MemoryAccess(0x6000, CPUSIZE.BYTE)))
+
+    def test_memset(self):
+        self.assertEqual(self.call("memset", 0x6000, 0x41, 16), 0x6000)
+        self.assertEqual(self.ctx.getConcreteMemoryAreaValue(0x6000, 16), b"A" * 16)
+
+    def test_strcmp_symbolic(self):
+        self.ctx.setConcreteMemoryAreaValue(0x5000, b"abc\x00")
+        self.ctx.setConcreteMemoryAreaValue(0x6000, b"abd\x00")
+        self.ctx.symbolizeMemory(MemoryAccess(0x5002, CPUSIZE.BYTE))
+        self.assertEqual(self.call("strcmp", 0x5000, 0x6000) & 0xffffffff, 0xffffffff)
+        self.assertEqual(len(self.ctx.getPathConstraints()), 1)
+
+        # The strings cannot be equal on the path where they differ at the symbolic byte
+        eax = self.ctx.getRegisterAst(self.ctx.registers.eax)
+        ast = self.ctx.getAstContext()
+        model = self.ctx.getModel(ast.land([self.ctx.getPathPredicate(), eax == 0]))
+        self.assertEqual(len(model), 0)
+
+    def test_strncpy(self):
+        self.ctx.setConcreteMemoryAreaValue(0x5000, b"abc\x00")
+        self.ctx.setConcreteMemoryAreaValue(0x6000, b"\xff" * 8)
+        self.assertEqual(self.call("strncpy", 0x6000, 0x5000, 8), 0x6000)
+        self.assertEqual(self.ctx.getConcreteMemoryAreaValue(0x6000, 8), b"abc\x00\x00\x00\x00\x00")
@@ -2,9 +2,13 @@
 # coding: utf-8
 """Test instruction."""
 
+import json
+import os
+import struct
+import tempfile
 import unittest
 
-from triton import (ARCH, Instruction, PREFIX, OPCODE, TritonContext)
+from triton import (ARCH, CALLBACK, Instruction, PREFIX, OPCODE, REG, TRACE, TritonContext)
 
 
 class TestInstruction(unittest.TestCase):
@@ -96,6 +100,10 @@ class TestInstruction(unittest.TestCase):
         """Check disassembly equivalent."""
         self.assertEqual(self.inst.getDisassembly(), "add rax, rbx")
 
+        ret = Instruction(0x1000, b"\xc3")
+        self.Triton.disassembly(ret)
+        self.assertEqual(ret.getDisassembly(), "ret")
+
     def test_constructor(self):
         """Check opcode informations."""
         inst1 = Instruction()
@@ -108,6 +116,22 @@ class TestInstruction(unittest.TestCase):
         self.assertEqual(inst3.getOpcode(), b"\xc3")
         self.assertEqual(inst3.getAddress(), 0x1000)
 
+    def test_reset(self):
+        """Check the reuse of an instruction."""
+        inst = Instruction(0x1000, b"\x48\x01\xd8") # add rax, rbx
+        self.Triton.processing(inst)
+        self.assertTrue(len(inst.getSymbolicExpressions()) > 0)
+
+        inst.reset(0x2000, b"\xc3")
+        self.assertEqual(inst.getAddress(), 0x2000)
+        self.assertEqual(inst.getOpcode(), b"\xc3")
+        self.assertEqual(inst.getDisassembly(), "")
+        self.assertEqual(len(inst.getSymbolicExpressions()), 0)
+        self.assertEqual(len(inst.getReadRegisters()), 0)
+
+        self.Triton.processing(inst)
+        self.assertEqual(inst.getDisassembly(), "ret")
+
 
 class TestLoadAccess(unittest.TestCase):
 
@@ -240,6 +264,226 @@ class TestProcessing(unittest.TestCase):
         inst = Instruction(b"\x00\xDC")  # add ah,bl
         self.Triton.processing(inst)
 
+    def test_instruction_list(self):
+        """Check the processing of a list of instructions."""
+        self.Triton = TritonContext()
+        self.Triton.setArchitecture(ARCH.X86_64)
+
+        block = [
+            Instruction(0x1000, b"\x48\xc7\xc0\x01\x00\x00\x00"), # mov rax, 1
+            Instruction(0x1007, b"\x48\x83\xc0\x02"),             # add rax, 2
+        ]
+        self.assertTrue(self.Triton.processing(block))
+        self.assertEqual(block[1].getDisassembly(), "add rax, 2")
+        self.assertEqual(self.Triton.getConcreteRegisterValue(self.Triton.registers.rax), 3)
+        self.assertEqual(self.Triton.getConcreteRegisterValue(self.Triton.registers.rip), 0x100b)
+
+    def test_block(self):
+        """Check the processing of a basic block."""
+        self.Triton = TritonContext()
+        self.Triton.setArchitecture(ARCH.X86_64)
+
+        code = b"\x48\xc7\xc0\x01\x00\x00\x00" # mov rax, 1
+        code += b"\x48\x83\xc0\x02"            # add rax, 2
+        code += b"\xe9\xf0\x0f\x00\x00"        # jmp 0x2000
+        code += b"\x48\xff\xc0"                # inc rax
+        self.Triton.setConcreteMemoryAreaValue(0x1000, code)
+
+        insts, nxt = self.Triton.processBlock(0x1000)
+        self.assertEqual([i.getAddress() for i in insts], [0x1000, 0x1007, 0x100b])
+        self.assertEqual(insts[2].getDisassembly(), "jmp 0x2000")
+        self.assertEqual(nxt, 0x2000)
+        self.assertEqual(self.Triton.getConcreteRegisterValue(self.Triton.registers.rax), 3)
+
+        # Undefined code ends the block
+        insts, nxt = self.Triton.processBlock(0x2000)
+        self.assertEqual(insts, [])
+        self.assertEqual(nxt, 0x2000)
+
+    def test_trace(self):
+        """Check the processing of a trace."""
+        self.Triton = TritonContext()
+        self.Triton.setArchitecture(ARCH.X86_64)
+
+        calls = []
+        self.Triton.addCallback(CALLBACK.SET_CONCRETE_REGISTER_VALUE, lambda ctx, reg, value: calls.append(reg.getName()))
+
+        trace  = "# add rax, rbx then mov rcx, qword ptr [0x1000]\n"
+        trace += "0x400000 4801d8 rax=0x1 rbx=0x2\n"
+        trace += "0x400003 488b0c2500100000 [0x1000]=4142434400000000\n"
+        self.assertEqual(self.Triton.processTrace(trace.encode(), TRACE.TEXT), 2)
+        self.assertEqual(self.Triton.getConcreteRegisterValue(self.Triton.registers.rcx), 0x44434241)
+        self.assertIn("rax", calls)
+
+        # The same trace in the binary format
+        self.Triton.reset()
+        self.Triton.setArchitecture(ARCH.X86_64)
+        trace  = struct.pack("<QB", 0x400000, 3) + b"\x48\x01\xd8"
+        trace += struct.pack("<BB", 2, 3) + b"rax" + struct.pack("<BB", 1, 1) + b"rbx" + struct.pack("<BB", 1, 2)
+        trace += struct.pack("<B", 0)
+        self.assertEqual(self.Triton.processTrace(bytearray(trace), TRACE.BINARY), 1)
+        self.assertEqual(self.Triton.getConcreteRegisterValue(self.Triton.registers.rax), 3)
+
+        with self.assertRaises(TypeError):
+            self.Triton.processTrace(b"0x400000 zz\n", TRACE.TEXT)
+
+    def test_pipelined_trace(self):
+        """Check the processing of a trace decoded by threads."""
+        # inc rax then add rbx, rax, more records than the slots of the ring
+        trace  = "0x400000 48ffc0 rax=0x0 rbx=0x0\n"
+        trace += "0x400003 4801c3\n0x400000 48ffc0\n" * 300
+
+        for decoders in [0, 1, 3]:
+            self.Triton = TritonContext()
+            self.Triton.setArchitecture(ARCH.X86_64)
+            self.Triton.symbolizeRegister(self.Triton.registers.rax)
+            self.assertEqual(self.Triton.processTrace(trace.encode(), TRACE.TEXT, decoders), 601)
+            self.assertEqual(self.Triton.getConcreteRegisterValue(self.Triton.registers.rax), 301)
+            self.assertEqual(self.Triton.getConcreteRegisterValue(self.Triton.registers.rbx), 300 * 301 // 2)
+            self.assertTrue(self.Triton.isRegisterSymbolized(self.Triton.registers.rbx))
+
+        # The records before an invalid one are processed
+        self.Triton = TritonContext()
+        self.Triton.setArchitecture(ARCH.X86_64)
+        with self.assertRaises(TypeError):
+            self.Triton.processTrace(b"0x400000 48ffc0 rax=0x0\n0x400003 ffff\n", TRACE.TEXT, 2)
+        self.assertEqual(self.Triton.getConcreteRegisterValue(self.Triton.registers.rax), 1)
+
+    def test_compact_trace(self):
+        """Check the replay of a compact trace with two threads."""
+        self.Triton = TritonContext()
+        self.Triton.setArchitecture(ARCH.X86_64)
+        self.Triton.symbolizeRegister(self.Triton.registers.rbx)
+
+        def record(addr, thread, opcode, regs=[], reads=[], writes=[]):
+            data  = struct.pack("<QIB", addr, thread, len(opcode)) + opcode
+            data += struct.pack("<B", len(regs)) + b"".join(struct.pack("<HB", r, 8) + struct.pack("<Q", v) for r, v in regs)
+            for areas in (reads, writes):
+                data += struct.pack("<B", len(areas)) + b"".join(struct.pack("<QB", a, len(b)) + b for a, b in areas)
+            return data
+
+        trace  = b"TTRC\x01"
+        trace += record(0x400000, 1, b"\x48\x01\xd8", regs=[(REG.X86_64.RAX, 1)])                          # add rax, rbx
+        trace += record(0x500000, 2, b"\x48\x8b\x0c\x25\x00\x10\x00\x00", regs=[(REG.X86_64.RAX, 0x10)],
+                        reads=[(0x1000, b"ABCD\x00\x00\x00\x00")])                                          # mov rcx, qword ptr [0x1000]
+        trace += record(0x400003, 1, b"\x48\x01\xd8", writes=[(0x2000, b"\x99")])                          # add rax, rbx
+        self.assertEqual(self.Triton.processTrace(trace, TRACE.COMPACT), 3)
+
+        # The registers of the first thread are restored, its symbolic rax is kept
+        self.assertEqual(self.Triton.getConcreteRegisterValue(self.Triton.registers.rax), 1)
+        self.assertTrue(self.Triton.isRegisterSymbolized(self.Triton.registers.rax))
+        self.assertEqual(self.Triton.getConcreteMemoryValue(0x2000), 0x99)
+
+        with self.assertRaises(TypeError):
+            self.Triton.processTrace(b"TTRC\x02", TRACE.COMPACT)
+
+    def test_statistics(self):
+        """Check the statistics of the processing."""
+        self.Triton = TritonContext()
+        self.Triton.setArchitecture(ARCH.X86_64)
+        self.Triton.symbolizeRegister(self.Triton.registers.rbx)
+
+        inst = Instruction(b"\x48\x01\xd8")  # add rax, rbx
+        self.Triton.processing(inst)
+        self.assertEqual(self.Triton.getStatistics()["instructions"], 0)
+
+        self.Triton.setStatistics(True)
+        self.Triton.processing(Instruction(b"\x48\x01\xd8"))
+        self.Triton.processing(Instruction(b"\x75\x00"))  # jne +0
+        stats = self.Triton.getStatistics()
+        self.assertEqual(stats["instructions"], 2)
+        self.assertGreater(stats["nodes"], 0)
+        self.assertEqual(stats["opcodes"][OPCODE.X86.ADD]["instructions"], 1)
+        self.assertEqual(stats["phases"]["disassembly"]["count"], 2)
+        self.assertEqual(stats["phases"]["semantics"]["count"], 2)
+        self.assertEqual(stats["phases"]["pathConstraint"]["count"], 1)
+
+        self.Triton.clearStatistics()
+        self.assertEqual(self.Triton.getStatistics()["instructions"], 0)
+        self.assertEqual(self.Triton.getStatistics()["opcodes"], {})
+        self.assertEqual(self.Triton.getProfile(10)["blocks"], [])
+
+        # Two executions of a block, then one of the next block
+        for _ in range(2):
+            self.Triton.processing(Instruction(0x1000, b"\x48\x01\xd8"))  # add rax, rbx
+            self.Triton.processing(Instruction(0x1003, b"\x75\x00"))      # jne +0
+        self.Triton.processing(Instruction(0x1005, b"\x48\x01\xd8"))
+        profile = self.Triton.getProfile(1)
+        self.assertEqual(profile["opcodes"][0][0], OPCODE.X86.ADD)
+        self.assertEqual(profile["addresses"][0][0], 0x1000)
+        self.assertEqual(profile["addresses"][0][1]["instructions"], 2)
+        self.assertEqual(profile["blocks"], [(0x1000, {"executions": 2, "instructions": 4, "nodes": profile["blocks"][0][1]["nodes"]})])
+        self.assertEqual(len(self.Triton.getProfile(10)["blocks"]), 2)
+
+        with self.assertRaises(TypeError):
+            self.Triton.setStatistics(1)
+
+    def test_coverage(self):
+        """Check the coverage of the processing."""
+        self.Triton = TritonContext()
+        self.Triton.setArchitecture(ARCH.X86_64)
+        rbx = self.Triton.symbolizeRegister(self.Triton.registers.rbx)
+
+        def run(ctx):
+            ctx.processing(Instruction(0x1000, b"\x48\x83\xfb\x01"))  # cmp rbx, 1
+            ctx.processing(Instruction(0x1004, b"\x75\x02"))            # jne 0x1008
+
+        run(self.Triton)
+        self.assertEqual(self.Triton.getCoverage()["addresses"], [])
+
+        self.Triton.setCoverage(True)
+        run(self.Triton)
+        coverage = self.Triton.getCoverage()
+        self.assertEqual(coverage["addresses"], [0x1000, 0x1004])
+        self.assertEqual(coverage["edges"], {(0x1004, 0x1008): 1})
+        self.assertEqual(coverage["branches"], {(0x1004, 0x1006): (0, 1), (0x1004, 0x1008): (1, 0)})
+        self.assertEqual(coverage["uncovered"], [(0x1004, 0x1006)])
+        self.assertEqual(sum(coverage["bitmap"]), 1)
+
+        # The forks share the coverage, this one takes the other branch
+        fork = self.Triton.fork()
+        fork.setConcreteVariableValue(rbx, 1)
+        run(fork)
+        coverage = self.Triton.getCoverage()
+        self.assertEqual(coverage["edges"], {(0x1004, 0x1006): 1, (0x1004, 0x1008): 1})
+        self.assertEqual(coverage["uncovered"], [])
+
+        self.Triton.clearCoverage()
+        self.assertEqual(self.Triton.getCoverage()["branches"], {})
+
+        with self.assertRaises(TypeError):
+            self.Triton.setCoverage(1)
+
+    def test_tracing(self):
+        """Check the Chrome trace of the processing."""
+        self.Triton = TritonContext()
+        self.Triton.setArchitecture(ARCH.X86_64)
+        path = os.path.join(tempfile.mkdtemp(), "trace.json")
+
+        self.Triton.setTracing(True)
+        self.Triton.processing(Instruction(0x1000, b"\x48\x01\xd8"))  # add rax, rbx
+        self.Triton.saveTrace(path)
+        with open(path) as f:
+            events = json.load(f)["traceEvents"]
+        self.assertTrue(any(e["name"] == "buildSemantics" and e["args"]["value"] == 0x1000 for e in events))
+
+        self.Triton.setTraceCapacity(1)
+        self.Triton.processing(Instruction(b"\x48\x01\xd8"))
+        self.Triton.processing(Instruction(b"\x48\x01\xd8"))
+        self.Triton.saveTrace(path)
+        with open(path) as f:
+            self.assertEqual(len(json.load(f)["traceEvents"]), 1)
+
+        self.Triton.clearTrace()
+        self.Triton.setTracing(False)
+        self.Triton.processing(Instruction(b"\x48\x01\xd8"))
+        self.Triton.saveTrace(path)
+        with open(path) as f:
+            self.assertEqual(json.load(f)["traceEvents"], [])
+
+        with self.assertRaises(TypeError):
+            self.Triton.setTraceCapacity(0)
+
 
 class TestMemoryAccess(unittest.TestCase):
 
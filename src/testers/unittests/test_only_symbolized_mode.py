@@ -164,3 +164,34 @@ class TestOnlySymbolizedMode(unittest.TestCase):
 
         self.assertEqual(inst.getOperands()[1].getAddress(), 0x1337)
         self.assertIsNotNone(inst.getOperands()[1].getLeaAst())
+
+    def test_9(self):
+        ctx = TritonContext()
+        ctx.setArchitecture(ARCH.X86_64)
+        ctx.setMode(MODE.ONLY_ON_SYMBOLIZED, True)
+        ctx.setConcreteRegisterValue(ctx.registers.rcx, 0x1122334455667788)
+        ctx.symbolizeRegister(ctx.registers.rax)
+        ctx.symbolizeMemory(MemoryAccess(0, CPUSIZE.QWORD))
+        count = len(ctx.getSymbolicExpressions())
+
+        # Concrete instructions only update the concrete state
+        inst = Instruction(b"\x48\x89\x0b") # mov qword ptr [rbx], rcx
+        self.assertTrue(ctx.processing(inst))
+        self.assertTrue(checkAstIntegrity(inst))
+        self.assertEqual(len(inst.getSymbolicExpressions()), 0)
+        self.assertFalse(ctx.isMemorySymbolized(MemoryAccess(0, CPUSIZE.QWORD)))
+        self.assertEqual(ctx.getConcreteMemoryValue(MemoryAccess(0, CPUSIZE.QWORD)), 0x1122334455667788)
+
+        inst = Instruction(b"\x48\x01\xcb") # add rbx, rcx
+        self.assertTrue(ctx.processing(inst))
+        self.assertEqual(len(inst.getSymbolicExpressions()), 0)
+        self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.rbx), 0x1122334455667788)
+        self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.zf), 0)
+        self.assertEqual(len(ctx.getSymbolicExpressions()), count)
+
+        # A concrete write into a symbolized register keeps the rest of it symbolic
+        inst = Instruction(b"\xb0\x01") # mov al, 1
+        self.assertTrue(ctx.processing(inst))
+        self.assertEqual(len(inst.getSymbolicExpressions()), 1)
+        self.assertTrue(ctx.isRegisterSymbolized(ctx.registers.rax))
+        self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.al), 1)
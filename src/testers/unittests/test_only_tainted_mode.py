@@ -85,3 +85,31 @@ class TestOnlyTaintedMode(unittest.TestCase):
         self.assertEqual(len(inst.getWrittenRegisters()), 2)
         self.assertEqual(len(inst.getLoadAccess()), 0)
         self.assertEqual(len(inst.getStoreAccess()), 0)
+
+    def test_3(self):
+        ctx = TritonContext()
+        ctx.setArchitecture(ARCH.X86_64)
+        ctx.setMode(MODE.ONLY_ON_TAINTED, True)
+
+        ctx.setConcreteRegisterValue(ctx.registers.rax, 0x1122334455667788)
+        ctx.setConcreteRegisterValue(ctx.registers.rbx, 0x1000)
+        ctx.symbolizeRegister(ctx.registers.rax)
+        count = len(ctx.getSymbolicExpressions())
+
+        # Nothing is tainted, the instructions only update the concrete state
+        mov = Instruction(b"\x48\x89\xc1")    # mov rcx, rax
+        store = Instruction(b"\x48\x89\x0b")  # mov qword ptr [rbx], rcx
+        self.assertTrue(ctx.processing(mov))
+        self.assertTrue(ctx.processing(store))
+        self.assertTrue(checkAstIntegrity(store))
+        self.assertEqual(len(mov.getSymbolicExpressions()), 0)
+        self.assertEqual(len(ctx.getSymbolicExpressions()), count)
+        self.assertFalse(ctx.isRegisterSymbolized(ctx.registers.rcx))
+        self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.rcx), 0x1122334455667788)
+        self.assertEqual(ctx.getConcreteMemoryValue(MemoryAccess(0x1000, CPUSIZE.QWORD)), 0x1122334455667788)
+
+        # Once something is tainted, the tainted instructions are built again
+        ctx.taintRegister(ctx.registers.rax)
+        self.assertTrue(ctx.processing(mov))
+        self.assertTrue(ctx.isRegisterSymbolized(ctx.registers.rcx))
+        self.assertEqual(len(mov.getWrittenRegisters()), 2)
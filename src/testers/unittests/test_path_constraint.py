@@ -2,6 +2,8 @@
 # coding: utf-8
 """Test Path Constraint."""
 
+import os
+import tempfile
 import unittest
 from triton import *
 
@@ -82,6 +84,37 @@ class TestPathConstraint(unittest.TestCase):
         pc  = self.ctx.getPathPredicate()
         self.assertEqual(str(pc), str(opc))
 
+    def test_flatPathPredicate(self):
+        ast = self.ctx.getAstContext()
+        self.ctx.pushPathConstraint(ast.lnot(ast.variable(self.ctx.getSymbolicVariable(0)) == 1))
+
+        flat = self.ctx.getFlatPathPredicate()
+        self.assertEqual(flat.getType(), AST_NODE.LAND)
+        self.assertEqual(len(flat.getChildren()), 3)
+        self.assertEqual(str(flat.getChildren()[2]), str(self.ctx.getPathPredicate().getChildren()[1]))
+        self.assertNotEqual(len(self.ctx.getModel(flat)), 0)
+
+        # The path predicate is kept from a call to another
+        self.ctx.popPathConstraint()
+        self.assertEqual(str(self.ctx.getPathPredicate()), "(and (= (_ bv1 1) (_ bv1 1)) (= ref!35 (_ bv1 1)))")
+        self.assertEqual(len(self.ctx.getFlatPathPredicate().getChildren()), 2)
+
+    def test_forkPathConstraints(self):
+        ast = self.ctx.getAstContext()
+        child = self.ctx.fork()
+        self.assertEqual(child.getPathPredicateSize(), 1)
+        self.assertEqual(len(child.getPredicatesToReachAddress(23)), 1)
+
+        # The shared constraints diverge once one of the contexts changes them
+        child.popPathConstraint()
+        child.pushPathConstraint(ast.variable(child.getSymbolicVariable(0)) == 1)
+        self.ctx.processing(Instruction(b"\x0F\x84\x55\x00\x00\x00"))
+        self.assertEqual(child.getPathPredicateSize(), 1)
+        self.assertEqual(len(child.getPredicatesToReachAddress(23)), 0)
+        self.assertEqual(self.ctx.getPathPredicateSize(), 2)
+        self.assertEqual(len(self.ctx.getPredicatesToReachAddress(23)), 2)
+        self.assertEqual(self.ctx.getPathConstraints()[0].getTakenAddress(), 108)
+
     def test_reachingBB(self):
         self.assertEqual(len(self.ctx.getPredicatesToReachAddress(108)), 1)
         self.assertEqual(len(self.ctx.getPredicatesToReachAddress(23)), 1)
@@ -103,3 +136,183 @@ class TestPathConstraint(unittest.TestCase):
             ctx.processing(Instruction(opcodes))
 
         self.assertEqual(ctx.getModel(ctx.getPredicatesToReachAddress(0x1337)[0])[0].getValue(), 0x1336)
+
+    def test_reachingBBPushPop(self):
+        # The branch taken again from 23, reached by the first one
+        self.ctx.processing(Instruction(b"\x0F\x84\x55\x00\x00\x00"))
+        preds = self.ctx.getPredicatesToReachAddress(23)
+        self.assertEqual(len(preds), 2)
+        self.assertEqual(str(preds[1]), str(self.ctx.getPathPredicate().getChildren()[0]))
+        self.assertEqual(len(self.ctx.getPredicatesToReachAddress(114)), 1)
+
+        self.ctx.popPathConstraint()
+        self.assertEqual(len(self.ctx.getPredicatesToReachAddress(23)), 1)
+        self.assertEqual(len(self.ctx.getPredicatesToReachAddress(114)), 0)
+
+        self.ctx.clearPathConstraints()
+        self.assertEqual(len(self.ctx.getPredicatesToReachAddress(108)), 0)
+
+    def test_deduplication(self):
+        ctx = TritonContext(ARCH.X86_64)
+        ast = ctx.getAstContext()
+        x = ast.variable(ctx.newSymbolicVariable(8))
+
+        ctx.setMode(MODE.PC_DEDUPLICATION, True)
+        ctx.pushPathConstraint(x == 1)
+        ctx.pushPathConstraint(x == 1)
+        ctx.pushPathConstraint(x != 2)
+        self.assertEqual(ctx.getPathPredicateSize(), 2)
+        self.assertEqual(ctx.getPathConstraints()[0].getCount(), 2)
+
+        # Once popped, the constraint is recorded again
+        ctx.popPathConstraint()
+        ctx.popPathConstraint()
+        ctx.pushPathConstraint(x == 1)
+        self.assertEqual(ctx.getPathPredicateSize(), 1)
+        self.assertEqual(ctx.getPathConstraints()[0].getCount(), 1)
+
+    def test_loopSummarization(self):
+        code = {
+            0x1000: b"\x48\xff\xc8",  # dec rax
+            0x1003: b"\x75\xfb",      # jne 0x1000
+        }
+
+        for summarize in (False, True):
+            ctx = TritonContext(ARCH.X86_64)
+            ctx.setMode(MODE.PC_LOOP_SUMMARIZATION, summarize)
+            ctx.setConcreteRegisterValue(ctx.registers.rax, 5)
+            ctx.symbolizeRegister(ctx.registers.rax)
+
+            pc = 0x1000
+            while pc != 0x1005:
+                ctx.processing(Instruction(pc, code[pc]))
+                pc = ctx.getConcreteRegisterValue(ctx.registers.rip)
+
+            pcs = ctx.getPathConstraints()
+            if not summarize:
+                self.assertEqual(len(pcs), 5)
+                continue
+
+            # The first three iterations are summarized, the last one taken stays apart
+            self.assertEqual(len(pcs), 3)
+            self.assertEqual(pcs[0].getCount(), 3)
+            self.assertEqual(len(pcs[0].getIterations()), 3)
+            self.assertEqual(pcs[1].getCount(), 1)
+            self.assertEqual(pcs[2].getTakenAddress(), 0x1005)
+
+            # Leaves the loop after the second iteration
+            self.assertEqual(ctx.getModel(ctx.getPredicateToFlipIteration(0, 1))[0].getValue(), 2)
+            self.assertEqual(ctx.getModel(ctx.getPredicateToFlipIteration(1, 0))[0].getValue(), 4)
+            self.assertEqual(len(ctx.getModel(ctx.getPathPredicate())), 1)
+
+            with self.assertRaises(TypeError):
+                ctx.getPredicateToFlipIteration(0, 3)
+            with self.assertRaises(TypeError):
+                ctx.setFlippableIterations(0)
+
+    def test_relevantPathPredicate(self):
+        ctx = TritonContext(ARCH.X86_64)
+        ast = ctx.getAstContext()
+        x, y, z = [ast.variable(ctx.newSymbolicVariable(8)) for i in range(3)]
+
+        ctx.pushPathConstraint(x == 1)
+        ctx.pushPathConstraint(y == z)
+        ctx.pushPathConstraint(ast.lnot(z == 3))
+        self.assertEqual(str(ctx.getRelevantPathPredicate(y == 3)), "(and (and (= (_ bv1 1) (_ bv1 1)) (= SymVar_1 SymVar_2)) (not (= SymVar_2 (_ bv3 8))))")
+        self.assertEqual(len(ctx.getModel(ast.land([ctx.getRelevantPathPredicate(y == 3), y == 3]))), 0)
+
+        # The constraints become dependent once a constraint shares their variables
+        ctx.pushPathConstraint(x == z)
+        self.assertEqual(str(ctx.getRelevantPathPredicate(y == 3).getChildren()[1]), str(x == z))
+        self.assertEqual(str(ctx.getRelevantPathPredicate(x == 2)), str(ctx.getPathPredicate()))
+        ctx.popPathConstraint()
+        self.assertEqual(str(ctx.getRelevantPathPredicate(x == 2)), "(and (= (_ bv1 1) (_ bv1 1)) (= SymVar_0 (_ bv1 8)))")
+
+    def test_solveAllBranchFlips(self):
+        flips = self.ctx.solveAllBranchFlips()
+        self.assertEqual(len(flips), 1)
+        self.assertEqual(flips[0]['index'], 0)
+        self.assertEqual(flips[0]['dstAddr'], 23)
+        self.assertEqual(flips[0]['status'], SOLVER_STATE.SAT)
+
+        # The model takes the branch not taken
+        model = flips[0]['model']
+        self.assertNotEqual(model[0].getValue() & 0x3fffffff, model[1].getValue() & 0x3fffffff)
+
+        flips = self.ctx.solveAllBranchFlips(parallel=True)
+        self.assertEqual(flips[0]['status'], SOLVER_STATE.SAT)
+        self.assertEqual(len(self.ctx.solveAllBranchFlips(limit=1)), 1)
+
+    def test_solveAllBranchFlipsUnsatCores(self):
+        ctx = TritonContext(ARCH.X86)
+        ctx.symbolizeRegister(ctx.registers.eax, 'x')
+
+        trace = [
+            (0x1000, b"\x3d\x10\x00\x00\x00"),  # cmp eax, 0x10
+            (0x1005, b"\x73\x10"),              # jae 0x1017
+            (0x1007, b"\x3d\x20\x00\x00\x00"),  # cmp eax, 0x20
+            (0x100c, b"\x72\x10"),              # jb 0x101e
+            (0x101e, b"\x3d\x20\x00\x00\x00"),  # cmp eax, 0x20
+            (0x1023, b"\x72\x10"),              # jb 0x1035
+        ]
+        for addr, opcodes in trace:
+            ctx.processing(Instruction(addr, opcodes))
+
+        flips = ctx.solveAllBranchFlips(unsatCores=True)
+        self.assertEqual([f['status'] for f in flips], [SOLVER_STATE.SAT, SOLVER_STATE.UNSAT, SOLVER_STATE.UNSAT])
+
+        # The core of the first UNSAT flip (x < 0x10 and x >= 0x20) prunes the second one
+        self.assertEqual([f['pruned'] for f in flips], [False, False, True])
+        self.assertEqual(len(flips[1]['core']), 2)
+        self.assertEqual(flips[2]['core'], [])
+
+        flips = ctx.solveAllBranchFlips()
+        self.assertEqual([f['pruned'] for f in flips], [False, False, False])
+
+    def test_solveAllBranchFlipsAdaptiveTimeouts(self):
+        self.ctx.setSolverAdaptiveTimeouts(True)
+        self.ctx.setSolverBudget(0, 100, 1000)
+
+        flips = self.ctx.solveAllBranchFlips()
+        self.assertEqual(flips[0]['status'], SOLVER_STATE.SAT)
+        self.assertEqual(self.ctx.getSolverBudgetStatistics()['retried'], 0)
+
+        # The base timeout cannot exceed the max one
+        with self.assertRaises(TypeError):
+            self.ctx.setSolverBudget(0, 1000, 100)
+
+        self.ctx.resetSolverBudget()
+        self.assertEqual(self.ctx.getSolverBudgetStatistics()['spent'], 0)
+
+    def test_spilling(self):
+        ast = self.ctx.getAstContext()
+        x = ast.variable(self.ctx.getSymbolicVariable(0))
+        path = os.path.join(tempfile.mkdtemp(), "spill")
+
+        self.ctx.setPathConstraintsSpilling(path, 4)
+        for i in range(20):
+            self.ctx.pushPathConstraint(x != i)
+        self.assertEqual(self.ctx.getPathPredicateSize(), 21)
+        self.assertEqual(self.ctx.getNumberOfSpilledPathConstraints(), 16)
+        self.assertTrue(os.path.exists(path))
+
+        # The cold constraints are faulted in when they are read
+        pcs = self.ctx.getPathConstraints()
+        self.assertEqual(self.ctx.getNumberOfSpilledPathConstraints(), 0)
+        self.assertEqual(pcs[0].getTakenAddress(), 108)
+        self.assertEqual(str(pcs[1].getTakenPredicate()), str(x != 0))
+        self.assertNotEqual(len(self.ctx.getModel(self.ctx.getPathPredicate())), 0)
+
+        # And released again at the next spill
+        for i in range(4):
+            self.ctx.pushPathConstraint(x != 0x100 + i)
+        self.assertEqual(self.ctx.getNumberOfSpilledPathConstraints(), 20)
+
+        # The chunks reached by the pops are forgotten
+        for i in range(20):
+            self.ctx.popPathConstraint()
+        self.assertEqual(self.ctx.getNumberOfSpilledPathConstraints(), 4)
+        self.assertEqual(self.ctx.getPathConstraints()[0].getTakenAddress(), 108)
+
+        self.ctx.setPathConstraintsSpilling("")
+        self.assertFalse(os.path.exists(path))
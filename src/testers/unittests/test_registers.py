@@ -266,3 +266,67 @@ class TestRegisterObject(unittest.TestCase):
         self.assertEqual(self.x64.registers.rax, self.x64.getRegister('RaX'))
         self.assertEqual(self.arm.registers.r0, self.arm.getRegister('R0'))
         self.assertEqual(self.aarch.registers.x9, self.aarch.getRegister('x9'))
+
+    def test_namespace(self):
+        """Check the registers attribute creates the registers on access."""
+        regs = self.x64.registers
+        self.assertIs(regs.rax, regs.rax)
+        self.assertIn('zmm0', dir(regs))
+        self.assertFalse(hasattr(regs, 'RAX'))
+        self.assertFalse(hasattr(regs, 'eax0'))
+
+        # The attribute outlives the context with the registers already accessed
+        del self.x64
+        self.assertEqual(regs.rax.getName(), 'rax')
+        self.assertEqual(REG.X86_64.RAX, regs.rax.getId())
+        self.assertIn('RAX', dir(REG.X86_64))
+
+
+class TestThreadRegisters(unittest.TestCase):
+
+    """Testing the registers of the guest threads."""
+
+    def setUp(self):
+        """Define the arch."""
+        self.ctx = TritonContext(ARCH.X86_64)
+
+    def test_switch(self):
+        """Check that each thread has its own concrete, symbolic and taint registers."""
+        regs = self.ctx.registers
+        self.assertEqual(self.ctx.getThread(), 0)
+        self.assertEqual(self.ctx.getThreads(), [0])
+
+        self.ctx.setConcreteRegisterValue(regs.rax, 0x1111)
+        self.ctx.setConcreteMemoryValue(0x1000, 0x42)
+        self.ctx.symbolizeRegister(regs.rbx)
+        self.ctx.taintRegister(regs.rcx)
+
+        # A new thread starts with a copy of the registers
+        self.ctx.setThread(7)
+        self.assertEqual(self.ctx.getThreads(), [0, 7])
+        self.assertEqual(self.ctx.getConcreteRegisterValue(regs.rax), 0x1111)
+        self.assertTrue(self.ctx.isRegisterSymbolized(regs.rbx))
+        self.assertTrue(self.ctx.isRegisterTainted(regs.rcx))
+
+        self.ctx.setConcreteRegisterValue(regs.rax, 0x2222)
+        self.ctx.concretizeRegister(regs.rbx)
+        self.ctx.untaintRegister(regs.rcx)
+        self.ctx.setConcreteMemoryValue(0x1000, 0x43)
+
+        # The registers of the first thread are restored, the memory is shared
+        self.ctx.setThread(0)
+        self.assertEqual(self.ctx.getConcreteRegisterValue(regs.rax), 0x1111)
+        self.assertTrue(self.ctx.isRegisterSymbolized(regs.rbx))
+        self.assertTrue(self.ctx.isRegisterTainted(regs.rcx))
+        self.assertEqual(self.ctx.getConcreteMemoryValue(0x1000), 0x43)
+
+        self.ctx.setThread(7)
+        self.assertEqual(self.ctx.getConcreteRegisterValue(regs.rax), 0x2222)
+        self.assertFalse(self.ctx.isRegisterSymbolized(regs.rbx))
+        self.assertFalse(self.ctx.isRegisterTainted(regs.rcx))
+
+        with self.assertRaises(TypeError):
+            self.ctx.removeThread(7)
+
+        self.ctx.removeThread(0)
+        self.assertEqual(self.ctx.getThreads(), [7])
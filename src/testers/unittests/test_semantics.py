@@ -110,6 +110,23 @@ class TestIR(unittest.TestCase):
         self.emulate(0x40065c)
         return
 
+    def test_ir_with_hash_consing(self):
+        """Load binary, setup environment and emulate the ir test suite."""
+        self.ctx = TritonContext()
+        self.ctx.setArchitecture(ARCH.X86_64)
+        self.ctx.setMode(MODE.AST_HASH_CONSING, True)
+
+        # Load the binary
+        binary_file = os.path.join(os.path.dirname(__file__), "misc", "ir-test-suite.bin")
+        self.load_binary(binary_file)
+
+        # Define a fake stack
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rbp, 0x7fffffff)
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rsp, 0x6fffffff)
+
+        self.emulate(0x40065c)
+        return
+
     def test_ir_with_opti2(self):
         """Load binary, setup environment and emulate the ir test suite."""
         self.ctx = TritonContext()
@@ -2,6 +2,8 @@
 # coding: utf-8
 """Test Solvers."""
 
+import shutil
+import threading
 import unittest
 
 from triton import *
@@ -60,3 +62,394 @@ class TestSolvers(unittest.TestCase):
         if 'BITWUZLA' in dir(SOLVER):
             self.solve_a_query(SOLVER.BITWUZLA)
             self.solve_bswap(SOLVER.BITWUZLA)
+
+    def test_portfolio(self):
+        if 'PORTFOLIO' not in dir(SOLVER):
+            return
+
+        self.solve_a_query(SOLVER.PORTFOLIO)
+        self.solve_bswap(SOLVER.PORTFOLIO)
+        self.assertIsNotNone(self.ctx.getSolverPortfolioWinner())
+
+        # Several instances of one solver may be raced
+        kind = SOLVER.Z3 if 'Z3' in dir(SOLVER) else SOLVER.BITWUZLA
+        self.ctx.setSolver(SOLVER.PORTFOLIO)
+        self.ctx.setSolverPortfolio([kind, kind])
+        x = self.ast.variable(self.ctx.newSymbolicVariable(8, "x"))
+        self.assertFalse(self.ctx.isSat(x == x + 1))
+        self.assertEqual(self.ctx.getSolverPortfolioWinner(), kind)
+        self.assertEqual(self.ctx.getSolverPortfolioWins(), {kind: 1})
+
+    def test_local_search(self):
+        self.ctx.setSolver(SOLVER.LOCAL_SEARCH)
+        self.solve_a_query(SOLVER.LOCAL_SEARCH)
+        self.solve_bswap(SOLVER.LOCAL_SEARCH)
+
+        # A checksum of the inputs is solved by the search
+        self.ctx.setSolver(SOLVER.LOCAL_SEARCH)
+        data = [self.ast.variable(self.ctx.newSymbolicVariable(8)) for i in range(8)]
+        checksum = self.ast.bv(0, 16)
+        for byte in data:
+            checksum = checksum + self.ast.zx(8, byte)
+        model = self.ctx.getModel(self.ast.land([checksum == 0x3a5, data[0] > 0x80]))
+        self.assertEqual(sum(m.getValue() for m in model.values()), 0x3a5)
+        self.assertGreater(model[data[0].getSymbolicVariable().getId()].getValue(), 0x80)
+        self.assertEqual(self.ctx.getSolverLocalSearchStatistics()["hits"], 1)
+
+        # An UNSAT query is handed off to the SMT solver, or UNKNOWN without one
+        if 'Z3' in dir(SOLVER) or 'BITWUZLA' in dir(SOLVER):
+            self.assertFalse(self.ctx.isSat(data[0] == data[0] + 1))
+            self.assertEqual(self.ctx.getSolverLocalSearchStatistics()["handoffs"], 1)
+        self.ctx.setSolverLocalSearchFallback(None)
+        self.ctx.setSolverLocalSearchBudget(10)
+        model, status, time = self.ctx.getModel(data[0] == data[0] + 1, status=True)
+        self.assertEqual(status, SOLVER_STATE.UNKNOWN)
+
+        if 'PORTFOLIO' in dir(SOLVER):
+            self.ctx.setSolver(SOLVER.PORTFOLIO)
+            kind = SOLVER.Z3 if 'Z3' in dir(SOLVER) else SOLVER.BITWUZLA
+            self.ctx.setSolverPortfolio([SOLVER.LOCAL_SEARCH, kind])
+            self.assertFalse(self.ctx.isSat(data[0] == data[0] + 1))
+            self.assertEqual(self.ctx.getSolverPortfolioWinner(), kind)
+
+    def test_external(self):
+        self.ctx.setSolver(SOLVER.EXTERNAL)
+        x = self.ast.variable(self.ctx.newSymbolicVariable(8, "x"))
+
+        # No query without a solver to run
+        with self.assertRaises(TypeError):
+            self.ctx.isSat(x == 1)
+
+        if shutil.which("z3") is None:
+            return
+
+        self.ctx.setSolverExternalCommand(["z3", "-in"])
+        self.ctx.setSolverExternalPoolSize(2)
+
+        # The sub-terms shared by the query are printed once
+        y = x + 1
+        model = self.ctx.getModel(self.ast.land([y * 3 == 9, y > 1]))
+        self.assertEqual(model[0].getValue(), 2)
+        self.assertFalse(self.ctx.isSat(x == x + 1))
+        self.assertEqual(len(self.ctx.getModels(x < 5, 10)), 5)
+
+        # Incremental mode
+        self.ctx.pushSolverConstraint(x > 10)
+        self.ctx.pushSolverScope()
+        self.ctx.pushSolverConstraint(x < 12)
+        self.assertEqual(self.ctx.getModelWithAssumptions([])[0].getValue(), 11)
+        self.ctx.popSolverScope()
+        self.assertEqual(self.ctx.getModelWithAssumptions([x == 20])[0].getValue(), 20)
+
+    def test_remote(self):
+        self.ctx.setSolver(SOLVER.REMOTE)
+        x = self.ast.variable(self.ctx.newSymbolicVariable(8, "x"))
+
+        # No query without a server
+        with self.assertRaises(TypeError):
+            self.ctx.isSat(x == 1)
+        with self.assertRaises(TypeError):
+            self.ctx.setSolverRemoteEndpoints(["localhost"])
+
+        # A server which cannot be reached gives UNKNOWN
+        self.ctx.setSolverRemoteEndpoints(["127.0.0.1:1"])
+        model, status, time = self.ctx.getModel(x == 1, status=True)
+        self.assertEqual(status, SOLVER_STATE.UNKNOWN)
+        self.assertEqual(len(model), 0)
+
+    def test_analytic(self):
+        self.ctx.setSolverAnalytic(True)
+        x = self.ast.variable(self.ctx.newSymbolicVariable(32, "x"))
+        y = self.ast.variable(self.ctx.newSymbolicVariable(32, "y"))
+        b = self.ast.variable(self.ctx.newSymbolicVariable(8, "b"))
+
+        # Intervals and equality chains, decided without solver
+        model = self.ctx.getModel(self.ast.land([x - 5 < 10, y == x + 3, self.ast.zx(24, b) == 0x41]))
+        self.assertTrue(5 <= model[0].getValue() < 15)
+        self.assertEqual(model[1].getValue(), model[0].getValue() + 3)
+        self.assertEqual(model[2].getValue(), 0x41)
+        self.assertFalse(self.ctx.isSat(self.ast.land([x > 0x100, x < 0x80])))
+
+        # Only the residue is sent to the solver, the model is completed with the analytic values
+        model = self.ctx.getModel(self.ast.land([b == 0x42, x * y == 0x1234]))
+        self.assertEqual(model[2].getValue(), 0x42)
+        self.assertEqual((model[0].getValue() * model[1].getValue()) & 0xffffffff, 0x1234)
+
+        stats = self.ctx.getSolverAnalyticStatistics()
+        self.assertEqual(stats["queries"], 3)
+        self.assertEqual(stats["decided"], 2)
+        self.assertEqual(stats["delegated"], 1)
+        self.assertEqual(stats["variables"], 4)
+
+    def test_preprocessing(self):
+        self.ctx.setSolverPreprocessing(True)
+        x = self.ast.variable(self.ctx.newSymbolicVariable(32, "x"))
+        y = self.ast.variable(self.ctx.newSymbolicVariable(32, "y"))
+        v = self.ast.variable(self.ctx.newSymbolicVariable(32, "v"))
+        b = self.ast.variable(self.ctx.newSymbolicVariable(8, "b"))
+
+        # The models are completed with the fixed and eliminated variables
+        model = self.ctx.getModel(self.ast.land([x == 5, y > x, v == x + y]))
+        self.assertEqual(model[0].getValue(), 5)
+        self.assertGreater(model[1].getValue(), 5)
+        self.assertEqual(model[2].getValue(), (model[0].getValue() + model[1].getValue()) & 0xffffffff)
+
+        # Decided without solver
+        self.assertFalse(self.ctx.isSat(self.ast.land([x == 1, x == 2])))
+        self.assertFalse(self.ctx.isSat(self.ast.zx(24, b) == 0x141))
+
+        stats = self.ctx.getSolverPreprocessingStatistics()
+        self.assertEqual(stats["queries"], 3)
+        self.assertEqual(stats["decided"], 2)
+        self.assertGreaterEqual(stats["fixed"], 1)
+        self.assertGreaterEqual(stats["eliminated"], 1)
+        self.assertEqual(stats["narrowed"], 1)
+
+    def test_profiles(self):
+        x = self.ast.variable(self.ctx.newSymbolicVariable(32, "x"))
+        y = self.ast.variable(self.ctx.newSymbolicVariable(32, "y"))
+
+        # The default solvers by default
+        self.assertTrue(self.ctx.isSat(x + 1 == 2))
+        self.assertEqual(self.ctx.getSolverProfileStatistics(), {})
+
+        # Selected by the class of the queries
+        self.ctx.setSolverProfileSelection(True)
+        self.ctx.addSolverProfile("arithmetic", tactics=["simplify", "bit-blast", "sat"])
+        model = self.ctx.getModel(self.ast.land([x * y == 0x1234, x > 1, y > 1]))
+        self.assertEqual((model[0].getValue() * model[1].getValue()) & 0xffffffff, 0x1234)
+        self.assertFalse(self.ctx.isSat(self.ast.land([x ^ y == 1, x == y])))
+
+        # Forced for all the queries
+        self.ctx.setSolverProfile("qfbv")
+        self.assertTrue(self.ctx.isSat(x * y == 0x4321))
+        self.ctx.setSolverProfile(None)
+
+        self.assertEqual(self.ctx.getSolverProfileStatistics(), {"arithmetic": 1, "qfbv": 2})
+        self.assertRaises(TypeError, self.ctx.setSolverProfile, "unknown")
+
+    def test_statistics(self):
+        x = self.ast.variable(self.ctx.newSymbolicVariable(8, "x"))
+
+        # Nothing is recorded by default
+        self.ctx.isSat(x == 1)
+        self.assertEqual(self.ctx.getSolverStatistics()["sat"], 0)
+
+        self.ctx.setSolverStatistics(True)
+        self.ctx.setSolverCacheCapacity(16)
+        self.ctx.getModel(x * 3 == 9)
+        self.ctx.isSat(x == x + 1)
+        self.ctx.getModel(x * 3 == 9)
+
+        stats = self.ctx.getSolverStatistics()
+        self.assertEqual(stats["sat"], 2)
+        self.assertEqual(stats["unsat"], 1)
+        self.assertEqual(stats["hits"], 1)
+        self.assertEqual(sum(stats["histogram"]), 2)
+        self.assertGreater(stats["nodes"], 0)
+        self.assertGreaterEqual(stats["nodes"], stats["largest"])
+
+        self.ctx.clearSolverStatistics()
+        self.assertEqual(self.ctx.getSolverStatistics()["sat"], 0)
+
+    def test_async(self):
+        self.ctx.setSolverThreads(2)
+        self.assertEqual(self.ctx.getSolverThreads(), 2)
+
+        x = self.ast.variable(self.ctx.newSymbolicVariable(8, "x"))
+        y = self.ast.variable(self.ctx.newSymbolicVariable(8, "y"))
+        f1 = self.ctx.getModelAsync(self.ast.land([x + y == 7, y == 2]))
+        f2 = self.ctx.isSatAsync(x == x + 1)
+
+        # The context may be used while the queries are solved
+        self.ctx.newSymbolicVariable(8, "z")
+
+        self.assertTrue(f1.wait(timeout=60000))
+        self.assertEqual(f1.getStatus(), SOLVER_STATE.SAT)
+        model = f1.getModel()
+        self.assertEqual(model[x.getSymbolicVariable().getId()].getValue(), 5)
+        self.assertEqual(model[y.getSymbolicVariable().getId()].getValue(), 2)
+        self.assertFalse(f2.isSat())
+        self.assertEqual(len(f2.getModel()), 0)
+        self.assertFalse(f2.isCancelled())
+
+        # A query answered by the cache is done at once
+        f3 = self.ctx.getModelAsync(self.ast.land([x + y == 7, y == 2]))
+        self.assertTrue(f3.isDone())
+        self.assertEqual(f3.getModel()[x.getSymbolicVariable().getId()].getValue(), 5)
+
+        # A cancelled query is UNKNOWN
+        f4 = self.ctx.isSatAsync(x * y == 143)
+        f4.cancel()
+        if f4.isCancelled():
+            self.assertEqual(f4.getStatus(), SOLVER_STATE.UNKNOWN)
+
+    def test_executor(self):
+        threads = self.ctx.getExecutorThreads()
+        self.assertGreaterEqual(threads, 1)
+
+        # The queries of the contexts share the threads of the process
+        self.ctx.setExecutorThreads(1)
+        other = TritonContext(ARCH.X86_64)
+        self.assertEqual(other.getExecutorThreads(), 1)
+
+        x = self.ast.variable(self.ctx.newSymbolicVariable(8, "x"))
+        futures = [self.ctx.isSatAsync(x == i) for i in range(4)]
+        self.assertTrue(all(f.isSat() for f in futures))
+
+        self.ctx.setExecutorThreads(threads)
+        self.assertEqual(self.ctx.getExecutorThreads(), threads)
+
+    def test_enumerate_models(self):
+        x = self.ast.variable(self.ctx.newSymbolicVariable(8, "x"))
+        y = self.ast.variable(self.ctx.newSymbolicVariable(8, "y"))
+        constraint = self.ast.land([x < 3, y < 10])
+        self.assertEqual(len(self.ctx.getModels(constraint, 100)), 30)
+
+        # Projected onto x, the models differing on y only are the same
+        models = self.ctx.getModels(constraint, 100, variables=[x.getSymbolicVariable()])
+        self.assertEqual(sorted(m[0].getValue() for m in models), [0, 1, 2])
+        self.assertTrue(all(len(m) == 1 for m in models))
+
+        # The models are streamed to the callback, which may stop the enumeration
+        seen = []
+        def cb(model):
+            seen.append(model)
+            return len(seen) < 4
+        count, status, time = self.ctx.getModels(constraint, 100, status=True, callback=cb)
+        self.assertEqual(status, SOLVER_STATE.SAT)
+        self.assertEqual(count, 4)
+        self.assertEqual(len(seen), 4)
+
+        def raising(model):
+            raise ValueError()
+        with self.assertRaises(ValueError):
+            self.ctx.getModels(constraint, 100, callback=raising)
+
+    def test_threads(self):
+        """Contexts solve concurrently, the GIL is released while solving."""
+        def solve(results, index):
+            ctx = TritonContext(ARCH.X86_64)
+            ast = ctx.getAstContext()
+            x = ast.variable(ctx.newSymbolicVariable(32, "x"))
+            node = ast.land([x * x == index * index, x < 0x10000])
+            results[index] = (ctx.isSat(node), ctx.getModel(node)[0].getValue(), len(ctx.getModels(x < 4, 10)))
+
+        results = dict()
+        threads = [threading.Thread(target=solve, args=(results, i)) for i in range(1, 5)]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+        self.assertEqual(results, {i: (True, i, 4) for i in range(1, 5)})
+
+    def test_session(self):
+        if 'Z3' not in dir(SOLVER):
+            return
+
+        self.ctx.setSolver(SOLVER.Z3)
+        x = self.ast.variable(self.ctx.newSymbolicVariable(8, "x"))
+
+        # The prefix holds for every query of the session
+        self.ctx.pushSolverConstraint(x > 10)
+        self.ctx.pushSolverScope()
+        self.ctx.pushSolverConstraint(x < 12)
+        model = self.ctx.getModelWithAssumptions([])
+        self.assertEqual(model[0].getValue(), 11)
+
+        # The assumptions are dropped once the query is done
+        model, status, time = self.ctx.getModelWithAssumptions([x == 20], status=True)
+        self.assertEqual(status, SOLVER_STATE.UNSAT)
+        self.assertEqual(len(model), 0)
+
+        self.ctx.popSolverScope()
+        model = self.ctx.getModelWithAssumptions([x == 20])
+        self.assertEqual(model[0].getValue(), 20)
+
+        with self.assertRaises(TypeError):
+            self.ctx.popSolverScope()
+
+        self.ctx.resetSolverSession()
+        model = self.ctx.getModelWithAssumptions([x == 3])
+        self.assertEqual(model[0].getValue(), 3)
+
+    def test_cache(self):
+        x = self.ast.variable(self.ctx.newSymbolicVariable(8, "x"))
+        y = self.ast.variable(self.ctx.newSymbolicVariable(8, "y"))
+        self.ctx.setSolverCacheCapacity(16)
+
+        model = self.ctx.getModel(self.ast.land([x + y == 7, y == 2]))
+        self.assertEqual(model[0].getValue(), 5)
+
+        # The operands of commutative operators are hashed in a canonical order
+        model, status, time = self.ctx.getModel(self.ast.land([y + x == 7, y == 2]), status=True)
+        self.assertEqual(status, SOLVER_STATE.SAT)
+        self.assertEqual(model[0].getValue(), 5)
+        self.assertEqual(model[1].getValue(), 2)
+
+        self.assertFalse(self.ctx.isSat(x == x + 1))
+        self.assertFalse(self.ctx.isSat(x == x + 1))
+        self.assertEqual(self.ctx.getSolverCacheStatistics(), {"counterexamples": 0, "hits": 2, "misses": 2, "size": 2})
+
+        self.ctx.clearSolverCache()
+        self.assertEqual(self.ctx.getSolverCacheStatistics(), {"counterexamples": 0, "hits": 0, "misses": 0, "size": 0})
+        self.ctx.setSolverCacheCapacity(0)
+
+    def test_cache_counterexamples(self):
+        x = self.ast.variable(self.ctx.newSymbolicVariable(8, "x"))
+        y = self.ast.variable(self.ctx.newSymbolicVariable(8, "y"))
+        self.ctx.setSolverCacheCapacity(16)
+
+        model = self.ctx.getModel(self.ast.land([x == 5, y > 3]))
+        self.assertEqual(model[0].getValue(), 5)
+
+        # Satisfied by the previous model, the solver is not called
+        model = self.ctx.getModel(x > 4)
+        self.assertEqual(model[0].getValue(), 5)
+
+        # Satisfied by the concrete values (x = 0, y = 0)
+        self.assertTrue(self.ctx.isSat(x + y == 0))
+
+        # Contains the conjuncts of an UNSAT query
+        self.assertFalse(self.ctx.isSat(self.ast.land([x == 1, x == 2])))
+        self.assertFalse(self.ctx.isSat(self.ast.land([y == 3, x == 2, x == 1])))
+        self.assertEqual(self.ctx.getSolverCacheStatistics()["counterexamples"], 3)
+        self.ctx.setSolverCacheCapacity(0)
+
+    def test_equivalence(self):
+        x = self.ast.variable(self.ctx.newSymbolicVariable(8, "x"))
+        y = self.ast.variable(self.ctx.newSymbolicVariable(8, "y"))
+
+        self.assertTrue(self.ctx.isEquivalent((x & y) + (x | y), x + y))
+        self.assertTrue(self.ctx.isEquivalent((x | y) - (x & y), x ^ y))
+        self.assertFalse(self.ctx.isEquivalent(x + y, x - y))
+        # Only differ on x = 0x80, refuted by the corner values
+        self.assertFalse(self.ctx.isEquivalent(self.ast.ite(x == 0x80, y, x), x))
+
+        self.assertEqual(self.ctx.checkEquivalences([(x * 2, x << 1), (x, y), (~x, -x - 1)]), [True, False, True])
+
+        self.assertTrue(self.ctx.isOpaquePredicate(((x * (x + 1)) & 1) == 0))
+        self.assertTrue(self.ctx.isOpaquePredicate(self.ast.lor([x == 1, x != 1])))
+        self.assertFalse(self.ctx.isOpaquePredicate(x == y))
+
+        with self.assertRaises(TypeError):
+            self.ctx.isEquivalent(x, self.ast.zx(8, x))
+        with self.assertRaises(TypeError):
+            self.ctx.isOpaquePredicate(x)
+
+    def test_unsat_core(self):
+        x = self.ast.variable(self.ctx.newSymbolicVariable(8, "x"))
+        y = self.ast.variable(self.ctx.newSymbolicVariable(8, "y"))
+
+        core = self.ctx.getUnsatCore([y > 3, x == 1, y < 200, x == 2])
+        self.assertEqual(sorted(str(n) for n in core), ["(= x (_ bv1 8))", "(= x (_ bv2 8))"])
+        self.assertEqual(self.ctx.getUnsatCore([y > 3, x == 1]), [])
+
+        # The core is recorded into the cache, a query containing it is UNSAT
+        self.ctx.setSolverCacheCapacity(16)
+        self.ctx.getUnsatCore([y > 3, x == 1, x == 2])
+        self.assertFalse(self.ctx.isSat(self.ast.land([x == 2, y == 5, x == 1])))
+        self.ctx.setSolverCacheCapacity(0)
+
+        with self.assertRaises(TypeError):
+            self.ctx.getUnsatCore([x])
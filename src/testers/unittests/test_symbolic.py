@@ -2,9 +2,11 @@
 # coding: utf-8
 """Test Symbolic."""
 
+import os
+import tempfile
 import unittest
 
-from triton import ARCH, Instruction, CPUSIZE, MemoryAccess, Immediate, TritonContext
+from triton import ARCH, AST_NODE, Instruction, CPUSIZE, MemoryAccess, Immediate, MODE, SYMBOLIC, TritonContext
 
 
 class TestSymbolic(unittest.TestCase):
@@ -89,6 +91,277 @@ class TestSymbolic(unittest.TestCase):
             # Incorrect size
             self.Triton.assignSymbolicExpressionToRegister(expr1, self.Triton.registers.rax)
 
+    def test_memory_across_pages(self):
+        """Check symbolic memory cells spanning two pages."""
+        self.Triton.symbolizeMemory(MemoryAccess(0xfff, CPUSIZE.BYTE))
+        self.Triton.symbolizeMemory(MemoryAccess(0x1000, CPUSIZE.BYTE))
+        self.assertTrue(self.Triton.isMemorySymbolized(MemoryAccess(0xffc, CPUSIZE.DWORD)))
+        self.assertTrue(self.Triton.isMemorySymbolized(MemoryAccess(0x1000, CPUSIZE.DWORD)))
+        self.assertFalse(self.Triton.isMemorySymbolized(MemoryAccess(0x1001, CPUSIZE.QWORD)))
+        self.assertEqual(len(self.Triton.getSymbolicMemory()), 2)
+
+        ast = self.Triton.getMemoryAst(MemoryAccess(0xffe, CPUSIZE.DWORD))
+        self.assertEqual(len(ast.getChildren()), 4)
+        self.assertTrue(ast.isSymbolized())
+
+        self.Triton.concretizeAllMemory()
+        self.assertFalse(self.Triton.isMemorySymbolized(MemoryAccess(0xffc, CPUSIZE.QWORD)))
+        self.assertEqual(len(self.Triton.getSymbolicMemory()), 0)
+
+    def test_concretize_all_reuse(self):
+        """Check the symbolic state written again after its concretization."""
+        for iteration in range(3):
+            # More pages than the stale ones kept, the first one being written again
+            for page in range(100):
+                self.Triton.symbolizeMemory(MemoryAccess(0x10000 + page * 0x1000 + iteration, CPUSIZE.BYTE))
+            self.Triton.symbolizeRegister(self.Triton.registers.rax)
+            self.assertEqual(len(self.Triton.getSymbolicMemory()), 100)
+            self.assertEqual(len(self.Triton.getSymbolicRegisters()), 1)
+
+            fork = self.Triton.fork()
+            self.Triton.concretizeAllMemory()
+            self.Triton.concretizeAllRegister()
+            self.assertEqual(len(self.Triton.getSymbolicMemory()), 0)
+            self.assertEqual(len(self.Triton.getSymbolicRegisters()), 0)
+            self.assertFalse(self.Triton.isMemorySymbolized(MemoryAccess(0x10000 + iteration, CPUSIZE.BYTE)))
+            self.assertFalse(self.Triton.isRegisterSymbolized(self.Triton.registers.rax))
+
+            # The copies keep their state
+            self.assertEqual(len(fork.getSymbolicMemory()), 100)
+            self.assertTrue(fork.isRegisterSymbolized(fork.registers.rax))
+
+        self.Triton.symbolizeMemory(MemoryAccess(0x10000, CPUSIZE.BYTE))
+        self.assertEqual(list(self.Triton.getSymbolicMemory().keys()), [0x10000])
+
+    def test_symbolize_memory_area(self):
+        """Check the symbolization and concretization of memory areas."""
+        self.Triton.setConcreteMemoryAreaValue(0xff0, bytes(range(0x20)))
+        symvars = self.Triton.symbolizeMemoryArea(0xff0, 0x20, 4, "input")
+        self.assertEqual(len(symvars), 8)
+        self.assertEqual(symvars[1].getAlias(), "input_1")
+        self.assertEqual(symvars[1].getOrigin(), 0xff4)
+        self.assertEqual(symvars[1].getBitSize(), 32)
+        self.assertTrue(self.Triton.isMemorySymbolized(MemoryAccess(0xff0, 0x20)))
+        self.assertEqual(len(self.Triton.getSymbolicMemory()), 0x20)
+
+        ast = self.Triton.getMemoryAst(MemoryAccess(0xffe, CPUSIZE.DWORD))
+        self.assertEqual(ast.evaluate(), 0x11100f0e)
+
+        # Bytes are their own variable
+        symvars = self.Triton.symbolizeMemoryArea(0x2000, 0x10)
+        self.assertEqual(len(symvars), 0x10)
+        self.assertEqual(self.Triton.getSymbolicMemory(0x2003).getAst().getSymbolicVariable().getId(), symvars[3].getId())
+
+        self.Triton.concretizeMemoryArea(0xff8, 0x1010)
+        self.assertTrue(self.Triton.isMemorySymbolized(MemoryAccess(0xff0, CPUSIZE.QWORD)))
+        self.assertFalse(self.Triton.isMemorySymbolized(MemoryAccess(0xff8, CPUSIZE.QWORD)))
+        self.assertTrue(self.Triton.isMemorySymbolized(MemoryAccess(0x2008, CPUSIZE.BYTE)))
+        self.assertEqual(len(self.Triton.getSymbolicMemory()), 8 + 8)
+
+        with self.assertRaises(TypeError):
+            self.Triton.symbolizeMemoryArea(0x3000, 0x10, 3)
+
+    def test_symbolic_budget(self):
+        """Check the limits of the symbolic budget."""
+        # Expressions deeper than the budget are concretized
+        self.Triton.setSymbolicBudget(maxDepth=16)
+        self.Triton.setConcreteRegisterValue(self.Triton.registers.rax, 1)
+        self.Triton.symbolizeRegister(self.Triton.registers.rax)
+        for _ in range(16):
+            self.Triton.processing(Instruction(b"\x48\x01\xc0"))  # add rax, rax
+        self.assertFalse(self.Triton.isRegisterSymbolized(self.Triton.registers.rax))
+        self.assertEqual(self.Triton.getConcreteRegisterValue(self.Triton.registers.rax), 1 << 16)
+
+        # The oldest memory cells are concretized first
+        self.Triton.symbolizeMemoryArea(0x1000, 64)
+        self.Triton.setSymbolicBudget(maxExpressions=16, policy=SYMBOLIC.CONCRETIZE_OLDEST_MEMORY)
+        self.assertTrue(self.Triton.isSymbolicBudgetExceeded())
+        self.Triton.processing(Instruction(b"\x48\x8b\x1c\x25\x38\x10\x00\x00"))  # mov rbx, [0x1038]
+        self.assertFalse(self.Triton.isMemorySymbolized(MemoryAccess(0x1000, 32)))
+        self.assertTrue(self.Triton.isMemorySymbolized(MemoryAccess(0x1020, 32)))
+        self.assertTrue(self.Triton.isRegisterSymbolized(self.Triton.registers.rbx))
+
+        # No new symbolic variable beyond the budget
+        self.Triton.setSymbolicBudget(maxExpressions=16, policy=SYMBOLIC.REFUSE_NEW_SYMBOLS)
+        with self.assertRaises(TypeError):
+            self.Triton.symbolizeRegister(self.Triton.registers.rcx)
+
+        self.Triton.setSymbolicBudget()
+        self.assertFalse(self.Triton.isSymbolicBudgetExceeded())
+        self.Triton.symbolizeRegister(self.Triton.registers.rcx)
+
+    def test_slice_expressions(self):
+        """Check backward slices of one or several expressions."""
+        self.Triton.symbolizeRegister(self.Triton.registers.rbx)
+        self.Triton.symbolizeRegister(self.Triton.registers.rdx)
+        self.Triton.processing(Instruction(b"\x48\x89\xd8"))  # mov rax, rbx
+        self.Triton.processing(Instruction(b"\x48\x01\xd8"))  # add rax, rbx
+        self.Triton.processing(Instruction(b"\x48\x89\xd1"))  # mov rcx, rdx
+
+        rax = self.Triton.getSymbolicRegister(self.Triton.registers.rax)
+        rcx = self.Triton.getSymbolicRegister(self.Triton.registers.rcx)
+
+        s1 = self.Triton.sliceExpressions(rax)
+        s2 = self.Triton.sliceExpressions(rcx)
+        self.assertEqual(len(s1), 3)
+        self.assertEqual(len(s2), 2)
+
+        union = self.Triton.sliceExpressionsMany([rax, rcx])
+        self.assertEqual(sorted(union.keys()), sorted(set(s1.keys()) | set(s2.keys())))
+        self.assertEqual(self.Triton.sliceExpressionsMany([]), {})
+
+    def test_views(self):
+        """Check the lazy views over the engine collections."""
+        self.Triton.symbolizeRegister(self.Triton.registers.rbx)
+        self.Triton.taintMemory(MemoryAccess(0x1000, CPUSIZE.WORD))
+        self.Triton.processing(Instruction(b"\x48\x89\xd8"))  # mov rax, rbx
+
+        exprs = self.Triton.getSymbolicExpressions()
+        self.assertEqual(list(exprs.keys()), sorted(exprs.keys()))
+        self.assertEqual(dict(exprs.items()), exprs)
+        self.assertEqual(exprs[0].getId(), 0)
+        self.assertTrue(0 in exprs)
+        self.assertFalse(-1 in exprs)
+        self.assertIsNone(exprs.get(len(exprs)))
+        with self.assertRaises(KeyError):
+            exprs[len(exprs)]
+
+        varz = self.Triton.getSymbolicVariables()
+        self.assertEqual(len(varz), 1)
+        self.assertEqual(varz[0].getBitSize(), 64)
+
+        tainted = self.Triton.getTaintedMemory()
+        self.assertEqual(tainted, [0x1000, 0x1001])
+        self.assertEqual(tainted[-1], 0x1001)
+        self.assertEqual(tainted[1:], [0x1001])
+        with self.assertRaises(IndexError):
+            tainted[2]
+
+    def test_fork(self):
+        """Check a forked context diverges from its parent."""
+        self.Triton.setConcreteMemoryValue(0x100, 0x11)
+        self.Triton.symbolizeMemory(MemoryAccess(0x100, CPUSIZE.BYTE))
+        self.Triton.taintRegister(self.Triton.registers.rbx)
+
+        child = self.Triton.fork()
+        self.assertEqual(child.getConcreteMemoryValue(0x100), 0x11)
+        self.assertTrue(child.isMemorySymbolized(0x100))
+        self.assertTrue(child.isRegisterTainted(child.registers.rbx))
+
+        child.setConcreteMemoryValue(0x100, 0x22)
+        child.concretizeMemory(0x100)
+        child.untaintRegister(child.registers.rbx)
+        self.assertEqual(self.Triton.getConcreteMemoryValue(0x100), 0x11)
+        self.assertTrue(self.Triton.isMemorySymbolized(0x100))
+        self.assertTrue(self.Triton.isRegisterTainted(self.Triton.registers.rbx))
+        self.assertEqual(child.getConcreteMemoryValue(0x100), 0x22)
+        self.assertFalse(child.isMemorySymbolized(0x100))
+        self.assertFalse(child.isRegisterTainted(child.registers.rbx))
+
+    def test_rollback_to_mark(self):
+        """Check a rollback restores the marked state at each iteration."""
+        with self.assertRaises(Exception):
+            self.Triton.rollbackToMark()
+
+        self.Triton.setConcreteMemoryAreaValue(0x1000, b"\x11" * 0x2000)
+        self.Triton.setConcreteRegisterValue(self.Triton.registers.rcx, 0x1234)
+        self.Triton.symbolizeRegister(self.Triton.registers.rax, "input")
+        self.Triton.setMark()
+
+        for iteration in range(3):
+            self.Triton.taintRegister(self.Triton.registers.rax)
+            self.Triton.processing(Instruction(0x400000, b"\x48\x01\xc1"))  # add rcx, rax
+            self.Triton.processing(Instruction(0x400003, b"\x48\x89\x0c\x25\x00\x10\x00\x00"))  # mov [0x1000], rcx
+            self.Triton.pushPathConstraint(self.astCtxt.equal(self.Triton.getSymbolicRegister(self.Triton.registers.rcx).getAst(), self.astCtxt.bv(0x2000, 64)))
+            self.Triton.setConcreteMemoryValue(0x5000, 0x22)
+            self.assertTrue(self.Triton.isMemorySymbolized(MemoryAccess(0x1000, CPUSIZE.QWORD)))
+            self.assertEqual(len(self.Triton.getPathConstraints()), 1)
+
+            self.Triton.rollbackToMark()
+            self.assertEqual(self.Triton.getConcreteMemoryAreaValue(0x1000, 0x2000), b"\x11" * 0x2000)
+            self.assertFalse(self.Triton.isConcreteMemoryValueDefined(0x5000, 1))
+            self.assertEqual(self.Triton.getConcreteRegisterValue(self.Triton.registers.rcx), 0x1234)
+            self.assertFalse(self.Triton.isRegisterSymbolized(self.Triton.registers.rcx))
+            self.assertFalse(self.Triton.isMemorySymbolized(MemoryAccess(0x1000, CPUSIZE.QWORD)))
+            self.assertFalse(self.Triton.isRegisterTainted(self.Triton.registers.rax))
+            self.assertTrue(self.Triton.isRegisterSymbolized(self.Triton.registers.rax))
+            self.assertEqual(len(self.Triton.getPathConstraints()), 0)
+
+        self.Triton.removeMark()
+        with self.assertRaises(Exception):
+            self.Triton.rollbackToMark()
+
+    def test_snapshot(self):
+        """Check a snapshot restores the state of a context."""
+        self.Triton.setMode(MODE.ALIGNED_MEMORY, True)
+        self.Triton.setConcreteMemoryAreaValue(0x1000, b"\x11" * 0x2000)
+        self.Triton.setConcreteMemoryValue(0x5003, 0x22)
+        self.Triton.setConcreteRegisterValue(self.Triton.registers.rcx, 0x1234)
+        self.Triton.symbolizeRegister(self.Triton.registers.rax, "input")
+        self.Triton.taintRegister(self.Triton.registers.rax)
+        self.Triton.processing(Instruction(0x400000, b"\x48\x01\xc1"))  # add rcx, rax
+        self.Triton.processing(Instruction(0x400003, b"\x48\x89\x0c\x25\x00\x10\x00\x00"))  # mov [0x1000], rcx
+        self.Triton.pushPathConstraint(self.astCtxt.equal(self.Triton.getSymbolicRegister(self.Triton.registers.rcx).getAst(), self.astCtxt.bv(0x2000, 64)))
+
+        with tempfile.NamedTemporaryFile(delete=False) as f:
+            pass
+        try:
+            self.Triton.saveSnapshot(f.name)
+
+            ctx = TritonContext()
+            ctx.loadSnapshot(f.name)
+            self.assertEqual(ctx.getArchitecture(), ARCH.X86_64)
+            self.assertTrue(ctx.isModeEnabled(MODE.ALIGNED_MEMORY))
+            self.assertEqual(ctx.getConcreteMemoryAreaValue(0x1008, 0x1ff8), b"\x11" * 0x1ff8)
+            self.assertEqual(ctx.getConcreteMemoryValue(MemoryAccess(0x1000, CPUSIZE.QWORD)), 0x1234)
+            self.assertEqual(ctx.getConcreteMemoryValue(0x5003), 0x22)
+            self.assertFalse(ctx.isConcreteMemoryValueDefined(0x5002, 1))
+            self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.rcx), 0x1234)
+
+            self.assertTrue(ctx.isRegisterSymbolized(ctx.registers.rcx))
+            self.assertTrue(ctx.isMemorySymbolized(MemoryAccess(0x1000, CPUSIZE.QWORD)))
+            self.assertTrue(ctx.isRegisterTainted(ctx.registers.rcx))
+            self.assertTrue(ctx.isMemoryTainted(0x1000))
+            self.assertEqual(ctx.getSymbolicVariable("input").getBitSize(), 64)
+            self.assertEqual(len(ctx.getPathConstraints()), 1)
+            self.assertEqual(str(ctx.getSymbolicRegister(ctx.registers.rcx).getAst()), str(self.Triton.getSymbolicRegister(self.Triton.registers.rcx).getAst()))
+
+            # The path constraint is solved over the restored variables
+            model = ctx.getModel(ctx.getPathPredicate())
+            self.assertEqual(model[0].getValue(), 0x2000 - 0x1234)
+
+            # The restored context goes on from its state, the file is not written
+            ctx.setConcreteMemoryValue(0x1008, 0x33)
+            self.assertEqual(ctx.getConcreteMemoryValue(0x1008), 0x33)
+            self.assertEqual(ctx.newSymbolicVariable(8).getId(), 1)
+        finally:
+            os.remove(f.name)
+
+    def test_memory_usage(self):
+        """Check the memory used by the subsystems."""
+        usage = self.Triton.getMemoryUsage()
+        self.assertEqual(usage["symbolicMemory"]["count"], 0)
+        self.assertEqual(usage["taintedMemory"]["count"], 0)
+
+        self.Triton.setMode(MODE.ALIGNED_MEMORY, True)
+        self.Triton.setConcreteMemoryAreaValue(0x1000, b"\x11" * 0x10)
+        self.Triton.symbolizeRegister(self.Triton.registers.rax)
+        self.Triton.taintRegister(self.Triton.registers.rax)
+        self.Triton.processing(Instruction(0x400000, b"\x48\x89\x04\x25\x00\x10\x00\x00"))  # mov [0x1000], rax
+
+        usage = self.Triton.getMemoryUsage()
+        self.assertEqual(usage["symbolicMemory"]["count"], 8)
+        self.assertEqual(usage["alignedMemory"]["count"], 1)
+        self.assertEqual(usage["taintedMemory"]["count"], 8)
+        self.assertEqual(usage["taintedRegisters"]["count"], 1)
+        self.assertEqual(usage["concreteMemory"]["count"], 0x10)
+        self.assertGreater(usage["concreteMemory"]["bytes"], 0)
+        self.assertGreater(usage["astNodes"]["kinds"][AST_NODE.VARIABLE], 0)
+        self.assertEqual(usage["astNodes"]["count"], sum(usage["astNodes"]["kinds"].values()))
+
+        self.Triton.concretizeAllMemory()
+        self.assertEqual(self.Triton.getMemoryUsage()["symbolicMemory"]["count"], 0)
+
 
 class TestSymbolicBuilding(unittest.TestCase):
 
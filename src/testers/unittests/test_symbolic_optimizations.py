@@ -38,3 +38,856 @@ class TestSymbolicOptimizations(unittest.TestCase):
         self.assertEqual(rcx.getType(), AST_NODE.REFERENCE)
         self.assertEqual(rcx.evaluate(), 1)
         return
+
+
+    def test_unaligned_load_in_aligned_store(self):
+        self.ctx.setMode(MODE.ALIGNED_MEMORY, True)
+
+        self.ctx.processing(Instruction(b"\x48\xb8\x88\x77\x66\x55\x44\x33\x22\x11")) # mov rax, 0x1122334455667788
+        self.ctx.processing(Instruction(b"\x48\x89\x03"))                                # mov [rbx], rax
+
+        node = self.ctx.getMemoryAst(MemoryAccess(2, CPUSIZE.DWORD))
+        self.assertEqual(node.getType(), AST_NODE.EXTRACT)
+        self.assertEqual(node.evaluate(), 0x33445566)
+
+        self.ctx.processing(Instruction(b"\xc6\x43\x04\x00"))                            # mov byte ptr [rbx+4], 0
+        node = self.ctx.getMemoryAst(MemoryAccess(2, CPUSIZE.DWORD))
+        self.assertEqual(node.getType(), AST_NODE.CONCAT)
+        self.assertEqual(node.evaluate(), 0x33005566)
+        return
+
+
+    def test_load_over_several_aligned_stores(self):
+        self.ctx.setMode(MODE.ALIGNED_MEMORY, True)
+
+        self.ctx.processing(Instruction(b"\x48\xb8\x88\x77\x66\x55\x44\x33\x22\x11")) # mov rax, 0x1122334455667788
+        self.ctx.processing(Instruction(b"\x48\x89\x03"))                                # mov [rbx], rax
+        self.ctx.processing(Instruction(b"\xc6\x43\x04\x00"))                            # mov byte ptr [rbx+4], 0
+
+        # The bytes around the overwritten one are each extracted from the qword store
+        node = self.ctx.getMemoryAst(MemoryAccess(0, CPUSIZE.QWORD))
+        self.assertEqual(node.getType(), AST_NODE.CONCAT)
+        self.assertEqual(len(node.getChildren()), 3)
+        self.assertEqual(node.evaluate(), 0x1122330055667788)
+
+        # A load over two stores concatenates them, the concrete bytes after them are one constant
+        self.ctx.processing(Instruction(b"\xc7\x43\x08\x99\xaa\xbb\xcc"))            # mov dword ptr [rbx+8], 0xccbbaa99
+        self.ctx.setConcreteMemoryAreaValue(12, b"\x01\x02\x03\x04")
+        node = self.ctx.getMemoryAst(MemoryAccess(4, CPUSIZE.DQWORD))
+        self.assertEqual(node.getType(), AST_NODE.CONCAT)
+        self.assertEqual(len(node.getChildren()), 4)
+        self.assertEqual(node.evaluate(), 0x0000000004030201ccbbaa9911223300)
+        return
+
+
+class TestPruneDeadExpressions(unittest.TestCase):
+
+    """Testing PRUNE_DEAD_EXPRESSIONS."""
+
+    def process(self, prune):
+        ctx = TritonContext(ARCH.X86_64)
+        ctx.setMode(MODE.PRUNE_DEAD_EXPRESSIONS, prune)
+        ctx.setConcreteRegisterValue(ctx.registers.rax, 0xffffffffffffffff)
+        ctx.symbolizeRegister(ctx.registers.rax)
+        first = Instruction(b"\x48\x83\xc0\x01")  # add rax, 1
+        second = Instruction(b"\x48\x83\xc0\x02") # add rax, 2
+        ctx.processing(first)
+        ctx.processing(second)
+        return ctx, first
+
+    def flagExpressions(self, ctx, inst):
+        return [e for e in inst.getSymbolicExpressions() if e.isRegister() and ctx.isFlag(e.getOrigin())]
+
+    def test_without_pruning(self):
+        ctx, first = self.process(False)
+        for e in self.flagExpressions(ctx, first):
+            self.assertTrue(e.isSymbolized())
+        return
+
+    def test_with_pruning(self):
+        ctx, first = self.process(True)
+        ref, kept = self.process(False)
+        flags = self.flagExpressions(ctx, first)
+        self.assertNotEqual(len(flags), 0)
+        for e, r in zip(flags, self.flagExpressions(ref, kept)):
+            # Overwritten by the second instruction without being read
+            self.assertFalse(e.isSymbolized())
+            self.assertEqual(e.getAst().getType(), AST_NODE.BV)
+            self.assertEqual(e.getAst().evaluate(), r.getAst().evaluate())
+        # rax is read by the second instruction, its definition is kept
+        rax = [e for e in first.getSymbolicExpressions() if e.isRegister() and e.getOrigin().getId() == REG.X86_64.RAX]
+        self.assertTrue(rax[0].isSymbolized())
+        self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.rax), 2)
+        self.assertTrue(ctx.getSymbolicRegister(ctx.registers.rax).isSymbolized())
+        return
+
+
+class TestAstHashConsing(unittest.TestCase):
+
+    """Testing AST_HASH_CONSING."""
+
+    def setUp(self):
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ast = self.ctx.getAstContext()
+        self.v1  = self.ast.variable(self.ctx.newSymbolicVariable(8))
+        self.v2  = self.ast.variable(self.ctx.newSymbolicVariable(8))
+
+
+    def test_without_consing(self):
+        self.ctx.setMode(MODE.AST_HASH_CONSING, False)
+        n1 = self.ast.bvadd(self.v1, self.v2)
+        n2 = self.ast.bvadd(self.v1, self.v2)
+        self.assertEqual(len(self.v1.getParents()), 2)
+        self.assertTrue(n1.equalTo(n2))
+        return
+
+
+    def test_with_consing(self):
+        self.ctx.setMode(MODE.AST_HASH_CONSING, True)
+        n1 = self.ast.bvadd(self.v1, self.v2)
+        n2 = self.ast.bvadd(self.v1, self.v2)
+        n3 = self.ast.bvadd(self.v2, self.v1)
+        self.assertEqual(len(self.v1.getParents()), 2)
+        self.assertTrue(n1.equalTo(n2))
+
+        e1 = self.ast.extract(3, 0, n1)
+        e2 = self.ast.extract(3, 0, n2)
+        self.assertEqual(len(n1.getParents()), 1)
+        self.assertEqual(e1.evaluate(), e2.evaluate())
+        return
+
+
+    def test_duplicate_is_not_shared(self):
+        self.ctx.setMode(MODE.AST_HASH_CONSING, True)
+        n1 = self.ast.bvadd(self.v1, self.v2)
+        n2 = self.ast.duplicate(n1)
+        n2.setChild(0, self.ast.bv(1, 8))
+        self.assertEqual(n1.getChildren()[0].getHash(), self.v1.getHash())
+        return
+
+
+class TestAstLazyHash(unittest.TestCase):
+
+    """Testing AST_LAZY_HASH."""
+
+    def build(self, lazy):
+        ctx = TritonContext(ARCH.X86_64)
+        ctx.setMode(MODE.AST_LAZY_HASH, lazy)
+        ast = ctx.getAstContext()
+        v1 = ast.variable(ctx.newSymbolicVariable(32))
+        v2 = ast.variable(ctx.newSymbolicVariable(32))
+        ref = ast.reference(ctx.newSymbolicExpression(v1 * v2))
+        node = ast.extract(15, 0, ast.bvxor(ref + v1, ast.bvlshr(v2, ast.bv(3, 32))))
+        return ctx, node
+
+    def test_same_hash(self):
+        ctx1, n1 = self.build(False)
+        ctx2, n2 = self.build(True)
+        self.assertEqual(n1.getHash(), n2.getHash())
+        self.assertEqual(n1.evaluate(), n2.evaluate())
+        return
+
+    def test_update_after_hash(self):
+        ctx, n = self.build(True)
+        h = n.getHash()
+        n.setChild(2, ctx.getAstContext().bv(1, 32))
+        self.assertNotEqual(h, n.getHash())
+        return
+
+
+class TestAstNary(unittest.TestCase):
+
+    """Testing AST_NARY."""
+
+    def setUp(self):
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ctx.setMode(MODE.AST_NARY, True)
+        self.ast = self.ctx.getAstContext()
+        self.v1  = self.ast.variable(self.ctx.newSymbolicVariable(8))
+        self.v2  = self.ast.variable(self.ctx.newSymbolicVariable(8))
+        self.v3  = self.ast.variable(self.ctx.newSymbolicVariable(8))
+        self.ctx.setConcreteVariableValue(self.v1.getSymbolicVariable(), 0x11)
+        self.ctx.setConcreteVariableValue(self.v2.getSymbolicVariable(), 0x22)
+        self.ctx.setConcreteVariableValue(self.v3.getSymbolicVariable(), 0xf3)
+
+
+    def test_flatten(self):
+        n = self.ast.bvadd(self.ast.bvadd(self.ast.bvadd(self.v1, self.ast.bv(1, 8)), self.v2), self.ast.bvadd(self.v3, self.ast.bv(2, 8)))
+        self.assertEqual(n.getType(), AST_NODE.BVADD)
+        self.assertEqual(len(n.getChildren()), 4)
+        self.assertEqual(n.getChildren()[3].evaluate(), 3)
+        self.assertEqual(n.evaluate(), (0x11 + 0x22 + 0xf3 + 3) & 0xff)
+        return
+
+
+    def test_canonical_order(self):
+        n1 = self.ast.bvxor(self.ast.bvxor(self.v1, self.v2), self.v3)
+        n2 = self.ast.bvxor(self.v3, self.ast.bvxor(self.v2, self.v1))
+        self.assertEqual(str(n1), str(n2))
+        return
+
+
+    def test_merge_operands(self):
+        self.assertEqual(str(self.ast.bvxor(self.ast.bvxor(self.v1, self.v2), self.v1)), str(self.v2))
+        self.assertEqual(str(self.ast.bvor(self.ast.bvor(self.v1, self.v2), self.v1)), str(self.ast.bvor(self.v2, self.v1)))
+        self.assertEqual(self.ast.bvand(self.ast.bvand(self.v1, self.ast.bv(0xf0, 8)), self.ast.bv(0x0f, 8)).evaluate(), 0)
+        return
+
+
+    def test_shared_node_is_kept(self):
+        inner = self.ast.bvadd(self.v1, self.v2)
+        e = self.ast.extract(3, 0, inner)
+        n = self.ast.bvadd(inner, self.v3)
+        self.assertEqual(len(n.getChildren()), 2)
+        return
+
+
+    def test_solver(self):
+        n = self.ast.bvadd(self.ast.bvadd(self.v1, self.v2), self.v3)
+        model = self.ctx.getModel(n == 0x42)
+        self.assertEqual(len(model), 3)
+        self.assertEqual(sum(m.getValue() for m in model.values()) & 0xff, 0x42)
+        return
+
+
+class TestSemanticsCache(unittest.TestCase):
+
+    """Testing SEMANTICS_CACHE."""
+
+    code = [
+        (0x1000, b"\x48\x01\xd8"),                 # add  rax, rbx
+        (0x1003, b"\x48\x31\xc1"),                 # xor  rcx, rax
+        (0x1006, b"\x48\x89\x4c\x24\x08"),         # mov  [rsp + 8], rcx
+        (0x100b, b"\x48\x8d\x14\x48"),             # lea  rdx, [rax + rcx * 2]
+        (0x100f, b"\x48\x03\x54\x24\x08"),         # add  rdx, [rsp + 8]
+        (0x1014, b"\x48\x39\xda"),                 # cmp  rdx, rbx
+    ]
+
+    def process(self, cache):
+        ctx = TritonContext(ARCH.X86_64)
+        ctx.setMode(MODE.SEMANTICS_CACHE, cache)
+        ctx.enableTaintEngine(False)
+        ctx.setConcreteRegisterValue(ctx.registers.rax, 0x1122334455667788)
+        ctx.setConcreteRegisterValue(ctx.registers.rbx, 0x10)
+        ctx.setConcreteRegisterValue(ctx.registers.rsp, 0x7fff0000)
+        ctx.symbolizeRegister(ctx.registers.rbx)
+        trace = list()
+        for _ in range(3):
+            for addr, opcode in self.code:
+                inst = Instruction(addr, opcode)
+                self.assertTrue(ctx.processing(inst))
+                trace.append((inst, [(e.getId(), str(e.getAst()), e.getAst().evaluate()) for e in inst.getSymbolicExpressions()]))
+            # The stack moves between iterations
+            ctx.setConcreteRegisterValue(ctx.registers.rsp, ctx.getConcreteRegisterValue(ctx.registers.rsp) - 0x20)
+        return ctx, trace
+
+    def test_same_expressions(self):
+        ref, expected = self.process(False)
+        ctx, trace = self.process(True)
+        for (i1, e1), (i2, e2) in zip(expected, trace):
+            self.assertEqual(e1, e2)
+            self.assertEqual(sorted(str(r) for r, _ in i1.getReadRegisters()), sorted(str(r) for r, _ in i2.getReadRegisters()))
+            self.assertEqual(sorted(str(r) for r, _ in i1.getWrittenRegisters()), sorted(str(r) for r, _ in i2.getWrittenRegisters()))
+            self.assertEqual([str(m) for m, _ in i1.getLoadAccess()], [str(m) for m, _ in i2.getLoadAccess()])
+            self.assertEqual([str(m) for m, _ in i1.getStoreAccess()], [str(m) for m, _ in i2.getStoreAccess()])
+        for reg in [ctx.registers.rax, ctx.registers.rcx, ctx.registers.rdx, ctx.registers.zf, ctx.registers.cf]:
+            self.assertEqual(ctx.getConcreteRegisterValue(reg), ref.getConcreteRegisterValue(reg))
+        return
+
+    def test_modified_code(self):
+        ctx, trace = self.process(True)
+        # Other bytes at a recorded address build their own semantics
+        rax = ctx.getConcreteRegisterValue(ctx.registers.rax)
+        ctx.processing(Instruction(0x1000, b"\x48\x29\xd8")) # sub rax, rbx
+        self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.rax), (rax - 0x10) & 0xffffffffffffffff)
+        return
+
+
+class TestLazyFlags(unittest.TestCase):
+
+    """Testing LAZY_FLAGS."""
+
+    code = [
+        (0x1000, b"\x48\x01\xd8"),                 # add  rax, rbx
+        (0x1003, b"\x48\x29\xc1"),                 # sub  rcx, rax
+        (0x1006, b"\x48\x11\xca"),                 # adc  rdx, rcx
+        (0x1009, b"\x48\x39\xda"),                 # cmp  rdx, rbx
+    ]
+
+    def process(self, lazy):
+        ctx = TritonContext(ARCH.X86_64)
+        ctx.setMode(MODE.LAZY_FLAGS, lazy)
+        ctx.setConcreteRegisterValue(ctx.registers.rax, 0xffffffffffffff00)
+        ctx.setConcreteRegisterValue(ctx.registers.rbx, 0x100)
+        ctx.setConcreteRegisterValue(ctx.registers.rcx, 0x10)
+        ctx.symbolizeRegister(ctx.registers.rbx)
+        insts = list()
+        for addr, opcode in self.code:
+            inst = Instruction(addr, opcode)
+            self.assertTrue(ctx.processing(inst))
+            insts.append(inst)
+        return ctx, insts
+
+    def test_same_state(self):
+        ref, _ = self.process(False)
+        ctx, _ = self.process(True)
+        for reg in [ctx.registers.rax, ctx.registers.rcx, ctx.registers.rdx,
+                    ctx.registers.af, ctx.registers.cf, ctx.registers.of,
+                    ctx.registers.pf, ctx.registers.sf, ctx.registers.zf,
+                    ctx.registers.eflags]:
+            self.assertEqual(ctx.getConcreteRegisterValue(reg), ref.getConcreteRegisterValue(reg))
+        zf = ctx.getRegisterAst(ctx.registers.zf)
+        self.assertEqual(zf.evaluate(), ref.getRegisterAst(ref.registers.zf).evaluate())
+        self.assertTrue(ctx.isRegisterSymbolized(ctx.registers.zf))
+        self.assertTrue(ctx.isSat(zf == 1))
+        return
+
+    def test_deferred_flags(self):
+        ref, expected = self.process(False)
+        ctx, insts = self.process(True)
+        # The flags are not built with the instructions
+        for i1, i2 in zip(expected, insts):
+            self.assertLess(len(i2.getSymbolicExpressions()), len(i1.getSymbolicExpressions()))
+        # The carry read by adc is built from sub
+        self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.rdx), ref.getConcreteRegisterValue(ref.registers.rdx))
+        # A flag read through the API is built
+        self.assertIsNotNone(ctx.getSymbolicRegister(ctx.registers.sf))
+        # A flag set by the user drops its expression
+        ctx.setConcreteRegisterValue(ctx.registers.of, 1)
+        self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.of), 1)
+        self.assertIsNone(ctx.getSymbolicRegister(ctx.registers.of))
+        return
+
+
+class TestDeadFlagsElimination(unittest.TestCase):
+
+    """Testing DEAD_FLAGS_ELIMINATION."""
+
+    code = [
+        (0x1000, b"\x00\x00\x01\xab"),             # adds x0, x0, x1
+        (0x1004, b"\x42\x00\x00\xeb"),             # subs x2, x2, x0
+        (0x1008, b"\x03\x00\x82\x9a"),             # csel x3, x0, x2, eq
+    ]
+
+    def process(self, dead):
+        ctx = TritonContext(ARCH.AARCH64)
+        ctx.setMode(MODE.DEAD_FLAGS_ELIMINATION, dead)
+        ctx.setConcreteRegisterValue(ctx.registers.x0, 0xffffffffffffff00)
+        ctx.setConcreteRegisterValue(ctx.registers.x1, 0x100)
+        ctx.setConcreteRegisterValue(ctx.registers.x2, 0x10)
+        ctx.symbolizeRegister(ctx.registers.x1)
+        insts = [Instruction(addr, opcode) for addr, opcode in self.code]
+        self.assertTrue(ctx.processing(insts))
+        return ctx, insts
+
+    def test_same_state(self):
+        ref, _ = self.process(False)
+        ctx, _ = self.process(True)
+        for reg in [ctx.registers.x0, ctx.registers.x2, ctx.registers.x3,
+                    ctx.registers.n, ctx.registers.z, ctx.registers.c, ctx.registers.v]:
+            self.assertEqual(ctx.getConcreteRegisterValue(reg), ref.getConcreteRegisterValue(reg))
+            self.assertEqual(ctx.getRegisterAst(reg).evaluate(), ref.getRegisterAst(reg).evaluate())
+        self.assertTrue(ctx.isSat(ctx.getRegisterAst(ctx.registers.z) == 1))
+        return
+
+    def test_dead_flags(self):
+        ref, expected = self.process(False)
+        ctx, insts = self.process(True)
+        # The flags of adds are written again by subs before being read
+        self.assertLess(len(insts[0].getSymbolicExpressions()), len(expected[0].getSymbolicExpressions()))
+        self.assertEqual(len(ctx.getSymbolicExpressions()), len(ref.getSymbolicExpressions()) - 4)
+        # The flags of subs are live at the exit of the block
+        for reg in [ctx.registers.n, ctx.registers.z, ctx.registers.c, ctx.registers.v]:
+            self.assertIsNotNone(ctx.getSymbolicRegister(reg))
+        return
+
+    def test_single_instruction(self):
+        counts = list()
+        for dead in [False, True]:
+            ctx = TritonContext(ARCH.AARCH64)
+            ctx.setMode(MODE.DEAD_FLAGS_ELIMINATION, dead)
+            ctx.symbolizeRegister(ctx.registers.x1)
+            inst = Instruction(0x1000, b"\x00\x00\x01\xab")
+            self.assertTrue(ctx.processing(inst))
+            counts.append(len(inst.getSymbolicExpressions()))
+        # Out of a block, the flags are recorded with their instruction
+        self.assertEqual(counts[0], counts[1])
+        return
+
+
+class TestBulkStringOperations(unittest.TestCase):
+
+    """Testing BULK_STRING_OPERATIONS."""
+
+    def run_string(self, bulk, opcode, setup):
+        ctx = TritonContext(ARCH.X86_64)
+        ctx.setMode(MODE.BULK_STRING_OPERATIONS, bulk)
+        ctx.setConcreteRegisterValue(ctx.registers.rip, 0x1000)
+        setup(ctx)
+        iterations = 0
+        while ctx.getConcreteRegisterValue(ctx.registers.rip) == 0x1000:
+            self.assertTrue(ctx.processing(Instruction(0x1000, opcode)))
+            iterations += 1
+        return ctx, iterations
+
+    def setup_copy(self, ctx):
+        ctx.setConcreteMemoryAreaValue(0x2000, bytes(range(0x100)))
+        ctx.symbolizeMemory(MemoryAccess(0x2005, CPUSIZE.BYTE))
+        ctx.setConcreteRegisterValue(ctx.registers.rsi, 0x2000)
+        ctx.setConcreteRegisterValue(ctx.registers.rdi, 0x3000)
+        ctx.setConcreteRegisterValue(ctx.registers.rcx, 0x40)
+
+    def setup_fill(self, ctx):
+        ctx.setConcreteRegisterValue(ctx.registers.rax, 0x1122334455667788)
+        ctx.symbolizeRegister(ctx.registers.rax)
+        ctx.setConcreteRegisterValue(ctx.registers.rdi, 0x3000)
+        ctx.setConcreteRegisterValue(ctx.registers.rcx, 0x10)
+        ctx.setConcreteRegisterValue(ctx.registers.df, 1)
+
+    def setup_scan(self, ctx):
+        ctx.setConcreteMemoryAreaValue(0x2000, b"hello world\x00")
+        ctx.setConcreteRegisterValue(ctx.registers.rdi, 0x2000)
+        ctx.setConcreteRegisterValue(ctx.registers.rcx, 0xffffffffffffffff)
+
+    def assertSameState(self, ref, ctx, base, size):
+        for reg in [ctx.registers.rcx, ctx.registers.rsi, ctx.registers.rdi, ctx.registers.zf]:
+            self.assertEqual(ctx.getConcreteRegisterValue(reg), ref.getConcreteRegisterValue(reg))
+        self.assertEqual(ctx.getConcreteMemoryAreaValue(base, size), ref.getConcreteMemoryAreaValue(base, size))
+        for addr in range(base, base + size):
+            self.assertEqual(ctx.isMemorySymbolized(addr), ref.isMemorySymbolized(addr))
+
+    def test_rep_movsb(self):
+        ref, expected = self.run_string(False, b"\xf3\xa4", self.setup_copy)
+        ctx, iterations = self.run_string(True, b"\xf3\xa4", self.setup_copy)
+        self.assertEqual(expected, 0x40)
+        self.assertEqual(iterations, 1)
+        self.assertSameState(ref, ctx, 0x3000, 0x40)
+        self.assertTrue(ctx.isMemorySymbolized(0x3005))
+        # The expression of the source cell is shared with the destination
+        self.assertEqual(ctx.getSymbolicMemory(0x3005).getId(), ctx.getSymbolicMemory(0x2005).getId())
+        return
+
+    def test_rep_movsb_overlap(self):
+        def setup(ctx):
+            self.setup_copy(ctx)
+            ctx.setConcreteRegisterValue(ctx.registers.rdi, 0x2001)
+        ref, _ = self.run_string(False, b"\xf3\xa4", setup)
+        ctx, iterations = self.run_string(True, b"\xf3\xa4", setup)
+        # The copy replicates the first byte, it is executed one iteration at a time
+        self.assertEqual(iterations, 0x40)
+        self.assertSameState(ref, ctx, 0x2000, 0x41)
+        return
+
+    def test_rep_stosq(self):
+        ref, expected = self.run_string(False, b"\xf3\x48\xab", self.setup_fill)
+        ctx, iterations = self.run_string(True, b"\xf3\x48\xab", self.setup_fill)
+        self.assertEqual(expected, 0x10)
+        self.assertEqual(iterations, 1)
+        self.assertSameState(ref, ctx, 0x3000 - 0x78, 0x80)
+        self.assertTrue(ctx.isMemorySymbolized(MemoryAccess(0x3000 - 0x78, CPUSIZE.QWORD)))
+        return
+
+    def test_repne_scasb(self):
+        ref, expected = self.run_string(False, b"\xf2\xae", self.setup_scan)
+        ctx, iterations = self.run_string(True, b"\xf2\xae", self.setup_scan)
+        self.assertEqual(expected, 12)
+        self.assertEqual(iterations, 1)
+        self.assertSameState(ref, ctx, 0x2000, 12)
+        self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.rcx), 0xffffffffffffffff - 12)
+        return
+
+    def test_repne_scasb_symbolic(self):
+        def setup(ctx):
+            self.setup_scan(ctx)
+            ctx.symbolizeMemory(MemoryAccess(0x2004, CPUSIZE.BYTE))
+        ref, _ = self.run_string(False, b"\xf2\xae", setup)
+        ctx, iterations = self.run_string(True, b"\xf2\xae", setup)
+        # The iteration reading the symbolic cell is executed as usual, the next ones are skipped again
+        self.assertEqual(iterations, 2)
+        self.assertSameState(ref, ctx, 0x2000, 12)
+        self.assertEqual(len(ctx.getPathConstraints()), len(ref.getPathConstraints()))
+        return
+
+
+class TestRegisterAstCache(unittest.TestCase):
+
+    """Testing the reuse of register ASTs."""
+
+    def setUp(self):
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ctx.symbolizeRegister(self.ctx.registers.rax)
+
+
+    def test_unchanged_register(self):
+        eax1 = self.ctx.getRegisterAst(self.ctx.registers.eax)
+        eax2 = self.ctx.getRegisterAst(self.ctx.registers.eax)
+        al   = self.ctx.getRegisterAst(self.ctx.registers.al)
+        self.assertEqual(hash(eax1), hash(eax2))
+        self.assertEqual(al.getBitvectorSize(), 8)
+
+        rbx1 = self.ctx.getRegisterAst(self.ctx.registers.rbx)
+        rbx2 = self.ctx.getRegisterAst(self.ctx.registers.rbx)
+        self.assertEqual(hash(rbx1), hash(rbx2))
+        return
+
+
+    def test_written_register(self):
+        eax1 = self.ctx.getRegisterAst(self.ctx.registers.eax)
+        self.ctx.processing(Instruction(b"\x48\xff\xc0")) # inc rax
+        eax2 = self.ctx.getRegisterAst(self.ctx.registers.eax)
+        self.assertNotEqual(hash(eax1), hash(eax2))
+        self.assertEqual(eax2.evaluate(), 1)
+
+        # A concrete write is seen by the next read
+        rbx1 = self.ctx.getRegisterAst(self.ctx.registers.rbx)
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rbx, 0x1234)
+        rbx2 = self.ctx.getRegisterAst(self.ctx.registers.rbx)
+        self.assertEqual(rbx1.evaluate(), 0)
+        self.assertEqual(rbx2.evaluate(), 0x1234)
+        return
+
+
+class TestSharedConstants(unittest.TestCase):
+
+    """Testing the shared constant nodes."""
+
+    def setUp(self):
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ast = self.ctx.getAstContext()
+
+
+    def test_shared(self):
+        self.assertEqual(hash(self.ast.bv(1, 1)), hash(self.ast.bv(1, 1)))
+        self.assertEqual(hash(self.ast.bv(0x12, 8)), hash(self.ast.bv(0x112, 8)))
+        self.assertEqual(hash(self.ast.bv(0x123456789, 64)), hash(self.ast.bv(0x123456789, 64)))
+        self.assertNotEqual(hash(self.ast.bv(1, 8)), hash(self.ast.bv(1, 16)))
+        self.assertTrue(self.ast.bv(1, 1).isFrozen())
+        return
+
+
+    def test_expression_of_a_constant(self):
+        self.ctx.processing(Instruction(b"\x48\xc7\xc0\x05\x00\x00\x00")) # mov rax, 5
+        self.ctx.processing(Instruction(b"\x48\xff\xc0"))                 # inc rax
+        rax = self.ctx.getSymbolicRegister(self.ctx.registers.rax)
+        self.assertEqual(rax.getAst().evaluate(), 6)
+
+        # The references to a constant expression follow its new AST
+        var = self.ctx.symbolizeExpression(0, 64)
+        self.assertTrue(rax.getAst().isSymbolized())
+        self.ctx.setConcreteVariableValue(var, 10)
+        self.assertEqual(rax.getAst().evaluate(), 11)
+        return
+
+
+class TestMemoryArray(unittest.TestCase):
+
+    """Testing MEMORY_ARRAY."""
+
+    def run_lookup(self, array, code):
+        ctx = TritonContext(ARCH.X86_64)
+        ctx.setMode(MODE.AST_ABSTRACT_DOMAIN, True)
+        ctx.setMode(MODE.MEMORY_ARRAY, array)
+        ctx.setConcreteMemoryAreaValue(0x2000, bytes([(i * 7 + 3) & 0xff for i in range(0x100)]))
+        ctx.setConcreteMemoryValue(0x1000, 0x10)
+        ctx.setConcreteRegisterValue(ctx.registers.rdi, 0x1000)
+        ctx.symbolizeMemory(MemoryAccess(0x1000, CPUSIZE.BYTE))
+        for opcode in code:
+            self.assertTrue(ctx.processing(Instruction(opcode)))
+        return ctx
+
+    def test_concretized_lookup(self):
+        ctx = self.run_lookup(False, [b"\x0f\xb6\x07", b"\x0f\xb6\x80\x00\x20\x00\x00"]) # movzx eax, byte ptr [rdi]; movzx eax, byte ptr [rax + 0x2000]
+        self.assertFalse(ctx.isRegisterSymbolized(ctx.registers.eax))
+        self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.eax), 0x73)
+
+    def test_symbolic_lookup(self):
+        ctx = self.run_lookup(True, [b"\x0f\xb6\x07", b"\x0f\xb6\x80\x00\x20\x00\x00"]) # movzx eax, byte ptr [rdi]; movzx eax, byte ptr [rax + 0x2000]
+        eax = ctx.getRegisterAst(ctx.registers.eax)
+        self.assertTrue(eax.isSymbolized())
+        self.assertEqual(eax.evaluate(), 0x73)
+
+        # The input whose entry of the table is 0x2a
+        model = ctx.getModel(eax == 0x2a)
+        self.assertEqual(len(model), 1)
+        value = list(model.values())[0].getValue()
+        self.assertEqual((value * 7 + 3) & 0xff, 0x2a)
+
+    def test_symbolic_store(self):
+        ctx = self.run_lookup(True, [
+            b"\x0f\xb6\x07",                     # movzx eax, byte ptr [rdi]
+            b"\xc6\x80\x00\x20\x00\x00\x99",     # mov byte ptr [rax + 0x2000], 0x99
+            b"\x0f\xb6\x88\x00\x20\x00\x00",     # movzx ecx, byte ptr [rax + 0x2000]
+            b"\x0f\xb6\x90\x01\x20\x00\x00",     # movzx edx, byte ptr [rax + 0x2001]
+        ])
+        ecx = ctx.getRegisterAst(ctx.registers.ecx)
+        edx = ctx.getRegisterAst(ctx.registers.edx)
+        self.assertEqual(ecx.evaluate(), 0x99)
+        self.assertEqual(ctx.getConcreteMemoryValue(0x2010), 0x99)
+
+        # Whatever the input is, the load reads the byte stored at the same address, and the next one is the table
+        self.assertFalse(ctx.isSat(ecx != 0x99))
+        self.assertTrue(ctx.isSat(edx == 0x7a))
+
+
+class TestPointerPolicy(unittest.TestCase):
+
+    """Testing the policies of the dereferences of symbolic addresses."""
+
+    def run_lookup(self, policy, limits=None):
+        ctx = TritonContext(ARCH.X86_64)
+        ctx.setMode(MODE.AST_ABSTRACT_DOMAIN, True)
+        ctx.setPointerPolicy(policy)
+        if limits:
+            ctx.setPointerPolicyLimits(*limits)
+        ctx.setConcreteMemoryAreaValue(0x2000, bytes([(i * 7 + 3) & 0xff for i in range(0x100)]))
+        ctx.setConcreteMemoryValue(0x1000, 0x10)
+        ctx.setConcreteRegisterValue(ctx.registers.rdi, 0x1000)
+        ctx.symbolizeMemory(MemoryAccess(0x1000, CPUSIZE.BYTE))
+        self.assertTrue(ctx.processing(Instruction(0x400000, b"\x0f\xb6\x07")))                 # movzx eax, byte ptr [rdi]
+        self.assertTrue(ctx.processing(Instruction(0x400003, b"\x0f\xb6\x80\x00\x20\x00\x00"))) # movzx eax, byte ptr [rax + 0x2000]
+        return ctx
+
+    def test_concretize(self):
+        ctx = self.run_lookup(SYMBOLIC.CONCRETIZE_POINTER)
+        self.assertEqual(ctx.getPathPredicateSize(), 0)
+        self.assertEqual(ctx.getPointerStatistics()[0x400003]['concretized'], 1)
+        self.assertNotIn(0x400000, ctx.getPointerStatistics())
+
+    def test_constrain(self):
+        ctx = self.run_lookup(SYMBOLIC.CONSTRAIN_POINTER)
+        self.assertEqual(ctx.getPathPredicateSize(), 1)
+        self.assertEqual(ctx.getPointerStatistics()[0x400003]['constrained'], 1)
+
+        # The input is the one of the concrete address
+        model = ctx.getModel(ctx.getPathPredicate())
+        self.assertEqual(list(model.values())[0].getValue(), 0x10)
+
+    def test_fork(self):
+        ctx = self.run_lookup(SYMBOLIC.FORK_POINTER, (1024, 4))
+        branches = ctx.getPathConstraints()[0].getBranchConstraints()
+        self.assertEqual(len(branches), 4)
+        self.assertTrue(branches[0]['isTaken'])
+        self.assertEqual(ctx.getPointerStatistics()[0x400003]['branches'], 4)
+
+        # Each branch not taken is another address of the table
+        for branch in branches[1:]:
+            self.assertFalse(branch['isTaken'])
+            self.assertTrue(ctx.isSat(branch['constraint']))
+
+    def test_symbolic(self):
+        ctx = self.run_lookup(SYMBOLIC.SYMBOLIC_POINTER)
+        self.assertTrue(ctx.isRegisterSymbolized(ctx.registers.eax))
+        self.assertEqual(ctx.getPathPredicateSize(), 0)
+        self.assertEqual(ctx.getPointerStatistics()[0x400003]['symbolic'], 1)
+
+    def test_symbolic_fallback(self):
+        ctx = self.run_lookup(SYMBOLIC.SYMBOLIC_POINTER, (16, 8))
+        self.assertFalse(ctx.isRegisterSymbolized(ctx.registers.eax))
+        self.assertEqual(ctx.getPathPredicateSize(), 1)
+        self.assertEqual(ctx.getPointerStatistics()[0x400003]['fallbacks'], 1)
+
+    def test_site_policy(self):
+        ctx = TritonContext(ARCH.X86_64)
+        ctx.setPointerPolicy(SYMBOLIC.CONSTRAIN_POINTER, 0x400003)
+        self.assertEqual(ctx.getPointerPolicy(0x400003), SYMBOLIC.CONSTRAIN_POINTER)
+        self.assertEqual(ctx.getPointerPolicy(0x400000), SYMBOLIC.CONCRETIZE_POINTER)
+        self.assertEqual(ctx.getPointerPolicy(), SYMBOLIC.CONCRETIZE_POINTER)
+
+
+class TestLoopInductionVariables(unittest.TestCase):
+
+    """Testing LOOP_INDUCTION_VARIABLES."""
+
+    code = b"\x48\xff\xc1"      # inc rcx
+    code += b"\x48\x39\xd1"     # cmp rcx, rdx
+    code += b"\x72\xf8"         # jb 0x1000
+
+    def run_loop(self, induction, symbolic=False):
+        ctx = TritonContext(ARCH.X86_64)
+        ctx.setMode(MODE.LOOP_INDUCTION_VARIABLES, induction)
+        ctx.setMode(MODE.PC_LOOP_SUMMARIZATION, True)
+        ctx.setConcreteMemoryAreaValue(0x1000, self.code)
+        ctx.setConcreteRegisterValue(ctx.registers.rdx, 10)
+        variables = [ctx.symbolizeRegister(ctx.registers.rdx)]
+        if symbolic:
+            variables.append(ctx.symbolizeRegister(ctx.registers.rcx))
+
+        nxt = 0x1000
+        while nxt == 0x1000:
+            _, nxt = ctx.processBlock(0x1000)
+        self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.rcx), 10)
+        return ctx, variables
+
+    def test_chain(self):
+        ref, _ = self.run_loop(False)
+        ctx, _ = self.run_loop(True)
+        chain = ref.sliceExpressions(ref.getSymbolicRegister(ref.registers.rcx))
+        collapsed = ctx.sliceExpressions(ctx.getSymbolicRegister(ctx.registers.rcx))
+        self.assertEqual(len(chain), 10)
+        self.assertEqual(len(collapsed), 2)
+        self.assertEqual(ctx.getRegisterAst(ctx.registers.rcx).evaluate(), 10)
+
+    def test_closed_form(self):
+        for induction in [False, True]:
+            ctx, variables = self.run_loop(induction)
+            pcs = ctx.getPathConstraints()
+            self.assertEqual(len(pcs), 3)
+            self.assertEqual(len(pcs[0].getIterations()), 8)
+            # The bound is greater than the last counter summarized, thus than the others
+            closed = str(pcs[0].getTakenPredicate()) == str(pcs[0].getIterations()[-1])
+            self.assertEqual(closed, induction)
+            self.assertEqual(ctx.getModel(ctx.getPathPredicate())[variables[0].getId()].getValue(), 10)
+
+    def test_symbolic_counter(self):
+        ctx, variables = self.run_loop(True, True)
+        model = ctx.getModel(ctx.getPathPredicate())
+        rdx, rcx = [model[v.getId()].getValue() for v in variables]
+        # The loop runs ten times whatever the counter starts at
+        self.assertEqual((rdx - rcx) % 2**64, 10)
+        self.assertEqual(ctx.getPathConstraints()[0].getTakenPredicate().getType(), AST_NODE.LAND)
+
+
+class TestAstDepthLimit(unittest.TestCase):
+
+    """Testing AST_DEPTH_LIMIT."""
+
+    def run_adds(self, policy):
+        ctx = TritonContext(ARCH.X86_64)
+        ctx.setMode(MODE.AST_DEPTH_LIMIT, True)
+        ctx.setSymbolicDepthLimit(16, policy)
+        ctx.setConcreteRegisterValue(ctx.registers.rbx, 3)
+        ctx.symbolizeRegister(ctx.registers.rbx)
+        for _ in range(64):
+            ctx.processing(Instruction(b"\x48\x01\xd8")) # add rax, rbx
+        expr = ctx.getSymbolicRegister(ctx.registers.rax)
+        self.assertLessEqual(expr.getAst().getLevel(), 16)
+        self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.rax), 192)
+        self.assertEqual(ctx.getRegisterAst(ctx.registers.rax).evaluate(), 192)
+        return ctx
+
+    def test_limit(self):
+        ctx = TritonContext(ARCH.X86_64)
+        self.assertEqual(ctx.getSymbolicDepthLimit(), 4096)
+        self.assertEqual(ctx.getSymbolicDepthPolicy(), SYMBOLIC.CONCRETIZE_DEEP_EXPRESSION)
+        with self.assertRaises(Exception):
+            ctx.setSymbolicDepthLimit(0)
+
+    def test_concretize(self):
+        ctx = self.run_adds(SYMBOLIC.CONCRETIZE_DEEP_EXPRESSION)
+        self.assertEqual(len(ctx.getSymbolicVariables()), 1)
+
+    def test_symbolize(self):
+        ctx = self.run_adds(SYMBOLIC.SYMBOLIZE_DEEP_EXPRESSION)
+        # The deep ASTs are replaced by fresh variables, the last one still reaches rbx
+        self.assertGreater(len(ctx.getSymbolicVariables()), 1)
+        self.assertTrue(ctx.getRegisterAst(ctx.registers.rax).isSymbolized())
+
+
+class TestComments(unittest.TestCase):
+
+    """Testing INTERNED_COMMENTS and NO_COMMENTS."""
+
+    def run_trace(self, mode):
+        ctx = TritonContext(ARCH.X86_64)
+        if mode is not None:
+            ctx.setMode(mode, True)
+        ctx.symbolizeRegister(ctx.registers.rbx)
+        comments = list()
+        for _ in range(2):
+            inst = Instruction(0x1000, b"\x48\x01\xd8") # add rax, rbx
+            ctx.processing(inst)
+            comments.append([e.getComment() for e in inst.getSymbolicExpressions()])
+            inst = Instruction(0x1003, b"\x48\x89\x04\x24") # mov [rsp], rax
+            ctx.processing(inst)
+            comments.append([e.getComment() for e in inst.getSymbolicExpressions()])
+        return comments
+
+    def test_interned(self):
+        ref = self.run_trace(None)
+        self.assertEqual(ref[0][0], "ADD operation - 0x1000: add rax, rbx")
+        self.assertEqual(self.run_trace(MODE.INTERNED_COMMENTS), ref)
+
+    def test_none(self):
+        for comments in self.run_trace(MODE.NO_COMMENTS):
+            self.assertTrue(all(c == "" for c in comments))
+
+
+class TestConcreteConditions(unittest.TestCase):
+
+    """Testing the predicated semantics with a concrete condition."""
+
+    def test_cmov(self):
+        ctx = TritonContext(ARCH.X86_64)
+        ctx.symbolizeRegister(ctx.registers.rbx)
+        inst = Instruction(b"\x48\x0f\x44\xc3") # cmove rax, rbx
+        ctx.processing(inst)
+        self.assertNotEqual(inst.getSymbolicExpressions()[0].getAst().getType(), AST.ITE)
+        self.assertFalse(ctx.isRegisterSymbolized(ctx.registers.rax))
+
+        ctx.symbolizeRegister(ctx.registers.zf)
+        inst = Instruction(b"\x48\x0f\x44\xc3") # cmove rax, rbx
+        ctx.processing(inst)
+        self.assertEqual(inst.getSymbolicExpressions()[0].getAst().getType(), AST.ITE)
+
+    def test_setcc(self):
+        ctx = TritonContext(ARCH.X86_64)
+        ctx.setConcreteRegisterValue(ctx.registers.zf, 1)
+        inst = Instruction(b"\x0f\x94\xc0") # sete al
+        ctx.processing(inst)
+        self.assertNotEqual(inst.getSymbolicExpressions()[0].getAst().getType(), AST.ITE)
+        self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.al), 1)
+
+    def test_csel(self):
+        ctx = TritonContext(ARCH.AARCH64)
+        ctx.setConcreteRegisterValue(ctx.registers.x1, 1)
+        ctx.setConcreteRegisterValue(ctx.registers.x2, 2)
+        inst = Instruction(b"\x20\x00\x82\x9a") # csel x0, x1, x2, eq
+        ctx.processing(inst)
+        self.assertNotEqual(inst.getSymbolicExpressions()[0].getAst().getType(), AST.ITE)
+        self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.x0), 2)
+
+        # The conditional branches keep both targets
+        ctx.processing(Instruction(0x1000, b"\x40\x00\x00\x54")) # b.eq 0x1008
+        self.assertTrue(ctx.getPathConstraints()[-1].isMultipleBranches())
+
+
+class TestMemoryRanges(unittest.TestCase):
+
+    """Testing the multiple transfers stored and loaded as one memory range."""
+
+    def setUp(self):
+        self.ctx = TritonContext(ARCH.ARM32)
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.r0, 0x11111111)
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.r1, 0x22222222)
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.r2, 0x33333333)
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.sp, 0x1000)
+        self.ctx.symbolizeRegister(self.ctx.registers.r2)
+
+    def test_push_pop(self):
+        ctx = self.ctx
+        ctx.processing(Instruction(0x100, b"\x07\x00\x2d\xe9")) # push {r0, r1, r2}
+        self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.sp), 0xff4)
+        self.assertEqual(ctx.getConcreteMemoryValue(MemoryAccess(0xff4, CPUSIZE.DWORD)), 0x11111111)
+        self.assertEqual(ctx.getConcreteMemoryValue(MemoryAccess(0xff8, CPUSIZE.DWORD)), 0x22222222)
+        self.assertEqual(ctx.getConcreteMemoryValue(MemoryAccess(0xffc, CPUSIZE.DWORD)), 0x33333333)
+        self.assertFalse(ctx.isMemorySymbolized(MemoryAccess(0xff4, CPUSIZE.QWORD)))
+        self.assertTrue(ctx.isMemorySymbolized(MemoryAccess(0xffc, CPUSIZE.DWORD)))
+
+        ctx.setConcreteRegisterValue(ctx.registers.r0, 0)
+        ctx.setConcreteRegisterValue(ctx.registers.r1, 0)
+        ctx.concretizeRegister(ctx.registers.r2)
+        ctx.processing(Instruction(0x104, b"\x07\x00\xbd\xe8")) # pop {r0, r1, r2}
+        self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.sp), 0x1000)
+        self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.r0), 0x11111111)
+        self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.r1), 0x22222222)
+        self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.r2), 0x33333333)
+        self.assertTrue(ctx.isRegisterSymbolized(ctx.registers.r2))
+
+    def test_stm_not_taken(self):
+        ctx = self.ctx
+        ctx.setConcreteRegisterValue(ctx.registers.r3, 0x2000)
+        ctx.setConcreteMemoryValue(MemoryAccess(0x2000, CPUSIZE.QWORD), 0x4444444455555555)
+        inst = Instruction(0x100, b"\x03\x00\x83\x08") # stmeq r3, {r0, r1}
+        ctx.processing(inst)
+        self.assertFalse(inst.isConditionTaken())
+        self.assertEqual(ctx.getConcreteMemoryValue(MemoryAccess(0x2000, CPUSIZE.QWORD)), 0x4444444455555555)
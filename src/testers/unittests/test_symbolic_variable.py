@@ -73,6 +73,17 @@ class TestSymbolicVariable(unittest.TestCase):
         self.assertEqual(str(self.v2), "v2:32")
         self.assertEqual(self.v2.getId(), 2)
 
+    def test_lookup(self):
+        """Test lookups by name and by alias"""
+        self.assertEqual(self.ctx.getSymbolicVariable("SymVar_1").getId(), 1)
+        self.assertEqual(self.ctx.getSymbolicVariable("v3").getId(), 3)
+        self.assertEqual(self.ctx.getAstContext().variable(self.v1).evaluate(), 0)
+        self.ctx.setConcreteVariableValue(self.v1, 0x1234)
+        self.assertEqual(self.ctx.getAstContext().variable(self.v1).evaluate(), 0x1234)
+        for name in ["SymVar_01", "SymVar_", "SymVar_9"]:
+            with self.assertRaises(Exception):
+                self.ctx.getSymbolicVariable(name)
+
     def test_model_with_alias(self):
         var = self.ctx.symbolizeRegister(self.ctx.registers.rax)
         var.setAlias("rax")
@@ -98,6 +109,25 @@ class TestSymbolicVariable(unittest.TestCase):
         self.assertEqual(str(model[4].getVariable().getAlias()), "")
         self.assertEqual(model[4].getVariable().getId(), 4)
 
+    def test_apply_model(self):
+        ctx = TritonContext(ARCH.X86_64)
+        ctx.symbolizeRegister(ctx.registers.rax)
+        ctx.symbolizeRegister(ctx.registers.rbx)
+        ctx.processing(Instruction(b"\x48\x01\xd8")) # add rax, rbx
+
+        ast = ctx.getAstContext()
+        rax_ast = ctx.getRegisterAst(ctx.registers.rax)
+        model = ctx.getModel(ast.land([rax_ast == 0x1234, ctx.getRegisterAst(ctx.registers.rbx) == 0x34]))
+        self.assertEqual(len(model), 2)
+
+        ctx.applyModel(model)
+        self.assertEqual(rax_ast.evaluate(), 0x1234)
+        self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.rbx), 0x34)
+        self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.rax), 0x1200)
+
+        with self.assertRaises(TypeError):
+            ctx.applyModel([1])
+
     def test_concrete_value1(self):
         ctx = TritonContext(ARCH.X86_64)
         ctx.setConcreteRegisterValue(ctx.registers.rax, 0x1122334455667788)
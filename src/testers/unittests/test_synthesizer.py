@@ -2,8 +2,10 @@
 # coding: utf-8
 """Test synthesizing."""
 
-import unittest
+import os
 import random
+import tempfile
+import unittest
 
 from triton import *
 
@@ -63,6 +65,20 @@ class TestSynth_1(unittest.TestCase):
         for org, obfu in self.obf_exprs:
             self.assertEqual(str(self.ctx.synthesize(obfu, constant=True, subexpr=True, opaque=True)), org)
 
+    def test_parallel(self):
+        for org, obfu in self.obf_exprs:
+            self.ctx.clearSynthesisCache()
+            self.assertEqual(str(self.ctx.synthesize(obfu, constant=True, subexpr=True, opaque=True, parallel=True)), org)
+
+    def test_enumerative(self):
+        x = self.ast.variable(self.ctx.newSymbolicVariable(32, 'a'))
+        y = self.ast.variable(self.ctx.newSymbolicVariable(32, 'b'))
+        z = self.ast.variable(self.ctx.newSymbolicVariable(32, 'd'))
+        # Terms of several operators, found in the bank of terms
+        self.assertEqual(str(self.ctx.synthesize(((x | y) - (x ^ y)) + z)), '((d + (a & b)) & 0xffffffff)')
+        self.assertEqual(str(self.ctx.synthesize((x ^ z) + 2 * (x & z) - y)), '((a + ((d - b) & 0xffffffff)) & 0xffffffff)')
+        self.assertIsNone(self.ctx.synthesize((x + y) * (x * x + z)))
+
 
 class TestSynth_2(unittest.TestCase):
     def setUp(self):
@@ -105,3 +121,33 @@ class TestSynth_2(unittest.TestCase):
         ast = self.ctx.getAstContext()
         res = str(ast.unroll(self.ctx.synthesize(eax, constant=False, subexpr=True)))
         self.assertLessEqual(res, "(bvadd (bvadd a (bvmul (bvmul a b) b)) (_ bv1 32))")
+
+
+class TestSynthCache(unittest.TestCase):
+    def test_cache(self):
+        path = os.path.join(tempfile.mkdtemp(), 'synth.cache')
+
+        ctx = TritonContext(ARCH.X86_64)
+        ast = ctx.getAstContext()
+        x = ast.variable(ctx.newSymbolicVariable(8))
+        y = ast.variable(ctx.newSymbolicVariable(8))
+        self.assertEqual(ctx.synthesize((x ^ y) + 2 * (x & y)).getType(), AST_NODE.BVADD)
+        self.assertNotEqual(ctx.getSynthesisCacheSize(), 0)
+        ctx.saveSynthesisCache(path)
+
+        # The nodes are looked up whatever their variables are
+        ctx2 = TritonContext(ARCH.X86_64)
+        ast2 = ctx2.getAstContext()
+        a = ast2.variable(ctx2.newSymbolicVariable(32))
+        b = ast2.variable(ctx2.newSymbolicVariable(8))
+        c = ast2.variable(ctx2.newSymbolicVariable(8))
+        ctx2.loadSynthesisCache(path)
+        self.assertEqual(ctx2.getSynthesisCacheSize(), ctx.getSynthesisCacheSize())
+        out = ctx2.synthesize((b ^ c) + 2 * (b & c))
+        self.assertEqual(out.getType(), AST_NODE.BVADD)
+        self.assertEqual(len(ctx2.getModel(out != b + c)), 0)
+
+        ctx2.clearSynthesisCache()
+        self.assertEqual(ctx2.getSynthesisCacheSize(), 0)
+        with self.assertRaises(TypeError):
+            ctx2.loadSynthesisCache(os.path.join(os.path.dirname(path), 'missing'))
@@ -429,6 +429,130 @@ class TestTaint(unittest.TestCase):
         self.assertTrue(0x4003 in m)
         self.assertFalse(0x5000 in m)
 
+    def test_taint_get_tainted_expressions(self):
+        """Get tainted symbolic expressions"""
+        ctx = TritonContext()
+        ctx.setArchitecture(ARCH.X86_64)
+
+        self.assertEqual(len(ctx.getTaintedSymbolicExpressions()), 0)
+
+        ctx.taintRegister(ctx.registers.rax)
+        ctx.processing(Instruction(b"\x48\x89\xc3")) # mov rbx, rax
+        ctx.processing(Instruction(b"\x48\x89\xd1")) # mov rcx, rdx
+        tainted = [e.getId() for e in ctx.getTaintedSymbolicExpressions()]
+        self.assertIn(ctx.getSymbolicRegister(ctx.registers.rbx).getId(), tainted)
+        self.assertNotIn(ctx.getSymbolicRegister(ctx.registers.rcx).getId(), tainted)
+
+        # Untainted since, it is dropped from the result
+        ctx.processing(Instruction(b"\x48\xc7\xc3\x00\x00\x00\x00")) # mov rbx, 0
+        ctx.processing(Instruction(b"\x48\x89\xd8")) # mov rax, rbx
+        self.assertFalse(ctx.isRegisterTainted(ctx.registers.rax))
+        for e in ctx.getTaintedSymbolicExpressions():
+            self.assertTrue(e.isTainted())
+
+    def test_taint_memory_across_pages(self):
+        """Taint memory ranges crossing a page boundary"""
+        Triton = TritonContext()
+        Triton.setArchitecture(ARCH.X86_64)
+
+        Triton.taintMemory(MemoryAccess(0x1ffc, 8))
+        self.assertEqual(sorted(Triton.getTaintedMemory()), list(range(0x1ffc, 0x2004)))
+        self.assertFalse(Triton.isMemoryTainted(MemoryAccess(0x1fdc, 32)))
+        self.assertTrue(Triton.isMemoryTainted(MemoryAccess(0x1fdd, 32)))
+        self.assertTrue(Triton.isMemoryTainted(MemoryAccess(0x2003, 32)))
+        self.assertFalse(Triton.isMemoryTainted(MemoryAccess(0x2004, 32)))
+
+        Triton.untaintMemory(MemoryAccess(0x1ffe, 4))
+        self.assertEqual(sorted(Triton.getTaintedMemory()), [0x1ffc, 0x1ffd, 0x2002, 0x2003])
+        self.assertFalse(Triton.isMemoryTainted(MemoryAccess(0x1ffe, 4)))
+
+        Triton.untaintMemory(MemoryAccess(0x1ffc, 8))
+        self.assertEqual(len(Triton.getTaintedMemory()), 0)
+
+    def test_taint_labels(self):
+        """Spread taint labels"""
+        Triton = TritonContext()
+        Triton.setArchitecture(ARCH.X86_64)
+
+        Triton.taintRegister(Triton.registers.rax, 0)
+        Triton.taintMemory(0x1000, 1)
+        Triton.taintMemory(MemoryAccess(0x2000, 8), 100)
+        self.assertEqual(Triton.getRegisterTaintLabels(Triton.registers.eax), [0])
+        self.assertEqual(Triton.getMemoryTaintLabels(0x1000), [1])
+        self.assertEqual(Triton.getMemoryTaintLabels(MemoryAccess(0x2000, 8)), [100])
+
+        # An assignment replaces the labels, an union merges them
+        Triton.taintAssignment(Triton.registers.rbx, Triton.registers.rax)
+        self.assertEqual(Triton.getRegisterTaintLabels(Triton.registers.rbx), [0])
+        Triton.taintUnion(Triton.registers.rbx, MemoryAccess(0x1000, 1))
+        Triton.taintUnion(Triton.registers.rbx, MemoryAccess(0x2000, 8))
+        self.assertEqual(Triton.getRegisterTaintLabels(Triton.registers.rbx), [0, 1, 100])
+
+        Triton.taintAssignment(MemoryAccess(0x3000, 8), Triton.registers.rbx)
+        self.assertEqual(Triton.getMemoryTaintLabels(MemoryAccess(0x3000, 8)), [0, 1, 100])
+        Triton.taintAssignment(MemoryAccess(0x1000, 1), MemoryAccess(0x2000, 1))
+        self.assertEqual(Triton.getMemoryTaintLabels(0x1000), [100])
+
+        # Untainting an item removes its labels
+        Triton.taintAssignment(Triton.registers.rbx, Triton.registers.rcx)
+        self.assertFalse(Triton.isRegisterTainted(Triton.registers.rbx))
+        self.assertEqual(Triton.getRegisterTaintLabels(Triton.registers.rbx), [])
+        Triton.untaintMemory(MemoryAccess(0x3000, 8))
+        self.assertEqual(Triton.getMemoryTaintLabels(MemoryAccess(0x3000, 8)), [])
+
+        # An unlabeled taint has no label
+        Triton.taintMemory(0x4000)
+        self.assertTrue(Triton.isMemoryTainted(0x4000))
+        self.assertEqual(Triton.getMemoryTaintLabels(0x4000), [])
+
+    def test_taint_summaries(self):
+        """Spread the taint from summaries as the semantics do"""
+        code = [
+            b"\x48\x89\xc3",             # mov    rbx, rax
+            b"\x48\x01\xd9",             # add    rcx, rbx
+            b"\x48\x83\xf9\x05",         # cmp    rcx, 5
+            b"\x48\x8d\x14\x71",         # lea    rdx, [rcx+rsi*2]
+            b"\x52",                     # push   rdx
+            b"\x5f",                     # pop    rdi
+            b"\x48\x31\xdb",             # xor    rbx, rbx
+            b"\x48\x89\x4c\x24\xf0",     # mov    [rsp-0x10], rcx
+            b"\x0f\xb6\x44\x24\xf0",     # movzx  eax, byte ptr [rsp-0x10]
+            b"\x85\xc0",                 # test   eax, eax
+            b"\x48\xff\xc6",             # inc    rsi
+            b"\x49\x11\xf8",             # adc    r8, rdi
+            b"\x49\xd1\xe1",             # shl    r9, 1 (no summary)
+        ]
+
+        contexts = list()
+        for mode in [False, True]:
+            ctx = TritonContext()
+            ctx.setArchitecture(ARCH.X86_64)
+            ctx.enableSymbolicEngine(False)
+            ctx.setMode(MODE.TAINT_SUMMARIES, mode)
+            ctx.setConcreteRegisterValue(ctx.registers.rsp, 0x7fff0000)
+            ctx.taintRegister(ctx.registers.rax)
+            contexts.append(ctx)
+
+        semantics, summaries = contexts
+        pc = 0x1000
+        for opcode in code:
+            # A summary does not update the concrete state, it is synchronized as a tracer does
+            for reg in semantics.getParentRegisters():
+                summaries.setConcreteRegisterValue(reg, semantics.getConcreteRegisterValue(reg))
+
+            for ctx in contexts:
+                inst = Instruction(pc, opcode)
+                self.assertTrue(ctx.processing(inst))
+
+            pc += len(opcode)
+            self.assertEqual(sorted(r.getName() for r in semantics.getTaintedRegisters()),
+                             sorted(r.getName() for r in summaries.getTaintedRegisters()))
+            self.assertEqual(sorted(semantics.getTaintedMemory()), sorted(summaries.getTaintedMemory()))
+
+        self.assertFalse(summaries.isRegisterTainted(summaries.registers.rbx))
+        self.assertTrue(summaries.isRegisterTainted(summaries.registers.rdi))
+        self.assertTrue(summaries.isMemoryTainted(MemoryAccess(0x7fff0000 - 0x10, 8)))
+
     def test_taint_set_register(self):
         """Set taint register"""
         Triton = TritonContext()
@@ -691,3 +815,56 @@ class TestTaint(unittest.TestCase):
         ctx.processing(inst)
 
         self.assertTrue(ctx.isRegisterTainted(ctx.registers.rbx))
+
+    def test_taint_bit_precise(self):
+        ctx = TritonContext()
+        ctx.setArchitecture(ARCH.X86_64)
+        ctx.setMode(MODE.TAINT_BIT_PRECISE, True)
+
+        # Only the bits of a sub-register are tainted
+        ctx.taintRegister(ctx.registers.ah)
+        self.assertEqual(ctx.getRegisterTaintBits(ctx.registers.rax), 0xff00)
+        self.assertFalse(ctx.isRegisterTainted(ctx.registers.al))
+        self.assertTrue(ctx.isRegisterTainted(ctx.registers.ax))
+
+        # The tainted bits are cleared by an untainted mask
+        ctx.processing(Instruction(b"\x25\xff\x00\x00\x00")) # and eax, 0xff
+        self.assertFalse(ctx.isRegisterTainted(ctx.registers.rax))
+
+        # The tainted bits are shifted out
+        ctx.taintRegister(ctx.registers.al)
+        ctx.processing(Instruction(b"\x48\xc1\xe8\x04")) # shr rax, 4
+        self.assertEqual(ctx.getRegisterTaintBits(ctx.registers.rax), 0xf)
+        ctx.processing(Instruction(b"\x48\xc1\xe8\x38")) # shr rax, 56
+        self.assertFalse(ctx.isRegisterTainted(ctx.registers.rax))
+
+        # The bits shifted in take the taint of the sign bit
+        ctx.setRegisterTaintBits(ctx.registers.rax, 1 << 63)
+        ctx.processing(Instruction(b"\x48\xc1\xf8\x08")) # sar rax, 8
+        self.assertEqual(ctx.getRegisterTaintBits(ctx.registers.rax), 0xff80000000000000)
+
+        # The tainted bits are set by an untainted operand
+        ctx.setRegisterTaintBits(ctx.registers.rax, 0x1)
+        ctx.processing(Instruction(b"\x0c\xff")) # or al, 0xff
+        self.assertFalse(ctx.isRegisterTainted(ctx.registers.rax))
+
+        # An extension copies the tainted bits
+        ctx.setRegisterTaintBits(ctx.registers.rax, 0x1)
+        ctx.processing(Instruction(b"\x0f\xb6\xd8")) # movzx ebx, al
+        self.assertEqual(ctx.getRegisterTaintBits(ctx.registers.rbx), 0x1)
+
+        # An arithmetic operation taints the whole destination
+        ctx.processing(Instruction(b"\x80\xc3\x01")) # add bl, 1
+        self.assertEqual(ctx.getRegisterTaintBits(ctx.registers.rbx), 0xff)
+
+        # Only the instructions the tainted bits reach are built
+        for mode in [False, True]:
+            ctx = TritonContext()
+            ctx.setArchitecture(ARCH.X86_64)
+            ctx.setMode(MODE.ONLY_ON_TAINTED, True)
+            ctx.setMode(MODE.TAINT_BIT_PRECISE, mode)
+            ctx.taintRegister(ctx.registers.ah)
+            inst = Instruction(b"\x25\xff\x00\x00\x00") # and eax, 0xff
+            ctx.processing(inst)
+            self.assertEqual(inst.isTainted(), not mode)
+            self.assertEqual(len(inst.getSymbolicExpressions()) == 0, mode)